@@ -32,6 +32,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -42,6 +43,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/visibility.h"
 
@@ -106,6 +108,33 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::RandomAccessFile> file_;
 };
 
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(io::OutputStream* output_stream)
+      : output_stream_(output_stream), length_(0) {}
+
+  uint64_t getLength() const override { return static_cast<uint64_t>(length_); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<int64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The Arrow stream is owned, and closed, by the caller
+  void close() override {}
+
+ private:
+  io::OutputStream* output_stream_;
+  int64_t length_;
+};
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -290,6 +319,110 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
   }
 
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<RecordBatch>* out) {
+    liborc::RowReaderOptions opts;
+    opts.include(std::list<std::string>(include_names.begin(), include_names.end()));
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+    return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+  }
+
+  Status ReadStripeStatistics(int64_t stripe,
+                              std::vector<std::shared_ptr<StripeColumnStatistics>>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    const liborc::Type& type = reader_->getType();
+    out->assign(type.getSubtypeCount(), nullptr);
+    std::unique_ptr<liborc::StripeStatistics> stripe_statistics;
+    try {
+      if (static_cast<uint64_t>(stripe) >= reader_->getNumberOfStripeStatistics()) {
+        // Statistics are optional in ORC files
+        return Status::OK();
+      }
+      stripe_statistics = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+
+    for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      const liborc::ColumnStatistics* column_statistics =
+          stripe_statistics->getColumnStatistics(
+              static_cast<uint32_t>(field_type->getColumnId()));
+      if (column_statistics == nullptr) continue;
+
+      std::shared_ptr<DataType> arrow_type;
+      RETURN_NOT_OK(GetArrowType(field_type, &arrow_type));
+      auto statistics = std::make_shared<StripeColumnStatistics>();
+      statistics->num_values =
+          static_cast<int64_t>(column_statistics->getNumberOfValues());
+      statistics->has_null = column_statistics->hasNull();
+      RETURN_NOT_OK(GetMinMax(*field_type, *column_statistics, arrow_type,
+                              &statistics->min, &statistics->max));
+      (*out)[i] = std::move(statistics);
+    }
+    return Status::OK();
+  }
+
+  // Convert the min/max values of ORC column statistics to Arrow scalars
+  static Status GetMinMax(const liborc::Type& type,
+                          const liborc::ColumnStatistics& statistics,
+                          const std::shared_ptr<DataType>& arrow_type,
+                          std::shared_ptr<Scalar>* min, std::shared_ptr<Scalar>* max) {
+    std::shared_ptr<Scalar> orc_min, orc_max;
+    switch (type.getKind()) {
+      case liborc::BYTE:
+      case liborc::SHORT:
+      case liborc::INT:
+      case liborc::LONG: {
+        auto stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(&statistics);
+        if (stats == nullptr || !stats->hasMinimum() || !stats->hasMaximum()) break;
+        orc_min = MakeScalar(stats->getMinimum());
+        orc_max = MakeScalar(stats->getMaximum());
+        break;
+      }
+      case liborc::FLOAT:
+      case liborc::DOUBLE: {
+        auto stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(&statistics);
+        if (stats == nullptr || !stats->hasMinimum() || !stats->hasMaximum()) break;
+        orc_min = MakeScalar(stats->getMinimum());
+        orc_max = MakeScalar(stats->getMaximum());
+        break;
+      }
+      case liborc::VARCHAR:
+      case liborc::STRING: {
+        auto stats = dynamic_cast<const liborc::StringColumnStatistics*>(&statistics);
+        if (stats == nullptr || !stats->hasMinimum() || !stats->hasMaximum()) break;
+        orc_min = std::make_shared<StringScalar>(stats->getMinimum());
+        orc_max = std::make_shared<StringScalar>(stats->getMaximum());
+        break;
+      }
+      case liborc::DATE: {
+        auto stats = dynamic_cast<const liborc::DateColumnStatistics*>(&statistics);
+        if (stats == nullptr || !stats->hasMinimum() || !stats->hasMaximum()) break;
+        orc_min = std::make_shared<Date32Scalar>(stats->getMinimum());
+        orc_max = std::make_shared<Date32Scalar>(stats->getMaximum());
+        break;
+      }
+      default:
+        break;
+    }
+    if (orc_min == nullptr) {
+      return Status::OK();
+    }
+    if (orc_min->type->Equals(*arrow_type)) {
+      *min = std::move(orc_min);
+      *max = std::move(orc_max);
+      return Status::OK();
+    }
+    // ORC widens the statistics of narrow types (e.g. int32 to int64)
+    ARROW_ASSIGN_OR_RAISE(*min, orc_min->CastTo(arrow_type));
+    ARROW_ASSIGN_OR_RAISE(*max, orc_max->CastTo(arrow_type));
+    return Status::OK();
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
                     Status::Invalid("Out of bounds stripe: ", stripe));
@@ -469,10 +602,152 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::ReadStripe(int64_t stripe,
+                                 const std::vector<std::string>& include_names,
+                                 std::shared_ptr<RecordBatch>* out) {
+  return impl_->ReadStripe(stripe, include_names, out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(
+    int64_t stripe, std::vector<std::shared_ptr<StripeColumnStatistics>>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORCFileWriter implementation
+
+namespace {
+
+Result<liborc::CompressionKind> GetOrcCompression(Compression::type compression) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      return liborc::CompressionKind_NONE;
+    case Compression::GZIP:
+      return liborc::CompressionKind_ZLIB;
+    case Compression::SNAPPY:
+      return liborc::CompressionKind_SNAPPY;
+    case Compression::LZO:
+      return liborc::CompressionKind_LZO;
+    case Compression::LZ4:
+      return liborc::CompressionKind_LZ4;
+    case Compression::ZSTD:
+      return liborc::CompressionKind_ZSTD;
+    default:
+      return Status::Invalid("Compression codec ", compression,
+                             " is not supported by ORC");
+  }
+}
+
+}  // namespace
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+              const WriteOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("ORC batch size must be positive, got ",
+                             options.batch_size);
+    }
+    schema_ = schema;
+    options_ = options;
+    ARROW_ASSIGN_OR_RAISE(orc_type_, GetOrcType(*schema));
+    ARROW_ASSIGN_OR_RAISE(auto compression, GetOrcCompression(options.compression));
+
+    liborc::WriterOptions orc_options;
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompression(compression);
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+    output_stream_.reset(new ArrowOutputStream(output_stream));
+    try {
+      writer_ = liborc::createWriter(*orc_type_, output_stream_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(options.batch_size));
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::TypeError("Cannot write a batch of schema ",
+                               batch.schema()->ToString(), " to an ORC file of schema ",
+                               schema_->ToString());
+    }
+    auto struct_batch = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+      // Columns fill distinct child batches, so they can be converted concurrently
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          options_.use_threads, batch.num_columns(), [&](int i) {
+            return WriteBatch(*batch.column(i)->Slice(offset, length),
+                              struct_batch->fields[i]);
+          }));
+      struct_batch->numElements = static_cast<uint64_t>(length);
+      struct_batch->hasNulls = false;
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  WriteOptions options_;
+  std::unique_ptr<liborc::Type> orc_type_;
+  std::unique_ptr<ArrowOutputStream> output_stream_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Result<std::unique_ptr<ORCFileWriter>> ORCFileWriter::Open(
+    const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+    const WriteOptions& options) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output_stream, options));
+  return std::move(result);
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
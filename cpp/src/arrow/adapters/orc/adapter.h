@@ -19,13 +19,18 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -34,6 +39,17 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level column over an ORC stripe
+struct ARROW_EXPORT StripeColumnStatistics {
+  /// The number of non-null values
+  int64_t num_values = 0;
+  /// Whether any value is null
+  bool has_null = true;
+  /// The minimum and maximum values, or null if not known
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -101,6 +117,25 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Read a single stripe as a RecordBatch
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] include_names the names of the top-level fields to read
+  /// \param[out] out the returned RecordBatch
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Read the column statistics of a single stripe
+  ///
+  /// Minimum and maximum values are only provided for integer, floating-point,
+  /// string and date columns.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each top-level field, or null for the
+  ///   fields without statistics
+  Status ReadStripeStatistics(int64_t stripe,
+                              std::vector<std::shared_ptr<StripeColumnStatistics>>* out);
+
   /// \brief Seek to designated row. Invoke NextStripeReader() after seek
   ///        will return stripe reader starting from designated row.
   ///
@@ -142,6 +177,66 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for writing ORC files
+struct ARROW_EXPORT WriteOptions {
+  /// The number of rows converted at once into an ORC row batch
+  int64_t batch_size = 1024;
+  /// The size in bytes of the memory buffered for a stripe before it is flushed
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// The compression codec, one of UNCOMPRESSED, GZIP (ORC's ZLIB), SNAPPY,
+  /// LZO, LZ4 or ZSTD
+  Compression::type compression = Compression::UNCOMPRESSED;
+  /// The size in bytes of each compression block
+  int64_t compression_block_size = 64 * 1024;
+  /// The number of rows between row index entries, or 0 to disable the index
+  int64_t row_index_stride = 10000;
+  /// Whether to convert the columns of a batch concurrently
+  bool use_threads = false;
+
+  static WriteOptions Defaults() { return WriteOptions(); }
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables or RecordBatches to an ORC file.
+///
+/// Supported column types are boolean, integers, floating point, binary and
+/// string types, fixed size binary (as ORC char), date32, timestamp, decimal128,
+/// as well as lists, maps and structs thereof.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the data to be written
+  /// \param[in] output_stream the destination, which must outlive the writer.
+  ///   It is not closed by Close().
+  /// \param[in] options options for writing the file
+  /// \return the returned writer object
+  static Result<std::unique_ptr<ORCFileWriter>> Open(
+      const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+      const WriteOptions& options = WriteOptions::Defaults());
+
+  /// \brief Write a RecordBatch
+  ///
+  /// \param[in] batch the batch to write, which must have the writer's schema
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table
+  ///
+  /// \param[in] table the table to write, which must have the writer's schema
+  Status Write(const Table& table);
+
+  /// \brief Flush the last stripe and write the file footer
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
@@ -20,6 +20,8 @@
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -157,4 +159,72 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+std::shared_ptr<Table> WriteAndReadOrc(const Table& table,
+                                       const adapters::orc::WriteOptions& options) {
+  EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  EXPECT_OK_AND_ASSIGN(auto writer, adapters::orc::ORCFileWriter::Open(
+                                        table.schema(), sink.get(), options));
+  ARROW_EXPECT_OK(writer->Write(table));
+  ARROW_EXPECT_OK(writer->Close());
+  EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ARROW_EXPECT_OK(adapters::orc::ORCFileReader::Open(
+      std::make_shared<io::BufferReader>(buffer), default_memory_pool(), &reader));
+  std::shared_ptr<Table> out;
+  ARROW_EXPECT_OK(reader->Read(&out));
+  return out;
+}
+
+TEST(TestAdapterWrite, RoundTrip) {
+  auto table_schema =
+      schema({field("bool", boolean()), field("int8", int8()), field("int16", int16()),
+              field("int32", int32()), field("int64", int64()),
+              field("float", float32()), field("double", float64()),
+              field("string", utf8()), field("binary", binary()),
+              field("fixed", fixed_size_binary(3)), field("date", date32()),
+              field("timestamp", timestamp(TimeUnit::NANO)),
+              field("decimal64", decimal(10, 2)), field("decimal128", decimal(25, 3)),
+              field("list", list(int32())),
+              field("struct", struct_({field("a", int64()), field("b", utf8())}))});
+  auto table = TableFromJSON(table_schema, {R"([
+    [true, 1, 2, 3, 4, 1.5, 2.5, "foo", "bar", "abc", 1, -500000000, "1.23",
+     "12345678901234567890.123", [1, 2], {"a": 1, "b": "x"}],
+    [null, null, null, null, null, null, null, null, null, null, null, null, null,
+     null, null, null]
+  ])", R"([
+    [false, -1, -2, -3, -4, -1.5, -2.5, "", "", "xyz", -1, 1500000000, "-1.23",
+     "-0.001", [], {"a": null, "b": null}],
+    [true, 127, 32767, 2147483647, 9223372036854775807, 0, 0, "quux", "q", "def",
+     0, 0, "0.00", "0.000", [null, 3], null]
+  ])"});
+
+  adapters::orc::WriteOptions options;
+  // Several ORC batches per chunk, converted concurrently
+  options.batch_size = 1;
+  options.use_threads = true;
+  auto actual = WriteAndReadOrc(*table, options);
+  ASSERT_OK(actual->ValidateFull());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+  // Compressed, with one ORC batch spanning the table chunks
+  options = adapters::orc::WriteOptions::Defaults();
+  options.compression = Compression::ZSTD;
+  actual = WriteAndReadOrc(*table, options);
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestAdapterWrite, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_RAISES(NotImplemented, adapters::orc::ORCFileWriter::Open(
+                                    schema({field("f", float16())}), sink.get()));
+
+  ASSERT_OK_AND_ASSIGN(auto writer, adapters::orc::ORCFileWriter::Open(
+                                        schema({field("f", int32())}), sink.get()));
+  auto batch = RecordBatchFromJSON(schema({field("f", int64())}), "[[1]]");
+  ASSERT_RAISES(TypeError, writer->Write(*batch));
+  ASSERT_OK(writer->Close());
+}
+
 }  // namespace arrow
@@ -15,10 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
@@ -61,6 +63,23 @@ Status AppendStructBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cb
   return Status::OK();
 }
 
+// Append the offsets and validity of a range of ORC list-like values, rebased
+// on the current length of the child builder.  Null ORC lists are empty.
+template <class batch_type>
+Status AppendListOffsets(batch_type* batch, int64_t offset, int64_t length,
+                         ListBuilder* builder) {
+  const uint8_t* valid_bytes = nullptr;
+  if (batch->hasNulls) {
+    valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
+  }
+  const int64_t base = builder->value_builder()->length() - batch->offsets[offset];
+  std::vector<int32_t> offsets(length);
+  for (int64_t i = 0; i < length; i++) {
+    offsets[i] = static_cast<int32_t>(base + batch->offsets[offset + i]);
+  }
+  return builder->AppendValues(offsets.data(), length, valid_bytes);
+}
+
 Status AppendListBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatch,
                        int64_t offset, int64_t length, ArrayBuilder* abuilder) {
   auto builder = checked_cast<ListBuilder*>(abuilder);
@@ -68,19 +87,12 @@ Status AppendListBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbat
   liborc::ColumnVectorBatch* elements = batch->elements.get();
   const liborc::Type* elemtype = type->getSubtype(0);
 
-  const bool has_nulls = batch->hasNulls;
-  for (int64_t i = offset; i < length + offset; i++) {
-    if (!has_nulls || batch->notNull[i]) {
-      int64_t start = batch->offsets[i];
-      int64_t end = batch->offsets[i + 1];
-      RETURN_NOT_OK(builder->Append());
-      RETURN_NOT_OK(
-          AppendBatch(elemtype, elements, start, end - start, builder->value_builder()));
-    } else {
-      RETURN_NOT_OK(builder->AppendNull());
-    }
-  }
-  return Status::OK();
+  // Append the list offsets, then all the child elements in a single batch
+  const int64_t elements_start = batch->offsets[offset];
+  const int64_t elements_length = batch->offsets[offset + length] - elements_start;
+  RETURN_NOT_OK(AppendListOffsets(batch, offset, length, builder));
+  return AppendBatch(elemtype, elements, elements_start, elements_length,
+                     builder->value_builder());
 }
 
 Status AppendMapBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatch,
@@ -93,20 +105,15 @@ Status AppendMapBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatc
   const liborc::Type* keytype = type->getSubtype(0);
   const liborc::Type* valtype = type->getSubtype(1);
 
-  const bool has_nulls = batch->hasNulls;
-  for (int64_t i = offset; i < length + offset; i++) {
-    RETURN_NOT_OK(list_builder->Append());
-    int64_t start = batch->offsets[i];
-    int64_t list_length = batch->offsets[i + 1] - start;
-    if (list_length && (!has_nulls || batch->notNull[i])) {
-      RETURN_NOT_OK(struct_builder->AppendValues(list_length, nullptr));
-      RETURN_NOT_OK(AppendBatch(keytype, keys, start, list_length,
-                                struct_builder->field_builder(0)));
-      RETURN_NOT_OK(AppendBatch(valtype, vals, start, list_length,
-                                struct_builder->field_builder(1)));
-    }
-  }
-  return Status::OK();
+  // Map entries are contiguous, so append all of them in a single batch
+  const int64_t entries_start = batch->offsets[offset];
+  const int64_t entries_length = batch->offsets[offset + length] - entries_start;
+  RETURN_NOT_OK(AppendListOffsets(batch, offset, length, list_builder));
+  RETURN_NOT_OK(struct_builder->AppendValues(entries_length, nullptr));
+  RETURN_NOT_OK(AppendBatch(keytype, keys, entries_start, entries_length,
+                            struct_builder->field_builder(0)));
+  return AppendBatch(valtype, vals, entries_start, entries_length,
+                     struct_builder->field_builder(1));
 }
 
 template <class builder_type, class batch_type, class elem_type>
@@ -208,13 +215,22 @@ Status AppendBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto builder = checked_cast<builder_type*>(abuilder);
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
+  // Presize the builder so that values can be appended without checks
   const bool has_nulls = batch->hasNulls;
+  int64_t data_length = 0;
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(
-          builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+      data_length += batch->length[i];
+    }
+  }
+  RETURN_NOT_OK(builder->Reserve(length));
+  RETURN_NOT_OK(builder->ReserveData(data_length));
+
+  for (int64_t i = offset; i < length + offset; i++) {
+    if (!has_nulls || batch->notNull[i]) {
+      builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(batch->length[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -226,11 +242,12 @@ Status AppendFixedBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
   const bool has_nulls = batch->hasNulls;
+  RETURN_NOT_OK(builder->Reserve(length));
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(builder->Append(batch->data[i]));
+      builder->UnsafeAppend(batch->data[i]);
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -241,23 +258,24 @@ Status AppendDecimalBatch(const liborc::Type* type, liborc::ColumnVectorBatch* c
   auto builder = checked_cast<Decimal128Builder*>(abuilder);
 
   const bool has_nulls = cbatch->hasNulls;
+  RETURN_NOT_OK(builder->Reserve(length));
   if (type->getPrecision() == 0 || type->getPrecision() > 18) {
     auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(builder->Append(
-            Decimal128(batch->values[i].getHighBits(), batch->values[i].getLowBits())));
+        builder->UnsafeAppend(
+            Decimal128(batch->values[i].getHighBits(), batch->values[i].getLowBits()));
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
   } else {
     auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(builder->Append(Decimal128(batch->values[i])));
+        builder->UnsafeAppend(Decimal128(batch->values[i]));
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
   }
@@ -425,6 +443,294 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Arrow to ORC conversion
+
+namespace {
+
+// Size `batch` for the values of `array` and fill its validity
+void PrepareBatch(const Array& array, liborc::ColumnVectorBatch* batch) {
+  const int64_t length = array.length();
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(static_cast<uint64_t>(length));
+  }
+  batch->numElements = static_cast<uint64_t>(length);
+  batch->hasNulls = array.null_count() > 0;
+  if (batch->hasNulls) {
+    char* not_null = batch->notNull.data();
+    for (int64_t i = 0; i < length; ++i) {
+      not_null[i] = array.IsValid(i);
+    }
+  }
+}
+
+// Integers, floating point and dates: a memcpy when the ORC and Arrow value types
+// match, a widening copy otherwise
+template <class array_type, class batch_type>
+Status WriteNumericBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<batch_type*>(cbatch);
+  const auto values = checked_cast<const array_type&>(array).raw_values();
+  std::copy(values, values + array.length(), batch->data.data());
+  return Status::OK();
+}
+
+Status WriteBoolBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+  const auto& bool_array = checked_cast<const BooleanArray&>(array);
+  int64_t* out = batch->data.data();
+  for (int64_t i = 0; i < array.length(); ++i) {
+    out[i] = bool_array.Value(i);
+  }
+  return Status::OK();
+}
+
+Status WriteTimestampBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+  const auto& timestamp_type = checked_cast<const TimestampType&>(*array.type());
+  int64_t units_per_second = 1;
+  switch (timestamp_type.unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+
+  const int64_t* values = checked_cast<const TimestampArray&>(array).raw_values();
+  int64_t* seconds = batch->data.data();
+  int64_t* nanos = batch->nanoseconds.data();
+  for (int64_t i = 0; i < array.length(); ++i) {
+    // Floor division, so that the nanoseconds are always positive
+    int64_t second = values[i] / units_per_second;
+    int64_t remainder = values[i] % units_per_second;
+    if (remainder < 0) {
+      second -= 1;
+      remainder += units_per_second;
+    }
+    seconds[i] = second;
+    nanos[i] = remainder * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteBinaryBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  const auto& binary_array = checked_cast<const array_type&>(array);
+  char** data = batch->data.data();
+  int64_t* lengths = batch->length.data();
+  for (int64_t i = 0; i < array.length(); ++i) {
+    typename array_type::offset_type length;
+    const uint8_t* value = binary_array.GetValue(i, &length);
+    // liborc only reads the values, so pointing into the Arrow buffers is safe
+    data[i] = const_cast<char*>(reinterpret_cast<const char*>(value));
+    lengths[i] = array.IsValid(i) ? static_cast<int64_t>(length) : 0;
+  }
+  return Status::OK();
+}
+
+Status WriteFixedBinaryBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  const auto& binary_array = checked_cast<const FixedSizeBinaryArray&>(array);
+  const int64_t byte_width = binary_array.byte_width();
+  char** data = batch->data.data();
+  int64_t* lengths = batch->length.data();
+  for (int64_t i = 0; i < array.length(); ++i) {
+    data[i] = const_cast<char*>(reinterpret_cast<const char*>(binary_array.GetValue(i)));
+    lengths[i] = byte_width;
+  }
+  return Status::OK();
+}
+
+Status WriteDecimalBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+  const auto& decimal_type = checked_cast<const Decimal128Type&>(*array.type());
+  // liborc uses 64-bit decimals up to a precision of 18, see AppendDecimalBatch
+  if (decimal_type.precision() <= 18) {
+    auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    int64_t* out = batch->values.data();
+    for (int64_t i = 0; i < array.length(); ++i) {
+      out[i] = static_cast<int64_t>(Decimal128(decimal_array.GetValue(i)).low_bits());
+    }
+  } else {
+    auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    liborc::Int128* out = batch->values.data();
+    for (int64_t i = 0; i < array.length(); ++i) {
+      Decimal128 value(decimal_array.GetValue(i));
+      out[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteStructBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+  const auto& struct_array = checked_cast<const StructArray&>(array);
+  for (int i = 0; i < struct_array.num_fields(); ++i) {
+    RETURN_NOT_OK(WriteBatch(*struct_array.field(i), batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+// Fill the ORC offsets of a list or map batch, rebased to zero, and return the
+// range of child values referenced by the array
+template <class batch_type>
+void WriteListOffsets(const ListArray& list_array, batch_type* batch,
+                      int64_t* values_offset, int64_t* values_length) {
+  const int32_t* offsets = list_array.raw_value_offsets();
+  const int64_t length = list_array.length();
+  int64_t* out = batch->offsets.data();
+  for (int64_t i = 0; i <= length; ++i) {
+    out[i] = offsets[i] - offsets[0];
+  }
+  *values_offset = offsets[0];
+  *values_length = offsets[length] - offsets[0];
+}
+
+Status WriteListBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+  const auto& list_array = checked_cast<const ListArray&>(array);
+  int64_t values_offset, values_length;
+  WriteListOffsets(list_array, batch, &values_offset, &values_length);
+  return WriteBatch(*list_array.values()->Slice(values_offset, values_length),
+                    batch->elements.get());
+}
+
+Status WriteMapBatch(const Array& array, liborc::ColumnVectorBatch* cbatch) {
+  auto batch = checked_cast<liborc::MapVectorBatch*>(cbatch);
+  const auto& map_array = checked_cast<const MapArray&>(array);
+  int64_t values_offset, values_length;
+  WriteListOffsets(map_array, batch, &values_offset, &values_length);
+  RETURN_NOT_OK(WriteBatch(*map_array.keys()->Slice(values_offset, values_length),
+                           batch->keys.get()));
+  return WriteBatch(*map_array.items()->Slice(values_offset, values_length),
+                    batch->elements.get());
+}
+
+}  // namespace
+
+Status WriteBatch(const Array& array, liborc::ColumnVectorBatch* batch) {
+  PrepareBatch(array, batch);
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteBoolBatch(array, batch);
+    case Type::INT8:
+      return WriteNumericBatch<Int8Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT16:
+      return WriteNumericBatch<Int16Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT32:
+      return WriteNumericBatch<Int32Array, liborc::LongVectorBatch>(array, batch);
+    case Type::INT64:
+      return WriteNumericBatch<Int64Array, liborc::LongVectorBatch>(array, batch);
+    case Type::FLOAT:
+      return WriteNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, batch);
+    case Type::DOUBLE:
+      return WriteNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, batch);
+    case Type::DATE32:
+      return WriteNumericBatch<Date32Array, liborc::LongVectorBatch>(array, batch);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, batch);
+    case Type::STRING:
+      return WriteBinaryBatch<StringArray>(array, batch);
+    case Type::BINARY:
+      return WriteBinaryBatch<BinaryArray>(array, batch);
+    case Type::LARGE_STRING:
+      return WriteBinaryBatch<LargeStringArray>(array, batch);
+    case Type::LARGE_BINARY:
+      return WriteBinaryBatch<LargeBinaryArray>(array, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteFixedBinaryBatch(array, batch);
+    case Type::DECIMAL128:
+      return WriteDecimalBatch(array, batch);
+    case Type::STRUCT:
+      return WriteStructBatch(array, batch);
+    case Type::LIST:
+      return WriteListBatch(array, batch);
+    case Type::MAP:
+      return WriteMapBatch(array, batch);
+    default:
+      return Status::NotImplemented("Writing ", array.type()->ToString(),
+                                    " to ORC is not supported");
+  }
+}
+
+Result<std::unique_ptr<liborc::Type>> GetOrcType(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+      return liborc::createPrimitiveType(liborc::BOOLEAN);
+    case Type::INT8:
+      return liborc::createPrimitiveType(liborc::BYTE);
+    case Type::INT16:
+      return liborc::createPrimitiveType(liborc::SHORT);
+    case Type::INT32:
+      return liborc::createPrimitiveType(liborc::INT);
+    case Type::INT64:
+      return liborc::createPrimitiveType(liborc::LONG);
+    case Type::FLOAT:
+      return liborc::createPrimitiveType(liborc::FLOAT);
+    case Type::DOUBLE:
+      return liborc::createPrimitiveType(liborc::DOUBLE);
+    case Type::DATE32:
+      return liborc::createPrimitiveType(liborc::DATE);
+    case Type::TIMESTAMP:
+      return liborc::createPrimitiveType(liborc::TIMESTAMP);
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      return liborc::createPrimitiveType(liborc::STRING);
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+      return liborc::createPrimitiveType(liborc::BINARY);
+    case Type::FIXED_SIZE_BINARY: {
+      const auto byte_width = checked_cast<const FixedSizeBinaryType&>(type).byte_width();
+      return liborc::createCharType(liborc::CHAR, static_cast<uint64_t>(byte_width));
+    }
+    case Type::DECIMAL128: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      return liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+    }
+    case Type::STRUCT: {
+      auto out = liborc::createStructType();
+      for (const auto& child : type.fields()) {
+        ARROW_ASSIGN_OR_RAISE(auto child_type, GetOrcType(*child->type()));
+        out->addStructField(child->name(), std::move(child_type));
+      }
+      return std::move(out);
+    }
+    case Type::LIST: {
+      const auto& value_type = checked_cast<const ListType&>(type).value_type();
+      ARROW_ASSIGN_OR_RAISE(auto orc_value_type, GetOrcType(*value_type));
+      return liborc::createListType(std::move(orc_value_type));
+    }
+    case Type::MAP: {
+      const auto& map_type = checked_cast<const MapType&>(type);
+      ARROW_ASSIGN_OR_RAISE(auto key_type, GetOrcType(*map_type.key_type()));
+      ARROW_ASSIGN_OR_RAISE(auto item_type, GetOrcType(*map_type.item_type()));
+      return liborc::createMapType(std::move(key_type), std::move(item_type));
+    }
+    default:
+      return Status::NotImplemented("Writing ", type.ToString(),
+                                    " to ORC is not supported");
+  }
+}
+
+Result<std::unique_ptr<liborc::Type>> GetOrcType(const Schema& schema) {
+  auto out = liborc::createStructType();
+  for (const auto& field : schema.fields()) {
+    ARROW_ASSIGN_OR_RAISE(auto field_type, GetOrcType(*field->type()));
+    out->addStructField(field->name(), std::move(field_type));
+  }
+  return std::move(out);
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -21,7 +21,9 @@
 #include <memory>
 
 #include "arrow/array/builder_base.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "orc/OrcFile.hh"
 
 namespace liborc = orc;
@@ -36,6 +38,20 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+/// \brief Return the ORC type a field of the given type is written as
+Result<std::unique_ptr<liborc::Type>> GetOrcType(const DataType& type);
+
+/// \brief Return the ORC struct type a batch of the given schema is written as
+Result<std::unique_ptr<liborc::Type>> GetOrcType(const Schema& schema);
+
+/// \brief Fill `batch` with all the values of `array`, growing it if needed
+///
+/// `batch` must have been created for GetOrcType(*array.type()).  Binary and
+/// string values are not copied: `batch` points into the buffers of `array`,
+/// which must outlive it.
+Status WriteBatch(const Array& array, liborc::ColumnVectorBatch* batch);
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
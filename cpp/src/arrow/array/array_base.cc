@@ -28,6 +28,7 @@
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
 #include "arrow/array/util.h"
 #include "arrow/array/validate.h"
 #include "arrow/buffer.h"
@@ -39,6 +40,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/visitor.h"
 #include "arrow/visitor_inline.h"
 
@@ -84,6 +86,8 @@ struct ScalarFromArraySlotImpl {
 
   Status Visit(const FixedSizeBinaryArray& a) { return Finish(a.GetString(index_)); }
 
+  Status Visit(const StringViewArray& a) { return Finish(a.GetString(index_)); }
+
   Status Visit(const DayTimeIntervalArray& a) { return Finish(a.Value(index_)); }
 
   template <typename T>
@@ -145,6 +149,13 @@ struct ScalarFromArraySlotImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& a) {
+    const int64_t physical_index = ree_util::FindPhysicalIndex(*a.data(), index_);
+    ARROW_ASSIGN_OR_RAISE(auto value, a.values()->GetScalar(physical_index));
+    out_ = std::make_shared<RunEndEncodedScalar>(std::move(value), a.type());
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionArray& a) {
     return Status::NotImplemented("Non-null ExtensionScalar");
   }
@@ -89,6 +89,22 @@ LargeStringArray::LargeStringArray(int64_t length,
 
 Status LargeStringArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
 
+StringViewArray::StringViewArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::STRING_VIEW);
+  SetData(data);
+}
+
+void StringViewArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  raw_views_ = data->GetValuesSafe<c_type>(1, /*offset=*/0);
+  raw_data_buffers_.clear();
+  for (size_t i = 2; i < data->buffers.size(); ++i) {
+    raw_data_buffers_.push_back(data->buffers[i] ? data->buffers[i]->data() : NULLPTR);
+  }
+}
+
+Status StringViewArray::ValidateUTF8() const { return internal::ValidateUTF8(*data_); }
+
 FixedSizeBinaryArray::FixedSizeBinaryArray(const std::shared_ptr<ArrayData>& data) {
   SetData(data);
 }
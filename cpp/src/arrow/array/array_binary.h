@@ -16,7 +16,7 @@
 // under the License.
 
 // Array accessor classes for Binary, LargeBinart, String, LargeString,
-// FixedSizeBinary
+// StringView, FixedSizeBinary
 
 #pragma once
 
@@ -202,6 +202,81 @@ class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
   Status ValidateUTF8() const;
 };
 
+// ----------------------------------------------------------------------
+// String views
+
+/// Concrete Array class for utf-8 string data stored as views
+///
+/// The views are stored in buffers[1], the data of the non-inline strings in
+/// buffers[2], buffers[3]...
+class ARROW_EXPORT StringViewArray : public FlatArray {
+ public:
+  using TypeClass = StringViewType;
+  using c_type = StringViewType::c_type;
+  using IteratorType = stl::ArrayIterator<StringViewArray>;
+
+  explicit StringViewArray(const std::shared_ptr<ArrayData>& data);
+
+  /// \brief Get string value as a string_view
+  ///
+  /// \param i the value index
+  /// \return the view over the selected value
+  util::string_view GetView(int64_t i) const {
+    return GetView(raw_views_[i + data_->offset]);
+  }
+
+  /// \brief Resolve a view of this array's views buffer to its string data
+  ///
+  /// The view must be a reference to an element of raw_views(), not a copy,
+  /// as the data of inline strings is stored in the view itself.
+  util::string_view GetView(const c_type& view) const {
+    const uint8_t* data =
+        view.is_inline() ? view.inlined.data
+                         : raw_data_buffers_[view.ref.buffer_index] + view.ref.offset;
+    return util::string_view(reinterpret_cast<const char*>(data), view.size());
+  }
+
+  /// \brief Get string value as a std::string
+  ///
+  /// \param i the value index
+  /// \return the value copied into a std::string
+  std::string GetString(int64_t i) const { return std::string(GetView(i)); }
+
+  /// \brief Return the length of the string at the passed index.
+  ///
+  /// Does not perform boundschecking
+  int32_t value_length(int64_t i) const { return raw_views_[i + data_->offset].size(); }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> views() const { return data_->buffers[1]; }
+
+  const c_type* raw_views() const { return raw_views_ + data_->offset; }
+
+  /// \brief Return the number of buffers holding the data of non-inline strings
+  int64_t num_data_buffers() const {
+    return static_cast<int64_t>(data_->buffers.size()) - 2;
+  }
+
+  const std::shared_ptr<Buffer>& data_buffer(int64_t i) const {
+    return data_->buffers[i + 2];
+  }
+
+  /// \brief Validate that this array contains only valid UTF8 entries
+  ///
+  /// This check is also implied by ValidateFull()
+  Status ValidateUTF8() const;
+
+  IteratorType begin() const { return IteratorType(*this); }
+
+  IteratorType end() const { return IteratorType(*this, length()); }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  const c_type* raw_views_ = NULLPTR;
+  std::vector<const uint8_t*> raw_data_buffers_;
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
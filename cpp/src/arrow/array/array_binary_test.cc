@@ -17,7 +17,9 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -26,6 +28,7 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -285,6 +288,17 @@ class TestStringArray : public ::testing::Test {
     ASSERT_RAISES(Invalid, ValidateFull(1, {0, -1, -1}, "data", 1));
     // Offsets non-monotonic
     ASSERT_RAISES(Invalid, ValidateFull(2, {0, 5, 4}, "some data"));
+
+    // Offsets spanning several blocks of the fast check
+    std::vector<offset_type> many_offsets(3000);
+    std::iota(many_offsets.begin(), many_offsets.end(), 0);
+    std::string many_data(many_offsets.size(), 'x');
+    ASSERT_OK(ValidateFull(2999, many_offsets, many_data));
+    many_offsets[2500] = 2502;
+    ASSERT_RAISES(Invalid, ValidateFull(2999, many_offsets, many_data));
+    many_offsets[2500] = 2500;
+    many_offsets.back() = 3001;
+    ASSERT_RAISES(Invalid, ValidateFull(2999, many_offsets, many_data));
   }
 
   void TestValidateData() {
@@ -301,15 +315,28 @@ class TestStringArray : public ::testing::Test {
     auto st2 = ValidateFull(1, {0, 4}, "\xf4\x90\x80\x80");
     // Single UTF8 character straddles two entries
     auto st3 = ValidateFull(2, {0, 1, 2}, "\xc3\xa9");
+    // Valid data as a whole, but a string starts inside a character
+    auto st4 = ValidateFull(2, {0, 2, 4}, "a\xc3\xa9" "b");
     if (T::is_utf8) {
       ASSERT_RAISES(Invalid, st1);
       ASSERT_RAISES(Invalid, st2);
       ASSERT_RAISES(Invalid, st3);
+      ASSERT_RAISES(Invalid, st4);
     } else {
       ASSERT_OK(st1);
       ASSERT_OK(st2);
       ASSERT_OK(st3);
+      ASSERT_OK(st4);
     }
+
+    // Invalid data in a null slot is ignored
+    std::vector<offset_type> offsets = {0, 3, 4, 7};
+    auto data = std::make_shared<Buffer>(
+        "abc\xff"
+        "def");
+    ArrayType with_null(3, Buffer::Wrap(offsets), data, Buffer::FromString("\x05"),
+                        /*null_count=*/1);
+    ASSERT_OK(with_null.ValidateFull());
   }
 
  protected:
@@ -492,6 +519,27 @@ class TestStringBuilder : public TestBuilder {
     CheckStringArray(*result_, strings, valid_bytes, reps);
   }
 
+  void TestStringViewAppend() {
+    std::vector<util::string_view> views = {"", "bb", "a", "ignored", "ccc"};
+    std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+
+    int N = static_cast<int>(views.size());
+    int reps = 1000;
+
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(views.data(), N, valid_bytes.data()));
+      ASSERT_OK(builder_->AppendValues(views.data(), N - 1));
+    }
+    Done();
+
+    ASSERT_EQ(reps * (2 * N - 1), result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(reps * 16, result_->value_data()->size());
+
+    CheckStringArray(*result_, {"", "bb", "a", "", "ccc", "", "bb", "a", "ignored"},
+                     {1, 1, 1, 0, 1, 1, 1, 1, 1}, reps);
+  }
+
   void TestAppendCStringsWithValidBytes() {
     const char* strings[] = {nullptr, "aaa", nullptr, "ignored", ""};
     std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
@@ -610,6 +658,8 @@ TYPED_TEST(TestStringBuilder, TestScalarAppendUnsafe) { this->TestScalarAppendUn
 
 TYPED_TEST(TestStringBuilder, TestVectorAppend) { this->TestVectorAppend(); }
 
+TYPED_TEST(TestStringBuilder, TestStringViewAppend) { this->TestStringViewAppend(); }
+
 TYPED_TEST(TestStringBuilder, TestAppendCStringsWithValidBytes) {
   this->TestAppendCStringsWithValidBytes();
 }
@@ -832,4 +882,101 @@ TYPED_TEST(TestBinaryDataVisitor, Basics) { this->TestBasics(); }
 
 TYPED_TEST(TestBinaryDataVisitor, Sliced) { this->TestSliced(); }
 
+// ----------------------------------------------------------------------
+// String view tests
+
+TEST(TestStringViewBuilder, InlineAndOutOfLine) {
+  // A small block size forces the long values into several data buffers
+  StringViewBuilder builder(default_memory_pool(), /*block_size=*/32);
+  const std::vector<std::string> values = {"", "short", "exactly 12 b",
+                                           "a value longer than the inline size",
+                                           "another long value, in a new block"};
+  for (const auto& value : values) {
+    ASSERT_OK(builder.Append(value));
+  }
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_EQ(6, builder.length());
+
+  std::shared_ptr<StringViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(6, array->length());
+  ASSERT_EQ(1, array->null_count());
+  ASSERT_EQ(2, array->num_data_buffers());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], array->GetView(i));
+    ASSERT_EQ(values[i].size(), static_cast<size_t>(array->value_length(i)));
+  }
+  ASSERT_TRUE(array->IsNull(5));
+  ASSERT_TRUE(array->raw_views()[2].is_inline());
+  ASSERT_FALSE(array->raw_views()[3].is_inline());
+
+  auto expected = ArrayFromJSON(utf8_view(), R"(["", "short", "exactly 12 b",
+      "a value longer than the inline size", "another long value, in a new block",
+      null])");
+  AssertArraysEqual(*expected, *array);
+  AssertArraysEqual(*expected->Slice(2, 3), *array->Slice(2, 3));
+}
+
+TEST(TestStringViewBuilder, AppendValues) {
+  StringViewBuilder builder;
+  std::vector<uint8_t> valid_bytes = {1, 0, 1};
+  ASSERT_OK(builder.AppendValues({"foo", "", "a rather long string value"},
+                                 valid_bytes.data()));
+  ASSERT_OK(builder.AppendEmptyValues(2));
+  std::shared_ptr<StringViewArray> array;
+  ASSERT_OK(builder.Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  auto expected = ArrayFromJSON(utf8_view(),
+                                R"(["foo", null, "a rather long string value", "", ""])");
+  AssertArraysEqual(*expected, *array);
+  ASSERT_EQ(0, builder.length());
+}
+
+TEST(TestStringViewArray, Validate) {
+  auto array = ArrayFromJSON(utf8_view(), R"(["a value longer than 12 bytes", "x"])");
+  ASSERT_OK(array->ValidateFull());
+  using c_type = StringViewType::c_type;
+
+  auto corrupt = [&](std::function<void(c_type*)> mutate) {
+    auto data = array->data()->Copy();
+    auto views = *AllocateBuffer(data->buffers[1]->size());
+    std::memcpy(views->mutable_data(), data->buffers[1]->data(), views->size());
+    mutate(reinterpret_cast<c_type*>(views->mutable_data()));
+    data->buffers[1] = std::move(views);
+    return MakeArray(data);
+  };
+  // Out of bounds buffer index
+  ASSERT_RAISES(Invalid, corrupt([](c_type* views) { views[0].ref.buffer_index = 1; })
+                             ->ValidateFull());
+  // Out of bounds offset
+  ASSERT_RAISES(Invalid,
+                corrupt([](c_type* views) { views[0].ref.offset = 10; })->ValidateFull());
+  // Prefix not matching the data
+  ASSERT_RAISES(Invalid,
+                corrupt([](c_type* views) { views[0].ref.prefix[0] = 'z'; })
+                    ->ValidateFull());
+  // Invalid UTF8
+  ASSERT_RAISES(Invalid,
+                corrupt([](c_type* views) { views[1].inlined.data[0] = 0xff; })
+                    ->ValidateFull());
+}
+
+TEST(TestStringViewArray, Concatenate) {
+  StringViewBuilder builder(default_memory_pool(), /*block_size=*/16);
+  ASSERT_OK(builder.AppendValues({"first long value here", "a", "second long value"}));
+  std::shared_ptr<StringViewArray> left;
+  ASSERT_OK(builder.Finish(&left));
+  auto right = ArrayFromJSON(utf8_view(), R"([null, "third long value, right side"])");
+
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate({left->Slice(1), right}));
+  ASSERT_OK(concatenated->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(utf8_view(), R"(["a", "second long value", null,
+      "third long value, right side"])"),
+                    *concatenated);
+  // The data buffers are shared with the inputs
+  ASSERT_EQ(left->num_data_buffers() + 1,
+            checked_cast<const StringViewArray&>(*concatenated).num_data_buffers());
+}
+
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstdint>
 #include <limits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -40,6 +41,8 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -335,6 +338,7 @@ struct MakeUnifier {
 
 struct RecursiveUnifier {
   MemoryPool* pool;
+  bool use_threads;
 
   // Return true if any of the arrays was changed (including descendents)
   Result<bool> Unify(std::shared_ptr<DataType> type, ArrayDataVector* chunks) {
@@ -375,25 +379,49 @@ struct RecursiveUnifier {
       // so this will fail.
       ARROW_ASSIGN_OR_RAISE(auto unifier,
                             DictionaryUnifier::Make(dict_type.value_type(), this->pool));
-      // Unify all dictionary array chunks
-      BufferVector transpose_maps(chunks->size());
+      // Unify all dictionary array chunks.  Chunks often share the same
+      // dictionary (e.g. when read from IPC), so each distinct dictionary
+      // is only unified once.
+      std::unordered_map<const ArrayData*, size_t> dict_to_map;
+      std::vector<size_t> chunk_to_map(chunks->size());
+      BufferVector transpose_maps;
       for (size_t j = 0; j < chunks->size(); ++j) {
-        DCHECK_NE((*chunks)[j]->dictionary, nullptr);
-        RETURN_NOT_OK(
-            unifier->Unify(*MakeArray((*chunks)[j]->dictionary), &transpose_maps[j]));
+        const auto& chunk_dict = (*chunks)[j]->dictionary;
+        DCHECK_NE(chunk_dict, nullptr);
+        auto inserted = dict_to_map.emplace(chunk_dict.get(), transpose_maps.size());
+        if (inserted.second) {
+          transpose_maps.emplace_back();
+          RETURN_NOT_OK(unifier->Unify(*MakeArray(chunk_dict), &transpose_maps.back()));
+        }
+        chunk_to_map[j] = inserted.first->second;
       }
       std::shared_ptr<Array> dictionary;
       RETURN_NOT_OK(unifier->GetResultWithIndexType(dict_type.index_type(), &dictionary));
-      for (size_t j = 0; j < chunks->size(); ++j) {
-        ARROW_ASSIGN_OR_RAISE(
-            (*chunks)[j],
-            TransposeDictIndices(
-                (*chunks)[j], type, type, dictionary->data(),
-                reinterpret_cast<const int32_t*>(transpose_maps[j]->data()), this->pool));
-        if (ext_type) {
-          (*chunks)[j]->type = ext_type;
+
+      // Transpose the chunk indices, in parallel if desired.  Chunks are
+      // handed out in contiguous groups to keep the task count bounded.
+      const int num_chunks = static_cast<int>(chunks->size());
+      const int num_tasks =
+          use_threads ? std::min(num_chunks, 4 * GetCpuThreadPoolCapacity())
+                      : 1;
+      auto transpose_chunks = [&](int task) -> Status {
+        const int begin = static_cast<int>(int64_t(num_chunks) * task / num_tasks);
+        const int end = static_cast<int>(int64_t(num_chunks) * (task + 1) / num_tasks);
+        for (int j = begin; j < end; ++j) {
+          const auto& transpose_map = transpose_maps[chunk_to_map[j]];
+          ARROW_ASSIGN_OR_RAISE(
+              (*chunks)[j],
+              TransposeDictIndices(
+                  (*chunks)[j], type, type, dictionary->data(),
+                  reinterpret_cast<const int32_t*>(transpose_map->data()), this->pool));
+          if (ext_type) {
+            (*chunks)[j]->type = ext_type;
+          }
         }
-      }
+        return Status::OK();
+      };
+      RETURN_NOT_OK(
+          internal::OptionalParallelFor(num_tasks > 1, num_tasks, transpose_chunks));
       changed = true;
     }
 
@@ -411,7 +439,7 @@ Result<std::unique_ptr<DictionaryUnifier>> DictionaryUnifier::Make(
 }
 
 Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
-    const std::shared_ptr<ChunkedArray>& array, MemoryPool* pool) {
+    const std::shared_ptr<ChunkedArray>& array, MemoryPool* pool, bool use_threads) {
   if (array->num_chunks() <= 1) {
     return array;
   }
@@ -419,8 +447,8 @@ Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
   ArrayDataVector data_chunks(array->num_chunks());
   std::transform(array->chunks().begin(), array->chunks().end(), data_chunks.begin(),
                  [](const std::shared_ptr<Array>& array) { return array->data(); });
-  ARROW_ASSIGN_OR_RAISE(bool changed,
-                        RecursiveUnifier{pool}.Unify(array->type(), &data_chunks));
+  RecursiveUnifier unifier{pool, use_threads};
+  ARROW_ASSIGN_OR_RAISE(bool changed, unifier.Unify(array->type(), &data_chunks));
   if (!changed) {
     return array;
   }
@@ -431,10 +459,12 @@ Result<std::shared_ptr<ChunkedArray>> DictionaryUnifier::UnifyChunkedArray(
 }
 
 Result<std::shared_ptr<Table>> DictionaryUnifier::UnifyTable(const Table& table,
-                                                             MemoryPool* pool) {
+                                                             MemoryPool* pool,
+                                                             bool use_threads) {
   ChunkedArrayVector columns = table.columns();
   for (auto& col : columns) {
-    ARROW_ASSIGN_OR_RAISE(col, DictionaryUnifier::UnifyChunkedArray(col, pool));
+    ARROW_ASSIGN_OR_RAISE(col,
+                          DictionaryUnifier::UnifyChunkedArray(col, pool, use_threads));
   }
   return Table::Make(table.schema(), std::move(columns), table.num_rows());
 }
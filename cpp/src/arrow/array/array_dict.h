@@ -138,9 +138,12 @@ class ARROW_EXPORT DictionaryUnifier {
   ///
   /// Only dictionaries with a primitive value type are currently supported.
   /// However, dictionaries nested inside a more complex type are correctly unified.
+  ///
+  /// Chunks sharing the same dictionary object are unified only once.  If
+  /// use_threads is true, the chunk indices are transposed on the CPU thread pool.
   static Result<std::shared_ptr<ChunkedArray>> UnifyChunkedArray(
       const std::shared_ptr<ChunkedArray>& array,
-      MemoryPool* pool = default_memory_pool());
+      MemoryPool* pool = default_memory_pool(), bool use_threads = false);
 
   /// \brief Unify dictionaries accross the chunks of each table column
   ///
@@ -149,8 +152,11 @@ class ARROW_EXPORT DictionaryUnifier {
   ///
   /// Only dictionaries with a primitive value type are currently supported.
   /// However, dictionaries nested inside a more complex type are correctly unified.
+  ///
+  /// See UnifyChunkedArray() for the meaning of use_threads.
   static Result<std::shared_ptr<Table>> UnifyTable(
-      const Table& table, MemoryPool* pool = default_memory_pool());
+      const Table& table, MemoryPool* pool = default_memory_pool(),
+      bool use_threads = false);
 
   /// \brief Append dictionary to the internal memo
   virtual Status Unify(const Array& dictionary) = 0;
@@ -454,6 +454,37 @@ TEST(TestStringDictionaryBuilder, AppendIndices) {
   TestStringDictionaryAppendIndices<StringDictionary32Builder, Int32Type, int32_t>();
 }
 
+TEST(TestStringDictionaryBuilder, AppendArray) {
+  StringDictionary32Builder builder;
+  ASSERT_OK(builder.Append("c"));
+  ASSERT_OK(builder.AppendArray(*ArrayFromJSON(utf8(), R"(["a", null, "c", "b", "a"])")));
+  ASSERT_OK(builder.AppendArray(*ArrayFromJSON(utf8(), R"(["b", "d"])")->Slice(1)));
+
+  ASSERT_OK_AND_ASSIGN(auto result, builder.Finish());
+  auto expected = DictArrayFromJSON(
+      dictionary(int32(), utf8()), "[0, 1, null, 0, 2, 1, 3]", R"(["c", "a", "b", "d"])");
+  AssertArraysEqual(*expected, *result);
+}
+
+TEST(TestStringDictionaryBuilder, AppendArraySlice) {
+  // The input dictionary contains a null and values not yet in the memo
+  auto input = DictArrayFromJSON(dictionary(int16(), utf8()), "[3, 0, null, 1, 2, 0]",
+                                 R"(["a", null, "b", "c"])");
+
+  StringDictionaryBuilder builder;
+  ASSERT_OK(builder.Append("b"));
+  ASSERT_OK(builder.AppendArraySlice(*input->data(), 1, 4));
+  ASSERT_OK(builder.AppendArraySlice(*input->Slice(4)->data(), 1, 1));
+  ASSERT_EQ(6, builder.length());
+  ASSERT_EQ(2, builder.null_count());
+
+  ASSERT_OK_AND_ASSIGN(auto result, builder.Finish());
+  ASSERT_OK(result->ValidateFull());
+  auto expected = DictArrayFromJSON(dictionary(int8(), utf8()),
+                                    "[0, 1, null, null, 2, 1]", R"(["b", "a", "c"])");
+  AssertArraysEqual(*expected, *result);
+}
+
 TEST(TestStringDictionaryBuilder, ArrayInit) {
   auto dict_array = ArrayFromJSON(utf8(), R"(["test", "test2"])");
   auto int_array = ArrayFromJSON(int8(), "[0, 1, 0]");
@@ -1584,6 +1615,35 @@ TEST(TestDictionaryUnifier, ChunkedArraySimple) {
   CheckDictionaryArray(unified->chunk(3), expected_dict, ArrayFromJSON(int8(), "[]"));
 }
 
+TEST(TestDictionaryUnifier, ChunkedArraySharedDictionaries) {
+  // Many chunks referencing a few dictionary objects
+  auto type = dictionary(int8(), utf8());
+  auto dict1 = ArrayFromJSON(utf8(), R"(["ab", "cd"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["ef", "cd"])");
+  auto indices = ArrayFromJSON(int8(), "[0, 1, null, 1]");
+  auto chunk1 = std::make_shared<DictionaryArray>(type, indices, dict1);
+  auto chunk2 = std::make_shared<DictionaryArray>(type, indices, dict2);
+
+  ArrayVector chunks;
+  for (int i = 0; i < 50; ++i) {
+    chunks.push_back(i % 3 == 2 ? chunk2 : chunk1);
+  }
+  ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(chunks));
+
+  auto expected_dict = ArrayFromJSON(utf8(), R"(["ab", "cd", "ef"])");
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "use_threads" : "serial");
+    ASSERT_OK_AND_ASSIGN(auto unified, DictionaryUnifier::UnifyChunkedArray(
+                                           chunked, default_memory_pool(), use_threads));
+    ASSERT_EQ(unified->num_chunks(), 50);
+    for (int i = 0; i < 50; ++i) {
+      CheckDictionaryArray(unified->chunk(i), expected_dict,
+                           ArrayFromJSON(int8(), i % 3 == 2 ? "[2, 1, null, 1]"
+                                                            : "[0, 1, null, 1]"));
+    }
+  }
+}
+
 TEST(TestDictionaryUnifier, ChunkedArrayZeroChunk) {
   auto type = dictionary(int8(), utf8());
   ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(ArrayVector{}, type));
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/array_run_end.h"
+
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<ArrayData>& data) {
+  ARROW_CHECK_EQ(data->type->id(), Type::RUN_END_ENCODED);
+  ARROW_CHECK_EQ(data->child_data.size(), 2);
+  SetData(data);
+}
+
+RunEndEncodedArray::RunEndEncodedArray(const std::shared_ptr<DataType>& type,
+                                       int64_t length,
+                                       const std::shared_ptr<Array>& run_ends,
+                                       const std::shared_ptr<Array>& values,
+                                       int64_t offset) {
+  ARROW_CHECK_EQ(type->id(), Type::RUN_END_ENCODED);
+  SetData(ArrayData::Make(type, length, {nullptr}, {run_ends->data(), values->data()},
+                          /*null_count=*/0, offset));
+}
+
+void RunEndEncodedArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  run_ends_ = MakeArray(data->child_data[0]);
+  values_ = MakeArray(data->child_data[1]);
+}
+
+Result<std::shared_ptr<RunEndEncodedArray>> RunEndEncodedArray::Make(
+    int64_t logical_length, const std::shared_ptr<Array>& run_ends,
+    const std::shared_ptr<Array>& values, int64_t logical_offset) {
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        RunEndEncodedType::Make(run_ends->type(), values->type()));
+  auto array = std::make_shared<RunEndEncodedArray>(type, logical_length, run_ends,
+                                                    values, logical_offset);
+  RETURN_NOT_OK(array->Validate());
+  return array;
+}
+
+int64_t RunEndEncodedArray::FindPhysicalOffset() const {
+  return ree_util::FindPhysicalOffset(*data_);
+}
+
+int64_t RunEndEncodedArray::FindPhysicalLength() const {
+  return ree_util::FindPhysicalLength(*data_);
+}
+
+}  // namespace arrow
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncodedArray
+
+/// \brief Array type for run-end encoded data
+///
+/// A run-end encoded array stores each run of equal consecutive values once,
+/// along with the logical position where the run ends.  For example, the
+/// array
+///
+///   ["foo", "foo", "foo", null, "bar", "bar"]
+///
+/// would have the run-end encoded representation
+///
+///   run_ends: [3, 4, 6]
+///   values: ["foo", null, "bar"]
+///
+/// The array offset and length are logical: slicing only adjusts them, the
+/// children are left untouched.  The array itself has no validity bitmap and a
+/// null count of 0; null values are stored as null run values.
+class ARROW_EXPORT RunEndEncodedArray : public Array {
+ public:
+  using TypeClass = RunEndEncodedType;
+
+  explicit RunEndEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  RunEndEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     const std::shared_ptr<Array>& run_ends,
+                     const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct a RunEndEncodedArray from run ends and values and
+  /// validate it
+  ///
+  /// \param[in] logical_length the logical length of the array
+  /// \param[in] run_ends strictly increasing int16, int32 or int64 run ends,
+  /// without nulls
+  /// \param[in] values the values of the runs, as many as run ends
+  /// \param[in] logical_offset the logical offset of the array
+  static Result<std::shared_ptr<RunEndEncodedArray>> Make(
+      int64_t logical_length, const std::shared_ptr<Array>& run_ends,
+      const std::shared_ptr<Array>& values, int64_t logical_offset = 0);
+
+  /// \brief Return the run ends, ignoring the array offset and length
+  const std::shared_ptr<Array>& run_ends() const { return run_ends_; }
+
+  /// \brief Return the run values, ignoring the array offset and length
+  const std::shared_ptr<Array>& values() const { return values_; }
+
+  /// \brief Return the index of the first run overlapping the array
+  int64_t FindPhysicalOffset() const;
+
+  /// \brief Return the number of runs overlapping the array
+  int64_t FindPhysicalLength() const;
+
+  const RunEndEncodedType* run_end_encoded_type() const {
+    return static_cast<const RunEndEncodedType*>(data_->type.get());
+  }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+ private:
+  std::shared_ptr<Array> run_ends_;
+  std::shared_ptr<Array> values_;
+};
+
+}  // namespace arrow
@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_run_end.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/pretty_print.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+// ----------------------------------------------------------------------
+// Run-end encoded array tests
+
+class TestRunEndEncodedArray
+    : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  void SetUp() override { run_end_type_ = GetParam(); }
+
+  std::shared_ptr<RunEndEncodedArray> Make(const std::string& run_ends_json,
+                                           const std::string& values_json,
+                                           int64_t length, int64_t offset = 0) {
+    auto run_ends = ArrayFromJSON(run_end_type_, run_ends_json);
+    auto values = ArrayFromJSON(utf8(), values_json);
+    auto result = RunEndEncodedArray::Make(length, run_ends, values, offset);
+    ARROW_EXPECT_OK(result.status());
+    return result.ValueOrDie();
+  }
+
+  std::shared_ptr<DataType> run_end_type_;
+};
+
+TEST_P(TestRunEndEncodedArray, MakeAndAccessors) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(array->length(), 6);
+  ASSERT_EQ(array->null_count(), 0);
+  ASSERT_EQ(array->type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_EQ(array->FindPhysicalOffset(), 0);
+  ASSERT_EQ(array->FindPhysicalLength(), 3);
+  ASSERT_TRUE(array->run_end_encoded_type()->run_end_type()->Equals(run_end_type_));
+  ASSERT_TRUE(array->run_end_encoded_type()->value_type()->Equals(utf8()));
+
+  // Slicing is logical
+  auto slice = checked_pointer_cast<RunEndEncodedArray>(array->Slice(2, 3));
+  ASSERT_OK(slice->ValidateFull());
+  ASSERT_EQ(slice->FindPhysicalOffset(), 0);
+  ASSERT_EQ(slice->FindPhysicalLength(), 3);
+  slice = checked_pointer_cast<RunEndEncodedArray>(array->Slice(3, 1));
+  ASSERT_EQ(slice->FindPhysicalOffset(), 1);
+  ASSERT_EQ(slice->FindPhysicalLength(), 1);
+  slice = checked_pointer_cast<RunEndEncodedArray>(array->Slice(6, 0));
+  ASSERT_EQ(slice->FindPhysicalLength(), 0);
+
+  // The array may end before the last run end
+  ASSERT_OK(Make("[3, 4, 6]", R"(["foo", null, "bar"])", 5)->ValidateFull());
+  ASSERT_OK(Make("[3, 4, 6]", R"(["foo", null, "bar"])", 2, 3)->ValidateFull());
+}
+
+TEST_P(TestRunEndEncodedArray, GetScalar) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  auto type = array->type();
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto scalar, array->GetScalar(i));
+    AssertScalarsEqual(RunEndEncodedScalar(MakeScalar("foo"), type), *scalar);
+  }
+  ASSERT_OK_AND_ASSIGN(auto scalar, array->GetScalar(3));
+  ASSERT_FALSE(checked_cast<const RunEndEncodedScalar&>(*scalar).value->is_valid);
+  ASSERT_OK_AND_ASSIGN(scalar, array->Slice(4)->GetScalar(1));
+  AssertScalarsEqual(RunEndEncodedScalar(MakeScalar("bar"), type), *scalar);
+}
+
+TEST_P(TestRunEndEncodedArray, Validate) {
+  auto values = ArrayFromJSON(utf8(), R"(["foo", null, "bar"])");
+  auto type = run_end_encoded(run_end_type_, utf8());
+
+  // Not enough logical values
+  RunEndEncodedArray too_short(type, 7, ArrayFromJSON(run_end_type_, "[3, 4, 6]"),
+                               values);
+  ASSERT_RAISES(Invalid, too_short.Validate());
+  // Run ends and values of different lengths
+  RunEndEncodedArray mismatch(type, 4, ArrayFromJSON(run_end_type_, "[3, 4]"), values);
+  ASSERT_RAISES(Invalid, mismatch.Validate());
+  // Null run ends
+  RunEndEncodedArray null_run_end(type, 6,
+                                  ArrayFromJSON(run_end_type_, "[3, null, 6]"), values);
+  ASSERT_RAISES(Invalid, null_run_end.Validate());
+  // Run ends not strictly increasing, only caught by full validation
+  RunEndEncodedArray not_increasing(type, 6, ArrayFromJSON(run_end_type_, "[3, 3, 6]"),
+                                    values);
+  ASSERT_OK(not_increasing.Validate());
+  ASSERT_RAISES(Invalid, not_increasing.ValidateFull());
+  RunEndEncodedArray not_positive(type, 6, ArrayFromJSON(run_end_type_, "[0, 4, 6]"),
+                                  values);
+  ASSERT_RAISES(Invalid, not_positive.ValidateFull());
+
+  // Invalid run end type
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(int8(), utf8()));
+  ASSERT_RAISES(TypeError, RunEndEncodedType::Make(uint32(), utf8()));
+}
+
+TEST_P(TestRunEndEncodedArray, Equals) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  // Same logical values, with differently split runs
+  auto split = Make("[1, 3, 4, 5, 6]", R"(["foo", "foo", null, "bar", "bar"])", 6);
+  AssertArraysEqual(*array, *split);
+  AssertArraysEqual(*array->Slice(2, 3), *split->Slice(2, 3));
+  ASSERT_TRUE(array->RangeEquals(4, 6, 4, split));
+
+  auto other = Make("[3, 4, 6]", R"(["foo", "baz", "bar"])", 6);
+  ASSERT_FALSE(array->Equals(other));
+  ASSERT_TRUE(array->RangeEquals(4, 6, 4, other));
+  ASSERT_FALSE(array->Slice(2)->Equals(other->Slice(2)));
+  ASSERT_TRUE(array->Slice(4)->Equals(other->Slice(4)));
+
+  // Different run end types
+  auto run_ends = ArrayFromJSON(
+      run_end_type_->id() == Type::INT64 ? int32() : int64(), "[3, 4, 6]");
+  ASSERT_OK_AND_ASSIGN(auto widened,
+                       RunEndEncodedArray::Make(6, run_ends, array->values()));
+  ASSERT_FALSE(array->Equals(widened));
+}
+
+TEST_P(TestRunEndEncodedArray, Builder) {
+  auto type = run_end_encoded(run_end_type_, utf8());
+  std::unique_ptr<ArrayBuilder> tmp;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), type, &tmp));
+  auto builder = checked_cast<RunEndEncodedBuilder*>(tmp.get());
+  auto value_builder = checked_cast<StringBuilder*>(builder->value_builder());
+
+  ASSERT_OK(builder->AppendRun(3));
+  ASSERT_OK(value_builder->Append("foo"));
+  ASSERT_OK(builder->AppendNulls(1));
+  ASSERT_OK(builder->AppendRun(2));
+  ASSERT_OK(value_builder->Append("bar"));
+  ASSERT_OK(builder->AppendEmptyValues(0));
+  ASSERT_EQ(builder->length(), 6);
+  ASSERT_EQ(builder->num_runs(), 3);
+  ASSERT_RAISES(Invalid, builder->AppendRun(0));
+
+  std::shared_ptr<RunEndEncodedArray> array;
+  ASSERT_OK(builder->Finish(&array));
+  ASSERT_OK(array->ValidateFull());
+  AssertArraysEqual(*Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6), *array);
+  ASSERT_EQ(builder->length(), 0);
+
+  // Values must be appended for each run
+  ASSERT_OK(builder->AppendRun(2));
+  ASSERT_RAISES(Invalid, builder->Finish(&array));
+}
+
+TEST_P(TestRunEndEncodedArray, BuilderCapacity) {
+  if (run_end_type_->id() != Type::INT16) {
+    return;
+  }
+  RunEndEncodedBuilder builder(default_memory_pool(), std::make_shared<StringBuilder>(),
+                               run_end_encoded(int16(), utf8()));
+  ASSERT_OK(builder.AppendNulls(std::numeric_limits<int16_t>::max() - 1));
+  ASSERT_OK(builder.AppendNulls(1));
+  ASSERT_RAISES(CapacityError, builder.AppendNulls(1));
+}
+
+TEST_P(TestRunEndEncodedArray, Concatenate) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       Concatenate({array->Slice(1, 2), array, array->Slice(4)}));
+  ASSERT_OK(concatenated->ValidateFull());
+  auto expected = Make("[2, 5, 6, 8, 10]", R"(["foo", "foo", null, "bar", "bar"])", 10);
+  AssertArraysEqual(*expected, *concatenated);
+}
+
+TEST_P(TestRunEndEncodedArray, MakeArrayOfNullAndFromScalar) {
+  auto type = run_end_encoded(run_end_type_, utf8());
+  ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(type, 5));
+  ASSERT_OK(nulls->ValidateFull());
+  AssertArraysEqual(*Make("[5]", "[null]", 5), *nulls);
+
+  RunEndEncodedScalar scalar(MakeScalar("foo"), type);
+  ASSERT_OK_AND_ASSIGN(auto repeated, MakeArrayFromScalar(scalar, 4));
+  ASSERT_OK(repeated->ValidateFull());
+  AssertArraysEqual(*Make("[4]", R"(["foo"])", 4), *repeated);
+}
+
+TEST_P(TestRunEndEncodedArray, LogicalRunEnds) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  ASSERT_OK_AND_ASSIGN(auto run_ends, ree_util::MakeLogicalRunEnds(*array->data()));
+  AssertArraysEqual(*ArrayFromJSON(run_end_type_, "[3, 4, 6]"), *MakeArray(run_ends));
+  ASSERT_OK_AND_ASSIGN(run_ends,
+                       ree_util::MakeLogicalRunEnds(*array->Slice(2, 3)->data()));
+  AssertArraysEqual(*ArrayFromJSON(run_end_type_, "[1, 2, 3]"), *MakeArray(run_ends));
+}
+
+TEST_P(TestRunEndEncodedArray, PrettyPrint) {
+  auto array = Make("[3, 4, 6]", R"(["foo", null, "bar"])", 6);
+  std::stringstream ss;
+  ASSERT_OK(PrettyPrint(*array->Slice(3), {}, &ss));
+  const std::string printed = ss.str();
+  ASSERT_NE(printed.find("-- run_ends:"), std::string::npos);
+  ASSERT_NE(printed.find("-- values:"), std::string::npos);
+  // Only the runs overlapping the slice are printed
+  ASSERT_EQ(printed.find("foo"), std::string::npos);
+  ASSERT_NE(printed.find("bar"), std::string::npos);
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncodedArray,
+                         ::testing::Values(int16(), int32(), int64()));
+
+}  // namespace arrow
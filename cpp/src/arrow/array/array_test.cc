@@ -247,6 +247,37 @@ TEST_F(TestArray, SliceRecomputeNullCount) {
   ASSERT_EQ(0, arr->null_count());
 }
 
+TEST_F(TestArray, ValiditySummary) {
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto array = rng.Int32(/*size=*/100000, /*min=*/0, /*max=*/100,
+                         /*null_probability=*/0.1);
+  auto& data = *array->data();
+  ASSERT_EQ(data.GetCachedValiditySummary(), nullptr);
+
+  // Computing the null count of a long array caches the summary
+  data.SetNullCount(kUnknownNullCount);
+  const int64_t null_count = data.GetNullCount();
+  auto summary = data.GetCachedValiditySummary();
+  ASSERT_NE(summary, nullptr);
+  ASSERT_EQ(summary, data.GetValiditySummary());
+  ASSERT_EQ(summary->length(), data.length);
+  ASSERT_EQ(summary->popcount(), data.length - null_count);
+
+  // Slices compute their own summary
+  auto slice = array->Slice(3, 50000)->data();
+  ASSERT_EQ(slice->GetCachedValiditySummary(), nullptr);
+  auto slice_summary = slice->GetValiditySummary();
+  ASSERT_EQ(slice_summary->popcount(), slice->length - slice->GetNullCount());
+
+  // A stale summary isn't returned
+  slice->offset += 1;
+  ASSERT_EQ(slice->GetCachedValiditySummary(), nullptr);
+
+  // No validity bitmap, no summary
+  auto no_nulls = std::make_shared<Int32Array>(data.length, data.buffers[1]);
+  ASSERT_EQ(no_nulls->data()->GetValiditySummary(), nullptr);
+}
+
 TEST_F(TestArray, NullArraySliceNullCount) {
   auto null_arr = std::make_shared<NullArray>(10);
   auto null_arr_sliced = null_arr->Slice(3, 6);
@@ -592,6 +623,56 @@ TEST_F(TestBuilder, TestResizeDownsize) {
   ASSERT_EQ(500, builder.length());
 }
 
+TEST_F(TestBuilder, AppendArraySlice) {
+  std::vector<std::shared_ptr<Array>> arrays = {
+      ArrayFromJSON(null(), "[null, null, null, null, null, null]"),
+      ArrayFromJSON(boolean(), "[true, null, false, true, false, null]"),
+      ArrayFromJSON(int8(), "[1, 2, null, 4, 5, null]"),
+      ArrayFromJSON(float64(), "[1.5, null, 3.5, 4.5, null, 6.5]"),
+      ArrayFromJSON(timestamp(TimeUnit::MILLI), "[1, null, 3, 4, 5, 6]"),
+      ArrayFromJSON(utf8(), R"(["a", "bb", null, "", "ddd", "e"])"),
+      ArrayFromJSON(large_binary(), R"(["a", null, "ccc", "", "dd", null])"),
+      ArrayFromJSON(utf8_view(), R"(["a", "a long string value", null, "", "d", "e"])"),
+      ArrayFromJSON(fixed_size_binary(2), R"(["ab", null, "cd", "ef", null, "gh"])"),
+      ArrayFromJSON(decimal(5, 2), R"(["1.23", null, "4.56", "7.89", "0.01", null])"),
+      ArrayFromJSON(list(int32()), "[[1, 2], null, [], [3], [4, null, 5], [6]]"),
+      ArrayFromJSON(large_list(utf8()), R"([["a"], [], null, ["b", "c"], ["d"], []])"),
+      ArrayFromJSON(fixed_size_list(int16(), 2), "[[1, 2], null, [3, 4], [5, null], "
+                                                 "[7, 8], [9, 10]]"),
+      ArrayFromJSON(struct_({field("a", int32()), field("b", utf8())}),
+                    R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "y"},
+                        {"a": 4, "b": null}, {"a": 5, "b": "z"}, null])"),
+      ArrayFromJSON(map(utf8(), int64()), R"([[["a", 1]], null, [], [["b", 2], ["c", 3]],
+                                              [["d", null]], []])"),
+      DictArrayFromJSON(dictionary(int8(), utf8()), "[0, 1, null, 2, 0, 1]",
+                        R"(["x", "y", "z"])"),
+  };
+
+  for (const auto& array : arrays) {
+    SCOPED_TRACE(array->type()->ToString());
+    // Slice the input too, to exercise the handling of the array offset
+    const auto input = array->Slice(1);
+
+    std::unique_ptr<ArrayBuilder> builder;
+    ASSERT_OK(MakeBuilder(pool_, array->type(), &builder));
+    ASSERT_OK(builder->AppendArraySlice(*input->data(), 0, 2));
+    ASSERT_OK(builder->AppendArraySlice(*input->data(), 2, 0));
+    ASSERT_OK(builder->AppendArraySlice(*input->data(), 2, 3));
+    ASSERT_EQ(5, builder->length());
+    ASSERT_EQ(input->null_count(), builder->null_count());
+
+    ASSERT_OK_AND_ASSIGN(auto result, builder->Finish());
+    ASSERT_OK(result->ValidateFull());
+    AssertArraysEqual(*input, *result, /*verbose=*/true);
+  }
+}
+
+TEST_F(TestBuilder, AppendArraySliceNotImplemented) {
+  auto array = ArrayFromJSON(int16(), "[1, 2, 3]");
+  AdaptiveIntBuilder builder(pool_);
+  ASSERT_RAISES(NotImplemented, builder.AppendArraySlice(*array->data(), 0, 3));
+}
+
 template <typename Attrs>
 class TestPrimitiveBuilder : public TestBuilder {
  public:
@@ -1616,6 +1697,40 @@ void CheckFloatingInfinityEquality() {
   }
 }
 
+template <typename TYPE>
+void CheckFloatingEqualityLongArrays() {
+  using c_type = typename TYPE::c_type;
+  std::shared_ptr<Array> a, b;
+  std::shared_ptr<DataType> type = TypeTraits<TYPE>::type_singleton();
+
+  // Enough values to span several comparison blocks, with a null every 7 values
+  const int64_t length = 1000;
+  std::vector<bool> is_valid(length);
+  std::vector<c_type> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = (i % 7 != 0);
+    values[i] = static_cast<c_type>(i) / 4;
+  }
+  ArrayFromVector<TYPE>(type, is_valid, values, &a);
+  for (int64_t i : {0, 5, 700}) {
+    std::vector<c_type> other_values = values;
+    other_values[i] += 1;
+    ArrayFromVector<TYPE>(type, is_valid, other_values, &b);
+    // Only index 0 and 700 are null
+    const bool expected = (i % 7 == 0);
+    ASSERT_EQ(a->Equals(b), expected);
+    ASSERT_EQ(a->Equals(b, EqualOptions().nans_equal(true)), expected);
+    ASSERT_EQ(a->ApproxEquals(b), expected);
+    ASSERT_TRUE(a->ApproxEquals(b, EqualOptions().atol(2)));
+    ASSERT_TRUE(a->RangeEquals(b, i + 1, length, i + 1));
+  }
+}
+
+TEST(TestPrimitiveAdHoc, FloatingEqualityLongArrays) {
+  CheckFloatingEqualityLongArrays<FloatType>();
+  CheckFloatingEqualityLongArrays<DoubleType>();
+}
+
 TEST(TestPrimitiveAdHoc, FloatingApproxEquals) {
   CheckApproxEquals<FloatType>();
   CheckApproxEquals<DoubleType>();
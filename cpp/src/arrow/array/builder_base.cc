@@ -92,6 +92,11 @@ Status ArrayBuilder::Advance(int64_t elements) {
   return null_bitmap_builder_.Advance(elements);
 }
 
+Status ArrayBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                      int64_t length) {
+  return Status::NotImplemented("AppendArraySlice for builder of type ", *type());
+}
+
 Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<ArrayData> internal_data;
   RETURN_NOT_OK(FinishInternal(&internal_data));
@@ -116,6 +116,17 @@ class ARROW_EXPORT ArrayBuilder {
   /// This method is useful when appending null values to a parent nested type.
   virtual Status AppendEmptyValues(int64_t length) = 0;
 
+  /// \brief Append a range of values from an array
+  ///
+  /// The array must have the same type as the builder.  Builders implementing
+  /// this copy the values and validity bits in bulk rather than one by one.
+  ///
+  /// \param[in] array the array data to copy from
+  /// \param[in] offset the first value to copy, relative to the array's offset
+  /// \param[in] length the number of values to copy
+  virtual Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                                  int64_t length);
+
   /// For cases where raw data was memcpy'd into the internal buffers, allows us
   /// to advance the length of the builder. It is your responsibility to use
   /// this function responsibly.
@@ -182,6 +193,17 @@ class ARROW_EXPORT ArrayBuilder {
     null_count_ = null_bitmap_builder_.false_count();
   }
 
+  // Append validity bits copied from a bitmap. If bitmap is null assume all
+  // of length bits are valid.
+  void UnsafeAppendToBitmap(const uint8_t* bitmap, int64_t offset, int64_t length) {
+    if (bitmap == NULLPTR) {
+      return UnsafeSetNotNull(length);
+    }
+    null_bitmap_builder_.UnsafeAppend(bitmap, offset, length);
+    length_ += length;
+    null_count_ = null_bitmap_builder_.false_count();
+  }
+
   // Append the same validity value a given number of times.
   void UnsafeAppendToBitmap(const int64_t num_bits, bool value) {
     if (value) {
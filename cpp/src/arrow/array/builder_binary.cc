@@ -40,6 +40,142 @@ namespace arrow {
 
 using internal::checked_cast;
 
+// ----------------------------------------------------------------------
+// String views
+
+constexpr int64_t StringViewBuilder::kDefaultBlockSize;
+
+StringViewBuilder::StringViewBuilder(MemoryPool* pool, int64_t block_size)
+    : ArrayBuilder(pool),
+      block_size_(block_size),
+      views_builder_(pool),
+      current_block_(pool) {}
+
+Status StringViewBuilder::ReserveBlock(int64_t length) {
+  if (current_block_.capacity() - current_block_.length() >= length) {
+    return Status::OK();
+  }
+  if (current_block_.length() > 0) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(current_block_.Finish(&block));
+    blocks_.push_back(std::move(block));
+  }
+  return current_block_.Resize(std::max(length, block_size_));
+}
+
+Status StringViewBuilder::Append(const uint8_t* value, int64_t length) {
+  if (ARROW_PREDICT_FALSE(length > std::numeric_limits<int32_t>::max())) {
+    return Status::CapacityError("string view cannot hold a string of ", length,
+                                 " bytes");
+  }
+  RETURN_NOT_OK(Reserve(1));
+  int32_t buffer_index = 0, offset = 0;
+  if (length > StringViewType::kInlineSize) {
+    RETURN_NOT_OK(ReserveBlock(length));
+    if (ARROW_PREDICT_FALSE(blocks_.size() >=
+                            static_cast<size_t>(std::numeric_limits<int32_t>::max()))) {
+      return Status::CapacityError("too many data buffers in string view array");
+    }
+    buffer_index = static_cast<int32_t>(blocks_.size());
+    offset = static_cast<int32_t>(current_block_.length());
+    current_block_.UnsafeAppend(value, length);
+  }
+  UnsafeAppendToBitmap(true);
+  views_builder_.UnsafeAppend(
+      MakeView(value, static_cast<int32_t>(length), buffer_index, offset));
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(false);
+  views_builder_.UnsafeAppend(c_type{});
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendNulls(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(length, false);
+  views_builder_.UnsafeAppend(length, c_type{});
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendEmptyValue() {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(true);
+  views_builder_.UnsafeAppend(c_type{});
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendEmptyValues(int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(length, true);
+  views_builder_.UnsafeAppend(length, c_type{});
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendValues(const std::vector<std::string>& values,
+                                       const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(values.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (valid_bytes == NULLPTR || valid_bytes[i]) {
+      RETURN_NOT_OK(Append(values[i]));
+    } else {
+      RETURN_NOT_OK(AppendNull());
+    }
+  }
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                           int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  const StringViewArray values(array.Copy());
+  for (int64_t i = offset; i < offset + length; ++i) {
+    if (values.IsValid(i)) {
+      RETURN_NOT_OK(Append(values.GetView(i)));
+    } else {
+      RETURN_NOT_OK(AppendNull());
+    }
+  }
+  return Status::OK();
+}
+
+void StringViewBuilder::Reset() {
+  ArrayBuilder::Reset();
+  views_builder_.Reset();
+  current_block_.Reset();
+  blocks_.clear();
+}
+
+Status StringViewBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(CheckCapacity(capacity));
+  RETURN_NOT_OK(views_builder_.Resize(capacity));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status StringViewBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> null_bitmap, views;
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(views_builder_.Finish(&views));
+  if (current_block_.length() > 0) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(current_block_.Finish(&block));
+    blocks_.push_back(std::move(block));
+  }
+  current_block_.Reset();
+
+  BufferVector buffers = {std::move(null_bitmap), std::move(views)};
+  for (auto& block : blocks_) {
+    buffers.push_back(std::move(block));
+  }
+  blocks_.clear();
+  *out = ArrayData::Make(type(), length_, std::move(buffers), null_count_);
+
+  capacity_ = length_ = null_count_ = 0;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -60,6 +196,15 @@ Status FixedSizeBinaryBuilder::AppendValues(const uint8_t* data, int64_t length,
   return byte_builder_.Append(data, length * byte_width_);
 }
 
+Status FixedSizeBinaryBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                                int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+  return byte_builder_.Append(
+      array.GetValues<uint8_t>(1, (array.offset + offset) * byte_width_),
+      length * byte_width_);
+}
+
 Status FixedSizeBinaryBuilder::AppendNull() {
   RETURN_NOT_OK(Reserve(1));
   UnsafeAppendNull();
@@ -151,8 +151,7 @@ class BaseBinaryBuilder : public ArrayBuilder {
         values.begin(), values.end(), 0ULL,
         [](uint64_t sum, const std::string& str) { return sum + str.size(); });
     ARROW_RETURN_NOT_OK(Reserve(values.size()));
-    ARROW_RETURN_NOT_OK(value_data_builder_.Reserve(total_length));
-    ARROW_RETURN_NOT_OK(offsets_builder_.Reserve(values.size()));
+    ARROW_RETURN_NOT_OK(ReserveData(total_length));
 
     if (valid_bytes != NULLPTR) {
       for (std::size_t i = 0; i < values.size(); ++i) {
@@ -174,6 +173,38 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of string views in one shot.
+  ///
+  /// The total data size is computed upfront, so that the values are then
+  /// copied without any further capacity check.
+  ///
+  /// \param[in] values a contiguous C array of string views
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const util::string_view* values, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR) {
+    int64_t total_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      if (valid_bytes == NULLPTR || valid_bytes[i]) {
+        total_length += static_cast<int64_t>(values[i].size());
+      }
+    }
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(total_length));
+
+    for (int64_t i = 0; i < length; ++i) {
+      UnsafeAppendNextOffset();
+      if (valid_bytes == NULLPTR || valid_bytes[i]) {
+        value_data_builder_.UnsafeAppend(
+            reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
+      }
+    }
+    UnsafeAppendToBitmap(valid_bytes, length);
+    return Status::OK();
+  }
+
   /// \brief Append a sequence of nul-terminated strings in one shot.
   ///        If one of the values is NULL, it is processed as a null
   ///        value even if the corresponding valid_bytes entry is 1.
@@ -241,6 +272,29 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    if (length == 0) return Status::OK();
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
+    const int64_t data_start = offsets[0];
+    const int64_t data_length = offsets[length] - data_start;
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(data_length));
+
+    // Rebase the offsets onto the data appended so far, then copy the data
+    // in one go
+    const int64_t delta = value_data_builder_.length() - data_start;
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + delta));
+    }
+    if (data_length > 0) {
+      value_data_builder_.UnsafeAppend(array.GetValues<uint8_t>(2, data_start),
+                                       data_length);
+    }
+    UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -409,6 +463,97 @@ class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
   std::shared_ptr<DataType> type() const override { return large_utf8(); }
 };
 
+// ----------------------------------------------------------------------
+// StringViewBuilder
+
+/// \class StringViewBuilder
+/// \brief Builder class for UTF8 strings stored as views
+///
+/// Strings too long to be inlined in their view are copied to data buffers of
+/// (at least) `block_size` bytes, a new one being started when a string doesn't
+/// fit in the current one.
+class ARROW_EXPORT StringViewBuilder : public ArrayBuilder {
+ public:
+  using TypeClass = StringViewType;
+  using c_type = StringViewType::c_type;
+
+  static constexpr int64_t kDefaultBlockSize = 32 * 1024;
+
+  explicit StringViewBuilder(MemoryPool* pool = default_memory_pool(),
+                             int64_t block_size = kDefaultBlockSize);
+
+  StringViewBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : StringViewBuilder(pool) {}
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(util::string_view value) { return Append(value.data(), value.size()); }
+
+  Status AppendNull() final;
+  Status AppendNulls(int64_t length) final;
+
+  Status AppendEmptyValue() final;
+  Status AppendEmptyValues(int64_t length) final;
+
+  /// \brief Append a sequence of strings in one shot.
+  ///
+  /// \param[in] values a vector of strings
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const std::vector<std::string>& values,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<StringViewArray>* out) { return FinishTyped(out); }
+
+  std::shared_ptr<DataType> type() const override { return utf8_view(); }
+
+  /// \brief Make the view of a string
+  ///
+  /// If the string is not inlined, its data is expected at the given offset of
+  /// the given data buffer.
+  static c_type MakeView(const uint8_t* value, int32_t length, int32_t buffer_index,
+                         int32_t offset) {
+    c_type view;
+    std::memset(&view, 0, sizeof(view));
+    view.inlined.size = length;
+    if (length <= StringViewType::kInlineSize) {
+      if (length > 0) {
+        std::memcpy(view.inlined.data, value, length);
+      }
+    } else {
+      std::memcpy(view.ref.prefix, value, StringViewType::kPrefixSize);
+      view.ref.buffer_index = buffer_index;
+      view.ref.offset = offset;
+    }
+    return view;
+  }
+
+ protected:
+  /// \brief Ensure the current data buffer has room for `length` more bytes
+  Status ReserveBlock(int64_t length);
+
+  int64_t block_size_;
+  TypedBufferBuilder<c_type> views_builder_;
+  BufferBuilder current_block_;
+  std::vector<std::shared_ptr<Buffer>> blocks_;
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
@@ -452,6 +597,9 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
   Status AppendValues(const uint8_t* data, int64_t length,
                       const uint8_t* valid_bytes = NULLPTR);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status AppendNull() final;
   Status AppendNulls(int64_t length) final;
 
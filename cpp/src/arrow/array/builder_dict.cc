@@ -88,6 +88,35 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
     }
   };
 
+  // Type-dependent visitor for memo table lookup or insertion of a whole array
+  struct ArrayValuesGetOrInserter {
+    MemoTable* memo_table_;
+    const Array& values_;
+    int32_t* out_;
+
+    template <typename T>
+    enable_if_no_memoize<T, Status> Visit(const T& type) {
+      return Status::NotImplemented("Inserting array values of ", type,
+                                    " is not implemented");
+    }
+
+    template <typename T>
+    enable_if_memoize<T, Status> Visit(const T&) {
+      using ConcreteMemoTable = typename DictionaryTraits<T>::MemoTableType;
+      auto memo_table = checked_cast<ConcreteMemoTable*>(memo_table_);
+      int32_t* out = out_;
+      return VisitArrayDataInline<T>(
+          *values_.data(),
+          [&](typename DictionaryValue<T>::type value) {
+            return memo_table->GetOrInsert(value, out++);
+          },
+          [&]() {
+            *out++ = 0;
+            return Status::OK();
+          });
+    }
+  };
+
   // Type-dependent visitor for building ArrayData from memo table
   struct ArrayDataGetter {
     std::shared_ptr<DataType> value_type_;
@@ -127,6 +156,15 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
     return VisitTypeInline(*array.type(), &visitor);
   }
 
+  Status GetOrInsert(const Array& array, int32_t* out) {
+    if (!array.type()->Equals(*type_)) {
+      return Status::Invalid("Array value type does not match memo type: ",
+                             array.type()->ToString());
+    }
+    ArrayValuesGetOrInserter visitor{memo_table_.get(), array, out};
+    return VisitTypeInline(*array.type(), &visitor);
+  }
+
   template <typename PhysicalType,
             typename CType = typename DictionaryValue<PhysicalType>::type>
   Status GetOrInsert(CType value, int32_t* out) {
@@ -198,6 +236,10 @@ Status DictionaryMemoTable::InsertValues(const Array& array) {
   return impl_->InsertValues(array);
 }
 
+Status DictionaryMemoTable::GetOrInsert(const Array& values, int32_t* out_indices) {
+  return impl_->GetOrInsert(values, out_indices);
+}
+
 int32_t DictionaryMemoTable::size() const { return impl_->size(); }
 
 }  // namespace internal
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_binary.h"
@@ -32,6 +33,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
@@ -75,6 +77,15 @@ class ARROW_EXPORT DictionaryMemoTable {
   /// \brief Insert new memo values
   Status InsertValues(const Array& values);
 
+  /// \brief Get or insert the memo index of each value of an array
+  ///
+  /// The memo table type is resolved once for the whole array rather than once
+  /// per value.  The index of null values is set to 0.
+  ///
+  /// \param[in] values the values to look up. Type must match the memo type
+  /// \param[out] out_indices the memo indices, as many as there are values
+  Status GetOrInsert(const Array& values, int32_t* out_indices);
+
   int32_t size() const;
 
   template <typename T>
@@ -291,43 +302,65 @@ class DictionaryBuilderBase : public ArrayBuilder {
   }
 
   /// \brief Append a whole dense array to the builder
-  template <typename T1 = T>
-  enable_if_t<!is_fixed_size_binary_type<T1>::value, Status> AppendArray(
-      const Array& array) {
-    using ArrayType = typename TypeTraits<T>::ArrayType;
-
+  Status AppendArray(const Array& array) {
 #ifndef NDEBUG
     ARROW_RETURN_NOT_OK(ArrayBuilder::CheckArrayType(
         value_type_, array, "Wrong value type of array to be appended"));
 #endif
 
-    const auto& concrete_array = static_cast<const ArrayType&>(array);
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (array.IsNull(i)) {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      } else {
-        ARROW_RETURN_NOT_OK(Append(concrete_array.GetView(i)));
+    const int64_t length = array.length();
+    std::vector<int32_t> memo_indices(length);
+    ARROW_RETURN_NOT_OK(memo_table_->GetOrInsert(array, memo_indices.data()));
+
+    std::vector<uint8_t> valid_bytes;
+    if (array.null_count() > 0) {
+      valid_bytes.resize(length);
+      for (int64_t i = 0; i < length; ++i) {
+        valid_bytes[i] = array.IsValid(i);
       }
     }
-    return Status::OK();
+    return AppendMemoIndices(memo_indices.data(), length,
+                             valid_bytes.empty() ? NULLPTR : valid_bytes.data());
   }
 
-  template <typename T1 = T>
-  enable_if_fixed_size_binary<T1, Status> AppendArray(const Array& array) {
-#ifndef NDEBUG
-    ARROW_RETURN_NOT_OK(ArrayBuilder::CheckArrayType(
-        value_type_, array, "Wrong value type of array to be appended"));
-#endif
-
-    const auto& concrete_array = static_cast<const FixedSizeBinaryArray&>(array);
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (array.IsNull(i)) {
-        ARROW_RETURN_NOT_OK(AppendNull());
-      } else {
-        ARROW_RETURN_NOT_OK(Append(concrete_array.GetValue(i)));
-      }
+  /// \brief Append a slice of a dictionary array with the same value type
+  ///
+  /// All the values of the input dictionary are looked up (and inserted if
+  /// needed) in the memo at once, then the input indices are remapped.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    const auto dictionary = MakeArray(array.dictionary);
+    std::vector<int32_t> transpose_map(dictionary->length());
+    ARROW_RETURN_NOT_OK(memo_table_->GetOrInsert(*dictionary, transpose_map.data()));
+
+    std::vector<int32_t> memo_indices(length);
+    std::vector<uint8_t> valid_bytes(length);
+    const auto& dict_type = checked_cast<const DictionaryType&>(*array.type);
+    switch (dict_type.index_type()->id()) {
+      case Type::UINT8:
+      case Type::INT8:
+        RemapIndices<uint8_t>(array, offset, length, *dictionary, transpose_map.data(),
+                              memo_indices.data(), valid_bytes.data());
+        break;
+      case Type::UINT16:
+      case Type::INT16:
+        RemapIndices<uint16_t>(array, offset, length, *dictionary, transpose_map.data(),
+                               memo_indices.data(), valid_bytes.data());
+        break;
+      case Type::UINT32:
+      case Type::INT32:
+        RemapIndices<uint32_t>(array, offset, length, *dictionary, transpose_map.data(),
+                               memo_indices.data(), valid_bytes.data());
+        break;
+      case Type::UINT64:
+      case Type::INT64:
+        RemapIndices<uint64_t>(array, offset, length, *dictionary, transpose_map.data(),
+                               memo_indices.data(), valid_bytes.data());
+        break;
+      default:
+        return Status::TypeError("Invalid index type: ", *dict_type.index_type());
     }
-    return Status::OK();
+    return AppendMemoIndices(memo_indices.data(), length, valid_bytes.data());
   }
 
   void Reset() override {
@@ -385,6 +418,46 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return Status::OK();
   }
 
+  // Valid indices are non-negative, so they can be read as unsigned
+  template <typename IndexCType>
+  static void RemapIndices(const ArrayData& array, int64_t offset, int64_t length,
+                           const Array& dictionary, const int32_t* transpose_map,
+                           int32_t* out_indices, uint8_t* out_valid_bytes) {
+    const IndexCType* indices = array.GetValues<IndexCType>(1) + offset;
+    const uint8_t* bitmap = array.GetValues<uint8_t>(0, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      const auto index = static_cast<int64_t>(indices[i]);
+      const bool is_valid =
+          (bitmap == NULLPTR || BitUtil::GetBit(bitmap, array.offset + offset + i)) &&
+          dictionary.IsValid(index);
+      out_valid_bytes[i] = is_valid;
+      out_indices[i] = is_valid ? transpose_map[index] : 0;
+    }
+  }
+
+  Status AppendMemoIndices(const int32_t* memo_indices, int64_t length,
+                           const uint8_t* valid_bytes) {
+    int64_t null_count_before = indices_builder_.null_count();
+    ARROW_RETURN_NOT_OK(
+        AppendIndexValues(&indices_builder_, memo_indices, length, valid_bytes));
+    capacity_ = indices_builder_.capacity();
+    length_ += length;
+    null_count_ += indices_builder_.null_count() - null_count_before;
+    return Status::OK();
+  }
+
+  static Status AppendIndexValues(AdaptiveIntBuilder* builder, const int32_t* values,
+                                  int64_t length, const uint8_t* valid_bytes) {
+    const std::vector<int64_t> wide_values(values, values + length);
+    return builder->AppendValues(wide_values.data(), length, valid_bytes);
+  }
+
+  template <typename IndexBuilder>
+  static Status AppendIndexValues(IndexBuilder* builder, const int32_t* values,
+                                  int64_t length, const uint8_t* valid_bytes) {
+    return builder->AppendValues(values, length, valid_bytes);
+  }
+
   Status FinishWithDictOffset(int64_t dict_offset,
                               std::shared_ptr<ArrayData>* out_indices,
                               std::shared_ptr<ArrayData>* out_dictionary) {
@@ -475,10 +548,11 @@ class DictionaryBuilderBase<BuilderType, NullType> : public ArrayBuilder {
     ARROW_RETURN_NOT_OK(ArrayBuilder::CheckArrayType(
         Type::NA, array, "Wrong value type of array to be appended"));
 #endif
-    for (int64_t i = 0; i < array.length(); i++) {
-      ARROW_RETURN_NOT_OK(AppendNull());
-    }
-    return Status::OK();
+    return AppendNulls(array.length());
+  }
+
+  Status AppendArraySlice(const ArrayData&, int64_t, int64_t length) override {
+    return AppendNulls(length);
   }
 
   Status Resize(int64_t capacity) override {
@@ -141,6 +141,16 @@ Status MapBuilder::AppendEmptyValues(int64_t length) {
   return Status::OK();
 }
 
+Status MapBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                    int64_t length) {
+  DCHECK_EQ(item_builder_->length(), key_builder_->length());
+  RETURN_NOT_OK(AdjustStructBuilderLength());
+  RETURN_NOT_OK(list_builder_->AppendArraySlice(array, offset, length));
+  length_ = list_builder_->length();
+  null_count_ = list_builder_->null_count();
+  return Status::OK();
+}
+
 Status MapBuilder::AdjustStructBuilderLength() {
   // If key/item builders have been appended, adjust struct builder length
   // to match. Struct and key are non-nullable, append all valid values.
@@ -225,6 +235,15 @@ Status FixedSizeListBuilder::AppendEmptyValues(int64_t length) {
   return value_builder_->AppendEmptyValues(list_size_ * length);
 }
 
+Status FixedSizeListBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                              int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+  return value_builder_->AppendArraySlice(*array.child_data[0],
+                                          (array.offset + offset) * list_size_,
+                                          length * list_size_);
+}
+
 Status FixedSizeListBuilder::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity));
   return ArrayBuilder::Resize(capacity);
@@ -262,6 +281,17 @@ void StructBuilder::Reset() {
   }
 }
 
+Status StructBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                       int64_t length) {
+  for (size_t i = 0; i < children_.size(); ++i) {
+    RETURN_NOT_OK(children_[i]->AppendArraySlice(*array.child_data[i],
+                                                 array.offset + offset, length));
+  }
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+  return Status::OK();
+}
+
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap;
   RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
@@ -135,4 +135,13 @@ Status BooleanBuilder::AppendValues(int64_t length, bool value) {
   return Status::OK();
 }
 
+Status BooleanBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                        int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  data_builder_.UnsafeAppend(array.buffers[1]->data(), array.offset + offset, length);
+  ArrayBuilder::UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0),
+                                     array.offset + offset, length);
+  return Status::OK();
+}
+
 }  // namespace arrow
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/builder_run_end.h"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace {
+
+int64_t MaxRunEnd(const DataType& run_end_type) {
+  switch (run_end_type.id()) {
+    case Type::INT16:
+      return std::numeric_limits<int16_t>::max();
+    case Type::INT32:
+      return std::numeric_limits<int32_t>::max();
+    default:
+      DCHECK_EQ(run_end_type.id(), Type::INT64);
+      return std::numeric_limits<int64_t>::max();
+  }
+}
+
+}  // namespace
+
+RunEndEncodedBuilder::RunEndEncodedBuilder(
+    MemoryPool* pool, const std::shared_ptr<ArrayBuilder>& value_builder,
+    const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(pool),
+      type_(type),
+      max_run_end_(
+          MaxRunEnd(*checked_cast<const RunEndEncodedType&>(*type).run_end_type())),
+      value_builder_(value_builder),
+      run_ends_builder_(pool) {
+  children_ = {value_builder};
+}
+
+Status RunEndEncodedBuilder::AppendRunEnd(int64_t run_length) {
+  if (ARROW_PREDICT_FALSE(run_length < 1)) {
+    return Status::Invalid("Run length must be positive, got ", run_length);
+  }
+  if (ARROW_PREDICT_FALSE(run_length > max_run_end_ - length_)) {
+    return Status::CapacityError("Run-end encoded array cannot be longer than ",
+                                 max_run_end_, " values with run end type ",
+                                 *checked_cast<const RunEndEncodedType&>(*type_)
+                                      .run_end_type());
+  }
+  length_ += run_length;
+  return run_ends_builder_.Append(length_);
+}
+
+Status RunEndEncodedBuilder::AppendRun(int64_t run_length) {
+  return AppendRunEnd(run_length);
+}
+
+Status RunEndEncodedBuilder::AppendNulls(int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(AppendRunEnd(length));
+  return value_builder_->AppendNull();
+}
+
+Status RunEndEncodedBuilder::AppendEmptyValues(int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(AppendRunEnd(length));
+  return value_builder_->AppendEmptyValue();
+}
+
+Status RunEndEncodedBuilder::Resize(int64_t capacity) {
+  if (capacity < num_runs()) {
+    return Status::Invalid("Resize cannot downsize (requested: ", capacity,
+                           ", current number of runs: ", num_runs(), ")");
+  }
+  RETURN_NOT_OK(run_ends_builder_.Reserve(capacity - num_runs()));
+  RETURN_NOT_OK(value_builder_->Reserve(capacity - value_builder_->length()));
+  capacity_ = capacity;
+  return Status::OK();
+}
+
+void RunEndEncodedBuilder::Reset() {
+  ArrayBuilder::Reset();
+  run_ends_builder_.Reset();
+  value_builder_->Reset();
+}
+
+Result<std::shared_ptr<ArrayData>> RunEndEncodedBuilder::FinishRunEnds() {
+  const auto& run_end_type =
+      checked_cast<const RunEndEncodedType&>(*type_).run_end_type();
+  if (run_end_type->id() != Type::INT64) {
+    // Run ends were checked against the run end type when appended
+    return ree_util::MakeRunEndsArray(run_end_type, run_ends_builder_.data(), num_runs(),
+                                      pool_);
+  }
+  const int64_t num_runs = this->num_runs();
+  std::shared_ptr<Buffer> run_ends;
+  RETURN_NOT_OK(run_ends_builder_.Finish(&run_ends));
+  return ArrayData::Make(run_end_type, num_runs, {nullptr, std::move(run_ends)},
+                         /*null_count=*/0);
+}
+
+Status RunEndEncodedBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (ARROW_PREDICT_FALSE(value_builder_->length() != num_runs())) {
+    return Status::Invalid("Run-end encoded builder has ", num_runs(),
+                           " runs but its value builder has ", value_builder_->length(),
+                           " values");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_data, FinishRunEnds());
+  std::shared_ptr<ArrayData> values;
+  RETURN_NOT_OK(value_builder_->FinishInternal(&values));
+
+  *out = ArrayData::Make(type_, length_, {nullptr},
+                         {std::move(run_ends_data), std::move(values)},
+                         /*null_count=*/0);
+  Reset();
+  return Status::OK();
+}
+
+}  // namespace arrow
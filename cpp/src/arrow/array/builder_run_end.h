@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// RunEndEncoded builder
+
+/// \class RunEndEncodedBuilder
+/// \brief Builder class for run-end encoded arrays
+///
+/// Values are appended by runs: AppendRun() starts a run of the given length,
+/// whose value must then be appended to the value builder.  Consecutive runs
+/// are not merged, even when their values are equal.
+///
+/// The length of the builder is the logical length of the array; its
+/// capacity is a number of runs.
+class ARROW_EXPORT RunEndEncodedBuilder : public ArrayBuilder {
+ public:
+  RunEndEncodedBuilder(MemoryPool* pool,
+                       const std::shared_ptr<ArrayBuilder>& value_builder,
+                       const std::shared_ptr<DataType>& type);
+
+  /// \brief Start a run of `run_length` values
+  ///
+  /// Exactly one value must then be appended to value_builder().
+  Status AppendRun(int64_t run_length);
+
+  /// \brief Append a null run of length 1
+  Status AppendNull() final { return AppendNulls(1); }
+  /// \brief Append a single null run of the given length
+  Status AppendNulls(int64_t length) final;
+
+  Status AppendEmptyValue() final { return AppendEmptyValues(1); }
+  /// \brief Append a single run of empty values of the given length
+  Status AppendEmptyValues(int64_t length) final;
+
+  int64_t length() const override { return length_; }
+
+  /// \brief The number of runs appended so far
+  int64_t num_runs() const { return run_ends_builder_.length(); }
+
+  Status Resize(int64_t capacity) override;
+  void Reset() override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \cond FALSE
+  using ArrayBuilder::Finish;
+  /// \endcond
+
+  Status Finish(std::shared_ptr<RunEndEncodedArray>* out) { return FinishTyped(out); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+  std::shared_ptr<DataType> type() const override { return type_; }
+
+ private:
+  Status AppendRunEnd(int64_t run_length);
+  Result<std::shared_ptr<ArrayData>> FinishRunEnds();
+
+  std::shared_ptr<DataType> type_;
+  int64_t max_run_end_;
+  std::shared_ptr<ArrayBuilder> value_builder_;
+  // Run ends are accumulated as int64 and narrowed to the run end type on Finish
+  TypedBufferBuilder<int64_t> run_ends_builder_;
+};
+
+}  // namespace arrow
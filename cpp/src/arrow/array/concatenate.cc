@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -39,11 +41,15 @@
 #include "arrow/util/int_util.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ree_util.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 using internal::SafeSignedAdd;
+using internal::SafeSignedSubtract;
 
 namespace {
 /// offset, length pair for representing a Range of a buffer or array
@@ -67,6 +73,66 @@ struct Bitmap {
   bool AllSet() const { return data == nullptr; }
 };
 
+// Copies writing fewer bytes than this are done on the calling thread
+constexpr int64_t kMinParallelCopyBytes = 1 << 20;
+
+// Run the `Status(int64_t)` function `copy(i)` for each input i, where
+// `out_positions` holds the output position (in elements of `byte_width` bytes)
+// of each input followed by the total output length.  Since the output
+// positions are known upfront, large copies are split into contiguous groups
+// of inputs of roughly the same output size, which are copied in parallel.
+template <typename CopyFunc>
+Status CopyInputs(const std::vector<int64_t>& out_positions, int64_t byte_width,
+                  CopyFunc&& copy) {
+  DCHECK(!out_positions.empty());
+  const auto num_inputs = static_cast<int64_t>(out_positions.size()) - 1;
+  const int64_t total = out_positions.back();
+  auto* pool = internal::GetCpuThreadPool();
+  const int capacity = pool->GetCapacity();
+  // Don't block a worker of the CPU pool waiting for its siblings
+  if (total * byte_width < kMinParallelCopyBytes || num_inputs < 2 || capacity < 2 ||
+      pool->OwnsThisThread()) {
+    for (int64_t i = 0; i < num_inputs; ++i) {
+      RETURN_NOT_OK(copy(i));
+    }
+    return Status::OK();
+  }
+  const int num_tasks = static_cast<int>(std::min<int64_t>(num_inputs, 4 * capacity));
+  const auto inputs_begin = out_positions.begin();
+  const auto inputs_end = out_positions.end() - 1;
+  return internal::ParallelFor(num_tasks, [&](int task) {
+    // The inputs whose output starts within this task's share of the output
+    auto begin = std::lower_bound(inputs_begin, inputs_end, total * task / num_tasks);
+    auto end = task == num_tasks - 1
+                   ? inputs_end
+                   : std::lower_bound(inputs_begin, inputs_end,
+                                      total * (task + 1) / num_tasks);
+    for (auto it = begin; it < end; ++it) {
+      RETURN_NOT_OK(copy(it - inputs_begin));
+    }
+    return Status::OK();
+  });
+}
+
+// Allocate a buffer and concatenate buffers into it (see CopyInputs).
+Result<std::shared_ptr<Buffer>> ConcatenateValueBuffers(const BufferVector& buffers,
+                                                        MemoryPool* pool) {
+  std::vector<int64_t> out_positions(buffers.size() + 1);
+  out_positions[0] = 0;
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    out_positions[i + 1] = out_positions[i] + buffers[i]->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(out_positions.back(), pool));
+  uint8_t* out_data = out->mutable_data();
+  RETURN_NOT_OK(CopyInputs(out_positions, /*byte_width=*/1, [&](int64_t i) {
+    if (buffers[i]->size() > 0) {
+      std::memcpy(out_data + out_positions[i], buffers[i]->data(), buffers[i]->size());
+    }
+    return Status::OK();
+  }));
+  return std::move(out);
+}
+
 // Allocate a buffer and concatenate bitmaps into it.
 Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
                           std::shared_ptr<Buffer>* out) {
@@ -93,11 +159,19 @@ Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
   return Status::OK();
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
+// Write `length` offsets from src into dst, adding `adjustment` to them.
+// NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
+// Avoid UB on non-validated input by doing the addition in the unsigned domain.
+// (the result can later be validated using Array::ValidateFull)
+// This simple loop is auto-vectorized by compilers.
 template <typename Offset>
-Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offset* dst,
-                  Range* values_range);
+void RebaseOffsets(const Offset* src, int64_t length, Offset adjustment, Offset* dst) {
+  using Unsigned = typename std::make_unsigned<Offset>::type;
+  const auto unsigned_adjustment = static_cast<Unsigned>(adjustment);
+  for (int64_t i = 0; i < length; ++i) {
+    dst[i] = static_cast<Offset>(static_cast<Unsigned>(src[i]) + unsigned_adjustment);
+  }
+}
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
@@ -107,61 +181,52 @@ Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
                           std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
-  int64_t out_length = 0;
-  for (const auto& buffer : buffers) {
-    out_length += buffer->size() / sizeof(Offset);
-  }
-  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer((out_length + 1) * sizeof(Offset), pool));
-  auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
-
-  int64_t elements_length = 0;
+  // First compute where each buffer's offsets go in the output, and the
+  // values length before it (which its first offset will be adjusted to)
+  std::vector<int64_t> out_positions(buffers.size() + 1);
+  std::vector<Offset> first_offsets(buffers.size());
+  out_positions[0] = 0;
   Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
+    const auto& src = buffers[i];
+    const int64_t length = src->size() / sizeof(Offset);
+    out_positions[i + 1] = out_positions[i] + length;
+    first_offsets[i] = values_length;
+
+    Range* values_range = &values_ranges->at(i);
+    if (length == 0) {
+      // It's allowed to have an empty offsets buffer for a 0-length array
+      // (see Array::Validate)
+      values_range->offset = 0;
+      values_range->length = 0;
+      continue;
+    }
+    // Compute the range of values which is spanned by this range of offsets
+    auto src_begin = reinterpret_cast<const Offset*>(src->data());
+    values_range->offset = src_begin[0];
+    values_range->length = src_begin[length] - values_range->offset;
+    if (values_length > std::numeric_limits<Offset>::max() - values_range->length) {
+      return Status::Invalid("offset overflow while concatenating arrays");
+    }
+    values_length += static_cast<Offset>(values_range->length);
   }
 
-  // the final element in dst is the length of all values spanned by the offsets
-  dst[out_length] = values_length;
-  return Status::OK();
-}
-
-template <typename Offset>
-Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset, Offset* dst,
-                  Range* values_range) {
-  if (src->size() == 0) {
-    // It's allowed to have an empty offsets buffer for a 0-length array
-    // (see Array::Validate)
-    values_range->offset = 0;
-    values_range->length = 0;
+  // Then write the adjusted offsets, each buffer independently
+  const int64_t out_length = out_positions.back();
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer((out_length + 1) * sizeof(Offset), pool));
+  auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
+  RETURN_NOT_OK(CopyInputs(out_positions, sizeof(Offset), [&](int64_t i) {
+    const int64_t length = out_positions[i + 1] - out_positions[i];
+    if (length > 0) {
+      auto src_begin = reinterpret_cast<const Offset*>(buffers[i]->data());
+      RebaseOffsets(src_begin, length, SafeSignedSubtract(first_offsets[i], src_begin[0]),
+                    dst + out_positions[i]);
+    }
     return Status::OK();
-  }
+  }));
 
-  // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
-
-  // Compute the range of values which is spanned by this range of offsets
-  values_range->offset = src_begin[0];
-  values_range->length = *src_end - values_range->offset;
-  if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
-    return Status::Invalid("offset overflow while concatenating arrays");
-  }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto adjustment = first_offset - src_begin[0];
-  // NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
-  // Avoid UB on non-validated input by doing the addition in the unsigned domain.
-  // (the result can later be validated using Array::ValidateFull)
-  std::transform(src_begin, src_end, dst, [adjustment](Offset offset) {
-    return SafeSignedAdd(offset, adjustment);
-  });
+  // the final element in dst is the length of all values spanned by the offsets
+  dst[out_length] = values_length;
   return Status::OK();
 }
 
@@ -204,7 +269,7 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal128, decimal256, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ConcatenateValueBuffers(buffers, pool_).Value(&out_->buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
@@ -213,7 +278,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValueBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
@@ -222,7 +287,39 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateValueBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+  }
+
+  Status Visit(const StringViewType&) {
+    // The data buffers are passed through, only the buffer indices of the
+    // non-inline views need to be shifted
+    using c_type = StringViewType::c_type;
+    ARROW_ASSIGN_OR_RAISE(auto view_buffers, Buffers(1, sizeof(c_type)));
+    ARROW_ASSIGN_OR_RAISE(out_->buffers[1], ConcatenateValueBuffers(view_buffers, pool_));
+    if (out_->buffers[1]->size() != out_->length * static_cast<int64_t>(sizeof(c_type))) {
+      return Status::Invalid("Missing views buffer when concatenating string views");
+    }
+    auto views = reinterpret_cast<c_type*>(out_->buffers[1]->mutable_data());
+
+    out_->buffers.resize(2);
+    int64_t buffer_offset = 0;
+    for (const auto& in : in_) {
+      if (buffer_offset > 0) {
+        for (int64_t i = 0; i < in->length; ++i) {
+          if (!views[i].is_inline()) {
+            views[i].ref.buffer_index += static_cast<int32_t>(buffer_offset);
+          }
+        }
+      }
+      views += in->length;
+      out_->buffers.insert(out_->buffers.end(), in->buffers.begin() + 2,
+                           in->buffers.end());
+      buffer_offset += static_cast<int64_t>(in->buffers.size()) - 2;
+      if (buffer_offset > std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid("Too many data buffers when concatenating string views");
+      }
+    }
+    return Status::OK();
   }
 
   Status Visit(const ListType&) {
@@ -276,24 +373,25 @@ class ConcatenateImpl {
       const DataType& index_type, const BufferVector& index_transpositions) {
     const auto index_width =
         internal::checked_cast<const FixedWidthType&>(index_type).bit_width() / 8;
-    int64_t out_length = 0;
-    for (const auto& data : in_) {
-      out_length += data->length;
+    std::vector<int64_t> out_positions(in_.size() + 1);
+    out_positions[0] = 0;
+    for (size_t i = 0; i < in_.size(); i++) {
+      out_positions[i + 1] = out_positions[i] + in_[i]->length;
     }
-    ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(out_length * index_width, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto out,
+                          AllocateBuffer(out_positions.back() * index_width, pool_));
     uint8_t* out_data = out->mutable_data();
-    for (size_t i = 0; i < in_.size(); i++) {
+    RETURN_NOT_OK(CopyInputs(out_positions, index_width, [&](int64_t i) {
       const auto& data = in_[i];
       auto transpose_map =
           reinterpret_cast<const int32_t*>(index_transpositions[i]->data());
-      RETURN_NOT_OK(internal::TransposeInts(index_type, index_type,
-                                            /*src=*/data->GetValues<uint8_t>(1, 0),
-                                            /*dest=*/out_data,
-                                            /*src_offset=*/data->offset,
-                                            /*dest_offset=*/0, /*length=*/data->length,
-                                            transpose_map));
-      out_data += data->length * index_width;
-    }
+      return internal::TransposeInts(index_type, index_type,
+                                     /*src=*/data->GetValues<uint8_t>(1, 0),
+                                     /*dest=*/out_data + out_positions[i] * index_width,
+                                     /*src_offset=*/data->offset,
+                                     /*dest_offset=*/0, /*length=*/data->length,
+                                     transpose_map);
+    }));
     return std::move(out);
   }
 
@@ -314,7 +412,7 @@ class ConcatenateImpl {
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
+      return ConcatenateValueBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
     } else {
       ARROW_ASSIGN_OR_RAISE(auto index_lookup, UnifyDictionaries(d));
       ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
@@ -323,6 +421,30 @@ class ConcatenateImpl {
     }
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Only the runs overlapping each input are kept, their run ends are
+    // clipped to the input and shifted by the preceding inputs' lengths
+    std::vector<Range> physical_ranges(in_.size());
+    for (size_t i = 0; i < in_.size(); ++i) {
+      physical_ranges[i].offset = ree_util::FindPhysicalOffset(*in_[i]);
+      physical_ranges[i].length = ree_util::FindPhysicalLength(*in_[i]);
+    }
+    switch (type.run_end_type()->id()) {
+      case Type::INT16:
+        RETURN_NOT_OK(ConcatenateRunEnds<int16_t>(physical_ranges));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(ConcatenateRunEnds<int32_t>(physical_ranges));
+        break;
+      default:
+        DCHECK_EQ(type.run_end_type()->id(), Type::INT64);
+        RETURN_NOT_OK(ConcatenateRunEnds<int64_t>(physical_ranges));
+        break;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto values, ChildData(1, physical_ranges));
+    return ConcatenateImpl(values, pool_).Concatenate(&out_->child_data[1]);
+  }
+
   Status Visit(const UnionType& u) {
     return Status::NotImplemented("concatenation of ", u);
   }
@@ -408,6 +530,37 @@ class ConcatenateImpl {
     return Buffers(index, fixed.bit_width() / 8);
   }
 
+  template <typename RunEndCType>
+  Status ConcatenateRunEnds(const std::vector<Range>& physical_ranges) {
+    if (out_->length > std::numeric_limits<RunEndCType>::max()) {
+      return Status::Invalid("Length overflow when concatenating run-end encoded arrays",
+                             " with run ends of type ",
+                             *in_[0]->child_data[0]->type);
+    }
+    int64_t physical_length = 0;
+    for (const auto& range : physical_ranges) {
+      physical_length += range.length;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto run_ends,
+                          AllocateBuffer(physical_length * sizeof(RunEndCType), pool_));
+    auto dst = reinterpret_cast<RunEndCType*>(run_ends->mutable_data());
+    int64_t logical_base = 0;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      const ArrayData& in = *in_[i];
+      const RunEndCType* src = ree_util::RunEndsArray(in).GetValues<RunEndCType>(1);
+      for (int64_t j = physical_ranges[i].offset;
+           j < physical_ranges[i].offset + physical_ranges[i].length; ++j) {
+        const int64_t run_end = std::min<int64_t>(src[j] - in.offset, in.length);
+        *dst++ = static_cast<RunEndCType>(logical_base + run_end);
+      }
+      logical_base += in.length;
+    }
+    out_->child_data[0] =
+        ArrayData::Make(in_[0]->child_data[0]->type, physical_length,
+                        {nullptr, std::move(run_ends)}, /*null_count=*/0);
+    return Status::OK();
+  }
+
   // Gather the index-th buffer of each input as a Bitmap
   // into a vector of Bitmaps.
   std::vector<Bitmap> Bitmaps(size_t index) {
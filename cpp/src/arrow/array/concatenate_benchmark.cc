@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+constexpr int64_t kTotalLength = 1 << 22;
+constexpr double kNullProbability = 0.1;
+
+// Concatenate kTotalLength elements split into state.range(0) chunks,
+// with state.range(1) CPU threads
+static void ConcatenateChunks(benchmark::State& state,  // NOLINT non-const reference
+                              const std::shared_ptr<Array>& array) {
+  const int64_t num_chunks = state.range(0);
+  const int64_t chunk_length = array->length() / num_chunks;
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(array->Slice(i * chunk_length, chunk_length));
+  }
+
+  auto* thread_pool = internal::GetCpuThreadPool();
+  const int orig_capacity = thread_pool->GetCapacity();
+  ABORT_NOT_OK(thread_pool->SetCapacity(static_cast<int>(state.range(1))));
+  int64_t total_bytes = 0;
+  for (auto _ : state) {
+    auto result = Concatenate(chunks).ValueOrDie();
+    total_bytes = 0;
+    for (const auto& buffer : result->data()->buffers) {
+      total_bytes += buffer ? buffer->size() : 0;
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  ABORT_NOT_OK(thread_pool->SetCapacity(orig_capacity));
+
+  state.SetBytesProcessed(state.iterations() * total_bytes);
+  state.SetItemsProcessed(state.iterations() * num_chunks * chunk_length);
+}
+
+static void ConcatenateInt64(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  ConcatenateChunks(state, rng.Int64(kTotalLength, 0, 1000, kNullProbability));
+}
+
+static void ConcatenateString(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  ConcatenateChunks(state, rng.String(kTotalLength, 0, 16, kNullProbability));
+}
+
+static void ConcatenateList(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rng(42);
+  auto values = rng.Int32(kTotalLength * 4, 0, 1000, kNullProbability);
+  ConcatenateChunks(state, rng.List(*values, kTotalLength, kNullProbability));
+}
+
+static void ConcatenateArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_chunks : {10, 10000}) {
+    for (int64_t num_threads : {1, 8}) {
+      bench->Args({num_chunks, num_threads});
+    }
+  }
+  bench->ArgNames({"chunks", "threads"})->UseRealTime();
+}
+
+BENCHMARK(ConcatenateInt64)->Apply(ConcatenateArgs);
+BENCHMARK(ConcatenateString)->Apply(ConcatenateArgs);
+BENCHMARK(ConcatenateList)->Apply(ConcatenateArgs);
+
+}  // namespace arrow
@@ -39,6 +39,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 
@@ -373,6 +374,46 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+// Large enough inputs are copied in parallel
+TEST_F(ConcatenateTest, ManyLargeChunks) {
+  const int32_t size = 1 << 18;
+  auto offsets = this->Offsets<int32_t>(size, 1000);
+  for (auto array : {rng_.String(size, /*min_length=*/0, /*max_length=*/15, 0.1),
+                     rng_.LargeString(size, /*min_length=*/0, /*max_length=*/15, 0.1),
+                     rng_.Numeric<Int64Type>(size, 0, 1000, 0.1)}) {
+    SCOPED_TRACE(array->type()->ToString());
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(this->Slices(array, offsets)));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  // Dictionaries needing unification
+  auto dict_type = dictionary(int32(), utf8());
+  ArrayVector chunks;
+  for (int i = 0; i < 200; ++i) {
+    auto dict = ArrayFromJSON(utf8(), i % 2 ? R"(["a", "b", "c"])" : R"(["c", "d"])");
+    auto indices = rng_.Numeric<Int32Type>(2000, 0, i % 2 ? 2 : 1, 0.1);
+    chunks.push_back(std::make_shared<DictionaryArray>(dict_type, indices, dict));
+  }
+  ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(chunks));
+  ASSERT_OK(actual->ValidateFull());
+  const auto& out = internal::checked_cast<const DictionaryArray&>(*actual);
+  const auto& out_dict = internal::checked_cast<const StringArray&>(*out.dictionary());
+  int64_t j = 0;
+  for (const auto& chunk : chunks) {
+    const auto& in = internal::checked_cast<const DictionaryArray&>(*chunk);
+    const auto& in_dict = internal::checked_cast<const StringArray&>(*in.dictionary());
+    for (int64_t k = 0; k < in.length(); ++k, ++j) {
+      ASSERT_EQ(in.IsNull(k), out.IsNull(j));
+      if (in.IsValid(k)) {
+        ASSERT_EQ(in_dict.GetView(in.GetValueIndex(k)),
+                  out_dict.GetView(out.GetValueIndex(j)));
+      }
+    }
+  }
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -28,6 +28,8 @@
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
@@ -116,10 +118,19 @@ Result<std::shared_ptr<ArrayData>> ArrayData::SliceSafe(int64_t off, int64_t len
   return Slice(off, len);
 }
 
+namespace {
+
+// Below this length, computing a validity summary isn't worth its allocation
+constexpr int64_t kMinSummaryLength = 4 * internal::BitmapSummary::kChunkBits;
+
+}  // namespace
+
 int64_t ArrayData::GetNullCount() const {
   int64_t precomputed = this->null_count.load();
   if (ARROW_PREDICT_FALSE(precomputed == kUnknownNullCount)) {
-    if (this->buffers[0]) {
+    if (this->buffers[0] && this->length >= kMinSummaryLength) {
+      precomputed = this->length - GetValiditySummary()->popcount();
+    } else if (this->buffers[0]) {
       precomputed = this->length -
                     CountSetBits(this->buffers[0]->data(), this->offset, this->length);
     } else {
@@ -130,6 +141,29 @@ int64_t ArrayData::GetNullCount() const {
   return precomputed;
 }
 
+std::shared_ptr<const internal::BitmapSummary> ArrayData::GetCachedValiditySummary()
+    const {
+  if (!this->buffers[0]) {
+    return nullptr;
+  }
+  auto summary = internal::atomic_load(&validity_summary_);
+  if (summary == nullptr ||
+      !summary->Describes(this->buffers[0]->data(), this->offset, this->length)) {
+    return nullptr;
+  }
+  return summary;
+}
+
+std::shared_ptr<const internal::BitmapSummary> ArrayData::GetValiditySummary() const {
+  auto summary = GetCachedValiditySummary();
+  if (summary == nullptr && this->buffers[0]) {
+    summary = std::make_shared<internal::BitmapSummary>(this->buffers[0]->data(),
+                                                        this->offset, this->length);
+    internal::atomic_store(&validity_summary_, summary);
+  }
+  return summary;
+}
+
 // ----------------------------------------------------------------------
 // Implement ArrayData::View
 
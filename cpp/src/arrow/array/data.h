@@ -30,6 +30,12 @@
 
 namespace arrow {
 
+namespace internal {
+
+class BitmapSummary;
+
+}  // namespace internal
+
 // When slicing, we do not know the null count of the sliced range without
 // doing some computation. To avoid doing this eagerly, we set the null count
 // to -1 (any negative number will do). When Array::null_count is called the
@@ -148,6 +154,7 @@ struct ARROW_EXPORT ArrayData {
     buffers = std::move(other.buffers);
     child_data = std::move(other.child_data);
     dictionary = std::move(other.dictionary);
+    validity_summary_.reset();
     return *this;
   }
 
@@ -160,6 +167,7 @@ struct ARROW_EXPORT ArrayData {
     buffers = other.buffers;
     child_data = other.child_data;
     dictionary = other.dictionary;
+    validity_summary_.reset();
     return *this;
   }
 
@@ -223,8 +231,22 @@ struct ARROW_EXPORT ArrayData {
   void SetNullCount(int64_t v) { null_count.store(v); }
 
   /// \brief Return null count, or compute and set it if it's not known
+  ///
+  /// For long arrays this also computes and caches a summary of the validity
+  /// bitmap.
   int64_t GetNullCount() const;
 
+  /// \brief Return a coarse summary of the validity bitmap (see
+  /// internal::BitmapSummary), or compute and cache it if it's not known
+  ///
+  /// Returns null if there is no validity bitmap. The summary isn't carried
+  /// over to copies, and is recomputed if the bitmap, offset or length change.
+  std::shared_ptr<const internal::BitmapSummary> GetValiditySummary() const;
+
+  /// \brief Return the validity bitmap summary if it's already known, otherwise
+  /// null
+  std::shared_ptr<const internal::BitmapSummary> GetCachedValiditySummary() const;
+
   bool MayHaveNulls() const {
     // If an ArrayData is slightly malformed it may have kUnknownNullCount set
     // but no buffer
@@ -242,6 +264,10 @@ struct ARROW_EXPORT ArrayData {
 
   // The dictionary for this Array, if any. Only used for dictionary type
   std::shared_ptr<ArrayData> dictionary;
+
+ private:
+  // Accessed atomically
+  mutable std::shared_ptr<const internal::BitmapSummary> validity_summary_;
 };
 
 namespace internal {
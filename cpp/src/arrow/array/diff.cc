@@ -31,6 +31,7 @@
 #include "arrow/array/array_decimal.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
@@ -42,6 +43,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/string.h"
 #include "arrow/util/string_view.h"
 #include "arrow/vendored/datetime.h"
@@ -96,6 +98,10 @@ static UnitSlice GetView(const UnionArray& array, int64_t index) {
   return UnitSlice{&array, index};
 }
 
+static UnitSlice GetView(const RunEndEncodedArray& array, int64_t index) {
+  return UnitSlice{&array, index};
+}
+
 using ValueComparator = std::function<bool(const Array&, int64_t, const Array&, int64_t)>;
 
 struct ValueComparatorVisitor {
@@ -480,6 +486,14 @@ class MakeFormatterImpl {
     return Status::OK();
   }
 
+  Status Visit(const StringViewType&) {
+    impl_ = [](const Array& array, int64_t index, std::ostream* os) {
+      *os << "\""
+          << Escape(checked_cast<const StringViewArray&>(array).GetView(index)) << "\"";
+    };
+    return Status::OK();
+  }
+
   // format Decimals with Decimal128Array::FormatValue
   Status Visit(const Decimal128Type&) {
     impl_ = [](const Array& array, int64_t index, std::ostream* os) {
@@ -603,6 +617,28 @@ class MakeFormatterImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& t) {
+    struct RunEndEncodedImpl {
+      explicit RunEndEncodedImpl(Formatter f) : values_formatter_(std::move(f)) {}
+
+      void operator()(const Array& array, int64_t index, std::ostream* os) {
+        const auto& ree_array = checked_cast<const RunEndEncodedArray&>(array);
+        const int64_t physical_index = ree_util::FindPhysicalIndex(*array.data(), index);
+        if (ree_array.values()->IsNull(physical_index)) {
+          *os << "null";
+        } else {
+          values_formatter_(*ree_array.values(), physical_index, os);
+        }
+      }
+
+      Formatter values_formatter_;
+    };
+
+    ARROW_ASSIGN_OR_RAISE(auto values_formatter, MakeFormatter(*t.value_type()));
+    impl_ = RunEndEncodedImpl(std::move(values_formatter));
+    return Status::OK();
+  }
+
   Status Visit(const NullType& t) {
     return Status::NotImplemented("formatting diffs between arrays of type ", t);
   }
@@ -30,6 +30,8 @@
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
@@ -207,6 +209,7 @@ class ArrayDataEndianSwapper {
   Status Visit(const FixedSizeBinaryType& type) { return Status::OK(); }
   Status Visit(const FixedSizeListType& type) { return Status::OK(); }
   Status Visit(const StructType& type) { return Status::OK(); }
+  Status Visit(const RunEndEncodedType& type) { return Status::OK(); }
   Status Visit(const UnionType& type) {
     out_->buffers[1] = data_->buffers[1];
     if (type.mode() == UnionMode::DENSE) {
@@ -234,6 +237,30 @@ class ArrayDataEndianSwapper {
     return Status::OK();
   }
 
+  Status Visit(const StringViewType& type) {
+    // Only the integer fields of the views are swapped, the inline data and
+    // prefixes are bytes
+    using c_type = StringViewType::c_type;
+    const auto& in_buffer = data_->buffers[1];
+    if (in_buffer == nullptr || in_buffer->size() == 0) {
+      return Status::OK();
+    }
+    auto in_data = reinterpret_cast<const c_type*>(in_buffer->data());
+    ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateBuffer(in_buffer->size()));
+    auto out_data = reinterpret_cast<c_type*>(out_buffer->mutable_data());
+    int64_t length = in_buffer->size() / sizeof(c_type);
+    for (int64_t i = 0; i < length; i++) {
+      out_data[i] = in_data[i];
+      out_data[i].inlined.size = BitUtil::ByteSwap(in_data[i].inlined.size);
+      if (!out_data[i].is_inline()) {
+        out_data[i].ref.buffer_index = BitUtil::ByteSwap(in_data[i].ref.buffer_index);
+        out_data[i].ref.offset = BitUtil::ByteSwap(in_data[i].ref.offset);
+      }
+    }
+    out_->buffers[1] = std::move(out_buffer);
+    return Status::OK();
+  }
+
   Status Visit(const ListType& type) {
     RETURN_NOT_OK(SwapOffsets<int32_t>(1));
     return Status::OK();
@@ -288,6 +315,20 @@ std::shared_ptr<Array> MakeArray(const std::shared_ptr<ArrayData>& data) {
 
 namespace internal {
 
+// Make the run ends of a run-end encoded array made of a single run
+static Result<std::shared_ptr<ArrayData>> MakeSingleRunEnds(
+    const std::shared_ptr<DataType>& run_end_type, int64_t length, MemoryPool* pool) {
+  const int bit_width = checked_cast<const FixedWidthType&>(*run_end_type).bit_width();
+  if (bit_width < 64 && length > (int64_t(1) << (bit_width - 1)) - 1) {
+    return Status::Invalid("Length ", length, " does not fit in run ends of type ",
+                           *run_end_type);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto run_end, MakeScalar(run_end_type, length));
+  ARROW_ASSIGN_OR_RAISE(auto run_ends,
+                        MakeArrayFromScalar(*run_end, length > 0 ? 1 : 0, pool));
+  return run_ends->data();
+}
+
 // get the maximum buffer length required, then allocate a single zeroed buffer
 // to use anywhere a buffer is required
 class NullArrayFactory {
@@ -326,6 +367,10 @@ class NullArrayFactory {
       return MaxOf(type.byte_width() * length_);
     }
 
+    Status Visit(const StringViewType& type) {
+      return MaxOf(sizeof(StringViewType::c_type) * length_);
+    }
+
     Status Visit(const StructType& type) {
       for (const auto& child : type.fields()) {
         RETURN_NOT_OK(MaxOf(GetBufferLength(child->type(), length_)));
@@ -351,6 +396,11 @@ class NullArrayFactory {
       return MaxOf(GetBufferLength(type.index_type(), length_));
     }
 
+    Status Visit(const RunEndEncodedType& type) {
+      // A single null run; the run ends are not zero so they use their own buffer
+      return MaxOf(GetBufferLength(type.value_type(), 1));
+    }
+
     Status Visit(const ExtensionType& type) {
       // XXX is an extension array's length always == storage length
       return MaxOf(GetBufferLength(type.storage_type(), length_));
@@ -415,6 +465,12 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const StringViewType&) {
+    // zeroed views are empty inline strings, no data buffer is needed
+    out_->buffers.resize(2, buffer_);
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     out_->buffers.resize(2, buffer_);
@@ -469,6 +525,16 @@ class NullArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    out_->buffers[0] = nullptr;
+    out_->null_count = 0;
+    const int64_t num_runs = length_ > 0 ? 1 : 0;
+    ARROW_ASSIGN_OR_RAISE(out_->child_data[0],
+                          MakeSingleRunEnds(type.run_end_type(), length_, pool_));
+    ARROW_ASSIGN_OR_RAISE(out_->child_data[1], CreateChild(1, num_runs));
+    return Status::OK();
+  }
+
   Status Visit(const DataType& type) {
     return Status::NotImplemented("construction of all-null ", type);
   }
@@ -536,6 +602,24 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const StringViewType&) {
+    const auto& value = checked_cast<const StringViewScalar&>(scalar_).value;
+    StringViewBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Append(value->data(), value->size()));
+    std::shared_ptr<ArrayData> single;
+    RETURN_NOT_OK(builder.FinishInternal(&single));
+    // All views are the same, referencing the same data if not inlined
+    const auto view = single->GetValues<StringViewType::c_type>(1)[0];
+    std::shared_ptr<Buffer> views;
+    RETURN_NOT_OK(CreateBufferOf(&view, sizeof(view), &views));
+    single->buffers[0] = nullptr;
+    single->buffers[1] = std::move(views);
+    single->length = length_;
+    single->null_count = 0;
+    out_ = MakeArray(single);
+    return Status::OK();
+  }
+
   template <typename T>
   enable_if_var_size_list<T, Status> Visit(const T& type) {
     using ScalarType = typename TypeTraits<T>::ScalarType;
@@ -603,6 +687,17 @@ class RepeatedArrayFactory {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const auto& value = checked_cast<const RunEndEncodedScalar&>(scalar_).value;
+    const int64_t num_runs = length_ > 0 ? 1 : 0;
+    ARROW_ASSIGN_OR_RAISE(auto run_ends,
+                          MakeSingleRunEnds(type.run_end_type(), length_, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values, MakeArrayFromScalar(*value, num_runs, pool_));
+    out_ = std::make_shared<RunEndEncodedArray>(scalar_.type, length_,
+                                                MakeArray(run_ends), values);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     return Status::NotImplemented("construction from scalar of type ", *scalar_.type);
   }
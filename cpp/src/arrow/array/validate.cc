@@ -17,6 +17,8 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
@@ -28,6 +30,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
@@ -70,6 +73,18 @@ struct ValidateArrayImpl {
 
   Status Visit(const LargeBinaryType& type) { return ValidateBinaryLike(type); }
 
+  Status Visit(const StringViewType& type) {
+    if (data.length > 0 && !IsBufferValid(1)) {
+      return Status::Invalid("Missing views buffer in non-empty array");
+    }
+    for (size_t i = 2; i < data.buffers.size(); ++i) {
+      if (data.buffers[i] == nullptr) {
+        return Status::Invalid("Data buffer #", i, " is null");
+      }
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ListType& type) { return ValidateListLike(type); }
 
   Status Visit(const LargeListType& type) { return ValidateListLike(type); }
@@ -171,6 +186,58 @@ struct ValidateArrayImpl {
     return ValidateWithType(*type.index_type());
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const ArrayData& run_ends = *data.child_data[0];
+    const ArrayData& values = *data.child_data[1];
+    if (!RunEndEncodedType::RunEndTypeValid(*run_ends.type)) {
+      return Status::Invalid("Run ends array must be int16, int32 or int64, got ",
+                             run_ends.type->ToString());
+    }
+    if (!run_ends.type->Equals(*type.run_end_type())) {
+      return Status::Invalid("Run ends array type ", run_ends.type->ToString(),
+                             " does not match type field ",
+                             type.run_end_type()->ToString());
+    }
+    if (!values.type->Equals(*type.value_type())) {
+      return Status::Invalid("Values array type ", values.type->ToString(),
+                             " does not match type field ",
+                             type.value_type()->ToString());
+    }
+
+    // Validate children first, to catch nonsensical length / offset etc.
+    const Status run_ends_valid = ValidateArray(run_ends);
+    if (!run_ends_valid.ok()) {
+      return Status::Invalid("Run ends array invalid: ", run_ends_valid.ToString());
+    }
+    const Status values_valid = ValidateArray(values);
+    if (!values_valid.ok()) {
+      return Status::Invalid("Values array invalid: ", values_valid.ToString());
+    }
+
+    if (run_ends.GetNullCount() != 0) {
+      return Status::Invalid("Run ends array cannot contain nulls");
+    }
+    if (run_ends.length != values.length) {
+      return Status::Invalid("Run ends array length (", run_ends.length,
+                             ") does not match values array length (", values.length,
+                             ")");
+    }
+    if (data.length == 0) {
+      return Status::OK();
+    }
+    if (run_ends.length == 0) {
+      return Status::Invalid("Run-end encoded array of length ", data.length,
+                             " has no runs");
+    }
+    const int64_t last_run_end = ree_util::GetRunEnd(run_ends, run_ends.length - 1);
+    if (last_run_end < data.offset + data.length) {
+      return Status::Invalid("Last run end (", last_run_end,
+                             ") is smaller than the array offset + length (",
+                             data.offset + data.length, ")");
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     // Visit storage
     return ValidateWithType(*type.storage_type());
@@ -300,7 +367,14 @@ Status ValidateArray(const ArrayData& data) {
     return Status::Invalid("Array length is negative");
   }
 
-  if (data.buffers.size() != layout.buffers.size()) {
+  if (layout.variadic_spec) {
+    if (data.buffers.size() < layout.buffers.size()) {
+      return Status::Invalid("Expected at least ", layout.buffers.size(),
+                             " buffers in array "
+                             "of type ",
+                             type.ToString(), ", got ", data.buffers.size());
+    }
+  } else if (data.buffers.size() != layout.buffers.size()) {
     return Status::Invalid("Expected ", layout.buffers.size(),
                            " buffers in array "
                            "of type ",
@@ -316,7 +390,9 @@ Status ValidateArray(const ArrayData& data) {
 
   for (int i = 0; i < static_cast<int>(data.buffers.size()); ++i) {
     const auto& buffer = data.buffers[i];
-    const auto& spec = layout.buffers[i];
+    const auto& spec = i < static_cast<int>(layout.buffers.size())
+                           ? layout.buffers[i]
+                           : *layout.variadic_spec;
 
     if (buffer == nullptr) {
       continue;
@@ -400,6 +476,10 @@ struct UTF8DataValidator {
   enable_if_string<StringType, Status> Visit(const StringType&) {
     util::InitializeUTF8();
 
+    if (ValidateDataRange<typename StringType::offset_type>()) {
+      return Status::OK();
+    }
+    // Validate the strings one by one, to skip null slots and locate errors
     int64_t i = 0;
     return VisitArrayDataInline<StringType>(
         data,
@@ -415,6 +495,56 @@ struct UTF8DataValidator {
           return Status::OK();
         });
   }
+
+  Status Visit(const StringViewType&) {
+    util::InitializeUTF8();
+
+    int64_t i = 0;
+    return VisitArrayDataInline<StringViewType>(
+        data,
+        [&](util::string_view v) {
+          if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(v))) {
+            return Status::Invalid("Invalid UTF8 sequence at string index ", i);
+          }
+          ++i;
+          return Status::OK();
+        },
+        [&]() {
+          ++i;
+          return Status::OK();
+        });
+  }
+
+  // Validate the data of all strings at once, which is much faster than
+  // string by string.  Returns false if that fails, even though the strings
+  // may be valid (e.g. null slots can span invalid data).
+  template <typename OffsetType>
+  bool ValidateDataRange() {
+    if (data.length == 0) {
+      return true;
+    }
+    const OffsetType* offsets = data.GetValues<OffsetType>(1);
+    const uint8_t* values = data.GetValues<uint8_t>(2, /*absolute_offset=*/0);
+    const int64_t size = offsets[data.length] - offsets[0];
+    if (values == nullptr) {
+      return size == 0;
+    }
+    const uint8_t* begin = values + offsets[0];
+    if (util::ValidateAscii(begin, size)) {
+      return true;
+    }
+    if (!util::ValidateUTF8(begin, size)) {
+      return false;
+    }
+    // Valid UTF-8 data is made of valid strings if none of them starts
+    // with a continuation byte
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (offsets[i] < offsets[i + 1] && (values[offsets[i]] & 0xC0) == 0x80) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 struct BoundsChecker {
@@ -475,6 +605,11 @@ struct ValidateArrayFullImpl {
 
   Status Visit(const LargeBinaryType& type) { return ValidateBinaryLike(type); }
 
+  Status Visit(const StringViewType& type) {
+    RETURN_NOT_OK(ValidateViews());
+    return ValidateUTF8(data);
+  }
+
   Status Visit(const ListType& type) { return ValidateListLike(type); }
 
   Status Visit(const LargeListType& type) { return ValidateListLike(type); }
@@ -571,11 +706,82 @@ struct ValidateArrayFullImpl {
     return ValidateArrayFull(*data.dictionary);
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    const ArrayData& run_ends = *data.child_data[0];
+    switch (run_ends.type->id()) {
+      case Type::INT16:
+        RETURN_NOT_OK(ValidateRunEnds<int16_t>(run_ends));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(ValidateRunEnds<int32_t>(run_ends));
+        break;
+      default:
+        RETURN_NOT_OK(ValidateRunEnds<int64_t>(run_ends));
+        break;
+    }
+    const Status values_valid = ValidateArrayFull(*data.child_data[1]);
+    if (!values_valid.ok()) {
+      return Status::Invalid("Values array invalid: ", values_valid.ToString());
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     return ValidateWithType(*type.storage_type());
   }
 
  protected:
+  template <typename RunEndCType>
+  Status ValidateRunEnds(const ArrayData& run_ends) {
+    const RunEndCType* values = run_ends.GetValues<RunEndCType>(1);
+    RunEndCType prev = 0;
+    for (int64_t i = 0; i < run_ends.length; ++i) {
+      if (values[i] <= prev) {
+        return Status::Invalid("Run ends are not strictly increasing and positive: ",
+                               "run end at position ", i, " is ", values[i],
+                               " after ", prev);
+      }
+      prev = values[i];
+    }
+    return Status::OK();
+  }
+
+  Status ValidateViews() {
+    const auto* views = data.GetValues<StringViewType::c_type>(1);
+    const uint8_t* bitmap = data.GetValues<uint8_t>(0, /*absolute_offset=*/0);
+    const auto num_data_buffers = static_cast<int64_t>(data.buffers.size()) - 2;
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (bitmap != nullptr && !BitUtil::GetBit(bitmap, data.offset + i)) {
+        continue;
+      }
+      const auto& view = views[i];
+      if (view.size() < 0) {
+        return Status::Invalid("String view at position ", i, " has negative size ",
+                               view.size());
+      }
+      if (view.is_inline()) {
+        continue;
+      }
+      const int32_t buffer_index = view.ref.buffer_index;
+      if (buffer_index < 0 || buffer_index >= num_data_buffers) {
+        return Status::Invalid("String view at position ", i,
+                               " references non-existent data buffer #", buffer_index);
+      }
+      const auto& data_buffer = *data.buffers[buffer_index + 2];
+      const int64_t end = static_cast<int64_t>(view.ref.offset) + view.size();
+      if (view.ref.offset < 0 || end > data_buffer.size()) {
+        return Status::Invalid("String view at position ", i,
+                               " is out of bounds of data buffer #", buffer_index);
+      }
+      if (std::memcmp(view.ref.prefix, data_buffer.data() + view.ref.offset,
+                      StringViewType::kPrefixSize) != 0) {
+        return Status::Invalid("String view at position ", i,
+                               " has a prefix inconsistent with its data");
+      }
+    }
+    return Status::OK();
+  }
+
   template <typename BinaryType>
   Status ValidateBinaryLike(const BinaryType& type) {
     const auto& data_buffer = data.buffers[2];
@@ -607,6 +813,10 @@ struct ValidateArrayFullImpl {
       return Status::Invalid("Non-empty array but offsets are null");
     }
 
+    if (OffsetsAreValid(offsets, offset_limit)) {
+      return Status::OK();
+    }
+    // Find the first invalid offset to report it
     auto prev_offset = offsets[0];
     if (prev_offset < 0) {
       return Status::Invalid("Offset invariant failure: array starts at negative offset ",
@@ -627,6 +837,28 @@ struct ValidateArrayFullImpl {
     return Status::OK();
   }
 
+  // Check the offset invariants without locating errors.  This is branch-free
+  // over blocks of offsets, so that compilers vectorize it.
+  template <typename offset_type>
+  bool OffsetsAreValid(const offset_type* offsets, int64_t offset_limit) {
+    constexpr int64_t kBlockSize = 1024;
+    // Monotonic offsets are all in bounds if the first and last are
+    if (offsets[0] < 0 || offsets[data.length] > offset_limit) {
+      return false;
+    }
+    for (int64_t block_start = 0; block_start < data.length; block_start += kBlockSize) {
+      const int64_t block_end = std::min(block_start + kBlockSize, data.length);
+      uint8_t monotonic = 1;
+      for (int64_t i = block_start; i < block_end; ++i) {
+        monotonic &= static_cast<uint8_t>(offsets[i] <= offsets[i + 1]);
+      }
+      if (!monotonic) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   Status CheckBounds(const DataType& type, int64_t min_value, int64_t max_value) {
     BoundsChecker checker{data, min_value, max_value};
     return VisitTypeInline(type, &checker);
@@ -645,7 +877,8 @@ Status ValidateArrayFull(const Array& array) { return ValidateArrayFull(*array.d
 
 ARROW_EXPORT
 Status ValidateUTF8(const ArrayData& data) {
-  DCHECK(data.type->id() == Type::STRING || data.type->id() == Type::LARGE_STRING);
+  DCHECK(data.type->id() == Type::STRING || data.type->id() == Type::LARGE_STRING ||
+         data.type->id() == Type::STRING_VIEW);
   UTF8DataValidator validator{data};
   return VisitTypeInline(*data.type, &validator);
 }
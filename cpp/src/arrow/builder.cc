@@ -137,6 +137,7 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       BUILDER_CASE(Binary);
       BUILDER_CASE(LargeString);
       BUILDER_CASE(LargeBinary);
+      BUILDER_CASE(StringView);
       BUILDER_CASE(FixedSizeBinary);
       BUILDER_CASE(Decimal128);
       BUILDER_CASE(Decimal256);
@@ -185,6 +186,14 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::RUN_END_ENCODED: {
+      const auto& ree_type = internal::checked_cast<const RunEndEncodedType&>(*type);
+      std::unique_ptr<ArrayBuilder> value_builder;
+      RETURN_NOT_OK(MakeBuilder(pool, ree_type.value_type(), &value_builder));
+      out->reset(new RunEndEncodedBuilder(pool, std::move(value_builder), type));
+      return Status::OK();
+    }
+
     case Type::STRUCT: {
       ARROW_ASSIGN_OR_RAISE(auto field_builders, FieldBuilders(*type, pool));
       out->reset(new StructBuilder(type, pool, std::move(field_builders)));
@@ -60,6 +60,32 @@ struct ArrowArray {
   void* private_data;
 };
 
+// EXPERIMENTAL: C device interface
+
+// Device type of the buffers of an ArrowDeviceArray
+// (values follow DLPack's DLDeviceType).
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+
+struct ArrowDeviceArray {
+  // The array, whose buffer pointers are addresses on the given device
+  // (child and dictionary arrays live on the same device)
+  struct ArrowArray array;
+  // Device number, e.g. the CUDA device ordinal
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  // Optional device-specific event (e.g. a pointer to a CUevent) that the
+  // consumer must wait on before accessing the buffers, or NULL if the data
+  // is ready to be read
+  void* sync_event;
+
+  // Reserved for future use, must be zeroed
+  int64_t reserved[3];
+};
+
 // EXPERIMENTAL: C stream interface
 
 struct ArrowArrayStream {
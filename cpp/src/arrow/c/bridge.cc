@@ -28,13 +28,16 @@
 #include "arrow/buffer.h"
 #include "arrow/c/helpers.h"
 #include "arrow/c/util_internal.h"
+#include "arrow/device.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -510,6 +513,10 @@ void ReleaseExportedArray(struct ArrowArray* array) {
 }
 
 struct ArrayExporter {
+  // If `device_buffers` is true, buffer addresses are exported even for
+  // non-CPU buffers (see ExportDeviceRecordBatch)
+  explicit ArrayExporter(bool device_buffers = false) : device_buffers_(device_buffers) {}
+
   Status Export(const std::shared_ptr<ArrayData>& data) {
     // Force computing null count.
     // This is because ARROW-9037 is in version 0.17 and 0.17.1, and they are
@@ -518,20 +525,26 @@ struct ArrayExporter {
     // Store buffer pointers
     export_.buffers_.resize(data->buffers.size());
     std::transform(data->buffers.begin(), data->buffers.end(), export_.buffers_.begin(),
-                   [](const std::shared_ptr<Buffer>& buffer) -> const void* {
-                     return buffer ? buffer->data() : nullptr;
+                   [this](const std::shared_ptr<Buffer>& buffer) -> const void* {
+                     if (!buffer) {
+                       return nullptr;
+                     }
+                     return device_buffers_
+                                ? reinterpret_cast<const void*>(buffer->address())
+                                : buffer->data();
                    });
 
     // Export dictionary
     if (data->dictionary != nullptr) {
-      dict_exporter_.reset(new ArrayExporter());
+      dict_exporter_.reset(new ArrayExporter(device_buffers_));
       RETURN_NOT_OK(dict_exporter_->Export(data->dictionary));
     }
 
     // Export children
     export_.children_.resize(data->child_data.size());
-    child_exporters_.resize(data->child_data.size());
+    child_exporters_.reserve(data->child_data.size());
     for (size_t i = 0; i < data->child_data.size(); ++i) {
+      child_exporters_.emplace_back(device_buffers_);
       RETURN_NOT_OK(child_exporters_[i].Export(data->child_data[i]));
     }
 
@@ -580,11 +593,65 @@ struct ArrayExporter {
     c_struct_->release = ReleaseExportedArray;
   }
 
+  bool device_buffers_;
   ExportedArrayPrivateData export_;
   std::unique_ptr<ArrayExporter> dict_exporter_;
   std::vector<ArrayExporter> child_exporters_;
 };
 
+// Check that all buffers of the array live on the same device, and that
+// exporting it won't need to read non-CPU memory.
+Status CheckDeviceArrayData(const ArrayData& data, std::shared_ptr<Device>* device) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) {
+      continue;
+    }
+    if (*device == nullptr) {
+      *device = buffer->device();
+    } else if (!buffer->device()->Equals(**device)) {
+      return Status::Invalid("Cannot export array with buffers on different devices (",
+                             (*device)->ToString(), " and ",
+                             buffer->device()->ToString(), ")");
+    }
+  }
+  if (!data.buffers.empty() && data.buffers[0] != nullptr && !data.buffers[0]->is_cpu() &&
+      data.null_count == kUnknownNullCount) {
+    return Status::Invalid(
+        "Cannot export array with a validity bitmap in device memory "
+        "and an unknown null count");
+  }
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(CheckDeviceArrayData(*child, device));
+  }
+  if (data.dictionary != nullptr) {
+    RETURN_NOT_OK(CheckDeviceArrayData(*data.dictionary, device));
+  }
+  return Status::OK();
+}
+
+// Check that the CPU-ness of a memory area matches the C device type,
+// for the device types known to Arrow C++.
+Status CheckDeviceType(ArrowDeviceType device_type, bool is_cpu) {
+  switch (device_type) {
+    case ARROW_DEVICE_CPU:
+    case ARROW_DEVICE_CUDA_HOST:
+      if (!is_cpu) {
+        return Status::Invalid("Device type ", device_type,
+                               " expects data in CPU-accessible memory");
+      }
+      break;
+    case ARROW_DEVICE_CUDA:
+      if (is_cpu) {
+        return Status::Invalid("Device type ", device_type,
+                               " expects data in device memory");
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status ExportArray(const Array& array, struct ArrowArray* out,
@@ -1151,6 +1218,32 @@ Result<std::shared_ptr<Schema>> ImportSchema(struct ArrowSchema* schema) {
   return importer.MakeSchema();
 }
 
+Status ExportDeviceRecordBatch(const RecordBatch& batch, ArrowDeviceType device_type,
+                               int64_t device_id, void* sync_event,
+                               struct ArrowDeviceArray* out,
+                               struct ArrowSchema* out_schema) {
+  ARROW_ASSIGN_OR_RAISE(auto array, batch.ToStructArray());
+  std::shared_ptr<Device> device;
+  RETURN_NOT_OK(CheckDeviceArrayData(*array->data(), &device));
+  if (device != nullptr) {
+    RETURN_NOT_OK(CheckDeviceType(device_type, device->is_cpu()));
+  }
+
+  SchemaExportGuard guard(out_schema);
+  if (out_schema != nullptr) {
+    RETURN_NOT_OK(ExportSchema(*batch.schema(), out_schema));
+  }
+  ArrayExporter exporter(/*device_buffers=*/true);
+  RETURN_NOT_OK(exporter.Export(array->data()));
+  memset(out, 0, sizeof(*out));
+  exporter.Finish(&out->array);
+  out->device_id = device_id;
+  out->device_type = device_type;
+  out->sync_event = sync_event;
+  guard.Detach();
+  return Status::OK();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // C data import
 
@@ -1185,6 +1278,10 @@ class ImportedBuffer : public Buffer {
                  std::shared_ptr<ImportedArrayData> import)
       : Buffer(data, size), import_(std::move(import)) {}
 
+  ImportedBuffer(const uint8_t* data, int64_t size, std::shared_ptr<MemoryManager> mm,
+                 std::shared_ptr<ImportedArrayData> import)
+      : Buffer(data, size, std::move(mm)), import_(std::move(import)) {}
+
   ~ImportedBuffer() override {}
 
  protected:
@@ -1192,7 +1289,10 @@ class ImportedBuffer : public Buffer {
 };
 
 struct ArrayImporter {
-  explicit ArrayImporter(const std::shared_ptr<DataType>& type) : type_(type) {}
+  // If `memory_manager` is null, the buffers are imported as CPU memory
+  explicit ArrayImporter(const std::shared_ptr<DataType>& type,
+                         std::shared_ptr<MemoryManager> memory_manager = nullptr)
+      : type_(type), memory_manager_(std::move(memory_manager)) {}
 
   Status Import(struct ArrowArray* src) {
     if (ArrowArrayIsReleased(src)) {
@@ -1264,7 +1364,7 @@ struct ArrayImporter {
     child_importers_.reserve(fields.size());
     for (int64_t i = 0; i < c_struct_->n_children; ++i) {
       DCHECK_NE(c_struct_->children[i], nullptr);
-      child_importers_.emplace_back(fields[i]->type());
+      child_importers_.emplace_back(fields[i]->type(), memory_manager_);
       RETURN_NOT_OK(child_importers_.back().ImportChild(this, c_struct_->children[i]));
     }
 
@@ -1279,7 +1379,7 @@ struct ArrayImporter {
       }
       const auto& dict_type = checked_cast<const DictionaryType&>(*type_);
       // Import dictionary values
-      ArrayImporter dict_importer(dict_type.value_type());
+      ArrayImporter dict_importer(dict_type.value_type(), memory_manager_);
       RETURN_NOT_OK(dict_importer.ImportDict(this, c_struct_->dictionary));
       data_->dictionary = dict_importer.GetArrayData();
     } else {
@@ -1427,6 +1527,12 @@ struct ArrayImporter {
           "ArrowArray struct has null bitmap buffer but non-zero null_count ",
           data_->null_count);
     }
+    if (!is_cpu() && data_->buffers[buffer_id] != nullptr &&
+        data_->null_count == kUnknownNullCount) {
+      // The null count would have to be computed from device memory
+      return Status::Invalid(
+          "ArrowArray struct has null bitmap in device memory but unknown null_count");
+    }
     return Status::OK();
   }
 
@@ -1453,6 +1559,10 @@ struct ArrayImporter {
   template <typename OffsetType>
   Status ImportStringValuesBuffer(int32_t offsets_buffer_id, int32_t buffer_id,
                                   int64_t byte_width = 1) {
+    if (!is_cpu()) {
+      return Status::NotImplemented("Importing ", type_->ToString(),
+                                    " array from device memory");
+    }
     auto offsets = data_->GetValues<OffsetType>(offsets_buffer_id);
     // Compute visible size of buffer
     int64_t buffer_size = byte_width * offsets[c_struct_->length];
@@ -1462,7 +1572,10 @@ struct ArrayImporter {
   Status ImportBuffer(int32_t buffer_id, int64_t buffer_size) {
     std::shared_ptr<Buffer>* out = &data_->buffers[buffer_id];
     auto data = reinterpret_cast<const uint8_t*>(c_struct_->buffers[buffer_id]);
-    if (data != nullptr) {
+    if (data != nullptr && memory_manager_ != nullptr) {
+      *out =
+          std::make_shared<ImportedBuffer>(data, buffer_size, memory_manager_, import_);
+    } else if (data != nullptr) {
       *out = std::make_shared<ImportedBuffer>(data, buffer_size, import_);
     } else {
       out->reset();
@@ -1470,9 +1583,12 @@ struct ArrayImporter {
     return Status::OK();
   }
 
+  bool is_cpu() const { return memory_manager_ == nullptr || memory_manager_->is_cpu(); }
+
   struct ArrowArray* c_struct_;
   int64_t recursion_level_;
   const std::shared_ptr<DataType>& type_;
+  std::shared_ptr<MemoryManager> memory_manager_;
 
   std::shared_ptr<ImportedArrayData> import_;
   std::shared_ptr<ArrayData> data_;
@@ -1516,6 +1632,20 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
   return ImportRecordBatch(array, *maybe_schema);
 }
 
+Result<std::shared_ptr<RecordBatch>> ImportDeviceRecordBatch(
+    struct ArrowDeviceArray* array, std::shared_ptr<Schema> schema,
+    std::shared_ptr<MemoryManager> mm) {
+  auto st = CheckDeviceType(array->device_type, mm->is_cpu());
+  if (!st.ok()) {
+    ArrowArrayRelease(&array->array);
+    return st;
+  }
+  auto type = struct_(schema->fields());
+  ArrayImporter importer(type, std::move(mm));
+  RETURN_NOT_OK(importer.Import(&array->array));
+  return importer.MakeRecordBatch(std::move(schema));
+}
+
 //////////////////////////////////////////////////////////////////////////
 // C stream export
 
@@ -1629,6 +1759,50 @@ Status ExportRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
   return Status::OK();
 }
 
+namespace {
+
+// A RecordBatchReader waiting on the batches of a readahead generator
+class GeneratorBatchReader : public RecordBatchReader {
+ public:
+  GeneratorBatchReader(std::shared_ptr<Schema> schema,
+                       AsyncGenerator<std::shared_ptr<RecordBatch>> generator)
+      : schema_(std::move(schema)), generator_(std::move(generator)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (finished_) {
+      // Don't call the generator again after it signalled the end
+      batch->reset();
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(*batch, generator_().result());
+    if (*batch == nullptr) {
+      finished_ = true;
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+Status ExportRecordBatchGenerator(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    struct ArrowArrayStream* out, int readahead) {
+  if (readahead > 0) {
+    generator = MakeSerialReadaheadGenerator(std::move(generator), readahead);
+  }
+  return ExportRecordBatchReader(
+      std::make_shared<GeneratorBatchReader>(std::move(schema), std::move(generator)),
+      out);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // C stream import
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -166,6 +167,50 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
 
 /// @}
 
+/// \defgroup c-device-interface Functions for working with the C device interface.
+///
+/// @{
+
+/// \brief EXPERIMENTAL: Export C++ RecordBatch using the C device interface.
+///
+/// Unlike ExportRecordBatch, the buffers of the record batch may live in
+/// non-CPU memory (e.g. CudaBuffers): their addresses are exported as-is,
+/// without copying the data to the host.  All buffers must live on the same
+/// device, and arrays with a validity bitmap in non-CPU memory must have a
+/// known null count.
+///
+/// \param[in] batch Record batch to export
+/// \param[in] device_type the type of the device the buffers live on
+/// \param[in] device_id the number of the device the buffers live on
+/// \param[in] sync_event optional event the consumer must wait on, or nullptr
+/// \param[out] out C struct where to export the record batch
+/// \param[out] out_schema optional C struct where to export the record batch schema
+ARROW_EXPORT
+Status ExportDeviceRecordBatch(const RecordBatch& batch, ArrowDeviceType device_type,
+                               int64_t device_id, void* sync_event,
+                               struct ArrowDeviceArray* out,
+                               struct ArrowSchema* out_schema = NULLPTR);
+
+/// \brief EXPERIMENTAL: Import C++ record batch from the C device interface.
+///
+/// The imported buffers are tied to the given memory manager, which must
+/// belong to the device described by the ArrowDeviceArray.  The caller is
+/// responsible for waiting on its `sync_event`, if any, before accessing
+/// the data.  Variable-size binary and string arrays can only be imported
+/// from CPU memory, as their offsets need to be read to compute the size of
+/// the data buffer.
+///
+/// \param[in,out] array C device interface struct holding the record batch data
+/// \param[in] schema schema of the imported record batch
+/// \param[in] mm memory manager of the device the buffers live on
+/// \return Imported record batch object
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ImportDeviceRecordBatch(
+    struct ArrowDeviceArray* array, std::shared_ptr<Schema> schema,
+    std::shared_ptr<MemoryManager> mm);
+
+/// @}
+
 /// \defgroup c-stream-interface Functions for working with the C data interface.
 ///
 /// @{
@@ -181,6 +226,25 @@ ARROW_EXPORT
 Status ExportRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
                                struct ArrowArrayStream* out);
 
+/// \brief EXPERIMENTAL: Export an async generator of record batches using the C
+/// stream interface.
+///
+/// Up to `readahead` batches are requested from the generator ahead of the
+/// consumer, so that producing the batches (e.g. scanning a dataset) overlaps
+/// with their consumption through the stream's get_next callback.  The
+/// generator is never called reentrantly and must signal the end of the
+/// stream with a null batch.
+///
+/// \param[in] schema schema of the generated record batches
+/// \param[in] generator async generator of record batches to export
+/// \param[out] out C struct where to export the stream
+/// \param[in] readahead maximum number of batches requested ahead of the consumer
+ARROW_EXPORT
+Status ExportRecordBatchGenerator(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    struct ArrowArrayStream* out, int readahead = 4);
+
 /// \brief EXPERIMENTAL: Import C++ RecordBatchReader from the C stream interface.
 ///
 /// The ArrowArrayStream struct has its contents moved to a private object
@@ -29,10 +29,12 @@
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
 #include "arrow/c/util_internal.h"
+#include "arrow/device.h"
 #include "arrow/ipc/json_simple.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
@@ -2864,6 +2866,95 @@ TEST_F(TestArrayStreamExport, Errors) {
   ASSERT_EQ(EINVAL, c_stream.get_next(&c_stream, &c_array));
 }
 
+TEST_F(TestArrayStreamExport, Generator) {
+  auto schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeBatches(
+      schema, {ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[4, 5, null]"),
+               ArrayFromJSON(int32(), "[6]")});
+
+  for (int readahead : {0, 1, 4}) {
+    SCOPED_TRACE(readahead);
+    struct ArrowArrayStream c_stream;
+
+    ASSERT_OK(ExportRecordBatchGenerator(schema, MakeVectorGenerator(batches), &c_stream,
+                                         readahead));
+    ArrayStreamExportGuard guard(&c_stream);
+
+    ASSERT_FALSE(ArrowArrayStreamIsReleased(&c_stream));
+    AssertStreamSchema(&c_stream, *schema);
+    for (const auto& batch : batches) {
+      AssertStreamNext(&c_stream, *batch);
+    }
+    AssertStreamEnd(&c_stream);
+    AssertStreamEnd(&c_stream);
+  }
+}
+
+TEST_F(TestArrayStreamExport, GeneratorErrors) {
+  auto schema = arrow::schema({field("ints", int32())});
+  struct ArrowArrayStream c_stream;
+
+  ASSERT_OK(ExportRecordBatchGenerator(
+      schema,
+      MakeFailingGenerator<std::shared_ptr<RecordBatch>>(
+          Status::Invalid("some example error")),
+      &c_stream));
+  ArrayStreamExportGuard guard(&c_stream);
+
+  AssertStreamSchema(&c_stream, *schema);
+  struct ArrowArray c_array;
+  ASSERT_EQ(EINVAL, c_stream.get_next(&c_stream, &c_array));
+  ASSERT_THAT(c_stream.get_last_error(&c_stream),
+              ::testing::HasSubstr("some example error"));
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Device array export / import tests
+
+class TestDeviceArrayRoundtrip : public BaseArrayStreamTest {};
+
+TEST_F(TestDeviceArrayRoundtrip, Cpu) {
+  auto schema = arrow::schema({field("ints", int32()), field("strs", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([[1, "a"], [null, "bc"], [3, null]])");
+
+  struct ArrowDeviceArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportDeviceRecordBatch(*batch, ARROW_DEVICE_CPU, /*device_id=*/0,
+                                    /*sync_event=*/nullptr, &c_array, &c_schema));
+  SchemaExportGuard schema_guard(&c_schema);
+  ArrayExportGuard array_guard(&c_array.array);
+  ASSERT_EQ(c_array.device_type, ARROW_DEVICE_CPU);
+  ASSERT_EQ(c_array.device_id, 0);
+  ASSERT_EQ(c_array.sync_event, nullptr);
+
+  ASSERT_OK_AND_ASSIGN(auto got_schema, ImportSchema(&c_schema));
+  AssertSchemaEqual(*schema, *got_schema);
+  ASSERT_OK_AND_ASSIGN(
+      auto got_batch,
+      ImportDeviceRecordBatch(&c_array, got_schema, default_cpu_memory_manager()));
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array.array));
+  AssertBatchesEqual(*batch, *got_batch);
+  // Zero-copy
+  ASSERT_EQ(got_batch->column(0)->data()->buffers[1]->address(),
+            batch->column(0)->data()->buffers[1]->address());
+}
+
+TEST_F(TestDeviceArrayRoundtrip, DeviceTypeMismatch) {
+  auto schema = arrow::schema({field("ints", int32())});
+  auto batch = RecordBatchFromJSON(schema, "[[1], [2]]");
+
+  struct ArrowDeviceArray c_array;
+  ASSERT_RAISES(Invalid, ExportDeviceRecordBatch(*batch, ARROW_DEVICE_CUDA, 0, nullptr,
+                                                 &c_array));
+
+  ASSERT_OK(ExportDeviceRecordBatch(*batch, ARROW_DEVICE_CPU, 0, nullptr, &c_array));
+  c_array.device_type = ARROW_DEVICE_CUDA;
+  ASSERT_RAISES(Invalid,
+                ImportDeviceRecordBatch(&c_array, schema, default_cpu_memory_manager()));
+  // The array was released on error
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array.array));
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Array stream roundtrip tests
 
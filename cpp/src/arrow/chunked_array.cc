@@ -18,10 +18,12 @@
 #include "arrow/chunked_array.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_nested.h"
@@ -31,6 +33,8 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -82,7 +86,18 @@ Result<std::shared_ptr<ChunkedArray>> ChunkedArray::Make(ArrayVector chunks,
   return std::make_shared<ChunkedArray>(std::move(chunks), std::move(type));
 }
 
+namespace {
+
+// Chunked arrays shorter than this are compared serially
+constexpr int64_t kMinParallelEqualsLength = 1 << 16;
+
+}  // namespace
+
 bool ChunkedArray::Equals(const ChunkedArray& other) const {
+  return Equals(other, /*use_threads=*/false);
+}
+
+bool ChunkedArray::Equals(const ChunkedArray& other, bool use_threads) const {
   if (length_ != other.length()) {
     return false;
   }
@@ -96,6 +111,33 @@ bool ChunkedArray::Equals(const ChunkedArray& other) const {
 
   // Check contents of the underlying arrays. This checks for equality of
   // the underlying data independently of the chunk size.
+  //
+  // A worker of the CPU pool compares serially, as the other workers may all
+  // be blocked waiting on this one.
+  if (use_threads && length_ >= kMinParallelEqualsLength &&
+      !internal::GetCpuThreadPool()->OwnsThisThread()) {
+    std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>> pieces;
+    internal::MultipleChunkIterator iterator(*this, other);
+    std::shared_ptr<Array> left_piece, right_piece;
+    while (iterator.Next(&left_piece, &right_piece)) {
+      pieces.emplace_back(std::move(left_piece), std::move(right_piece));
+    }
+    if (pieces.size() > 1) {
+      // Pieces are skipped once an unequal pair has been found
+      std::atomic<bool> equal(true);
+      Status st = internal::ParallelFor(static_cast<int>(pieces.size()), [&](int i) {
+        if (equal.load() && !pieces[i].first->Equals(*pieces[i].second)) {
+          equal.store(false);
+        }
+        return Status::OK();
+      });
+      // If not all pieces could be compared (e.g. the pool is shutting down)
+      // and no difference was found, compare serially below
+      if (st.ok() || !equal.load()) {
+        return equal.load();
+      }
+    }
+  }
   return internal::ApplyBinaryChunked(
              *this, other,
              [](const Array& left_piece, const Array& right_piece,
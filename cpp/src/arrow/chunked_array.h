@@ -136,6 +136,12 @@ class ARROW_EXPORT ChunkedArray {
   bool Equals(const ChunkedArray& other) const;
   /// \brief Determine if two chunked arrays are equal.
   bool Equals(const std::shared_ptr<ChunkedArray>& other) const;
+  /// \brief Determine if two chunked arrays are equal, optionally in parallel.
+  ///
+  /// Same as Equals(const ChunkedArray&), except that if `use_threads` is true,
+  /// the contiguous pieces of both chunked arrays are compared concurrently on
+  /// the CPU thread pool.
+  bool Equals(const ChunkedArray& other, bool use_threads) const;
 
   /// \return PrettyPrint representation suitable for debugging
   std::string ToString() const;
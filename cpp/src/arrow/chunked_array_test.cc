@@ -29,6 +29,7 @@
 #include "arrow/type.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -136,6 +137,55 @@ TEST_F(TestChunkedArray, EqualsDifferingMetadata) {
   ASSERT_TRUE(left.Equals(right));
 }
 
+TEST_F(TestChunkedArray, EqualsUseThreads) {
+  auto type = utf8();
+  ChunkedArray left({ArrayFromJSON(type, R"(["a", null, "bc"])"),
+                     ArrayFromJSON(type, R"(["d", "ef", null, "g"])"),
+                     ArrayFromJSON(type, R"(["hij"])")});
+  ChunkedArray right({ArrayFromJSON(type, R"(["a", null])"),
+                      ArrayFromJSON(type, R"(["bc", "d", "ef", null, "g", "hij"])")});
+  ChunkedArray unequal({ArrayFromJSON(type, R"(["a", null])"),
+                        ArrayFromJSON(type, R"(["bc", "d", "ef", null, "g", "hik"])")});
+  for (bool use_threads : {false, true}) {
+    ASSERT_TRUE(left.Equals(right, use_threads));
+    ASSERT_TRUE(right.Equals(left, use_threads));
+    ASSERT_FALSE(left.Equals(unequal, use_threads));
+    ASSERT_FALSE(unequal.Equals(left, use_threads));
+  }
+}
+
+TEST_F(TestChunkedArray, EqualsUseThreadsLarge) {
+  // Long enough to be compared in parallel
+  const int64_t length = 1 << 17;
+  auto values = random::RandomArrayGenerator(0x5EED).Int32(length, 0, 1000,
+                                                           /*null_probability=*/0);
+  ChunkedArray left({values->Slice(0, 1 << 15), values->Slice(1 << 15)});
+  ArrayVector right_chunks;
+  for (int64_t offset = 0; offset < length; offset += 10000) {
+    right_chunks.push_back(values->Slice(offset, 10000));
+  }
+  ChunkedArray right(right_chunks);
+  ChunkedArray unequal({values->Slice(0, length - 1), ArrayFromJSON(int32(), "[-1]")});
+
+  ASSERT_TRUE(left.Equals(right, /*use_threads=*/true));
+  ASSERT_FALSE(left.Equals(unequal, /*use_threads=*/true));
+  ASSERT_FALSE(unequal.Equals(right, /*use_threads=*/true));
+
+  // Comparisons in CPU pool tasks don't wait on tasks queued behind them
+  auto pool = internal::GetCpuThreadPool();
+  std::vector<Future<bool>> futures;
+  for (int i = 0; i < 2 * pool->GetCapacity(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, pool->Submit([&, i] {
+      return left.Equals(i % 2 ? right : unequal, /*use_threads=*/true);
+    }));
+    futures.push_back(std::move(future));
+  }
+  for (size_t i = 0; i < futures.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(bool equal, futures[i].result());
+    ASSERT_EQ(equal, i % 2 == 1);
+  }
+}
+
 TEST_F(TestChunkedArray, SliceEquals) {
   arrays_one_.push_back(MakeRandomArray<Int32Array>(100));
   arrays_one_.push_back(MakeRandomArray<Int32Array>(50));
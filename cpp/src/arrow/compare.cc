@@ -19,6 +19,7 @@
 
 #include "arrow/compare.h"
 
+#include <algorithm>
 #include <climits>
 #include <cmath>
 #include <cstdint>
@@ -46,6 +47,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/memory.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -70,9 +72,12 @@ struct FloatingEquality {
   bool operator()(T x, T y) { return x == y; }
 };
 
+// The predicates below use non-short-circuiting operators so that loops
+// calling them can be vectorized.
+
 template <typename T>
 struct FloatingEquality<T, NansEqual> {
-  bool operator()(T x, T y) { return (x == y) || (std::isnan(x) && std::isnan(y)); }
+  bool operator()(T x, T y) { return (x == y) | ((x != x) & (y != y)); }
 };
 
 template <typename T>
@@ -80,7 +85,7 @@ struct FloatingEquality<T, Approximate> {
   explicit FloatingEquality(const EqualOptions& options)
       : epsilon(static_cast<T>(options.atol())) {}
 
-  bool operator()(T x, T y) { return (fabs(x - y) <= epsilon) || (x == y); }
+  bool operator()(T x, T y) { return (std::abs(x - y) <= epsilon) | (x == y); }
 
   const T epsilon;
 };
@@ -91,7 +96,7 @@ struct FloatingEquality<T, Approximate | NansEqual> {
       : epsilon(static_cast<T>(options.atol())) {}
 
   bool operator()(T x, T y) {
-    return (fabs(x - y) <= epsilon) || (x == y) || (std::isnan(x) && std::isnan(y));
+    return (std::abs(x - y) <= epsilon) | (x == y) | ((x != x) & (y != y));
   }
 
   const T epsilon;
@@ -198,6 +203,11 @@ class RangeDataEqualsImpl {
   Status Visit(const BooleanType&) {
     const uint8_t* left_bits = left_.GetValues<uint8_t>(1, 0);
     const uint8_t* right_bits = right_.GetValues<uint8_t>(1, 0);
+    if (left_.MayHaveNulls() &&
+        BitmapEquals(left_bits, left_start_idx_ + left_.offset, right_bits,
+                     right_start_idx_ + right_.offset, range_length_)) {
+      return Status::OK();
+    }
     auto compare_runs = [&](int64_t i, int64_t length) -> bool {
       if (length <= 8) {
         // Avoid the BitmapUInt64Reader overhead for very small runs
@@ -240,12 +250,34 @@ class RangeDataEqualsImpl {
   // Also matches LargeStringType
   Status Visit(const LargeBinaryType& type) { return CompareBinary(type); }
 
+  Status Visit(const StringViewType&) {
+    const StringViewArray left(left_.Copy()), right(right_.Copy());
+    const auto* left_views = left.raw_views() + left_start_idx_;
+    const auto* right_views = right.raw_views() + right_start_idx_;
+
+    auto compare_runs = [&](int64_t i, int64_t length) -> bool {
+      for (int64_t j = i; j < i + length; ++j) {
+        if (left.GetView(left_views[j]) != right.GetView(right_views[j])) {
+          return false;
+        }
+      }
+      return true;
+    };
+    VisitValidRuns(compare_runs);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryType& type) {
     const auto byte_width = type.byte_width();
     const uint8_t* left_data = left_.GetValues<uint8_t>(1, 0);
     const uint8_t* right_data = right_.GetValues<uint8_t>(1, 0);
 
     if (left_data != nullptr && right_data != nullptr) {
+      if (WholeRangeEquals(left_data + (left_start_idx_ + left_.offset) * byte_width,
+                           right_data + (right_start_idx_ + right_.offset) * byte_width,
+                           range_length_ * byte_width)) {
+        return Status::OK();
+      }
       auto compare_runs = [&](int64_t i, int64_t length) -> bool {
         return memcmp(left_data + (left_start_idx_ + left_.offset + i) * byte_width,
                       right_data + (right_start_idx_ + right_.offset + i) * byte_width,
@@ -365,6 +397,22 @@ class RangeDataEqualsImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Compare the values of each pair of overlapping runs
+    const auto left = left_.Slice(left_start_idx_, range_length_);
+    const auto right = right_.Slice(right_start_idx_, range_length_);
+    const ArrayData& left_values = ree_util::ValuesArray(left_);
+    const ArrayData& right_values = ree_util::ValuesArray(right_);
+    for (ree_util::MergedRunsIterator it(*left, *right); !it.is_end() && result_;
+         it.Next()) {
+      RangeDataEqualsImpl impl(options_, floating_approximate_, left_values, right_values,
+                               it.left_physical_index(), it.right_physical_index(),
+                               /*range_length=*/1);
+      result_ &= impl.Compare();
+    }
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionType& type) {
     // Compare storages
     result_ &= CompareWithType(*type.storage_type());
@@ -381,12 +429,27 @@ class RangeDataEqualsImpl {
 
     template <typename CompareFunction>
     void operator()(CompareFunction&& compare) {
-      impl->VisitValues([&](int64_t i) {
-        const CType x = left_values[i + impl->left_start_idx_];
-        const CType y = right_values[i + impl->right_start_idx_];
-        return compare(x, y);
+      const CType* left = left_values + impl->left_start_idx_;
+      const CType* right = right_values + impl->right_start_idx_;
+      impl->VisitValidRuns([&](int64_t i, int64_t length) {
+        // Compare block by block without branching inside a block, so that the
+        // inner loop is vectorized, and stop at the first unequal block
+        const int64_t end = i + length;
+        for (int64_t block_start = i; block_start < end; block_start += kBlockSize) {
+          const int64_t block_end = std::min(block_start + kBlockSize, end);
+          bool equal = true;
+          for (int64_t j = block_start; j < block_end; ++j) {
+            equal &= compare(left[j], right[j]);
+          }
+          if (!equal) {
+            return false;
+          }
+        }
+        return true;
       });
     }
+
+    static constexpr int64_t kBlockSize = 256;
   };
 
   template <typename CType>
@@ -396,6 +459,10 @@ class RangeDataEqualsImpl {
   Status ComparePrimitive(const TypeClass&) {
     const CType* left_values = left_.GetValues<CType>(1);
     const CType* right_values = right_.GetValues<CType>(1);
+    if (WholeRangeEquals(left_values + left_start_idx_, right_values + right_start_idx_,
+                         range_length_ * sizeof(CType))) {
+      return Status::OK();
+    }
     VisitValidRuns([&](int64_t i, int64_t length) {
       return memcmp(left_values + left_start_idx_ + i,
                     right_values + right_start_idx_ + i, length * sizeof(CType)) == 0;
@@ -409,6 +476,12 @@ class RangeDataEqualsImpl {
     const CType* left_values = left_.GetValues<CType>(1);
     const CType* right_values = right_.GetValues<CType>(1);
 
+    // Identical bits imply equality, unless NaNs compare unequal
+    if (options_.nans_equal() &&
+        memcmp(left_values + left_start_idx_, right_values + right_start_idx_,
+               range_length_ * sizeof(CType)) == 0) {
+      return Status::OK();
+    }
     ComparatorVisitor<CType> visitor{this, left_values, right_values};
     VisitFloatingEquality<CType>(options_, floating_approximate_, visitor);
     return Status::OK();
@@ -420,6 +493,18 @@ class RangeDataEqualsImpl {
     const uint8_t* right_data = right_.GetValues<uint8_t>(2, 0);
 
     if (left_data != nullptr && right_data != nullptr) {
+      if (left_.MayHaveNulls()) {
+        using offset_type = typename TypeClass::offset_type;
+        const offset_type* left_offsets =
+            left_.GetValues<offset_type>(1) + left_start_idx_;
+        const offset_type* right_offsets =
+            right_.GetValues<offset_type>(1) + right_start_idx_;
+        if (OffsetsEqual(left_offsets, right_offsets, range_length_) &&
+            memcmp(left_data + left_offsets[0], right_data + right_offsets[0],
+                   left_offsets[range_length_] - left_offsets[0]) == 0) {
+          return Status::OK();
+        }
+      }
       const auto compare_ranges = [&](int64_t left_offset, int64_t right_offset,
                                       int64_t length) -> bool {
         return memcmp(left_data + left_offset, right_data + right_offset, length) == 0;
@@ -474,14 +559,27 @@ class RangeDataEqualsImpl {
     VisitValidRuns(compare_runs);
   }
 
-  template <typename CompareValues>
-  void VisitValues(CompareValues&& compare_values) {
-    internal::VisitSetBitRunsVoid(left_.buffers[0], left_.offset + left_start_idx_,
-                                  range_length_, [&](int64_t position, int64_t length) {
-                                    for (int64_t i = 0; i < length; ++i) {
-                                      result_ &= compare_values(position + i);
-                                    }
-                                  });
+  // Compare the values of the whole range at once, including null slots.
+  // This is only attempted when there may be nulls: buffers produced the same way
+  // usually hold the same bytes in null slots, and comparing them in one go avoids
+  // splitting the comparison at each null.
+  bool WholeRangeEquals(const void* left, const void* right, int64_t nbytes) const {
+    return left_.MayHaveNulls() && memcmp(left, right, nbytes) == 0;
+  }
+
+  // Whether two ranges of offsets are equal, up to a constant shift
+  template <typename offset_type>
+  static bool OffsetsEqual(const offset_type* left, const offset_type* right,
+                           int64_t length) {
+    if (left[0] == right[0]) {
+      return memcmp(left, right, (length + 1) * sizeof(offset_type)) == 0;
+    }
+    const offset_type shift = right[0] - left[0];
+    bool equal = true;
+    for (int64_t i = 1; i <= length; ++i) {
+      equal &= (left[i] + shift == right[i]);
+    }
+    return equal;
   }
 
   // Visit and compare runs of non-null values
@@ -569,7 +667,7 @@ class TypeEqualsVisitor {
 
   template <typename T>
   enable_if_t<is_null_type<T>::value || is_primitive_ctype<T>::value ||
-                  is_base_binary_type<T>::value,
+                  is_base_binary_type<T>::value || is_string_view_type<T>::value,
               Status>
   Visit(const T&) {
     result_ = true;
@@ -623,6 +721,8 @@ class TypeEqualsVisitor {
     return VisitChildren(left);
   }
 
+  Status Visit(const RunEndEncodedType& left) { return VisitChildren(left); }
+
   Status Visit(const MapType& left) {
     const auto& right = checked_cast<const MapType&>(right_);
     if (left.keys_sorted() != right.keys_sorted()) {
@@ -795,6 +895,12 @@ class ScalarEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& left) {
+    const auto& right = checked_cast<const RunEndEncodedScalar&>(right_);
+    result_ = ScalarEquals(*left.value, *right.value, options_, floating_approximate_);
+    return Status::OK();
+  }
+
   Status Visit(const ExtensionScalar& left) {
     return Status::NotImplemented("extension");
   }
@@ -17,11 +17,13 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "benchmark/benchmark.h"
 
 #include "arrow/array.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compare.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -70,6 +72,26 @@ static void ArrayRangeEqualsFloat32(benchmark::State& state) {
   BenchmarkArrayRangeEquals(array, state);
 }
 
+static void ArrayRangeApproxEqualsFloat64(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array = rng.Float64(args.size, 0, 100, args.null_proportion);
+  const auto right_array =
+      MakeArray(array->data()->Copy())->Slice(1, array->length() - 1);
+  const auto options = EqualOptions().atol(1e-5).nans_equal(true);
+
+  for (auto _ : state) {
+    const bool are_ok = ArrayRangeApproxEquals(*array, *right_array,
+                                               /*left_start_idx=*/1,
+                                               /*left_end_idx=*/array->length() - 2,
+                                               /*right_start_idx=*/0, options);
+    if (ARROW_PREDICT_FALSE(!are_ok)) {
+      ARROW_LOG(FATAL) << "Arrays should have compared equal";
+    }
+  }
+}
+
 static void ArrayRangeEqualsBoolean(benchmark::State& state) {
   RegressionArgs args(state, /*size_is_bytes=*/false);
 
@@ -151,8 +173,42 @@ static void ArrayRangeEqualsDenseUnion(benchmark::State& state) {
   BenchmarkArrayRangeEquals(array, state);
 }
 
+static void BenchmarkChunkedArrayEquals(benchmark::State& state, bool use_threads) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array = rng.Int64(args.size, 0, 100, args.null_proportion);
+
+  // Chunk both sides differently so that the pieces are compared
+  // as slices of different chunks
+  auto make_chunked = [&](int64_t chunk_size) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < array->length(); offset += chunk_size) {
+      chunks.push_back(array->Slice(offset, chunk_size));
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), array->type());
+  };
+  const auto left = make_chunked(args.size / 16 + 1);
+  const auto right = make_chunked(args.size / 13 + 1);
+
+  for (auto _ : state) {
+    if (ARROW_PREDICT_FALSE(!left->Equals(*right, use_threads))) {
+      ARROW_LOG(FATAL) << "Chunked arrays should have compared equal";
+    }
+  }
+}
+
+static void ChunkedArrayEqualsInt64(benchmark::State& state) {
+  BenchmarkChunkedArrayEquals(state, /*use_threads=*/false);
+}
+
+static void ChunkedArrayEqualsInt64Threaded(benchmark::State& state) {
+  BenchmarkChunkedArrayEquals(state, /*use_threads=*/true);
+}
+
 BENCHMARK(ArrayRangeEqualsInt32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsFloat32)->Apply(RegressionSetArgs);
+BENCHMARK(ArrayRangeApproxEqualsFloat64)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsBoolean)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsString)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsFixedSizeBinary)->Apply(RegressionSetArgs);
@@ -160,5 +216,7 @@ BENCHMARK(ArrayRangeEqualsListOfInt32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsStruct)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsSparseUnion)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsDenseUnion)->Apply(RegressionSetArgs);
+BENCHMARK(ChunkedArrayEqualsInt64)->Apply(RegressionSetArgs);
+BENCHMARK(ChunkedArrayEqualsInt64Threaded)->Apply(RegressionSetArgs);
 
 }  // namespace arrow
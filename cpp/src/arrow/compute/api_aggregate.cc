@@ -73,5 +73,11 @@ Result<Datum> TDigest(const Datum& value, const TDigestOptions& options,
   return CallFunction("tdigest", {value}, &options, ctx);
 }
 
+Result<Datum> ApproxCountDistinct(const Datum& value,
+                                  const ApproxCountDistinctOptions& options,
+                                  ExecContext* ctx) {
+  return CallFunction("approx_count_distinct", {value}, &options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -149,6 +149,29 @@ struct ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t buffer_size;
 };
 
+/// \brief Control ApproxCountDistinct kernel behavior
+///
+/// By default, returns the estimated number of distinct non-null values.
+struct ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+  explicit ApproxCountDistinctOptions(int32_t precision = 14, bool merge_sketches = false,
+                                      bool output_sketch = false)
+      : precision{precision},
+        merge_sketches{merge_sketches},
+        output_sketch{output_sketch} {}
+
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  /// number of hash bits indexing the 2^precision registers of the HyperLogLog
+  /// sketch, between 4 and 18. The relative standard error of the estimate is about
+  /// 1.04 / sqrt(2^precision), default 14 (0.8%, with sketches of up to 16 KiB)
+  int32_t precision;
+  /// whether the input is binary sketches output with output_sketch, which are merged
+  /// instead of counted as values, e.g. to roll up pre-aggregated sketches
+  bool merge_sketches;
+  /// whether to output a binary sketch instead of the estimate
+  bool output_sketch;
+};
+
 /// @}
 
 /// \brief Count non-null (or null) values in an array.
@@ -306,6 +329,26 @@ Result<Datum> TDigest(const Datum& value,
                       const TDigestOptions& options = TDigestOptions::Defaults(),
                       ExecContext* ctx = NULLPTR);
 
+/// \brief Estimate the number of distinct non-null values of an array with the
+/// HyperLogLog++ algorithm
+///
+/// Unlike counting the unique values exactly, this takes bounded memory whatever the
+/// number of distinct values. Sketches of partial results may also be output, stored
+/// and merged later, see ApproxCountDistinctOptions.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an int64 scalar, or a binary scalar holding the sketch
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproxCountDistinct(
+    const Datum& value,
+    const ApproxCountDistinctOptions& options = ApproxCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 namespace internal {
 
 /// Internal use only: streaming group identifier.
@@ -323,6 +366,11 @@ class ARROW_EXPORT Grouper {
   /// be as wide as necessary.
   virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
 
+  /// Look up the group ids of a batch of keys without adding groups, producing a uint32
+  /// array which is null where a key doesn't belong to any group.  Once all keys were
+  /// consumed, may be called concurrently.
+  virtual Result<Datum> Lookup(const ExecBatch& batch) = 0;
+
   /// Get current unique keys. May be called multiple times.
   virtual Result<ExecBatch> GetUniques() = 0;
 
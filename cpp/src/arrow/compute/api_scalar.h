@@ -20,8 +20,10 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/exec.h"  // IWYU pragma: keep
 #include "arrow/compute/function.h"
@@ -49,6 +51,14 @@ struct ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   std::string pattern;
 };
 
+struct ARROW_EXPORT MatchAnySubstringOptions : public FunctionOptions {
+  explicit MatchAnySubstringOptions(std::vector<std::string> patterns)
+      : patterns(std::move(patterns)) {}
+
+  /// The exact substrings to look for inside input values.
+  std::vector<std::string> patterns;
+};
+
 struct ARROW_EXPORT SplitOptions : public FunctionOptions {
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false)
       : max_splits(max_splits), reverse(reverse) {}
@@ -69,6 +69,14 @@ Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("select_k_unstable", {datum}, &options, ctx));
+  return result.make_array();
+}
+
 Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, ctx));
   return result.make_array();
@@ -79,6 +87,53 @@ Result<Datum> DictionaryEncode(const Datum& value, const DictionaryEncodeOptions
   return CallFunction("dictionary_encode", {value}, &options, ctx);
 }
 
+Result<Datum> RunEndEncode(const Datum& value, const RunEndEncodeOptions& options,
+                           ExecContext* ctx) {
+  return CallFunction("run_end_encode", {value}, &options, ctx);
+}
+
+Result<Datum> RunEndDecode(const Datum& value, ExecContext* ctx) {
+  return CallFunction("run_end_decode", {value}, ctx);
+}
+
+Result<Datum> CumulativeSum(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_sum", {values}, &options, ctx);
+}
+
+Result<Datum> CumulativeProduct(const Datum& values, const CumulativeOptions& options,
+                                ExecContext* ctx) {
+  return CallFunction("cumulative_prod", {values}, &options, ctx);
+}
+
+Result<Datum> CumulativeMin(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_min", {values}, &options, ctx);
+}
+
+Result<Datum> CumulativeMax(const Datum& values, const CumulativeOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("cumulative_max", {values}, &options, ctx);
+}
+
+Result<Datum> Rolling(const Datum& values, const std::string& aggregation,
+                      const RollingWindowOptions& options, ExecContext* ctx) {
+  return CallFunction("rolling_" + aggregation, {values}, &options, ctx);
+}
+
+Result<RecordBatchVector> HashPartition(const std::shared_ptr<RecordBatch>& batch,
+                                        const HashPartitionOptions& options,
+                                        ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("hash_partition", {Datum(batch)}, &options, ctx));
+  RecordBatchVector partitions;
+  partitions.reserve(result.collection().size());
+  for (const auto& partition : result.collection()) {
+    partitions.push_back(partition.record_batch());
+  }
+  return partitions;
+}
+
 const char kValuesFieldName[] = "values";
 const char kCountsFieldName[] = "counts";
 const int32_t kValuesFieldIndex = 0;
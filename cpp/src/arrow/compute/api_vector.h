@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
@@ -81,6 +84,56 @@ struct DictionaryEncodeOptions : public FunctionOptions {
   NullEncodingBehavior null_encoding_behavior = MASK;
 };
 
+/// \brief Options for the run_end_encode function
+struct ARROW_EXPORT RunEndEncodeOptions : public FunctionOptions {
+  explicit RunEndEncodeOptions(std::shared_ptr<DataType> run_end_type = int32())
+      : run_end_type(std::move(run_end_type)) {}
+
+  static RunEndEncodeOptions Defaults() { return RunEndEncodeOptions(); }
+
+  /// The type of the run ends: int16, int32 or int64
+  std::shared_ptr<DataType> run_end_type;
+};
+
+/// \brief Options for the cumulative functions
+struct ARROW_EXPORT CumulativeOptions : public FunctionOptions {
+  explicit CumulativeOptions(bool skip_nulls = false) : skip_nulls(skip_nulls) {}
+
+  static CumulativeOptions Defaults() { return CumulativeOptions(); }
+
+  /// If true, nulls are emitted as null and leave the running value unchanged.
+  /// If false, the first null and every value after it are emitted as null.
+  bool skip_nulls = false;
+};
+
+/// \brief Options for the rolling window functions
+struct ARROW_EXPORT RollingWindowOptions : public FunctionOptions {
+  explicit RollingWindowOptions(int64_t window_size = 1, int64_t min_periods = -1)
+      : window_size(window_size), min_periods(min_periods) {}
+
+  static RollingWindowOptions Defaults() { return RollingWindowOptions(); }
+
+  /// The number of rows in each window, ending at (and including) the current row
+  int64_t window_size;
+  /// The minimum number of non-null values a window needs to produce a
+  /// non-null result.  A negative value means the window size.
+  int64_t min_periods;
+};
+
+/// \brief Options for the hash_partition function
+struct ARROW_EXPORT HashPartitionOptions : public FunctionOptions {
+  explicit HashPartitionOptions(std::vector<std::string> keys = {},
+                                int32_t num_partitions = 1)
+      : keys(std::move(keys)), num_partitions(num_partitions) {}
+
+  static HashPartitionOptions Defaults() { return HashPartitionOptions(); }
+
+  /// Names of the columns whose values are hashed to choose the partition of a row
+  std::vector<std::string> keys;
+  /// The number of output partitions
+  int32_t num_partitions;
+};
+
 /// \brief One sort key for PartitionNthIndices (TODO) and SortIndices
 struct ARROW_EXPORT SortKey {
   explicit SortKey(std::string name, SortOrder order = SortOrder::Ascending)
@@ -116,6 +169,43 @@ struct ARROW_EXPORT PartitionNthOptions : public FunctionOptions {
   int64_t pivot;
 };
 
+/// \brief Options for SelectKUnstable
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  static SelectKOptions Defaults() { return SelectKOptions{}; }
+
+  /// Select the k largest values of the given columns
+  static SelectKOptions TopKDefault(int64_t k, std::vector<std::string> key_names = {}) {
+    return WithOrder(k, std::move(key_names), SortOrder::Descending);
+  }
+  /// Select the k smallest values of the given columns
+  static SelectKOptions BottomKDefault(int64_t k,
+                                       std::vector<std::string> key_names = {}) {
+    return WithOrder(k, std::move(key_names), SortOrder::Ascending);
+  }
+
+  /// The number of elements to select; must be non-negative.
+  int64_t k;
+  /// The columns to order by. For an array or chunked array input, only the
+  /// order of the first key is used and its name is ignored.
+  std::vector<SortKey> sort_keys;
+
+ private:
+  static SelectKOptions WithOrder(int64_t k, std::vector<std::string> key_names,
+                                  SortOrder order) {
+    if (key_names.empty()) {
+      key_names.emplace_back("not-used");
+    }
+    std::vector<SortKey> sort_keys;
+    for (auto& name : key_names) {
+      sort_keys.emplace_back(std::move(name), order);
+    }
+    return SelectKOptions(k, std::move(sort_keys));
+  }
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -269,6 +359,28 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
                                            ExecContext* ctx = NULLPTR);
 
+/// \brief Returns the indices of the first k elements of an input in
+/// the specified order. Input is one of array, chunked array, record
+/// batch or table.
+///
+/// The output holds min(k, length) indices, ordered as sort_indices
+/// would order them, but the order of equal elements is unspecified.
+/// Nulls and NaNs are ordered at the end as in SortIndices(), so they
+/// are only selected when there are fewer than k other values.
+/// Memory usage is proportional to k rather than to the input length.
+///
+/// For example given array = [null, 1, 3.3, null, 2, 5.3] and
+/// options = SelectKOptions::TopKDefault(2), the output will be [5, 2].
+///
+/// \param[in] datum array, chunked array, record batch or table to select from
+/// \param[in] options number of elements to select and sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected elements
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -331,6 +443,184 @@ Result<Datum> DictionaryEncode(
     const DictionaryEncodeOptions& options = DictionaryEncodeOptions::Defaults(),
     ExecContext* ctx = NULLPTR);
 
+/// \brief Run-end encode values in an array-like object
+///
+/// Each run of equal consecutive values is stored once, along with the
+/// position where the run ends.  Nulls are equal to each other.
+///
+/// For example, given values ["a", "a", null, null, "b"] the output will be
+/// Run ends: [2, 4, 5] / Values: ["a", null, "b"]
+///
+/// \param[in] data array-like input
+/// \param[in] options configures the run end type
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input and a run-end encoded type
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> RunEndEncode(
+    const Datum& data,
+    const RunEndEncodeOptions& options = RunEndEncodeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Decode run-end encoded values into a plain array-like object
+///
+/// \param[in] data run-end encoded array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input and the type of its values
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> RunEndDecode(const Datum& data, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running sum of a numeric array-like object
+///
+/// For example, given values [1, 2, null, 4] the output will be [1, 3, null, null],
+/// or [1, 3, null, 7] if nulls are skipped.  Integer sums wrap around on overflow.
+/// State is carried from one chunk to the next for chunked input.
+///
+/// \param[in] values numeric array-like input
+/// \param[in] options configures null handling
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CumulativeSum(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running product of a numeric array-like object
+///
+/// \see CumulativeSum
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CumulativeProduct(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running minimum of a numeric array-like object
+///
+/// \see CumulativeSum
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CumulativeMin(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running maximum of a numeric array-like object
+///
+/// \see CumulativeSum
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CumulativeMax(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Aggregate a numeric array-like object over a rolling window of rows
+///
+/// Each output value aggregates the non-null input values of the window ending
+/// at the same row.  Windows at the start of the input are shorter than the
+/// window size.  A window with fewer non-null values than
+/// RollingWindowOptions::min_periods produces a null.
+///
+/// For example, a rolling "sum" of [1, 2, 3, null, 5] over a window of 2 rows
+/// with min_periods 1 gives [1, 3, 5, 3, 5].
+///
+/// \param[in] values numeric array-like input
+/// \param[in] aggregation one of "sum", "mean", "min" or "max"
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input; "mean" gives float64,
+/// the other aggregations give the input type
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Rolling(const Datum& values, const std::string& aggregation,
+                      const RollingWindowOptions& options,
+                      ExecContext* ctx = NULLPTR);
+
+/// \brief Split a record batch into partitions according to the hash of key columns
+///
+/// The values of the key columns are hashed together for each row, and the row
+/// goes to partition `hash % num_partitions`.  Rows with equal keys therefore
+/// always land in the same partition, which is what a hash shuffle needs.
+/// Within a partition, rows keep their relative order from the input.
+///
+/// \param[in] batch the record batch to partition
+/// \param[in] options the key columns and the number of partitions
+/// \param[in] ctx the function execution context, optional
+/// \return HashPartitionOptions::num_partitions record batches with the schema
+/// of the input, some of which may be empty
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<RecordBatchVector> HashPartition(const std::shared_ptr<RecordBatch>& batch,
+                                        const HashPartitionOptions& options,
+                                        ExecContext* ctx = NULLPTR);
+
+/// \brief Dictionary-encode a stream of arrays against a single dictionary
+///
+/// Unlike DictionaryEncode(), the hash table of distinct values is kept
+/// between calls to Encode(): each value is hashed once, previously seen values
+/// keep their index, and only new values are appended to the dictionary.
+/// The dictionary of each encoded array therefore starts with the dictionary
+/// of the previous one, so that writing the encoded arrays to an IPC stream
+/// with ipc::IpcWriteOptions::emit_dictionary_deltas emits the new entries as
+/// dictionary deltas.  When an array adds no value, the previous dictionary
+/// is reused as is, and the IPC writer skips it by pointer comparison.
+///
+/// Nulls are handled according to the DictionaryEncodeOptions, as in
+/// DictionaryEncode().  An encoder is not thread-safe.
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT StreamingDictionaryEncoder {
+ public:
+  virtual ~StreamingDictionaryEncoder() = default;
+
+  /// \brief Make an encoder for values of the given type
+  ///
+  /// \param[in] value_type the type of the values to encode
+  /// \param[in] options configures null encoding behavior
+  /// \param[in] ctx the function execution context, optional, which must outlive
+  /// the encoder
+  static Result<std::unique_ptr<StreamingDictionaryEncoder>> Make(
+      const std::shared_ptr<DataType>& value_type,
+      const DictionaryEncodeOptions& options = DictionaryEncodeOptions::Defaults(),
+      ExecContext* ctx = NULLPTR);
+
+  /// \brief Encode an array or chunked array of the value type
+  ///
+  /// \return an array or chunked array of type dictionary(int32(), value_type),
+  /// whose dictionary is the whole dictionary after encoding `values`
+  virtual Result<Datum> Encode(const Datum& values) = 0;
+
+  /// \brief The dictionary, i.e. the distinct values encoded so far
+  virtual Result<std::shared_ptr<Array>> GetDictionary() = 0;
+
+  /// \brief The dictionary entries added since the previous call to
+  /// GetDelta(), or since the encoder was made
+  virtual Result<std::shared_ptr<Array>> GetDelta() = 0;
+
+  /// \brief The number of occurrences of each dictionary entry in the values
+  /// encoded so far, as in ValueCounts()
+  ///
+  /// With null_encoding == MASK, nulls are not counted.
+  virtual Result<std::shared_ptr<StructArray>> ValueCounts() = 0;
+};
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
@@ -26,6 +26,7 @@
 
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec.h"
+#include "arrow/compute/exec_internal.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/registry.h"
@@ -86,6 +87,28 @@ const FunctionDoc cast_doc{"Cast values to another data type",
 
 // Metafunction for dispatching to appropriate CastFunction. This corresponds
 // to the standard SQL CAST(expr AS target_type)
+// A cast to the type of the argument
+class BoundIdentityCast : public BoundFunction {
+ public:
+  BoundIdentityCast(const std::vector<ValueDescr>& descrs, ExecContext* ctx)
+      : BoundFunction(descrs, descrs[0]), ctx_(ctx) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(
+      const std::vector<Datum>& args,
+      const std::shared_ptr<SelectionVector>& selection) const override {
+    if (selection == nullptr) {
+      return args[0];
+    }
+    ARROW_ASSIGN_OR_RAISE(auto selected_args,
+                          compute::detail::GatherSelection(args, *selection, ctx_));
+    return selected_args[0];
+  }
+
+ private:
+  ExecContext* ctx_;
+};
+
 class CastMetaFunction : public MetaFunction {
  public:
   CastMetaFunction() : MetaFunction("cast", Arity::Unary(), &cast_doc) {}
@@ -114,6 +137,22 @@ class CastMetaFunction : public MetaFunction {
         GetCastFunctionInternal(cast_options->to_type, args[0].type().get()));
     return cast_func->Execute(args, options, ctx);
   }
+
+  Result<std::unique_ptr<BoundFunction>> Bind(const std::vector<ValueDescr>& descrs,
+                                              const FunctionOptions* options,
+                                              ExecContext* ctx) const override {
+    ARROW_ASSIGN_OR_RAISE(auto cast_options, ValidateOptions(options));
+    RETURN_NOT_OK(CheckArity(descrs));
+    if (descrs[0].type->Equals(*cast_options->to_type)) {
+      return std::unique_ptr<BoundFunction>(
+          new BoundIdentityCast(descrs, ctx ? ctx : default_exec_context()));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<CastFunction> cast_func,
+        GetCastFunctionInternal(cast_options->to_type, descrs[0].type.get()));
+    // Cast functions are kept alive by the cast table
+    return cast_func->Bind(descrs, options, ctx);
+  }
 };
 
 }  // namespace
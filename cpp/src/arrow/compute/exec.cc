@@ -20,16 +20,19 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_dict.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
@@ -41,12 +44,15 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_writer.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -54,7 +60,9 @@ namespace arrow {
 using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
+using internal::CountSetBits;
 using internal::CpuInfo;
+using internal::FirstTimeBitmapWriter;
 
 namespace compute {
 
@@ -460,6 +468,57 @@ class NullPropagator {
   bool bitmap_preallocated_ = false;
 };
 
+// Null propagation for the rows selected by a selection vector: the validity
+// bits of the selected rows are gathered from the arguments
+Status PropagateSelectedNulls(KernelContext* ctx, const ExecBatch& batch,
+                              ArrayData* output) {
+  bool is_all_null = false;
+  std::vector<const ArrayData*> arrays_with_nulls;
+  for (const Datum& datum : batch.values) {
+    auto null_generalization = NullGeneralization::Get(datum);
+    if (null_generalization == NullGeneralization::ALL_NULL) {
+      is_all_null = true;
+    } else if (null_generalization == NullGeneralization::PERHAPS_NULL &&
+               datum.kind() == Datum::ARRAY && datum.array()->buffers[0] != nullptr) {
+      arrays_with_nulls.push_back(datum.array().get());
+    }
+  }
+
+  if (!is_all_null && arrays_with_nulls.empty()) {
+    output->null_count = 0;
+    if (output->buffers[0] != nullptr) {
+      BitUtil::SetBitsTo(output->buffers[0]->mutable_data(), output->offset,
+                         output->length, true);
+    }
+    return Status::OK();
+  }
+  if (output->buffers[0] == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(output->buffers[0], ctx->AllocateBitmap(output->length));
+  }
+  uint8_t* bitmap = output->buffers[0]->mutable_data();
+  if (is_all_null) {
+    output->null_count = output->length;
+    BitUtil::SetBitsTo(bitmap, output->offset, output->length, false);
+    return Status::OK();
+  }
+
+  const int32_t* indices = batch.selection_vector->indices();
+  FirstTimeBitmapWriter writer(bitmap, output->offset, output->length);
+  for (int64_t i = 0; i < output->length; ++i) {
+    bool valid = true;
+    for (const ArrayData* arr : arrays_with_nulls) {
+      valid &= BitUtil::GetBit(arr->buffers[0]->data(), arr->offset + indices[i]);
+    }
+    if (valid) {
+      writer.Set();
+    }
+    writer.Next();
+  }
+  writer.Finish();
+  output->null_count = kUnknownNullCount;
+  return Status::OK();
+}
+
 std::shared_ptr<ChunkedArray> ToChunkedArray(const std::vector<Datum>& values,
                                              const std::shared_ptr<DataType>& type) {
   std::vector<std::shared_ptr<Array>> arrays;
@@ -564,6 +623,34 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
+  Status ExecuteSelection(const ExecBatch& batch, ExecListener* listener) override {
+    DCHECK_NE(batch.selection_vector, nullptr);
+    // Chunked arguments are gathered too rather than split along the selection
+    if (!kernel_->can_execute_selection || HaveChunkedArray(batch.values)) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto values,
+          GatherSelection(batch.values, *batch.selection_vector, exec_context()));
+      return Execute(values, listener);
+    }
+
+    const int32_t* indices = batch.selection_vector->indices();
+    const int64_t length = batch.selection_vector->length();
+    for (const Datum& value : batch.values) {
+      if (value.is_array()) {
+        const int64_t num_rows = value.length();
+        if (!std::all_of(indices, indices + length, [&](int32_t index) {
+              return index >= 0 && index < num_rows;
+            })) {
+          return Status::IndexError("Selection vector index out of bounds");
+        }
+      }
+    }
+    if (output_descr_.shape == ValueDescr::ARRAY) {
+      RETURN_NOT_OK(SetupPreallocation(length, /*allow_contiguous=*/false));
+    }
+    return ExecuteBatch(batch, listener);
+  }
+
   Datum WrapResults(const std::vector<Datum>& inputs,
                     const std::vector<Datum>& outputs) override {
     if (output_descr_.shape == ValueDescr::SCALAR) {
@@ -634,7 +721,8 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
       // kernels supporting preallocation, then we do so up front and then
       // iterate over slices of that large array. Otherwise, we preallocate prior
       // to processing each batch emitted from the ExecBatchIterator
-      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length()));
+      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length(),
+                                       exec_context()->preallocate_contiguous()));
     }
     return Status::OK();
   }
@@ -684,8 +772,10 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
-  Status SetupPreallocation(int64_t total_length) {
+  Status SetupPreallocation(int64_t total_length, bool allow_contiguous) {
     output_num_buffers_ = static_cast<int>(output_descr_.type->layout().buffers.size());
+    // The executor may be executed more than once
+    data_preallocated_.clear();
 
     // Decide if we need to preallocate memory for this kernel
     validity_preallocated_ =
@@ -702,7 +792,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     // Some kernels are also unable to write into sliced outputs, so we respect the
     // kernel's attributes.
     preallocate_contiguous_ =
-        (exec_context()->preallocate_contiguous() && kernel_->can_write_into_slices &&
+        (allow_contiguous && kernel_->can_write_into_slices &&
          validity_preallocated_ && !is_nested(output_descr_.type->id()) &&
          data_preallocated_.size() == static_cast<size_t>(output_num_buffers_ - 1) &&
          std::all_of(data_preallocated_.begin(), data_preallocated_.end(),
@@ -933,10 +1023,89 @@ Status PropagateNulls(KernelContext* ctx, const ExecBatch& batch, ArrayData* out
         "Can only propagate nulls into pre-allocated memory "
         "when the output offset is non-zero");
   }
+  if (batch.selection_vector != nullptr) {
+    return PropagateSelectedNulls(ctx, batch, output);
+  }
   NullPropagator propagator(ctx, batch, output);
   return propagator.Execute();
 }
 
+Result<std::vector<Datum>> GatherSelection(const std::vector<Datum>& args,
+                                           const SelectionVector& selection,
+                                           ExecContext* ctx) {
+  const Datum indices(selection.data());
+  std::vector<Datum> out(args.size());
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args[i].is_arraylike()) {
+      ARROW_ASSIGN_OR_RAISE(out[i], Take(args[i], indices, TakeOptions::Defaults(), ctx));
+    } else {
+      out[i] = args[i];
+    }
+  }
+  return out;
+}
+
+bool CanExecuteOnDictionary(const Function& func, const std::vector<Datum>& args) {
+  if (func.kind() != Function::SCALAR || args.size() != 1 || !args[0].is_arraylike() ||
+      args[0].type()->id() != Type::DICTIONARY) {
+    return false;
+  }
+  const auto& dict_type = checked_cast<const DictionaryType&>(*args[0].type());
+  std::vector<ValueDescr> inputs = {ValueDescr::Array(dict_type.value_type())};
+  auto maybe_kernel = func.DispatchBest(&inputs);
+  if (!maybe_kernel.ok()) {
+    return false;
+  }
+  // Null indices must give the same output as null values would
+  const auto* kernel = static_cast<const ScalarKernel*>(*maybe_kernel);
+  return kernel->null_handling == NullHandling::INTERSECTION;
+}
+
+Result<Datum> ExecuteOnDictionary(const Function& func, const Datum& arg,
+                                  const FunctionOptions* options, ExecContext* ctx) {
+  // Chunks often share their dictionary (e.g. when read from Parquet), in which
+  // case it is only transformed once
+  std::shared_ptr<ArrayData> last_dictionary;
+  std::shared_ptr<Array> last_result;
+
+  auto execute_array =
+      [&](const std::shared_ptr<Array>& array) -> Result<std::shared_ptr<Array>> {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*array);
+    if (last_dictionary != dict_array.data()->dictionary) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum result, func.Execute({Datum(dict_array.dictionary())}, options, ctx));
+      last_dictionary = dict_array.data()->dictionary;
+      last_result = result.make_array();
+    }
+    const auto out_type_id = last_result->type_id();
+    if (is_base_binary_like(out_type_id) || is_fixed_size_binary(out_type_id)) {
+      return std::make_shared<DictionaryArray>(
+          dictionary(dict_array.indices()->type(), last_result->type()),
+          dict_array.indices(), last_result);
+    }
+    return Take(*last_result, *dict_array.indices(), TakeOptions::Defaults(), ctx);
+  };
+
+  if (arg.kind() == Datum::ARRAY) {
+    ARROW_ASSIGN_OR_RAISE(auto out, execute_array(arg.make_array()));
+    return Datum(std::move(out));
+  }
+  const ChunkedArray& chunked = *arg.chunked_array();
+  ArrayVector out_chunks;
+  for (const auto& chunk : chunked.chunks()) {
+    ARROW_ASSIGN_OR_RAISE(auto out, execute_array(chunk));
+    out_chunks.push_back(std::move(out));
+  }
+  if (out_chunks.empty()) {
+    // Execute on an empty array to find out the output type
+    ARROW_ASSIGN_OR_RAISE(auto empty,
+                          MakeArrayOfNull(chunked.type(), 0, ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(auto out, execute_array(empty));
+    return Datum(std::make_shared<ChunkedArray>(ArrayVector{}, out->type()));
+  }
+  return Datum(std::make_shared<ChunkedArray>(std::move(out_chunks)));
+}
+
 std::unique_ptr<KernelExecutor> KernelExecutor::MakeScalar() {
   return ::arrow::internal::make_unique<detail::ScalarExecutor>();
 }
@@ -958,6 +1127,10 @@ ExecContext::ExecContext(MemoryPool* pool, FunctionRegistry* func_registry)
 
 CpuInfo* ExecContext::cpu_info() const { return CpuInfo::GetInstance(); }
 
+::arrow::internal::Executor* ExecContext::executor() const {
+  return executor_ != nullptr ? executor_ : ::arrow::internal::GetCpuThreadPool();
+}
+
 // ----------------------------------------------------------------------
 // SelectionVector
 
@@ -974,7 +1147,34 @@ int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->len
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
     const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Mask too large for a selection vector");
+  }
+  const uint8_t* mask = arr.values()->data();
+  int64_t mask_offset = arr.offset();
+  std::shared_ptr<Buffer> valid_mask;
+  if (arr.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(valid_mask,
+                          BitmapAnd(default_memory_pool(), mask, mask_offset,
+                                    arr.null_bitmap_data(), arr.offset(), arr.length(),
+                                    /*out_offset=*/0));
+    mask = valid_mask->data();
+    mask_offset = 0;
+  }
+
+  const int64_t num_selected = CountSetBits(mask, mask_offset, arr.length());
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(num_selected * sizeof(int32_t)));
+  auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+  arrow::internal::VisitSetBitRunsVoid(mask, mask_offset, arr.length(),
+                                       [&](int64_t position, int64_t length) {
+                                         for (int64_t i = 0; i < length; ++i) {
+                                           *indices++ =
+                                               static_cast<int32_t>(position + i);
+                                         }
+                                       });
+  return std::make_shared<SelectionVector>(ArrayData::Make(
+      int32(), num_selected, {nullptr, std::move(indices_buffer)}, /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -993,5 +1193,27 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           const FunctionOptions* options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return CallFunction(func_name, batch, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  return func->Execute(batch, options, ctx);
+}
+
+Result<std::unique_ptr<BoundFunction>> BindFunction(
+    const std::string& func_name, const std::vector<ValueDescr>& descrs,
+    const FunctionOptions* options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  return func->Bind(descrs, options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -39,11 +39,13 @@ namespace arrow {
 namespace internal {
 
 class CpuInfo;
+class Executor;
 
 }  // namespace internal
 
 namespace compute {
 
+class BoundFunction;
 struct FunctionOptions;
 class FunctionRegistry;
 
@@ -91,6 +93,14 @@ class ARROW_EXPORT ExecContext {
   /// execution. This is not yet used.
   bool use_threads() const { return use_threads_; }
 
+  /// \brief Set the Executor running parallel tasks, e.g. a NumaThreadPool
+  /// to process ExecPlan source batches on the NUMA node holding them.
+  void set_executor(::arrow::internal::Executor* executor) { executor_ = executor; }
+
+  /// \brief The Executor running parallel tasks, default is the CPU thread
+  /// pool returned by GetCpuThreadPool().
+  ::arrow::internal::Executor* executor() const;
+
   // Set the preallocation strategy for kernel execution as it relates to
   // chunked execution. For chunked execution, whether via ChunkedArray inputs
   // or splitting larger Array arguments into smaller pieces, contiguous
@@ -117,6 +127,7 @@ class ARROW_EXPORT ExecContext {
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  ::arrow::internal::Executor* executor_ = NULLPTR;
 };
 
 ARROW_EXPORT ExecContext* default_exec_context();
@@ -133,7 +144,8 @@ ARROW_EXPORT ExecContext* default_exec_context();
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Scalar functions accept an ExecBatch with a selection vector, see
+/// CallFunction.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -143,11 +155,16 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
+  ///
+  /// Null slots of the mask are not selected, as with FilterOptions::DROP.
   static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The indices as int32 array data
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -236,6 +253,28 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief Variant of CallFunction taking the arguments as an ExecBatch, which
+/// computes the output for the rows selected by the batch's selection vector,
+/// if any.
+///
+/// Scalar functions pass the selection vector down to the kernels supporting
+/// it; otherwise only the selected rows of the arguments are gathered before
+/// execution.
+ARROW_EXPORT
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           const FunctionOptions* options, ExecContext* ctx = NULLPTR);
+
+/// \brief Bind a function to argument descriptors and options, for repeated
+/// execution on batches of the same types, see Function::Bind.
+///
+/// Unlike CallFunction, kernel dispatch and state initialization (e.g.
+/// hashing the value set of "is_in") happen once, here.  `options` and `ctx`
+/// must outlive the returned object.
+ARROW_EXPORT
+Result<std::unique_ptr<BoundFunction>> BindFunction(
+    const std::string& func_name, const std::vector<ValueDescr>& descrs,
+    const FunctionOptions* options, ExecContext* ctx = NULLPTR);
+
 /// @}
 
 }  // namespace compute
@@ -0,0 +1,1430 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/exec_plan.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/hash_aggregate_internal.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+namespace {
+
+using ::arrow::detail::Empty;
+
+struct ExecPlanImpl : public ExecPlan {
+  explicit ExecPlanImpl(ExecContext* exec_context) : ExecPlan(exec_context) {}
+
+  ~ExecPlanImpl() override {
+    if (started_ && !finished_.is_finished()) {
+      ARROW_LOG(WARNING) << "Plan was destroyed before finishing";
+      StopProducing();
+      finished_.Wait();
+    }
+  }
+
+  ExecNode* AddNode(std::unique_ptr<ExecNode> node) {
+    if (node->num_inputs() == 0) {
+      sources_.push_back(node.get());
+    }
+    if (node->num_outputs() == 0) {
+      sinks_.push_back(node.get());
+    }
+    nodes_.push_back(std::move(node));
+    return nodes_.back().get();
+  }
+
+  Status Validate() const {
+    if (nodes_.empty()) {
+      return Status::Invalid("ExecPlan has no node");
+    }
+    for (const auto& node : nodes_) {
+      RETURN_NOT_OK(node->Validate());
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() {
+    if (started_) {
+      return Status::Invalid("ExecPlan is already started");
+    }
+    RETURN_NOT_OK(Validate());
+    started_ = true;
+
+    // Inputs are added before their outputs, so start the nodes in reverse
+    // order for consumers to be ready before their producers
+    for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it) {
+      auto st = (*it)->StartProducing();
+      if (!st.ok()) {
+        for (auto started = nodes_.rbegin(); started != it; ++started) {
+          (*started)->StopProducing();
+        }
+        finished_ = Future<>::MakeFinished(st);
+        return st;
+      }
+    }
+
+    std::vector<Future<>> futures;
+    for (const auto& node : nodes_) {
+      futures.push_back(node->finished());
+    }
+    finished_ = AllComplete(futures);
+    return Status::OK();
+  }
+
+  void StopProducing() {
+    DCHECK(started_) << "stopped an ExecPlan which never started";
+    for (const auto& node : nodes_) {
+      node->StopProducing();
+    }
+  }
+
+  std::string ToString() const {
+    std::stringstream ss;
+    ss << "ExecPlan with " << nodes_.size() << " nodes:" << std::endl;
+    for (const auto& node : nodes_) {
+      ss << node->ToString() << std::endl;
+    }
+    return ss.str();
+  }
+
+  std::vector<std::unique_ptr<ExecNode>> nodes_;
+  NodeVector sources_, sinks_;
+  bool started_ = false;
+  Future<> finished_ = Future<>::MakeFinished();
+};
+
+ExecPlanImpl* ToDerived(ExecPlan* ptr) { return checked_cast<ExecPlanImpl*>(ptr); }
+
+const ExecPlanImpl* ToDerived(const ExecPlan* ptr) {
+  return checked_cast<const ExecPlanImpl*>(ptr);
+}
+
+// Counts the batches received from an input, whose total is only known once the
+// input finished
+class BatchCounter {
+ public:
+  // Returns true if this was the last batch
+  bool Increment() {
+    const int count = count_.fetch_add(1) + 1;
+    return count == total_.load() && DoneOnce();
+  }
+
+  // Returns true if all the batches were already received
+  bool SetTotal(int total) {
+    total_.store(total);
+    return count_.load() == total && DoneOnce();
+  }
+
+  // Returns true if the counting wasn't already done
+  bool Cancel() { return DoneOnce(); }
+
+  bool done() const { return done_.load(); }
+
+ private:
+  bool DoneOnce() { return !done_.exchange(true); }
+
+  std::atomic<int> count_{0};
+  std::atomic<int> total_{-1};
+  std::atomic<bool> done_{false};
+};
+
+// Task-local states, so that batches consumed concurrently update distinct
+// states, all merged once the input finished
+template <typename State>
+class LocalStates {
+ public:
+  using Init = std::function<Result<std::unique_ptr<State>>()>;
+
+  explicit LocalStates(Init init) : init_(std::move(init)) {}
+
+  Result<State*> Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!available_.empty()) {
+        State* state = available_.back();
+        available_.pop_back();
+        return state;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto state, init_());
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_.push_back(std::move(state));
+    return states_.back().get();
+  }
+
+  void Release(State* state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    available_.push_back(state);
+  }
+
+  // Only to be called once all the states were released
+  std::vector<std::unique_ptr<State>>& states() { return states_; }
+
+ private:
+  Init init_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<State>> states_;
+  std::vector<State*> available_;
+};
+
+// Completing a node's finished future may destroy the plan, so callbacks must
+// not run on the node's own copy
+void MarkFinished(Future<>* finished) {
+  auto copy = *finished;
+  copy.MarkFinished();
+}
+
+[[noreturn]] void NoInputs() {
+  DCHECK(false) << "no inputs; this should never be called";
+  std::abort();
+}
+
+[[noreturn]] void NoOutputs() {
+  DCHECK(false) << "no outputs; this should never be called";
+  std::abort();
+}
+
+// ----------------------------------------------------------------------
+// Source
+
+struct SourceNode : ExecNode {
+  SourceNode(ExecPlan* plan, std::string label, std::shared_ptr<Schema> output_schema,
+             AsyncGenerator<util::optional<ExecBatch>> generator)
+      : ExecNode(plan, std::move(label), {}, {}, std::move(output_schema),
+                 /*num_outputs=*/1),
+        generator_(std::move(generator)) {}
+
+  const char* kind_name() const override { return "SourceNode"; }
+
+  void InputReceived(ExecNode*, int, ExecBatch) override { NoInputs(); }
+  void ErrorReceived(ExecNode*, Status) override { NoInputs(); }
+  void InputFinished(ExecNode*, int) override { NoInputs(); }
+
+  Status StartProducing() override {
+    if (plan_->exec_context()->use_threads()) {
+      executor_ = plan_->exec_context()->executor();
+      numa_aware_ =
+          dynamic_cast<::arrow::internal::NumaThreadPool*>(executor_) != nullptr;
+      // Keep the thread pool busy, without queueing the whole source on it
+      max_in_flight_ = 2 * executor_->GetCapacity();
+    }
+    Loop([this] { return Next(); })
+        .AddCallback([this](const Result<int>& maybe_total) {
+          // Errors of the generator were reported already
+          int total = maybe_total.ok() ? *maybe_total : batch_count_;
+          outputs_[0]->InputFinished(this, total);
+          std::unique_lock<std::mutex> lock(mutex_);
+          generator_done_ = true;
+          MaybeFinish(&lock);
+        });
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode*) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++pause_count_;
+  }
+
+  void ResumeProducing(ExecNode*) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    --pause_count_;
+    MaybeWakeUp(&lock);
+  }
+
+  void StopProducing(ExecNode*) override { StopProducing(); }
+
+  void StopProducing() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    MaybeWakeUp(&lock);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ private:
+  Future<ControlFlow<int>> Next() {
+    return WaitUntilReady().Then([this](const Empty&) -> Future<ControlFlow<int>> {
+      if (is_stopped()) {
+        return Break(batch_count_);
+      }
+      return generator_().Then(
+          [this](const util::optional<ExecBatch>& batch) -> ControlFlow<int> {
+            if (IsIterationEnd(batch) || is_stopped()) {
+              return Break(batch_count_);
+            }
+            Deliver(batch_count_++, *batch);
+            return Continue();
+          },
+          [this](const Status& error) -> ControlFlow<int> {
+            outputs_[0]->ErrorReceived(this, error);
+            return Break(batch_count_);
+          });
+    });
+  }
+
+  void Deliver(int seq_num, ExecBatch batch) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++in_flight_;
+    }
+    auto task = [this, seq_num, batch]() {
+      outputs_[0]->InputReceived(this, seq_num, std::move(batch));
+      std::unique_lock<std::mutex> lock(mutex_);
+      --in_flight_;
+      MaybeWakeUp(&lock);
+      if (lock.owns_lock()) {
+        MaybeFinish(&lock);
+      }
+    };
+    if (executor_ == nullptr) {
+      task();
+      return;
+    }
+    ::arrow::internal::TaskHints hints;
+    if (numa_aware_) {
+      // Process the batch on the node holding its data
+      hints.numa_node = NumaNodeOf(batch);
+    }
+    auto st = executor_->Spawn(hints, std::move(task));
+    if (!st.ok()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+        stopped_ = true;
+      }
+      outputs_[0]->ErrorReceived(this, std::move(st));
+    }
+  }
+
+  // The NUMA node of the first data buffer of the batch, or -1
+  static int NumaNodeOf(const ExecBatch& batch) {
+    for (const auto& value : batch.values) {
+      if (!value.is_array()) continue;
+      for (const auto& buffer : value.array()->buffers) {
+        if (buffer != nullptr && buffer->is_cpu() && buffer->size() > 0) {
+          return ::arrow::internal::GetNumaNodeOfAddress(buffer->data());
+        }
+      }
+    }
+    return -1;
+  }
+
+  bool is_stopped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stopped_;
+  }
+
+  bool is_ready() const {
+    return stopped_ || (pause_count_ <= 0 && in_flight_ < max_in_flight_);
+  }
+
+  Future<> WaitUntilReady() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_ready()) {
+      return Future<>::MakeFinished();
+    }
+    ready_ = Future<>::Make();
+    return ready_;
+  }
+
+  // Unlocks if the generator is woken up
+  void MaybeWakeUp(std::unique_lock<std::mutex>* lock) {
+    if (ready_.is_valid() && is_ready()) {
+      auto ready = std::move(ready_);
+      ready_ = Future<>();
+      lock->unlock();
+      ready.MarkFinished();
+    }
+  }
+
+  void MaybeFinish(std::unique_lock<std::mutex>* lock) {
+    if (generator_done_ && in_flight_ == 0 && !finishing_) {
+      finishing_ = true;
+      lock->unlock();
+      MarkFinished(&finished_);
+    }
+  }
+
+  AsyncGenerator<util::optional<ExecBatch>> generator_;
+  ::arrow::internal::Executor* executor_ = NULLPTR;
+  bool numa_aware_ = false;
+  int max_in_flight_ = 1;
+  // Only accessed by the generator loop
+  int batch_count_ = 0;
+
+  std::mutex mutex_;
+  int pause_count_ = 0;
+  int in_flight_ = 0;
+  bool stopped_ = false;
+  bool generator_done_ = false;
+  bool finishing_ = false;
+  Future<> ready_;
+  Future<> finished_ = Future<>::Make();
+};
+
+// ----------------------------------------------------------------------
+// Map
+
+struct MapNode : ExecNode {
+  MapNode(ExecNode* input, std::string label, std::shared_ptr<Schema> output_schema,
+          std::function<Result<ExecBatch>(ExecBatch)> map)
+      : ExecNode(input->plan(), std::move(label), {input}, {"target"},
+                 std::move(output_schema), /*num_outputs=*/1),
+        map_(std::move(map)) {}
+
+  const char* kind_name() const override { return "MapNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.done()) {
+      return;
+    }
+    auto maybe_batch = map_(std::move(batch));
+    if (maybe_batch.ok()) {
+      outputs_[0]->InputReceived(this, seq_num, maybe_batch.MoveValueUnsafe());
+    } else {
+      outputs_[0]->ErrorReceived(this, maybe_batch.status());
+      inputs_[0]->StopProducing(this);
+    }
+    if (counter_.Increment()) {
+      MarkFinished(&finished_);
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int num_total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->InputFinished(this, num_total_batches);
+    if (counter_.SetTotal(num_total_batches)) {
+      MarkFinished(&finished_);
+    }
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode*) override { inputs_[0]->PauseProducing(this); }
+
+  void ResumeProducing(ExecNode*) override { inputs_[0]->ResumeProducing(this); }
+
+  void StopProducing(ExecNode*) override { StopProducing(); }
+
+  void StopProducing() override {
+    if (counter_.Cancel()) {
+      MarkFinished(&finished_);
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ private:
+  std::function<Result<ExecBatch>(ExecBatch)> map_;
+  BatchCounter counter_;
+  Future<> finished_ = Future<>::Make();
+};
+
+// ----------------------------------------------------------------------
+// Aggregations
+
+// Common logic of the nodes consuming all their input into local states before
+// producing a single batch
+template <typename State>
+struct AggregateNodeBase : ExecNode {
+  AggregateNodeBase(ExecNode* input, std::string label,
+                    std::shared_ptr<Schema> output_schema,
+                    typename LocalStates<State>::Init init)
+      : ExecNode(input->plan(), std::move(label), {input}, {"target"},
+                 std::move(output_schema), /*num_outputs=*/1),
+        local_states_(std::move(init)) {}
+
+  void InputReceived(ExecNode* input, int, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.done()) {
+      return;
+    }
+    auto st = ConsumeLocally(batch);
+    if (!st.ok()) {
+      Fail(std::move(st));
+      return;
+    }
+    if (counter_.Increment()) {
+      Finish();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    // No output is produced from an incomplete input
+    if (counter_.Cancel()) {
+      MarkFinished(&finished_);
+    }
+  }
+
+  void InputFinished(ExecNode* input, int num_total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.SetTotal(num_total_batches)) {
+      Finish();
+    }
+  }
+
+  Status StartProducing() override {
+    // A state is needed even if the input is empty
+    ARROW_ASSIGN_OR_RAISE(State * state, local_states_.Acquire());
+    local_states_.Release(state);
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode*) override {
+    // The output is produced only once the input is exhausted
+  }
+
+  void ResumeProducing(ExecNode*) override {}
+
+  void StopProducing(ExecNode*) override { StopProducing(); }
+
+  void StopProducing() override {
+    if (counter_.Cancel()) {
+      MarkFinished(&finished_);
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  virtual Status Consume(State* state, const ExecBatch& batch) = 0;
+
+  // Merge and finalize the local states into the output batch
+  virtual Result<ExecBatch> Finalize(std::vector<std::unique_ptr<State>>* states) = 0;
+
+  ExecContext* exec_context() { return plan_->exec_context(); }
+
+ private:
+  Status ConsumeLocally(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(State * state, local_states_.Acquire());
+    auto st = Consume(state, batch);
+    local_states_.Release(state);
+    return st;
+  }
+
+  void Fail(Status error) {
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    inputs_[0]->StopProducing(this);
+    if (counter_.Cancel()) {
+      MarkFinished(&finished_);
+    }
+  }
+
+  void Finish() {
+    auto maybe_batch = Finalize(&local_states_.states());
+    if (maybe_batch.ok()) {
+      outputs_[0]->InputReceived(this, 0, maybe_batch.MoveValueUnsafe());
+    } else {
+      outputs_[0]->ErrorReceived(this, maybe_batch.status());
+    }
+    outputs_[0]->InputFinished(this, 1);
+    MarkFinished(&finished_);
+  }
+
+  LocalStates<State> local_states_;
+  BatchCounter counter_;
+  Future<> finished_ = Future<>::Make();
+};
+
+using KernelStates = std::vector<std::unique_ptr<KernelState>>;
+
+struct ScalarAggregateNode : AggregateNodeBase<KernelStates> {
+  ScalarAggregateNode(ExecNode* input, std::string label,
+                      std::shared_ptr<Schema> output_schema,
+                      std::vector<int> target_indices,
+                      std::vector<const ScalarAggregateKernel*> kernels,
+                      std::vector<std::vector<ValueDescr>> in_descrs,
+                      std::vector<const FunctionOptions*> options)
+      : AggregateNodeBase(input, std::move(label), std::move(output_schema),
+                          [this]() { return InitStates(); }),
+        target_indices_(std::move(target_indices)),
+        kernels_(std::move(kernels)),
+        in_descrs_(std::move(in_descrs)),
+        options_(std::move(options)) {}
+
+  const char* kind_name() const override { return "ScalarAggregateNode"; }
+
+ protected:
+  Status Consume(KernelStates* states, const ExecBatch& batch) override {
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext kernel_ctx{exec_context()};
+      kernel_ctx.SetState((*states)[i].get());
+      ExecBatch target_batch({batch.values[target_indices_[i]]}, batch.length);
+      kernels_[i]->consume(&kernel_ctx, target_batch);
+      RETURN_NOT_OK(kernel_ctx.status());
+    }
+    return Status::OK();
+  }
+
+  Result<ExecBatch> Finalize(
+      std::vector<std::unique_ptr<KernelStates>>* states) override {
+    std::vector<Datum> values(kernels_.size());
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext kernel_ctx{exec_context()};
+      kernel_ctx.SetState((*states->front())[i].get());
+      for (size_t task = 1; task < states->size(); ++task) {
+        kernels_[i]->merge(&kernel_ctx, std::move(*(*(*states)[task])[i]),
+                           kernel_ctx.state());
+        RETURN_NOT_OK(kernel_ctx.status());
+      }
+      kernels_[i]->finalize(&kernel_ctx, &values[i]);
+      RETURN_NOT_OK(kernel_ctx.status());
+    }
+    return ExecBatch(std::move(values), 1);
+  }
+
+ private:
+  Result<std::unique_ptr<KernelStates>> InitStates() {
+    auto states = std::unique_ptr<KernelStates>(new KernelStates(kernels_.size()));
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext kernel_ctx{exec_context()};
+      (*states)[i] = kernels_[i]->init(
+          &kernel_ctx, KernelInitArgs{kernels_[i], in_descrs_[i], options_[i]});
+      RETURN_NOT_OK(kernel_ctx.status());
+    }
+    return std::move(states);
+  }
+
+  std::vector<int> target_indices_;
+  std::vector<const ScalarAggregateKernel*> kernels_;
+  std::vector<std::vector<ValueDescr>> in_descrs_;
+  std::vector<const FunctionOptions*> options_;
+};
+
+struct GroupByState {
+  std::unique_ptr<internal::Grouper> grouper;
+  KernelStates kernel_states;
+};
+
+struct GroupByNode : AggregateNodeBase<GroupByState> {
+  GroupByNode(ExecNode* input, std::string label, std::shared_ptr<Schema> output_schema,
+              std::vector<int> key_indices, std::vector<int> target_indices,
+              std::vector<internal::Aggregate> aggregates,
+              std::vector<const HashAggregateKernel*> kernels)
+      : AggregateNodeBase(input, std::move(label), std::move(output_schema),
+                          [this]() { return InitState(); }),
+        key_indices_(std::move(key_indices)),
+        target_indices_(std::move(target_indices)),
+        aggregates_(std::move(aggregates)),
+        kernels_(std::move(kernels)) {
+    const auto& input_schema = *inputs_[0]->output_schema();
+    for (int index : key_indices_) {
+      key_descrs_.push_back(ValueDescr::Array(input_schema.field(index)->type()));
+    }
+    for (int index : target_indices_) {
+      target_descrs_.push_back(ValueDescr::Array(input_schema.field(index)->type()));
+    }
+  }
+
+  const char* kind_name() const override { return "GroupByNode"; }
+
+ protected:
+  Status Consume(GroupByState* state, const ExecBatch& batch) override {
+    std::vector<Datum> keys(key_indices_.size());
+    for (size_t i = 0; i < key_indices_.size(); ++i) {
+      keys[i] = batch.values[key_indices_[i]];
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum ids,
+                          state->grouper->Consume(ExecBatch(keys, batch.length)));
+
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext kernel_ctx{exec_context()};
+      kernel_ctx.SetState(state->kernel_states[i].get());
+      ExecBatch kernel_batch({batch.values[target_indices_[i]], ids,
+                              Datum(state->grouper->num_groups())},
+                             batch.length);
+      kernels_[i]->consume(&kernel_ctx, kernel_batch);
+      RETURN_NOT_OK(kernel_ctx.status());
+    }
+    return Status::OK();
+  }
+
+  Result<ExecBatch> Finalize(
+      std::vector<std::unique_ptr<GroupByState>>* states) override {
+    GroupByState* state = states->front().get();
+    // Merge the other states, mapping their group ids to the first state's
+    for (size_t task = 1; task < states->size(); ++task) {
+      GroupByState* other = (*states)[task].get();
+      ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, other->grouper->GetUniques());
+      ARROW_ASSIGN_OR_RAISE(Datum transposition, state->grouper->Consume(other_keys));
+      for (size_t i = 0; i < kernels_.size(); ++i) {
+        KernelContext kernel_ctx{exec_context()};
+        kernel_ctx.SetState(state->kernel_states[i].get());
+        kernels_[i]->merge(&kernel_ctx, std::move(*other->kernel_states[i]),
+                           *transposition.array());
+        RETURN_NOT_OK(kernel_ctx.status());
+      }
+    }
+
+    std::vector<Datum> values;
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext kernel_ctx{exec_context()};
+      kernel_ctx.SetState(state->kernel_states[i].get());
+      Datum out;
+      kernels_[i]->finalize(&kernel_ctx, &out);
+      RETURN_NOT_OK(kernel_ctx.status());
+      values.push_back(std::move(out));
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, state->grouper->GetUniques());
+    for (auto& key : uniques.values) {
+      values.push_back(std::move(key));
+    }
+    return ExecBatch(std::move(values), state->grouper->num_groups());
+  }
+
+ private:
+  Result<std::unique_ptr<GroupByState>> InitState() {
+    std::unique_ptr<GroupByState> state(new GroupByState);
+    ARROW_ASSIGN_OR_RAISE(state->grouper,
+                          internal::Grouper::Make(key_descrs_, exec_context()));
+    ARROW_ASSIGN_OR_RAISE(state->kernel_states,
+                          internal::InitHashAggregateKernels(
+                              kernels_, exec_context(), aggregates_, target_descrs_));
+    return std::move(state);
+  }
+
+  std::vector<int> key_indices_;
+  std::vector<int> target_indices_;
+  std::vector<internal::Aggregate> aggregates_;
+  std::vector<const HashAggregateKernel*> kernels_;
+  std::vector<ValueDescr> key_descrs_;
+  std::vector<ValueDescr> target_descrs_;
+};
+
+Result<std::vector<int>> FindFieldIndices(const Schema& schema,
+                                          const std::vector<FieldRef>& refs) {
+  std::vector<int> indices(refs.size());
+  for (size_t i = 0; i < refs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto match, refs[i].FindOne(schema));
+    if (match.indices().size() != 1) {
+      return Status::NotImplemented("Referencing nested field ", refs[i].ToString());
+    }
+    indices[i] = match.indices()[0];
+  }
+  return indices;
+}
+
+// ----------------------------------------------------------------------
+// Hash join
+
+Result<ArrayVector> MaterializeValues(const ExecBatch& batch, MemoryPool* pool) {
+  ArrayVector columns(batch.values.size());
+  for (size_t i = 0; i < batch.values.size(); ++i) {
+    const Datum& value = batch.values[i];
+    if (value.is_array()) {
+      columns[i] = value.make_array();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(columns[i],
+                            MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+    }
+  }
+  return columns;
+}
+
+struct HashJoinNode : ExecNode {
+  HashJoinNode(ExecNode* left, ExecNode* right, std::string label,
+               std::shared_ptr<Schema> output_schema, JoinType join_type,
+               std::vector<int> left_key_indices, std::vector<int> right_key_indices)
+      : ExecNode(left->plan(), std::move(label), {left, right}, {"left", "right"},
+                 std::move(output_schema), /*num_outputs=*/1),
+        join_type_(join_type),
+        left_key_indices_(std::move(left_key_indices)),
+        right_key_indices_(std::move(right_key_indices)),
+        // Batches are already probed in parallel
+        batch_ctx_(plan_->exec_context()->memory_pool(),
+                   plan_->exec_context()->func_registry()) {
+    batch_ctx_.set_use_threads(false);
+  }
+
+  const char* kind_name() const override { return "HashJoinNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    if (input == inputs_[1]) {
+      if (build_counter_.done()) {
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        build_batches_.push_back(std::move(batch));
+      }
+      if (build_counter_.Increment()) {
+        BuildFinished();
+      }
+      return;
+    }
+
+    DCHECK_EQ(input, inputs_[0]);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!build_ready_) {
+        pending_.emplace_back(seq_num, std::move(batch));
+        return;
+      }
+    }
+    ProbeAndOutput(seq_num, batch);
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK(input == inputs_[0] || input == inputs_[1]);
+    Fail(std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int num_total_batches) override {
+    if (input == inputs_[1]) {
+      if (build_counter_.SetTotal(num_total_batches)) {
+        BuildFinished();
+      }
+      return;
+    }
+
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->InputFinished(this, num_total_batches);
+    if (probe_counter_.SetTotal(num_total_batches)) {
+      SideFinished();
+    }
+  }
+
+  Status StartProducing() override {
+    // Nothing can be probed before the hash table is built
+    inputs_[0]->PauseProducing(this);
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode*) override { inputs_[0]->PauseProducing(this); }
+
+  void ResumeProducing(ExecNode*) override { inputs_[0]->ResumeProducing(this); }
+
+  void StopProducing(ExecNode*) override { StopProducing(); }
+
+  void StopProducing() override {
+    Cancel();
+    inputs_[0]->StopProducing(this);
+    inputs_[1]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+ private:
+  void BuildFinished() {
+    auto st = BuildHashTable();
+    if (!st.ok()) {
+      Fail(std::move(st));
+      SideFinished();
+      return;
+    }
+
+    std::vector<std::pair<int, ExecBatch>> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      build_ready_ = true;
+      pending.swap(pending_);
+    }
+    // The left input was paused while the hash table was built, so only a few
+    // batches can be pending
+    for (const auto& seq_batch : pending) {
+      ProbeAndOutput(seq_batch.first, seq_batch.second);
+    }
+    inputs_[0]->ResumeProducing(this);
+    SideFinished();
+  }
+
+  // Build a hash table of the right rows: the Grouper assigns a group id to
+  // each distinct key, and the rows of each group are laid out contiguously
+  Status BuildHashTable() {
+    std::vector<ExecBatch> batches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      batches.swap(build_batches_);
+    }
+    MemoryPool* pool = batch_ctx_.memory_pool();
+    const auto& build_schema = *inputs_[1]->output_schema();
+
+    int64_t num_rows = 0;
+    std::vector<ArrayVector> chunks(build_schema.num_fields());
+    for (const auto& batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(auto columns, MaterializeValues(batch, pool));
+      for (size_t i = 0; i < columns.size(); ++i) {
+        chunks[i].push_back(std::move(columns[i]));
+      }
+      num_rows += batch.length;
+    }
+    batches.clear();
+
+    build_columns_.resize(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      if (chunks[i].empty()) {
+        ARROW_ASSIGN_OR_RAISE(build_columns_[i],
+                              MakeArrayOfNull(build_schema.field(i)->type(), 0, pool));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(build_columns_[i], Concatenate(chunks[i], pool));
+      }
+      chunks[i].clear();
+    }
+
+    std::vector<ValueDescr> key_descrs;
+    std::vector<Datum> keys;
+    for (int index : right_key_indices_) {
+      key_descrs.push_back(ValueDescr::Array(build_schema.field(index)->type()));
+      keys.emplace_back(build_columns_[index]);
+    }
+    ARROW_ASSIGN_OR_RAISE(grouper_, internal::Grouper::Make(key_descrs, &batch_ctx_));
+    group_offsets_.assign(1, 0);
+    if (num_rows == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(ExecBatch(keys, num_rows)));
+    const uint32_t* group_ids = ids.array()->GetValues<uint32_t>(1);
+
+    auto has_null_key = [&](int64_t row) {
+      for (int index : right_key_indices_) {
+        if (build_columns_[index]->IsNull(row)) return true;
+      }
+      return false;
+    };
+
+    // Counting sort of the rows by group id
+    std::vector<int64_t> counts(grouper_->num_groups() + 1, 0);
+    for (int64_t row = 0; row < num_rows; ++row) {
+      if (!has_null_key(row)) {
+        ++counts[group_ids[row] + 1];
+      }
+    }
+    for (size_t i = 1; i < counts.size(); ++i) {
+      counts[i] += counts[i - 1];
+    }
+    group_offsets_ = counts;
+    group_rows_.resize(counts.back());
+    for (int64_t row = 0; row < num_rows; ++row) {
+      if (!has_null_key(row)) {
+        group_rows_[counts[group_ids[row]]++] = row;
+      }
+    }
+    return Status::OK();
+  }
+
+  void ProbeAndOutput(int seq_num, const ExecBatch& batch) {
+    if (probe_counter_.done()) {
+      return;
+    }
+    auto maybe_batch = Probe(batch);
+    if (maybe_batch.ok()) {
+      outputs_[0]->InputReceived(this, seq_num, maybe_batch.MoveValueUnsafe());
+    } else {
+      Fail(maybe_batch.status());
+      return;
+    }
+    if (probe_counter_.Increment()) {
+      SideFinished();
+    }
+  }
+
+  Result<ExecBatch> Probe(const ExecBatch& batch) {
+    MemoryPool* pool = batch_ctx_.memory_pool();
+    ARROW_ASSIGN_OR_RAISE(auto left_columns, MaterializeValues(batch, pool));
+
+    // Group ids of the left keys, left null if no group can match
+    std::shared_ptr<UInt32Array> ids;
+    if (grouper_->num_groups() > 0) {
+      std::vector<Datum> keys;
+      for (int index : left_key_indices_) {
+        keys.emplace_back(left_columns[index]);
+      }
+      ARROW_ASSIGN_OR_RAISE(Datum maybe_ids,
+                            grouper_->Lookup(ExecBatch(keys, batch.length)));
+      ids = checked_pointer_cast<UInt32Array>(maybe_ids.make_array());
+    }
+
+    Int64Builder left_indices(pool), right_indices(pool);
+    RETURN_NOT_OK(left_indices.Reserve(batch.length));
+    const bool emit_right =
+        join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER;
+    if (emit_right) {
+      RETURN_NOT_OK(right_indices.Reserve(batch.length));
+    }
+    for (int64_t i = 0; i < batch.length; ++i) {
+      int64_t begin = 0, end = 0;
+      if (ids != nullptr && ids->IsValid(i)) {
+        const uint32_t group_id = ids->Value(i);
+        begin = group_offsets_[group_id];
+        end = group_offsets_[group_id + 1];
+      }
+      switch (join_type_) {
+        case JoinType::INNER:
+        case JoinType::LEFT_OUTER:
+          for (int64_t r = begin; r < end; ++r) {
+            RETURN_NOT_OK(left_indices.Append(i));
+            RETURN_NOT_OK(right_indices.Append(group_rows_[r]));
+          }
+          if (begin == end && join_type_ == JoinType::LEFT_OUTER) {
+            RETURN_NOT_OK(left_indices.Append(i));
+            RETURN_NOT_OK(right_indices.AppendNull());
+          }
+          break;
+        case JoinType::LEFT_SEMI:
+          if (begin < end) {
+            RETURN_NOT_OK(left_indices.Append(i));
+          }
+          break;
+        case JoinType::LEFT_ANTI:
+          if (begin == end) {
+            RETURN_NOT_OK(left_indices.Append(i));
+          }
+          break;
+      }
+    }
+
+    std::shared_ptr<Array> left_take, right_take;
+    RETURN_NOT_OK(left_indices.Finish(&left_take));
+    std::vector<Datum> values;
+    for (const auto& column : left_columns) {
+      ARROW_ASSIGN_OR_RAISE(auto taken, Take(*column, *left_take,
+                                             TakeOptions::NoBoundsCheck(), &batch_ctx_));
+      values.emplace_back(std::move(taken));
+    }
+    if (emit_right) {
+      RETURN_NOT_OK(right_indices.Finish(&right_take));
+      for (const auto& column : build_columns_) {
+        ARROW_ASSIGN_OR_RAISE(auto taken,
+                              Take(*column, *right_take, TakeOptions::NoBoundsCheck(),
+                                   &batch_ctx_));
+        values.emplace_back(std::move(taken));
+      }
+    }
+    return ExecBatch(std::move(values), left_take->length());
+  }
+
+  void Fail(Status error) {
+    outputs_[0]->ErrorReceived(this, std::move(error));
+    Cancel();
+    inputs_[0]->StopProducing(this);
+    inputs_[1]->StopProducing(this);
+  }
+
+  void Cancel() {
+    if (build_counter_.Cancel()) {
+      SideFinished();
+    }
+    if (probe_counter_.Cancel()) {
+      SideFinished();
+    }
+  }
+
+  // The node is finished once both the build and the probe sides are
+  void SideFinished() {
+    if (sides_left_.fetch_sub(1) == 1) {
+      MarkFinished(&finished_);
+    }
+  }
+
+  const JoinType join_type_;
+  const std::vector<int> left_key_indices_;
+  const std::vector<int> right_key_indices_;
+  ExecContext batch_ctx_;
+
+  BatchCounter build_counter_, probe_counter_;
+  std::atomic<int> sides_left_{2};
+
+  std::mutex mutex_;
+  std::vector<ExecBatch> build_batches_;
+  std::vector<std::pair<int, ExecBatch>> pending_;
+  bool build_ready_ = false;
+
+  // Only accessed once the hash table is built
+  std::unique_ptr<internal::Grouper> grouper_;
+  ArrayVector build_columns_;
+  // The right rows of group i are group_rows_[group_offsets_[i]:group_offsets_[i+1]]
+  std::vector<int64_t> group_offsets_;
+  std::vector<int64_t> group_rows_;
+
+  Future<> finished_ = Future<>::Make();
+};
+
+// ----------------------------------------------------------------------
+// Sink
+
+struct SinkNode : ExecNode {
+  // The input is paused while at least this many batches are waiting to be
+  // pulled...
+  static constexpr int kPauseSize = 32;
+  // ...and resumed once fewer than this many are left
+  static constexpr int kResumeSize = 16;
+
+  SinkNode(ExecNode* input, std::string label,
+           PushGenerator<util::optional<ExecBatch>>::Producer producer)
+      : ExecNode(input->plan(), std::move(label), {input}, {"collected"}, {},
+                 /*num_outputs=*/0),
+        producer_(std::move(producer)) {}
+
+  const char* kind_name() const override { return "SinkNode"; }
+
+  void InputReceived(ExecNode* input, int, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.done()) {
+      return;
+    }
+    bool pause = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (++queued_ >= kPauseSize && !paused_) {
+        paused_ = pause = true;
+      }
+    }
+    if (pause) {
+      inputs_[0]->PauseProducing(this);
+    }
+    producer_.Push(util::make_optional(std::move(batch)));
+    if (counter_.Increment()) {
+      Finish();
+    }
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    producer_.Push(std::move(error));
+    inputs_[0]->StopProducing(this);
+    if (counter_.Cancel()) {
+      Finish();
+    }
+  }
+
+  void InputFinished(ExecNode* input, int num_total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.SetTotal(num_total_batches)) {
+      Finish();
+    }
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void PauseProducing(ExecNode*) override { NoOutputs(); }
+  void ResumeProducing(ExecNode*) override { NoOutputs(); }
+  void StopProducing(ExecNode*) override { NoOutputs(); }
+
+  void StopProducing() override {
+    if (counter_.Cancel()) {
+      Finish();
+    }
+    inputs_[0]->StopProducing(this);
+  }
+
+  Future<> finished() override { return finished_; }
+
+  // Called by the generator when a batch was pulled
+  void BatchPulled() {
+    bool resume = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--queued_ < kResumeSize && paused_) {
+        paused_ = false;
+        resume = true;
+      }
+    }
+    if (resume && !finished_.is_finished()) {
+      inputs_[0]->ResumeProducing(this);
+    }
+  }
+
+ private:
+  void Finish() {
+    producer_.Close();
+    MarkFinished(&finished_);
+  }
+
+  PushGenerator<util::optional<ExecBatch>>::Producer producer_;
+  BatchCounter counter_;
+
+  std::mutex mutex_;
+  int queued_ = 0;
+  bool paused_ = false;
+
+  Future<> finished_ = Future<>::Make();
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExecPlan
+
+Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(ExecContext* ctx) {
+  return std::shared_ptr<ExecPlan>(new ExecPlanImpl{ctx});
+}
+
+ExecNode* ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  return ToDerived(this)->AddNode(std::move(node));
+}
+
+const ExecPlan::NodeVector& ExecPlan::sources() const {
+  return ToDerived(this)->sources_;
+}
+
+const ExecPlan::NodeVector& ExecPlan::sinks() const { return ToDerived(this)->sinks_; }
+
+Status ExecPlan::Validate() { return ToDerived(this)->Validate(); }
+
+Status ExecPlan::StartProducing() { return ToDerived(this)->StartProducing(); }
+
+void ExecPlan::StopProducing() { ToDerived(this)->StopProducing(); }
+
+Future<> ExecPlan::finished() { return ToDerived(this)->finished_; }
+
+std::string ExecPlan::ToString() const { return ToDerived(this)->ToString(); }
+
+// ----------------------------------------------------------------------
+// ExecNode
+
+ExecNode::ExecNode(ExecPlan* plan, std::string label, NodeVector inputs,
+                   std::vector<std::string> input_labels,
+                   std::shared_ptr<Schema> output_schema, int num_outputs)
+    : plan_(plan),
+      label_(std::move(label)),
+      inputs_(std::move(inputs)),
+      input_labels_(std::move(input_labels)),
+      output_schema_(std::move(output_schema)),
+      num_outputs_(num_outputs) {
+  for (auto input : inputs_) {
+    input->outputs_.push_back(this);
+  }
+}
+
+Status ExecNode::Validate() const {
+  if (inputs_.size() != input_labels_.size()) {
+    return Status::Invalid("Invalid number of inputs for '", label(), "' (expected ",
+                           input_labels_.size(), ", actual ", inputs_.size(), ")");
+  }
+  if (static_cast<int>(outputs_.size()) != num_outputs_) {
+    return Status::Invalid("Invalid number of outputs for '", label(), "' (expected ",
+                           num_outputs_, ", actual ", outputs_.size(), ")");
+  }
+  for (auto input : inputs_) {
+    if (input->plan() != plan_) {
+      return Status::Invalid("Input of '", label(), "' belongs to another ExecPlan");
+    }
+  }
+  return Status::OK();
+}
+
+std::string ExecNode::ToString() const {
+  std::stringstream ss;
+  ss << kind_name() << "{\"" << label_ << '"';
+  if (!inputs_.empty()) {
+    ss << ", inputs=[";
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << input_labels_[i] << ": \"" << inputs_[i]->label() << '"';
+    }
+    ss << ']';
+  }
+  ss << '}';
+  return ss.str();
+}
+
+// ----------------------------------------------------------------------
+// Node factories
+
+ExecNode* MakeSourceNode(ExecPlan* plan, std::string label,
+                         std::shared_ptr<Schema> output_schema,
+                         AsyncGenerator<util::optional<ExecBatch>> generator) {
+  return plan->EmplaceNode<SourceNode>(plan, std::move(label), std::move(output_schema),
+                                       std::move(generator));
+}
+
+ExecNode* MakeMapNode(ExecNode* input, std::string label,
+                      std::shared_ptr<Schema> output_schema,
+                      std::function<Result<ExecBatch>(ExecBatch)> map) {
+  return input->plan()->EmplaceNode<MapNode>(input, std::move(label),
+                                             std::move(output_schema), std::move(map));
+}
+
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input, std::string label,
+                                          std::vector<internal::Aggregate> aggregates,
+                                          std::vector<FieldRef> targets) {
+  if (aggregates.size() != targets.size()) {
+    return Status::Invalid(aggregates.size(), " aggregate functions were specified but ",
+                           targets.size(), " targets were provided.");
+  }
+  ExecContext* ctx = input->plan()->exec_context();
+  const auto& input_schema = *input->output_schema();
+  ARROW_ASSIGN_OR_RAISE(auto target_indices, FindFieldIndices(input_schema, targets));
+
+  std::vector<const ScalarAggregateKernel*> kernels(aggregates.size());
+  std::vector<std::vector<ValueDescr>> in_descrs(aggregates.size());
+  std::vector<const FunctionOptions*> options(aggregates.size());
+  FieldVector fields(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::SCALAR_AGGREGATE) {
+      return Status::Invalid("Function '", aggregates[i].function,
+                             "' is not a scalar aggregate function");
+    }
+    in_descrs[i] = {ValueDescr::Array(input_schema.field(target_indices[i])->type())};
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, function->DispatchExact(in_descrs[i]));
+    kernels[i] = static_cast<const ScalarAggregateKernel*>(kernel);
+
+    options[i] = aggregates[i].options;
+    if (options[i] == nullptr) {
+      options[i] = function->default_options();
+    }
+
+    // Resolve the output type with a throwaway state
+    KernelContext kernel_ctx{ctx};
+    auto state =
+        kernels[i]->init(&kernel_ctx, KernelInitArgs{kernel, in_descrs[i], options[i]});
+    RETURN_NOT_OK(kernel_ctx.status());
+    kernel_ctx.SetState(state.get());
+    ARROW_ASSIGN_OR_RAISE(
+        auto descr, kernel->signature->out_type().Resolve(&kernel_ctx, in_descrs[i]));
+    fields[i] = field(aggregates[i].function, std::move(descr.type));
+  }
+
+  return input->plan()->EmplaceNode<ScalarAggregateNode>(
+      input, std::move(label), schema(std::move(fields)), std::move(target_indices),
+      std::move(kernels), std::move(in_descrs), std::move(options));
+}
+
+Result<ExecNode*> MakeGroupByNode(ExecNode* input, std::string label,
+                                  std::vector<FieldRef> keys,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  std::vector<FieldRef> targets) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy node needs at least one key");
+  }
+  ExecContext* ctx = input->plan()->exec_context();
+  const auto& input_schema = *input->output_schema();
+  ARROW_ASSIGN_OR_RAISE(auto key_indices, FindFieldIndices(input_schema, keys));
+  ARROW_ASSIGN_OR_RAISE(auto target_indices, FindFieldIndices(input_schema, targets));
+
+  std::vector<ValueDescr> target_descrs;
+  for (int index : target_indices) {
+    target_descrs.push_back(ValueDescr::Array(input_schema.field(index)->type()));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto kernels, internal::GetHashAggregateKernels(
+                                          ctx, aggregates, target_descrs));
+  ARROW_ASSIGN_OR_RAISE(auto states, internal::InitHashAggregateKernels(
+                                         kernels, ctx, aggregates, target_descrs));
+  ARROW_ASSIGN_OR_RAISE(FieldVector fields,
+                        internal::ResolveHashAggregateKernels(aggregates, kernels, states,
+                                                              ctx, target_descrs));
+  for (int index : key_indices) {
+    fields.push_back(input_schema.field(index));
+  }
+
+  return input->plan()->EmplaceNode<GroupByNode>(
+      input, std::move(label), schema(std::move(fields)), std::move(key_indices),
+      std::move(target_indices), std::move(aggregates), std::move(kernels));
+}
+
+Result<ExecNode*> MakeHashJoinNode(ExecNode* left, ExecNode* right, std::string label,
+                                   JoinType join_type, std::vector<FieldRef> left_keys,
+                                   std::vector<FieldRef> right_keys) {
+  if (left_keys.empty()) {
+    return Status::Invalid("HashJoin node needs at least one key");
+  }
+  if (left_keys.size() != right_keys.size()) {
+    return Status::Invalid("HashJoin node got ", left_keys.size(), " left keys but ",
+                           right_keys.size(), " right keys");
+  }
+  const auto& left_schema = *left->output_schema();
+  const auto& right_schema = *right->output_schema();
+  ARROW_ASSIGN_OR_RAISE(auto left_key_indices, FindFieldIndices(left_schema, left_keys));
+  ARROW_ASSIGN_OR_RAISE(auto right_key_indices,
+                        FindFieldIndices(right_schema, right_keys));
+
+  std::vector<ValueDescr> key_descrs;
+  for (size_t i = 0; i < left_key_indices.size(); ++i) {
+    const auto& left_type = left_schema.field(left_key_indices[i])->type();
+    const auto& right_type = right_schema.field(right_key_indices[i])->type();
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("HashJoin key types differ: ", left_keys[i].ToString(),
+                               " is ", left_type->ToString(), " but ",
+                               right_keys[i].ToString(), " is ",
+                               right_type->ToString());
+    }
+    key_descrs.push_back(ValueDescr::Array(left_type));
+  }
+  // Check that the keys are supported
+  RETURN_NOT_OK(internal::Grouper::Make(key_descrs, left->plan()->exec_context()));
+
+  FieldVector fields = left_schema.fields();
+  if (join_type == JoinType::INNER || join_type == JoinType::LEFT_OUTER) {
+    for (const auto& right_field : right_schema.fields()) {
+      fields.push_back(join_type == JoinType::LEFT_OUTER ? right_field->WithNullable(true)
+                                                         : right_field);
+    }
+  }
+
+  return left->plan()->EmplaceNode<HashJoinNode>(
+      left, right, std::move(label), schema(std::move(fields)), join_type,
+      std::move(left_key_indices), std::move(right_key_indices));
+}
+
+AsyncGenerator<util::optional<ExecBatch>> MakeSinkNode(ExecNode* input,
+                                                       std::string label) {
+  PushGenerator<util::optional<ExecBatch>> push_gen;
+  auto node = input->plan()->EmplaceNode<SinkNode>(input, std::move(label),
+                                                   push_gen.producer());
+
+  // The plan may be destroyed before the generator is exhausted
+  std::weak_ptr<ExecPlan> weak_plan = input->plan()->shared_from_this();
+  return [push_gen, node, weak_plan]() mutable {
+    return push_gen().Then([node, weak_plan](const util::optional<ExecBatch>& batch) {
+      if (!IsIterationEnd(batch)) {
+        if (auto plan = weak_plan.lock()) {
+          node->BatchPulled();
+        }
+      }
+      return batch;
+    });
+  };
+}
+
+}  // namespace compute
+}  // namespace arrow
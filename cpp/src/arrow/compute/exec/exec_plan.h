@@ -0,0 +1,271 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/type_fwd.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/future.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class ExecNode;
+
+/// \brief A graph of ExecNodes streaming ExecBatches from sources to sinks
+///
+/// Batches are pushed downstream, a morsel at a time, as soon as they are
+/// produced.  If the ExecContext uses threads, batches of the sources are
+/// processed in parallel on the CPU thread pool.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
+ public:
+  using NodeVector = std::vector<ExecNode*>;
+
+  virtual ~ExecPlan() = default;
+
+  ExecContext* exec_context() const { return exec_context_; }
+
+  /// Make an empty exec plan
+  static Result<std::shared_ptr<ExecPlan>> Make(ExecContext* = default_exec_context());
+
+  /// Add a node to the plan, which takes ownership of it.  Nodes must be added
+  /// after their inputs.
+  ExecNode* AddNode(std::unique_ptr<ExecNode> node);
+
+  template <typename Node, typename... Args>
+  Node* EmplaceNode(Args&&... args) {
+    std::unique_ptr<Node> node{new Node{std::forward<Args>(args)...}};
+    auto out = node.get();
+    AddNode(std::move(node));
+    return out;
+  }
+
+  /// The initial inputs
+  const NodeVector& sources() const;
+
+  /// The final outputs
+  const NodeVector& sinks() const;
+
+  /// Check that all the nodes are connected
+  Status Validate();
+
+  /// \brief Start producing on all nodes
+  ///
+  /// Nodes are started in reverse order of addition, so that the consumers
+  /// are ready before their producers start.
+  Status StartProducing();
+
+  /// \brief Stop producing on all nodes
+  void StopProducing();
+
+  /// \brief A future which completes once all the nodes have finished
+  Future<> finished();
+
+  /// A string representation of the plan, listing its nodes
+  std::string ToString() const;
+
+ protected:
+  ExecContext* exec_context_;
+  explicit ExecPlan(ExecContext* exec_context) : exec_context_(exec_context) {}
+};
+
+/// \brief A node of an ExecPlan, consuming the batches of its inputs and
+/// producing batches for its outputs
+///
+/// Batches are numbered by their producer with consecutive sequence numbers,
+/// but they may be received in any order and concurrently.  Once a producer
+/// knows how many batches it produced, it calls InputFinished() on its outputs.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT ExecNode {
+ public:
+  using NodeVector = std::vector<ExecNode*>;
+
+  virtual ~ExecNode() = default;
+
+  virtual const char* kind_name() const = 0;
+
+  int num_inputs() const { return static_cast<int>(inputs_.size()); }
+  int num_outputs() const { return num_outputs_; }
+
+  /// The input nodes, in the order in which this node uses them
+  const NodeVector& inputs() const { return inputs_; }
+
+  /// Labels identifying the function of each input
+  const std::vector<std::string>& input_labels() const { return input_labels_; }
+
+  /// The nodes consuming the output of this node
+  const NodeVector& outputs() const { return outputs_; }
+
+  /// The schema of the batches this node produces
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  ExecPlan* plan() { return plan_; }
+
+  /// An optional label, for display and debugging
+  const std::string& label() const { return label_; }
+
+  /// Check that the outputs of this node were all connected
+  Status Validate() const;
+
+  /// \brief Receive a batch from an input
+  ///
+  /// May be called concurrently from several threads.
+  virtual void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) = 0;
+
+  /// \brief Receive an error from an input, which will not produce any more
+  /// batches
+  virtual void ErrorReceived(ExecNode* input, Status error) = 0;
+
+  /// \brief Learn the number of batches an input produces in total
+  ///
+  /// Some of those batches may not have been received yet.
+  virtual void InputFinished(ExecNode* input, int num_total_batches) = 0;
+
+  /// \brief Start producing
+  ///
+  /// Nodes not producing on their own (i.e. all but sources) start producing
+  /// when their inputs push batches to them.
+  virtual Status StartProducing() = 0;
+
+  /// \brief Ask this node to stop producing batches for a while (backpressure)
+  ///
+  /// Calls to PauseProducing() and ResumeProducing() from the same output pair
+  /// up; batches already in flight may still be produced.
+  virtual void PauseProducing(ExecNode* output) = 0;
+
+  /// \brief Resume producing after a call to PauseProducing()
+  virtual void ResumeProducing(ExecNode* output) = 0;
+
+  /// \brief Stop producing for the given output, which doesn't need any more
+  /// batches
+  virtual void StopProducing(ExecNode* output) = 0;
+
+  /// \brief Stop producing definitively, for all outputs
+  virtual void StopProducing() = 0;
+
+  /// \brief A future which completes once this node has finished producing
+  virtual Future<> finished() = 0;
+
+  std::string ToString() const;
+
+ protected:
+  ExecNode(ExecPlan* plan, std::string label, NodeVector inputs,
+           std::vector<std::string> input_labels, std::shared_ptr<Schema> output_schema,
+           int num_outputs);
+
+  ExecPlan* plan_;
+  std::string label_;
+
+  NodeVector inputs_;
+  std::vector<std::string> input_labels_;
+
+  std::shared_ptr<Schema> output_schema_;
+  int num_outputs_;
+  NodeVector outputs_;
+};
+
+/// \brief Make a node producing the batches of a generator
+///
+/// The generator yields nullopt once exhausted.  It is not pulled from while
+/// the outputs are paused or while too many of its batches are still being
+/// processed by the plan.
+ARROW_EXPORT
+ExecNode* MakeSourceNode(ExecPlan* plan, std::string label,
+                         std::shared_ptr<Schema> output_schema,
+                         AsyncGenerator<util::optional<ExecBatch>> generator);
+
+/// \brief Make a node transforming each batch of its input independently
+///
+/// `map` may be called concurrently from several threads.
+ARROW_EXPORT
+ExecNode* MakeMapNode(ExecNode* input, std::string label,
+                      std::shared_ptr<Schema> output_schema,
+                      std::function<Result<ExecBatch>(ExecBatch)> map);
+
+/// \brief Make a node aggregating all the batches of its input into a single
+/// row
+///
+/// The i-th aggregate function (e.g. "sum") is applied to the field
+/// `targets[i]` of the input.  The output fields are named after the functions.
+ARROW_EXPORT
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input, std::string label,
+                                          std::vector<internal::Aggregate> aggregates,
+                                          std::vector<FieldRef> targets);
+
+/// \brief Make a node aggregating the batches of its input in groups of equal
+/// keys
+///
+/// The i-th hash aggregate function (e.g. "hash_sum") is applied to the field
+/// `targets[i]` of the input.  The output fields are the aggregates, named
+/// after the functions, followed by the keys.
+ARROW_EXPORT
+Result<ExecNode*> MakeGroupByNode(ExecNode* input, std::string label,
+                                  std::vector<FieldRef> keys,
+                                  std::vector<internal::Aggregate> aggregates,
+                                  std::vector<FieldRef> targets);
+
+/// \brief Kind of rows produced by a hash join node
+enum class JoinType {
+  /// Pairs of left and right rows with equal keys
+  INNER,
+  /// Same as INNER, along with the unmatched left rows paired with nulls
+  LEFT_OUTER,
+  /// Left rows having at least one match
+  LEFT_SEMI,
+  /// Left rows without any match
+  LEFT_ANTI,
+};
+
+/// \brief Make a node joining the rows of two inputs with equal keys
+///
+/// The right input is consumed entirely into a hash table before the batches
+/// of the left input are probed against it, independently and concurrently.
+/// Rows with a null key never match.  The output fields are those of the left
+/// input, followed by those of the right input for inner and outer joins.  One
+/// output batch is produced per left batch.
+ARROW_EXPORT
+Result<ExecNode*> MakeHashJoinNode(ExecNode* left, ExecNode* right, std::string label,
+                                   JoinType join_type, std::vector<FieldRef> left_keys,
+                                   std::vector<FieldRef> right_keys);
+
+/// \brief Add a sink node consuming the batches of its input
+///
+/// The batches are yielded in the order in which they were received.  The
+/// returned generator yields nullopt once the input is exhausted, and an
+/// error if the plan failed.  The input is paused while too many batches are
+/// waiting to be pulled from the generator.
+ARROW_EXPORT
+AsyncGenerator<util::optional<ExecBatch>> MakeSinkNode(ExecNode* input,
+                                                       std::string label);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,544 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
+
+using testing::HasSubstr;
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+using BatchGenerator = AsyncGenerator<util::optional<ExecBatch>>;
+
+std::shared_ptr<Schema> TestSchema() {
+  return schema({field("i", int32()), field("key", utf8())});
+}
+
+// Make `num_batches` batches of TestSchema(); `i` counts rows from 0
+std::vector<ExecBatch> MakeBatches(int num_batches, int batch_size = 4) {
+  std::vector<ExecBatch> batches;
+  int i = 0;
+  for (int b = 0; b < num_batches; ++b) {
+    Int32Builder ints;
+    StringBuilder keys;
+    for (int row = 0; row < batch_size; ++row, ++i) {
+      ARROW_EXPECT_OK(ints.Append(i));
+      ARROW_EXPECT_OK(keys.Append(i % 3 == 0 ? "a" : "b"));
+    }
+    std::shared_ptr<Array> ints_array, keys_array;
+    ARROW_EXPECT_OK(ints.Finish(&ints_array));
+    ARROW_EXPECT_OK(keys.Finish(&keys_array));
+    batches.push_back(ExecBatch({ints_array, keys_array}, batch_size));
+  }
+  return batches;
+}
+
+BatchGenerator MakeGenerator(const std::vector<ExecBatch>& batches) {
+  std::vector<util::optional<ExecBatch>> opt_batches(batches.begin(), batches.end());
+  return MakeVectorGenerator(std::move(opt_batches));
+}
+
+Result<std::shared_ptr<Table>> CollectSorted(const std::shared_ptr<Schema>& schema,
+                                             BatchGenerator gen,
+                                             const std::vector<std::string>& sort_keys) {
+  auto collected = CollectAsyncGenerator(std::move(gen));
+  ARROW_ASSIGN_OR_RAISE(auto batches, collected.result());
+  RecordBatchVector record_batches;
+  for (const auto& batch : batches) {
+    ArrayVector columns;
+    for (const auto& value : batch->values) {
+      if (value.is_array()) {
+        columns.push_back(value.make_array());
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto column,
+                              MakeArrayFromScalar(*value.scalar(), batch->length));
+        columns.push_back(std::move(column));
+      }
+    }
+    record_batches.push_back(RecordBatch::Make(schema, batch->length, columns));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema, record_batches));
+  std::vector<SortKey> keys;
+  for (const auto& name : sort_keys) {
+    keys.emplace_back(name);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, SortOptions(std::move(keys))));
+  ARROW_ASSIGN_OR_RAISE(auto sorted, Take(table, indices));
+  return sorted.table()->CombineChunks();
+}
+
+void AssertPlanFinishes(ExecPlan* plan) { ASSERT_FINISHES_OK(plan->finished()); }
+
+class TestExecPlan : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override { ctx_.set_use_threads(GetParam()); }
+
+  ExecContext ctx_;
+};
+
+}  // namespace
+
+TEST(ExecPlan, Validate) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_RAISES(Invalid, plan->Validate());
+
+  // A source without output
+  MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(1)));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, HasSubstr("Invalid number of outputs"),
+                                  plan->Validate());
+  ASSERT_RAISES(Invalid, plan->StartProducing());
+}
+
+TEST(ExecPlan, ToString) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(1)));
+  MakeSinkNode(source, "sink");
+  ASSERT_OK(plan->Validate());
+  ASSERT_EQ(plan->sources(), ExecPlan::NodeVector{source});
+  ASSERT_EQ(plan->sinks().size(), 1);
+  EXPECT_THAT(plan->ToString(),
+              HasSubstr("SinkNode{\"sink\", inputs=[collected: \"source\"]}"));
+}
+
+TEST_P(TestExecPlan, SourceSink) {
+  auto batches = MakeBatches(10);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(batches));
+  auto sink_gen = MakeSinkNode(source, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_OK_AND_ASSIGN(auto actual, CollectSorted(TestSchema(), sink_gen, {"i"}));
+  AssertPlanFinishes(plan.get());
+
+  ASSERT_OK_AND_ASSIGN(auto expected, CollectSorted(TestSchema(), MakeGenerator(batches),
+                                                    {"i"}));
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_P(TestExecPlan, EmptySource) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source = MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator({}));
+  auto sink_gen = MakeSinkNode(source, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink_gen));
+  ASSERT_EQ(batches.size(), 0);
+  AssertPlanFinishes(plan.get());
+}
+
+TEST_P(TestExecPlan, Map) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(10)));
+  ExecContext* ctx = &ctx_;
+  auto add = [ctx](ExecBatch batch) -> Result<ExecBatch> {
+    ARROW_ASSIGN_OR_RAISE(batch.values[0],
+                          Add(batch.values[0], Datum(100), ArithmeticOptions(), ctx));
+    return batch;
+  };
+  auto map = MakeMapNode(source, "add", TestSchema(), add);
+  auto sink_gen = MakeSinkNode(map, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_OK_AND_ASSIGN(auto actual, CollectSorted(TestSchema(), sink_gen, {"i"}));
+  AssertPlanFinishes(plan.get());
+
+  ASSERT_EQ(actual->num_rows(), 40);
+  const auto& ints = checked_cast<const Int32Array&>(*actual->column(0)->chunk(0));
+  for (int i = 0; i < 40; ++i) {
+    ASSERT_EQ(ints.Value(i), i + 100);
+  }
+}
+
+TEST_P(TestExecPlan, MapError) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(10)));
+  auto map = MakeMapNode(source, "fail", TestSchema(), [](ExecBatch batch) {
+    if (batch.values[0].array()->GetValues<int32_t>(1)[0] == 8) {
+      return Result<ExecBatch>(Status::IOError("map failed"));
+    }
+    return Result<ExecBatch>(std::move(batch));
+  });
+  auto sink_gen = MakeSinkNode(map, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, HasSubstr("map failed"),
+                                  CollectAsyncGenerator(sink_gen).result());
+  AssertPlanFinishes(plan.get());
+}
+
+TEST_P(TestExecPlan, SourceError) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto batches = MakeGenerator(MakeBatches(3));
+  int count = 0;
+  BatchGenerator failing = [batches, count]() mutable {
+    if (count++ == 2) {
+      return Future<util::optional<ExecBatch>>::MakeFinished(
+          Status::IOError("source failed"));
+    }
+    return batches();
+  };
+  auto source = MakeSourceNode(plan.get(), "source", TestSchema(), std::move(failing));
+  auto sink_gen = MakeSinkNode(source, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, HasSubstr("source failed"),
+                                  CollectAsyncGenerator(sink_gen).result());
+  AssertPlanFinishes(plan.get());
+}
+
+TEST_P(TestExecPlan, ScalarAggregate) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(25)));
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeScalarAggregateNode(source, "aggregate",
+                              {{"sum", nullptr}, {"count", nullptr}, {"mean", nullptr}},
+                      {FieldRef("i"), FieldRef("key"), FieldRef("i")}));
+  AssertSchemaEqual(
+      schema({field("sum", int64()), field("count", int64()), field("mean", float64())}),
+      aggregate->output_schema());
+  auto sink_gen = MakeSinkNode(aggregate, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink_gen));
+  AssertPlanFinishes(plan.get());
+
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0]->length, 1);
+  AssertDatumsEqual(Datum(int64_t(99 * 100 / 2)), batches[0]->values[0],
+                    /*verbose=*/true);
+  AssertDatumsEqual(Datum(int64_t(100)), batches[0]->values[1],
+                    /*verbose=*/true);
+  AssertDatumsEqual(Datum(49.5), batches[0]->values[2], /*verbose=*/true);
+}
+
+TEST_P(TestExecPlan, ScalarAggregateEmpty) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source = MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator({}));
+  ASSERT_OK_AND_ASSIGN(auto aggregate, MakeScalarAggregateNode(source, "aggregate",
+                                                               {{"count", nullptr}},
+                                                               {FieldRef("i")}));
+  auto sink_gen = MakeSinkNode(aggregate, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink_gen));
+  ASSERT_EQ(batches.size(), 1);
+  AssertDatumsEqual(Datum(int64_t(0)), batches[0]->values[0],
+                    /*verbose=*/true);
+}
+
+TEST(ExecPlan, ScalarAggregateInvalid) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(1)));
+  ASSERT_RAISES(Invalid, MakeScalarAggregateNode(source, "aggregate", {{"sum", nullptr}},
+                                                 {}));
+  ASSERT_RAISES(Invalid, MakeScalarAggregateNode(source, "aggregate", {{"add", nullptr}},
+                                                 {FieldRef("i")}));
+  ASSERT_RAISES(Invalid, MakeScalarAggregateNode(source, "aggregate", {{"sum", nullptr}},
+                                                 {FieldRef("nonexistent")}));
+}
+
+TEST_P(TestExecPlan, GroupBy) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto source =
+      MakeSourceNode(plan.get(), "source", TestSchema(), MakeGenerator(MakeBatches(25)));
+  ASSERT_OK_AND_ASSIGN(
+      auto group_by,
+      MakeGroupByNode(source, "group_by", {FieldRef("key")},
+                      {{"hash_sum", nullptr}, {"hash_count", nullptr}},
+                      {FieldRef("i"), FieldRef("i")}));
+  auto out_schema = schema(
+      {field("hash_sum", int64()), field("hash_count", int64()), field("key", utf8())});
+  AssertSchemaEqual(out_schema, group_by->output_schema());
+  auto sink_gen = MakeSinkNode(group_by, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_OK_AND_ASSIGN(auto actual, CollectSorted(out_schema, sink_gen, {"key"}));
+  AssertPlanFinishes(plan.get());
+
+  // Rows 0, 3, ..., 99 have key "a"
+  int64_t sum_a = 0, count_a = 0;
+  for (int i = 0; i < 100; i += 3) {
+    sum_a += i;
+    ++count_a;
+  }
+  auto expected =
+      TableFromJSON(out_schema, {"[[" + std::to_string(sum_a) + ", " +
+                                 std::to_string(count_a) + ", \"a\"], [" +
+                                 std::to_string(99 * 100 / 2 - sum_a) + ", " +
+                                 std::to_string(100 - count_a) + ", \"b\"]]"});
+  AssertTablesEqual(*expected, *actual);
+}
+
+class TestHashJoin : public TestExecPlan {
+ protected:
+  void SetUp() override {
+    TestExecPlan::SetUp();
+    left_schema_ = schema({field("lkey", int32()), field("lval", utf8())});
+    right_schema_ = schema({field("rkey", int32()), field("rval", int64())});
+  }
+
+  // Join left and right batches on lkey == rkey, returning the output sorted on
+  // all its fields
+  Result<std::shared_ptr<Table>> Join(JoinType join_type,
+                                      std::vector<std::string> left_json,
+                                      std::vector<std::string> right_json) {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make(&ctx_));
+    auto left = MakeSourceNode(plan.get(), "left", left_schema_,
+                               MakeGenerator(FromJSON(left_schema_, left_json)));
+    auto right = MakeSourceNode(plan.get(), "right", right_schema_,
+                                MakeGenerator(FromJSON(right_schema_, right_json)));
+    ARROW_ASSIGN_OR_RAISE(auto join,
+                          MakeHashJoinNode(left, right, "join", join_type,
+                                           {FieldRef("lkey")}, {FieldRef("rkey")}));
+    auto sink_gen = MakeSinkNode(join, "sink");
+
+    RETURN_NOT_OK(plan->StartProducing());
+    std::vector<std::string> sort_keys;
+    for (const auto& field : join->output_schema()->fields()) {
+      sort_keys.push_back(field->name());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto actual,
+                          CollectSorted(join->output_schema(), sink_gen, sort_keys));
+    RETURN_NOT_OK(plan->finished().status());
+    return actual;
+  }
+
+  static std::vector<ExecBatch> FromJSON(const std::shared_ptr<Schema>& schema,
+                                         const std::vector<std::string>& json) {
+    std::vector<ExecBatch> batches;
+    for (const auto& batch_json : json) {
+      batches.emplace_back(*RecordBatchFromJSON(schema, batch_json));
+    }
+    return batches;
+  }
+
+  const std::vector<std::string> left_json_ = {R"([[1, "a"], [2, "b"], [null, "c"]])",
+                                               R"([[3, "d"], [1, "e"]])", "[]"};
+  const std::vector<std::string> right_json_ = {R"([[1, 10], [3, 30]])",
+                                                R"([[1, 11], [null, 40], [4, 50]])"};
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+};
+
+TEST_P(TestHashJoin, Inner) {
+  ASSERT_OK_AND_ASSIGN(auto actual, Join(JoinType::INNER, left_json_, right_json_));
+  auto out_schema = schema({field("lkey", int32()), field("lval", utf8()),
+                            field("rkey", int32()), field("rval", int64())});
+  AssertTablesEqual(*TableFromJSON(out_schema, {R"([
+    [1, "a", 1, 10],
+    [1, "a", 1, 11],
+    [1, "e", 1, 10],
+    [1, "e", 1, 11],
+    [3, "d", 3, 30]
+  ])"}),
+                    *actual);
+}
+
+TEST_P(TestHashJoin, LeftOuter) {
+  ASSERT_OK_AND_ASSIGN(auto actual, Join(JoinType::LEFT_OUTER, left_json_, right_json_));
+  auto out_schema = schema({field("lkey", int32()), field("lval", utf8()),
+                            field("rkey", int32()), field("rval", int64())});
+  AssertTablesEqual(*TableFromJSON(out_schema, {R"([
+    [1, "a", 1, 10],
+    [1, "a", 1, 11],
+    [1, "e", 1, 10],
+    [1, "e", 1, 11],
+    [2, "b", null, null],
+    [3, "d", 3, 30],
+    [null, "c", null, null]
+  ])"}),
+                    *actual);
+}
+
+TEST_P(TestHashJoin, LeftSemi) {
+  ASSERT_OK_AND_ASSIGN(auto actual, Join(JoinType::LEFT_SEMI, left_json_, right_json_));
+  AssertTablesEqual(
+      *TableFromJSON(left_schema_, {R"([[1, "a"], [1, "e"], [3, "d"]])"}), *actual);
+}
+
+TEST_P(TestHashJoin, LeftAnti) {
+  ASSERT_OK_AND_ASSIGN(auto actual, Join(JoinType::LEFT_ANTI, left_json_, right_json_));
+  AssertTablesEqual(*TableFromJSON(left_schema_, {R"([[2, "b"], [null, "c"]])"}),
+                    *actual);
+}
+
+TEST_P(TestHashJoin, EmptyRight) {
+  ASSERT_OK_AND_ASSIGN(auto actual, Join(JoinType::INNER, left_json_, {}));
+  ASSERT_EQ(actual->num_rows(), 0);
+  ASSERT_OK_AND_ASSIGN(actual, Join(JoinType::LEFT_ANTI, left_json_, {"[]"}));
+  ASSERT_EQ(actual->num_rows(), 5);
+}
+
+TEST_P(TestHashJoin, MultipleKeys) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  // i % 3 == 0 has key "a", so (i, key) matches only for i == 0 and i == 3
+  auto left =
+      MakeSourceNode(plan.get(), "left", TestSchema(), MakeGenerator(MakeBatches(25)));
+  auto right_schema = schema({field("key", utf8()), field("i", int32())});
+  auto right = MakeSourceNode(
+      plan.get(), "right", right_schema,
+      MakeGenerator(FromJSON(right_schema, {R"([["a", 0], ["b", 0], ["a", 3]])"})));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(left, right, "join", JoinType::LEFT_SEMI,
+                                        {FieldRef("i"), FieldRef("key")},
+                                        {FieldRef("i"), FieldRef("key")}));
+  auto sink_gen = MakeSinkNode(join, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_OK_AND_ASSIGN(auto actual, CollectSorted(TestSchema(), sink_gen, {"i"}));
+  AssertPlanFinishes(plan.get());
+  AssertTablesEqual(*TableFromJSON(TestSchema(), {R"([[0, "a"], [3, "a"]])"}),
+                    *actual);
+}
+
+TEST_P(TestHashJoin, ManyBatches) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto left =
+      MakeSourceNode(plan.get(), "left", TestSchema(), MakeGenerator(MakeBatches(25)));
+  auto right = MakeSourceNode(plan.get(), "right", TestSchema(),
+                              MakeGenerator(MakeBatches(25)));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(left, right, "join", JoinType::INNER,
+                                        {FieldRef("key")}, {FieldRef("key")}));
+  auto sink_gen = MakeSinkNode(join, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink_gen));
+  AssertPlanFinishes(plan.get());
+
+  // One output batch per left batch; 34 rows have key "a" and 66 have key "b"
+  ASSERT_EQ(batches.size(), 25);
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->length;
+  }
+  ASSERT_EQ(num_rows, 34 * 34 + 66 * 66);
+}
+
+TEST_P(TestHashJoin, RightError) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  auto left =
+      MakeSourceNode(plan.get(), "left", TestSchema(), MakeGenerator(MakeBatches(10)));
+  BatchGenerator failing = [] {
+    return Future<util::optional<ExecBatch>>::MakeFinished(
+        Status::IOError("right failed"));
+  };
+  auto right = MakeSourceNode(plan.get(), "right", TestSchema(), std::move(failing));
+  ASSERT_OK_AND_ASSIGN(auto join,
+                       MakeHashJoinNode(left, right, "join", JoinType::INNER,
+                                        {FieldRef("key")}, {FieldRef("key")}));
+  auto sink_gen = MakeSinkNode(join, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, HasSubstr("right failed"),
+                                  CollectAsyncGenerator(sink_gen).result());
+  AssertPlanFinishes(plan.get());
+}
+
+TEST(ExecPlan, HashJoinInvalid) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto left =
+      MakeSourceNode(plan.get(), "left", TestSchema(), MakeGenerator(MakeBatches(1)));
+  auto right =
+      MakeSourceNode(plan.get(), "right", TestSchema(), MakeGenerator(MakeBatches(1)));
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(left, right, "join", JoinType::INNER, {}, {}));
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(left, right, "join", JoinType::INNER,
+                                          {FieldRef("i")}, {}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      TypeError, HasSubstr("key types differ"),
+      MakeHashJoinNode(left, right, "join", JoinType::INNER, {FieldRef("i")},
+                       {FieldRef("key")}));
+  ASSERT_RAISES(Invalid, MakeHashJoinNode(left, right, "join", JoinType::INNER,
+                                          {FieldRef("nonexistent")}, {FieldRef("i")}));
+}
+
+TEST(ExecPlan, SinkBackpressure) {
+  // Without threads, batches are pushed synchronously, so the source is paused
+  // as soon as enough batches are waiting in the sink
+  ExecContext ctx;
+  ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx));
+
+  constexpr int kNumBatches = 100;
+  auto batches = MakeGenerator(MakeBatches(kNumBatches, 1));
+  auto pulled = std::make_shared<std::atomic<int>>(0);
+  BatchGenerator counting = [batches, pulled]() mutable {
+    ++*pulled;
+    return batches();
+  };
+  auto source = MakeSourceNode(plan.get(), "source", TestSchema(), std::move(counting));
+  auto sink_gen = MakeSinkNode(source, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  ASSERT_LT(pulled->load(), kNumBatches / 2);
+  ASSERT_FALSE(plan->finished().is_finished());
+
+  // Pulling from the sink resumes the source
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto collected, CollectAsyncGenerator(sink_gen));
+  ASSERT_EQ(collected.size(), kNumBatches);
+  AssertPlanFinishes(plan.get());
+}
+
+TEST_P(TestExecPlan, StopProducing) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&ctx_));
+  // A source which never finishes on its own
+  BatchGenerator infinite = [] {
+    return Future<util::optional<ExecBatch>>::MakeFinished(MakeBatches(1)[0]);
+  };
+  auto source = MakeSourceNode(plan.get(), "source", TestSchema(), std::move(infinite));
+  auto sink_gen = MakeSinkNode(source, "sink");
+
+  ASSERT_OK(plan->StartProducing());
+  plan->StopProducing();
+  AssertPlanFinishes(plan.get());
+  // The sink yields what it received before stopping
+  ASSERT_FINISHES_OK(CollectAsyncGenerator(sink_gen));
+}
+
+INSTANTIATE_TEST_SUITE_P(UseThreads, TestExecPlan, ::testing::Values(false, true));
+INSTANTIATE_TEST_SUITE_P(UseThreads, TestHashJoin, ::testing::Values(false, true));
+
+}  // namespace compute
+}  // namespace arrow
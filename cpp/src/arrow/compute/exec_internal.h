@@ -117,6 +117,12 @@ class ARROW_EXPORT KernelExecutor {
   /// Not thread-safe
   virtual Status Execute(const std::vector<Datum>& args, ExecListener* listener) = 0;
 
+  /// \brief Execute on the rows of `batch` selected by its selection vector.
+  /// The values of `batch` must be arrays or scalars.
+  virtual Status ExecuteSelection(const ExecBatch&, ExecListener*) {
+    return Status::NotImplemented("Execution on selection vectors");
+  }
+
   virtual Datum WrapResults(const std::vector<Datum>& args,
                             const std::vector<Datum>& outputs) = 0;
 
@@ -137,6 +143,28 @@ class ARROW_EXPORT KernelExecutor {
 ARROW_EXPORT
 Status PropagateNulls(KernelContext* ctx, const ExecBatch& batch, ArrayData* out);
 
+/// \brief Gather the rows of array-like arguments selected by a selection
+/// vector; scalar arguments are left as is
+Result<std::vector<Datum>> GatherSelection(const std::vector<Datum>& args,
+                                           const SelectionVector& selection,
+                                           ExecContext* ctx);
+
+/// \brief Return whether a function can be executed on the dictionary of its
+/// dictionary-encoded argument rather than on the decoded values.
+///
+/// This is the case for scalar functions taking a single array-like argument
+/// when they have a kernel for the dictionary value type which emits null
+/// exactly where its input is null.
+bool CanExecuteOnDictionary(const Function& func, const std::vector<Datum>& args);
+
+/// \brief Execute a function on the dictionary of each array of `arg` and
+/// keep its indices, so that the work is done once per distinct value.
+///
+/// Binary-like results stay dictionary-encoded; other results are decoded
+/// with "take" into plain arrays of the kernel's output type.
+Result<Datum> ExecuteOnDictionary(const Function& func, const Datum& arg,
+                                  const FunctionOptions* options, ExecContext* ctx);
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
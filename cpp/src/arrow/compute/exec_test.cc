@@ -28,6 +28,7 @@
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
@@ -84,6 +85,19 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, true, null, false, true, true]");
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(
+                                            checked_cast<const BooleanArray&>(*mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 2, 5, 6]"),
+                    *MakeArray(sel_vector->data()));
+
+  auto sliced_mask = mask->Slice(2);
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*sliced_mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -853,6 +867,124 @@ TEST_F(TestCallScalarFunction, ScalarFunction) {
   ASSERT_TRUE(expected->Equals(*result.scalar()));
 }
 
+TEST_F(TestCallScalarFunction, SelectionVector) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, null, 4, 2147483647, 6]");
+  auto right = ArrayFromJSON(int32(), "[6, 5, 4, 3, 1, null]");
+  auto selection =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[5, 0, 2, 3]"));
+  ExecBatch batch({left, right}, selection->length());
+  batch.selection_vector = selection;
+
+  // Kernels executing on the selection: overflow in rows which are not
+  // selected is not reported
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("greater", batch, nullptr));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[null, false, null, true]"),
+                    *result.make_array());
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("add_checked", batch, nullptr));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 7, null, 7]"), *result.make_array());
+
+  ExecBatch scalar_batch({left, Datum(std::make_shared<Int32Scalar>(2))},
+                         selection->length());
+  scalar_batch.selection_vector = selection;
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("greater", scalar_batch, nullptr));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null, true]"),
+                    *result.make_array());
+
+  // Kernels executing on the gathered rows
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("add", batch, nullptr));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 7, null, 7]"), *result.make_array());
+
+  // Chunked arguments are gathered as well
+  ExecBatch chunked_batch(
+      {std::make_shared<ChunkedArray>(ArrayVector{left->Slice(0, 3), left->Slice(3)}),
+       right},
+      selection->length());
+  chunked_batch.selection_vector = selection;
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("greater", chunked_batch, nullptr));
+  AssertChunkedEquivalent(*ChunkedArrayFromJSON(boolean(), {"[null, false, null, true]"}),
+                          *result.chunked_array());
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 6]"));
+  batch.length = 2;
+  ASSERT_RAISES(IndexError, CallFunction("greater", batch, nullptr));
+  ASSERT_RAISES(IndexError, CallFunction("add", batch, nullptr));
+}
+
+TEST_F(TestCallScalarFunction, BoundFunction) {
+  auto multiplier = std::make_shared<Int32Scalar>(2);
+  ExampleOptions options(multiplier);
+  ASSERT_OK_AND_ASSIGN(auto bound, BindFunction("test_stateful",
+                                                {ValueDescr::Array(int32())}, &options));
+  ASSERT_EQ(ValueDescr::Array(int32()), bound->out_descr());
+
+  // The state was initialized once, when binding
+  const ExampleOptions bound_options = options;
+  options.value = std::make_shared<Int32Scalar>(3);
+  for (const char* json : {"[1, 2, 3, null, 5]", "[]", "[-4]"}) {
+    ASSERT_OK_AND_ASSIGN(Datum result, bound->Execute({ArrayFromJSON(int32(), json)}));
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         CallFunction("test_stateful", {ArrayFromJSON(int32(), json)},
+                                      &bound_options));
+    AssertDatumsEqual(expected, result);
+  }
+
+  // Arguments must match the bound descriptors
+  ASSERT_RAISES(TypeError, bound->Execute({ArrayFromJSON(int64(), "[1]")}));
+  ASSERT_RAISES(TypeError, bound->Execute({Datum(multiplier)}));
+  ASSERT_RAISES(Invalid, bound->Execute(std::vector<Datum>{}));
+
+  ASSERT_RAISES(NotImplemented, BindFunction("test_stateful",
+                                             {ValueDescr::Array(int64())}, &options));
+  ASSERT_RAISES(NotImplemented,
+                BindFunction("sort_indices", {ValueDescr::Array(int32())}, nullptr));
+}
+
+TEST_F(TestCallScalarFunction, BoundFunctionImplicitCasts) {
+  // Arguments bound with ANY shape may be arrays or scalars
+  ASSERT_OK_AND_ASSIGN(auto bound,
+                       BindFunction("add", {ValueDescr(int32()), ValueDescr(int64())},
+                                    nullptr));
+  ASSERT_EQ(ValueDescr(int64()), bound->out_descr());
+
+  ASSERT_OK_AND_ASSIGN(Datum result, bound->Execute({ArrayFromJSON(int32(), "[1, null]"),
+                                                     ArrayFromJSON(int64(), "[2, 3]")}));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[3, null]"), result);
+  ASSERT_OK_AND_ASSIGN(result, bound->Execute({ArrayFromJSON(int32(), "[1, 4]"),
+                                               Datum(int64_t(5))}));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[6, 9]"), result);
+  ASSERT_OK_AND_ASSIGN(result, bound->Execute({Datum(int32_t(1)), Datum(int64_t(5))}));
+  AssertDatumsEqual(Datum(int64_t(6)), result);
+}
+
+TEST_F(TestCallScalarFunction, BoundCast) {
+  auto selection =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[2, 0]"));
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, null, 3]")}, selection->length());
+  batch.selection_vector = selection;
+
+  CastOptions options = CastOptions::Safe(int64());
+  ASSERT_OK_AND_ASSIGN(auto bound,
+                       BindFunction("cast", {ValueDescr::Array(int32())}, &options));
+  ASSERT_EQ(ValueDescr::Array(int64()), bound->out_descr());
+  ASSERT_OK_AND_ASSIGN(Datum result, bound->Execute(batch.values));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, null, 3]"), result);
+  ASSERT_OK_AND_ASSIGN(result, bound->Execute(batch));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[3, 1]"), result);
+
+  // Casts to the same type are identities
+  options.to_type = int32();
+  ASSERT_OK_AND_ASSIGN(bound,
+                       BindFunction("cast", {ValueDescr::Array(int32())}, &options));
+  ASSERT_OK_AND_ASSIGN(result, bound->Execute(batch.values));
+  AssertDatumsEqual(batch.values[0], result);
+  ASSERT_OK_AND_ASSIGN(result, bound->Execute(batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[3, 1]"), result);
+
+  options.to_type = nullptr;
+  ASSERT_RAISES(Invalid, BindFunction("cast", {ValueDescr::Array(int32())}, &options));
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include "arrow/compute/kernels/common.h"
 #include "arrow/datum.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/tracing_internal.h"
 
 namespace arrow {
 
@@ -156,23 +157,166 @@ Result<const Kernel*> Function::DispatchBest(std::vector<ValueDescr>* values) co
 
 Result<Datum> Function::Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const {
+  return ExecuteImpl(args, /*selection=*/nullptr, options, ctx);
+}
+
+Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* options,
+                                ExecContext* ctx) const {
+  if (batch.selection_vector == nullptr) {
+    return Execute(batch.values, options, ctx);
+  }
+  if (kind() == Function::META) {
+    // Meta functions only see materialized arguments
+    if (ctx == nullptr) {
+      ExecContext default_ctx;
+      return Execute(batch, options, &default_ctx);
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto args, detail::GatherSelection(batch.values, *batch.selection_vector, ctx));
+    return Execute(args, options, ctx);
+  }
+  return ExecuteImpl(batch.values, batch.selection_vector, options, ctx);
+}
+
+namespace {
+
+// Execute `kernel`, whose state (if any) is already set in `kernel_ctx`, on
+// arguments already cast to `inputs`
+Result<Datum> ExecuteKernel(Function::Kind kind, const Kernel* kernel,
+                            KernelContext* kernel_ctx,
+                            const std::vector<ValueDescr>& inputs,
+                            const FunctionOptions* options,
+                            const std::vector<Datum>& args,
+                            const std::shared_ptr<SelectionVector>& selection) {
+  std::unique_ptr<detail::KernelExecutor> executor;
+  if (kind == Function::SCALAR) {
+    executor = detail::KernelExecutor::MakeScalar();
+  } else if (kind == Function::VECTOR) {
+    executor = detail::KernelExecutor::MakeVector();
+  } else if (kind == Function::SCALAR_AGGREGATE) {
+    executor = detail::KernelExecutor::MakeScalarAggregate();
+  } else {
+    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
+  }
+  RETURN_NOT_OK(executor->Init(kernel_ctx, {kernel, inputs, options}));
+
+  auto listener = std::make_shared<detail::DatumAccumulator>();
+  if (selection != nullptr) {
+    ExecBatch batch(args, selection->length());
+    batch.selection_vector = selection;
+    RETURN_NOT_OK(executor->ExecuteSelection(batch, listener.get()));
+  } else {
+    RETURN_NOT_OK(executor->Execute(args, listener.get()));
+  }
+  return executor->WrapResults(args, listener->values());
+}
+
+class KernelBoundFunction : public BoundFunction {
+ public:
+  KernelBoundFunction(std::vector<ValueDescr> in_descrs, ValueDescr out_descr,
+                      const Kernel* kernel, std::vector<ValueDescr> kernel_descrs,
+                      std::unique_ptr<KernelState> state,
+                      const FunctionOptions* options, ExecContext* ctx)
+      : BoundFunction(std::move(in_descrs), std::move(out_descr)),
+        kernel_(kernel),
+        kernel_descrs_(std::move(kernel_descrs)),
+        state_(std::move(state)),
+        options_(options),
+        ctx_(ctx) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(
+      const std::vector<Datum>& args,
+      const std::shared_ptr<SelectionVector>& selection) const override {
+    // Only the types are cast: arguments bound with ValueDescr::ANY shape
+    // keep their own shape, which determines the output's
+    std::vector<Datum> implicitly_cast_args = args;
+    std::vector<ValueDescr> inputs(args.size());
+    for (size_t i = 0; i != args.size(); ++i) {
+      const auto& to_type = kernel_descrs_[i].type;
+      if (!args[i].type()->Equals(*to_type)) {
+        ARROW_ASSIGN_OR_RAISE(implicitly_cast_args[i],
+                              Cast(args[i], CastOptions::Safe(to_type), ctx_));
+      }
+      inputs[i] = implicitly_cast_args[i].descr();
+    }
+
+    // Kernels only read their state, so it can be shared by concurrent calls
+    KernelContext kernel_ctx{ctx_};
+    kernel_ctx.SetState(state_.get());
+    return ExecuteKernel(Function::SCALAR, kernel_, &kernel_ctx, inputs, options_,
+                         implicitly_cast_args, selection);
+  }
+
+ private:
+  const Kernel* kernel_;
+  // The descriptors the arguments are implicitly cast to
+  std::vector<ValueDescr> kernel_descrs_;
+  std::unique_ptr<KernelState> state_;
+  const FunctionOptions* options_;
+  ExecContext* ctx_;
+};
+
+Status CheckBoundArgs(const std::vector<ValueDescr>& descrs,
+                      const std::vector<Datum>& args) {
+  RETURN_NOT_OK(detail::CheckAllValues(args));
+  if (args.size() != descrs.size()) {
+    return Status::Invalid("Function was bound to ", descrs.size(),
+                           " arguments but was passed ", args.size());
+  }
+  for (size_t i = 0; i < descrs.size(); ++i) {
+    if ((descrs[i].shape != ValueDescr::ANY && descrs[i].shape != args[i].shape()) ||
+        !descrs[i].type->Equals(*args[i].type())) {
+      return Status::TypeError("Function was bound to ", ValueDescr::ToString(descrs),
+                               " but argument ", i, " is ", args[i].descr().ToString());
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Result<Datum> Function::ExecuteImpl(const std::vector<Datum>& args,
+                                    const std::shared_ptr<SelectionVector>& selection,
+                                    const FunctionOptions* options,
+                                    ExecContext* ctx) const {
   if (options == nullptr) {
     options = default_options();
   }
   if (ctx == nullptr) {
     ExecContext default_ctx;
-    return Execute(args, options, &default_ctx);
+    return ExecuteImpl(args, selection, options, &default_ctx);
   }
 
   // type-check Datum arguments here. Really we'd like to avoid this as much as
   // possible
   RETURN_NOT_OK(detail::CheckAllValues(args));
+  if (selection != nullptr && kind() != Function::SCALAR) {
+    // Only scalar kernels may execute on selections
+    ARROW_ASSIGN_OR_RAISE(auto selected_args,
+                          detail::GatherSelection(args, *selection, ctx));
+    return ExecuteImpl(selected_args, /*selection=*/nullptr, options, ctx);
+  }
   std::vector<ValueDescr> inputs(args.size());
   for (size_t i = 0; i != args.size(); ++i) {
     inputs[i] = args[i].descr();
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchBest(&inputs));
+  auto maybe_kernel = DispatchBest(&inputs);
+  if (!maybe_kernel.ok()) {
+    // Elementwise functions without kernels for dictionary-encoded input are
+    // executed once per distinct value
+    if (detail::CanExecuteOnDictionary(*this, args)) {
+      if (selection != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto selected_args,
+                              detail::GatherSelection(args, *selection, ctx));
+        return detail::ExecuteOnDictionary(*this, selected_args[0], options, ctx);
+      }
+      return detail::ExecuteOnDictionary(*this, args[0], options, ctx);
+    }
+    return maybe_kernel.status();
+  }
+  const Kernel* kernel = *maybe_kernel;
   ARROW_ASSIGN_OR_RAISE(auto implicitly_cast_args, Cast(args, inputs, ctx));
 
   std::unique_ptr<KernelState> state;
@@ -184,21 +328,57 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
     kernel_ctx.SetState(state.get());
   }
 
-  std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
-    executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
-    executor = detail::KernelExecutor::MakeVector();
-  } else if (kind() == Function::SCALAR_AGGREGATE) {
-    executor = detail::KernelExecutor::MakeScalarAggregate();
-  } else {
-    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
+  ARROW_TRACE_SPAN(span, "arrow::compute::Function::Execute");
+  ARROW_TRACE_SPAN_ATTRIBUTE(span, "function", name());
+  return ExecuteKernel(kind(), kernel, &kernel_ctx, inputs, options,
+                       implicitly_cast_args, selection);
+}
+
+Result<std::unique_ptr<BoundFunction>> Function::Bind(
+    const std::vector<ValueDescr>& descrs, const FunctionOptions* options,
+    ExecContext* ctx) const {
+  if (kind() != Function::SCALAR) {
+    return Status::NotImplemented("Binding function ", name(),
+                                  " which is not a SCALAR function");
+  }
+  if (options == nullptr) {
+    options = default_options();
+  }
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
   }
-  RETURN_NOT_OK(executor->Init(&kernel_ctx, {kernel, inputs, options}));
 
-  auto listener = std::make_shared<detail::DatumAccumulator>();
-  RETURN_NOT_OK(executor->Execute(implicitly_cast_args, listener.get()));
-  return executor->WrapResults(implicitly_cast_args, listener->values());
+  std::vector<ValueDescr> inputs = descrs;
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs));
+
+  std::unique_ptr<KernelState> state;
+  KernelContext kernel_ctx{ctx};
+  if (kernel->init) {
+    state = kernel->init(&kernel_ctx, {kernel, inputs, options});
+    RETURN_NOT_OK(kernel_ctx.status());
+    kernel_ctx.SetState(state.get());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out_descr,
+                        kernel->signature->out_type().Resolve(&kernel_ctx, inputs));
+  if (out_descr.shape == ValueDescr::SCALAR) {
+    // Unless all arguments are scalars, the output may be an array
+    for (const auto& descr : descrs) {
+      if (descr.shape != ValueDescr::SCALAR) out_descr.shape = ValueDescr::ANY;
+    }
+  }
+  return std::unique_ptr<BoundFunction>(
+      new KernelBoundFunction(descrs, std::move(out_descr), kernel, std::move(inputs),
+                              std::move(state), options, ctx));
+}
+
+Result<Datum> BoundFunction::Execute(const std::vector<Datum>& args) const {
+  RETURN_NOT_OK(CheckBoundArgs(in_descrs_, args));
+  return ExecuteImpl(args, /*selection=*/nullptr);
+}
+
+Result<Datum> BoundFunction::Execute(const ExecBatch& batch) const {
+  RETURN_NOT_OK(CheckBoundArgs(in_descrs_, batch.values));
+  return ExecuteImpl(batch.values, batch.selection_vector);
 }
 
 Status Function::Validate() const {
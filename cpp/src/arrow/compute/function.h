@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -110,6 +111,46 @@ struct ARROW_EXPORT FunctionDoc {
   static const FunctionDoc& Empty();
 };
 
+/// \brief A function bound to the descriptors of its arguments and to its
+/// options, see Function::Bind.
+///
+/// The kernel is dispatched and its state (e.g. the hash table of "is_in" or
+/// the compiled regex of "match_substring_regex") initialized once, so that
+/// executing on many batches of the same types only costs the execution
+/// proper.  Execution is const and may be called concurrently.
+class ARROW_EXPORT BoundFunction {
+ public:
+  virtual ~BoundFunction() = default;
+
+  /// \brief The argument descriptors the function was bound to
+  const std::vector<ValueDescr>& in_descrs() const { return in_descrs_; }
+
+  /// \brief The descriptor of the output
+  const ValueDescr& out_descr() const { return out_descr_; }
+
+  /// \brief Execute the function on arguments matching in_descrs().
+  ///
+  /// An argument bound with ValueDescr::ANY shape may be an array or a
+  /// scalar; otherwise both its type and shape must match exactly.
+  Result<Datum> Execute(const std::vector<Datum>& args) const;
+
+  /// \brief Execute the function on the rows of `batch` selected by its
+  /// selection vector, if any.
+  Result<Datum> Execute(const ExecBatch& batch) const;
+
+ protected:
+  BoundFunction(std::vector<ValueDescr> in_descrs, ValueDescr out_descr)
+      : in_descrs_(std::move(in_descrs)), out_descr_(std::move(out_descr)) {}
+
+  /// Execute on arguments already checked against in_descrs()
+  virtual Result<Datum> ExecuteImpl(
+      const std::vector<Datum>& args,
+      const std::shared_ptr<SelectionVector>& selection) const = 0;
+
+  std::vector<ValueDescr> in_descrs_;
+  ValueDescr out_descr_;
+};
+
 /// \brief Base class for compute functions. Function implementations contain a
 /// collection of "kernels" which are implementations of the function for
 /// specific argument types. Selecting a viable kernel for executing a function
@@ -186,6 +227,28 @@ class ARROW_EXPORT Function {
   virtual Result<Datum> Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const;
 
+  /// \brief Execute the function on the rows of `batch` selected by its
+  /// selection vector, giving one output value per selected row.
+  ///
+  /// Without a selection vector, this is the same as executing on the values
+  /// of `batch`.
+  Result<Datum> Execute(const ExecBatch& batch, const FunctionOptions* options,
+                        ExecContext* ctx) const;
+
+  /// \brief Bind the function to argument descriptors and options, for
+  /// repeated execution without redoing kernel dispatch and state
+  /// initialization.
+  ///
+  /// If the `options` pointer is null, then `default_options()` will be used.
+  /// The function, `options` and `ctx` must outlive the returned object.
+  /// Only SCALAR functions can be bound, as well as meta functions overriding
+  /// this method such as "cast".  Dictionary arguments must be supported by a
+  /// kernel, since the fallback executing on dictionary values is not
+  /// available.
+  virtual Result<std::unique_ptr<BoundFunction>> Bind(
+      const std::vector<ValueDescr>& descrs, const FunctionOptions* options,
+      ExecContext* ctx) const;
+
   /// \brief Returns a the default options for this function.
   ///
   /// Whatever option semantics a Function has, implementations must guarantee
@@ -195,6 +258,10 @@ class ARROW_EXPORT Function {
   virtual Status Validate() const;
 
  protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const std::shared_ptr<SelectionVector>& selection,
+                            const FunctionOptions* options, ExecContext* ctx) const;
+
   Function(std::string name, Function::Kind kind, const Arity& arity,
            const FunctionDoc* doc, const FunctionOptions* default_options)
       : name_(std::move(name)),
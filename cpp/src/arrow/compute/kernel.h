@@ -602,6 +602,15 @@ struct ScalarKernel : public ArrayKernel {
   // bitmaps is a reasonable default
   NullHandling::type null_handling = NullHandling::INTERSECTION;
   MemAllocation::type mem_allocation = MemAllocation::PREALLOCATE;
+
+  /// \brief Whether the kernel can execute on the rows selected by
+  /// ExecBatch::selection_vector, rather than on all the rows of the array
+  /// arguments. Otherwise the selected rows are gathered before calling the
+  /// kernel.
+  ///
+  /// The output has then one value per selected row, and its validity bitmap
+  /// is already populated according to null_handling.
+  bool can_execute_selection = false;
 };
 
 // ----------------------------------------------------------------------
@@ -678,7 +687,10 @@ using ScalarAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
 /// * init: creates a new KernelState for a kernel.
 /// * consume: processes an ExecBatch and updates the KernelState found in the
 ///   KernelContext.
-/// * merge: combines one KernelState with another.
+/// * merge: combines another KernelState into the one found in the
+///   KernelContext. Since the two states were produced by different Groupers,
+///   the merge also receives a uint32 array mapping each group id of the
+///   other state to the corresponding group id of the destination state.
 /// * finalize: produces the end result of the aggregation using the
 ///   KernelState in the KernelContext.
 struct ScalarAggregateKernel : public Kernel {
@@ -710,7 +722,7 @@ struct ScalarAggregateKernel : public Kernel {
 using HashAggregateConsume = std::function<void(KernelContext*, const ExecBatch&)>;
 
 using HashAggregateMerge =
-    std::function<void(KernelContext*, KernelState&&, KernelState*)>;
+    std::function<void(KernelContext*, KernelState&&, const ArrayData&)>;
 
 // Finalize returns Datum to permit multiple return values
 using HashAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
@@ -723,7 +735,10 @@ using HashAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
 /// * consume: processes an ExecBatch (which includes the argument as well
 ///   as an array of group identifiers) and updates the KernelState found in the
 ///   KernelContext.
-/// * merge: combines one KernelState with another.
+/// * merge: combines another KernelState into the one found in the
+///   KernelContext. Since the two states were produced by different Groupers,
+///   the merge also receives a uint32 array mapping each group id of the
+///   other state to the corresponding group id of the destination state.
 /// * finalize: produces the end result of the aggregation using the
 ///   KernelState in the KernelContext.
 struct HashAggregateKernel : public Kernel {
@@ -0,0 +1,269 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+using arrow::internal::HyperLogLog;
+
+namespace {
+
+// The hashes of short values only disperse their bits well enough for hash tables,
+// not for the leading zero counts of HyperLogLog: finalize them like MurmurHash3.
+uint64_t SketchHash(const void* data, int64_t length) {
+  uint64_t h = ::arrow::internal::ComputeStringHash<0>(data, length);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+struct SketchUpdater {
+  const ArrayData& data;
+  const uint32_t* sketch_ids;
+  HyperLogLog* sketches;
+
+  HyperLogLog* sketch(int64_t i) {
+    return sketch_ids == nullptr ? sketches : sketches + sketch_ids[i];
+  }
+
+  template <typename Func>
+  void VisitValid(Func&& func) {
+    // Run positions are relative to data.offset
+    arrow::internal::VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
+                                         [&](int64_t pos, int64_t len) {
+                                           for (int64_t i = pos; i < pos + len; ++i) {
+                                             func(i);
+                                           }
+                                         });
+  }
+
+  Status Visit(const BooleanType&) {
+    VisitValid([&](int64_t i) {
+      const uint8_t value = BitUtil::GetBit(data.buffers[1]->data(), data.offset + i);
+      sketch(i)->Add(SketchHash(&value, sizeof(value)));
+    });
+    return Status::OK();
+  }
+
+  // Values comparing equal have the same hash: zeros of either sign are hashed as
+  // positive zero, and NaNs as a single NaN.
+  template <typename CType>
+  Status VisitFloatingPoint() {
+    const CType* values = data.GetValues<CType>(1);
+    VisitValid([&](int64_t i) {
+      CType value = values[i];
+      if (std::isnan(value)) {
+        value = std::numeric_limits<CType>::quiet_NaN();
+      } else if (value == 0) {
+        value = 0;
+      }
+      sketch(i)->Add(SketchHash(&value, sizeof(value)));
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const FloatType&) { return VisitFloatingPoint<float>(); }
+
+  Status Visit(const DoubleType&) { return VisitFloatingPoint<double>(); }
+
+  // Integers, temporal types, decimals and fixed size binary: hash the bytes of values
+  Status Visit(const FixedWidthType& type) {
+    const int64_t width = type.bit_width() / 8;
+    const uint8_t* values = data.buffers[1]->data() + data.offset * width;
+    VisitValid([&](int64_t i) { sketch(i)->Add(SketchHash(values + i * width, width)); });
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    int64_t i = 0;
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view value) {
+          sketch(i++)->Add(SketchHash(value.data(), static_cast<int64_t>(value.size())));
+        },
+        [&] { ++i; });
+    return Status::OK();
+  }
+
+  // All null
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const DictionaryType& type) {
+    return Visit(static_cast<const DataType&>(type));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Approximate distinct count of values of type ", type);
+  }
+};
+
+Status MergeSketches(int32_t precision, const ArrayData& data,
+                     const uint32_t* sketch_ids, HyperLogLog* sketches) {
+  int64_t i = 0;
+  return VisitArrayDataInline<BinaryType>(
+      data,
+      [&](util::string_view serialized) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto other, HyperLogLog::Deserialize(serialized));
+        if (other.precision() != precision) {
+          return Status::Invalid("Cannot merge a HyperLogLog sketch of precision ",
+                                 other.precision(), " into one of precision ",
+                                 precision);
+        }
+        auto sketch = sketch_ids == nullptr ? sketches : sketches + sketch_ids[i];
+        sketch->Merge(other);
+        ++i;
+        return Status::OK();
+      },
+      [&]() -> Status {
+        ++i;
+        return Status::OK();
+      });
+}
+
+}  // namespace
+
+Status CheckApproxCountDistinct(const ApproxCountDistinctOptions& options,
+                                const DataType& type) {
+  if (options.precision < HyperLogLog::kMinPrecision ||
+      options.precision > HyperLogLog::kMaxPrecision) {
+    return Status::Invalid("Approximate distinct count precision must be between ",
+                           HyperLogLog::kMinPrecision, " and ",
+                           HyperLogLog::kMaxPrecision, ", got ", options.precision);
+  }
+  if (options.merge_sketches) {
+    if (type.id() != Type::BINARY) {
+      return Status::TypeError("Merged HyperLogLog sketches must be binary, got ", type);
+    }
+    return Status::OK();
+  }
+  // The types SketchUpdater visits
+  if (type.id() == Type::NA || is_base_binary_like(type.id()) ||
+      (is_fixed_width(type.id()) && !is_dictionary(type.id()))) {
+    return Status::OK();
+  }
+  return Status::NotImplemented("Approximate distinct count of values of type ", type);
+}
+
+Status UpdateSketches(const ApproxCountDistinctOptions& options, const ArrayData& data,
+                      const uint32_t* sketch_ids, HyperLogLog* sketches) {
+  if (data.length == data.GetNullCount()) {
+    return Status::OK();
+  }
+  if (options.merge_sketches) {
+    return MergeSketches(options.precision, data, sketch_ids, sketches);
+  }
+  SketchUpdater updater{data, sketch_ids, sketches};
+  return VisitTypeInline(*data.type, &updater);
+}
+
+std::shared_ptr<DataType> ApproxCountDistinctType(
+    const ApproxCountDistinctOptions& options) {
+  return options.output_sketch ? binary() : int64();
+}
+
+namespace internal {
+
+namespace {
+
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  explicit ApproxCountDistinctImpl(const ApproxCountDistinctOptions& options)
+      : options(options), sketch(options.precision) {}
+
+  void Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    KERNEL_RETURN_IF_ERROR(ctx,
+                           UpdateSketches(options, *batch[0].array(), nullptr, &sketch));
+  }
+
+  void MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ApproxCountDistinctImpl&>(src);
+    this->sketch.Merge(other.sketch);
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    if (options.output_sketch) {
+      *out = Datum(
+          std::make_shared<BinaryScalar>(Buffer::FromString(sketch.Serialize())));
+    } else {
+      *out = Datum(static_cast<int64_t>(std::llround(sketch.Estimate())));
+    }
+  }
+
+  const ApproxCountDistinctOptions& options;
+  HyperLogLog sketch;
+};
+
+std::unique_ptr<KernelState> ApproxCountDistinctInit(KernelContext* ctx,
+                                                     const KernelInitArgs& args) {
+  const auto& options = static_cast<const ApproxCountDistinctOptions&>(*args.options);
+  ctx->SetStatus(CheckApproxCountDistinct(options, *args.inputs[0].type));
+  if (ctx->HasError()) return nullptr;
+  return ::arrow::internal::make_unique<ApproxCountDistinctImpl>(options);
+}
+
+const FunctionDoc approx_count_distinct_doc{
+    "Approximate number of distinct values with the HyperLogLog++ algorithm",
+    ("Nulls are ignored. Memory use is bounded by the precision of the sketch\n"
+     "whatever the number of distinct values, and partial results can be\n"
+     "output as binary sketches and merged later.\n"
+     "The relative standard error is about 1.04 / sqrt(2^precision)."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+std::shared_ptr<ScalarAggregateFunction> AddApproxCountDistinctAggKernels() {
+  static auto default_options = ApproxCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), &approx_count_distinct_doc,
+      &default_options);
+  auto sig = KernelSignature::Make(
+      {InputType(ValueDescr::ARRAY)},
+      OutputType(
+          [](KernelContext* ctx, const std::vector<ValueDescr>&) -> Result<ValueDescr> {
+            const auto& impl =
+                checked_cast<const ApproxCountDistinctImpl&>(*ctx->state());
+            return ValueDescr::Scalar(ApproxCountDistinctType(impl.options));
+          }));
+  AddAggKernel(std::move(sig), ApproxCountDistinctInit, func.get());
+  return func;
+}
+
+}  // namespace
+
+void RegisterScalarAggregateApproxCountDistinct(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(AddApproxCountDistinctAggKernels()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
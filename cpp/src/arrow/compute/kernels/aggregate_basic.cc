@@ -15,12 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstring>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -55,12 +61,32 @@ namespace aggregate {
 // ----------------------------------------------------------------------
 // Count implementation
 
+// Run-end encoded arrays store their nulls as null run values
+int64_t CountRunEndEncodedNulls(const ArrayData& input) {
+  const ArrayData& values = ree_util::ValuesArray(input);
+  if (values.GetNullCount() == 0) {
+    return 0;
+  } else if (values.type->id() == Type::NA) {
+    return input.length;
+  }
+  const uint8_t* validity = values.buffers[0]->data();
+  int64_t nulls = 0;
+  DCHECK_OK(ree_util::VisitRuns(input, [&](int64_t physical_index, int64_t run_length) {
+    const bool valid = BitUtil::GetBit(validity, values.offset + physical_index);
+    nulls += valid ? 0 : run_length;
+    return Status::OK();
+  }));
+  return nulls;
+}
+
 struct CountImpl : public ScalarAggregator {
   explicit CountImpl(CountOptions options) : options(std::move(options)) {}
 
   void Consume(KernelContext*, const ExecBatch& batch) override {
     const ArrayData& input = *batch[0].array();
-    const int64_t nulls = input.GetNullCount();
+    const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                              ? CountRunEndEncodedNulls(input)
+                              : input.GetNullCount();
     this->nulls += nulls;
     this->non_nulls += input.length - nulls;
   }
@@ -115,6 +141,234 @@ std::unique_ptr<KernelState> MeanInit(KernelContext* ctx, const KernelInitArgs&
   return visitor.Create();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded sum implementation
+
+// Sums the value of each run once, multiplied by the run length
+template <typename ArrowType>
+struct RunEndEncodedSumImpl : public SumImpl<ArrowType, SimdLevel::NONE> {
+  using CType = typename ArrowType::c_type;
+  using SumCType = typename FindAccumulatorType<ArrowType>::Type::c_type;
+
+  void Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const ArrayData& values = ree_util::ValuesArray(input);
+    const uint8_t* validity =
+        values.MayHaveNulls() ? values.buffers[0]->data() : nullptr;
+    KERNEL_RETURN_IF_ERROR(
+        ctx, ree_util::VisitRuns(input, [&](int64_t physical_index, int64_t run_length) {
+          const int64_t index = values.offset + physical_index;
+          if (validity == nullptr || BitUtil::GetBit(validity, index)) {
+            this->count += run_length;
+            this->sum += GetRunValue(values, index) * static_cast<SumCType>(run_length);
+          }
+          return Status::OK();
+        }));
+  }
+
+  static SumCType GetRunValue(const ArrayData& values, int64_t index) {
+    if (is_boolean_type<ArrowType>::value) {
+      return BitUtil::GetBit(values.buffers[1]->data(), index);
+    }
+    return static_cast<SumCType>(
+        reinterpret_cast<const CType*>(values.buffers[1]->data())[index]);
+  }
+};
+
+std::unique_ptr<KernelState> RunEndEncodedSumInit(KernelContext* ctx,
+                                                  const KernelInitArgs& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args.inputs[0].type);
+  SumLikeInit<RunEndEncodedSumImpl> visitor(ctx, *ree_type.value_type());
+  return visitor.Create();
+}
+
+// Same output types as the sum of plain arrays
+Result<ValueDescr> ResolveRunEndEncodedSumOutput(KernelContext*,
+                                                 const std::vector<ValueDescr>& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args[0].type);
+  const Type::type value_type_id = ree_type.value_type()->id();
+  if (value_type_id == Type::BOOL || is_signed_integer(value_type_id)) {
+    return ValueDescr::Scalar(int64());
+  } else if (is_unsigned_integer(value_type_id)) {
+    return ValueDescr::Scalar(uint64());
+  } else if (is_floating(value_type_id)) {
+    return ValueDescr::Scalar(float64());
+  }
+  return Status::NotImplemented("No sum implemented for ", ree_type);
+}
+
+// ----------------------------------------------------------------------
+// Decimal sum implementation
+
+// Sums the values of a decimal array as 32-bit limbs, each limb position in
+// its own 64-bit lane so that the inner loop is plain integer addition the
+// compiler can vectorize.  The most significant limb is sign-extended; the
+// others are unsigned.  The lanes are only carried into a 256-bit sum once
+// per block of values, each lane being able to absorb 2^32 limbs.
+template <typename ArrowType>
+struct DecimalSumLanes {
+  static constexpr int kWords = ArrowType::kByteWidth / 8;
+  static constexpr int kLanes = 2 * kWords;
+  static constexpr int64_t kMaxBlockSize = int64_t(1) << 31;
+
+  void ConsumeRun(const uint8_t* values, int64_t length) {
+    while (length > 0) {
+      const int64_t block_size = std::min(length, int64_t(kMaxBlockSize));
+      uint64_t lanes[kLanes - 1] = {};
+      int64_t top_lane = 0;
+      for (int64_t i = 0; i < block_size; ++i) {
+        uint64_t words[kWords];
+        std::memcpy(words, values + i * ArrowType::kByteWidth, sizeof(words));
+        for (int w = 0; w < kWords - 1; ++w) {
+          const uint64_t word = BitUtil::FromLittleEndian(words[w]);
+          lanes[2 * w] += word & 0xFFFFFFFFULL;
+          lanes[2 * w + 1] += word >> 32;
+        }
+        const uint64_t word = BitUtil::FromLittleEndian(words[kWords - 1]);
+        lanes[kLanes - 2] += word & 0xFFFFFFFFULL;
+        top_lane += static_cast<int32_t>(word >> 32);
+      }
+      for (int lane = 0; lane < kLanes - 1; ++lane) {
+        BasicDecimal256 limbs(lanes[lane]);
+        limbs <<= static_cast<uint32_t>(32 * lane);
+        sum += limbs;
+      }
+      BasicDecimal256 top(top_lane);
+      top <<= static_cast<uint32_t>(32 * (kLanes - 1));
+      sum += top;
+
+      values += block_size * ArrowType::kByteWidth;
+      length -= block_size;
+    }
+  }
+
+  void Consume(const ArrayData& data) {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * ArrowType::kByteWidth;
+    arrow::internal::VisitSetBitRunsVoid(
+        data.buffers[0], data.offset, data.length, [&](int64_t pos, int64_t len) {
+          ConsumeRun(values + pos * ArrowType::kByteWidth, len);
+        });
+  }
+
+  BasicDecimal256 sum;
+};
+
+// The sum of the values of a decimal type, normalized to the output type
+// whose precision is the maximum for its width
+template <typename ArrowType>
+struct DecimalSumImpl : public ScalarAggregator {
+  using ThisType = DecimalSumImpl<ArrowType>;
+  using OutputScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using CType = typename OutputScalarType::ValueType;
+
+  explicit DecimalSumImpl(std::shared_ptr<DataType> out_type)
+      : out_type(std::move(out_type)) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const auto& data = batch[0].array();
+    this->count += data->length - data->GetNullCount();
+    lanes.Consume(*data);
+  }
+
+  void MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    this->count += other.count;
+    this->lanes.sum += other.lanes.sum;
+  }
+
+  Status CheckPrecision(const BasicDecimal256& value) const {
+    const auto& type = checked_cast<const DecimalType&>(*out_type);
+    if (!value.FitsInPrecision(type.precision())) {
+      return Status::Invalid("Decimal sum overflows ", type.ToString());
+    }
+    return Status::OK();
+  }
+
+  static CType Narrow(const BasicDecimal256& value) {
+    return Narrow(value, CType{});
+  }
+  static Decimal128 Narrow(const BasicDecimal256& value, Decimal128) {
+    const auto& words = value.little_endian_array();
+    return Decimal128(static_cast<int64_t>(words[1]), words[0]);
+  }
+  static Decimal256 Narrow(const BasicDecimal256& value, Decimal256) { return value; }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    if (this->count == 0) {
+      out->value = MakeNullScalar(out_type);
+      return;
+    }
+    KERNEL_RETURN_IF_ERROR(ctx, CheckPrecision(lanes.sum));
+    out->value = std::make_shared<OutputScalarType>(Narrow(lanes.sum), out_type);
+  }
+
+  std::shared_ptr<DataType> out_type;
+  int64_t count = 0;
+  DecimalSumLanes<ArrowType> lanes;
+};
+
+// The mean of the values of a decimal type, at the input scale and rounded
+// half away from zero
+template <typename ArrowType>
+struct DecimalMeanImpl : public DecimalSumImpl<ArrowType> {
+  using DecimalSumImpl<ArrowType>::DecimalSumImpl;
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    if (this->count == 0) {
+      out->value = MakeNullScalar(this->out_type);
+      return;
+    }
+    const BasicDecimal256 count(this->count);
+    BasicDecimal256 mean, remainder;
+    this->lanes.sum.Divide(count, &mean, &remainder);
+    remainder.Abs();
+    remainder <<= 1;
+    if (remainder >= count) {
+      mean += BasicDecimal256(this->lanes.sum.Sign());
+    }
+    KERNEL_RETURN_IF_ERROR(ctx, this->CheckPrecision(mean));
+    out->value = std::make_shared<typename DecimalSumImpl<ArrowType>::OutputScalarType>(
+        this->Narrow(mean), this->out_type);
+  }
+};
+
+template <template <typename> class KernelClass>
+std::unique_ptr<KernelState> DecimalSumLikeInit(KernelContext* ctx,
+                                                const KernelInitArgs& args) {
+  auto out_type = args.kernel->signature->out_type().Resolve(ctx, args.inputs);
+  if (!out_type.ok()) {
+    ctx->SetStatus(out_type.status());
+    return nullptr;
+  }
+  if (args.inputs[0].type->id() == Type::DECIMAL128) {
+    return ::arrow::internal::make_unique<KernelClass<Decimal128Type>>(
+        out_type->type);
+  }
+  return ::arrow::internal::make_unique<KernelClass<Decimal256Type>>(out_type->type);
+}
+
+Result<ValueDescr> ResolveDecimalSumOutput(KernelContext*,
+                                           const std::vector<ValueDescr>& args) {
+  const auto& type = checked_cast<const DecimalType&>(*args[0].type);
+  if (type.id() == Type::DECIMAL128) {
+    return ValueDescr::Scalar(decimal128(Decimal128Type::kMaxPrecision, type.scale()));
+  }
+  return ValueDescr::Scalar(decimal256(Decimal256Type::kMaxPrecision, type.scale()));
+}
+
+Result<ValueDescr> ResolveDecimalMeanOutput(KernelContext*,
+                                            const std::vector<ValueDescr>& args) {
+  return ValueDescr::Scalar(args[0].type);
+}
+
+void AddDecimalSumLikeKernels(KernelInit init, OutputType::Resolver resolver,
+                              ScalarAggregateFunction* func) {
+  for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
+    auto sig = KernelSignature::Make({InputType::Array(id)}, OutputType(resolver));
+    AddAggKernel(std::move(sig), init, func);
+  }
+}
+
 // ----------------------------------------------------------------------
 // MinMax implementation
 
@@ -236,12 +490,16 @@ const FunctionDoc count_doc{"Count the number of null / non-null values",
                             {"array"},
                             "CountOptions"};
 
-const FunctionDoc sum_doc{
-    "Sum values of a numeric array", ("Null values are ignored."), {"array"}};
+const FunctionDoc sum_doc{"Sum values of a numeric array",
+                          ("Null values are ignored.\n"
+                           "Decimals are summed exactly, at the input scale and\n"
+                           "the maximum precision of the input decimal width."),
+                          {"array"}};
 
 const FunctionDoc mean_doc{"Compute the mean of a numeric array",
-                           ("Null values are ignored. The result is always computed\n"
-                            "as a double, regardless of the input types"),
+                           ("Null values are ignored. The result is computed as\n"
+                            "a double, except for decimal inputs whose mean has\n"
+                            "the input type, rounded half away from zero."),
                            {"array"}};
 
 const FunctionDoc min_max_doc{"Compute the minimum and maximum values of a numeric array",
@@ -279,6 +537,12 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
                                 func.get());
   aggregate::AddBasicAggKernels(aggregate::SumInit, FloatingPointTypes(), float64(),
                                 func.get());
+  aggregate::AddDecimalSumLikeKernels(
+      aggregate::DecimalSumLikeInit<aggregate::DecimalSumImpl>,
+      aggregate::ResolveDecimalSumOutput, func.get());
+  AddAggKernel(KernelSignature::Make({InputType::Array(Type::RUN_END_ENCODED)},
+                                    OutputType(aggregate::ResolveRunEndEncodedSumOutput)),
+               aggregate::RunEndEncodedSumInit, func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -299,6 +563,9 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   aggregate::AddBasicAggKernels(aggregate::MeanInit, {boolean()}, float64(), func.get());
   aggregate::AddBasicAggKernels(aggregate::MeanInit, NumericTypes(), float64(),
                                 func.get());
+  aggregate::AddDecimalSumLikeKernels(
+      aggregate::DecimalSumLikeInit<aggregate::DecimalMeanImpl>,
+      aggregate::ResolveDecimalMeanOutput, func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
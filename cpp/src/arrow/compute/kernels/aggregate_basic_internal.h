@@ -60,11 +60,11 @@ struct SumImpl : public ScalarAggregator {
 
   void Consume(KernelContext*, const ExecBatch& batch) override {
     const auto& data = batch[0].array();
-    this->count = data->length - data->GetNullCount();
+    this->count += data->length - data->GetNullCount();
     if (is_boolean_type<ArrowType>::value) {
-      this->sum = static_cast<typename SumType::c_type>(BooleanArray(data).true_count());
+      this->sum += static_cast<typename SumType::c_type>(BooleanArray(data).true_count());
     } else {
-      this->sum =
+      this->sum +=
           arrow::compute::detail::SumArray<CType, typename SumType::c_type>(*data);
     }
   }
@@ -227,7 +227,7 @@ struct MinMaxImpl : public ScalarAggregator {
     local.has_values = (arr.length() - null_count) > 0;
 
     if (local.has_nulls && options.null_handling == MinMaxOptions::EMIT_NULL) {
-      this->state = local;
+      this->state += local;
       return;
     }
 
@@ -238,7 +238,7 @@ struct MinMaxImpl : public ScalarAggregator {
         local.MergeOne(arr.Value(i));
       }
     }
-    this->state = local;
+    this->state += local;
   }
 
   void MergeFrom(KernelContext*, KernelState&& src) override {
@@ -342,7 +342,7 @@ struct BooleanMinMaxImpl : public MinMaxImpl<BooleanType, SimdLevel> {
     local.has_nulls = null_count > 0;
     local.has_values = valid_count > 0;
     if (local.has_nulls && options.null_handling == MinMaxOptions::EMIT_NULL) {
-      this->state = local;
+      this->state += local;
       return;
     }
 
@@ -351,7 +351,7 @@ struct BooleanMinMaxImpl : public MinMaxImpl<BooleanType, SimdLevel> {
     local.max = true_count > 0;
     local.min = false_count == 0;
 
-    this->state = local;
+    this->state += local;
   }
 };
 
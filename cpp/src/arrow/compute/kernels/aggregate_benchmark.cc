@@ -19,6 +19,7 @@
 
 #include <vector>
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -463,6 +464,19 @@ GROUP_BY_BENCHMARK(SumDoublesGroupedByMediumIntStringPairSet, [&] {
   BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {int_key, str_key});
 });
 
+GROUP_BY_BENCHMARK(ModeInt64sGroupedByMediumIntegerSet, [&] {
+  auto values = rng.Int64(args.size,
+                          /*min=*/0,
+                          /*max=*/255,
+                          /*null_probability=*/args.null_proportion);
+
+  auto key = rng.Int64(args.size,
+                       /*min=*/0,
+                       /*max=*/4095);
+
+  BenchmarkGroupBy(state, {{"hash_mode", NULLPTR}}, {values}, {key});
+});
+
 //
 // Sum
 //
@@ -539,6 +553,34 @@ MODE_KERNEL_BENCHMARK(ModeKernelInt16, Int16Type);
 MODE_KERNEL_BENCHMARK(ModeKernelInt32, Int32Type);
 MODE_KERNEL_BENCHMARK(ModeKernelInt64, Int64Type);
 
+// Many chunks of values in a wide range, which are counted in parallel
+template <typename ArrowType>
+void ModeKernelChunkedWide(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(CType);
+  auto rand = random::RandomArrayGenerator(1924);
+  auto array = rand.Numeric<ArrowType>(array_size, 0, 1 << 20, args.null_proportion);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < array_size; offset += 64 * 1024) {
+    chunks.push_back(array->Slice(offset, 64 * 1024));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(std::move(chunks));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Mode(chunked).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void ModeKernelChunkedArgs(benchmark::internal::Benchmark* bench) {
+  BenchmarkSetArgsWithSizes(bench, {16 * 1024 * 1024});  // 16M
+}
+
+BENCHMARK_TEMPLATE(ModeKernelChunkedWide, Int32Type)->Apply(ModeKernelChunkedArgs);
+BENCHMARK_TEMPLATE(ModeKernelChunkedWide, Int64Type)->Apply(ModeKernelChunkedArgs);
+
 //
 // MinMax
 //
@@ -17,9 +17,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -59,6 +65,56 @@ void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                   ScalarAggregateFunction* func,
                   SimdLevel::type simd_level = SimdLevel::NONE);
 
+// Helpers shared by approx_count_distinct and hash_approx_count_distinct
+
+// Check the options and the argument type of an approximate distinct count
+Status CheckApproxCountDistinct(const ApproxCountDistinctOptions& options,
+                                const DataType& type);
+
+// Add the non-null values of an array to HyperLogLog sketches, or merge the sketches
+// they hold if options.merge_sketches. Value i goes to sketches[sketch_ids[i]], or to
+// sketches[0] if sketch_ids is null.
+Status UpdateSketches(const ApproxCountDistinctOptions& options, const ArrayData& data,
+                      const uint32_t* sketch_ids,
+                      ::arrow::internal::HyperLogLog* sketches);
+
+// The output of an approximate distinct count: the rounded estimate, or the
+// serialized sketch if options.output_sketch
+std::shared_ptr<DataType> ApproxCountDistinctType(
+    const ApproxCountDistinctOptions& options);
+
+// Helpers shared by quantile and hash_quantile
+
+// Check that QuantileOptions has quantiles, all between 0 and 1
+Status CheckQuantileOptions(const QuantileOptions& options);
+
+// The type of the quantiles: the input type if the interpolation picks data points,
+// float64 otherwise
+std::shared_ptr<DataType> QuantileType(const QuantileOptions& options,
+                                       const std::shared_ptr<DataType>& in_type);
+
+// Compute the quantiles of `length` > 0 valid, non-NaN values of a numeric type, which
+// are reordered in place. One value of QuantileType() is written to `out` per quantile.
+Status ComputeQuantiles(const QuantileOptions& options, const DataType& type,
+                        uint8_t* values, int64_t length, uint8_t* out);
+
+// Helpers shared by mode and hash_mode
+
+// The type of a mode: struct<mode: in_type, count: int64>
+std::shared_ptr<DataType> ModeType(const std::shared_ptr<DataType>& in_type);
+
+// Whether a value and its count rank before another one among the modes: its count
+// is larger, or equal and the value is smaller, NaN being larger than any value
+template <typename CType>
+bool ModeRanksBefore(const std::pair<CType, int64_t>& lhs,
+                     const std::pair<CType, int64_t>& rhs) {
+  if (lhs.second != rhs.second) {
+    return lhs.second > rhs.second;
+  }
+  const bool rhs_is_nan = rhs.first != rhs.first;
+  return lhs.first < rhs.first || (rhs_is_nan && lhs.first == lhs.first);
+}
+
 namespace detail {
 
 using arrow::internal::VisitSetBitRunsVoid;
@@ -15,268 +15,365 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// The values are counted in parallel: consumed chunks are split into pieces, which
+// the tasks of the CPU pool count into their own ModeCounts.  Those are mergeable
+// states, holding the counts of small integer ranges in a dense vector and the others
+// in a hash map, which are summed at the end.
+
+#include <algorithm>
 #include <cmath>
-#include <queue>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
-namespace internal {
 
 namespace {
 
 constexpr char kModeFieldName[] = "mode";
 constexpr char kCountFieldName[] = "count";
 
-// {value:count} map
-template <typename CType>
-using CounterMap = std::unordered_map<CType, int64_t>;
-
-// map based counter for floating points
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<std::is_floating_point<CType>::value, CounterMap<CType>> CountValuesByMap(
-    const ArrayType& array, int64_t& nan_count) {
-  CounterMap<CType> value_counts_map;
-  const ArrayData& data = *array.data();
-  const CType* values = data.GetValues<CType>(1);
-
-  nan_count = 0;
-  if (array.length() > array.null_count()) {
-    arrow::internal::VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
-                                         [&](int64_t pos, int64_t len) {
-                                           for (int64_t i = 0; i < len; ++i) {
-                                             const auto value = values[pos + i];
-                                             if (std::isnan(value)) {
-                                               ++nan_count;
-                                             } else {
-                                               ++value_counts_map[value];
-                                             }
-                                           }
-                                         });
-  }
+}  // namespace
 
-  return value_counts_map;
+std::shared_ptr<DataType> ModeType(const std::shared_ptr<DataType>& in_type) {
+  return struct_({field(kModeFieldName, in_type), field(kCountFieldName, int64())});
 }
 
-// map base counter for non floating points
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<!std::is_floating_point<CType>::value, CounterMap<CType>> CountValuesByMap(
-    const ArrayType& array) {
-  CounterMap<CType> value_counts_map;
-  const ArrayData& data = *array.data();
-  const CType* values = data.GetValues<CType>(1);
-
-  if (array.length() > array.null_count()) {
-    arrow::internal::VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
-                                         [&](int64_t pos, int64_t len) {
-                                           for (int64_t i = 0; i < len; ++i) {
-                                             ++value_counts_map[values[pos + i]];
-                                           }
-                                         });
-  }
+namespace internal {
 
-  return value_counts_map;
-}
+namespace {
 
-// vector based counter for int8 or integers with small value range
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-CounterMap<CType> CountValuesByVector(const ArrayType& array, CType min, CType max) {
-  const int range = static_cast<int>(max - min);
-  DCHECK(range >= 0 && range < 64 * 1024 * 1024);
-  const ArrayData& data = *array.data();
-  const CType* values = data.GetValues<CType>(1);
-
-  std::vector<int64_t> value_counts_vector(range + 1);
-  if (array.length() > array.null_count()) {
-    arrow::internal::VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
-                                         [&](int64_t pos, int64_t len) {
-                                           for (int64_t i = 0; i < len; ++i) {
-                                             ++value_counts_vector[values[pos + i] - min];
-                                           }
-                                         });
-  }
+using arrow::internal::VisitSetBitRunsVoid;
 
-  // Transfer value counts to a map to be consistent with other chunks
-  CounterMap<CType> value_counts_map(range + 1);
-  for (int i = 0; i <= range; ++i) {
-    CType value = static_cast<CType>(i + min);
-    int64_t count = value_counts_vector[i];
-    if (count) {
-      value_counts_map[value] = count;
-    }
-  }
+// Consumed chunks are counted in pieces of this length
+constexpr int64_t kPieceLength = 1 << 16;
+// Consumed chunks are kept until they add up to this length, then counted at once
+constexpr int64_t kMaxPendingLength = 1 << 22;
+// The counts of integers within a range this wide are kept in a dense vector,
+// when a piece has enough values to pay for it, see ARROW-9873
+constexpr uint64_t kMaxDenseRange = 16384;
+constexpr int64_t kMinDenseBytes = 8192;
+// Pieces of integers within a narrower range are counted in several histograms
+constexpr uint64_t kMaxInterleavedRange = 256;
+
+// {value:count} map
+template <typename CType>
+using CounterMap = std::unordered_map<CType, int64_t>;
 
-  return value_counts_map;
+// The distance between an integer and a smaller one
+template <typename CType>
+uint64_t DenseOffset(CType value, CType base) {
+  return static_cast<uint64_t>(value) - static_cast<uint64_t>(base);
 }
 
-// map or vector based counter for int16/32/64 per value range
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-CounterMap<CType> CountValuesByMapOrVector(const ArrayType& array) {
-  // see https://issues.apache.org/jira/browse/ARROW-9873
-  static constexpr int kMinArraySize = 8192 / sizeof(CType);
-  static constexpr int kMaxValueRange = 16384;
-  const ArrayData& data = *array.data();
-  const CType* values = data.GetValues<CType>(1);
+// Mergeable counts of the values of one or more pieces of input
+template <typename ArrowType>
+struct ModeCounts {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ValueCount = std::pair<CType, int64_t>;
+
+  // bool: count the ones and the zeros
+  template <typename T = ArrowType>
+  enable_if_boolean<T> Count(const ArrayData& data, int64_t offset, int64_t length) {
+    const uint8_t* values = data.buffers[1]->data();
+    int64_t true_count = 0;
+    int64_t valid_count = 0;
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                        [&](int64_t pos, int64_t len) {
+                          true_count += arrow::internal::CountSetBits(
+                              values, data.offset + offset + pos, len);
+                          valid_count += len;
+                        });
+    if (valid_count > 0) {
+      ReserveDense(false, true);
+      dense_counts[0] += valid_count - true_count;
+      dense_counts[1] += true_count;
+    }
+  }
 
-  if ((array.length() - array.null_count()) >= kMinArraySize) {
+  // integers: count in the dense vector if their range is small enough
+  template <typename T = ArrowType>
+  enable_if_integer<T> Count(const ArrayData& data, int64_t offset, int64_t length) {
+    const CType* values = data.GetValues<CType>(1) + offset;
     CType min = std::numeric_limits<CType>::max();
     CType max = std::numeric_limits<CType>::min();
-
-    arrow::internal::VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
-                                         [&](int64_t pos, int64_t len) {
-                                           for (int64_t i = 0; i < len; ++i) {
-                                             const auto value = values[pos + i];
-                                             min = std::min(min, value);
-                                             max = std::max(max, value);
-                                           }
-                                         });
-
-    if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <= kMaxValueRange) {
-      return CountValuesByVector(array, min, max);
+    int64_t valid_count = 0;
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = 0; i < len; ++i) {
+                            min = std::min(min, values[pos + i]);
+                            max = std::max(max, values[pos + i]);
+                          }
+                          valid_count += len;
+                        });
+    if (valid_count == 0) return;
+
+    const uint64_t range = DenseOffset(max, min);
+    const int64_t min_dense_values = kMinDenseBytes / static_cast<int64_t>(sizeof(CType));
+    const bool dense = sizeof(CType) == 1 ||
+                       (valid_count >= min_dense_values && range <= kMaxDenseRange);
+    if (dense && ReserveDense(min, max)) {
+      int64_t* counts = dense_counts.data() + DenseOffset(min, dense_min);
+      if (range < kMaxInterleavedRange) {
+        CountInterleaved(data, offset, length, min, range, counts);
+      } else {
+        VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                            [&](int64_t pos, int64_t len) {
+                              for (int64_t i = 0; i < len; ++i) {
+                                ++counts[DenseOffset(values[pos + i], min)];
+                              }
+                            });
+      }
+      return;
     }
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = 0; i < len; ++i) {
+                            ++value_counts[values[pos + i]];
+                          }
+                        });
   }
-  return CountValuesByMap(array);
-}
 
-// bool
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<is_boolean_type<typename ArrayType::TypeClass>::value, CounterMap<CType>>
-CountValues(const ArrayType& array, int64_t& nan_count) {
-  // we need just count ones and zeros
-  CounterMap<CType> map;
-  if (array.length() > array.null_count()) {
-    map[true] = array.true_count();
-    map[false] = array.length() - array.null_count() - map[true];
+  // floating points: count in the map, and NaNs apart
+  template <typename T = ArrowType>
+  enable_if_floating_point<T> Count(const ArrayData& data, int64_t offset,
+                                    int64_t length) {
+    const CType* values = data.GetValues<CType>(1) + offset;
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = 0; i < len; ++i) {
+                            const auto value = values[pos + i];
+                            if (std::isnan(value)) {
+                              ++nan_count;
+                            } else {
+                              ++value_counts[value];
+                            }
+                          }
+                        });
   }
-  nan_count = 0;
-  return map;
-}
 
-// int8
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<is_integer_type<typename ArrayType::TypeClass>::value && sizeof(CType) == 1,
-            CounterMap<CType>>
-CountValues(const ArrayType& array, int64_t& nan_count) {
-  using Limits = std::numeric_limits<CType>;
-  nan_count = 0;
-  return CountValuesByVector(array, Limits::min(), Limits::max());
-}
+  // Add the counts of the values of a piece, all within [min, min + range], to
+  // `counts`.  Consecutive values go to four histograms in turn, so that a run of
+  // equal values doesn't wait on the update of the same counter, and the histograms
+  // are summed by a loop the compiler vectorizes.
+  static void CountInterleaved(const ArrayData& data, int64_t offset, int64_t length,
+                               CType min, uint64_t range, int64_t* counts) {
+    DCHECK_LT(range, kMaxInterleavedRange);
+    DCHECK_LE(length, kPieceLength);
+    // a piece has less than 2^32 values
+    uint32_t lanes[4][kMaxInterleavedRange] = {};
+    const CType* values = data.GetValues<CType>(1) + offset;
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + offset, length,
+                        [&](int64_t pos, int64_t len) {
+                          const CType* run = values + pos;
+                          int64_t i = 0;
+                          for (; i + 4 <= len; i += 4) {
+                            ++lanes[0][DenseOffset(run[i], min)];
+                            ++lanes[1][DenseOffset(run[i + 1], min)];
+                            ++lanes[2][DenseOffset(run[i + 2], min)];
+                            ++lanes[3][DenseOffset(run[i + 3], min)];
+                          }
+                          for (; i < len; ++i) {
+                            ++lanes[0][DenseOffset(run[i], min)];
+                          }
+                        });
+    for (uint64_t j = 0; j <= range; ++j) {
+      counts[j] += static_cast<int64_t>(lanes[0][j]) + lanes[1][j] + lanes[2][j] +
+                   lanes[3][j];
+    }
+  }
 
-// int16/32/64
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<is_integer_type<typename ArrayType::TypeClass>::value && (sizeof(CType) > 1),
-            CounterMap<CType>>
-CountValues(const ArrayType& array, int64_t& nan_count) {
-  nan_count = 0;
-  return CountValuesByMapOrVector(array);
-}
+  // Widen the dense vector to cover [lo, hi], unless it would get too wide
+  bool ReserveDense(CType lo, CType hi) {
+    if (dense_counts.empty()) {
+      dense_min = lo;
+      dense_max = hi;
+      dense_counts.assign(DenseOffset(hi, lo) + 1, 0);
+      return true;
+    }
+    const CType new_min = std::min(lo, dense_min);
+    const CType new_max = std::max(hi, dense_max);
+    if (new_min == dense_min && new_max == dense_max) {
+      return true;
+    }
+    if (sizeof(CType) > 1 && DenseOffset(new_max, new_min) > kMaxDenseRange) {
+      return false;
+    }
+    std::vector<int64_t> counts(DenseOffset(new_max, new_min) + 1, 0);
+    std::copy(dense_counts.begin(), dense_counts.end(),
+              counts.begin() + DenseOffset(dense_min, new_min));
+    dense_counts = std::move(counts);
+    dense_min = new_min;
+    dense_max = new_max;
+    return true;
+  }
 
-// float/double
-template <typename ArrayType, typename CType = typename ArrayType::TypeClass::c_type>
-enable_if_t<(std::is_floating_point<CType>::value), CounterMap<CType>>  // NOLINT format
-CountValues(const ArrayType& array, int64_t& nan_count) {
-  nan_count = 0;
-  return CountValuesByMap(array, nan_count);
-}
+  CType DenseValue(size_t index) const {
+    return static_cast<CType>(static_cast<uint64_t>(dense_min) + index);
+  }
 
-template <typename ArrowType>
-struct ModeState {
-  using ThisType = ModeState<ArrowType>;
-  using CType = typename ArrowType::c_type;
-
-  void MergeFrom(ThisType&& state) {
-    if (this->value_counts.empty()) {
-      this->value_counts = std::move(state.value_counts);
-    } else {
-      for (const auto& value_count : state.value_counts) {
-        auto value = value_count.first;
-        auto count = value_count.second;
-        this->value_counts[value] += count;
+  void MergeFrom(ModeCounts&& other) {
+    nan_count += other.nan_count;
+    if (!other.dense_counts.empty()) {
+      if (ReserveDense(other.dense_min, other.dense_max)) {
+        int64_t* counts = dense_counts.data() + DenseOffset(other.dense_min, dense_min);
+        const int64_t* other_counts = other.dense_counts.data();
+        const size_t size = other.dense_counts.size();
+        for (size_t i = 0; i < size; ++i) {
+          counts[i] += other_counts[i];
+        }
+      } else {
+        for (size_t i = 0; i < other.dense_counts.size(); ++i) {
+          if (other.dense_counts[i] > 0) {
+            other.value_counts[other.DenseValue(i)] += other.dense_counts[i];
+          }
+        }
       }
     }
-    if (is_floating_type<ArrowType>::value) {
-      this->nan_count += state.nan_count;
+    // insert the smaller map into the larger one
+    if (value_counts.size() < other.value_counts.size()) {
+      std::swap(value_counts, other.value_counts);
+    }
+    for (const auto& value_count : other.value_counts) {
+      value_counts[value_count.first] += value_count.second;
     }
+    other = ModeCounts();
   }
 
-  // find top-n value/count pairs with min-heap (priority queue with '>' comparator)
-  void Finalize(CType* modes, int64_t* counts, const int64_t n) {
-    DCHECK(n >= 1 && n <= this->DistinctValues());
+  // The n most common values and their counts, in descending order
+  std::vector<ValueCount> TopN(int64_t n) {
+    // a value may be counted both in the map and in the dense vector
+    if (!dense_counts.empty()) {
+      for (auto it = value_counts.begin(); it != value_counts.end();) {
+        if (it->first >= dense_min && it->first <= dense_max) {
+          dense_counts[DenseOffset(it->first, dense_min)] += it->second;
+          it = value_counts.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
 
-    // mode 'greater than' comparator: larger count or same count with smaller value
-    using ValueCountPair = std::pair<CType, int64_t>;
-    auto mode_gt = [](const ValueCountPair& lhs, const ValueCountPair& rhs) {
-      const bool rhs_is_nan = rhs.first != rhs.first;  // nan as largest value
-      return lhs.second > rhs.second ||
-             (lhs.second == rhs.second && (lhs.first < rhs.first || rhs_is_nan));
+    // keep the n modes in a heap whose top ranks last
+    auto ranks_before = [](const ValueCount& lhs, const ValueCount& rhs) {
+      return ModeRanksBefore(lhs, rhs);
     };
-
-    // initialize min-heap with first n modes
-    std::vector<ValueCountPair> vector(n);
-    // push nan if exists
-    const bool has_nan = is_floating_type<ArrowType>::value && this->nan_count > 0;
-    if (has_nan) {
-      vector[0] = std::make_pair(static_cast<CType>(NAN), this->nan_count);
-    }
-    // push n or n-1 modes
-    auto it = this->value_counts.cbegin();
-    for (int i = has_nan; i < n; ++i) {
-      vector[i] = *it++;
-    }
-    // turn to min-heap
-    std::priority_queue<ValueCountPair, std::vector<ValueCountPair>, decltype(mode_gt)>
-        min_heap(std::move(mode_gt), std::move(vector));
-
-    // iterate and insert modes into min-heap
-    // - mode < heap top: ignore mode
-    // - mode > heap top: discard heap top, insert mode
-    for (; it != this->value_counts.cend(); ++it) {
-      if (mode_gt(*it, min_heap.top())) {
-        min_heap.pop();
-        min_heap.push(*it);
+    std::vector<ValueCount> heap;
+    auto push = [&](CType value, int64_t count) {
+      if (static_cast<int64_t>(heap.size()) < n) {
+        heap.emplace_back(value, count);
+        std::push_heap(heap.begin(), heap.end(), ranks_before);
+      } else if (n > 0 && ranks_before(ValueCount(value, count), heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), ranks_before);
+        heap.back() = ValueCount(value, count);
+        std::push_heap(heap.begin(), heap.end(), ranks_before);
+      }
+    };
+    for (size_t i = 0; i < dense_counts.size(); ++i) {
+      if (dense_counts[i] > 0) {
+        push(DenseValue(i), dense_counts[i]);
       }
     }
-
-    // pop modes from min-heap and insert into output array (in reverse order)
-    DCHECK_EQ(min_heap.size(), static_cast<size_t>(n));
-    for (int64_t i = n - 1; i >= 0; --i) {
-      std::tie(modes[i], counts[i]) = min_heap.top();
-      min_heap.pop();
+    for (const auto& value_count : value_counts) {
+      push(value_count.first, value_count.second);
     }
+    if (nan_count > 0) {
+      push(static_cast<CType>(NAN), nan_count);
+    }
+    std::sort_heap(heap.begin(), heap.end(), ranks_before);
+    return heap;
   }
 
-  int64_t DistinctValues() const {
-    return this->value_counts.size() +
-           (is_floating_type<ArrowType>::value && this->nan_count > 0);
-  }
-
-  int64_t nan_count = 0;  // only make sense to floating types
+  // dense_counts[i] counts the value dense_min + i, up to dense_max
+  CType dense_min{};
+  CType dense_max{};
+  std::vector<int64_t> dense_counts;
   CounterMap<CType> value_counts;
+  int64_t nan_count = 0;  // only make sense to floating types
 };
 
 template <typename ArrowType>
 struct ModeImpl : public ScalarAggregator {
   using ThisType = ModeImpl<ArrowType>;
-  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
-  using CType = typename ArrowType::c_type;
-
-  ModeImpl(const std::shared_ptr<DataType>& out_type, const ModeOptions& options)
-      : out_type(out_type), options(options) {}
-
-  void Consume(KernelContext*, const ExecBatch& batch) override {
-    ArrayType array(batch[0].array());
-    this->state.value_counts = CountValues(array, this->state.nan_count);
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  // a slice of a consumed chunk
+  struct Piece {
+    const ArrayData* data;
+    int64_t offset;
+    int64_t length;
+  };
+
+  explicit ModeImpl(const ModeOptions& options) : options(options) {}
+
+  void Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    const auto& data = batch[0].array();
+    if (data->length > data->GetNullCount()) {
+      pending_length += data->length;
+      pending.push_back(data);
+    }
+    if (pending_length >= kMaxPendingLength) {
+      KERNEL_RETURN_IF_ERROR(ctx, CountPending(ctx));
+    }
   }
 
-  void MergeFrom(KernelContext*, KernelState&& src) override {
+  void MergeFrom(KernelContext* ctx, KernelState&& src) override {
     auto& other = checked_cast<ThisType&>(src);
-    this->state.MergeFrom(std::move(other.state));
+    counts.MergeFrom(std::move(other.counts));
+    pending.insert(pending.end(), other.pending.begin(), other.pending.end());
+    pending_length += other.pending_length;
+    other.pending.clear();
+    other.pending_length = 0;
+    if (pending_length >= kMaxPendingLength) {
+      KERNEL_RETURN_IF_ERROR(ctx, CountPending(ctx));
+    }
+  }
+
+  // Count the pending chunks: each task counts every num_tasks-th piece, then the
+  // counts of the tasks are merged
+  Status CountPending(KernelContext* ctx) {
+    std::vector<Piece> pieces;
+    for (const auto& data : pending) {
+      for (int64_t offset = 0; offset < data->length; offset += kPieceLength) {
+        pieces.push_back(
+            {data.get(), offset, std::min(kPieceLength, data->length - offset)});
+      }
+    }
+    int num_tasks = 1;
+    // the threads of the CPU pool may all be waiting on this one already
+    if (ctx->exec_context()->use_threads() &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      num_tasks = static_cast<int>(std::max<int64_t>(
+          1, std::min<int64_t>(pieces.size(), GetCpuThreadPoolCapacity())));
+    }
+
+    std::vector<ModeCounts<ArrowType>> partials(num_tasks);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        num_tasks > 1, num_tasks, [&](int task) {
+          for (size_t i = task; i < pieces.size(); i += num_tasks) {
+            partials[task].Count(*pieces[i].data, pieces[i].offset, pieces[i].length);
+          }
+          return Status::OK();
+        }));
+    for (auto& partial : partials) {
+      counts.MergeFrom(std::move(partial));
+    }
+    pending.clear();
+    pending_length = 0;
+    return Status::OK();
   }
 
   static std::shared_ptr<ArrayData> MakeArrayData(
@@ -289,17 +386,12 @@ struct ModeImpl : public ScalarAggregator {
   }
 
   void Finalize(KernelContext* ctx, Datum* out) override {
+    KERNEL_RETURN_IF_ERROR(ctx, CountPending(ctx));
+
     const auto& mode_type = TypeTraits<ArrowType>::type_singleton();
     const auto& count_type = int64();
-    const auto& out_type =
-        struct_({field(kModeFieldName, mode_type), field(kCountFieldName, count_type)});
-
-    int64_t n = this->options.n;
-    if (n > state.DistinctValues()) {
-      n = state.DistinctValues();
-    } else if (n < 0) {
-      n = 0;
-    }
+    const auto modes = counts.TopN(this->options.n);
+    const auto n = static_cast<int64_t>(modes.size());
 
     auto mode_data = this->MakeArrayData(mode_type, n);
     auto count_data = this->MakeArrayData(count_type, n);
@@ -310,14 +402,19 @@ struct ModeImpl : public ScalarAggregator {
                              ctx->Allocate(n * sizeof(int64_t)));
       CType* mode_buffer = mode_data->template GetMutableValues<CType>(1);
       int64_t* count_buffer = count_data->template GetMutableValues<int64_t>(1);
-      this->state.Finalize(mode_buffer, count_buffer, n);
+      for (int64_t i = 0; i < n; ++i) {
+        std::tie(mode_buffer[i], count_buffer[i]) = modes[i];
+      }
     }
 
-    *out = Datum(ArrayData::Make(out_type, n, {nullptr}, {mode_data, count_data}, 0));
+    *out = Datum(
+        ArrayData::Make(ModeType(mode_type), n, {nullptr}, {mode_data, count_data}, 0));
   }
 
-  std::shared_ptr<DataType> out_type;
-  ModeState<ArrowType> state;
+  ModeCounts<ArrowType> counts;
+  // the consumed chunks which are not counted yet
+  ArrayDataVector pending;
+  int64_t pending_length = 0;
   ModeOptions options;
 };
 
@@ -341,7 +438,7 @@ struct ModeInitState {
   template <typename Type>
   enable_if_t<is_number_type<Type>::value || is_boolean_type<Type>::value, Status> Visit(
       const Type&) {
-    state.reset(new ModeImpl<Type>(out_type, options));
+    state.reset(new ModeImpl<Type>(options));
     return Status::OK();
   }
 
@@ -362,8 +459,8 @@ void AddModeKernels(KernelInit init, const std::vector<std::shared_ptr<DataType>
                     ScalarAggregateFunction* func) {
   for (const auto& ty : types) {
     // array[T] -> array[struct<mode: T, count: int64_t>]
-    auto out_ty = struct_({field(kModeFieldName, ty), field(kCountFieldName, int64())});
-    auto sig = KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(out_ty));
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(ModeType(ty)));
     AddAggKernel(std::move(sig), init, func);
   }
 }
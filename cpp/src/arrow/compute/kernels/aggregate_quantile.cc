@@ -15,13 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <vector>
 
 #include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/stl_allocator.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -74,6 +81,108 @@ uint64_t QuantileToDataPoint(size_t length, double q,
   return datapoint_index;
 }
 
+// the ranks (positions in ascending order) of the data points the quantiles of
+// `length` values are computed from, in ascending order and without duplicates
+std::vector<uint64_t> QuantileRanks(const QuantileOptions& options, uint64_t length) {
+  std::vector<uint64_t> ranks;
+  for (double q : options.q) {
+    if (IsDataPoint(options)) {
+      ranks.push_back(QuantileToDataPoint(length, q, options.interpolation));
+    } else {
+      const double index = (length - 1) * q;
+      const uint64_t lower_index = static_cast<uint64_t>(index);
+      ranks.push_back(lower_index);
+      if (index != lower_index) {
+        ranks.push_back(lower_index + 1);
+      }
+    }
+  }
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  return ranks;
+}
+
+// select the values of the given ranks (ascending) among `length` values, which are
+// reordered in place
+template <typename CType>
+std::vector<CType> SelectRanks(CType* values, uint64_t length,
+                               const std::vector<uint64_t>& ranks) {
+  std::vector<CType> rank_values(ranks.size());
+  // select ranks in descending order: values left of the last selected rank are the
+  // smallest ones, only they need to be partitioned for the next rank
+  uint64_t end = length;
+  for (size_t i = ranks.size(); i-- > 0;) {
+    DCHECK_LT(ranks[i], end);
+    std::nth_element(values, values + ranks[i], values + end);
+    rank_values[i] = values[ranks[i]];
+    end = ranks[i];
+  }
+  return rank_values;
+}
+
+// write the quantiles of `length` values to `out`, given the values of the ranks
+// returned by QuantileRanks()
+template <typename CType>
+void FillQuantiles(const QuantileOptions& options, uint64_t length,
+                   const std::vector<uint64_t>& ranks,
+                   const std::vector<CType>& rank_values, uint8_t* out) {
+  auto value_at = [&](uint64_t rank) {
+    auto it = std::lower_bound(ranks.begin(), ranks.end(), rank);
+    DCHECK(it != ranks.end() && *it == rank);
+    return rank_values[it - ranks.begin()];
+  };
+
+  if (IsDataPoint(options)) {
+    CType* out_values = reinterpret_cast<CType*>(out);
+    for (size_t i = 0; i < options.q.size(); ++i) {
+      out_values[i] =
+          value_at(QuantileToDataPoint(length, options.q[i], options.interpolation));
+    }
+    return;
+  }
+
+  double* out_values = reinterpret_cast<double*>(out);
+  for (size_t i = 0; i < options.q.size(); ++i) {
+    const double index = (length - 1) * options.q[i];
+    const uint64_t lower_index = static_cast<uint64_t>(index);
+    const double fraction = index - lower_index;
+
+    const double lower_value = static_cast<double>(value_at(lower_index));
+    if (fraction == 0) {
+      out_values[i] = lower_value;
+      continue;
+    }
+    const double higher_value = static_cast<double>(value_at(lower_index + 1));
+
+    if (options.interpolation == QuantileOptions::LINEAR) {
+      // more stable than naive linear interpolation
+      out_values[i] = fraction * higher_value + (1 - fraction) * lower_value;
+    } else if (options.interpolation == QuantileOptions::MIDPOINT) {
+      out_values[i] = lower_value / 2 + higher_value / 2;
+    } else {
+      DCHECK(false);
+      out_values[i] = NAN;
+    }
+  }
+}
+
+// allocate the output of quantile for `length` valid input values, it is empty if
+// there is none
+Result<std::shared_ptr<ArrayData>> MakeQuantileOutput(
+    KernelContext* ctx, const QuantileOptions& options,
+    const std::shared_ptr<DataType>& in_type, uint64_t length) {
+  const int64_t out_length = length > 0 ? static_cast<int64_t>(options.q.size()) : 0;
+  const auto out_type = QuantileType(options, in_type);
+  auto out_data = ArrayData::Make(out_type, out_length, 0);
+  out_data->buffers.resize(2, nullptr);
+  if (out_length > 0) {
+    const auto out_bit_width = checked_pointer_cast<NumberType>(out_type)->bit_width();
+    ARROW_ASSIGN_OR_RAISE(out_data->buffers[1],
+                          ctx->Allocate(out_length * out_bit_width / 8));
+  }
+  return out_data;
+}
+
 // copy and nth_element approach, large memory footprint
 template <typename InType>
 struct SortQuantiler {
@@ -105,50 +214,17 @@ struct SortQuantiler {
       }
     }
 
-    // prepare out array
-    int64_t out_length = options.q.size();
-    if (in_buffer.empty()) {
-      out_length = 0;  // input is empty or only contains null and nan, return empty array
-    }
-    // out type depends on options
-    const bool is_datapoint = IsDataPoint(options);
-    const std::shared_ptr<DataType> out_type =
-        is_datapoint ? TypeTraits<InType>::type_singleton() : float64();
-    auto out_data = ArrayData::Make(out_type, out_length, 0);
-    out_data->buffers.resize(2, nullptr);
+    // input is empty or only contains null and nan, return empty array
+    KERNEL_ASSIGN_OR_RAISE(
+        auto out_data, ctx,
+        MakeQuantileOutput(ctx, options, datum.type(), in_buffer.size()));
 
     // calculate quantiles
-    if (out_length > 0) {
-      const auto out_bit_width = checked_pointer_cast<NumberType>(out_type)->bit_width();
-      KERNEL_ASSIGN_OR_RAISE(out_data->buffers[1], ctx,
-                             ctx->Allocate(out_length * out_bit_width / 8));
-
-      // find quantiles in descending order
-      std::vector<int64_t> q_indices(out_length);
-      std::iota(q_indices.begin(), q_indices.end(), 0);
-      std::sort(q_indices.begin(), q_indices.end(),
-                [&options](int64_t left_index, int64_t right_index) {
-                  return options.q[right_index] < options.q[left_index];
-                });
-
-      // input array is partitioned around data point at `last_index` (pivot)
-      // for next quatile which is smaller, we only consider inputs left of the pivot
-      uint64_t last_index = in_buffer.size();
-      if (is_datapoint) {
-        CType* out_buffer = out_data->template GetMutableValues<CType>(1);
-        for (int64_t i = 0; i < out_length; ++i) {
-          const int64_t q_index = q_indices[i];
-          out_buffer[q_index] = GetQuantileAtDataPoint(
-              in_buffer, &last_index, options.q[q_index], options.interpolation);
-        }
-      } else {
-        double* out_buffer = out_data->template GetMutableValues<double>(1);
-        for (int64_t i = 0; i < out_length; ++i) {
-          const int64_t q_index = q_indices[i];
-          out_buffer[q_index] = GetQuantileByInterp(
-              in_buffer, &last_index, options.q[q_index], options.interpolation);
-        }
-      }
+    if (!in_buffer.empty()) {
+      const auto ranks = QuantileRanks(options, in_buffer.size());
+      FillQuantiles(options, in_buffer.size(), ranks,
+                    SelectRanks(in_buffer.data(), in_buffer.size(), ranks),
+                    out_data->buffers[1]->mutable_data());
     }
 
     *out = Datum(std::move(out_data));
@@ -169,62 +245,252 @@ struct SortQuantiler {
     }
     return n;
   }
+};
 
-  // return quantile located exactly at some input data point
-  CType GetQuantileAtDataPoint(std::vector<CType, Allocator>& in, uint64_t* last_index,
-                               double q,
-                               enum QuantileOptions::Interpolation interpolation) {
-    const uint64_t datapoint_index = QuantileToDataPoint(in.size(), q, interpolation);
+// parallel selection approach for large inputs, without copying them
+//
+// A random sample of the values gives, for each quantile, a narrow band of candidate
+// values which contains the quantile with high probability. One parallel pass over the
+// input then counts the values below each band and only copies the values inside the
+// bands, from which the quantiles are selected. Should a quantile fall outside of its
+// band, this falls back to the copy and nth_element approach.
+template <typename InType>
+struct SelectQuantiler {
+  using CType = typename InType::c_type;
+  using Allocator = arrow::stl::allocator<CType>;
+  using ValueVector = std::vector<CType, Allocator>;
+
+  // the sample has length / 256 values, within these bounds
+  static constexpr int64_t kMinSampleSize = 1 << 14;
+  static constexpr int64_t kMaxSampleSize = 1 << 20;
+  // input chunks are split into pieces of this length for the parallel pass
+  static constexpr int64_t kPieceLength = 1 << 16;
+
+  // candidate values [lower, upper] of one or more quantiles
+  struct Band {
+    CType lower;
+    CType upper;
+  };
 
-    if (datapoint_index != *last_index) {
-      DCHECK_LT(datapoint_index, *last_index);
-      std::nth_element(in.begin(), in.begin() + datapoint_index,
-                       in.begin() + *last_index);
-      *last_index = datapoint_index;
-    }
+  // a slice of an input chunk
+  struct Piece {
+    const ArrayData* data;
+    int64_t offset;
+    int64_t length;
+  };
 
-    return in[datapoint_index];
+  // what one task of the parallel pass found
+  struct PartialCounts {
+    // gap_counts[i]: # of values between bands i - 1 and i
+    std::vector<int64_t> gap_counts;
+    // band_values[i]: values inside band i
+    std::vector<ValueVector> band_values;
+  };
+
+  void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    KERNEL_RETURN_IF_ERROR(ctx, DoExec(ctx, batch, out));
   }
 
-  // return quantile interpolated from adjacent input data points
-  double GetQuantileByInterp(std::vector<CType, Allocator>& in, uint64_t* last_index,
-                             double q,
-                             enum QuantileOptions::Interpolation interpolation) {
-    const double index = (in.size() - 1) * q;
-    const uint64_t lower_index = static_cast<uint64_t>(index);
-    const double fraction = index - lower_index;
+  Status DoExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const QuantileOptions& options = QuantileState::Get(ctx);
+    const Datum& datum = batch[0];
+    const ArrayVector chunks = datum.chunks();
+
+    ValueVector sample(Allocator(ctx->memory_pool()));
+    SampleValues(chunks, datum.length(), &sample);
+    if (sample.empty()) {
+      // likely all NaN
+      SortQuantiler<InType>().Exec(ctx, batch, out);
+      return Status::OK();
+    }
+    std::sort(sample.begin(), sample.end());
+    const std::vector<Band> bands = MakeBands(options, sample);
+    const size_t num_bands = bands.size();
+    sample = ValueVector(Allocator(ctx->memory_pool()));
+
+    std::vector<Piece> pieces;
+    for (const auto& chunk : chunks) {
+      for (int64_t offset = 0; offset < chunk->length(); offset += kPieceLength) {
+        pieces.push_back({chunk->data().get(), offset,
+                          std::min(kPieceLength, chunk->length() - offset)});
+      }
+    }
+    int num_tasks = 1;
+    // the threads of the CPU pool may all be waiting on this one already
+    if (ctx->exec_context()->use_threads() &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      num_tasks = static_cast<int>(std::max<int64_t>(
+          1, std::min<int64_t>(pieces.size(), GetCpuThreadPoolCapacity())));
+    }
 
-    if (lower_index != *last_index) {
-      DCHECK_LT(lower_index, *last_index);
-      std::nth_element(in.begin(), in.begin() + lower_index, in.begin() + *last_index);
+    std::vector<PartialCounts> partials(num_tasks);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        num_tasks > 1, num_tasks, [&](int task) {
+          PartialCounts* partial = &partials[task];
+          partial->gap_counts.assign(num_bands + 1, 0);
+          partial->band_values.resize(num_bands,
+                                      ValueVector(Allocator(ctx->memory_pool())));
+          for (size_t i = task; i < pieces.size(); i += num_tasks) {
+            CountPiece(pieces[i], bands, partial);
+          }
+          return Status::OK();
+        }));
+
+    // gather the values of each band, and count the values below it
+    std::vector<ValueVector> band_values = std::move(partials[0].band_values);
+    std::vector<uint64_t> below(num_bands);
+    uint64_t length = 0;
+    for (size_t i = 0; i <= num_bands; ++i) {
+      for (const auto& partial : partials) {
+        length += partial.gap_counts[i];
+      }
+      if (i == num_bands) break;
+      below[i] = length;
+      for (int task = 1; task < num_tasks; ++task) {
+        auto& task_values = partials[task].band_values[i];
+        band_values[i].insert(band_values[i].end(), task_values.begin(),
+                              task_values.end());
+        task_values = ValueVector(Allocator(ctx->memory_pool()));
+      }
+      length += band_values[i].size();
     }
 
-    const double lower_value = static_cast<double>(in[lower_index]);
-    if (fraction == 0) {
-      *last_index = lower_index;
-      return lower_value;
+    // select the ranks the quantiles are computed from inside their bands
+    const auto ranks = QuantileRanks(options, length);
+    std::vector<CType> rank_values;
+    size_t next_rank = 0;
+    for (size_t i = 0; i < num_bands; ++i) {
+      const uint64_t begin = below[i];
+      const uint64_t end = begin + band_values[i].size();
+      std::vector<uint64_t> band_ranks;
+      while (next_rank < ranks.size() && ranks[next_rank] >= begin &&
+             ranks[next_rank] < end) {
+        band_ranks.push_back(ranks[next_rank++] - begin);
+      }
+      const auto values =
+          SelectRanks(band_values[i].data(), band_values[i].size(), band_ranks);
+      rank_values.insert(rank_values.end(), values.begin(), values.end());
+    }
+    if (next_rank < ranks.size()) {
+      // a quantile is outside of the candidate bands
+      band_values.clear();
+      SortQuantiler<InType>().Exec(ctx, batch, out);
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto out_data,
+                          MakeQuantileOutput(ctx, options, datum.type(), length));
+    FillQuantiles(options, length, ranks, rank_values,
+                  out_data->buffers[1]->mutable_data());
+    *out = Datum(std::move(out_data));
+    return Status::OK();
+  }
+
+  // draw a random sample of the valid values, with replacement
+  static void SampleValues(const ArrayVector& chunks, int64_t length,
+                           ValueVector* sample) {
+    const int64_t sample_size = std::min(
+        length, std::max(kMinSampleSize, std::min(kMaxSampleSize, length / 256)));
+    std::vector<int64_t> positions(sample_size);
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int64_t> position_dist(0, length - 1);
+    std::generate(positions.begin(), positions.end(), [&] { return position_dist(gen); });
+    std::sort(positions.begin(), positions.end());
+
+    sample->reserve(sample_size);
+    size_t chunk_index = 0;
+    int64_t chunk_start = 0;
+    for (const int64_t position : positions) {
+      while (position >= chunk_start + chunks[chunk_index]->length()) {
+        chunk_start += chunks[chunk_index++]->length();
+      }
+      const ArrayData& data = *chunks[chunk_index]->data();
+      const int64_t index = position - chunk_start;
+      if (data.buffers[0] != nullptr &&
+          !BitUtil::GetBit(data.buffers[0]->data(), data.offset + index)) {
+        continue;
+      }
+      const CType value = data.GetValues<CType>(1)[index];
+      if (value == value) {  // not NaN
+        sample->push_back(value);
+      }
     }
+  }
 
-    const uint64_t higher_index = lower_index + 1;
-    DCHECK_LT(higher_index, in.size());
-    if (lower_index != *last_index && higher_index != *last_index) {
-      DCHECK_LT(higher_index, *last_index);
-      // higher value must be the minimal value after lower_index
-      auto min = std::min_element(in.begin() + higher_index, in.begin() + *last_index);
-      std::iter_swap(in.begin() + higher_index, min);
+  // the bands of candidate values of the quantiles, ascending and disjoint
+  static std::vector<Band> MakeBands(const QuantileOptions& options,
+                                     const ValueVector& sample) {
+    // the number of sample values below a quantile deviates from its expected value
+    // by sqrt(n * q * (1 - q)) <= sqrt(n) / 2 on average, widen the bands by 4 times
+    // that to make misses very unlikely
+    const int64_t n = static_cast<int64_t>(sample.size());
+    const int64_t margin = static_cast<int64_t>(2 * std::sqrt(n)) + 2;
+
+    std::vector<double> q = options.q;
+    std::sort(q.begin(), q.end());
+    std::vector<Band> bands;
+    for (double quantile : q) {
+      const int64_t position = static_cast<int64_t>(quantile * (n - 1));
+      // values beyond the sample's extremes must be included at both ends
+      Band band{position - margin <= 0 ? Lowest() : sample[position - margin],
+                position + margin >= n - 1 ? Highest() : sample[position + margin]};
+      if (!bands.empty() && band.lower <= bands.back().upper) {
+        bands.back().upper = std::max(bands.back().upper, band.upper);
+      } else {
+        bands.push_back(band);
+      }
     }
-    *last_index = lower_index;
+    return bands;
+  }
 
-    const double higher_value = static_cast<double>(in[higher_index]);
+  static void CountPiece(const Piece& piece, const std::vector<Band>& bands,
+                         PartialCounts* partial) {
+    const ArrayData& data = *piece.data;
+    const CType* values = data.GetValues<CType>(1) + piece.offset;
+    const size_t num_bands = bands.size();
+    VisitSetBitRunsVoid(data.buffers[0], data.offset + piece.offset, piece.length,
+                        [&](int64_t pos, int64_t len) {
+                          for (int64_t i = pos; i < pos + len; ++i) {
+                            const CType value = values[i];
+                            if (value != value) continue;  // NaN
+                            size_t band = 0;
+                            while (band < num_bands && value > bands[band].upper) {
+                              ++band;
+                            }
+                            if (band < num_bands && value >= bands[band].lower) {
+                              partial->band_values[band].push_back(value);
+                            } else {
+                              ++partial->gap_counts[band];
+                            }
+                          }
+                        });
+  }
 
-    if (interpolation == QuantileOptions::LINEAR) {
-      // more stable than naive linear interpolation
-      return fraction * higher_value + (1 - fraction) * lower_value;
-    } else if (interpolation == QuantileOptions::MIDPOINT) {
-      return lower_value / 2 + higher_value / 2;
+  static CType Lowest() {
+    return std::numeric_limits<CType>::has_infinity
+               ? -std::numeric_limits<CType>::infinity()
+               : std::numeric_limits<CType>::lowest();
+  }
+
+  static CType Highest() {
+    return std::numeric_limits<CType>::has_infinity
+               ? std::numeric_limits<CType>::infinity()
+               : std::numeric_limits<CType>::max();
+  }
+};
+
+// selection or 'copy & nth_element' approach per size
+template <typename InType>
+struct SelectOrSortQuantiler {
+  void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    // below this, copying is cheap and the sample would be a large fraction of it
+    static constexpr int64_t kMinSelectLength = 1 << 20;
+
+    const Datum& datum = batch[0];
+    if (datum.length() - datum.null_count() >= kMinSelectLength) {
+      SelectQuantiler<InType>().Exec(ctx, batch, out);
     } else {
-      DCHECK(false);
-      return NAN;
+      SortQuantiler<InType>().Exec(ctx, batch, out);
     }
   }
 };
@@ -375,7 +641,8 @@ struct CountQuantiler {
   }
 };
 
-// histogram or 'copy & nth_element' approach per value range and size, only for integers
+// histogram, selection or 'copy & nth_element' approach per value range and size, only
+// for integers
 template <typename InType>
 struct CountOrSortQuantiler {
   using CType = typename InType::c_type;
@@ -409,7 +676,7 @@ struct CountOrSortQuantiler {
       }
     }
 
-    SortQuantiler<InType>().Exec(ctx, batch, out);
+    SelectOrSortQuantiler<InType>().Exec(ctx, batch, out);
   }
 };
 
@@ -436,7 +703,7 @@ struct ExactQuantiler<InType, enable_if_t<(is_integer_type<InType>::value &&
 
 template <typename InType>
 struct ExactQuantiler<InType, enable_if_t<is_floating_type<InType>::value>> {
-  SortQuantiler<InType> impl;
+  SelectOrSortQuantiler<InType> impl;
 };
 
 template <typename _, typename InType>
@@ -447,30 +714,14 @@ struct QuantileExecutor {
       return;
     }
 
-    const QuantileOptions& options = QuantileState::Get(ctx);
-    if (options.q.empty()) {
-      ctx->SetStatus(Status::Invalid("Requires quantile argument"));
-      return;
-    }
-    for (double q : options.q) {
-      if (q < 0 || q > 1) {
-        ctx->SetStatus(Status::Invalid("Quantile must be between 0 and 1"));
-        return;
-      }
-    }
-
+    KERNEL_RETURN_IF_ERROR(ctx, CheckQuantileOptions(QuantileState::Get(ctx)));
     ExactQuantiler<InType>().impl.Exec(ctx, batch, out);
   }
 };
 
 Result<ValueDescr> ResolveOutput(KernelContext* ctx,
                                  const std::vector<ValueDescr>& args) {
-  const QuantileOptions& options = QuantileState::Get(ctx);
-  if (IsDataPoint(options)) {
-    return ValueDescr::Array(args[0].type);
-  } else {
-    return ValueDescr::Array(float64());
-  }
+  return ValueDescr::Array(QuantileType(QuantileState::Get(ctx), args[0].type));
 }
 
 void AddQuantileKernels(VectorFunction* func) {
@@ -498,8 +749,68 @@ const FunctionDoc quantile_doc{
     {"array"},
     "QuantileOptions"};
 
+template <typename CType>
+void ComputeQuantilesImpl(const QuantileOptions& options, CType* values,
+                          uint64_t length, uint8_t* out) {
+  const auto ranks = QuantileRanks(options, length);
+  FillQuantiles(options, length, ranks, SelectRanks(values, length, ranks), out);
+}
+
+struct ComputeQuantilesVisitor {
+  const QuantileOptions& options;
+  uint8_t* values;
+  int64_t length;
+  uint8_t* out;
+
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using CType = typename T::c_type;
+    ComputeQuantilesImpl(options, reinterpret_cast<CType*>(values),
+                         static_cast<uint64_t>(length), out);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+};
+
 }  // namespace
 
+}  // namespace internal
+
+// Helpers shared with hash_quantile, declared in aggregate_internal.h
+
+Status CheckQuantileOptions(const QuantileOptions& options) {
+  if (options.q.empty()) {
+    return Status::Invalid("Requires quantile argument");
+  }
+  for (double q : options.q) {
+    if (q < 0 || q > 1) {
+      return Status::Invalid("Quantile must be between 0 and 1");
+    }
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> QuantileType(const QuantileOptions& options,
+                                       const std::shared_ptr<DataType>& in_type) {
+  return internal::IsDataPoint(options) ? in_type : float64();
+}
+
+Status ComputeQuantiles(const QuantileOptions& options, const DataType& type,
+                        uint8_t* values, int64_t length, uint8_t* out) {
+  DCHECK_GT(length, 0);
+  internal::ComputeQuantilesVisitor visitor{options, values, length, out};
+  return VisitTypeInline(type, &visitor);
+}
+
+namespace internal {
+
 void RegisterScalarAggregateQuantile(FunctionRegistry* registry) {
   static QuantileOptions default_options;
   auto func = std::make_shared<VectorFunction>("quantile", Arity::Unary(), &quantile_doc,
@@ -16,11 +16,13 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -39,6 +41,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -293,6 +296,58 @@ TEST_F(TestSumKernelRoundOff, Basics) {
   ASSERT_EQ(sum->value, 2756346749973250.0);
 }
 
+void CheckDecimalAgg(const std::function<Result<Datum>(const Datum&)>& agg,
+                     const Datum& input, const Datum& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum result, agg(input));
+  AssertDatumsEqual(expected, result, /*verbose=*/true);
+}
+
+std::shared_ptr<Scalar> DecimalScalarFromString(const std::shared_ptr<DataType>& type,
+                                                const std::string& value) {
+  if (type->id() == Type::DECIMAL128) {
+    return std::make_shared<Decimal128Scalar>(Decimal128(value), type);
+  }
+  return std::make_shared<Decimal256Scalar>(Decimal256(value), type);
+}
+
+TEST(TestDecimalSumKernel, SimpleSum) {
+  const auto sum = [](const Datum& input) { return Sum(input); };
+  for (const auto& ty : {decimal128(3, 2), decimal256(3, 2)}) {
+    const auto out_ty =
+        ty->id() == Type::DECIMAL128 ? decimal128(38, 2) : decimal256(76, 2);
+
+    CheckDecimalAgg(sum, ArrayFromJSON(ty, "[]"), MakeNullScalar(out_ty));
+    CheckDecimalAgg(sum, ArrayFromJSON(ty, "[null]"), MakeNullScalar(out_ty));
+    CheckDecimalAgg(sum, ArrayFromJSON(ty, R"(["1.00", "2.00", "3.00", "4.00", "5.00"])"),
+                    DecimalScalarFromString(out_ty, "15.00"));
+    CheckDecimalAgg(sum, ArrayFromJSON(ty, R"(["1.23", null, "-9.99", "0.05", null])"),
+                    DecimalScalarFromString(out_ty, "-8.71"));
+    CheckDecimalAgg(sum,
+                    ChunkedArrayFromJSON(ty, {R"(["9.99", "-1.01"])", "[]",
+                                              R"([null, "0.02"])"}),
+                    DecimalScalarFromString(out_ty, "9.00"));
+  }
+}
+
+TEST(TestDecimalSumKernel, CarriesBetweenWords) {
+  const auto sum = [](const Datum& input) { return Sum(input); };
+  const auto ty = decimal128(38, 0);
+
+  // The low 64 bits of these values are all ones, and carry into the high word
+  CheckDecimalAgg(sum,
+                  ArrayFromJSON(ty, R"(["18446744073709551615", "18446744073709551615",
+                                       "-1", "-36893488147419103230"])"),
+                  DecimalScalarFromString(ty, "-1"));
+
+  const auto large = ArrayFromJSON(ty, R"(["99999999999999999999999999999999999999",
+                                          "99999999999999999999999999999999999999",
+                                          "-99999999999999999999999999999999999999"])");
+  CheckDecimalAgg(sum, large,
+                  DecimalScalarFromString(ty, "99999999999999999999999999999999999999"));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("overflows"),
+                                  Sum(large->Slice(0, 2)));
+}
+
 //
 // Count
 //
@@ -456,6 +511,26 @@ TYPED_TEST(TestRandomNumericMeanKernel, RandomArrayMeanOverflow) {
   }
 }
 
+TEST(TestDecimalMeanKernel, SimpleMean) {
+  const auto mean = [](const Datum& input) { return Mean(input); };
+  for (const auto& ty : {decimal128(5, 2), decimal256(5, 2)}) {
+    CheckDecimalAgg(mean, ArrayFromJSON(ty, "[]"), MakeNullScalar(ty));
+    CheckDecimalAgg(mean, ArrayFromJSON(ty, R"(["1.00", null, "2.00", "4.00"])"),
+                    DecimalScalarFromString(ty, "2.33"));
+    CheckDecimalAgg(mean,
+                    ArrayFromJSON(ty, R"(["1.00", "2.00", "4.00", "4.00", "4.00",
+                                          "5.00"])"),
+                    DecimalScalarFromString(ty, "3.33"));
+    // Rounded half away from zero
+    CheckDecimalAgg(mean, ArrayFromJSON(ty, R"(["0.01", "0.02"])"),
+                    DecimalScalarFromString(ty, "0.02"));
+    CheckDecimalAgg(mean, ArrayFromJSON(ty, R"(["-0.01", "-0.02"])"),
+                    DecimalScalarFromString(ty, "-0.02"));
+    CheckDecimalAgg(mean, ArrayFromJSON(ty, R"(["-0.01", "-0.01", "-0.02"])"),
+                    DecimalScalarFromString(ty, "-0.01"));
+  }
+}
+
 //
 // Min / Max
 //
@@ -1082,6 +1157,50 @@ TEST_F(TestInt32ModeKernel, LargeValueRange) {
   CheckModeWithRange<ArrowType>(-10000000, 10000000);
 }
 
+TEST_F(TestInt32ModeKernel, ManyChunks) {
+  // Chunks of drifting value ranges are counted partly in dense vectors and partly
+  // in hash maps, by several tasks, whose counts must add up
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  ArrayVector chunks;
+  for (int i = 0; i < 20; ++i) {
+    const int32_t min = i * 1500 - 15000;
+    const int64_t length = i % 3 == 0 ? 1000 : 70 * 1000;
+    chunks.push_back(rand.Numeric<Int32Type>(length, min, min + 3000, 0.1));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  std::unordered_map<int32_t, int64_t> value_counts;
+  for (const auto& chunk : chunks) {
+    const auto& values = checked_cast<const Int32Array&>(*chunk);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) ++value_counts[values.Value(i)];
+    }
+  }
+  using ValueCount = std::pair<int32_t, int64_t>;
+  std::vector<ValueCount> expected(value_counts.begin(), value_counts.end());
+  std::sort(expected.begin(), expected.end(),
+            [](const ValueCount& lhs, const ValueCount& rhs) {
+              return lhs.second > rhs.second ||
+                     (lhs.second == rhs.second && lhs.first < rhs.first);
+            });
+  expected.resize(10);
+
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ASSERT_OK_AND_ASSIGN(Datum out, Mode(chunked, ModeOptions{10}, &ctx));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    const StructArray out_array(out.array());
+    ASSERT_EQ(out_array.length(), 10);
+    const auto& modes = checked_cast<const Int32Array&>(*out_array.field(0));
+    const auto& counts = checked_cast<const Int64Array&>(*out_array.field(1));
+    for (int64_t i = 0; i < 10; ++i) {
+      ASSERT_EQ(modes.Value(i), expected[i].first);
+      ASSERT_EQ(counts.Value(i), expected[i].second);
+    }
+  }
+}
+
 //
 // Variance/Stddev
 //
@@ -1587,6 +1706,24 @@ class TestRandomQuantileKernel : public TestPrimitiveQuantileKernel<DoubleType>
                              NaiveQuantile(*array, quantiles, interpolations_));
   }
 
+  void CheckChunkedQuantiles(int64_t array_size, int64_t num_chunks,
+                             int64_t num_quantiles) {
+    std::shared_ptr<Array> array;
+    std::vector<double> quantiles;
+    GenerateTestData(array_size, num_quantiles, -100, 200, &array, &quantiles);
+
+    ArrayVector array_vector;
+    const int64_t chunk_size = array_size / num_chunks;
+    for (int64_t i = 0; i < num_chunks - 1; ++i) {
+      array_vector.emplace_back(array->Slice(i * chunk_size, chunk_size));
+    }
+    array_vector.emplace_back(array->Slice((num_chunks - 1) * chunk_size));
+    auto chunked = *ChunkedArray::Make(array_vector);
+
+    this->AssertQuantilesAre(chunked, QuantileOptions{quantiles},
+                             NaiveQuantile(*array, quantiles, interpolations_));
+  }
+
   void CheckTDigests(const std::vector<int>& chunk_sizes, int64_t num_quantiles) {
     int total_size = 0;
     for (int size : chunk_sizes) {
@@ -1715,6 +1852,16 @@ TEST_F(TestRandomQuantileKernel, Histogram) {
   this->CheckQuantiles(/*array_size=*/80000, /*num_quantiles=*/100);
 }
 
+TEST_F(TestRandomQuantileKernel, Selection) {
+  // exercise parallel selection approach: more than 1 << 20 non-null values
+  this->CheckQuantiles(/*array_size=*/1200000, /*num_quantiles=*/20);
+}
+
+TEST_F(TestRandomQuantileKernel, SelectionChunked) {
+  this->CheckChunkedQuantiles(/*array_size=*/1200000, /*num_chunks=*/7,
+                              /*num_quantiles=*/5);
+}
+
 TEST_F(TestRandomQuantileKernel, TDigest) {
   this->CheckTDigests(/*chunk_sizes=*/{12345, 6789, 8765, 4321}, /*num_quantiles=*/100);
 }
@@ -1739,5 +1886,105 @@ TEST_F(TestTDigestKernel, AllNullsOrNaNs) {
   }
 }
 
+//
+// ApproxCountDistinct
+//
+
+class TestApproxCountDistinctKernel : public ::testing::Test {
+ public:
+  int64_t Estimate(const Datum& input, const ApproxCountDistinctOptions& options =
+                                           ApproxCountDistinctOptions::Defaults()) {
+    EXPECT_OK_AND_ASSIGN(Datum out, ApproxCountDistinct(input, options));
+    return out.scalar_as<Int64Scalar>().value;
+  }
+
+  std::shared_ptr<Scalar> Sketch(const Datum& input) {
+    ApproxCountDistinctOptions options;
+    options.output_sketch = true;
+    EXPECT_OK_AND_ASSIGN(Datum out, ApproxCountDistinct(input, options));
+    EXPECT_EQ(out.scalar()->type->id(), Type::BINARY);
+    return out.scalar();
+  }
+
+  void CheckExact(const std::shared_ptr<DataType>& type,
+                  const std::vector<std::string>& json, int64_t expected) {
+    SCOPED_TRACE(type->ToString());
+    ASSERT_EQ(Estimate(ChunkedArrayFromJSON(type, json)), expected);
+  }
+};
+
+TEST_F(TestApproxCountDistinctKernel, Basics) {
+  // Few distinct values are counted exactly
+  CheckExact(int64(), {"[]"}, 0);
+  CheckExact(int32(), {"[1, 2, null, 1]", "[]", "[3, null, 2]"}, 3);
+  CheckExact(uint8(), {"[null, null]"}, 0);
+  CheckExact(float64(), {"[0.0, -0.0, NaN, 1.5]", "[NaN, 1.5]"}, 3);
+  CheckExact(boolean(), {"[true, false, true, null]"}, 2);
+  CheckExact(date32(), {"[0, 1, 0]"}, 2);
+  CheckExact(utf8(), {R"(["a", "", null, "a"])", R"(["bc"])"}, 3);
+  CheckExact(large_binary(), {R"(["a", "a", "b"])"}, 2);
+  CheckExact(fixed_size_binary(2), {R"(["ab", "cd", "ab"])"}, 2);
+  CheckExact(null(), {"[null, null]"}, 0);
+}
+
+TEST_F(TestApproxCountDistinctKernel, Random) {
+  random::RandomArrayGenerator rand(0x5487655);
+  ArrayVector chunks;
+  for (int i = 0; i < 10; ++i) {
+    chunks.push_back(rand.Int64(20000, 0, 49999, /*null_probability=*/0.0));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+  ASSERT_OK_AND_ASSIGN(auto uniques, Unique(chunked));
+  const double exact = static_cast<double>(uniques->length());
+
+  // The relative standard error is about 1.04 / sqrt(2^precision), allow 4 times it
+  for (int32_t precision : {8, 12, 14, 18}) {
+    SCOPED_TRACE(precision);
+    ApproxCountDistinctOptions options(precision);
+    const double tolerance = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    ASSERT_NEAR(Estimate(chunked, options) / exact, 1.0, tolerance);
+  }
+}
+
+TEST_F(TestApproxCountDistinctKernel, MergeSketches) {
+  random::RandomArrayGenerator rand(0x7653);
+  auto left = rand.Int64(30000, 0, 29999, /*null_probability=*/0.1);
+  auto right = rand.Int64(30000, 20000, 49999, /*null_probability=*/0.1);
+  auto both = std::make_shared<ChunkedArray>(ArrayVector{left, right});
+
+  // Merging the sketches of parts is the same as sketching the whole
+  ASSERT_OK_AND_ASSIGN(auto sketches,
+                       ScalarVectorToArray({Sketch(left), MakeNullScalar(binary()),
+                                             Sketch(right)}));
+  ApproxCountDistinctOptions merge_sketches;
+  merge_sketches.merge_sketches = true;
+  ASSERT_EQ(Estimate(sketches, merge_sketches), Estimate(both));
+
+  ASSERT_OK_AND_ASSIGN(Datum merged, ApproxCountDistinct(sketches, [] {
+                         ApproxCountDistinctOptions options;
+                         options.merge_sketches = options.output_sketch = true;
+                         return options;
+                       }()));
+  AssertScalarsEqual(*Sketch(both), *merged.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestApproxCountDistinctKernel, Errors) {
+  auto values = ArrayFromJSON(int64(), "[1, 2]");
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(values, ApproxCountDistinctOptions(3)));
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(values, ApproxCountDistinctOptions(19)));
+  ASSERT_RAISES(NotImplemented,
+                ApproxCountDistinct(ArrayFromJSON(list(int64()), "[[1], [2]]")));
+
+  ApproxCountDistinctOptions merge_sketches(14, /*merge_sketches=*/true);
+  ASSERT_RAISES(TypeError, ApproxCountDistinct(values, merge_sketches));
+  auto not_sketches = ArrayFromJSON(binary(), R"(["not a sketch"])");
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(not_sketches, merge_sketches));
+  // Sketches of another precision
+  auto sketch = Sketch(values);
+  ASSERT_OK_AND_ASSIGN(auto sketches, ScalarVectorToArray({sketch}));
+  ASSERT_RAISES(Invalid,
+                ApproxCountDistinct(sketches, ApproxCountDistinctOptions(12, true)));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -59,9 +59,11 @@ struct VarStdState {
           return (v - mean) * (v - mean);
         });
 
-    this->count = count;
-    this->mean = mean;
-    this->m2 = m2;
+    ThisType state;
+    state.count = count;
+    state.mean = mean;
+    state.m2 = m2;
+    this->MergeFrom(state);
   }
 
   // int32/16/8: textbook one pass algorithm with integer arithmetic
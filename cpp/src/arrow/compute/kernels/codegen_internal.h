@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -171,6 +172,7 @@ struct GetViewType<Type, enable_if_has_c_type<Type>> {
 
 template <typename Type>
 struct GetViewType<Type, enable_if_t<is_base_binary_type<Type>::value ||
+                                     is_string_view_type<Type>::value ||
                                      is_fixed_size_binary_type<Type>::value>> {
   using T = util::string_view;
   using PhysicalType = T;
@@ -186,6 +188,8 @@ struct GetViewType<Decimal128Type> {
   static T LogicalValue(PhysicalType value) {
     return Decimal128(reinterpret_cast<const uint8_t*>(value.data()));
   }
+
+  static T LogicalValue(T value) { return value; }
 };
 
 template <>
@@ -196,6 +200,8 @@ struct GetViewType<Decimal256Type> {
   static T LogicalValue(PhysicalType value) {
     return Decimal256(reinterpret_cast<const uint8_t*>(value.data()));
   }
+
+  static T LogicalValue(T value) { return value; }
 };
 
 template <typename Type, typename Enable = void>
@@ -280,6 +286,41 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+template <typename Type>
+struct ArrayIterator<Type, enable_if_string_view<Type>> {
+  using c_type = typename Type::c_type;
+  const c_type* views;
+  std::vector<const char*> data_buffers;
+
+  explicit ArrayIterator(const ArrayData& arr) : views(arr.GetValues<c_type>(1)) {
+    for (size_t i = 2; i < arr.buffers.size(); ++i) {
+      data_buffers.push_back(reinterpret_cast<const char*>(arr.buffers[i]->data()));
+    }
+  }
+
+  util::string_view operator()() {
+    const c_type& view = *views++;
+    if (view.is_inline()) {
+      return util::string_view(reinterpret_cast<const char*>(view.inlined.data),
+                               view.size());
+    }
+    return util::string_view(data_buffers[view.ref.buffer_index] + view.ref.offset,
+                             view.size());
+  }
+};
+
+template <typename Type>
+struct ArrayIterator<Type, enable_if_decimal<Type>> {
+  using T = typename TypeTraits<Type>::ScalarType::ValueType;
+  // Decimal data buffers are not safely reinterpret_cast-able on big-endian
+  using endian_agnostic = std::array<uint8_t, sizeof(T)>;
+  const endian_agnostic* values;
+
+  explicit ArrayIterator(const ArrayData& data)
+      : values(data.GetValues<endian_agnostic>(1)) {}
+  T operator()() { return T(values++->data()); }
+};
+
 // Iterator over various output array types, taking a GetOutputType<Type>
 
 template <typename Type, typename Enable = void>
@@ -299,6 +340,20 @@ struct OutputArrayWriter<Type, enable_if_has_c_type_not_boolean<Type>> {
   void WriteNull() { *values++ = T{}; }
 };
 
+template <typename Type>
+struct OutputArrayWriter<Type, enable_if_decimal<Type>> {
+  using T = typename TypeTraits<Type>::ScalarType::ValueType;
+  using endian_agnostic = std::array<uint8_t, sizeof(T)>;
+  endian_agnostic* values;
+
+  explicit OutputArrayWriter(ArrayData* data)
+      : values(data->GetMutableValues<endian_agnostic>(1)) {}
+
+  void Write(T value) { value.ToBytes(values++->data()); }
+
+  void WriteNull() { T{}.ToBytes(values++->data()); }
+};
+
 // (Un)box Scalar to / from C++ value
 
 template <typename Type, typename Enable = void>
@@ -314,7 +369,8 @@ struct UnboxScalar<Type, enable_if_has_c_type<Type>> {
 };
 
 template <typename Type>
-struct UnboxScalar<Type, enable_if_base_binary<Type>> {
+struct UnboxScalar<Type, enable_if_t<is_base_binary_type<Type>::value ||
+                                     is_string_view_type<Type>::value>> {
   static util::string_view Unbox(const Scalar& val) {
     if (!val.is_valid) return util::string_view();
     return util::string_view(*checked_cast<const BaseBinaryScalar&>(val).value);
@@ -403,6 +459,23 @@ static void VisitTwoArrayValuesInline(const ArrayData& arr0, const ArrayData& ar
                         arr0.length, std::move(visit_valid), std::move(visit_null));
 }
 
+// ----------------------------------------------------------------------
+// Row mappings for kernels with ScalarKernel::can_execute_selection, giving
+// the input row for each output row
+
+struct AllRows {
+  int64_t operator()(int64_t i) const { return i; }
+};
+
+struct SelectedRows {
+  explicit SelectedRows(const SelectionVector& selection)
+      : indices(selection.indices()) {}
+
+  int64_t operator()(int64_t i) const { return indices[i]; }
+
+  const int32_t* indices;
+};
+
 // ----------------------------------------------------------------------
 // Reusable type resolvers
 
@@ -543,6 +616,17 @@ struct OutputAdapter<Type, enable_if_has_c_type_not_boolean<Type>> {
   }
 };
 
+template <typename Type>
+struct OutputAdapter<Type, enable_if_decimal<Type>> {
+  template <typename Generator>
+  static void Write(KernelContext*, Datum* out, Generator&& generator) {
+    OutputArrayWriter<Type> writer(out->mutable_array());
+    for (int64_t i = 0; i < out->mutable_array()->length; ++i) {
+      writer.Write(generator());
+    }
+  }
+};
+
 template <typename Type>
 struct OutputAdapter<Type, enable_if_base_binary<Type>> {
   template <typename Generator>
@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Benchmarks running the same kernels once per SIMD level, to compare the
+// runtime-dispatched variants against each other on the machine at hand.
+//
+// Every benchmark takes (size in bytes, inverse null proportion, SimdLevel)
+// arguments and reports bytes_per_second and items_per_second along with
+// "simd_level", "null_percent" and "size" counters, so that the output of
+// --benchmark_format=json can be compared across levels mechanically.
+// Levels the CPU does not support are reported as skipped.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+static const std::vector<ArgsType> kInverseNullProportions = {0, 10000, 100, 10, 2, 1};
+static const std::vector<ArgsType> kSimdLevels = {SimdLevel::NONE, SimdLevel::AVX2,
+                                                  SimdLevel::AVX512};
+
+// Restrict kernel dispatch to the given SIMD level for the scope's lifetime
+// by masking the CPU features above it.
+class ScopedSimdLevel {
+ public:
+  explicit ScopedSimdLevel(SimdLevel::type level)
+      : cpu_info_(CpuInfo::GetInstance()),
+        saved_flags_(cpu_info_->hardware_flags()) {
+    // Kernels are registered according to the CPU features enabled when the
+    // registry is created, so make sure it exists before masking any of them.
+    GetFunctionRegistry();
+
+    switch (level) {
+      case SimdLevel::AVX512:
+        supported_ = cpu_info_->IsSupported(CpuInfo::AVX512);
+        break;
+      case SimdLevel::AVX2:
+        supported_ = cpu_info_->IsSupported(CpuInfo::AVX2);
+        break;
+      default:
+        supported_ = true;
+        break;
+    }
+    if (level < SimdLevel::AVX512) {
+      cpu_info_->EnableFeature(CpuInfo::AVX512, false);
+    }
+    if (level < SimdLevel::AVX2) {
+      cpu_info_->EnableFeature(CpuInfo::AVX2 | CpuInfo::BMI2, false);
+    }
+  }
+
+  ~ScopedSimdLevel() {
+    const int64_t disabled = saved_flags_ & ~cpu_info_->hardware_flags();
+    if (disabled != 0) {
+      cpu_info_->EnableFeature(disabled, true);
+    }
+  }
+
+  bool supported() const { return supported_; }
+
+ private:
+  CpuInfo* cpu_info_;
+  const int64_t saved_flags_;
+  bool supported_ = true;
+};
+
+static std::string SimdLevelName(int64_t level) {
+  switch (level) {
+    case SimdLevel::NONE:
+      return "none";
+    case SimdLevel::SSE4_2:
+      return "sse4_2";
+    case SimdLevel::AVX:
+      return "avx";
+    case SimdLevel::AVX2:
+      return "avx2";
+    case SimdLevel::AVX512:
+      return "avx512";
+    case SimdLevel::NEON:
+      return "neon";
+    default:
+      return "unknown";
+  }
+}
+
+// Like RegressionArgs, but also reports items processed, and picks the SIMD
+// level from the third benchmark argument.
+struct DispatchLevelArgs {
+  // size of each input array, in bytes
+  const int64_t size;
+
+  // number of values in each input array
+  int64_t length;
+
+  // proportion of nulls in generated arrays
+  double null_proportion;
+
+  const SimdLevel::type simd_level;
+
+  DispatchLevelArgs(benchmark::State& state, int64_t byte_width, int num_inputs)
+      : size(state.range(0)),
+        simd_level(static_cast<SimdLevel::type>(state.range(2))),
+        state_(state),
+        num_inputs_(num_inputs) {
+    length = size / byte_width;
+    if (state.range(1) == 0) {
+      null_proportion = 0.0;
+    } else {
+      null_proportion = std::min(1., 1. / static_cast<double>(state.range(1)));
+    }
+    state.SetLabel(SimdLevelName(simd_level));
+  }
+
+  ~DispatchLevelArgs() {
+    state_.counters["size"] = static_cast<double>(size);
+    state_.counters["null_percent"] = null_proportion * 100;
+    state_.counters["simd_level"] = static_cast<double>(simd_level);
+    state_.SetBytesProcessed(state_.iterations() * size * num_inputs_);
+    state_.SetItemsProcessed(state_.iterations() * length);
+  }
+
+ private:
+  benchmark::State& state_;
+  const int num_inputs_;
+};
+
+static void DispatchLevelSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond);
+  bench->ArgNames({"size", "inverse_null_proportion", "simd_level"});
+  for (const auto size : {kL1Size, kL2Size, kL3Size}) {
+    for (const auto inverse_null_proportion : kInverseNullProportions) {
+      for (const auto level : kSimdLevels) {
+        bench->Args({static_cast<ArgsType>(size), inverse_null_proportion, level});
+      }
+    }
+  }
+}
+
+template <typename ArrowType>
+static void UnaryKernel(benchmark::State& state, const std::string& func_name,
+                        const FunctionOptions* options = nullptr) {
+  auto type = TypeTraits<ArrowType>::type_singleton();
+  DispatchLevelArgs args(state, sizeof(typename ArrowType::c_type), /*num_inputs=*/1);
+  ScopedSimdLevel scoped_level(args.simd_level);
+  if (!scoped_level.supported()) {
+    state.SkipWithError("SIMD level not supported by this CPU");
+    return;
+  }
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.ArrayOf(type, args.length, args.null_proportion);
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {array}, options).status());
+  }
+}
+
+template <typename ArrowType>
+static void BinaryKernel(benchmark::State& state, const std::string& func_name,
+                         const FunctionOptions* options = nullptr) {
+  auto type = TypeTraits<ArrowType>::type_singleton();
+  DispatchLevelArgs args(state, sizeof(typename ArrowType::c_type), /*num_inputs=*/2);
+  ScopedSimdLevel scoped_level(args.simd_level);
+  if (!scoped_level.supported()) {
+    state.SkipWithError("SIMD level not supported by this CPU");
+    return;
+  }
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::shared_ptr<Array> lhs, rhs;
+  if (is_integer(type->id())) {
+    // Keep values small so that checked arithmetic doesn't overflow
+    lhs = *Cast(*rand.Int8(args.length, 0, 100, args.null_proportion), type);
+    rhs = *Cast(*rand.Int8(args.length, 0, 100, args.null_proportion), type);
+  } else {
+    lhs = rand.ArrayOf(type, args.length, args.null_proportion);
+    rhs = rand.ArrayOf(type, args.length, args.null_proportion);
+  }
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {lhs, rhs}, options).status());
+  }
+}
+
+// ----------------------------------------------------------------------
+// Aggregates
+
+template <typename ArrowType>
+static void DispatchSum(benchmark::State& state) {
+  UnaryKernel<ArrowType>(state, "sum");
+}
+
+template <typename ArrowType>
+static void DispatchMean(benchmark::State& state) {
+  UnaryKernel<ArrowType>(state, "mean");
+}
+
+template <typename ArrowType>
+static void DispatchMinMax(benchmark::State& state) {
+  UnaryKernel<ArrowType>(state, "min_max");
+}
+
+BENCHMARK_TEMPLATE(DispatchSum, Int32Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchSum, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchSum, FloatType)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchSum, DoubleType)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMean, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMean, DoubleType)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMinMax, Int32Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMinMax, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMinMax, FloatType)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMinMax, DoubleType)->Apply(DispatchLevelSetArgs);
+
+// ----------------------------------------------------------------------
+// Scalar kernels
+
+template <typename ArrowType>
+static void DispatchAddChecked(benchmark::State& state) {
+  BinaryKernel<ArrowType>(state, "add_checked");
+}
+
+template <typename ArrowType>
+static void DispatchMultiplyChecked(benchmark::State& state) {
+  BinaryKernel<ArrowType>(state, "multiply_checked");
+}
+
+template <typename ArrowType>
+static void DispatchGreater(benchmark::State& state) {
+  BinaryKernel<ArrowType>(state, "greater");
+}
+
+BENCHMARK_TEMPLATE(DispatchAddChecked, Int32Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchAddChecked, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMultiplyChecked, Int32Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchMultiplyChecked, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchGreater, Int32Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchGreater, Int64Type)->Apply(DispatchLevelSetArgs);
+BENCHMARK_TEMPLATE(DispatchGreater, DoubleType)->Apply(DispatchLevelSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,10 +17,16 @@
 
 #include "arrow/compute/api_aggregate.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer_builder.h"
@@ -29,11 +35,18 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/hash_aggregate_internal.h"
+#include "arrow/compute/row_encoder.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/tdigest.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -45,395 +58,377 @@ namespace compute {
 namespace internal {
 namespace {
 
-struct KeyEncoder {
-  // the first byte of an encoded key is used to indicate nullity
-  static constexpr bool kExtraByteForNull = true;
+// Builds the output of Grouper::Lookup(): group ids, null where no group matched
+class GroupIdsBuilder {
+ public:
+  GroupIdsBuilder(int64_t length, MemoryPool* pool) : length_(length), pool_(pool) {}
 
-  static constexpr uint8_t kNullByte = 1;
-  static constexpr uint8_t kValidByte = 0;
-
-  virtual ~KeyEncoder() = default;
-
-  virtual void AddLength(const ArrayData&, int32_t* lengths) = 0;
-
-  virtual Status Encode(const ArrayData&, uint8_t** encoded_bytes) = 0;
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(ids_, AllocateBuffer(length_ * sizeof(uint32_t), pool_));
+    std::memset(ids_->mutable_data(), 0, ids_->size());
+    ARROW_ASSIGN_OR_RAISE(validity_, AllocateEmptyBitmap(length_, pool_));
+    return Status::OK();
+  }
 
-  virtual Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes,
-                                                    int32_t length, MemoryPool*) = 0;
+  void Set(int64_t i, uint32_t group_id) {
+    reinterpret_cast<uint32_t*>(ids_->mutable_data())[i] = group_id;
+    BitUtil::SetBit(validity_->mutable_data(), i);
+    ++num_found_;
+  }
 
-  // extract the null bitmap from the leading nullity bytes of encoded keys
-  static Status DecodeNulls(MemoryPool* pool, int32_t length, uint8_t** encoded_bytes,
-                            std::shared_ptr<Buffer>* null_bitmap, int32_t* null_count) {
-    // first count nulls to determine if a null bitmap is necessary
-    *null_count = 0;
-    for (int32_t i = 0; i < length; ++i) {
-      *null_count += (encoded_bytes[i][0] == kNullByte);
+  Datum Finish() {
+    if (num_found_ == length_) {
+      validity_ = nullptr;
     }
+    return ArrayData::Make(uint32(), length_, {std::move(validity_), std::move(ids_)},
+                           length_ - num_found_);
+  }
 
-    if (*null_count > 0) {
-      ARROW_ASSIGN_OR_RAISE(*null_bitmap, AllocateBitmap(length, pool));
-      uint8_t* validity = (*null_bitmap)->mutable_data();
+ private:
+  int64_t length_;
+  MemoryPool* pool_;
+  int64_t num_found_ = 0;
+  std::shared_ptr<Buffer> ids_, validity_;
+};
 
-      FirstTimeBitmapWriter writer(validity, 0, length);
-      for (int32_t i = 0; i < length; ++i) {
-        if (encoded_bytes[i][0] == kValidByte) {
-          writer.Set();
-        } else {
-          writer.Clear();
-        }
-        writer.Next();
-        encoded_bytes[i] += 1;
-      }
-      writer.Finish();
-    } else {
-      for (int32_t i = 0; i < length; ++i) {
-        encoded_bytes[i] += 1;
-      }
-    }
-    return Status ::OK();
+struct GrouperImpl : Grouper {
+  static Result<std::unique_ptr<GrouperImpl>> Make(const std::vector<ValueDescr>& keys,
+                                                   ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<GrouperImpl>();
+    impl->ctx_ = ctx;
+    RETURN_NOT_OK(impl->encoder_.Init(keys, ctx));
+    return std::move(impl);
   }
-};
 
-struct BooleanKeyEncoder : KeyEncoder {
-  static constexpr int kByteWidth = 1;
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    encoder_.Clear();
+    RETURN_NOT_OK(encoder_.EncodeAndAppend(batch));
 
-  void AddLength(const ArrayData& data, int32_t* lengths) override {
-    for (int64_t i = 0; i < data.length; ++i) {
-      lengths[i] += kByteWidth + kExtraByteForNull;
-    }
-  }
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
 
-  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
-    VisitArrayDataInline<BooleanType>(
-        data,
-        [&](bool value) {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kValidByte;
-          *encoded_ptr++ = value;
-        },
-        [&] {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kNullByte;
-          *encoded_ptr++ = 0;
-        });
-    return Status::OK();
-  }
+    for (int32_t i = 0; i < encoder_.num_rows(); ++i) {
+      const util::string_view key_view = encoder_.encoded_row(i);
+      std::string key(key_view.data(), key_view.size());
+      const auto key_length = static_cast<int32_t>(key.size());
 
-  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
-                                            MemoryPool* pool) override {
-    std::shared_ptr<Buffer> null_buf;
-    int32_t null_count;
-    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+      auto it_success = map_.emplace(key, num_groups_);
+      auto group_id = it_success.first->second;
 
-    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+      if (it_success.second) {
+        // new key; update offsets and key_bytes
+        ++num_groups_;
+        auto next_key_offset = static_cast<int32_t>(key_bytes_.size());
+        key_bytes_.resize(next_key_offset + key_length);
+        offsets_.push_back(next_key_offset + key_length);
+        memcpy(key_bytes_.data() + next_key_offset, key.c_str(), key_length);
+      }
 
-    uint8_t* raw_output = key_buf->mutable_data();
-    for (int32_t i = 0; i < length; ++i) {
-      auto& encoded_ptr = encoded_bytes[i];
-      BitUtil::SetBitTo(raw_output, i, encoded_ptr[0] != 0);
-      encoded_ptr += 1;
+      group_ids_batch.UnsafeAppend(group_id);
     }
 
-    return ArrayData::Make(boolean(), length, {std::move(null_buf), std::move(key_buf)},
-                           null_count);
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
-};
 
-struct FixedWidthKeyEncoder : KeyEncoder {
-  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
-      : type_(std::move(type)),
-        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
-
-  void AddLength(const ArrayData& data, int32_t* lengths) override {
-    for (int64_t i = 0; i < data.length; ++i) {
-      lengths[i] += byte_width_ + kExtraByteForNull;
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    // Encode into a local row buffer, as lookups may run concurrently
+    RowEncoder encoder = encoder_.CloneEmpty();
+    RETURN_NOT_OK(encoder.EncodeAndAppend(batch));
+
+    GroupIdsBuilder group_ids(batch.length, ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Init());
+    std::string key;
+    for (int32_t i = 0; i < encoder.num_rows(); ++i) {
+      const util::string_view key_view = encoder.encoded_row(i);
+      key.assign(key_view.data(), key_view.size());
+      auto it = map_.find(key);
+      if (it != map_.end()) {
+        group_ids.Set(i, it->second);
+      }
     }
+    return group_ids.Finish();
   }
 
-  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
-    ArrayData viewed(fixed_size_binary(byte_width_), data.length, data.buffers,
-                     data.null_count, data.offset);
-
-    VisitArrayDataInline<FixedSizeBinaryType>(
-        viewed,
-        [&](util::string_view bytes) {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kValidByte;
-          memcpy(encoded_ptr, bytes.data(), byte_width_);
-          encoded_ptr += byte_width_;
-        },
-        [&] {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kNullByte;
-          memset(encoded_ptr, 0, byte_width_);
-          encoded_ptr += byte_width_;
-        });
-    return Status::OK();
-  }
-
-  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
-                                            MemoryPool* pool) override {
-    std::shared_ptr<Buffer> null_buf;
-    int32_t null_count;
-    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
-
-    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+  uint32_t num_groups() const override { return num_groups_; }
 
-    uint8_t* raw_output = key_buf->mutable_data();
-    for (int32_t i = 0; i < length; ++i) {
-      auto& encoded_ptr = encoded_bytes[i];
-      std::memcpy(raw_output, encoded_ptr, byte_width_);
-      encoded_ptr += byte_width_;
-      raw_output += byte_width_;
+  Result<ExecBatch> GetUniques() override {
+    std::vector<uint8_t*> key_buf_ptrs(num_groups_);
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      key_buf_ptrs[i] = key_bytes_.data() + offsets_[i];
     }
-
-    return ArrayData::Make(type_, length, {std::move(null_buf), std::move(key_buf)},
-                           null_count);
+    return encoder_.DecodeRows(num_groups_, key_buf_ptrs.data());
   }
 
-  std::shared_ptr<DataType> type_;
-  int byte_width_;
+  ExecContext* ctx_;
+  std::unordered_map<std::string, uint32_t> map_;
+  std::vector<int32_t> offsets_ = {0};
+  std::vector<uint8_t> key_bytes_;
+  uint32_t num_groups_ = 0;
+  // Encodes the keys of each consumed batch
+  RowEncoder encoder_;
 };
 
-struct DictionaryKeyEncoder : FixedWidthKeyEncoder {
-  DictionaryKeyEncoder(std::shared_ptr<DataType> type, MemoryPool* pool)
-      : FixedWidthKeyEncoder(std::move(type)), pool_(pool) {}
-
-  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
-    auto dict = MakeArray(data.dictionary);
-    if (dictionary_) {
-      if (!dictionary_->Equals(dict)) {
-        // TODO(bkietz) unify if necessary. For now, just error if any batch's dictionary
-        // differs from the first we saw for this key
-        return Status::NotImplemented("Unifying differing dictionaries");
-      }
-    } else {
-      dictionary_ = std::move(dict);
+/// Grouper specialized for keys which are all fixed width.
+///
+/// Every key row has the same encoded length, so rows are packed back to back into a
+/// single arena and a group id is enough to locate the row of a group. Group ids are
+/// looked up in an open addressing hash table whose hashes are computed one key column
+/// at a time, which is considerably cheaper than GrouperImpl's per-row std::string
+/// construction once the number of groups grows large.
+struct GrouperFastImpl : Grouper {
+  using hash_t = ::arrow::internal::hash_t;
+
+  // A null hash must be distinguishable from the hash of a zeroed value
+  static constexpr hash_t kNullHash = 0x9E3779B97F4A7C15ULL;
+
+  static bool CanUse(const std::vector<ValueDescr>& keys) {
+    if (keys.empty()) return false;
+    for (const auto& key : keys) {
+      if (key.type->id() == Type::DICTIONARY) return false;
+      if (key.type->id() != Type::BOOL && !is_fixed_width(key.type->id())) return false;
     }
-    return FixedWidthKeyEncoder::Encode(data, encoded_bytes);
+    return true;
   }
 
-  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
-                                            MemoryPool* pool) override {
-    ARROW_ASSIGN_OR_RAISE(auto data,
-                          FixedWidthKeyEncoder::Decode(encoded_bytes, length, pool));
+  static Result<std::unique_ptr<GrouperFastImpl>> Make(
+      const std::vector<ValueDescr>& keys, ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<GrouperFastImpl>(ctx);
 
-    if (dictionary_) {
-      data->dictionary = dictionary_->data();
-    } else {
-      ARROW_ASSIGN_OR_RAISE(auto dict, MakeArrayOfNull(type_, 0));
-      data->dictionary = dict->data();
+    for (const auto& key : keys) {
+      int byte_width = 1;
+      if (key.type->id() != Type::BOOL) {
+        byte_width = checked_cast<const FixedWidthType&>(*key.type).bit_width() / 8;
+      }
+      impl->key_types_.push_back(key.type);
+      impl->byte_widths_.push_back(byte_width);
+      impl->column_offsets_.push_back(impl->row_width_);
+      // each column is prefixed by a byte indicating nullity
+      impl->row_width_ += 1 + byte_width;
     }
 
-    data->type = type_;
-    return data;
+    return std::move(impl);
   }
 
-  MemoryPool* pool_;
-  std::shared_ptr<Array> dictionary_;
-};
-
-template <typename T>
-struct VarLengthKeyEncoder : KeyEncoder {
-  using Offset = typename T::offset_type;
+  explicit GrouperFastImpl(ExecContext* ctx)
+      : ctx_(ctx), map_(ctx->memory_pool(), /*capacity=*/0) {}
 
-  void AddLength(const ArrayData& data, int32_t* lengths) override {
-    int64_t i = 0;
-    VisitArrayDataInline<T>(
-        data,
-        [&](util::string_view bytes) {
-          lengths[i++] +=
-              kExtraByteForNull + sizeof(Offset) + static_cast<int32_t>(bytes.size());
-        },
-        [&] { lengths[i++] += kExtraByteForNull + sizeof(Offset); });
-  }
-
-  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
-    VisitArrayDataInline<T>(
-        data,
-        [&](util::string_view bytes) {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kValidByte;
-          util::SafeStore(encoded_ptr, static_cast<Offset>(bytes.size()));
-          encoded_ptr += sizeof(Offset);
-          memcpy(encoded_ptr, bytes.data(), bytes.size());
-          encoded_ptr += bytes.size();
-        },
-        [&] {
-          auto& encoded_ptr = *encoded_bytes++;
-          *encoded_ptr++ = kNullByte;
-          util::SafeStore(encoded_ptr, static_cast<Offset>(0));
-          encoded_ptr += sizeof(Offset);
-        });
-    return Status::OK();
-  }
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    const int64_t length = batch.length;
 
-  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
-                                            MemoryPool* pool) override {
-    std::shared_ptr<Buffer> null_buf;
-    int32_t null_count;
-    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+    batch_rows_.assign(static_cast<size_t>(length * row_width_), 0);
+    batch_hashes_.assign(static_cast<size_t>(length), 0);
 
-    Offset length_sum = 0;
-    for (int32_t i = 0; i < length; ++i) {
-      length_sum += util::SafeLoadAs<Offset>(encoded_bytes[i]);
+    for (int i = 0; i < batch.num_values(); ++i) {
+      EncodeColumn(*batch[i].array(), i, batch_rows_.data(), batch_hashes_.data());
     }
 
-    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
-                          AllocateBuffer(sizeof(Offset) * (1 + length), pool));
-    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length_sum));
-
-    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
-    auto raw_keys = key_buf->mutable_data();
-
-    Offset current_offset = 0;
-    for (int32_t i = 0; i < length; ++i) {
-      raw_offsets[i] = current_offset;
-
-      auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
-      encoded_bytes[i] += sizeof(Offset);
-
-      memcpy(raw_keys + current_offset, encoded_bytes[i], key_length);
-      encoded_bytes[i] += key_length;
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(length));
+
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* row = batch_rows_.data() + i * row_width_;
+
+      auto p = map_.Lookup(batch_hashes_[i], [&](const uint32_t* group_id) {
+        return std::memcmp(GroupRow(*group_id), row, row_width_) == 0;
+      });
+
+      uint32_t group_id;
+      if (p.second) {
+        group_id = p.first->payload;
+      } else {
+        // new key; append its row to the arena
+        group_id = num_groups_++;
+        RETURN_NOT_OK(map_.Insert(p.first, batch_hashes_[i], group_id));
+        rows_.insert(rows_.end(), row, row + row_width_);
+      }
 
-      current_offset += key_length;
+      group_ids_batch.UnsafeAppend(group_id);
     }
-    raw_offsets[length] = current_offset;
 
-    return ArrayData::Make(
-        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
-        null_count);
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    return Datum(UInt32Array(length, std::move(group_ids)));
   }
 
-  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
-
-  std::shared_ptr<DataType> type_;
-};
-
-struct GrouperImpl : Grouper {
-  static Result<std::unique_ptr<GrouperImpl>> Make(const std::vector<ValueDescr>& keys,
-                                                   ExecContext* ctx) {
-    auto impl = ::arrow::internal::make_unique<GrouperImpl>();
-
-    impl->encoders_.resize(keys.size());
-    impl->ctx_ = ctx;
-
-    for (size_t i = 0; i < keys.size(); ++i) {
-      const auto& key = keys[i].type;
-
-      if (key->id() == Type::BOOL) {
-        impl->encoders_[i] = ::arrow::internal::make_unique<BooleanKeyEncoder>();
-        continue;
-      }
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    const int64_t length = batch.length;
 
-      if (key->id() == Type::DICTIONARY) {
-        impl->encoders_[i] =
-            ::arrow::internal::make_unique<DictionaryKeyEncoder>(key, ctx->memory_pool());
-        continue;
-      }
+    // Local scratch space, as lookups may run concurrently
+    std::vector<uint8_t> rows(static_cast<size_t>(length * row_width_), 0);
+    std::vector<hash_t> hashes(static_cast<size_t>(length), 0);
+    for (int i = 0; i < batch.num_values(); ++i) {
+      EncodeColumn(*batch[i].array(), i, rows.data(), hashes.data());
+    }
 
-      if (is_fixed_width(key->id())) {
-        impl->encoders_[i] = ::arrow::internal::make_unique<FixedWidthKeyEncoder>(key);
-        continue;
+    GroupIdsBuilder group_ids(length, ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids.Init());
+    const auto& map = map_;
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* row = rows.data() + i * row_width_;
+      auto p = map.Lookup(hashes[i], [&](const uint32_t* group_id) {
+        return std::memcmp(GroupRow(*group_id), row, row_width_) == 0;
+      });
+      if (p.second) {
+        group_ids.Set(i, p.first->payload);
       }
+    }
+    return group_ids.Finish();
+  }
 
-      if (is_binary_like(key->id())) {
-        impl->encoders_[i] =
-            ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(key);
-        continue;
-      }
+  uint32_t num_groups() const override { return num_groups_; }
 
-      if (is_large_binary_like(key->id())) {
-        impl->encoders_[i] =
-            ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(key);
-        continue;
-      }
+  Result<ExecBatch> GetUniques() override {
+    ExecBatch out({}, num_groups_);
 
-      return Status::NotImplemented("Keys of type ", *key);
+    out.values.resize(key_types_.size());
+    for (size_t i = 0; i < key_types_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(out.values[i], DecodeColumn(static_cast<int>(i)));
     }
 
-    return std::move(impl);
+    return out;
   }
 
-  Result<Datum> Consume(const ExecBatch& batch) override {
-    std::vector<int32_t> offsets_batch(batch.length + 1);
-    for (int i = 0; i < batch.num_values(); ++i) {
-      encoders_[i]->AddLength(*batch[i].array(), offsets_batch.data());
-    }
+ private:
+  static hash_t CombineHashes(hash_t seed, hash_t h) {
+    return seed ^ (h + 0x9E3779B9ULL + (seed << 6) + (seed >> 2));
+  }
 
-    int32_t total_length = 0;
-    for (int64_t i = 0; i < batch.length; ++i) {
-      auto total_length_before = total_length;
-      total_length += offsets_batch[i];
-      offsets_batch[i] = total_length_before;
+  template <typename UInt>
+  void HashAndCopyColumn(const ArrayData& data, int i, uint8_t* rows,
+                         hash_t* hashes) const {
+    const auto values = data.GetValues<UInt>(1);
+    const uint8_t* validity = data.GetNullCount() > 0 ? data.buffers[0]->data() : nullptr;
+    uint8_t* row = rows + column_offsets_[i];
+
+    for (int64_t j = 0; j < data.length; ++j, row += row_width_) {
+      hash_t h;
+      if (validity && !BitUtil::GetBit(validity, data.offset + j)) {
+        row[0] = RowEncoder::kNullByte;
+        h = kNullHash;
+      } else {
+        util::SafeStore(row + 1, values[j]);
+        h = ::arrow::internal::ScalarHelper<UInt>::ComputeHash(values[j]);
+      }
+      hashes[j] = CombineHashes(hashes[j], h);
     }
-    offsets_batch[batch.length] = total_length;
+  }
 
-    std::vector<uint8_t> key_bytes_batch(total_length);
-    std::vector<uint8_t*> key_buf_ptrs(batch.length);
-    for (int64_t i = 0; i < batch.length; ++i) {
-      key_buf_ptrs[i] = key_bytes_batch.data() + offsets_batch[i];
+  // Encode a key column into `rows` and combine its hashes into `hashes`
+  void EncodeColumn(const ArrayData& data, int i, uint8_t* rows, hash_t* hashes) const {
+    if (key_types_[i]->id() == Type::BOOL) {
+      const uint8_t* validity =
+          data.GetNullCount() > 0 ? data.buffers[0]->data() : nullptr;
+      const uint8_t* bits = data.buffers[1]->data();
+      uint8_t* row = rows + column_offsets_[i];
+
+      for (int64_t j = 0; j < data.length; ++j, row += row_width_) {
+        hash_t h;
+        if (validity && !BitUtil::GetBit(validity, data.offset + j)) {
+          row[0] = RowEncoder::kNullByte;
+          h = kNullHash;
+        } else {
+          row[1] = BitUtil::GetBit(bits, data.offset + j);
+          h = ::arrow::internal::ScalarHelper<uint8_t>::ComputeHash(row[1]);
+        }
+        hashes[j] = CombineHashes(hashes[j], h);
+      }
+      return;
     }
 
-    for (int i = 0; i < batch.num_values(); ++i) {
-      RETURN_NOT_OK(encoders_[i]->Encode(*batch[i].array(), key_buf_ptrs.data()));
+    switch (byte_widths_[i]) {
+      case 1:
+        return HashAndCopyColumn<uint8_t>(data, i, rows, hashes);
+      case 2:
+        return HashAndCopyColumn<uint16_t>(data, i, rows, hashes);
+      case 4:
+        return HashAndCopyColumn<uint32_t>(data, i, rows, hashes);
+      case 8:
+        return HashAndCopyColumn<uint64_t>(data, i, rows, hashes);
+      default:
+        break;
     }
 
-    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
-    RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
-
-    for (int64_t i = 0; i < batch.length; ++i) {
-      int32_t key_length = offsets_batch[i + 1] - offsets_batch[i];
-      std::string key(
-          reinterpret_cast<const char*>(key_bytes_batch.data() + offsets_batch[i]),
-          key_length);
-
-      auto it_success = map_.emplace(key, num_groups_);
-      auto group_id = it_success.first->second;
-
-      if (it_success.second) {
-        // new key; update offsets and key_bytes
-        ++num_groups_;
-        auto next_key_offset = static_cast<int32_t>(key_bytes_.size());
-        key_bytes_.resize(next_key_offset + key_length);
-        offsets_.push_back(next_key_offset + key_length);
-        memcpy(key_bytes_.data() + next_key_offset, key.c_str(), key_length);
+    const int byte_width = byte_widths_[i];
+    const uint8_t* validity = data.GetNullCount() > 0 ? data.buffers[0]->data() : nullptr;
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+    uint8_t* row = rows + column_offsets_[i];
+
+    for (int64_t j = 0; j < data.length; ++j, row += row_width_, values += byte_width) {
+      hash_t h;
+      if (validity && !BitUtil::GetBit(validity, data.offset + j)) {
+        row[0] = RowEncoder::kNullByte;
+        h = kNullHash;
+      } else {
+        std::memcpy(row + 1, values, byte_width);
+        h = ::arrow::internal::ComputeStringHash<0>(values, byte_width);
       }
-
-      group_ids_batch.UnsafeAppend(group_id);
+      hashes[j] = CombineHashes(hashes[j], h);
     }
+  }
 
-    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
-    return Datum(UInt32Array(batch.length, std::move(group_ids)));
+  // The arena row of a group; the offset is computed in 64 bits, as the arena
+  // may outgrow 4 GiB
+  const uint8_t* GroupRow(uint32_t group_id) const {
+    return rows_.data() + static_cast<int64_t>(group_id) * row_width_;
   }
 
-  uint32_t num_groups() const override { return num_groups_; }
+  Result<std::shared_ptr<ArrayData>> DecodeColumn(int i) {
+    MemoryPool* pool = ctx_->memory_pool();
+    const int byte_width = byte_widths_[i];
+    const uint8_t* row = rows_.data() + column_offsets_[i];
 
-  Result<ExecBatch> GetUniques() override {
-    ExecBatch out({}, num_groups_);
+    int64_t null_count = 0;
+    for (int64_t j = 0; j < num_groups_; ++j) {
+      null_count += row[j * row_width_] == RowEncoder::kNullByte;
+    }
 
-    std::vector<uint8_t*> key_buf_ptrs(num_groups_);
-    for (int64_t i = 0; i < num_groups_; ++i) {
-      key_buf_ptrs[i] = key_bytes_.data() + offsets_[i];
+    std::shared_ptr<Buffer> null_buf;
+    if (null_count > 0) {
+      ARROW_ASSIGN_OR_RAISE(null_buf, AllocateBitmap(num_groups_, pool));
+      FirstTimeBitmapWriter writer(null_buf->mutable_data(), 0, num_groups_);
+      for (int64_t j = 0; j < num_groups_; ++j) {
+        if (row[j * row_width_] == RowEncoder::kValidByte) {
+          writer.Set();
+        } else {
+          writer.Clear();
+        }
+        writer.Next();
+      }
+      writer.Finish();
     }
 
-    out.values.resize(encoders_.size());
-    for (size_t i = 0; i < encoders_.size(); ++i) {
+    std::shared_ptr<Buffer> key_buf;
+    if (key_types_[i]->id() == Type::BOOL) {
+      ARROW_ASSIGN_OR_RAISE(key_buf, AllocateBitmap(num_groups_, pool));
+      uint8_t* raw_output = key_buf->mutable_data();
+      for (int64_t j = 0; j < num_groups_; ++j) {
+        BitUtil::SetBitTo(raw_output, j, row[j * row_width_ + 1] != 0);
+      }
+    } else {
       ARROW_ASSIGN_OR_RAISE(
-          out.values[i],
-          encoders_[i]->Decode(key_buf_ptrs.data(), static_cast<int32_t>(num_groups_),
-                               ctx_->memory_pool()));
+          key_buf, AllocateBuffer(static_cast<int64_t>(num_groups_) * byte_width, pool));
+      uint8_t* raw_output = key_buf->mutable_data();
+      for (int64_t j = 0; j < num_groups_; ++j) {
+        std::memcpy(raw_output + j * byte_width, row + j * row_width_ + 1, byte_width);
+      }
     }
 
-    return out;
+    return ArrayData::Make(key_types_[i], num_groups_,
+                           {std::move(null_buf), std::move(key_buf)}, null_count);
   }
 
   ExecContext* ctx_;
-  std::unordered_map<std::string, uint32_t> map_;
-  std::vector<int32_t> offsets_ = {0};
-  std::vector<uint8_t> key_bytes_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<int> byte_widths_, column_offsets_;
+  int row_width_ = 0;
+
+  ::arrow::internal::HashTable<uint32_t> map_;
+  std::vector<uint8_t> rows_;
   uint32_t num_groups_ = 0;
-  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+
+  // scratch space reused across calls to Consume()
+  std::vector<uint8_t> batch_rows_;
+  std::vector<hash_t> batch_hashes_;
 };
 
 /// C++ abstract base class for the HashAggregateKernel interface.
@@ -445,16 +440,37 @@ struct GroupedAggregator : KernelState {
 
   virtual Status Consume(const ExecBatch& batch) = 0;
 
+  /// Accumulate the state of another aggregator of the same kind into this one.
+  /// group_id_mapping is a uint32 array mapping each of other's group ids to
+  /// the corresponding group id of this aggregator.
+  virtual Status Merge(GroupedAggregator&& other, const ArrayData& group_id_mapping) = 0;
+
   virtual Result<Datum> Finalize() = 0;
 
-  template <typename Reserve>
-  Status MaybeReserve(int64_t old_num_groups, const ExecBatch& batch,
-                      const Reserve& reserve) {
-    int64_t new_num_groups = batch[2].scalar_as<UInt32Scalar>().value;
-    if (new_num_groups <= old_num_groups) {
+  /// Grow the state to accommodate added_groups new groups
+  virtual Status Reserve(int64_t added_groups) = 0;
+
+  virtual int64_t num_groups() const = 0;
+
+  Status MaybeReserve(int64_t new_num_groups) {
+    if (new_num_groups <= num_groups()) {
       return Status::OK();
     }
-    return reserve(new_num_groups - old_num_groups);
+    return Reserve(new_num_groups - num_groups());
+  }
+
+  Status MaybeReserve(const ExecBatch& batch) {
+    return MaybeReserve(batch[2].scalar_as<UInt32Scalar>().value);
+  }
+
+  /// Grow the state to accommodate every group referenced by group_id_mapping
+  Status MaybeReserve(const ArrayData& group_id_mapping) {
+    auto mapping = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t new_num_groups = num_groups();
+    for (int64_t i = 0; i < group_id_mapping.length; ++i) {
+      new_num_groups = std::max<int64_t>(new_num_groups, mapping[i] + 1);
+    }
+    return MaybeReserve(new_num_groups);
   }
 
   virtual std::shared_ptr<DataType> out_type() const = 0;
@@ -471,11 +487,15 @@ struct GroupedCountImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    return counts_.Append(added_groups * sizeof(int64_t), 0);
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(counts_.length(), batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      return counts_.Append(added_groups * sizeof(int64_t), 0);
-    }));
+    RETURN_NOT_OK(MaybeReserve(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     auto raw_counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
@@ -483,6 +503,9 @@ struct GroupedCountImpl : public GroupedAggregator {
     const auto& input = batch[0].array();
 
     if (options_.count_mode == CountOptions::COUNT_NULL) {
+      if (!input->MayHaveNulls()) {
+        return Status::OK();
+      }
       for (int64_t i = 0, input_i = input->offset; i < input->length; ++i, ++input_i) {
         auto g = group_ids[i];
         raw_counts[g] += !BitUtil::GetBit(input->buffers[0]->data(), input_i);
@@ -490,11 +513,11 @@ struct GroupedCountImpl : public GroupedAggregator {
       return Status::OK();
     }
 
+    // Run positions are relative to input->offset
     arrow::internal::VisitSetBitRunsVoid(
         input->buffers[0], input->offset, input->length,
         [&](int64_t begin, int64_t length) {
-          for (int64_t input_i = begin, i = begin - input->offset;
-               input_i < begin + length; ++input_i, ++i) {
+          for (int64_t i = begin; i < begin + length; ++i) {
             auto g = group_ids[i];
             raw_counts[g] += 1;
           }
@@ -502,6 +525,20 @@ struct GroupedCountImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    auto raw_counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
+    auto other_counts = reinterpret_cast<const int64_t*>(other->counts_.data());
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      raw_counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
   Result<Datum> Finalize() override {
     ARROW_ASSIGN_OR_RAISE(auto counts, counts_.Finish());
     return std::make_shared<Int64Array>(num_groups_, std::move(counts));
@@ -572,13 +609,17 @@ struct GroupedSumImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    RETURN_NOT_OK(sums_.Append(added_groups * kSumSize, 0));
+    RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(num_groups_, batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      RETURN_NOT_OK(sums_.Append(added_groups * kSumSize, 0));
-      RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
-      return Status::OK();
-    }));
+    RETURN_NOT_OK(MaybeReserve(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     consume_impl_(batch[0].array(), group_ids, sums_.mutable_data(),
@@ -586,6 +627,38 @@ struct GroupedSumImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  template <typename AccType>
+  static void MergeSums(const uint32_t* g, int64_t length, const uint8_t* other_sums,
+                        uint8_t* sums) {
+    auto raw_sums = reinterpret_cast<AccType*>(sums);
+    auto raw_other_sums = reinterpret_cast<const AccType*>(other_sums);
+    for (int64_t other_g = 0; other_g < length; ++other_g) {
+      raw_sums[g[other_g]] += raw_other_sums[other_g];
+    }
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    const int64_t length = group_id_mapping.length;
+    switch (out_type_->id()) {
+      case Type::DOUBLE:
+        MergeSums<double>(g, length, other->sums_.data(), sums_.mutable_data());
+        break;
+      case Type::INT64:
+        MergeSums<int64_t>(g, length, other->sums_.data(), sums_.mutable_data());
+        break;
+      default:
+        MergeSums<uint64_t>(g, length, other->sums_.data(), sums_.mutable_data());
+        break;
+    }
+    MergeSums<int64_t>(g, length, other->counts_.data(), counts_.mutable_data());
+    return Status::OK();
+  }
+
   Result<Datum> Finalize() override {
     std::shared_ptr<Buffer> null_bitmap;
     int64_t null_count = 0;
@@ -642,6 +715,9 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
       std::function<void(const std::shared_ptr<ArrayData>&, const uint32_t*, void*, void*,
                          uint8_t*, uint8_t*)>;
 
+  using MergeImpl =
+      std::function<void(const ArrayData&, const void*, const void*, void*, void*)>;
+
   using ResizeImpl = std::function<Status(BufferBuilder*, int64_t)>;
 
   template <typename CType>
@@ -674,6 +750,21 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
             [&] { BitUtil::SetBit(has_nulls, *group++); });
       };
 
+      merge_impl = [](const ArrayData& group_id_mapping, const void* other_mins,
+                      const void* other_maxes, void* mins, void* maxes) {
+        auto g = group_id_mapping.GetValues<uint32_t>(1);
+        auto raw_other_mins = reinterpret_cast<const CType*>(other_mins);
+        auto raw_other_maxes = reinterpret_cast<const CType*>(other_maxes);
+        auto raw_mins = reinterpret_cast<CType*>(mins);
+        auto raw_maxes = reinterpret_cast<CType*>(maxes);
+
+        for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+          raw_mins[g[other_g]] = std::min(raw_mins[g[other_g]], raw_other_mins[other_g]);
+          raw_maxes[g[other_g]] =
+              std::max(raw_maxes[g[other_g]], raw_other_maxes[other_g]);
+        }
+      };
+
       resize_min_impl = MakeResizeImpl(Extrema<CType>::max());
       resize_max_impl = MakeResizeImpl(Extrema<CType>::min());
       return Status::OK();
@@ -692,6 +783,7 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     }
 
     ConsumeImpl consume_impl;
+    MergeImpl merge_impl;
     ResizeImpl resize_min_impl, resize_max_impl;
   };
 
@@ -702,29 +794,33 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
 
     mins_ = BufferBuilder(ctx->memory_pool());
     maxes_ = BufferBuilder(ctx->memory_pool());
-    has_values_ = BufferBuilder(ctx->memory_pool());
-    has_nulls_ = BufferBuilder(ctx->memory_pool());
+    has_values_ = TypedBufferBuilder<bool>(ctx->memory_pool());
+    has_nulls_ = TypedBufferBuilder<bool>(ctx->memory_pool());
 
     GetImpl get_impl;
     RETURN_NOT_OK(VisitTypeInline(*input_type, &get_impl));
 
     consume_impl_ = std::move(get_impl.consume_impl);
+    merge_impl_ = std::move(get_impl.merge_impl);
     resize_min_impl_ = std::move(get_impl.resize_min_impl);
     resize_max_impl_ = std::move(get_impl.resize_max_impl);
-    resize_bitmap_impl_ = MakeResizeImpl(false);
 
     return Status::OK();
   }
 
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    RETURN_NOT_OK(resize_min_impl_(&mins_, added_groups));
+    RETURN_NOT_OK(resize_max_impl_(&maxes_, added_groups));
+    RETURN_NOT_OK(has_values_.Append(added_groups, false));
+    RETURN_NOT_OK(has_nulls_.Append(added_groups, false));
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
   Status Consume(const ExecBatch& batch) override {
-    RETURN_NOT_OK(MaybeReserve(num_groups_, batch, [&](int64_t added_groups) {
-      num_groups_ += added_groups;
-      RETURN_NOT_OK(resize_min_impl_(&mins_, added_groups));
-      RETURN_NOT_OK(resize_max_impl_(&maxes_, added_groups));
-      RETURN_NOT_OK(resize_bitmap_impl_(&has_values_, added_groups));
-      RETURN_NOT_OK(resize_bitmap_impl_(&has_nulls_, added_groups));
-      return Status::OK();
-    }));
+    RETURN_NOT_OK(MaybeReserve(batch));
 
     auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
     consume_impl_(batch[0].array(), group_ids, mins_.mutable_data(),
@@ -733,6 +829,26 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     return Status::OK();
   }
 
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+
+    merge_impl_(group_id_mapping, other->mins_.data(), other->maxes_.data(),
+                mins_.mutable_data(), maxes_.mutable_data());
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      if (BitUtil::GetBit(other->has_values_.data(), other_g)) {
+        BitUtil::SetBit(has_values_.mutable_data(), g[other_g]);
+      }
+      if (BitUtil::GetBit(other->has_nulls_.data(), other_g)) {
+        BitUtil::SetBit(has_nulls_.mutable_data(), g[other_g]);
+      }
+    }
+    return Status::OK();
+  }
+
   Result<Datum> Finalize() override {
     // aggregation for group is valid if there was at least one value in that group
     ARROW_ASSIGN_OR_RAISE(auto null_bitmap, has_values_.Finish());
@@ -757,43 +873,892 @@ struct GroupedMinMaxImpl : public GroupedAggregator {
     return struct_({field("min", type_), field("max", type_)});
   }
 
-  int64_t num_groups_;
-  BufferBuilder mins_, maxes_, has_values_, has_nulls_;
+  int64_t num_groups_ = 0;
+  BufferBuilder mins_, maxes_;
+  TypedBufferBuilder<bool> has_values_, has_nulls_;
   std::shared_ptr<DataType> type_;
   ConsumeImpl consume_impl_;
-  ResizeImpl resize_min_impl_, resize_max_impl_, resize_bitmap_impl_;
+  MergeImpl merge_impl_;
+  ResizeImpl resize_min_impl_, resize_max_impl_;
   MinMaxOptions options_;
 };
 
-template <typename Impl>
-HashAggregateKernel MakeKernel(InputType argument_type) {
-  HashAggregateKernel kernel;
+// ----------------------------------------------------------------------
+// Mean implementation
 
-  kernel.init = [](KernelContext* ctx,
-                   const KernelInitArgs& args) -> std::unique_ptr<KernelState> {
-    auto impl = ::arrow::internal::make_unique<Impl>();
-    // FIXME(bkietz) Init should not take a type. That should be an unboxed template arg
-    // for the Impl. Otherwise we're not exposing dispatch as well as we should.
-    ctx->SetStatus(impl->Init(ctx->exec_context(), args.options, args.inputs[0].type));
-    if (ctx->HasError()) return nullptr;
-    return std::move(impl);
-  };
+struct GroupedMeanImpl : public GroupedSumImpl {
+  Result<Datum> Finalize() override {
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
 
-  kernel.signature = KernelSignature::Make(
-      {std::move(argument_type), InputType::Array(Type::UINT32),
-       InputType::Scalar(Type::UINT32)},
-      OutputType(
-          [](KernelContext* ctx, const std::vector<ValueDescr>&) -> Result<ValueDescr> {
-            return checked_cast<GroupedAggregator*>(ctx->state())->out_type();
+    ARROW_ASSIGN_OR_RAISE(auto means,
+                          AllocateBuffer(num_groups_ * sizeof(double), pool_));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    auto raw_counts = reinterpret_cast<const int64_t*>(counts_.data());
+
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (raw_counts[i] > 0) {
+        raw_means[i] = SumAsDouble(i) / static_cast<double>(raw_counts[i]);
+        continue;
+      }
+      raw_means[i] = 0;
+
+      if (null_bitmap == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups_, pool_));
+        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups_, true);
+      }
+
+      null_count += 1;
+      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    }
+
+    return ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(means)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+  // sums are accumulated as double, int64_t, or uint64_t depending on the input type
+  double SumAsDouble(int64_t i) const {
+    switch (out_type_->id()) {
+      case Type::DOUBLE:
+        return reinterpret_cast<const double*>(sums_.data())[i];
+      case Type::INT64:
+        return static_cast<double>(reinterpret_cast<const int64_t*>(sums_.data())[i]);
+      default:
+        return static_cast<double>(reinterpret_cast<const uint64_t*>(sums_.data())[i]);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------
+// Variance/Stddev implementation
+
+enum class VarOrStd : bool { Var, Std };
+
+struct GroupedVarStdImpl : public GroupedAggregator {
+  using ConsumeImpl = std::function<void(const std::shared_ptr<ArrayData>&,
+                                         const uint32_t*, int64_t*, double*, double*)>;
+
+  struct GetConsumeImpl {
+    template <typename T, typename CType = typename TypeTraits<T>::CType>
+    enable_if_number<T, Status> Visit(const T&) {
+      // Welford's online algorithm, so that each batch is visited only once
+      consume_impl = [](const std::shared_ptr<ArrayData>& input, const uint32_t* group,
+                        int64_t* counts, double* means, double* m2s) {
+        VisitArrayDataInline<T>(
+            *input,
+            [&](CType value) {
+              const auto g = *group++;
+              const double v = static_cast<double>(value);
+              const double delta = v - means[g];
+              counts[g] += 1;
+              means[g] += delta / counts[g];
+              m2s[g] += delta * (v - means[g]);
+            },
+            [&] { ++group; });
+      };
+      return Status::OK();
+    }
+
+    Status Visit(const HalfFloatType& type) {
+      return Status::NotImplemented("Computing variance/stddev of data of type ", type);
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::NotImplemented("Computing variance/stddev of data of type ", type);
+    }
+
+    ConsumeImpl consume_impl;
+  };
+
+  explicit GroupedVarStdImpl(VarOrStd return_type) : return_type_(return_type) {}
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const VarianceOptions*>(options);
+    pool_ = ctx->memory_pool();
+    counts_ = BufferBuilder(pool_);
+    means_ = BufferBuilder(pool_);
+    m2s_ = BufferBuilder(pool_);
+
+    GetConsumeImpl get_consume_impl;
+    RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
+    consume_impl_ = std::move(get_consume_impl.consume_impl);
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups * sizeof(int64_t), 0));
+    RETURN_NOT_OK(means_.Append(added_groups * sizeof(double), 0));
+    RETURN_NOT_OK(m2s_.Append(added_groups * sizeof(double), 0));
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    consume_impl_(batch[0].array(), group_ids,
+                  reinterpret_cast<int64_t*>(counts_.mutable_data()),
+                  reinterpret_cast<double*>(means_.mutable_data()),
+                  reinterpret_cast<double*>(m2s_.mutable_data()));
+    return Status::OK();
+  }
+
+  // Combine `m2` from two sets of values (m2 = n*s2)
+  // https://www.emathzone.com/tutorials/basic-statistics/combined-variance.html
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedVarStdImpl*>(&raw_other);
+
+    auto counts = reinterpret_cast<int64_t*>(counts_.mutable_data());
+    auto means = reinterpret_cast<double*>(means_.mutable_data());
+    auto m2s = reinterpret_cast<double*>(m2s_.mutable_data());
+
+    auto other_counts = reinterpret_cast<const int64_t*>(other->counts_.data());
+    auto other_means = reinterpret_cast<const double*>(other->means_.data());
+    auto other_m2s = reinterpret_cast<const double*>(other->m2s_.data());
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      if (other_counts[other_g] == 0) continue;
+      const auto i = g[other_g];
+      if (counts[i] == 0) {
+        counts[i] = other_counts[other_g];
+        means[i] = other_means[other_g];
+        m2s[i] = other_m2s[other_g];
+        continue;
+      }
+      const double count = static_cast<double>(counts[i]);
+      const double other_count = static_cast<double>(other_counts[other_g]);
+      const double other_mean = other_means[other_g];
+      const double mean =
+          (means[i] * count + other_mean * other_count) / (count + other_count);
+      m2s[i] += other_m2s[other_g] + count * (means[i] - mean) * (means[i] - mean) +
+                other_count * (other_mean - mean) * (other_mean - mean);
+      counts[i] += other_counts[other_g];
+      means[i] = mean;
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+
+    ARROW_ASSIGN_OR_RAISE(auto values,
+                          AllocateBuffer(num_groups_ * sizeof(double), pool_));
+    auto raw_values = reinterpret_cast<double*>(values->mutable_data());
+    auto raw_counts = reinterpret_cast<const int64_t*>(counts_.data());
+    auto raw_m2s = reinterpret_cast<const double*>(m2s_.data());
+
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (raw_counts[i] > options_.ddof) {
+        const double var = raw_m2s[i] / (raw_counts[i] - options_.ddof);
+        raw_values[i] = return_type_ == VarOrStd::Var ? var : std::sqrt(var);
+        continue;
+      }
+      raw_values[i] = 0;
+
+      if (null_bitmap == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups_, pool_));
+        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups_, true);
+      }
+
+      null_count += 1;
+      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    }
+
+    return ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(values)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+  VarOrStd return_type_;
+  VarianceOptions options_;
+  int64_t num_groups_ = 0;
+  BufferBuilder counts_, means_, m2s_;
+  ConsumeImpl consume_impl_;
+  MemoryPool* pool_;
+};
+
+struct GroupedVarianceImpl : public GroupedVarStdImpl {
+  GroupedVarianceImpl() : GroupedVarStdImpl(VarOrStd::Var) {}
+};
+
+struct GroupedStddevImpl : public GroupedVarStdImpl {
+  GroupedStddevImpl() : GroupedVarStdImpl(VarOrStd::Std) {}
+};
+
+// ----------------------------------------------------------------------
+// TDigest implementation
+
+struct GroupedTDigestImpl : public GroupedAggregator {
+  using TDigest = ::arrow::internal::TDigest;
+  using ConsumeImpl = std::function<void(const std::shared_ptr<ArrayData>&,
+                                         const uint32_t*, std::vector<TDigest>*)>;
+
+  struct GetConsumeImpl {
+    template <typename T, typename CType = typename TypeTraits<T>::CType>
+    enable_if_number<T, Status> Visit(const T&) {
+      consume_impl = [](const std::shared_ptr<ArrayData>& input, const uint32_t* group,
+                        std::vector<TDigest>* tdigests) {
+        VisitArrayDataInline<T>(
+            *input, [&](CType value) { (*tdigests)[*group++].NanAdd(value); },
+            [&] { ++group; });
+      };
+      return Status::OK();
+    }
+
+    Status Visit(const HalfFloatType& type) {
+      return Status::NotImplemented("Computing t-digest of data of type ", type);
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::NotImplemented("Computing t-digest of data of type ", type);
+    }
+
+    ConsumeImpl consume_impl;
+  };
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const TDigestOptions*>(options);
+    pool_ = ctx->memory_pool();
+
+    GetConsumeImpl get_consume_impl;
+    RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
+    consume_impl_ = std::move(get_consume_impl.consume_impl);
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    tdigests_.reserve(num_groups_);
+    for (int64_t i = 0; i < added_groups; ++i) {
+      tdigests_.emplace_back(options_.delta, options_.buffer_size);
+    }
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    consume_impl_(batch[0].array(), group_ids, &tdigests_);
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedTDigestImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    std::vector<TDigest> other_tdigest(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      other_tdigest[0] = std::move(other->tdigests_[other_g]);
+      tdigests_[g[other_g]].Merge(&other_tdigest);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t slot_length = static_cast<int64_t>(options_.q.size());
+
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto values, AllocateBuffer(num_groups_ * slot_length * sizeof(double), pool_));
+    auto raw_values = reinterpret_cast<double*>(values->mutable_data());
+
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (!tdigests_[i].is_empty()) {
+        for (int64_t j = 0; j < slot_length; ++j) {
+          raw_values[i * slot_length + j] = tdigests_[i].Quantile(options_.q[j]);
+        }
+        continue;
+      }
+      std::fill(raw_values + i * slot_length, raw_values + (i + 1) * slot_length, 0.0);
+
+      if (null_bitmap == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups_, pool_));
+        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups_, true);
+      }
+
+      null_count += 1;
+      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    }
+
+    auto child = ArrayData::Make(float64(), num_groups_ * slot_length,
+                                 {nullptr, std::move(values)}, /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups_, {std::move(null_bitmap)},
+                           {std::move(child)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(float64(), static_cast<int32_t>(options_.q.size()));
+  }
+
+  TDigestOptions options_;
+  int64_t num_groups_ = 0;
+  std::vector<TDigest> tdigests_;
+  ConsumeImpl consume_impl_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// Quantile implementation
+
+struct GroupedQuantileImpl : public GroupedAggregator {
+  using ConsumeImpl =
+      std::function<Status(const ArrayData&, const uint32_t*, BufferBuilder*,
+                           TypedBufferBuilder<uint32_t>*)>;
+
+  struct GetConsumeImpl {
+    template <typename T, typename CType = typename TypeTraits<T>::CType>
+    enable_if_number<T, Status> Visit(const T&) {
+      // append the valid, non-NaN values and their group ids
+      consume_impl = [](const ArrayData& input, const uint32_t* group,
+                        BufferBuilder* values, TypedBufferBuilder<uint32_t>* groups) {
+        TypedBufferBuilder<CType> typed_values(std::move(*values));
+        RETURN_NOT_OK(typed_values.Reserve(input.length));
+        RETURN_NOT_OK(groups->Reserve(input.length));
+        VisitArrayDataInline<T>(
+            input,
+            [&](CType value) {
+              if (value == value) {
+                typed_values.UnsafeAppend(value);
+                groups->UnsafeAppend(*group);
+              }
+              ++group;
+            },
+            [&] { ++group; });
+        *values = std::move(*typed_values.bytes_builder());
+        return Status::OK();
+      };
+      return Status::OK();
+    }
+
+    Status Visit(const HalfFloatType& type) {
+      return Status::NotImplemented("Computing quantiles of data of type ", type);
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::NotImplemented("Computing quantiles of data of type ", type);
+    }
+
+    ConsumeImpl consume_impl;
+  };
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const QuantileOptions*>(options);
+    RETURN_NOT_OK(CheckQuantileOptions(options_));
+    type_ = input_type;
+    pool_ = ctx->memory_pool();
+    values_ = BufferBuilder(pool_);
+    groups_ = TypedBufferBuilder<uint32_t>(pool_);
+
+    GetConsumeImpl get_consume_impl;
+    RETURN_NOT_OK(VisitTypeInline(*input_type, &get_consume_impl));
+    consume_impl_ = std::move(get_consume_impl.consume_impl);
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    return consume_impl_(*batch[0].array(), group_ids, &values_, &groups_);
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedQuantileImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    RETURN_NOT_OK(values_.Append(other->values_.data(), other->values_.length()));
+    RETURN_NOT_OK(groups_.Reserve(other->groups_.length()));
+    for (int64_t i = 0; i < other->groups_.length(); ++i) {
+      groups_.UnsafeAppend(g[other->groups_.data()[i]]);
+    }
+    other->values_.Reset();
+    other->groups_.Reset();
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const int64_t slot_length = static_cast<int64_t>(options_.q.size());
+    const auto quantile_type = QuantileType(options_, type_);
+    const int value_width = checked_cast<const FixedWidthType&>(*type_).bit_width() / 8;
+    const int quantile_width =
+        checked_cast<const FixedWidthType&>(*quantile_type).bit_width() / 8;
+
+    // gather the values by group, those of group g start at offsets[g]
+    const int64_t num_values = groups_.length();
+    const uint32_t* groups = groups_.data();
+    std::vector<int64_t> offsets(num_groups_ + 1, 0);
+    for (int64_t i = 0; i < num_values; ++i) {
+      ++offsets[groups[i] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    ARROW_ASSIGN_OR_RAISE(auto gathered, AllocateBuffer(num_values * value_width, pool_));
+    uint8_t* raw_gathered = gathered->mutable_data();
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < num_values; ++i) {
+      std::memcpy(raw_gathered + positions[groups[i]]++ * value_width,
+                  values_.data() + i * value_width, value_width);
+    }
+    values_.Reset();
+    groups_.Reset();
+
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto quantiles,
+        AllocateBuffer(num_groups_ * slot_length * quantile_width, pool_));
+    uint8_t* raw_quantiles = quantiles->mutable_data();
+
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      uint8_t* out = raw_quantiles + i * slot_length * quantile_width;
+      const int64_t length = offsets[i + 1] - offsets[i];
+      if (length > 0) {
+        RETURN_NOT_OK(ComputeQuantiles(options_, *type_,
+                                       raw_gathered + offsets[i] * value_width, length,
+                                       out));
+        continue;
+      }
+      std::memset(out, 0, slot_length * quantile_width);
+
+      if (null_bitmap == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_groups_, pool_));
+        BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups_, true);
+      }
+
+      null_count += 1;
+      BitUtil::SetBitTo(null_bitmap->mutable_data(), i, false);
+    }
+
+    auto child = ArrayData::Make(quantile_type, num_groups_ * slot_length,
+                                 {nullptr, std::move(quantiles)}, /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups_, {std::move(null_bitmap)},
+                           {std::move(child)}, null_count);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(QuantileType(options_, type_),
+                           static_cast<int32_t>(options_.q.size()));
+  }
+
+  QuantileOptions options_;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  // the valid values of all groups, and their group ids
+  BufferBuilder values_;
+  TypedBufferBuilder<uint32_t> groups_;
+  ConsumeImpl consume_impl_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// Mode implementation
+
+// The occurrences of each (group id, value) pair are counted, the pairs being keyed
+// by a Grouper of their own
+template <typename Type>
+struct GroupedModeImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+  using ValueCount = std::pair<CType, int64_t>;
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const ModeOptions*>(options);
+    type_ = input_type;
+    pool_ = ctx->memory_pool();
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    nan_counts_ = TypedBufferBuilder<int64_t>(pool_);
+    ARROW_ASSIGN_OR_RAISE(pairs_, Grouper::Make({ValueDescr::Array(uint32()),
+                                                 ValueDescr::Array(input_type)},
+                                                ctx));
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    return nan_counts_.Append(added_groups, 0);
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    // gather the valid, non-NaN values and their group ids
+    const ArrayData& input = *batch[0].array();
+    auto group = batch[1].array()->GetValues<uint32_t>(1);
+    int64_t* nan_counts = nan_counts_.mutable_data();
+    TypedBufferBuilder<uint32_t> groups(pool_);
+    TypedBufferBuilder<CType> values(pool_);
+    RETURN_NOT_OK(groups.Reserve(input.length));
+    RETURN_NOT_OK(values.Reserve(input.length));
+    VisitArrayDataInline<Type>(
+        input,
+        [&](CType value) {
+          if (value != value) {
+            ++nan_counts[*group];
+          } else {
+            groups.UnsafeAppend(*group);
+            // -0.0 and 0.0 are the same value
+            values.UnsafeAppend(value == 0 ? CType{} : value);
+          }
+          ++group;
+        },
+        [&] { ++group; });
+
+    const int64_t length = groups.length();
+    ARROW_ASSIGN_OR_RAISE(auto groups_buffer, groups.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer, values.Finish());
+    return CountPairs(length, std::move(groups_buffer),
+                      ArrayData::Make(type_, length, {nullptr, std::move(values_buffer)},
+                                      /*null_count=*/0),
+                      /*weights=*/nullptr);
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedModeImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t* nan_counts = nan_counts_.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      nan_counts[g[other_g]] += other->nan_counts_.data()[other_g];
+    }
+
+    // count the other's pairs, with their group ids mapped to ours
+    ARROW_ASSIGN_OR_RAISE(ExecBatch other_pairs, other->pairs_->GetUniques());
+    const int64_t num_pairs = other->pairs_->num_groups();
+    auto other_groups = other_pairs[0].array()->GetValues<uint32_t>(1);
+    TypedBufferBuilder<uint32_t> groups(pool_);
+    RETURN_NOT_OK(groups.Reserve(num_pairs));
+    for (int64_t i = 0; i < num_pairs; ++i) {
+      groups.UnsafeAppend(g[other_groups[i]]);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto groups_buffer, groups.Finish());
+    return CountPairs(num_pairs, std::move(groups_buffer), other_pairs[1].array(),
+                      other->counts_.data());
+  }
+
+  // Add `weights[i]` occurrences (one if null) of pair i to the counts
+  Status CountPairs(int64_t length, std::shared_ptr<Buffer> groups,
+                    std::shared_ptr<ArrayData> values, const int64_t* weights) {
+    if (length == 0) return Status::OK();
+    ExecBatch keys({ArrayData::Make(uint32(), length, {nullptr, std::move(groups)},
+                                    /*null_count=*/0),
+                    std::move(values)},
+                   length);
+    ARROW_ASSIGN_OR_RAISE(Datum pair_ids, pairs_->Consume(keys));
+    RETURN_NOT_OK(counts_.Append(pairs_->num_groups() - counts_.length(), 0));
+
+    auto pair_id = pair_ids.array()->GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+    if (weights == nullptr) {
+      for (int64_t i = 0; i < length; ++i) {
+        ++counts[pair_id[i]];
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        counts[pair_id[i]] += weights[i];
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch pairs, pairs_->GetUniques());
+    const int64_t num_pairs = pairs_->num_groups();
+    auto pair_groups = pairs[0].array()->GetValues<uint32_t>(1);
+    const int64_t* pair_counts = counts_.data();
+    const int64_t* nan_counts = nan_counts_.data();
+
+    // gather the values and their counts by group, those of group g start at
+    // offsets[g]
+    std::vector<int64_t> offsets(num_groups_ + 1, 0);
+    for (int64_t i = 0; i < num_pairs; ++i) {
+      ++offsets[pair_groups[i] + 1];
+    }
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      offsets[g + 1] += nan_counts[g] > 0;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<ValueCount> value_counts(offsets.back());
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    int64_t i = 0;
+    VisitArrayDataInline<Type>(
+        *pairs[1].array(),
+        [&](CType value) {
+          value_counts[positions[pair_groups[i]]++] = ValueCount(value, pair_counts[i]);
+          ++i;
+        },
+        [&] { ++i; });
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      if (nan_counts[g] > 0) {
+        value_counts[positions[g]++] = ValueCount(static_cast<CType>(NAN), nan_counts[g]);
+      }
+    }
+
+    // select the n modes of each group
+    auto ranks_before = [](const ValueCount& lhs, const ValueCount& rhs) {
+      return ModeRanksBefore(lhs, rhs);
+    };
+    const int64_t n = std::max<int64_t>(options_.n, 0);
+    TypedBufferBuilder<int32_t> list_offsets(pool_);
+    TypedBufferBuilder<CType> modes(pool_);
+    TypedBufferBuilder<int64_t> counts(pool_);
+    RETURN_NOT_OK(list_offsets.Reserve(num_groups_ + 1));
+    list_offsets.UnsafeAppend(0);
+    int64_t num_modes = 0;
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      auto begin = value_counts.begin() + offsets[g];
+      auto end = value_counts.begin() + offsets[g + 1];
+      auto middle = begin + std::min<int64_t>(n, end - begin);
+      std::partial_sort(begin, middle, end, ranks_before);
+      RETURN_NOT_OK(modes.Reserve(middle - begin));
+      RETURN_NOT_OK(counts.Reserve(middle - begin));
+      for (auto it = begin; it != middle; ++it) {
+        modes.UnsafeAppend(it->first);
+        counts.UnsafeAppend(it->second);
+      }
+      num_modes += middle - begin;
+      if (num_modes > std::numeric_limits<int32_t>::max()) {
+        return Status::CapacityError("hash_mode output exceeds the capacity of a list");
+      }
+      list_offsets.UnsafeAppend(static_cast<int32_t>(num_modes));
+    }
+    counts_.Reset();
+    nan_counts_.Reset();
+
+    ARROW_ASSIGN_OR_RAISE(auto modes_buffer, modes.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto counts_buffer, counts.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto list_offsets_buffer, list_offsets.Finish());
+    auto mode_data = ArrayData::Make(type_, num_modes, {nullptr, std::move(modes_buffer)},
+                                     /*null_count=*/0);
+    auto count_data = ArrayData::Make(int64(), num_modes,
+                                      {nullptr, std::move(counts_buffer)},
+                                      /*null_count=*/0);
+    auto struct_data = ArrayData::Make(ModeType(type_), num_modes, {nullptr},
+                                       {std::move(mode_data), std::move(count_data)},
+                                       /*null_count=*/0);
+    return ArrayData::Make(out_type(), num_groups_,
+                           {nullptr, std::move(list_offsets_buffer)},
+                           {std::move(struct_data)}, /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return list(ModeType(type_)); }
+
+  ModeOptions options_;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  // the distinct (group id, value) pairs, and the number of occurrences of each
+  std::unique_ptr<Grouper> pairs_;
+  TypedBufferBuilder<int64_t> counts_;
+  // the number of NaNs of each group
+  TypedBufferBuilder<int64_t> nan_counts_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// ApproxCountDistinct implementation
+
+struct GroupedApproxCountDistinctImpl : public GroupedAggregator {
+  using HyperLogLog = ::arrow::internal::HyperLogLog;
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) override {
+    options_ = *checked_cast<const ApproxCountDistinctOptions*>(options);
+    pool_ = ctx->memory_pool();
+    return CheckApproxCountDistinct(options_, *input_type);
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    // Sketches start sparse, so groups with few distinct values stay small
+    sketches_.reserve(num_groups_);
+    for (int64_t i = 0; i < added_groups; ++i) {
+      sketches_.emplace_back(options_.precision);
+    }
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    auto group_ids = batch[1].array()->GetValues<uint32_t>(1);
+    return UpdateSketches(options_, *batch[0].array(), group_ids, sketches_.data());
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedApproxCountDistinctImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sketches_[g[other_g]].Merge(other->sketches_[other_g]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    if (options_.output_sketch) {
+      BinaryBuilder builder(pool_);
+      RETURN_NOT_OK(builder.Reserve(num_groups_));
+      for (auto& sketch : sketches_) {
+        RETURN_NOT_OK(builder.Append(sketch.Serialize()));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto out, builder.Finish());
+      return out;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto counts,
+                          AllocateBuffer(num_groups_ * sizeof(int64_t), pool_));
+    auto raw_counts = reinterpret_cast<int64_t*>(counts->mutable_data());
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      raw_counts[i] = static_cast<int64_t>(std::llround(sketches_[i].Estimate()));
+    }
+    return std::make_shared<Int64Array>(num_groups_, std::move(counts));
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return ApproxCountDistinctType(options_);
+  }
+
+  ApproxCountDistinctOptions options_;
+  int64_t num_groups_ = 0;
+  std::vector<HyperLogLog> sketches_;
+  MemoryPool* pool_;
+};
+
+// ----------------------------------------------------------------------
+// Any/All implementation
+
+template <bool kIsAny>
+struct GroupedBooleanImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const FunctionOptions*,
+              const std::shared_ptr<DataType>&) override {
+    seen_ = TypedBufferBuilder<bool>(ctx->memory_pool());
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t added_groups) override {
+    num_groups_ += added_groups;
+    // any() of an empty group is false, all() of an empty group is true
+    return seen_.Append(added_groups, !kIsAny);
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+  Status Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(MaybeReserve(batch));
+
+    auto group = batch[1].array()->GetValues<uint32_t>(1);
+    uint8_t* seen = seen_.mutable_data();
+
+    VisitArrayDataInline<BooleanType>(
+        *batch[0].array(),
+        [&](bool value) {
+          const auto g = *group++;
+          if (value == kIsAny) {
+            BitUtil::SetBitTo(seen, g, kIsAny);
+          }
+        },
+        [&] { ++group; });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    RETURN_NOT_OK(MaybeReserve(group_id_mapping));
+    auto other = checked_cast<GroupedBooleanImpl*>(&raw_other);
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      if (BitUtil::GetBit(other->seen_.data(), other_g) == kIsAny) {
+        BitUtil::SetBitTo(seen_.mutable_data(), g[other_g], kIsAny);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(auto seen, seen_.Finish());
+    return ArrayData::Make(boolean(), num_groups_, {nullptr, std::move(seen)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  int64_t num_groups_ = 0;
+  TypedBufferBuilder<bool> seen_;
+};
+
+using GroupedAnyImpl = GroupedBooleanImpl<true>;
+using GroupedAllImpl = GroupedBooleanImpl<false>;
+
+template <typename Impl>
+HashAggregateKernel MakeKernel(InputType argument_type) {
+  HashAggregateKernel kernel;
+
+  kernel.init = [](KernelContext* ctx,
+                   const KernelInitArgs& args) -> std::unique_ptr<KernelState> {
+    auto impl = ::arrow::internal::make_unique<Impl>();
+    // FIXME(bkietz) Init should not take a type. That should be an unboxed template arg
+    // for the Impl. Otherwise we're not exposing dispatch as well as we should.
+    ctx->SetStatus(impl->Init(ctx->exec_context(), args.options, args.inputs[0].type));
+    if (ctx->HasError()) return nullptr;
+    return std::move(impl);
+  };
+
+  kernel.signature = KernelSignature::Make(
+      {std::move(argument_type), InputType::Array(Type::UINT32),
+       InputType::Scalar(Type::UINT32)},
+      OutputType(
+          [](KernelContext* ctx, const std::vector<ValueDescr>&) -> Result<ValueDescr> {
+            return checked_cast<GroupedAggregator*>(ctx->state())->out_type();
           }));
 
   kernel.consume = [](KernelContext* ctx, const ExecBatch& batch) {
     ctx->SetStatus(checked_cast<GroupedAggregator*>(ctx->state())->Consume(batch));
   };
 
-  kernel.merge = [](KernelContext* ctx, KernelState&&, KernelState*) {
-    // TODO(ARROW-11840) merge two hash tables
-    ctx->SetStatus(Status::NotImplemented("Merge hashed aggregations"));
+  kernel.merge = [](KernelContext* ctx, KernelState&& other,
+                    const ArrayData& group_id_mapping) {
+    auto state = checked_cast<GroupedAggregator*>(ctx->state());
+    ctx->SetStatus(
+        state->Merge(checked_cast<GroupedAggregator&&>(other), group_id_mapping));
   };
 
   kernel.finalize = [](KernelContext* ctx, Datum* out) {
@@ -804,7 +1769,36 @@ HashAggregateKernel MakeKernel(InputType argument_type) {
   return kernel;
 }
 
-Result<std::vector<const HashAggregateKernel*>> GetKernels(
+struct GroupedModeFactory {
+  template <typename T>
+  enable_if_t<is_number_type<T>::value || is_boolean_type<T>::value, Status> Visit(
+      const T&) {
+    kernel = MakeKernel<GroupedModeImpl<T>>(InputType::Array(type));
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing modes of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing modes of data of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedModeFactory factory;
+    factory.type = type;
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  std::shared_ptr<DataType> type;
+  HashAggregateKernel kernel;
+};
+
+}  // namespace
+
+Result<std::vector<const HashAggregateKernel*>> GetHashAggregateKernels(
     ExecContext* ctx, const std::vector<Aggregate>& aggregates,
     const std::vector<ValueDescr>& in_descrs) {
   if (aggregates.size() != in_descrs.size()) {
@@ -826,7 +1820,7 @@ Result<std::vector<const HashAggregateKernel*>> GetKernels(
   return kernels;
 }
 
-Result<std::vector<std::unique_ptr<KernelState>>> InitKernels(
+Result<std::vector<std::unique_ptr<KernelState>>> InitHashAggregateKernels(
     const std::vector<const HashAggregateKernel*>& kernels, ExecContext* ctx,
     const std::vector<Aggregate>& aggregates, const std::vector<ValueDescr>& in_descrs) {
   std::vector<std::unique_ptr<KernelState>> states(kernels.size());
@@ -856,7 +1850,7 @@ Result<std::vector<std::unique_ptr<KernelState>>> InitKernels(
   return std::move(states);
 }
 
-Result<FieldVector> ResolveKernels(
+Result<FieldVector> ResolveHashAggregateKernels(
     const std::vector<Aggregate>& aggregates,
     const std::vector<const HashAggregateKernel*>& kernels,
     const std::vector<std::unique_ptr<KernelState>>& states, ExecContext* ctx,
@@ -878,10 +1872,11 @@ Result<FieldVector> ResolveKernels(
   return fields;
 }
 
-}  // namespace
-
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
                                                ExecContext* ctx) {
+  if (GrouperFastImpl::CanUse(descrs)) {
+    return GrouperFastImpl::Make(descrs, ctx);
+  }
   return GrouperImpl::Make(descrs, ctx);
 }
 
@@ -892,14 +1887,15 @@ Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Dat
                         ExecBatch::Make(arguments).Map(
                             [](ExecBatch batch) { return batch.GetDescriptors(); }));
 
-  ARROW_ASSIGN_OR_RAISE(auto kernels, GetKernels(ctx, aggregates, argument_descrs));
+  ARROW_ASSIGN_OR_RAISE(auto kernels,
+                        GetHashAggregateKernels(ctx, aggregates, argument_descrs));
 
-  ARROW_ASSIGN_OR_RAISE(auto states,
-                        InitKernels(kernels, ctx, aggregates, argument_descrs));
+  ARROW_ASSIGN_OR_RAISE(
+      auto states, InitHashAggregateKernels(kernels, ctx, aggregates, argument_descrs));
 
   ARROW_ASSIGN_OR_RAISE(
       FieldVector out_fields,
-      ResolveKernels(aggregates, kernels, states, ctx, argument_descrs));
+      ResolveHashAggregateKernels(aggregates, kernels, states, ctx, argument_descrs));
 
   using arrow::compute::detail::ExecBatchIterator;
 
@@ -914,29 +1910,83 @@ Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Dat
   ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, ctx));
 
   int i = 0;
-  for (ValueDescr& key_descr : key_descrs) {
-    out_fields.push_back(field("key_" + std::to_string(i++), std::move(key_descr.type)));
+  for (const ValueDescr& key_descr : key_descrs) {
+    out_fields.push_back(field("key_" + std::to_string(i++), key_descr.type));
   }
 
   ARROW_ASSIGN_OR_RAISE(auto key_batch_iterator,
                         ExecBatchIterator::Make(keys, ctx->exec_chunksize()));
 
-  // start "streaming" execution
+  // Gather (zero-copy) batches up front so they can be partitioned among threads
+  std::vector<ExecBatch> argument_batches, key_batches;
   ExecBatch key_batch, argument_batch;
   while (argument_batch_iterator->Next(&argument_batch) &&
          key_batch_iterator->Next(&key_batch)) {
     if (key_batch.length == 0) continue;
+    argument_batches.push_back(std::move(argument_batch));
+    key_batches.push_back(std::move(key_batch));
+  }
+
+  // Each task consumes a contiguous run of batches into its own Grouper and
+  // kernel states. Merging the tasks' states in order then assigns group ids
+  // exactly as a serial scan over all batches would.
+  const int num_batches = static_cast<int>(key_batches.size());
+  int num_tasks = 1;
+  // the threads of the CPU pool may all be waiting on this one already
+  if (ctx->use_threads() && !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+    num_tasks = std::max(1, std::min(num_batches, GetCpuThreadPoolCapacity()));
+  }
+
+  std::vector<std::unique_ptr<Grouper>> groupers(num_tasks);
+  std::vector<std::vector<std::unique_ptr<KernelState>>> task_states(num_tasks);
+  groupers[0] = std::move(grouper);
+  task_states[0] = std::move(states);
+  for (int task = 1; task < num_tasks; ++task) {
+    ARROW_ASSIGN_OR_RAISE(groupers[task], Grouper::Make(key_descrs, ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        task_states[task],
+        InitHashAggregateKernels(kernels, ctx, aggregates, argument_descrs));
+  }
+
+  // start "streaming" execution
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      num_tasks > 1, num_tasks, [&](int task) -> Status {
+        const auto& task_grouper = groupers[task];
+        const int begin = task * num_batches / num_tasks;
+        const int end = (task + 1) * num_batches / num_tasks;
+
+        for (int batch_index = begin; batch_index < end; ++batch_index) {
+          // compute a batch of group ids
+          ARROW_ASSIGN_OR_RAISE(Datum id_batch,
+                                task_grouper->Consume(key_batches[batch_index]));
+
+          // consume group ids with HashAggregateKernels
+          for (size_t i = 0; i < kernels.size(); ++i) {
+            KernelContext batch_ctx{ctx};
+            batch_ctx.SetState(task_states[task][i].get());
+            ARROW_ASSIGN_OR_RAISE(
+                auto batch,
+                ExecBatch::Make({argument_batches[batch_index][i], id_batch,
+                                 Datum(task_grouper->num_groups())}));
+            kernels[i]->consume(&batch_ctx, batch);
+            if (batch_ctx.HasError()) return batch_ctx.status();
+          }
+        }
+        return Status::OK();
+      }));
 
-    // compute a batch of group ids
-    ARROW_ASSIGN_OR_RAISE(Datum id_batch, grouper->Consume(key_batch));
+  // Merge task-local states into the first task's
+  grouper = std::move(groupers[0]);
+  states = std::move(task_states[0]);
+  for (int task = 1; task < num_tasks; ++task) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, groupers[task]->GetUniques());
+    ARROW_ASSIGN_OR_RAISE(Datum group_id_mapping, grouper->Consume(other_keys));
 
-    // consume group ids with HashAggregateKernels
     for (size_t i = 0; i < kernels.size(); ++i) {
       KernelContext batch_ctx{ctx};
       batch_ctx.SetState(states[i].get());
-      ARROW_ASSIGN_OR_RAISE(auto batch, ExecBatch::Make({argument_batch[i], id_batch,
-                                                         Datum(grouper->num_groups())}));
-      kernels[i]->consume(&batch_ctx, batch);
+      kernels[i]->merge(&batch_ctx, std::move(*task_states[task][i]),
+                        *group_id_mapping.array());
       if (batch_ctx.HasError()) return batch_ctx.status();
     }
   }
@@ -1034,6 +2084,73 @@ const FunctionDoc hash_min_max_doc{
      "This can be changed through MinMaxOptions."),
     {"array", "group_id_array", "group_count"},
     "MinMaxOptions"};
+
+const FunctionDoc hash_mean_doc{"Average values of a numeric array",
+                                ("Null values are ignored."),
+                                {"array", "group_id_array", "group_count"}};
+
+const FunctionDoc hash_variance_doc{
+    "Calculate the variance of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population variance is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is emitted for that group."),
+    {"array", "group_id_array", "group_count"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_stddev_doc{
+    "Calculate the standard deviation of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population standard deviation is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is emitted for that group."),
+    {"array", "group_id_array", "group_count"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_tdigest_doc{
+    "Calculate approximate quantiles of a numeric array with the T-Digest algorithm",
+    ("By default, the 0.5 quantile (median) is returned.\n"
+     "Nulls and NaNs are ignored.\n"
+     "A null list is emitted for groups without any valid data point."),
+    {"array", "group_id_array", "group_count"},
+    "TDigestOptions"};
+
+const FunctionDoc hash_quantile_doc{
+    "Calculate exact quantiles of a numeric array",
+    ("By default, the 0.5 quantile (median) is returned.\n"
+     "If a quantile lies between two data points, an interpolated value is\n"
+     "returned based on the selected interpolation method.\n"
+     "Nulls and NaNs are ignored.\n"
+     "A null list is emitted for groups without any valid data point.\n"
+     "The valid values of all groups are kept until the end."),
+    {"array", "group_id_array", "group_count"},
+    "QuantileOptions"};
+
+const FunctionDoc hash_mode_doc{
+    "Calculate the modal (most common) values of a numeric array",
+    ("Returns the top-n most common values of each group, as a list of\n"
+     "`struct<mode: T, count: int64>`, where T is the input type.\n"
+     "Values with larger counts come first, and values with the same count\n"
+     "come in ascending order.  Nulls are ignored.\n"
+     "An empty list is emitted for groups without any non-null value."),
+    {"array", "group_id_array", "group_count"},
+    "ModeOptions"};
+
+const FunctionDoc hash_approx_count_distinct_doc{
+    "Approximate number of distinct values in each group",
+    ("Nulls are ignored. The HyperLogLog++ sketch of each group takes a few bytes\n"
+     "per distinct value, up to 2^precision bytes. Partial results can be\n"
+     "output as binary sketches and merged later."),
+    {"array", "group_id_array", "group_count"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc hash_any_doc{"Test whether any element evaluates to true",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array", "group_count"}};
+
+const FunctionDoc hash_all_doc{"Test whether all elements evaluate to true",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array", "group_count"}};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
@@ -1059,6 +2176,81 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel(MakeKernel<GroupedMinMaxImpl>(ValueDescr::ARRAY)));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Ternary(),
+                                                        &hash_mean_doc);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedMeanImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_variance_options = VarianceOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_variance", Arity::Ternary(), &hash_variance_doc, &default_variance_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedVarianceImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_stddev_options = VarianceOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_stddev", Arity::Ternary(), &hash_stddev_doc, &default_stddev_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedStddevImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_tdigest_options = TDigestOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_tdigest", Arity::Ternary(), &hash_tdigest_doc, &default_tdigest_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedTDigestImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_quantile_options = QuantileOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_quantile", Arity::Ternary(), &hash_quantile_doc, &default_quantile_options);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedQuantileImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_mode_options = ModeOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_mode", Arity::Ternary(), &hash_mode_doc, &default_mode_options);
+    DCHECK_OK(func->AddKernel(GroupedModeFactory::Make(boolean()).ValueOrDie()));
+    for (const auto& ty : NumericTypes()) {
+      DCHECK_OK(func->AddKernel(GroupedModeFactory::Make(ty).ValueOrDie()));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_approx_count_distinct_options =
+        ApproxCountDistinctOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approx_count_distinct", Arity::Ternary(), &hash_approx_count_distinct_doc,
+        &default_approx_count_distinct_options);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel<GroupedApproxCountDistinctImpl>(ValueDescr::ARRAY)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_any", Arity::Ternary(),
+                                                        &hash_any_doc);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedAnyImpl>(boolean())));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_all", Arity::Ternary(),
+                                                        &hash_all_doc);
+    DCHECK_OK(func->AddKernel(MakeKernel<GroupedAllImpl>(boolean())));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
@@ -45,6 +45,7 @@
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 using testing::HasSubstr;
 
@@ -188,6 +189,17 @@ struct TestGrouper {
     AssertDatumsEqual(expected, ids, /*verbose=*/true);
   }
 
+  void ExpectLookup(const std::string& key_json, const std::string& expected) {
+    const uint32_t num_groups = grouper_->num_groups();
+    ASSERT_OK_AND_ASSIGN(
+        Datum ids,
+        grouper_->Lookup(ExecBatch(*RecordBatchFromJSON(key_schema_, key_json))));
+    ASSERT_OK(ids.make_array()->ValidateFull());
+    AssertDatumsEqual(ArrayFromJSON(uint32(), expected), ids, /*verbose=*/true);
+    // lookups never add groups
+    ASSERT_EQ(grouper_->num_groups(), num_groups);
+  }
+
   void ConsumeAndValidate(const ExecBatch& key_batch, Datum* ids = nullptr) {
     ASSERT_OK_AND_ASSIGN(Datum id_batch, grouper_->Consume(key_batch));
 
@@ -387,6 +399,54 @@ TEST(Grouper, DoubleStringInt64Key) {
   g.ExpectConsume(R"([[-0.0, "be", 7], [0.0, "be", 7]])", "[3, 4]");
 }
 
+TEST(Grouper, FixedWidthMultipleKeys) {
+  // all keys fixed width: exercises the row-packed grouper
+  TestGrouper g({int64(), boolean(), fixed_size_binary(3), int16()});
+
+  g.ExpectConsume(R"([[1, true, "abc", 0], [1, true, "abc", 0]])", "[0, 0]");
+
+  g.ExpectConsume(R"([[1, false, "abc", 0], [1, null, "abc", 0]])", "[1, 2]");
+
+  g.ExpectConsume(R"([[null, null, null, null], [1, true, "abd", 0]])", "[3, 4]");
+
+  g.ExpectConsume(R"([
+    [null, null, null, null],
+    [1,    true, "abc", 0],
+    [1,    true, "abc", null],
+    [0,    null, "abc", 0],
+    [1,    true, "abc", null]
+  ])",
+                  "[3, 0, 5, 6, 5]");
+}
+
+TEST(Grouper, Lookup) {
+  // variable width keys
+  TestGrouper g({utf8(), int64()});
+  g.ExpectLookup(R"([["eh", 0]])", "[null]");
+  g.ExpectConsume(R"([["eh", 0], ["bee", null], ["eh", 1]])", "[0, 1, 2]");
+  g.ExpectLookup(R"([["eh", 1], ["eh", 2], ["bee", null], ["bee", 0], ["eh", 0]])",
+                 "[2, null, 1, null, 0]");
+
+  // fixed width keys
+  g = TestGrouper({int64(), boolean()});
+  g.ExpectConsume(R"([[1, true], [null, true], [1, null]])", "[0, 1, 2]");
+  g.ExpectLookup(R"([[1, null], [1, false], [null, true], [1, true]])",
+                 "[2, null, 1, 0]");
+  g.ExpectLookup(R"([[1, true], [null, true]])", "[0, 1]");
+  g.ExpectLookup("[]", "[]");
+}
+
+TEST(Grouper, RandomInt64Int32Keys) {
+  TestGrouper g({int64(), int32()});
+  for (int i = 0; i < 4; ++i) {
+    SCOPED_TRACE(std::to_string(i) + "th key batch");
+
+    ExecBatch key_batch{
+        *random::GenerateBatch(g.key_schema_->fields(), 1 << 12, 0xDEADBEEF)};
+    g.ConsumeAndValidate(key_batch);
+  }
+}
+
 TEST(Grouper, RandomInt64Keys) {
   TestGrouper g({int64()});
   for (int i = 0; i < 4; ++i) {
@@ -604,6 +664,290 @@ TEST(GroupBy, CountAndSum) {
       /*verbose=*/true);
 }
 
+TEST(GroupBy, MeanVarianceStddev) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [1.0,   1],
+    [null,  1],
+    [0.0,   2],
+    [null,  3],
+    [4.0,   null],
+    [3.0,   1],
+    [2.0,   2],
+    [-2.0,  2],
+    [6.0,   null],
+    [null,  3]
+  ])");
+
+  VarianceOptions ddof1(/*ddof=*/1);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       internal::GroupBy(
+                           {
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                           },
+                           {
+                               batch->GetColumnByName("key"),
+                           },
+                           {
+                               {"hash_mean", nullptr},
+                               {"hash_variance", nullptr},
+                               {"hash_variance", &ddof1},
+                               {"hash_stddev", nullptr},
+                           }));
+
+  AssertArraysApproxEqual(*ArrayFromJSON(struct_({
+                                             field("hash_mean", float64()),
+                                             field("hash_variance", float64()),
+                                             field("hash_variance", float64()),
+                                             field("hash_stddev", float64()),
+                                             field("key_0", int64()),
+                                         }),
+                                         R"([
+    [2.0,  1.0,                2.0,  1.0,               1],
+    [0.0,  2.6666666666666665, 4.0,  1.632993161855452, 2],
+    [null, null,               null, null,              3],
+    [5.0,  1.0,                2.0,  1.0,               null]
+  ])"),
+                          *aggregated_and_grouped.make_array(),
+                          /*verbose=*/true);
+}
+
+TEST(GroupBy, TDigest) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", int32()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [4,    null],
+    [3,    1],
+    [2,    2],
+    [-2,   2],
+    [6,    null],
+    [null, 3]
+  ])");
+
+  TDigestOptions min_and_max(std::vector<double>{0.0, 1.0});
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       internal::GroupBy({batch->GetColumnByName("argument")},
+                                         {batch->GetColumnByName("key")},
+                                         {
+                                             {"hash_tdigest", &min_and_max},
+                                         }));
+
+  auto tdigest_type = fixed_size_list(float64(), 2);
+  AssertDatumsEqual(ArrayFromJSON(struct_({
+                                      field("hash_tdigest", tdigest_type),
+                                      field("key_0", int64()),
+                                  }),
+                                  R"([
+    [[1.0,  3.0], 1],
+    [[-2.0, 2.0], 2],
+    [null,        3],
+    [[4.0,  6.0], null]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
+TEST(GroupBy, Quantile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", int32()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [4,    null],
+    [3,    1],
+    [2,    2],
+    [-2,   2],
+    [6,    null],
+    [null, 3]
+  ])");
+
+  QuantileOptions median(0.5);
+  QuantileOptions lower(std::vector<double>{0.0, 0.5}, QuantileOptions::LOWER);
+  ASSERT_OK_AND_ASSIGN(
+      Datum aggregated_and_grouped,
+      internal::GroupBy(
+          {batch->GetColumnByName("argument"), batch->GetColumnByName("argument")},
+          {batch->GetColumnByName("key")},
+          {
+              {"hash_quantile", &median},
+              {"hash_quantile", &lower},
+          }));
+
+  auto median_type = fixed_size_list(float64(), 1);
+  auto lower_type = fixed_size_list(int32(), 2);
+  AssertDatumsEqual(ArrayFromJSON(struct_({
+                                      field("hash_quantile", median_type),
+                                      field("hash_quantile", lower_type),
+                                      field("key_0", int64()),
+                                  }),
+                                  R"([
+    [[2.0], [1,  1], 1],
+    [[0.0], [-2, 0], 2],
+    [null,  null,    3],
+    [[5.0], [4,  4], null]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
+TEST(GroupBy, Mode) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", int32()), field("floats", float64()),
+              field("key", int64())}),
+      R"([
+    [1,    0.0,  1],
+    [null, null, 1],
+    [3,    NaN,  2],
+    [null, null, 3],
+    [4,    1.5,  null],
+    [3,    -0.0, 1],
+    [2,    NaN,  2],
+    [3,    1.5,  2],
+    [1,    2.5,  1],
+    [2,    NaN,  2],
+    [3,    1.5,  1]
+  ])");
+
+  ModeOptions top_two(/*n=*/2);
+  ASSERT_OK_AND_ASSIGN(
+      Datum aggregated_and_grouped,
+      internal::GroupBy(
+          {batch->GetColumnByName("argument"), batch->GetColumnByName("floats")},
+          {batch->GetColumnByName("key")},
+          {
+              {"hash_mode", nullptr},
+              {"hash_mode", &top_two},
+          }));
+
+  // ties go to the smaller value, -0.0 is counted as 0.0 and NaNs as one value
+  auto int_type = list(struct_({field("mode", int32()), field("count", int64())}));
+  auto float_type = list(struct_({field("mode", float64()), field("count", int64())}));
+  AssertArraysEqual(*ArrayFromJSON(struct_({
+                                       field("hash_mode", int_type),
+                                       field("hash_mode", float_type),
+                                       field("key_0", int64()),
+                                   }),
+                                   R"([
+    [[[1, 2]], [[0.0, 2], [1.5, 1]],  1],
+    [[[2, 2]], [[NaN, 3], [1.5, 1]],  2],
+    [[],       [],                    3],
+    [[[4, 1]], [[1.5, 1]],            null]
+  ])"),
+                    *aggregated_and_grouped.make_array(),
+                    /*verbose=*/true, EqualOptions::Defaults().nans_equal(true));
+}
+
+TEST(GroupBy, ApproxCountDistinct) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", utf8()), field("key", int64())}), R"([
+    ["a",  1],
+    [null, 1],
+    ["b",  2],
+    [null, 3],
+    ["a",  null],
+    ["a",  1],
+    ["c",  2],
+    ["b",  2],
+    ["b",  null],
+    [null, 3],
+    ["",   1]
+  ])");
+
+  auto approx_count_distinct = [](Datum argument, Datum key,
+                                  const ApproxCountDistinctOptions* options) {
+    return internal::GroupBy({std::move(argument)}, {std::move(key)},
+                             {{"hash_approx_count_distinct", options}});
+  };
+
+  // Few distinct values are counted exactly
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       approx_count_distinct(batch->GetColumnByName("argument"),
+                                             batch->GetColumnByName("key"), nullptr));
+
+  auto expected = ArrayFromJSON(struct_({
+                                    field("hash_approx_count_distinct", int64()),
+                                    field("key_0", int64()),
+                                }),
+                                R"([
+    [2, 1],
+    [2, 2],
+    [0, 3],
+    [2, null]
+  ])");
+  AssertDatumsEqual(expected, aggregated_and_grouped, /*verbose=*/true);
+
+  // Output sketches, then merge them as a rollup would
+  ApproxCountDistinctOptions output_sketch(/*precision=*/12, /*merge_sketches=*/false,
+                                           /*output_sketch=*/true);
+  ASSERT_OK_AND_ASSIGN(Datum sketches,
+                       approx_count_distinct(batch->GetColumnByName("argument"),
+                                             batch->GetColumnByName("key"),
+                                             &output_sketch));
+  const auto& sketches_and_keys = *sketches.array_as<StructArray>();
+  ASSERT_EQ(sketches_and_keys.field(0)->type()->id(), Type::BINARY);
+
+  ApproxCountDistinctOptions merge_sketches(/*precision=*/12, /*merge_sketches=*/true);
+  ASSERT_OK_AND_ASSIGN(
+      Datum merged, approx_count_distinct(sketches_and_keys.field(0),
+                                          sketches_and_keys.field(1), &merge_sketches));
+  AssertDatumsEqual(expected, merged, /*verbose=*/true);
+
+  // Sketches of another precision can't be merged
+  merge_sketches.precision = 14;
+  ASSERT_RAISES(Invalid, approx_count_distinct(sketches_and_keys.field(0),
+                                               sketches_and_keys.field(1),
+                                               &merge_sketches));
+}
+
+TEST(GroupBy, AnyAndAll) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", boolean()), field("key", int64())}), R"([
+    [true,  1],
+    [null,  1],
+    [false, 2],
+    [null,  3],
+    [false, null],
+    [true,  1],
+    [true,  2],
+    [null,  3]
+  ])");
+
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       internal::GroupBy(
+                           {
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                           },
+                           {
+                               batch->GetColumnByName("key"),
+                           },
+                           {
+                               {"hash_any", nullptr},
+                               {"hash_all", nullptr},
+                           }));
+
+  AssertDatumsEqual(ArrayFromJSON(struct_({
+                                      field("hash_any", boolean()),
+                                      field("hash_all", boolean()),
+                                      field("key_0", int64()),
+                                  }),
+                                  R"([
+    [true,  true,  1],
+    [true,  false, 2],
+    [false, true,  3],
+    [false, false, null]
+  ])"),
+                    aggregated_and_grouped,
+                    /*verbose=*/true);
+}
+
 TEST(GroupBy, SumOnlyStringAndDictKeys) {
   for (auto key_type : {utf8(), dictionary(int32(), utf8())}) {
     SCOPED_TRACE("key type: " + key_type->ToString());
@@ -699,5 +1043,61 @@ TEST(GroupBy, RandomArraySum) {
   }
 }
 
+TEST(GroupBy, ParallelMatchesSerial) {
+  ScopedCpuThreadPoolCapacity capacity;
+
+  auto batch = random::GenerateBatch(
+      {
+          // a narrow range keeps the variance's rounding errors within tolerance
+          field("argument", int32(),
+                key_value_metadata(
+                    {{"null_probability", "0.1"}, {"min", "-1000"}, {"max", "1000"}})),
+          field("flag", boolean(), key_value_metadata({{"null_probability", "0.1"}})),
+          field("key", int64(), key_value_metadata({{"min", "0"}, {"max", "100"}})),
+      },
+      1 << 12, 0xDEADBEEF);
+
+  // split the batch into many chunks so that each thread receives several batches
+  auto Chunked = [&](const std::string& name) {
+    auto column = batch->GetColumnByName(name);
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < column->length(); offset += 300) {
+      chunks.push_back(column->Slice(offset, 300));
+    }
+    return Datum(std::make_shared<ChunkedArray>(std::move(chunks)));
+  };
+
+  std::vector<Datum> arguments = {Chunked("argument"), Chunked("argument"),
+                                  Chunked("argument"), Chunked("argument"),
+                                  Chunked("flag"),     Chunked("argument"),
+                                  Chunked("argument"), Chunked("argument")};
+  std::vector<internal::Aggregate> aggregates = {
+      {"hash_count", nullptr},    {"hash_sum", nullptr}, {"hash_min_max", nullptr},
+      {"hash_variance", nullptr}, {"hash_any", nullptr},
+      // sketches merge into the same sketch in any order
+      {"hash_approx_count_distinct", nullptr},
+      // exact quantiles don't depend on the order of the values
+      {"hash_quantile", nullptr},
+      // and neither do the counts of the most common values
+      {"hash_mode", nullptr},
+  };
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(
+      Datum expected,
+      internal::GroupBy(arguments, {Chunked("key")}, aggregates, &serial_ctx));
+
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+  ASSERT_OK_AND_ASSIGN(
+      Datum actual,
+      internal::GroupBy(arguments, {Chunked("key")}, aggregates, &parallel_ctx));
+
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertArraysApproxEqual(*expected.make_array(), *actual.make_array(),
+                          /*verbose=*/true);
+}
+
 }  // namespace compute
 }  // namespace arrow
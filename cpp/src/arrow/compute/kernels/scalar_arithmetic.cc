@@ -15,18 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
+#include <string>
 
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_arithmetic_internal.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
 
-using internal::AddWithOverflow;
 using internal::DivideWithOverflow;
 using internal::MultiplyWithOverflow;
-using internal::SubtractWithOverflow;
 
 namespace compute {
 namespace internal {
@@ -57,6 +59,11 @@ using enable_if_integer =
 template <typename T>
 using enable_if_floating_point = enable_if_t<std::is_floating_point<T>::value, T>;
 
+template <typename T>
+using enable_if_decimal_value =
+    enable_if_t<std::is_same<Decimal128, T>::value || std::is_same<Decimal256, T>::value,
+                T>;
+
 template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
 constexpr Unsigned to_unsigned(T signed_) {
   return static_cast<Unsigned>(signed_);
@@ -77,22 +84,9 @@ struct Add {
   static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
     return arrow::internal::SafeSignedAdd(left, right);
   }
-};
-
-struct AddChecked {
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
-    T result = 0;
-    if (ARROW_PREDICT_FALSE(AddWithOverflow(left, right, &result))) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return result;
-  }
 
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_floating_point<T> Call(KernelContext*, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
+  template <typename T>
+  static enable_if_decimal_value<T> Call(KernelContext*, T left, T right) {
     return left + right;
   }
 };
@@ -112,22 +106,9 @@ struct Subtract {
   static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
     return arrow::internal::SafeSignedSubtract(left, right);
   }
-};
 
-struct SubtractChecked {
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
-    T result = 0;
-    if (ARROW_PREDICT_FALSE(SubtractWithOverflow(left, right, &result))) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return result;
-  }
-
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_floating_point<T> Call(KernelContext*, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
+  template <typename T>
+  static enable_if_decimal_value<T> Call(KernelContext*, T left, T right) {
     return left - right;
   }
 };
@@ -169,22 +150,9 @@ struct Multiply {
   static constexpr uint16_t Call(KernelContext*, uint16_t left, uint16_t right) {
     return static_cast<uint32_t>(left) * static_cast<uint32_t>(right);
   }
-};
-
-struct MultiplyChecked {
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
-    T result = 0;
-    if (ARROW_PREDICT_FALSE(MultiplyWithOverflow(left, right, &result))) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return result;
-  }
 
-  template <typename T, typename Arg0, typename Arg1>
-  enable_if_floating_point<T> Call(KernelContext*, Arg0 left, Arg1 right) {
-    static_assert(std::is_same<T, Arg0>::value && std::is_same<T, Arg1>::value, "");
+  template <typename T>
+  static enable_if_decimal_value<T> Call(KernelContext*, T left, T right) {
     return left * right;
   }
 };
@@ -207,6 +175,17 @@ struct Divide {
     }
     return result;
   }
+
+  // The dividend has been scaled up so that the quotient, truncated towards
+  // zero, has the output scale
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_decimal_value<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
+    if (ARROW_PREDICT_FALSE(right == Arg1())) {
+      ctx->SetStatus(Status::Invalid("divide by zero"));
+      return T();
+    }
+    return left / right;
+  }
 };
 
 struct DivideChecked {
@@ -233,6 +212,11 @@ struct DivideChecked {
     }
     return left / right;
   }
+
+  template <typename T, typename Arg0, typename Arg1>
+  static enable_if_decimal_value<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
+    return Divide::Call<T>(ctx, left, right);
+  }
 };
 
 struct Power {
@@ -330,11 +314,67 @@ ArrayKernelExec NumericEqualTypesBinary(detail::GetTypeId get_id) {
   }
 }
 
+Result<std::shared_ptr<DataType>> MakeDecimal(Type::type id, int32_t precision,
+                                              int32_t scale) {
+  if (id == Type::DECIMAL128) {
+    return Decimal128Type::Make(precision, scale);
+  }
+  return Decimal256Type::Make(precision, scale);
+}
+
+// Cast two decimal arguments to the types expected by the kernels of
+// `func_name`: of the same width and, for addition and subtraction, of the same
+// scale, or for division with the dividend scaled up, so that the quotient of
+// the values is at the output scale.  The precisions are increased to keep the
+// values exact.
+Status CastBinaryDecimalArgs(const std::string& func_name,
+                             std::vector<ValueDescr>* values) {
+  auto& left_type = (*values)[0].type;
+  auto& right_type = (*values)[1].type;
+  if (left_type->id() == Type::NA) {
+    left_type = right_type;
+  } else if (right_type->id() == Type::NA) {
+    right_type = left_type;
+  }
+  if (!is_decimal(left_type->id()) || !is_decimal(right_type->id())) {
+    // Decimals are only computed with decimals
+    return Status::OK();
+  }
+
+  const auto id = (left_type->id() == Type::DECIMAL256 ||
+                   right_type->id() == Type::DECIMAL256)
+                      ? Type::DECIMAL256
+                      : Type::DECIMAL128;
+  int32_t p1 = checked_cast<const DecimalType&>(*left_type).precision();
+  int32_t s1 = checked_cast<const DecimalType&>(*left_type).scale();
+  int32_t p2 = checked_cast<const DecimalType&>(*right_type).precision();
+  int32_t s2 = checked_cast<const DecimalType&>(*right_type).scale();
+
+  const std::string op = func_name.substr(0, func_name.find('_'));
+  if (op == "add" || op == "subtract") {
+    const int32_t scale = std::max(s1, s2);
+    p1 += scale - s1;
+    p2 += scale - s2;
+    s1 = s2 = scale;
+  } else if (op == "divide") {
+    // The output scale is at least 4, and enough for the digits of the divisor
+    const int32_t scale_up = std::max(4, s1 + p2 - s2 + 1) + s2 - s1;
+    p1 += scale_up;
+    s1 += scale_up;
+  } else if (op != "multiply") {
+    return Status::Invalid("Invalid decimal function: ", func_name);
+  }
+  ARROW_ASSIGN_OR_RAISE(left_type, MakeDecimal(id, p1, s1));
+  ARROW_ASSIGN_OR_RAISE(right_type, MakeDecimal(id, p2, s2));
+  return Status::OK();
+}
+
 struct ArithmeticFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
   Result<const Kernel*> DispatchBest(std::vector<ValueDescr>* values) const override {
     RETURN_NOT_OK(CheckArity(*values));
+    RETURN_NOT_OK(CheckDecimals(values));
 
     using arrow::compute::detail::DispatchExactImpl;
     if (auto kernel = DispatchExactImpl(this, *values)) return kernel;
@@ -349,8 +389,64 @@ struct ArithmeticFunction : ScalarFunction {
     if (auto kernel = DispatchExactImpl(this, *values)) return kernel;
     return arrow::compute::detail::NoMatchingKernel(this, *values);
   }
+
+  Status CheckDecimals(std::vector<ValueDescr>* values) const {
+    const bool has_decimal =
+        std::any_of(values->begin(), values->end(), [](const ValueDescr& value) {
+          return is_decimal(value.type->id());
+        });
+    if (has_decimal && values->size() == 2) {
+      return CastBinaryDecimalArgs(name(), values);
+    }
+    return Status::OK();
+  }
 };
 
+// Output types of the decimal kernels, whose arguments have been cast by
+// CastBinaryDecimalArgs
+
+Result<ValueDescr> ResolveDecimalAdditionOrSubtractionOutput(
+    KernelContext*, const std::vector<ValueDescr>& args) {
+  const auto& left_type = checked_cast<const DecimalType&>(*args[0].type);
+  const auto& right_type = checked_cast<const DecimalType&>(*args[1].type);
+  DCHECK_EQ(left_type.scale(), right_type.scale());
+  const int32_t precision = std::max(left_type.precision(), right_type.precision()) + 1;
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        MakeDecimal(left_type.id(), precision, left_type.scale()));
+  return ValueDescr(std::move(type));
+}
+
+Result<ValueDescr> ResolveDecimalMultiplicationOutput(
+    KernelContext*, const std::vector<ValueDescr>& args) {
+  const auto& left_type = checked_cast<const DecimalType&>(*args[0].type);
+  const auto& right_type = checked_cast<const DecimalType&>(*args[1].type);
+  const int32_t precision = left_type.precision() + right_type.precision() + 1;
+  const int32_t scale = left_type.scale() + right_type.scale();
+  ARROW_ASSIGN_OR_RAISE(auto type, MakeDecimal(left_type.id(), precision, scale));
+  return ValueDescr(std::move(type));
+}
+
+Result<ValueDescr> ResolveDecimalDivisionOutput(KernelContext*,
+                                                const std::vector<ValueDescr>& args) {
+  const auto& left_type = checked_cast<const DecimalType&>(*args[0].type);
+  const auto& right_type = checked_cast<const DecimalType&>(*args[1].type);
+  const int32_t scale = left_type.scale() - right_type.scale();
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        MakeDecimal(left_type.id(), left_type.precision(), scale));
+  return ValueDescr(std::move(type));
+}
+
+template <template <typename... Args> class KernelGenerator, typename Op>
+void AddDecimalBinaryKernels(OutputType::Resolver resolver, ScalarFunction* func) {
+  const OutputType out_type(std::move(resolver));
+  const InputType in_type128(Type::DECIMAL128);
+  const InputType in_type256(Type::DECIMAL256);
+  DCHECK_OK(func->AddKernel({in_type128, in_type128}, out_type,
+                            KernelGenerator<Decimal128Type, Decimal128Type, Op>::Exec));
+  DCHECK_OK(func->AddKernel({in_type256, in_type256}, out_type,
+                            KernelGenerator<Decimal256Type, Decimal256Type, Op>::Exec));
+}
+
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
                                                        const FunctionDoc* doc) {
@@ -362,6 +458,29 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
   return func;
 }
 
+// Like MakeArithmeticFunction, but for the checked ops that report overflow
+// a batch at a time, with SIMD variants of their kernels.
+template <typename Op>
+std::shared_ptr<ScalarFunction> MakeCheckedArithmeticFunction(std::string name,
+                                                              const FunctionDoc* doc) {
+  auto func = std::make_shared<ArithmeticFunction>(name, Arity::Binary(), doc);
+  AddCheckedArithmeticKernels<Op, SimdLevel::NONE>(func.get());
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+    AddCheckedArithmeticAvx2Kernels<Op>(func.get());
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+    AddCheckedArithmeticAvx512Kernels<Op>(func.get());
+  }
+#endif
+  return func;
+}
+
 // Like MakeArithmeticFunction, but for arithmetic ops that need to run
 // only on non-null output.
 template <typename Op>
@@ -442,11 +561,17 @@ const FunctionDoc pow_checked_doc{
 void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   auto add = MakeArithmeticFunction<Add>("add", &add_doc);
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Add>(
+      ResolveDecimalAdditionOrSubtractionOutput, add.get());
   DCHECK_OK(registry->AddFunction(std::move(add)));
 
   // ----------------------------------------------------------------------
   auto add_checked =
-      MakeArithmeticFunctionNotNull<AddChecked>("add_checked", &add_checked_doc);
+      MakeCheckedArithmeticFunction<AddChecked>("add_checked", &add_checked_doc);
+  // Decimal results cannot overflow their precision, which the output type has
+  // room for
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Add>(
+      ResolveDecimalAdditionOrSubtractionOutput, add_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(add_checked)));
 
   // ----------------------------------------------------------------------
@@ -460,30 +585,42 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
         NumericEqualTypesBinary<ScalarBinaryEqualTypes, Subtract>(Type::TIMESTAMP);
     DCHECK_OK(subtract->AddKernel({in_type, in_type}, duration(unit), std::move(exec)));
   }
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Subtract>(
+      ResolveDecimalAdditionOrSubtractionOutput, subtract.get());
 
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
 
   // ----------------------------------------------------------------------
-  auto subtract_checked = MakeArithmeticFunctionNotNull<SubtractChecked>(
+  auto subtract_checked = MakeCheckedArithmeticFunction<SubtractChecked>(
       "subtract_checked", &sub_checked_doc);
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Subtract>(
+      ResolveDecimalAdditionOrSubtractionOutput, subtract_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(subtract_checked)));
 
   // ----------------------------------------------------------------------
   auto multiply = MakeArithmeticFunction<Multiply>("multiply", &mul_doc);
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Multiply>(
+      ResolveDecimalMultiplicationOutput, multiply.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
-  auto multiply_checked = MakeArithmeticFunctionNotNull<MultiplyChecked>(
+  auto multiply_checked = MakeCheckedArithmeticFunction<MultiplyChecked>(
       "multiply_checked", &mul_checked_doc);
+  AddDecimalBinaryKernels<ScalarBinaryEqualTypes, Multiply>(
+      ResolveDecimalMultiplicationOutput, multiply_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply_checked)));
 
   // ----------------------------------------------------------------------
   auto divide = MakeArithmeticFunctionNotNull<Divide>("divide", &div_doc);
+  AddDecimalBinaryKernels<ScalarBinaryNotNullEqualTypes, Divide>(
+      ResolveDecimalDivisionOutput, divide.get());
   DCHECK_OK(registry->AddFunction(std::move(divide)));
 
   // ----------------------------------------------------------------------
   auto divide_checked =
       MakeArithmeticFunctionNotNull<DivideChecked>("divide_checked", &div_checked_doc);
+  AddDecimalBinaryKernels<ScalarBinaryNotNullEqualTypes, DivideChecked>(
+      ResolveDecimalDivisionOutput, divide_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(divide_checked)));
 
   // ----------------------------------------------------------------------
@@ -0,0 +1,269 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/int_util_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// Checked arithmetic operators
+//
+// Call() always returns the wrapped around result and ORs an overflow flag
+// into `*overflow` rather than branching on it, so that loops over it can be
+// vectorized by the compiler.
+
+struct AddChecked {
+  template <typename T>
+  static enable_if_t<std::is_unsigned<T>::value, T> Call(T left, T right,
+                                                         uint8_t* overflow) {
+    const T result = static_cast<T>(left + right);
+    *overflow |= result < left;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_signed<T>::value && std::is_integral<T>::value, T> Call(
+      T left, T right, uint8_t* overflow) {
+    using Unsigned = typename std::make_unsigned<T>::type;
+    const T result =
+        static_cast<T>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+    // Overflow iff both operands have a sign different from the result's
+    *overflow |= ((left ^ result) & (right ^ result)) < 0;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right,
+                                                               uint8_t*) {
+    return left + right;
+  }
+};
+
+struct SubtractChecked {
+  template <typename T>
+  static enable_if_t<std::is_unsigned<T>::value, T> Call(T left, T right,
+                                                         uint8_t* overflow) {
+    *overflow |= left < right;
+    return static_cast<T>(left - right);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_signed<T>::value && std::is_integral<T>::value, T> Call(
+      T left, T right, uint8_t* overflow) {
+    using Unsigned = typename std::make_unsigned<T>::type;
+    const T result =
+        static_cast<T>(static_cast<Unsigned>(left) - static_cast<Unsigned>(right));
+    // Overflow iff the operands have different signs and the result's sign
+    // differs from the left operand's
+    *overflow |= ((left ^ right) & (left ^ result)) < 0;
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right,
+                                                               uint8_t*) {
+    return left - right;
+  }
+};
+
+struct MultiplyChecked {
+  // The product of narrow integers is computed exactly in 64 bits
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value && (sizeof(T) < 8), T> Call(
+      T left, T right, uint8_t* overflow) {
+    using Wide = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                           uint64_t>::type;
+    const Wide wide = static_cast<Wide>(left) * static_cast<Wide>(right);
+    const T result = static_cast<T>(wide);
+    *overflow |= wide != static_cast<Wide>(result);
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value && (sizeof(T) == 8), T> Call(
+      T left, T right, uint8_t* overflow) {
+    T result = 0;
+    *overflow |= arrow::internal::MultiplyWithOverflow(left, right, &result);
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right,
+                                                               uint8_t*) {
+    return left * right;
+  }
+};
+
+// Add the kernels for numeric types with the given SIMD level
+template <typename Op, SimdLevel::type kSimdLevel>
+void AddCheckedArithmeticKernels(ScalarFunction* func);
+
+// SIMD variants for kernels
+template <typename Op>
+void AddCheckedArithmeticAvx2Kernels(ScalarFunction* func);
+
+template <typename Op>
+void AddCheckedArithmeticAvx512Kernels(ScalarFunction* func);
+
+// ----------------------------------------------------------------------
+// Checked arithmetic on numeric values
+
+// Compute the checked operation on all the output values, but only report
+// overflow on non-null slots, like ScalarBinaryNotNull does.  Blocks without
+// nulls go through a branch-free loop.  The SimdLevel template parameter
+// keeps apart the instantiations of the translation units compiled with
+// different flags.
+template <typename Type, typename Op, SimdLevel::type kSimdLevel>
+struct CheckedArithmetic {
+  using T = typename Type::c_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    uint8_t overflow = 0;
+    if (batch[0].is_scalar() && batch[1].is_scalar()) {
+      const Scalar& left = *batch[0].scalar();
+      const Scalar& right = *batch[1].scalar();
+      if (left.is_valid && right.is_valid) {
+        BoxScalar<Type>::Box(Op::Call(UnboxScalar<Type>::Unbox(left),
+                                      UnboxScalar<Type>::Unbox(right), &overflow),
+                             out->scalar().get());
+      }
+    } else if (batch.selection_vector != nullptr) {
+      overflow = ExecRows(batch, out->mutable_array(),
+                          SelectedRows(*batch.selection_vector));
+    } else {
+      overflow = ExecRows(batch, out->mutable_array(), AllRows{});
+    }
+    if (overflow) {
+      ctx->SetStatus(Status::Invalid("overflow"));
+    }
+  }
+
+ private:
+  // Returns non-zero if any non-null slot overflowed
+  template <typename Rows>
+  static uint8_t ExecRows(const ExecBatch& batch, ArrayData* out_arr, Rows rows) {
+    T* out_values = out_arr->GetMutableValues<T>(1);
+    if (batch[1].is_scalar()) {
+      const T* left_values = batch[0].array()->GetValues<T>(1);
+      const T right_value = UnboxScalar<Type>::Unbox(*batch[1].scalar());
+      return Compute(
+          *out_arr, [&](int64_t i) { return left_values[rows(i)]; },
+          [&](int64_t) { return right_value; }, out_values);
+    } else if (batch[0].is_scalar()) {
+      const T left_value = UnboxScalar<Type>::Unbox(*batch[0].scalar());
+      const T* right_values = batch[1].array()->GetValues<T>(1);
+      return Compute(
+          *out_arr, [&](int64_t) { return left_value; },
+          [&](int64_t i) { return right_values[rows(i)]; }, out_values);
+    } else {
+      const T* left_values = batch[0].array()->GetValues<T>(1);
+      const T* right_values = batch[1].array()->GetValues<T>(1);
+      return Compute(
+          *out_arr, [&](int64_t i) { return left_values[rows(i)]; },
+          [&](int64_t i) { return right_values[rows(i)]; }, out_values);
+    }
+  }
+
+  // The output validity bitmap, already populated by the executor, tells which
+  // slots to check
+  template <typename Left, typename Right>
+  static uint8_t Compute(const ArrayData& out_arr, Left&& left, Right&& right, T* out) {
+    const uint8_t* out_bitmap = out_arr.GetValues<uint8_t>(0, 0);
+    const int64_t length = out_arr.length;
+
+    uint8_t overflow = 0;
+    arrow::internal::OptionalBitBlockCounter bit_counter(out_bitmap, out_arr.offset,
+                                                         length);
+    int64_t position = 0;
+    while (position < length) {
+      const auto block = bit_counter.NextBlock();
+      const int64_t block_end = position + block.length;
+      if (block.AllSet()) {
+        uint8_t block_overflow = 0;
+        for (int64_t i = position; i < block_end; ++i) {
+          out[i] = Op::Call(left(i), right(i), &block_overflow);
+        }
+        overflow |= block_overflow;
+      } else if (block.NoneSet()) {
+        std::memset(out + position, 0, block.length * sizeof(T));
+      } else {
+        for (int64_t i = position; i < block_end; ++i) {
+          if (BitUtil::GetBit(out_bitmap, out_arr.offset + i)) {
+            out[i] = Op::Call(left(i), right(i), &overflow);
+          } else {
+            out[i] = T{};
+          }
+        }
+      }
+      position = block_end;
+    }
+    return overflow;
+  }
+};
+
+template <typename Op, SimdLevel::type kSimdLevel>
+ArrayKernelExec GenerateCheckedArithmetic(detail::GetTypeId get_id) {
+  switch (get_id.id) {
+    case Type::INT8:
+      return CheckedArithmetic<Int8Type, Op, kSimdLevel>::Exec;
+    case Type::UINT8:
+      return CheckedArithmetic<UInt8Type, Op, kSimdLevel>::Exec;
+    case Type::INT16:
+      return CheckedArithmetic<Int16Type, Op, kSimdLevel>::Exec;
+    case Type::UINT16:
+      return CheckedArithmetic<UInt16Type, Op, kSimdLevel>::Exec;
+    case Type::INT32:
+      return CheckedArithmetic<Int32Type, Op, kSimdLevel>::Exec;
+    case Type::UINT32:
+      return CheckedArithmetic<UInt32Type, Op, kSimdLevel>::Exec;
+    case Type::INT64:
+      return CheckedArithmetic<Int64Type, Op, kSimdLevel>::Exec;
+    case Type::UINT64:
+      return CheckedArithmetic<UInt64Type, Op, kSimdLevel>::Exec;
+    case Type::FLOAT:
+      return CheckedArithmetic<FloatType, Op, kSimdLevel>::Exec;
+    case Type::DOUBLE:
+      return CheckedArithmetic<DoubleType, Op, kSimdLevel>::Exec;
+    default:
+      DCHECK(false);
+      return ExecFail;
+  }
+}
+
+template <typename Op, SimdLevel::type kSimdLevel>
+void AddCheckedArithmeticKernels(ScalarFunction* func) {
+  for (const auto& ty : NumericTypes()) {
+    ScalarKernel kernel({ty, ty}, ty, GenerateCheckedArithmetic<Op, kSimdLevel>(ty));
+    kernel.simd_level = kSimdLevel;
+    kernel.can_execute_selection = true;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
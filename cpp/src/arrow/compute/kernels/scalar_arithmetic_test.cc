@@ -358,6 +358,50 @@ TYPED_TEST(TestBinaryArithmeticIntegral, OverflowRaises) {
                           "overflow");
 }
 
+TYPED_TEST(TestBinaryArithmeticIntegral, OverflowRaisesLongArrays) {
+  using CType = typename TestFixture::CType;
+
+  auto max = std::numeric_limits<CType>::max();
+
+  this->SetOverflowCheck(true);
+
+  // Span several bit blocks, with and without nulls, so as to exercise
+  // the batched overflow checks
+  auto join = [](std::vector<std::string>::const_iterator begin,
+                 std::vector<std::string>::const_iterator end) {
+    return "[" +
+           ::arrow::internal::JoinStrings(std::vector<util::string_view>(begin, end),
+                                          ",") +
+           "]";
+  };
+  std::vector<std::string> values(300, "1"), expected(300, "2");
+  values[250] = std::to_string(max);
+  auto left = ArrayFromJSON(this->type_singleton(), join(values.begin(), values.end()));
+  std::fill(values.begin(), values.end(), "1");
+  auto right = ArrayFromJSON(this->type_singleton(), join(values.begin(), values.end()));
+  ASSERT_OK_AND_ASSIGN(auto one, right->GetScalar(0));
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("overflow"),
+                                  Add(left, right, this->options_));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("overflow"),
+      Add(left->Slice(3, 290), right->Slice(5, 290), this->options_));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("overflow"),
+                                  Add(left->Slice(3), one, this->options_));
+
+  // No overflow is reported when the overflowing slot is null
+  left = TweakValidityBit(left, 250, false);
+  expected[250] = "null";
+  this->AssertBinop(Add, left, right, join(expected.begin(), expected.end()));
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       Add(left->Slice(3, 290), right->Slice(5, 290), this->options_));
+  this->ValidateAndAssertApproxEqual(actual.make_array(),
+                                     join(expected.begin() + 3, expected.begin() + 293));
+  ASSERT_OK_AND_ASSIGN(actual, Add(left->Slice(3), one, this->options_));
+  this->ValidateAndAssertApproxEqual(actual.make_array(),
+                                     join(expected.begin() + 3, expected.end()));
+}
+
 TYPED_TEST(TestBinaryArithmeticSigned, AddOverflowRaises) {
   using CType = typename TestFixture::CType;
 
@@ -817,5 +861,69 @@ TEST(TestBinaryArithmetic, AddWithImplicitCastsUint64EdgeCase) {
                                      ArrayFromJSON(uint64(), "[18446744073709551615]")}));
 }
 
+TEST(TestBinaryArithmeticDecimal, DispatchBest) {
+  // Addition and subtraction rescale to the larger scale
+  for (std::string name : {"add", "subtract", "add_checked", "subtract_checked"}) {
+    CheckDispatchBest(name, {decimal128(4, 2), decimal128(5, 3)},
+                      {decimal128(5, 3), decimal128(5, 3)});
+    CheckDispatchBest(name, {decimal128(4, 2), decimal256(5, 3)},
+                      {decimal256(5, 3), decimal256(5, 3)});
+    CheckDispatchBest(name, {decimal128(4, 2), null()},
+                      {decimal128(4, 2), decimal128(4, 2)});
+  }
+  // Multiplication only widens
+  CheckDispatchBest("multiply", {decimal128(4, 2), decimal256(5, 3)},
+                    {decimal256(4, 2), decimal256(5, 3)});
+  // Division scales up the dividend, for a quotient with at least 4 digits after the
+  // decimal point
+  CheckDispatchBest("divide", {decimal128(4, 2), decimal128(3, 1)},
+                    {decimal128(8, 6), decimal128(3, 1)});
+}
+
+TEST(TestBinaryArithmeticDecimal, AddSubtract) {
+  for (std::string suffix : {"", "_checked"}) {
+    for (const auto& make : {decimal128, decimal256}) {
+      CheckScalarBinary(
+          "add" + suffix,
+          ArrayFromJSON(make(4, 2), R"(["12.34", "-0.01", null, "99.99"])"),
+          ArrayFromJSON(make(5, 3), R"(["1.005", "0.001", "1.000", "99.999"])"),
+          ArrayFromJSON(make(6, 3), R"(["13.345", "-0.009", null, "199.989"])"));
+      CheckScalarBinary(
+          "subtract" + suffix,
+          ArrayFromJSON(make(4, 2), R"(["12.34", "-0.01", null, "-99.99"])"),
+          ArrayFromJSON(make(5, 3), R"(["1.005", "0.001", "1.000", "99.999"])"),
+          ArrayFromJSON(make(6, 3), R"(["11.335", "-0.011", null, "-199.989"])"));
+    }
+  }
+}
+
+TEST(TestBinaryArithmeticDecimal, Multiply) {
+  for (std::string suffix : {"", "_checked"}) {
+    for (const auto& make : {decimal128, decimal256}) {
+      CheckScalarBinary("multiply" + suffix,
+                        ArrayFromJSON(make(4, 2), R"(["12.34", "-0.01", null, "99.99"])"),
+                        ArrayFromJSON(make(3, 1), R"(["10.0", "5.5", "1.0", "-99.9"])"),
+                        ArrayFromJSON(make(8, 3), R"(["123.400", "-0.055", null,
+                                                    "-9989.001"])"));
+    }
+  }
+}
+
+TEST(TestBinaryArithmeticDecimal, Divide) {
+  for (std::string suffix : {"", "_checked"}) {
+    for (const auto& make : {decimal128, decimal256}) {
+      CheckScalarBinary("divide" + suffix,
+                        ArrayFromJSON(make(4, 2), R"(["12.34", "-1.00", null, "10.00"])"),
+                        ArrayFromJSON(make(3, 1), R"(["2.0", "3.0", "1.0", "-0.3"])"),
+                        ArrayFromJSON(make(8, 5), R"(["6.17000", "-0.33333", null,
+                                                    "-33.33333"])"));
+      ASSERT_RAISES(Invalid,
+                    CallFunction("divide" + suffix,
+                                 {ArrayFromJSON(make(4, 2), R"(["1.00"])"),
+                                  ArrayFromJSON(make(4, 2), R"(["0.00"])")}));
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/extension_type.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -196,6 +197,27 @@ void CastFromExtension(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   out->value = casted_storage.array();
 }
 
+void CastFromRunEndEncoded(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const CastOptions& options = checked_cast<const CastState*>(ctx->state())->options;
+  const ArrayData& input = *batch[0].array();
+
+  // Cast the values of the runs only, then expand them
+  auto values =
+      ree_util::ValuesArray(input).Slice(ree_util::FindPhysicalOffset(input),
+                                         ree_util::FindPhysicalLength(input));
+  Datum casted_values;
+  KERNEL_ASSIGN_OR_RAISE(
+      casted_values, ctx,
+      Cast(Datum(std::move(values)), out->type(), options, ctx->exec_context()));
+  std::shared_ptr<ArrayData> run_ends;
+  KERNEL_ASSIGN_OR_RAISE(run_ends, ctx,
+                         ree_util::MakeLogicalRunEnds(input, ctx->memory_pool()));
+  auto casted = ArrayData::Make(run_end_encoded(run_ends->type, out->type()),
+                                input.length, {nullptr},
+                                {run_ends, casted_values.array()}, /*null_count=*/0);
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx, RunEndDecode(Datum(casted), ctx->exec_context()));
+}
+
 void CastFromNull(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   if (batch[0].is_scalar()) return;
 
@@ -272,6 +294,12 @@ void AddCommonCasts(Type::type out_type_id, OutputType out_ty, CastFunction* fun
   DCHECK_OK(func->AddKernel(Type::EXTENSION, {InputType::Array(Type::EXTENSION)}, out_ty,
                             CastFromExtension, NullHandling::COMPUTED_NO_PREALLOCATE,
                             MemAllocation::NO_PREALLOCATE));
+
+  // From run-end encoded to this type
+  DCHECK_OK(func->AddKernel(Type::RUN_END_ENCODED,
+                            {InputType::Array(Type::RUN_END_ENCODED)}, out_ty,
+                            CastFromRunEndEncoded, NullHandling::COMPUTED_NO_PREALLOCATE,
+                            MemAllocation::NO_PREALLOCATE));
 }
 
 }  // namespace internal
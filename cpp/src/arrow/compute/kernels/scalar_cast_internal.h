@@ -22,6 +22,7 @@
 #include "arrow/compute/cast_internal.h"  // IWYU pragma: export
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow {
 
@@ -42,10 +43,31 @@ struct CastFunctor<
 
 void CastFromExtension(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
+void CastFromRunEndEncoded(KernelContext* ctx, const ExecBatch& batch, Datum* out);
+
 // Utility for numeric casts
 void CastNumberToNumberUnsafe(Type::type in_type, Type::type out_type, const Datum& input,
                               Datum* out);
 
+// Utility for casts from strings, which parses all valid values of the input at
+// once into the preallocated output
+template <typename OutType, typename InType>
+Status ParseStrings(const OutType& out_type, const ArrayData& input, ArrayData* output) {
+  using offset_type = typename InType::offset_type;
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const uint8_t* data = input.GetValues<uint8_t>(2, /*absolute_offset=*/0);
+  const int64_t failed = ::arrow::internal::ParseValues(
+      out_type, offsets, data, input.GetValues<uint8_t>(0, 0), input.offset,
+      input.length, output->GetMutableValues<typename OutType::c_type>(1));
+  if (ARROW_PREDICT_FALSE(failed != input.length)) {
+    const util::string_view val(reinterpret_cast<const char*>(data) + offsets[failed],
+                                offsets[failed + 1] - offsets[failed]);
+    return Status::Invalid("Failed to parse string: '", val, "' as a scalar of type ",
+                           out_type.ToString());
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Dictionary to other things
 
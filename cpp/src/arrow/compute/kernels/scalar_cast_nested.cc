@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// Implementation of casting to (or between) list types
+// Implementation of casting to (or between) list, struct and run-end encoded types
 
+#include <limits>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -25,7 +27,11 @@
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ree_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -34,18 +40,43 @@ using internal::CopyBitmap;
 namespace compute {
 namespace internal {
 
-template <typename Type>
+// The validity bitmap of a sliced array, for an output starting at offset 0.  The
+// bitmap is shared when the slice starts on a byte boundary.
+Result<std::shared_ptr<Buffer>> UnslicedValidity(KernelContext* ctx,
+                                                 const ArrayData& in_array) {
+  if (in_array.buffers[0] == nullptr) {
+    return std::shared_ptr<Buffer>();
+  }
+  if (in_array.offset % 8 == 0) {
+    return SliceBuffer(in_array.buffers[0], in_array.offset / 8,
+                       BitUtil::BytesForBits(in_array.length));
+  }
+  return CopyBitmap(ctx->memory_pool(), in_array.buffers[0]->data(), in_array.offset,
+                    in_array.length);
+}
+
+// Rebase list offsets to start at zero while converting them to the output offset
+// type.  The iterations are independent so that the compiler vectorizes the loop.
+template <typename SrcOffsetType, typename DestOffsetType>
+void RebaseOffsets(const SrcOffsetType* src, int64_t length, DestOffsetType* dest) {
+  const SrcOffsetType base = src[0];
+  for (int64_t i = 0; i < length + 1; ++i) {
+    dest[i] = static_cast<DestOffsetType>(src[i] - base);
+  }
+}
+
+template <typename SrcType, typename DestType>
 void CastListExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-  using offset_type = typename Type::offset_type;
-  using ScalarType = typename TypeTraits<Type>::ScalarType;
+  using src_offset_type = typename SrcType::offset_type;
+  using dest_offset_type = typename DestType::offset_type;
 
   const CastOptions& options = CastState::Get(ctx);
 
-  auto child_type = checked_cast<const Type&>(*out->type()).value_type();
+  auto child_type = checked_cast<const DestType&>(*out->type()).value_type();
 
   if (out->kind() == Datum::SCALAR) {
-    const auto& in_scalar = checked_cast<const ScalarType&>(*batch[0].scalar());
-    auto out_scalar = checked_cast<ScalarType*>(out->scalar().get());
+    const auto& in_scalar = checked_cast<const BaseListScalar&>(*batch[0].scalar());
+    auto out_scalar = checked_cast<BaseListScalar*>(out->scalar().get());
 
     DCHECK(!out_scalar->is_valid);
     if (in_scalar.is_valid) {
@@ -60,41 +91,194 @@ void CastListExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
 
   const ArrayData& in_array = *batch[0].array();
   ArrayData* out_array = out->mutable_array();
+  std::shared_ptr<ArrayData> values = in_array.child_data[0];
 
-  // Copy from parent
-  out_array->buffers = in_array.buffers;
-  Datum values = in_array.child_data[0];
-
-  if (in_array.offset != 0) {
-    KERNEL_ASSIGN_OR_RAISE(out_array->buffers[0], ctx,
-                           CopyBitmap(ctx->memory_pool(), in_array.buffers[0]->data(),
-                                      in_array.offset, in_array.length));
-    KERNEL_ASSIGN_OR_RAISE(out_array->buffers[1], ctx,
-                           ctx->Allocate(sizeof(offset_type) * (in_array.length + 1)));
-
-    auto offsets = in_array.GetValues<offset_type>(1);
-    auto shifted_offsets = out_array->GetMutableValues<offset_type>(1);
-
-    for (int64_t i = 0; i < in_array.length + 1; ++i) {
-      shifted_offsets[i] = offsets[i] - offsets[0];
+  if (std::is_same<src_offset_type, dest_offset_type>::value &&
+      (in_array.offset == 0 || values->type->Equals(*child_type))) {
+    // Zero-copy: the validity bitmap and the offsets are reused, and so are the
+    // values unless their type changes
+    out_array->buffers = in_array.buffers;
+    out_array->offset = in_array.offset;
+  } else {
+    // Rebase the offsets of the slice, so that only the values it spans are cast
+    const auto* offsets = in_array.GetValues<src_offset_type>(1);
+    const src_offset_type first = offsets ? offsets[0] : 0;
+    const src_offset_type last = offsets ? offsets[in_array.length] : 0;
+    if (last - first > std::numeric_limits<dest_offset_type>::max()) {
+      ctx->SetStatus(Status::Invalid("Failed casting from ", *in_array.type, " to ",
+                                     *out->type(), ": input array too large"));
+      return;
+    }
+    out_array->buffers.resize(2);
+    KERNEL_ASSIGN_OR_RAISE(out_array->buffers[0], ctx, UnslicedValidity(ctx, in_array));
+    KERNEL_ASSIGN_OR_RAISE(
+        out_array->buffers[1], ctx,
+        ctx->Allocate(sizeof(dest_offset_type) * (in_array.length + 1)));
+    auto out_offsets = out_array->GetMutableValues<dest_offset_type>(1);
+    if (offsets) {
+      RebaseOffsets(offsets, in_array.length, out_offsets);
+    } else {
+      out_offsets[0] = 0;
     }
-    values = in_array.child_data[0]->Slice(offsets[0], offsets[in_array.length]);
+    values = values->Slice(first, last - first);
   }
+  out_array->null_count = in_array.null_count.load();
 
+  // Identical value types are passed through by Cast
   KERNEL_ASSIGN_OR_RAISE(Datum cast_values, ctx,
                          Cast(values, child_type, options, ctx->exec_context()));
 
   DCHECK_EQ(Datum::ARRAY, cast_values.kind());
-  out_array->child_data.push_back(cast_values.array());
+  out_array->child_data = {cast_values.array()};
 }
 
-template <typename Type>
+template <typename SrcType, typename DestType>
 void AddListCast(CastFunction* func) {
   ScalarKernel kernel;
-  kernel.exec = CastListExec<Type>;
-  kernel.signature = KernelSignature::Make({InputType(Type::type_id)}, kOutputTargetType);
+  kernel.exec = CastListExec<SrcType, DestType>;
+  kernel.signature =
+      KernelSignature::Make({InputType(SrcType::type_id)}, kOutputTargetType);
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(SrcType::type_id, std::move(kernel)));
+}
+
+// Number of fields to cast from which a struct cast runs the field casts in
+// parallel
+constexpr size_t kMinParallelStructFieldCasts = 4;
+
+// Cast between struct types with the same field names: only the fields whose type
+// changes are cast, the validity bitmap and the other fields are shared
+void CastStructExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const CastOptions& options = CastState::Get(ctx);
+  const auto& in_type = checked_cast<const StructType&>(*batch[0].type());
+  const auto& out_type = checked_cast<const StructType&>(*out->type());
+
+  bool same_names = in_type.num_fields() == out_type.num_fields();
+  for (int i = 0; same_names && i < in_type.num_fields(); ++i) {
+    same_names = in_type.field(i)->name() == out_type.field(i)->name();
+  }
+  if (!same_names) {
+    ctx->SetStatus(Status::TypeError("Cannot cast ", in_type, " to ", out_type,
+                                     ": struct field names do not match"));
+    return;
+  }
+
+  if (out->kind() == Datum::SCALAR) {
+    const auto& in_scalar = checked_cast<const StructScalar&>(*batch[0].scalar());
+    auto out_scalar = checked_cast<StructScalar*>(out->scalar().get());
+
+    if (in_scalar.is_valid) {
+      ScalarVector values(in_scalar.value.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        Datum value;
+        KERNEL_ASSIGN_OR_RAISE(
+            value, ctx,
+            Cast(in_scalar.value[i], out_type.field(static_cast<int>(i))->type(),
+                 options, ctx->exec_context()));
+        values[i] = value.scalar();
+      }
+      out_scalar->value = std::move(values);
+      out_scalar->is_valid = true;
+    }
+    return;
+  }
+
+  const ArrayData& in_array = *batch[0].array();
+  ArrayData* out_array = out->mutable_array();
+  out_array->buffers = in_array.buffers;
+  out_array->offset = in_array.offset;
+  out_array->null_count = in_array.null_count.load();
+  out_array->child_data = in_array.child_data;
+
+  std::vector<int> cast_fields;
+  for (int i = 0; i < out_type.num_fields(); ++i) {
+    if (!in_array.child_data[i]->type->Equals(*out_type.field(i)->type())) {
+      cast_fields.push_back(i);
+    }
+  }
+  if (cast_fields.empty()) return;
+
+  // Only the values of a slice are cast, the output then starts at offset 0
+  if (in_array.offset != 0) {
+    KERNEL_ASSIGN_OR_RAISE(out_array->buffers[0], ctx, UnslicedValidity(ctx, in_array));
+    out_array->offset = 0;
+    for (auto& child : out_array->child_data) {
+      child = child->Slice(in_array.offset, in_array.length);
+    }
+  }
+
+  auto cast_field = [&](int task) {
+    const int i = cast_fields[task];
+    ARROW_ASSIGN_OR_RAISE(
+        Datum cast_child,
+        Cast(out_array->child_data[i]->Slice(0, in_array.length),
+             out_type.field(i)->type(), options, ctx->exec_context()));
+    out_array->child_data[i] = cast_child.array();
+    return Status::OK();
+  };
+  // Wide structs cast their fields in parallel, but a worker of the CPU pool
+  // doesn't block waiting for its siblings
+  const bool use_threads = ctx->exec_context()->use_threads() &&
+                           cast_fields.size() >= kMinParallelStructFieldCasts &&
+                           !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+  KERNEL_RETURN_IF_ERROR(
+      ctx, ::arrow::internal::OptionalParallelFor(
+               use_threads, static_cast<int>(cast_fields.size()), cast_field));
+}
+
+void AddStructCast(CastFunction* func) {
+  ScalarKernel kernel;
+  kernel.exec = CastStructExec;
+  kernel.signature = KernelSignature::Make({InputType(Type::STRUCT)}, kOutputTargetType);
   kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
-  DCHECK_OK(func->AddKernel(Type::type_id, std::move(kernel)));
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(Type::STRUCT, std::move(kernel)));
+}
+
+// Cast to the run-end encoded type from the options: run-end encoded input is
+// cast run by run, other input is cast to the value type and then encoded
+void CastToRunEndEncoded(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const CastOptions& options = CastState::Get(ctx);
+  const auto& out_type = checked_cast<const RunEndEncodedType&>(*out->type());
+  const ArrayData& input = *batch[0].array();
+
+  if (input.type->id() != Type::RUN_END_ENCODED) {
+    Datum values;
+    KERNEL_ASSIGN_OR_RAISE(values, ctx,
+                           Cast(batch[0], out_type.value_type(), options,
+                                ctx->exec_context()));
+    RunEndEncodeOptions encode_options(out_type.run_end_type());
+    KERNEL_ASSIGN_OR_RAISE(*out, ctx,
+                           RunEndEncode(values, encode_options, ctx->exec_context()));
+    return;
+  }
+
+  std::shared_ptr<ArrayData> run_ends;
+  KERNEL_ASSIGN_OR_RAISE(run_ends, ctx,
+                         ree_util::MakeLogicalRunEnds(input, ctx->memory_pool()));
+  auto values =
+      ree_util::ValuesArray(input).Slice(ree_util::FindPhysicalOffset(input),
+                                         ree_util::FindPhysicalLength(input));
+  Datum casted_run_ends, casted_values;
+  KERNEL_ASSIGN_OR_RAISE(casted_run_ends, ctx,
+                         Cast(Datum(std::move(run_ends)), out_type.run_end_type(),
+                              CastOptions::Safe(), ctx->exec_context()));
+  KERNEL_ASSIGN_OR_RAISE(casted_values, ctx,
+                         Cast(Datum(std::move(values)), out_type.value_type(), options,
+                              ctx->exec_context()));
+  out->value = ArrayData::Make(out->type(), input.length, {nullptr},
+                               {casted_run_ends.array(), casted_values.array()},
+                               /*null_count=*/0);
+}
+
+void AddRunEndEncodedCast(CastFunction* func) {
+  for (int id = Type::NA; id < Type::MAX_ID; ++id) {
+    const auto in_type_id = static_cast<Type::type>(id);
+    DCHECK_OK(func->AddKernel(in_type_id, {InputType::Array(in_type_id)},
+                              kOutputTargetType, CastToRunEndEncoded,
+                              NullHandling::COMPUTED_NO_PREALLOCATE,
+                              MemAllocation::NO_PREALLOCATE));
+  }
 }
 
 std::vector<std::shared_ptr<CastFunction>> GetNestedCasts() {
@@ -102,23 +286,30 @@ std::vector<std::shared_ptr<CastFunction>> GetNestedCasts() {
 
   auto cast_list = std::make_shared<CastFunction>("cast_list", Type::LIST);
   AddCommonCasts(Type::LIST, kOutputTargetType, cast_list.get());
-  AddListCast<ListType>(cast_list.get());
+  AddListCast<ListType, ListType>(cast_list.get());
+  AddListCast<LargeListType, ListType>(cast_list.get());
 
   auto cast_large_list =
       std::make_shared<CastFunction>("cast_large_list", Type::LARGE_LIST);
   AddCommonCasts(Type::LARGE_LIST, kOutputTargetType, cast_large_list.get());
-  AddListCast<LargeListType>(cast_large_list.get());
+  AddListCast<LargeListType, LargeListType>(cast_large_list.get());
+  AddListCast<ListType, LargeListType>(cast_large_list.get());
 
   // FSL is a bit incomplete at the moment
   auto cast_fsl =
       std::make_shared<CastFunction>("cast_fixed_size_list", Type::FIXED_SIZE_LIST);
   AddCommonCasts(Type::FIXED_SIZE_LIST, kOutputTargetType, cast_fsl.get());
 
-  // So is struct
   auto cast_struct = std::make_shared<CastFunction>("cast_struct", Type::STRUCT);
   AddCommonCasts(Type::STRUCT, kOutputTargetType, cast_struct.get());
+  AddStructCast(cast_struct.get());
+
+  // Run-end encoded input to other types is handled by AddCommonCasts
+  auto cast_ree =
+      std::make_shared<CastFunction>("cast_run_end_encoded", Type::RUN_END_ENCODED);
+  AddRunEndEncodedCast(cast_ree.get());
 
-  return {cast_list, cast_large_list, cast_fsl, cast_struct};
+  return {cast_list, cast_large_list, cast_fsl, cast_struct, cast_ree};
 }
 
 }  // namespace internal
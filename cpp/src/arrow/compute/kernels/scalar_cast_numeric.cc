@@ -31,7 +31,6 @@ using internal::BitBlockCount;
 using internal::CheckIntegersInRange;
 using internal::IntegersCanFit;
 using internal::OptionalBitBlockCounter;
-using internal::ParseValue;
 
 namespace compute {
 namespace internal {
@@ -277,24 +276,12 @@ struct CastFunctor<O, BooleanType, enable_if_number<O>> {
 // ----------------------------------------------------------------------
 // String to number
 
-template <typename OutType>
-struct ParseString {
-  template <typename OutValue, typename Arg0Value>
-  OutValue Call(KernelContext* ctx, Arg0Value val) const {
-    OutValue result = OutValue(0);
-    if (ARROW_PREDICT_FALSE(!ParseValue<OutType>(val.data(), val.size(), &result))) {
-      ctx->SetStatus(Status::Invalid("Failed to parse string: '", val,
-                                     "' as a scalar of type ",
-                                     TypeTraits<OutType>::type_singleton()->ToString()));
-    }
-    return result;
-  }
-};
-
 template <typename O, typename I>
 struct CastFunctor<O, I, enable_if_base_binary<I>> {
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    applicator::ScalarUnaryNotNull<O, I, ParseString<O>>::Exec(ctx, batch, out);
+    const auto& out_type = checked_cast<const O&>(*out->type());
+    KERNEL_RETURN_IF_ERROR(
+        ctx, (ParseStrings<O, I>(out_type, *batch[0].array(), out->mutable_array())));
   }
 };
 
@@ -570,7 +557,8 @@ void AddCommonNumberCasts(const std::shared_ptr<DataType>& out_ty, CastFunction*
   // Cast from other strings
   for (const std::shared_ptr<DataType>& in_ty : BaseBinaryTypes()) {
     auto exec = GenerateVarBinaryBase<CastFunctor, OutType>(*in_ty);
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, exec));
+    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty,
+                              TrivialScalarUnaryAsArraysExec(exec)));
   }
 }
 
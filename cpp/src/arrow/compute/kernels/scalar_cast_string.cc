@@ -22,6 +22,7 @@
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/optional.h"
@@ -40,13 +41,11 @@ namespace internal {
 namespace {
 
 // ----------------------------------------------------------------------
-// Number / Boolean to String
+// Number / Boolean / Decimal to String
 
 template <typename O, typename I>
 struct NumericToStringCastFunctor {
-  using value_type = typename TypeTraits<I>::CType;
-  using BuilderType = typename TypeTraits<O>::BuilderType;
-  using FormatterType = StringFormatter<I>;
+  using offset_type = typename O::offset_type;
 
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     DCHECK(out->is_array());
@@ -56,18 +55,33 @@ struct NumericToStringCastFunctor {
   }
 
   static Status Convert(KernelContext* ctx, const ArrayData& input, ArrayData* output) {
-    FormatterType formatter(input.type);
-    BuilderType builder(input.type, ctx->memory_pool());
-    RETURN_NOT_OK(VisitArrayDataInline<I>(
-        input,
-        [&](value_type v) {
-          return formatter(v, [&](util::string_view v) { return builder.Append(v); });
-        },
-        [&]() { return builder.AppendNull(); }));
-
-    std::shared_ptr<Array> output_array;
-    RETURN_NOT_OK(builder.Finish(&output_array));
-    *output = std::move(*output_array->data());
+    // Format straight into the output buffers rather than through a builder,
+    // and carry over the validity bitmap as-is.
+    TypedBufferBuilder<offset_type> offsets_builder(ctx->memory_pool());
+    BufferBuilder data_builder(ctx->memory_pool());
+    RETURN_NOT_OK(offsets_builder.Append(0));
+    RETURN_NOT_OK(::arrow::internal::FormatArrayValues<I>(input, &offsets_builder,
+                                                          &data_builder));
+
+    std::shared_ptr<Buffer> validity;
+    if (input.MayHaveNulls()) {
+      if (input.offset == 0) {
+        validity = input.buffers[0];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            validity, ::arrow::internal::CopyBitmap(ctx->memory_pool(),
+                                                    input.buffers[0]->data(),
+                                                    input.offset, input.length));
+      }
+    }
+    std::shared_ptr<Buffer> offsets, data;
+    RETURN_NOT_OK(offsets_builder.Finish(&offsets));
+    RETURN_NOT_OK(data_builder.Finish(&data));
+
+    output->length = input.length;
+    output->offset = 0;
+    output->null_count = validity ? input.GetNullCount() : 0;
+    output->buffers = {std::move(validity), std::move(offsets), std::move(data)};
     return Status::OK();
   }
 };
@@ -173,6 +187,105 @@ void BinaryToBinaryCastExec(KernelContext* ctx, const ExecBatch& batch, Datum* o
 #pragma warning(pop)
 #endif
 
+// ----------------------------------------------------------------------
+// Binary-like to string view and back
+
+// The views reference the input data buffer when its offsets fit in the views,
+// so that only the 16-byte views are allocated.
+template <typename I>
+Status BinaryToStringView(KernelContext* ctx, const ArrayData& input,
+                          ArrayData* output) {
+  using offset_type = typename I::offset_type;
+  using c_type = StringViewType::c_type;
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  if (input.length > 0 &&
+      offsets[input.length] > std::numeric_limits<int32_t>::max()) {
+    // Too large to be referenced, copy the strings to new data buffers
+    StringViewBuilder builder(ctx->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(input.length));
+    RETURN_NOT_OK(VisitArrayDataInline<I>(
+        input, [&](util::string_view v) { return builder.Append(v); },
+        [&]() { return builder.AppendNull(); }));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    *output = std::move(*result);
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto views, ctx->Allocate(input.length * sizeof(c_type)));
+  auto out_views = reinterpret_cast<c_type*>(views->mutable_data());
+  const uint8_t* data = input.GetValues<uint8_t>(2, /*absolute_offset=*/0);
+  for (int64_t i = 0; i < input.length; ++i) {
+    const auto offset = static_cast<int32_t>(offsets[i]);
+    const auto length = static_cast<int32_t>(offsets[i + 1] - offsets[i]);
+    out_views[i] = StringViewBuilder::MakeView(data + offset, length,
+                                               /*buffer_index=*/0, offset);
+  }
+
+  std::shared_ptr<Buffer> null_bitmap = input.buffers[0];
+  if (null_bitmap != nullptr && input.offset != 0) {
+    ARROW_ASSIGN_OR_RAISE(null_bitmap, ::arrow::internal::CopyBitmap(
+                                           ctx->memory_pool(), null_bitmap->data(),
+                                           input.offset, input.length));
+  }
+  output->buffers = {std::move(null_bitmap), std::move(views)};
+  if (input.buffers[2] != nullptr) {
+    output->buffers.push_back(input.buffers[2]);
+  }
+  output->offset = 0;
+  output->null_count = input.null_count.load();
+  return Status::OK();
+}
+
+template <typename I>
+void BinaryToStringViewCastExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  DCHECK(out->is_array());
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArrayData& input = *batch[0].array();
+
+  if (!I::is_utf8 && !options.allow_invalid_utf8) {
+    InitializeUTF8();
+
+    ArrayDataVisitor<I> visitor;
+    Utf8Validator validator;
+    KERNEL_RETURN_IF_ERROR(ctx, visitor.Visit(input, &validator));
+  }
+  KERNEL_RETURN_IF_ERROR(ctx, BinaryToStringView<I>(ctx, input, out->mutable_array()));
+}
+
+template <typename O>
+Status StringViewToBinary(KernelContext* ctx, const ArrayData& input,
+                          ArrayData* output) {
+  using offset_type = typename O::offset_type;
+
+  int64_t total_length = 0;
+  VisitArrayDataInline<StringViewType>(
+      input, [&](util::string_view v) { total_length += v.size(); }, [] {});
+
+  typename TypeTraits<O>::BuilderType builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(input.length));
+  RETURN_NOT_OK(builder.ReserveData(total_length));
+  VisitArrayDataInline<StringViewType>(
+      input,
+      [&](util::string_view v) {
+        builder.UnsafeAppend(v.data(), static_cast<offset_type>(v.size()));
+      },
+      [&] { builder.UnsafeAppendNull(); });
+
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(builder.FinishInternal(&result));
+  *output = std::move(*result);
+  return Status::OK();
+}
+
+template <typename O>
+void StringViewToBinaryCastExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  DCHECK(out->is_array());
+  KERNEL_RETURN_IF_ERROR(
+      ctx, StringViewToBinary<O>(ctx, *batch[0].array(), out->mutable_array()));
+}
+
 // ----------------------------------------------------------------------
 // Cast functions registration
 
@@ -192,6 +305,17 @@ void AddNumberToStringCasts(CastFunction* func) {
                             GenerateNumeric<NumericToStringCastFunctor, OutType>(*in_ty)),
                         NullHandling::COMPUTED_NO_PREALLOCATE));
   }
+
+  DCHECK_OK(func->AddKernel(
+      Type::DECIMAL128, {InputType(Type::DECIMAL128)}, out_ty,
+      TrivialScalarUnaryAsArraysExec(
+          NumericToStringCastFunctor<OutType, Decimal128Type>::Exec),
+      NullHandling::COMPUTED_NO_PREALLOCATE));
+  DCHECK_OK(func->AddKernel(
+      Type::DECIMAL256, {InputType(Type::DECIMAL256)}, out_ty,
+      TrivialScalarUnaryAsArraysExec(
+          NumericToStringCastFunctor<OutType, Decimal256Type>::Exec),
+      NullHandling::COMPUTED_NO_PREALLOCATE));
 }
 
 template <typename OutType, typename InType>
@@ -211,6 +335,19 @@ void AddBinaryToBinaryCast(CastFunction* func) {
   AddBinaryToBinaryCast<OutType, BinaryType>(func);
   AddBinaryToBinaryCast<OutType, LargeStringType>(func);
   AddBinaryToBinaryCast<OutType, LargeBinaryType>(func);
+
+  DCHECK_OK(func->AddKernel(
+      Type::STRING_VIEW, {utf8_view()}, TypeTraits<OutType>::type_singleton(),
+      TrivialScalarUnaryAsArraysExec(StringViewToBinaryCastExec<OutType>),
+      NullHandling::COMPUTED_NO_PREALLOCATE));
+}
+
+template <typename InType>
+void AddBinaryToStringViewCast(CastFunction* func) {
+  DCHECK_OK(func->AddKernel(
+      InType::type_id, {TypeTraits<InType>::type_singleton()}, utf8_view(),
+      TrivialScalarUnaryAsArraysExec(BinaryToStringViewCastExec<InType>),
+      NullHandling::COMPUTED_NO_PREALLOCATE));
 }
 
 }  // namespace
@@ -241,7 +378,16 @@ std::vector<std::shared_ptr<CastFunction>> GetBinaryLikeCasts() {
   AddCommonCasts(Type::FIXED_SIZE_BINARY, OutputType(ResolveOutputFromOptions),
                  cast_fsb.get());
 
-  return {cast_binary, cast_large_binary, cast_string, cast_large_string, cast_fsb};
+  auto cast_string_view =
+      std::make_shared<CastFunction>("cast_string_view", Type::STRING_VIEW);
+  AddCommonCasts(Type::STRING_VIEW, utf8_view(), cast_string_view.get());
+  AddBinaryToStringViewCast<StringType>(cast_string_view.get());
+  AddBinaryToStringViewCast<BinaryType>(cast_string_view.get());
+  AddBinaryToStringViewCast<LargeStringType>(cast_string_view.get());
+  AddBinaryToStringViewCast<LargeBinaryType>(cast_string_view.get());
+
+  return {cast_binary,       cast_large_binary, cast_string,
+          cast_large_string, cast_fsb,          cast_string_view};
 }
 
 }  // namespace internal
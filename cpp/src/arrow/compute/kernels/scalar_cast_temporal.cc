@@ -28,8 +28,6 @@
 
 namespace arrow {
 
-using internal::ParseValue;
-
 namespace compute {
 namespace internal {
 
@@ -295,27 +293,12 @@ struct CastFunctor<TimestampType, Date64Type> {
 // ----------------------------------------------------------------------
 // String to Timestamp
 
-struct ParseTimestamp {
-  template <typename OutValue, typename Arg0Value>
-  OutValue Call(KernelContext* ctx, Arg0Value val) const {
-    OutValue result = 0;
-    if (ARROW_PREDICT_FALSE(!ParseValue(type, val.data(), val.size(), &result))) {
-      ctx->SetStatus(Status::Invalid("Failed to parse string: '", val,
-                                     "' as a scalar of type ", type.ToString()));
-    }
-    return result;
-  }
-
-  const TimestampType& type;
-};
-
 template <typename I>
 struct CastFunctor<TimestampType, I, enable_if_t<is_base_binary_type<I>::value>> {
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     const auto& out_type = checked_cast<const TimestampType&>(*out->type());
-    applicator::ScalarUnaryNotNullStateful<TimestampType, I, ParseTimestamp> kernel(
-        ParseTimestamp{out_type});
-    return kernel.Exec(ctx, batch, out);
+    KERNEL_RETURN_IF_ERROR(ctx, (ParseStrings<TimestampType, I>(
+                                    out_type, *batch[0].array(), out->mutable_array())));
   }
 };
 
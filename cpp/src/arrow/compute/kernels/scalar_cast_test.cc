@@ -26,7 +26,9 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/extension_type.h"
@@ -1472,6 +1474,13 @@ TEST(Cast, StringToInt) {
       auto options = CastOptions::Safe(uint8());
       CheckCastFails(ArrayFromJSON(string_type, "[\"" + not_uint8 + "\"]"), options);
     }
+
+    // The first unparseable value is reported, skipping nulls
+    auto strings =
+        ArrayFromJSON(string_type, R"(["x", "12345678", null, "123456789x", "y"])");
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("Failed to parse string: '123456789x'"),
+        Cast(strings->Slice(1), int64()));
   }
 }
 
@@ -1593,6 +1602,40 @@ TEST(Cast, BinaryOrStringToBinary) {
   }
 }
 
+TEST(Cast, BinaryOrStringToStringView) {
+  const char* json = R"(["", null, "short", "a value longer than the inline size"])";
+  for (auto from_type : {utf8(), large_utf8(), binary(), large_binary()}) {
+    CheckCast(ArrayFromJSON(from_type, "[]"), ArrayFromJSON(utf8_view(), "[]"));
+    CheckCast(ArrayFromJSON(from_type, json), ArrayFromJSON(utf8_view(), json));
+
+    // Sliced input
+    auto sliced = ArrayFromJSON(from_type, json)->Slice(1);
+    ASSERT_OK_AND_ASSIGN(auto views, Cast(*sliced, utf8_view()));
+    ASSERT_OK(views->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(utf8_view(), json)->Slice(1), *views);
+    // The views reference the data of the input
+    ASSERT_EQ(sliced->data()->buffers[2].get(), views->data()->buffers[2].get());
+  }
+
+  for (auto bin_type : {binary(), large_binary()}) {
+    auto options = CastOptions::Safe(utf8_view());
+    CheckCastFails(InvalidUtf8(bin_type), options);
+
+    options.allow_invalid_utf8 = true;
+    ASSERT_OK_AND_ASSIGN(auto strings,
+                         Cast(*InvalidUtf8(bin_type), utf8_view(), options));
+    ASSERT_RAISES(Invalid, strings->ValidateFull());
+  }
+}
+
+TEST(Cast, StringViewToBinaryOrString) {
+  const char* json = R"(["", null, "short", "a value longer than the inline size"])";
+  for (auto to_type : {utf8(), large_utf8(), binary(), large_binary()}) {
+    CheckCast(ArrayFromJSON(utf8_view(), "[]"), ArrayFromJSON(to_type, "[]"));
+    CheckCast(ArrayFromJSON(utf8_view(), json), ArrayFromJSON(to_type, json));
+  }
+}
+
 TEST(Cast, StringToString) {
   for (auto from_type : {utf8(), large_utf8()}) {
     for (auto to_type : {utf8(), large_utf8()}) {
@@ -1667,6 +1710,40 @@ TEST(Cast, BooleanToString) {
   }
 }
 
+TEST(Cast, DecimalToString) {
+  for (auto string_type : {utf8(), large_utf8()}) {
+    CheckCast(ArrayFromJSON(decimal128(5, 2), R"(["0.00", "-123.45", "999.99", null])"),
+              ArrayFromJSON(string_type, R"(["0.00", "-123.45", "999.99", null])"));
+
+    CheckCast(ArrayFromJSON(decimal256(40, 0),
+                            R"(["1234567890123456789012345678901234567890", null])"),
+              ArrayFromJSON(string_type,
+                            R"(["1234567890123456789012345678901234567890", null])"));
+  }
+}
+
+TEST(Cast, NumberToStringLongArray) {
+  // Spans several formatting blocks, with a sliced validity bitmap
+  auto ints = checked_pointer_cast<Int64Array>(
+      ArrayFromJSON(int64(), "[1, -22, null, 333, 4444]"));
+  Int64Builder int_builder;
+  StringBuilder string_builder;
+  for (int64_t i = 0; i < 5000; ++i) {
+    const int64_t j = i % ints->length();
+    if (ints->IsNull(j)) {
+      ASSERT_OK(int_builder.AppendNull());
+      ASSERT_OK(string_builder.AppendNull());
+    } else {
+      ASSERT_OK(int_builder.Append(ints->Value(j) * i));
+      ASSERT_OK(string_builder.Append(std::to_string(ints->Value(j) * i)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto input, int_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected, string_builder.Finish());
+  CheckCast(input, expected);
+  CheckCast(input->Slice(3), expected->Slice(3));
+}
+
 TEST(Cast, ListToPrimitive) {
   ASSERT_RAISES(NotImplemented,
                 Cast(*ArrayFromJSON(list(int8()), "[[1, 2], [3, 4]]"), uint8()));
@@ -1714,6 +1791,102 @@ TEST(Cast, ListToListOptionsPassthru) {
   CheckCast(list_int32, ArrayFromJSON(list(int16()), "[[32689]]"), options);
 }
 
+TEST(Cast, ListToLargeList) {
+  const char* json = "[[0], [1], null, [2, 3, 4], [5, 6], null, [], [7], [8, null]]";
+  using make_list_t = std::shared_ptr<DataType>(const std::shared_ptr<DataType>&);
+  for (auto from : std::vector<make_list_t*>{&list, &large_list}) {
+    for (auto to : std::vector<make_list_t*>{&list, &large_list}) {
+      for (auto value_type : {int32(), int64()}) {
+        auto input = ArrayFromJSON(from(int32()), json);
+        auto expected = ArrayFromJSON(to(value_type), json);
+        CheckCast(input, expected);
+        CheckCast(input->Slice(1), expected->Slice(1));
+        CheckCast(input->Slice(3, 4), expected->Slice(3, 4));
+      }
+    }
+  }
+}
+
+TEST(Cast, ListToListZeroCopy) {
+  auto input = ArrayFromJSON(list(int32()), "[[0], [1, 2], null, [3, 4, 5], []]");
+
+  // The offsets are reused when the values are cast
+  ASSERT_OK_AND_ASSIGN(auto list_int64, Cast(*input, list(int64())));
+  ASSERT_OK(list_int64->ValidateFull());
+  AssertBufferSame(*input, *list_int64, 0);
+  AssertBufferSame(*input, *list_int64, 1);
+
+  // The values are reused when the offsets are converted
+  for (const auto& slice : {input, input->Slice(1), input->Slice(2, 2)}) {
+    ASSERT_OK_AND_ASSIGN(auto large_list_int32, Cast(*slice, large_list(int32())));
+    ASSERT_OK(large_list_int32->ValidateFull());
+    ASSERT_EQ(input->data()->child_data[0]->buffers[1].get(),
+              large_list_int32->data()->child_data[0]->buffers[1].get());
+  }
+}
+
+TEST(Cast, StructToStruct) {
+  auto input = ArrayFromJSON(
+      struct_({field("a", int32()), field("b", utf8()), field("c", list(int8()))}),
+      R"([{"a": 1, "b": "x", "c": [1]}, null, {"a": null, "b": "yy", "c": null},
+          {"a": 4, "b": null, "c": [2, 3]}, {"a": -5, "b": "", "c": []},
+          {"a": 6, "b": "z", "c": [4]}, null, {"a": 8, "b": "w", "c": [null]},
+          {"a": 9, "b": "v", "c": [5, 6]}, {"a": 10, "b": "u", "c": []}])");
+  auto expected = ArrayFromJSON(
+      struct_({field("a", int64()), field("b", utf8()), field("c", list(int16()))}),
+      R"([{"a": 1, "b": "x", "c": [1]}, null, {"a": null, "b": "yy", "c": null},
+          {"a": 4, "b": null, "c": [2, 3]}, {"a": -5, "b": "", "c": []},
+          {"a": 6, "b": "z", "c": [4]}, null, {"a": 8, "b": "w", "c": [null]},
+          {"a": 9, "b": "v", "c": [5, 6]}, {"a": 10, "b": "u", "c": []}])");
+  CheckCast(input, expected);
+  CheckCast(input->Slice(3), expected->Slice(3));
+  CheckCast(input->Slice(8), expected->Slice(8));
+
+  // The validity bitmap and the fields which aren't cast are reused
+  ASSERT_OK_AND_ASSIGN(auto cast, Cast(*input, expected->type()));
+  AssertBufferSame(*input, *cast, 0);
+  ASSERT_EQ(input->data()->child_data[1], cast->data()->child_data[1]);
+
+  // Field casts get the cast options
+  auto options = CastOptions::Safe(
+      struct_({field("a", int8()), field("b", utf8()), field("c", list(int8()))}));
+  ASSERT_RAISES(Invalid,
+                Cast(*ArrayFromJSON(input->type(), R"([{"a": 1000, "b": "", "c": []}])"),
+                     options));
+}
+
+TEST(Cast, StructToStructFieldMismatch) {
+  auto input = ArrayFromJSON(struct_({field("a", int32()), field("b", utf8())}),
+                             R"([{"a": 1, "b": "x"}])");
+  ASSERT_RAISES(TypeError,
+                Cast(*input, struct_({field("a", int64()), field("c", utf8())})));
+  ASSERT_RAISES(TypeError, Cast(*input, struct_({field("a", int64())})));
+  ASSERT_RAISES(TypeError,
+                Cast(*input, struct_({field("b", utf8()), field("a", int64())})));
+}
+
+TEST(Cast, WideStructToStruct) {
+  // Enough fields to cast for the field casts to run in parallel
+  const char* json = "[1, null, 3, 4, 5, null, 7, 8, 9, 10, 11]";
+  auto values = ArrayFromJSON(int32(), json);
+  auto expected_values = ArrayFromJSON(float64(), json);
+  FieldVector input_fields, expected_fields;
+  ArrayVector input_children, expected_children;
+  for (int i = 0; i < 12; ++i) {
+    const bool is_cast = i % 3 != 0;
+    const std::string name = "f" + std::to_string(i);
+    input_fields.push_back(field(name, int32()));
+    expected_fields.push_back(field(name, is_cast ? float64() : int32()));
+    input_children.push_back(values);
+    expected_children.push_back(is_cast ? expected_values : values);
+  }
+  ASSERT_OK_AND_ASSIGN(auto input, StructArray::Make(input_children, input_fields));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       StructArray::Make(expected_children, expected_fields));
+  CheckCast(input, expected);
+  CheckCast(input->Slice(5), expected->Slice(5));
+}
+
 TEST(Cast, IdentityCasts) {
   // ARROW-4102
   auto CheckIdentityCast = [](std::shared_ptr<DataType> type, const std::string& json) {
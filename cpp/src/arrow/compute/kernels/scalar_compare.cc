@@ -15,7 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <string>
+
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_compare_internal.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -28,50 +35,6 @@ namespace internal {
 
 namespace {
 
-struct Equal {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left == right;
-  }
-};
-
-struct NotEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left != right;
-  }
-};
-
-struct Greater {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left > right;
-  }
-};
-
-struct GreaterEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left >= right;
-  }
-};
-
-// Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
-
-template <typename Op>
-void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  auto exec =
-      GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-  DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
-}
-
-template <typename InType, typename Op>
-void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  DCHECK_OK(
-      func->AddKernel({ty, ty}, boolean(),
-                      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
-}
-
 struct CompareFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
@@ -97,6 +60,128 @@ struct CompareFunction : ScalarFunction {
   }
 };
 
+// ----------------------------------------------------------------------
+// Run-end encoded comparisons
+//
+// Run-end encoded inputs are compared run by run, calling the comparison
+// function on the values of the runs: the output is run-end encoded, unless a
+// run-end encoded input is compared with a plain array.
+
+Result<Datum> DecodeIfRunEndEncoded(const Datum& value, ExecContext* ctx) {
+  if (value.type()->id() == Type::RUN_END_ENCODED) {
+    return RunEndDecode(value, ctx);
+  }
+  return value;
+}
+
+// The values of the runs overlapping a run-end encoded array
+std::shared_ptr<ArrayData> PhysicalValues(const ArrayData& data) {
+  return ree_util::ValuesArray(data).Slice(ree_util::FindPhysicalOffset(data),
+                                           ree_util::FindPhysicalLength(data));
+}
+
+Status CompareRunEndEncoded(const std::string& func_name, KernelContext* ctx,
+                            const ExecBatch& batch, Datum* out) {
+  ExecContext* exec_ctx = ctx->exec_context();
+  if (out->type()->id() != Type::RUN_END_ENCODED) {
+    ARROW_ASSIGN_OR_RAISE(Datum left, DecodeIfRunEndEncoded(batch[0], exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(Datum right, DecodeIfRunEndEncoded(batch[1], exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(*out, CallFunction(func_name, {left, right}, exec_ctx));
+    return Status::OK();
+  }
+
+  const auto& out_type = checked_cast<const RunEndEncodedType&>(*out->type());
+  std::shared_ptr<ArrayData> run_ends;
+  Datum compared;
+  if (batch[0].is_array() && batch[1].is_array()) {
+    // Both sides are run-end encoded: compare the values of the merged runs
+    const ArrayData& left = *batch[0].array();
+    const ArrayData& right = *batch[1].array();
+    TypedBufferBuilder<int64_t> run_ends_builder(exec_ctx->memory_pool());
+    TypedBufferBuilder<int64_t> left_indices(exec_ctx->memory_pool());
+    TypedBufferBuilder<int64_t> right_indices(exec_ctx->memory_pool());
+    int64_t position = 0;
+    for (ree_util::MergedRunsIterator it(left, right); !it.is_end(); it.Next()) {
+      position += it.run_length();
+      RETURN_NOT_OK(run_ends_builder.Append(position));
+      RETURN_NOT_OK(left_indices.Append(it.left_physical_index()));
+      RETURN_NOT_OK(right_indices.Append(it.right_physical_index()));
+    }
+    const int64_t num_runs = run_ends_builder.length();
+    ARROW_ASSIGN_OR_RAISE(
+        run_ends, ree_util::MakeRunEndsArray(out_type.run_end_type(),
+                                             run_ends_builder.data(), num_runs,
+                                             exec_ctx->memory_pool()));
+    std::shared_ptr<Buffer> left_buffer, right_buffer;
+    RETURN_NOT_OK(left_indices.Finish(&left_buffer));
+    RETURN_NOT_OK(right_indices.Finish(&right_buffer));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum left_values,
+        Take(Datum(left.child_data[1]),
+             Datum(ArrayData::Make(int64(), num_runs, {nullptr, left_buffer}, 0)),
+             TakeOptions::NoBoundsCheck(), exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum right_values,
+        Take(Datum(right.child_data[1]),
+             Datum(ArrayData::Make(int64(), num_runs, {nullptr, right_buffer}, 0)),
+             TakeOptions::NoBoundsCheck(), exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(compared,
+                          CallFunction(func_name, {left_values, right_values}, exec_ctx));
+  } else {
+    // Compared with a scalar: compare the values of the runs only
+    const bool left_is_array = batch[0].is_array();
+    const ArrayData& data = left_is_array ? *batch[0].array() : *batch[1].array();
+    ARROW_ASSIGN_OR_RAISE(run_ends,
+                          ree_util::MakeLogicalRunEnds(data, exec_ctx->memory_pool()));
+    Datum values(PhysicalValues(data));
+    std::vector<Datum> args = {batch[0], batch[1]};
+    args[left_is_array ? 0 : 1] = std::move(values);
+    ARROW_ASSIGN_OR_RAISE(compared, CallFunction(func_name, args, exec_ctx));
+  }
+  out->value = ArrayData::Make(out->type(), batch.length, {nullptr},
+                               {std::move(run_ends), compared.array()},
+                               /*null_count=*/0);
+  return Status::OK();
+}
+
+// The output is run-end encoded with the widest run end type of the inputs,
+// unless a plain array is compared
+Result<ValueDescr> ResolveRunEndEncodedCompareOutput(
+    KernelContext*, const std::vector<ValueDescr>& args) {
+  std::shared_ptr<DataType> run_end_type;
+  for (const auto& arg : args) {
+    if (arg.type->id() == Type::RUN_END_ENCODED) {
+      const auto& arg_run_end_type =
+          checked_cast<const RunEndEncodedType&>(*arg.type).run_end_type();
+      if (run_end_type == nullptr ||
+          bit_width(arg_run_end_type->id()) > bit_width(run_end_type->id())) {
+        run_end_type = arg_run_end_type;
+      }
+    } else if (arg.shape == ValueDescr::ARRAY) {
+      return ValueDescr::Array(boolean());
+    }
+  }
+  return ValueDescr::Array(run_end_encoded(std::move(run_end_type), boolean()));
+}
+
+void AddRunEndEncodedCompareKernels(const std::string& func_name, ScalarFunction* func) {
+  ScalarKernel kernel;
+  kernel.exec = [func_name](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    KERNEL_RETURN_IF_ERROR(ctx, CompareRunEndEncoded(func_name, ctx, batch, out));
+  };
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.can_write_into_slices = false;
+
+  const InputType run_end_encoded_array = InputType::Array(Type::RUN_END_ENCODED);
+  const InputType any_input(ValueDescr::ANY);
+  const OutputType out_type(ResolveRunEndEncodedCompareOutput);
+  kernel.signature = KernelSignature::Make({run_end_encoded_array, any_input}, out_type);
+  DCHECK_OK(func->AddKernel(kernel));
+  kernel.signature = KernelSignature::Make({any_input, run_end_encoded_array}, out_type);
+  DCHECK_OK(func->AddKernel(kernel));
+}
+
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
                                                     const FunctionDoc* doc) {
@@ -106,54 +191,32 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
       {boolean(), boolean()}, boolean(),
       applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
 
-  for (const std::shared_ptr<DataType>& ty : IntTypes()) {
-    AddIntegerCompare<Op>(ty, func.get());
+  AddPrimitiveCompareKernels<Op, SimdLevel::NONE>(func.get());
+  // Add the SIMD variants for primitive types
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+    AddPrimitiveCompareAvx2Kernels<Op>(func.get());
   }
-  AddIntegerCompare<Op>(date32(), func.get());
-  AddIntegerCompare<Op>(date64(), func.get());
-
-  AddGenericCompare<FloatType, Op>(float32(), func.get());
-  AddGenericCompare<DoubleType, Op>(float64(), func.get());
-
-  // Add timestamp kernels
-  for (auto unit : AllTimeUnits()) {
-    InputType in_type(match::TimestampTypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-
-  // Duration
-  for (auto unit : AllTimeUnits()) {
-    InputType in_type(match::DurationTypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-
-  // Time32 and Time64
-  for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI}) {
-    InputType in_type(match::Time32TypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int32());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
-  }
-  for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
-    InputType in_type(match::Time64TypeUnit(unit));
-    auto exec =
-        GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
-            int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+    AddPrimitiveCompareAvx512Kernels<Op>(func.get());
   }
+#endif
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
     auto exec =
         GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
+  DCHECK_OK(func->AddKernel(
+      {utf8_view(), utf8_view()}, boolean(),
+      applicator::ScalarBinaryEqualTypes<BooleanType, StringViewType, Op>::Exec));
+
+  AddRunEndEncodedCompareKernels(name, func.get());
 
   return func;
 }
@@ -0,0 +1,226 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+struct Equal {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left >= right;
+  }
+};
+
+// Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
+
+// Add the kernels for primitive types with the given SIMD level
+template <typename Op, SimdLevel::type kSimdLevel>
+void AddPrimitiveCompareKernels(ScalarFunction* func);
+
+// SIMD variants for kernels
+template <typename Op>
+void AddPrimitiveCompareAvx2Kernels(ScalarFunction* func);
+
+template <typename Op>
+void AddPrimitiveCompareAvx512Kernels(ScalarFunction* func);
+
+// ----------------------------------------------------------------------
+// Comparison of primitive values
+
+// Compare primitive values a batch at a time and write the output bitmap
+// a word at a time, rather than generating one bit after another.  The
+// comparisons of a batch don't depend on each other so they are vectorized
+// by the compiler.  The SimdLevel template parameter keeps apart the
+// instantiations of the translation units compiled with different flags.
+template <typename Type, typename Op, SimdLevel::type kSimdLevel>
+struct ComparePrimitive {
+  using T = typename Type::c_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].is_scalar() && batch[1].is_scalar()) {
+      return applicator::ScalarBinaryEqualTypes<BooleanType, Type, Op>::Exec(ctx, batch,
+                                                                            out);
+    }
+    if (batch.selection_vector != nullptr) {
+      ExecRows(ctx, batch, out, SelectedRows(*batch.selection_vector));
+    } else {
+      ExecRows(ctx, batch, out, AllRows{});
+    }
+  }
+
+ private:
+  template <typename Rows>
+  static void ExecRows(KernelContext* ctx, const ExecBatch& batch, Datum* out,
+                       Rows rows) {
+    ArrayData* out_arr = out->mutable_array();
+    if (batch[1].is_scalar()) {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T right = UnboxScalar<Type>::Unbox(*batch[1].scalar());
+      WriteBits(out_arr, [&](int64_t i) { return Op::Call(ctx, left[rows(i)], right); });
+    } else if (batch[0].is_scalar()) {
+      const T left = UnboxScalar<Type>::Unbox(*batch[0].scalar());
+      const T* right = batch[1].array()->GetValues<T>(1);
+      WriteBits(out_arr, [&](int64_t i) { return Op::Call(ctx, left, right[rows(i)]); });
+    } else {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T* right = batch[1].array()->GetValues<T>(1);
+      WriteBits(out_arr, [&](int64_t i) {
+        return Op::Call(ctx, left[rows(i)], right[rows(i)]);
+      });
+    }
+  }
+
+  static constexpr int64_t kBatchSize = 64;
+
+  // Generate the output bits, `compare(i)` giving the i-th one
+  template <typename Compare>
+  static void WriteBits(ArrayData* out_arr, Compare&& compare) {
+    uint8_t* bitmap = out_arr->buffers[1]->mutable_data();
+    const int64_t offset = out_arr->offset;
+    const int64_t length = out_arr->length;
+
+    int64_t i = 0;
+    // Bits of a byte shared with preceding output are written one at a time
+    for (; i < length && (offset + i) % 8 != 0; ++i) {
+      BitUtil::SetBitTo(bitmap, offset + i, compare(i));
+    }
+    uint8_t* out_bytes = bitmap + (offset + i) / 8;
+    for (; i + kBatchSize <= length; i += kBatchSize) {
+      uint8_t results[kBatchSize];
+      for (int64_t j = 0; j < kBatchSize; ++j) {
+        results[j] = compare(i + j);
+      }
+      for (int64_t j = 0; j < kBatchSize; j += 8) {
+        *out_bytes++ = PackBits(results + j);
+      }
+    }
+    for (; i < length; ++i) {
+      BitUtil::SetBitTo(bitmap, offset + i, compare(i));
+    }
+  }
+
+  // Pack 8 booleans, each 0 or 1 in a byte, into one byte of bits.  Multiplying
+  // by the magic number moves the i-th byte's low bit into bit (56 + i).
+  static uint8_t PackBits(const uint8_t* results) {
+    uint64_t bytes;
+    std::memcpy(&bytes, results, sizeof(bytes));
+    bytes = BitUtil::FromLittleEndian(bytes);
+    return static_cast<uint8_t>((bytes * 0x0102040810204080ULL) >> 56);
+  }
+};
+
+template <typename Op, SimdLevel::type kSimdLevel>
+ArrayKernelExec GenerateComparePrimitive(detail::GetTypeId get_id) {
+  switch (get_id.id) {
+    case Type::INT8:
+      return ComparePrimitive<Int8Type, Op, kSimdLevel>::Exec;
+    case Type::INT16:
+      return ComparePrimitive<Int16Type, Op, kSimdLevel>::Exec;
+    case Type::INT32:
+    case Type::DATE32:
+    case Type::TIME32:
+      return ComparePrimitive<Int32Type, Op, kSimdLevel>::Exec;
+    case Type::INT64:
+    case Type::DATE64:
+    case Type::TIMESTAMP:
+    case Type::TIME64:
+    case Type::DURATION:
+      return ComparePrimitive<Int64Type, Op, kSimdLevel>::Exec;
+    case Type::UINT8:
+      return ComparePrimitive<UInt8Type, Op, kSimdLevel>::Exec;
+    case Type::UINT16:
+      return ComparePrimitive<UInt16Type, Op, kSimdLevel>::Exec;
+    case Type::UINT32:
+      return ComparePrimitive<UInt32Type, Op, kSimdLevel>::Exec;
+    case Type::UINT64:
+      return ComparePrimitive<UInt64Type, Op, kSimdLevel>::Exec;
+    case Type::FLOAT:
+      return ComparePrimitive<FloatType, Op, kSimdLevel>::Exec;
+    case Type::DOUBLE:
+      return ComparePrimitive<DoubleType, Op, kSimdLevel>::Exec;
+    default:
+      DCHECK(false);
+      return ExecFail;
+  }
+}
+
+template <typename Op, SimdLevel::type kSimdLevel>
+void AddPrimitiveCompareKernels(ScalarFunction* func) {
+  auto add_kernel = [&](InputType in_type, Type::type physical_id) {
+    ScalarKernel kernel({in_type, in_type}, boolean(),
+                        GenerateComparePrimitive<Op, kSimdLevel>(physical_id));
+    kernel.simd_level = kSimdLevel;
+    kernel.can_execute_selection = true;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  };
+
+  for (const std::shared_ptr<DataType>& ty : IntTypes()) {
+    add_kernel(ty, ty->id());
+  }
+  add_kernel(date32(), Type::DATE32);
+  add_kernel(date64(), Type::DATE64);
+  add_kernel(float32(), Type::FLOAT);
+  add_kernel(float64(), Type::DOUBLE);
+
+  for (auto unit : AllTimeUnits()) {
+    add_kernel(InputType(match::TimestampTypeUnit(unit)), Type::TIMESTAMP);
+  }
+  for (auto unit : AllTimeUnits()) {
+    add_kernel(InputType(match::DurationTypeUnit(unit)), Type::DURATION);
+  }
+  for (auto unit : {TimeUnit::SECOND, TimeUnit::MILLI}) {
+    add_kernel(InputType(match::Time32TypeUnit(unit)), Type::TIME32);
+  }
+  for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
+    add_kernel(InputType(match::Time64TypeUnit(unit)), Type::TIME64);
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
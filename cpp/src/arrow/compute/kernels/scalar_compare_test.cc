@@ -398,6 +398,21 @@ struct CompareRandomNumeric {
         ValidateCompare<Type>(options, array1, fifty);
         ValidateCompare<Type>(options, fifty, array1);
         ValidateCompare<Type>(options, array1, array2);
+
+        // Inputs not aligned on a byte boundary
+        auto sliced1 = Datum(array1.make_array()->Slice(3, length - 10));
+        auto sliced2 = Datum(array2.make_array()->Slice(5, length - 10));
+        ValidateCompare<Type>(options, sliced1, fifty);
+        ValidateCompare<Type>(options, fifty, sliced2);
+        ValidateCompare<Type>(options, sliced1, sliced2);
+
+        // Output chunks written at offsets not aligned on a byte boundary
+        ExecContext ctx;
+        ctx.set_exec_chunksize(101);
+        ASSERT_OK_AND_ASSIGN(Datum expected, Compare(array1, array2, options));
+        ASSERT_OK_AND_ASSIGN(Datum actual, Compare(array1, array2, options, &ctx));
+        ASSERT_OK(actual.make_array()->ValidateFull());
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
       }
     }
   }
@@ -652,5 +667,26 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, StringView) {
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  // Long enough for some values not to be inlined in the views
+  auto lhs = rand.String(256, 0, 20, /*null_probability=*/0.1);
+  auto rhs = rand.String(256, 0, 20, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(auto lhs_views, Cast(*lhs, utf8_view()));
+  ASSERT_OK_AND_ASSIGN(auto rhs_views, Cast(*rhs, utf8_view()));
+  auto hello = std::make_shared<StringViewScalar>("hello");
+
+  for (std::string function :
+       {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(function, {lhs, rhs}));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, {lhs_views, rhs_views}));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+    ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {lhs, Datum("hello")}));
+    ASSERT_OK_AND_ASSIGN(actual, CallFunction(function, {lhs_views, Datum(hello)}));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -19,9 +19,11 @@
 
 #include "arrow/array/array_base.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/result.h"
 #include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_run_reader.h"
 
 namespace arrow {
 namespace compute {
@@ -60,6 +62,257 @@ const FunctionDoc list_value_length_doc{
      "Null values emit a null in the output."),
     {"lists"}};
 
+// ----------------------------------------------------------------------
+// List-wise aggregations
+//
+// These reduce the values of each list in place, reading the list offsets and
+// the child values directly rather than flattening the lists and grouping the
+// values by their parent index.  Each run of non-null values of a list is
+// reduced in a tight loop the compiler can vectorize.
+
+template <typename ArrowType>
+struct ListSum {
+  using CType = typename ArrowType::c_type;
+  using OutType = typename FindAccumulatorType<ArrowType>::Type;
+  using OutCType = typename OutType::c_type;
+
+  void Consume(const CType* values, int64_t length) {
+    OutCType run_sum = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      run_sum += static_cast<OutCType>(values[i]);
+    }
+    sum += run_sum;
+    count += length;
+  }
+
+  bool Finish(OutCType* out) const {
+    *out = sum;
+    return count > 0;
+  }
+
+  OutCType sum = 0;
+  int64_t count = 0;
+};
+
+template <typename ArrowType>
+struct ListMean : public ListSum<ArrowType> {
+  using OutType = DoubleType;
+  using OutCType = double;
+
+  bool Finish(double* out) const {
+    *out = static_cast<double>(this->sum) / this->count;
+    return this->count > 0;
+  }
+};
+
+// NaNs are ignored by min and max, like in the "min_max" aggregation
+template <typename ArrowType>
+struct ListMin {
+  using CType = typename ArrowType::c_type;
+  using OutType = ArrowType;
+  using OutCType = CType;
+
+  void Consume(const CType* values, int64_t length) {
+    CType run_min = value;
+    for (int64_t i = 0; i < length; ++i) {
+      run_min = values[i] < run_min ? values[i] : run_min;
+    }
+    value = run_min;
+    count += length;
+  }
+
+  bool Finish(CType* out) const {
+    *out = value;
+    return count > 0;
+  }
+
+  CType value = std::numeric_limits<CType>::has_infinity
+                    ? std::numeric_limits<CType>::infinity()
+                    : std::numeric_limits<CType>::max();
+  int64_t count = 0;
+};
+
+template <typename ArrowType>
+struct ListMax {
+  using CType = typename ArrowType::c_type;
+  using OutType = ArrowType;
+  using OutCType = CType;
+
+  void Consume(const CType* values, int64_t length) {
+    CType run_max = value;
+    for (int64_t i = 0; i < length; ++i) {
+      run_max = values[i] > run_max ? values[i] : run_max;
+    }
+    value = run_max;
+    count += length;
+  }
+
+  bool Finish(CType* out) const {
+    *out = value;
+    return count > 0;
+  }
+
+  CType value = std::numeric_limits<CType>::has_infinity
+                    ? -std::numeric_limits<CType>::infinity()
+                    : std::numeric_limits<CType>::lowest();
+  int64_t count = 0;
+};
+
+// Reduce the non-null values in [start, start + length) of `values`, returning
+// false if there are none
+template <typename Op>
+bool ReduceListValues(const ArrayData& values, int64_t start, int64_t length,
+                      typename Op::OutCType* out) {
+  Op op;
+  const auto raw_values = values.GetValues<typename Op::CType>(1) + start;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      values.buffers[0], values.offset + start, length,
+      [&](int64_t position, int64_t run_length) {
+        op.Consume(raw_values + position, run_length);
+      });
+  return op.Finish(out);
+}
+
+template <typename Op, typename Type>
+void ListAggregate(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  using OutScalarType = typename TypeTraits<typename Op::OutType>::ScalarType;
+  using OutCType = typename Op::OutCType;
+
+  if (batch[0].kind() == Datum::ARRAY) {
+    typename TypeTraits<Type>::ArrayType list(batch[0].array());
+    const ArrayData& values = *list.values()->data();
+    const auto offsets = list.raw_value_offsets();
+    ArrayData* out_arr = out->mutable_array();
+    auto out_values = out_arr->GetMutableValues<OutCType>(1);
+    uint8_t* out_bitmap = out_arr->buffers[0]->mutable_data();
+    int64_t null_count = 0;
+
+    for (int64_t i = 0; i < list.length(); ++i) {
+      const bool valid =
+          list.IsValid(i) && ReduceListValues<Op>(values, offsets[i],
+                                                  offsets[i + 1] - offsets[i],
+                                                  &out_values[i]);
+      if (!valid) {
+        out_values[i] = OutCType{};
+        ++null_count;
+      }
+      BitUtil::SetBitTo(out_bitmap, out_arr->offset + i, valid);
+    }
+    out_arr->null_count = null_count;
+  } else {
+    const auto& arg0 = checked_cast<const BaseListScalar&>(*batch[0].scalar());
+    auto out_scalar = checked_cast<OutScalarType*>(out->scalar().get());
+    out_scalar->is_valid =
+        arg0.is_valid && ReduceListValues<Op>(*arg0.value->data(), 0,
+                                              arg0.value->length(), &out_scalar->value);
+  }
+}
+
+template <template <typename> class Op, typename Type>
+struct ListAggregateVisitor {
+  KernelContext* ctx;
+  const ExecBatch& batch;
+  Datum* out;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("List aggregation of values of type ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("List aggregation of values of type ", type);
+  }
+
+  template <typename ValueType>
+  enable_if_number<ValueType, Status> Visit(const ValueType&) {
+    ListAggregate<Op<ValueType>, Type>(ctx, batch, out);
+    return Status::OK();
+  }
+};
+
+template <template <typename> class Op, typename Type>
+void ListAggregateExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& list_type = checked_cast<const BaseListType&>(*batch[0].type());
+  const auto& value_type = list_type.value_type();
+  ListAggregateVisitor<Op, Type> visitor{ctx, batch, out};
+  KERNEL_RETURN_IF_ERROR(ctx, VisitTypeInline(*value_type, &visitor));
+}
+
+template <template <typename> class Op>
+struct ListAggregateTypeVisitor {
+  std::shared_ptr<DataType> out_type;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("List aggregation of values of type ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("List aggregation of values of type ", type);
+  }
+
+  template <typename ValueType>
+  enable_if_number<ValueType, Status> Visit(const ValueType&) {
+    out_type = TypeTraits<typename Op<ValueType>::OutType>::type_singleton();
+    return Status::OK();
+  }
+};
+
+template <template <typename> class Op>
+Result<ValueDescr> ResolveListAggregate(KernelContext*,
+                                        const std::vector<ValueDescr>& descrs) {
+  const auto& list_type = checked_cast<const BaseListType&>(*descrs[0].type);
+  const auto& value_type = list_type.value_type();
+  ListAggregateTypeVisitor<Op> visitor;
+  RETURN_NOT_OK(VisitTypeInline(*value_type, &visitor));
+  return ValueDescr(std::move(visitor.out_type), descrs[0].shape);
+}
+
+template <template <typename> class Op>
+void AddListAggregate(std::string name, const FunctionDoc* doc,
+                      FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>(std::move(name), Arity::Unary(), doc);
+  ScalarKernel kernel({InputType(Type::LIST)}, OutputType(ResolveListAggregate<Op>),
+                      ListAggregateExec<Op, ListType>);
+  kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(kernel));
+  kernel.signature = KernelSignature::Make({InputType(Type::LARGE_LIST)},
+                                           OutputType(ResolveListAggregate<Op>));
+  kernel.exec = ListAggregateExec<Op, LargeListType>;
+  DCHECK_OK(func->AddKernel(kernel));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+const FunctionDoc list_sum_doc{
+    "Compute the sum of each list",
+    ("`lists` must have a list-like type with numeric values.\n"
+     "For each non-null value in `lists`, the sum of its non-null values is\n"
+     "emitted, as Int64, UInt64 or Double.\n"
+     "Null values and lists without non-null values emit a null in the output."),
+    {"lists"}};
+
+const FunctionDoc list_mean_doc{
+    "Compute the mean of each list",
+    ("`lists` must have a list-like type with numeric values.\n"
+     "For each non-null value in `lists`, the mean of its non-null values is\n"
+     "emitted as Double.\n"
+     "Null values and lists without non-null values emit a null in the output."),
+    {"lists"}};
+
+const FunctionDoc list_min_doc{
+    "Compute the minimum of each list",
+    ("`lists` must have a list-like type with numeric values.\n"
+     "For each non-null value in `lists`, the minimum of its non-null values\n"
+     "is emitted.  NaNs are ignored.\n"
+     "Null values and lists without non-null values emit a null in the output."),
+    {"lists"}};
+
+const FunctionDoc list_max_doc{
+    "Compute the maximum of each list",
+    ("`lists` must have a list-like type with numeric values.\n"
+     "For each non-null value in `lists`, the maximum of its non-null values\n"
+     "is emitted.  NaNs are ignored.\n"
+     "Null values and lists without non-null values emit a null in the output."),
+    {"lists"}};
+
 Result<ValueDescr> ProjectResolve(KernelContext* ctx,
                                   const std::vector<ValueDescr>& descrs) {
   const auto& names = OptionsWrapper<ProjectOptions>::Get(ctx).field_names;
@@ -155,6 +408,11 @@ void RegisterScalarNested(FunctionRegistry* registry) {
                                          ListValueLength<LargeListType>));
   DCHECK_OK(registry->AddFunction(std::move(list_value_length)));
 
+  AddListAggregate<ListSum>("list_sum", &list_sum_doc, registry);
+  AddListAggregate<ListMean>("list_mean", &list_mean_doc, registry);
+  AddListAggregate<ListMin>("list_min", &list_min_doc, registry);
+  AddListAggregate<ListMax>("list_max", &list_max_doc, registry);
+
   auto project_function =
       std::make_shared<ScalarFunction>("project", Arity::VarArgs(), &project_doc);
   ScalarKernel kernel{KernelSignature::Make({InputType{}}, OutputType{ProjectResolve},
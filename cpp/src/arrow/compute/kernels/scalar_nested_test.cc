@@ -38,6 +38,46 @@ TEST(TestScalarNested, ListValueLength) {
   }
 }
 
+TEST(TestScalarNested, ListSum) {
+  for (auto ty : {list(int32()), large_list(int32())}) {
+    CheckScalarUnary("list_sum", ty, "[[0, null, 1], null, [2, 3], [], [null]]", int64(),
+                     "[1, null, 5, null, null]");
+  }
+  CheckScalarUnary("list_sum", list(uint8()), "[[200, 100], [null, 1]]", uint64(),
+                   "[300, 1]");
+  CheckScalarUnary("list_sum", list(float64()), "[[1.5, 2.5], [null, -1], []]",
+                   float64(), "[4, -1, null]");
+}
+
+TEST(TestScalarNested, ListMean) {
+  for (auto ty : {list(int32()), large_list(int32())}) {
+    CheckScalarUnary("list_mean", ty, "[[1, 2], [null, 3, 4], null, [], [null]]",
+                     float64(), "[1.5, 3.5, null, null, null]");
+  }
+  CheckScalarUnary("list_mean", list(float32()), "[[0.5, 1.5, 4], [-2]]", float64(),
+                   "[2, -2]");
+}
+
+TEST(TestScalarNested, ListMinMax) {
+  for (auto ty : {list(int16()), large_list(int16())}) {
+    CheckScalarUnary("list_min", ty, "[[3, -1, null, 2], null, [], [5], [null]]",
+                     int16(), "[-1, null, null, 5, null]");
+    CheckScalarUnary("list_max", ty, "[[3, -1, null, 2], null, [], [5], [null]]",
+                     int16(), "[3, null, null, 5, null]");
+  }
+  CheckScalarUnary("list_min", list(uint64()), "[[18446744073709551615, 7]]", uint64(),
+                   "[7]");
+  CheckScalarUnary("list_max", list(float64()), "[[-1.5, -0.5], [-3]]", float64(),
+                   "[-0.5, -3]");
+}
+
+TEST(TestScalarNested, ListAggregateUnsupported) {
+  for (auto func : {"list_sum", "list_mean", "list_min", "list_max"}) {
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction(func, {ArrayFromJSON(list(utf8()), R"([["a"]])")}));
+  }
+}
+
 struct {
   template <typename... Options>
   Result<Datum> operator()(std::vector<Datum> args, std::vector<std::string> field_names,
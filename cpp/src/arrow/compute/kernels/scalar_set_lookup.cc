@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
@@ -23,6 +25,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/bloom_filter.h"
 #include "arrow/util/hashing.h"
 #include "arrow/visitor_inline.h"
 
@@ -35,11 +38,27 @@ namespace compute {
 namespace internal {
 namespace {
 
+// Value sets at least this large get a Bloom filter in front of their memo
+// table, which is unlikely to fit in the CPU caches
+constexpr int64_t kBloomFilterMinValueSetSize = 1 << 16;
+
+// Inputs are hashed and probed against the Bloom filter this many at a time
+constexpr int64_t kBloomFilterBatchSize = 1 << 10;
+
 template <typename Type>
 struct SetLookupState : public KernelState {
-  explicit SetLookupState(MemoryPool* pool) : lookup_table(pool, 0) {}
+  using T = typename GetViewType<Type>::T;
+
+  // Lookups of booleans and small integers index the memo table directly
+  static constexpr bool kCanUseBloomFilter = sizeof(T) >= 4;
+
+  explicit SetLookupState(MemoryPool* pool) : pool(pool), lookup_table(pool, 0) {}
 
   Status Init(const SetLookupOptions& options) {
+    if (kCanUseBloomFilter && options.value_set.length() >= kBloomFilterMinValueSetSize) {
+      RETURN_NOT_OK(bloom_filter.Init(options.value_set.length(), pool));
+      use_bloom_filter = true;
+    }
     if (options.value_set.kind() == Datum::ARRAY) {
       RETURN_NOT_OK(AddArrayValueSet(*options.value_set.array()));
     } else if (options.value_set.kind() == Datum::CHUNKED_ARRAY) {
@@ -60,8 +79,10 @@ struct SetLookupState : public KernelState {
   }
 
   Status AddArrayValueSet(const ArrayData& data) {
-    using T = typename GetViewType<Type>::T;
     auto visit_valid = [&](T v) {
+      if (use_bloom_filter) {
+        bloom_filter.Insert(Hash(v));
+      }
       int32_t unused_memo_index;
       return lookup_table.GetOrInsert(v, &unused_memo_index);
     };
@@ -73,9 +94,52 @@ struct SetLookupState : public KernelState {
     return VisitArrayDataInline<Type>(data, visit_valid, visit_null);
   }
 
+  // Visit the input, calling visit_valid(index) with the value_set index of each
+  // non-null value, or -1 if it isn't in value_set, and visit_null() for each null
+  template <typename VisitValid, typename VisitNull>
+  void VisitLookup(const ArrayData& data, VisitValid&& visit_valid,
+                   VisitNull&& visit_null) const {
+    if (!use_bloom_filter) {
+      VisitArrayDataInline<Type>(
+          data, [&](T v) { visit_valid(lookup_table.Get(v)); }, visit_null);
+      return;
+    }
+
+    // Most values absent from value_set are ruled out by probing the Bloom
+    // filter with a batch of hashes, without touching the memo table
+    uint64_t hashes[kBloomFilterBatchSize];
+    uint8_t may_contain[kBloomFilterBatchSize / 8];
+    for (int64_t offset = 0; offset < data.length; offset += kBloomFilterBatchSize) {
+      const auto batch =
+          data.Slice(offset, std::min(kBloomFilterBatchSize, data.length - offset));
+      int64_t i = 0;
+      VisitArrayDataInline<Type>(
+          *batch, [&](T v) { hashes[i++] = Hash(v); }, [&]() { hashes[i++] = 0; });
+      bloom_filter.MayContain(hashes, batch->length, may_contain);
+
+      i = 0;
+      VisitArrayDataInline<Type>(
+          *batch,
+          [&](T v) {
+            visit_valid(BitUtil::GetBit(may_contain, i++) ? lookup_table.Get(v) : -1);
+          },
+          [&]() {
+            ++i;
+            visit_null();
+          });
+    }
+  }
+
+  static uint64_t Hash(const T& v) {
+    return ::arrow::internal::ScalarHelper<T>::ComputeHash(v);
+  }
+
+  MemoryPool* pool;
   using MemoTable = typename HashTraits<Type>::MemoTableType;
   MemoTable lookup_table;
   int32_t null_index = -1;
+  bool use_bloom_filter = false;
+  ::arrow::internal::BlockedBloomFilter bloom_filter;
 };
 
 template <>
@@ -167,6 +231,9 @@ struct InitStateVisitor {
   }
 };
 
+// The lookup table is built here, once per call.  Callers looking up many
+// batches into the same value set bind the function (see BindFunction), so that
+// the table is built once for all the batches.
 std::unique_ptr<KernelState> InitSetLookup(KernelContext* ctx,
                                            const KernelInitArgs& args) {
   if (args.options == nullptr) {
@@ -208,15 +275,12 @@ struct IndexInVisitor {
 
   template <typename Type>
   Status ProcessIndexIn() {
-    using T = typename GetViewType<Type>::T;
-
     const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
 
     RETURN_NOT_OK(this->builder.Reserve(data.length));
-    VisitArrayDataInline<Type>(
+    state.VisitLookup(
         data,
-        [&](T v) {
-          int32_t index = state.lookup_table.Get(v);
+        [&](int32_t index) {
           if (index != -1) {
             // matching needle; output index from value_set
             this->builder.UnsafeAppend(index);
@@ -298,17 +362,16 @@ struct IsInVisitor {
 
   template <typename Type>
   Status ProcessIsIn() {
-    using T = typename GetViewType<Type>::T;
     const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
     ArrayData* output = out->mutable_array();
 
     FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(), output->offset,
                                  output->length);
 
-    VisitArrayDataInline<Type>(
+    state.VisitLookup(
         this->data,
-        [&](T v) {
-          if (state.lookup_table.Get(v) != -1) {
+        [&](int32_t index) {
+          if (index != -1) {
             writer.Set();
           } else {
             writer.Clear();
@@ -789,5 +789,83 @@ TEST(TestSetLookup, IsInWithImplicitCasts) {
                    ArrayFromJSON(boolean(), "[0, 1, 0, 1]"), &opts);
 }
 
+template <typename Builder, typename MakeValue>
+void CheckLargeValueSet(MakeValue make_value) {
+  // Large enough to be fronted with a Bloom filter
+  constexpr int kValueSetSize = 100000;
+  Builder value_set_builder, input_builder;
+  for (int i = 0; i < kValueSetSize; ++i) {
+    ASSERT_OK(value_set_builder.Append(make_value(3 * i)));
+  }
+  ASSERT_OK(value_set_builder.AppendNull());
+
+  // Found values, absent values and nulls; longer than a probing batch
+  Int32Builder expected_index_builder;
+  BooleanBuilder expected_is_in_builder;
+  for (int i = 0; i < 5000; ++i) {
+    const int v = (i * 7919) % (4 * kValueSetSize);
+    if (i % 10 == 0) {
+      ASSERT_OK(input_builder.AppendNull());
+      ASSERT_OK(expected_index_builder.Append(kValueSetSize));
+      ASSERT_OK(expected_is_in_builder.Append(true));
+    } else {
+      ASSERT_OK(input_builder.Append(make_value(v)));
+      const bool found = v % 3 == 0 && v / 3 < kValueSetSize;
+      if (found) {
+        ASSERT_OK(expected_index_builder.Append(v / 3));
+      } else {
+        ASSERT_OK(expected_index_builder.AppendNull());
+      }
+      ASSERT_OK(expected_is_in_builder.Append(found));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto value_set, value_set_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto input, input_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected_index, expected_index_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected_is_in, expected_is_in_builder.Finish());
+
+  SetLookupOptions options(value_set);
+  ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(input, options));
+  AssertDatumsEqual(expected_index, actual, /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(actual, IsIn(input, options));
+  AssertDatumsEqual(expected_is_in, actual, /*verbose=*/true);
+
+  // Sliced input
+  ASSERT_OK_AND_ASSIGN(actual, IndexIn(input->Slice(1234), options));
+  AssertDatumsEqual(expected_index->Slice(1234), actual, /*verbose=*/true);
+}
+
+TEST(TestSetLookup, LargeValueSet) {
+  CheckLargeValueSet<Int64Builder>([](int v) { return static_cast<int64_t>(v); });
+  CheckLargeValueSet<UInt32Builder>([](int v) { return static_cast<uint32_t>(v); });
+  CheckLargeValueSet<StringBuilder>([](int v) { return "value" + std::to_string(v); });
+}
+
+TEST(TestSetLookup, BoundFunction) {
+  // A bound function builds the lookup table of its value set once, and
+  // reuses it for every batch it is executed on
+  Int32Builder value_set_builder;
+  for (int32_t i = 0; i < 5000; ++i) {
+    ASSERT_OK(value_set_builder.Append(3 * i));
+  }
+  ASSERT_OK(value_set_builder.AppendNull());
+  ASSERT_OK_AND_ASSIGN(auto value_set, value_set_builder.Finish());
+  SetLookupOptions options(value_set);
+
+  ASSERT_OK_AND_ASSIGN(auto is_in,
+                       BindFunction("is_in", {ValueDescr::Array(int32())}, &options));
+  ASSERT_OK_AND_ASSIGN(auto index_in,
+                       BindFunction("index_in", {ValueDescr::Array(int32())}, &options));
+  for (int i = 0; i < 3; ++i) {
+    auto input = ArrayFromJSON(int32(), "[0, 1, 3, null]")->Slice(i);
+    ASSERT_OK_AND_ASSIGN(Datum actual, is_in->Execute({input}));
+    AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, false, true, true]")->Slice(i),
+                      actual, /*verbose=*/true);
+    ASSERT_OK_AND_ASSIGN(actual, index_in->Execute({input}));
+    AssertDatumsEqual(ArrayFromJSON(int32(), "[0, null, 1, 5000]")->Slice(i), actual,
+                      /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,8 +16,10 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <string>
+#include <vector>
 
 #ifdef ARROW_WITH_UTF8PROC
 #include <utf8proc.h>
@@ -29,9 +31,11 @@
 
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/utf8.h"
 #include "arrow/util/value_parsing.h"
 
@@ -72,15 +76,7 @@ struct Utf8Length {
   template <typename OutValue, typename Arg0Value = util::string_view>
   static OutValue Call(KernelContext*, Arg0Value val) {
     auto str = reinterpret_cast<const uint8_t*>(val.data());
-    auto strlen = val.size();
-
-    OutValue length = 0;
-    while (strlen > 0) {
-      length += ((*str & 0xc0) != 0x80);
-      ++str;
-      --strlen;
-    }
-    return length;
+    return static_cast<OutValue>(util::UTF8Length(str, str + val.size()));
   }
 };
 
@@ -108,6 +104,106 @@ void EnsureLookupTablesFilled() {
 
 #endif  // ARROW_WITH_UTF8PROC
 
+using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
+
+// Transform a buffer of offsets to one which begins with 0 and has same
+// value lengths.
+template <typename T>
+Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
+                         int64_t length, std::shared_ptr<Buffer>* out) {
+  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
+  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
+  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
+  T first_offset = *input_offsets;
+  for (int64_t i = 0; i < length; ++i) {
+    *out_offsets++ = input_offsets[i] - first_offset;
+  }
+  *out_offsets = input_offsets[length] - first_offset;
+  return Status::OK();
+}
+
+// Apply `transform` to input character data- this function cannot change the
+// length
+template <typename Type>
+void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
+                         TransformFunc transform, Datum* out) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using offset_type = typename Type::offset_type;
+
+  if (batch[0].kind() == Datum::ARRAY) {
+    const ArrayData& input = *batch[0].array();
+    ArrayType input_boxed(batch[0].array());
+
+    ArrayData* out_arr = out->mutable_array();
+
+    if (input.offset == 0) {
+      // We can reuse offsets from input
+      out_arr->buffers[1] = input.buffers[1];
+    } else {
+      DCHECK(input.buffers[1]);
+      // We must allocate new space for the offsets and shift the existing offsets
+      KERNEL_RETURN_IF_ERROR(
+          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
+                                              input.length, &out_arr->buffers[1]));
+    }
+
+    // Allocate space for output data
+    int64_t data_nbytes = input_boxed.total_values_length();
+    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
+    if (input.length > 0) {
+      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
+                out_arr->buffers[2]->mutable_data());
+    }
+  } else {
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
+    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
+    if (input.is_valid) {
+      result->is_valid = true;
+      int64_t data_nbytes = input.value->size();
+      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
+      transform(input.value->data(), data_nbytes, result->value->mutable_data());
+    }
+    out->value = result;
+  }
+}
+
+// Whether the character data of a string array or scalar is all ASCII
+template <typename Type>
+bool IsAsciiInput(const Datum& input) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  if (input.kind() == Datum::ARRAY) {
+    ArrayType input_boxed(input.array());
+    return input_boxed.length() == 0 ||
+           util::ValidateAscii(input_boxed.raw_data() + input_boxed.value_offset(0),
+                               input_boxed.total_values_length());
+  }
+  const auto& scalar = checked_cast<const BaseBinaryScalar&>(*input.scalar());
+  return !scalar.is_valid ||
+         util::ValidateAscii(scalar.value->data(), scalar.value->size());
+}
+
+void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
+  std::transform(input, input + length, output, ascii_toupper);
+}
+
+template <typename Type>
+struct AsciiUpper {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
+  }
+};
+
+void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
+  std::transform(input, input + length, output, ascii_tolower);
+}
+
+template <typename Type>
+struct AsciiLower {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
+  }
+};
+
 /// Transform string -> string with a reasonable guess on the maximum number of codepoints
 template <typename Type, typename Derived>
 struct StringTransform {
@@ -202,6 +298,11 @@ struct StringTransformCodepoint : StringTransform<Type, Derived> {
 
   bool Transform(const uint8_t* input, offset_type input_string_ncodeunits,
                  uint8_t* output, offset_type* output_written) {
+    if (util::ValidateAscii(input, input_string_ncodeunits)) {
+      Derived::TransformAscii(input, input_string_ncodeunits, output);
+      *output_written = input_string_ncodeunits;
+      return true;
+    }
     uint8_t* output_start = output;
     if (ARROW_PREDICT_FALSE(
             !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
@@ -221,6 +322,12 @@ struct StringTransformCodepoint : StringTransform<Type, Derived> {
     return static_cast<int64_t>(input_ncodeunits) * 3 / 2;
   }
   void Execute(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (IsAsciiInput<Type>(batch[0])) {
+      // ASCII codepoints map to ASCII codepoints, so the offsets are kept and the
+      // character data transformed as a whole
+      StringDataTransform<Type>(ctx, batch, Derived::TransformAscii, out);
+      return;
+    }
     EnsureLookupTablesFilled();
     Base::Execute(ctx, batch, out);
   }
@@ -232,6 +339,9 @@ struct UTF8Upper : StringTransformCodepoint<Type, UTF8Upper<Type>> {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
   }
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiUpper(input, length, output);
+  }
 };
 
 template <typename Type>
@@ -240,6 +350,9 @@ struct UTF8Lower : StringTransformCodepoint<Type, UTF8Lower<Type>> {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
   }
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiLower(input, length, output);
+  }
 };
 
 #else
@@ -248,91 +361,6 @@ void EnsureLookupTablesFilled() {}
 
 #endif  // ARROW_WITH_UTF8PROC
 
-using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
-
-// Transform a buffer of offsets to one which begins with 0 and has same
-// value lengths.
-template <typename T>
-Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
-                         int64_t length, std::shared_ptr<Buffer>* out) {
-  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
-  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
-  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
-  T first_offset = *input_offsets;
-  for (int64_t i = 0; i < length; ++i) {
-    *out_offsets++ = input_offsets[i] - first_offset;
-  }
-  *out_offsets = input_offsets[length] - first_offset;
-  return Status::OK();
-}
-
-// Apply `transform` to input character data- this function cannot change the
-// length
-template <typename Type>
-void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
-                         TransformFunc transform, Datum* out) {
-  using ArrayType = typename TypeTraits<Type>::ArrayType;
-  using offset_type = typename Type::offset_type;
-
-  if (batch[0].kind() == Datum::ARRAY) {
-    const ArrayData& input = *batch[0].array();
-    ArrayType input_boxed(batch[0].array());
-
-    ArrayData* out_arr = out->mutable_array();
-
-    if (input.offset == 0) {
-      // We can reuse offsets from input
-      out_arr->buffers[1] = input.buffers[1];
-    } else {
-      DCHECK(input.buffers[1]);
-      // We must allocate new space for the offsets and shift the existing offsets
-      KERNEL_RETURN_IF_ERROR(
-          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
-                                              input.length, &out_arr->buffers[1]));
-    }
-
-    // Allocate space for output data
-    int64_t data_nbytes = input_boxed.total_values_length();
-    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
-    if (input.length > 0) {
-      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
-                out_arr->buffers[2]->mutable_data());
-    }
-  } else {
-    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
-    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
-    if (input.is_valid) {
-      result->is_valid = true;
-      int64_t data_nbytes = input.value->size();
-      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
-      transform(input.value->data(), data_nbytes, result->value->mutable_data());
-    }
-    out->value = result;
-  }
-}
-
-void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
-}
-
-template <typename Type>
-struct AsciiUpper {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
-  }
-};
-
-void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
-}
-
-template <typename Type>
-struct AsciiLower {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
-  }
-};
-
 // ----------------------------------------------------------------------
 // exact pattern detection
 
@@ -494,6 +522,221 @@ void AddMatchSubstring(FunctionRegistry* registry) {
 #endif
 }
 
+// ----------------------------------------------------------------------
+// Multiple pattern detection
+
+// An Aho-Corasick automaton over the bytes of the patterns, which finds all of
+// them in a single pass over a string.  Its transitions are a dense table over
+// the classes of bytes, where all bytes absent from the patterns are one class.
+class MultiSubstringMatcher {
+ public:
+  MultiSubstringMatcher(KernelContext* ctx, const MatchAnySubstringOptions& options) {
+    const auto& patterns = options.patterns;
+    byte_classes_.fill(0);
+    for (const auto& pattern : patterns) {
+      for (const auto c : pattern) {
+        auto& byte_class = byte_classes_[static_cast<uint8_t>(c)];
+        if (byte_class == 0) {
+          byte_class = static_cast<uint16_t>(num_classes_++);
+        }
+      }
+    }
+
+    // Build the trie, where missing transitions are -1...
+    AddState();
+    for (int32_t index = 0; index < static_cast<int32_t>(patterns.size()); ++index) {
+      int32_t state = 0;
+      for (const auto c : patterns[index]) {
+        int32_t* next = &transitions_[Transition(state, static_cast<uint8_t>(c))];
+        if (*next == -1) {
+          // AddState() may reallocate the transitions
+          const int32_t added = AddState();
+          next = &transitions_[Transition(state, static_cast<uint8_t>(c))];
+          *next = added;
+        }
+        state = *next;
+      }
+      if (matches_[state] == -1) {
+        matches_[state] = index;
+      }
+    }
+
+    // ...then, breadth-first, replace them by the transitions of the longest
+    // proper suffix in the trie (the failure link), and inherit its matches
+    std::vector<int32_t> failures(matches_.size(), 0);
+    std::vector<int32_t> queue;
+    for (int byte_class = 0; byte_class < num_classes_; ++byte_class) {
+      int32_t& next = transitions_[byte_class];
+      if (next == -1) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    for (size_t i = 0; i < queue.size(); ++i) {
+      const int32_t state = queue[i];
+      const int32_t failure = failures[state];
+      if (matches_[failure] != -1 &&
+          (matches_[state] == -1 || matches_[failure] < matches_[state])) {
+        matches_[state] = matches_[failure];
+      }
+      for (int byte_class = 0; byte_class < num_classes_; ++byte_class) {
+        int32_t& next = transitions_[state * num_classes_ + byte_class];
+        const int32_t failure_next = transitions_[failure * num_classes_ + byte_class];
+        if (next == -1) {
+          next = failure_next;
+        } else {
+          failures[next] = failure_next;
+          queue.push_back(next);
+        }
+      }
+    }
+  }
+
+  // Whether any pattern occurs in `current`
+  bool Match(util::string_view current) const {
+    int32_t state = 0;
+    if (matches_[state] != -1) return true;
+    for (const auto c : current) {
+      state = transitions_[Transition(state, static_cast<uint8_t>(c))];
+      if (matches_[state] != -1) return true;
+    }
+    return false;
+  }
+
+  // The lowest index of the patterns occurring in `current`, or -1
+  int32_t MatchIndex(util::string_view current) const {
+    int32_t state = 0;
+    int32_t index = matches_[state];
+    for (const auto c : current) {
+      if (index == 0) break;
+      state = transitions_[Transition(state, static_cast<uint8_t>(c))];
+      const int32_t match = matches_[state];
+      if (match != -1 && (index == -1 || match < index)) {
+        index = match;
+      }
+    }
+    return index;
+  }
+
+ private:
+  int64_t Transition(int32_t state, uint8_t c) const {
+    return static_cast<int64_t>(state) * num_classes_ + byte_classes_[c];
+  }
+
+  int32_t AddState() {
+    transitions_.resize(transitions_.size() + num_classes_, -1);
+    matches_.push_back(-1);
+    return static_cast<int32_t>(matches_.size() - 1);
+  }
+
+  std::array<uint16_t, 256> byte_classes_;
+  int num_classes_ = 1;
+  std::vector<int32_t> transitions_;
+  // The lowest index of the patterns which are suffixes of each state, or -1
+  std::vector<int32_t> matches_;
+};
+
+using MultiSubstringMatcherState =
+    KernelStateFromFunctionOptions<MultiSubstringMatcher, MatchAnySubstringOptions>;
+
+template <typename Type>
+struct MatchAnySubstring {
+  using offset_type = typename Type::offset_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const MultiSubstringMatcher& matcher = MultiSubstringMatcherState::Get(ctx);
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&matcher](const void* raw_offsets, const uint8_t* data, int64_t length,
+                   int64_t output_offset, uint8_t* output) {
+          const offset_type* offsets = reinterpret_cast<const offset_type*>(raw_offsets);
+          FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+          for (int64_t i = 0; i < length; ++i) {
+            const char* current_data = reinterpret_cast<const char*>(data + offsets[i]);
+            int64_t current_length = offsets[i + 1] - offsets[i];
+            if (matcher.Match(util::string_view(current_data, current_length))) {
+              bitmap_writer.Set();
+            }
+            bitmap_writer.Next();
+          }
+          bitmap_writer.Finish();
+        },
+        out);
+  }
+};
+
+template <typename Type>
+struct MatchAnySubstringIndex {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const MultiSubstringMatcher& matcher = MultiSubstringMatcherState::Get(ctx);
+    ArrayType input(batch[0].array());
+    Int32Builder builder(ctx->memory_pool());
+    KERNEL_RETURN_IF_ERROR(ctx, builder.Reserve(input.length()));
+    for (int64_t i = 0; i < input.length(); ++i) {
+      const int32_t index = input.IsNull(i) ? -1 : matcher.MatchIndex(input.GetView(i));
+      if (index == -1) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(index);
+      }
+    }
+    std::shared_ptr<ArrayData> out_data;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&out_data));
+    out->value = std::move(out_data);
+  }
+};
+
+const FunctionDoc match_any_substring_doc(
+    "Match strings against several literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns.  Each string is scanned once, whatever the number of patterns.\n"
+     "Null inputs emit null.  The patterns must be given in\n"
+     "MatchAnySubstringOptions."),
+    {"strings"}, "MatchAnySubstringOptions");
+
+const FunctionDoc match_any_substring_index_doc(
+    "Find which of several literal patterns strings contain",
+    ("For each string in `strings`, emit the lowest index of the given patterns\n"
+     "it contains, or null if it contains none.  Each string is scanned once,\n"
+     "whatever the number of patterns.  Null inputs emit null.  The patterns\n"
+     "must be given in MatchAnySubstringOptions."),
+    {"strings"}, "MatchAnySubstringOptions");
+
+void AddMatchAnySubstring(FunctionRegistry* registry) {
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_substring", Arity::Unary(),
+                                                 &match_any_substring_doc);
+    auto exec_32 = MatchAnySubstring<StringType>::Exec;
+    auto exec_64 = MatchAnySubstring<LargeStringType>::Exec;
+    DCHECK_OK(func->AddKernel({utf8()}, boolean(), exec_32,
+                              MultiSubstringMatcherState::Init));
+    DCHECK_OK(func->AddKernel({large_utf8()}, boolean(), exec_64,
+                              MultiSubstringMatcherState::Init));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    // Builds its own output, including the validity of strings without matches
+    auto func = std::make_shared<ScalarFunction>(
+        "match_any_substring_index", Arity::Unary(), &match_any_substring_index_doc);
+    for (const auto& ty : {utf8(), large_utf8()}) {
+      ScalarKernel kernel({ty}, int32(),
+                          ty->id() == Type::STRING
+                              ? MatchAnySubstringIndex<StringType>::Exec
+                              : MatchAnySubstringIndex<LargeStringType>::Exec,
+                          MultiSubstringMatcherState::Init);
+      kernel.exec = TrivialScalarUnaryAsArraysExec(kernel.exec,
+                                                   NullHandling::COMPUTED_NO_PREALLOCATE);
+      kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      DCHECK_OK(func->AddKernel(std::move(kernel)));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
 // IsAlpha/Digit etc
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -1513,28 +1756,51 @@ Result<ValueDescr> StrptimeResolve(KernelContext* ctx, const std::vector<ValueDe
 
 #ifdef ARROW_WITH_UTF8PROC
 
+// Narrow [*begin, *end) to exclude the codepoints at its start (if `left`) and
+// end (if `right`) for which `trimmed` is true.  Bytes below 0x80 are always
+// whole codepoints in UTF8, so ASCII characters are tested without decoding.
+template <bool left, bool right, typename Predicate>
+bool TrimCodepoints(const uint8_t** begin, const uint8_t** end, Predicate&& trimmed) {
+  const uint8_t* first = *begin;
+  const uint8_t* last = *end;
+  auto kept = [&](uint32_t c) { return !trimmed(c); };
+  if (left) {
+    while (first < last && *first < 0x80 && trimmed(*first)) {
+      ++first;
+    }
+    if (first < last && *first >= 0x80 &&
+        !arrow::util::UTF8FindIf(first, last, kept, &first)) {
+      return false;
+    }
+  }
+  if (right) {
+    while (first < last && last[-1] < 0x80 && trimmed(last[-1])) {
+      --last;
+    }
+    if (first < last && last[-1] >= 0x80 &&
+        !arrow::util::UTF8FindIfReverse(first, last, kept, &last)) {
+      return false;
+    }
+  }
+  *begin = first;
+  *end = last;
+  return true;
+}
+
 template <typename Type, bool left, bool right, typename Derived>
 struct UTF8TrimWhitespaceBase : StringTransform<Type, Derived> {
   using Base = StringTransform<Type, Derived>;
   using offset_type = typename Base::offset_type;
   bool Transform(const uint8_t* input, offset_type input_string_ncodeunits,
                  uint8_t* output, offset_type* output_written) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
-    const uint8_t* end_trimmed = end;
-    const uint8_t* begin_trimmed = begin;
+    const uint8_t* begin_trimmed = input;
+    const uint8_t* end_trimmed = input + input_string_ncodeunits;
 
-    auto predicate = [](uint32_t c) { return !IsSpaceCharacterUnicode(c); };
-    if (left && !ARROW_PREDICT_TRUE(
-                    arrow::util::UTF8FindIf(begin, end, predicate, &begin_trimmed))) {
+    auto trimmed = [](uint32_t c) { return IsSpaceCharacterUnicode(c); };
+    if (!ARROW_PREDICT_TRUE(
+            (TrimCodepoints<left, right>(&begin_trimmed, &end_trimmed, trimmed)))) {
       return false;
     }
-    if (right && (begin_trimmed < end)) {
-      if (!ARROW_PREDICT_TRUE(arrow::util::UTF8FindIfReverse(begin_trimmed, end,
-                                                             predicate, &end_trimmed))) {
-        return false;
-      }
-    }
     std::copy(begin_trimmed, end_trimmed, output);
     *output_written = static_cast<offset_type>(end_trimmed - begin_trimmed);
     return true;
@@ -1594,25 +1860,15 @@ struct UTF8TrimBase : StringTransform<Type, Derived> {
 
   bool Transform(const uint8_t* input, offset_type input_string_ncodeunits,
                  uint8_t* output, offset_type* output_written) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
-    const uint8_t* end_trimmed = end;
-    const uint8_t* begin_trimmed = begin;
+    const uint8_t* begin_trimmed = input;
+    const uint8_t* end_trimmed = input + input_string_ncodeunits;
 
-    auto predicate = [&](uint32_t c) {
-      bool contains = state_.codepoints_[c];
-      return !contains;
-    };
-    if (left && !ARROW_PREDICT_TRUE(
-                    arrow::util::UTF8FindIf(begin, end, predicate, &begin_trimmed))) {
+    const auto& codepoints = state_.codepoints_;
+    auto trimmed = [&](uint32_t c) { return c < codepoints.size() && codepoints[c]; };
+    if (!ARROW_PREDICT_TRUE(
+            (TrimCodepoints<left, right>(&begin_trimmed, &end_trimmed, trimmed)))) {
       return false;
     }
-    if (right && (begin_trimmed < end)) {
-      if (!ARROW_PREDICT_TRUE(arrow::util::UTF8FindIfReverse(begin_trimmed, end,
-                                                             predicate, &end_trimmed))) {
-        return false;
-      }
-    }
     std::copy(begin_trimmed, end_trimmed, output);
     *output_written = static_cast<offset_type>(end_trimmed - begin_trimmed);
     return true;
@@ -1860,16 +2116,33 @@ void AddBinaryLength(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
+template <typename OutType, typename Type>
+struct Utf8LengthExec {
+  using offset_type = typename Type::offset_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].kind() == Datum::ARRAY && IsAsciiInput<Type>(batch[0])) {
+      // Every byte is a codepoint: the lengths are the differences of the offsets
+      const ArrayData& input = *batch[0].array();
+      const offset_type* offsets = input.GetValues<offset_type>(1);
+      offset_type* lengths = out->mutable_array()->GetMutableValues<offset_type>(1);
+      for (int64_t i = 0; i < input.length; ++i) {
+        lengths[i] = offsets[i + 1] - offsets[i];
+      }
+      return;
+    }
+    applicator::ScalarUnaryNotNull<OutType, Type, Utf8Length>::Exec(ctx, batch, out);
+  }
+};
+
 void AddUtf8Length(FunctionRegistry* registry) {
   auto func =
       std::make_shared<ScalarFunction>("utf8_length", Arity::Unary(), &utf8_length_doc);
 
-  ArrayKernelExec exec_offset_32 =
-      applicator::ScalarUnaryNotNull<Int32Type, StringType, Utf8Length>::Exec;
+  ArrayKernelExec exec_offset_32 = Utf8LengthExec<Int32Type, StringType>::Exec;
   DCHECK_OK(func->AddKernel({utf8()}, int32(), std::move(exec_offset_32)));
 
-  ArrayKernelExec exec_offset_64 =
-      applicator::ScalarUnaryNotNull<Int64Type, LargeStringType, Utf8Length>::Exec;
+  ArrayKernelExec exec_offset_64 = Utf8LengthExec<Int64Type, LargeStringType>::Exec;
   DCHECK_OK(func->AddKernel({large_utf8()}, int64(), std::move(exec_offset_64)));
 
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -2146,6 +2419,7 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddBinaryLength(registry);
   AddUtf8Length(registry);
   AddMatchSubstring(registry);
+  AddMatchAnySubstring(registry);
   MakeUnaryStringBatchKernelWithState<ReplaceSubStringPlain>(
       "replace_substring", registry, &replace_substring_doc,
       MemAllocation::NO_PREALLOCATE);
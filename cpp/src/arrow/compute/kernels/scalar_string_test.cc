@@ -16,6 +16,9 @@
 // under the License.
 
 #include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -23,9 +26,11 @@
 #include <utf8proc.h>
 #endif
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace compute {
@@ -113,6 +118,9 @@ TYPED_TEST(TestStringKernels, Utf8Length) {
   this->CheckUnary("utf8_length",
                    R"(["aaa", null, "áéíóú", "ɑɽⱤoW😀", "áéí 0😀", "", "b"])",
                    this->offset_type(), "[3, null, 5, 6, 6, 0, 1]");
+  // All ASCII
+  this->CheckUnary("utf8_length", R"(["aaa", null, "", "b", "a long string of ASCII"])",
+                   this->offset_type(), "[3, null, 0, 1, 22]");
 }
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -121,6 +129,10 @@ TYPED_TEST(TestStringKernels, Utf8Upper) {
   this->CheckUnary("utf8_upper", "[\"aAazZæÆ&\", null, \"\", \"b\"]", this->type(),
                    "[\"AAAZZÆÆ&\", null, \"\", \"B\"]");
 
+  // All ASCII
+  this->CheckUnary("utf8_upper", "[\"aAazZ&\", null, \"\", \"hello World\"]",
+                   this->type(), "[\"AAAZZ&\", null, \"\", \"HELLO WORLD\"]");
+
   // test varying encoding lenghts and thus changing indices/offsets
   this->CheckUnary("utf8_upper", "[\"ɑɽⱤoW\", null, \"ıI\", \"b\"]", this->type(),
                    "[\"ⱭⱤⱤOW\", null, \"II\", \"B\"]");
@@ -142,6 +154,10 @@ TYPED_TEST(TestStringKernels, Utf8Lower) {
   this->CheckUnary("utf8_lower", "[\"aAazZæÆ&\", null, \"\", \"b\"]", this->type(),
                    "[\"aaazzææ&\", null, \"\", \"b\"]");
 
+  // All ASCII
+  this->CheckUnary("utf8_lower", "[\"aAazZ&\", null, \"\", \"hello World\"]",
+                   this->type(), "[\"aaazz&\", null, \"\", \"hello world\"]");
+
   // test varying encoding lengths and thus changing indices/offsets
   this->CheckUnary("utf8_lower", "[\"ⱭɽⱤoW\", null, \"ıI\", \"B\"]", this->type(),
                    "[\"ɑɽɽow\", null, \"ıi\", \"b\"]");
@@ -348,6 +364,123 @@ TYPED_TEST(TestStringKernels, MatchSubstring) {
                    &options_double_char_2);
 }
 
+TYPED_TEST(TestStringKernels, MatchAnySubstring) {
+  // Overlapping patterns, and patterns which are suffixes of others
+  MatchAnySubstringOptions options{{"he", "she", "his", "hers"}};
+  auto input = R"(["ushers", "hi", "this", "", null, "h", "ahishers", "sh"])";
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring", input, boolean(),
+                   "[true, false, true, false, null, false, true, false]", &options);
+  this->CheckUnary("match_any_substring_index", "[]", int32(), "[]", &options);
+  this->CheckUnary("match_any_substring_index", input, int32(),
+                   "[0, null, 2, null, null, null, 0, null]", &options);
+
+  MatchAnySubstringOptions options_none{{}};
+  this->CheckUnary("match_any_substring", R"(["abc", "", null])", boolean(),
+                   "[false, false, null]", &options_none);
+  this->CheckUnary("match_any_substring_index", R"(["abc", "", null])", int32(),
+                   "[null, null, null]", &options_none);
+
+  // The empty pattern is in every string
+  MatchAnySubstringOptions options_empty{{"bc", ""}};
+  this->CheckUnary("match_any_substring", R"(["abc", "", null])", boolean(),
+                   "[true, true, null]", &options_empty);
+  this->CheckUnary("match_any_substring_index", R"(["abc", "", null])", int32(),
+                   "[0, 1, null]", &options_empty);
+
+  MatchAnySubstringOptions options_utf8{{"é", "\xe2\x82"}};
+  this->CheckUnary("match_any_substring_index", R"(["café", "€", "e"])", int32(),
+                   "[0, 1, null]", &options_utf8);
+
+  ASSERT_RAISES(Invalid, CallFunction("match_any_substring",
+                                      {ArrayFromJSON(this->type(), "[]")}));
+}
+
+TYPED_TEST(TestStringKernels, MatchAnySubstringRandom) {
+  // Many short patterns over a small alphabet, to exercise the failure links
+  std::mt19937 gen(42);
+  auto random_string = [&](int max_length) {
+    std::string s(std::uniform_int_distribution<int>(0, max_length)(gen), 'a');
+    for (auto& c : s) {
+      c = static_cast<char>('a' + std::uniform_int_distribution<int>(0, 3)(gen));
+    }
+    return s;
+  };
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 200; ++i) {
+    patterns.push_back(random_string(6) + "b");
+  }
+  std::vector<std::string> strings;
+  for (int i = 0; i < 500; ++i) {
+    strings.push_back(random_string(30));
+  }
+
+  typename TypeTraits<TypeParam>::BuilderType builder;
+  BooleanBuilder expected_match;
+  Int32Builder expected_index;
+  for (const auto& s : strings) {
+    ASSERT_OK(builder.Append(s));
+    int32_t index = -1;
+    for (size_t i = 0; i < patterns.size() && index == -1; ++i) {
+      if (s.find(patterns[i]) != std::string::npos) {
+        index = static_cast<int32_t>(i);
+      }
+    }
+    ASSERT_OK(expected_match.Append(index != -1));
+    ASSERT_OK(index == -1 ? expected_index.AppendNull() : expected_index.Append(index));
+  }
+  std::shared_ptr<Array> input;
+  ASSERT_OK(builder.Finish(&input));
+
+  MatchAnySubstringOptions options{patterns};
+  CheckScalarUnary("match_any_substring", input, expected_match.Finish().ValueOrDie(),
+                   &options);
+  CheckScalarUnary("match_any_substring_index", input,
+                   expected_index.Finish().ValueOrDie(), &options);
+}
+
+TYPED_TEST(TestStringKernels, DictionaryInput) {
+  auto dict = ArrayFromJSON(this->type(), R"(["foo", "Bar", null, "bazfoo"])");
+  auto indices = ArrayFromJSON(int32(), "[0, 1, null, 2, 3, 0, 3]");
+  ASSERT_OK_AND_ASSIGN(
+      auto dict_array,
+      DictionaryArray::FromArrays(dictionary(int32(), this->type()), indices, dict));
+
+  // String results are dictionary-encoded with the input indices
+  ASSERT_OK_AND_ASSIGN(Datum upper, CallFunction("ascii_upper", {dict_array}));
+  auto upper_array = upper.make_array();
+  ASSERT_OK(upper_array->ValidateFull());
+  AssertTypeEqual(*dictionary(int32(), this->type()), *upper_array->type());
+  const auto& upper_dict =
+      ::arrow::internal::checked_cast<const DictionaryArray&>(*upper_array);
+  AssertArraysEqual(*indices, *upper_dict.indices());
+  AssertArraysEqual(*ArrayFromJSON(this->type(), R"(["FOO", "BAR", null, "BAZFOO"])"),
+                    *upper_dict.dictionary());
+
+  // Other results are decoded
+  ASSERT_OK_AND_ASSIGN(Datum lengths, CallFunction("binary_length", {dict_array}));
+  AssertArraysEqual(*ArrayFromJSON(this->offset_type(), "[3, 3, null, null, 6, 3, 6]"),
+                    *lengths.make_array());
+  MatchSubstringOptions options{"foo"};
+  ASSERT_OK_AND_ASSIGN(Datum matches,
+                       CallFunction("match_substring", {dict_array}, &options));
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[true, false, null, null, true, true, true]"),
+      *matches.make_array());
+
+  // Chunked input, chunks sharing a dictionary
+  auto chunked =
+      std::make_shared<ChunkedArray>(ArrayVector{dict_array, dict_array->Slice(4)});
+  ASSERT_OK_AND_ASSIGN(lengths, CallFunction("binary_length", {chunked}));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(this->offset_type(),
+                                            {"[3, 3, null, null, 6, 3, 6]", "[6, 3, 6]"}),
+                     *lengths.chunked_array());
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, dict_array->type());
+  ASSERT_OK_AND_ASSIGN(lengths, CallFunction("binary_length", {empty}));
+  AssertChunkedEqual(ChunkedArray(ArrayVector{}, this->offset_type()),
+                     *lengths.chunked_array());
+}
+
 #ifdef ARROW_WITH_RE2
 TYPED_TEST(TestStringKernels, MatchSubstringRegex) {
   MatchSubstringOptions options{"ab"};
@@ -523,6 +656,11 @@ TYPED_TEST(TestStringKernels, TrimWhitespaceUTF8) {
   this->CheckUnary("utf8_ltrim_whitespace",
                    "[\" \\tfoo\", null, \"bar  \", \" \xe2\x80\x88 foo bar \"]",
                    this->type(), "[\"foo\", null, \"bar  \", \"foo bar \"]");
+
+  // ASCII whitespace next to non-ASCII characters
+  this->CheckUnary("utf8_trim_whitespace",
+                   "[\" é \", \"é \xe2\x80\x88\", \"\\t\xe2\x80\x88 \", \" \"]",
+                   this->type(), "[\"é\", \"é\", \"\", \"\"]");
 }
 
 TYPED_TEST(TestStringKernels, TrimUTF8) {
@@ -535,6 +673,9 @@ TYPED_TEST(TestStringKernels, TrimUTF8) {
   this->CheckUnary("utf8_rtrim", "[\"ȺȺfooȺAȺ\", null, \"barȺAȺ\", \"ȺAȺfooȺAȺbarA\"]",
                    this->type(), "[\"ȺȺfoo\", null, \"bar\", \"ȺAȺfooȺAȺbar\"]",
                    &options);
+  // Characters above all the trimmed ones
+  this->CheckUnary("utf8_trim", "[\"AAx😀A\", \"😀\", \"A\"]", this->type(),
+                   "[\"x😀\", \"😀\", \"\"]", &options);
 
   TrimOptions options_invalid{"ɑa\xFFɑ"};
   auto input = ArrayFromJSON(this->type(), "[\"foo\"]");
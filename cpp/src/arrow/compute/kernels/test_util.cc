@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/test_util.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -196,5 +198,14 @@ void CheckDispatchBest(std::string func_name, std::vector<ValueDescr> original_v
       << expected_kernel->signature->ToString();
 }
 
+ScopedCpuThreadPoolCapacity::ScopedCpuThreadPoolCapacity(int min_capacity)
+    : original_capacity_(GetCpuThreadPoolCapacity()) {
+  ARROW_EXPECT_OK(SetCpuThreadPoolCapacity(std::max(original_capacity_, min_capacity)));
+}
+
+ScopedCpuThreadPoolCapacity::~ScopedCpuThreadPoolCapacity() {
+  ARROW_EXPECT_OK(SetCpuThreadPoolCapacity(original_capacity_));
+}
+
 }  // namespace compute
 }  // namespace arrow
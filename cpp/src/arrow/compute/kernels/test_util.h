@@ -148,5 +148,17 @@ void TestRandomPrimitiveCTypes() {
 void CheckDispatchBest(std::string func_name, std::vector<ValueDescr> descrs,
                        std::vector<ValueDescr> exact_descrs);
 
+// Raise the capacity of the CPU thread pool to at least `min_capacity` for the
+// lifetime of this object, so that parallel code paths run several tasks even
+// on machines with few cores.
+class ScopedCpuThreadPoolCapacity {
+ public:
+  explicit ScopedCpuThreadPoolCapacity(int min_capacity = 4);
+  ~ScopedCpuThreadPoolCapacity();
+
+ private:
+  int original_capacity_;
+};
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,581 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels computing cumulative (running) and rolling window aggregates
+//
+// The running value, or the values of the current window, are kept in the
+// KernelState.  Chunked input is therefore processed one chunk at a time, in
+// order, without concatenating the chunks.
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// Integer arithmetic wraps around on overflow, like the "add" and "multiply"
+// functions
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> WrappingAdd(T left, T right) {
+  return static_cast<T>(static_cast<uint64_t>(left) + static_cast<uint64_t>(right));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> WrappingAdd(T left, T right) {
+  return left + right;
+}
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> WrappingSubtract(T left, T right) {
+  return static_cast<T>(static_cast<uint64_t>(left) - static_cast<uint64_t>(right));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> WrappingSubtract(T left, T right) {
+  return left - right;
+}
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> WrappingMultiply(T left, T right) {
+  return static_cast<T>(static_cast<uint64_t>(left) * static_cast<uint64_t>(right));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> WrappingMultiply(T left, T right) {
+  return left * right;
+}
+
+struct SumOp {
+  template <typename T>
+  static T Identity() {
+    return 0;
+  }
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return WrappingAdd(left, right);
+  }
+};
+
+struct ProductOp {
+  template <typename T>
+  static T Identity() {
+    return 1;
+  }
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return WrappingMultiply(left, right);
+  }
+};
+
+// NaN is unordered: it never replaces the running minimum or maximum
+struct MinOp {
+  template <typename T>
+  static T Identity() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+  }
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return right < left ? right : left;
+  }
+};
+
+struct MaxOp {
+  template <typename T>
+  static T Identity() {
+    return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::lowest();
+  }
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return left < right ? right : left;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Cumulative functions
+
+// Write the running aggregate of `length` values to `out`, starting from
+// `*current` and updating it
+template <typename Op, typename T>
+enable_if_t<!(std::is_same<Op, SumOp>::value && std::is_integral<T>::value)> ScanValues(
+    const T* values, int64_t length, T* current, T* out) {
+  T acc = *current;
+  for (int64_t i = 0; i < length; ++i) {
+    acc = Op::Call(acc, values[i]);
+    out[i] = acc;
+  }
+  *current = acc;
+}
+
+// Wrapping integer addition is associative, so each block of values is
+// prefix-summed on its own, in log2(kBlockSize) data-parallel steps the
+// compiler turns into vector shifts and adds, before adding the running total.
+// Floating-point sums keep the serial loop above, to round like a serial sum.
+template <typename Op, typename T>
+enable_if_t<std::is_same<Op, SumOp>::value && std::is_integral<T>::value> ScanValues(
+    const T* values, int64_t length, T* current, T* out) {
+  using U = typename std::make_unsigned<T>::type;
+  constexpr int kBlockSize = 8;
+
+  U acc = static_cast<U>(*current);
+  int64_t i = 0;
+  for (; i + kBlockSize <= length; i += kBlockSize) {
+    U block[kBlockSize];
+    for (int j = 0; j < kBlockSize; ++j) {
+      block[j] = static_cast<U>(values[i + j]);
+    }
+    for (int shift = 1; shift < kBlockSize; shift *= 2) {
+      U shifted[kBlockSize];
+      for (int j = 0; j < kBlockSize; ++j) {
+        shifted[j] = j < shift ? 0 : block[j - shift];
+      }
+      for (int j = 0; j < kBlockSize; ++j) {
+        block[j] = static_cast<U>(block[j] + shifted[j]);
+      }
+    }
+    for (int j = 0; j < kBlockSize; ++j) {
+      out[i + j] = static_cast<T>(static_cast<U>(acc + block[j]));
+    }
+    acc = static_cast<U>(acc + block[kBlockSize - 1]);
+  }
+  for (; i < length; ++i) {
+    acc = static_cast<U>(acc + static_cast<U>(values[i]));
+    out[i] = static_cast<T>(acc);
+  }
+  *current = static_cast<T>(acc);
+}
+
+template <typename ArgType, typename Op>
+struct CumulativeKernel {
+  using T = typename TypeTraits<ArgType>::CType;
+
+  struct State : public KernelState {
+    explicit State(CumulativeOptions options) : options(std::move(options)) {}
+
+    CumulativeOptions options;
+    // The running value at the end of the previous chunks
+    T current = Op::template Identity<T>();
+    // Whether a null was seen, when nulls are not skipped
+    bool null_seen = false;
+  };
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    if (auto options = static_cast<const CumulativeOptions*>(args.options)) {
+      return ::arrow::internal::make_unique<State>(*options);
+    }
+    ctx->SetStatus(
+        Status::Invalid("Attempted to initialize KernelState from null FunctionOptions"));
+    return NULLPTR;
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+    const int64_t length = input.length;
+    const int64_t null_count = input.GetNullCount();
+    const T* values = input.GetValues<T>(1);
+    T* out_values = output->GetMutableValues<T>(1);
+
+    if (!state->null_seen && null_count == 0) {
+      ScanValues<Op>(values, length, &state->current, out_values);
+      output->null_count = 0;
+      return;
+    }
+
+    // AllocateBitmap zeroes the bitmap, i.e. everything starts out null
+    KERNEL_ASSIGN_OR_RAISE(output->buffers[0], ctx, ctx->AllocateBitmap(length));
+    uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+    std::fill(out_values, out_values + length, T(0));
+    if (state->null_seen) {
+      output->null_count = length;
+      return;
+    }
+
+    const uint8_t* bitmap = input.buffers[0]->data();
+    if (state->options.skip_nulls) {
+      ::arrow::internal::CopyBitmap(bitmap, input.offset, length, out_bitmap, 0);
+      ::arrow::internal::VisitSetBitRunsVoid(
+          bitmap, input.offset, length, [&](int64_t position, int64_t run_length) {
+            ScanValues<Op>(values + position, run_length, &state->current,
+                           out_values + position);
+          });
+      output->null_count = null_count;
+    } else {
+      // Only the values before the first null are valid
+      ::arrow::internal::SetBitRunReader reader(bitmap, input.offset, length);
+      const auto run = reader.NextRun();
+      const int64_t num_valid = run.position == 0 ? run.length : 0;
+      ScanValues<Op>(values, num_valid, &state->current, out_values);
+      BitUtil::SetBitsTo(out_bitmap, 0, num_valid, true);
+      output->null_count = length - num_valid;
+      state->null_seen = true;
+    }
+  }
+};
+
+template <typename Op>
+struct Cumulative {
+  template <typename ArgType>
+  using Kernel = CumulativeKernel<ArgType, Op>;
+};
+
+// ----------------------------------------------------------------------
+// Rolling window functions
+
+// The aggregators see the non-null values of the current window as they enter
+// it, in row order, and are asked to evict the rows that have left it
+
+template <typename T, typename Acc>
+class RollingSumBase {
+ public:
+  void Push(int64_t row, T value) {
+    window_.emplace_back(row, value);
+    sum_ = WrappingAdd(sum_, static_cast<Acc>(value));
+  }
+
+  // Remove the values of the rows before `first_row`
+  void Evict(int64_t first_row) {
+    while (!window_.empty() && window_.front().first < first_row) {
+      sum_ = WrappingSubtract(sum_, static_cast<Acc>(window_.front().second));
+      window_.pop_front();
+    }
+    if (window_.empty()) {
+      // Drop any floating-point rounding error accumulated so far
+      sum_ = 0;
+    }
+  }
+
+  int64_t count() const { return static_cast<int64_t>(window_.size()); }
+
+ protected:
+  std::deque<std::pair<int64_t, T>> window_;
+  Acc sum_ = 0;
+};
+
+template <typename T>
+class RollingSum : public RollingSumBase<T, T> {
+ public:
+  using OutValue = T;
+
+  OutValue value() const { return this->sum_; }
+};
+
+template <typename T>
+class RollingMean : public RollingSumBase<T, double> {
+ public:
+  using OutValue = double;
+
+  OutValue value() const { return this->sum_ / this->count(); }
+};
+
+// Only the values which may still become the extremum of a later window are
+// kept, so the candidates are monotonic and the first one is the extremum.
+// NaN values are unordered and treated like nulls.
+template <typename T, typename Op>
+class RollingExtremum {
+ public:
+  using OutValue = T;
+
+  void Push(int64_t row, T value) {
+    if (value != value) {
+      return;
+    }
+    while (!candidates_.empty() &&
+           Op::Call(candidates_.back().second, value) == value) {
+      candidates_.pop_back();
+    }
+    candidates_.emplace_back(row, value);
+    rows_.push_back(row);
+  }
+
+  void Evict(int64_t first_row) {
+    while (!candidates_.empty() && candidates_.front().first < first_row) {
+      candidates_.pop_front();
+    }
+    while (!rows_.empty() && rows_.front() < first_row) {
+      rows_.pop_front();
+    }
+  }
+
+  int64_t count() const { return static_cast<int64_t>(rows_.size()); }
+
+  OutValue value() const { return candidates_.front().second; }
+
+ private:
+  std::deque<std::pair<int64_t, T>> candidates_;
+  // The rows of all non-null values in the window
+  std::deque<int64_t> rows_;
+};
+
+template <typename T>
+using RollingMin = RollingExtremum<T, MinOp>;
+
+template <typename T>
+using RollingMax = RollingExtremum<T, MaxOp>;
+
+template <typename ArgType, template <typename> class Aggregator>
+struct RollingKernel {
+  using T = typename TypeTraits<ArgType>::CType;
+  using OutValue = typename Aggregator<T>::OutValue;
+
+  struct State : public KernelState {
+    State(int64_t window_size, int64_t min_periods)
+        : window_size(window_size), min_periods(min_periods) {}
+
+    const int64_t window_size;
+    const int64_t min_periods;
+    // The number of rows in the previous chunks
+    int64_t num_rows = 0;
+    Aggregator<T> aggregator;
+  };
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const RollingWindowOptions*>(args.options);
+    if (options == nullptr) {
+      ctx->SetStatus(Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions"));
+      return NULLPTR;
+    }
+    if (options->window_size <= 0) {
+      ctx->SetStatus(Status::Invalid("Rolling window size must be strictly positive, got ",
+                                     options->window_size));
+      return NULLPTR;
+    }
+    if (options->min_periods > options->window_size) {
+      ctx->SetStatus(Status::Invalid("Rolling window min_periods (",
+                                     options->min_periods,
+                                     ") must not exceed the window size (",
+                                     options->window_size, ")"));
+      return NULLPTR;
+    }
+    // An empty window has no aggregate value
+    const int64_t min_periods =
+        options->min_periods < 0 ? options->window_size
+                                 : std::max<int64_t>(options->min_periods, 1);
+    return ::arrow::internal::make_unique<State>(options->window_size, min_periods);
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+    const int64_t length = input.length;
+    const uint8_t* bitmap = input.MayHaveNulls() ? input.buffers[0]->data() : NULLPTR;
+    const T* values = input.GetValues<T>(1);
+    OutValue* out_values = output->GetMutableValues<OutValue>(1);
+
+    KERNEL_ASSIGN_OR_RAISE(output->buffers[0], ctx, ctx->AllocateBitmap(length));
+    uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+
+    Aggregator<T>* aggregator = &state->aggregator;
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t row = state->num_rows + i;
+      aggregator->Evict(row - state->window_size + 1);
+      if (bitmap == NULLPTR || BitUtil::GetBit(bitmap, input.offset + i)) {
+        aggregator->Push(row, values[i]);
+      }
+      if (aggregator->count() >= state->min_periods) {
+        out_values[i] = aggregator->value();
+        BitUtil::SetBit(out_bitmap, i);
+      } else {
+        out_values[i] = OutValue(0);
+        ++null_count;
+      }
+    }
+    state->num_rows += length;
+    output->null_count = null_count;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Registration
+
+template <template <typename> class KernelImpl>
+struct NumericKernelAdder {
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value || is_physical_floating_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    VectorKernel kernel;
+    kernel.init = KernelImpl<Type>::Init;
+    kernel.exec = KernelImpl<Type>::Exec;
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::PREALLOCATE;
+    kernel.signature = KernelSignature::Make(
+        {InputType::Array(type)}, out_type ? OutputType(out_type) : OutputType(type));
+    // The kernel state carries over from one chunk to the next
+    kernel.can_execute_chunkwise = true;
+    kernel.output_chunked = true;
+    return func->AddKernel(std::move(kernel));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("No kernel for type ", type);
+  }
+
+  VectorFunction* func;
+  std::shared_ptr<DataType> type;
+  // If null, the output type is the input type
+  std::shared_ptr<DataType> out_type;
+};
+
+template <template <typename> class KernelImpl>
+void AddNumericKernels(VectorFunction* func,
+                       const std::shared_ptr<DataType>& out_type = nullptr) {
+  for (const auto& type : NumericTypes()) {
+    NumericKernelAdder<KernelImpl> adder{func, type, out_type};
+    DCHECK_OK(VisitTypeInline(*type, &adder));
+  }
+}
+
+const auto kDefaultCumulativeOptions = CumulativeOptions::Defaults();
+const auto kDefaultRollingWindowOptions = RollingWindowOptions::Defaults();
+
+const FunctionDoc cumulative_sum_doc(
+    "Compute the cumulative sum over a numeric input",
+    ("`values` must be numeric.  Return an array/chunked array of the running sums,\n"
+     "with the same type as the input.  Integer sums wrap around on overflow.\n"
+     "By default, the first null and all values after it are emitted as null;\n"
+     "set `skip_nulls` in CumulativeOptions to skip nulls instead."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_prod_doc(
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric.  Return an array/chunked array of the running\n"
+     "products, with the same type as the input.  Integer products wrap around\n"
+     "on overflow.  Nulls are handled as in \"cumulative_sum\"."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_min_doc(
+    "Compute the cumulative minimum over a numeric input",
+    ("`values` must be numeric.  Return an array/chunked array of the running\n"
+     "minimums, with the same type as the input.  NaN values are ignored.\n"
+     "Nulls are handled as in \"cumulative_sum\"."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_max_doc(
+    "Compute the cumulative maximum over a numeric input",
+    ("`values` must be numeric.  Return an array/chunked array of the running\n"
+     "maximums, with the same type as the input.  NaN values are ignored.\n"
+     "Nulls are handled as in \"cumulative_sum\"."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc rolling_sum_doc(
+    "Compute the sum over a rolling window of rows",
+    ("`values` must be numeric.  Each output value is the sum of the non-null\n"
+     "values in the window of `window_size` rows ending at the same row,\n"
+     "with the same type as the input.  Windows with fewer than `min_periods`\n"
+     "non-null values produce a null."),
+    {"values"}, "RollingWindowOptions");
+
+const FunctionDoc rolling_mean_doc(
+    "Compute the mean over a rolling window of rows",
+    ("`values` must be numeric.  Each output value is the float64 mean of the\n"
+     "non-null values in the window of `window_size` rows ending at the same row.\n"
+     "Windows with fewer than `min_periods` non-null values produce a null."),
+    {"values"}, "RollingWindowOptions");
+
+const FunctionDoc rolling_min_doc(
+    "Compute the minimum over a rolling window of rows",
+    ("`values` must be numeric.  Each output value is the minimum of the non-null\n"
+     "values in the window of `window_size` rows ending at the same row.\n"
+     "NaN values are ignored.  Windows with fewer than `min_periods` non-null\n"
+     "values produce a null."),
+    {"values"}, "RollingWindowOptions");
+
+const FunctionDoc rolling_max_doc(
+    "Compute the maximum over a rolling window of rows",
+    ("`values` must be numeric.  Each output value is the maximum of the non-null\n"
+     "values in the window of `window_size` rows ending at the same row.\n"
+     "NaN values are ignored.  Windows with fewer than `min_periods` non-null\n"
+     "values produce a null."),
+    {"values"}, "RollingWindowOptions");
+
+template <template <typename> class KernelImpl>
+void RegisterCumulative(FunctionRegistry* registry, std::string name,
+                        const FunctionDoc* doc) {
+  auto func = std::make_shared<VectorFunction>(std::move(name), Arity::Unary(), doc,
+                                               &kDefaultCumulativeOptions);
+  AddNumericKernels<KernelImpl>(func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+template <template <typename> class Aggregator>
+struct Rolling {
+  template <typename ArgType>
+  using Kernel = RollingKernel<ArgType, Aggregator>;
+};
+
+template <template <typename> class Aggregator>
+void RegisterRolling(FunctionRegistry* registry, std::string name,
+                     const FunctionDoc* doc,
+                     const std::shared_ptr<DataType>& out_type = nullptr) {
+  auto func = std::make_shared<VectorFunction>(std::move(name), Arity::Unary(), doc,
+                                               &kDefaultRollingWindowOptions);
+  AddNumericKernels<Rolling<Aggregator>::template Kernel>(func.get(), out_type);
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace
+
+void RegisterVectorCumulative(FunctionRegistry* registry) {
+  RegisterCumulative<Cumulative<SumOp>::Kernel>(registry, "cumulative_sum",
+                                                &cumulative_sum_doc);
+  RegisterCumulative<Cumulative<ProductOp>::Kernel>(registry, "cumulative_prod",
+                                                    &cumulative_prod_doc);
+  RegisterCumulative<Cumulative<MinOp>::Kernel>(registry, "cumulative_min",
+                                                &cumulative_min_doc);
+  RegisterCumulative<Cumulative<MaxOp>::Kernel>(registry, "cumulative_max",
+                                                &cumulative_max_doc);
+
+  RegisterRolling<RollingSum>(registry, "rolling_sum", &rolling_sum_doc);
+  RegisterRolling<RollingMean>(registry, "rolling_mean", &rolling_mean_doc, float64());
+  RegisterRolling<RollingMin>(registry, "rolling_min", &rolling_min_doc);
+  RegisterRolling<RollingMax>(registry, "rolling_max", &rolling_max_doc);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
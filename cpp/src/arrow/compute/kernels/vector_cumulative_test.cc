@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+void CheckCumulative(const std::string& func_name, const std::shared_ptr<Array>& input,
+                     const std::shared_ptr<Array>& expected,
+                     const FunctionOptions& options) {
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, {input}, &options));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*expected, *result.make_array(), /*verbose=*/true);
+
+  // The result doesn't depend on how the input is chunked
+  if (input->length() == 0) {
+    return;
+  }
+  for (int64_t chunk_size : {1, 2, 3}) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < input->length(); offset += chunk_size) {
+      chunks.push_back(input->Slice(offset, chunk_size));
+    }
+    auto chunked = std::make_shared<ChunkedArray>(chunks, input->type());
+    ASSERT_OK_AND_ASSIGN(result, CallFunction(func_name, {chunked}, &options));
+    ASSERT_EQ(result.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_OK(result.chunked_array()->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto concatenated,
+                         Concatenate(result.chunked_array()->chunks()));
+    AssertArraysEqual(*expected, *concatenated, /*verbose=*/true);
+  }
+}
+
+template <typename ArrowType>
+class TestCumulativeKernel : public ::testing::Test {
+ protected:
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  void Check(const std::string& func_name, const std::string& input,
+             const std::string& expected, bool skip_nulls = false) {
+    CheckCumulative(func_name, ArrayFromJSON(type(), input),
+                    ArrayFromJSON(type(), expected), CumulativeOptions(skip_nulls));
+  }
+};
+
+TYPED_TEST_SUITE(TestCumulativeKernel, NumericArrowTypes);
+
+TYPED_TEST(TestCumulativeKernel, Sum) {
+  this->Check("cumulative_sum", "[]", "[]");
+  this->Check("cumulative_sum", "[1, 2, 3, 4, 5]", "[1, 3, 6, 10, 15]");
+  this->Check("cumulative_sum", "[1, 2, null, 4, 5]", "[1, 3, null, null, null]");
+  this->Check("cumulative_sum", "[null, 2, 3]", "[null, null, null]");
+  this->Check("cumulative_sum", "[1, 2, null, 4, 5]", "[1, 3, null, 7, 12]",
+              /*skip_nulls=*/true);
+  this->Check("cumulative_sum", "[null, null, 3]", "[null, null, 3]",
+              /*skip_nulls=*/true);
+}
+
+TYPED_TEST(TestCumulativeKernel, Product) {
+  this->Check("cumulative_prod", "[1, 2, 3, 4, 5]", "[1, 2, 6, 24, 120]");
+  this->Check("cumulative_prod", "[1, 2, null, 4, 5]", "[1, 2, null, null, null]");
+  this->Check("cumulative_prod", "[1, 2, null, 4, 5]", "[1, 2, null, 8, 40]",
+              /*skip_nulls=*/true);
+}
+
+TYPED_TEST(TestCumulativeKernel, MinMax) {
+  this->Check("cumulative_min", "[5, 3, 4, 1, 2]", "[5, 3, 3, 1, 1]");
+  this->Check("cumulative_max", "[1, 3, 2, 5, 4]", "[1, 3, 3, 5, 5]");
+  this->Check("cumulative_min", "[5, null, 4, 1]", "[5, null, null, null]");
+  this->Check("cumulative_max", "[1, null, 4, 2]", "[1, null, 4, 4]",
+              /*skip_nulls=*/true);
+}
+
+TEST(TestCumulativeSum, IntegerOverflowWraps) {
+  CheckCumulative("cumulative_sum", ArrayFromJSON(int8(), "[100, 27, 1, 1]"),
+                  ArrayFromJSON(int8(), "[100, 127, -128, -127]"),
+                  CumulativeOptions::Defaults());
+  CheckCumulative("cumulative_sum", ArrayFromJSON(uint8(), "[200, 55, 1]"),
+                  ArrayFromJSON(uint8(), "[200, 255, 0]"), CumulativeOptions::Defaults());
+}
+
+TEST(TestCumulativeSum, Random) {
+  // Long enough for the block-wise integer scan, with a few nulls
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  for (double null_probability : {0.0, 0.01}) {
+    auto input = rand.Int64(1000, -1000, 1000, null_probability);
+    const auto& values = checked_cast<const Int64Array&>(*input);
+
+    Int64Builder builder;
+    int64_t sum = 0;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) {
+        sum += values.Value(i);
+        ASSERT_OK(builder.Append(sum));
+      } else {
+        ASSERT_OK(builder.AppendNull());
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, builder.Finish());
+    CheckCumulative("cumulative_sum", input, expected, CumulativeOptions(true));
+  }
+}
+
+TEST(TestCumulativeSum, Errors) {
+  ASSERT_RAISES(NotImplemented, CumulativeSum(ArrayFromJSON(utf8(), R"(["a"])")));
+}
+
+TEST(TestRollingWindow, Sum) {
+  auto input = ArrayFromJSON(int32(), "[1, 2, 3, null, 5, 6]");
+  CheckCumulative("rolling_sum", input, ArrayFromJSON(int32(), "[1, 3, 5, 3, 5, 11]"),
+                  RollingWindowOptions(2, 1));
+  CheckCumulative("rolling_sum", input,
+                  ArrayFromJSON(int32(), "[null, 3, 5, null, null, 11]"),
+                  RollingWindowOptions(2));
+  CheckCumulative("rolling_sum", input, ArrayFromJSON(int32(), "[1, 3, 6, 5, 8, 11]"),
+                  RollingWindowOptions(3, 1));
+  CheckCumulative("rolling_sum", input, ArrayFromJSON(int32(), "[1, 2, 3, null, 5, 6]"),
+                  RollingWindowOptions(1));
+  CheckCumulative("rolling_sum", ArrayFromJSON(float64(), "[0.5, 1.5, 2.5]"),
+                  ArrayFromJSON(float64(), "[0.5, 2, 4.5]"),
+                  RollingWindowOptions(10, 1));
+}
+
+TEST(TestRollingWindow, Mean) {
+  CheckCumulative("rolling_mean", ArrayFromJSON(int64(), "[1, 2, 3, null, 5, 7]"),
+                  ArrayFromJSON(float64(), "[null, 1.5, 2, 2.5, 4, 6]"),
+                  RollingWindowOptions(3, 2));
+}
+
+TEST(TestRollingWindow, MinMax) {
+  auto input = ArrayFromJSON(float64(), "[3, 1, null, 4, NaN, 2, 6]");
+  CheckCumulative("rolling_min", input,
+                  ArrayFromJSON(float64(), "[3, 1, 1, 1, 4, 2, 2]"),
+                  RollingWindowOptions(3, 1));
+  CheckCumulative("rolling_max", input,
+                  ArrayFromJSON(float64(), "[3, 3, 3, 4, 4, 4, 6]"),
+                  RollingWindowOptions(3, 1));
+  CheckCumulative("rolling_max", ArrayFromJSON(uint16(), "[5, 4, 3, 2, 1]"),
+                  ArrayFromJSON(uint16(), "[null, 5, 4, 3, 2]"), RollingWindowOptions(2));
+}
+
+TEST(TestRollingWindow, Errors) {
+  auto input = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, Rolling(input, "sum", RollingWindowOptions(0)));
+  ASSERT_RAISES(Invalid, Rolling(input, "sum", RollingWindowOptions(2, 3)));
+  ASSERT_RAISES(KeyError, Rolling(input, "median", RollingWindowOptions(2)));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -225,6 +225,97 @@ class DictEncodeAction final : public ActionBase {
   DictionaryEncodeOptions encode_options_;
 };
 
+// ----------------------------------------------------------------------
+// Streaming dictionary encode implementation
+
+// Like DictEncodeAction, but also counts the occurrences of each memo table
+// entry across all invocations, for StreamingDictionaryEncoder::ValueCounts
+class StreamingDictEncodeAction final : public ActionBase {
+ public:
+  using ActionBase::ActionBase;
+
+  static constexpr bool with_error_status = false;
+
+  StreamingDictEncodeAction(const std::shared_ptr<DataType>& type,
+                            const FunctionOptions* options, MemoryPool* pool)
+      : ActionBase(type, pool), indices_builder_(pool) {
+    if (auto options_ptr = static_cast<const DictionaryEncodeOptions*>(options)) {
+      encode_options_ = *options_ptr;
+    }
+  }
+
+  Status Reset() {
+    indices_builder_.Reset();
+    counts_.clear();
+    return Status::OK();
+  }
+
+  Status Reserve(const int64_t length) { return indices_builder_.Reserve(length); }
+
+  template <class Index>
+  void ObserveNullFound(Index index) {
+    if (encode_options_.null_encoding_behavior == DictionaryEncodeOptions::MASK) {
+      indices_builder_.UnsafeAppendNull();
+    } else {
+      ObserveFound(index);
+    }
+  }
+
+  template <class Index>
+  void ObserveNullNotFound(Index index) {
+    if (encode_options_.null_encoding_behavior == DictionaryEncodeOptions::MASK) {
+      indices_builder_.UnsafeAppendNull();
+      if (index >= 0) {
+        // A null inserted in the dictionary (of NullType) all the same
+        counts_.push_back(0);
+      }
+    } else {
+      ObserveNotFound(index);
+    }
+  }
+
+  template <class Index>
+  void ObserveFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+    ++counts_[index];
+  }
+
+  template <class Index>
+  void ObserveNotFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+    counts_.push_back(1);
+  }
+
+  bool ShouldEncodeNulls() {
+    return encode_options_.null_encoding_behavior == DictionaryEncodeOptions::ENCODE;
+  }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(indices_builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  // Return the counts so far, which keep accumulating
+  Status FlushFinal(Datum* out) {
+    const auto length = static_cast<int64_t>(counts_.size());
+    ARROW_ASSIGN_OR_RAISE(auto counts,
+                          AllocateBuffer(length * sizeof(int64_t), pool_));
+    if (length > 0) {
+      std::memcpy(counts->mutable_data(), counts_.data(), length * sizeof(int64_t));
+    }
+    out->value = ArrayData::Make(int64(), length, {nullptr, std::move(counts)},
+                                 /*null_count=*/0);
+    return Status::OK();
+  }
+
+ private:
+  Int32Builder indices_builder_;
+  std::vector<int64_t> counts_;
+  DictionaryEncodeOptions encode_options_;
+};
+
 class HashKernel : public KernelState {
  public:
   HashKernel() : options_(nullptr) {}
@@ -239,7 +330,12 @@ class HashKernel : public KernelState {
   // should not be used until after Reset() is called.
   virtual Status FlushFinal(Datum* out) = 0;
   // Get the values (keys) accumulated in the dictionary so far.
-  virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) {
+    return GetDictionaryDelta(0, out);
+  }
+  // Get the values accumulated in the dictionary from index `start_offset` on.
+  virtual Status GetDictionaryDelta(int64_t start_offset,
+                                    std::shared_ptr<ArrayData>* out) = 0;
 
   virtual std::shared_ptr<DataType> value_type() const = 0;
 
@@ -283,9 +379,10 @@ class RegularHashKernel : public HashKernel {
 
   Status FlushFinal(Datum* out) override { return action_.FlushFinal(out); }
 
-  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+  Status GetDictionaryDelta(int64_t start_offset,
+                            std::shared_ptr<ArrayData>* out) override {
     return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, *memo_table_,
-                                                          0 /* start_offset */, out);
+                                                          start_offset, out);
   }
 
   std::shared_ptr<DataType> value_type() const override { return type_; }
@@ -383,7 +480,7 @@ class NullHashKernel : public HashKernel {
   enable_if_t<!HasError, Status> DoAppend(const ArrayData& arr) {
     RETURN_NOT_OK(action_.Reserve(arr.length));
     for (int64_t i = 0; i < arr.length; ++i) {
-      if (i == 0) {
+      if (seen_null_ == false && i == 0) {
         seen_null_ = true;
         action_.ObserveNullNotFound(0);
       } else {
@@ -411,14 +508,11 @@ class NullHashKernel : public HashKernel {
   Status Flush(Datum* out) override { return action_.Flush(out); }
   Status FlushFinal(Datum* out) override { return action_.FlushFinal(out); }
 
-  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
-    std::shared_ptr<NullArray> null_array;
-    if (seen_null_) {
-      null_array = std::make_shared<NullArray>(1);
-    } else {
-      null_array = std::make_shared<NullArray>(0);
-    }
-    *out = null_array->data();
+  Status GetDictionaryDelta(int64_t start_offset,
+                            std::shared_ptr<ArrayData>* out) override {
+    const int64_t length = seen_null_ ? 1 : 0;
+    *out = std::make_shared<NullArray>(std::max<int64_t>(length - start_offset, 0))
+               ->data();
     return Status::OK();
   }
 
@@ -477,8 +571,9 @@ class DictionaryHashKernel : public HashKernel {
 
   Status FlushFinal(Datum* out) override { return indices_kernel_->FlushFinal(out); }
 
-  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
-    return indices_kernel_->GetDictionary(out);
+  Status GetDictionaryDelta(int64_t start_offset,
+                            std::shared_ptr<ArrayData>* out) override {
+    return indices_kernel_->GetDictionaryDelta(start_offset, out);
   }
 
   std::shared_ptr<DataType> value_type() const override {
@@ -693,6 +788,115 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
   }
 }
 
+// ----------------------------------------------------------------------
+// StreamingDictionaryEncoder implementation
+
+class StreamingDictionaryEncoderImpl : public StreamingDictionaryEncoder {
+ public:
+  StreamingDictionaryEncoderImpl(std::shared_ptr<DataType> value_type,
+                                 std::unique_ptr<HashKernel> hash_kernel,
+                                 std::shared_ptr<Array> dictionary, ExecContext* ctx)
+      : value_type_(std::move(value_type)),
+        hash_kernel_(std::move(hash_kernel)),
+        dictionary_(std::move(dictionary)),
+        ctx_(ctx) {}
+
+  static Result<std::unique_ptr<StreamingDictionaryEncoder>> Make(
+      const std::shared_ptr<DataType>& value_type,
+      const DictionaryEncodeOptions& options, ExecContext* ctx) {
+    // Check that the values can be hashed, as by dictionary_encode
+    const std::vector<ValueDescr> inputs = {ValueDescr::Array(value_type)};
+    ARROW_ASSIGN_OR_RAISE(auto func,
+                          ctx->func_registry()->GetFunction("dictionary_encode"));
+    ARROW_ASSIGN_OR_RAISE(auto kernel, func->DispatchExact(inputs));
+
+    KernelContext kernel_ctx(ctx);
+    const KernelInitArgs args{kernel, inputs, &options};
+    auto init = GetHashInit<StreamingDictEncodeAction>(value_type->id());
+    std::unique_ptr<HashKernel> hash_kernel(
+        checked_cast<HashKernel*>(init(&kernel_ctx, args).release()));
+    RETURN_NOT_OK(kernel_ctx.status());
+
+    std::shared_ptr<ArrayData> dictionary;
+    RETURN_NOT_OK(hash_kernel->GetDictionary(&dictionary));
+    return ::arrow::internal::make_unique<StreamingDictionaryEncoderImpl>(
+        value_type, std::move(hash_kernel), MakeArray(dictionary), ctx);
+  }
+
+  Result<Datum> Encode(const Datum& values) override {
+    if (!values.is_arraylike()) {
+      return Status::TypeError(
+          "Can only dictionary-encode arrays and chunked arrays, got ",
+          values.ToString());
+    }
+    if (!values.type()->Equals(*value_type_)) {
+      return Status::TypeError("Expected values of type ", *value_type_, ", got ",
+                               *values.type());
+    }
+    if (values.is_array()) {
+      ARROW_ASSIGN_OR_RAISE(auto indices, EncodeIndices(*values.array()));
+      RETURN_NOT_OK(UpdateDictionary());
+      return Datum(std::make_shared<DictionaryArray>(out_type(), indices, dictionary_));
+    }
+    std::vector<std::shared_ptr<Array>> chunks_indices;
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      ARROW_ASSIGN_OR_RAISE(auto indices, EncodeIndices(*chunk->data()));
+      chunks_indices.push_back(std::move(indices));
+    }
+    RETURN_NOT_OK(UpdateDictionary());
+    ArrayVector chunks;
+    for (const auto& indices : chunks_indices) {
+      chunks.push_back(
+          std::make_shared<DictionaryArray>(out_type(), indices, dictionary_));
+    }
+    return Datum(std::make_shared<ChunkedArray>(std::move(chunks), out_type()));
+  }
+
+  Result<std::shared_ptr<Array>> GetDictionary() override { return dictionary_; }
+
+  Result<std::shared_ptr<Array>> GetDelta() override {
+    auto delta = dictionary_->Slice(delta_start_);
+    delta_start_ = dictionary_->length();
+    return delta;
+  }
+
+  Result<std::shared_ptr<StructArray>> ValueCounts() override {
+    Datum counts;
+    RETURN_NOT_OK(hash_kernel_->FlushFinal(&counts));
+    return checked_pointer_cast<StructArray>(
+        MakeArray(BoxValueCounts(dictionary_->data(), counts.array())));
+  }
+
+ private:
+  std::shared_ptr<DataType> out_type() const { return dictionary(int32(), value_type_); }
+
+  Result<std::shared_ptr<Array>> EncodeIndices(const ArrayData& values) {
+    RETURN_NOT_OK(hash_kernel_->Append(values));
+    Datum indices;
+    RETURN_NOT_OK(hash_kernel_->Flush(&indices));
+    return indices.make_array();
+  }
+
+  // Append the values inserted in the hash table to the dictionary, keeping
+  // the same dictionary if there are none.  Only the new values are copied out
+  // of the hash table.
+  Status UpdateDictionary() {
+    std::shared_ptr<ArrayData> delta;
+    RETURN_NOT_OK(hash_kernel_->GetDictionaryDelta(dictionary_->length(), &delta));
+    if (delta->length > 0) {
+      ARROW_ASSIGN_OR_RAISE(dictionary_, Concatenate({dictionary_, MakeArray(delta)},
+                                                     ctx_->memory_pool()));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> value_type_;
+  std::unique_ptr<HashKernel> hash_kernel_;
+  std::shared_ptr<Array> dictionary_;
+  int64_t delta_start_ = 0;
+  ExecContext* ctx_;
+};
+
 const FunctionDoc unique_doc(
     "Compute unique elements",
     ("Return an array with distinct values.  Nulls in the input are ignored."),
@@ -771,5 +975,15 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 }
 
 }  // namespace internal
+
+Result<std::unique_ptr<StreamingDictionaryEncoder>> StreamingDictionaryEncoder::Make(
+    const std::shared_ptr<DataType>& value_type, const DictionaryEncodeOptions& options,
+    ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ctx = default_exec_context();
+  }
+  return internal::StreamingDictionaryEncoderImpl::Make(value_type, options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
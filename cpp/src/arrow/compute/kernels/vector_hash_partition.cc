@@ -0,0 +1,269 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Hash partitioning of record batches, as needed by a shuffle
+//
+// The key columns of a batch are hashed row by row and combined into one hash
+// per row, which selects the partition of the row.  The rows are then grouped
+// by partition with a counting sort: the partition sizes give the offset of
+// each partition in a permutation of the rows, which is gathered with a single
+// "take" of the whole batch.  Each partition is a zero-copy slice of the
+// gathered batch.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::hash_t;
+using internal::ScalarHelper;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// The hash of a null key value, whatever its type
+constexpr hash_t kNullHash = 0x9E3779B97F4A7C15ULL;
+
+// Equal floating-point values must hash equally: fold -0.0 into 0.0 and all
+// NaNs into a single one before hashing their bit representation
+template <typename T>
+T CanonicalValue(T value) {
+  return value;
+}
+
+float CanonicalValue(float value) {
+  if (std::isnan(value)) return std::numeric_limits<float>::quiet_NaN();
+  return value == 0 ? 0.0f : value;
+}
+
+double CanonicalValue(double value) {
+  if (std::isnan(value)) return std::numeric_limits<double>::quiet_NaN();
+  return value == 0 ? 0.0 : value;
+}
+
+template <typename Type, typename Enable = void>
+struct HashViewType {
+  using T = util::string_view;
+};
+
+template <typename Type>
+struct HashViewType<Type, enable_if_has_c_type<Type>> {
+  using T = typename Type::c_type;
+};
+
+Status HashColumn(const ArrayData& data, hash_t* out);
+
+template <typename IndexCType>
+void GatherDictionaryHashes(const ArrayData& indices,
+                            const std::vector<hash_t>& dictionary_hashes,
+                            hash_t* out) {
+  VisitArrayDataInline<typename CTypeTraits<IndexCType>::ArrowType>(
+      indices, [&](IndexCType index) { *out++ = dictionary_hashes[index]; },
+      [&]() { *out++ = kNullHash; });
+}
+
+// Writes the hash of each value of a column to `out`
+struct ColumnHasher {
+  const ArrayData& data;
+  hash_t* out;
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value || is_base_binary_type<Type>::value ||
+                  is_string_view_type<Type>::value ||
+                  is_fixed_size_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    using T = typename HashViewType<Type>::T;
+    hash_t* hashes = out;
+    VisitArrayDataInline<Type>(
+        data,
+        [&](T value) { *hashes++ = ScalarHelper<T>::ComputeHash(CanonicalValue(value)); },
+        [&]() { *hashes++ = kNullHash; });
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    std::fill(out, out + data.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    const ArrayData& dictionary = *data.dictionary;
+    std::vector<hash_t> dictionary_hashes(dictionary.length);
+    RETURN_NOT_OK(HashColumn(dictionary, dictionary_hashes.data()));
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        GatherDictionaryHashes<int8_t>(data, dictionary_hashes, out);
+        break;
+      case Type::INT16:
+        GatherDictionaryHashes<int16_t>(data, dictionary_hashes, out);
+        break;
+      case Type::INT32:
+        GatherDictionaryHashes<int32_t>(data, dictionary_hashes, out);
+        break;
+      case Type::INT64:
+        GatherDictionaryHashes<int64_t>(data, dictionary_hashes, out);
+        break;
+      case Type::UINT8:
+        GatherDictionaryHashes<uint8_t>(data, dictionary_hashes, out);
+        break;
+      case Type::UINT16:
+        GatherDictionaryHashes<uint16_t>(data, dictionary_hashes, out);
+        break;
+      case Type::UINT32:
+        GatherDictionaryHashes<uint32_t>(data, dictionary_hashes, out);
+        break;
+      case Type::UINT64:
+        GatherDictionaryHashes<uint64_t>(data, dictionary_hashes, out);
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *type.index_type());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("hash_partition keys of type ", type);
+  }
+};
+
+Status HashColumn(const ArrayData& data, hash_t* out) {
+  ColumnHasher hasher{data, out};
+  return VisitTypeInline(*data.type, &hasher);
+}
+
+// Computes the partition of each row from the hashes of its key columns
+Result<std::vector<hash_t>> PartitionIds(const RecordBatch& batch,
+                                         const HashPartitionOptions& options) {
+  const int64_t num_rows = batch.num_rows();
+  std::vector<hash_t> row_hashes(num_rows, 0);
+  std::vector<hash_t> column_hashes(num_rows);
+  for (const auto& key : options.keys) {
+    auto column = batch.GetColumnByName(key);
+    if (!column) {
+      return Status::Invalid("Nonexistent hash_partition key column: ", key);
+    }
+    RETURN_NOT_OK(HashColumn(*column->data(), column_hashes.data()));
+    // Mixing the previous hash before combining makes the result depend on
+    // the order of the keys, and keeps rows with swapped key values apart
+    for (int64_t i = 0; i < num_rows; ++i) {
+      row_hashes[i] =
+          ScalarHelper<uint64_t, 1>::ComputeHash(row_hashes[i]) ^ column_hashes[i];
+    }
+  }
+  const auto num_partitions = static_cast<hash_t>(options.num_partitions);
+  for (auto& hash : row_hashes) {
+    hash %= num_partitions;
+  }
+  return row_hashes;
+}
+
+const FunctionDoc hash_partition_doc(
+    "Split a record batch into partitions according to the hash of key columns",
+    ("Each row goes to the partition given by the hash of its values in the key\n"
+     "columns, modulo the number of partitions.  The output is a collection of\n"
+     "`num_partitions` record batches, in which the rows keep their input order."),
+    {"batch"}, "HashPartitionOptions");
+
+const auto kDefaultHashPartitionOptions = HashPartitionOptions::Defaults();
+
+class HashPartitionMetaFunction : public MetaFunction {
+ public:
+  HashPartitionMetaFunction()
+      : MetaFunction("hash_partition", Arity::Unary(), &hash_partition_doc,
+                     &kDefaultHashPartitionOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    if (args[0].kind() != Datum::RECORD_BATCH) {
+      return Status::NotImplemented("Unsupported input for hash_partition: ",
+                                    args[0].ToString());
+    }
+    const auto& partition_options = static_cast<const HashPartitionOptions&>(*options);
+    if (partition_options.num_partitions <= 0) {
+      return Status::Invalid("hash_partition needs a positive number of partitions, got ",
+                             partition_options.num_partitions);
+    }
+    if (partition_options.keys.empty()) {
+      return Status::Invalid("hash_partition needs at least one key column");
+    }
+    const auto& batch = args[0].record_batch();
+    ARROW_ASSIGN_OR_RAISE(auto partition_ids, PartitionIds(*batch, partition_options));
+
+    // Counting sort of the rows by partition: partition_offsets[p] is the
+    // position of the first row of partition p in the permutation
+    const int32_t num_partitions = partition_options.num_partitions;
+    std::vector<int64_t> partition_offsets(num_partitions + 1, 0);
+    for (auto partition : partition_ids) {
+      ++partition_offsets[partition + 1];
+    }
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      partition_offsets[p + 1] += partition_offsets[p];
+    }
+
+    const int64_t num_rows = batch->num_rows();
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(num_rows * sizeof(int64_t), ctx->memory_pool()));
+    auto indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+    std::vector<int64_t> next_positions(partition_offsets.begin(),
+                                        partition_offsets.end() - 1);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      indices[next_positions[partition_ids[i]]++] = i;
+    }
+
+    auto permutation =
+        ArrayData::Make(int64(), num_rows, {nullptr, std::move(indices_buffer)},
+                        /*null_count=*/0);
+    ARROW_ASSIGN_OR_RAISE(Datum permuted,
+                          Take(args[0], Datum(std::move(permutation)),
+                               TakeOptions::NoBoundsCheck(), ctx));
+    const auto& permuted_batch = permuted.record_batch();
+
+    std::vector<Datum> partitions;
+    partitions.reserve(num_partitions);
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      partitions.emplace_back(permuted_batch->Slice(
+          partition_offsets[p], partition_offsets[p + 1] - partition_offsets[p]));
+    }
+    return Datum(std::move(partitions));
+  }
+};
+
+}  // namespace
+
+void RegisterVectorHashPartition(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(std::make_shared<HashPartitionMetaFunction>()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
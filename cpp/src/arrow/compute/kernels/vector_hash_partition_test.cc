@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+// Returns, for each input row id (the "id" column), the partition it went to,
+// checking that the rows of each partition keep their input order
+std::vector<int> PartitionOfRows(const RecordBatchVector& partitions,
+                                 int64_t num_rows) {
+  std::vector<int> partition_of_row(num_rows, -1);
+  for (size_t p = 0; p < partitions.size(); ++p) {
+    const auto& ids =
+        checked_cast<const Int64Array&>(*partitions[p]->GetColumnByName("id"));
+    for (int64_t i = 0; i < ids.length(); ++i) {
+      if (i > 0) {
+        EXPECT_LT(ids.Value(i - 1), ids.Value(i));
+      }
+      EXPECT_EQ(partition_of_row[ids.Value(i)], -1);
+      partition_of_row[ids.Value(i)] = static_cast<int>(p);
+    }
+  }
+  for (int64_t i = 0; i < num_rows; ++i) {
+    EXPECT_NE(partition_of_row[i], -1) << "row " << i << " was lost";
+  }
+  return partition_of_row;
+}
+
+// Checks that rows with equal keys (given as strings) share a partition
+void AssertKeysColocated(const std::vector<std::string>& keys,
+                         const std::vector<int>& partition_of_row) {
+  std::map<std::string, int> partition_of_key;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    auto it = partition_of_key.emplace(keys[i], partition_of_row[i]).first;
+    ASSERT_EQ(it->second, partition_of_row[i]) << "key " << keys[i];
+  }
+}
+
+TEST(HashPartition, Basics) {
+  auto schema = arrow::schema({field("id", int64()), field("key", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [0, "a"], [1, "b"], [2, "c"], [3, "a"], [4, null], [5, "dd"],
+    [6, "b"], [7, "eee"], [8, null], [9, "a"], [10, "ffff"], [11, "c"]
+  ])");
+  std::vector<std::string> keys = {"a", "b",   "c", "a",    "null", "dd",
+                                   "b", "eee", "null", "a", "ffff", "c"};
+
+  for (int32_t num_partitions : {1, 2, 3, 7}) {
+    SCOPED_TRACE(num_partitions);
+    ASSERT_OK_AND_ASSIGN(
+        auto partitions,
+        HashPartition(batch, HashPartitionOptions({"key"}, num_partitions)));
+    ASSERT_EQ(partitions.size(), static_cast<size_t>(num_partitions));
+    int64_t total_rows = 0;
+    for (const auto& partition : partitions) {
+      AssertSchemaEqual(*schema, *partition->schema());
+      total_rows += partition->num_rows();
+    }
+    ASSERT_EQ(total_rows, batch->num_rows());
+    AssertKeysColocated(keys, PartitionOfRows(partitions, batch->num_rows()));
+  }
+
+  // A single partition is the input batch
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartition(batch, HashPartitionOptions({"key"}, 1)));
+  AssertBatchesEqual(*batch, *partitions[0]);
+}
+
+TEST(HashPartition, MultipleKeys) {
+  auto schema = arrow::schema(
+      {field("id", int64()), field("x", int32()), field("y", boolean())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [0, 1, true], [1, 1, false], [2, 2, true], [3, 1, true], [4, null, false],
+    [5, 2, true], [6, null, false], [7, 1, false], [8, 3, null], [9, 3, null]
+  ])");
+  std::vector<std::string> keys = {"1t", "1f", "2t", "1t", "nf",
+                                   "2t", "nf", "1f", "3n", "3n"};
+
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartition(batch, HashPartitionOptions({"x", "y"}, 4)));
+  AssertKeysColocated(keys, PartitionOfRows(partitions, batch->num_rows()));
+}
+
+TEST(HashPartition, FloatingPoint) {
+  // -0.0 equals 0.0, and NaNs are grouped together
+  auto schema = arrow::schema({field("id", int64()), field("key", float64())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [0, 0.0], [1, -0.0], [2, NaN], [3, 1.5], [4, NaN], [5, -0.0], [6, 1.5]
+  ])");
+  std::vector<std::string> keys = {"0", "0", "nan", "1.5", "nan", "0", "1.5"};
+
+  for (int32_t num_partitions : {2, 5, 16}) {
+    ASSERT_OK_AND_ASSIGN(
+        auto partitions,
+        HashPartition(batch, HashPartitionOptions({"key"}, num_partitions)));
+    AssertKeysColocated(keys, PartitionOfRows(partitions, batch->num_rows()));
+  }
+}
+
+TEST(HashPartition, Dictionary) {
+  // Dictionary-encoded keys are partitioned like their decoded values
+  auto values = ArrayFromJSON(utf8(), R"(["x", "y", null, "z", "x", "w", "y", "x"])");
+  auto ids = ArrayFromJSON(int64(), "[0, 1, 2, 3, 4, 5, 6, 7]");
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict_values = DictArrayFromJSON(dict_type, "[2, 0, null, 1, 2, 3, 0, 2]",
+                                       R"(["z", "y", "x", "w"])");
+
+  auto plain = RecordBatch::Make(
+      arrow::schema({field("id", int64()), field("key", utf8())}), 8, {ids, values});
+  auto encoded = RecordBatch::Make(
+      arrow::schema({field("id", int64()), field("key", dict_type)}), 8,
+      {ids, dict_values});
+
+  ASSERT_OK_AND_ASSIGN(auto plain_partitions,
+                       HashPartition(plain, HashPartitionOptions({"key"}, 3)));
+  ASSERT_OK_AND_ASSIGN(auto encoded_partitions,
+                       HashPartition(encoded, HashPartitionOptions({"key"}, 3)));
+  ASSERT_EQ(PartitionOfRows(plain_partitions, 8),
+            PartitionOfRows(encoded_partitions, 8));
+}
+
+TEST(HashPartition, Empty) {
+  auto schema = arrow::schema({field("id", int64()), field("key", int32())});
+  auto batch = RecordBatchFromJSON(schema, "[]");
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartition(batch, HashPartitionOptions({"key"}, 3)));
+  ASSERT_EQ(partitions.size(), 3U);
+  for (const auto& partition : partitions) {
+    ASSERT_EQ(partition->num_rows(), 0);
+  }
+}
+
+TEST(HashPartition, Errors) {
+  auto schema = arrow::schema({field("id", int64()), field("key", list(int32()))});
+  auto batch = RecordBatchFromJSON(schema, "[[0, [1]], [1, null]]");
+  ASSERT_RAISES(Invalid, HashPartition(batch, HashPartitionOptions({"id"}, 0)));
+  ASSERT_RAISES(Invalid, HashPartition(batch, HashPartitionOptions({}, 2)));
+  ASSERT_RAISES(Invalid, HashPartition(batch, HashPartitionOptions({"nope"}, 2)));
+  ASSERT_RAISES(NotImplemented, HashPartition(batch, HashPartitionOptions({"key"}, 2)));
+  HashPartitionOptions options({"id"}, 2);
+  ASSERT_RAISES(NotImplemented, CallFunction("hash_partition",
+                                             {ArrayFromJSON(int32(), "[1]")}, &options));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -44,7 +44,11 @@
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
 
+#include "arrow/io/memory.h"
 #include "arrow/ipc/json_simple.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 
 namespace arrow {
 
@@ -746,5 +750,132 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// StreamingDictionaryEncoder tests
+
+void CheckStreamingEncode(StreamingDictionaryEncoder* encoder, const Datum& values,
+                          const std::string& expected_indices,
+                          const std::string& expected_dictionary) {
+  const auto& value_type = values.type();
+  ASSERT_OK_AND_ASSIGN(Datum result, encoder->Encode(values));
+  auto expected = std::make_shared<DictionaryArray>(
+      dictionary(int32(), value_type), ArrayFromJSON(int32(), expected_indices),
+      ArrayFromJSON(value_type, expected_dictionary));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertArraysEqual(*expected, *result.make_array(), /*verbose=*/true);
+}
+
+TEST(TestStreamingDictionaryEncoder, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto encoder, StreamingDictionaryEncoder::Make(utf8()));
+
+  CheckStreamingEncode(encoder.get(), ArrayFromJSON(utf8(), R"(["b", "a", null, "b"])"),
+                       "[0, 1, null, 0]", R"(["b", "a"])");
+  ASSERT_OK_AND_ASSIGN(auto delta, encoder->GetDelta());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "a"])"), *delta);
+
+  // Previously seen values keep their index
+  CheckStreamingEncode(encoder.get(), ArrayFromJSON(utf8(), R"(["c", "a", "d"])"),
+                       "[2, 1, 3]", R"(["b", "a", "c", "d"])");
+  ASSERT_OK_AND_ASSIGN(delta, encoder->GetDelta());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["c", "d"])"), *delta);
+
+  // No new values: the dictionary is the same
+  ASSERT_OK_AND_ASSIGN(auto dict_before, encoder->GetDictionary());
+  CheckStreamingEncode(encoder.get(), ArrayFromJSON(utf8(), R"(["d", null])"),
+                       "[3, null]", R"(["b", "a", "c", "d"])");
+  ASSERT_OK_AND_ASSIGN(auto dict_after, encoder->GetDictionary());
+  ASSERT_EQ(dict_before, dict_after);
+  ASSERT_OK_AND_ASSIGN(delta, encoder->GetDelta());
+  ASSERT_EQ(delta->length(), 0);
+
+  ASSERT_OK_AND_ASSIGN(auto counts, encoder->ValueCounts());
+  ASSERT_OK(counts->ValidateFull());
+  auto expected_counts = ArrayFromJSON(
+      struct_({field(kValuesFieldName, utf8()), field(kCountsFieldName, int64())}),
+      R"([{"values": "b", "counts": 2}, {"values": "a", "counts": 2},
+          {"values": "c", "counts": 1}, {"values": "d", "counts": 2}])");
+  AssertArraysEqual(*expected_counts, *counts, /*verbose=*/true);
+}
+
+TEST(TestStreamingDictionaryEncoder, NullEncoding) {
+  auto options = DictionaryEncodeOptions::Defaults();
+  options.null_encoding_behavior = DictionaryEncodeOptions::ENCODE;
+  ASSERT_OK_AND_ASSIGN(auto encoder, StreamingDictionaryEncoder::Make(int16(), options));
+
+  CheckStreamingEncode(encoder.get(), ArrayFromJSON(int16(), "[1, null, 1]"), "[0, 1, 0]",
+                       "[1, null]");
+  CheckStreamingEncode(encoder.get(), ArrayFromJSON(int16(), "[null, 2]"), "[1, 2]",
+                       "[1, null, 2]");
+
+  ASSERT_OK_AND_ASSIGN(auto counts, encoder->ValueCounts());
+  ASSERT_OK(counts->ValidateFull());
+  auto expected_counts = ArrayFromJSON(
+      struct_({field(kValuesFieldName, int16()), field(kCountsFieldName, int64())}),
+      R"([{"values": 1, "counts": 2}, {"values": null, "counts": 2},
+          {"values": 2, "counts": 1}])");
+  AssertArraysEqual(*expected_counts, *counts, /*verbose=*/true);
+}
+
+TEST(TestStreamingDictionaryEncoder, ChunkedArray) {
+  ASSERT_OK_AND_ASSIGN(auto encoder, StreamingDictionaryEncoder::Make(int64()));
+  auto values = ChunkedArrayFromJSON(int64(), {"[3, 1]", "[]", "[1, 4]"});
+  ASSERT_OK_AND_ASSIGN(Datum result, encoder->Encode(values));
+  ASSERT_EQ(result.kind(), Datum::CHUNKED_ARRAY);
+
+  // All chunks share the dictionary after encoding the chunked array
+  auto dict_type = dictionary(int32(), int64());
+  auto dict = ArrayFromJSON(int64(), "[3, 1, 4]");
+  ArrayVector expected_chunks;
+  for (const auto& indices : {"[0, 1]", "[]", "[1, 2]"}) {
+    expected_chunks.push_back(std::make_shared<DictionaryArray>(
+        dict_type, ArrayFromJSON(int32(), indices), dict));
+  }
+  AssertChunkedEqual(ChunkedArray(expected_chunks, dict_type), *result.chunked_array());
+}
+
+TEST(TestStreamingDictionaryEncoder, Errors) {
+  ASSERT_RAISES(NotImplemented, StreamingDictionaryEncoder::Make(list(int8())));
+
+  ASSERT_OK_AND_ASSIGN(auto encoder, StreamingDictionaryEncoder::Make(utf8()));
+  ASSERT_RAISES(TypeError, encoder->Encode(ArrayFromJSON(binary(), "[]")));
+  ASSERT_RAISES(TypeError, encoder->Encode(MakeScalar("a")));
+}
+
+TEST(TestStreamingDictionaryEncoder, IpcDictionaryDeltas) {
+  ASSERT_OK_AND_ASSIGN(auto encoder, StreamingDictionaryEncoder::Make(utf8()));
+  auto schema = ::arrow::schema({field("f", dictionary(int32(), utf8()))});
+  RecordBatchVector batches;
+  for (const auto& json : {R"(["a", "b"])", R"(["b", "c", null])", R"(["a"])"}) {
+    ASSERT_OK_AND_ASSIGN(Datum encoded, encoder->Encode(ArrayFromJSON(utf8(), json)));
+    batches.push_back(
+        RecordBatch::Make(schema, encoded.length(), {encoded.make_array()}));
+  }
+
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeStreamWriter(sink, schema, options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+
+  // The first batch emits the dictionary, the second a delta, the third nothing
+  const auto stats = writer->stats();
+  ASSERT_EQ(stats.num_dictionary_batches, 2);
+  ASSERT_EQ(stats.num_dictionary_deltas, 1);
+  ASSERT_EQ(stats.num_replaced_dictionaries, 0);
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto reader, ipc::RecordBatchStreamReader::Open(
+                                        std::make_shared<io::BufferReader>(buffer)));
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> read_batch;
+    ASSERT_OK(reader->ReadNext(&read_batch));
+    ASSERT_NE(read_batch, nullptr);
+    AssertBatchesEqual(*batch, *read_batch);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,346 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels converting to and from run-end encoded arrays
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+namespace {
+
+using RunEndEncodeState = OptionsWrapper<RunEndEncodeOptions>;
+
+// ----------------------------------------------------------------------
+// run_end_encode
+
+// Find the runs of equal consecutive values of `data`, appending the (logical)
+// run ends and the index of the first value of each run.  Nulls are equal to
+// each other and different from any valid value.
+//
+// `values_equal(i, j)` compares the valid values at indices `i` and `j`,
+// relative to the array offset.
+template <typename ValuesEqual>
+Status FindRuns(const ArrayData& data, ValuesEqual&& values_equal,
+                TypedBufferBuilder<int64_t>* run_ends,
+                TypedBufferBuilder<int64_t>* run_starts) {
+  if (data.length == 0) {
+    return Status::OK();
+  }
+  // Null arrays have no validity bitmap and a single run
+  const uint8_t* validity =
+      data.MayHaveNulls() && data.buffers[0] ? data.buffers[0]->data() : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return validity == nullptr || BitUtil::GetBit(validity, data.offset + i);
+  };
+
+  RETURN_NOT_OK(run_starts->Append(0));
+  bool previous_valid = is_valid(0);
+  for (int64_t i = 1; i < data.length; ++i) {
+    const bool valid = is_valid(i);
+    if (valid != previous_valid || (valid && !values_equal(i - 1, i))) {
+      RETURN_NOT_OK(run_ends->Append(i));
+      RETURN_NOT_OK(run_starts->Append(i));
+    }
+    previous_valid = valid;
+  }
+  return run_ends->Append(data.length);
+}
+
+template <typename CType>
+Status FindFixedWidthRuns(const ArrayData& data, TypedBufferBuilder<int64_t>* run_ends,
+                          TypedBufferBuilder<int64_t>* run_starts) {
+  // Values are compared bitwise, so that e.g. equal NaNs end up in the same run
+  const CType* values = data.GetValues<CType>(1);
+  return FindRuns(
+      data, [&](int64_t i, int64_t j) { return values[i] == values[j]; }, run_ends,
+      run_starts);
+}
+
+template <typename ArrayType>
+Status FindBinaryRuns(const ArrayData& data, TypedBufferBuilder<int64_t>* run_ends,
+                      TypedBufferBuilder<int64_t>* run_starts) {
+  ArrayType array(data.Copy());
+  return FindRuns(
+      data, [&](int64_t i, int64_t j) { return array.GetView(i) == array.GetView(j); },
+      run_ends, run_starts);
+}
+
+Status FindRunsOfType(const ArrayData& data, TypedBufferBuilder<int64_t>* run_ends,
+                      TypedBufferBuilder<int64_t>* run_starts) {
+  const DataType& type = *data.type;
+  switch (type.id()) {
+    case Type::NA:
+      return FindRuns(
+          data, [](int64_t, int64_t) { return true; }, run_ends, run_starts);
+    case Type::BOOL: {
+      const uint8_t* values = data.buffers[1]->data();
+      return FindRuns(
+          data,
+          [&](int64_t i, int64_t j) {
+            return BitUtil::GetBit(values, data.offset + i) ==
+                   BitUtil::GetBit(values, data.offset + j);
+          },
+          run_ends, run_starts);
+    }
+    case Type::BINARY:
+    case Type::STRING:
+      return FindBinaryRuns<BinaryArray>(data, run_ends, run_starts);
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return FindBinaryRuns<LargeBinaryArray>(data, run_ends, run_starts);
+    case Type::STRING_VIEW:
+      return FindBinaryRuns<StringViewArray>(data, run_ends, run_starts);
+    case Type::DICTIONARY:
+    case Type::EXTENSION:
+      break;
+    default:
+      if (is_fixed_width(type.id())) {
+        const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+        switch (byte_width) {
+          case 1:
+            return FindFixedWidthRuns<uint8_t>(data, run_ends, run_starts);
+          case 2:
+            return FindFixedWidthRuns<uint16_t>(data, run_ends, run_starts);
+          case 4:
+            return FindFixedWidthRuns<uint32_t>(data, run_ends, run_starts);
+          case 8:
+            return FindFixedWidthRuns<uint64_t>(data, run_ends, run_starts);
+          default: {
+            const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+            return FindRuns(
+                data,
+                [&](int64_t i, int64_t j) {
+                  return std::memcmp(values + i * byte_width, values + j * byte_width,
+                                     byte_width) == 0;
+                },
+                run_ends, run_starts);
+          }
+        }
+      }
+      break;
+  }
+  // Nested, dictionary and extension values: fall back on array comparison
+  std::shared_ptr<Array> array = MakeArray(data.Copy());
+  return FindRuns(
+      data,
+      [&](int64_t i, int64_t j) { return array->RangeEquals(i, i + 1, j, *array); },
+      run_ends, run_starts);
+}
+
+void RunEndEncodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& input = *batch[0].array();
+  if (input.type->id() == Type::RUN_END_ENCODED) {
+    ctx->SetStatus(Status::TypeError("Input is already run-end encoded"));
+    return;
+  }
+  const auto& out_type = checked_cast<const RunEndEncodedType&>(*out->type());
+
+  TypedBufferBuilder<int64_t> run_ends(ctx->memory_pool());
+  TypedBufferBuilder<int64_t> run_starts(ctx->memory_pool());
+  KERNEL_RETURN_IF_ERROR(ctx, FindRunsOfType(input, &run_ends, &run_starts));
+
+  std::shared_ptr<ArrayData> run_ends_data;
+  KERNEL_ASSIGN_OR_RAISE(run_ends_data, ctx,
+                         ree_util::MakeRunEndsArray(out_type.run_end_type(),
+                                                    run_ends.data(), run_ends.length(),
+                                                    ctx->memory_pool()));
+  // Gather the first value of each run
+  const int64_t num_runs = run_starts.length();
+  std::shared_ptr<Buffer> run_starts_buffer;
+  KERNEL_RETURN_IF_ERROR(ctx, run_starts.Finish(&run_starts_buffer));
+  auto indices = ArrayData::Make(int64(), num_runs, {nullptr, run_starts_buffer},
+                                 /*null_count=*/0);
+  Datum values;
+  KERNEL_ASSIGN_OR_RAISE(values, ctx,
+                         Take(batch[0], Datum(indices), TakeOptions::NoBoundsCheck(),
+                              ctx->exec_context()));
+
+  out->value = ArrayData::Make(out->type(), input.length, {nullptr},
+                               {std::move(run_ends_data), values.array()},
+                               /*null_count=*/0);
+}
+
+Result<ValueDescr> ResolveRunEndEncodeOutput(KernelContext* ctx,
+                                             const std::vector<ValueDescr>& args) {
+  const auto& options = RunEndEncodeState::Get(ctx);
+  ARROW_ASSIGN_OR_RAISE(auto type,
+                        RunEndEncodedType::Make(options.run_end_type, args[0].type));
+  return ValueDescr::Array(std::move(type));
+}
+
+// ----------------------------------------------------------------------
+// run_end_decode
+
+// Write each run value as many times as the run is long, for fixed-width values
+Status DecodeFixedWidth(const ArrayData& input, int bit_width, MemoryPool* pool,
+                        ArrayData* output) {
+  const ArrayData& values = ree_util::ValuesArray(input);
+  const uint8_t* values_validity =
+      values.MayHaveNulls() ? values.buffers[0]->data() : nullptr;
+  const uint8_t* values_data = values.buffers[1]->data();
+
+  std::shared_ptr<Buffer> validity;
+  if (values_validity != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(validity, AllocateEmptyBitmap(input.length, pool));
+  }
+  std::shared_ptr<Buffer> data;
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(data, AllocateEmptyBitmap(input.length, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(data, AllocateBuffer(input.length * bit_width / 8, pool));
+  }
+  uint8_t* out_validity = validity ? validity->mutable_data() : nullptr;
+  uint8_t* out_data = data->mutable_data();
+  const int byte_width = bit_width / 8;
+
+  int64_t position = 0;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(ree_util::VisitRuns(
+      input, [&](int64_t physical_index, int64_t run_length) {
+        const int64_t index = values.offset + physical_index;
+        if (out_validity != nullptr) {
+          const bool valid = BitUtil::GetBit(values_validity, index);
+          BitUtil::SetBitsTo(out_validity, position, run_length, valid);
+          null_count += valid ? 0 : run_length;
+        }
+        if (bit_width == 1) {
+          BitUtil::SetBitsTo(out_data, position, run_length,
+                             BitUtil::GetBit(values_data, index));
+        } else {
+          const uint8_t* value = values_data + index * byte_width;
+          uint8_t* out = out_data + position * byte_width;
+          for (int64_t i = 0; i < run_length; ++i, out += byte_width) {
+            std::memcpy(out, value, byte_width);
+          }
+        }
+        position += run_length;
+        return Status::OK();
+      }));
+
+  output->buffers = {std::move(validity), std::move(data)};
+  output->null_count = null_count;
+  return Status::OK();
+}
+
+void RunEndDecodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const ArrayData& input = *batch[0].array();
+  const ArrayData& values = ree_util::ValuesArray(input);
+  const DataType& value_type = *values.type;
+
+  if (is_fixed_width(value_type.id()) && value_type.id() != Type::DICTIONARY &&
+      value_type.id() != Type::EXTENSION) {
+    const int bit_width = checked_cast<const FixedWidthType&>(value_type).bit_width();
+    if (bit_width == 1 || (bit_width > 0 && bit_width % 8 == 0)) {
+      ArrayData* output = out->mutable_array();
+      output->length = input.length;
+      KERNEL_RETURN_IF_ERROR(
+          ctx, DecodeFixedWidth(input, bit_width, ctx->memory_pool(), output));
+      return;
+    }
+  }
+
+  // Other values: gather the value of the run of each position
+  TypedBufferBuilder<int64_t> indices_builder(ctx->memory_pool());
+  KERNEL_RETURN_IF_ERROR(ctx, indices_builder.Reserve(input.length));
+  KERNEL_RETURN_IF_ERROR(
+      ctx, ree_util::VisitRuns(input, [&](int64_t physical_index, int64_t run_length) {
+        for (int64_t i = 0; i < run_length; ++i) {
+          indices_builder.UnsafeAppend(physical_index);
+        }
+        return Status::OK();
+      }));
+  std::shared_ptr<Buffer> indices_buffer;
+  KERNEL_RETURN_IF_ERROR(ctx, indices_builder.Finish(&indices_buffer));
+  auto indices = ArrayData::Make(int64(), input.length, {nullptr, indices_buffer},
+                                 /*null_count=*/0);
+  Datum decoded;
+  KERNEL_ASSIGN_OR_RAISE(
+      decoded, ctx,
+      Take(Datum(input.child_data[1]), Datum(indices), TakeOptions::NoBoundsCheck(),
+           ctx->exec_context()));
+  out->value = decoded.array();
+}
+
+Result<ValueDescr> ResolveRunEndDecodeOutput(KernelContext*,
+                                             const std::vector<ValueDescr>& args) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*args[0].type);
+  return ValueDescr::Array(ree_type.value_type());
+}
+
+const auto kDefaultRunEndEncodeOptions = RunEndEncodeOptions::Defaults();
+
+const FunctionDoc run_end_encode_doc(
+    "Run-end encode array",
+    ("Return a run-end encoded version of the input array.\n"
+     "Each run of equal consecutive values is stored once; nulls are equal\n"
+     "to each other.  The run end type is set in RunEndEncodeOptions."),
+    {"array"}, "RunEndEncodeOptions");
+
+const FunctionDoc run_end_decode_doc(
+    "Decode run-end encoded array",
+    ("Return a plain array with the values of the run-end encoded input array."),
+    {"array"});
+
+}  // namespace
+
+void RegisterVectorRunEnd(FunctionRegistry* registry) {
+  VectorKernel encode_base;
+  encode_base.init = RunEndEncodeState::Init;
+  encode_base.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  encode_base.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  encode_base.signature = KernelSignature::Make({InputType(ValueDescr::ARRAY)},
+                                                OutputType(ResolveRunEndEncodeOutput));
+  encode_base.exec = RunEndEncodeExec;
+  auto encode = std::make_shared<VectorFunction>("run_end_encode", Arity::Unary(),
+                                                 &run_end_encode_doc,
+                                                 &kDefaultRunEndEncodeOptions);
+  DCHECK_OK(encode->AddKernel(encode_base));
+  DCHECK_OK(registry->AddFunction(std::move(encode)));
+
+  VectorKernel decode_base;
+  decode_base.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  decode_base.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  decode_base.signature =
+      KernelSignature::Make({InputType::Array(Type::RUN_END_ENCODED)},
+                            OutputType(ResolveRunEndDecodeOutput));
+  decode_base.exec = RunEndDecodeExec;
+  auto decode = std::make_shared<VectorFunction>("run_end_decode", Arity::Unary(),
+                                                 &run_end_decode_doc);
+  DCHECK_OK(decode->AddKernel(decode_base));
+  DCHECK_OK(registry->AddFunction(std::move(decode)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_run_end.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+std::shared_ptr<Array> RunEndEncodedFromJSON(
+    const std::shared_ptr<DataType>& run_end_type,
+    const std::shared_ptr<DataType>& value_type, int64_t length,
+    const std::string& run_ends, const std::string& values) {
+  return RunEndEncodedArray::Make(length, ArrayFromJSON(run_end_type, run_ends),
+                                  ArrayFromJSON(value_type, values))
+      .ValueOrDie();
+}
+
+class TestRunEndEncode : public ::testing::TestWithParam<std::shared_ptr<DataType>> {
+ protected:
+  std::shared_ptr<Array> REE(const std::shared_ptr<DataType>& value_type,
+                             int64_t length, const std::string& run_ends,
+                             const std::string& values) {
+    return RunEndEncodedFromJSON(GetParam(), value_type, length, run_ends, values);
+  }
+
+  void CheckRoundTrip(const std::shared_ptr<Array>& input,
+                      const std::shared_ptr<Array>& expected) {
+    RunEndEncodeOptions options(GetParam());
+    ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(input, options));
+    ASSERT_OK(encoded.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, encoded);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+    ASSERT_OK(decoded.make_array()->ValidateFull());
+    AssertDatumsEqual(input, decoded);
+
+    // Sliced input
+    if (input->length() > 2) {
+      auto slice = input->Slice(1, input->length() - 2);
+      ASSERT_OK_AND_ASSIGN(encoded, RunEndEncode(slice, options));
+      ASSERT_OK(encoded.make_array()->ValidateFull());
+      ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(encoded));
+      AssertDatumsEqual(slice, decoded);
+      ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(expected->Slice(1, slice->length())));
+      AssertDatumsEqual(slice, decoded);
+    }
+  }
+};
+
+TEST_P(TestRunEndEncode, EncodeDecode) {
+  CheckRoundTrip(ArrayFromJSON(int32(), "[1, 1, 1, null, null, 2, 1]"),
+                 REE(int32(), 7, "[3, 5, 6, 7]", "[1, null, 2, 1]"));
+  CheckRoundTrip(ArrayFromJSON(boolean(), "[true, true, false, null, false]"),
+                 REE(boolean(), 5, "[2, 3, 4, 5]", "[true, false, null, false]"));
+  CheckRoundTrip(ArrayFromJSON(float64(), "[0.5, 0.5, 0.5, 0.5]"),
+                 REE(float64(), 4, "[4]", "[0.5]"));
+  CheckRoundTrip(ArrayFromJSON(utf8(), R"(["a", "a", null, "bc", "bc", "a"])"),
+                 REE(utf8(), 6, "[2, 3, 5, 6]", R"(["a", null, "bc", "a"])"));
+  CheckRoundTrip(ArrayFromJSON(large_binary(), R"(["a", "b", "b"])"),
+                 REE(large_binary(), 3, "[1, 3]", R"(["a", "b"])"));
+  CheckRoundTrip(ArrayFromJSON(fixed_size_binary(3), R"(["abc", "abc", "def"])"),
+                 REE(fixed_size_binary(3), 3, "[2, 3]", R"(["abc", "def"])"));
+  CheckRoundTrip(ArrayFromJSON(list(int8()), "[[1], [1], [], null, [2, 3], [2, 3]]"),
+                 REE(list(int8()), 6, "[2, 3, 4, 6]", "[[1], [], null, [2, 3]]"));
+  CheckRoundTrip(ArrayFromJSON(null(), "[null, null, null]"),
+                 REE(null(), 3, "[3]", "[null]"));
+  CheckRoundTrip(ArrayFromJSON(int64(), "[]"), REE(int64(), 0, "[]", "[]"));
+}
+
+TEST_P(TestRunEndEncode, ChunkedArray) {
+  auto input = ChunkedArrayFromJSON(int16(), {"[1, 1, 2]", "[2, 2]"});
+  RunEndEncodeOptions options(GetParam());
+  ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(input, options));
+  ASSERT_EQ(encoded.kind(), Datum::CHUNKED_ARRAY);
+  const auto& chunks = encoded.chunked_array()->chunks();
+  ASSERT_EQ(chunks.size(), 2);
+  AssertArraysEqual(*REE(int16(), 3, "[2, 3]", "[1, 2]"), *chunks[0]);
+  AssertArraysEqual(*REE(int16(), 2, "[2]", "[2]"), *chunks[1]);
+}
+
+TEST_P(TestRunEndEncode, Take) {
+  auto values = REE(utf8(), 6, "[3, 4, 6]", R"(["foo", null, "bar"])");
+  auto indices = ArrayFromJSON(int8(), "[0, 2, 1, null, 5, 4, 3, 0]");
+  ASSERT_OK_AND_ASSIGN(Datum taken, Take(values, indices));
+  ASSERT_OK(taken.make_array()->ValidateFull());
+  ASSERT_EQ(taken.type()->id(), Type::RUN_END_ENCODED);
+  // Positions taking the same run are merged
+  AssertDatumsEqual(REE(utf8(), 8, "[3, 4, 6, 7, 8]",
+                        R"(["foo", null, "bar", null, "foo"])"),
+                    taken);
+  ASSERT_OK_AND_ASSIGN(taken,
+                       Take(values->Slice(2, 3), ArrayFromJSON(int64(), "[2, 0]")));
+  AssertDatumsEqual(REE(utf8(), 2, "[1, 2]", R"(["bar", "foo"])"), taken);
+
+  ASSERT_RAISES(IndexError, Take(values, ArrayFromJSON(int32(), "[6]")));
+}
+
+TEST_P(TestRunEndEncode, Filter) {
+  auto values = REE(utf8(), 6, "[3, 4, 6]", R"(["foo", null, "bar"])");
+  auto filter = ArrayFromJSON(boolean(), "[true, false, true, true, false, true]");
+  ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(values, filter));
+  ASSERT_OK(filtered.make_array()->ValidateFull());
+  AssertDatumsEqual(REE(utf8(), 4, "[2, 3, 4]", R"(["foo", null, "bar"])"), filtered);
+
+  filter = ArrayFromJSON(boolean(), "[true, null, true, false, false, null]");
+  ASSERT_OK_AND_ASSIGN(filtered, Filter(values, filter));
+  AssertDatumsEqual(REE(utf8(), 2, "[2]", R"(["foo"])"), filtered);
+  ASSERT_OK_AND_ASSIGN(filtered,
+                       Filter(values, filter, FilterOptions(FilterOptions::EMIT_NULL)));
+  AssertDatumsEqual(REE(utf8(), 4, "[1, 2, 3, 4]", R"(["foo", null, "foo", null])"),
+                    filtered);
+
+  // Sliced values
+  ASSERT_OK_AND_ASSIGN(filtered, Filter(values->Slice(2, 3),
+                                        ArrayFromJSON(boolean(), "[true, false, true]")));
+  AssertDatumsEqual(REE(utf8(), 2, "[1, 2]", R"(["foo", "bar"])"), filtered);
+}
+
+TEST_P(TestRunEndEncode, Compare) {
+  auto left = REE(int32(), 6, "[3, 4, 6]", "[1, null, 3]");
+  auto right = REE(int32(), 6, "[2, 5, 6]", "[1, 3, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("equal", {left, right}));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  ASSERT_EQ(result.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(result));
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, true, false, null, true, true]"),
+                    decoded);
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("less", {left, right}));
+  ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(result));
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[false, false, true, null, false, false]"),
+                    decoded);
+
+  // Compared with a scalar, only the run values are compared
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("greater", {left->Slice(1), MakeScalar(2)}));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  AssertDatumsEqual(RunEndEncodedFromJSON(GetParam(), boolean(), 5, "[2, 3, 5]",
+                                          "[false, null, true]"),
+                    result);
+  ASSERT_OK_AND_ASSIGN(result,
+                       CallFunction("greater", {MakeScalar(int64_t(2)), left->Slice(1)}));
+  AssertDatumsEqual(RunEndEncodedFromJSON(GetParam(), boolean(), 5, "[2, 3, 5]",
+                                          "[true, null, false]"),
+                    result);
+
+  // Compared with a plain array, the output is a plain array
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("not_equal",
+                                            {left, ArrayFromJSON(int32(),
+                                                                 "[1, 2, 1, 1, 3, 4]")}));
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[false, true, false, null, false, true]"),
+                    result);
+}
+
+TEST_P(TestRunEndEncode, Sum) {
+  auto values = REE(int32(), 6, "[3, 4, 6]", "[1, null, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum sum, Sum(values));
+  AssertDatumsEqual(Datum(int64_t(9)), sum);
+  ASSERT_OK_AND_ASSIGN(sum, Sum(values->Slice(2, 3)));
+  AssertDatumsEqual(Datum(int64_t(4)), sum);
+  ASSERT_OK_AND_ASSIGN(sum, Sum(REE(float64(), 3, "[3]", "[0.5]")));
+  AssertDatumsEqual(Datum(1.5), sum);
+  ASSERT_OK_AND_ASSIGN(sum, Sum(REE(uint8(), 0, "[]", "[]")));
+  AssertDatumsEqual(Datum(std::make_shared<UInt64Scalar>()), sum);
+  ASSERT_RAISES(NotImplemented, Sum(REE(utf8(), 1, "[1]", R"(["a"])")));
+
+  ASSERT_OK_AND_ASSIGN(Datum count, Count(values));
+  AssertDatumsEqual(Datum(int64_t(5)), count);
+  ASSERT_OK_AND_ASSIGN(count, Count(values, CountOptions(CountOptions::COUNT_NULL)));
+  AssertDatumsEqual(Datum(int64_t(1)), count);
+}
+
+TEST_P(TestRunEndEncode, Cast) {
+  auto values = REE(int32(), 6, "[3, 4, 6]", "[1, null, 3]");
+  ASSERT_OK_AND_ASSIGN(auto casted, Cast(*values, int64()));
+  ASSERT_OK(casted->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1, 1, null, 3, 3]"), *casted);
+  ASSERT_OK_AND_ASSIGN(casted, Cast(*values->Slice(2, 3), utf8()));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["1", null, "3"])"), *casted);
+
+  auto ree_type = run_end_encoded(GetParam(), float64());
+  ASSERT_OK_AND_ASSIGN(casted, Cast(*ArrayFromJSON(int8(), "[1, 1, 2]"), ree_type));
+  ASSERT_OK(casted->ValidateFull());
+  AssertArraysEqual(*REE(float64(), 3, "[2, 3]", "[1, 2]"), *casted);
+  ASSERT_OK_AND_ASSIGN(casted, Cast(*values->Slice(2, 3), ree_type));
+  ASSERT_OK(casted->ValidateFull());
+  AssertArraysEqual(*REE(float64(), 3, "[1, 2, 3]", "[1, null, 3]"), *casted);
+
+  // Run ends that do not fit the target run end type
+  auto long_run = RunEndEncodedFromJSON(int32(), int8(), 40000, "[40000]", "[1]");
+  ASSERT_RAISES(Invalid, Cast(*long_run, run_end_encoded(int16(), int8())));
+}
+
+INSTANTIATE_TEST_SUITE_P(RunEndTypes, TestRunEndEncode,
+                         ::testing::Values(int16(), int32(), int64()));
+
+}  // namespace compute
+}  // namespace arrow
@@ -28,6 +28,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -41,6 +42,9 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ree_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1187,6 +1191,159 @@ void ExtensionFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   out->value = filtered_values.data();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded take and filter
+//
+// The output is run-end encoded as well: positions selecting the same run of
+// the input (or null) are merged into a single output run, so that only the
+// selected runs values are gathered.
+
+class RunEndEncodedSelection {
+ public:
+  explicit RunEndEncodedSelection(KernelContext* ctx)
+      : ctx_(ctx),
+        run_ends_(ctx->memory_pool()),
+        physical_indices_(ctx->memory_pool()),
+        physical_is_valid_(ctx->memory_pool()) {}
+
+  // Append `length` positions selecting the given run, or null if
+  // `physical_index` is negative
+  Status Append(int64_t physical_index, int64_t length) {
+    if (physical_index < 0) {
+      physical_index = -1;
+    }
+    length_ += length;
+    if (physical_indices_.length() > 0 && last_physical_index_ == physical_index) {
+      run_ends_.mutable_data()[run_ends_.length() - 1] = length_;
+      return Status::OK();
+    }
+    last_physical_index_ = physical_index;
+    RETURN_NOT_OK(run_ends_.Append(length_));
+    RETURN_NOT_OK(physical_indices_.Append(std::max<int64_t>(physical_index, 0)));
+    return physical_is_valid_.Append(physical_index >= 0);
+  }
+
+  Status Finish(const ArrayData& values, Datum* out) {
+    const auto& ree_type = checked_cast<const RunEndEncodedType&>(*values.type);
+    const int64_t num_runs = physical_indices_.length();
+    const int64_t null_count = physical_is_valid_.false_count();
+    ARROW_ASSIGN_OR_RAISE(
+        auto run_ends,
+        ree_util::MakeRunEndsArray(ree_type.run_end_type(), run_ends_.data(), num_runs,
+                                   ctx_->memory_pool()));
+    std::shared_ptr<Buffer> indices_buffer, indices_validity;
+    RETURN_NOT_OK(physical_indices_.Finish(&indices_buffer));
+    RETURN_NOT_OK(physical_is_valid_.Finish(&indices_validity));
+    auto indices =
+        ArrayData::Make(int64(), num_runs,
+                        {null_count > 0 ? std::move(indices_validity) : nullptr,
+                         std::move(indices_buffer)},
+                        null_count);
+    ARROW_ASSIGN_OR_RAISE(Datum run_values,
+                          Take(Datum(values.child_data[1]), Datum(indices),
+                               TakeOptions::NoBoundsCheck(), ctx_->exec_context()));
+    out->value = ArrayData::Make(values.type, length_, {nullptr},
+                                 {std::move(run_ends), run_values.array()},
+                                 /*null_count=*/0);
+    return Status::OK();
+  }
+
+ private:
+  KernelContext* ctx_;
+  int64_t length_ = 0;
+  int64_t last_physical_index_ = -1;
+  TypedBufferBuilder<int64_t> run_ends_;
+  TypedBufferBuilder<int64_t> physical_indices_;
+  TypedBufferBuilder<bool> physical_is_valid_;
+};
+
+Status RunEndEncodedTakeImpl(KernelContext* ctx, const ArrayData& values,
+                             const ArrayData& indices, Datum* out) {
+  if (TakeState::Get(ctx).boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(indices, values.length));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum int64_indices,
+                        Cast(Datum(indices.Copy()), int64(), CastOptions::Unsafe(),
+                             ctx->exec_context()));
+  const ArrayData& indices_data = *int64_indices.array();
+  const int64_t* raw_indices = indices_data.GetValues<int64_t>(1);
+  const uint8_t* indices_validity =
+      indices_data.MayHaveNulls() ? indices_data.buffers[0]->data() : nullptr;
+
+  // Remember the last run found, since consecutive indices often fall in the
+  // same run
+  int64_t run_start = 0, run_end = 0, physical_index = -1;
+  RunEndEncodedSelection selection(ctx);
+  for (int64_t i = 0; i < indices_data.length; ++i) {
+    if (indices_validity != nullptr &&
+        !BitUtil::GetBit(indices_validity, indices_data.offset + i)) {
+      RETURN_NOT_OK(selection.Append(-1, 1));
+      continue;
+    }
+    const int64_t index = raw_indices[i];
+    if (index < run_start || index >= run_end) {
+      physical_index = ree_util::FindPhysicalIndex(values, index);
+      run_start =
+          physical_index == 0
+              ? -values.offset
+              : ree_util::GetRunEnd(ree_util::RunEndsArray(values), physical_index - 1) -
+                    values.offset;
+      run_end = ree_util::GetRunEnd(ree_util::RunEndsArray(values), physical_index) -
+                values.offset;
+    }
+    RETURN_NOT_OK(selection.Append(physical_index, 1));
+  }
+  return selection.Finish(values, out);
+}
+
+Status RunEndEncodedFilterImpl(KernelContext* ctx, const ArrayData& values,
+                               const ArrayData& filter, Datum* out) {
+  if (values.length != filter.length) {
+    return Status::Invalid("Filter inputs must all be the same length");
+  }
+  const bool emit_nulls =
+      FilterState::Get(ctx).null_selection_behavior == FilterOptions::EMIT_NULL;
+  const uint8_t* filter_data = filter.buffers[1]->data();
+  const uint8_t* filter_validity =
+      filter.MayHaveNulls() ? filter.buffers[0]->data() : nullptr;
+
+  RunEndEncodedSelection selection(ctx);
+  int64_t position = filter.offset;
+  RETURN_NOT_OK(ree_util::VisitRuns(
+      values, [&](int64_t physical_index, int64_t run_length) {
+        if (filter_validity == nullptr) {
+          // Only count the selected positions of the run
+          const int64_t selected = CountSetBits(filter_data, position, run_length);
+          if (selected > 0) {
+            RETURN_NOT_OK(selection.Append(physical_index, selected));
+          }
+        } else {
+          for (int64_t i = position; i < position + run_length; ++i) {
+            if (!BitUtil::GetBit(filter_validity, i)) {
+              if (emit_nulls) {
+                RETURN_NOT_OK(selection.Append(-1, 1));
+              }
+            } else if (BitUtil::GetBit(filter_data, i)) {
+              RETURN_NOT_OK(selection.Append(physical_index, 1));
+            }
+          }
+        }
+        position += run_length;
+        return Status::OK();
+      }));
+  return selection.Finish(values, out);
+}
+
+void RunEndEncodedTake(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, RunEndEncodedTakeImpl(ctx, *batch[0].array(), *batch[1].array(), out));
+}
+
+void RunEndEncodedFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, RunEndEncodedFilterImpl(ctx, *batch[0].array(), *batch[1].array(), out));
+}
+
 // ----------------------------------------------------------------------
 // Implement take for other data types where there is less performance
 // sensitivity by visiting the selected indices.
@@ -1594,6 +1751,45 @@ struct FSBImpl : public Selection<FSBImpl, FixedSizeBinaryType> {
   Status Finish() override { return data_builder.Finish(&out->buffers[1]); }
 };
 
+// Only the views are gathered, the output shares the data buffers of the values
+struct StringViewImpl : public Selection<StringViewImpl, StringViewType> {
+  using Base = Selection<StringViewImpl, StringViewType>;
+  LIFT_BASE_MEMBERS();
+  using c_type = StringViewType::c_type;
+
+  TypedBufferBuilder<c_type> views_builder;
+
+  StringViewImpl(KernelContext* ctx, const ExecBatch& batch, int64_t output_length,
+                 Datum* out)
+      : Base(ctx, batch, output_length, out), views_builder(ctx->memory_pool()) {}
+
+  template <typename Adapter>
+  Status GenerateOutput() {
+    const c_type* views = values->GetValues<c_type>(1);
+    c_type empty_view;
+    std::memset(&empty_view, 0, sizeof(empty_view));
+
+    RETURN_NOT_OK(views_builder.Reserve(output_length));
+    Adapter adapter(this);
+    return adapter.Generate(
+        [&](int64_t index) {
+          views_builder.UnsafeAppend(views[index]);
+          return Status::OK();
+        },
+        [&]() {
+          views_builder.UnsafeAppend(empty_view);
+          return Status::OK();
+        });
+  }
+
+  Status Finish() override {
+    for (size_t i = 2; i < values->buffers.size(); ++i) {
+      out->buffers[i] = values->buffers[i];
+    }
+    return views_builder.Finish(&out->buffers[1]);
+  }
+};
+
 template <typename Type>
 struct ListImpl : public Selection<ListImpl<Type>, Type> {
   using offset_type = typename Type::offset_type;
@@ -1760,6 +1956,434 @@ void StructFilter(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
 
 #undef LIFT_BASE_MEMBERS
 
+// ----------------------------------------------------------------------
+// Selections shared by several chunks or columns
+//
+// The rows selected by a filter or by take indices are computed once, then
+// applied to each column of a record batch or table (in parallel if the
+// ExecContext allows it) without concatenating the chunks of the values.
+
+// Whether Concatenate() supports arrays of the given type
+bool CanConcatenate(const DataType& type) {
+  switch (type.id()) {
+    case Type::SPARSE_UNION:
+    case Type::DENSE_UNION:
+    case Type::EXTENSION:
+      return false;
+    default:
+      break;
+  }
+  for (const auto& field : type.fields()) {
+    if (!CanConcatenate(*field->type())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Result<std::shared_ptr<Array>> ConcatenatePieces(ArrayVector pieces, MemoryPool* pool) {
+  if (pieces.size() == 1) {
+    return std::move(pieces[0]);
+  }
+  return Concatenate(pieces, pool);
+}
+
+// Spans of selected rows at least this long on average are sliced out of the
+// values rather than taken
+constexpr int64_t kMinAverageFilterSpan = 128;
+
+// The rows selected by a boolean filter, either as spans of consecutive rows or
+// as take indices
+class FilterSelection {
+ public:
+  static Result<FilterSelection> Make(const ArrayData& filter,
+                                      FilterOptions::NullSelectionBehavior null_selection,
+                                      MemoryPool* pool) {
+    FilterSelection selection;
+    const bool have_filter_nulls = filter.MayHaveNulls();
+    if (!have_filter_nulls || null_selection == FilterOptions::DROP) {
+      // The selected rows are the set bits of (filter AND filter validity)
+      const uint8_t* selected = filter.buffers[1]->data();
+      int64_t selected_offset = filter.offset;
+      std::shared_ptr<Buffer> selected_buffer;
+      if (have_filter_nulls) {
+        ARROW_ASSIGN_OR_RAISE(selected_buffer,
+                              arrow::internal::BitmapAnd(
+                                  pool, selected, filter.offset, filter.buffers[0]->data(),
+                                  filter.offset, filter.length, /*out_offset=*/0));
+        selected = selected_buffer->data();
+        selected_offset = 0;
+      }
+      selection.length_ = CountSetBits(selected, selected_offset, filter.length);
+      const auto max_spans =
+          static_cast<size_t>(selection.length_ / kMinAverageFilterSpan);
+      selection.use_spans_ = true;
+      arrow::internal::SetBitRunReader reader(selected, selected_offset, filter.length);
+      for (auto run = reader.NextRun(); !run.AtEnd(); run = reader.NextRun()) {
+        if (selection.spans_.size() == max_spans) {
+          selection.use_spans_ = false;
+          selection.spans_.clear();
+          break;
+        }
+        selection.spans_.push_back(run);
+      }
+    }
+    if (!selection.use_spans_) {
+      ARROW_ASSIGN_OR_RAISE(selection.indices_,
+                            GetTakeIndices(filter, null_selection, pool));
+      selection.length_ = selection.indices_->length;
+    }
+    return selection;
+  }
+
+  // The number of output rows
+  int64_t length() const { return length_; }
+
+  Result<std::shared_ptr<Array>> Apply(const std::shared_ptr<Array>& values,
+                                       ExecContext* ctx) const {
+    if (!use_spans_) {
+      return TakeIndices(values, indices_, ctx);
+    }
+    if (spans_.empty()) {
+      return values->Slice(0, 0);
+    }
+    if (spans_.size() == 1) {
+      return values->Slice(spans_[0].position, spans_[0].length);
+    }
+    if (!CanConcatenate(*values->type())) {
+      ARROW_ASSIGN_OR_RAISE(auto indices, SpanIndices(ctx->memory_pool()));
+      return TakeIndices(values, indices, ctx);
+    }
+    ArrayVector slices;
+    slices.reserve(spans_.size());
+    for (const auto& span : spans_) {
+      slices.push_back(values->Slice(span.position, span.length));
+    }
+    return Concatenate(slices, ctx->memory_pool());
+  }
+
+ private:
+  static Result<std::shared_ptr<Array>> TakeIndices(
+      const std::shared_ptr<Array>& values, const std::shared_ptr<ArrayData>& indices,
+      ExecContext* ctx) {
+    ARROW_ASSIGN_OR_RAISE(Datum out, Take(values, Datum(indices),
+                                          TakeOptions::NoBoundsCheck(), ctx));
+    return out.make_array();
+  }
+
+  Result<std::shared_ptr<ArrayData>> SpanIndices(MemoryPool* pool) const {
+    TypedBufferBuilder<int64_t> builder(pool);
+    RETURN_NOT_OK(builder.Reserve(length_));
+    for (const auto& span : spans_) {
+      for (int64_t i = 0; i < span.length; ++i) {
+        builder.UnsafeAppend(span.position + i);
+      }
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(builder.Finish(&buffer));
+    return ArrayData::Make(int64(), length_, {nullptr, std::move(buffer)},
+                           /*null_count=*/0);
+  }
+
+  int64_t length_ = 0;
+  bool use_spans_ = false;
+  std::vector<arrow::internal::SetBitRun> spans_;
+  std::shared_ptr<ArrayData> indices_;
+};
+
+// Runs of take indices into the same chunk at least this long on average are
+// taken run by run.  Shorter runs are gathered chunk by chunk and put back in
+// order by a second take.
+constexpr int64_t kMinAverageTakeRun = 1024;
+
+// Take indices resolved against the chunk layout of a chunked array, which may
+// be applied to any chunked array with the same layout
+class ChunkedTakeSelection {
+ public:
+  static Result<ChunkedTakeSelection> Make(const ChunkedArray& values,
+                                           const std::shared_ptr<ArrayData>& indices,
+                                           MemoryPool* pool) {
+    ChunkedTakeSelection selection;
+    selection.indices_ = indices;
+    selection.chunk_offsets_.push_back(0);
+    int num_non_empty = 0;
+    for (const auto& chunk : values.chunks()) {
+      if (chunk->length() > 0) {
+        if (num_non_empty++ == 0) {
+          selection.single_chunk_ = static_cast<int>(selection.chunk_offsets_.size()) - 1;
+        }
+      }
+      selection.chunk_offsets_.push_back(selection.chunk_offsets_.back() +
+                                         chunk->length());
+    }
+    // Non-integer indices are rejected by the array kernel
+    if (num_non_empty <= 1 || indices->length == 0 || !is_integer(indices->type->id())) {
+      selection.strategy_ = SINGLE_CHUNK;
+      return selection;
+    }
+    switch (indices->type->id()) {
+      case Type::INT8:
+        RETURN_NOT_OK(selection.Resolve<int8_t>(pool));
+        break;
+      case Type::INT16:
+        RETURN_NOT_OK(selection.Resolve<int16_t>(pool));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(selection.Resolve<int32_t>(pool));
+        break;
+      case Type::INT64:
+        RETURN_NOT_OK(selection.Resolve<int64_t>(pool));
+        break;
+      case Type::UINT8:
+        RETURN_NOT_OK(selection.Resolve<uint8_t>(pool));
+        break;
+      case Type::UINT16:
+        RETURN_NOT_OK(selection.Resolve<uint16_t>(pool));
+        break;
+      case Type::UINT32:
+        RETURN_NOT_OK(selection.Resolve<uint32_t>(pool));
+        break;
+      default:
+        RETURN_NOT_OK(selection.Resolve<uint64_t>(pool));
+        break;
+    }
+    return selection;
+  }
+
+  // Whether `values` has the chunk layout the indices were resolved against
+  bool Matches(const ChunkedArray& values) const {
+    if (static_cast<size_t>(values.num_chunks()) + 1 != chunk_offsets_.size()) {
+      return false;
+    }
+    for (int i = 0; i < values.num_chunks(); ++i) {
+      if (values.chunk(i)->length() != chunk_offsets_[i + 1] - chunk_offsets_[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  Result<std::shared_ptr<Array>> Apply(const ChunkedArray& values,
+                                       const TakeOptions& options,
+                                       ExecContext* ctx) const {
+    DCHECK(Matches(values));
+    MemoryPool* pool = ctx->memory_pool();
+    switch (strategy_) {
+      case SINGLE_CHUNK: {
+        std::shared_ptr<Array> chunk;
+        if (single_chunk_ >= 0) {
+          chunk = values.chunk(single_chunk_);
+        } else {
+          ARROW_ASSIGN_OR_RAISE(chunk, MakeArrayOfNull(values.type(), 0, pool));
+        }
+        return Take(*chunk, *MakeArray(indices_), options, ctx);
+      }
+      case RUNS: {
+        const auto local_indices = MakeArray(local_indices_);
+        ArrayVector pieces(runs_.size());
+        for (size_t i = 0; i < runs_.size(); ++i) {
+          const auto& run = runs_[i];
+          ARROW_ASSIGN_OR_RAISE(
+              pieces[i], Take(*values.chunk(run.chunk),
+                              *local_indices->Slice(run.offset, run.length),
+                              TakeOptions::NoBoundsCheck(), ctx));
+        }
+        return ConcatenatePieces(std::move(pieces), pool);
+      }
+      case GATHER:
+      default: {
+        ArrayVector pieces;
+        for (size_t i = 0; i < chunk_indices_.size(); ++i) {
+          if (chunk_indices_[i] != nullptr) {
+            ARROW_ASSIGN_OR_RAISE(
+                auto piece, Take(*values.chunk(static_cast<int>(i)),
+                                 *MakeArray(chunk_indices_[i]),
+                                 TakeOptions::NoBoundsCheck(), ctx));
+            pieces.push_back(std::move(piece));
+          }
+        }
+        ARROW_ASSIGN_OR_RAISE(auto gathered, ConcatenatePieces(std::move(pieces), pool));
+        return Take(*gathered, *MakeArray(permutation_), TakeOptions::NoBoundsCheck(), ctx);
+      }
+    }
+  }
+
+ private:
+  enum Strategy { SINGLE_CHUNK, RUNS, GATHER };
+
+  // Consecutive indices into the same chunk
+  struct Run {
+    int chunk;
+    int64_t offset;
+    int64_t length;
+  };
+
+  template <typename IndexCType>
+  Status Resolve(MemoryPool* pool) {
+    using PrintType = typename std::conditional<std::is_signed<IndexCType>::value,
+                                                int64_t, uint64_t>::type;
+    const ArrayData& indices = *indices_;
+    const IndexCType* index_values = indices.GetValues<IndexCType>(1);
+    const uint8_t* index_bitmap = indices.MayHaveNulls() ? indices.buffers[0]->data()
+                                                         : nullptr;
+    const int64_t total_length = chunk_offsets_.back();
+
+    // The buffers of the local indices are shifted by the offset of the indices,
+    // so that the latter's validity bitmap can be reused
+    ARROW_ASSIGN_OR_RAISE(auto local_buffer, AllocateBuffer(
+                                                 (indices.offset + indices.length) *
+                                                     sizeof(int64_t),
+                                                 pool));
+    auto local_values = reinterpret_cast<int64_t*>(local_buffer->mutable_data()) + indices.offset;
+    std::vector<int> chunk_ids(indices.length);
+
+    int chunk = single_chunk_;
+    for (int64_t i = 0; i < indices.length; ++i) {
+      if (index_bitmap == nullptr ||
+          BitUtil::GetBit(index_bitmap, indices.offset + i)) {
+        const IndexCType index = index_values[i];
+        if ((std::is_signed<IndexCType>::value && index < 0) ||
+            static_cast<uint64_t>(index) >= static_cast<uint64_t>(total_length)) {
+          return Status::IndexError("Index ", static_cast<PrintType>(index),
+                                    " out of bounds");
+        }
+        const auto value = static_cast<int64_t>(index);
+        if (value < chunk_offsets_[chunk] || value >= chunk_offsets_[chunk + 1]) {
+          chunk = static_cast<int>(std::upper_bound(chunk_offsets_.begin(),
+                                                    chunk_offsets_.end(), value) -
+                                   chunk_offsets_.begin()) -
+                  1;
+        }
+        local_values[i] = value - chunk_offsets_[chunk];
+      } else {
+        // Null indices continue the current run
+        local_values[i] = 0;
+      }
+      chunk_ids[i] = chunk;
+      if (runs_.empty() || runs_.back().chunk != chunk) {
+        runs_.push_back({chunk, i, 0});
+      }
+      ++runs_.back().length;
+    }
+
+    if (static_cast<int64_t>(runs_.size()) * kMinAverageTakeRun <= indices.length) {
+      strategy_ = RUNS;
+      local_indices_ = ArrayData::Make(
+          int64(), indices.length, {indices.buffers[0], std::move(local_buffer)},
+          indices.null_count.load(), indices.offset);
+      return Status::OK();
+    }
+    runs_.clear();
+
+    // Gather the valid indices of each chunk, and compute where each output row
+    // lands among the gathered rows
+    strategy_ = GATHER;
+    const int num_chunks = static_cast<int>(chunk_offsets_.size()) - 1;
+    std::vector<int64_t> gathered_offsets(num_chunks + 1, 0);
+    for (int64_t i = 0; i < indices.length; ++i) {
+      if (index_bitmap == nullptr ||
+          BitUtil::GetBit(index_bitmap, indices.offset + i)) {
+        ++gathered_offsets[chunk_ids[i] + 1];
+      }
+    }
+    chunk_indices_.resize(num_chunks);
+    std::vector<int64_t*> chunk_values(num_chunks, nullptr);
+    for (int c = 0; c < num_chunks; ++c) {
+      const int64_t count = gathered_offsets[c + 1];
+      gathered_offsets[c + 1] += gathered_offsets[c];
+      if (count > 0) {
+        ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(count * sizeof(int64_t), pool));
+        chunk_values[c] = reinterpret_cast<int64_t*>(buffer->mutable_data());
+        chunk_indices_[c] =
+            ArrayData::Make(int64(), count, {nullptr, std::move(buffer)}, /*null_count=*/0);
+      }
+    }
+    // The local indices buffer is reused for the permutation
+    for (int64_t i = 0; i < indices.length; ++i) {
+      if (index_bitmap == nullptr ||
+          BitUtil::GetBit(index_bitmap, indices.offset + i)) {
+        const int c = chunk_ids[i];
+        *chunk_values[c]++ = local_values[i];
+        local_values[i] = gathered_offsets[c]++;
+      }
+    }
+    permutation_ = ArrayData::Make(int64(), indices.length,
+                                   {indices.buffers[0], std::move(local_buffer)},
+                                   indices.null_count.load(), indices.offset);
+    return Status::OK();
+  }
+
+  Strategy strategy_ = SINGLE_CHUNK;
+  // Cumulative chunk lengths, starting at 0
+  std::vector<int64_t> chunk_offsets_;
+  // The only non-empty chunk, or -1 if there are none (SINGLE_CHUNK), else the
+  // first non-empty chunk
+  int single_chunk_ = -1;
+  std::shared_ptr<ArrayData> indices_;
+  // RUNS: int64 indices relative to their chunk, with the nulls of indices_
+  std::shared_ptr<ArrayData> local_indices_;
+  std::vector<Run> runs_;
+  // GATHER: the valid indices of each chunk (null if none), relative to it
+  std::vector<std::shared_ptr<ArrayData>> chunk_indices_;
+  // GATHER: positions among the gathered rows, with the nulls of indices_
+  std::shared_ptr<ArrayData> permutation_;
+};
+
+// Take indices resolved once per distinct chunk layout among table columns
+class TableTakeSelection {
+ public:
+  static Result<TableTakeSelection> Make(const Table& table,
+                                         const std::shared_ptr<ArrayData>& indices,
+                                         MemoryPool* pool) {
+    TableTakeSelection selection;
+    selection.column_selections_.resize(table.num_columns());
+    for (int j = 0; j < table.num_columns(); ++j) {
+      const ChunkedArray& column = *table.column(j);
+      size_t k = 0;
+      while (k < selection.selections_.size() &&
+             !selection.selections_[k].Matches(column)) {
+        ++k;
+      }
+      if (k == selection.selections_.size()) {
+        ARROW_ASSIGN_OR_RAISE(auto column_selection,
+                              ChunkedTakeSelection::Make(column, indices, pool));
+        selection.selections_.push_back(std::move(column_selection));
+      }
+      selection.column_selections_[j] = k;
+    }
+    return selection;
+  }
+
+  Result<std::shared_ptr<Array>> Apply(const Table& table, int column,
+                                       const TakeOptions& options,
+                                       ExecContext* ctx) const {
+    return selections_[column_selections_[column]].Apply(*table.column(column), options,
+                                                         ctx);
+  }
+
+ private:
+  std::vector<ChunkedTakeSelection> selections_;
+  std::vector<size_t> column_selections_;
+};
+
+// Columns producing fewer rows than this are selected serially, as a task per
+// column would cost more than it saves
+constexpr int64_t kMinParallelSelectionLength = 1 << 14;
+
+// Call `func(i)` for each column i, which produces `num_rows` rows, in parallel
+// if the context allows it.  A worker of the CPU pool (e.g. a scan task
+// filtering its batches) runs serially, as the other workers may all be
+// blocked waiting on this one.
+template <typename Function>
+Status ForEachColumn(int num_columns, int64_t num_rows, ExecContext* ctx,
+                     Function&& func) {
+  const bool use_threads = ctx->use_threads() && num_columns > 1 &&
+                           num_rows >= kMinParallelSelectionLength &&
+                           !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+  return ::arrow::internal::OptionalParallelFor(use_threads, num_columns,
+                                                std::forward<Function>(func));
+}
+
 // ----------------------------------------------------------------------
 // Implement Filter metafunction
 
@@ -1771,19 +2395,18 @@ Result<std::shared_ptr<RecordBatch>> FilterRecordBatch(const RecordBatch& batch,
     return Status::Invalid("Filter inputs must all be the same length");
   }
 
-  // Convert filter to selection vector/indices and use Take
+  // Compute the selection once for all the columns
   const auto& filter_opts = *static_cast<const FilterOptions*>(options);
   ARROW_ASSIGN_OR_RAISE(
-      std::shared_ptr<ArrayData> indices,
-      GetTakeIndices(*filter.array(), filter_opts.null_selection_behavior,
-                     ctx->memory_pool()));
+      auto selection,
+      FilterSelection::Make(*filter.array(), filter_opts.null_selection_behavior,
+                            ctx->memory_pool()));
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
-                                          TakeOptions::NoBoundsCheck(), ctx));
-    columns[i] = out.make_array();
-  }
-  return RecordBatch::Make(batch.schema(), indices->length, columns);
+  RETURN_NOT_OK(
+      ForEachColumn(batch.num_columns(), selection.length(), ctx, [&](int i) -> Status {
+        return selection.Apply(batch.column(i), ctx).Value(&columns[i]);
+      }));
+  return RecordBatch::Make(batch.schema(), selection.length(), columns);
 }
 
 Result<std::shared_ptr<Table>> FilterTable(const Table& table, const Datum& filter,
@@ -1822,31 +2445,33 @@ Result<std::shared_ptr<Table>> FilterTable(const Table& table, const Datum& filt
 
   // Instead of filtering each column with the boolean filter
   // (which would be slow if the table has a large number of columns: ARROW-10569),
-  // convert each filter chunk to indices, and take() the column.
+  // compute the selection of each filter chunk once and apply it to the columns.
   const int64_t num_chunks = static_cast<int64_t>(inputs.back().size());
-  std::vector<ArrayVector> out_columns(num_columns);
+  std::vector<int64_t> selected_chunks;
+  std::vector<FilterSelection> selections;
   int64_t out_num_rows = 0;
-
   for (int64_t i = 0; i < num_chunks; ++i) {
-    const ArrayData& filter_chunk = *inputs.back()[i]->data();
-    ARROW_ASSIGN_OR_RAISE(
-        const auto indices,
-        GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
-                       ctx->memory_pool()));
-
-    if (indices->length > 0) {
-      // Take from all input columns
-      Datum indices_datum{std::move(indices)};
-      for (int col = 0; col < num_columns; ++col) {
-        const auto& column_chunk = inputs[col][i];
-        ARROW_ASSIGN_OR_RAISE(Datum out, Take(column_chunk, indices_datum,
-                                              TakeOptions::NoBoundsCheck(), ctx));
-        out_columns[col].push_back(std::move(out).make_array());
-      }
-      out_num_rows += indices->length;
+    ARROW_ASSIGN_OR_RAISE(auto selection,
+                          FilterSelection::Make(*inputs.back()[i]->data(),
+                                                filter_opts.null_selection_behavior,
+                                                ctx->memory_pool()));
+    if (selection.length() > 0) {
+      out_num_rows += selection.length();
+      selected_chunks.push_back(i);
+      selections.push_back(std::move(selection));
     }
   }
 
+  std::vector<ArrayVector> out_columns(num_columns);
+  RETURN_NOT_OK(ForEachColumn(num_columns, out_num_rows, ctx, [&](int col) -> Status {
+    out_columns[col].resize(selections.size());
+    for (size_t k = 0; k < selections.size(); ++k) {
+      ARROW_ASSIGN_OR_RAISE(out_columns[col][k],
+                            selections[k].Apply(inputs[col][selected_chunks[k]], ctx));
+    }
+    return Status::OK();
+  }));
+
   ChunkedArrayVector out_chunks(num_columns);
   for (int i = 0; i < num_columns; ++i) {
     out_chunks[i] = std::make_shared<ChunkedArray>(std::move(out_columns[i]),
@@ -1912,26 +2537,12 @@ Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
                                              ExecContext* ctx) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
-
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
-  } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    ARROW_ASSIGN_OR_RAISE(current_chunk,
-                          Concatenate(values.chunks(), ctx->memory_pool()));
-  }
-  // Call Array Take on our single chunk
-  ARROW_ASSIGN_OR_RAISE(new_chunks[0], TakeAA(*current_chunk, indices, options, ctx));
-  return std::make_shared<ChunkedArray>(std::move(new_chunks));
+  // The indices are resolved against the chunks, so that the latter need not be
+  // concatenated
+  ARROW_ASSIGN_OR_RAISE(auto selection, ChunkedTakeSelection::Make(
+                                            values, indices.data(), ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(auto out, selection.Apply(values, options, ctx));
+  return std::make_shared<ChunkedArray>(ArrayVector{std::move(out)}, values.type());
 }
 
 Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
@@ -1942,15 +2553,12 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
   for (int i = 0; i < num_chunks; i++) {
     // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
-                          TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(
+        auto selection, ChunkedTakeSelection::Make(values, indices.chunk(i)->data(),
+                                                   ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(new_chunks[i], selection.Apply(values, options, ctx));
   }
-  return std::make_shared<ChunkedArray>(std::move(new_chunks));
+  return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
 
 Result<std::shared_ptr<ChunkedArray>> TakeAC(const Array& values,
@@ -1973,9 +2581,9 @@ Result<std::shared_ptr<RecordBatch>> TakeRA(const RecordBatch& batch,
   auto ncols = batch.num_columns();
   auto nrows = indices.length();
   std::vector<std::shared_ptr<Array>> columns(ncols);
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeAA(*batch.column(j), indices, options, ctx));
-  }
+  RETURN_NOT_OK(ForEachColumn(ncols, nrows, ctx, [&](int j) -> Status {
+    return TakeAA(*batch.column(j), indices, options, ctx).Value(&columns[j]);
+  }));
   return RecordBatch::Make(batch.schema(), nrows, columns);
 }
 
@@ -1984,19 +2592,40 @@ Result<std::shared_ptr<Table>> TakeTA(const Table& table, const Array& indices,
   auto ncols = table.num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeCA(*table.column(j), indices, options, ctx));
-  }
+  ARROW_ASSIGN_OR_RAISE(auto selection, TableTakeSelection::Make(table, indices.data(),
+                                                                 ctx->memory_pool()));
+  RETURN_NOT_OK(ForEachColumn(ncols, indices.length(), ctx, [&](int j) -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto chunk, selection.Apply(table, j, options, ctx));
+    columns[j] = std::make_shared<ChunkedArray>(ArrayVector{std::move(chunk)},
+                                                table.column(j)->type());
+    return Status::OK();
+  }));
   return Table::Make(table.schema(), columns);
 }
 
 Result<std::shared_ptr<Table>> TakeTC(const Table& table, const ChunkedArray& indices,
                                       const TakeOptions& options, ExecContext* ctx) {
   auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-  for (int j = 0; j < ncols; j++) {
-    ARROW_ASSIGN_OR_RAISE(columns[j], TakeCC(*table.column(j), indices, options, ctx));
+  auto num_chunks = indices.num_chunks();
+  std::vector<TableTakeSelection> selections;
+  selections.reserve(num_chunks);
+  for (int i = 0; i < num_chunks; i++) {
+    ARROW_ASSIGN_OR_RAISE(auto selection,
+                          TableTakeSelection::Make(table, indices.chunk(i)->data(),
+                                                   ctx->memory_pool()));
+    selections.push_back(std::move(selection));
   }
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+  RETURN_NOT_OK(ForEachColumn(ncols, indices.length(), ctx, [&](int j) -> Status {
+    ArrayVector new_chunks(num_chunks);
+    for (int i = 0; i < num_chunks; i++) {
+      ARROW_ASSIGN_OR_RAISE(new_chunks[i], selections[i].Apply(table, j, options, ctx));
+    }
+    columns[j] =
+        std::make_shared<ChunkedArray>(std::move(new_chunks), table.column(j)->type());
+    return Status::OK();
+  }));
   return Table::Make(table.schema(), columns);
 }
 
@@ -2011,8 +2640,8 @@ const FunctionDoc take_doc(
 // Metafunction for dispatching to different Take implementations other than
 // Array-Array.
 //
-// TODO: Revamp approach to executing Take operations. In addition to being
-// overly complex dispatching, there is no parallelization.
+// TODO: Revamp approach to executing Take operations, the dispatching is overly
+// complex.
 class TakeMetaFunction : public MetaFunction {
  public:
   TakeMetaFunction()
@@ -2124,10 +2753,12 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::BinaryLike(), ValueDescr::ARRAY), BinaryFilter},
       {InputType(match::LargeBinaryLike(), ValueDescr::ARRAY), BinaryFilter},
       {InputType::Array(Type::FIXED_SIZE_BINARY), FilterExec<FSBImpl>},
+      {InputType::Array(Type::STRING_VIEW), FilterExec<StringViewImpl>},
       {InputType::Array(null()), NullFilter},
       {InputType::Array(Type::DECIMAL), FilterExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryFilter},
       {InputType::Array(Type::EXTENSION), ExtensionFilter},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedFilter},
       {InputType::Array(Type::LIST), FilterExec<ListImpl<ListType>>},
       {InputType::Array(Type::LARGE_LIST), FilterExec<ListImpl<LargeListType>>},
       {InputType::Array(Type::FIXED_SIZE_LIST), FilterExec<FSLImpl>},
@@ -2152,11 +2783,13 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
       {InputType(match::LargeBinaryLike(), ValueDescr::ARRAY),
        TakeExec<VarBinaryImpl<LargeBinaryType>>},
       {InputType::Array(Type::FIXED_SIZE_BINARY), TakeExec<FSBImpl>},
+      {InputType::Array(Type::STRING_VIEW), TakeExec<StringViewImpl>},
       {InputType::Array(null()), NullTake},
       {InputType::Array(Type::DECIMAL128), TakeExec<FSBImpl>},
       {InputType::Array(Type::DECIMAL256), TakeExec<FSBImpl>},
       {InputType::Array(Type::DICTIONARY), DictionaryTake},
       {InputType::Array(Type::EXTENSION), ExtensionTake},
+      {InputType::Array(Type::RUN_END_ENCODED), RunEndEncodedTake},
       {InputType::Array(Type::LIST), TakeExec<ListImpl<ListType>>},
       {InputType::Array(Type::LARGE_LIST), TakeExec<ListImpl<LargeListType>>},
       {InputType::Array(Type::FIXED_SIZE_LIST), TakeExec<FSLImpl>},
@@ -31,6 +31,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -500,6 +501,16 @@ TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4]");
 }
 
+class TestFilterKernelWithStringView : public TestFilterKernel<StringViewType> {};
+
+TEST_F(TestFilterKernelWithStringView, FilterStringView) {
+  auto values = R"(["a", "a value longer than the inline size", null, "c"])";
+  this->AssertFilter(utf8_view(), values, "[0, 1, 0, 1]",
+                     R"(["a value longer than the inline size", "c"])");
+  this->AssertFilter(utf8_view(), values, "[1, null, 1, 0]", R"(["a", null, null])");
+  this->AssertFilter(utf8_view(), values, "[0, 0, 0, 0]", "[]");
+}
+
 class TestFilterKernelWithList : public TestFilterKernel<ListType> {
  public:
 };
@@ -1130,6 +1141,23 @@ TEST_F(TestTakeKernelFSB, TakeFixedSizeBinary) {
                                      int64(), "[2, 5]", &arr));
 }
 
+class TestTakeKernelStringView : public TestTakeKernelTyped<StringViewType> {};
+
+TEST_F(TestTakeKernelStringView, TakeStringView) {
+  auto values = R"(["a", "a value longer than the inline size", null])";
+  CheckTake(utf8_view(), values, "[1, 0, 1]",
+            R"(["a value longer than the inline size", "a",
+                "a value longer than the inline size"])");
+  CheckTake(utf8_view(), values, "[2, null, 0]", R"([null, null, "a"])");
+  CheckTake(utf8_view(), values, "[]", "[]");
+
+  this->TestNoValidityBitmapButUnknownNullCount(utf8_view(), R"(["a", "b", "c"])",
+                                                "[0, 1, 0]");
+
+  std::shared_ptr<Array> arr;
+  ASSERT_RAISES(IndexError, TakeJSON(utf8_view(), values, int8(), "[0, 3]", &arr));
+}
+
 class TestTakeKernelWithList : public TestTakeKernelTyped<ListType> {};
 
 TEST_F(TestTakeKernelWithList, TakeListInt32) {
@@ -1541,12 +1569,17 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
   this->AssertChunkedTake(int8(), {"[7]", "[8, 9]"}, {"[0, 1, 0]", "[]", "[2]"},
                           {"[7, 8, 7]", "[]", "[9]"});
   this->AssertTake(int8(), {"[7]", "[8, 9]"}, "[2, 1]", {"[9, 8]"});
+  this->AssertTake(int8(), {"[7]", "[]", "[8, 9]"}, "[2, null, 0, 1]",
+                   {"[9, null, 7, 8]"});
+  this->AssertTake(int8(), {"[]", "[]"}, "[null, null]", {"[null, null]"});
 
   std::shared_ptr<ChunkedArray> arr;
   ASSERT_RAISES(IndexError,
                 this->TakeWithArray(int8(), {"[7]", "[8, 9]"}, "[0, 5]", &arr));
   ASSERT_RAISES(IndexError, this->TakeWithChunkedArray(int8(), {"[7]", "[8, 9]"},
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
+  ASSERT_RAISES(IndexError,
+                this->TakeWithArray(int8(), {"[7]", "[8, 9]"}, "[0, -1]", &arr));
 }
 
 class TestTakeKernelWithTable : public TestTakeKernelTyped<Table> {
@@ -1717,5 +1750,167 @@ TEST(TestTake, RandomFixedSizeBinary) {
   TakeRandomTest<FixedSizeBinaryType>::Test(fixed_size_binary(16));
 }
 
+// ----------------------------------------------------------------------
+// Selections resolved against chunk layouts
+
+std::shared_ptr<ChunkedArray> SplitIntoChunks(const std::shared_ptr<Array>& array,
+                                              const std::vector<int64_t>& lengths) {
+  ArrayVector chunks;
+  int64_t offset = 0;
+  for (const int64_t length : lengths) {
+    chunks.push_back(array->Slice(offset, length));
+    offset += length;
+  }
+  chunks.push_back(array->Slice(offset));
+  return std::make_shared<ChunkedArray>(std::move(chunks), array->type());
+}
+
+std::shared_ptr<Array> SortedIndices(int64_t length, int64_t step) {
+  std::vector<int64_t> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = i * step;
+  }
+  std::shared_ptr<Array> out;
+  ArrayFromVector<Int64Type>(values, &out);
+  return out;
+}
+
+void CheckChunkedTake(const std::shared_ptr<Array>& values,
+                      const std::vector<int64_t>& chunk_lengths,
+                      const std::shared_ptr<Array>& indices) {
+  auto chunked = SplitIntoChunks(values, chunk_lengths);
+  ASSERT_OK_AND_ASSIGN(Datum expected, Take(values, indices));
+  ASSERT_OK_AND_ASSIGN(Datum actual, Take(chunked, indices));
+  ASSERT_OK(actual.chunked_array()->ValidateFull());
+  ASSERT_EQ(actual.chunked_array()->num_chunks(), 1);
+  AssertArraysEqual(*expected.make_array(), *actual.chunked_array()->chunk(0),
+                    /*verbose=*/true);
+}
+
+TEST(TestTake, ChunkedRandom) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 5000;
+  const std::vector<int64_t> chunk_lengths = {1000, 0, 2500, 1};
+  for (const auto& type : {int32(), utf8(), boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    auto values = rand.ArrayOf(type, length, /*null_probability=*/0.1);
+    // Long runs of indices into the same chunk
+    CheckChunkedTake(values, chunk_lengths, SortedIndices(length, 1));
+    CheckChunkedTake(values, chunk_lengths, SortedIndices(length, 1)->Slice(700, 3000));
+    // Scattered indices
+    CheckChunkedTake(values, chunk_lengths, SortedIndices(length / 7, 7));
+    for (const auto null_probability : {0.0, 0.1, 1.0}) {
+      auto indices = rand.Int32(2000, 0, length - 1, null_probability);
+      CheckChunkedTake(values, chunk_lengths, indices);
+      CheckChunkedTake(values, chunk_lengths, indices->Slice(3));
+      CheckChunkedTake(values, chunk_lengths,
+                       rand.UInt16(2000, 2400, 3600, null_probability));
+    }
+  }
+
+  auto chunked = SplitIntoChunks(rand.Int32(length, 0, 100), chunk_lengths);
+  ASSERT_RAISES(IndexError, Take(chunked, ArrayFromJSON(int32(), "[1, 5000]")));
+  ASSERT_RAISES(IndexError, Take(chunked, ArrayFromJSON(int64(), "[-1, 1]")));
+}
+
+TEST(TestTake, ChunkedTableRandom) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 3000;
+  auto a = rand.Int64(length, 0, 1000, /*null_probability=*/0.1);
+  auto b = rand.String(length, 0, 10, /*null_probability=*/0.1);
+  // The columns have different chunk layouts
+  auto table = Table::Make(schema({field("a", int64()), field("b", utf8())}),
+                           {SplitIntoChunks(a, {1000, 1000}), SplitIntoChunks(b, {2500})});
+  auto indices = ChunkedArrayFromJSON(int32(), {"[2999, null, 0, 1500]", "[]"});
+  auto sorted_indices = std::make_shared<ChunkedArray>(
+      ArrayVector{SortedIndices(length, 1), SortedIndices(length / 3, 3)});
+
+  for (const auto& indices : {indices, sorted_indices}) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, Take(table, indices));
+    ASSERT_OK(actual.table()->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(Datum expected_a, Take(a, indices));
+    ASSERT_OK_AND_ASSIGN(Datum expected_b, Take(b, indices));
+    AssertChunkedEqual(*expected_a.chunked_array(), *actual.table()->column(0));
+    AssertChunkedEqual(*expected_b.chunked_array(), *actual.table()->column(1));
+
+    ASSERT_OK_AND_ASSIGN(actual, Take(table, indices->chunk(0)));
+    ASSERT_OK(actual.table()->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(expected_a, Take(a, indices->chunk(0)));
+    AssertArraysEqual(*expected_a.make_array(), *actual.table()->column(0)->chunk(0));
+  }
+}
+
+TEST(TestFilter, ChunkedTableRandom) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 5000;
+  auto a = rand.Int64(length, 0, 1000, /*null_probability=*/0.1);
+  auto b = rand.String(length, 0, 10, /*null_probability=*/0.1);
+  auto table = Table::Make(schema({field("a", int64()), field("b", utf8())}),
+                           {SplitIntoChunks(a, {1000, 1000}), SplitIntoChunks(b, {2500})});
+  auto batch = RecordBatch::Make(table->schema(), length, {a, b});
+
+  // Mostly true filters are applied using spans of selected rows, the others
+  // using indices
+  for (const auto true_probability : {0.0, 0.5, 0.9999, 1.0}) {
+    for (const auto null_probability : {0.0, 0.0001, 0.1}) {
+      auto filter = rand.Boolean(length, true_probability, null_probability);
+      for (const auto null_selection :
+           {FilterOptions::DROP, FilterOptions::EMIT_NULL}) {
+        SCOPED_TRACE("true_probability = " + std::to_string(true_probability) +
+                     ", null_probability = " + std::to_string(null_probability) +
+                     ", null_selection = " + std::to_string(null_selection));
+        FilterOptions options(null_selection);
+        ASSERT_OK_AND_ASSIGN(Datum expected_a, Filter(a, filter, options));
+        ASSERT_OK_AND_ASSIGN(Datum expected_b, Filter(b, filter, options));
+
+        ASSERT_OK_AND_ASSIGN(Datum actual, Filter(table, filter, options));
+        ASSERT_OK(actual.table()->ValidateFull());
+        AssertChunkedEquivalent(ChunkedArray(expected_a.make_array()),
+                                *actual.table()->column(0));
+        AssertChunkedEquivalent(ChunkedArray(expected_b.make_array()),
+                                *actual.table()->column(1));
+
+        ASSERT_OK_AND_ASSIGN(actual, Filter(batch, filter, options));
+        ASSERT_OK(actual.record_batch()->ValidateFull());
+        AssertArraysEqual(*expected_a.make_array(), *actual.record_batch()->column(0));
+        AssertArraysEqual(*expected_b.make_array(), *actual.record_batch()->column(1));
+      }
+    }
+  }
+}
+
+TEST(TestFilter, RecordBatchInCpuPoolTasks) {
+  // Every worker of the CPU pool filtering a batch at once, as scan tasks do,
+  // mustn't wait on column tasks queued behind the workers themselves
+  ScopedCpuThreadPoolCapacity capacity;
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 1 << 16;
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < 8; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    columns.push_back(rand.Int32(length, 0, 100, /*null_probability=*/0.1));
+  }
+  auto batch = RecordBatch::Make(schema(fields), length, columns);
+  auto filter = rand.Boolean(length, /*true_probability=*/0.5, /*null_probability=*/0.1);
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(Datum expected,
+                       Filter(batch, filter, FilterOptions::Defaults(), &serial_ctx));
+
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  std::vector<Future<Datum>> futures;
+  for (int i = 0; i < 2 * pool->GetCapacity(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future,
+                         pool->Submit([&] { return Filter(batch, filter); }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, future.result());
+    AssertBatchesEqual(*expected.record_batch(), *actual.record_batch());
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <numeric>
 #include <type_traits>
@@ -29,7 +31,10 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -532,6 +537,195 @@ class ArrayCountOrCompareSorter {
   static const uint32_t countsort_max_range_ = 4096;
 };
 
+// Sort binary-like values with a MSD radix sort on 8-byte prefixes
+//
+// Each value is keyed by its next 8 bytes packed big-endian into an integer,
+// so that most of the work is a stable radix sort of a flat array of integers
+// rather than comparisons chasing offsets into the value data.  Runs of
+// equal keys are then refined on the following 8 bytes, until they are
+// small enough to be sorted with plain comparisons.
+template <typename ArrowType>
+class ArrayBinarySorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  struct Entry {
+    uint64_t key;
+    uint64_t index;
+  };
+
+  // A run of entries whose first `depth` bytes are equal
+  struct Range {
+    Entry* begin;
+    Entry* end;
+    int64_t depth;
+  };
+
+ public:
+  // Returns where null starts.
+  //
+  // `offset` is used when this is called on a chunk of a chunked array
+  uint64_t* Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+                 int64_t offset, const ArraySortOptions& options) {
+    auto nulls_begin = PartitionNulls<ArrayType, StablePartitioner>(
+        indices_begin, indices_end, values, offset);
+    const auto length = nulls_begin - indices_begin;
+    entries_.resize(length);
+    scratch_.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      entries_[i].index = indices_begin[i];
+    }
+
+    // Use an explicit stack, as long common prefixes would need a deep recursion
+    std::vector<Range> ranges = {{entries_.data(), entries_.data() + length, 0}};
+    while (!ranges.empty()) {
+      const auto range = ranges.back();
+      ranges.pop_back();
+      RefineRange(range, values, offset, options.order, &ranges);
+    }
+
+    for (int64_t i = 0; i < length; ++i) {
+      indices_begin[i] = entries_[i].index;
+    }
+    return nulls_begin;
+  }
+
+ private:
+  // Number of value bytes packed in a key
+  static constexpr int64_t kKeyWidth = sizeof(uint64_t);
+  // Runs no longer than this are sorted with comparisons
+  static constexpr int64_t kMaxCompareSortLength = 16;
+  // Keys of runs shorter than this are sorted with std::stable_sort
+  static constexpr int64_t kMinRadixSortLength = 256;
+
+  static util::string_view GetView(const ArrayType& values, int64_t offset,
+                                   uint64_t index) {
+    return values.GetView(index - offset);
+  }
+
+  // Pack bytes [depth, depth + kKeyWidth) of the value, padded with zeros
+  static uint64_t PackKey(util::string_view value, int64_t depth) {
+    uint64_t key = 0;
+    const int64_t size = static_cast<int64_t>(value.size());
+    if (depth < size) {
+      std::memcpy(&key, value.data() + depth,
+                  static_cast<size_t>(std::min(size - depth, int64_t{kKeyWidth})));
+    }
+    return BitUtil::FromBigEndian(key);
+  }
+
+  void RefineRange(const Range& range, const ArrayType& values, int64_t offset,
+                   SortOrder order, std::vector<Range>* ranges) {
+    const auto length = range.end - range.begin;
+    if (length <= kMaxCompareSortLength) {
+      CompareSort(range, values, offset, order);
+      return;
+    }
+
+    bool all_values_end = true;
+    for (auto it = range.begin; it != range.end; ++it) {
+      const auto value = GetView(values, offset, it->index);
+      it->key = PackKey(value, range.depth);
+      if (order == SortOrder::Descending) {
+        it->key = ~it->key;
+      }
+      all_values_end &= static_cast<int64_t>(value.size()) <= range.depth + kKeyWidth;
+    }
+    SortByKey(range.begin, range.end);
+
+    for (auto run_begin = range.begin; run_begin != range.end;) {
+      auto run_end = run_begin + 1;
+      while (run_end != range.end && run_end->key == run_begin->key) {
+        ++run_end;
+      }
+      if (run_end - run_begin > 1) {
+        if (all_values_end) {
+          // The values only differ by their number of trailing zero bytes
+          LengthSort({run_begin, run_end, range.depth}, values, offset, order);
+        } else {
+          ranges->push_back({run_begin, run_end, range.depth + kKeyWidth});
+        }
+      }
+      run_begin = run_end;
+    }
+  }
+
+  // Stable LSD radix sort on the keys, skipping the bytes equal in all keys
+  void SortByKey(Entry* begin, Entry* end) {
+    const auto length = end - begin;
+    if (length < kMinRadixSortLength) {
+      std::stable_sort(begin, end, [](const Entry& left, const Entry& right) {
+        return left.key < right.key;
+      });
+      return;
+    }
+    uint64_t all_ones = ~static_cast<uint64_t>(0);
+    uint64_t any_ones = 0;
+    for (auto it = begin; it != end; ++it) {
+      all_ones &= it->key;
+      any_ones |= it->key;
+    }
+    const uint64_t varying_bits = all_ones ^ any_ones;
+
+    Entry* source = begin;
+    Entry* destination = scratch_.data();
+    for (int shift = 0; shift < 64; shift += 8) {
+      if (((varying_bits >> shift) & 0xFF) == 0) {
+        continue;
+      }
+      std::array<int64_t, 257> counts{};
+      for (auto it = source; it != source + length; ++it) {
+        ++counts[((it->key >> shift) & 0xFF) + 1];
+      }
+      for (int i = 1; i < 257; ++i) {
+        counts[i] += counts[i - 1];
+      }
+      for (auto it = source; it != source + length; ++it) {
+        destination[counts[(it->key >> shift) & 0xFF]++] = *it;
+      }
+      std::swap(source, destination);
+    }
+    if (source != begin) {
+      std::copy(source, source + length, begin);
+    }
+  }
+
+  void CompareSort(const Range& range, const ArrayType& values, int64_t offset,
+                   SortOrder order) {
+    // The first `depth` bytes are equal, up to zero padding
+    auto suffix = [&](util::string_view value, util::string_view other) {
+      const auto skip = std::min<int64_t>(
+          range.depth, std::min(value.size(), other.size()));
+      return value.substr(static_cast<size_t>(skip));
+    };
+    if (order == SortOrder::Ascending) {
+      std::stable_sort(range.begin, range.end, [&](const Entry& left, const Entry& right) {
+        const auto lhs = GetView(values, offset, left.index);
+        const auto rhs = GetView(values, offset, right.index);
+        return suffix(lhs, rhs) < suffix(rhs, lhs);
+      });
+    } else {
+      std::stable_sort(range.begin, range.end, [&](const Entry& left, const Entry& right) {
+        const auto lhs = GetView(values, offset, left.index);
+        const auto rhs = GetView(values, offset, right.index);
+        return suffix(rhs, lhs) < suffix(lhs, rhs);
+      });
+    }
+  }
+
+  // Sort values equal up to zero padding: the shorter ones are smaller
+  void LengthSort(const Range& range, const ArrayType& values, int64_t offset,
+                  SortOrder order) {
+    std::stable_sort(range.begin, range.end, [&](const Entry& left, const Entry& right) {
+      const auto lhs = GetView(values, offset, left.index).size();
+      const auto rhs = GetView(values, offset, right.index).size();
+      return order == SortOrder::Ascending ? lhs < rhs : rhs < lhs;
+    });
+  }
+
+  std::vector<Entry> entries_;
+  std::vector<Entry> scratch_;
+};
+
 template <typename Type, typename Enable = void>
 struct ArraySorter;
 
@@ -555,12 +749,18 @@ struct ArraySorter<Type, enable_if_t<(is_integer_type<Type>::value &&
 };
 
 template <typename Type>
-struct ArraySorter<
-    Type, enable_if_t<is_floating_type<Type>::value || is_base_binary_type<Type>::value ||
-                      is_fixed_size_binary_type<Type>::value>> {
+struct ArraySorter<Type, enable_if_t<is_floating_type<Type>::value ||
+                                     is_decimal_type<Type>::value>> {
   ArrayCompareSorter<Type> impl;
 };
 
+template <typename Type>
+struct ArraySorter<Type, enable_if_t<is_base_binary_type<Type>::value ||
+                                     is_string_view_type<Type>::value ||
+                                     std::is_same<Type, FixedSizeBinaryType>::value>> {
+  ArrayBinarySorter<Type> impl;
+};
+
 using ArraySortIndicesState = internal::OptionsWrapper<ArraySortOptions>;
 
 template <typename OutType, typename InType>
@@ -584,6 +784,7 @@ struct ArraySortIndices {
 //
 // * Number types
 // * Base binary types
+// * String view
 
 template <template <typename...> class ExecTemplate>
 void AddSortingKernels(VectorKernel base, VectorFunction* func) {
@@ -614,6 +815,174 @@ void AddSortingKernels(VectorKernel base, VectorFunction* func) {
       KernelSignature::Make({InputType::Array(Type::FIXED_SIZE_BINARY)}, uint64());
   base.exec = ExecTemplate<UInt64Type, FixedSizeBinaryType>::Exec;
   DCHECK_OK(func->AddKernel(base));
+  base.signature = KernelSignature::Make({InputType::Array(Type::STRING_VIEW)}, uint64());
+  base.exec = ExecTemplate<UInt64Type, StringViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
+}
+
+// ----------------------------------------------------------------------
+// Parallel sorting helpers
+
+// Don't bother splitting a sort into tasks smaller than this.
+constexpr int64_t kMinParallelSortLength = 4096;
+
+// Returns the number of tasks sorting `length` indices should be split into.
+//
+// A sort called from a worker of the CPU pool (e.g. by an ExecPlan node) runs
+// serially, as the other workers may all be blocked waiting on this one.
+int GetNumSortTasks(ExecContext* ctx, int64_t length) {
+  if (!ctx->use_threads() || ::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+    return 1;
+  }
+  const int64_t max_tasks = std::max<int64_t>(1, length / kMinParallelSortLength);
+  return static_cast<int>(
+      std::min<int64_t>(max_tasks, GetCpuThreadPoolCapacity()));
+}
+
+// Call `func(task_index, i)` for each i in [0, num_items), spreading the calls
+// over up to `num_tasks` tasks. Calls with the same task index never run
+// concurrently.
+template <typename Function>
+Status ParallelForEach(int num_tasks, int64_t num_items, Function&& func) {
+  const int num_workers = static_cast<int>(std::min<int64_t>(num_tasks, num_items));
+  return ::arrow::internal::OptionalParallelFor(
+      num_workers > 1, num_workers, [&](int task_index) {
+        for (int64_t i = task_index; i < num_items; i += num_workers) {
+          func(task_index, i);
+        }
+        return Status::OK();
+      });
+}
+
+// Two adjacent sorted runs of indices: [begin, middle) and [middle, end).
+struct SortedRunPair {
+  uint64_t* begin;
+  uint64_t* middle;
+  uint64_t* end;
+};
+
+// Stably merge each pair of sorted runs in place.
+//
+// Each merge is cut along evenly spaced diagonals of its merge path, so that
+// `num_tasks` tasks are kept busy even when few pairs remain. `temp_indices`
+// must have room for as many indices as spanned from `indices_begin` to the
+// end of the last pair.
+//
+// `compare(task_index, left, right)` is never called concurrently with the
+// same task index.
+template <typename Compare>
+Status MergeSortedRuns(int num_tasks, const std::vector<SortedRunPair>& pairs,
+                       uint64_t* indices_begin, uint64_t* temp_indices,
+                       Compare&& compare) {
+  struct MergePiece {
+    uint64_t* left_begin;
+    uint64_t* left_end;
+    uint64_t* right_begin;
+    uint64_t* right_end;
+    uint64_t* out;
+  };
+
+  const int64_t num_pairs = static_cast<int64_t>(pairs.size());
+  const int64_t pieces_per_pair =
+      std::max<int64_t>(1, num_tasks / std::max<int64_t>(1, num_pairs));
+  std::vector<MergePiece> pieces;
+  pieces.reserve(num_pairs * pieces_per_pair);
+  for (const auto& pair : pairs) {
+    const int64_t left_length = pair.middle - pair.begin;
+    const int64_t right_length = pair.end - pair.middle;
+    int64_t prev_diagonal = 0;
+    int64_t prev_left_count = 0;
+    for (int64_t p = 1; p <= pieces_per_pair; ++p) {
+      const int64_t diagonal = (left_length + right_length) * p / pieces_per_pair;
+      // Find how many left indices come before `diagonal` in the merged output.
+      // Ties are taken from the left, like std::merge does.
+      int64_t lo = std::max<int64_t>(0, diagonal - right_length);
+      int64_t hi = std::min(diagonal, left_length);
+      while (lo < hi) {
+        const int64_t i = lo + (hi - lo) / 2;
+        const int64_t j = diagonal - i;
+        if (!compare(0, pair.middle[j - 1], pair.begin[i])) {
+          lo = i + 1;
+        } else {
+          hi = i;
+        }
+      }
+      const int64_t left_count = lo;
+      pieces.push_back({pair.begin + prev_left_count, pair.begin + left_count,
+                        pair.middle + (prev_diagonal - prev_left_count),
+                        pair.middle + (diagonal - left_count),
+                        pair.begin + prev_diagonal});
+      prev_diagonal = diagonal;
+      prev_left_count = left_count;
+    }
+  }
+
+  // Pieces of a single merge read each other's output range, so all of them
+  // must be merged into the temp area before any is copied back.
+  const auto num_pieces = static_cast<int64_t>(pieces.size());
+  RETURN_NOT_OK(ParallelForEach(num_tasks, num_pieces, [&](int task_index, int64_t i) {
+    const auto& piece = pieces[i];
+    std::merge(piece.left_begin, piece.left_end, piece.right_begin, piece.right_end,
+               temp_indices + (piece.out - indices_begin),
+               [&](uint64_t left, uint64_t right) {
+                 return compare(task_index, left, right);
+               });
+  }));
+  return ParallelForEach(num_tasks, num_pieces, [&](int, int64_t i) {
+    const auto& piece = pieces[i];
+    const auto piece_length =
+        (piece.left_end - piece.left_begin) + (piece.right_end - piece.right_begin);
+    const auto temp_begin = temp_indices + (piece.out - indices_begin);
+    std::copy(temp_begin, temp_begin + piece_length, piece.out);
+  });
+}
+
+// Stably sort indices using up to `num_tasks` tasks.
+//
+// Contiguous slices are sorted concurrently, then merged by pairs.
+// See MergeSortedRuns() for the requirements on `compare`.
+template <typename Compare>
+Status ParallelStableSort(MemoryPool* pool, int num_tasks, uint64_t* indices_begin,
+                          uint64_t* indices_end, Compare&& compare) {
+  if (num_tasks <= 1) {
+    std::stable_sort(indices_begin, indices_end, [&](uint64_t left, uint64_t right) {
+      return compare(0, left, right);
+    });
+    return Status::OK();
+  }
+
+  const int64_t length = indices_end - indices_begin;
+  std::vector<uint64_t*> bounds(num_tasks + 1);
+  for (int i = 0; i <= num_tasks; ++i) {
+    bounds[i] = indices_begin + length * i / num_tasks;
+  }
+  RETURN_NOT_OK(ParallelForEach(num_tasks, num_tasks, [&](int task_index, int64_t i) {
+    std::stable_sort(bounds[i], bounds[i + 1], [&](uint64_t left, uint64_t right) {
+      return compare(task_index, left, right);
+    });
+  }));
+
+  ARROW_ASSIGN_OR_RAISE(auto temp_buffer,
+                        AllocateBuffer(sizeof(uint64_t) * length, pool));
+  auto temp_indices = reinterpret_cast<uint64_t*>(temp_buffer->mutable_data());
+  while (bounds.size() > 2) {
+    std::vector<SortedRunPair> pairs;
+    for (size_t i = 0; i + 2 < bounds.size(); i += 2) {
+      pairs.push_back({bounds[i], bounds[i + 1], bounds[i + 2]});
+    }
+    RETURN_NOT_OK(
+        MergeSortedRuns(num_tasks, pairs, indices_begin, temp_indices, compare));
+    std::vector<uint64_t*> merged_bounds;
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (bounds.size() % 2 == 0) {
+      // Odd number of runs: the last one is carried over as is
+      merged_bounds.push_back(bounds.back());
+    }
+    bounds = std::move(merged_bounds);
+  }
+  return Status::OK();
 }
 
 // ----------------------------------------------------------------------
@@ -657,9 +1026,8 @@ class ChunkedArrayCompareSorter {
 
 // Sort a chunked array by sorting each array in the chunked array.
 //
-// TODO: This is a naive implementation. We'll be able to improve
-// performance of this. For example, we'll be able to use threads for
-// sorting each array.
+// When the context allows threads, chunks are sorted concurrently on the
+// CPU thread pool and the sorted chunks are merged with MergeSortedRuns().
 class ChunkedArraySorter : public TypeVisitor {
  public:
   ChunkedArraySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
@@ -696,8 +1064,6 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
     if (can_use_array_sorter_) {
       // Sort each chunk independently and merge to sorted indices.
-      // This is a serial implementation.
-      ArraySorter<Type> sorter;
       struct SortedChunk {
         int64_t begin_offset;
         int64_t end_offset;
@@ -705,55 +1071,81 @@ class ChunkedArraySorter : public TypeVisitor {
       };
       std::vector<SortedChunk> sorted(num_chunks);
 
-      // First sort all individual chunks
       int64_t begin_offset = 0;
-      int64_t end_offset = 0;
       int64_t null_count = 0;
       for (int i = 0; i < num_chunks; ++i) {
-        const auto array = checked_cast<const ArrayType*>(arrays[i]);
-        end_offset += array->length();
-        null_count += array->null_count();
-        uint64_t* nulls_begin =
-            sorter.impl.Sort(indices_begin_ + begin_offset, indices_begin_ + end_offset,
-                             *array, begin_offset, options);
-        sorted[i] = {begin_offset, end_offset, nulls_begin - indices_begin_};
+        const int64_t end_offset = begin_offset + arrays[i]->length();
+        null_count += arrays[i]->null_count();
+        sorted[i] = {begin_offset, end_offset, end_offset};
         begin_offset = end_offset;
       }
-      DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
+      DCHECK_EQ(begin_offset, indices_end_ - indices_begin_);
+      const int num_tasks = GetNumSortTasks(ctx_, indices_end_ - indices_begin_);
+
+      // First sort all individual chunks
+      RETURN_NOT_OK(ParallelForEach(num_tasks, num_chunks, [&](int, int64_t i) {
+        ArraySorter<Type> sorter;
+        auto& chunk = sorted[i];
+        uint64_t* nulls_begin = sorter.impl.Sort(
+            indices_begin_ + chunk.begin_offset, indices_begin_ + chunk.end_offset,
+            checked_cast<const ArrayType&>(*arrays[i]), chunk.begin_offset, options);
+        chunk.nulls_offset = nulls_begin - indices_begin_;
+      }));
 
       std::unique_ptr<Buffer> temp_buffer;
       uint64_t* temp_indices = nullptr;
       if (sorted.size() > 1) {
         ARROW_ASSIGN_OR_RAISE(
-            temp_buffer,
-            AllocateBuffer(sizeof(int64_t) * (indices_end_ - indices_begin_ - null_count),
-                           ctx_->memory_pool()));
+            temp_buffer, AllocateBuffer(sizeof(int64_t) * (indices_end_ - indices_begin_),
+                                        ctx_->memory_pool()));
         temp_indices = reinterpret_cast<uint64_t*>(temp_buffer->mutable_data());
       }
 
+      // ChunkedArrayResolver caches the last resolved chunk, so each task
+      // needs its own resolvers. Each side of a merge also uses its own resolver.
+      std::vector<ChunkedArrayResolver> left_resolvers(num_tasks,
+                                                       ChunkedArrayResolver(arrays));
+      std::vector<ChunkedArrayResolver> right_resolvers(num_tasks,
+                                                        ChunkedArrayResolver(arrays));
+      auto compare = [&](int task_index, uint64_t left, uint64_t right) {
+        const auto chunk_left = left_resolvers[task_index].Resolve<ArrayType>(left);
+        const auto chunk_right = right_resolvers[task_index].Resolve<ArrayType>(right);
+        if (order_ == SortOrder::Ascending) {
+          return chunk_left.Value() < chunk_right.Value();
+        } else {
+          // We don't use 'left > right' here to reduce required operator.
+          // If we use 'right < left' here, '<' is only required.
+          return chunk_right.Value() < chunk_left.Value();
+        }
+      };
+
       // Then merge them by pairs, recursively
       while (sorted.size() > 1) {
-        auto out_it = sorted.begin();
-        auto it = sorted.begin();
-        while (it < sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
+        const auto num_pairs = static_cast<int64_t>(sorted.size() / 2);
+        std::vector<SortedChunk> merged(num_pairs);
+        std::vector<SortedRunPair> non_nulls(num_pairs);
+        RETURN_NOT_OK(ParallelForEach(num_tasks, num_pairs, [&](int, int64_t i) {
+          const auto& left = sorted[2 * i];
+          const auto& right = sorted[2 * i + 1];
           DCHECK_EQ(left.end_offset, right.begin_offset);
           DCHECK_GE(left.nulls_offset, left.begin_offset);
           DCHECK_LE(left.nulls_offset, left.end_offset);
           DCHECK_GE(right.nulls_offset, right.begin_offset);
           DCHECK_LE(right.nulls_offset, right.end_offset);
-          uint64_t* nulls_begin = Merge<ArrayType>(
+          uint64_t* nulls_begin = MoveNullsToEnd<ArrayType>(
               indices_begin_ + left.begin_offset, indices_begin_ + left.end_offset,
               indices_begin_ + right.end_offset, indices_begin_ + left.nulls_offset,
-              indices_begin_ + right.nulls_offset, arrays, null_count, order_,
-              temp_indices);
-          *out_it++ = {left.begin_offset, right.end_offset, nulls_begin - indices_begin_};
+              indices_begin_ + right.nulls_offset, arrays, null_count);
+          merged[i] = {left.begin_offset, right.end_offset, nulls_begin - indices_begin_};
+          non_nulls[i] = {indices_begin_ + left.begin_offset,
+                          indices_begin_ + left.nulls_offset, nulls_begin};
+        }));
+        RETURN_NOT_OK(
+            MergeSortedRuns(num_tasks, non_nulls, indices_begin_, temp_indices, compare));
+        if (sorted.size() % 2 == 1) {
+          merged.push_back(sorted.back());
         }
-        if (it < sorted.end()) {
-          *out_it++ = *it++;
-        }
-        sorted.erase(out_it, sorted.end());
+        sorted = std::move(merged);
       }
       DCHECK_EQ(sorted.size(), 1);
       DCHECK_EQ(sorted[0].begin_offset, 0);
@@ -769,14 +1161,16 @@ class ChunkedArraySorter : public TypeVisitor {
     return Status::OK();
   }
 
-  // Merges two sorted indices arrays and returns where nulls starts.
+  // Prepares two sorted indices arrays for merging and returns where nulls
+  // starts. The left non-nulls then span [indices_begin, left_nulls_begin)
+  // and the right non-nulls span [left_nulls_begin, nulls_begin).
   // Where nulls starts is used when the next merge to detect the
   // sorted indices locations.
   template <typename ArrayType>
-  uint64_t* Merge(uint64_t* indices_begin, uint64_t* indices_middle,
-                  uint64_t* indices_end, uint64_t* left_nulls_begin,
-                  uint64_t* right_nulls_begin, const std::vector<const Array*>& arrays,
-                  int64_t null_count, const SortOrder order, uint64_t* temp_indices) {
+  uint64_t* MoveNullsToEnd(uint64_t* indices_begin, uint64_t* indices_middle,
+                           uint64_t* indices_end, uint64_t* left_nulls_begin,
+                           uint64_t* right_nulls_begin,
+                           const std::vector<const Array*>& arrays, int64_t null_count) {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     //  ^                   ^               ^                    ^
@@ -798,32 +1192,6 @@ class ChunkedArraySorter : public TypeVisitor {
     if (NullTraits<typename ArrayType::TypeClass>::has_null_like_values) {
       PartitionNullsOnly<StablePartitioner>(nulls_begin, indices_end, arrays, null_count);
     }
-
-    // Merge the non-null values into temp area
-    indices_middle = indices_begin + left_num_non_nulls;
-    indices_end = indices_middle + right_num_non_nulls;
-    const ChunkedArrayResolver left_resolver(arrays);
-    const ChunkedArrayResolver right_resolver(arrays);
-    if (order == SortOrder::Ascending) {
-      std::merge(indices_begin, indices_middle, indices_middle, indices_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   return chunk_left.Value() < chunk_right.Value();
-                 });
-    } else {
-      std::merge(indices_begin, indices_middle, indices_middle, indices_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   // We don't use 'left > right' here to reduce required
-                   // operator. If we use 'right < left' here, '<' is only
-                   // required.
-                   return chunk_right.Value() < chunk_left.Value();
-                 });
-    }
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (nulls_begin - indices_begin), indices_begin);
     return nulls_begin;
   }
 
@@ -1188,7 +1556,7 @@ class MultipleKeyComparator {
 
 // Sort a batch using a single sort and multiple-key comparisons.
 class MultipleKeyRecordBatchSorter : public TypeVisitor {
- private:
+ public:
   // Preprocessed sort key.
   struct ResolvedSortKey {
     ResolvedSortKey(const std::shared_ptr<Array>& array, const SortOrder order)
@@ -1212,10 +1580,11 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
 
   using Comparator = MultipleKeyComparator<ResolvedSortKey>;
 
- public:
-  MultipleKeyRecordBatchSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                               const RecordBatch& batch, const SortOptions& options)
-      : indices_begin_(indices_begin),
+  MultipleKeyRecordBatchSorter(ExecContext* ctx, uint64_t* indices_begin,
+                               uint64_t* indices_end, const RecordBatch& batch,
+                               const SortOptions& options)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
         indices_end_(indices_end),
         sort_keys_(ResolveSortKeys(batch, options.sort_keys, &status_)),
         comparator_(sort_keys_) {}
@@ -1235,7 +1604,6 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
 
 #undef VISIT
 
- private:
   static std::vector<ResolvedSortKey> ResolveSortKeys(
       const RecordBatch& batch, const std::vector<SortKey>& sort_keys, Status* status) {
     std::vector<ResolvedSortKey> resolved;
@@ -1250,35 +1618,44 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
     return resolved;
   }
 
+ private:
   template <typename Type>
   Status SortInternal() {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
 
-    auto& comparator = comparator_;
     const auto& first_sort_key = sort_keys_[0];
     const ArrayType& array = checked_cast<const ArrayType&>(first_sort_key.array);
     auto nulls_begin = indices_end_;
     nulls_begin = PartitionNullsInternal<Type>(first_sort_key);
+    RETURN_NOT_OK(comparator_.status());
     // Sort first-key non-nulls
-    std::stable_sort(indices_begin_, nulls_begin, [&](uint64_t left, uint64_t right) {
-      // Both values are never null nor NaN
-      // (otherwise they've been partitioned away above).
-      const auto value_left = array.GetView(left);
-      const auto value_right = array.GetView(right);
-      if (value_left != value_right) {
-        bool compared = value_left < value_right;
-        if (first_sort_key.order == SortOrder::Ascending) {
-          return compared;
-        } else {
-          return !compared;
-        }
-      }
-      // If the left value equals to the right value,
-      // we need to compare the second and following
-      // sort keys.
-      return comparator.Compare(left, right, 1);
-    });
-    return comparator_.status();
+    const int num_tasks = GetNumSortTasks(ctx_, nulls_begin - indices_begin_);
+    // Comparator is stateful, so give each task its own.
+    std::vector<Comparator> comparators(num_tasks, comparator_);
+    RETURN_NOT_OK(ParallelStableSort(
+        ctx_->memory_pool(), num_tasks, indices_begin_, nulls_begin,
+        [&](int task_index, uint64_t left, uint64_t right) {
+          // Both values are never null nor NaN
+          // (otherwise they've been partitioned away above).
+          const auto value_left = array.GetView(left);
+          const auto value_right = array.GetView(right);
+          if (value_left != value_right) {
+            bool compared = value_left < value_right;
+            if (first_sort_key.order == SortOrder::Ascending) {
+              return compared;
+            } else {
+              return !compared;
+            }
+          }
+          // If the left value equals to the right value,
+          // we need to compare the second and following
+          // sort keys.
+          return comparators[task_index].Compare(left, right, 1);
+        }));
+    for (const auto& comparator : comparators) {
+      RETURN_NOT_OK(comparator.status());
+    }
+    return Status::OK();
   }
 
   // Behaves like PatitionNulls() but this supports multiple sort keys.
@@ -1349,6 +1726,7 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
     return nans_and_nulls_begin;
   }
 
+  ExecContext* ctx_;
   uint64_t* indices_begin_;
   uint64_t* indices_end_;
   Status status_;
@@ -1385,7 +1763,7 @@ class TableRadixSorter {
 
 // Sort a table using a single sort and multiple-key comparisons.
 class MultipleKeyTableSorter : public TypeVisitor {
- private:
+ public:
   // TODO instead of resolving chunks for each column independently, we could
   // split the table into RecordBatches and pay the cost of chunked indexing
   // at the first column only.
@@ -1419,10 +1797,10 @@ class MultipleKeyTableSorter : public TypeVisitor {
 
   using Comparator = MultipleKeyComparator<ResolvedSortKey>;
 
- public:
-  MultipleKeyTableSorter(uint64_t* indices_begin, uint64_t* indices_end,
+  MultipleKeyTableSorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
                          const Table& table, const SortOptions& options)
-      : indices_begin_(indices_begin),
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
         indices_end_(indices_end),
         sort_keys_(ResolveSortKeys(table, options.sort_keys, &status_)),
         comparator_(sort_keys_) {}
@@ -1442,7 +1820,6 @@ class MultipleKeyTableSorter : public TypeVisitor {
 
 #undef VISIT
 
- private:
   static std::vector<ResolvedSortKey> ResolveSortKeys(
       const Table& table, const std::vector<SortKey>& sort_keys, Status* status) {
     std::vector<ResolvedSortKey> resolved;
@@ -1458,35 +1835,50 @@ class MultipleKeyTableSorter : public TypeVisitor {
     return resolved;
   }
 
+ private:
   template <typename Type>
   Status SortInternal() {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
 
-    auto& comparator = comparator_;
-    const auto& first_sort_key = sort_keys_[0];
     auto nulls_begin = indices_end_;
-    nulls_begin = PartitionNullsInternal<Type>(first_sort_key);
-    std::stable_sort(indices_begin_, nulls_begin, [&](uint64_t left, uint64_t right) {
-      // Both values are never null nor NaN.
-      auto chunk_left = first_sort_key.GetChunk<ArrayType>(left);
-      auto chunk_right = first_sort_key.GetChunk<ArrayType>(right);
-      auto value_left = chunk_left.Value();
-      auto value_right = chunk_right.Value();
-      if (value_left == value_right) {
-        // If the left value equals to the right value,
-        // we need to compare the second and following
-        // sort keys.
-        return comparator.Compare(left, right, 1);
-      } else {
-        auto compared = value_left < value_right;
-        if (first_sort_key.order == SortOrder::Ascending) {
-          return compared;
-        } else {
-          return !compared;
-        }
-      }
-    });
-    return comparator_.status();
+    nulls_begin = PartitionNullsInternal<Type>(sort_keys_[0]);
+    RETURN_NOT_OK(comparator_.status());
+    const int num_tasks = GetNumSortTasks(ctx_, nulls_begin - indices_begin_);
+    // Both the chunk resolvers and Comparator are stateful, so give each
+    // task its own copies.
+    std::vector<std::vector<ResolvedSortKey>> task_sort_keys(num_tasks, sort_keys_);
+    std::vector<Comparator> comparators;
+    comparators.reserve(num_tasks);
+    for (const auto& sort_keys : task_sort_keys) {
+      comparators.emplace_back(sort_keys);
+    }
+    RETURN_NOT_OK(ParallelStableSort(
+        ctx_->memory_pool(), num_tasks, indices_begin_, nulls_begin,
+        [&](int task_index, uint64_t left, uint64_t right) {
+          const auto& first_sort_key = task_sort_keys[task_index][0];
+          // Both values are never null nor NaN.
+          auto chunk_left = first_sort_key.GetChunk<ArrayType>(left);
+          auto chunk_right = first_sort_key.GetChunk<ArrayType>(right);
+          auto value_left = chunk_left.Value();
+          auto value_right = chunk_right.Value();
+          if (value_left == value_right) {
+            // If the left value equals to the right value,
+            // we need to compare the second and following
+            // sort keys.
+            return comparators[task_index].Compare(left, right, 1);
+          } else {
+            auto compared = value_left < value_right;
+            if (first_sort_key.order == SortOrder::Ascending) {
+              return compared;
+            } else {
+              return !compared;
+            }
+          }
+        }));
+    for (const auto& comparator : comparators) {
+      RETURN_NOT_OK(comparator.status());
+    }
+    return Status::OK();
   }
 
   // Behaves like PatitionNulls() but this supports multiple sort keys.
@@ -1547,6 +1939,7 @@ class MultipleKeyTableSorter : public TypeVisitor {
     return nans_begin;
   }
 
+  ExecContext* ctx_;
   uint64_t* indices_begin_;
   uint64_t* indices_end_;
   Status status_;
@@ -1554,6 +1947,112 @@ class MultipleKeyTableSorter : public TypeVisitor {
   Comparator comparator_;
 };
 
+// ----------------------------------------------------------------------
+// Top-K selection
+
+template <typename Value>
+enable_if_t<std::is_floating_point<Value>::value, bool> IsNaNValue(Value value) {
+  return std::isnan(value);
+}
+
+template <typename Value>
+enable_if_t<!std::is_floating_point<Value>::value, bool> IsNaNValue(const Value&) {
+  return false;
+}
+
+// Select the indices of the first k records in sort order.
+//
+// The input is scanned once while a max-heap holds the k best records
+// seen so far, so only O(k) indices are kept whatever the input length.
+// The first sort key is compared here and the following ones in Comparator.
+template <typename ResolvedSortKey>
+class MultipleKeySelector : public TypeVisitor {
+ public:
+  using Comparator = MultipleKeyComparator<ResolvedSortKey>;
+
+  // indices_end - indices_begin must not be larger than length.
+  MultipleKeySelector(uint64_t* indices_begin, uint64_t* indices_end, int64_t length,
+                      const std::vector<ResolvedSortKey>& sort_keys)
+      : indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        length_(length),
+        sort_keys_(sort_keys),
+        comparator_(sort_keys_) {}
+
+  Status Select() {
+    if (indices_begin_ == indices_end_) {
+      return Status::OK();
+    }
+    return sort_keys_[0].type->Accept(this);
+  }
+
+#define VISIT(TYPE) \
+  Status Visit(const TYPE& type) override { return SelectInternal<TYPE>(); }
+
+  VISIT_PHYSICAL_TYPES(VISIT)
+
+#undef VISIT
+
+ private:
+  template <typename Type>
+  Status SelectInternal() {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+    const auto& first_sort_key = sort_keys_[0];
+    const bool may_have_nulls = first_sort_key.null_count > 0;
+    // Nulls and NaNs are ordered after any other value whatever the
+    // sort order, like in sort_indices.
+    auto less = [&](uint64_t left, uint64_t right) {
+      const auto chunk_left = first_sort_key.template GetChunk<ArrayType>(left);
+      const auto chunk_right = first_sort_key.template GetChunk<ArrayType>(right);
+      if (may_have_nulls) {
+        const bool is_null_left = chunk_left.IsNull();
+        const bool is_null_right = chunk_right.IsNull();
+        if (is_null_left != is_null_right) {
+          return is_null_right;
+        } else if (is_null_left) {
+          return comparator_.Compare(left, right, 1);
+        }
+      }
+      const auto value_left = chunk_left.Value();
+      const auto value_right = chunk_right.Value();
+      const bool is_nan_left = IsNaNValue(value_left);
+      const bool is_nan_right = IsNaNValue(value_right);
+      if (is_nan_left != is_nan_right) {
+        return is_nan_right;
+      } else if (!is_nan_left && value_left != value_right) {
+        if (first_sort_key.order == SortOrder::Ascending) {
+          return value_left < value_right;
+        } else {
+          return value_right < value_left;
+        }
+      }
+      return comparator_.Compare(left, right, 1);
+    };
+
+    // The heap top is the worst of the selected records, which is
+    // replaced whenever a better record is found.
+    std::iota(indices_begin_, indices_end_, 0);
+    std::make_heap(indices_begin_, indices_end_, less);
+    for (int64_t i = indices_end_ - indices_begin_; i < length_; ++i) {
+      const auto index = static_cast<uint64_t>(i);
+      if (less(index, *indices_begin_)) {
+        std::pop_heap(indices_begin_, indices_end_, less);
+        *(indices_end_ - 1) = index;
+        std::push_heap(indices_begin_, indices_end_, less);
+      }
+    }
+    std::sort_heap(indices_begin_, indices_end_, less);
+    return comparator_.status();
+  }
+
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  const int64_t length_;
+  const std::vector<ResolvedSortKey>& sort_keys_;
+  Comparator comparator_;
+};
+
 // ----------------------------------------------------------------------
 // Top-level sort functions
 
@@ -1669,7 +2168,7 @@ class SortIndicesMetaFunction : public MetaFunction {
       RadixRecordBatchSorter sorter(out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
-      MultipleKeyRecordBatchSorter sorter(out_begin, out_end, batch, options);
+      MultipleKeyRecordBatchSorter sorter(ctx, out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     }
     return Datum(out);
@@ -1710,12 +2209,130 @@ class SortIndicesMetaFunction : public MetaFunction {
     //
     // TableRadixSorter sorter;
     // ARROW_RETURN_NOT_OK(sorter.Sort(ctx, out_begin, out_end, table, options));
-    MultipleKeyTableSorter sorter(out_begin, out_end, table, options);
+    MultipleKeyTableSorter sorter(ctx, out_begin, out_end, table, options);
     ARROW_RETURN_NOT_OK(sorter.Sort());
     return Datum(out);
   }
 };
 
+const auto kDefaultSelectKOptions = SelectKOptions::Defaults();
+
+const FunctionDoc select_k_unstable_doc(
+    "Select the indices of the first `k` ordered elements from the input",
+    ("This function selects an array of indices of the first `k` ordered\n"
+     "elements of the input array, chunked array, record batch or table.\n"
+     "The output is sorted according to the given sort keys, but the relative\n"
+     "order of equal elements is unspecified.  Null values are considered\n"
+     "greater than any other value and NaNs greater than any other non-null\n"
+     "value, whatever the sort order; they are therefore only selected if\n"
+     "there are fewer than `k` other values.\n"
+     "\n"
+     "`k` and the sort keys must be given in SelectKOptions."),
+    {"input"}, "SelectKOptions");
+
+class SelectKUnstableMetaFunction : public MetaFunction {
+ public:
+  SelectKUnstableMetaFunction()
+      : MetaFunction("select_k_unstable", Arity::Unary(), &select_k_unstable_doc,
+                     &kDefaultSelectKOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const SelectKOptions& select_k_options = static_cast<const SelectKOptions&>(*options);
+    if (select_k_options.k < 0) {
+      return Status::Invalid("select_k_unstable requires a non-negative `k`, got ",
+                             select_k_options.k);
+    }
+    switch (args[0].kind()) {
+      case Datum::ARRAY:
+        return SelectK(args[0].make_array(), select_k_options, ctx);
+      case Datum::CHUNKED_ARRAY:
+        return SelectK(*args[0].chunked_array(), select_k_options, ctx);
+      case Datum::RECORD_BATCH:
+        return SelectK(*args[0].record_batch(), select_k_options, ctx);
+      case Datum::TABLE:
+        return SelectK(*args[0].table(), select_k_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for select_k_unstable operation: "
+        "values=",
+        args[0].ToString());
+  }
+
+ private:
+  static SortOrder GetFirstOrder(const SelectKOptions& options) {
+    if (options.sort_keys.empty()) {
+      return SortOrder::Ascending;
+    }
+    return options.sort_keys[0].order;
+  }
+
+  template <typename ResolvedSortKey>
+  Result<Datum> Select(int64_t k, int64_t length,
+                       const std::vector<ResolvedSortKey>& sort_keys,
+                       ExecContext* ctx) const {
+    auto out_type = uint64();
+    k = std::min(k, length);
+    auto buffer_size = BitUtil::BytesForBits(
+        k * std::static_pointer_cast<UInt64Type>(out_type)->bit_width());
+    BufferVector buffers(2);
+    ARROW_ASSIGN_OR_RAISE(buffers[1],
+                          AllocateResizableBuffer(buffer_size, ctx->memory_pool()));
+    auto out = std::make_shared<ArrayData>(out_type, k, buffers, 0);
+    auto out_begin = out->GetMutableValues<uint64_t>(1);
+    auto out_end = out_begin + k;
+
+    MultipleKeySelector<ResolvedSortKey> selector(out_begin, out_end, length, sort_keys);
+    RETURN_NOT_OK(selector.Select());
+    return Datum(out);
+  }
+
+  Result<Datum> SelectK(const std::shared_ptr<Array>& values,
+                        const SelectKOptions& options, ExecContext* ctx) const {
+    using ResolvedSortKey = MultipleKeyRecordBatchSorter::ResolvedSortKey;
+    std::vector<ResolvedSortKey> sort_keys;
+    sort_keys.emplace_back(values, GetFirstOrder(options));
+    return Select(options.k, values->length(), sort_keys, ctx);
+  }
+
+  Result<Datum> SelectK(const ChunkedArray& chunked_array, const SelectKOptions& options,
+                        ExecContext* ctx) const {
+    using ResolvedSortKey = MultipleKeyTableSorter::ResolvedSortKey;
+    // ResolvedSortKey holds pointers to its own members, so construct it
+    // in place and never copy it.
+    std::vector<ResolvedSortKey> sort_keys;
+    sort_keys.emplace_back(chunked_array, GetFirstOrder(options));
+    return Select(options.k, chunked_array.length(), sort_keys, ctx);
+  }
+
+  Result<Datum> SelectK(const RecordBatch& batch, const SelectKOptions& options,
+                        ExecContext* ctx) const {
+    if (options.sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    Status status;
+    auto sort_keys =
+        MultipleKeyRecordBatchSorter::ResolveSortKeys(batch, options.sort_keys, &status);
+    RETURN_NOT_OK(status);
+    return Select(options.k, batch.num_rows(), sort_keys, ctx);
+  }
+
+  Result<Datum> SelectK(const Table& table, const SelectKOptions& options,
+                        ExecContext* ctx) const {
+    if (options.sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    Status status;
+    auto sort_keys =
+        MultipleKeyTableSorter::ResolveSortKeys(table, options.sort_keys, &status);
+    RETURN_NOT_OK(status);
+    return Select(options.k, table.num_rows(), sort_keys, ctx);
+  }
+};
+
 const auto kDefaultArraySortOptions = ArraySortOptions::Defaults();
 
 const FunctionDoc array_sort_indices_doc(
@@ -1761,6 +2378,8 @@ void RegisterVectorSort(FunctionRegistry* registry) {
 
   DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
 
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKUnstableMetaFunction>()));
+
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices = std::make_shared<VectorFunction>(
       "partition_nth_indices", Arity::Unary(), &partition_nth_indices_doc);
@@ -91,6 +91,17 @@ static void ChunkedArraySortIndicesInt64Wide(benchmark::State& state) {
   ChunkedArraySortIndicesInt64Benchmark(state, min, max);
 }
 
+static void ArraySortIndicesString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Assume an average value length of 16 bytes plus a 4-byte offset
+  const int64_t array_size = args.size / 20;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 0, 32, args.null_proportion);
+
+  ArraySortIndicesBenchmark(state, values);
+}
+
 static void DatumSortIndicesBenchmark(benchmark::State& state, const Datum& datum,
                                       const SortOptions& options) {
   for (auto _ : state) {
@@ -235,6 +246,12 @@ BENCHMARK(ArraySortIndicesInt64Wide)
     ->Args({1 << 23, 100})
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(ArraySortIndicesString)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 100})
+    ->Args({1 << 23, 100})
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 BENCHMARK(ChunkedArraySortIndicesInt64Narrow)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 100})
@@ -18,12 +18,16 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
+#include <gmock/gmock.h>
+
 #include "arrow/array/array_decimal.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -409,7 +413,7 @@ template <typename ArrowType>
 class TestArraySortIndicesForTemporal : public TestArraySortIndices<ArrowType> {};
 TYPED_TEST_SUITE(TestArraySortIndicesForTemporal, TemporalArrowTypes);
 
-using StringSortTestTypes = testing::Types<StringType, LargeStringType>;
+using StringSortTestTypes = testing::Types<StringType, LargeStringType, StringViewType>;
 
 template <typename ArrowType>
 class TestArraySortIndicesForStrings : public TestArraySortIndices<ArrowType> {};
@@ -623,6 +627,94 @@ TYPED_TEST(TestArraySortIndicesRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Binary-like values sharing long prefixes, some only differing by trailing
+// zero bytes, to go through every refinement step of the prefix radix sort.
+// If width is positive, all values are of that width.
+std::vector<std::string> MakeBinaryLikeValues(int64_t length, int32_t width,
+                                              random::SeedType seed) {
+  std::default_random_engine engine(seed);
+  std::uniform_int_distribution<int> length_dist(0, 24);
+  std::uniform_int_distribution<int> char_dist(0, 3);
+  std::bernoulli_distribution prefix_dist(0.5);
+  const char chars[] = {'\0', 'a', 'b', '\xff'};
+  const std::string common_prefix = "a long common prefix";
+  std::vector<std::string> values;
+  for (int64_t i = 0; i < length; ++i) {
+    std::string value = prefix_dist(engine) ? common_prefix : "";
+    for (int j = length_dist(engine); j > 0; --j) {
+      value += chars[char_dist(engine)];
+    }
+    if (width > 0) {
+      value.resize(width, '\0');
+    }
+    values.push_back(std::move(value));
+  }
+  return values;
+}
+
+template <typename BuilderType>
+void AssertBinaryLikeSortIndices(BuilderType* builder) {
+  const int64_t length = 3000;
+  const int64_t offset = 7;
+  const int32_t width =
+      builder->type()->id() == Type::FIXED_SIZE_BINARY
+          ? checked_cast<const FixedSizeBinaryType&>(*builder->type()).byte_width()
+          : -1;
+  const auto values = MakeBinaryLikeValues(length, width, 0x61549225);
+  std::bernoulli_distribution null_dist(0.1);
+  std::default_random_engine engine(42);
+  std::vector<bool> is_valid;
+  for (const auto& value : values) {
+    is_valid.push_back(!null_dist(engine));
+    if (is_valid.back()) {
+      ASSERT_OK(builder->Append(value));
+    } else {
+      ASSERT_OK(builder->AppendNull());
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto array, builder->Finish());
+  // Exercise a non-zero offset as well
+  array = array->Slice(offset);
+
+  for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    std::vector<uint64_t> expected, nulls;
+    for (int64_t i = 0; i < length - offset; ++i) {
+      (is_valid[i + offset] ? expected : nulls).push_back(i);
+    }
+    std::stable_sort(expected.begin(), expected.end(), [&](uint64_t l, uint64_t r) {
+      const auto& lhs = values[l + offset];
+      const auto& rhs = values[r + offset];
+      return order == SortOrder::Ascending ? lhs < rhs : rhs < lhs;
+    });
+    expected.insert(expected.end(), nulls.begin(), nulls.end());
+    std::shared_ptr<Array> expected_array;
+    ArrayFromVector<UInt64Type>(expected, &expected_array);
+
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(*array, order));
+    AssertArraysEqual(*expected_array, *actual);
+    ChunkedArray chunked_array({array->Slice(0, 1000), array->Slice(1000)});
+    ASSERT_OK_AND_ASSIGN(actual, SortIndices(chunked_array, order));
+    AssertArraysEqual(*expected_array, *actual);
+  }
+}
+
+template <typename ArrowType>
+class TestArraySortIndicesBinaryLike : public TestBase {};
+
+using BinaryLikeSortTestTypes =
+    testing::Types<BinaryType, LargeBinaryType, StringType, LargeStringType>;
+TYPED_TEST_SUITE(TestArraySortIndicesBinaryLike, BinaryLikeSortTestTypes);
+
+TYPED_TEST(TestArraySortIndicesBinaryLike, CommonPrefixes) {
+  typename TypeTraits<TypeParam>::BuilderType builder;
+  AssertBinaryLikeSortIndices(&builder);
+}
+
+TEST(TestArraySortIndicesFixedSizeBinary, CommonPrefixes) {
+  FixedSizeBinaryBuilder builder(fixed_size_binary(30));
+  AssertBinaryLikeSortIndices(&builder);
+}
+
 // Test basic cases for chunked array.
 class TestChunkedArraySortIndices : public ::testing::Test {};
 
@@ -710,6 +802,32 @@ class TestChunkedArrayRandomBase : public TestBase {
       }
     }
   }
+
+  // Sorting is stable, so sorting with threads must give the same
+  // indices as sorting without.
+  void TestSortIndicesParallel(int length) {
+    ScopedCpuThreadPoolCapacity capacity;
+    ExecContext serial_ctx;
+    serial_ctx.set_use_threads(false);
+    ExecContext parallel_ctx;
+    parallel_ctx.set_use_threads(true);
+    for (auto null_probability : {0.0, 0.1, 1.0}) {
+      for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+        for (auto num_chunks : {1, 3, 40}) {
+          std::vector<std::shared_ptr<Array>> arrays;
+          for (int i = 0; i < num_chunks; ++i) {
+            arrays.push_back(this->GenerateArray(length / num_chunks, null_probability));
+          }
+          ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(arrays));
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               SortIndices(*chunked_array, order, &serial_ctx));
+          ASSERT_OK_AND_ASSIGN(auto actual,
+                               SortIndices(*chunked_array, order, &parallel_ctx));
+          AssertArraysEqual(*expected, *actual);
+        }
+      }
+    }
+  }
 };
 
 // Long array with big value range: std::stable_sort
@@ -732,6 +850,10 @@ TYPED_TEST_SUITE(TestChunkedArrayRandom, SortIndicesableTypes);
 
 TYPED_TEST(TestChunkedArrayRandom, SortIndices) { this->TestSortIndices(1000); }
 
+TYPED_TEST(TestChunkedArrayRandom, SortIndicesParallel) {
+  this->TestSortIndicesParallel(1 << 14);
+}
+
 // Long array with small value range: counting sort
 // - length >= 1024(CountCompareSorter::countsort_min_len_)
 // - range  <= 4096(CountCompareSorter::countsort_max_range_)
@@ -756,6 +878,9 @@ class TestChunkedArrayRandomNarrow : public TestChunkedArrayRandomBase<Type> {
 };
 TYPED_TEST_SUITE(TestChunkedArrayRandomNarrow, IntegralArrowTypes);
 TYPED_TEST(TestChunkedArrayRandomNarrow, SortIndices) { this->TestSortIndices(1000); }
+TYPED_TEST(TestChunkedArrayRandomNarrow, SortIndicesParallel) {
+  this->TestSortIndicesParallel(1 << 14);
+}
 
 // Test basic cases for record batch.
 class TestRecordBatchSortIndices : public ::testing::Test {};
@@ -1246,6 +1371,55 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
   Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
 }
 
+TEST(TestTableSortIndicesParallel, MatchesSerial) {
+  ScopedCpuThreadPoolCapacity capacity;
+
+  const auto seed = 0x61549225;
+  const auto length = 1 << 15;
+  const FieldVector fields = {
+      {field("int32", int32())}, {field("double", float64())}, {field("string", utf8())}};
+  // Use a narrow range for the first sort key, so that the following keys
+  // break many ties.
+  ArrayVector columns = {
+      RandomRange<Int32Type>(seed).Generate(length, 100, 0.1),
+      Random<DoubleType>(seed).Generate(length, 0.1, 0.1),
+      Random<StringType>(seed).Generate(length, 0.1),
+  };
+  const auto table = Table::Make(schema(fields), columns, length);
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+
+  // RecordBatch sorting only uses multiple-key comparisons above 8 sort keys
+  std::vector<SortKey> sort_keys;
+  for (int i = 0; i < 9; ++i) {
+    const auto order = (i % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+    sort_keys.emplace_back(fields[i % fields.size()]->name(), order);
+  }
+  for (const auto n_sort_keys : {2, 9}) {
+    SortOptions options(std::vector<SortKey>(sort_keys.begin(),
+                                             sort_keys.begin() + n_sort_keys));
+    for (const int64_t num_chunks : {1, 7}) {
+      TableBatchReader reader(*table);
+      reader.set_chunksize((length + num_chunks - 1) / num_chunks);
+      ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           SortIndices(Datum(*chunked_table), options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           SortIndices(Datum(*chunked_table), options, &parallel_ctx));
+      AssertArraysEqual(*expected, *actual);
+    }
+
+    const auto batch = RecordBatch::Make(schema(fields), length, columns);
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         SortIndices(Datum(*batch), options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(*batch), options, &parallel_ctx));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 static const auto first_sort_keys =
     testing::Values("uint8", "uint16", "uint32", "uint64", "int8", "int16", "int32",
                     "int64", "float", "double", "string", "decimal128");
@@ -1259,5 +1433,169 @@ INSTANTIATE_TEST_SUITE_P(MayNull, TestTableSortIndicesRandom,
 INSTANTIATE_TEST_SUITE_P(AllNull, TestTableSortIndicesRandom,
                          testing::Combine(first_sort_keys, testing::Values(1.0)));
 
+
+// ----------------------------------------------------------------------
+// Tests for SelectKUnstable
+
+template <typename T>
+void AssertSelectKUnstable(const std::shared_ptr<T>& input,
+                           const SelectKOptions& options, const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SelectKUnstable(Datum(*input), options));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual, /*verbose=*/true);
+}
+
+TEST(TestSelectKUnstable, Array) {
+  auto array = ArrayFromJSON(float64(), "[null, 1, 3.3, null, 2, 5.3]");
+  AssertSelectKUnstable(array, SelectKOptions::TopKDefault(2), "[5, 2]");
+  AssertSelectKUnstable(array, SelectKOptions::BottomKDefault(3), "[1, 4, 2]");
+  AssertSelectKUnstable(array, SelectKOptions::TopKDefault(0), "[]");
+
+  // Nulls and NaNs are selected last whatever the order
+  array = ArrayFromJSON(float32(), "[NaN, 1, null, 3]");
+  AssertSelectKUnstable(array, SelectKOptions::BottomKDefault(4), "[1, 3, 0, 2]");
+  AssertSelectKUnstable(array, SelectKOptions::TopKDefault(4), "[3, 1, 0, 2]");
+  AssertSelectKUnstable(array, SelectKOptions::TopKDefault(10), "[3, 1, 0, 2]");
+
+  array = ArrayFromJSON(utf8(), R"(["b", null, "a", "d", "c"])");
+  AssertSelectKUnstable(array, SelectKOptions::TopKDefault(3), "[3, 4, 0]");
+  AssertSelectKUnstable(array, SelectKOptions::BottomKDefault(3), "[2, 0, 4]");
+
+  AssertSelectKUnstable(ArrayFromJSON(int32(), "[]"), SelectKOptions::TopKDefault(2),
+                        "[]");
+}
+
+TEST(TestSelectKUnstable, InvalidOptions) {
+  auto array = ArrayFromJSON(int32(), "[1, 2, 3]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("non-negative `k`"),
+      SelectKUnstable(Datum(*array), SelectKOptions::TopKDefault(-1)));
+
+  auto batch = RecordBatchFromJSON(::arrow::schema({field("a", int32())}),
+                                   R"([{"a": 1}, {"a": 2}])");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                  ::testing::HasSubstr("one or more sort keys"),
+                                  SelectKUnstable(Datum(*batch), SelectKOptions(1)));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Nonexistent sort key column"),
+      SelectKUnstable(Datum(*batch), SelectKOptions::TopKDefault(1, {"b"})));
+}
+
+TEST(TestSelectKUnstable, ChunkedArray) {
+  auto chunked_array = ChunkedArrayFromJSON(int32(), {"[1, null, 5]", "[]", "[3, 2]"});
+  AssertSelectKUnstable(chunked_array, SelectKOptions::TopKDefault(3), "[2, 3, 4]");
+  AssertSelectKUnstable(chunked_array, SelectKOptions::BottomKDefault(5),
+                        "[0, 4, 3, 2, 1]");
+}
+
+TEST(TestSelectKUnstable, RecordBatch) {
+  auto schema = ::arrow::schema({
+      {field("a", uint8())},
+      {field("b", uint32())},
+  });
+  SelectKOptions options(
+      4, {SortKey("a", SortOrder::Ascending), SortKey("b", SortOrder::Descending)});
+
+  auto batch = RecordBatchFromJSON(schema,
+                                   R"([{"a": null, "b": 5},
+                                       {"a": 1,    "b": 3},
+                                       {"a": 3,    "b": null},
+                                       {"a": null, "b": null},
+                                       {"a": 2,    "b": 5},
+                                       {"a": 1,    "b": 5}
+                                       ])");
+  AssertSelectKUnstable(batch, options, "[5, 1, 4, 2]");
+  options.k = 6;
+  AssertSelectKUnstable(batch, options, "[5, 1, 4, 2, 0, 3]");
+}
+
+TEST(TestSelectKUnstable, Table) {
+  auto schema = ::arrow::schema({
+      {field("a", float32())},
+      {field("b", float64())},
+  });
+  SelectKOptions options(
+      5, {SortKey("a", SortOrder::Descending), SortKey("b", SortOrder::Ascending)});
+
+  auto table = TableFromJSON(schema, {R"([{"a": 3,    "b": 5},
+                                          {"a": 1,    "b": NaN},
+                                          {"a": 3,    "b": 4}
+                                         ])",
+                                      R"([{"a": 0,    "b": 6},
+                                          {"a": NaN,  "b": 5},
+                                          {"a": null, "b": 5},
+                                          {"a": 1,    "b": 5}
+                                         ])"});
+  AssertSelectKUnstable(table, options, "[2, 0, 6, 1, 3]");
+  options.k = 7;
+  AssertSelectKUnstable(table, options, "[2, 0, 6, 1, 3, 4, 5]");
+}
+
+// Ties are broken arbitrarily, so compare the selected values with the
+// values of the first k sorted indices.
+template <typename Type>
+class TestSelectKUnstableRandom : public TestBase {};
+
+TYPED_TEST_SUITE(TestSelectKUnstableRandom, SortIndicesableTypes);
+
+TYPED_TEST(TestSelectKUnstableRandom, RandomValues) {
+  Random<TypeParam> rand(0x61549225);
+  const int length = 500;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+      for (auto num_chunks : {1, 5}) {
+        ArrayVector arrays;
+        for (int i = 0; i < num_chunks; ++i) {
+          arrays.push_back(rand.Generate(length / num_chunks, null_probability));
+        }
+        ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(arrays));
+        ASSERT_OK_AND_ASSIGN(auto values, Concatenate(arrays));
+        ASSERT_OK_AND_ASSIGN(auto sorted, SortIndices(*values, order));
+        for (int64_t k : {0, 1, 17, length - 1, length, length + 10}) {
+          SelectKOptions options(k, {SortKey("not-used", order)});
+          auto expected_indices = sorted->Slice(0, std::min<int64_t>(k, length));
+          ASSERT_OK_AND_ASSIGN(auto expected, Take(*values, *expected_indices));
+          for (const auto& datum : {Datum(values), Datum(chunked_array)}) {
+            ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(datum, options));
+            ASSERT_OK_AND_ASSIGN(auto actual, Take(*values, *indices));
+            AssertArraysEqual(*expected, *actual);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(TestSelectKUnstableRandom, Table) {
+  const auto seed = 0x61549225;
+  const auto length = 2000;
+  const FieldVector fields = {
+      {field("int32", int32())}, {field("double", float64())}, {field("string", utf8())}};
+  ArrayVector columns = {
+      RandomRange<Int32Type>(seed).Generate(length, 20, 0.1),
+      Random<DoubleType>(seed).Generate(length, 0.1),
+      Random<StringType>(seed).Generate(length, 0.1),
+  };
+  const auto batch = RecordBatch::Make(schema(fields), length, columns);
+  const auto single_chunk_table = Table::Make(schema(fields), columns, length);
+  TableBatchReader reader(*single_chunk_table);
+  reader.set_chunksize(300);
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatchReader(&reader));
+
+  std::vector<SortKey> sort_keys = {SortKey("int32", SortOrder::Descending),
+                                    SortKey("string", SortOrder::Ascending),
+                                    SortKey("double", SortOrder::Descending)};
+  for (int64_t k : {1, 100, length}) {
+    SelectKOptions options(k, sort_keys);
+    ASSERT_OK_AND_ASSIGN(auto sorted, SortIndices(Datum(*batch), SortOptions(sort_keys)));
+    ASSERT_OK_AND_ASSIGN(auto expected, Take(*batch, *sorted->Slice(0, k)));
+    for (const auto& datum : {Datum(batch), Datum(table)}) {
+      ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(datum, options));
+      ASSERT_OK_AND_ASSIGN(auto actual, Take(*batch, *indices));
+      AssertBatchesEqual(*expected, *actual);
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -128,12 +128,16 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
 
   // Vector functions
   RegisterVectorHash(registry.get());
+  RegisterVectorHashPartition(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorNested(registry.get());
+  RegisterVectorRunEnd(registry.get());
+  RegisterVectorCumulative(registry.get());
   RegisterVectorSort(registry.get());
 
   // Aggregate functions
   RegisterScalarAggregateBasic(registry.get());
+  RegisterScalarAggregateApproxCountDistinct(registry.get());
   RegisterScalarAggregateMode(registry.get());
   RegisterScalarAggregateQuantile(registry.get());
   RegisterScalarAggregateTDigest(registry.get());
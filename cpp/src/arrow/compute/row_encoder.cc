@@ -0,0 +1,531 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/row_encoder.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/exec.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_writer.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::FirstTimeBitmapWriter;
+
+namespace compute {
+namespace internal {
+
+// Encodes and decodes the values of a single column, for all rows at once
+struct KeyEncoder {
+  static constexpr uint8_t kNullByte = RowEncoder::kNullByte;
+  static constexpr uint8_t kValidByte = RowEncoder::kValidByte;
+
+  virtual ~KeyEncoder() = default;
+
+  // The encoded length of every value, or -1 if values are of variable length
+  virtual int32_t fixed_length() const = 0;
+
+  // Add the encoded length of each value to `lengths`
+  virtual void AddLength(const ArrayData&, int32_t* lengths) = 0;
+
+  // Encode each value at the corresponding pointer, advancing the pointers
+  virtual Status Encode(const ArrayData&, uint8_t** encoded_bytes) = 0;
+
+  // Decode a value from each pointer, advancing the pointers
+  virtual Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes,
+                                                    int32_t length, MemoryPool*) = 0;
+
+  // extract the null bitmap from the leading nullity bytes of encoded keys
+  static Status DecodeNulls(MemoryPool* pool, int32_t length, uint8_t** encoded_bytes,
+                            std::shared_ptr<Buffer>* null_bitmap, int32_t* null_count) {
+    // first count nulls to determine if a null bitmap is necessary
+    *null_count = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      *null_count += (encoded_bytes[i][0] == kNullByte);
+    }
+
+    if (*null_count > 0) {
+      ARROW_ASSIGN_OR_RAISE(*null_bitmap, AllocateBitmap(length, pool));
+      uint8_t* validity = (*null_bitmap)->mutable_data();
+
+      FirstTimeBitmapWriter writer(validity, 0, length);
+      for (int32_t i = 0; i < length; ++i) {
+        if (encoded_bytes[i][0] == kValidByte) {
+          writer.Set();
+        } else {
+          writer.Clear();
+        }
+        writer.Next();
+        encoded_bytes[i] += 1;
+      }
+      writer.Finish();
+    } else {
+      for (int32_t i = 0; i < length; ++i) {
+        encoded_bytes[i] += 1;
+      }
+    }
+    return Status::OK();
+  }
+};
+
+namespace {
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1;
+
+  int32_t fixed_length() const override { return 1 + kByteWidth; }
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + kByteWidth;
+    }
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    VisitArrayDataInline<BooleanType>(
+        data,
+        [&](bool value) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          *encoded_ptr++ = value;
+        },
+        [&] {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          *encoded_ptr++ = 0;
+        });
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
+                                            MemoryPool* pool) override {
+    std::shared_ptr<Buffer> null_buf;
+    int32_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      BitUtil::SetBitTo(raw_output, i, encoded_ptr[0] != 0);
+      encoded_ptr += 1;
+    }
+
+    return ArrayData::Make(boolean(), length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  int32_t fixed_length() const override { return 1 + byte_width_; }
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + byte_width_;
+    }
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    if (data.GetNullCount() == 0) {
+      // Fast path: a copy loop specialized for common byte widths
+      const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width_;
+      switch (byte_width_) {
+        case 1:
+          return EncodeAllValid<1>(values, data.length, encoded_bytes);
+        case 2:
+          return EncodeAllValid<2>(values, data.length, encoded_bytes);
+        case 4:
+          return EncodeAllValid<4>(values, data.length, encoded_bytes);
+        case 8:
+          return EncodeAllValid<8>(values, data.length, encoded_bytes);
+        case 16:
+          return EncodeAllValid<16>(values, data.length, encoded_bytes);
+        default:
+          break;
+      }
+    }
+
+    ArrayData viewed(fixed_size_binary(byte_width_), data.length, data.buffers,
+                     data.null_count, data.offset);
+
+    VisitArrayDataInline<FixedSizeBinaryType>(
+        viewed,
+        [&](util::string_view bytes) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          memcpy(encoded_ptr, bytes.data(), byte_width_);
+          encoded_ptr += byte_width_;
+        },
+        [&] {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          memset(encoded_ptr, 0, byte_width_);
+          encoded_ptr += byte_width_;
+        });
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
+                                            MemoryPool* pool) override {
+    std::shared_ptr<Buffer> null_buf;
+    int32_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+
+    uint8_t* raw_output = key_buf->mutable_data();
+    switch (byte_width_) {
+      case 1:
+        DecodeValues<1>(encoded_bytes, length, raw_output);
+        break;
+      case 2:
+        DecodeValues<2>(encoded_bytes, length, raw_output);
+        break;
+      case 4:
+        DecodeValues<4>(encoded_bytes, length, raw_output);
+        break;
+      case 8:
+        DecodeValues<8>(encoded_bytes, length, raw_output);
+        break;
+      case 16:
+        DecodeValues<16>(encoded_bytes, length, raw_output);
+        break;
+      default:
+        for (int32_t i = 0; i < length; ++i) {
+          auto& encoded_ptr = encoded_bytes[i];
+          std::memcpy(raw_output, encoded_ptr, byte_width_);
+          encoded_ptr += byte_width_;
+          raw_output += byte_width_;
+        }
+        break;
+    }
+
+    return ArrayData::Make(type_, length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+
+  // With a compile-time width, the memcpy calls below compile to plain loads
+  // and stores
+  template <int kWidth>
+  static Status EncodeAllValid(const uint8_t* values, int64_t length,
+                               uint8_t** encoded_bytes) {
+    for (int64_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      *encoded_ptr++ = kValidByte;
+      std::memcpy(encoded_ptr, values + i * kWidth, kWidth);
+      encoded_ptr += kWidth;
+    }
+    return Status::OK();
+  }
+
+  template <int kWidth>
+  static void DecodeValues(uint8_t** encoded_bytes, int32_t length, uint8_t* out) {
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      std::memcpy(out + i * kWidth, encoded_ptr, kWidth);
+      encoded_ptr += kWidth;
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+struct DictionaryKeyEncoder : FixedWidthKeyEncoder {
+  DictionaryKeyEncoder(std::shared_ptr<DataType> type, MemoryPool* pool)
+      : FixedWidthKeyEncoder(std::move(type)), pool_(pool) {}
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    auto dict = MakeArray(data.dictionary);
+    if (dictionary_) {
+      if (!dictionary_->Equals(dict)) {
+        // TODO(bkietz) unify if necessary. For now, just error if any batch's dictionary
+        // differs from the first we saw for this key
+        return Status::NotImplemented("Unifying differing dictionaries");
+      }
+    } else {
+      dictionary_ = std::move(dict);
+    }
+    return FixedWidthKeyEncoder::Encode(data, encoded_bytes);
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
+                                            MemoryPool* pool) override {
+    ARROW_ASSIGN_OR_RAISE(auto data,
+                          FixedWidthKeyEncoder::Decode(encoded_bytes, length, pool));
+
+    if (dictionary_) {
+      data->dictionary = dictionary_->data();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto dict, MakeArrayOfNull(type_, 0));
+      data->dictionary = dict->data();
+    }
+
+    data->type = type_;
+    return data;
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<Array> dictionary_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  int32_t fixed_length() const override { return -1; }
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    int64_t i = 0;
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          lengths[i++] += 1 + sizeof(Offset) + static_cast<int32_t>(bytes.size());
+        },
+        [&] { lengths[i++] += 1 + sizeof(Offset); });
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(bytes.size()));
+          encoded_ptr += sizeof(Offset);
+          memcpy(encoded_ptr, bytes.data(), bytes.size());
+          encoded_ptr += bytes.size();
+        },
+        [&] {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(0));
+          encoded_ptr += sizeof(Offset);
+        });
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(uint8_t** encoded_bytes, int32_t length,
+                                            MemoryPool* pool) override {
+    std::shared_ptr<Buffer> null_buf;
+    int32_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    Offset length_sum = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      length_sum += util::SafeLoadAs<Offset>(encoded_bytes[i]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
+                          AllocateBuffer(sizeof(Offset) * (1 + length), pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length_sum, pool));
+
+    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+    auto raw_keys = key_buf->mutable_data();
+
+    Offset current_offset = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      raw_offsets[i] = current_offset;
+
+      auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
+      encoded_bytes[i] += sizeof(Offset);
+
+      memcpy(raw_keys + current_offset, encoded_bytes[i], key_length);
+      encoded_bytes[i] += key_length;
+
+      current_offset += key_length;
+    }
+    raw_offsets[length] = current_offset;
+
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
+        null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+Result<std::shared_ptr<KeyEncoder>> MakeKeyEncoder(const std::shared_ptr<DataType>& type,
+                                                   ExecContext* ctx) {
+  if (type->id() == Type::BOOL) {
+    return std::make_shared<BooleanKeyEncoder>();
+  }
+  if (type->id() == Type::DICTIONARY) {
+    return std::make_shared<DictionaryKeyEncoder>(type, ctx->memory_pool());
+  }
+  if (is_fixed_width(type->id())) {
+    return std::make_shared<FixedWidthKeyEncoder>(type);
+  }
+  if (is_binary_like(type->id())) {
+    return std::make_shared<VarLengthKeyEncoder<BinaryType>>(type);
+  }
+  if (is_large_binary_like(type->id())) {
+    return std::make_shared<VarLengthKeyEncoder<LargeBinaryType>>(type);
+  }
+  return Status::NotImplemented("Keys of type ", *type);
+}
+
+}  // namespace
+}  // namespace internal
+
+constexpr uint8_t RowEncoder::kValidByte;
+constexpr uint8_t RowEncoder::kNullByte;
+
+RowEncoder::RowEncoder() = default;
+
+RowEncoder::~RowEncoder() = default;
+
+Status RowEncoder::Init(const std::vector<ValueDescr>& column_types, ExecContext* ctx) {
+  ctx_ = ctx;
+  encoders_.clear();
+  row_length_ = 0;
+  for (const auto& descr : column_types) {
+    ARROW_ASSIGN_OR_RAISE(auto encoder, internal::MakeKeyEncoder(descr.type, ctx));
+    const int32_t length = encoder->fixed_length();
+    row_length_ = (length < 0 || row_length_ < 0) ? -1 : row_length_ + length;
+    encoders_.push_back(std::move(encoder));
+  }
+  Clear();
+  return Status::OK();
+}
+
+void RowEncoder::Clear() {
+  num_rows_ = 0;
+  offsets_.assign(1, 0);
+  bytes_.clear();
+}
+
+RowEncoder RowEncoder::CloneEmpty() const {
+  RowEncoder clone;
+  clone.ctx_ = ctx_;
+  clone.encoders_ = encoders_;
+  clone.row_length_ = row_length_;
+  clone.Clear();
+  return clone;
+}
+
+Status RowEncoder::EncodeAndAppend(const ExecBatch& batch) {
+  if (batch.num_values() != static_cast<int>(encoders_.size())) {
+    return Status::Invalid("Expected batch of ", encoders_.size(), " columns, got ",
+                           batch.num_values());
+  }
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  std::vector<std::shared_ptr<ArrayData>> columns(encoders_.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const Datum& value = batch.values[i];
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto array, MakeArrayFromScalar(*value.scalar(), batch.length,
+                                          ctx_->memory_pool()));
+      columns[i] = array->data();
+    } else {
+      columns[i] = value.array();
+    }
+  }
+
+  const int64_t length = batch.length;
+  const int64_t start = static_cast<int64_t>(bytes_.size());
+  std::vector<uint8_t*> row_ptrs(static_cast<size_t>(length));
+
+  if (is_fixed_length()) {
+    const int64_t total = start + length * row_length_;
+    if (total > std::numeric_limits<int32_t>::max() ||
+        num_rows_ + length > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Encoded rows would exceed 2GB");
+    }
+    bytes_.resize(static_cast<size_t>(total));
+    for (int64_t i = 0; i < length; ++i) {
+      row_ptrs[i] = bytes_.data() + start + i * row_length_;
+    }
+  } else {
+    // Compute the row lengths first, then lay out the rows
+    std::vector<int32_t> lengths(static_cast<size_t>(length), 0);
+    for (size_t i = 0; i < columns.size(); ++i) {
+      encoders_[i]->AddLength(*columns[i], lengths.data());
+    }
+    int64_t total = start;
+    for (int64_t i = 0; i < length; ++i) {
+      total += lengths[i];
+    }
+    if (total > std::numeric_limits<int32_t>::max() ||
+        num_rows_ + length > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Encoded rows would exceed 2GB");
+    }
+    bytes_.resize(static_cast<size_t>(total));
+    offsets_.resize(static_cast<size_t>(num_rows_ + length + 1));
+    int32_t offset = static_cast<int32_t>(start);
+    for (int64_t i = 0; i < length; ++i) {
+      row_ptrs[i] = bytes_.data() + offset;
+      offset += lengths[i];
+      offsets_[num_rows_ + i + 1] = offset;
+    }
+  }
+
+  for (size_t i = 0; i < columns.size(); ++i) {
+    RETURN_NOT_OK(encoders_[i]->Encode(*columns[i], row_ptrs.data()));
+  }
+  num_rows_ += static_cast<int32_t>(length);
+  return Status::OK();
+}
+
+Result<ExecBatch> RowEncoder::Decode(int64_t num_rows, const int32_t* row_ids) {
+  std::vector<uint8_t*> row_ptrs(static_cast<size_t>(num_rows));
+  for (int64_t i = 0; i < num_rows; ++i) {
+    DCHECK_LT(row_ids[i], num_rows_);
+    row_ptrs[i] = bytes_.data() + row_offset(row_ids[i]);
+  }
+  return DecodeRows(num_rows, row_ptrs.data());
+}
+
+Result<ExecBatch> RowEncoder::DecodeRows(int64_t num_rows, uint8_t** encoded_rows) {
+  ExecBatch out({}, num_rows);
+  out.values.resize(encoders_.size());
+  for (size_t i = 0; i < encoders_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        out.values[i], encoders_[i]->Decode(encoded_rows, static_cast<int32_t>(num_rows),
+                                            ctx_->memory_pool()));
+  }
+  return out;
+}
+
+}  // namespace compute
+}  // namespace arrow
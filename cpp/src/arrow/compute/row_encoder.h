@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// NOTE: API is EXPERIMENTAL and will change without going through a
+// deprecation cycle
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+namespace internal {
+
+struct KeyEncoder;
+
+}  // namespace internal
+
+/// \brief Conversion between columnar batches and row-major byte strings
+///
+/// Each encoded row is the concatenation of its encoded values, in column
+/// order.  An encoded value is a byte indicating nullity, followed by:
+/// - for boolean, a single byte;
+/// - for other fixed width types (including dictionary indices), the value bytes;
+/// - for binary-like types, the length of the value then its bytes.
+///
+/// Null values are encoded with zeroed value bytes, so that two rows are equal
+/// if and only if their encodings are equal.  Encoded rows can therefore be
+/// used as hashing or grouping keys, or stored as opaque byte strings.
+///
+/// If all columns are fixed width, every row has the same length and rows are
+/// laid out back to back (fixed-length layout).  Otherwise rows are delimited
+/// by offsets (variable-length layout).
+///
+/// Encoding and decoding proceed one column at a time over all rows.
+class ARROW_EXPORT RowEncoder {
+ public:
+  static constexpr uint8_t kValidByte = 0;
+  static constexpr uint8_t kNullByte = 1;
+
+  RowEncoder();
+  ~RowEncoder();
+
+  /// \brief Prepare the encoder for batches of the given column types
+  ///
+  /// Supported types are boolean, fixed width types, dictionary types, and
+  /// (large) binary and string types.  Any rows already encoded are cleared.
+  Status Init(const std::vector<ValueDescr>& column_types, ExecContext* ctx);
+
+  /// \brief Encode the rows of a batch, appending them to the encoded rows
+  Status EncodeAndAppend(const ExecBatch& batch);
+
+  /// \brief Decode the encoded rows with the given indices into a batch
+  Result<ExecBatch> Decode(int64_t num_rows, const int32_t* row_ids);
+
+  /// \brief Decode rows from pointers to their encodings
+  ///
+  /// The rows need not have been encoded by this encoder, but must have been
+  /// encoded for the same column types (and dictionaries).  Each pointer is
+  /// advanced past the decoded row.
+  Result<ExecBatch> DecodeRows(int64_t num_rows, uint8_t** encoded_rows);
+
+  /// \brief Discard all encoded rows
+  void Clear();
+
+  /// \brief A new encoder for the same column types, without any encoded rows
+  ///
+  /// Per-column state, such as the dictionary of a dictionary column, is shared
+  /// with this encoder.
+  RowEncoder CloneEmpty() const;
+
+  /// \brief The number of encoded rows
+  int32_t num_rows() const { return num_rows_; }
+
+  /// \brief The encoding of the i-th row
+  util::string_view encoded_row(int32_t i) const {
+    const int32_t begin = row_offset(i);
+    const int32_t end = row_offset(i + 1);
+    return util::string_view(reinterpret_cast<const char*>(bytes_.data()) + begin,
+                             end - begin);
+  }
+
+  /// \brief Whether all rows have the same encoded length
+  bool is_fixed_length() const { return row_length_ >= 0; }
+
+  /// \brief The encoded length of all rows, or -1 if rows are of variable length
+  int32_t row_length() const { return row_length_; }
+
+ private:
+  int32_t row_offset(int32_t i) const {
+    return is_fixed_length() ? i * row_length_ : offsets_[i];
+  }
+
+  ExecContext* ctx_ = NULLPTR;
+  std::vector<std::shared_ptr<internal::KeyEncoder>> encoders_;
+  // Row length if all encoders are fixed length, -1 otherwise
+  int32_t row_length_ = -1;
+  int32_t num_rows_ = 0;
+  // Row offsets into bytes_, only used for the variable-length layout
+  std::vector<int32_t> offsets_;
+  std::vector<uint8_t> bytes_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/row_encoder.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestRowEncoder : public ::testing::Test {
+ protected:
+  void Init(const std::vector<std::shared_ptr<DataType>>& types) {
+    std::vector<ValueDescr> descrs;
+    for (const auto& type : types) {
+      descrs.emplace_back(type);
+    }
+    ASSERT_OK(encoder_.Init(descrs, &ctx_));
+  }
+
+  // Encode the batch, then decode all rows and compare with the batch
+  void CheckRoundtrip(const ExecBatch& batch) {
+    encoder_.Clear();
+    ASSERT_OK(encoder_.EncodeAndAppend(batch));
+    ASSERT_EQ(encoder_.num_rows(), batch.length);
+
+    std::vector<int32_t> row_ids(batch.length);
+    for (int32_t i = 0; i < encoder_.num_rows(); ++i) {
+      row_ids[i] = i;
+    }
+    ASSERT_OK_AND_ASSIGN(auto decoded, encoder_.Decode(batch.length, row_ids.data()));
+    ASSERT_EQ(decoded.num_values(), batch.num_values());
+    for (int i = 0; i < batch.num_values(); ++i) {
+      ASSERT_OK(decoded[i].make_array()->ValidateFull());
+      AssertArraysEqual(*batch[i].make_array(), *decoded[i].make_array(),
+                        /*verbose=*/true);
+    }
+  }
+
+  ExecContext ctx_;
+  RowEncoder encoder_;
+};
+
+TEST_F(TestRowEncoder, FixedLengthLayout) {
+  Init({int32(), boolean(), fixed_size_binary(3)});
+  ASSERT_TRUE(encoder_.is_fixed_length());
+  ASSERT_EQ(encoder_.row_length(), 5 + 2 + 4);
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, null, 3, 1, 1]"),
+                   ArrayFromJSON(boolean(), "[true, false, null, true, true]"),
+                   ArrayFromJSON(fixed_size_binary(3),
+                                 R"(["abc", "def", "ghi", "abc", null])")},
+                  5);
+  CheckRoundtrip(batch);
+
+  // Equal rows have equal encodings
+  ASSERT_EQ(encoder_.encoded_row(0), encoder_.encoded_row(3));
+  ASSERT_NE(encoder_.encoded_row(0), encoder_.encoded_row(4));
+  for (int32_t i = 0; i < encoder_.num_rows(); ++i) {
+    ASSERT_EQ(encoder_.encoded_row(i).size(), 11);
+  }
+
+  // Sliced input
+  ExecBatch sliced({batch[0].make_array()->Slice(1, 3),
+                    batch[1].make_array()->Slice(1, 3),
+                    batch[2].make_array()->Slice(1, 3)},
+                   3);
+  CheckRoundtrip(sliced);
+}
+
+TEST_F(TestRowEncoder, VariableLengthLayout) {
+  Init({utf8(), int16(), large_binary()});
+  ASSERT_FALSE(encoder_.is_fixed_length());
+
+  ExecBatch batch({ArrayFromJSON(utf8(), R"(["a", "", null, "bcd", "a"])"),
+                   ArrayFromJSON(int16(), "[1, 2, 3, null, 1]"),
+                   ArrayFromJSON(large_binary(), R"(["xy", null, "z", "", "xy"])")},
+                  5);
+  CheckRoundtrip(batch);
+  ASSERT_EQ(encoder_.encoded_row(0), encoder_.encoded_row(4));
+  ASSERT_NE(encoder_.encoded_row(0), encoder_.encoded_row(1));
+  // A null and an empty string are distinct
+  ASSERT_NE(encoder_.encoded_row(1).substr(0, 5), encoder_.encoded_row(2).substr(0, 5));
+}
+
+TEST_F(TestRowEncoder, AppendAndDecodeSelection) {
+  Init({utf8(), int64()});
+  ASSERT_OK(encoder_.EncodeAndAppend(ExecBatch(
+      {ArrayFromJSON(utf8(), R"(["a", "bb"])"), ArrayFromJSON(int64(), "[1, 2]")}, 2)));
+  ASSERT_OK(encoder_.EncodeAndAppend(
+      ExecBatch({ArrayFromJSON(utf8(), R"([null, "ccc", "dddd"])"),
+                 ArrayFromJSON(int64(), "[3, null, 5]")},
+                3)));
+  ASSERT_EQ(encoder_.num_rows(), 5);
+
+  std::vector<int32_t> row_ids = {4, 0, 2, 2};
+  ASSERT_OK_AND_ASSIGN(auto decoded, encoder_.Decode(4, row_ids.data()));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["dddd", "a", null, null])"),
+                    *decoded[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[5, 1, 3, 3]"), *decoded[1].make_array());
+}
+
+TEST_F(TestRowEncoder, DictionaryAndScalar) {
+  auto dict_type = dictionary(int32(), utf8());
+  Init({dict_type, int8()});
+
+  auto dict = ArrayFromJSON(utf8(), R"(["x", "y"])");
+  auto indices = ArrayFromJSON(int32(), "[0, 1, null, 1]");
+  ASSERT_OK_AND_ASSIGN(auto dict_array, DictionaryArray::FromArrays(indices, dict));
+  ExecBatch batch({dict_array, Datum(std::make_shared<Int8Scalar>(7))}, 4);
+  ASSERT_OK(encoder_.EncodeAndAppend(batch));
+  ASSERT_EQ(encoder_.num_rows(), 4);
+  ASSERT_EQ(encoder_.encoded_row(1), encoder_.encoded_row(3));
+
+  // A clone shares the dictionary, and rejects a different one
+  RowEncoder clone = encoder_.CloneEmpty();
+  ASSERT_EQ(clone.num_rows(), 0);
+  ASSERT_OK(clone.EncodeAndAppend(batch));
+  ASSERT_EQ(clone.encoded_row(1), encoder_.encoded_row(1));
+
+  ASSERT_OK_AND_ASSIGN(
+      auto other_dict_array,
+      DictionaryArray::FromArrays(indices, ArrayFromJSON(utf8(), R"(["z", "y"])")));
+  ASSERT_RAISES(NotImplemented,
+                clone.EncodeAndAppend(ExecBatch(
+                    {other_dict_array, Datum(std::make_shared<Int8Scalar>(7))}, 4)));
+
+  std::vector<int32_t> row_ids = {0, 1, 2, 3};
+  ASSERT_OK_AND_ASSIGN(auto decoded, encoder_.Decode(4, row_ids.data()));
+  AssertArraysEqual(*dict_array, *decoded[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[7, 7, 7, 7]"), *decoded[1].make_array());
+}
+
+TEST_F(TestRowEncoder, Errors) {
+  std::vector<ValueDescr> descrs = {ValueDescr(list(int32()))};
+  ASSERT_RAISES(NotImplemented, encoder_.Init(descrs, &ctx_));
+
+  Init({int32()});
+  ExecBatch batch({ArrayFromJSON(int32(), "[1]"), ArrayFromJSON(int32(), "[2]")}, 1);
+  ASSERT_RAISES(Invalid, encoder_.EncodeAndAppend(batch));
+}
+
+}  // namespace compute
+}  // namespace arrow
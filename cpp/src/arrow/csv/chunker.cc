@@ -17,6 +17,7 @@
 
 #include "arrow/csv/chunker.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -238,6 +239,80 @@ class LexingBoundaryFinder : public BoundaryFinder {
   ParseOptions options_;
 };
 
+// A BoundaryFinder implementation that guesses CSV line boundaries without
+// lexing, assuming that quote characters only ever delimit quoted fields (in
+// which they are doubled).  A newline is then outside quotes if it follows an
+// even number of quote characters from the start of the block.
+//
+// The guess is wrong for some valid CSV data (quote characters inside a
+// non-quoted field, escaped quote characters or newlines), so the resulting
+// chunks must be validated by parsing them.  When the quotes don't allow any
+// guess, the first or last newline is used.
+class SpeculativeBoundaryFinder : public BoundaryFinder {
+ public:
+  explicit SpeculativeBoundaryFinder(const ParseOptions& options)
+      : quoting_(options.quoting), quote_char_(options.quote_char) {}
+
+  Status FindFirst(util::string_view partial, util::string_view block,
+                   int64_t* out_pos) override {
+    bool in_quotes = (CountQuotes(partial) % 2) != 0;
+    for (size_t i = 0; i < block.size(); ++i) {
+      const char c = block[i];
+      if (quoting_ && c == quote_char_) {
+        in_quotes = !in_quotes;
+      } else if (!in_quotes && IsNewline(c)) {
+        *out_pos = SkipNewlines(block, i);
+        return Status::OK();
+      }
+    }
+    const auto pos = block.find_first_of("\r\n");
+    *out_pos =
+        (pos == util::string_view::npos) ? kNoDelimiterFound : SkipNewlines(block, pos);
+    return Status::OK();
+  }
+
+  Status FindLast(util::string_view block, int64_t* out_pos) override {
+    // Whether there is an odd number of quotes before position `i`
+    bool in_quotes = (CountQuotes(block) % 2) != 0;
+    for (size_t i = block.size(); i > 0; --i) {
+      const char c = block[i - 1];
+      if (quoting_ && c == quote_char_) {
+        in_quotes = !in_quotes;
+      } else if (!in_quotes && IsNewline(c)) {
+        *out_pos = static_cast<int64_t>(i);
+        return Status::OK();
+      }
+    }
+    const auto pos = block.find_last_of("\r\n");
+    *out_pos = (pos == util::string_view::npos) ? kNoDelimiterFound
+                                                : static_cast<int64_t>(pos + 1);
+    return Status::OK();
+  }
+
+ protected:
+  static bool IsNewline(char c) { return c == '\n' || c == '\r'; }
+
+  // Like NewlineBoundaryFinder, include any newline characters following the
+  // one at `pos`
+  static int64_t SkipNewlines(util::string_view block, size_t pos) {
+    ++pos;
+    while (pos < block.size() && IsNewline(block[pos])) {
+      ++pos;
+    }
+    return static_cast<int64_t>(pos);
+  }
+
+  int64_t CountQuotes(util::string_view data) const {
+    if (!quoting_) {
+      return 0;
+    }
+    return std::count(data.begin(), data.end(), quote_char_);
+  }
+
+  bool quoting_;
+  char quote_char_;
+};
+
 }  // namespace
 
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
@@ -262,5 +337,13 @@ std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
   return internal::make_unique<Chunker>(std::move(delimiter));
 }
 
+std::unique_ptr<Chunker> MakeSpeculativeChunker(const ParseOptions& options) {
+  if (!options.newlines_in_values) {
+    return MakeChunker(options);
+  }
+  return internal::make_unique<Chunker>(
+      std::make_shared<SpeculativeBoundaryFinder>(options));
+}
+
 }  // namespace csv
 }  // namespace arrow
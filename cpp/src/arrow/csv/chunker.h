@@ -32,5 +32,15 @@ namespace csv {
 ARROW_EXPORT
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options);
 
+/// \brief Make a chunker that guesses CSV line boundaries
+///
+/// If `options.newlines_in_values` is true, this chunker doesn't lex the CSV
+/// data to find line boundaries, but assumes that quote characters only
+/// delimit quoted fields.  The resulting chunks may then not start or end on
+/// a line boundary, which the caller must check when parsing them.
+/// Otherwise, this is the same as MakeChunker().
+ARROW_EXPORT
+std::unique_ptr<Chunker> MakeSpeculativeChunker(const ParseOptions& options);
+
 }  // namespace csv
 }  // namespace arrow
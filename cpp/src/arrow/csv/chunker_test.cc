@@ -261,5 +261,38 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+TEST(SpeculativeChunkerTest, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  auto chunker = MakeSpeculativeChunker(options);
+
+  // Well-formed quoting gives the same chunks as lexing
+  {
+    auto csv = MakeCSVData({"a,\"c \n d\",e\n", "\"\"\"\"\n", "f,\"\n\"\n"});
+    AssertChunkSize(*chunker, csv, 23);
+    AssertChunkSize(*chunker, csv.substr(0, 22), 17);
+    AssertChunkSize(*chunker, csv.substr(0, 16), 12);
+  }
+  // A quote inside a non-quoted field makes the guess wrong
+  {
+    auto csv = MakeCSVData({"a,b\"c,d\n", "e\n", "\"f\ng\"\n"});
+    AssertChunkSize(*chunker, csv, 13);
+  }
+  // Without any possible guess, the last newline is taken
+  {
+    auto csv = MakeCSVData({"a,\"b\n", "c\n"});
+    AssertChunkSize(*chunker, csv, 7);
+  }
+}
+
+TEST(SpeculativeChunkerTest, NoNewlinesInValues) {
+  // Same as MakeChunker()
+  auto options = ParseOptions::Defaults();
+  auto chunker = MakeSpeculativeChunker(options);
+  auto csv = MakeCSVData({"a,\"c \n", " d\",e\n"});
+  auto lengths = {6, 6};
+  AssertChunking(*chunker, csv, lengths);
+}
+
 }  // namespace csv
 }  // namespace arrow
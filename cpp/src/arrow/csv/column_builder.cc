@@ -73,9 +73,33 @@ class ConcreteColumnBuilder : public ColumnBuilder {
       }
       DCHECK_EQ(chunk->type()->id(), type->id()) << "Chunk types not equal!";
     }
+    if (type->id() == Type::DICTIONARY && shared_dictionaries()) {
+      ShareFinalDictionary();
+    }
     return std::make_shared<ChunkedArray>(chunks_, std::move(type));
   }
 
+  virtual bool shared_dictionaries() const { return false; }
+
+  // The chunk dictionaries are all prefixes of the column's shared dictionary
+  // (see ConvertOptions::shared_dictionaries): give all chunks its final state.
+  void ShareFinalDictionary() {
+    std::shared_ptr<ArrayData> dictionary;
+    for (const auto& chunk : chunks_) {
+      const auto& chunk_dict = chunk->data()->dictionary;
+      if (dictionary == nullptr || chunk_dict->length > dictionary->length) {
+        dictionary = chunk_dict;
+      }
+    }
+    for (auto& chunk : chunks_) {
+      if (chunk->data()->dictionary != dictionary) {
+        auto data = chunk->data()->Copy();
+        data->dictionary = dictionary;
+        chunk = MakeArray(std::move(data));
+      }
+    }
+  }
+
   void ReserveChunks(int64_t block_index) {
     // Create a null Array pointer at the back at the list.
     std::lock_guard<std::mutex> lock(mutex_);
@@ -180,6 +204,7 @@ class TypedColumnBuilder : public ConcreteColumnBuilder {
 
  protected:
   std::shared_ptr<DataType> type() const override { return type_; }
+  bool shared_dictionaries() const override { return options_.shared_dictionaries; }
 
   std::shared_ptr<DataType> type_;
   // CAUTION: ConvertOptions can grow large (if it customizes hundreds or
@@ -228,6 +253,7 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
     DCHECK_NE(converter_, nullptr);
     return converter_->type();
   }
+  bool shared_dictionaries() const override { return options_.shared_dictionaries; }
 
   Status UpdateType();
   Status TryConvertChunk(int64_t chunk_index);
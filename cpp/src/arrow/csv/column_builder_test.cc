@@ -546,5 +546,56 @@ TEST_F(InferringColumnBuilderTest, SingleChunkBinaryAutoDict) {
                        {expected_dictionary});
 }
 
+TEST_F(InferringColumnBuilderTest, MultipleChunkSharedAutoDict) {
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  options.auto_dict_max_cardinality = 3;
+  options.shared_dictionaries = true;
+
+  ChunkData csv_data = {{"ab", "cd", "ab"}, {"ef", "cd"}, {"ab"}};
+  auto expected_dictionary = ArrayFromJSON(utf8(), R"(["ab", "cd", "ef"])");
+  CheckAutoDictEncoded(TaskGroup::MakeSerial(), csv_data, options,
+                       {ArrayFromJSON(int32(), "[0, 1, 0]"),
+                        ArrayFromJSON(int32(), "[2, 1]"), ArrayFromJSON(int32(), "[0]")},
+                       {expected_dictionary, expected_dictionary, expected_dictionary});
+
+  // The max cardinality applies to the whole column
+  options.auto_dict_max_cardinality = 2;
+  CheckInferred(TaskGroup::MakeSerial(), csv_data, options,
+                {ArrayFromJSON(utf8(), R"(["ab", "cd", "ab"])"),
+                 ArrayFromJSON(utf8(), R"(["ef", "cd"])"),
+                 ArrayFromJSON(utf8(), R"(["ab"])")});
+}
+
+TEST_F(InferringColumnBuilderTest, MultipleChunkSharedAutoDictParallel) {
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  options.shared_dictionaries = true;
+  auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
+
+  ChunkData csv_data;
+  for (int i = 0; i < 20; ++i) {
+    csv_data.push_back({std::to_string(i % 7) + "x", std::to_string(i % 5) + "y"});
+  }
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options, tg));
+  AssertBuilding(builder, csv_data, &actual);
+
+  ASSERT_EQ(actual->num_chunks(), static_cast<int>(csv_data.size()));
+  const auto& dictionary =
+      checked_cast<const DictionaryArray&>(*actual->chunk(0)).dictionary();
+  ASSERT_EQ(dictionary->length(), 12);
+  for (int i = 0; i < actual->num_chunks(); ++i) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*actual->chunk(i));
+    ASSERT_EQ(dict_array.dictionary()->data(), dictionary->data());
+    const auto& values = checked_cast<const StringArray&>(*dictionary);
+    for (int64_t j = 0; j < dict_array.length(); ++j) {
+      ASSERT_EQ(values.GetString(dict_array.GetValueIndex(j)), csv_data[i][j]);
+    }
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,13 +17,16 @@
 
 #include "arrow/csv/converter.h"
 
+#include <atomic>
 #include <cstring>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/array_dict.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_dict.h"
@@ -340,8 +343,17 @@ struct MultipleParsersTimestampValueDecoder : public ValueDecoder {
         parsers_(GetParsers(options_)) {}
 
   Status Decode(const uint8_t* data, uint32_t size, bool quoted, value_type* out) {
-    for (const auto& parser : parsers_) {
-      if (parser->operator()(reinterpret_cast<const char*>(data), size, unit_, out)) {
+    const char* s = reinterpret_cast<const char*>(data);
+    // Values of a column usually share a format, so try the parser that
+    // succeeded last first.  This is only a hint: chunks may be converted
+    // concurrently.
+    const size_t last_parser = last_parser_.load(std::memory_order_relaxed);
+    if (parsers_[last_parser]->operator()(s, size, unit_, out)) {
+      return Status::OK();
+    }
+    for (size_t i = 0; i < parsers_.size(); ++i) {
+      if (i != last_parser && parsers_[i]->operator()(s, size, unit_, out)) {
+        last_parser_.store(i, std::memory_order_relaxed);
         return Status::OK();
       }
     }
@@ -361,6 +373,7 @@ struct MultipleParsersTimestampValueDecoder : public ValueDecoder {
 
   TimeUnit::type unit_;
   std::vector<const TimestampParser*> parsers_;
+  std::atomic<size_t> last_parser_{0};
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -486,6 +499,9 @@ class TypedDictionaryConverter : public ConcreteDictionaryConverter {
 
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(builder.Finish(&res));
+    if (shared_memo_table_) {
+      return ShareDictionary(checked_cast<const DictionaryArray&>(*res));
+    }
     return res;
   }
 
@@ -494,11 +510,52 @@ class TypedDictionaryConverter : public ConcreteDictionaryConverter {
  protected:
   Status Initialize() override {
     util::InitializeUTF8();
+    if (options_.shared_dictionaries) {
+      shared_memo_table_.reset(new internal::DictionaryMemoTable(pool_, value_type_));
+    }
     return decoder_.Initialize();
   }
 
+  // Re-encode a chunk against the dictionary shared by all chunks.
+  // Each chunk is first encoded with its own (small) dictionary so that the
+  // lock is only taken once per distinct value of the chunk, not per value.
+  Result<std::shared_ptr<Array>> ShareDictionary(const DictionaryArray& chunk) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+
+    const auto& chunk_dict = checked_cast<const ArrayType&>(*chunk.dictionary());
+    ARROW_ASSIGN_OR_RAISE(auto transpose_map,
+                          AllocateBuffer(chunk_dict.length() * sizeof(int32_t), pool_));
+    auto transpose = reinterpret_cast<int32_t*>(transpose_map->mutable_data());
+
+    std::shared_ptr<Array> dictionary;
+    {
+      std::lock_guard<std::mutex> lock(shared_mutex_);
+      for (int64_t i = 0; i < chunk_dict.length(); ++i) {
+        RETURN_NOT_OK(
+            shared_memo_table_->GetOrInsert<T>(chunk_dict.GetView(i), &transpose[i]));
+      }
+      if (ARROW_PREDICT_FALSE(shared_memo_table_->size() > max_cardinality_)) {
+        return Status::IndexError("Dictionary length exceeded max cardinality");
+      }
+      // Only materialize the dictionary again if it grew
+      if (shared_dictionary_ == nullptr ||
+          shared_dictionary_->length() < shared_memo_table_->size()) {
+        std::shared_ptr<ArrayData> data;
+        RETURN_NOT_OK(shared_memo_table_->GetArrayData(0, &data));
+        shared_dictionary_ = MakeArray(std::move(data));
+      }
+      dictionary = shared_dictionary_;
+    }
+    return chunk.Transpose(type_, dictionary, transpose, pool_);
+  }
+
   ValueDecoderType decoder_;
   int32_t max_cardinality_ = std::numeric_limits<int32_t>::max();
+
+  // Only used with ConvertOptions::shared_dictionaries
+  std::unique_ptr<internal::DictionaryMemoTable> shared_memo_table_;
+  std::shared_ptr<Array> shared_dictionary_;
+  std::mutex shared_mutex_;
 };
 
 //
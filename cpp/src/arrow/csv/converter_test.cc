@@ -447,6 +447,12 @@ TEST(TimestampConversion, UserDefinedParsers) {
   options.timestamp_parsers.push_back(TimestampParser::MakeISO8601());
   AssertConversion<TimestampType, int64_t>(type, {"01/02/1970,1970-01-03\n"},
                                            {{86400000}, {172800000}}, options);
+
+  // Test multiple parsers with formats changing within a column
+  AssertConversion<TimestampType, int64_t>(
+      type, {"01/02/1970\n", "1970-01-03\n", "1970-01-04\n", "01/05/1970\n", "N/A\n"},
+      {{86400000, 172800000, 259200000, 345600000, 0}},
+      {{true, true, true, true, false}}, options);
 }
 
 Decimal128 Dec128(util::string_view value) {
@@ -599,6 +605,36 @@ TYPED_TEST(TestStringDictConverter, MaxCardinality) {
   ASSERT_RAISES(IndexError, DictConversion(this->type(), csv_string, 2));
 }
 
+TYPED_TEST(TestStringDictConverter, SharedDictionary) {
+  auto options = ConvertOptions::Defaults();
+  options.shared_dictionaries = true;
+  ASSERT_OK_AND_ASSIGN(auto converter, DictionaryConverter::Make(this->type(), options));
+  converter->SetMaxCardinality(4);
+
+  auto convert = [&](const std::string& csv_string) {
+    std::shared_ptr<BlockParser> parser;
+    MakeCSVParser({csv_string}, &parser);
+    return converter->Convert(*parser, 0);
+  };
+
+  // Indices of all chunks refer to the same, growing dictionary
+  ASSERT_OK_AND_ASSIGN(auto first, convert("cd\nab\ncd\n"));
+  ASSERT_OK_AND_ASSIGN(auto second, convert("ef\nN/A\nab\n"));
+  ASSERT_OK(first->ValidateFull());
+  ASSERT_OK(second->ValidateFull());
+  const auto& first_dict = internal::checked_cast<const DictionaryArray&>(*first);
+  const auto& second_dict = internal::checked_cast<const DictionaryArray&>(*second);
+  AssertArraysEqual(*first_dict.dictionary(),
+                    *ArrayFromJSON(this->type(), R"(["cd", "ab"])"));
+  AssertArraysEqual(*first_dict.indices(), *ArrayFromJSON(int32(), "[0, 1, 0]"));
+  AssertArraysEqual(*second_dict.dictionary(),
+                    *ArrayFromJSON(this->type(), R"(["cd", "ab", "ef", "N/A"])"));
+  AssertArraysEqual(*second_dict.indices(), *ArrayFromJSON(int32(), "[2, 3, 1]"));
+
+  // The max cardinality applies to the shared dictionary
+  ASSERT_RAISES(IndexError, convert("ab\ngh\n"));
+}
+
 TEST(TestFixedSizeBinaryDictConverter, Basics) {
   auto value_type = fixed_size_binary(3);
 
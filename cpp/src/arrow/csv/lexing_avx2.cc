@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/lexing_internal.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+void FindSpecialCharsAvx2(const uint8_t* data, int64_t num_words,
+                          const uint8_t* special_chars, uint64_t* out) {
+  __m256i patterns[kNumSpecialChars];
+  for (int k = 0; k < kNumSpecialChars; ++k) {
+    patterns[k] = _mm256_set1_epi8(static_cast<char>(special_chars[k]));
+  }
+
+  for (int64_t i = 0; i < num_words; ++i, data += 64) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    __m256i lo_matches = _mm256_cmpeq_epi8(lo, patterns[0]);
+    __m256i hi_matches = _mm256_cmpeq_epi8(hi, patterns[0]);
+    for (int k = 1; k < kNumSpecialChars; ++k) {
+      lo_matches = _mm256_or_si256(lo_matches, _mm256_cmpeq_epi8(lo, patterns[k]));
+      hi_matches = _mm256_or_si256(hi_matches, _mm256_cmpeq_epi8(hi, patterns[k]));
+    }
+    const auto lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(lo_matches));
+    const auto hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(hi_matches));
+    out[i] = lo_bits | (static_cast<uint64_t>(hi_bits) << 32);
+  }
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
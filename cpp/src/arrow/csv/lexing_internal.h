@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+// The number of special chars searched by the FindSpecialChars functions
+constexpr int kNumSpecialChars = 5;
+
+// Find the bytes equal to one of `special_chars` in num_words * 64 bytes of data.
+// Bit j of out[i] is set if data[i * 64 + j] is special.
+using FindSpecialCharsFunc = void (*)(const uint8_t* data, int64_t num_words,
+                                      const uint8_t* special_chars, uint64_t* out);
+
+void FindSpecialCharsAvx2(const uint8_t* data, int64_t num_words,
+                          const uint8_t* special_chars, uint64_t* out);
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
@@ -83,11 +83,21 @@ struct ARROW_EXPORT ConvertOptions {
   /// Whether to try to automatically dict-encode string / binary data.
   /// If true, then when type inference detects a string or binary column,
   /// it is dict-encoded up to `auto_dict_max_cardinality` distinct values
-  /// (per chunk), after which it switches to regular encoding.
+  /// (per chunk, or per column if `shared_dictionaries` is true), after which
+  /// it switches to regular encoding.
   ///
   /// This setting is ignored for non-inferred columns (those in `column_types`).
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
+  /// Whether the chunks of a dict-encoded column share a single dictionary.
+  ///
+  /// If false, each chunk has its own dictionary.  If true, all chunks of a
+  /// column are encoded against one dictionary, which grows as new values
+  /// are found, so that their indices can be compared directly.  The table
+  /// reader gives all chunks the final dictionary; batches from the streaming
+  /// reader get the dictionary as of their conversion (a prefix of the final
+  /// dictionary).
+  bool shared_dictionaries = false;
 
   // XXX Should we have a separate FilterOptions?
 
@@ -105,8 +115,10 @@ struct ARROW_EXPORT ConvertOptions {
   /// User-defined timestamp parsers, using the virtual parser interface in
   /// arrow/util/value_parsing.h. More than one parser can be specified, and
   /// the CSV conversion logic will try parsing values starting from the
-  /// beginning of this vector. If no parsers are specified, we use the default
-  /// built-in ISO-8601 parser.
+  /// beginning of this vector, except that the parser that last succeeded
+  /// in a column is tried first. Therefore, if several parsers are given, they
+  /// should not accept the same values with different results. If no parsers
+  /// are specified, we use the default built-in ISO-8601 parser.
   std::vector<std::shared_ptr<TimestampParser>> timestamp_parsers;
 
   /// Create conversion options with default values, including conventional
@@ -148,6 +160,12 @@ struct ARROW_EXPORT WriteOptions {
   /// This number can impact performance.
   int32_t batch_size = 1024;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, batches of `batch_size` rows are converted in parallel, and written
+  /// in order by the calling thread.
+  bool use_threads = true;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 };
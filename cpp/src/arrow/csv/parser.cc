@@ -19,18 +19,26 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
+#include <vector>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 namespace csv {
 
 using detail::DataBatch;
+using detail::kNumSpecialChars;
 using detail::ParsedValueDesc;
 
 namespace {
@@ -47,20 +55,25 @@ Status MismatchingColumns(int32_t expected, int32_t actual) {
 
 inline bool IsControlChar(uint8_t c) { return c < ' '; }
 
-template <bool Quoting, bool Escaping>
+template <bool Quoting, bool Escaping, bool SelectColumns>
 class SpecializedOptions {
  public:
   static constexpr bool quoting = Quoting;
   static constexpr bool escaping = Escaping;
+  // Whether only the values of some columns are stored
+  static constexpr bool select_columns = SelectColumns;
 };
 
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class PresizedDataWriter {
  public:
+  static constexpr int64_t kFieldDataPadding = 16;
+
   PresizedDataWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+    parsed_buffer_ =
+        *AllocateResizableBuffer(parsed_capacity_ + kFieldDataPadding, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -76,6 +89,21 @@ class PresizedDataWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push `length` bytes, reading and writing up to kFieldDataPadding bytes more
+  // if `data_end` allows it
+  void PushFieldData(const char* data, int64_t length, const char* data_end) {
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    uint8_t* out = parsed_ + parsed_size_;
+    parsed_size_ += length;
+    // Most fields are short: favour a fixed-size copy over a memcpy() call
+    if (ARROW_PREDICT_TRUE(length <= kFieldDataPadding &&
+                           data_end - data >= kFieldDataPadding)) {
+      std::memcpy(out, data, kFieldDataPadding);
+    } else {
+      std::memcpy(out, data, static_cast<size_t>(length));
+    }
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -168,13 +196,157 @@ class PresizedValueDescWriter : public ValueDescWriter<PresizedValueDescWriter>
   }
 };
 
+// Find the special chars in 64 bytes of data at a time, using SWAR
+void FindSpecialCharsDefault(const uint8_t* data, int64_t num_words,
+                             const uint8_t* special_chars, uint64_t* out) {
+  constexpr uint64_t kLow7Bits = 0x7f7f7f7f7f7f7f7fULL;
+  uint64_t patterns[kNumSpecialChars];
+  for (int k = 0; k < kNumSpecialChars; ++k) {
+    patterns[k] = special_chars[k] * 0x0101010101010101ULL;
+  }
+
+  for (int64_t i = 0; i < num_words; ++i) {
+    uint64_t bits = 0;
+    for (int j = 0; j < 8; ++j, data += 8) {
+      const auto word = BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(data));
+      uint64_t matches = 0;
+      for (int k = 0; k < kNumSpecialChars; ++k) {
+        // Set the high bit of the bytes equal to the pattern's
+        const uint64_t x = word ^ patterns[k];
+        matches |= ~(((x & kLow7Bits) + kLow7Bits) | x | kLow7Bits);
+      }
+      // Gather the high bits of the 8 bytes into 8 consecutive bits
+      bits |= (((matches >> 7) * 0x0102040810204080ULL) >> 56) << (j * 8);
+    }
+    out[i] = bits;
+  }
+}
+
+struct FindSpecialCharsDynamicFunction {
+  using FunctionType = detail::FindSpecialCharsFunc;
+
+  static std::vector<std::pair<::arrow::internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+      { ::arrow::internal::DispatchLevel::NONE, FindSpecialCharsDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { ::arrow::internal::DispatchLevel::AVX2, detail::FindSpecialCharsAvx2 }
+#endif
+    };
+  }
+};
+
+// A structural index of a block of CSV data: a bitmap of the bytes which may
+// end a run of ordinary field bytes (delimiters, line separators, quote and
+// escape chars).  It is built with SIMD instructions where available and
+// lets the parser copy runs of ordinary bytes in bulk, instead of running
+// the state machine on each byte.
+class SpecialCharIndex {
+ public:
+  explicit SpecialCharIndex(const ParseOptions& options) {
+    // Unused special chars are duplicates of a line separator
+    special_chars_[0] = '\n';
+    special_chars_[1] = '\r';
+    special_chars_[2] = static_cast<uint8_t>(options.delimiter);
+    special_chars_[3] =
+        static_cast<uint8_t>(options.quoting ? options.quote_char : '\n');
+    special_chars_[4] =
+        static_cast<uint8_t>(options.escaping ? options.escape_char : '\n');
+  }
+
+  Status Build(MemoryPool* pool, const char* data, int64_t length) {
+    static ::arrow::internal::DynamicDispatch<FindSpecialCharsDynamicFunction>
+        dispatch;
+
+    // One more word than needed, so that the position just past the data
+    // can be looked up
+    const int64_t num_words = length / 64 + 1;
+    if (bitmap_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(bitmap_, AllocateResizableBuffer(0, pool));
+    }
+    RETURN_NOT_OK(bitmap_->Resize(num_words * 8, /*shrink_to_fit=*/false));
+    words_ = reinterpret_cast<uint64_t*>(bitmap_->mutable_data());
+    data_ = data;
+
+    const int64_t num_full_words = length / 64;
+    const auto bytes = reinterpret_cast<const uint8_t*>(data);
+    dispatch.func(bytes, num_full_words, special_chars_, words_);
+    // The trailing bytes, and all positions past the data, are special
+    uint64_t bits = ~static_cast<uint64_t>(0);
+    for (int64_t i = num_full_words * 64; i < length; ++i) {
+      if (!IsSpecial(bytes[i])) {
+        bits &= ~(static_cast<uint64_t>(1) << (i % 64));
+      }
+    }
+    words_[num_full_words] = bits;
+    return Status::OK();
+  }
+
+  // A view of the index, meant to be copied to a local variable while parsing:
+  // the parser's byte stores would otherwise force reloading its members
+  struct View {
+    const uint64_t* words;
+    const char* data;
+
+    // The number of ordinary bytes starting at `pos`
+    int64_t OrdinaryRunLength(const char* pos) const {
+      const int64_t start = pos - data;
+      int64_t word_index = start / 64;
+      uint64_t word = words[word_index] >> (start % 64);
+      if (word != 0) {
+        return BitUtil::CountTrailingZeros(word);
+      }
+      do {
+        word = words[++word_index];
+      } while (word == 0);
+      return word_index * 64 + BitUtil::CountTrailingZeros(word) - start;
+    }
+  };
+
+  View view() const { return {words_, data_}; }
+
+ protected:
+  bool IsSpecial(uint8_t c) const {
+    return std::memchr(special_chars_, c, kNumSpecialChars) != nullptr;
+  }
+
+  uint8_t special_chars_[kNumSpecialChars];
+  std::shared_ptr<ResizableBuffer> bitmap_;
+  uint64_t* words_ = nullptr;
+  const char* data_ = nullptr;
+};
+
 }  // namespace
 
 class BlockParserImpl {
  public:
   BlockParserImpl(MemoryPool* pool, ParseOptions options, int32_t num_cols,
                   int32_t max_num_rows)
-      : pool_(pool), options_(options), max_num_rows_(max_num_rows), batch_(num_cols) {}
+      : pool_(pool),
+        options_(options),
+        max_num_rows_(max_num_rows),
+        special_chars_(options_),
+        batch_(num_cols) {}
+
+  BlockParserImpl(MemoryPool* pool, ParseOptions options, int32_t num_cols,
+                  int32_t max_num_rows, const std::vector<int32_t>& column_indices)
+      : BlockParserImpl(pool, std::move(options), num_cols, max_num_rows) {
+    DCHECK_GT(num_cols, 0);
+    // Stored values are laid out in column order
+    auto& positions = batch_.column_positions_;
+    positions.assign(num_cols, -1);
+    for (const auto col_index : column_indices) {
+      DCHECK_GE(col_index, 0);
+      DCHECK_LT(col_index, num_cols);
+      positions[col_index] = 0;
+    }
+    batch_.num_stored_cols_ = 0;
+    for (auto& position : positions) {
+      if (position >= 0) {
+        position = batch_.num_stored_cols_++;
+      }
+    }
+  }
 
   const DataBatch& parsed_batch() const { return batch_; }
 
@@ -184,10 +356,36 @@ class BlockParserImpl {
                    const char** out_data) {
     int32_t num_cols = 0;
     char c;
+    const auto special_chars = special_chars_.view();
+    const int32_t* column_positions = batch_.column_positions_.data();
+    // Whether the value of the current field is stored
+    bool store_field = true;
 
     DCHECK_GT(data_end, data);
 
-    auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+    auto StoreField = [&]() {
+      return !SpecializedOptions::select_columns || store_field;
+    };
+    auto PushFieldChar = [&](char field_char) {
+      if (StoreField()) {
+        parsed_writer->PushFieldChar(field_char);
+      }
+    };
+    // Copy the bytes up to the next special char (or the end of data) at once.
+    // This is only done after an ordinary byte was pushed, so that empty fields
+    // and runs of special chars don't pay for an index lookup.
+    auto CopyOrdinaryRun = [&]() {
+      const int64_t length = special_chars.OrdinaryRunLength(data);
+      if (StoreField()) {
+        parsed_writer->PushFieldData(data, length, data_end);
+      }
+      data += length;
+    };
+    auto FinishField = [&]() {
+      if (StoreField()) {
+        values_writer->FinishField(parsed_writer);
+      }
+    };
 
     values_writer->BeginLine();
     parsed_writer->BeginLine();
@@ -212,6 +410,11 @@ class BlockParserImpl {
 
   FieldStart:
     // At the start of a field
+    if (SpecializedOptions::select_columns) {
+      // Fields past the expected number of columns are skipped, the line is
+      // invalid anyway
+      store_field = num_cols < batch_.num_cols_ && column_positions[num_cols] >= 0;
+    }
     // Quoting is only recognized at start of field
     if (SpecializedOptions::quoting &&
         ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
@@ -234,7 +437,7 @@ class BlockParserImpl {
         goto AbortLine;
       }
       c = *data++;
-      parsed_writer->PushFieldChar(c);
+      PushFieldChar(c);
       goto InField;
     }
     if (ARROW_PREDICT_FALSE(c == options_.delimiter)) {
@@ -252,7 +455,8 @@ class BlockParserImpl {
         goto LineEnd;
       }
     }
-    parsed_writer->PushFieldChar(c);
+    PushFieldChar(c);
+    CopyOrdinaryRun();
     goto InField;
 
   InQuotedField:
@@ -266,7 +470,7 @@ class BlockParserImpl {
         goto AbortLine;
       }
       c = *data++;
-      parsed_writer->PushFieldChar(c);
+      PushFieldChar(c);
       goto InQuotedField;
     }
     if (ARROW_PREDICT_FALSE(c == options_.quote_char)) {
@@ -279,7 +483,8 @@ class BlockParserImpl {
         goto InField;
       }
     }
-    parsed_writer->PushFieldChar(c);
+    PushFieldChar(c);
+    CopyOrdinaryRun();
     goto InQuotedField;
 
   FieldEnd:
@@ -297,7 +502,7 @@ class BlockParserImpl {
     ++num_cols;
     if (ARROW_PREDICT_FALSE(num_cols != batch_.num_cols_)) {
       if (batch_.num_cols_ == -1) {
-        batch_.num_cols_ = num_cols;
+        batch_.num_cols_ = batch_.num_stored_cols_ = num_cols;
       } else {
         return MismatchingColumns(batch_.num_cols_, num_cols);
       }
@@ -320,10 +525,10 @@ class BlockParserImpl {
     if (!options_.ignore_empty_lines) {
       if (batch_.num_cols_ == -1) {
         // Consider as single value
-        batch_.num_cols_ = 1;
+        batch_.num_cols_ = batch_.num_stored_cols_ = 1;
       }
       // Record as row of empty (null?) values
-      while (num_cols++ < batch_.num_cols_) {
+      while (num_cols++ < batch_.num_stored_cols_) {
         values_writer->StartField(false /* quoted */);
         FinishField();
       }
@@ -366,7 +571,10 @@ class BlockParserImpl {
   template <typename SpecializedOptions>
   Status ParseSpecialized(const std::vector<util::string_view>& views, bool is_final,
                           uint32_t* out_size) {
-    batch_ = DataBatch{batch_.num_cols_};
+    DataBatch batch{batch_.num_cols_};
+    batch.num_stored_cols_ = batch_.num_stored_cols_;
+    batch.column_positions_ = std::move(batch_.column_positions_);
+    batch_ = std::move(batch);
     values_size_ = 0;
 
     size_t total_view_length = 0;
@@ -384,6 +592,7 @@ class BlockParserImpl {
       const char* data = view.data();
       const char* data_end = view.data() + view.length();
       bool finished_parsing = false;
+      RETURN_NOT_OK(special_chars_.Build(pool_, data, view.length()));
 
       if (batch_.num_cols_ == -1) {
         // Can't presize values when the number of columns is not known, first parse
@@ -407,14 +616,16 @@ class BlockParserImpl {
 
         int32_t rows_in_chunk;
         constexpr int32_t kTargetChunkSize = 32768;  // in number of values
-        if (batch_.num_cols_ > 0) {
-          rows_in_chunk = std::min(std::max(kTargetChunkSize / batch_.num_cols_, 512),
-                                   max_num_rows_ - batch_.num_rows_);
+        if (batch_.num_stored_cols_ > 0) {
+          rows_in_chunk =
+              std::min(std::max(kTargetChunkSize / batch_.num_stored_cols_, 512),
+                       max_num_rows_ - batch_.num_rows_);
         } else {
           rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - batch_.num_rows_);
         }
 
-        PresizedValueDescWriter values_writer(pool_, rows_in_chunk, batch_.num_cols_);
+        PresizedValueDescWriter values_writer(pool_, rows_in_chunk,
+                                              batch_.num_stored_cols_);
         values_writer.Start(parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
@@ -438,7 +649,7 @@ class BlockParserImpl {
     if (batch_.num_cols_ == -1) {
       DCHECK_EQ(batch_.num_rows_, 0);
     }
-    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_cols_);
+    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_stored_cols_);
 #ifndef NDEBUG
     if (batch_.num_rows_ > 0) {
       // Ending parsed offset should be equal to number of parsed bytes
@@ -462,27 +673,38 @@ class BlockParserImpl {
                uint32_t* out_size) {
     if (options_.quoting) {
       if (options_.escaping) {
-        return ParseSpecialized<SpecializedOptions<true, true>>(data, is_final, out_size);
+        return ParseSelectingColumns<true, true>(data, is_final, out_size);
       } else {
-        return ParseSpecialized<SpecializedOptions<true, false>>(data, is_final,
-                                                                 out_size);
+        return ParseSelectingColumns<true, false>(data, is_final, out_size);
       }
     } else {
       if (options_.escaping) {
-        return ParseSpecialized<SpecializedOptions<false, true>>(data, is_final,
-                                                                 out_size);
+        return ParseSelectingColumns<false, true>(data, is_final, out_size);
       } else {
-        return ParseSpecialized<SpecializedOptions<false, false>>(data, is_final,
-                                                                  out_size);
+        return ParseSelectingColumns<false, false>(data, is_final, out_size);
       }
     }
   }
 
  protected:
+  template <bool Quoting, bool Escaping>
+  Status ParseSelectingColumns(const std::vector<util::string_view>& data,
+                               bool is_final, uint32_t* out_size) {
+    if (batch_.column_positions_.empty()) {
+      return ParseSpecialized<SpecializedOptions<Quoting, Escaping, false>>(
+          data, is_final, out_size);
+    } else {
+      return ParseSpecialized<SpecializedOptions<Quoting, Escaping, true>>(
+          data, is_final, out_size);
+    }
+  }
+
   MemoryPool* pool_;
   const ParseOptions options_;
   // The maximum number of rows to parse from a block
   int32_t max_num_rows_;
+  // Index of the special chars of the data being parsed
+  SpecialCharIndex special_chars_;
 
   // Unparsed data size
   int32_t values_size_;
@@ -497,6 +719,12 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_col
                          int32_t max_num_rows)
     : impl_(new BlockParserImpl(pool, std::move(options), num_cols, max_num_rows)) {}
 
+BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
+                         int32_t max_num_rows,
+                         const std::vector<int32_t>& column_indices)
+    : impl_(new BlockParserImpl(pool, std::move(options), num_cols, max_num_rows,
+                                column_indices)) {}
+
 BlockParser::~BlockParser() {}
 
 Status BlockParser::Parse(const std::vector<util::string_view>& data,
@@ -53,7 +53,8 @@ struct ParsedValueDesc {
 
 class ARROW_EXPORT DataBatch {
  public:
-  explicit DataBatch(int32_t num_cols) : num_cols_(num_cols) {}
+  explicit DataBatch(int32_t num_cols)
+      : num_cols_(num_cols), num_stored_cols_(num_cols) {}
 
   /// \brief Return the number of parsed rows
   int32_t num_rows() const { return num_rows_; }
@@ -66,12 +67,19 @@ class ARROW_EXPORT DataBatch {
   Status VisitColumn(int32_t col_index, Visitor&& visit) const {
     using detail::ParsedValueDesc;
 
+    int32_t stored_index = col_index;
+    if (!column_positions_.empty()) {
+      stored_index = col_index < num_cols_ ? column_positions_[col_index] : -1;
+      if (stored_index < 0) {
+        return Status::Invalid("CSV column #", col_index, " was not parsed");
+      }
+    }
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_) {
+      for (int32_t pos = stored_index; pos < max_pos; pos += num_stored_cols_) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -89,8 +97,8 @@ class ARROW_EXPORT DataBatch {
     const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
     const auto start_pos =
         static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) -
-        num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        num_stored_cols_ - 1;
+    for (int32_t col_index = 0; col_index < num_stored_cols_; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -104,6 +112,11 @@ class ARROW_EXPORT DataBatch {
   int32_t num_rows_ = 0;
   // The number of columns
   int32_t num_cols_ = 0;
+  // The number of columns whose values are stored (all of them by default)
+  int32_t num_stored_cols_ = 0;
+  // If not empty, the position of each column's value among the stored
+  // values of a row (-1 if not stored)
+  std::vector<int32_t> column_positions_;
 
   // XXX should we ensure the parsed buffer is padded with 8 or 16 excess zero bytes?
   // It may help with null parsing...
@@ -137,6 +150,14 @@ class ARROW_EXPORT BlockParser {
                        int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
                        int32_t max_num_rows = kMaxParserNumRows);
+  /// \brief Create a parser storing the values of some columns only
+  ///
+  /// `column_indices` are the indices of the columns whose values are stored,
+  /// out of `num_cols` columns (which must be known).  The fields of other
+  /// columns are still delimited, but neither unquoted nor stored: visiting
+  /// them is an error.
+  BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
+              int32_t max_num_rows, const std::vector<int32_t>& column_indices);
   ~BlockParser();
 
   /// \brief Parse a block of data
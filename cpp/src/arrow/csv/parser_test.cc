@@ -623,5 +623,115 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Runs of ordinary chars of all lengths, around 64-byte boundaries and
+  // the end of data, interrupted by special chars
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  std::string csv;
+  size_t last_line_start = 0;
+  std::vector<std::string> unquoted, quoted, escaped;
+  for (int length = 0; length < 150; ++length) {
+    last_line_start = csv.size();
+    std::string value;
+    for (int i = 0; i < length; ++i) {
+      value.push_back(static_cast<char>('a' + i % 26));
+    }
+    const auto half = value.substr(0, length / 2);
+    const auto other_half = value.substr(length / 2);
+    // Quotes after the start of a field and special chars inside quotes
+    // are ordinary
+    unquoted.push_back("-" + half + "\"" + other_half);
+    quoted.push_back(half + ",\r\n\"" + other_half);
+    escaped.push_back(half + "," + other_half);
+    csv += unquoted.back() + ",\"" + half + ",\r\n\"\"" + other_half + "\"," + half +
+           "\\," + other_half + "\n";
+  }
+  {
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {unquoted, quoted, escaped});
+  }
+  // Without the trailing newline, the last line is only parsed in the final block
+  csv.pop_back();
+  {
+    BlockParser parser(options);
+    AssertParsePartial(parser, csv, static_cast<uint32_t>(last_line_start));
+    ASSERT_EQ(parser.num_rows(), 149);
+  }
+  {
+    BlockParser parser(options);
+    AssertParseFinal(parser, csv);
+    AssertColumnsEq(parser, {unquoted, quoted, escaped});
+  }
+}
+
+TEST(BlockParser, ColumnSelection) {
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  // Skipped fields must still be delimited correctly
+  auto csv = MakeCSVData(
+      {"a,\"b,\nc\",d\\,e,f\n", "g,\"\",,i\n", "\"j\",k,l,\"m\"\"\"\n"});
+  {
+    BlockParser parser(default_memory_pool(), options, 4, kMaxParserNumRows, {3, 0});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 4);
+    AssertColumnEq(parser, 0, {"a", "g", "j"}, {false, false, true});
+    AssertColumnEq(parser, 3, {"f", "i", "m\""}, {false, false, true});
+    ASSERT_EQ(parser.num_bytes(), 7);
+    auto visit = [](const uint8_t*, uint32_t, bool) { return Status::OK(); };
+    ASSERT_RAISES(Invalid, parser.VisitColumn(1, visit));
+    ASSERT_RAISES(Invalid, parser.VisitColumn(2, visit));
+  }
+  {
+    BlockParser parser(default_memory_pool(), options, 4, kMaxParserNumRows, {1});
+    AssertParseOk(parser, csv);
+    AssertColumnEq(parser, 1, {"b,\nc", "", "k"}, {true, true, false});
+  }
+  {
+    // No column selected: rows are still counted
+    BlockParser parser(default_memory_pool(), options, 4, kMaxParserNumRows, {});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_rows(), 3);
+    ASSERT_EQ(parser.num_bytes(), 0);
+  }
+  {
+    // Truncated last line
+    BlockParser parser(default_memory_pool(), options, 4, kMaxParserNumRows, {2});
+    AssertParsePartial(parser, csv + "n,\"o", static_cast<uint32_t>(csv.size()));
+    AssertColumnEq(parser, 2, {"d,e", "", "l"});
+  }
+  {
+    // Column count is checked
+    BlockParser parser(default_memory_pool(), options, 4, kMaxParserNumRows, {0});
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, "a,b,c\n", &out_size));
+    ASSERT_RAISES(Invalid, Parse(parser, "a,b,c,d,e\n", &out_size));
+  }
+  {
+    // Empty lines
+    auto options = ParseOptions::Defaults();
+    options.ignore_empty_lines = false;
+    BlockParser parser(default_memory_pool(), options, 2, kMaxParserNumRows, {1});
+    AssertParseOk(parser, "a,b\n\nc,d\n");
+    AssertColumnEq(parser, 1, {"b", "", "d"});
+  }
+}
+
+TEST(BlockParser, ColumnSelectionLotsOfRows) {
+  // Several values chunks
+  std::string csv;
+  std::vector<std::string> expected;
+  for (int32_t i = 0; i < 5000; ++i) {
+    csv += std::to_string(i) + ",\"x\"," + std::to_string(-i) + "\n";
+    expected.push_back(std::to_string(-i));
+  }
+  BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), 3,
+                     kMaxParserNumRows, {2});
+  AssertParseOk(parser, csv);
+  AssertColumnEq(parser, 2, expected);
+}
+
 }  // namespace csv
 }  // namespace arrow
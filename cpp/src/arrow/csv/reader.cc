@@ -17,6 +17,7 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -453,6 +454,16 @@ class ReaderMixin {
         }
       }
     }
+
+    for (const auto& column : conversion_schema_.columns) {
+      if (!column.is_missing) {
+        parsed_column_indices_.push_back(column.index);
+      }
+    }
+    std::sort(parsed_column_indices_.begin(), parsed_column_indices_.end());
+    parsed_column_indices_.erase(
+        std::unique(parsed_column_indices_.begin(), parsed_column_indices_.end()),
+        parsed_column_indices_.end());
     return Status::OK();
   }
 
@@ -466,8 +477,16 @@ class ReaderMixin {
                             const std::shared_ptr<Buffer>& block, int64_t block_index,
                             bool is_final) {
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser = std::make_shared<BlockParser>(io_context_.pool(), parse_options_,
-                                                num_csv_cols_, max_num_rows);
+    std::shared_ptr<BlockParser> parser;
+    if (parsed_column_indices_.size() < static_cast<size_t>(num_csv_cols_)) {
+      // Only store the values of the converted columns
+      parser = std::make_shared<BlockParser>(io_context_.pool(), parse_options_,
+                                             num_csv_cols_, max_num_rows,
+                                             parsed_column_indices_);
+    } else {
+      parser = std::make_shared<BlockParser>(io_context_.pool(), parse_options_,
+                                             num_csv_cols_, max_num_rows);
+    }
 
     std::shared_ptr<Buffer> straddling;
     std::vector<util::string_view> views;
@@ -503,6 +522,8 @@ class ReaderMixin {
   // Column names in the CSV file
   std::vector<std::string> column_names_;
   ConversionSchema conversion_schema_;
+  // Indices of the CSV columns used by the conversion schema
+  std::vector<int32_t> parsed_column_indices_;
 
   std::shared_ptr<io::InputStream> input_;
   std::shared_ptr<internal::TaskGroup> task_group_;
@@ -823,6 +844,154 @@ class SerialStreamingReader : public BaseStreamingReader,
   AsyncGenerator<CSVBlock> block_generator_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Threaded StreamingReader implementation
+
+// A CSV block whose parsing and conversion has been launched on the CPU executor
+using PendingBlock = util::optional<Future<>>;
+
+class ThreadedStreamingReader
+    : public BaseStreamingReader,
+      public std::enable_shared_from_this<ThreadedStreamingReader> {
+ public:
+  using BaseStreamingReader::BaseStreamingReader;
+
+  Future<std::shared_ptr<csv::StreamingReader>> Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    max_readahead_ = std::max(1, cpu_executor_->GetCapacity());
+    int readahead_restart = std::max(1, max_readahead_ / 2);
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto bg_it, MakeBackgroundGenerator(std::move(istream_it), io_context_.executor(),
+                                            max_readahead_, readahead_restart));
+
+    auto transferred_it = MakeTransferredGenerator(bg_it, cpu_executor_);
+    buffer_generator_ = CSVBufferIterator::MakeAsync(std::move(transferred_it));
+    // Column decoders convert inline, from the parsing task of each block, so that
+    // a block is entirely converted once its task is finished.  Decoder tasks
+    // never fail (conversion errors are stored in the decoded chunks) and cannot
+    // be cancelled, so the serial task group can be shared between parsing tasks.
+    task_group_ = internal::TaskGroup::MakeSerial(StopToken::Unstoppable());
+
+    auto self = shared_from_this();
+    // Read schema from first batch.  The first block is converted alone, so that
+    // the inferred column types are frozen before other blocks are launched.
+    return SetupReader(self).Then(
+        [self](...) -> Result<std::shared_ptr<csv::StreamingReader>> {
+          ARROW_ASSIGN_OR_RAISE(self->pending_batch_, self->DecodeNextBatch());
+          DCHECK_NE(self->schema_, nullptr);
+          return self;
+        });
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
+    if (eof_) {
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+    }
+    if (io_context_.stop_token().IsStopRequested()) {
+      eof_ = true;
+      return io_context_.stop_token().Poll();
+    }
+    return ReadNextSkippingEmpty(shared_from_this());
+  }
+
+ protected:
+  Future<std::shared_ptr<RecordBatch>> DoReadNext(
+      std::shared_ptr<ThreadedStreamingReader> self) {
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(batch);
+    }
+    // Blocks are yielded in order, so the chunks of the next block are
+    // decoded once its task is finished.
+    return pending_block_generator_().Then(
+        [self](const PendingBlock& pending) -> Future<std::shared_ptr<RecordBatch>> {
+          if (IsIterationEnd(pending)) {
+            self->eof_ = true;
+            return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+          }
+          return pending->Then(
+              [self](...) { return self->DecodeNextBatch(); },
+              [self](const Status& st) -> Result<std::shared_ptr<RecordBatch>> {
+                // Parse error => bail out
+                self->eof_ = true;
+                return st;
+              });
+        });
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextSkippingEmpty(
+      std::shared_ptr<ThreadedStreamingReader> self) {
+    return DoReadNext(self).Then([self](const std::shared_ptr<RecordBatch>& batch) {
+      if (batch != nullptr && batch->num_rows() == 0) {
+        return self->ReadNextSkippingEmpty(self);
+      }
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(batch);
+    });
+  }
+
+  // Launch parsing and conversion of a block on the CPU executor
+  Future<> LaunchBlock(const CSVBlock& block) {
+    DCHECK(!block.consume_bytes);
+    auto self = shared_from_this();
+    return DeferNotOk(
+        cpu_executor_->Submit(io_context_.stop_token(), [self, block]() -> Status {
+          return self
+              ->ParseAndInsert(block.partial, block.completion, block.buffer,
+                               block.block_index, block.is_final)
+              .status();
+        }));
+  }
+
+  Future<> SetupReader(std::shared_ptr<ThreadedStreamingReader> self) {
+    return buffer_generator_()
+        .Then([self](const std::shared_ptr<Buffer>& first_buffer) -> Future<CSVBlock> {
+          if (first_buffer == nullptr) {
+            return Status::Invalid("Empty CSV file");
+          }
+          auto own_first_buffer = first_buffer;
+          RETURN_NOT_OK(self->ProcessHeader(own_first_buffer, &own_first_buffer));
+          RETURN_NOT_OK(self->MakeColumnDecoders());
+
+          self->block_generator_ = ThreadedBlockReader::MakeAsyncIterator(
+              std::move(self->buffer_generator_), MakeChunker(self->parse_options_),
+              std::move(own_first_buffer));
+          return self->block_generator_();
+        })
+        .Then([self](const CSVBlock& first_block) -> Future<> {
+          // The first buffer is never empty, so there is always a first block
+          DCHECK(!IsIterationEnd(first_block));
+          DCHECK_EQ(first_block.block_index, 0);
+          auto first_block_done = self->LaunchBlock(first_block);
+
+          // Launch the following blocks as they are read, up to max_readahead_
+          // blocks ahead of the consumer.  The generator is owned by the reader,
+          // so it must not keep the reader alive.
+          std::weak_ptr<ThreadedStreamingReader> weak_self = self;
+          std::function<PendingBlock(const CSVBlock&)> launch_block =
+              [weak_self](const CSVBlock& block) -> PendingBlock {
+            auto self = weak_self.lock();
+            if (!self) {
+              return Future<>::MakeFinished(
+                  Status::Cancelled("CSV StreamingReader was destroyed"));
+            }
+            return self->LaunchBlock(block);
+          };
+          self->pending_block_generator_ = MakeSerialReadaheadGenerator(
+              MakeMappedGenerator(std::move(self->block_generator_),
+                                  std::move(launch_block)),
+              self->max_readahead_);
+          return first_block_done;
+        });
+  }
+
+  int max_readahead_ = 1;
+  AsyncGenerator<CSVBlock> block_generator_;
+  AsyncGenerator<PendingBlock> pending_block_generator_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -926,18 +1095,28 @@ class AsyncThreadedTableReader
 
     auto self = shared_from_this();
     return ProcessFirstBuffer().Then([self](std::shared_ptr<Buffer> first_buffer) {
+      // With newlines in values, line boundaries can only be found by lexing
+      // the whole file serially.  Instead, they are guessed and the parsed
+      // blocks are validated in order (see ValidateSpeculativeBlock).
+      const bool speculative = self->parse_options_.newlines_in_values;
       auto block_generator = ThreadedBlockReader::MakeAsyncIterator(
-          self->buffer_generator_, MakeChunker(self->parse_options_),
+          self->buffer_generator_,
+          speculative ? MakeSpeculativeChunker(self->parse_options_)
+                      : MakeChunker(self->parse_options_),
           std::move(first_buffer));
 
       std::function<Status(CSVBlock)> block_visitor =
-          [self](CSVBlock maybe_block) -> Status {
+          [self, speculative](CSVBlock maybe_block) -> Status {
         // The logic in VisitAsyncGenerator ensures that we will never be
         // passed an empty block (visit does not call with the end token) so
         // we can be assured maybe_block has a value.
         DCHECK_GE(maybe_block.block_index, 0);
         DCHECK(!maybe_block.consume_bytes);
 
+        if (speculative) {
+          self->LaunchSpeculativeBlock(maybe_block);
+          return Status::OK();
+        }
         // Launch parse task
         self->task_group_->Append([self, maybe_block] {
           return self
@@ -950,12 +1129,23 @@ class AsyncThreadedTableReader
       };
 
       return VisitAsyncGenerator(std::move(block_generator), block_visitor)
+          .Then(
+              [self](...) -> Future<> {
+                // Speculative blocks add conversion tasks once validated
+                return self->speculation_;
+              },
+              [self](const Status& st) -> Future<> {
+                // Don't leave speculative blocks running
+                return self->speculation_.Then(
+                    [self, st](...) { self->speculation_status_ &= st; });
+              })
           .Then([self](...) -> Future<> {
             // By this point we've added all top level tasks so it is safe to call
             // FinishAsync
             return self->task_group_->FinishAsync();
           })
           .Then([self](...) -> Result<std::shared_ptr<Table>> {
+            RETURN_NOT_OK(self->speculation_status_);
             // Finish conversion, create schema and table
             return self->MakeTable();
           });
@@ -963,6 +1153,69 @@ class AsyncThreadedTableReader
   }
 
  protected:
+  // Parse a speculatively chunked block on the CPU executor, and validate it
+  // after all previous blocks
+  void LaunchSpeculativeBlock(const CSVBlock& block) {
+    auto self = shared_from_this();
+    // The block is not parsed as final, since a line that doesn't end where
+    // it was guessed would be truncated
+    auto parsed = DeferNotOk(cpu_executor_->Submit(
+        io_context_.stop_token(), [self, block]() -> Result<ParseResult> {
+          return self->Parse(block.partial, block.completion, block.buffer,
+                             block.block_index, /*is_final=*/false);
+        }));
+    // The chain of validations doesn't fail, so that it always waits for
+    // all parse tasks
+    speculation_ = speculation_.Then([self, block, parsed](...) -> Future<> {
+      return parsed.Then(
+          [self, block](const ParseResult& result) {
+            self->speculation_status_ &= self->ValidateSpeculativeBlock(block, result);
+          },
+          [self, block](const Status& st) {
+            self->speculation_status_ &= self->ValidateSpeculativeBlock(block, st);
+          });
+    });
+  }
+
+  // A speculative block starts on a line boundary if all previous blocks were
+  // parsed entirely, in which case its parse result is valid (even if it's an
+  // error).  Otherwise, the unparsed end of the previous block starts a line
+  // spanning over this block, and both are parsed again together.
+  Status ValidateSpeculativeBlock(const CSVBlock& block,
+                                  Result<ParseResult> maybe_result) {
+    if (!speculation_status_.ok()) {
+      return Status::OK();
+    }
+    const int64_t block_size =
+        block.partial->size() + block.completion->size() + block.buffer->size();
+    if (unparsed_ != nullptr || (block.is_final && maybe_result.ok() &&
+                                 maybe_result->parsed_bytes < block_size)) {
+      BufferVector buffers = {block.partial, block.completion, block.buffer};
+      if (unparsed_ != nullptr) {
+        buffers.insert(buffers.begin(), unparsed_);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto data, ConcatenateBuffers(buffers, io_context_.pool()));
+      auto empty = SliceBuffer(data, 0, 0);
+      ARROW_ASSIGN_OR_RAISE(
+          auto result, Parse(empty, empty, data, block.block_index, block.is_final));
+      unparsed_ = result.parsed_bytes < data->size()
+                      ? SliceBuffer(data, result.parsed_bytes)
+                      : nullptr;
+      return ProcessData(result.parser, block.block_index);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto result, std::move(maybe_result));
+    if (result.parsed_bytes < block_size) {
+      // Mispredicted end of block
+      ARROW_ASSIGN_OR_RAISE(
+          auto data,
+          ConcatenateBuffers({block.partial, block.completion, block.buffer},
+                             io_context_.pool()));
+      unparsed_ = SliceBuffer(data, result.parsed_bytes);
+    }
+    return ProcessData(result.parser, block.block_index);
+  }
+
   Future<std::shared_ptr<Buffer>> ProcessFirstBuffer() {
     // First block
     auto first_buffer_future = buffer_generator_();
@@ -980,6 +1233,11 @@ class AsyncThreadedTableReader
 
   Executor* cpu_executor_;
   AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator_;
+  // Validation of the speculative blocks launched so far, and its first error
+  Future<> speculation_ = Future<>::MakeFinished();
+  Status speculation_status_;
+  // Unparsed end of the last validated speculative block
+  std::shared_ptr<Buffer> unparsed_;
 };
 
 Result<std::shared_ptr<TableReader>> MakeTableReader(
@@ -1004,8 +1262,13 @@ Future<std::shared_ptr<StreamingReader>> MakeStreamingReader(
     internal::Executor* cpu_executor, const ReadOptions& read_options,
     const ParseOptions& parse_options, const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(
-      io_context, cpu_executor, input, read_options, parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        io_context, cpu_executor, input, read_options, parse_options, convert_options);
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(
+        io_context, cpu_executor, input, read_options, parse_options, convert_options);
+  }
   return reader->Init();
 }
 
@@ -69,8 +69,10 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
   /// This involves some I/O as the first batch must be loaded during the creation process
   /// so it is returned as a future
   ///
-  /// Currently, the StreamingReader is not async-reentrant and does not do any fan-out
-  /// parsing (see ARROW-11889)
+  /// The StreamingReader is not async-reentrant.  If ReadOptions::use_threads is
+  /// true, blocks are parsed and converted in parallel on `cpu_executor`, with
+  /// a bounded readahead, and batches are still yielded in file order.  Inferred
+  /// column types are decided on the first block.
   static Future<std::shared_ptr<StreamingReader>> MakeAsync(
       io::IOContext io_context, std::shared_ptr<io::InputStream> input,
       internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&,
@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end CSV ingest benchmarks: compressed bytes -> CompressedInputStream
+// -> TableReader -> Table.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace csv {
+
+// Total number of cells in each generated dataset, so that narrow and wide
+// datasets have comparable sizes.
+constexpr int64_t kNumCells = 1 << 20;
+
+enum TypeMix { kAllIntegers = 0, kMixedTypes = 1, kAllStrings = 2 };
+
+// Generate CSV data with `num_cols` columns.  `quoted_percent` percent of the
+// string cells are quoted and contain a delimiter.
+static std::string BuildCSVData(int32_t num_cols, int32_t quoted_percent,
+                                TypeMix type_mix) {
+  std::default_random_engine engine(0x5EED);
+  std::uniform_int_distribution<int64_t> ints(-1000000, 1000000);
+  std::uniform_int_distribution<int32_t> percent(0, 99);
+  std::uniform_int_distribution<int32_t> days(0, 27);
+
+  const int64_t num_rows = kNumCells / num_cols;
+  std::stringstream ss;
+  for (int32_t col = 0; col < num_cols; ++col) {
+    ss << (col ? "," : "") << "col" << col;
+  }
+  ss << "\n";
+
+  for (int64_t row = 0; row < num_rows; ++row) {
+    for (int32_t col = 0; col < num_cols; ++col) {
+      if (col) ss << ",";
+      int32_t kind = type_mix == kMixedTypes ? col % 4 : (type_mix == kAllStrings) * 2;
+      switch (kind) {
+        case 0:
+          ss << ints(engine);
+          break;
+        case 1:
+          ss << ints(engine) / 100 << "." << percent(engine);
+          break;
+        case 2:
+          if (percent(engine) < quoted_percent) {
+            ss << "\"str," << ints(engine) << "\"";
+          } else {
+            ss << "str" << ints(engine);
+          }
+          break;
+        default: {
+          const int32_t day = days(engine) + 1;
+          ss << "2021-02-" << (day < 10 ? "0" : "") << day << " 12:34:56";
+          break;
+        }
+      }
+    }
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+static std::shared_ptr<Buffer> Compress(const std::string& data,
+                                        Compression::type compression) {
+  if (compression == Compression::UNCOMPRESSED) {
+    return Buffer::FromString(data);
+  }
+  auto codec = *util::Codec::Create(compression);
+  auto sink = *io::BufferOutputStream::Create();
+  auto stream = *io::CompressedOutputStream::Make(codec.get(), sink);
+  ABORT_NOT_OK(stream->Write(data.data(), static_cast<int64_t>(data.size())));
+  ABORT_NOT_OK(stream->Close());
+  return *sink->Finish();
+}
+
+// Arguments: number of columns, percentage of quoted string cells, TypeMix,
+// use_threads, block size in KiB, Compression::type
+static void ReadCSV(benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_cols = static_cast<int32_t>(state.range(0));
+  const auto quoted_percent = static_cast<int32_t>(state.range(1));
+  const auto type_mix = static_cast<TypeMix>(state.range(2));
+  const auto compression = static_cast<Compression::type>(state.range(5));
+  if (!util::Codec::IsAvailable(compression)) {
+    state.SkipWithError("Codec not available");
+    return;
+  }
+
+  const std::string csv = BuildCSVData(num_cols, quoted_percent, type_mix);
+  const auto compressed = Compress(csv, compression);
+  std::unique_ptr<util::Codec> codec;
+  if (compression != Compression::UNCOMPRESSED) {
+    codec = *util::Codec::Create(compression);
+  }
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(3) != 0;
+  read_options.block_size = static_cast<int32_t>(state.range(4) * 1024);
+  auto parse_options = ParseOptions::Defaults();
+  auto convert_options = ConvertOptions::Defaults();
+
+  for (auto _ : state) {
+    std::shared_ptr<io::InputStream> input =
+        std::make_shared<io::BufferReader>(compressed);
+    if (codec) {
+      input = *io::CompressedInputStream::Make(codec.get(), input);
+    }
+    auto reader = *TableReader::Make(io::default_io_context(), input, read_options,
+                                     parse_options, convert_options);
+    auto table = *reader->Read();
+    if (table->num_columns() != num_cols) {
+      std::cerr << "Read incomplete\n";
+      std::abort();
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * csv.size());
+  state.counters["compression_ratio"] =
+      static_cast<double>(csv.size()) / static_cast<double>(compressed->size());
+}
+
+static void ReadCSVArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "quoted%", "types", "threads", "block_kb", "codec"});
+  // Shape and content of the data
+  for (const int64_t num_cols : {4, 64, 512}) {
+    for (const int64_t quoted_percent : {0, 50}) {
+      for (const int64_t type_mix : {kAllIntegers, kMixedTypes, kAllStrings}) {
+        bench->Args({num_cols, quoted_percent, type_mix, 1, 1024,
+                     Compression::UNCOMPRESSED});
+      }
+    }
+  }
+  // Threading, block size and compression
+  for (const int64_t use_threads : {0, 1}) {
+    for (const int64_t block_kb : {64, 256, 1024, 4096}) {
+      for (const int64_t compression :
+           {Compression::UNCOMPRESSED, Compression::GZIP, Compression::ZSTD,
+            Compression::LZ4_FRAME}) {
+        bench->Args({64, 10, kMixedTypes, use_threads, block_kb, compression});
+      }
+    }
+  }
+}
+
+BENCHMARK(ReadCSV)->Apply(ReadCSVArgs)->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
@@ -23,16 +23,19 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/reader.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/thread_pool.h"
 
@@ -42,6 +45,8 @@ using RecordBatchGenerator = AsyncGenerator<std::shared_ptr<RecordBatch>>;
 
 namespace csv {
 
+using internal::checked_cast;
+
 // Allows the streaming reader to be used in tests that expect a table reader
 class StreamingReaderAsTableReader : public TableReader {
  public:
@@ -152,6 +157,108 @@ TableReaderFactory MakeSerialFactory() {
   };
 }
 
+void TestIncludeColumns(TableReaderFactory reader_factory) {
+  // The parser only stores values for the included columns
+  std::string csv = "a,b,c,d\n";
+  std::vector<int64_t> a_values, d_values;
+  for (int i = 0; i < 1000; ++i) {
+    csv += std::to_string(i) + ",\"x,\"\"\",y," + std::to_string(-i) + "\n";
+    a_values.push_back(i);
+    d_values.push_back(-i);
+  }
+  auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+  ASSERT_OK_AND_ASSIGN(auto reader, reader_factory(input));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->Read());
+  ASSERT_OK(table->ValidateFull());
+  AssertSchemaEqual(
+      *table->schema(),
+      *schema({field("d", int64()), field("a", int64()), field("e", null())}));
+  std::shared_ptr<Array> expected_a, expected_d;
+  ArrayFromVector<Int64Type>(a_values, &expected_a);
+  ArrayFromVector<Int64Type>(d_values, &expected_d);
+  AssertChunkedEquivalent(ChunkedArray({expected_d}), *table->column(0));
+  AssertChunkedEquivalent(ChunkedArray({expected_a}), *table->column(1));
+  ASSERT_EQ(table->column(2)->null_count(), 1000);
+}
+
+TableReaderFactory MakeIncludeColumnsFactory(bool use_threads) {
+  return [use_threads](std::shared_ptr<io::InputStream> input_stream)
+             -> Result<std::shared_ptr<TableReader>> {
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = 1 << 10;
+    read_options.use_threads = use_threads;
+    auto convert_options = ConvertOptions::Defaults();
+    convert_options.include_columns = {"d", "a", "e"};
+    convert_options.include_missing_columns = true;
+    return TableReader::Make(io::default_io_context(), input_stream, read_options,
+                             ParseOptions::Defaults(), convert_options);
+  };
+}
+
+TEST(SerialReaderTests, IncludeColumns) {
+  TestIncludeColumns(MakeIncludeColumnsFactory(/*use_threads=*/false));
+}
+
+TEST(AsyncReaderTests, IncludeColumns) {
+  TestIncludeColumns(MakeIncludeColumnsFactory(/*use_threads=*/true));
+}
+
+Result<std::shared_ptr<Table>> ReadNewlinesInValues(const std::string& csv,
+                                                    bool use_threads, bool escaping) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.block_size = 256;
+  read_options.use_threads = use_threads;
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  parse_options.escaping = escaping;
+  auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader, TableReader::Make(io::default_io_context(), std::move(input),
+                                     read_options, parse_options,
+                                     ConvertOptions::Defaults()));
+  return reader->Read();
+}
+
+void TestNewlinesInValues(bool escaping) {
+  // The threaded reader guesses line boundaries from quote parity, which
+  // some of these lines defeat
+  const int NROWS = 2000;
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < NROWS; ++i) {
+    csv += std::to_string(i);
+    switch (i % 5) {
+      case 0:
+        csv += ",\"x\ny\",z\n";
+        break;
+      case 1:
+        csv += ",\"\"\"\n\"\"\",z\n";
+        break;
+      case 2:
+        // Quote inside a non-quoted field
+        csv += ",x\"y,\"\n\n\"\n";
+        break;
+      case 3:
+        csv += escaping ? ",x\\\ny\\\",z\n" : ",,z\r\n";
+        break;
+      default:
+        csv += ",,\n";
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ReadNewlinesInValues(csv, false, escaping));
+  ASSERT_EQ(expected->num_rows(), NROWS);
+  ASSERT_OK_AND_ASSIGN(auto actual, ReadNewlinesInValues(csv, true, escaping));
+  ASSERT_OK(actual->ValidateFull());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  // Parse error after mispredicted block boundaries
+  csv += "1,\"x\ny\",z,2\n";
+  ASSERT_RAISES(Invalid, ReadNewlinesInValues(csv, true, escaping));
+}
+
+TEST(AsyncReaderTests, NewlinesInValues) { TestNewlinesInValues(false); }
+
+TEST(AsyncReaderTests, NewlinesInValuesEscaping) { TestNewlinesInValues(true); }
+
 TEST(SerialReaderTests, Stress) { StressTableReader(MakeSerialFactory()); }
 TEST(SerialReaderTests, StressInvalid) { StressInvalidTableReader(MakeSerialFactory()); }
 TEST(SerialReaderTests, NestedParallelism) {
@@ -190,11 +297,12 @@ TEST(AsyncReaderTests, NestedParallelism) {
   TestNestedParallelism(thread_pool, table_factory);
 }
 
-Result<TableReaderFactory> MakeStreamingFactory() {
-  return [](std::shared_ptr<io::InputStream> input_stream)
+Result<TableReaderFactory> MakeStreamingFactory(bool use_threads = true) {
+  return [use_threads](std::shared_ptr<io::InputStream> input_stream)
              -> Result<std::shared_ptr<TableReader>> {
     auto read_options = ReadOptions::Defaults();
     read_options.block_size = 1 << 10;
+    read_options.use_threads = use_threads;
     ARROW_ASSIGN_OR_RAISE(
         auto streaming_reader,
         StreamingReader::Make(io::default_io_context(), input_stream, read_options,
@@ -217,5 +325,115 @@ TEST(StreamingReaderTests, NestedParallelism) {
   TestNestedParallelism(thread_pool, table_factory);
 }
 
+TEST(SerialStreamingReaderTests, Stress) {
+  ASSERT_OK_AND_ASSIGN(auto table_factory, MakeStreamingFactory(false));
+  StressTableReader(table_factory);
+}
+TEST(SerialStreamingReaderTests, StressInvalid) {
+  ASSERT_OK_AND_ASSIGN(auto table_factory, MakeStreamingFactory(false));
+  StressInvalidTableReader(table_factory);
+}
+TEST(SerialStreamingReaderTests, NestedParallelism) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(1));
+  ASSERT_OK_AND_ASSIGN(auto table_factory, MakeStreamingFactory(false));
+  TestNestedParallelism(thread_pool, table_factory);
+}
+
+Result<std::shared_ptr<StreamingReader>> MakeThreadedStreamingReader(
+    internal::Executor* cpu_executor, const std::string& csv, int32_t block_size) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.block_size = block_size;
+  read_options.use_threads = true;
+  auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+  return StreamingReader::MakeAsync(io::default_io_context(), std::move(input),
+                                    cpu_executor, read_options, ParseOptions::Defaults(),
+                                    ConvertOptions::Defaults())
+      .result();
+}
+
+TEST(ThreadedStreamingReaderTests, BatchOrder) {
+  const int NROWS = 5000;
+  std::string csv = "a,b\n";
+  for (int i = 0; i < NROWS; ++i) {
+    csv += std::to_string(i) + ",x" + std::to_string(i) + "\n";
+  }
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeThreadedStreamingReader(thread_pool.get(), csv, 256));
+  AssertSchemaEqual(*reader->schema(),
+                    *schema({field("a", int64()), field("b", utf8())}));
+
+  int64_t expected = 0;
+  int num_batches = 0;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_GT(batch->num_rows(), 0);
+    const auto& a = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < a.length(); ++i) {
+      ASSERT_EQ(a.Value(i), expected++);
+    }
+    ++num_batches;
+  }
+  ASSERT_EQ(expected, NROWS);
+  ASSERT_GT(num_batches, 10);
+  // EOF is sticky
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST(ThreadedStreamingReaderTests, TypesInferredFromFirstBlock) {
+  // The first block only has integers, a later one has a float
+  std::string csv = "a\n";
+  for (int i = 0; i < 1000; ++i) {
+    csv += std::to_string(i) + "\n";
+  }
+  csv += "1.5\n";
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeThreadedStreamingReader(thread_pool.get(), csv, 256));
+  AssertSchemaEqual(*reader->schema(), *schema({field("a", int64())}));
+
+  Status st;
+  while (st.ok()) {
+    std::shared_ptr<RecordBatch> batch;
+    st = reader->ReadNext(&batch);
+    if (batch == nullptr) {
+      break;
+    }
+    AssertSchemaEqual(*batch->schema(), *reader->schema());
+  }
+  ASSERT_RAISES(Invalid, st);
+}
+
+TEST(ThreadedStreamingReaderTests, ParseError) {
+  std::string csv = "a,b\n";
+  for (int i = 0; i < 1000; ++i) {
+    csv += (i == 500) ? "1,2,3\n" : "1,2\n";
+  }
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeThreadedStreamingReader(thread_pool.get(), csv, 256));
+  Status st;
+  int64_t num_rows = 0;
+  while (st.ok()) {
+    std::shared_ptr<RecordBatch> batch;
+    st = reader->ReadNext(&batch);
+    if (batch == nullptr) {
+      break;
+    }
+    num_rows += batch->num_rows();
+  }
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_LE(num_rows, 500);
+  // The reader stops after an error
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
 }  // namespace csv
 }  // namespace arrow
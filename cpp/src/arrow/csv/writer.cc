@@ -16,6 +16,12 @@
 // under the License.
 
 #include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
 #include "arrow/array.h"
 #include "arrow/compute/cast.h"
 #include "arrow/io/interfaces.h"
@@ -23,9 +29,12 @@
 #include "arrow/result.h"
 #include "arrow/result_internal.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/visitor_inline.h"
 
@@ -38,16 +47,21 @@ namespace csv {
 // The algorithm used here at a high level is to break RecordBatches/Tables into slices
 // and convert each slice independently.  A slice is then converted to CSV by first
 // scanning each column to determine the size of its contents when rendered as a string in
-// CSV. For non-string types this requires casting the value to string (which is cached).
-// This data is used to understand the precise length of each row and a single allocation
-// for the final CSV data buffer. Once the final size is known each column is then
-// iterated over again to place its contents into the CSV data buffer. The rationale for
-// choosing this approach is it allows for reuse of the cast functionality in the compute
-// module and inline data visiting functionality in the core library. A performance
-// comparison has not been done using a naive single-pass approach. This approach might
-// still be competitive due to reduction in the number of per row branches necessary with
-// a single pass approach. Profiling would likely yield further opportunities for
-// optimization with this approach.
+// CSV. Integer and floating-point values are formatted directly (into the output
+// buffer, or a fixed-size scratch area for floating-point values); other non-string
+// types are cast to string (which is cached).  This data is used to understand the
+// precise length of each row and a single allocation for the final CSV data buffer.
+// Once the final size is known each column is then iterated over again to place its
+// contents into the CSV data buffer. The rationale for choosing this approach is it
+// allows for reuse of the cast functionality in the compute module and inline data
+// visiting functionality in the core library. A performance comparison has not been
+// done using a naive single-pass approach. This approach might still be competitive
+// due to reduction in the number of per row branches necessary with a single pass
+// approach. Profiling would likely yield further opportunities for optimization with
+// this approach.
+//
+// Slices are independent, so with WriteOptions::use_threads they are converted in
+// parallel on the CPU thread pool, and written to the output in order.
 
 namespace {
 
@@ -93,14 +107,7 @@ class ColumnPopulator {
   // Adds the number of characters each entry in data will add to to elements
   // in row_lengths.
   Status UpdateRowLengths(const Array& data, int32_t* row_lengths) {
-    compute::ExecContext ctx(pool_);
-    // Populators are intented to be applied to reasonably small data.  In most cases
-    // threading overhead would not be justified.
-    ctx.set_use_threads(false);
-    ASSIGN_OR_RAISE(
-        std::shared_ptr<Array> casted,
-        compute::Cast(data, /*to_type=*/utf8(), compute::CastOptions(), &ctx));
-    casted_array_ = internal::checked_pointer_cast<StringArray>(casted);
+    RETURN_NOT_OK(SetData(data));
     return UpdateRowLengths(row_lengths);
   }
 
@@ -113,6 +120,19 @@ class ColumnPopulator {
   virtual void PopulateColumns(char* output, int32_t* offsets) const = 0;
 
  protected:
+  // Prepares the column data.  By default, data is cast to string.
+  virtual Status SetData(const Array& data) {
+    compute::ExecContext ctx(pool_);
+    // Populators are intented to be applied to reasonably small data.  In most cases
+    // threading overhead would not be justified.
+    ctx.set_use_threads(false);
+    ASSIGN_OR_RAISE(
+        std::shared_ptr<Array> casted,
+        compute::Cast(data, /*to_type=*/utf8(), compute::CastOptions(), &ctx));
+    casted_array_ = internal::checked_pointer_cast<StringArray>(casted);
+    return Status::OK();
+  }
+
   virtual Status UpdateRowLengths(int32_t* row_lengths) = 0;
   std::shared_ptr<StringArray> casted_array_;
   const char end_char_;
@@ -168,6 +188,119 @@ class UnquotedColumnPopulator : public ColumnPopulator {
   }
 };
 
+// Populator for integer types.  Digits are counted when updating row lengths, and
+// formatted directly into the output.
+template <typename Type>
+class IntegerColumnPopulator : public ColumnPopulator {
+ public:
+  using c_type = typename Type::c_type;
+
+  IntegerColumnPopulator(MemoryPool* pool, char end_char)
+      : ColumnPopulator(pool, end_char) {}
+
+  void PopulateColumns(char* output, int32_t* offsets) const override {
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](c_type value) {
+          char* cursor = output + *offsets - 1;
+          *cursor = end_char_;
+          internal::detail::FormatAllDigits(internal::detail::Abs(value), &cursor);
+          if (value < 0) {
+            internal::detail::FormatOneChar('-', &cursor);
+          }
+          *offsets = static_cast<int32_t>(cursor - output);
+          offsets++;
+        },
+        [&]() {
+          // Nulls are empty (unquoted) to distinguish with empty string.
+          *(output + *offsets - 1) = end_char_;
+          *offsets -= 1;
+          offsets++;
+        });
+  }
+
+ protected:
+  Status SetData(const Array& data) override {
+    data_ = data.data();
+    return Status::OK();
+  }
+
+  Status UpdateRowLengths(int32_t* row_lengths) override {
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](c_type value) {
+          auto abs_value = internal::detail::Abs(value);
+          int32_t length = (value < 0) ? 2 : 1;
+          while (abs_value >= 10) {
+            abs_value /= 10;
+            ++length;
+          }
+          *row_lengths++ += length;
+        },
+        [&]() { row_lengths++; });
+    return Status::OK();
+  }
+
+  std::shared_ptr<ArrayData> data_;
+};
+
+// Populator for floating-point types.  Values are formatted once, when updating
+// row lengths, into a scratch area with a fixed size per value.
+template <typename Type>
+class FloatingPointColumnPopulator : public ColumnPopulator {
+ public:
+  using c_type = typename Type::c_type;
+  using FormatterType = internal::StringFormatter<Type>;
+
+  FloatingPointColumnPopulator(MemoryPool* pool, char end_char)
+      : ColumnPopulator(pool, end_char) {}
+
+  void PopulateColumns(char* output, int32_t* offsets) const override {
+    for (size_t row = 0; row < lengths_.size(); ++row) {
+      // Nulls have a zero length: they are empty (unquoted) to distinguish
+      // with empty string.
+      const int32_t length = lengths_[row];
+      char* row_end = output + offsets[row];
+      memcpy(row_end - length - 1, scratch_.data() + row * kMaxLength, length);
+      *(row_end - 1) = end_char_;
+      offsets[row] -= length + /*end_char*/ 1;
+    }
+  }
+
+ protected:
+  static constexpr int kMaxLength = FormatterType::buffer_size;
+
+  Status SetData(const Array& data) override {
+    data_ = data.data();
+    return Status::OK();
+  }
+
+  Status UpdateRowLengths(int32_t* row_lengths) override {
+    lengths_.resize(data_->length);
+    scratch_.resize(data_->length * kMaxLength);
+    char* value_out = scratch_.data();
+    int32_t* length_out = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](c_type value) {
+          *length_out = formatter_.FormatFloat(value, value_out, kMaxLength);
+          *row_lengths++ += *length_out++;
+          value_out += kMaxLength;
+        },
+        [&]() {
+          *length_out++ = 0;
+          row_lengths++;
+          value_out += kMaxLength;
+        });
+    return Status::OK();
+  }
+
+  std::shared_ptr<ArrayData> data_;
+  FormatterType formatter_;
+  std::vector<int32_t> lengths_;
+  std::vector<char> scratch_;
+};
+
 // Strings need special handling to ensure they are escaped properly.
 // This class handles escaping assuming that all strings will be quoted
 // and that the only character within the string that needs to escaped is
@@ -239,10 +372,21 @@ class QuotedColumnPopulator : public ColumnPopulator {
   std::vector<bool> row_needs_escaping_;
 };
 
+template <typename T>
+using is_floating_point_formatted =
+    std::integral_constant<bool, std::is_same<FloatType, T>::value ||
+                                     std::is_same<DoubleType, T>::value>;
+
+template <typename T>
+using is_directly_formatted =
+    std::integral_constant<bool, is_integer_type<T>::value ||
+                                     is_floating_point_formatted<T>::value>;
+
 struct PopulatorFactory {
   template <typename TypeClass>
   enable_if_t<is_base_binary_type<TypeClass>::value ||
-                  std::is_same<FixedSizeBinaryType, TypeClass>::value,
+                  std::is_same<FixedSizeBinaryType, TypeClass>::value ||
+                  is_string_view_type<TypeClass>::value,
               Status>
   Visit(const TypeClass& type) {
     populator = new QuotedColumnPopulator(pool, end_char);
@@ -251,6 +395,8 @@ struct PopulatorFactory {
 
   template <typename TypeClass>
   enable_if_dictionary<TypeClass, Status> Visit(const TypeClass& type) {
+    // Dictionary values are decoded by the cast to string
+    cast_to_string = true;
     return VisitTypeInline(*type.value_type(), this);
   }
 
@@ -262,36 +408,101 @@ struct PopulatorFactory {
   }
 
   template <typename TypeClass>
-  enable_if_t<is_primitive_ctype<TypeClass>::value || is_decimal_type<TypeClass>::value ||
-                  is_null_type<TypeClass>::value || is_temporal_type<TypeClass>::value,
+  enable_if_t<(is_primitive_ctype<TypeClass>::value &&
+               !is_directly_formatted<TypeClass>::value) ||
+                  is_decimal_type<TypeClass>::value || is_null_type<TypeClass>::value ||
+                  is_temporal_type<TypeClass>::value,
               Status>
   Visit(const TypeClass& type) {
     populator = new UnquotedColumnPopulator(pool, end_char);
     return Status::OK();
   }
 
+  template <typename TypeClass>
+  enable_if_integer<TypeClass, Status> Visit(const TypeClass& type) {
+    if (cast_to_string) {
+      populator = new UnquotedColumnPopulator(pool, end_char);
+    } else {
+      populator = new IntegerColumnPopulator<TypeClass>(pool, end_char);
+    }
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_floating_point_formatted<TypeClass>::value, Status> Visit(
+      const TypeClass& type) {
+    if (cast_to_string) {
+      populator = new UnquotedColumnPopulator(pool, end_char);
+    } else {
+      populator = new FloatingPointColumnPopulator<TypeClass>(pool, end_char);
+    }
+    return Status::OK();
+  }
+
   char end_char;
   MemoryPool* pool;
   ColumnPopulator* populator;
+  bool cast_to_string;
 };
 
 Result<std::unique_ptr<ColumnPopulator>> MakePopulator(const Field& field, char end_char,
                                                        MemoryPool* pool) {
-  PopulatorFactory factory{end_char, pool, nullptr};
+  PopulatorFactory factory{end_char, pool, nullptr, /*cast_to_string=*/false};
   RETURN_NOT_OK(VisitTypeInline(*field.type(), &factory));
   return std::unique_ptr<ColumnPopulator>(factory.populator);
 }
 
+Result<std::vector<std::unique_ptr<ColumnPopulator>>> MakePopulators(
+    const Schema& schema, MemoryPool* pool) {
+  std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+  for (int col = 0; col < schema.num_fields(); col++) {
+    char end_char = col < schema.num_fields() - 1 ? ',' : '\n';
+    ASSIGN_OR_RAISE(populators[col], MakePopulator(*schema.field(col), end_char, pool));
+  }
+  return populators;
+}
+
+using OffsetVector = std::vector<int32_t, arrow::stl::allocator<int32_t>>;
+
+// Converts a non-empty batch to CSV data in `data_buffer`.
+Status TranslateMinimalBatch(
+    const RecordBatch& batch,
+    const std::vector<std::unique_ptr<ColumnPopulator>>& column_populators,
+    OffsetVector* offsets, ResizableBuffer* data_buffer) {
+  DCHECK_GT(batch.num_rows(), 0);
+  offsets->resize(batch.num_rows());
+  std::fill(offsets->begin(), offsets->end(), 0);
+
+  // Calculate relative offsets for each row (excluding delimiters)
+  for (int32_t col = 0; col < static_cast<int32_t>(column_populators.size()); col++) {
+    RETURN_NOT_OK(
+        column_populators[col]->UpdateRowLengths(*batch.column(col), offsets->data()));
+  }
+  // Calculate cumulalative offsets for each row (including delimiters).
+  (*offsets)[0] += batch.num_columns();
+  for (int64_t row = 1; row < batch.num_rows(); row++) {
+    (*offsets)[row] += (*offsets)[row - 1] + /*delimiter lengths*/ batch.num_columns();
+  }
+  // Resize the target buffer to required size. We assume batch to batch sizes
+  // should be pretty close so don't shrink the buffer to avoid allocation churn.
+  RETURN_NOT_OK(data_buffer->Resize(offsets->back(), /*shrink_to_fit=*/false));
+
+  // Use the offsets to populate contents.
+  for (auto populator = column_populators.rbegin(); populator != column_populators.rend();
+       populator++) {
+    (*populator)
+        ->PopulateColumns(reinterpret_cast<char*>(data_buffer->mutable_data()),
+                          offsets->data());
+  }
+  DCHECK_EQ(0, (*offsets)[0]);
+  return Status::OK();
+}
+
 class CSVConverter {
  public:
   static Result<std::unique_ptr<CSVConverter>> Make(std::shared_ptr<Schema> schema,
                                                     MemoryPool* pool) {
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    for (int col = 0; col < schema->num_fields(); col++) {
-      char end_char = col < schema->num_fields() - 1 ? ',' : '\n';
-      ASSIGN_OR_RAISE(populators[col],
-                      MakePopulator(*schema->field(col), end_char, pool));
-    }
+    ASSIGN_OR_RAISE(auto populators, MakePopulators(*schema, pool));
     return std::unique_ptr<CSVConverter>(
         new CSVConverter(std::move(schema), std::move(populators), pool));
   }
@@ -299,29 +510,17 @@ class CSVConverter {
   Status WriteCSV(const RecordBatch& batch, const WriteOptions& options,
                   io::OutputStream* out) {
     RETURN_NOT_OK(PrepareForContentsWrite(options, out));
-    RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options.batch_size);
-    for (auto maybe_slice : iterator) {
-      ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(out->Write(data_buffer_));
-    }
-    return Status::OK();
+    return WriteBatches(RecordBatchSliceIterator(batch, options.batch_size), options,
+                        out);
   }
 
   Status WriteCSV(const Table& table, const WriteOptions& options,
                   io::OutputStream* out) {
-    TableBatchReader reader(table);
-    reader.set_chunksize(options.batch_size);
+    auto reader = std::make_shared<TableBatchReader>(table);
+    reader->set_chunksize(options.batch_size);
     RETURN_NOT_OK(PrepareForContentsWrite(options, out));
-    std::shared_ptr<RecordBatch> batch;
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(out->Write(data_buffer_));
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-    }
-
-    return Status::OK();
+    return WriteBatches(MakeFunctionIterator([reader] { return reader->Next(); }),
+                        options, out);
   }
 
  private:
@@ -370,41 +569,80 @@ class CSVConverter {
     return out->Write(data_buffer_);
   }
 
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
+  Status WriteBatches(RecordBatchIterator batches, const WriteOptions& options,
+                      io::OutputStream* out) {
+    if (options.use_threads) {
+      return WriteBatchesParallel(std::move(batches), out);
     }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    for (auto maybe_batch : batches) {
+      ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch, maybe_batch);
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      RETURN_NOT_OK(TranslateMinimalBatch(*batch, column_populators_, &offsets_,
+                                          data_buffer_.get()));
+      RETURN_NOT_OK(out->Write(data_buffer_));
     }
-    // Calculate cumulalative offsets for each row (including delimiters).
-    offsets_[0] += batch.num_columns();
-    for (int64_t row = 1; row < batch.num_rows(); row++) {
-      offsets_[row] += offsets_[row - 1] + /*delimiter lengths*/ batch.num_columns();
+    return Status::OK();
+  }
+
+  // Convert batches on the CPU thread pool, while the calling thread writes the
+  // converted batches in order.  The number of batches in flight is bounded
+  // by twice the thread pool capacity.
+  Status WriteBatchesParallel(RecordBatchIterator batches, io::OutputStream* out) {
+    auto executor = internal::GetCpuThreadPool();
+    const size_t max_in_flight = static_cast<size_t>(2 * executor->GetCapacity());
+
+    std::deque<Future<std::shared_ptr<Buffer>>> in_flight;
+    Status st;
+    auto write_next = [&]() {
+      auto maybe_buffer = in_flight.front().result();
+      in_flight.pop_front();
+      if (st.ok()) {
+        st = maybe_buffer.ok() ? out->Write(*maybe_buffer) : maybe_buffer.status();
+      }
+    };
+
+    while (st.ok()) {
+      auto maybe_batch = batches.Next();
+      if (!maybe_batch.ok()) {
+        st = maybe_batch.status();
+        break;
+      }
+      std::shared_ptr<RecordBatch> batch = *std::move(maybe_batch);
+      if (batch == nullptr) {
+        break;
+      }
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      if (in_flight.size() >= max_in_flight) {
+        write_next();
+      }
+      // The task doesn't reference the converter, which may be destroyed
+      // before the task ends in case of error.
+      auto schema = schema_;
+      auto pool = pool_;
+      in_flight.push_back(DeferNotOk(executor->Submit(
+          [schema, pool, batch]() -> Result<std::shared_ptr<Buffer>> {
+            ASSIGN_OR_RAISE(auto populators, MakePopulators(*schema, pool));
+            OffsetVector offsets(0, 0, ::arrow::stl::allocator<int32_t>(pool));
+            ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                            AllocateResizableBuffer(0, pool));
+            RETURN_NOT_OK(TranslateMinimalBatch(*batch, populators, &offsets,
+                                                data_buffer.get()));
+            return std::move(data_buffer);
+          })));
     }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(data_buffer_->Resize(offsets_.back(), /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto populator = column_populators_.rbegin();
-         populator != column_populators_.rend(); populator++) {
-      (*populator)
-          ->PopulateColumns(reinterpret_cast<char*>(data_buffer_->mutable_data()),
-                            offsets_.data());
+    while (st.ok() && !in_flight.empty()) {
+      write_next();
     }
-    DCHECK_EQ(0, offsets_[0]);
-    return Status::OK();
+    return st;
   }
 
   static constexpr int64_t kColumnSizeGuess = 8;
   std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int32_t, arrow::stl::allocator<int32_t>> offsets_;
+  OffsetVector offsets_;
   std::shared_ptr<ResizableBuffer> data_buffer_;
   const std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
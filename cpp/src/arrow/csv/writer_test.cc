@@ -20,6 +20,8 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/buffer.h"
 #include "arrow/csv/writer.h"
 #include "arrow/io/memory.h"
@@ -112,6 +114,13 @@ TEST_P(TestWriteCSV, TestWrite) {
                        Table::FromRecordBatches({record_batch}));
   ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
   EXPECT_EQ(csv, GetParam().expected_output);
+
+  // Threading shouldn't matter.
+  options.use_threads = !options.use_threads;
+  ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+  EXPECT_EQ(csv, GetParam().expected_output);
+  ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
+  EXPECT_EQ(csv, GetParam().expected_output);
 }
 
 INSTANTIATE_TEST_SUITE_P(MultiColumnWriteCSVTest, TestWriteCSV,
@@ -124,5 +133,61 @@ INSTANTIATE_TEST_SUITE_P(SingleColumnWriteCSVTest, TestWriteCSV,
                              R"("int64")"
                              "\n9999\n\n-15\n"}));
 
+INSTANTIATE_TEST_SUITE_P(
+    NumericWriteCSVTest, TestWriteCSV,
+    ::testing::Values(
+        WriterTestParams{schema({field("a", int8()), field("b", uint64()),
+                                 field("c", int64()), field("d", uint8())}),
+                         R"([[-128, 18446744073709551615, -9223372036854775808, 0],
+                             [127, 0, 9223372036854775807, 255],
+                             [null, 10, -1, null],
+                             [-10, null, 100, 9]])",
+                         DefaultTestOptions(/*header=*/false),
+                         "-128,18446744073709551615,-9223372036854775808,0\n"
+                         "127,0,9223372036854775807,255\n"
+                         ",10,-1,\n"
+                         "-10,,100,9\n"},
+        WriterTestParams{schema({field("a", float32()), field("b", float64())}),
+                         R"([[1.5, -0.25], [null, 1e300], [-3, null], [0, 123456.789]])",
+                         DefaultTestOptions(/*header=*/false),
+                         "1.5,-0.25\n,1e+300\n-3,\n0,123456.789\n"}));
+
+TEST(TestWriteCSV, DictionaryNumbers) {
+  auto dict_type = dictionary(int32(), int64());
+  auto dict_array = DictArrayFromJSON(dict_type, "[0, 1, null, 1]", "[-5, 42]");
+  auto batch = RecordBatch::Make(schema({field("a", dict_type)}), 4, {dict_array});
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_OK(WriteCSV(*batch, DefaultTestOptions(/*header=*/false), default_memory_pool(),
+                     out.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+  ASSERT_EQ(buffer->ToString(), "-5\n42\n\n42\n");
+}
+
+TEST(TestWriteCSV, ParallelOutputOrder) {
+  const int NROWS = 10000;
+  Int64Builder int_builder;
+  StringBuilder string_builder;
+  std::string expected;
+  for (int i = 0; i < NROWS; ++i) {
+    ASSERT_OK(int_builder.Append(i));
+    ASSERT_OK(string_builder.Append("x" + std::to_string(i)));
+    expected += std::to_string(i) + ",\"x" + std::to_string(i) + "\"\n";
+  }
+  ASSERT_OK_AND_ASSIGN(auto ints, int_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto strings, string_builder.Finish());
+  auto batch = RecordBatch::Make(schema({field("a", int64()), field("b", utf8())}),
+                                 NROWS, {ints, strings});
+
+  for (bool use_threads : {false, true}) {
+    WriteOptions options = DefaultTestOptions(/*header=*/false);
+    options.batch_size = 100;
+    options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+    ASSERT_OK(WriteCSV(*batch, options, default_memory_pool(), out.get()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+    ASSERT_EQ(buffer->ToString(), expected);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,11 +19,15 @@
 
 #pragma once
 
+#include "arrow/dataset/batch_cache.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/expression.h"
+#include "arrow/dataset/external_group_by.h"
+#include "arrow/dataset/external_sort.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_csv.h"
 #include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_orc.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/dataset/scanner.h"
@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/batch_cache.h"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/expression.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/spill_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t BatchCache::kDefaultCapacity;
+
+namespace {
+
+// The fields a scan reads from fragments, sorted and deduplicated. Nested references
+// are kept apart from their top-level field since fragments may only read the
+// referenced children of a struct.
+std::vector<std::string> MaterializedFieldSet(const ScanOptions& options) {
+  std::vector<std::string> fields;
+  for (const FieldRef& ref : options.MaterializedFieldRefs()) {
+    fields.push_back(ref.name() ? *ref.name() : ref.ToString());
+  }
+  std::sort(fields.begin(), fields.end());
+  fields.erase(std::unique(fields.begin(), fields.end()), fields.end());
+  return fields;
+}
+
+// What a fragment was scanned with, determining which batches it yields
+struct ScanKey {
+  std::shared_ptr<FragmentScanOptions> fragment_scan_options;
+  Expression filter;
+  std::vector<std::string> fields;
+
+  // Whether the batches scanned with this key are usable by a scan with other
+  bool Serves(const ScanKey& other) const {
+    return fragment_scan_options == other.fragment_scan_options &&
+           (filter == literal(true) || filter == other.filter) &&
+           std::includes(fields.begin(), fields.end(), other.fields.begin(),
+                         other.fields.end());
+  }
+};
+
+}  // namespace
+
+class BatchCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  int64_t capacity() const { return capacity_; }
+
+  Metrics metrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return metrics_;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    items_.clear();
+    metrics_.num_entries = 0;
+    metrics_.bytes = 0;
+  }
+
+  bool Lookup(const std::shared_ptr<Fragment>& fragment, const ScanKey& key,
+              RecordBatchVector* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = map_.equal_range(fragment.get());
+    for (auto it = range.first; it != range.second;) {
+      auto item = (it++)->second;
+      if (item->fragment.lock() != fragment) {
+        // The cached fragment was destroyed and its address reused
+        Erase(item);
+      } else if (item->key.Serves(key)) {
+        ++metrics_.hits;
+        // Move item to the front of the list
+        items_.splice(items_.begin(), items_, item);
+        *out = item->batches;
+        return true;
+      }
+    }
+    ++metrics_.misses;
+    return false;
+  }
+
+  void Insert(const std::shared_ptr<Fragment>& fragment, ScanKey key,
+              RecordBatchVector batches) {
+    int64_t charge = 0;
+    for (const auto& batch : batches) {
+      charge += internal::BufferSize(*batch);
+    }
+    if (charge > capacity_) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = map_.equal_range(fragment.get());
+    for (auto it = range.first; it != range.second;) {
+      auto item = (it++)->second;
+      if (item->fragment.lock() != fragment || key.Serves(item->key)) {
+        // Destroyed or superseded by the new entry
+        Erase(item);
+      } else if (item->key.Serves(key)) {
+        // Another scan of the same fragment got there first
+        return;
+      }
+    }
+
+    items_.push_front(Item{fragment.get(), fragment, std::move(key), std::move(batches),
+                           charge});
+    map_.emplace(fragment.get(), items_.begin());
+    ++metrics_.num_entries;
+    metrics_.bytes += charge;
+
+    // Evict least recently used items until within capacity
+    while (metrics_.bytes > capacity_) {
+      ++metrics_.evictions;
+      Erase(std::prev(items_.end()));
+    }
+  }
+
+ private:
+  struct Item {
+    const Fragment* address;
+    std::weak_ptr<Fragment> fragment;
+    ScanKey key;
+    RecordBatchVector batches;
+    int64_t charge;
+  };
+  using ItemList = std::list<Item>;
+
+  void Erase(ItemList::iterator item) {
+    auto range = map_.equal_range(item->address);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == item) {
+        map_.erase(it);
+        break;
+      }
+    }
+    metrics_.bytes -= item->charge;
+    --metrics_.num_entries;
+    items_.erase(item);
+  }
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // In most to least recently used order
+  ItemList items_;
+  std::unordered_multimap<const Fragment*, ItemList::iterator> map_;
+  Metrics metrics_;
+};
+
+BatchCache::BatchCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+BatchCache::~BatchCache() = default;
+
+int64_t BatchCache::capacity() const { return impl_->capacity(); }
+
+BatchCache::Metrics BatchCache::metrics() const { return impl_->metrics(); }
+
+void BatchCache::Clear() { impl_->Clear(); }
+
+Result<ScanTaskIterator> BatchCache::Scan(const std::shared_ptr<Fragment>& fragment,
+                                          const std::shared_ptr<ScanOptions>& options) {
+  if (fragment->type_name() == "in-memory") {
+    return fragment->Scan(options);
+  }
+
+  ScanKey key{options->fragment_scan_options, options->filter,
+              MaterializedFieldSet(*options)};
+  RecordBatchVector batches;
+  if (!impl_->Lookup(fragment, key, &batches)) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_tasks, fragment->Scan(options));
+    for (auto maybe_task : scan_tasks) {
+      ARROW_ASSIGN_OR_RAISE(auto task, maybe_task);
+      ARROW_ASSIGN_OR_RAISE(auto task_batches, task->Execute());
+      for (auto maybe_batch : task_batches) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+        batches.push_back(std::move(batch));
+      }
+    }
+    impl_->Insert(fragment, std::move(key), batches);
+  }
+
+  // Cached batches may have been read with a larger batch size
+  RecordBatchVector sliced;
+  for (const auto& batch : batches) {
+    if (batch->num_rows() <= options->batch_size) {
+      sliced.push_back(batch);
+      continue;
+    }
+    for (int64_t offset = 0; offset < batch->num_rows(); offset += options->batch_size) {
+      sliced.push_back(batch->Slice(offset, options->batch_size));
+    }
+  }
+  ScanTaskVector tasks{
+      std::make_shared<InMemoryScanTask>(std::move(sliced), options, fragment)};
+  return MakeVectorIterator(std::move(tasks));
+}
+
+}  // namespace dataset
+}  // namespace arrow
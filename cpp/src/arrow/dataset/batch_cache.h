@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A cache of the batches decoded from fragments, which can be shared by any
+/// number of scans through ScanOptions::batch_cache.
+///
+/// Entries are keyed by the Fragment object (so a Dataset should be kept and scanned
+/// again rather than rediscovered), the fragment scan options and the filter pushed
+/// down to the fragment, and hold the batches the fragment yielded for the fields a
+/// scan materialized. A scan is served from an entry which was read with the same
+/// fragment scan options, either the same filter or none, and at least the fields it
+/// materializes: batches with extra columns or rows are fine since the scanner filters
+/// and projects them anyway.
+///
+/// On a miss the fragment is read in full before its batches are yielded, then cached.
+/// In-memory fragments are never cached.
+///
+/// The cache is bounded by the size of the buffers of its entries and evicts the least
+/// recently used entries first.
+class ARROW_DS_EXPORT BatchCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = int64_t(1) << 30;
+
+  struct Metrics {
+    /// Number of fragment scans served from the cache
+    int64_t hits = 0;
+    /// Number of fragment scans which weren't in the cache
+    int64_t misses = 0;
+    /// Number of entries removed to stay within capacity
+    int64_t evictions = 0;
+    /// Number of entries currently in the cache
+    int64_t num_entries = 0;
+    /// Size of the buffers of the current entries, in bytes
+    int64_t bytes = 0;
+  };
+
+  explicit BatchCache(int64_t capacity = kDefaultCapacity);
+  ~BatchCache();
+
+  /// \brief Return the maximum size of the cache, in bytes.
+  int64_t capacity() const;
+
+  Metrics metrics() const;
+
+  /// \brief Remove all entries. Metrics other than sizes are preserved.
+  void Clear();
+
+  /// \brief Scan a fragment like Fragment::Scan, from the cache if possible.
+  Result<ScanTaskIterator> Scan(const std::shared_ptr<Fragment>& fragment,
+                                const std::shared_ptr<ScanOptions>& options);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
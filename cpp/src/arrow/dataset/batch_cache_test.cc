@@ -0,0 +1,284 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/batch_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kBatchSize = 1024;
+
+// An in-memory fragment counting how often it is scanned, which the cache does not
+// mistake for an InMemoryFragment
+class CountingFragment : public InMemoryFragment {
+ public:
+  using InMemoryFragment::InMemoryFragment;
+
+  std::string type_name() const override { return "counting"; }
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options) override {
+    ++num_scans;
+    return InMemoryFragment::Scan(std::move(options));
+  }
+
+  int num_scans = 0;
+};
+
+class FragmentVectorDataset : public Dataset {
+ public:
+  FragmentVectorDataset(std::shared_ptr<Schema> schema, FragmentVector fragments)
+      : Dataset(std::move(schema)), fragments_(std::move(fragments)) {}
+
+  std::string type_name() const override { return "fragment-vector"; }
+
+  Result<std::shared_ptr<Dataset>> ReplaceSchema(
+      std::shared_ptr<Schema> schema) const override {
+    return std::make_shared<FragmentVectorDataset>(std::move(schema), fragments_);
+  }
+
+ protected:
+  Result<FragmentIterator> GetFragmentsImpl(Expression) override {
+    return MakeVectorIterator(fragments_);
+  }
+
+  FragmentVector fragments_;
+};
+
+class TestBatchCache : public DatasetFixtureMixin {
+ protected:
+  void SetUp() override {
+    SetSchema({field("i32", int32()), field("f64", float64())});
+    batch_ = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+    fragment_ = MakeFragment();
+  }
+
+  std::shared_ptr<CountingFragment> MakeFragment() {
+    return std::make_shared<CountingFragment>(RecordBatchVector{batch_, batch_});
+  }
+
+  void Project(std::vector<std::string> names) {
+    ASSERT_OK(SetProjection(options_.get(), std::move(names)));
+  }
+
+  RecordBatchVector ScanThrough(BatchCache* cache,
+                                const std::shared_ptr<Fragment>& fragment) {
+    RecordBatchVector batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_tasks, cache->Scan(fragment, options_));
+    for (auto maybe_task : scan_tasks) {
+      EXPECT_OK_AND_ASSIGN(auto task, maybe_task);
+      EXPECT_EQ(task->fragment(), fragment);
+      EXPECT_OK_AND_ASSIGN(auto task_batches, task->Execute());
+      for (auto maybe_batch : task_batches) {
+        EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+        batches.push_back(batch);
+      }
+    }
+    return batches;
+  }
+
+  void AssertMetrics(const BatchCache& cache, int64_t hits, int64_t misses,
+                     int64_t evictions, int64_t num_entries) {
+    auto metrics = cache.metrics();
+    EXPECT_EQ(metrics.hits, hits);
+    EXPECT_EQ(metrics.misses, misses);
+    EXPECT_EQ(metrics.evictions, evictions);
+    EXPECT_EQ(metrics.num_entries, num_entries);
+  }
+
+  std::shared_ptr<RecordBatch> batch_;
+  std::shared_ptr<CountingFragment> fragment_;
+};
+
+TEST_F(TestBatchCache, ServesRepeatedScans) {
+  BatchCache cache;
+  for (int i = 0; i < 3; ++i) {
+    auto batches = ScanThrough(&cache, fragment_);
+    ASSERT_EQ(batches.size(), 2);
+    for (const auto& batch : batches) {
+      AssertBatchesEqual(*batch_, *batch);
+    }
+  }
+  ASSERT_EQ(fragment_->num_scans, 1);
+  AssertMetrics(cache, /*hits=*/2, /*misses=*/1, /*evictions=*/0, /*num_entries=*/1);
+  ASSERT_GT(cache.metrics().bytes, 0);
+
+  // Cached batches are sliced to the batch size of the scan
+  options_->batch_size = kBatchSize / 4;
+  auto batches = ScanThrough(&cache, fragment_);
+  ASSERT_EQ(batches.size(), 8);
+  ASSERT_EQ(fragment_->num_scans, 1);
+
+  cache.Clear();
+  AssertMetrics(cache, /*hits=*/3, /*misses=*/1, /*evictions=*/0, /*num_entries=*/0);
+  ASSERT_EQ(cache.metrics().bytes, 0);
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 2);
+}
+
+TEST_F(TestBatchCache, SubsetOfFields) {
+  BatchCache cache;
+  Project({"i32"});
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 1);
+
+  // f64 wasn't necessarily read
+  Project({"f64"});
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 2);
+
+  // Reading all fields supersedes the narrower entries, then serves any subset
+  Project({"i32", "f64"});
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 3);
+  AssertMetrics(cache, /*hits=*/0, /*misses=*/3, /*evictions=*/0, /*num_entries=*/1);
+
+  for (auto names : {std::vector<std::string>{"f64"}, std::vector<std::string>{"i32"},
+                     std::vector<std::string>{}}) {
+    Project(names);
+    ScanThrough(&cache, fragment_);
+  }
+  // Fields referenced by the filter are materialized too
+  SetFilter(greater(field_ref("f64"), literal(0.0)));
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 3);
+}
+
+TEST_F(TestBatchCache, Filter) {
+  BatchCache cache;
+  auto filter = greater(field_ref("i32"), literal(0));
+  auto other_filter = less(field_ref("i32"), literal(0));
+
+  SetFilter(filter);
+  ScanThrough(&cache, fragment_);
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 1);
+
+  // Rows may have been skipped by the filter pushed down to the fragment
+  SetFilter(other_filter);
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 2);
+  SetFilter(literal(true));
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 3);
+
+  // An unfiltered scan serves any filter
+  SetFilter(greater_equal(field_ref("i32"), literal(5)));
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 3);
+}
+
+TEST_F(TestBatchCache, FragmentScanOptions) {
+  BatchCache cache;
+  ScanThrough(&cache, fragment_);
+  options_->fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+  ScanThrough(&cache, fragment_);
+  ScanThrough(&cache, fragment_);
+  ASSERT_EQ(fragment_->num_scans, 2);
+  AssertMetrics(cache, /*hits=*/1, /*misses=*/2, /*evictions=*/0, /*num_entries=*/2);
+}
+
+TEST_F(TestBatchCache, Eviction) {
+  auto a = fragment_, b = MakeFragment(), c = MakeFragment();
+  int64_t fragment_bytes;
+  {
+    BatchCache cache;
+    ScanThrough(&cache, a);
+    fragment_bytes = cache.metrics().bytes;
+  }
+
+  // Room for the batches of two fragments
+  BatchCache cache(2 * fragment_bytes);
+  ScanThrough(&cache, a);
+  ScanThrough(&cache, b);
+  ASSERT_EQ(cache.metrics().bytes, 2 * fragment_bytes);
+  // Make b the least recently used
+  ScanThrough(&cache, a);
+  ScanThrough(&cache, c);
+  AssertMetrics(cache, /*hits=*/1, /*misses=*/3, /*evictions=*/1, /*num_entries=*/2);
+
+  ScanThrough(&cache, a);
+  ScanThrough(&cache, c);
+  ScanThrough(&cache, b);
+  ASSERT_EQ(a->num_scans, 2);
+  ASSERT_EQ(b->num_scans, 2);
+  ASSERT_EQ(c->num_scans, 1);
+
+  // Too large to be cached
+  BatchCache small_cache(fragment_bytes / 2);
+  ScanThrough(&small_cache, a);
+  ScanThrough(&small_cache, a);
+  ASSERT_EQ(a->num_scans, 4);
+  AssertMetrics(small_cache, /*hits=*/0, /*misses=*/2, /*evictions=*/0,
+                /*num_entries=*/0);
+}
+
+TEST_F(TestBatchCache, InMemoryFragmentNotCached) {
+  BatchCache cache;
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{batch_});
+  ScanThrough(&cache, fragment);
+  AssertMetrics(cache, /*hits=*/0, /*misses=*/0, /*evictions=*/0, /*num_entries=*/0);
+}
+
+TEST_F(TestBatchCache, SharedByScanners) {
+  constexpr int kNumFragments = 4;
+  std::vector<std::shared_ptr<CountingFragment>> fragments;
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumFragments; ++i) {
+    auto batch = RecordBatch::Make(
+        schema_, kBatchSize,
+        {ConstantArrayGenerator::Int32(kBatchSize, i),
+         ConstantArrayGenerator::Float64(kBatchSize, static_cast<double>(i))});
+    batches.push_back(batch);
+    fragments.push_back(std::make_shared<CountingFragment>(RecordBatchVector{batch}));
+  }
+  auto dataset = std::make_shared<FragmentVectorDataset>(
+      schema_, FragmentVector(fragments.begin(), fragments.end()));
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  auto cache = std::make_shared<BatchCache>();
+  for (bool use_async : {false, true}) {
+    for (bool use_threads : {false, true}) {
+      auto options = std::make_shared<ScanOptions>(*options_);
+      options->use_async = use_async;
+      options->use_threads = use_threads;
+      options->batch_cache = cache;
+      ScannerBuilder builder(dataset, options);
+      ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+      ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+  }
+  for (const auto& fragment : fragments) {
+    ASSERT_EQ(fragment->num_scans, 1);
+  }
+  AssertMetrics(*cache, /*hits=*/3 * kNumFragments, /*misses=*/kNumFragments,
+                /*evictions=*/0, /*num_entries=*/kNumFragments);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -52,6 +52,11 @@ Result<std::shared_ptr<Schema>> Fragment::ReadPhysicalSchema() {
   return physical_schema_;
 }
 
+Future<util::optional<int64_t>> Fragment::CountRows(Expression,
+                                                    const std::shared_ptr<ScanOptions>&) {
+  return util::optional<int64_t>();
+}
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return physical_schema_;
 }
@@ -95,6 +100,23 @@ Result<ScanTaskIterator> InMemoryFragment::Scan(std::shared_ptr<ScanOptions> opt
   return MakeMapIterator(fn, std::move(batches_it));
 }
 
+Future<util::optional<int64_t>> InMemoryFragment::CountRows(
+    Expression predicate, const std::shared_ptr<ScanOptions>&) {
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return util::optional<int64_t>(0);
+  }
+  if (predicate != literal(true)) {
+    return util::optional<int64_t>();
+  }
+  int64_t total = 0;
+  for (const auto& batch : record_batches_) {
+    total += batch->num_rows();
+  }
+  return util::optional<int64_t>(total);
+}
+
 Dataset::Dataset(std::shared_ptr<Schema> schema, Expression partition_expression)
     : schema_(std::move(schema)),
       partition_expression_(std::move(partition_expression)) {}
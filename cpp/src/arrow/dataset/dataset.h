@@ -19,17 +19,21 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/api_vector.h"
 #include "arrow/dataset/expression.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/mutex.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 namespace dataset {
@@ -64,6 +68,14 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   /// To receive a record batch stream which is fully filtered and projected, use Scanner.
   virtual Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options) = 0;
 
+  /// \brief Count the rows of this Fragment matching a predicate without scanning it.
+  ///
+  /// The count is derived from what is known without reading any data, e.g. the
+  /// partition expression or file metadata such as Parquet row group statistics.
+  /// Returns util::nullopt if the rows can only be counted by scanning the Fragment.
+  virtual Future<util::optional<int64_t>> CountRows(
+      Expression predicate, const std::shared_ptr<ScanOptions>& options);
+
   virtual std::string type_name() const = 0;
   virtual std::string ToString() const { return type_name(); }
 
@@ -107,6 +119,8 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
   explicit InMemoryFragment(RecordBatchVector record_batches, Expression = literal(true));
 
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options) override;
+  Future<util::optional<int64_t>> CountRows(
+      Expression predicate, const std::shared_ptr<ScanOptions>& options) override;
 
   std::string type_name() const override { return "in-memory"; }
 
@@ -137,6 +151,12 @@ class ARROW_DS_EXPORT Dataset : public std::enable_shared_from_this<Dataset> {
   /// May be null, which indicates no information is available.
   const Expression& partition_expression() const { return partition_expression_; }
 
+  /// \brief Keys by which the rows of each of this Dataset's Fragments are sorted.
+  /// Empty if no order is known.
+  ///
+  /// Fragments are not sorted relative to one another; see Scanner::ScanBatchesSorted.
+  const std::vector<compute::SortKey>& sort_keys() const { return sort_keys_; }
+
   /// \brief The name identifying the kind of Dataset
   virtual std::string type_name() const = 0;
 
@@ -158,6 +178,7 @@ class ARROW_DS_EXPORT Dataset : public std::enable_shared_from_this<Dataset> {
 
   std::shared_ptr<Schema> schema_;
   Expression partition_expression_ = literal(true);
+  std::vector<compute::SortKey> sort_keys_;
 };
 
 /// \brief A Source which yields fragments wrapping a stream of record batches.
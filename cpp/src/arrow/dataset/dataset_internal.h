@@ -207,5 +207,20 @@ arrow::Result<std::shared_ptr<T>> GetFragmentScanOptions(
   return internal::checked_pointer_cast<T>(source);
 }
 
+// The summary index written by FileSystemDataset::Write is an IPC file with one row
+// per written file:
+//   path: utf8, relative to the dataset's base directory
+//   partition_expression: binary, as produced by Serialize(Expression)
+//   num_rows: int64
+//   statistics: struct with a child per column of the file, named after it, of type
+//     struct<min: T, max: T, null_count: int64>; min and max are null if unknown
+// The dataset's schema is serialized as IPC and base64 encoded under the
+// kSummaryIndexSchemaKey key of the file schema's metadata.
+constexpr char kSummaryIndexSchemaKey[] = "dataset_schema";
+constexpr char kSummaryIndexPath[] = "path";
+constexpr char kSummaryIndexPartitionExpression[] = "partition_expression";
+constexpr char kSummaryIndexNumRows[] = "num_rows";
+constexpr char kSummaryIndexStatistics[] = "statistics";
+
 }  // namespace dataset
 }  // namespace arrow
@@ -18,22 +18,42 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 DatasetFactory::DatasetFactory() : root_partition_(literal(true)) {}
 
 Result<std::shared_ptr<Schema>> DatasetFactory::Inspect(InspectOptions options) {
@@ -134,17 +154,23 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<fs::FileInfo>& files,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
+  std::vector<char> supported(files.size(), true);
+  if (options.exclude_invalid_files) {
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        files.size() > 1, static_cast<int>(files.size()),
+        [&](int i) {
+          ARROW_ASSIGN_OR_RAISE(supported[i],
+                                format->IsSupported(FileSource(files[i], filesystem)));
+          return Status::OK();
+        },
+        filesystem->io_context().executor()));
+  }
+
   std::vector<fs::FileInfo> filtered_files;
-  for (const auto& info : files) {
-    if (options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(info, filesystem)));
-      if (!supported) {
-        continue;
-      }
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (supported[i]) {
+      filtered_files.emplace_back(files[i]);
     }
-
-    filtered_files.emplace_back(info);
   }
 
   return std::shared_ptr<DatasetFactory>(
@@ -165,6 +191,143 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+namespace {
+
+constexpr char kListingCacheBaseDir[] = "base_dir";
+constexpr char kListingCacheMaxRecursion[] = "max_recursion";
+
+// Crawl a selector by listing its base directory first, then each of its subdirectories
+// concurrently on the filesystem's IO executor. Object stores list a prefix page after
+// page, so splitting the crawl by prefix lets the requests proceed in parallel.
+// Subdirectories matching `ignore_prefixes` aren't crawled at all.
+Result<std::vector<fs::FileInfo>> CrawlFiles(
+    fs::FileSystem* filesystem, const fs::FileSelector& selector,
+    const std::vector<std::string>& ignore_prefixes) {
+  if (!selector.recursive || selector.max_recursion == 0) {
+    return filesystem->GetFileInfo(selector);
+  }
+
+  fs::FileSelector top_selector = selector;
+  top_selector.recursive = false;
+  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(top_selector));
+
+  std::vector<fs::FileSelector> subdir_selectors;
+  for (const auto& info : files) {
+    if (!info.IsDirectory()) continue;
+    auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+    if (relative.has_value() &&
+        StartsWithAnyOf(std::string(*relative), ignore_prefixes)) {
+      continue;
+    }
+    fs::FileSelector subdir_selector = selector;
+    subdir_selector.base_dir = info.path();
+    subdir_selector.max_recursion = selector.max_recursion - 1;
+    subdir_selectors.push_back(std::move(subdir_selector));
+  }
+
+  std::vector<std::vector<fs::FileInfo>> subdir_files(subdir_selectors.size());
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      subdir_selectors.size() > 1, static_cast<int>(subdir_selectors.size()),
+      [&](int i) {
+        ARROW_ASSIGN_OR_RAISE(subdir_files[i],
+                              filesystem->GetFileInfo(subdir_selectors[i]));
+        return Status::OK();
+      },
+      filesystem->io_context().executor()));
+
+  for (auto& infos : subdir_files) {
+    std::move(infos.begin(), infos.end(), std::back_inserter(files));
+  }
+  return files;
+}
+
+// Read the files cached by WriteListingCache for `selector`, or return nullopt if the
+// cache is missing, stale, unreadable or was written for another selector.
+util::optional<std::vector<fs::FileInfo>> ReadListingCache(
+    const FileSystemFactoryOptions& options, const fs::FileSelector& selector) {
+  fs::LocalFileSystem local_fs;
+  auto cache_info = local_fs.GetFileInfo(options.listing_cache_path);
+  if (!cache_info.ok() || !cache_info->IsFile() ||
+      fs::TimePoint::clock::now() - cache_info->mtime() >
+          options.listing_cache_max_age) {
+    return util::nullopt;
+  }
+
+  auto maybe_files = [&]() -> Result<util::optional<std::vector<fs::FileInfo>>> {
+    ARROW_ASSIGN_OR_RAISE(auto input,
+                          local_fs.OpenInputFile(options.listing_cache_path));
+    ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input));
+
+    const auto& metadata = reader->schema()->metadata();
+    if (metadata == nullptr) return util::nullopt;
+    ARROW_ASSIGN_OR_RAISE(auto base_dir, metadata->Get(kListingCacheBaseDir));
+    ARROW_ASSIGN_OR_RAISE(auto max_recursion, metadata->Get(kListingCacheMaxRecursion));
+    auto expected_max_recursion = selector.recursive ? selector.max_recursion : 0;
+    if (base_dir != selector.base_dir ||
+        max_recursion != std::to_string(expected_max_recursion)) {
+      return util::nullopt;
+    }
+
+    std::vector<fs::FileInfo> files;
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+      RETURN_NOT_OK(batch->ValidateFull());
+      const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+      const auto& sizes = checked_cast<const Int64Array&>(*batch->column(1));
+      const auto& mtimes = checked_cast<const Int64Array&>(*batch->column(2));
+      for (int64_t j = 0; j < batch->num_rows(); ++j) {
+        fs::FileInfo info(paths.GetString(j), fs::FileType::File);
+        info.set_size(sizes.Value(j));
+        info.set_mtime(fs::TimePoint(fs::TimePoint::duration(mtimes.Value(j))));
+        files.push_back(std::move(info));
+      }
+    }
+    return files;
+  }();
+
+  if (!maybe_files.ok()) return util::nullopt;
+  return maybe_files.MoveValueUnsafe();
+}
+
+// Cache the files found by crawling `selector`. The cache is written to a temporary
+// file first so that concurrent readers never see a partial listing.
+Status WriteListingCache(const FileSystemFactoryOptions& options,
+                         const fs::FileSelector& selector,
+                         const std::vector<fs::FileInfo>& files) {
+  StringBuilder paths;
+  Int64Builder sizes, mtimes;
+  for (const auto& info : files) {
+    RETURN_NOT_OK(paths.Append(info.path()));
+    RETURN_NOT_OK(sizes.Append(info.size()));
+    RETURN_NOT_OK(mtimes.Append(info.mtime().time_since_epoch().count()));
+  }
+  ArrayVector columns(3);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(sizes.Finish(&columns[1]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[2]));
+
+  auto metadata = key_value_metadata(
+      {kListingCacheBaseDir, kListingCacheMaxRecursion},
+      {selector.base_dir,
+       std::to_string(selector.recursive ? selector.max_recursion : 0)});
+  auto cache_schema =
+      schema({field("path", utf8()), field("size", int64()), field("mtime", int64())},
+             std::move(metadata));
+  auto batch =
+      RecordBatch::Make(cache_schema, static_cast<int64_t>(files.size()), columns);
+
+  fs::LocalFileSystem local_fs;
+  auto temp_path = options.listing_cache_path + ".tmp";
+  ARROW_ASSIGN_OR_RAISE(auto destination, local_fs.OpenOutputStream(temp_path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, cache_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  RETURN_NOT_OK(destination->Close());
+  return local_fs.Move(temp_path, options.listing_cache_path);
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -176,13 +339,30 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
 
-  // Filter out anything that's not a file or that's explicitly ignored
+  util::optional<std::vector<fs::FileInfo>> cached_files;
+  if (!options.listing_cache_path.empty()) {
+    cached_files = ReadListingCache(options, selector);
+  }
+
+  std::vector<fs::FileInfo> files;
+  if (cached_files.has_value()) {
+    files = std::move(*cached_files);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, CrawlFiles(filesystem.get(), selector,
+                                            options.selector_ignore_prefixes));
+    files.erase(std::remove_if(files.begin(), files.end(),
+                               [](const fs::FileInfo& info) { return !info.IsFile(); }),
+                files.end());
+    if (!options.listing_cache_path.empty()) {
+      RETURN_NOT_OK(WriteListingCache(options, selector, files));
+    }
+  }
+
+  // Filter out anything that's explicitly ignored
   Status st;
   auto files_end =
       std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
 
         auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
         if (!relative.has_value()) {
@@ -220,16 +400,21 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
-
-  const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect({info, fs_}));
-    schemas.push_back(schema);
+  size_t num_inspected = files_.size();
+  if (options.fragments >= 0) {
+    num_inspected = std::min(num_inspected, static_cast<size_t>(options.fragments));
   }
 
+  // Inspect fragments concurrently, since each inspection is dominated by IO latency
+  std::vector<std::shared_ptr<Schema>> schemas(num_inspected);
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      num_inspected > 1, static_cast<int>(num_inspected),
+      [&](int i) {
+        ARROW_ASSIGN_OR_RAISE(schemas[i], format_->Inspect({files_[i], fs_}));
+        return Status::OK();
+      },
+      fs_->io_context().executor()));
+
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
                         options_.partitioning.GetOrInferSchema(
                             StripPrefixAndFilename(files_, options_.partition_base_dir)));
@@ -268,7 +453,127 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
     fragments.push_back(fragment);
   }
 
-  return FileSystemDataset::Make(schema, root_partition_, format_, fs_, fragments);
+  return FileSystemDataset::Make(schema, root_partition_, format_, fs_, fragments,
+                                 options_.sort_keys);
+}
+
+namespace {
+
+// Conjoin the statistics recorded for each column of a file into a single guarantee
+Result<Expression> StatisticsAsExpression(const StructArray& statistics, int64_t i,
+                                          int64_t num_rows) {
+  std::vector<Expression> guarantees;
+  const auto& type = checked_cast<const StructType&>(*statistics.type());
+  for (int field_index = 0; field_index < type.num_fields(); ++field_index) {
+    const auto& column_statistics =
+        checked_cast<const StructArray&>(*statistics.field(field_index));
+    auto field_expr = field_ref(type.field(field_index)->name());
+
+    const auto& null_counts =
+        checked_cast<const Int64Array&>(*column_statistics.GetFieldByName("null_count"));
+    if (num_rows > 0 && null_counts.Value(i) == num_rows) {
+      // all values are null
+      auto value_type = column_statistics.GetFieldByName("min")->type();
+      guarantees.push_back(
+          equal(std::move(field_expr), literal(MakeNullScalar(value_type))));
+      continue;
+    }
+
+    const auto& mins = column_statistics.GetFieldByName("min");
+    const auto& maxes = column_statistics.GetFieldByName("max");
+    ARROW_ASSIGN_OR_RAISE(auto min, mins->GetScalar(i));
+    ARROW_ASSIGN_OR_RAISE(auto max, maxes->GetScalar(i));
+    if (!min->is_valid || !max->is_valid) continue;
+
+    guarantees.push_back(greater_equal(field_expr, literal(std::move(min))));
+    guarantees.push_back(less_equal(std::move(field_expr), literal(std::move(max))));
+  }
+  return and_(std::move(guarantees));
+}
+
+}  // namespace
+
+SummaryIndexDatasetFactory::SummaryIndexDatasetFactory(
+    std::shared_ptr<fs::FileSystem> filesystem, std::shared_ptr<FileFormat> format,
+    std::shared_ptr<Schema> schema, std::vector<std::shared_ptr<FileFragment>> fragments)
+    : fs_(std::move(filesystem)),
+      format_(std::move(format)),
+      schema_(std::move(schema)),
+      fragments_(std::move(fragments)) {}
+
+Result<std::shared_ptr<DatasetFactory>> SummaryIndexDatasetFactory::Make(
+    const std::string& index_path, std::shared_ptr<fs::FileSystem> filesystem,
+    std::shared_ptr<FileFormat> format) {
+  ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(index_path));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input));
+
+  auto index_schema = reader->schema();
+  auto index_metadata = index_schema->metadata();
+  if (index_metadata == nullptr || !index_metadata->Contains(kSummaryIndexSchemaKey)) {
+    return Status::Invalid("Summary index '", index_path, "' has no dataset schema");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded_schema, index_metadata->Get(kSummaryIndexSchemaKey));
+  auto serialized_schema = Buffer::FromString(util::base64_decode(encoded_schema));
+  io::BufferReader schema_reader(serialized_schema);
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto schema, ipc::ReadSchema(&schema_reader, &dictionary_memo));
+
+  for (const char* name : {kSummaryIndexPath, kSummaryIndexPartitionExpression,
+                           kSummaryIndexNumRows, kSummaryIndexStatistics}) {
+    if (index_schema->GetFieldIndex(name) == -1) {
+      return Status::Invalid("Summary index '", index_path, "' has no ", name,
+                             " column");
+    }
+  }
+
+  auto base_dir = fs::internal::GetAbstractPathParent(index_path).first;
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int batch_index = 0; batch_index < reader->num_record_batches(); ++batch_index) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(batch_index));
+    const auto& paths = checked_cast<const StringArray&>(
+        *batch->GetColumnByName(kSummaryIndexPath));
+    const auto& partition_expressions = checked_cast<const BinaryArray&>(
+        *batch->GetColumnByName(kSummaryIndexPartitionExpression));
+    const auto& num_rows =
+        checked_cast<const Int64Array&>(*batch->GetColumnByName(kSummaryIndexNumRows));
+    const auto& statistics = checked_cast<const StructArray&>(
+        *batch->GetColumnByName(kSummaryIndexStatistics));
+
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      auto path = fs::internal::ConcatAbstractPath(base_dir, paths.GetString(i));
+
+      auto serialized = Buffer::FromString(partition_expressions.GetString(i));
+      ARROW_ASSIGN_OR_RAISE(auto partition_expression, Deserialize(serialized));
+      ARROW_ASSIGN_OR_RAISE(auto statistics_expression,
+                            StatisticsAsExpression(statistics, i, num_rows.Value(i)));
+
+      ARROW_ASSIGN_OR_RAISE(
+          auto fragment,
+          format->MakeFragment({std::move(path), filesystem},
+                               and_(std::move(partition_expression),
+                                    std::move(statistics_expression))));
+      fragments.push_back(std::move(fragment));
+    }
+  }
+
+  return std::shared_ptr<DatasetFactory>(new SummaryIndexDatasetFactory(
+      std::move(filesystem), std::move(format), std::move(schema), std::move(fragments)));
+}
+
+Result<std::vector<std::shared_ptr<Schema>>> SummaryIndexDatasetFactory::InspectSchemas(
+    InspectOptions options) {
+  return std::vector<std::shared_ptr<Schema>>{schema_};
+}
+
+Result<std::shared_ptr<Dataset>> SummaryIndexDatasetFactory::Finish(
+    FinishOptions options) {
+  std::shared_ptr<Schema> schema = options.schema;
+  if (schema == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(schema, Inspect(options.inspect_options));
+  }
+  return FileSystemDataset::Make(std::move(schema), root_partition_, format_, fs_,
+                                 fragments_);
 }
 
 }  // namespace dataset
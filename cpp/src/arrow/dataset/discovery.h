@@ -23,10 +23,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "arrow/compute/api_vector.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
@@ -160,9 +162,9 @@ struct FileSystemFactoryOptions {
   std::string partition_base_dir;
 
   // Invalid files (via selector or explicitly) will be excluded by checking
-  // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
-  // IO, but unsupported files may be present in the Dataset
+  // with the FileFormat::IsSupported method.  This will incur IO for each files,
+  // issued concurrently on the filesystem's IO executor. Disabling this feature will
+  // skip the IO, but unsupported files may be present in the Dataset
   // (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
@@ -181,6 +183,20 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  // When discovering from a Selector, cache the discovered files in this file on the
+  // local filesystem. Later discoveries of the same selector reuse the cached listing
+  // instead of crawling again, as long as the cache is younger than
+  // listing_cache_max_age. Files added or removed in the meantime are only seen once
+  // the cache expires. Empty (the default) disables caching.
+  std::string listing_cache_path;
+
+  std::chrono::seconds listing_cache_max_age{3600};
+
+  // Keys by which the rows of every discovered file are already sorted, e.g. the
+  // timestamp column of time-series files. They are declared on the dataset as
+  // Dataset::sort_keys and enable Scanner::ScanBatchesSorted. Not validated.
+  std::vector<compute::SortKey> sort_keys;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -248,5 +264,45 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   FileSystemFactoryOptions options_;
 };
 
+/// \brief SummaryIndexDatasetFactory creates a FileSystemDataset from the summary index
+/// written by FileSystemDataset::Write (see
+/// FileSystemDatasetWriteOptions::write_summary_index).
+///
+/// Only the index is read: directories aren't listed and no indexed file is opened.
+/// Each fragment's partition expression is the one recorded when it was written,
+/// conjoined with the range of values of each of its columns, so that
+/// Dataset::GetFragments prunes fragments using both partition keys and statistics.
+class ARROW_DS_EXPORT SummaryIndexDatasetFactory : public DatasetFactory {
+ public:
+  /// \brief Build a SummaryIndexDatasetFactory from a summary index file.
+  ///
+  /// Paths recorded in the index are relative to the directory containing it.
+  ///
+  /// \param[in] index_path path of the summary index, usually
+  ///     `<base_dir>/_summary_index.arrow`
+  /// \param[in] filesystem from which to open the index and the indexed files
+  /// \param[in] format of the indexed files
+  static Result<std::shared_ptr<DatasetFactory>> Make(
+      const std::string& index_path, std::shared_ptr<fs::FileSystem> filesystem,
+      std::shared_ptr<FileFormat> format);
+
+  /// \brief Return the schema recorded in the index.
+  Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas(
+      InspectOptions options) override;
+
+  Result<std::shared_ptr<Dataset>> Finish(FinishOptions options) override;
+
+ protected:
+  SummaryIndexDatasetFactory(std::shared_ptr<fs::FileSystem> filesystem,
+                             std::shared_ptr<FileFormat> format,
+                             std::shared_ptr<Schema> schema,
+                             std::vector<std::shared_ptr<FileFragment>> fragments);
+
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<FileFragment>> fragments_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
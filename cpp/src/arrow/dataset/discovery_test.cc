@@ -20,6 +20,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -29,6 +31,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 
 using testing::SizeIs;
 
@@ -171,6 +174,42 @@ TEST_F(FileSystemDatasetFactoryTest, Selector) {
   AssertFinishWithPaths({"A/a", "A/A/a"});
 }
 
+TEST_F(FileSystemDatasetFactoryTest, SelectorMaxRecursion) {
+  selector_.base_dir = "A";
+  selector_.recursive = true;
+  selector_.max_recursion = 1;
+
+  MakeFactory({fs::File("A/a"), fs::File("A/A/a"), fs::File("A/A/A/a"),
+               fs::File("A/B/a"), fs::File("A/B/B/B/a")});
+  AssertFinishWithPaths({"A/a", "A/A/a", "A/B/a"});
+}
+
+TEST_F(FileSystemDatasetFactoryTest, ListingCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("discovery-test-"));
+  selector_.base_dir = "A";
+  selector_.recursive = true;
+  factory_options_.listing_cache_path = temp_dir->path().ToString() + "listing";
+
+  MakeFactory({fs::File("A/a"), fs::File("A/A/a")});
+  AssertFinishWithPaths({"A/a", "A/A/a"});
+
+  // The cached listing is reused, so the new file isn't discovered
+  MakeFactory({fs::File("A/a"), fs::File("A/A/a"), fs::File("A/B/a")});
+  AssertFinishWithPaths({"A/a", "A/A/a"});
+
+  // ... unless the selector differs
+  selector_.max_recursion = 0;
+  MakeFactory({fs::File("A/a"), fs::File("A/A/a"), fs::File("A/B/a")});
+  AssertFinishWithPaths({"A/a"});
+
+  // ... or the cache has expired
+  selector_.max_recursion = INT32_MAX;
+  factory_options_.listing_cache_max_age = std::chrono::seconds(0);
+  MakeFactory({fs::File("A/a"), fs::File("A/A/a"), fs::File("A/B/a")});
+  AssertFinishWithPaths({"A/a", "A/A/a", "A/B/a"});
+}
+
 TEST_F(FileSystemDatasetFactoryTest, ExplicitPartition) {
   selector_.base_dir = "a=ignored/base";
   auto part_field = field("a", int32());
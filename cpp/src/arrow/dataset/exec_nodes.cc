@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_nodes.h"
+
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/datum.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::ExecBatch;
+using compute::ExecContext;
+using compute::ExecNode;
+
+namespace {
+
+// Kernels are executed serially on each batch: batches are already processed in
+// parallel, and waiting for nested tasks from a thread of the pool could
+// exhaust it
+std::shared_ptr<ExecContext> MakeBatchContext(const ExecContext& plan_context) {
+  auto ctx = std::make_shared<ExecContext>(plan_context.memory_pool(),
+                                           plan_context.func_registry());
+  ctx->set_use_threads(false);
+  return ctx;
+}
+
+Result<std::shared_ptr<Array>> MaterializeValue(const Datum& value, int64_t length,
+                                                MemoryPool* pool) {
+  if (value.is_array()) {
+    return value.make_array();
+  }
+  return MakeArrayFromScalar(*value.scalar(), length, pool);
+}
+
+Result<std::shared_ptr<RecordBatch>> ToRecordBatch(const ExecBatch& batch,
+                                                   std::shared_ptr<Schema> schema,
+                                                   MemoryPool* pool) {
+  ArrayVector columns(batch.values.size());
+  for (size_t i = 0; i < batch.values.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i],
+                          MaterializeValue(batch.values[i], batch.length, pool));
+  }
+  return RecordBatch::Make(std::move(schema), batch.length, std::move(columns));
+}
+
+}  // namespace
+
+Result<ExecNode*> MakeScanNode(compute::ExecPlan* plan, std::string label,
+                               std::shared_ptr<Scanner> scanner) {
+  const auto& options = scanner->options();
+  ARROW_ASSIGN_OR_RAISE(auto batch_it, scanner->ScanBatchesUnordered());
+  ARROW_ASSIGN_OR_RAISE(auto batch_gen,
+                        MakeBackgroundGenerator(std::move(batch_it),
+                                                options->io_context.executor()));
+
+  // The scanner must outlive the generator
+  std::function<util::optional<ExecBatch>(const EnumeratedRecordBatch&)> to_exec_batch =
+      [scanner](const EnumeratedRecordBatch& batch) -> util::optional<ExecBatch> {
+    return ExecBatch(*batch.record_batch.value);
+  };
+  auto gen = MakeMappedGenerator(std::move(batch_gen), std::move(to_exec_batch));
+  return compute::MakeSourceNode(plan, std::move(label), options->projected_schema,
+                                 std::move(gen));
+}
+
+Result<ExecNode*> MakeFilterNode(ExecNode* input, std::string label, Expression filter) {
+  const auto& schema = input->output_schema();
+  auto ctx = MakeBatchContext(*input->plan()->exec_context());
+  ARROW_ASSIGN_OR_RAISE(filter, filter.Bind(*schema, ctx.get()));
+  if (filter.type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must evaluate to bool, but ",
+                             filter.ToString(), " evaluates to ",
+                             filter.type()->ToString());
+  }
+
+  auto map = [schema, ctx, filter](ExecBatch batch) -> Result<ExecBatch> {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          ToRecordBatch(batch, schema, ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(Datum mask,
+                          ExecuteScalarExpression(filter, record_batch, ctx.get()));
+    if (mask.is_scalar()) {
+      const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+      if (mask_scalar.is_valid && mask_scalar.value) {
+        return batch;
+      }
+      return ExecBatch(*record_batch->Slice(0, 0));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                          compute::Filter(record_batch, mask,
+                                          compute::FilterOptions::Defaults(), ctx.get()));
+    return ExecBatch(*filtered.record_batch());
+  };
+  return compute::MakeMapNode(input, std::move(label), schema, std::move(map));
+}
+
+Result<ExecNode*> MakeProjectNode(ExecNode* input, std::string label,
+                                  std::vector<Expression> exprs,
+                                  std::vector<std::string> names) {
+  if (names.empty()) {
+    for (const auto& expr : exprs) {
+      names.push_back(expr.ToString());
+    }
+  } else if (names.size() != exprs.size()) {
+    return Status::Invalid("Project node got ", exprs.size(), " expressions but ",
+                           names.size(), " names");
+  }
+
+  const auto& input_schema = input->output_schema();
+  auto ctx = MakeBatchContext(*input->plan()->exec_context());
+  FieldVector fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(exprs[i], exprs[i].Bind(*input_schema, ctx.get()));
+    fields[i] = field(std::move(names[i]), exprs[i].type());
+  }
+
+  auto map = [input_schema, ctx, exprs](ExecBatch batch) -> Result<ExecBatch> {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          ToRecordBatch(batch, input_schema, ctx->memory_pool()));
+    std::vector<Datum> values(exprs.size());
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(Datum value,
+                            ExecuteScalarExpression(exprs[i], record_batch, ctx.get()));
+      // Downstream nodes expect arrays
+      ARROW_ASSIGN_OR_RAISE(values[i],
+                            MaterializeValue(value, batch.length, ctx->memory_pool()));
+    }
+    return ExecBatch(std::move(values), batch.length);
+  };
+  return compute::MakeMapNode(input, std::move(label), schema(std::move(fields)),
+                              std::move(map));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/dataset/expression.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Make a source node producing the batches of a dataset scan
+///
+/// Batches are read on the I/O executor of the scan options and have the
+/// projected schema of the scan.  They are produced in no particular order.
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan, std::string label,
+                                        std::shared_ptr<Scanner> scanner);
+
+/// \brief Make a node keeping the rows of its input for which `filter` is true
+///
+/// The filter is bound to the output schema of the input and must be boolean.
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeFilterNode(compute::ExecNode* input, std::string label,
+                                          Expression filter);
+
+/// \brief Make a node evaluating expressions against each batch of its input
+///
+/// The output has one field per expression, named after `names` if given or
+/// after the expression otherwise.
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeProjectNode(compute::ExecNode* input, std::string label,
+                                           std::vector<Expression> exprs,
+                                           std::vector<std::string> names = {});
+
+}  // namespace dataset
+}  // namespace arrow
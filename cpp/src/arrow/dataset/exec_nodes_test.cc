@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/exec_nodes.h"
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+
+using testing::HasSubstr;
+
+namespace arrow {
+namespace dataset {
+
+using compute::ExecBatch;
+using compute::ExecPlan;
+
+class TestExecNodes : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("i", int32()), field("key", utf8())});
+    RecordBatchVector batches;
+    for (int b = 0; b < 8; ++b) {
+      std::string json = "[";
+      for (int row = 0; row < 4; ++row) {
+        const int i = b * 4 + row;
+        json += (row ? ", " : "") + std::string("{\"i\": ") + std::to_string(i) +
+                ", \"key\": \"" + (i % 2 ? "odd" : "even") + "\"}";
+      }
+      batches.push_back(RecordBatchFromJSON(schema_, json + "]"));
+    }
+    dataset_ = std::make_shared<InMemoryDataset>(schema_, batches);
+    exec_context_.set_use_threads(GetParam());
+  }
+
+  std::shared_ptr<Scanner> MakeScanner() {
+    ScannerBuilder builder(dataset_);
+    ARROW_EXPECT_OK(builder.UseThreads(GetParam()));
+    return builder.Finish().ValueOrDie();
+  }
+
+  // Run the plan and collect the output of its sink, sorted on `sort_key`
+  std::shared_ptr<Table> Run(ExecPlan* plan,
+                             AsyncGenerator<util::optional<ExecBatch>> sink_gen,
+                             const std::shared_ptr<Schema>& out_schema,
+                             const std::string& sort_key) {
+    ARROW_EXPECT_OK(plan->StartProducing());
+    auto batches = CollectAsyncGenerator(std::move(sink_gen)).result().ValueOrDie();
+    ARROW_EXPECT_OK(plan->finished().status());
+
+    RecordBatchVector record_batches;
+    for (const auto& batch : batches) {
+      ArrayVector columns;
+      for (const auto& value : batch->values) {
+        columns.push_back(value.make_array());
+      }
+      record_batches.push_back(RecordBatch::Make(out_schema, batch->length, columns));
+    }
+    auto table = Table::FromRecordBatches(out_schema, record_batches).ValueOrDie();
+    auto indices =
+        compute::SortIndices(table, compute::SortOptions({compute::SortKey(sort_key)}))
+            .ValueOrDie();
+    auto sorted = compute::Take(table, indices).ValueOrDie();
+    return sorted.table()->CombineChunks().ValueOrDie();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Dataset> dataset_;
+  compute::ExecContext exec_context_;
+};
+
+TEST_P(TestExecNodes, ScanFilterProject) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context_));
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), "scan", MakeScanner()));
+  AssertSchemaEqual(schema_, scan->output_schema());
+  ASSERT_OK_AND_ASSIGN(auto filter,
+                       MakeFilterNode(scan, "filter",
+                                      and_(greater_equal(field_ref("i"), literal(10)),
+                                           equal(field_ref("key"), literal("even")))));
+  ASSERT_OK_AND_ASSIGN(
+      auto project,
+      MakeProjectNode(filter, "project",
+                      {call("multiply", {field_ref("i"), literal(2)}), literal(true)},
+                      {"double_i", "flag"}));
+  auto out_schema = schema({field("double_i", int32()), field("flag", boolean())});
+  AssertSchemaEqual(out_schema, project->output_schema());
+  auto sink_gen = compute::MakeSinkNode(project, "sink");
+
+  auto actual = Run(plan.get(), sink_gen, out_schema, "double_i");
+  std::string expected_json = "[";
+  for (int i = 10; i < 32; i += 2) {
+    expected_json += (i > 10 ? ", " : "") + std::string("[") + std::to_string(2 * i) +
+                     ", true]";
+  }
+  AssertTablesEqual(*TableFromJSON(out_schema, {expected_json + "]"}), *actual);
+}
+
+TEST_P(TestExecNodes, FilterLiteral) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context_));
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), "scan", MakeScanner()));
+  ASSERT_OK_AND_ASSIGN(auto filter, MakeFilterNode(scan, "filter", literal(false)));
+  auto sink_gen = compute::MakeSinkNode(filter, "sink");
+
+  auto actual = Run(plan.get(), sink_gen, schema_, "i");
+  ASSERT_EQ(actual->num_rows(), 0);
+}
+
+TEST_P(TestExecNodes, ScanGroupBy) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context_));
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), "scan", MakeScanner()));
+  ASSERT_OK_AND_ASSIGN(
+      auto group_by, compute::MakeGroupByNode(scan, "group_by", {FieldRef("key")},
+                                              {{"hash_sum", nullptr}}, {FieldRef("i")}));
+  auto sink_gen = compute::MakeSinkNode(group_by, "sink");
+
+  auto out_schema = schema({field("hash_sum", int64()), field("key", utf8())});
+  auto actual = Run(plan.get(), sink_gen, out_schema, "key");
+  // 0 + 2 + ... + 30 and 1 + 3 + ... + 31
+  AssertTablesEqual(*TableFromJSON(out_schema, {R"([[240, "even"], [256, "odd"]])"}),
+                    *actual);
+}
+
+TEST_P(TestExecNodes, ScanHashJoin) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make(&exec_context_));
+  ASSERT_OK_AND_ASSIGN(auto left, MakeScanNode(plan.get(), "left", MakeScanner()));
+  ASSERT_OK_AND_ASSIGN(auto right_scan, MakeScanNode(plan.get(), "right", MakeScanner()));
+  ASSERT_OK_AND_ASSIGN(auto right,
+                       MakeFilterNode(right_scan, "filter",
+                                      less(field_ref("i"), literal(4))));
+  ASSERT_OK_AND_ASSIGN(auto join, compute::MakeHashJoinNode(
+                                      left, right, "join", compute::JoinType::INNER,
+                                      {FieldRef("key")}, {FieldRef("key")}));
+  ASSERT_OK_AND_ASSIGN(auto project,
+                       MakeProjectNode(join, "project",
+                                       {call("add", {field_ref(0), field_ref(2)})},
+                                       {"sum"}));
+  auto sink_gen = compute::MakeSinkNode(project, "sink");
+
+  // Each left row matches the right rows 0 and 2, or 1 and 3, of the same parity
+  auto out_schema = schema({field("sum", int32())});
+  auto actual = Run(plan.get(), sink_gen, out_schema, "sum");
+  std::vector<int> sums;
+  for (int i = 0; i < 32; ++i) {
+    sums.push_back(i + i % 2);
+    sums.push_back(i + i % 2 + 2);
+  }
+  std::sort(sums.begin(), sums.end());
+  std::string expected_json = "[";
+  for (size_t i = 0; i < sums.size(); ++i) {
+    expected_json += (i ? ", [" : "[") + std::to_string(sums[i]) + "]";
+  }
+  AssertTablesEqual(*TableFromJSON(out_schema, {expected_json + "]"}), *actual);
+}
+
+TEST(ExecNodes, InvalidExpressions) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto source_schema = schema({field("i", int32())});
+  auto source = compute::MakeSourceNode(
+      plan.get(), "source", source_schema,
+      MakeVectorGenerator(std::vector<util::optional<ExecBatch>>{}));
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(TypeError, HasSubstr("must evaluate to bool"),
+                                  MakeFilterNode(source, "filter", field_ref("i")));
+  ASSERT_RAISES(Invalid, MakeProjectNode(source, "project", {field_ref("i")},
+                                         {"a", "b"}));
+}
+
+INSTANTIATE_TEST_SUITE_P(UseThreads, TestExecNodes, ::testing::Values(false, true));
+
+}  // namespace dataset
+}  // namespace arrow
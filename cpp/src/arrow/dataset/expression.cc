@@ -17,12 +17,19 @@
 
 #include "arrow/dataset/expression.h"
 
+#include <algorithm>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/registry.h"
 #include "arrow/dataset/expression_internal.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
@@ -564,6 +571,297 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input
   return executor->WrapResults(arguments, listener->values());
 }
 
+// A CompiledExpression's program is a vector of instructions in evaluation order. Each
+// instruction writes its result into the slot sharing its index and reads its arguments
+// from the slots of earlier instructions.
+struct CompiledExpression::Instruction {
+  // Exactly one of these is set
+  const Datum* literal = NULLPTR;
+  const FieldRef* field_ref = NULLPTR;
+  const Expression::Call* call = NULLPTR;
+
+  std::vector<int> arguments;
+  // Slots which aren't read by any later instruction and can be released once this
+  // instruction has executed
+  std::vector<int> last_uses;
+
+  // Field reference state: the expected type, the path found in the last input type or
+  // schema, the cast bound to the last field's descriptor if its type differed from the
+  // expected one and the null used for a missing field
+  ValueDescr descr;
+  std::shared_ptr<void> last_input_type;
+  FieldPath path;
+  compute::CastOptions cast_options;
+  std::unique_ptr<compute::BoundFunction> cast;
+  std::shared_ptr<Scalar> null;
+
+  // Call state: the executor, initialized for the last argument descriptors
+  std::unique_ptr<compute::KernelContext> kernel_context;
+  std::unique_ptr<compute::detail::KernelExecutor> executor;
+  std::vector<ValueDescr> descrs;
+
+  // "project" broadcasts its scalar arguments to the length of its array arguments:
+  // the arrays broadcast by the last execution, with the scalars they were made from
+  bool broadcasts_scalars = false;
+  std::vector<std::pair<std::shared_ptr<Scalar>, std::shared_ptr<Array>>> broadcasts;
+};
+
+// The state of an execution of the program. Each thread executing concurrently needs its
+// own, so they are pooled.
+struct CompiledExpression::Program {
+  compute::ExecContext* exec_context;
+  std::vector<Instruction> instructions;
+  std::vector<Datum> slots;
+
+  int Compile(const Expression& expr,
+              std::unordered_map<Expression, int, Expression::Hash>* compiled) {
+    auto it = compiled->find(expr);
+    if (it != compiled->end()) return it->second;
+
+    Instruction instruction;
+    if (auto lit = expr.literal()) {
+      instruction.literal = lit;
+    } else if (auto call = expr.call()) {
+      instruction.call = call;
+      instruction.broadcasts_scalars = call->function_name == "project";
+      for (const Expression& argument : call->arguments) {
+        instruction.arguments.push_back(Compile(argument, compiled));
+      }
+    } else {
+      instruction.field_ref = expr.field_ref();
+      instruction.descr = expr.descr();
+    }
+
+    int slot = static_cast<int>(instructions.size());
+    instructions.push_back(std::move(instruction));
+    compiled->emplace(expr, slot);
+    return slot;
+  }
+
+  Status ExecuteFieldRef(Instruction* instruction, const Datum& input, Datum* out) {
+    std::shared_ptr<void> input_type;
+    if (auto type = input.type()) {
+      input_type = type;
+    } else if (auto schema = input.schema()) {
+      input_type = schema;
+    } else {
+      return Status::NotImplemented("retrieving fields from datum ", input.ToString());
+    }
+
+    if (input_type != instruction->last_input_type) {
+      const FieldRef& ref = *instruction->field_ref;
+      if (auto type = input.type()) {
+        ARROW_ASSIGN_OR_RAISE(instruction->path, ref.FindOneOrNone(*type));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(instruction->path, ref.FindOneOrNone(*input.schema()));
+      }
+      instruction->last_input_type = std::move(input_type);
+    }
+
+    const auto& descr = instruction->descr;
+    Datum field;
+    if (!instruction->path.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          field, util::visit(FieldPathGetDatumImpl{input, instruction->path}, input.value));
+    }
+    if (field == Datum{}) {
+      if (instruction->null == nullptr) {
+        instruction->null = MakeNullScalar(descr.type);
+      }
+      *out = instruction->null;
+      return Status::OK();
+    }
+
+    if (!field.type()->Equals(*descr.type)) {
+      // Fields are cast to the type they were bound to, typically because a fragment's
+      // physical schema differs from the dataset's. Dispatch is only redone when the
+      // field's type or shape changes.
+      if (instruction->cast == nullptr ||
+          instruction->cast->in_descrs()[0] != field.descr()) {
+        ARROW_ASSIGN_OR_RAISE(auto cast_function,
+                              exec_context->func_registry()->GetFunction("cast"));
+        instruction->cast_options = compute::CastOptions::Safe(descr.type);
+        ARROW_ASSIGN_OR_RAISE(instruction->cast,
+                              cast_function->Bind({field.descr()},
+                                                  &instruction->cast_options,
+                                                  exec_context));
+      }
+      ARROW_ASSIGN_OR_RAISE(field, instruction->cast->Execute({field}));
+    }
+    *out = std::move(field);
+    return Status::OK();
+  }
+
+  // Broadcast scalar arguments like the kernel of "project" would, reusing the arrays
+  // of the last execution for the same scalars, such as the null columns of fields
+  // missing from a fragment.
+  Status BroadcastScalars(Instruction* instruction, std::vector<Datum>* arguments) {
+    auto array = std::find_if(arguments->begin(), arguments->end(),
+                              [](const Datum& argument) { return argument.is_array(); });
+    if (array == arguments->end()) return Status::OK();
+    const int64_t length = array->length();
+
+    instruction->broadcasts.resize(arguments->size());
+    for (size_t i = 0; i < arguments->size(); ++i) {
+      Datum* argument = &(*arguments)[i];
+      if (!argument->is_scalar()) continue;
+
+      const auto& scalar = argument->scalar();
+      auto* broadcast = &instruction->broadcasts[i];
+      if (broadcast->second == nullptr || broadcast->second->length() < length ||
+          !broadcast->first->Equals(*scalar)) {
+        broadcast->first = scalar;
+        ARROW_ASSIGN_OR_RAISE(
+            broadcast->second,
+            MakeArrayFromScalar(*scalar, length, exec_context->memory_pool()));
+      }
+      if (broadcast->second->length() == length) {
+        *argument = broadcast->second;
+      } else {
+        *argument = broadcast->second->Slice(0, length);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ExecuteCall(Instruction* instruction, Datum* out) {
+    const Expression::Call* call = instruction->call;
+
+    std::vector<Datum> arguments(instruction->arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      arguments[i] = slots[instruction->arguments[i]];
+    }
+    if (instruction->broadcasts_scalars) {
+      RETURN_NOT_OK(BroadcastScalars(instruction, &arguments));
+    }
+
+    // Kernel lookup was done by Bind, and the executor only needs to be reinitialized
+    // when the arguments' shapes differ from the previous execution's
+    auto descrs = GetDescriptors(arguments);
+    if (instruction->executor == nullptr || descrs != instruction->descrs) {
+      instruction->kernel_context.reset(new compute::KernelContext(exec_context));
+      instruction->kernel_context->SetState(call->kernel_state.get());
+      instruction->executor = compute::detail::KernelExecutor::MakeScalar();
+      RETURN_NOT_OK(instruction->executor->Init(
+          instruction->kernel_context.get(), {call->kernel, descrs, call->options.get()}));
+      instruction->descrs = std::move(descrs);
+    }
+
+    compute::detail::DatumAccumulator listener;
+    RETURN_NOT_OK(instruction->executor->Execute(arguments, &listener));
+    *out = instruction->executor->WrapResults(arguments, listener.values());
+    return Status::OK();
+  }
+
+  Status ExecuteProgram(const Datum& input) {
+    for (size_t i = 0; i < instructions.size(); ++i) {
+      Instruction* instruction = &instructions[i];
+      if (instruction->literal) {
+        slots[i] = *instruction->literal;
+      } else if (instruction->field_ref) {
+        RETURN_NOT_OK(ExecuteFieldRef(instruction, input, &slots[i]));
+      } else {
+        RETURN_NOT_OK(ExecuteCall(instruction, &slots[i]));
+      }
+
+      for (int slot : instruction->last_uses) {
+        slots[slot] = Datum{};
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Execute(const Datum& input) {
+    auto st = ExecuteProgram(input);
+    if (!st.ok()) {
+      // Don't hold on to the intermediate results of a failed execution
+      std::fill(slots.begin(), slots.end(), Datum{});
+      return st;
+    }
+    return std::move(slots.back());
+  }
+};
+
+struct CompiledExpression::Impl {
+  Expression expr;
+  compute::ExecContext exec_context;
+  std::mutex mutex;
+  // Programs not currently executing
+  std::vector<std::unique_ptr<Program>> idle;
+
+  std::unique_ptr<Program> MakeProgram() {
+    std::unique_ptr<Program> program(new Program);
+    program->exec_context = &exec_context;
+
+    std::unordered_map<Expression, int, Expression::Hash> slots;
+    program->Compile(expr, &slots);
+    auto& instructions = program->instructions;
+    program->slots.resize(instructions.size());
+
+    // Release every slot but the result's after its last use
+    std::vector<int> last_use(instructions.size(), -1);
+    for (int i = 0; i < static_cast<int>(instructions.size()); ++i) {
+      for (int argument : instructions[i].arguments) {
+        last_use[argument] = i;
+      }
+    }
+    for (int slot = 0; slot < static_cast<int>(last_use.size()) - 1; ++slot) {
+      if (last_use[slot] != -1) {
+        instructions[last_use[slot]].last_uses.push_back(slot);
+      }
+    }
+    return program;
+  }
+};
+
+CompiledExpression::CompiledExpression() = default;
+
+CompiledExpression::~CompiledExpression() = default;
+
+Result<std::unique_ptr<CompiledExpression>> CompiledExpression::Make(
+    Expression expr, compute::ExecContext* exec_context) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot compile unbound expression.");
+  }
+
+  if (!expr.IsScalarExpression()) {
+    return Status::Invalid("Cannot compile non-scalar expression ", expr.ToString());
+  }
+
+  std::unique_ptr<CompiledExpression> compiled(new CompiledExpression);
+  compiled->impl_.reset(new Impl);
+  auto impl = compiled->impl_.get();
+  if (exec_context != nullptr) {
+    impl->exec_context = *exec_context;
+  }
+  impl->expr = std::move(expr);
+  impl->idle.push_back(impl->MakeProgram());
+  return std::move(compiled);
+}
+
+const Expression& CompiledExpression::expression() const { return impl_->expr; }
+
+Result<Datum> CompiledExpression::Execute(const Datum& input) {
+  std::unique_ptr<Program> program;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (!impl_->idle.empty()) {
+      program = std::move(impl_->idle.back());
+      impl_->idle.pop_back();
+    }
+  }
+  if (program == nullptr) {
+    // Other threads are executing every program so far
+    program = impl_->MakeProgram();
+  }
+
+  auto result = program->Execute(input);
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  impl_->idle.push_back(std::move(program));
+  return result;
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -211,6 +211,43 @@ ARROW_DS_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Datum& input,
                                       compute::ExecContext* = NULLPTR);
 
+/// \brief A bound scalar expression compiled for repeated execution, for example
+/// against each batch of a scan.
+///
+/// Compilation flattens the expression into a linear program, evaluating identical
+/// subexpressions only once. Each call keeps its kernel executor across executions
+/// and only reinitializes it when the shapes of its arguments change, and each field
+/// reference remembers where its field was found in the last input's schema and how
+/// to cast it to the bound type. Scalars which "project" broadcasts, such as the nulls
+/// of fields missing from the input, are only materialized again when they or the
+/// length of the input change. An intermediate result is released as soon as its last
+/// consumer has executed.
+///
+/// Execute() may be called from several threads: each concurrent execution uses its
+/// own copy of the program's state, which is compiled on demand and kept for reuse.
+class ARROW_DS_EXPORT CompiledExpression {
+ public:
+  /// Compile a bound scalar expression. The ExecContext is copied.
+  static Result<std::unique_ptr<CompiledExpression>> Make(
+      Expression expr, compute::ExecContext* = NULLPTR);
+
+  ~CompiledExpression();
+
+  /// Execute the expression against the provided input Datum, as
+  /// ExecuteScalarExpression would.
+  Result<Datum> Execute(const Datum& input);
+
+  const Expression& expression() const;
+
+ private:
+  CompiledExpression();
+
+  struct Instruction;
+  struct Program;
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 // Serialization
 
 ARROW_DS_EXPORT
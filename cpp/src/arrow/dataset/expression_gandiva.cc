@@ -0,0 +1,289 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/expression_gandiva.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+using gandiva::TreeExprBuilder;
+
+// Compute functions with a Gandiva function of the same semantics and signature.
+const std::unordered_map<std::string, std::string>& GandivaFunctionNames() {
+  static const std::unordered_map<std::string, std::string> names = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"divide", "divide"},
+      {"negate", "negative"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"invert", "not"},
+      {"is_null", "isnull"},
+      {"is_valid", "isnotnull"},
+  };
+  return names;
+}
+
+Result<gandiva::NodePtr> LiteralToGandivaNode(const Datum& literal) {
+  if (!literal.is_scalar()) {
+    return Status::NotImplemented("Gandiva translation of non-scalar literal ",
+                                  literal.ToString());
+  }
+  const Scalar& scalar = *literal.scalar();
+  if (!scalar.is_valid) {
+    return TreeExprBuilder::MakeNull(scalar.type);
+  }
+  switch (scalar.type->id()) {
+    case Type::BOOL:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const BooleanScalar&>(scalar).value);
+    case Type::INT8:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const Int8Scalar&>(scalar).value);
+    case Type::INT16:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const Int16Scalar&>(scalar).value);
+    case Type::INT32:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const Int32Scalar&>(scalar).value);
+    case Type::INT64:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const Int64Scalar&>(scalar).value);
+    case Type::UINT8:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const UInt8Scalar&>(scalar).value);
+    case Type::UINT16:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const UInt16Scalar&>(scalar).value);
+    case Type::UINT32:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const UInt32Scalar&>(scalar).value);
+    case Type::UINT64:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const UInt64Scalar&>(scalar).value);
+    case Type::FLOAT:
+      return TreeExprBuilder::MakeLiteral(checked_cast<const FloatScalar&>(scalar).value);
+    case Type::DOUBLE:
+      return TreeExprBuilder::MakeLiteral(
+          checked_cast<const DoubleScalar&>(scalar).value);
+    case Type::STRING:
+      return TreeExprBuilder::MakeStringLiteral(
+          checked_cast<const StringScalar&>(scalar).value->ToString());
+    case Type::BINARY:
+      return TreeExprBuilder::MakeBinaryLiteral(
+          checked_cast<const BinaryScalar&>(scalar).value->ToString());
+    default:
+      return Status::NotImplemented("Gandiva translation of literal of type ",
+                                    *scalar.type);
+  }
+}
+
+Result<gandiva::NodePtr> CastToGandivaNode(const Expression::Call& call,
+                                           gandiva::NodeVector args) {
+  const auto& to_type = call.descr.type;
+  const auto& from_type = call.arguments[0].type();
+  // Only widening casts, which cannot fail or lose information in either library.
+  if (to_type->id() == Type::INT64 &&
+      (from_type->id() == Type::INT32 || from_type->id() == Type::INT64)) {
+    return TreeExprBuilder::MakeFunction("castBIGINT", std::move(args), to_type);
+  }
+  if (to_type->id() == Type::DOUBLE &&
+      (from_type->id() == Type::INT32 || from_type->id() == Type::FLOAT)) {
+    return TreeExprBuilder::MakeFunction("castFLOAT8", std::move(args), to_type);
+  }
+  return Status::NotImplemented("Gandiva translation of cast from ", *from_type, " to ",
+                                *to_type);
+}
+
+}  // namespace
+
+Result<gandiva::NodePtr> ToGandivaNode(const Expression& expr, const Schema& schema) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot translate unbound expression ", expr.ToString());
+  }
+
+  if (auto literal = expr.literal()) {
+    return LiteralToGandivaNode(*literal);
+  }
+
+  if (auto ref = expr.field_ref()) {
+    if (!ref->IsName()) {
+      return Status::NotImplemented("Gandiva translation of nested field reference ",
+                                    ref->ToString());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto field, ref->GetOne(schema));
+    return TreeExprBuilder::MakeField(std::move(field));
+  }
+
+  auto call = expr.call();
+  gandiva::NodeVector args;
+  for (const auto& argument : call->arguments) {
+    ARROW_ASSIGN_OR_RAISE(auto arg, ToGandivaNode(argument, schema));
+    args.push_back(std::move(arg));
+  }
+
+  if (call->function_name == "and_kleene") {
+    return TreeExprBuilder::MakeAnd(args);
+  }
+  if (call->function_name == "or_kleene") {
+    return TreeExprBuilder::MakeOr(args);
+  }
+  if (call->function_name == "cast") {
+    return CastToGandivaNode(*call, std::move(args));
+  }
+  const auto& names = GandivaFunctionNames();
+  auto it = names.find(call->function_name);
+  if (it == names.end()) {
+    return Status::NotImplemented("Gandiva translation of function ",
+                                  call->function_name);
+  }
+  return TreeExprBuilder::MakeFunction(it->second, std::move(args), call->descr.type);
+}
+
+Result<gandiva::ConditionPtr> ToGandivaCondition(const Expression& filter,
+                                                 const Schema& schema) {
+  if (filter.type() == nullptr || filter.type()->id() != Type::BOOL) {
+    return Status::Invalid("Filter must be a boolean expression, got ",
+                           filter.ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto node, ToGandivaNode(filter, schema));
+  return TreeExprBuilder::MakeCondition(std::move(node));
+}
+
+Result<gandiva::ExpressionVector> ToGandivaExpressions(const Expression& projection,
+                                                       const Schema& schema) {
+  auto call = projection.call();
+  if (call == nullptr || call->function_name != "project") {
+    return Status::Invalid("Projection must be a call to project, got ",
+                           projection.ToString());
+  }
+  const auto& struct_type = checked_cast<const StructType&>(*call->descr.type);
+
+  gandiva::ExpressionVector exprs;
+  for (size_t i = 0; i < call->arguments.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto node, ToGandivaNode(call->arguments[i], schema));
+    exprs.push_back(
+        TreeExprBuilder::MakeExpression(std::move(node), struct_type.field(i)));
+  }
+  return exprs;
+}
+
+Result<std::shared_ptr<gandiva::Filter>> GandivaBatchFilter::ForSchema(
+    const std::shared_ptr<Schema>& schema) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (last_schema_ == nullptr || !last_schema_->Equals(*schema)) {
+    last_schema_ = schema;
+    last_filter_ = nullptr;
+    auto condition = ToGandivaCondition(filter_, *schema);
+    // A filter without field references is a constant, leave it to the compute path.
+    if (condition.ok() && !FieldsInExpression(filter_).empty() &&
+        !gandiva::Filter::Make(schema, *condition, &last_filter_).ok()) {
+      last_filter_ = nullptr;
+    }
+  }
+  return last_filter_;
+}
+
+Result<std::shared_ptr<RecordBatch>> GandivaBatchFilter::Filter(
+    const std::shared_ptr<RecordBatch>& batch, MemoryPool* pool) {
+  if (batch->num_rows() == 0) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto filter, ForSchema(batch->schema()));
+  if (filter == nullptr) {
+    return nullptr;
+  }
+
+  std::shared_ptr<Array> selection;
+  ARROW_RETURN_NOT_OK(filter->EvaluateAdaptive(*batch, pool, &selection));
+
+  compute::ExecContext exec_context{pool};
+  Datum filtered;
+  if (selection->type_id() == Type::BOOL) {
+    if (checked_cast<const BooleanArray&>(*selection).true_count() == batch->num_rows()) {
+      return batch;
+    }
+    ARROW_ASSIGN_OR_RAISE(filtered,
+                          compute::Filter(batch, selection,
+                                          compute::FilterOptions::Defaults(),
+                                          &exec_context));
+  } else {
+    if (selection->length() == 0) {
+      return batch->Slice(0, 0);
+    }
+    ARROW_ASSIGN_OR_RAISE(filtered, compute::Take(batch, selection,
+                                                  compute::TakeOptions::NoBoundsCheck(),
+                                                  &exec_context));
+  }
+  return filtered.record_batch();
+}
+
+Result<std::shared_ptr<gandiva::Projector>> GandivaBatchProjector::ForSchema(
+    const std::shared_ptr<Schema>& schema) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (last_schema_ == nullptr || !last_schema_->Equals(*schema)) {
+    last_schema_ = schema;
+    last_projector_ = nullptr;
+    auto exprs = ToGandivaExpressions(projection_, *schema);
+    // Only virtual columns are projected, leave the broadcast to the compute path.
+    if (exprs.ok() && !FieldsInExpression(projection_).empty() &&
+        !gandiva::Projector::Make(schema, *exprs, &last_projector_).ok()) {
+      last_projector_ = nullptr;
+    }
+  }
+  return last_projector_;
+}
+
+Result<std::shared_ptr<RecordBatch>> GandivaBatchProjector::Project(
+    const std::shared_ptr<RecordBatch>& batch, MemoryPool* pool) {
+  if (batch->num_rows() == 0) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto projector, ForSchema(batch->schema()));
+  if (projector == nullptr) {
+    return nullptr;
+  }
+
+  arrow::ArrayVector columns;
+  ARROW_RETURN_NOT_OK(projector->Evaluate(*batch, pool, &columns));
+  const auto& struct_type = checked_cast<const StructType&>(*projection_.type());
+  auto out_schema = schema(struct_type.fields(), batch->schema()->metadata());
+  return RecordBatch::Make(std::move(out_schema), batch->num_rows(), std::move(columns));
+}
+
+}  // namespace dataset
+}  // namespace arrow
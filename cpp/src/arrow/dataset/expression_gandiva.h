@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+// Evaluation of dataset expressions with Gandiva. Only available when Arrow is built
+// with ARROW_GANDIVA.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/dataset/expression.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "gandiva/condition.h"
+#include "gandiva/expression.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Translate a bound expression to a Gandiva tree, referencing the fields of
+/// `schema`.
+///
+/// Supports field references by name, scalar literals and calls to the arithmetic,
+/// comparison, boolean, null check and numeric cast functions. Returns NotImplemented
+/// for anything else.
+ARROW_DS_EXPORT
+Result<gandiva::NodePtr> ToGandivaNode(const Expression& expr, const Schema& schema);
+
+/// \brief Translate a bound boolean filter to a Gandiva condition.
+ARROW_DS_EXPORT
+Result<gandiva::ConditionPtr> ToGandivaCondition(const Expression& filter,
+                                                 const Schema& schema);
+
+/// \brief Translate a bound projection (a call to "project", as built by project())
+/// to one Gandiva expression per projected field.
+ARROW_DS_EXPORT
+Result<gandiva::ExpressionVector> ToGandivaExpressions(const Expression& projection,
+                                                       const Schema& schema);
+
+/// \brief Filters record batches with a gandiva::Filter.
+///
+/// A Filter is built for each distinct batch schema, Gandiva caches the generated code
+/// across instances. Returns null for a batch it cannot evaluate (untranslatable
+/// expression, type not supported by Gandiva, empty batch): the caller falls back to
+/// the compute kernels.
+class ARROW_DS_EXPORT GandivaBatchFilter {
+ public:
+  explicit GandivaBatchFilter(Expression filter) : filter_(std::move(filter)) {}
+
+  Result<std::shared_ptr<RecordBatch>> Filter(const std::shared_ptr<RecordBatch>& batch,
+                                              MemoryPool* pool);
+
+ private:
+  Result<std::shared_ptr<gandiva::Filter>> ForSchema(
+      const std::shared_ptr<Schema>& schema);
+
+  Expression filter_;
+  std::mutex mutex_;
+  std::shared_ptr<Schema> last_schema_;
+  std::shared_ptr<gandiva::Filter> last_filter_;
+};
+
+/// \brief Projects record batches with a gandiva::Projector.
+///
+/// Same caching and fallback rules as GandivaBatchFilter.
+class ARROW_DS_EXPORT GandivaBatchProjector {
+ public:
+  explicit GandivaBatchProjector(Expression projection)
+      : projection_(std::move(projection)) {}
+
+  Result<std::shared_ptr<RecordBatch>> Project(const std::shared_ptr<RecordBatch>& batch,
+                                               MemoryPool* pool);
+
+ private:
+  Result<std::shared_ptr<gandiva::Projector>> ForSchema(
+      const std::shared_ptr<Schema>& schema);
+
+  Expression projection_;
+  std::mutex mutex_;
+  std::shared_ptr<Schema> last_schema_;
+  std::shared_ptr<gandiva::Projector> last_projector_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/expression_gandiva.h"
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/test_util.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestExpressionGandiva : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("i32", int32()), field("f64", float64()),
+                      field("str", utf8())});
+    batch_ = RecordBatchFromJSON(schema_, R"([
+      {"i32": 1, "f64": 1.5, "str": "a"},
+      {"i32": 2, "f64": null, "str": "b"},
+      {"i32": null, "f64": 3.5, "str": null},
+      {"i32": 4, "f64": 4.5, "str": "d"},
+      {"i32": 5, "f64": 5.5, "str": "e"}
+    ])");
+  }
+
+  Expression Bind(const Expression& expr) {
+    EXPECT_OK_AND_ASSIGN(auto bound, expr.Bind(*schema_));
+    return bound;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestExpressionGandiva, Translate) {
+  ASSERT_OK(ToGandivaNode(Bind(field_ref("i32")), *schema_));
+  ASSERT_OK(ToGandivaNode(Bind(literal(std::make_shared<Int32Scalar>())), *schema_));
+  ASSERT_OK(ToGandivaCondition(
+      Bind(and_(greater(field_ref("i32"), literal(2)), is_valid(field_ref("f64")))),
+      *schema_));
+  ASSERT_OK_AND_ASSIGN(auto exprs,
+                       ToGandivaExpressions(
+                           Bind(project({call("add", {field_ref("f64"), literal(1.0)}),
+                                         field_ref("i32")},
+                                        {"f64 + 1", "i32"})),
+                           *schema_));
+  ASSERT_EQ(exprs.size(), 2);
+
+  // Not boolean
+  ASSERT_RAISES(Invalid, ToGandivaCondition(Bind(field_ref("i32")), *schema_));
+  // Unbound
+  ASSERT_RAISES(Invalid, ToGandivaNode(field_ref("i32"), *schema_));
+  // No Gandiva equivalent
+  ASSERT_RAISES(NotImplemented,
+                ToGandivaNode(Bind(call("ascii_upper", {field_ref("str")})), *schema_));
+}
+
+TEST_F(TestExpressionGandiva, Filter) {
+  GandivaBatchFilter filter(Bind(greater(field_ref("i32"), literal(1))));
+  ASSERT_OK_AND_ASSIGN(auto filtered, filter.Filter(batch_, default_memory_pool()));
+  ASSERT_NE(filtered, nullptr);
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(schema_, R"([
+      {"i32": 2, "f64": null, "str": "b"},
+      {"i32": 4, "f64": 4.5, "str": "d"},
+      {"i32": 5, "f64": 5.5, "str": "e"}
+    ])"),
+                       *filtered);
+
+  // Same schema, the Gandiva filter is reused
+  ASSERT_OK_AND_ASSIGN(filtered, filter.Filter(batch_->Slice(3), default_memory_pool()));
+  ASSERT_EQ(filtered->num_rows(), 2);
+}
+
+TEST_F(TestExpressionGandiva, FilterFallsBack) {
+  GandivaBatchFilter filter(
+      Bind(equal(call("ascii_upper", {field_ref("str")}), literal("A"))));
+  ASSERT_OK_AND_ASSIGN(auto filtered, filter.Filter(batch_, default_memory_pool()));
+  ASSERT_EQ(filtered, nullptr);
+
+  // Constant filters are left to the compute path
+  GandivaBatchFilter constant(Bind(literal(true)));
+  ASSERT_OK_AND_ASSIGN(filtered, constant.Filter(batch_, default_memory_pool()));
+  ASSERT_EQ(filtered, nullptr);
+}
+
+TEST_F(TestExpressionGandiva, Project) {
+  GandivaBatchProjector projector(
+      Bind(project({call("multiply", {field_ref("f64"), literal(2.0)}), field_ref("i32")},
+                   {"f64 * 2", "i32"})));
+  ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(batch_, default_memory_pool()));
+  ASSERT_NE(projected, nullptr);
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(schema({field("f64 * 2", float64()),
+                                                    field("i32", int32())}),
+                                            R"([
+      {"f64 * 2": 3.0, "i32": 1},
+      {"f64 * 2": null, "i32": 2},
+      {"f64 * 2": 7.0, "i32": null},
+      {"f64 * 2": 9.0, "i32": 4},
+      {"f64 * 2": 11.0, "i32": 5}
+    ])"),
+                       *projected);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -533,6 +534,13 @@ void ExpectExecute(Expression expr, Datum in, Datum* actual_out = NULLPTR) {
 
   AssertDatumsEqual(actual, expected, /*verbose=*/true);
 
+  ASSERT_OK_AND_ASSIGN(auto compiled, CompiledExpression::Make(expr));
+  for (int i = 0; i < 2; ++i) {
+    // the second execution reuses the state of the first
+    ASSERT_OK_AND_ASSIGN(Datum compiled_actual, compiled->Execute(in));
+    AssertDatumsEqual(compiled_actual, expected, /*verbose=*/true);
+  }
+
   if (actual_out) {
     *actual_out = actual;
   }
@@ -570,6 +578,90 @@ TEST(Expression, ExecuteCall) {
   ])"));
 }
 
+TEST(Expression, CompiledExecuteVaryingInputs) {
+  // "a + a" is evaluated once
+  ASSERT_OK_AND_ASSIGN(
+      auto expr,
+      call("multiply", {call("add", {field_ref("a"), field_ref("a")}),
+                        call("add", {field_ref("a"), field_ref("a")})})
+          .Bind(ValueDescr::Array(struct_({field("a", float64())}))));
+  ASSERT_OK_AND_ASSIGN(auto compiled, CompiledExpression::Make(expr));
+
+  for (Datum in : {
+           Datum(ArrayFromJSON(struct_({field("a", float64())}),
+                               R"([{"a": 1.5}, {"a": null}, {"a": -2}])")),
+           // the field moved and has another type, so it is looked up again and cast
+           Datum(ArrayFromJSON(struct_({field("b", utf8()), field("a", int32())}),
+                               R"([{"b": "x", "a": 3}, {"b": "y", "a": 0}])")),
+           // the field is missing, so the executors are reinitialized for scalars
+           Datum(ArrayFromJSON(struct_({field("b", utf8())}), R"([{"b": "x"}])")),
+       }) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, in));
+    ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(in));
+    AssertDatumsEqual(actual, expected, /*verbose=*/true);
+  }
+
+  ASSERT_RAISES(Invalid, CompiledExpression::Make(field_ref("a")));
+}
+
+TEST(Expression, CompiledExecuteSchemaEvolution) {
+  // fields of a fragment's physical schema are cast and missing fields are null
+  ASSERT_OK_AND_ASSIGN(
+      auto expr, project({field_ref("a"), field_ref("b")}, {"a", "b"})
+                     .Bind(ValueDescr::Array(
+                         struct_({field("a", int64()), field("b", utf8())}))));
+  ASSERT_OK_AND_ASSIGN(auto compiled, CompiledExpression::Make(expr));
+
+  auto physical_type = struct_({field("a", int32())});
+  std::shared_ptr<Buffer> last_b_buffer;
+  for (const char* json : {R"([{"a": 1}, {"a": null}, {"a": 3}])",
+                           R"([{"a": 4}, {"a": 5}, {"a": 6}])", R"([{"a": 7}])",
+                           R"([{"a": 8}, {"a": 9}, {"a": 10}, {"a": 11}])"}) {
+    Datum in(ArrayFromJSON(physical_type, json));
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, in));
+    ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(in));
+    AssertDatumsEqual(actual, expected, /*verbose=*/true);
+
+    const auto& b = actual.array_as<StructArray>()->field(1);
+    ASSERT_EQ(b->null_count(), b->length());
+    if (last_b_buffer != nullptr && b->length() <= 3) {
+      // the null column is reused as long as it is long enough
+      ASSERT_EQ(b->data()->buffers[1], last_b_buffer);
+    }
+    last_b_buffer = b->data()->buffers[1];
+  }
+
+  // the field appears with the bound type
+  Datum in(ArrayFromJSON(struct_({field("a", int64()), field("b", utf8())}),
+                         R"([{"a": 1, "b": "x"}, {"a": 2, "b": null}])"));
+  ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, in));
+  ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(in));
+  AssertDatumsEqual(actual, expected, /*verbose=*/true);
+}
+
+TEST(Expression, CompiledExecuteConcurrently) {
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       call("add", {field_ref("a"), literal(int64_t(1))})
+                           .Bind(ValueDescr::Array(struct_({field("a", int64())}))));
+  ASSERT_OK_AND_ASSIGN(auto compiled, CompiledExpression::Make(expr));
+
+  // each thread casts its own input type
+  std::vector<std::thread> threads;
+  for (auto type : {int8(), int16(), int32(), int64()}) {
+    threads.emplace_back([&compiled, &expr, type] {
+      Datum in(ArrayFromJSON(struct_({field("a", type)}), R"([{"a": 1}, {"a": 2}])"));
+      ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, in));
+      for (int i = 0; i < 100; ++i) {
+        ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(in));
+        AssertDatumsEqual(actual, expected, /*verbose=*/true);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 TEST(Expression, ExecuteDictionaryTransparent) {
   ExpectExecute(
       equal(field_ref("a"), field_ref("b")),
@@ -0,0 +1,505 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/external_group_by.h"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash_aggregate_internal.h"
+#include "arrow/compute/row_encoder.h"
+#include "arrow/dataset/spill_internal.h"
+#include "arrow/datum.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using compute::ExecBatch;
+using compute::ExecContext;
+using compute::HashAggregateKernel;
+using compute::KernelContext;
+using compute::KernelState;
+using compute::internal::Grouper;
+
+namespace dataset {
+
+using internal::BufferSize;
+using internal::SpillDirectory;
+
+namespace {
+
+// Partitions are split again at most this many times. Rows only end up in the same
+// partition at every level if their keys hash alike with every level's salt, so this
+// only guards against pathological keys, whose groups are then aggregated in memory.
+constexpr int kMaxSpillDepth = 4;
+
+// Estimated overhead of a group in the Grouper's hash table, on top of its key
+constexpr int64_t kGroupOverhead = 32;
+
+// What the passes of a group by share: the aggregation, and where to spill.
+//
+// The aggregated batches have the targets then the keys as columns, so that the
+// arguments of the aggregates are the first columns.
+struct GroupBySpec {
+  ExternalGroupByOptions options;
+  std::shared_ptr<SpillDirectory> spill_dir;
+  // Schema of the aggregated (and spilled) batches
+  std::shared_ptr<Schema> schema;
+  std::vector<ValueDescr> argument_descrs;
+  std::vector<ValueDescr> key_descrs;
+  std::vector<const HashAggregateKernel*> kernels;
+  std::shared_ptr<Schema> out_schema;
+
+  int num_arguments() const { return static_cast<int>(argument_descrs.size()); }
+
+  ExecBatch KeyBatch(const RecordBatch& batch) const {
+    std::vector<Datum> values;
+    for (int i = num_arguments(); i < batch.num_columns(); ++i) {
+      values.emplace_back(batch.column_data(i));
+    }
+    return ExecBatch(std::move(values), batch.num_rows());
+  }
+};
+
+// A spilled partition, which is aggregated by a pass of the given depth
+struct SpilledPartition {
+  std::string path;
+  int depth;
+};
+
+Result<std::shared_ptr<Array>> MakeIndices(TypedBufferBuilder<int32_t>* builder) {
+  const int64_t length = builder->length();
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(builder->Finish(&data));
+  return std::make_shared<Int32Array>(length, std::move(data));
+}
+
+// One pass over some batches: the input, or a spilled partition.
+//
+// Groups are added to the Grouper until they outgrow the memory limit. The Grouper is
+// then frozen: the rows of its groups are still aggregated, and the other rows are
+// hash partitioned and spilled. The groups of a partition are therefore in no other
+// partition nor in memory, and the partitions can be aggregated independently.
+class GroupByPass {
+ public:
+  GroupByPass(std::shared_ptr<GroupBySpec> spec, int depth)
+      : spec_(std::move(spec)),
+        depth_(depth),
+        tracked_pool_(spec_->options.pool),
+        ctx_(&tracked_pool_),
+        temp_ctx_(spec_->options.pool) {}
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(grouper_, Grouper::Make(spec_->key_descrs, &ctx_));
+    ARROW_ASSIGN_OR_RAISE(
+        states_, compute::internal::InitHashAggregateKernels(
+                     spec_->kernels, &ctx_, spec_->options.aggregates,
+                     spec_->argument_descrs));
+    return encoder_.Init(spec_->key_descrs, &temp_ctx_);
+  }
+
+  const std::vector<std::unique_ptr<KernelState>>& states() const { return states_; }
+
+  Status Consume(const std::shared_ptr<RecordBatch>& batch) {
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    const ExecBatch keys = spec_->KeyBatch(*batch);
+    if (!frozen_) {
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(keys));
+      RETURN_NOT_OK(Aggregate(batch, ids));
+      for (const auto& key : keys.values) {
+        key_bytes_ += BufferSize(*key.array());
+      }
+      num_rows_ += batch->num_rows();
+      frozen_ = depth_ < kMaxSpillDepth && GroupsSize() > spec_->options.memory_limit;
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Lookup(keys));
+    const ArrayData& id_data = *ids.array();
+    if (id_data.GetNullCount() == 0) {
+      return Aggregate(batch, ids);
+    }
+    if (id_data.GetNullCount() == batch->num_rows()) {
+      return Spill(batch);
+    }
+
+    // Split the rows between the known groups and the spilled ones
+    TypedBufferBuilder<int32_t> known(temp_ctx_.memory_pool());
+    TypedBufferBuilder<int32_t> spilled(temp_ctx_.memory_pool());
+    RETURN_NOT_OK(known.Reserve(batch->num_rows() - id_data.GetNullCount()));
+    RETURN_NOT_OK(spilled.Reserve(id_data.GetNullCount()));
+    const uint8_t* validity = id_data.GetValues<uint8_t>(0, 0);
+    for (int32_t i = 0; i < static_cast<int32_t>(batch->num_rows()); ++i) {
+      if (BitUtil::GetBit(validity, id_data.offset + i)) {
+        known.UnsafeAppend(i);
+      } else {
+        spilled.UnsafeAppend(i);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto known_indices, MakeIndices(&known));
+    ARROW_ASSIGN_OR_RAISE(auto spilled_indices, MakeIndices(&spilled));
+
+    const auto take_options = compute::TakeOptions::NoBoundsCheck();
+    ARROW_ASSIGN_OR_RAISE(Datum known_rows,
+                          compute::Take(batch, known_indices, take_options, &temp_ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum known_ids,
+                          compute::Take(ids, known_indices, take_options, &temp_ctx_));
+    RETURN_NOT_OK(Aggregate(known_rows.record_batch(), known_ids));
+
+    ARROW_ASSIGN_OR_RAISE(Datum spilled_rows, compute::Take(batch, spilled_indices,
+                                                            take_options, &temp_ctx_));
+    return Spill(spilled_rows.record_batch());
+  }
+
+  // Finalize the groups aggregated in memory, and append the partitions spilled to
+  // those left to aggregate
+  Result<std::shared_ptr<RecordBatch>> Finish(std::deque<SpilledPartition>* partitions) {
+    const int64_t num_groups = grouper_->num_groups();
+    ArrayVector columns;
+    for (size_t i = 0; i < spec_->kernels.size(); ++i) {
+      KernelContext kernel_ctx{&ctx_};
+      kernel_ctx.SetState(states_[i].get());
+      Datum out;
+      spec_->kernels[i]->finalize(&kernel_ctx, &out);
+      if (kernel_ctx.HasError()) return kernel_ctx.status();
+      columns.push_back(out.make_array());
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper_->GetUniques());
+    for (const auto& key : uniques.values) {
+      columns.push_back(key.make_array());
+    }
+    states_.clear();
+    grouper_.reset();
+
+    for (auto& partition : partitions_) {
+      if (partition.writer == nullptr) {
+        continue;
+      }
+      RETURN_NOT_OK(partition.writer->Close());
+      RETURN_NOT_OK(partition.stream->Close());
+      partitions->push_back({std::move(partition.path), depth_ + 1});
+    }
+    partitions_.clear();
+
+    return RecordBatch::Make(spec_->out_schema, num_groups, std::move(columns));
+  }
+
+ private:
+  struct Partition {
+    std::string path;
+    std::shared_ptr<io::OutputStream> stream;
+    std::shared_ptr<ipc::RecordBatchWriter> writer;
+  };
+
+  Status Aggregate(const std::shared_ptr<RecordBatch>& batch, const Datum& ids) {
+    for (size_t i = 0; i < spec_->kernels.size(); ++i) {
+      KernelContext kernel_ctx{&ctx_};
+      kernel_ctx.SetState(states_[i].get());
+      ARROW_ASSIGN_OR_RAISE(
+          auto kernel_batch,
+          ExecBatch::Make({batch->column_data(static_cast<int>(i)), ids,
+                           Datum(grouper_->num_groups())}));
+      spec_->kernels[i]->consume(&kernel_ctx, kernel_batch);
+      if (kernel_ctx.HasError()) return kernel_ctx.status();
+    }
+    return Status::OK();
+  }
+
+  // Approximate memory taken by the groups: the Grouper and the kernel states allocate
+  // from the tracked pool, but some Grouper implementations keep their keys and hash
+  // table in standard containers, which are estimated from the average key size.
+  int64_t GroupsSize() const {
+    const int64_t key_size = num_rows_ > 0 ? key_bytes_ / num_rows_ : 0;
+    return tracked_pool_.bytes_allocated() +
+           static_cast<int64_t>(grouper_->num_groups()) * (key_size + kGroupOverhead);
+  }
+
+  // The partition of each row of a batch, from the hash of its encoded keys salted
+  // with the depth: the partitions of a partition are not all alike, and the hash
+  // doesn't correlate with the Grouper's.
+  Result<std::vector<int>> PartitionRows(const RecordBatch& batch) {
+    encoder_.Clear();
+    RETURN_NOT_OK(encoder_.EncodeAndAppend(spec_->KeyBatch(batch)));
+    const uint64_t salt = static_cast<uint64_t>(depth_ + 1) * 0x9E3779B97F4A7C15ULL;
+    const uint64_t num_partitions = spec_->options.num_partitions;
+    std::vector<int> row_partitions(batch.num_rows());
+    for (int32_t i = 0; i < encoder_.num_rows(); ++i) {
+      const auto row = encoder_.encoded_row(i);
+      uint64_t hash =
+          ::arrow::internal::ComputeStringHash<1>(row.data(), row.size()) ^ salt;
+      hash *= 0xC2B2AE3D27D4EB4FULL;
+      hash ^= hash >> 32;
+      row_partitions[i] = static_cast<int>(hash % num_partitions);
+    }
+    return row_partitions;
+  }
+
+  Status Spill(const std::shared_ptr<RecordBatch>& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto row_partitions, PartitionRows(*batch));
+
+    // Counting sort of the rows by partition, so that each partition's rows are a
+    // slice of the batch taken in that order
+    const int num_partitions = spec_->options.num_partitions;
+    std::vector<int64_t> offsets(num_partitions + 1, 0);
+    for (int partition : row_partitions) {
+      ++offsets[partition + 1];
+    }
+    for (int p = 0; p < num_partitions; ++p) {
+      offsets[p + 1] += offsets[p];
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                          AllocateBuffer(batch->num_rows() * sizeof(int32_t),
+                                         temp_ctx_.memory_pool()));
+    auto indices_data = reinterpret_cast<int32_t*>(indices->mutable_data());
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int32_t i = 0; i < static_cast<int32_t>(batch->num_rows()); ++i) {
+      indices_data[positions[row_partitions[i]]++] = i;
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          compute::Take(batch,
+                                        std::make_shared<Int32Array>(batch->num_rows(),
+                                                                     std::move(indices)),
+                                        compute::TakeOptions::NoBoundsCheck(),
+                                        &temp_ctx_));
+    const auto& sorted_batch = sorted.record_batch();
+
+    partitions_.resize(num_partitions);
+    for (int p = 0; p < num_partitions; ++p) {
+      const int64_t length = offsets[p + 1] - offsets[p];
+      if (length == 0) {
+        continue;
+      }
+      auto& partition = partitions_[p];
+      if (partition.writer == nullptr) {
+        RETURN_NOT_OK(OpenPartition(&partition));
+      }
+      RETURN_NOT_OK(
+          partition.writer->WriteRecordBatch(*sorted_batch->Slice(offsets[p], length)));
+    }
+    return Status::OK();
+  }
+
+  Status OpenPartition(Partition* partition) {
+    ARROW_ASSIGN_OR_RAISE(partition->path, spec_->spill_dir->NewFilePath("partition-"));
+    ARROW_ASSIGN_OR_RAISE(partition->stream,
+                          spec_->spill_dir->filesystem()->OpenOutputStream(
+                              partition->path));
+    auto write_options = ipc::IpcWriteOptions::Defaults();
+    write_options.memory_pool = spec_->options.pool;
+    ARROW_ASSIGN_OR_RAISE(partition->writer, ipc::MakeStreamWriter(
+                                                 partition->stream, spec_->schema,
+                                                 write_options));
+    return Status::OK();
+  }
+
+  std::shared_ptr<GroupBySpec> spec_;
+  const int depth_;
+  // Tracks the memory of the groups, as the Grouper and the kernel states allocate
+  // from ctx_. Temporary allocations are made from temp_ctx_ instead.
+  ProxyMemoryPool tracked_pool_;
+  ExecContext ctx_;
+  ExecContext temp_ctx_;
+
+  std::unique_ptr<Grouper> grouper_;
+  std::vector<std::unique_ptr<KernelState>> states_;
+  // Whether groups outgrew the memory limit, and rows of new groups are spilled
+  bool frozen_ = false;
+  // Key bytes and rows consumed until frozen, for the average key size
+  int64_t key_bytes_ = 0;
+  int64_t num_rows_ = 0;
+
+  compute::RowEncoder encoder_;
+  std::vector<Partition> partitions_;
+};
+
+// Outputs the groups aggregated in memory by a pass, then aggregates the spilled
+// partitions one at a time.
+class GroupByReader : public RecordBatchReader {
+ public:
+  GroupByReader(std::shared_ptr<GroupBySpec> spec, std::shared_ptr<RecordBatch> groups,
+                std::deque<SpilledPartition> partitions)
+      : spec_(std::move(spec)),
+        groups_(std::move(groups)),
+        partitions_(std::move(partitions)) {}
+
+  std::shared_ptr<Schema> schema() const override { return spec_->out_schema; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      if (groups_ != nullptr && offset_ < groups_->num_rows()) {
+        *out = groups_->Slice(offset_, spec_->options.batch_size);
+        offset_ += (*out)->num_rows();
+        return Status::OK();
+      }
+      groups_.reset();
+      if (partitions_.empty()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      SpilledPartition partition = std::move(partitions_.front());
+      partitions_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(groups_, AggregatePartition(partition));
+      offset_ = 0;
+    }
+  }
+
+ private:
+  Result<std::shared_ptr<RecordBatch>> AggregatePartition(
+      const SpilledPartition& partition) {
+    GroupByPass pass(spec_, partition.depth);
+    RETURN_NOT_OK(pass.Init());
+    {
+      auto read_options = ipc::IpcReadOptions::Defaults();
+      read_options.memory_pool = spec_->options.pool;
+      read_options.use_threads = false;
+      ARROW_ASSIGN_OR_RAISE(
+          auto stream, spec_->spill_dir->filesystem()->OpenInputStream(partition.path));
+      ARROW_ASSIGN_OR_RAISE(auto reader,
+                            ipc::RecordBatchStreamReader::Open(stream, read_options));
+      while (true) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(reader->ReadNext(&batch));
+        if (batch == nullptr) {
+          break;
+        }
+        RETURN_NOT_OK(pass.Consume(batch));
+      }
+    }
+    RETURN_NOT_OK(spec_->spill_dir->filesystem()->DeleteFile(partition.path));
+    return pass.Finish(&partitions_);
+  }
+
+  std::shared_ptr<GroupBySpec> spec_;
+  std::shared_ptr<RecordBatch> groups_;
+  int64_t offset_ = 0;
+  std::deque<SpilledPartition> partitions_;
+};
+
+Result<int> FindColumn(const Schema& schema, const std::string& name) {
+  const int index = schema.GetFieldIndex(name);
+  if (index == -1) {
+    return Status::Invalid("No single column named '", name, "' in ",
+                           schema.ToString());
+  }
+  return index;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> GroupByExternal(
+    std::shared_ptr<RecordBatchReader> input, ExternalGroupByOptions options) {
+  if (options.keys.empty()) {
+    return Status::Invalid("External group by needs at least one key");
+  }
+  if (options.targets.size() != options.aggregates.size()) {
+    return Status::Invalid("External group by needs a target for each of the ",
+                           options.aggregates.size(), " aggregates, got ",
+                           options.targets.size());
+  }
+  if (options.spill_dir.empty()) {
+    return Status::Invalid("External group by needs a spill directory");
+  }
+  if (options.memory_limit <= 0 || options.batch_size <= 0) {
+    return Status::Invalid(
+        "External group by memory limit and batch size must be positive");
+  }
+  if (options.num_partitions < 2) {
+    return Status::Invalid("External group by num_partitions must be at least 2, got ",
+                           options.num_partitions);
+  }
+  if (options.filesystem == nullptr) {
+    options.filesystem = std::make_shared<fs::LocalFileSystem>();
+  }
+
+  // Project the input to the targets then the keys
+  const auto& input_schema = *input->schema();
+  std::vector<int> column_indices;
+  FieldVector fields;
+  auto spec = std::make_shared<GroupBySpec>();
+  for (const auto& name : options.targets) {
+    ARROW_ASSIGN_OR_RAISE(int index, FindColumn(input_schema, name));
+    column_indices.push_back(index);
+    fields.push_back(input_schema.field(index));
+    spec->argument_descrs.push_back(ValueDescr::Array(fields.back()->type()));
+  }
+  FieldVector key_fields;
+  for (const auto& name : options.keys) {
+    ARROW_ASSIGN_OR_RAISE(int index, FindColumn(input_schema, name));
+    column_indices.push_back(index);
+    fields.push_back(input_schema.field(index));
+    key_fields.push_back(fields.back());
+    spec->key_descrs.push_back(ValueDescr::Array(fields.back()->type()));
+  }
+  spec->schema = schema(std::move(fields));
+
+  ExecContext ctx(options.pool);
+  ARROW_ASSIGN_OR_RAISE(spec->kernels,
+                        compute::internal::GetHashAggregateKernels(
+                            &ctx, options.aggregates, spec->argument_descrs));
+  spec->spill_dir = std::make_shared<SpillDirectory>(
+      options.filesystem, options.spill_dir, /*prefix=*/"arrow-group-by-");
+  spec->options = std::move(options);
+
+  GroupByPass pass(spec, /*depth=*/0);
+  RETURN_NOT_OK(pass.Init());
+  ARROW_ASSIGN_OR_RAISE(FieldVector out_fields,
+                        compute::internal::ResolveHashAggregateKernels(
+                            spec->options.aggregates, spec->kernels, pass.states(), &ctx,
+                            spec->argument_descrs));
+  for (auto& field : key_fields) {
+    out_fields.push_back(std::move(field));
+  }
+  spec->out_schema = schema(std::move(out_fields));
+
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(input->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ArrayDataVector columns;
+    for (int index : column_indices) {
+      columns.push_back(batch->column_data(index));
+    }
+    RETURN_NOT_OK(
+        pass.Consume(RecordBatch::Make(spec->schema, batch->num_rows(), columns)));
+  }
+
+  std::deque<SpilledPartition> partitions;
+  ARROW_ASSIGN_OR_RAISE(auto groups, pass.Finish(&partitions));
+  return std::make_shared<GroupByReader>(std::move(spec), std::move(groups),
+                                         std::move(partitions));
+}
+
+}  // namespace dataset
+}  // namespace arrow
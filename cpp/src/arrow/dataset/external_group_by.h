@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Options for GroupByExternal
+struct ARROW_DS_EXPORT ExternalGroupByOptions {
+  /// Columns to group by.
+  std::vector<std::string> keys;
+
+  /// Hash aggregate functions to compute for each group (such as "hash_sum"). The
+  /// options they point to must stay alive until the returned reader is destroyed.
+  std::vector<compute::internal::Aggregate> aggregates;
+
+  /// Columns to aggregate, one for each of the aggregates.
+  std::vector<std::string> targets;
+
+  /// FileSystem to which partitions are spilled. If null, the local filesystem.
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// Directory under which partitions are spilled. Each group by creates a uniquely
+  /// named subdirectory in it, which is deleted once the group by is finished or
+  /// abandoned.
+  std::string spill_dir;
+
+  /// Memory pool for the allocations of the group by.
+  MemoryPool* pool = default_memory_pool();
+
+  /// Approximate number of bytes the groups and their aggregation states may take in
+  /// memory, default is 1 GiB.
+  int64_t memory_limit = int64_t(1) << 30;
+
+  /// Number of partitions the rows of the groups not fitting in memory are spilled to,
+  /// default is 32.
+  int num_partitions = 32;
+
+  /// Maximum number of rows in output batches, default is 64K.
+  int64_t batch_size = int64_t(1) << 16;
+};
+
+/// \brief Group the rows of a reader and aggregate each group, spilling rows to disk
+/// if the groups don't fit in the memory limit
+///
+/// The input is consumed before returning. Groups are aggregated in memory with a
+/// compute::internal::Grouper and the hash aggregate kernels until they outgrow the
+/// memory limit. From then on, no group is added: rows of the groups already in memory
+/// are still aggregated, and the other rows are partitioned by the hash of their keys
+/// into Arrow IPC stream files in the spill directory. Since a partition has all the
+/// rows of its groups, the returned reader then aggregates the partitions one after
+/// the other, independently. A partition whose groups don't fit in memory either is
+/// partitioned again, with another hash.
+///
+/// The output has a column for each aggregate, named after its function, followed by
+/// the key columns. Groups are output in no particular order.
+ARROW_DS_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> GroupByExternal(
+    std::shared_ptr<RecordBatchReader> input, ExternalGroupByOptions options);
+
+}  // namespace dataset
+}  // namespace arrow
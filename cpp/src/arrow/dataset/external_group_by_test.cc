@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/external_group_by.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+using compute::SortKey;
+
+class TestExternalGroupBy : public ::testing::Test {
+ public:
+  void SetUp() override {
+    filesystem_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    ASSERT_OK(filesystem_->CreateDir("spill"));
+
+    options_.filesystem = filesystem_;
+    options_.spill_dir = "spill";
+    options_.batch_size = 1000;
+    options_.aggregates = {{"hash_sum", nullptr}, {"hash_count", nullptr}};
+    options_.targets = {"v", "v"};
+  }
+
+  std::shared_ptr<Table> MakeTable(int64_t num_rows, int64_t num_keys) {
+    auto rand = random::RandomArrayGenerator(0x9b0);
+    return Table::Make(
+        schema({field("k", int64()), field("s", utf8()), field("v", int32())}),
+        {rand.Int64(num_rows, 0, num_keys - 1, /*null_probability=*/0.01),
+         rand.StringWithRepeats(num_rows, /*unique=*/3, 0, 2, /*null_probability=*/0.1),
+         rand.Int32(num_rows, -100, 100, /*null_probability=*/0.1)});
+  }
+
+  std::shared_ptr<Table> SortByKeys(const std::shared_ptr<Table>& table) {
+    std::vector<SortKey> sort_keys;
+    for (const auto& key : options_.keys) {
+      sort_keys.emplace_back(key);
+    }
+    EXPECT_OK_AND_ASSIGN(auto indices,
+                         compute::SortIndices(table, compute::SortOptions(sort_keys)));
+    EXPECT_OK_AND_ASSIGN(Datum sorted, compute::Take(table, indices));
+    EXPECT_OK_AND_ASSIGN(auto combined, sorted.table()->CombineChunks());
+    return combined;
+  }
+
+  std::shared_ptr<Table> GroupByInMemory(const std::shared_ptr<Table>& table,
+                                         const std::shared_ptr<Schema>& out_schema) {
+    std::vector<Datum> arguments, keys;
+    for (const auto& target : options_.targets) {
+      arguments.emplace_back(table->GetColumnByName(target));
+    }
+    for (const auto& key : options_.keys) {
+      keys.emplace_back(table->GetColumnByName(key));
+    }
+    EXPECT_OK_AND_ASSIGN(
+        Datum grouped, compute::internal::GroupBy(arguments, keys, options_.aggregates));
+    const auto& struct_array = checked_cast<const StructArray&>(*grouped.make_array());
+    return Table::Make(out_schema, struct_array.fields());
+  }
+
+  void CheckGroupBy(const std::shared_ptr<Table>& table, int64_t input_batch_size) {
+    auto input = std::make_shared<TableBatchReader>(*table);
+    input->set_chunksize(input_batch_size);
+
+    ASSERT_OK_AND_ASSIGN(auto reader, GroupByExternal(input, options_));
+    std::shared_ptr<Table> grouped;
+    ASSERT_OK(reader->ReadAll(&grouped));
+    ASSERT_OK(grouped->ValidateFull());
+    for (const auto& column : grouped->columns()) {
+      for (const auto& chunk : column->chunks()) {
+        ASSERT_LE(chunk->length(), options_.batch_size);
+      }
+    }
+    AssertTablesEqual(*SortByKeys(GroupByInMemory(table, grouped->schema())),
+                      *SortByKeys(grouped), /*same_chunk_layout=*/false);
+
+    // The spilled partitions are deleted with the reader
+    reader.reset();
+    AssertSpillDirEmpty();
+  }
+
+  void AssertSpillDirEmpty() { ASSERT_EQ(NumSpilledFiles(), 0); }
+
+  int64_t NumSpilledFiles() {
+    fs::FileSelector selector;
+    selector.base_dir = "spill";
+    selector.recursive = true;
+    EXPECT_OK_AND_ASSIGN(auto infos, filesystem_->GetFileInfo(selector));
+    int64_t num_files = 0;
+    for (const auto& info : infos) {
+      num_files += info.IsFile();
+    }
+    return num_files;
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  ExternalGroupByOptions options_;
+};
+
+TEST_F(TestExternalGroupBy, InMemory) {
+  auto table = MakeTable(5000, /*num_keys=*/500);
+  options_.keys = {"k"};
+  CheckGroupBy(table, /*input_batch_size=*/700);
+}
+
+TEST_F(TestExternalGroupBy, Spill) {
+  auto table = MakeTable(20000, /*num_keys=*/5000);
+  options_.keys = {"k"};
+  options_.memory_limit = 20000;
+  options_.num_partitions = 4;
+  CheckGroupBy(table, /*input_batch_size=*/1000);
+}
+
+TEST_F(TestExternalGroupBy, SpillMultipleKeys) {
+  auto table = MakeTable(20000, /*num_keys=*/2000);
+  options_.keys = {"s", "k"};
+  options_.memory_limit = 20000;
+  options_.num_partitions = 3;
+  CheckGroupBy(table, /*input_batch_size=*/500);
+}
+
+TEST_F(TestExternalGroupBy, PartitionsAreSpilled) {
+  auto table = MakeTable(2000, /*num_keys=*/1000);
+  auto input = std::make_shared<TableBatchReader>(*table);
+  input->set_chunksize(100);
+
+  options_.keys = {"k"};
+  options_.memory_limit = 1000;
+  ASSERT_OK_AND_ASSIGN(auto reader, GroupByExternal(input, options_));
+  ASSERT_GT(NumSpilledFiles(), 0);
+  reader.reset();
+  AssertSpillDirEmpty();
+}
+
+TEST_F(TestExternalGroupBy, EmptyInput) {
+  auto table = MakeTable(10, /*num_keys=*/5)->Slice(0, 0);
+  options_.keys = {"k"};
+  CheckGroupBy(table, /*input_batch_size=*/10);
+}
+
+TEST_F(TestExternalGroupBy, Errors) {
+  auto table = MakeTable(10, /*num_keys=*/5);
+  auto input = std::make_shared<TableBatchReader>(*table);
+
+  ASSERT_RAISES(Invalid, GroupByExternal(input, options_));
+
+  options_.keys = {"nonexistent"};
+  ASSERT_RAISES(Invalid, GroupByExternal(input, options_));
+
+  options_.keys = {"k"};
+  options_.targets = {"v"};
+  ASSERT_RAISES(Invalid, GroupByExternal(input, options_));
+
+  options_.targets = {"v", "v"};
+  options_.spill_dir = "";
+  ASSERT_RAISES(Invalid, GroupByExternal(input, options_));
+
+  options_.spill_dir = "spill";
+  options_.num_partitions = 1;
+  ASSERT_RAISES(Invalid, GroupByExternal(input, options_));
+
+  options_.num_partitions = 2;
+  options_.aggregates[0].function = "hash_nonexistent";
+  ASSERT_RAISES(KeyError, GroupByExternal(input, options_));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,585 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/external_sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/dataset/spill_internal.h"
+#include "arrow/datum.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+using internal::BufferSize;
+using internal::SpillDirectory;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Row comparison
+
+// Compares values of a sort key column in two batches. As compute::SortIndices does,
+// nulls are greater than anything else and NaNs greater than any non-null value,
+// whatever the sort order.
+class ColumnComparator {
+ public:
+  explicit ColumnComparator(compute::SortOrder order) : order_(order) {}
+  virtual ~ColumnComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+
+ protected:
+  const compute::SortOrder order_;
+};
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+template <typename ArrowType>
+class TypedColumnComparator : public ColumnComparator {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ColumnComparator::ColumnComparator;
+
+  int Compare(const Array& left, int64_t left_index, const Array& right,
+              int64_t right_index) const override {
+    const auto& left_array = checked_cast<const ArrayType&>(left);
+    const auto& right_array = checked_cast<const ArrayType&>(right);
+    const bool left_null = left_array.IsNull(left_index);
+    const bool right_null = right_array.IsNull(right_index);
+    if (left_null || right_null) {
+      return static_cast<int>(left_null) - static_cast<int>(right_null);
+    }
+    const auto left_value = left_array.GetView(left_index);
+    const auto right_value = right_array.GetView(right_index);
+    const bool left_nan = IsNaN(left_value);
+    const bool right_nan = IsNaN(right_value);
+    if (left_nan || right_nan) {
+      return static_cast<int>(left_nan) - static_cast<int>(right_nan);
+    }
+    const int compared =
+        left_value == right_value ? 0 : (left_value < right_value ? -1 : 1);
+    return order_ == compute::SortOrder::Descending ? -compared : compared;
+  }
+};
+
+struct ColumnComparatorMaker {
+  template <typename T>
+  using IsSupported = std::integral_constant<
+      bool, (has_c_type<T>::value && !is_interval_type<T>::value &&
+             !is_half_float_type<T>::value) ||
+                is_base_binary_type<T>::value ||
+                std::is_same<T, FixedSizeBinaryType>::value>;
+
+  template <typename T>
+  enable_if_t<IsSupported<T>::value, Status> Visit(const T&) {
+    out = ::arrow::internal::make_unique<TypedColumnComparator<T>>(order);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Unsupported type for external sorting: ", type);
+  }
+
+  compute::SortOrder order;
+  std::unique_ptr<ColumnComparator> out;
+};
+
+// Compares rows of batches on all the sort keys, given the sort key columns of each
+// batch.
+class RowComparator {
+ public:
+  static Result<std::shared_ptr<RowComparator>> Make(
+      const Schema& schema, const std::vector<compute::SortKey>& sort_keys) {
+    auto comparator = std::make_shared<RowComparator>();
+    for (const auto& sort_key : sort_keys) {
+      const int index = schema.GetFieldIndex(sort_key.name);
+      if (index < 0) {
+        return Status::Invalid("Sort key column '", sort_key.name,
+                               "' not found or ambiguous in schema ", schema);
+      }
+      ColumnComparatorMaker maker{sort_key.order, nullptr};
+      RETURN_NOT_OK(VisitTypeInline(*schema.field(index)->type(), &maker));
+      comparator->key_columns_.push_back(index);
+      comparator->comparators_.push_back(std::move(maker.out));
+    }
+    return comparator;
+  }
+
+  const std::vector<int>& key_columns() const { return key_columns_; }
+
+  int Compare(const std::vector<std::shared_ptr<Array>>& left_keys, int64_t left_index,
+              const std::vector<std::shared_ptr<Array>>& right_keys,
+              int64_t right_index) const {
+    for (size_t i = 0; i < comparators_.size(); ++i) {
+      const int compared = comparators_[i]->Compare(*left_keys[i], left_index,
+                                                    *right_keys[i], right_index);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return 0;
+  }
+
+ private:
+  std::vector<int> key_columns_;
+  std::vector<std::unique_ptr<ColumnComparator>> comparators_;
+};
+
+// ----------------------------------------------------------------------
+// Runs
+
+// A uniquely named directory holding the runs of one sort, created on first use and
+// deleted with its contents when the last reference to it is released.
+// Reads the batches of a table it keeps alive
+class TableReader : public RecordBatchReader {
+ public:
+  TableReader(std::shared_ptr<Table> table, int64_t batch_size)
+      : table_(std::move(table)), reader_(*table_) {
+    reader_.set_chunksize(batch_size);
+  }
+
+  std::shared_ptr<Schema> schema() const override { return table_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    return reader_.ReadNext(out);
+  }
+
+ private:
+  std::shared_ptr<Table> table_;
+  TableBatchReader reader_;
+};
+
+// Merges sorted sources into one sorted stream. Rows comparing equal are output in
+// the order of their sources, so that the merge is stable.
+//
+// Each output batch is gathered from the source batches it picks rows from: the rows
+// of each source batch are taken (or sliced if they are contiguous), concatenated and
+// put back in the merged order.
+class MergingReader : public RecordBatchReader {
+ public:
+  MergingReader(std::shared_ptr<Schema> schema,
+                std::shared_ptr<RowComparator> comparator,
+                std::vector<std::shared_ptr<RecordBatchReader>> sources,
+                int64_t batch_size, MemoryPool* pool,
+                std::shared_ptr<SpillDirectory> spill_dir)
+      : spill_dir_(std::move(spill_dir)),
+        schema_(std::move(schema)),
+        comparator_(std::move(comparator)),
+        batch_size_(batch_size),
+        exec_context_(pool) {
+    cursors_.resize(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      cursors_[i].source = std::move(sources[i]);
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (!started_) {
+      RETURN_NOT_OK(Start());
+    }
+
+    // The batches picked from in this call
+    slots_.clear();
+    for (int cursor_index : heap_) {
+      cursors_[cursor_index].slot = AddSlot(cursors_[cursor_index].batch);
+    }
+
+    picks_.clear();
+    while (static_cast<int64_t>(picks_.size()) < batch_size_ && !heap_.empty()) {
+      std::pop_heap(heap_.begin(), heap_.end(), HeapOrder{this});
+      Cursor* cursor = &cursors_[heap_.back()];
+      picks_.emplace_back(cursor->slot, cursor->row);
+      if (++cursor->row == cursor->batch->num_rows()) {
+        RETURN_NOT_OK(LoadNextBatch(cursor));
+        if (cursor->batch == nullptr) {
+          heap_.pop_back();
+          continue;
+        }
+        cursor->slot = AddSlot(cursor->batch);
+      }
+      std::push_heap(heap_.begin(), heap_.end(), HeapOrder{this});
+    }
+
+    if (picks_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    return Gather(out);
+  }
+
+ private:
+  struct Cursor {
+    std::shared_ptr<RecordBatchReader> source;
+    std::shared_ptr<RecordBatch> batch;
+    // The sort key columns of the batch
+    std::vector<std::shared_ptr<Array>> keys;
+    int64_t row = 0;
+    int slot = -1;
+  };
+
+  // Orders the heap so that its top is the cursor with the smallest row
+  struct HeapOrder {
+    bool operator()(int left, int right) const {
+      const Cursor& left_cursor = self->cursors_[left];
+      const Cursor& right_cursor = self->cursors_[right];
+      const int compared =
+          self->comparator_->Compare(left_cursor.keys, left_cursor.row,
+                                     right_cursor.keys, right_cursor.row);
+      return compared > 0 || (compared == 0 && left > right);
+    }
+
+    const MergingReader* self;
+  };
+
+  Status Start() {
+    started_ = true;
+    for (size_t i = 0; i < cursors_.size(); ++i) {
+      RETURN_NOT_OK(LoadNextBatch(&cursors_[i]));
+      if (cursors_[i].batch != nullptr) {
+        heap_.push_back(static_cast<int>(i));
+      }
+    }
+    std::make_heap(heap_.begin(), heap_.end(), HeapOrder{this});
+    return Status::OK();
+  }
+
+  // Load the next non-empty batch of a source, or null if it is exhausted
+  Status LoadNextBatch(Cursor* cursor) {
+    do {
+      RETURN_NOT_OK(cursor->source->ReadNext(&cursor->batch));
+    } while (cursor->batch != nullptr && cursor->batch->num_rows() == 0);
+
+    cursor->row = 0;
+    cursor->keys.clear();
+    if (cursor->batch == nullptr) {
+      // Release the source, closing its spilled run
+      cursor->source.reset();
+    } else {
+      for (int column : comparator_->key_columns()) {
+        cursor->keys.push_back(cursor->batch->column(column));
+      }
+    }
+    return Status::OK();
+  }
+
+  int AddSlot(std::shared_ptr<RecordBatch> batch) {
+    slots_.push_back(std::move(batch));
+    return static_cast<int>(slots_.size()) - 1;
+  }
+
+  Status Gather(std::shared_ptr<RecordBatch>* out) {
+    const int64_t num_rows = static_cast<int64_t>(picks_.size());
+
+    // The rows picked from each slot (in increasing order), and the rank of each pick
+    // among the picks of its slot
+    std::vector<std::vector<int64_t>> slot_rows(slots_.size());
+    std::vector<int64_t> ranks(num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      auto& rows = slot_rows[picks_[i].first];
+      ranks[i] = static_cast<int64_t>(rows.size());
+      rows.push_back(picks_[i].second);
+    }
+
+    std::vector<std::shared_ptr<RecordBatch>> pieces;
+    std::vector<int64_t> piece_offsets(slots_.size(), 0);
+    int64_t offset = 0;
+    for (size_t slot = 0; slot < slots_.size(); ++slot) {
+      const auto& rows = slot_rows[slot];
+      if (rows.empty()) {
+        continue;
+      }
+      const int64_t length = static_cast<int64_t>(rows.size());
+      std::shared_ptr<RecordBatch> piece;
+      if (rows.back() - rows.front() + 1 == length) {
+        piece = slots_[slot]->Slice(rows.front(), length);
+      } else {
+        Int64Array indices(length, Buffer::Wrap(rows));
+        ARROW_ASSIGN_OR_RAISE(Datum taken,
+                              compute::Take(slots_[slot], indices,
+                                            compute::TakeOptions::NoBoundsCheck(),
+                                            &exec_context_));
+        piece = taken.record_batch();
+      }
+      piece_offsets[slot] = offset;
+      offset += length;
+      pieces.push_back(std::move(piece));
+    }
+
+    if (pieces.size() == 1) {
+      *out = std::move(pieces[0]);
+      return Status::OK();
+    }
+
+    ArrayVector columns;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector column_pieces;
+      for (const auto& piece : pieces) {
+        column_pieces.push_back(piece->column(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto column,
+                            Concatenate(column_pieces, exec_context_.memory_pool()));
+      columns.push_back(std::move(column));
+    }
+    auto concatenated = RecordBatch::Make(schema_, num_rows, std::move(columns));
+
+    // Put the rows back in the merged order
+    std::vector<int64_t> positions(num_rows);
+    bool in_order = true;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      positions[i] = piece_offsets[picks_[i].first] + ranks[i];
+      in_order &= positions[i] == i;
+    }
+    if (in_order) {
+      *out = std::move(concatenated);
+      return Status::OK();
+    }
+    Int64Array indices(num_rows, Buffer::Wrap(positions));
+    ARROW_ASSIGN_OR_RAISE(Datum merged,
+                          compute::Take(concatenated, indices,
+                                        compute::TakeOptions::NoBoundsCheck(),
+                                        &exec_context_));
+    *out = merged.record_batch();
+    return Status::OK();
+  }
+
+  // Declared first so that the runs are closed before their directory is deleted
+  std::shared_ptr<SpillDirectory> spill_dir_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RowComparator> comparator_;
+  const int64_t batch_size_;
+  compute::ExecContext exec_context_;
+
+  std::vector<Cursor> cursors_;
+  // Indices of the cursors which aren't exhausted
+  std::vector<int> heap_;
+  bool started_ = false;
+
+  std::vector<std::shared_ptr<RecordBatch>> slots_;
+  // The (slot, row) of each row of the next output batch
+  std::vector<std::pair<int, int64_t>> picks_;
+};
+
+// ----------------------------------------------------------------------
+// Sorter
+
+class ExternalSorter {
+ public:
+  ExternalSorter(std::shared_ptr<Schema> schema, ExternalSortOptions options,
+                 std::shared_ptr<RowComparator> comparator)
+      : schema_(std::move(schema)),
+        options_(std::move(options)),
+        comparator_(std::move(comparator)),
+        spill_dir_(std::make_shared<SpillDirectory>(
+            options_.filesystem, options_.spill_dir, /*prefix=*/"arrow-sort-")) {}
+
+  Status Consume(std::shared_ptr<RecordBatch> batch) {
+    buffered_bytes_ += BufferSize(*batch);
+    buffered_.push_back(std::move(batch));
+    if (buffered_bytes_ >= options_.memory_limit / 2) {
+      return SpillBuffered();
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> Finish() {
+    // The last run stays in memory
+    ARROW_ASSIGN_OR_RAISE(auto last_run, SortBuffered());
+    if (runs_.empty()) {
+      return std::make_shared<TableReader>(std::move(last_run), options_.batch_size);
+    }
+
+    // Merge consecutive runs, so that the merge stays stable, until the spilled runs
+    // and the last one can be merged at once
+    const int64_t merge_width = MergeWidth();
+    while (static_cast<int64_t>(runs_.size()) + 1 > merge_width) {
+      std::vector<std::string> merged_runs;
+      for (size_t begin = 0; begin < runs_.size(); begin += merge_width) {
+        const size_t end = std::min(runs_.size(), begin + merge_width);
+        std::vector<std::string> paths(runs_.begin() + begin, runs_.begin() + end);
+        ARROW_ASSIGN_OR_RAISE(auto merged, MergeRuns(paths, nullptr));
+        ARROW_ASSIGN_OR_RAISE(auto path, WriteRun(merged.get()));
+        merged.reset();
+        RETURN_NOT_OK(spill_dir_->filesystem()->DeleteFiles(paths));
+        merged_runs.push_back(std::move(path));
+      }
+      runs_ = std::move(merged_runs);
+    }
+    return MergeRuns(runs_, std::make_shared<TableReader>(std::move(last_run),
+                                                          options_.batch_size));
+  }
+
+ private:
+  Result<std::shared_ptr<Table>> SortBuffered() {
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, buffered_));
+    buffered_.clear();
+    buffered_bytes_ = 0;
+
+    compute::ExecContext exec_context(options_.pool);
+    const compute::SortOptions sort_options(options_.sort_keys);
+    ARROW_ASSIGN_OR_RAISE(auto indices,
+                          compute::SortIndices(table, sort_options, &exec_context));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          compute::Take(table, indices,
+                                        compute::TakeOptions::NoBoundsCheck(),
+                                        &exec_context));
+    return sorted.table();
+  }
+
+  Status SpillBuffered() {
+    ARROW_ASSIGN_OR_RAISE(auto sorted, SortBuffered());
+    TableReader reader(std::move(sorted), options_.batch_size);
+    ARROW_ASSIGN_OR_RAISE(auto path, WriteRun(&reader));
+    runs_.push_back(std::move(path));
+    return Status::OK();
+  }
+
+  Result<std::string> WriteRun(RecordBatchReader* reader) {
+    ARROW_ASSIGN_OR_RAISE(auto path, spill_dir_->NewFilePath("run-"));
+    ARROW_ASSIGN_OR_RAISE(auto stream, spill_dir_->filesystem()->OpenOutputStream(path));
+    auto write_options = ipc::IpcWriteOptions::Defaults();
+    write_options.memory_pool = options_.pool;
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          ipc::MakeStreamWriter(stream, schema_, write_options));
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      max_batch_bytes_ = std::max(max_batch_bytes_, BufferSize(*batch));
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(stream->Close());
+    return path;
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> MergeRuns(
+      const std::vector<std::string>& paths,
+      std::shared_ptr<RecordBatchReader> last_run) {
+    auto read_options = ipc::IpcReadOptions::Defaults();
+    read_options.memory_pool = options_.pool;
+    read_options.use_threads = false;
+
+    std::vector<std::shared_ptr<RecordBatchReader>> sources;
+    for (const auto& path : paths) {
+      ARROW_ASSIGN_OR_RAISE(auto stream, spill_dir_->filesystem()->OpenInputStream(path));
+      ARROW_ASSIGN_OR_RAISE(auto source,
+                            ipc::RecordBatchStreamReader::Open(stream, read_options));
+      sources.push_back(std::move(source));
+    }
+    if (last_run != nullptr) {
+      sources.push_back(std::move(last_run));
+    }
+    return std::make_shared<MergingReader>(schema_, comparator_, std::move(sources),
+                                           options_.batch_size, options_.pool,
+                                           spill_dir_);
+  }
+
+  // Each merged run holds its current batch, and the output batch is gathered from
+  // copies of them: leave room for twice the batches of all merged runs in what the
+  // in-memory run leaves of the memory limit.
+  int64_t MergeWidth() const {
+    const int64_t width =
+        options_.memory_limit / 2 / std::max<int64_t>(1, 2 * max_batch_bytes_);
+    return std::max<int64_t>(2, std::min<int64_t>(width, options_.max_merge_width));
+  }
+
+  std::shared_ptr<Schema> schema_;
+  ExternalSortOptions options_;
+  std::shared_ptr<RowComparator> comparator_;
+  std::shared_ptr<SpillDirectory> spill_dir_;
+
+  RecordBatchVector buffered_;
+  int64_t buffered_bytes_ = 0;
+  // Paths of the spilled runs, in input order
+  std::vector<std::string> runs_;
+  // Size of the largest batch spilled so far
+  int64_t max_batch_bytes_ = 0;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> SortExternal(
+    std::shared_ptr<RecordBatchReader> input, ExternalSortOptions options) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("External sort needs at least one sort key");
+  }
+  if (options.spill_dir.empty()) {
+    return Status::Invalid("External sort needs a spill directory");
+  }
+  if (options.memory_limit <= 0 || options.batch_size <= 0) {
+    return Status::Invalid("External sort memory limit and batch size must be positive");
+  }
+  if (options.max_merge_width < 2) {
+    return Status::Invalid("External sort max_merge_width must be at least 2, got ",
+                           options.max_merge_width);
+  }
+  if (options.filesystem == nullptr) {
+    options.filesystem = std::make_shared<fs::LocalFileSystem>();
+  }
+
+  auto schema = input->schema();
+  ARROW_ASSIGN_OR_RAISE(auto comparator, RowComparator::Make(*schema, options.sort_keys));
+  ExternalSorter sorter(schema, std::move(options), std::move(comparator));
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(input->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(sorter.Consume(std::move(batch)));
+  }
+  return sorter.Finish();
+}
+
+}  // namespace dataset
+}  // namespace arrow
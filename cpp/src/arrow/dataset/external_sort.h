@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Options for SortExternal
+struct ARROW_DS_EXPORT ExternalSortOptions {
+  /// Columns to sort by, in order of precedence. As with compute::SortIndices, nulls
+  /// are sorted last and NaNs just before them, whatever the sort order.
+  std::vector<compute::SortKey> sort_keys;
+
+  /// FileSystem to which sorted runs are spilled. If null, the local filesystem.
+  std::shared_ptr<fs::FileSystem> filesystem;
+
+  /// Directory under which sorted runs are spilled. Each sort creates a uniquely named
+  /// subdirectory in it, which is deleted once the sort is finished or abandoned.
+  std::string spill_dir;
+
+  /// Memory pool for the allocations of the sort.
+  MemoryPool* pool = default_memory_pool();
+
+  /// Approximate number of bytes the sort may hold in memory, default is 1 GiB.
+  /// Input batches are buffered until they reach half of this limit, the other half
+  /// being left for sorting them, and are then sorted and spilled as one run. The
+  /// limit also bounds the number of runs merged at once, since each of them keeps a
+  /// batch in memory.
+  int64_t memory_limit = int64_t(1) << 30;
+
+  /// Maximum number of runs merged at once, default is 64. If there are more runs,
+  /// they are merged in several passes, each of them writing fewer and longer runs.
+  int max_merge_width = 64;
+
+  /// Maximum number of rows in spilled and output batches, default is 64K.
+  int64_t batch_size = int64_t(1) << 16;
+};
+
+/// \brief Sort the batches of a reader, spilling sorted runs to disk if they don't fit
+/// in the memory limit
+///
+/// The input is consumed before returning: batches are buffered in memory and each
+/// time they reach the memory limit, they are sorted and written to the spill
+/// directory as an Arrow IPC stream file (a "run"). The returned reader then streams
+/// the k-way merge of the runs. If the whole input fits in memory, nothing is spilled
+/// and the reader streams the sorted input.
+///
+/// The sort is stable: rows comparing equal are output in the order they were read.
+ARROW_DS_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> SortExternal(
+    std::shared_ptr<RecordBatchReader> input, ExternalSortOptions options);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/external_sort.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::SortKey;
+using compute::SortOrder;
+
+class TestExternalSort : public ::testing::Test {
+ public:
+  void SetUp() override {
+    filesystem_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    ASSERT_OK(filesystem_->CreateDir("spill"));
+
+    options_.filesystem = filesystem_;
+    options_.spill_dir = "spill";
+    options_.batch_size = 1000;
+  }
+
+  std::shared_ptr<Table> MakeTable(int64_t num_rows) {
+    // Few distinct keys, so that rows often compare equal on the first sort keys
+    auto rand = random::RandomArrayGenerator(0x5e7);
+    std::vector<int64_t> ids(num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      ids[i] = i;
+    }
+    std::shared_ptr<Array> id_array;
+    ArrayFromVector<Int64Type>(ids, &id_array);
+    return Table::Make(
+        schema({field("i", int32()), field("s", utf8()), field("d", float64()),
+                field("id", int64())}),
+        {rand.Int32(num_rows, 0, 20, /*null_probability=*/0.05),
+         rand.StringWithRepeats(num_rows, /*unique=*/50, 0, 4, /*null_probability=*/0.05),
+         rand.Float64(num_rows, -1, 1, /*null_probability=*/0.05,
+                      /*nan_probability=*/0.05),
+         id_array});
+  }
+
+  std::shared_ptr<Table> SortInMemory(const std::shared_ptr<Table>& table) {
+    EXPECT_OK_AND_ASSIGN(auto indices,
+                         compute::SortIndices(table, compute::SortOptions(sort_keys_)));
+    EXPECT_OK_AND_ASSIGN(Datum sorted, compute::Take(table, indices));
+    return sorted.table();
+  }
+
+  void CheckSort(const std::shared_ptr<Table>& table, int64_t input_batch_size) {
+    auto input = std::make_shared<TableBatchReader>(*table);
+    input->set_chunksize(input_batch_size);
+
+    options_.sort_keys = sort_keys_;
+    ASSERT_OK_AND_ASSIGN(auto reader, SortExternal(input, options_));
+    std::shared_ptr<Table> sorted;
+    ASSERT_OK(reader->ReadAll(&sorted));
+    ASSERT_OK(sorted->ValidateFull());
+    for (const auto& column : sorted->columns()) {
+      for (const auto& chunk : column->chunks()) {
+        ASSERT_LE(chunk->length(), options_.batch_size);
+      }
+    }
+    // The row ids identify the rows, and NaNs don't compare equal in tables
+    AssertChunkedEquivalent(*SortInMemory(table)->GetColumnByName("id"),
+                            *sorted->GetColumnByName("id"));
+
+    // The spilled runs are deleted with the reader
+    reader.reset();
+    AssertSpillDirEmpty();
+  }
+
+  void AssertSpillDirEmpty() {
+    fs::FileSelector selector;
+    selector.base_dir = "spill";
+    selector.recursive = true;
+    ASSERT_OK_AND_ASSIGN(auto infos, filesystem_->GetFileInfo(selector));
+    ASSERT_EQ(infos.size(), 0);
+  }
+
+  int64_t NumSpilledFiles() {
+    fs::FileSelector selector;
+    selector.base_dir = "spill";
+    selector.recursive = true;
+    EXPECT_OK_AND_ASSIGN(auto infos, filesystem_->GetFileInfo(selector));
+    int64_t num_files = 0;
+    for (const auto& info : infos) {
+      num_files += info.IsFile();
+    }
+    return num_files;
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  ExternalSortOptions options_;
+  // The row id makes the expected order unique
+  std::vector<SortKey> sort_keys_ = {SortKey("i"), SortKey("s", SortOrder::Descending),
+                                     SortKey("d"), SortKey("id")};
+};
+
+TEST_F(TestExternalSort, InMemory) {
+  auto table = MakeTable(5000);
+  CheckSort(table, /*input_batch_size=*/700);
+}
+
+TEST_F(TestExternalSort, Spill) {
+  auto table = MakeTable(20000);
+  // A few input batches per run
+  options_.memory_limit = 200000;
+  CheckSort(table, /*input_batch_size=*/1000);
+}
+
+TEST_F(TestExternalSort, SpillMultiplePasses) {
+  auto table = MakeTable(20000);
+  // A run per input batch, merged three at a time
+  options_.memory_limit = 1000;
+  options_.max_merge_width = 3;
+  CheckSort(table, /*input_batch_size=*/500);
+}
+
+TEST_F(TestExternalSort, Stable) {
+  // Without the row id as a tie-breaker, equal rows keep their input order
+  auto table = MakeTable(10000);
+  sort_keys_ = {SortKey("i", SortOrder::Descending)};
+  options_.memory_limit = 1000;
+  options_.max_merge_width = 4;
+  CheckSort(table, /*input_batch_size=*/700);
+}
+
+TEST_F(TestExternalSort, RunsAreSpilled) {
+  auto table = MakeTable(2000);
+  auto input = std::make_shared<TableBatchReader>(*table);
+  input->set_chunksize(100);
+
+  options_.sort_keys = sort_keys_;
+  options_.memory_limit = 10000;
+  ASSERT_OK_AND_ASSIGN(auto reader, SortExternal(input, options_));
+  ASSERT_GT(NumSpilledFiles(), 0);
+  reader.reset();
+  AssertSpillDirEmpty();
+}
+
+TEST_F(TestExternalSort, EmptyInput) {
+  auto table = MakeTable(10)->Slice(0, 0);
+  CheckSort(table, /*input_batch_size=*/10);
+}
+
+TEST_F(TestExternalSort, Errors) {
+  auto table = MakeTable(10);
+  auto input_ptr = std::make_shared<TableBatchReader>(*table);
+
+  ASSERT_RAISES(Invalid, SortExternal(input_ptr, options_));
+
+  options_.sort_keys = {SortKey("nonexistent")};
+  ASSERT_RAISES(Invalid, SortExternal(input_ptr, options_));
+
+  options_.sort_keys = {SortKey("i")};
+  options_.spill_dir = "";
+  ASSERT_RAISES(Invalid, SortExternal(input_ptr, options_));
+
+  options_.spill_dir = "spill";
+  options_.max_merge_width = 1;
+  ASSERT_RAISES(Invalid, SortExternal(input_ptr, options_));
+
+  auto list_table = TableFromJSON(schema({field("l", list(int32()))}), {"[[[1]]]"});
+  auto list_input_ptr = std::make_shared<TableBatchReader>(*list_table);
+  options_.sort_keys = {SortKey("l")};
+  options_.max_merge_width = 2;
+  ASSERT_RAISES(TypeError, SortExternal(list_input_ptr, options_));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -18,35 +18,51 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <list>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/forest_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/localfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/compressed.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/map.h"
 #include "arrow/util/mutex.h"
 #include "arrow/util/string.h"
 #include "arrow/util/task_group.h"
+#include "arrow/util/tracing_internal.h"
 #include "arrow/util/variant.h"
 
 namespace arrow {
 namespace dataset {
 
 Result<std::shared_ptr<io::RandomAccessFile>> FileSource::Open() const {
+  ARROW_TRACE_SPAN(span, "arrow::dataset::FileSource::Open");
   if (filesystem_) {
     return filesystem_->OpenInputFile(file_info_);
   }
@@ -102,6 +118,12 @@ Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
                        std::move(partition_expression), std::move(physical_schema)));
 }
 
+Future<util::optional<int64_t>> FileFormat::CountRows(
+    const std::shared_ptr<FileFragment>&, Expression,
+    const std::shared_ptr<ScanOptions>&) {
+  return util::optional<int64_t>();
+}
+
 Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
@@ -111,19 +133,215 @@ Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanOptions> options
   return format_->ScanFile(std::move(options), self);
 }
 
+Future<util::optional<int64_t>> FileFragment::CountRows(
+    Expression predicate, const std::shared_ptr<ScanOptions>& options) {
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return util::optional<int64_t>(0);
+  }
+  auto self = std::dynamic_pointer_cast<FileFragment>(shared_from_this());
+  return format_->CountRows(self, std::move(predicate), options);
+}
+
+namespace {
+
+void CollectConjunctionMembers(const Expression& expr, std::vector<Expression>* members) {
+  if (auto call = expr.call()) {
+    if (call->function_name == "and_kleene") {
+      CollectConjunctionMembers(call->arguments[0], members);
+      CollectConjunctionMembers(call->arguments[1], members);
+      return;
+    }
+  }
+  members->push_back(expr);
+}
+
+}  // namespace
+
 struct FileSystemDataset::FragmentSubtrees {
   // Forest for skipping fragments based on extracted subtree expressions
   Forest forest;
   // fragment indices and subtree expressions in forest order
   std::vector<util::Variant<int, Expression>> fragments_and_subtrees;
+
+  // Index of the fragments whose partition expressions pin a field to a value
+  // (field == literal), keyed by that value. Filter conjunction members which
+  // constrain such a field are resolved once per distinct value rather than once per
+  // fragment.
+  struct FieldIndex {
+    std::shared_ptr<DataType> type;
+    // Set if the field is pinned to values of differing types; the index is unusable.
+    bool mixed_types = false;
+    std::unordered_map<Expression, std::vector<int>, Expression::Hash> fragments_by_value;
+    // Fragments which don't pin this field and so can't be excluded by it.
+    std::vector<int> unpinned;
+  };
+  std::unordered_map<std::string, FieldIndex> field_indices;
+
+  void IndexFieldValues(const std::vector<std::shared_ptr<FileFragment>>& fragments) {
+    std::vector<Expression> members;
+    for (size_t i = 0; i < fragments.size(); ++i) {
+      members.clear();
+      CollectConjunctionMembers(fragments[i]->partition_expression(), &members);
+
+      for (const auto& member : members) {
+        auto call = member.call();
+        if (!call || call->function_name != "equal") continue;
+
+        auto name = call->arguments[0].field_ref() != nullptr
+                        ? call->arguments[0].field_ref()->name()
+                        : nullptr;
+        auto value = call->arguments[1].literal();
+        if (!name || !value || !value->is_scalar() || !value->scalar()->is_valid) {
+          continue;
+        }
+
+        auto& index = field_indices[*name];
+        if (index.type == nullptr) {
+          index.type = value->type();
+        } else if (!index.type->Equals(*value->type())) {
+          index.mixed_types = true;
+        }
+
+        auto& pinned = index.fragments_by_value[call->arguments[1]];
+        if (pinned.empty() || pinned.back() != static_cast<int>(i)) {
+          pinned.push_back(static_cast<int>(i));
+        }
+      }
+    }
+
+    std::vector<bool> is_pinned;
+    for (auto& name_index : field_indices) {
+      auto& index = name_index.second;
+      is_pinned.assign(fragments.size(), false);
+      for (const auto& value_fragments : index.fragments_by_value) {
+        for (int i : value_fragments.second) is_pinned[i] = true;
+      }
+      for (size_t i = 0; i < fragments.size(); ++i) {
+        if (!is_pinned[i]) index.unpinned.push_back(static_cast<int>(i));
+      }
+    }
+  }
+
+  // Look up the index and the values satisfying a conjunction member of the form
+  // (field <cmp> literal), (literal <cmp> field), or is_in(field, value_set).
+  // Returns nullptr if the member can't be resolved by any index.
+  Result<const FieldIndex*> MatchValues(const Expression& member,
+                                        std::vector<const std::vector<int>*>* matches) {
+    auto call = member.call();
+    if (!call) return nullptr;
+
+    auto IndexFor = [&](const Expression& ref_expr,
+                        const DataType& type) -> const FieldIndex* {
+      auto ref = ref_expr.field_ref();
+      if (!ref || !ref->name()) return nullptr;
+      auto it = field_indices.find(*ref->name());
+      if (it == field_indices.end() || it->second.mixed_types) return nullptr;
+      return it->second.type->Equals(type) ? &it->second : nullptr;
+    };
+
+    if (auto options = GetSetLookupOptions(*call)) {
+      if (call->function_name != "is_in" || !options->value_set.is_array()) {
+        return nullptr;
+      }
+      auto value_set = options->value_set.make_array();
+      auto index = IndexFor(call->arguments[0], *value_set->type());
+      if (!index) return nullptr;
+
+      for (int64_t i = 0; i < value_set->length(); ++i) {
+        if (value_set->IsNull(i)) continue;
+        ARROW_ASSIGN_OR_RAISE(auto value, value_set->GetScalar(i));
+        auto it = index->fragments_by_value.find(literal(std::move(value)));
+        if (it != index->fragments_by_value.end()) matches->push_back(&it->second);
+      }
+      return index;
+    }
+
+    auto cmp = Comparison::Get(call->function_name);
+    if (!cmp) return nullptr;
+
+    auto ref_expr = &call->arguments[0];
+    auto value = call->arguments[1].literal();
+    auto op = *cmp;
+    if (!value) {
+      // literal <cmp> field; flip the comparison
+      ref_expr = &call->arguments[1];
+      value = call->arguments[0].literal();
+      if (op == Comparison::LESS || op == Comparison::GREATER ||
+          op == Comparison::LESS_EQUAL || op == Comparison::GREATER_EQUAL) {
+        op = static_cast<Comparison::type>(op ^ (Comparison::LESS | Comparison::GREATER));
+      }
+    }
+    if (!value || !value->is_scalar()) return nullptr;
+
+    auto index = IndexFor(*ref_expr, *value->type());
+    if (!index) return nullptr;
+
+    if (op == Comparison::EQUAL) {
+      auto it = index->fragments_by_value.find(literal(*value));
+      if (it != index->fragments_by_value.end()) matches->push_back(&it->second);
+      return index;
+    }
+
+    for (const auto& value_fragments : index->fragments_by_value) {
+      auto actual = Comparison::Execute(*value_fragments.first.literal(), *value);
+      // no comparison kernel for this type; leave the member to the forest
+      if (!actual.ok()) return nullptr;
+      if (*actual & op) matches->push_back(&value_fragments.second);
+    }
+    return index;
+  }
+
+  // Narrow a mask over fragments (initially empty, meaning all fragments) by each
+  // conjunction member of predicate which can be resolved against the field indices.
+  // Returns true if the mask is exact: every conjunction member was resolved and no
+  // fragment was admitted only because it doesn't pin a constrained field.
+  Result<bool> NarrowCandidates(const Expression& predicate, size_t num_fragments,
+                                std::vector<bool>* candidates) {
+    if (field_indices.empty()) return false;
+
+    std::vector<Expression> members;
+    CollectConjunctionMembers(predicate, &members);
+
+    bool exact = true;
+    std::vector<const std::vector<int>*> matches;
+    std::vector<bool> admitted;
+    for (const auto& member : members) {
+      matches.clear();
+      ARROW_ASSIGN_OR_RAISE(auto index, MatchValues(member, &matches));
+      if (!index) {
+        exact = false;
+        continue;
+      }
+
+      admitted.assign(num_fragments, false);
+      for (auto fragment_indices : matches) {
+        for (int i : *fragment_indices) admitted[i] = true;
+      }
+      for (int i : index->unpinned) admitted[i] = true;
+      exact = exact && index->unpinned.empty();
+
+      if (candidates->empty()) {
+        *candidates = std::move(admitted);
+      } else {
+        for (size_t i = 0; i < num_fragments; ++i) {
+          (*candidates)[i] = (*candidates)[i] && admitted[i];
+        }
+      }
+    }
+    return exact && !candidates->empty();
+  }
 };
 
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
     std::shared_ptr<Schema> schema, Expression root_partition,
     std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem,
-    std::vector<std::shared_ptr<FileFragment>> fragments) {
+    std::vector<std::shared_ptr<FileFragment>> fragments,
+    std::vector<compute::SortKey> sort_keys) {
   std::shared_ptr<FileSystemDataset> out(
       new FileSystemDataset(std::move(schema), std::move(root_partition)));
+  out->sort_keys_ = std::move(sort_keys);
   out->format_ = std::move(format);
   out->filesystem_ = std::move(filesystem);
   out->fragments_ = std::move(fragments);
@@ -134,7 +352,8 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
 Result<std::shared_ptr<Dataset>> FileSystemDataset::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
-  return Make(std::move(schema), partition_expression_, format_, filesystem_, fragments_);
+  return Make(std::move(schema), partition_expression_, format_, filesystem_, fragments_,
+              sort_keys_);
 }
 
 std::vector<std::string> FileSystemDataset::files() const {
@@ -191,6 +410,8 @@ void FileSystemDataset::SetupSubtreePruning() {
     }
   }
 
+  subtrees_->IndexFieldValues(fragments_);
+
   subtrees_->forest = Forest(static_cast<int>(encoded.size()), [&](int l, int r) {
     if (encoded[l].fragment_index) {
       // Fragment: not an ancestor.
@@ -213,11 +434,41 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(Expression predicat
     return MakeVectorIterator(FragmentVector(fragments_.begin(), fragments_.end()));
   }
 
+  std::vector<bool> candidates;
+  ARROW_ASSIGN_OR_RAISE(bool exact, subtrees_->NarrowCandidates(
+                                        predicate, fragments_.size(), &candidates));
+  if (exact) {
+    FragmentVector fragments;
+    for (size_t i = 0; i < fragments_.size(); ++i) {
+      if (candidates[i]) fragments.push_back(fragments_[i]);
+    }
+    return MakeVectorIterator(std::move(fragments));
+  }
+
+  // Count candidate fragments preceding each position in the forest so that subtrees
+  // containing no candidates can be skipped without simplifying the predicate.
+  std::vector<int> candidates_before;
+  if (!candidates.empty()) {
+    const auto& forest_order = subtrees_->fragments_and_subtrees;
+    candidates_before.resize(forest_order.size() + 1, 0);
+    for (size_t i = 0; i < forest_order.size(); ++i) {
+      auto fragment_index = util::get_if<int>(&forest_order[i]);
+      candidates_before[i + 1] =
+          candidates_before[i] + (fragment_index && candidates[*fragment_index] ? 1 : 0);
+    }
+  }
+
   std::vector<int> fragment_indices;
 
   std::vector<Expression> predicates{predicate};
   RETURN_NOT_OK(subtrees_->forest.Visit(
       [&](Forest::Ref ref) -> Result<bool> {
+        if (!candidates_before.empty() &&
+            candidates_before[ref.i + 1 + ref.num_descendants()] ==
+                candidates_before[ref.i]) {
+          return false;
+        }
+
         if (auto fragment_index =
                 util::get_if<int>(&subtrees_->fragments_and_subtrees[ref.i])) {
           fragment_indices.push_back(*fragment_index);
@@ -276,101 +527,326 @@ Status ValidateBasenameTemplate(util::string_view basename_template) {
   return Status::OK();
 }
 
-/// WriteQueue allows batches to be pushed from multiple threads while another thread
-/// flushes some to disk.
+// Return whichever of two scalars compares as `op` ("less" or "greater"), or the
+// candidate if there is no current value.
+Result<std::shared_ptr<Scalar>> Extremum(std::shared_ptr<Scalar> current,
+                                         std::shared_ptr<Scalar> candidate,
+                                         const std::string& op) {
+  if (current == nullptr) {
+    return candidate;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto replace,
+                        compute::CallFunction(op, {Datum(candidate), Datum(current)}));
+  if (replace.scalar_as<BooleanScalar>().value) {
+    return candidate;
+  }
+  return current;
+}
+
+/// FileSummary accumulates the row count and column statistics of the batches written
+/// to a single file, to be recorded in the summary index.
+class FileSummary {
+ public:
+  FileSummary(std::string path, Expression partition_expression, int num_columns)
+      : path_(std::move(path)),
+        partition_expression_(std::move(partition_expression)),
+        columns_(num_columns) {}
+
+  Status Update(const RecordBatch& batch) {
+    num_rows_ += batch.num_rows();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(columns_[i].Update(batch.column(i)));
+    }
+    return Status::OK();
+  }
+
+  const std::string& path() const { return path_; }
+  const Expression& partition_expression() const { return partition_expression_; }
+  int64_t num_rows() const { return num_rows_; }
+
+  const std::shared_ptr<Scalar>& min(int i) const { return columns_[i].min; }
+  const std::shared_ptr<Scalar>& max(int i) const { return columns_[i].max; }
+  int64_t null_count(int i) const { return columns_[i].null_count; }
+
+ private:
+  struct ColumnSummary {
+    Status Update(const std::shared_ptr<Array>& column) {
+      null_count += column->null_count();
+      if (!has_min_max || column->null_count() == column->length()) {
+        return Status::OK();
+      }
+
+      auto maybe_min_max = compute::MinMax(column);
+      if (maybe_min_max.status().IsNotImplemented()) {
+        // min_max doesn't support this type
+        has_min_max = false;
+        return Status::OK();
+      }
+      ARROW_ASSIGN_OR_RAISE(auto min_max, maybe_min_max);
+
+      const auto& extrema = min_max.scalar_as<StructScalar>().value;
+      if (!extrema[0]->is_valid) {
+        // e.g. only NaNs
+        return Status::OK();
+      }
+      ARROW_ASSIGN_OR_RAISE(min, Extremum(std::move(min), extrema[0], "less"));
+      ARROW_ASSIGN_OR_RAISE(max, Extremum(std::move(max), extrema[1], "greater"));
+      return Status::OK();
+    }
+
+    std::shared_ptr<Scalar> min, max;
+    int64_t null_count = 0;
+    bool has_min_max = true;
+  };
+
+  std::string path_;
+  Expression partition_expression_;
+  int64_t num_rows_ = 0;
+  std::vector<ColumnSummary> columns_;
+};
+
+struct WriteState;
+
+/// WriteQueue allows batches to be pushed from multiple threads while a single flush at
+/// a time writes them to the partition's current file.
 class WriteQueue {
  public:
-  WriteQueue(std::string partition_expression, size_t index,
+  WriteQueue(std::string partition_expression, Expression partition, int index,
              std::shared_ptr<Schema> schema)
       : partition_expression_(std::move(partition_expression)),
+        partition_(std::move(partition)),
         index_(index),
         schema_(std::move(schema)) {}
 
-  // Push a batch into the writer's queue of pending writes.
-  void Push(std::shared_ptr<RecordBatch> batch) {
-    auto push_lock = push_mutex_.Lock();
+  // Push a batch into the writer's queue of pending writes. Returns true if the caller
+  // must Flush() the queue, false if a flush is already underway which will also write
+  // the pushed batch.
+  bool Push(std::shared_ptr<RecordBatch> batch) {
+    auto lock = mutex_.Lock();
     pending_.push_back(std::move(batch));
+    if (flushing_) return false;
+    flushing_ = true;
+    return true;
   }
 
-  // Flush all pending batches, or return immediately if another thread is already
-  // flushing this queue.
-  Status Flush(const FileSystemDatasetWriteOptions& write_options) {
-    if (auto writer_lock = writer_mutex_.TryLock()) {
-      if (writer_ == nullptr) {
-        // FileWriters are opened lazily to avoid blocking access to a scan-wide queue set
-        RETURN_NOT_OK(OpenWriter(write_options));
-      }
+  // Write all pending batches, including those pushed while flushing.
+  Status Flush(WriteState* state);
 
-      while (true) {
-        std::shared_ptr<RecordBatch> batch;
-        {
-          auto push_lock = push_mutex_.Lock();
-          if (pending_.empty()) {
-            // Ensure the writer_lock is released before the push_lock. Otherwise another
-            // thread might successfully Push() a batch but then fail to Flush() it since
-            // the writer_lock is still held, leaving an unflushed batch in pending_.
-            writer_lock.Unlock();
-            break;
-          }
-          batch = std::move(pending_.front());
-          pending_.pop_front();
-        }
-        RETURN_NOT_OK(writer_->Write(batch));
-      }
-    }
-    return Status::OK();
+  // Close the current file if no flush is underway. Returns false if the queue is busy
+  // and its file was left open.
+  Result<bool> TryClose() {
+    auto lock = mutex_.TryLock();
+    if (!lock || flushing_) return false;
+    RETURN_NOT_OK(CloseWriter());
+    return true;
   }
 
-  const std::shared_ptr<FileWriter>& writer() const { return writer_; }
-
- private:
-  Status OpenWriter(const FileSystemDatasetWriteOptions& write_options) {
-    auto dir =
-        fs::internal::EnsureTrailingSlash(write_options.base_dir) + partition_expression_;
-
-    auto basename = internal::Replace(write_options.basename_template, kIntegerToken,
-                                      std::to_string(index_));
-    if (!basename) {
-      return Status::Invalid("string interpolation of basename template failed");
-    }
-
-    auto path = fs::internal::ConcatAbstractPath(dir, *basename);
+  // Close the current file, if any. Only valid once no more batches are pushed.
+  Status Finish() { return CloseWriter(); }
 
-    RETURN_NOT_OK(write_options.filesystem->CreateDir(dir));
-    ARROW_ASSIGN_OR_RAISE(auto destination,
-                          write_options.filesystem->OpenOutputStream(path));
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
 
-    ARROW_ASSIGN_OR_RAISE(
-        writer_, write_options.format()->MakeWriter(std::move(destination), schema_,
-                                                    write_options.file_write_options));
-    return Status::OK();
+  // Summaries of every file written for this partition. Empty unless
+  // write_options.write_summary_index is set
+  const std::vector<std::unique_ptr<FileSummary>>& summaries() const {
+    return summaries_;
   }
 
-  util::Mutex writer_mutex_;
-  std::shared_ptr<FileWriter> writer_;
+ private:
+  Status WriteBatch(WriteState* state, std::shared_ptr<RecordBatch> batch);
+  Status OpenWriter(WriteState* state);
+
+  Status CloseWriter() {
+    if (writer_ == nullptr) return Status::OK();
+    auto writer = std::move(writer_);
+    writer_.reset();
+    if (summary_ != nullptr) {
+      summaries_.push_back(std::move(summary_));
+    }
+    return writer->Finish();
+  }
 
-  util::Mutex push_mutex_;
+  util::Mutex mutex_;
   std::deque<std::shared_ptr<RecordBatch>> pending_;
+  bool flushing_ = false;
+
+  // Only accessed by the flushing thread, or while holding mutex_ and not flushing
+  std::shared_ptr<FileWriter> writer_;
+  std::unique_ptr<FileSummary> summary_;
+  int64_t rows_in_file_ = 0;
+  std::vector<std::unique_ptr<FileSummary>> summaries_;
 
   // The (formatted) partition expression to which this queue corresponds
   std::string partition_expression_;
+  Expression partition_;
 
-  size_t index_;
+  // Index interpolated into the basename of the next file opened, -1 if one must be
+  // taken from WriteState::next_file_index
+  int index_;
 
   std::shared_ptr<Schema> schema_;
+
+  // Position in WriteState::open_files, valid while writer_ is open
+  std::list<WriteQueue*>::iterator open_files_position_;
+
+  friend struct WriteState;
 };
 
 struct WriteState {
-  explicit WriteState(FileSystemDatasetWriteOptions write_options)
-      : write_options(std::move(write_options)) {}
+  WriteState(FileSystemDatasetWriteOptions write_options, bool use_threads)
+      : write_options(std::move(write_options)), use_threads(use_threads) {}
+
+  // Register a file about to be opened for `queue`, closing the least recently used
+  // files of other queues to stay within write_options.max_open_files. Files which
+  // are being written can't be closed, so the limit may be exceeded by the number of
+  // concurrently flushing queues.
+  Status AddOpenFile(WriteQueue* queue) {
+    auto lock = open_files_mutex.Lock();
+    auto max_open_files = static_cast<size_t>(write_options.max_open_files);
+    for (auto it = open_files.end();
+         max_open_files != 0 && open_files.size() >= max_open_files &&
+         it != open_files.begin();) {
+      WriteQueue* victim = *--it;
+      ARROW_ASSIGN_OR_RAISE(bool closed, victim->TryClose());
+      if (closed) {
+        it = open_files.erase(it);
+      }
+    }
+    queue->open_files_position_ = open_files.insert(open_files.begin(), queue);
+    return Status::OK();
+  }
+
+  // Mark `queue`'s file as most recently used
+  void TouchOpenFile(WriteQueue* queue) {
+    auto lock = open_files_mutex.Lock();
+    open_files.splice(open_files.begin(), open_files, queue->open_files_position_);
+  }
+
+  // Forget `queue`'s file, which its flush is about to close
+  void RemoveOpenFile(WriteQueue* queue) {
+    auto lock = open_files_mutex.Lock();
+    open_files.erase(queue->open_files_position_);
+  }
 
   FileSystemDatasetWriteOptions write_options;
+  bool use_threads;
+
   util::Mutex mutex;
   std::unordered_map<std::string, std::unique_ptr<WriteQueue>> queues;
+  std::atomic<int> next_file_index{0};
+
+  // Queues with an open file, most recently written first
+  util::Mutex open_files_mutex;
+  std::list<WriteQueue*> open_files;
 };
 
-Status WriteNextBatch(WriteState& state, const std::shared_ptr<Fragment>& fragment,
-                      std::shared_ptr<RecordBatch> batch) {
+Status WriteQueue::Flush(WriteState* state) {
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    {
+      auto lock = mutex_.Lock();
+      if (pending_.empty()) {
+        flushing_ = false;
+        return Status::OK();
+      }
+      batch = std::move(pending_.front());
+      pending_.pop_front();
+    }
+    auto st = WriteBatch(state, std::move(batch));
+    if (!st.ok()) {
+      auto lock = mutex_.Lock();
+      flushing_ = false;
+      return st;
+    }
+  }
+}
+
+Status WriteQueue::WriteBatch(WriteState* state, std::shared_ptr<RecordBatch> batch) {
+  const auto& write_options = state->write_options;
+  while (batch->num_rows() > 0) {
+    if (writer_ == nullptr) {
+      // FileWriters are opened lazily to avoid blocking access to a scan-wide queue set
+      RETURN_NOT_OK(OpenWriter(state));
+    } else {
+      state->TouchOpenFile(this);
+    }
+
+    // Split off the rows which don't fit into the current file
+    std::shared_ptr<RecordBatch> rest;
+    if (write_options.max_rows_per_file > 0 &&
+        rows_in_file_ + batch->num_rows() > write_options.max_rows_per_file) {
+      auto fit = write_options.max_rows_per_file - rows_in_file_;
+      rest = batch->Slice(fit);
+      batch = batch->Slice(0, fit);
+    }
+
+    RETURN_NOT_OK(writer_->Write(batch));
+    if (summary_ != nullptr) {
+      RETURN_NOT_OK(summary_->Update(*batch));
+    }
+    rows_in_file_ += batch->num_rows();
+
+    bool file_full = rows_in_file_ == write_options.max_rows_per_file;
+    if (!file_full && write_options.max_bytes_per_file > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto bytes_written, writer_->GetBytesWritten());
+      file_full = bytes_written >= write_options.max_bytes_per_file;
+    }
+    if (file_full) {
+      state->RemoveOpenFile(this);
+      RETURN_NOT_OK(CloseWriter());
+    }
+
+    if (rest == nullptr) break;
+    batch = std::move(rest);
+  }
+  return Status::OK();
+}
+
+Status WriteQueue::OpenWriter(WriteState* state) {
+  const auto& write_options = state->write_options;
+  auto dir =
+      fs::internal::EnsureTrailingSlash(write_options.base_dir) + partition_expression_;
+
+  int index = index_ >= 0 ? index_ : state->next_file_index++;
+  index_ = -1;
+  auto basename = internal::Replace(write_options.basename_template, kIntegerToken,
+                                    std::to_string(index));
+  if (!basename) {
+    return Status::Invalid("string interpolation of basename template failed");
+  }
+
+  auto path = fs::internal::ConcatAbstractPath(dir, *basename);
+
+  RETURN_NOT_OK(state->AddOpenFile(this));
+  RETURN_NOT_OK(write_options.filesystem->CreateDir(dir));
+  ARROW_ASSIGN_OR_RAISE(auto destination,
+                        write_options.filesystem->OpenOutputStream(path));
+
+  ARROW_ASSIGN_OR_RAISE(
+      writer_, write_options.format()->MakeWriter(std::move(destination), schema_,
+                                                  write_options.file_write_options));
+  rows_in_file_ = 0;
+
+  if (write_options.write_summary_index) {
+    auto relative_path =
+        path.substr(fs::internal::EnsureTrailingSlash(write_options.base_dir).size());
+    summary_ = internal::make_unique<FileSummary>(std::move(relative_path), partition_,
+                                                  schema_->num_fields());
+  }
+  return Status::OK();
+}
+
+// Flush `queue` on the filesystem's IO executor, or inline if not using threads.
+Future<> ScheduleFlush(WriteState& state, WriteQueue* queue) {
+  if (!state.use_threads) {
+    return Future<>::MakeFinished(queue->Flush(&state));
+  }
+  auto executor = state.write_options.filesystem->io_context().executor();
+  return DeferNotOk(executor->Submit([&state, queue] { return queue->Flush(&state); }));
+}
+
+Future<> WriteNextBatch(WriteState& state, const std::shared_ptr<Fragment>& fragment,
+                        std::shared_ptr<RecordBatch> batch) {
   ARROW_ASSIGN_OR_RAISE(auto groups, state.write_options.partitioning->Partition(batch));
   batch.reset();  // drop to hopefully conserve memory
 
@@ -380,7 +856,7 @@ Status WriteNextBatch(WriteState& state, const std::shared_ptr<Fragment>& fragme
                            state.write_options.max_partitions);
   }
 
-  std::unordered_set<WriteQueue*> need_flushed;
+  std::vector<Future<>> flushes;
   for (size_t i = 0; i < groups.batches.size(); ++i) {
     auto partition_expression =
         and_(std::move(groups.expressions[i]), fragment->partition_expression());
@@ -399,49 +875,60 @@ Status WriteNextBatch(WriteState& state, const std::shared_ptr<Fragment>& fragme
                   [&](const std::string& emplaced_part) {
                     // lookup in `queues` also failed,
                     // generate a new WriteQueue
-                    size_t queue_index = state.queues.size() - 1;
-
-                    return internal::make_unique<WriteQueue>(emplaced_part, queue_index,
-                                                             batch->schema());
+                    return internal::make_unique<WriteQueue>(
+                        emplaced_part, partition_expression, state.next_file_index++,
+                        batch->schema());
                   })
                   ->second.get();
     }
 
-    queue->Push(std::move(batch));
-    need_flushed.insert(queue);
+    if (queue->Push(std::move(batch))) {
+      flushes.push_back(ScheduleFlush(state, queue));
+    }
   }
 
-  // flush all touched WriteQueues
-  for (auto queue : need_flushed) {
-    RETURN_NOT_OK(queue->Flush(state.write_options));
-  }
-  return Status::OK();
+  // Wait for every flush, even if one fails, since they reference `state`. Waiting
+  // also keeps the batches pending in the queues bounded by the scan's parallelism.
+  return All(std::move(flushes))
+      .Then([](const std::vector<Result<detail::Empty>>& results) -> Status {
+        for (const auto& result : results) {
+          RETURN_NOT_OK(result);
+        }
+        return Status::OK();
+      });
 }
 
 Future<> WriteInternal(const ScanOptions& scan_options, WriteState& state,
                        ScanTaskVector scan_tasks, internal::Executor* cpu_executor) {
   // Store a mapping from partitions (represened by their formatted partition expressions)
   // to a WriteQueue which flushes batches into that partition's output file. In principle
-  // any thread could produce a batch for any partition, so each task alternates between
-  // pushing batches and flushing them to disk.
+  // any thread could produce a batch for any partition, so each task pushes batches and
+  // waits for the partitions' queues to be flushed to disk on the IO executor.
   std::vector<Future<>> scan_futs;
   auto task_group = scan_options.TaskGroup();
 
   for (const auto& scan_task : scan_tasks) {
     if (scan_task->supports_async()) {
       ARROW_ASSIGN_OR_RAISE(auto batches_gen, scan_task->ExecuteAsync(cpu_executor));
-      std::function<Status(std::shared_ptr<RecordBatch> batch)> batch_visitor =
-          [&, scan_task](std::shared_ptr<RecordBatch> batch) {
-            return WriteNextBatch(state, scan_task->fragment(), std::move(batch));
-          };
-      scan_futs.push_back(VisitAsyncGenerator(batches_gen, batch_visitor));
+      scan_futs.push_back(Loop([&state, scan_task, batches_gen] {
+        return batches_gen().Then(
+            [&state, scan_task](
+                const std::shared_ptr<RecordBatch>& batch) -> Future<ControlFlow<>> {
+              if (IsIterationEnd(batch)) {
+                return Future<ControlFlow<>>::MakeFinished(Break());
+              }
+              return WriteNextBatch(state, scan_task->fragment(), batch)
+                  .Then([](const detail::Empty&) -> ControlFlow<> { return Continue(); });
+            });
+      }));
     } else {
       task_group->Append([&, scan_task] {
         ARROW_ASSIGN_OR_RAISE(auto batches, scan_task->Execute());
 
         for (auto maybe_batch : batches) {
           ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
-          RETURN_NOT_OK(WriteNextBatch(state, scan_task->fragment(), std::move(batch)));
+          RETURN_NOT_OK(
+              WriteNextBatch(state, scan_task->fragment(), std::move(batch)).status());
         }
 
         return Status::OK();
@@ -452,6 +939,94 @@ Future<> WriteInternal(const ScanOptions& scan_options, WriteState& state,
   return AllComplete(scan_futs);
 }
 
+// Make an array of the given scalars, where null pointers become nulls.
+Result<std::shared_ptr<Array>> ArrayFromScalars(
+    const std::shared_ptr<DataType>& type,
+    const std::vector<std::shared_ptr<Scalar>>& scalars) {
+  if (scalars.empty()) {
+    return MakeArrayOfNull(type, 0);
+  }
+  ArrayVector chunks(scalars.size());
+  for (size_t i = 0; i < scalars.size(); ++i) {
+    if (scalars[i] != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(chunks[i], MakeArrayFromScalar(*scalars[i], 1));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(chunks[i], MakeArrayOfNull(type, 1));
+    }
+  }
+  return Concatenate(chunks);
+}
+
+Status WriteSummaryIndex(const FileSystemDatasetWriteOptions& write_options,
+                         const std::shared_ptr<Schema>& dataset_schema,
+                         std::shared_ptr<Schema> file_schema,
+                         const std::vector<const FileSummary*>& summaries) {
+  StringBuilder paths;
+  BinaryBuilder partition_expressions;
+  Int64Builder num_rows;
+  for (const FileSummary* summary : summaries) {
+    RETURN_NOT_OK(paths.Append(summary->path()));
+    ARROW_ASSIGN_OR_RAISE(auto serialized, Serialize(summary->partition_expression()));
+    RETURN_NOT_OK(partition_expressions.Append(serialized->data(), serialized->size()));
+    RETURN_NOT_OK(num_rows.Append(summary->num_rows()));
+  }
+
+  ArrayVector statistics(file_schema->num_fields());
+  for (int i = 0; i < file_schema->num_fields(); ++i) {
+    const auto& type = file_schema->field(i)->type();
+    std::vector<std::shared_ptr<Scalar>> mins, maxes;
+    Int64Builder null_counts;
+    for (const FileSummary* summary : summaries) {
+      mins.push_back(summary->min(i));
+      maxes.push_back(summary->max(i));
+      RETURN_NOT_OK(null_counts.Append(summary->null_count(i)));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto min, ArrayFromScalars(type, mins));
+    ARROW_ASSIGN_OR_RAISE(auto max, ArrayFromScalars(type, maxes));
+    ARROW_ASSIGN_OR_RAISE(auto null_count, null_counts.Finish());
+    ARROW_ASSIGN_OR_RAISE(statistics[i],
+                          StructArray::Make({min, max, null_count},
+                                            {field("min", type), field("max", type),
+                                             field("null_count", int64())}));
+  }
+
+  ArrayVector columns(4);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(partition_expressions.Finish(&columns[1]));
+  RETURN_NOT_OK(num_rows.Finish(&columns[2]));
+  if (statistics.empty()) {
+    columns[3] = std::make_shared<StructArray>(struct_({}), summaries.size(),
+                                               ArrayVector{});
+  } else {
+    ARROW_ASSIGN_OR_RAISE(columns[3],
+                          StructArray::Make(statistics, file_schema->field_names()));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*dataset_schema));
+  auto metadata = key_value_metadata(
+      {kSummaryIndexSchemaKey},
+      {arrow::util::base64_encode(serialized_schema->data(),
+                                  static_cast<unsigned int>(serialized_schema->size()))});
+  auto index_schema = schema(
+      {field(kSummaryIndexPath, utf8()),
+       field(kSummaryIndexPartitionExpression, binary()),
+       field(kSummaryIndexNumRows, int64()),
+       field(kSummaryIndexStatistics, columns[3]->type())},
+      std::move(metadata));
+  auto batch =
+      RecordBatch::Make(index_schema, static_cast<int64_t>(summaries.size()), columns);
+
+  auto path = fs::internal::ConcatAbstractPath(write_options.base_dir,
+                                               kSummaryIndexFileName);
+  ARROW_ASSIGN_OR_RAISE(auto destination,
+                        write_options.filesystem->OpenOutputStream(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, index_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return destination->Close();
+}
+
 }  // namespace
 
 Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_options,
@@ -472,7 +1047,7 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
   ARROW_ASSIGN_OR_RAISE(auto scan_task_it, scanner->Scan());
   ARROW_ASSIGN_OR_RAISE(ScanTaskVector scan_tasks, scan_task_it.ToVector());
 
-  WriteState state(write_options);
+  WriteState state(write_options, scanner->options()->use_threads);
   auto res = internal::RunSynchronously<arrow::detail::Empty>(
       [&](internal::Executor* cpu_executor) -> Future<> {
         return WriteInternal(*scanner->options(), state, std::move(scan_tasks),
@@ -483,9 +1058,31 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
 
   auto task_group = scanner->options()->TaskGroup();
   for (const auto& part_queue : state.queues) {
-    task_group->Append([&] { return part_queue.second->writer()->Finish(); });
+    task_group->Append([&] { return part_queue.second->Finish(); });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  if (!write_options.write_summary_index) {
+    return Status::OK();
   }
-  return task_group->Finish();
+
+  // Written files contain the projected columns, except those used as partition keys
+  const auto& dataset_schema = scanner->options()->projected_schema;
+  std::shared_ptr<Schema> file_schema = dataset_schema;
+  std::vector<const FileSummary*> summaries;
+  for (const auto& part_queue : state.queues) {
+    file_schema = part_queue.second->schema();
+    for (const auto& summary : part_queue.second->summaries()) {
+      summaries.push_back(summary.get());
+    }
+  }
+  // Sorting by path makes the index deterministic
+  std::sort(summaries.begin(), summaries.end(),
+            [](const FileSummary* l, const FileSummary* r) {
+              return l->path() < r->path();
+            });
+  return WriteSummaryIndex(write_options, dataset_schema, std::move(file_schema),
+                           summaries);
 }
 
 }  // namespace dataset
@@ -94,6 +94,11 @@ class ARROW_DS_EXPORT FileSource {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file's FileInfo, if any. Only valid when file source wraps a
+  /// path. Size and modification time are only known if the source was constructed
+  /// from a full FileInfo, e.g. during discovery.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -164,12 +169,23 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
       std::shared_ptr<FileWriteOptions> options) const = 0;
 
   virtual std::shared_ptr<FileWriteOptions> DefaultWriteOptions() = 0;
+
+  /// \brief Count the rows of a FileFragment matching a predicate from the file's
+  /// metadata, see Fragment::CountRows.
+  ///
+  /// The predicate was already simplified against the fragment's partition expression.
+  /// The default implementation returns util::nullopt: rows are counted by scanning.
+  virtual Future<util::optional<int64_t>> CountRows(
+      const std::shared_ptr<FileFragment>& file, Expression predicate,
+      const std::shared_ptr<ScanOptions>& options);
 };
 
 /// \brief A Fragment that is stored in a file with a known format
 class ARROW_DS_EXPORT FileFragment : public Fragment {
  public:
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options) override;
+  Future<util::optional<int64_t>> CountRows(
+      Expression predicate, const std::shared_ptr<ScanOptions>& options) override;
 
   std::string type_name() const override { return format_->type_name(); }
   std::string ToString() const override { return source_.path(); };
@@ -206,6 +222,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   /// \param[in] filesystem the filesystem of each FileFragment, or nullptr if the
   ///            fragments wrap buffers.
   /// \param[in] fragments list of fragments to create the dataset from.
+  /// \param[in] sort_keys keys by which the rows of every fragment are sorted, if any.
   ///
   /// Note that fragments wrapping files resident in differing filesystems are not
   /// permitted; to work with multiple filesystems use a UnionDataset.
@@ -214,7 +231,8 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   static Result<std::shared_ptr<FileSystemDataset>> Make(
       std::shared_ptr<Schema> schema, Expression root_partition,
       std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem,
-      std::vector<std::shared_ptr<FileFragment>> fragments);
+      std::vector<std::shared_ptr<FileFragment>> fragments,
+      std::vector<compute::SortKey> sort_keys = {});
 
   /// \brief Write a dataset.
   static Status Write(const FileSystemDatasetWriteOptions& write_options,
@@ -283,6 +301,12 @@ class ARROW_DS_EXPORT FileWriter {
 
   virtual Status Finish();
 
+  /// \brief The number of bytes written to the destination so far.
+  ///
+  /// Formats which buffer data internally may report less than has been passed to
+  /// Write().
+  Result<int64_t> GetBytesWritten() const { return destination_->Tell(); }
+
   const std::shared_ptr<FileFormat>& format() const { return options_->format(); }
   const std::shared_ptr<Schema>& schema() const { return schema_; }
   const std::shared_ptr<FileWriteOptions>& options() const { return options_; }
@@ -301,6 +325,10 @@ class ARROW_DS_EXPORT FileWriter {
   std::shared_ptr<io::OutputStream> destination_;
 };
 
+/// \brief Name of the summary index written into the base directory of a dataset by
+/// FileSystemDataset::Write, see FileSystemDatasetWriteOptions::write_summary_index.
+constexpr char kSummaryIndexFileName[] = "_summary_index.arrow";
+
 struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// Options for individual fragment writing.
   std::shared_ptr<FileWriteOptions> file_write_options;
@@ -317,10 +345,33 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// Maximum number of partitions any batch may be written into, default is 1K.
   int max_partitions = 1024;
 
+  /// Maximum number of files kept open at once. Once reached, the least recently
+  /// written file is closed before another one is opened, and later batches for its
+  /// partition go to a new file. Files which are being written aren't closed, so the
+  /// limit may be exceeded by the number of partitions written concurrently. 0 means
+  /// no limit, default is 900.
+  uint32_t max_open_files = 900;
+
+  /// Maximum number of rows in any written file. Batches are split to respect the
+  /// limit and another file is started for the remaining rows. 0 means no limit.
+  int64_t max_rows_per_file = 0;
+
+  /// Approximate maximum size of any written file. A file is closed once the bytes
+  /// written to it reach this limit, so it may exceed the limit by one batch. 0 means
+  /// no limit.
+  int64_t max_bytes_per_file = 0;
+
   /// Template string used to generate fragment basenames.
   /// {i} will be replaced by an auto incremented integer.
   std::string basename_template;
 
+  /// If true, also write an index of the written files into
+  /// base_dir/_summary_index.arrow. For each file it records the path, partition
+  /// expression, row count and each column's min, max and null count, so that
+  /// SummaryIndexDatasetFactory can recreate the dataset and prune its fragments with
+  /// a single read.
+  bool write_summary_index = false;
+
   const std::shared_ptr<FileFormat>& format() const {
     return file_write_options->format();
   }
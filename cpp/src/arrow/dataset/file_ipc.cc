@@ -19,17 +19,22 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/scalar.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 
@@ -73,6 +78,63 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+// Derive an expression which holds for all the rows of a record batch from the
+// statistics of one of its columns, as is done for Parquet row groups
+static util::optional<Expression> ColumnStatisticsAsExpression(
+    const Field& field, const ipc::ColumnStatistics& statistics, int64_t num_rows) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.null_count == num_rows) {
+    return equal(std::move(field_expr), literal(MakeNullScalar(field.type())));
+  }
+
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return util::nullopt;
+  }
+  return and_(greater_equal(field_expr, literal(statistics.min)),
+              less_equal(field_expr, literal(statistics.max)));
+}
+
+// Select the record batches of the file which may contain rows satisfying the
+// filter, according to the statistics in the file footer (if any)
+static Result<std::vector<int>> SelectRecordBatches(ipc::RecordBatchFileReader* reader,
+                                                    const Expression& filter) {
+  const auto& schema = *reader->schema();
+
+  std::unordered_set<int> filtered_fields;
+  for (const FieldRef& ref : FieldsInExpression(filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.empty()) continue;
+    filtered_fields.insert(match[0]);
+  }
+
+  if (filtered_fields.empty()) {
+    std::vector<int> all(reader->num_record_batches());
+    std::iota(all.begin(), all.end(), 0);
+    return all;
+  }
+
+  return reader->SelectRecordBatches(
+      [&](const ipc::RecordBatchStatistics& statistics) -> Result<bool> {
+        std::vector<Expression> guarantees;
+        for (int i : filtered_fields) {
+          if (const auto& column_statistics = statistics.columns[i]) {
+            if (auto guarantee = ColumnStatisticsAsExpression(
+                    *schema.field(i), *column_statistics, statistics.num_rows)) {
+              guarantees.push_back(std::move(*guarantee));
+            }
+          }
+        }
+        if (guarantees.empty()) {
+          return true;
+        }
+        ARROW_ASSIGN_OR_RAISE(auto guarantee, and_(guarantees).Bind(schema));
+        ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(filter, guarantee));
+        return simplified.IsSatisfiable();
+      });
+}
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
@@ -106,19 +168,24 @@ class IpcScanTask : public ScanTask {
             GetIncludedFields(*reader->schema(), scan_options->MaterializedFields()));
 
         ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
+
+        // Skip the record batches whose statistics rule out the filter
+        ARROW_ASSIGN_OR_RAISE(auto record_batches,
+                              SelectRecordBatches(reader.get(), scan_options->filter));
+        return RecordBatchIterator(Impl{std::move(reader), std::move(record_batches), 0});
       }
 
       Result<std::shared_ptr<RecordBatch>> Next() {
-        if (i_ == reader_->num_record_batches()) {
+        if (i_ == record_batches_.size()) {
           return nullptr;
         }
 
-        return reader_->ReadRecordBatch(i_++);
+        return reader_->ReadRecordBatch(record_batches_[i_++]);
       }
 
       std::shared_ptr<ipc::RecordBatchFileReader> reader_;
-      int i_;
+      std::vector<int> record_batches_;
+      size_t i_;
     };
 
     return Impl::Make(
@@ -34,6 +34,10 @@ namespace dataset {
 constexpr char kIpcTypeName[] = "ipc";
 
 /// \brief A FileFormat implementation that reads from and writes to Ipc files
+///
+/// When scanning with a filter, record batches are skipped according to the
+/// column statistics found in the file footer, see
+/// ipc::IpcWriteOptions::write_statistics.
 class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
  public:
   std::string type_name() const override { return kIpcTypeName; }
@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -271,6 +272,198 @@ TEST_F(TestIpcFileSystemDataset, WriteExceedsMaxPartitions) {
                                   FileSystemDataset::Write(write_options_, scanner));
 }
 
+TEST_F(TestIpcFileSystemDataset, WriteSummaryIndex) {
+  write_options_.partitioning = std::make_shared<HivePartitioning>(
+      SchemaFromColumnNames(source_schema_, {"year", "month"}));
+  write_options_.write_summary_index = true;
+
+  auto scanner = MakeScanner(dataset_, scan_options_);
+  ASSERT_OK(FileSystemDataset::Write(write_options_, scanner));
+
+  ASSERT_OK_AND_ASSIGN(auto factory, SummaryIndexDatasetFactory::Make(
+                                         "new_root/_summary_index.arrow", fs_, format_));
+  ASSERT_OK_AND_ASSIGN(auto written, factory->Finish());
+  AssertSchemaEqual(*scan_options_->projected_schema, *written->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto fragment_it, written->GetFragments());
+  ASSERT_OK_AND_ASSIGN(auto fragments, fragment_it.ToVector());
+  ASSERT_EQ(fragments.size(), 2);
+
+  // Statistics prune fragments along with partition keys: sales in 2019 never exceed
+  // 273.5
+  auto CountFragments = [&](Expression predicate) -> size_t {
+    EXPECT_OK_AND_ASSIGN(predicate, predicate.Bind(*written->schema()));
+    EXPECT_OK_AND_ASSIGN(auto it, written->GetFragments(predicate));
+    EXPECT_OK_AND_ASSIGN(auto vector, it.ToVector());
+    return vector.size();
+  };
+  EXPECT_EQ(CountFragments(greater(field_ref("sales"), literal(500.0))), 1);
+  EXPECT_EQ(CountFragments(greater(field_ref("sales"), literal(1000.0))), 0);
+  EXPECT_EQ(CountFragments(and_(equal(field_ref("year"), literal(2019)),
+                                greater(field_ref("sales"), literal(200.0)))),
+            1);
+  EXPECT_EQ(CountFragments(equal(field_ref("region"), literal("NY"))), 2);
+
+  // All written rows are found
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema = written->schema();
+  ASSERT_OK(SetProjection(options.get(), written->schema()->field_names()));
+  ASSERT_OK_AND_ASSIGN(auto table, MakeScanner(written, options)->ToTable());
+  EXPECT_EQ(table->num_rows(), 16);
+}
+
+TEST_F(TestIpcFileSystemDataset, WriteMaxRowsPerFile) {
+  write_options_.partitioning = std::make_shared<HivePartitioning>(
+      SchemaFromColumnNames(source_schema_, {"year", "month"}));
+  write_options_.write_summary_index = true;
+  write_options_.max_rows_per_file = 3;
+
+  auto scanner = MakeScanner(dataset_, scan_options_);
+  ASSERT_OK(FileSystemDataset::Write(write_options_, scanner));
+
+  ASSERT_OK_AND_ASSIGN(auto factory, SummaryIndexDatasetFactory::Make(
+                                         "new_root/_summary_index.arrow", fs_, format_));
+  ASSERT_OK_AND_ASSIGN(auto written, factory->Finish());
+
+  // Each of the two partitions holds 8 rows, split over files of at most 3 rows
+  ASSERT_OK_AND_ASSIGN(auto fragment_it, written->GetFragments());
+  ASSERT_OK_AND_ASSIGN(auto fragments, fragment_it.ToVector());
+  ASSERT_EQ(fragments.size(), 6);
+
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema = written->schema();
+  ASSERT_OK(SetProjection(options.get(), written->schema()->field_names()));
+  std::unordered_map<Fragment*, int64_t> rows_per_file;
+  ASSERT_OK_AND_ASSIGN(auto batch_it, MakeScanner(written, options)->ScanBatches());
+  ASSERT_OK(batch_it.Visit([&](TaggedRecordBatch batch) {
+    rows_per_file[batch.fragment.get()] += batch.record_batch->num_rows();
+    return Status::OK();
+  }));
+  int64_t num_rows = 0;
+  for (const auto& fragment_rows : rows_per_file) {
+    EXPECT_LE(fragment_rows.second, 3);
+    num_rows += fragment_rows.second;
+  }
+  EXPECT_EQ(num_rows, 16);
+}
+
+TEST_F(TestIpcFileSystemDataset, WriteMaxOpenFiles) {
+  write_options_.partitioning = std::make_shared<HivePartitioning>(
+      SchemaFromColumnNames(source_schema_, {"model"}));
+  write_options_.write_summary_index = true;
+  write_options_.max_open_files = 1;
+
+  auto scanner = MakeScanner(dataset_, scan_options_);
+  ASSERT_OK(FileSystemDataset::Write(write_options_, scanner));
+
+  ASSERT_OK_AND_ASSIGN(auto factory, SummaryIndexDatasetFactory::Make(
+                                         "new_root/_summary_index.arrow", fs_, format_));
+  ASSERT_OK_AND_ASSIGN(auto written, factory->Finish());
+
+  // Closed files aren't reopened, so partitions revisited after their file was closed
+  // are written into more than one file
+  ASSERT_OK_AND_ASSIGN(auto fragment_it, written->GetFragments());
+  ASSERT_OK_AND_ASSIGN(auto fragments, fragment_it.ToVector());
+  EXPECT_GT(fragments.size(), 4);
+
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema = written->schema();
+  ASSERT_OK(SetProjection(options.get(), written->schema()->field_names()));
+  ASSERT_OK_AND_ASSIGN(auto table, MakeScanner(written, options)->ToTable());
+  EXPECT_EQ(table->num_rows(), 16);
+}
+
+TEST_F(TestIpcFileFormat, ScanBatchesSorted) {
+  auto sorted_schema = schema({field("ts", int64()), field("file", utf8())});
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (auto json : {R"([[1, "a"], [4, "a"], [4, "a"], [9, "a"], [null, "a"]])",
+                    R"([[2, "b"], [4, "b"], [7, "b"]])", R"([])",
+                    R"([[0, "d"], [4, "d"], [10, "d"]])"}) {
+    auto buffer = Write(*TableFromJSON(sorted_schema, {json}));
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+    fragments.push_back(std::move(fragment));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dataset,
+                       FileSystemDataset::Make(sorted_schema, literal(true), format_,
+                                               nullptr, fragments,
+                                               {compute::SortKey("ts")}));
+
+  for (bool use_async : {false, true}) {
+    ScannerBuilder builder(dataset);
+    ASSERT_OK(builder.UseAsync(use_async));
+    ASSERT_OK(builder.BatchSize(4));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner->ScanBatchesSorted());
+    ASSERT_OK_AND_ASSIGN(auto batches, batch_it.ToVector());
+    for (const auto& batch : batches) {
+      EXPECT_LE(batch->num_rows(), 4);
+    }
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(sorted_schema, batches));
+    // equal keys keep fragment order
+    AssertTablesEqual(*TableFromJSON(sorted_schema, {R"([
+      [0, "d"], [1, "a"], [2, "b"], [4, "a"], [4, "a"], [4, "b"], [4, "d"],
+      [7, "b"], [9, "a"], [10, "d"], [null, "a"]
+    ])"}),
+                      *table, /*same_chunk_layout=*/false);
+  }
+
+  // stop after the first rows matching a filter
+  ScannerBuilder builder(dataset);
+  ASSERT_OK(builder.Filter(greater(field_ref("ts"), literal(int64_t(3)))));
+  ASSERT_OK(builder.BatchSize(2));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto batch_it, scanner->ScanBatchesSorted());
+  ASSERT_OK_AND_ASSIGN(auto batch, batch_it.Next());
+  AssertBatchesEqual(*RecordBatchFromJSON(sorted_schema, R"([[4, "a"], [4, "a"]])"),
+                     *batch);
+
+  // sort keys must be projected
+  ASSERT_OK(builder.Project({"file"}));
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_RAISES(Invalid, scanner->ScanBatchesSorted());
+}
+
+TEST_F(TestIpcFileFormat, PredicatePushdown) {
+  auto schema = arrow::schema({field("ts", int64()), field("file", utf8())});
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema, options));
+  for (auto json : {R"([[1, "a"], [3, "a"]])", R"([[5, "b"], [8, "b"]])",
+                    R"([[null, "c"]])"}) {
+    ASSERT_OK(writer->WriteRecordBatch(*RecordBatchFromJSON(schema, json)));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(schema->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto CheckScannedBatches = [&](Expression filter,
+                                 std::vector<std::string> expected_batches) {
+    ASSERT_OK_AND_ASSIGN(opts_->filter, filter.Bind(*opts_->dataset_schema));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      batches.push_back(std::move(batch));
+    }
+    ASSERT_EQ(batches.size(), expected_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*RecordBatchFromJSON(schema, expected_batches[i]),
+                         *batches[i]);
+    }
+  };
+
+  CheckScannedBatches(literal(true), {R"([[1, "a"], [3, "a"]])",
+                                      R"([[5, "b"], [8, "b"]])", R"([[null, "c"]])"});
+  // The last batch is skipped as well since all its values are null
+  CheckScannedBatches(greater(field_ref("ts"), literal(int64_t(4))),
+                      {R"([[5, "b"], [8, "b"]])"});
+  CheckScannedBatches(equal(field_ref("file"), literal("a")),
+                      {R"([[1, "a"], [3, "a"]])"});
+  CheckScannedBatches(less(field_ref("ts"), literal(int64_t(0))), {});
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
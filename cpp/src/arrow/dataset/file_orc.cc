@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::ORCFileWriter;
+using adapters::orc::StripeColumnStatistics;
+
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+static inline Result<std::unique_ptr<ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+// The names of the top-level fields of the file which are referenced by the scan,
+// in file order
+static inline Result<std::vector<std::string>> GetIncludedFields(
+    const Schema& schema, const std::vector<std::string>& materialized_fields) {
+  std::set<int> included_indices;
+  for (FieldRef ref : materialized_fields) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.indices().empty()) continue;
+
+    included_indices.insert(match.indices()[0]);
+  }
+
+  std::vector<std::string> included_fields;
+  for (int i : included_indices) {
+    included_fields.push_back(schema.field(i)->name());
+  }
+  return included_fields;
+}
+
+// Derive an expression which holds for all the rows of a stripe from the
+// statistics of one of its columns, as is done for Parquet row groups
+static util::optional<Expression> ColumnStatisticsAsExpression(
+    const Field& field, const StripeColumnStatistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return equal(std::move(field_expr), literal(MakeNullScalar(field.type())));
+  }
+
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return util::nullopt;
+  }
+  return and_(greater_equal(field_expr, literal(statistics.min)),
+              less_equal(field_expr, literal(statistics.max)));
+}
+
+// Select the stripes of the file which may contain rows satisfying the filter,
+// according to the stripe statistics (if any)
+static Result<std::vector<int64_t>> SelectStripes(ORCFileReader* reader,
+                                                  const Schema& schema,
+                                                  const Expression& filter) {
+  std::unordered_set<int> filtered_fields;
+  for (const FieldRef& ref : FieldsInExpression(filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.empty()) continue;
+    filtered_fields.insert(match[0]);
+  }
+
+  std::vector<int64_t> stripes;
+  const int64_t num_stripes = reader->NumberOfStripes();
+  for (int64_t stripe = 0; stripe < num_stripes; ++stripe) {
+    if (filtered_fields.empty()) {
+      stripes.push_back(stripe);
+      continue;
+    }
+
+    std::vector<std::shared_ptr<StripeColumnStatistics>> statistics;
+    RETURN_NOT_OK(reader->ReadStripeStatistics(stripe, &statistics));
+
+    std::vector<Expression> guarantees;
+    for (int i : filtered_fields) {
+      if (const auto& column_statistics = statistics[i]) {
+        if (auto guarantee =
+                ColumnStatisticsAsExpression(*schema.field(i), *column_statistics)) {
+          guarantees.push_back(std::move(*guarantee));
+        }
+      }
+    }
+    if (!guarantees.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto guarantee, and_(guarantees).Bind(schema));
+      ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(filter, guarantee));
+      if (!simplified.IsSatisfiable()) continue;
+    }
+    stripes.push_back(stripe);
+  }
+  return stripes;
+}
+
+/// \brief A ScanTask reading a single stripe of an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(std::shared_ptr<FileFragment> fragment,
+              std::shared_ptr<ScanOptions> options, int64_t stripe,
+              std::vector<std::string> included_fields)
+      : ScanTask(std::move(options), fragment),
+        source_(fragment->source()),
+        stripe_(stripe),
+        included_fields_(std::move(included_fields)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Each task has its own reader, so that stripes can be read concurrently
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, options_->pool));
+
+    std::shared_ptr<RecordBatch> batch;
+    if (included_fields_.empty()) {
+      // No field is referenced (e.g. when counting rows), but the number of
+      // rows is still needed: read the first field and drop it.
+      std::shared_ptr<Schema> file_schema;
+      RETURN_NOT_OK(reader->ReadSchema(&file_schema));
+      if (file_schema->num_fields() == 0) {
+        return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+      }
+      RETURN_NOT_OK(reader->ReadStripe(stripe_, {file_schema->field(0)->name()}, &batch));
+      batch = RecordBatch::Make(schema({}), batch->num_rows(), ArrayVector{});
+    } else {
+      RETURN_NOT_OK(reader->ReadStripe(stripe_, included_fields_, &batch));
+    }
+
+    // A stripe is read in one go, then sliced to the requested batch size
+    RecordBatchVector batches;
+    const int64_t batch_size = options_->batch_size;
+    for (int64_t offset = 0; offset < batch->num_rows(); offset += batch_size) {
+      batches.push_back(batch->Slice(offset, batch_size));
+    }
+    return MakeVectorIterator(std::move(batches));
+  }
+
+ private:
+  FileSource source_;
+  int64_t stripe_;
+  std::vector<std::string> included_fields_;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    std::shared_ptr<ScanOptions> options,
+    const std::shared_ptr<FileFragment>& fragment) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(fragment->source(), options->pool));
+  std::shared_ptr<Schema> file_schema;
+  RETURN_NOT_OK(reader->ReadSchema(&file_schema));
+
+  ARROW_ASSIGN_OR_RAISE(auto included_fields,
+                        GetIncludedFields(*file_schema, options->MaterializedFields()));
+
+  // Skip the stripes whose statistics rule out the filter
+  ARROW_ASSIGN_OR_RAISE(auto stripes,
+                        SelectStripes(reader.get(), *file_schema, options->filter));
+
+  ScanTaskVector tasks;
+  for (int64_t stripe : stripes) {
+    tasks.push_back(
+        std::make_shared<OrcScanTask>(fragment, options, stripe, included_fields));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+//
+// OrcFileWriter, OrcFileWriteOptions
+//
+
+std::shared_ptr<FileWriteOptions> OrcFileFormat::DefaultWriteOptions() {
+  std::shared_ptr<OrcFileWriteOptions> orc_options(
+      new OrcFileWriteOptions(shared_from_this()));
+
+  orc_options->options = std::make_shared<adapters::orc::WriteOptions>(
+      adapters::orc::WriteOptions::Defaults());
+  return orc_options;
+}
+
+Result<std::shared_ptr<FileWriter>> OrcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options) const {
+  if (!Equals(*options->format())) {
+    return Status::TypeError("Mismatching format/write options.");
+  }
+
+  auto orc_options = checked_pointer_cast<OrcFileWriteOptions>(options);
+
+  // override use_threads to avoid nested parallelism
+  adapters::orc::WriteOptions writer_options = *orc_options->options;
+  writer_options.use_threads = false;
+
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ORCFileWriter::Open(schema, destination.get(), writer_options));
+
+  return std::shared_ptr<FileWriter>(
+      new OrcFileWriter(std::move(destination), std::move(writer), std::move(schema),
+                        std::move(orc_options)));
+}
+
+OrcFileWriter::OrcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                             std::unique_ptr<ORCFileWriter> writer,
+                             std::shared_ptr<Schema> schema,
+                             std::shared_ptr<OrcFileWriteOptions> options)
+    : FileWriter(std::move(schema), std::move(options), std::move(destination)),
+      orc_writer_(std::move(writer)) {}
+
+Status OrcFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return orc_writer_->Write(*batch);
+}
+
+Status OrcFileWriter::FinishInternal() { return orc_writer_->Close(); }
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr char kOrcTypeName[] = "orc";
+
+/// \brief A FileFormat implementation that reads from ORC files
+///
+/// Each stripe of a file is read by a separate ScanTask, so that the stripes
+/// of a file may be read concurrently.  Only the fields referenced by the scan
+/// are read.  When scanning with a filter, stripes are skipped according to
+/// the column statistics found in the file, see
+/// adapters::orc::ORCFileReader::ReadStripeStatistics.
+///
+/// Files are written with adapters::orc::ORCFileWriter, see OrcFileWriteOptions.
+class ARROW_DS_EXPORT OrcFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return kOrcTypeName; }
+
+  bool Equals(const FileFormat& other) const override {
+    return type_name() == other.type_name();
+  }
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(
+      std::shared_ptr<ScanOptions> options,
+      const std::shared_ptr<FileFragment>& fragment) const override;
+
+  Result<std::shared_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options) const override;
+
+  std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
+};
+
+class ARROW_DS_EXPORT OrcFileWriteOptions : public FileWriteOptions {
+ public:
+  /// Options passed to adapters::orc::ORCFileWriter::Open. use_threads is ignored
+  std::shared_ptr<adapters::orc::WriteOptions> options;
+
+ protected:
+  using FileWriteOptions::FileWriteOptions;
+
+  friend class OrcFileFormat;
+};
+
+class ARROW_DS_EXPORT OrcFileWriter : public FileWriter {
+ public:
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  OrcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::unique_ptr<adapters::orc::ORCFileWriter> writer,
+                std::shared_ptr<Schema> schema,
+                std::shared_ptr<OrcFileWriteOptions> options);
+
+  Status FinishInternal() override;
+
+  std::unique_ptr<adapters::orc::ORCFileWriter> orc_writer_;
+
+  friend class OrcFileFormat;
+};
+
+}  // namespace dataset
+}  // namespace arrow
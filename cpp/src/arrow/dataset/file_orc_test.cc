@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <orc/OrcFile.hh>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/scanner_internal.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/optional.h"
+
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_pointer_cast;
+
+class OrcMemoryOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 1024; }
+
+  void write(const void* buf, size_t size) override {
+    data_.append(reinterpret_cast<const char*>(buf), size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  const std::string& data() const { return data_; }
+
+ private:
+  std::string data_;
+  std::string name_ = "OrcMemoryOutputStream";
+};
+
+// A stripe of an ORC file with a "ts" bigint column and a "file" string column
+struct OrcStripe {
+  std::vector<util::optional<int64_t>> ts;
+  std::vector<std::string> file;
+};
+
+// Write an ORC file with one stripe per OrcStripe
+std::shared_ptr<Buffer> WriteOrcFile(const std::vector<OrcStripe>& stripes) {
+  OrcMemoryOutputStream stream;
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<ts:bigint,file:string>"));
+  liborc::WriterOptions options;
+  // Flush a stripe after each added batch
+  options.setStripeSize(1);
+  options.setMemoryPool(liborc::getDefaultPool());
+  auto writer = liborc::createWriter(*type, &stream, options);
+
+  for (const auto& stripe : stripes) {
+    const uint64_t num_rows = stripe.ts.size();
+    auto batch = writer->createRowBatch(num_rows);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto ts_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto file_batch = dynamic_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+    for (uint64_t i = 0; i < num_rows; ++i) {
+      ts_batch->notNull[i] = stripe.ts[i].has_value();
+      ts_batch->hasNulls |= !stripe.ts[i].has_value();
+      ts_batch->data[i] = stripe.ts[i].value_or(0);
+      file_batch->data[i] = const_cast<char*>(stripe.file[i].data());
+      file_batch->length[i] = static_cast<int64_t>(stripe.file[i].size());
+    }
+    struct_batch->numElements = ts_batch->numElements = file_batch->numElements =
+        num_rows;
+    writer->add(*batch);
+  }
+  writer->close();
+  return Buffer::FromString(stream.data());
+}
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  void SetUp() override {
+    buffer_ = WriteOrcFile({{{1, 3}, {"a", "a"}},
+                            {{5, 8}, {"b", "b"}},
+                            {{util::nullopt}, {"c"}}});
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_));
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  void SetSchema(std::vector<std::shared_ptr<Field>> fields) {
+    opts_ = std::make_shared<ScanOptions>();
+    opts_->dataset_schema = schema(std::move(fields));
+    ASSERT_OK(SetProjection(opts_.get(), opts_->dataset_schema->field_names()));
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("ts", int64()), field("file", utf8())});
+  std::shared_ptr<Buffer> buffer_;
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+};
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(FileSource(buffer_)));
+  AssertSchemaEqual(*schema_, *actual, /*check_metadata=*/false);
+}
+
+TEST_F(TestOrcFileFormat, IsSupported) {
+  ASSERT_OK_AND_ASSIGN(bool supported, format_->IsSupported(FileSource(buffer_)));
+  ASSERT_TRUE(supported);
+
+  auto not_orc = std::make_shared<Buffer>(util::string_view("not an ORC file"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(not_orc)));
+  ASSERT_FALSE(supported);
+}
+
+TEST_F(TestOrcFileFormat, ScanStripes) {
+  SetSchema(schema_->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer_)));
+
+  // One scan task per stripe, each yielding batches of at most batch_size rows
+  opts_->batch_size = 1;
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+  ASSERT_EQ(scan_tasks.size(), 3);
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    ASSERT_EQ(batch->num_rows(), 1);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 5);
+}
+
+TEST_F(TestOrcFileFormat, ScanProjected) {
+  SetSchema(schema_->fields());
+  ASSERT_OK(SetProjection(opts_.get(), {"file"}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer_)));
+
+  auto expected_schema = schema({field("file", utf8())});
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*batch->schema(), *expected_schema, /*check_metadata=*/false);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 5);
+}
+
+TEST_F(TestOrcFileFormat, PredicatePushdown) {
+  SetSchema(schema_->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer_)));
+
+  auto CheckScannedBatches = [&](Expression filter,
+                                 std::vector<std::string> expected_batches) {
+    ASSERT_OK_AND_ASSIGN(opts_->filter, filter.Bind(*opts_->dataset_schema));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      batches.push_back(std::move(batch));
+    }
+    ASSERT_EQ(batches.size(), expected_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*RecordBatchFromJSON(schema_, expected_batches[i]),
+                         *batches[i]);
+    }
+  };
+
+  CheckScannedBatches(literal(true), {R"([[1, "a"], [3, "a"]])",
+                                      R"([[5, "b"], [8, "b"]])", R"([[null, "c"]])"});
+  // The last stripe is skipped as well since all its values are null
+  CheckScannedBatches(greater(field_ref("ts"), literal(int64_t(4))),
+                      {R"([[5, "b"], [8, "b"]])"});
+  CheckScannedBatches(equal(field_ref("file"), literal("a")),
+                      {R"([[1, "a"], [3, "a"]])"});
+  CheckScannedBatches(less(field_ref("ts"), literal(int64_t(0))), {});
+}
+
+TEST_F(TestOrcFileFormat, WriteRecordBatchReader) {
+  auto batch = RecordBatchFromJSON(schema_, R"([[1, "a"], [null, "b"], [3, null]])");
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+
+  auto options = format_->DefaultWriteOptions();
+  ASSERT_OK_AND_ASSIGN(auto writer, format_->MakeWriter(sink, schema_, options));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  SetSchema(schema_->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(written)));
+  ASSERT_OK_AND_ASSIGN(auto batches, Batches(fragment.get()).ToVector());
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(*batch, *batches[0]);
+}
+
+TEST_F(TestOrcFileFormat, WriteRecordBatchReaderCustomOptions) {
+  auto orc_options =
+      checked_pointer_cast<OrcFileWriteOptions>(format_->DefaultWriteOptions());
+  orc_options->options->compression = Compression::GZIP;
+  orc_options->options->batch_size = 2;
+
+  auto batch = RecordBatchFromJSON(schema_, R"([[1, "a"], [2, "b"], [3, "c"]])");
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, format_->MakeWriter(sink, schema_, orc_options));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(FileSource(written)));
+  AssertSchemaEqual(*schema_, *actual, /*check_metadata=*/false);
+
+  orc_options->options->compression = Compression::BROTLI;
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create());
+  ASSERT_RAISES(Invalid, format_->MakeWriter(sink, schema_, orc_options));
+}
+
+class TestOrcFileSystemDataset : public testing::Test,
+                                 public WriteFileSystemDatasetMixin {
+ public:
+  void SetUp() override {
+    MakeSourceDataset();
+    auto orc_format = std::make_shared<OrcFileFormat>();
+    format_ = orc_format;
+    SetWriteOptions(orc_format->DefaultWriteOptions());
+  }
+};
+
+TEST_F(TestOrcFileSystemDataset, WriteWithIdenticalPartitioningSchema) {
+  TestWriteWithIdenticalPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithUnrelatedPartitioningSchema) {
+  TestWriteWithUnrelatedPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithSupersetPartitioningSchema) {
+  TestWriteWithSupersetPartitioningSchema();
+}
+
+TEST_F(TestOrcFileSystemDataset, WriteWithEmptyPartitioningSchema) {
+  TestWriteWithEmptyPartitioningSchema();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,14 +17,24 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
@@ -33,10 +43,13 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/tracing_internal.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -52,9 +65,14 @@ using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
+///
+/// If late_column_projection is not empty, the columns in column_projection are the
+/// ones referenced by the filter. They are decoded first and the late columns are
+/// only decoded if any row of the row group passes the filter.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  std::vector<int> late_column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<std::once_flag> pre_buffer_once,
                   std::vector<int> pre_buffer_row_groups, arrow::io::IOContext io_context,
@@ -64,6 +82,7 @@ class ParquetScanTask : public ScanTask {
       : ScanTask(std::move(options), std::move(fragment)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
+        late_column_projection_(std::move(late_column_projection)),
         reader_(std::move(reader)),
         pre_buffer_once_(std::move(pre_buffer_once)),
         pre_buffer_row_groups_(std::move(pre_buffer_row_groups)),
@@ -88,6 +107,10 @@ class ParquetScanTask : public ScanTask {
       std::unique_ptr<RecordBatchReader> record_batch_reader;
     } NextBatch;
 
+    if (!late_column_projection_.empty()) {
+      return ExecuteLateMaterialized();
+    }
+
     RETURN_NOT_OK(EnsurePreBuffered());
     NextBatch.file_reader = reader_;
     RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
@@ -95,6 +118,82 @@ class ParquetScanTask : public ScanTask {
     return MakeFunctionIterator(std::move(NextBatch));
   }
 
+  Result<RecordBatchIterator> ExecuteLateMaterialized() {
+    RETURN_NOT_OK(EnsurePreBuffered());
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto filter, SimplifyWithGuarantee(options_->filter,
+                                           fragment_->partition_expression()));
+    compute::ExecContext exec_context{options_->pool};
+
+    // Phase one: decode the filter columns and evaluate the filter on them.
+    std::unique_ptr<RecordBatchReader> filter_reader;
+    RETURN_NOT_OK(
+        reader_->GetRecordBatchReader({row_group_}, column_projection_, &filter_reader));
+
+    RecordBatchVector filter_batches;
+    std::vector<Datum> masks;
+    // One past the last batch with any row passing the filter
+    size_t end = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, filter_reader->Next());
+      if (batch == nullptr) break;
+
+      ARROW_ASSIGN_OR_RAISE(Datum mask,
+                            ExecuteScalarExpression(filter, Datum(batch), &exec_context));
+      bool any_selected;
+      if (mask.is_scalar()) {
+        const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+        any_selected = mask_scalar.is_valid && mask_scalar.value;
+      } else {
+        any_selected = mask.array_as<BooleanArray>()->true_count() > 0;
+      }
+
+      filter_batches.push_back(std::move(batch));
+      masks.push_back(any_selected ? std::move(mask) : Datum());
+      if (any_selected) end = filter_batches.size();
+    }
+
+    if (end == 0) {
+      // No row passes the filter, so the remaining columns needn't be decoded at all.
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    // Phase two: decode the remaining columns up to the last batch with rows passing
+    // the filter. Both readers use the same batch size so their batches line up.
+    std::unique_ptr<RecordBatchReader> late_reader;
+    RETURN_NOT_OK(
+        reader_->GetRecordBatchReader({row_group_}, late_column_projection_, &late_reader));
+
+    RecordBatchVector out;
+    for (size_t i = 0; i < end; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto late_batch, late_reader->Next());
+      if (late_batch == nullptr ||
+          late_batch->num_rows() != filter_batches[i]->num_rows()) {
+        return Status::Invalid("Parquet row group ", row_group_,
+                               " yielded misaligned batches for late materialization");
+      }
+      if (masks[i].kind() == Datum::NONE) continue;
+
+      auto batch = filter_batches[i];
+      for (int j = 0; j < late_batch->num_columns(); ++j) {
+        ARROW_ASSIGN_OR_RAISE(batch, batch->AddColumn(batch->num_columns(),
+                                                      late_batch->schema()->field(j),
+                                                      late_batch->column(j)));
+      }
+
+      if (masks[i].is_array()) {
+        ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                              compute::Filter(batch, masks[i],
+                                              compute::FilterOptions::Defaults(),
+                                              &exec_context));
+        batch = filtered.record_batch();
+      }
+      out.push_back(std::move(batch));
+    }
+    return MakeVectorIterator(std::move(out));
+  }
+
   // Ensure that pre-buffering has been applied to the underlying Parquet reader
   // exactly once (if needed). If we instead set pre_buffer on in the Arrow
   // reader properties, each scan task will try to separately pre-buffer, which
@@ -118,6 +217,7 @@ class ParquetScanTask : public ScanTask {
  private:
   int row_group_;
   std::vector<int> column_projection_;
+  std::vector<int> late_column_projection_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
   // Pre-buffering state. pre_buffer_once will be nullptr if no pre-buffering is
   // to be done. We assume all scan tasks have the same column projection.
@@ -138,6 +238,8 @@ static parquet::ReaderProperties MakeReaderProperties(
     properties.disable_buffered_stream();
   }
   properties.set_buffer_size(parquet_scan_options->reader_properties->buffer_size());
+  properties.set_footer_read_size(
+      parquet_scan_options->reader_properties->footer_read_size());
   properties.file_decryption_properties(
       parquet_scan_options->reader_properties->file_decryption_properties());
   return properties;
@@ -163,6 +265,24 @@ static Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
+static util::optional<Expression> MinMaxAsExpression(
+    const Field& field, const parquet::Statistics& statistics) {
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
+    return util::nullopt;
+  }
+
+  auto maybe_min = min->CastTo(field.type());
+  auto maybe_max = max->CastTo(field.type());
+  if (maybe_min.ok() && maybe_max.ok()) {
+    auto field_expr = field_ref(field.name());
+    return and_(greater_equal(field_expr, literal(maybe_min.MoveValueUnsafe())),
+                less_equal(field_expr, literal(maybe_max.MoveValueUnsafe())));
+  }
+
+  return util::nullopt;
+}
+
 static util::optional<Expression> ColumnChunkStatisticsAsExpression(
     const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
   // For the remaining of this function, failure to extract/parse statistics
@@ -182,30 +302,301 @@ static util::optional<Expression> ColumnChunkStatisticsAsExpression(
   }
 
   const auto& field = schema_field.field;
-  auto field_expr = field_ref(field->name());
 
   // Optimize for corner case where all values are nulls
   if (statistics->num_values() == statistics->null_count()) {
-    return equal(std::move(field_expr), literal(MakeNullScalar(field->type())));
+    return equal(field_ref(field->name()), literal(MakeNullScalar(field->type())));
   }
 
-  std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
-    return util::nullopt;
+  return MinMaxAsExpression(*field, *statistics);
+}
+
+using ColumnStatisticsExpressions = std::vector<util::optional<Expression>>;
+
+// Derive the statistics expressions of a column in each of the given row groups, bound
+// to the physical schema. The result is indexed by row group.
+static Result<ColumnStatisticsExpressions> ColumnStatisticsAsExpressions(
+    const SchemaField& schema_field, const parquet::FileMetaData& metadata,
+    const std::vector<int>& row_groups, const Schema& physical_schema) {
+  ColumnStatisticsExpressions expressions(metadata.num_row_groups());
+  for (int row_group : row_groups) {
+    auto row_group_metadata = metadata.RowGroup(row_group);
+    if (auto minmax =
+            ColumnChunkStatisticsAsExpression(schema_field, *row_group_metadata)) {
+      ARROW_ASSIGN_OR_RAISE(expressions[row_group], minmax->Bind(physical_schema));
+    }
   }
+  return expressions;
+}
 
-  auto maybe_min = min->CastTo(field->type());
-  auto maybe_max = max->CastTo(field->type());
-  if (maybe_min.ok() && maybe_max.ok()) {
-    min = maybe_min.MoveValueUnsafe();
-    max = maybe_max.MoveValueUnsafe();
-    return and_(greater_equal(field_expr, literal(min)),
-                less_equal(field_expr, literal(max)));
+// The pages of one column chunk, as (first row, guarantee) pairs
+using PageGuarantees = std::vector<std::pair<int64_t, Expression>>;
+
+static PageGuarantees PageIndexAsGuarantees(const SchemaField& schema_field,
+                                            int64_t num_rows,
+                                            const parquet::ColumnIndex& column_index,
+                                            const parquet::OffsetIndex& offset_index) {
+  const auto& field = schema_field.field;
+  PageGuarantees pages;
+  if (column_index.num_pages() != offset_index.num_pages()) return pages;
+
+  for (int i = 0; i < offset_index.num_pages(); ++i) {
+    const int64_t first_row = offset_index.page_locations()[i].first_row_index;
+    if (column_index.null_pages()[i]) {
+      pages.emplace_back(first_row, equal(field_ref(field->name()),
+                                          literal(MakeNullScalar(field->type()))));
+      continue;
+    }
+    int64_t num_values = offset_index.num_rows(i, num_rows);
+    if (column_index.has_null_counts()) num_values -= column_index.null_counts()[i];
+    auto statistics = column_index.page_statistics(i, num_values);
+    auto minmax = MinMaxAsExpression(*field, *statistics);
+    pages.emplace_back(first_row, minmax ? *minmax : literal(true));
+  }
+  return pages;
+}
+
+// Exclude row groups in which no row can satisfy the predicate according to the page
+// indexes of the columns it references: the rows of a row group are split into
+// segments where each such column stays within one page, and the predicate is
+// simplified against the statistics of those pages. This is tighter than the column
+// chunk statistics when the values of a chunk have gaps, e.g. for clustered columns.
+static Result<std::vector<int>> FilterRowGroupsByPageIndex(
+    const Expression& predicate, parquet::ParquetFileReader* reader,
+    const SchemaManifest& manifest, const Schema& physical_schema,
+    std::vector<int> row_groups) {
+  std::vector<const SchemaField*> schema_fields;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+    const SchemaField& schema_field = manifest.schema_fields[match[0]];
+    // Rows only match pages for non-repeated leaves
+    if (!schema_field.is_leaf() || schema_field.level_info.rep_level > 0) continue;
+    schema_fields.push_back(&schema_field);
+  }
+  if (schema_fields.empty()) return row_groups;
+
+  std::vector<int> filtered;
+  for (int row_group : row_groups) {
+    std::vector<PageGuarantees> columns;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    auto row_group_reader = reader->RowGroup(row_group);
+    const int64_t num_rows = row_group_reader->metadata()->num_rows();
+    for (const SchemaField* schema_field : schema_fields) {
+      auto column_index = row_group_reader->GetColumnIndex(schema_field->column_index);
+      auto offset_index = row_group_reader->GetOffsetIndex(schema_field->column_index);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+      auto pages =
+          PageIndexAsGuarantees(*schema_field, num_rows, *column_index, *offset_index);
+      if (!pages.empty()) columns.push_back(std::move(pages));
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+
+    bool satisfiable = columns.empty();
+    std::vector<size_t> current(columns.size(), 0);
+    int64_t segment_start = 0;
+    while (!satisfiable) {
+      // Guarantee of the segment starting at segment_start, and where it ends
+      Expression guarantee = literal(true);
+      int64_t segment_end = std::numeric_limits<int64_t>::max();
+      for (size_t c = 0; c < columns.size(); ++c) {
+        const auto& pages = columns[c];
+        while (current[c] + 1 < pages.size() &&
+               pages[current[c] + 1].first <= segment_start) {
+          ++current[c];
+        }
+        guarantee = guarantee == literal(true)
+                        ? pages[current[c]].second
+                        : and_(std::move(guarantee), pages[current[c]].second);
+        if (current[c] + 1 < pages.size()) {
+          segment_end = std::min(segment_end, pages[current[c] + 1].first);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(predicate, guarantee));
+      satisfiable = simplified.IsSatisfiable();
+      if (segment_end == std::numeric_limits<int64_t>::max()) break;
+      segment_start = segment_end;
+    }
+    if (satisfiable) filtered.push_back(row_group);
   }
+  return filtered;
+}
 
+// Hash a value the way the writer hashed the physical value it stored for it, if
+// that is unambiguous. Floating point zeros and NaNs are not: equal values may have
+// been written with different bit patterns.
+static util::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& filter,
+                                                parquet::Type::type physical_type,
+                                                const Scalar& scalar) {
+  if (!scalar.is_valid) return util::nullopt;
+  auto Int32Hash = [&](int32_t value) -> util::optional<uint64_t> {
+    if (physical_type != parquet::Type::INT32) return util::nullopt;
+    return filter.Hash(value);
+  };
+  auto Int64Hash = [&](int64_t value) -> util::optional<uint64_t> {
+    if (physical_type != parquet::Type::INT64) return util::nullopt;
+    return filter.Hash(value);
+  };
+  switch (scalar.type->id()) {
+    case Type::INT8:
+      return Int32Hash(checked_cast<const Int8Scalar&>(scalar).value);
+    case Type::INT16:
+      return Int32Hash(checked_cast<const Int16Scalar&>(scalar).value);
+    case Type::INT32:
+      return Int32Hash(checked_cast<const Int32Scalar&>(scalar).value);
+    case Type::UINT8:
+      return Int32Hash(checked_cast<const UInt8Scalar&>(scalar).value);
+    case Type::UINT16:
+      return Int32Hash(checked_cast<const UInt16Scalar&>(scalar).value);
+    case Type::UINT32:
+      return Int32Hash(
+          static_cast<int32_t>(checked_cast<const UInt32Scalar&>(scalar).value));
+    case Type::DATE32:
+      return Int32Hash(checked_cast<const Date32Scalar&>(scalar).value);
+    case Type::INT64:
+      return Int64Hash(checked_cast<const Int64Scalar&>(scalar).value);
+    case Type::UINT64:
+      return Int64Hash(
+          static_cast<int64_t>(checked_cast<const UInt64Scalar&>(scalar).value));
+    case Type::FLOAT: {
+      const float value = checked_cast<const FloatScalar&>(scalar).value;
+      if (physical_type != parquet::Type::FLOAT || value == 0 || std::isnan(value)) {
+        return util::nullopt;
+      }
+      return filter.Hash(value);
+    }
+    case Type::DOUBLE: {
+      const double value = checked_cast<const DoubleScalar&>(scalar).value;
+      if (physical_type != parquet::Type::DOUBLE || value == 0 || std::isnan(value)) {
+        return util::nullopt;
+      }
+      return filter.Hash(value);
+    }
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return util::nullopt;
+      const parquet::ByteArray value(
+          util::string_view(*checked_cast<const BaseBinaryScalar&>(scalar).value));
+      return filter.Hash(&value);
+    }
+    default:
+      break;
+  }
   return util::nullopt;
 }
 
+// The values which a conjunction member of the predicate requires a column to hold
+// one of, for `equal(field, literal)` and `is_in(field, value_set)`
+struct BloomFilterLookup {
+  const SchemaField* schema_field;
+  std::vector<std::shared_ptr<Scalar>> values;
+};
+
+static Result<std::vector<BloomFilterLookup>> GetBloomFilterLookups(
+    const Expression& predicate, const SchemaManifest& manifest,
+    const Schema& physical_schema) {
+  std::vector<Expression> conjunction_members;
+  auto call = predicate.call();
+  if (call && call->function_name == "and_kleene") {
+    conjunction_members = FlattenedAssociativeChain(predicate).fringe;
+  } else {
+    conjunction_members = {predicate};
+  }
+
+  std::vector<BloomFilterLookup> lookups;
+  for (const Expression& member : conjunction_members) {
+    call = member.call();
+    if (!call) continue;
+
+    const FieldRef* ref = nullptr;
+    std::vector<std::shared_ptr<Scalar>> values;
+    if (call->function_name == "equal") {
+      const Datum* lit = nullptr;
+      for (int i = 0; i < 2; ++i) {
+        if (call->arguments[i].field_ref() && call->arguments[1 - i].literal()) {
+          ref = call->arguments[i].field_ref();
+          lit = call->arguments[1 - i].literal();
+        }
+      }
+      if (ref == nullptr || !lit->is_scalar()) continue;
+      values.push_back(lit->scalar());
+    } else if (call->function_name == "is_in") {
+      auto options = GetSetLookupOptions(*call);
+      ref = call->arguments[0].field_ref();
+      if (ref == nullptr || !options->value_set.is_arraylike()) continue;
+      auto value_set = options->value_set.make_array();
+      // Nulls may match null rows, which the bloom filter doesn't record
+      if (value_set->null_count() > 0) continue;
+      for (int64_t i = 0; i < value_set->length(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto value, value_set->GetScalar(i));
+        values.push_back(std::move(value));
+      }
+    } else {
+      continue;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto match, ref->FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+    const SchemaField& schema_field = manifest.schema_fields[match[0]];
+    if (!schema_field.is_leaf()) continue;
+    // The values must be of the column's type, so that they hash like its values
+    const bool same_type =
+        std::all_of(values.begin(), values.end(), [&](const std::shared_ptr<Scalar>& v) {
+          return v->type->Equals(*schema_field.field->type());
+        });
+    if (!same_type) continue;
+    lookups.push_back({&schema_field, std::move(values)});
+  }
+  return lookups;
+}
+
+// Exclude row groups in which the bloom filter of a column shows that it holds none
+// of the values which the predicate requires it to hold.
+static Result<std::vector<int>> FilterRowGroupsByBloomFilter(
+    const Expression& predicate, parquet::ParquetFileReader* reader,
+    const SchemaManifest& manifest, const Schema& physical_schema,
+    std::vector<int> row_groups) {
+  ARROW_ASSIGN_OR_RAISE(auto lookups,
+                        GetBloomFilterLookups(predicate, manifest, physical_schema));
+  if (lookups.empty()) return row_groups;
+
+  std::vector<int> filtered;
+  for (int row_group : row_groups) {
+    bool satisfiable = true;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    auto row_group_reader = reader->RowGroup(row_group);
+    for (const BloomFilterLookup& lookup : lookups) {
+      const int column = lookup.schema_field->column_index;
+      if (!row_group_reader->metadata()->ColumnChunk(column)->has_bloom_filter()) {
+        continue;
+      }
+      auto bloom_filter = row_group_reader->GetColumnBloomFilter(column);
+      if (bloom_filter == nullptr) continue;
+      const auto physical_type =
+          reader->metadata()->schema()->Column(column)->physical_type();
+
+      bool might_contain = false;
+      for (const auto& value : lookup.values) {
+        auto hash = BloomFilterHash(*bloom_filter, physical_type, *value);
+        if (!hash || bloom_filter->FindHash(*hash)) {
+          might_contain = true;
+          break;
+        }
+      }
+      if (!might_contain) {
+        satisfiable = false;
+        break;
+      }
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    if (satisfiable) filtered.push_back(row_group);
+  }
+  return filtered;
+}
+
 static void AddColumnIndices(const SchemaField& schema_field,
                              std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -218,33 +609,97 @@ static void AddColumnIndices(const SchemaField& schema_field,
   }
 }
 
-// Compute the column projection out of an optional arrow::Schema
+// Add the leaves of the fields matching a reference given as a sequence of names. Only
+// the referenced children of a struct are read: the reader assembles the struct from
+// those of its leaves it is given.
+static void AddColumnIndices(const std::vector<SchemaField>& schema_fields,
+                             const std::vector<std::string>& names, size_t depth,
+                             std::vector<int>* column_projection) {
+  for (const auto& schema_field : schema_fields) {
+    if (schema_field.field->name() != names[depth]) continue;
+    if (depth + 1 == names.size() || schema_field.field->type()->id() != Type::STRUCT) {
+      AddColumnIndices(schema_field, column_projection);
+    } else {
+      AddColumnIndices(schema_field.children, names, depth + 1, column_projection);
+    }
+  }
+}
+
+// Compute the column projection out of the references to materialized fields
 static std::vector<int> InferColumnProjection(const parquet::arrow::FileReader& reader,
-                                              const ScanOptions& options) {
-  auto manifest = reader.manifest();
-  // Checks if the field is needed in either the projection or the filter.
-  auto field_names = options.MaterializedFields();
-  std::unordered_set<std::string> materialized_fields{field_names.cbegin(),
-                                                      field_names.cend()};
-  auto should_materialize_column = [&materialized_fields](const std::string& f) {
-    return materialized_fields.find(f) != materialized_fields.end();
-  };
+                                              const std::vector<FieldRef>& field_refs) {
+  const auto& manifest = reader.manifest();
 
   std::vector<int> columns_selection;
-  // Note that the loop is using the file's schema to iterate instead of the
-  // materialized fields of the ScanOptions. This ensures that missing
-  // fields in the file (but present in the ScanOptions) will be ignored. The
-  // scanner's projector will take care of padding the column with the proper
-  // values.
-  for (const auto& schema_field : manifest.schema_fields) {
-    if (should_materialize_column(schema_field.field->name())) {
-      AddColumnIndices(schema_field, &columns_selection);
+  // Note that the references are resolved against the file's schema manifest
+  // rather than the dataset's schema. This ensures that missing fields in the file
+  // (but present in the ScanOptions) will be ignored. The scanner's projector will
+  // take care of padding the column with the proper values.
+  for (const FieldRef& ref : field_refs) {
+    std::vector<std::string> names;
+    if (auto name = ref.name()) {
+      names.push_back(*name);
+    } else {
+      for (const FieldRef& nested_ref : *ref.nested_refs()) {
+        names.push_back(*nested_ref.name());
+      }
     }
+    AddColumnIndices(manifest.schema_fields, names, /*depth=*/0, &columns_selection);
   }
 
+  // Leaves referenced several times are read once, in the file's order
+  std::sort(columns_selection.begin(), columns_selection.end());
+  columns_selection.erase(std::unique(columns_selection.begin(), columns_selection.end()),
+                          columns_selection.end());
   return columns_selection;
 }
 
+static std::vector<int> InferColumnProjection(const parquet::arrow::FileReader& reader,
+                                              const ScanOptions& options) {
+  // Checks if the field is needed in either the projection or the filter.
+  return InferColumnProjection(reader, options.MaterializedFieldRefs());
+}
+
+// The top-level field a leaf column belongs to
+static const SchemaField* GetTopLevelField(const SchemaManifest& manifest,
+                                           int column_index) {
+  const SchemaField* field = nullptr;
+  if (!manifest.GetColumnField(column_index, &field).ok()) return nullptr;
+  while (auto parent = manifest.GetParent(field)) {
+    field = parent;
+  }
+  return field;
+}
+
+/// Split the columns to read into those referenced by the filter and the remaining
+/// projected ones.  Returns false if late materialization wouldn't save anything.
+static bool InferLateColumnProjection(const parquet::arrow::FileReader& reader,
+                                      const ScanOptions& options,
+                                      std::vector<int>* filter_columns,
+                                      std::vector<int>* late_columns) {
+  if (options.filter == literal(true)) return false;
+
+  *filter_columns = InferColumnProjection(reader, FieldsInExpression(options.filter));
+
+  // Each phase yields whole top-level columns, so the leaves of a struct which the
+  // filter reads some children of are all read in the first phase
+  std::unordered_set<const SchemaField*> filter_fields;
+  for (int i : *filter_columns) {
+    filter_fields.insert(GetTopLevelField(reader.manifest(), i));
+  }
+  std::vector<int> early_columns;
+  late_columns->clear();
+  for (int i : InferColumnProjection(reader, options)) {
+    if (filter_fields.count(GetTopLevelField(reader.manifest(), i)) == 0) {
+      late_columns->push_back(i);
+    } else {
+      early_columns.push_back(i);
+    }
+  }
+  *filter_columns = std::move(early_columns);
+  return !filter_columns->empty() && !late_columns->empty();
+}
+
 bool ParquetFileFormat::Equals(const FileFormat& other) const {
   if (other.type_name() != type_name()) return false;
 
@@ -292,6 +747,13 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 
 Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
     const FileSource& source, ScanOptions* options) const {
+  return GetReader(source, options, /*metadata=*/nullptr);
+}
+
+Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
+    const FileSource& source, ScanOptions* options,
+    std::shared_ptr<parquet::FileMetaData> metadata) const {
+  ARROW_TRACE_SPAN(span, "arrow::dataset::ParquetFileFormat::GetReader");
   ARROW_ASSIGN_OR_RAISE(auto parquet_scan_options,
                         GetFragmentScanOptions<ParquetFragmentScanOptions>(
                             kParquetTypeName, options, default_fragment_scan_options));
@@ -301,13 +763,14 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   std::unique_ptr<parquet::ParquetFileReader> reader;
   try {
-    reader = parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    reader = parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                              std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
   }
 
-  std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+  metadata = reader->metadata();
   auto arrow_properties = MakeArrowReaderProperties(*this, *metadata);
 
   if (options) {
@@ -338,16 +801,19 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
   // a FileReader, potentially avoiding IO altogether if all RowGroups are excluded due to
   // prior statistics knowledge. In the case where a RowGroup doesn't have statistics
   // metdata, it will not be excluded.
-  if (parquet_fragment->metadata() != nullptr) {
+  ARROW_ASSIGN_OR_RAISE(bool has_metadata, parquet_fragment->LookupCachedMetadata());
+  if (has_metadata) {
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
 
     pre_filtered = true;
-    if (row_groups.empty()) MakeEmpty();
+    if (row_groups.empty()) return MakeEmpty();
   }
 
-  // Open the reader and pay the real IO cost.
-  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<parquet::arrow::FileReader> reader,
-                        GetReader(fragment->source(), options.get()));
+  // Open the reader and pay the real IO cost. If the metadata came from a
+  // ParquetMetadataCache, it is the file's own and its footer needn't be read again.
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<parquet::arrow::FileReader> reader,
+      GetReader(fragment->source(), options.get(), parquet_fragment->cached_metadata()));
 
   // Ensure that parquet_fragment has FileMetaData
   RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata(reader.get()));
@@ -356,24 +822,64 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     // row groups were not already filtered; do this now
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
 
-    if (row_groups.empty()) MakeEmpty();
+    if (row_groups.empty()) return MakeEmpty();
   }
 
-  auto column_projection = InferColumnProjection(*reader, *options);
-  ScanTaskVector tasks(row_groups.size());
-
   ARROW_ASSIGN_OR_RAISE(
       auto parquet_scan_options,
       GetFragmentScanOptions<ParquetFragmentScanOptions>(kParquetTypeName, options.get(),
                                                          default_fragment_scan_options));
+
+  if (parquet_scan_options->use_page_index || parquet_scan_options->use_bloom_filter) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto predicate,
+        SimplifyWithGuarantee(options->filter, fragment->partition_expression()));
+    if (predicate != literal(true)) {
+      ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragment->ReadPhysicalSchema());
+      if (parquet_scan_options->use_page_index) {
+        ARROW_ASSIGN_OR_RAISE(row_groups,
+                              FilterRowGroupsByPageIndex(
+                                  predicate, reader->parquet_reader(), reader->manifest(),
+                                  *physical_schema, std::move(row_groups)));
+      }
+      if (parquet_scan_options->use_bloom_filter) {
+        ARROW_ASSIGN_OR_RAISE(row_groups,
+                              FilterRowGroupsByBloomFilter(
+                                  predicate, reader->parquet_reader(), reader->manifest(),
+                                  *physical_schema, std::move(row_groups)));
+      }
+      if (row_groups.empty()) return MakeEmpty();
+    }
+  }
+
+  std::vector<int> column_projection, late_column_projection;
+  if (!parquet_scan_options->late_materialization ||
+      !InferLateColumnProjection(*reader, *options, &column_projection,
+                                 &late_column_projection)) {
+    column_projection = InferColumnProjection(*reader, *options);
+    late_column_projection.clear();
+  }
+  ScanTaskVector tasks(row_groups.size());
   std::shared_ptr<std::once_flag> pre_buffer_once = nullptr;
   if (parquet_scan_options->arrow_reader_properties->pre_buffer()) {
     pre_buffer_once = std::make_shared<std::once_flag>();
+    if (parquet_scan_options->eager_pre_buffer) {
+      // Start the reads now; the scan tasks will find pre-buffering done
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      std::call_once(*pre_buffer_once, [&]() {
+        ARROW_UNUSED(reader->parquet_reader()->PreBuffer(
+            row_groups, column_projection,
+            parquet_scan_options->arrow_reader_properties->io_context(),
+            parquet_scan_options->arrow_reader_properties->cache_options()));
+      });
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
   }
 
   for (size_t i = 0; i < row_groups.size(); ++i) {
     tasks[i] = std::make_shared<ParquetScanTask>(
-        row_groups[i], column_projection, reader, pre_buffer_once, row_groups,
+        row_groups[i], column_projection, late_column_projection, reader, pre_buffer_once,
+        row_groups,
         parquet_scan_options->arrow_reader_properties->io_context(),
         parquet_scan_options->arrow_reader_properties->cache_options(), options,
         fragment);
@@ -382,6 +888,22 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
   return MakeVectorIterator(std::move(tasks));
 }
 
+Future<util::optional<int64_t>> ParquetFileFormat::CountRows(
+    const std::shared_ptr<FileFragment>& file, Expression predicate,
+    const std::shared_ptr<ScanOptions>& options) {
+  auto parquet_file = checked_pointer_cast<ParquetFileFragment>(file);
+  auto count_rows = [parquet_file, predicate]() -> Result<util::optional<int64_t>> {
+    RETURN_NOT_OK(parquet_file->EnsureCompleteMetadata());
+    return parquet_file->TryCountRows(predicate);
+  };
+  if (!options->use_threads) {
+    return count_rows();
+  }
+  // The footer may have to be read, like when a fragment is opened for scanning
+  return DeferNotOk(options->io_context.executor()->Submit(
+      options->io_context.stop_token(), std::move(count_rows)));
+}
+
 Result<std::shared_ptr<ParquetFileFragment>> ParquetFileFormat::MakeFragment(
     FileSource source, Expression partition_expression,
     std::shared_ptr<Schema> physical_schema, std::vector<int> row_groups) {
@@ -435,12 +957,206 @@ ParquetFileWriter::ParquetFileWriter(std::shared_ptr<io::OutputStream> destinati
       parquet_writer_(std::move(writer)) {}
 
 Status ParquetFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
-  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(batch->schema(), {batch}));
-  return parquet_writer_->WriteTable(*table, batch->num_rows());
+  return parquet_writer_->WriteRecordBatch(*batch);
 }
 
 Status ParquetFileWriter::FinishInternal() { return parquet_writer_->Close(); }
 
+//
+// ParquetMetadataCache
+//
+
+constexpr int64_t ParquetMetadataCache::kDefaultCapacity;
+
+class ParquetMetadataCache::Entry {
+ public:
+  Entry(std::shared_ptr<parquet::FileMetaData> metadata,
+        std::shared_ptr<SchemaManifest> manifest, std::shared_ptr<Schema> physical_schema)
+      : metadata(std::move(metadata)),
+        manifest(std::move(manifest)),
+        physical_schema(std::move(physical_schema)),
+        statistics_(this->physical_schema->num_fields()) {}
+
+  // Return the statistics expressions of a field of the physical schema in every row
+  // group, deriving them on first use.
+  Result<std::shared_ptr<const ColumnStatisticsExpressions>> Statistics(int field_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& statistics = statistics_[field_index];
+    if (statistics == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto expressions,
+          ColumnStatisticsAsExpressions(manifest->schema_fields[field_index], *metadata,
+                                        internal::Iota(metadata->num_row_groups()),
+                                        *physical_schema));
+      statistics = std::make_shared<ColumnStatisticsExpressions>(std::move(expressions));
+    }
+    return statistics;
+  }
+
+  // A rough estimate of the memory held by this entry: deserialized metadata is a few
+  // times larger than the footer, and each row group's column may get a statistics
+  // expression with two bound literals.
+  int64_t charge() const {
+    constexpr int64_t kStatisticsExpressionSize = 256;
+    return 4 * static_cast<int64_t>(metadata->size()) +
+           kStatisticsExpressionSize * metadata->num_row_groups() *
+               physical_schema->num_fields();
+  }
+
+  const std::shared_ptr<parquet::FileMetaData> metadata;
+  const std::shared_ptr<SchemaManifest> manifest;
+  const std::shared_ptr<Schema> physical_schema;
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<const ColumnStatisticsExpressions>> statistics_;
+};
+
+class ParquetMetadataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  int64_t capacity() const { return capacity_; }
+
+  Metrics metrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return metrics_;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    items_.clear();
+    metrics_.num_entries = 0;
+    metrics_.bytes = 0;
+  }
+
+  std::shared_ptr<Entry> Lookup(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      ++metrics_.misses;
+      return nullptr;
+    }
+    ++metrics_.hits;
+    // Move item to the front of the list
+    items_.splice(items_.begin(), items_, it->second);
+    return it->second->entry;
+  }
+
+  std::shared_ptr<Entry> Insert(const std::string& key, std::shared_ptr<Entry> entry) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      // Another fragment read the same file concurrently; share its entry
+      items_.splice(items_.begin(), items_, it->second);
+      return it->second->entry;
+    }
+
+    const int64_t charge = entry->charge();
+    if (charge > capacity_) {
+      // Too large to ever be cached, but still usable by the caller
+      return entry;
+    }
+
+    items_.push_front(Item{key, entry, charge});
+    map_.emplace(key, items_.begin());
+    ++metrics_.num_entries;
+    metrics_.bytes += charge;
+
+    // Evict least recently used items until within capacity
+    while (metrics_.bytes > capacity_) {
+      const Item& lru = items_.back();
+      metrics_.bytes -= lru.charge;
+      --metrics_.num_entries;
+      ++metrics_.evictions;
+      map_.erase(lru.key);
+      items_.pop_back();
+    }
+    return entry;
+  }
+
+ private:
+  struct Item {
+    std::string key;
+    std::shared_ptr<Entry> entry;
+    int64_t charge;
+  };
+  using ItemList = std::list<Item>;
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // In most to least recently used order
+  ItemList items_;
+  std::unordered_map<std::string, ItemList::iterator> map_;
+  Metrics metrics_;
+};
+
+// Return the key of a source in a ParquetMetadataCache, or an empty string if the
+// source can't be cached.
+static std::string MetadataCacheKey(const FileSource& source,
+                                    const ParquetFileFormat& format) {
+  const auto& info = source.file_info();
+  if (source.filesystem() == nullptr || info.size() == fs::kNoSize ||
+      info.mtime() == fs::kNoTime) {
+    return "";
+  }
+
+  // dict_columns changes the physical schema and hence the derived statistics
+  std::vector<std::string> dict_columns(format.reader_options.dict_columns.begin(),
+                                        format.reader_options.dict_columns.end());
+  std::sort(dict_columns.begin(), dict_columns.end());
+
+  std::stringstream ss;
+  ss << source.filesystem()->type_name() << ':' << info.path() << '\0' << info.size()
+     << '\0' << info.mtime().time_since_epoch().count();
+  for (const auto& name : dict_columns) {
+    ss << '\0' << name;
+  }
+  return ss.str();
+}
+
+ParquetMetadataCache::ParquetMetadataCache(int64_t capacity)
+    : impl_(new Impl(capacity)) {}
+
+ParquetMetadataCache::~ParquetMetadataCache() = default;
+
+const std::shared_ptr<ParquetMetadataCache>& ParquetMetadataCache::Default() {
+  static std::shared_ptr<ParquetMetadataCache> cache =
+      std::make_shared<ParquetMetadataCache>();
+  return cache;
+}
+
+int64_t ParquetMetadataCache::capacity() const { return impl_->capacity(); }
+
+ParquetMetadataCache::Metrics ParquetMetadataCache::metrics() const {
+  return impl_->metrics();
+}
+
+void ParquetMetadataCache::Clear() { impl_->Clear(); }
+
+std::shared_ptr<ParquetMetadataCache::Entry> ParquetMetadataCache::Lookup(
+    const FileSource& source, const ParquetFileFormat& format) {
+  auto key = MetadataCacheKey(source, format);
+  if (key.empty()) {
+    return nullptr;
+  }
+  return impl_->Lookup(key);
+}
+
+std::shared_ptr<ParquetMetadataCache::Entry> ParquetMetadataCache::Insert(
+    const FileSource& source, const ParquetFileFormat& format,
+    std::shared_ptr<parquet::FileMetaData> metadata,
+    std::shared_ptr<SchemaManifest> manifest, std::shared_ptr<Schema> physical_schema) {
+  auto key = MetadataCacheKey(source, format);
+  if (key.empty()) {
+    return nullptr;
+  }
+  return impl_->Insert(key, std::make_shared<Entry>(std::move(metadata),
+                                                    std::move(manifest),
+                                                    std::move(physical_schema)));
+}
+
 //
 // ParquetFileFragment
 //
@@ -463,6 +1179,9 @@ Status ParquetFileFragment::EnsureCompleteMetadata(parquet::arrow::FileReader* r
 
   if (reader == nullptr) {
     lock.Unlock();
+    ARROW_ASSIGN_OR_RAISE(bool cached, LookupCachedMetadata());
+    if (cached) return Status::OK();
+
     ARROW_ASSIGN_OR_RAISE(auto reader, parquet_format_.GetReader(source_));
     return EnsureCompleteMetadata(reader.get());
   }
@@ -480,10 +1199,50 @@ Status ParquetFileFragment::EnsureCompleteMetadata(parquet::arrow::FileReader* r
     row_groups_ = internal::Iota(reader->num_row_groups());
   }
 
-  ARROW_ASSIGN_OR_RAISE(
-      auto manifest,
-      GetSchemaManifest(*reader->parquet_reader()->metadata(), reader->properties()));
-  return SetMetadata(reader->parquet_reader()->metadata(), std::move(manifest));
+  auto metadata = reader->parquet_reader()->metadata();
+  ARROW_ASSIGN_OR_RAISE(auto manifest,
+                        GetSchemaManifest(*metadata, reader->properties()));
+  if (const auto& cache = parquet_format_.reader_options.metadata_cache) {
+    cache_entry_ =
+        cache->Insert(source_, parquet_format_, metadata, manifest, physical_schema_);
+  }
+  return SetMetadata(std::move(metadata), std::move(manifest));
+}
+
+Result<bool> ParquetFileFragment::LookupCachedMetadata() {
+  auto lock = physical_schema_mutex_.Lock();
+  if (metadata_ != nullptr) {
+    return true;
+  }
+
+  const auto& cache = parquet_format_.reader_options.metadata_cache;
+  if (cache == nullptr) {
+    return false;
+  }
+  auto entry = cache->Lookup(source_, parquet_format_);
+  if (entry == nullptr) {
+    return false;
+  }
+
+  if (physical_schema_ && !physical_schema_->Equals(*entry->physical_schema)) {
+    return Status::Invalid("Fragment initialized with physical schema ",
+                           *physical_schema_, " but ", source_.path(), " has schema ",
+                           *entry->physical_schema);
+  }
+  physical_schema_ = entry->physical_schema;
+
+  if (!row_groups_) {
+    row_groups_ = internal::Iota(entry->metadata->num_row_groups());
+  }
+
+  RETURN_NOT_OK(SetMetadata(entry->metadata, entry->manifest));
+  cache_entry_ = std::move(entry);
+  return true;
+}
+
+std::shared_ptr<parquet::FileMetaData> ParquetFileFragment::cached_metadata() {
+  auto lock = physical_schema_mutex_.Lock();
+  return cache_entry_ != nullptr ? metadata_ : nullptr;
 }
 
 Status ParquetFileFragment::SetMetadata(
@@ -521,6 +1280,7 @@ Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(Expression predicate
                                                        physical_schema_, {row_group}));
 
     RETURN_NOT_OK(fragment->SetMetadata(metadata_, manifest_));
+    fragment->cache_entry_ = cache_entry_;
     fragments[i++] = std::move(fragment);
   }
 
@@ -541,6 +1301,7 @@ Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
                                                physical_schema_, std::move(row_groups)));
 
   RETURN_NOT_OK(new_fragment->SetMetadata(metadata_, manifest_));
+  new_fragment->cache_entry_ = cache_entry_;
   return new_fragment;
 }
 
@@ -553,6 +1314,55 @@ inline void FoldingAnd(Expression* l, Expression r) {
 }
 
 Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(std::move(predicate)));
+
+  auto lock = physical_schema_mutex_.Lock();
+  std::vector<int> row_groups;
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    if (expressions[i].IsSatisfiable()) {
+      row_groups.push_back(row_groups_->at(i));
+    }
+  }
+  return row_groups;
+}
+
+Result<util::optional<int64_t>> ParquetFileFragment::TryCountRows(Expression predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(predicate));
+
+  auto lock = physical_schema_mutex_.Lock();
+  // Statistics guarantee nothing about nulls, which never match a predicate: a row
+  // group is only known to match in full if its referenced columns have no nulls.
+  std::vector<int> columns;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+    if (match.empty()) continue;
+    const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+    if (!schema_field.is_leaf()) return util::nullopt;
+    columns.push_back(schema_field.column_index);
+  }
+
+  int64_t num_rows = 0;
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    if (!expressions[i].IsSatisfiable()) continue;
+    if (expressions[i] != literal(true)) return util::nullopt;
+
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    auto row_group = metadata_->RowGroup(row_groups_->at(i));
+    for (int column : columns) {
+      auto statistics = row_group->ColumnChunk(column)->statistics();
+      if (statistics == nullptr || !statistics->HasNullCount() ||
+          statistics->null_count() != 0) {
+        return util::nullopt;
+      }
+    }
+    num_rows += row_group->num_rows();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+  return num_rows;
+}
+
+Result<std::vector<Expression>> ParquetFileFragment::TestRowGroups(
+    Expression predicate) {
   auto lock = physical_schema_mutex_.Lock();
 
   DCHECK_NE(metadata_, nullptr);
@@ -560,7 +1370,7 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predica
       predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
 
   if (!predicate.IsSatisfiable()) {
-    return std::vector<int>{};
+    return std::vector<Expression>(row_groups_->size(), literal(false));
   }
 
   for (const FieldRef& ref : FieldsInExpression(predicate)) {
@@ -570,14 +1380,24 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predica
     if (statistics_expressions_complete_[match[0]]) continue;
     statistics_expressions_complete_[match[0]] = true;
 
-    const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+    std::shared_ptr<const ColumnStatisticsExpressions> column_statistics;
+    if (cache_entry_ != nullptr) {
+      // Derived once per file for all row groups and shared with other fragments
+      ARROW_ASSIGN_OR_RAISE(column_statistics, cache_entry_->Statistics(match[0]));
+    } else {
+      const SchemaField& schema_field = manifest_->schema_fields[match[0]];
+      ARROW_ASSIGN_OR_RAISE(
+          auto expressions,
+          ColumnStatisticsAsExpressions(schema_field, *metadata_, *row_groups_,
+                                        *physical_schema_));
+      column_statistics =
+          std::make_shared<ColumnStatisticsExpressions>(std::move(expressions));
+    }
+
     int i = 0;
     for (int row_group : *row_groups_) {
-      auto row_group_metadata = metadata_->RowGroup(row_group);
-
-      if (auto minmax =
-              ColumnChunkStatisticsAsExpression(schema_field, *row_group_metadata)) {
-        FoldingAnd(&statistics_expressions_[i], std::move(*minmax));
+      if (const auto& minmax = (*column_statistics)[row_group]) {
+        FoldingAnd(&statistics_expressions_[i], *minmax);
         ARROW_ASSIGN_OR_RAISE(statistics_expressions_[i],
                               statistics_expressions_[i].Bind(*physical_schema_));
       }
@@ -586,16 +1406,12 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(Expression predica
     }
   }
 
-  std::vector<int> row_groups;
+  std::vector<Expression> expressions(row_groups_->size());
   for (size_t i = 0; i < row_groups_->size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(auto row_group_predicate,
+    ARROW_ASSIGN_OR_RAISE(expressions[i],
                           SimplifyWithGuarantee(predicate, statistics_expressions_[i]));
-    if (row_group_predicate.IsSatisfiable()) {
-      row_groups.push_back(row_groups_->at(i));
-    }
   }
-
-  return row_groups;
+  return expressions;
 }
 
 //
@@ -59,6 +59,64 @@ namespace dataset {
 
 constexpr char kParquetTypeName[] = "parquet";
 
+/// \brief A cache of parquet file metadata and the row group statistics derived from
+/// it, which can be shared by any number of ParquetFileFormats.
+///
+/// Entries are keyed by filesystem, path, size and modification time of the file (and
+/// by the format's dictionary columns, which affect the derived schema), so a file
+/// rewritten in place is only served stale metadata if neither its size nor its mtime
+/// changed. Sources whose size and mtime are unknown, such as buffers or paths not
+/// obtained through discovery, are never cached.
+///
+/// The cache is bounded by an estimate of the memory held by its entries and evicts
+/// the least recently used entries first.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 256 << 20;
+
+  struct Metrics {
+    /// Number of lookups served from the cache
+    int64_t hits = 0;
+    /// Number of lookups of cacheable sources which weren't in the cache
+    int64_t misses = 0;
+    /// Number of entries removed to stay within capacity
+    int64_t evictions = 0;
+    /// Number of entries currently in the cache
+    int64_t num_entries = 0;
+    /// Estimated memory held by the current entries, in bytes
+    int64_t bytes = 0;
+  };
+
+  explicit ParquetMetadataCache(int64_t capacity = kDefaultCapacity);
+  ~ParquetMetadataCache();
+
+  /// \brief Return the process-wide cache, with the default capacity.
+  static const std::shared_ptr<ParquetMetadataCache>& Default();
+
+  /// \brief Return the maximum estimated size of the cache, in bytes.
+  int64_t capacity() const;
+
+  Metrics metrics() const;
+
+  /// \brief Remove all entries. Metrics other than sizes are preserved.
+  void Clear();
+
+  class Entry;
+
+ private:
+  std::shared_ptr<Entry> Lookup(const FileSource& source,
+                                const ParquetFileFormat& format);
+  std::shared_ptr<Entry> Insert(const FileSource& source, const ParquetFileFormat& format,
+                                std::shared_ptr<parquet::FileMetaData> metadata,
+                                std::shared_ptr<parquet::arrow::SchemaManifest> manifest,
+                                std::shared_ptr<Schema> physical_schema);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  friend class ParquetFileFragment;
+};
+
 /// \brief A FileFormat implementation that reads from Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
@@ -83,6 +141,10 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// Cache consulted for file metadata and row group statistics before reading a
+    /// file's footer, see ParquetMetadataCache. If null, nothing is cached.
+    std::shared_ptr<ParquetMetadataCache> metadata_cache;
   } reader_options;
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -116,6 +178,21 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       std::shared_ptr<FileWriteOptions> options) const override;
 
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
+
+  /// \brief Count rows from the file's metadata
+  ///
+  /// Row groups whose statistics show they match the predicate in full, with no nulls
+  /// in the referenced columns, are counted from their number of rows and those which
+  /// can't match are skipped. If any other row group is left, returns util::nullopt.
+  Future<util::optional<int64_t>> CountRows(
+      const std::shared_ptr<FileFragment>& file, Expression predicate,
+      const std::shared_ptr<ScanOptions>& options) override;
+
+ private:
+  // Open a FileReader, reusing the file's already known FileMetaData if not null.
+  Result<std::unique_ptr<parquet::arrow::FileReader>> GetReader(
+      const FileSource& source, ScanOptions* options,
+      std::shared_ptr<parquet::FileMetaData> metadata) const;
 };
 
 /// \brief A FileFragment with parquet logic.
@@ -160,6 +237,14 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Status SetMetadata(std::shared_ptr<parquet::FileMetaData> metadata,
                      std::shared_ptr<parquet::arrow::SchemaManifest> manifest);
 
+  // Set metadata from the format's metadata cache, if the source is cached there.
+  // Returns whether metadata is available.
+  Result<bool> LookupCachedMetadata();
+
+  // Return metadata_ if it was read from or inserted into a ParquetMetadataCache, in
+  // which case it is known to be the file's own, else null.
+  std::shared_ptr<parquet::FileMetaData> cached_metadata();
+
   // Overridden to opportunistically set metadata since a reader must be opened anyway.
   Result<std::shared_ptr<Schema>> ReadPhysicalSchemaImpl() override {
     ARROW_RETURN_NOT_OK(EnsureCompleteMetadata());
@@ -169,6 +254,13 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   // Return a filtered subset of row group indices.
   Result<std::vector<int>> FilterRowGroups(Expression predicate);
 
+  // Simplify a predicate against the statistics of each selected row group.
+  Result<std::vector<Expression>> TestRowGroups(Expression predicate);
+
+  // Count the rows matching a predicate from the metadata, if the statistics tell
+  // which row groups match in full.
+  Result<util::optional<int64_t>> TryCountRows(Expression predicate);
+
   ParquetFileFormat& parquet_format_;
 
   // Indices of row groups selected by this fragment,
@@ -179,6 +271,8 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   std::vector<bool> statistics_expressions_complete_;
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<parquet::arrow::SchemaManifest> manifest_;
+  // Set iff metadata_ was read from or inserted into a ParquetMetadataCache
+  std::shared_ptr<ParquetMetadataCache::Entry> cache_entry_;
 
   friend class ParquetFileFormat;
   friend class ParquetDatasetFactory;
@@ -203,6 +297,32 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   /// option will be removed after support is added for simultaneous parallelization
   /// across files and columns.
   bool enable_parallel_column_conversion = false;
+  /// When pre_buffer is enabled in arrow_reader_properties, issue the reads of the
+  /// column chunks of a fragment as soon as its scan tasks are created, rather than
+  /// when the first of them executes.
+  ///
+  /// This lets a scanner that creates scan tasks ahead of executing them (such as a
+  /// threaded scan) overlap the first-byte latency of upcoming fragments with the
+  /// decoding of the current ones, at the cost of holding more data in memory.
+  bool eager_pre_buffer = false;
+  /// EXPERIMENTAL: Decode the columns referenced by the filter first, and decode the
+  /// remaining projected columns only for row groups with rows passing the filter.
+  ///
+  /// This pays off for selective filters over wide tables, where most of the decode
+  /// of the projected columns would otherwise be discarded by the filter. Only the
+  /// filter columns are pre-buffered.
+  bool late_materialization = false;
+  /// Skip row groups in which the page indexes of the filter columns show that no
+  /// row can satisfy the filter. Only applies to files written with page indexes,
+  /// see parquet::WriterProperties::Builder::enable_write_page_index(), and costs
+  /// one small read per filter column and row group.
+  bool use_page_index = true;
+  /// Skip row groups in which the bloom filter of a column shows that it holds none
+  /// of the values an `equal` or `is_in` conjunction member of the filter looks up.
+  /// Only applies to columns written with bloom filters, see
+  /// parquet::WriterProperties::Builder::enable_bloom_filter(), and costs one read
+  /// per looked up column and row group.
+  bool use_bloom_filter = true;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
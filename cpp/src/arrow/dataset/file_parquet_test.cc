@@ -18,9 +18,11 @@
 #include "arrow/dataset/file_parquet.h"
 
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/cast.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/dataset/test_util.h"
@@ -295,6 +297,34 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReaderPreBuffer) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestParquetFileFormat, ScanRecordBatchReaderEagerPreBuffer) {
+  auto reader = GetRecordBatchReader(schema({field("f64", float64())}));
+  auto source = GetFileSource(reader.get());
+
+  SetSchema(reader->schema()->fields());
+  SetFilter(literal(true));
+
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->arrow_reader_properties->set_pre_buffer(true);
+  fragment_scan_options->eager_pre_buffer = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_));
+  // The column chunks are requested before any scan task executes
+  ASSERT_OK_AND_ASSIGN(auto tasks, scan_task_it.ToVector());
+  ASSERT_EQ(static_cast<int64_t>(tasks.size()), kBatchRepetitions);
+
+  int64_t row_count = 0;
+  for (const auto& task : tasks) {
+    ASSERT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
 TEST_F(TestParquetFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -382,6 +412,47 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
   }
 }
 
+TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjectedNested) {
+  SetSchema({i32, field("s", struct_({f64, i64, f32}))});
+  ASSERT_OK(SetProjection(opts_.get(), {field_ref(FieldRef("s", "i64"))}, {"s.i64"}));
+
+  auto reader = GetRecordBatchReader(opts_->dataset_schema);
+  auto source = GetFileSource(reader.get());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  auto AssertBatchSchemas = [&](const std::shared_ptr<Schema>& expected_schema) {
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      AssertSchemaEqual(*batch->schema(), *expected_schema, /*check_metadata=*/false);
+    }
+  };
+
+  // Only the referenced leaves of the struct are read, in the file's order
+  AssertBatchSchemas(schema({field("s", struct_({i64}))}));
+  SetFilter(equal(field_ref(FieldRef("s", "f32")), literal(0.0f)));
+  AssertBatchSchemas(schema({field("s", struct_({i64, f32}))}));
+
+  // A struct which the filter references is read in the first phase of late
+  // materialization, other columns are still decoded after it
+  fragment_scan_options->late_materialization = true;
+  AssertBatchSchemas(schema({field("s", struct_({i64, f32}))}));
+  SetFilter(equal(field_ref("i32"), literal(0)));
+  AssertBatchSchemas(schema({i32, field("s", struct_({i64}))}));
+
+  // The projection extracts the nested field
+  fragment_scan_options->late_materialization = false;
+  SetFilter(literal(true));
+  ScannerBuilder builder(opts_->dataset_schema, fragment, opts_);
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  AssertSchemaEqual(*table->schema(), *schema({field("s.i64", int64())}),
+                    /*check_metadata=*/false);
+  ASSERT_EQ(table->num_rows(), kNumRows);
+}
+
 TEST_F(TestParquetFileFormat, Inspect) {
   auto reader = GetRecordBatchReader(schema({field("f64", float64())}));
   auto source = GetFileSource(reader.get());
@@ -473,6 +544,160 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, CountRowsFromMetadata) {
+  // See PredicatePushdown: row group `i` holds `i` rows whose values are all `i`, so
+  // each row group matches a predicate on its values in full or not at all.
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  SetSchema(reader->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto count_rows = [&](Expression filter) {
+    SetFilter(filter);
+    EXPECT_OK_AND_ASSIGN(auto count, fragment->CountRows(opts_->filter, opts_).result());
+    return count;
+  };
+  ASSERT_EQ(count_rows(literal(true)), kTotalNumRows);
+  ASSERT_EQ(count_rows(equal(field_ref("i64"), literal<int64_t>(3))), 3);
+  ASSERT_EQ(count_rows(less(field_ref("i64"), literal<int64_t>(6))), 5 * (5 + 1) / 2);
+  ASSERT_EQ(count_rows(equal(field_ref("i64"), literal<int64_t>(kNumRowGroups + 1))),
+            0);
+
+  // The statistics can't tell which rows of a row group match
+  ASSERT_EQ(count_rows(equal(field_ref("i64"), field_ref("u8"))), util::nullopt);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group whose values have a gap, which the column chunk statistics
+  // can't tell apart from the rest of the chunk but the page index can.
+  std::vector<int64_t> values(2000);
+  std::iota(values.begin(), values.begin() + 1000, 0);
+  std::iota(values.begin() + 1000, values.end(), 2000);
+  Int64Builder builder;
+  ASSERT_OK(builder.AppendValues(values));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  auto table = Table::Make(schema({field("i64", int64())}), {array});
+
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->data_pagesize(1024)
+                        ->write_batch_size(500)
+                        ->enable_write_page_index()
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, table->num_rows(),
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(1500)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(2500)));
+  CountRowsAndBatchesInScan(fragment, 2000, 1);
+  SetFilter(or_(less(field_ref("i64"), literal<int64_t>(0)),
+                greater(field_ref("i64"), literal<int64_t>(1200))));
+  CountRowsAndBatchesInScan(fragment, 2000, 1);
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_page_index = false;
+  opts_->fragment_scan_options = fragment_scan_options;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(1500)));
+  CountRowsAndBatchesInScan(fragment, 2000, 1);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Two row groups holding the even and the odd values, which the column chunk
+  // statistics can't tell apart but the bloom filters can.
+  Int64Builder int_builder;
+  StringBuilder str_builder;
+  for (int64_t i = 0; i < 2000; ++i) {
+    const int64_t value = i < 1000 ? 2 * i : 2 * (i - 1000) + 1;
+    ASSERT_OK(int_builder.Append(value));
+    ASSERT_OK(str_builder.Append(std::to_string(value)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto int_array, int_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto str_array, str_builder.Finish());
+  auto table = Table::Make(schema({field("i64", int64()), field("str", utf8())}),
+                           {int_array, str_array});
+
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("i64")
+                        ->enable_bloom_filter("str")
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/1000,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(500)));
+  CountRowsAndBatchesInScan(fragment, 1000, 1);
+  SetFilter(equal(field_ref("str"), literal("501")));
+  CountRowsAndBatchesInScan(fragment, 1000, 1);
+  SetFilter(and_(equal(field_ref("i64"), literal<int64_t>(500)),
+                 equal(field_ref("str"), literal("501"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(call("is_in", {field_ref("i64")},
+                 compute::SetLookupOptions{ArrayFromJSON(int64(), "[500, 501]")}));
+  CountRowsAndBatchesInScan(fragment, 2000, 2);
+  // Disjunctions aren't looked up
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(500)),
+                equal(field_ref("i64"), literal<int64_t>(502))));
+  CountRowsAndBatchesInScan(fragment, 2000, 2);
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->use_bloom_filter = false;
+  opts_->fragment_scan_options = fragment_scan_options;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(500)));
+  CountRowsAndBatchesInScan(fragment, 2000, 2);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  SetSchema(reader->schema()->fields());
+  ASSERT_OK(SetProjection(opts_.get(), {"u8"}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // The filter columns are decoded first, the remaining projected ones after them
+  auto expected_schema = schema({field("i64", int64()), field("u8", uint8())});
+
+  SetFilter(less(field_ref("i64"), literal<int64_t>(6)));
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*batch->schema(), *expected_schema, /*check_metadata=*/false);
+    ASSERT_OK_AND_ASSIGN(auto u8, compute::Cast(*batch->column(1), int64()));
+    AssertArraysEqual(*batch->column(0), *u8);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 5 * (5 + 1) / 2);
+
+  // Row groups without any row passing the filter yield no batches
+  SetFilter(equal(field_ref("bool"), literal(true)));
+  CountRowsAndBatchesInScan(fragment, 8 * 8, 8);
+
+  SetFilter(literal(false));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -541,6 +766,30 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragmentsUsingStringColum
   CountRowGroupsInFragment(fragment, {0, 3}, equal(field_ref("x"), literal("a")));
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownTruncatedStatistics) {
+  // The statistics of the strings are truncated to their first three bytes
+  auto table = TableFromJSON(schema({field("x", utf8())}),
+                             {
+                                 R"([{"x": "apple pie"}, {"x": "apricot"}])",
+                                 R"([{"x": "banana split"}, {"x": "blueberry"}])",
+                                 R"([{"x": "cherry"}, {"x": "cherry tart"}])",
+                             });
+  auto properties = WriterProperties::Builder().max_statistics_size(3)->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/2,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto source = std::make_shared<FileSource>(buffer);
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  CountRowGroupsInFragment(fragment, {1}, equal(field_ref("x"), literal("blueberry")));
+  CountRowGroupsInFragment(fragment, {0}, less(field_ref("x"), literal("apricots")));
+  CountRowGroupsInFragment(fragment, {2}, greater(field_ref("x"), literal("cherry")));
+  CountRowGroupsInFragment(fragment, {}, equal(field_ref("x"), literal("date")));
+}
+
 TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
@@ -598,6 +847,83 @@ TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
       row_groups_fragment({kNumRowGroups + 1})->Scan(opts_));
 }
 
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  constexpr int64_t kNumRowGroups = 16;
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  SetSchema(reader->schema()->fields());
+  auto buffer = Write(reader.get());
+
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(
+                                    fs::TimePoint(fs::TimePoint::duration(42)), {}));
+  auto mockfs = checked_cast<fs::internal::MockFileSystem*>(fs.get());
+  ASSERT_OK(mockfs->CreateFile("dir/a.parquet", util::string_view(*buffer)));
+  ASSERT_OK(mockfs->CreateFile("dir/b.parquet", util::string_view(*buffer)));
+
+  fs::FileSelector selector;
+  selector.base_dir = "dir";
+
+  // Scan every fragment of a freshly discovered dataset
+  auto ScanDataset = [&] {
+    ASSERT_OK_AND_ASSIGN(auto factory,
+                         FileSystemDatasetFactory::Make(fs, selector, format_, {}));
+    ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+    ASSERT_OK_AND_ASSIGN(auto fragments, dataset->GetFragments());
+    for (auto maybe_fragment : fragments) {
+      ASSERT_OK_AND_ASSIGN(auto fragment, maybe_fragment);
+      CountRowsAndBatchesInScan(fragment, 3, 1);
+    }
+  };
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(3)));
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  format_->reader_options.metadata_cache = cache;
+
+  ScanDataset();
+  auto metrics = cache->metrics();
+  ASSERT_EQ(metrics.hits, 0);
+  ASSERT_EQ(metrics.misses, 2);
+  ASSERT_EQ(metrics.num_entries, 2);
+  ASSERT_GT(metrics.bytes, 0);
+  const int64_t entry_size = metrics.bytes / 2;
+
+  // Fragments of another dataset over the same files share the cached metadata
+  ScanDataset();
+  metrics = cache->metrics();
+  ASSERT_EQ(metrics.hits, 2);
+  ASSERT_EQ(metrics.misses, 2);
+  ASSERT_EQ(metrics.num_entries, 2);
+
+  // Rewriting a file with a different size invalidates its entry
+  auto other_reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups + 1);
+  auto other_buffer = Write(other_reader.get());
+  ASSERT_OK(mockfs->CreateFile("dir/b.parquet", util::string_view(*other_buffer)));
+  ScanDataset();
+  metrics = cache->metrics();
+  ASSERT_EQ(metrics.hits, 3);
+  ASSERT_EQ(metrics.misses, 3);
+  ASSERT_EQ(metrics.num_entries, 3);
+
+  cache->Clear();
+  ASSERT_EQ(cache->metrics().num_entries, 0);
+  ASSERT_EQ(cache->metrics().bytes, 0);
+
+  // Least recently used entries are evicted to stay within capacity
+  cache = std::make_shared<ParquetMetadataCache>(entry_size);
+  format_->reader_options.metadata_cache = cache;
+  ASSERT_OK(mockfs->CreateFile("dir/b.parquet", util::string_view(*buffer)));
+  ScanDataset();
+  metrics = cache->metrics();
+  ASSERT_EQ(metrics.misses, 2);
+  ASSERT_EQ(metrics.evictions, 1);
+  ASSERT_EQ(metrics.num_entries, 1);
+  ASSERT_LE(metrics.bytes, cache->capacity());
+
+  // Sources without a known size and mtime are not cached
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({"dir/a.parquet", fs}));
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  ASSERT_EQ(cache->metrics().misses, 2);
+}
+
 TEST_F(TestParquetFileFormat, WriteRecordBatchReader) {
   std::shared_ptr<RecordBatchReader> reader =
       GetRecordBatchReader(schema({field("f64", float64())}));
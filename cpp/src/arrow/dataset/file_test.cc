@@ -207,6 +207,58 @@ TEST_F(TestFileSystemDataset, TreePartitionPruning) {
                              franklins);
 }
 
+TEST_F(TestFileSystemDataset, PartitionValueIndexPruning) {
+  std::vector<fs::FileInfo> files;
+  std::vector<Expression> partitions;
+  for (int day : {1, 2, 3}) {
+    for (int hour : {0, 12}) {
+      auto path = "day=" + std::to_string(day) + "/hour=" + std::to_string(hour);
+      files.push_back(fs::File(path));
+      partitions.push_back(and_(equal(field_ref("day"), literal(day)),
+                                equal(field_ref("hour"), literal(hour))));
+    }
+  }
+  // doesn't pin hour, so can't be excluded by filters on hour
+  files.push_back(fs::File("day=4"));
+  partitions.push_back(equal(field_ref("day"), literal(4)));
+
+  MakeDataset(files, literal(true), partitions,
+              schema({field("day", int32()), field("hour", int32()),
+                      field("value", float64())}));
+
+  auto GetFragments = [&](Expression filter) {
+    return *dataset_->GetFragments(*filter.Bind(*dataset_->schema()));
+  };
+
+  AssertFragmentsAreFromPath(
+      GetFragments(equal(field_ref("hour"), literal(12))),
+      {"day=1/hour=12", "day=2/hour=12", "day=3/hour=12", "day=4"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(greater_equal(field_ref("day"), literal(2)),
+                        less(literal(6), field_ref("hour")))),
+      {"day=2/hour=12", "day=3/hour=12", "day=4"});
+
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(call("is_in", {field_ref("day")},
+                             compute::SetLookupOptions{ArrayFromJSON(int32(), "[1, 4]")}),
+                        not_equal(field_ref("hour"), literal(0)))),
+      {"day=1/hour=12", "day=4"});
+
+  // conjunction members which the index can't resolve are left to simplification
+  AssertFragmentsAreFromPath(
+      GetFragments(and_(equal(field_ref("day"), literal(3)),
+                        greater(field_ref("value"), literal(0.5)))),
+      {"day=3/hour=0", "day=3/hour=12"});
+
+  AssertFragmentsAreFromPath(GetFragments(or_(equal(field_ref("day"), literal(1)),
+                                              equal(field_ref("hour"), literal(0)))),
+                             {"day=1/hour=0", "day=1/hour=12", "day=2/hour=0",
+                              "day=3/hour=0", "day=4"});
+
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("day"), literal(5))), {});
+}
+
 TEST_F(TestFileSystemDataset, FragmentPartitions) {
   auto root_partition = equal(field_ref("country"), literal("US"));
   std::vector<fs::FileInfo> regions = {
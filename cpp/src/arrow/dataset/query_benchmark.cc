@@ -0,0 +1,560 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end benchmarks of analytical queries over a TPC-H-like "lineitem"
+// table, going through the dataset writer, the dataset scanner, the compute
+// functions and the IPC file format.
+//
+// The table is generated at a given scale, in units of 60000 rows (about
+// TPC-H scale factor 0.01), and written once per scale with
+// FileSystemDataset::Write to a temporary directory, partitioned by ship mode.
+// Each query then runs scan -> filter -> project -> aggregate -> sort, one
+// stage after the other, so that the time of every stage can be reported.
+// The scan and the per-batch stages use the CPU thread pool.
+//
+// Besides the wall time, every benchmark reports:
+// - <stage>_seconds: the average time spent in each stage
+// - peak_memory: the largest memory use of an iteration, from its MemoryPool
+// - cpu_utilization: the process CPU time divided by the wall time and the
+//   capacity of the CPU thread pool, 1 meaning all threads were busy
+//
+// The scales run are 1 and 10, unless the ARROW_QUERY_BENCHMARK_SCALE
+// environment variable gives another one.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/expression.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/vendored/datetime.h"
+
+namespace arrow {
+
+using internal::GetEnvVar;
+using internal::ParallelFor;
+using internal::TemporaryDir;
+
+namespace dataset {
+
+constexpr int64_t kRowsPerScale = 60000;
+constexpr int64_t kGeneratedBatchSize = 1 << 15;
+
+static int32_t Days(int year, unsigned month, unsigned day) {
+  namespace date = arrow_vendored::date;
+  return static_cast<int32_t>(
+      date::sys_days(date::year(year) / date::month(month) / date::day(day))
+          .time_since_epoch()
+          .count());
+}
+
+static Expression DateLiteral(int year, unsigned month, unsigned day) {
+  return literal(std::make_shared<Date32Scalar>(Days(year, month, day)));
+}
+
+static std::shared_ptr<Schema> LineitemSchema() {
+  return schema({field("l_orderkey", int64()), field("l_quantity", float64()),
+                 field("l_extendedprice", float64()), field("l_discount", float64()),
+                 field("l_tax", float64()), field("l_returnflag", utf8()),
+                 field("l_linestatus", utf8()), field("l_shipdate", date32()),
+                 field("l_shipmode", utf8())});
+}
+
+// Generates the lineitem table with value distributions close to those of
+// TPC-H dbgen, deterministically for a given number of rows
+static std::shared_ptr<Table> GenerateLineitem(int64_t num_rows) {
+  static const char* kShipModes[] = {"REG AIR", "AIR", "RAIL", "SHIP",
+                                     "TRUCK",   "MAIL", "FOB"};
+  const int32_t start_date = Days(1992, 1, 1);
+  const int32_t end_date = Days(1998, 8, 2);
+  const int32_t current_date = Days(1995, 6, 17);
+
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int> quantity(1, 50);
+  std::uniform_real_distribution<double> part_price(900.0, 2000.0);
+  std::uniform_int_distribution<int> discount(0, 10);
+  std::uniform_int_distribution<int> tax(0, 8);
+  std::uniform_int_distribution<int32_t> order_date(start_date, end_date);
+  std::uniform_int_distribution<int32_t> ship_delay(1, 121);
+  std::uniform_int_distribution<int32_t> receipt_delay(1, 30);
+  std::uniform_int_distribution<int> coin(0, 1);
+  std::uniform_int_distribution<int> ship_mode(0, 6);
+
+  RecordBatchVector batches;
+  for (int64_t offset = 0; offset < num_rows; offset += kGeneratedBatchSize) {
+    const int64_t length = std::min(kGeneratedBatchSize, num_rows - offset);
+    Int64Builder orderkeys;
+    DoubleBuilder quantities, prices, discounts, taxes;
+    StringBuilder returnflags, linestatuses, shipmodes;
+    Date32Builder shipdates;
+    for (int64_t i = offset; i < offset + length; ++i) {
+      // About four lines per order
+      ABORT_NOT_OK(orderkeys.Append(i / 4 + 1));
+      const int line_quantity = quantity(rng);
+      ABORT_NOT_OK(quantities.Append(line_quantity));
+      ABORT_NOT_OK(prices.Append(line_quantity * part_price(rng)));
+      ABORT_NOT_OK(discounts.Append(discount(rng) / 100.0));
+      ABORT_NOT_OK(taxes.Append(tax(rng) / 100.0));
+      const int32_t shipdate = order_date(rng) + ship_delay(rng);
+      const int32_t receiptdate = shipdate + receipt_delay(rng);
+      ABORT_NOT_OK(returnflags.Append(
+          receiptdate <= current_date ? (coin(rng) ? "R" : "A") : "N"));
+      ABORT_NOT_OK(linestatuses.Append(shipdate > current_date ? "O" : "F"));
+      ABORT_NOT_OK(shipdates.Append(shipdate));
+      ABORT_NOT_OK(shipmodes.Append(kShipModes[ship_mode(rng)]));
+    }
+    ArrayVector columns(9);
+    ABORT_NOT_OK(orderkeys.Finish(&columns[0]));
+    ABORT_NOT_OK(quantities.Finish(&columns[1]));
+    ABORT_NOT_OK(prices.Finish(&columns[2]));
+    ABORT_NOT_OK(discounts.Finish(&columns[3]));
+    ABORT_NOT_OK(taxes.Finish(&columns[4]));
+    ABORT_NOT_OK(returnflags.Finish(&columns[5]));
+    ABORT_NOT_OK(linestatuses.Finish(&columns[6]));
+    ABORT_NOT_OK(shipdates.Finish(&columns[7]));
+    ABORT_NOT_OK(shipmodes.Finish(&columns[8]));
+    batches.push_back(RecordBatch::Make(LineitemSchema(), length, std::move(columns)));
+  }
+  EXPECT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(LineitemSchema(), batches));
+  return table;
+}
+
+static std::shared_ptr<Table> GetLineitem(int64_t scale) {
+  static std::map<int64_t, std::shared_ptr<Table>> tables;
+  auto it = tables.find(scale);
+  if (it == tables.end()) {
+    it = tables.emplace(scale, GenerateLineitem(scale * kRowsPerScale)).first;
+  }
+  return it->second;
+}
+
+static FileSystemDatasetWriteOptions MakeWriteOptions(const std::string& base_dir) {
+  auto format = std::make_shared<IpcFileFormat>();
+  FileSystemDatasetWriteOptions write_options;
+  write_options.file_write_options = format->DefaultWriteOptions();
+  write_options.filesystem = std::make_shared<fs::LocalFileSystem>();
+  write_options.base_dir = base_dir;
+  write_options.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("l_shipmode", utf8())}));
+  write_options.basename_template = "part_{i}.arrow";
+  return write_options;
+}
+
+static Status WriteLineitem(const std::shared_ptr<Table>& table,
+                            const FileSystemDatasetWriteOptions& write_options,
+                            MemoryPool* pool) {
+  ScannerBuilder builder(std::make_shared<InMemoryDataset>(table));
+  RETURN_NOT_OK(builder.UseThreads(true));
+  RETURN_NOT_OK(builder.Pool(pool));
+  ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+  return FileSystemDataset::Write(write_options, std::move(scanner));
+}
+
+// The written lineitem dataset of a scale, kept for all the query benchmarks
+struct WrittenDataset {
+  std::unique_ptr<TemporaryDir> dir;
+  std::shared_ptr<Dataset> dataset;
+};
+
+static std::shared_ptr<Dataset> GetWrittenLineitem(int64_t scale) {
+  static std::map<int64_t, WrittenDataset> datasets;
+  auto it = datasets.find(scale);
+  if (it != datasets.end()) return it->second.dataset;
+
+  WrittenDataset written;
+  EXPECT_OK_AND_ASSIGN(written.dir, TemporaryDir::Make("query-benchmark-"));
+  auto write_options = MakeWriteOptions(written.dir->path().ToString());
+  ABORT_NOT_OK(
+      WriteLineitem(GetLineitem(scale), write_options, default_memory_pool()));
+
+  fs::FileSelector selector;
+  selector.base_dir = write_options.base_dir;
+  selector.recursive = true;
+  FileSystemFactoryOptions factory_options;
+  factory_options.partitioning = write_options.partitioning;
+  factory_options.partition_base_dir = write_options.base_dir;
+  EXPECT_OK_AND_ASSIGN(auto factory, FileSystemDatasetFactory::Make(
+                                         write_options.filesystem, selector,
+                                         write_options.format(), factory_options));
+  EXPECT_OK_AND_ASSIGN(written.dataset, factory->Finish());
+  return datasets.emplace(scale, std::move(written)).first->second.dataset;
+}
+
+// A query running scan -> filter -> project -> aggregate -> sort
+struct Query {
+  /// Columns of the dataset to scan
+  std::vector<std::string> columns;
+  /// Predicate on the scanned columns
+  Expression filter;
+  /// Columns computed from the filtered columns, and their names
+  std::vector<Expression> projections;
+  std::vector<std::string> names;
+  /// Projected columns to group by.  If empty, the aggregates are scalar
+  /// aggregate functions (such as "sum") rather than hash aggregate functions.
+  std::vector<std::string> keys;
+  std::vector<compute::internal::Aggregate> aggregates;
+  /// Projected columns to aggregate, one for each of the aggregates
+  std::vector<std::string> targets;
+  /// Sort of the aggregated result, whose columns are named
+  /// "<function>(<target>)" and after the keys.  Not sorted if empty.
+  std::vector<compute::SortKey> sort_keys;
+  /// Number of rows to keep after the sort, or -1 to keep all
+  int64_t limit = -1;
+};
+
+// Measures the time spent in each stage of a query, and the CPU time and
+// memory use of its iterations
+class QueryMetrics {
+ public:
+  explicit QueryMetrics(benchmark::State& state) : state_(state) {}
+
+  template <typename Fn>
+  Status Time(const std::string& stage, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    Status st = fn();
+    stage_seconds_[stage] +=
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return st;
+  }
+
+  void StartIteration() {
+    wall_start_ = std::chrono::steady_clock::now();
+    cpu_start_ = std::clock();
+  }
+
+  void FinishIteration(const MemoryPool& pool) {
+    wall_seconds_ +=
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start_)
+            .count();
+    cpu_seconds_ += static_cast<double>(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+    peak_memory_ = std::max(peak_memory_, pool.max_memory());
+  }
+
+  void Report(int64_t rows_per_iteration) {
+    for (const auto& stage : stage_seconds_) {
+      state_.counters[stage.first + "_seconds"] =
+          benchmark::Counter(stage.second, benchmark::Counter::kAvgIterations);
+    }
+    state_.counters["peak_memory"] = static_cast<double>(peak_memory_);
+    if (wall_seconds_ > 0) {
+      state_.counters["cpu_utilization"] =
+          cpu_seconds_ / (wall_seconds_ * GetCpuThreadPoolCapacity());
+    }
+    state_.SetItemsProcessed(state_.iterations() * rows_per_iteration);
+  }
+
+ private:
+  benchmark::State& state_;
+  std::map<std::string, double> stage_seconds_;
+  std::chrono::steady_clock::time_point wall_start_;
+  std::clock_t cpu_start_ = 0;
+  double wall_seconds_ = 0;
+  double cpu_seconds_ = 0;
+  int64_t peak_memory_ = 0;
+};
+
+// Applies `fn` to every batch, in parallel on the CPU thread pool
+template <typename Fn>
+static Status MapBatches(RecordBatchVector* batches, Fn&& fn) {
+  return ParallelFor(static_cast<int>(batches->size()), [&](int i) {
+    ARROW_ASSIGN_OR_RAISE((*batches)[i], fn((*batches)[i]));
+    return Status::OK();
+  });
+}
+
+static Result<std::shared_ptr<Array>> ToArray(const Datum& datum, int64_t length,
+                                              MemoryPool* pool) {
+  if (datum.is_scalar()) {
+    return MakeArrayFromScalar(*datum.scalar(), length, pool);
+  }
+  return datum.make_array();
+}
+
+static Result<std::shared_ptr<RecordBatch>> Aggregate(const Query& query,
+                                                      const Table& table,
+                                                      compute::ExecContext* ctx) {
+  FieldVector fields;
+  ArrayVector columns;
+  if (query.keys.empty()) {
+    for (size_t i = 0; i < query.aggregates.size(); ++i) {
+      const auto& aggregate = query.aggregates[i];
+      ARROW_ASSIGN_OR_RAISE(
+          Datum value,
+          compute::CallFunction(aggregate.function,
+                                {table.GetColumnByName(query.targets[i])},
+                                aggregate.options, ctx));
+      ARROW_ASSIGN_OR_RAISE(auto column, ToArray(value, 1, ctx->memory_pool()));
+      fields.push_back(
+          field(aggregate.function + "(" + query.targets[i] + ")", column->type()));
+      columns.push_back(std::move(column));
+    }
+    return RecordBatch::Make(schema(std::move(fields)), 1, std::move(columns));
+  }
+
+  std::vector<Datum> arguments, keys;
+  for (const auto& target : query.targets) {
+    arguments.emplace_back(table.GetColumnByName(target));
+  }
+  for (const auto& key : query.keys) {
+    keys.emplace_back(table.GetColumnByName(key));
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      Datum grouped, compute::internal::GroupBy(arguments, keys, query.aggregates, ctx));
+  // Name the aggregates after their targets and the keys after their columns
+  const auto& struct_array = grouped.array_as<StructArray>();
+  for (size_t i = 0; i < query.aggregates.size(); ++i) {
+    fields.push_back(field(query.aggregates[i].function + "(" + query.targets[i] + ")",
+                           struct_array->field(static_cast<int>(i))->type()));
+    columns.push_back(struct_array->field(static_cast<int>(i)));
+  }
+  for (size_t i = 0; i < query.keys.size(); ++i) {
+    const auto& column =
+        struct_array->field(static_cast<int>(query.aggregates.size() + i));
+    fields.push_back(field(query.keys[i], column->type()));
+    columns.push_back(column);
+  }
+  return RecordBatch::Make(schema(std::move(fields)), struct_array->length(),
+                           std::move(columns));
+}
+
+static Status RunQuery(const Query& query, const std::shared_ptr<Dataset>& dataset,
+                       MemoryPool* pool, QueryMetrics* metrics) {
+  compute::ExecContext ctx(pool);
+  RecordBatchVector batches;
+
+  RETURN_NOT_OK(metrics->Time("scan", [&]() -> Status {
+    ScannerBuilder builder(dataset);
+    RETURN_NOT_OK(builder.Project(query.columns));
+    RETURN_NOT_OK(builder.UseThreads(true));
+    RETURN_NOT_OK(builder.Pool(pool));
+    ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, scanner->ScanBatches());
+    return batch_it.Visit([&](TaggedRecordBatch tagged_batch) {
+      batches.push_back(std::move(tagged_batch.record_batch));
+      return Status::OK();
+    });
+  }));
+  if (batches.empty()) {
+    return Status::Invalid("The scan of the dataset gave no batch");
+  }
+
+  RETURN_NOT_OK(metrics->Time("filter", [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto filter, query.filter.Bind(*batches[0]->schema()));
+    return MapBatches(&batches, [&](const std::shared_ptr<RecordBatch>& batch)
+                                    -> Result<std::shared_ptr<RecordBatch>> {
+      ARROW_ASSIGN_OR_RAISE(Datum mask, ExecuteScalarExpression(filter, batch, &ctx));
+      ARROW_ASSIGN_OR_RAISE(
+          Datum filtered,
+          compute::Filter(batch, mask, compute::FilterOptions::Defaults(), &ctx));
+      return filtered.record_batch();
+    });
+  }));
+
+  std::shared_ptr<Schema> projected_schema;
+  RETURN_NOT_OK(metrics->Time("project", [&]() -> Status {
+    std::vector<Expression> projections;
+    FieldVector fields;
+    for (size_t i = 0; i < query.projections.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto projection,
+                            query.projections[i].Bind(*batches[0]->schema()));
+      fields.push_back(field(query.names[i], projection.type()));
+      projections.push_back(std::move(projection));
+    }
+    projected_schema = schema(std::move(fields));
+    return MapBatches(&batches, [&](const std::shared_ptr<RecordBatch>& batch)
+                                    -> Result<std::shared_ptr<RecordBatch>> {
+      ArrayVector columns;
+      for (const auto& projection : projections) {
+        ARROW_ASSIGN_OR_RAISE(Datum value,
+                              ExecuteScalarExpression(projection, batch, &ctx));
+        ARROW_ASSIGN_OR_RAISE(auto column, ToArray(value, batch->num_rows(), pool));
+        columns.push_back(std::move(column));
+      }
+      return RecordBatch::Make(projected_schema, batch->num_rows(), std::move(columns));
+    });
+  }));
+
+  std::shared_ptr<RecordBatch> result;
+  RETURN_NOT_OK(metrics->Time("aggregate", [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(projected_schema, batches));
+    ARROW_ASSIGN_OR_RAISE(result, Aggregate(query, *table, &ctx));
+    return Status::OK();
+  }));
+
+  if (query.sort_keys.empty()) return Status::OK();
+  return metrics->Time("sort", [&]() -> Status {
+    ARROW_ASSIGN_OR_RAISE(
+        auto indices,
+        compute::SortIndices(result, compute::SortOptions(query.sort_keys), &ctx));
+    if (query.limit >= 0 && query.limit < indices->length()) {
+      indices = indices->Slice(0, query.limit);
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(result, indices,
+                                                      compute::TakeOptions::Defaults(),
+                                                      &ctx));
+    result = sorted.record_batch();
+    return Status::OK();
+  });
+}
+
+static Expression Revenue() {
+  // l_extendedprice * (1 - l_discount)
+  return call("multiply", {field_ref("l_extendedprice"),
+                           call("subtract", {literal(1.0), field_ref("l_discount")})});
+}
+
+// TPC-H Q1: pricing summary report
+static Query PricingSummaryQuery() {
+  Query query;
+  query.columns = {"l_returnflag", "l_linestatus",    "l_quantity", "l_extendedprice",
+                   "l_discount",   "l_tax",           "l_shipdate"};
+  query.filter = less_equal(field_ref("l_shipdate"), DateLiteral(1998, 9, 2));
+  query.projections = {
+      field_ref("l_returnflag"), field_ref("l_linestatus"), field_ref("l_quantity"),
+      field_ref("l_extendedprice"), field_ref("l_discount"), Revenue(),
+      call("multiply",
+           {Revenue(), call("add", {literal(1.0), field_ref("l_tax")})})};
+  query.names = {"l_returnflag", "l_linestatus", "l_quantity", "l_extendedprice",
+                 "l_discount",   "disc_price",   "charge"};
+  query.keys = {"l_returnflag", "l_linestatus"};
+  query.aggregates = {{"hash_sum", nullptr},  {"hash_sum", nullptr},
+                      {"hash_sum", nullptr},  {"hash_sum", nullptr},
+                      {"hash_mean", nullptr}, {"hash_mean", nullptr},
+                      {"hash_mean", nullptr}, {"hash_count", nullptr}};
+  query.targets = {"l_quantity", "l_extendedprice", "disc_price", "charge",
+                   "l_quantity", "l_extendedprice", "l_discount", "l_quantity"};
+  query.sort_keys = {compute::SortKey("l_returnflag"), compute::SortKey("l_linestatus")};
+  return query;
+}
+
+// TPC-H Q6: forecasting revenue change, a selective filter and a scalar sum
+static Query RevenueForecastQuery() {
+  Query query;
+  query.columns = {"l_shipdate", "l_discount", "l_quantity", "l_extendedprice"};
+  query.filter = and_({greater_equal(field_ref("l_shipdate"), DateLiteral(1994, 1, 1)),
+                       less(field_ref("l_shipdate"), DateLiteral(1995, 1, 1)),
+                       greater_equal(field_ref("l_discount"), literal(0.05)),
+                       less_equal(field_ref("l_discount"), literal(0.07)),
+                       less(field_ref("l_quantity"), literal(24.0))});
+  query.projections = {
+      call("multiply", {field_ref("l_extendedprice"), field_ref("l_discount")})};
+  query.names = {"revenue"};
+  query.aggregates = {{"sum", nullptr}};
+  query.targets = {"revenue"};
+  return query;
+}
+
+// After TPC-H Q3: the ten orders with the largest revenue, a group by over
+// many groups followed by a sort
+static Query TopOrdersQuery() {
+  Query query;
+  query.columns = {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"};
+  query.filter = greater(field_ref("l_shipdate"), DateLiteral(1995, 3, 15));
+  query.projections = {field_ref("l_orderkey"), Revenue()};
+  query.names = {"l_orderkey", "revenue"};
+  query.keys = {"l_orderkey"};
+  query.aggregates = {{"hash_sum", nullptr}};
+  query.targets = {"revenue"};
+  query.sort_keys = {
+      compute::SortKey("hash_sum(revenue)", compute::SortOrder::Descending),
+      compute::SortKey("l_orderkey")};
+  query.limit = 10;
+  return query;
+}
+
+static void WriteDataset(benchmark::State& state) {
+  const auto table = GetLineitem(state.range(0));
+  QueryMetrics metrics(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    ASSERT_OK_AND_ASSIGN(auto dir, TemporaryDir::Make("query-benchmark-"));
+    auto write_options = MakeWriteOptions(dir->path().ToString());
+    ProxyMemoryPool pool(default_memory_pool());
+    state.ResumeTiming();
+
+    metrics.StartIteration();
+    ABORT_NOT_OK(metrics.Time("write", [&] {
+      return WriteLineitem(table, write_options, &pool);
+    }));
+    metrics.FinishIteration(pool);
+
+    state.PauseTiming();
+    dir.reset();
+    state.ResumeTiming();
+  }
+  metrics.Report(table->num_rows());
+}
+
+static void RunQueryBenchmark(benchmark::State& state, Query (*make_query)()) {
+  const Query query = make_query();
+  const auto dataset = GetWrittenLineitem(state.range(0));
+  QueryMetrics metrics(state);
+  for (auto _ : state) {
+    ProxyMemoryPool pool(default_memory_pool());
+    metrics.StartIteration();
+    ABORT_NOT_OK(RunQuery(query, dataset, &pool, &metrics));
+    metrics.FinishIteration(pool);
+  }
+  metrics.Report(state.range(0) * kRowsPerScale);
+}
+
+static void SetScaleArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"scale"})->UseRealTime()->Unit(benchmark::kMillisecond);
+  auto maybe_scale = GetEnvVar("ARROW_QUERY_BENCHMARK_SCALE");
+  if (maybe_scale.ok()) {
+    bench->Arg(std::stoll(*maybe_scale));
+  } else {
+    bench->Arg(1)->Arg(10);
+  }
+}
+
+BENCHMARK(WriteDataset)->Apply(SetScaleArgs);
+BENCHMARK_CAPTURE(RunQueryBenchmark, pricing_summary, &PricingSummaryQuery)
+    ->Apply(SetScaleArgs);
+BENCHMARK_CAPTURE(RunQueryBenchmark, revenue_forecast, &RevenueForecastQuery)
+    ->Apply(SetScaleArgs);
+BENCHMARK_CAPTURE(RunQueryBenchmark, top_orders, &TopOrdersQuery)->Apply(SetScaleArgs);
+
+}  // namespace dataset
+}  // namespace arrow
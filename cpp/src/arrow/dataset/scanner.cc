@@ -18,19 +18,28 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <cmath>
+#include <deque>
 #include <memory>
 #include <mutex>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/config.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/mutex.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace dataset {
@@ -38,16 +47,30 @@ namespace dataset {
 std::vector<std::string> ScanOptions::MaterializedFields() const {
   std::vector<std::string> fields;
 
-  for (const Expression* expr : {&filter, &projection}) {
-    for (const FieldRef& ref : FieldsInExpression(*expr)) {
-      DCHECK(ref.name());
-      fields.push_back(*ref.name());
+  for (const FieldRef& ref : MaterializedFieldRefs()) {
+    const FieldRef* top_level = &ref;
+    if (auto nested_refs = ref.nested_refs()) {
+      top_level = &nested_refs->front();
     }
+    DCHECK(top_level->name());
+    fields.push_back(*top_level->name());
   }
 
   return fields;
 }
 
+std::vector<FieldRef> ScanOptions::MaterializedFieldRefs() const {
+  std::vector<FieldRef> refs;
+
+  for (const Expression* expr : {&filter, &projection}) {
+    for (FieldRef& ref : FieldsInExpression(*expr)) {
+      refs.push_back(std::move(ref));
+    }
+  }
+
+  return refs;
+}
+
 using arrow::internal::Executor;
 using arrow::internal::SerialExecutor;
 using arrow::internal::TaskGroup;
@@ -71,8 +94,8 @@ Result<RecordBatchGenerator> ScanTask::ExecuteAsync(internal::Executor*) {
 bool ScanTask::supports_async() const { return false; }
 
 Result<ScanTaskIterator> Scanner::Scan() {
-  // TODO(ARROW-12289) This is overridden in SyncScanner and will never be implemented in
-  // AsyncScanner.  It is deprecated and will eventually go away.
+  // TODO(ARROW-12289) This is overridden in SyncScanner and AsyncScanner.  It is
+  // deprecated and will eventually go away.
   return Status::NotImplemented("This scanner does not support the legacy Scan() method");
 }
 
@@ -138,6 +161,376 @@ Result<EnumeratedRecordBatchIterator> Scanner::AddPositioningToInOrderScan(
       EnumeratingIterator{std::make_shared<State>(std::move(scan), std::move(first))});
 }
 
+Result<RecordBatchIterator> Scanner::ScanBatchesSorted() {
+  return Status::NotImplemented("This scanner does not support sorted scans");
+}
+
+namespace {
+
+// Read the first num_rows rows of an ordered scan, polling stop_token between batches
+Result<std::shared_ptr<Table>> ReadHead(TaggedRecordBatchIterator* batches,
+                                        int64_t num_rows,
+                                        const std::shared_ptr<Schema>& schema,
+                                        StopToken stop_token) {
+  RecordBatchVector head;
+  while (num_rows > 0) {
+    RETURN_NOT_OK(stop_token.Poll());
+    ARROW_ASSIGN_OR_RAISE(auto next, batches->Next());
+    if (IsIterationEnd(next)) break;
+    auto batch = std::move(next.record_batch);
+    if (batch->num_rows() > num_rows) {
+      batch = batch->Slice(0, num_rows);
+    }
+    num_rows -= batch->num_rows();
+    head.push_back(std::move(batch));
+  }
+  return Table::FromRecordBatches(schema, std::move(head));
+}
+
+// Options to scan fragments only to count their rows: no column is projected, so only
+// those referenced by the filter are read
+Result<std::shared_ptr<ScanOptions>> MakeCountRowsOptions(const ScanOptions& options) {
+  auto count_options = std::make_shared<ScanOptions>(options);
+  RETURN_NOT_OK(SetProjection(count_options.get(), std::vector<std::string>{}));
+  return count_options;
+}
+
+// Sum the rows the fragments count without being scanned. Fragments which must be
+// scanned are appended to to_scan.
+Result<int64_t> CountRowsWithoutScanning(const FragmentVector& fragments,
+                                         const std::shared_ptr<ScanOptions>& options,
+                                         FragmentVector* to_scan) {
+  std::vector<Future<util::optional<int64_t>>> counts;
+  for (const auto& fragment : fragments) {
+    counts.push_back(fragment->CountRows(options->filter, options));
+  }
+  int64_t total = 0;
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto count, counts[i].result());
+    if (count.has_value()) {
+      total += *count;
+    } else {
+      to_scan->push_back(fragments[i]);
+    }
+  }
+  return total;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Table>> Scanner::Head(int64_t num_rows) {
+  if (num_rows < 0) {
+    return Status::Invalid("Head of a scan needs a non-negative number of rows");
+  }
+  if (num_rows == 0) {
+    return Table::FromRecordBatches(scan_options_->projected_schema,
+                                    RecordBatchVector{});
+  }
+  ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatches());
+  return ReadHead(&batches, num_rows, scan_options_->projected_schema,
+                  scan_options_->io_context.stop_token());
+}
+
+namespace {
+
+// Drops the fragments tagging the batches of an ordered scan
+class ScanBatchReader : public RecordBatchReader {
+ public:
+  ScanBatchReader(std::shared_ptr<Schema> schema, TaggedRecordBatchIterator batches)
+      : schema_(std::move(schema)), batches_(std::move(batches)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto next, batches_.Next());
+    *batch = IsIterationEnd(next) ? nullptr : std::move(next.record_batch);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  TaggedRecordBatchIterator batches_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ToRecordBatchReader() {
+  ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatches());
+  return std::make_shared<ScanBatchReader>(scan_options_->projected_schema,
+                                           std::move(batches));
+}
+
+namespace {
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+inline bool IsNaN(float value) { return std::isnan(value); }
+inline bool IsNaN(double value) { return std::isnan(value); }
+
+// A sort key column of a fragment's current batch, compared row-wise against the same
+// column of another fragment's current batch.
+class SortKeyColumn {
+ public:
+  explicit SortKeyColumn(compute::SortOrder order) : order_(order) {}
+  virtual ~SortKeyColumn() = default;
+
+  // Negative, zero or positive as row i sorts before, with or after row j of other.
+  virtual int Compare(int64_t i, const SortKeyColumn& other, int64_t j) const = 0;
+
+ protected:
+  compute::SortOrder order_;
+};
+
+template <typename ArrowType>
+class TypedSortKeyColumn : public SortKeyColumn {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  TypedSortKeyColumn(std::shared_ptr<Array> array, compute::SortOrder order)
+      : SortKeyColumn(order),
+        array_(std::move(array)),
+        values_(checked_cast<const ArrayType*>(array_.get())) {}
+
+  int Compare(int64_t i, const SortKeyColumn& other, int64_t j) const override {
+    const auto& other_values = *checked_cast<const TypedSortKeyColumn&>(other).values_;
+
+    // nulls, then NaNs, sort at the end regardless of order
+    bool null_i = values_->IsNull(i), null_j = other_values.IsNull(j);
+    if (null_i || null_j) return static_cast<int>(null_i) - static_cast<int>(null_j);
+
+    auto l = values_->GetView(i);
+    auto r = other_values.GetView(j);
+    bool nan_l = IsNaN(l), nan_r = IsNaN(r);
+    if (nan_l || nan_r) return static_cast<int>(nan_l) - static_cast<int>(nan_r);
+
+    int cmp = l < r ? -1 : (r < l ? 1 : 0);
+    return order_ == compute::SortOrder::Ascending ? cmp : -cmp;
+  }
+
+ private:
+  std::shared_ptr<Array> array_;
+  const ArrayType* values_;
+};
+
+template <typename T>
+using is_sort_key_type = std::integral_constant<
+    bool, (is_number_type<T>::value && !std::is_same<T, HalfFloatType>::value) ||
+              is_boolean_type<T>::value || is_date_type<T>::value ||
+              is_time_type<T>::value || is_timestamp_type<T>::value ||
+              is_duration_type<T>::value || is_base_binary_type<T>::value ||
+              std::is_same<T, FixedSizeBinaryType>::value>;
+
+struct SortKeyColumnMaker {
+  template <typename T>
+  enable_if_t<is_sort_key_type<T>::value, Status> Visit(const T&) {
+    out.reset(new TypedSortKeyColumn<T>(array, order));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Sorted scan by a sort key of type ", type);
+  }
+
+  std::shared_ptr<Array> array;
+  compute::SortOrder order;
+  std::unique_ptr<SortKeyColumn> out;
+};
+
+/// \brief Merge streams of record batches, each sorted by the same keys, into a
+/// single sorted stream of batches of up to batch_size rows.
+///
+/// Streams are drained in runs: rows of the stream with the least current row are
+/// sliced off up to the first row which sorts after the current row of any other
+/// stream. Ties are broken by stream index, so equal rows keep stream order.
+class SortedMergeIterator {
+ public:
+  struct SortKeyIndex {
+    int field_index;
+    compute::SortOrder order;
+  };
+
+  SortedMergeIterator(std::vector<RecordBatchIterator> streams,
+                      std::vector<SortKeyIndex> sort_keys,
+                      std::shared_ptr<Schema> schema, int64_t batch_size,
+                      MemoryPool* pool)
+      : state_(std::make_shared<State>()) {
+    for (auto& batches : streams) {
+      state_->streams.emplace_back();
+      state_->streams.back().batches = std::move(batches);
+    }
+    state_->sort_keys = std::move(sort_keys);
+    state_->schema = std::move(schema);
+    state_->batch_size = batch_size;
+    state_->pool = pool;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() { return state_->Next(); }
+
+ private:
+  struct Stream {
+    RecordBatchIterator batches;
+    std::shared_ptr<RecordBatch> batch;
+    int64_t row = 0;
+    std::vector<std::unique_ptr<SortKeyColumn>> keys;
+  };
+
+  struct State {
+    // Load the next non-empty batch of a stream, or clear its batch when exhausted.
+    Status LoadNextBatch(Stream* stream) {
+      do {
+        ARROW_ASSIGN_OR_RAISE(stream->batch, stream->batches.Next());
+        if (IsIterationEnd(stream->batch)) {
+          stream->batches = RecordBatchIterator();
+          return Status::OK();
+        }
+      } while (stream->batch->num_rows() == 0);
+
+      stream->row = 0;
+      stream->keys.clear();
+      for (const auto& key : sort_keys) {
+        SortKeyColumnMaker maker{stream->batch->column(key.field_index), key.order,
+                                 nullptr};
+        RETURN_NOT_OK(VisitTypeInline(*maker.array->type(), &maker));
+        stream->keys.push_back(std::move(maker.out));
+      }
+      return Status::OK();
+    }
+
+    // Whether row i of stream s sorts after the current row of stream t.
+    bool After(int s, int64_t i, int t) const {
+      const auto& l = streams[s];
+      const auto& r = streams[t];
+      for (size_t k = 0; k < sort_keys.size(); ++k) {
+        int cmp = l.keys[k]->Compare(i, *r.keys[k], r.row);
+        if (cmp != 0) return cmp > 0;
+      }
+      return s > t;
+    }
+
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      if (!started) {
+        started = true;
+        for (int s = 0; s < static_cast<int>(streams.size()); ++s) {
+          RETURN_NOT_OK(LoadNextBatch(&streams[s]));
+          if (streams[s].batch) PushHeap(s);
+        }
+      }
+
+      RecordBatchVector runs;
+      int64_t num_rows = 0;
+      while (num_rows < batch_size && !heap.empty()) {
+        int s = PopHeap();
+        auto& stream = streams[s];
+
+        // binary search for the end of the run, which is sorted
+        int64_t begin = stream.row;
+        int64_t end =
+            std::min(stream.batch->num_rows(), begin + batch_size - num_rows);
+        if (!heap.empty()) {
+          int64_t lo = begin + 1;
+          while (lo < end) {
+            int64_t mid = lo + (end - lo) / 2;
+            if (After(s, mid, heap.front())) {
+              end = mid;
+            } else {
+              lo = mid + 1;
+            }
+          }
+        }
+
+        runs.push_back(stream.batch->Slice(begin, end - begin));
+        num_rows += end - begin;
+        stream.row = end;
+
+        if (stream.row == stream.batch->num_rows()) {
+          RETURN_NOT_OK(LoadNextBatch(&stream));
+        }
+        if (stream.batch) PushHeap(s);
+      }
+
+      if (runs.empty()) return IterationEnd<std::shared_ptr<RecordBatch>>();
+      if (runs.size() == 1) return std::move(runs[0]);
+
+      ArrayVector columns(schema->num_fields());
+      for (int i = 0; i < schema->num_fields(); ++i) {
+        ArrayVector chunks;
+        for (const auto& run : runs) chunks.push_back(run->column(i));
+        ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, pool));
+      }
+      return RecordBatch::Make(schema, num_rows, std::move(columns));
+    }
+
+    // heap is a min-heap of the indices of unexhausted streams by their current row
+    void PushHeap(int s) {
+      heap.push_back(s);
+      std::push_heap(heap.begin(), heap.end(), HeapOrder{this});
+    }
+
+    int PopHeap() {
+      std::pop_heap(heap.begin(), heap.end(), HeapOrder{this});
+      int s = heap.back();
+      heap.pop_back();
+      return s;
+    }
+
+    struct HeapOrder {
+      bool operator()(int l, int r) const {
+        return state->After(l, state->streams[l].row, r);
+      }
+      const State* state;
+    };
+
+    std::vector<Stream> streams;
+    std::vector<SortKeyIndex> sort_keys;
+    std::shared_ptr<Schema> schema;
+    int64_t batch_size;
+    MemoryPool* pool;
+    bool started = false;
+    std::vector<int> heap;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+Result<RecordBatchIterator> ScanFragmentsSorted(
+    const Dataset& dataset, FragmentIterator fragments,
+    const std::shared_ptr<ScanOptions>& options) {
+  if (dataset.sort_keys().empty()) {
+    return Status::Invalid("Sorted scan of a dataset which declares no sort keys");
+  }
+
+  std::vector<SortedMergeIterator::SortKeyIndex> sort_keys;
+  for (const auto& key : dataset.sort_keys()) {
+    int i = options->projected_schema->GetFieldIndex(key.name);
+    if (i == -1) {
+      return Status::Invalid("Sort key '", key.name,
+                             "' is not a column of the projected schema ",
+                             *options->projected_schema);
+    }
+    sort_keys.push_back({i, key.order});
+  }
+
+  std::vector<RecordBatchIterator> streams;
+  for (auto maybe_fragment : fragments) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, maybe_fragment);
+    ARROW_ASSIGN_OR_RAISE(
+        auto scan_task_it,
+        GetScanTaskIterator(MakeVectorIterator(FragmentVector{std::move(fragment)}),
+                            options));
+    auto execute = [](std::shared_ptr<ScanTask> task) { return task->Execute(); };
+    streams.push_back(
+        MakeFlattenIterator(MakeMaybeMapIterator(execute, std::move(scan_task_it))));
+  }
+
+  return RecordBatchIterator(SortedMergeIterator(std::move(streams), std::move(sort_keys),
+                                                 options->projected_schema,
+                                                 options->batch_size, options->pool));
+}
+
+}  // namespace
+
 Result<TaggedRecordBatchIterator> SyncScanner::ScanBatches() {
   // TODO(ARROW-11797) Provide a better implementation that does readahead.  Also, add
   // unit testing
@@ -182,6 +575,36 @@ Result<FragmentIterator> SyncScanner::GetFragments() {
   return GetFragmentsFromDatasets({dataset_}, scan_options_->filter);
 }
 
+Result<RecordBatchIterator> SyncScanner::ScanBatchesSorted() {
+  if (dataset_ == nullptr) {
+    return Status::NotImplemented("Sorted scan of a single fragment");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it, GetFragments());
+  return ScanFragmentsSorted(*dataset_, std::move(fragment_it), scan_options_);
+}
+
+Result<int64_t> SyncScanner::CountRows() {
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it, GetFragments());
+  ARROW_ASSIGN_OR_RAISE(auto fragments, fragment_it.ToVector());
+  ARROW_ASSIGN_OR_RAISE(auto count_options, MakeCountRowsOptions(*scan_options_));
+
+  FragmentVector to_scan;
+  ARROW_ASSIGN_OR_RAISE(int64_t total,
+                        CountRowsWithoutScanning(fragments, count_options, &to_scan));
+  ARROW_ASSIGN_OR_RAISE(
+      auto scan_task_it,
+      GetScanTaskIterator(MakeVectorIterator(std::move(to_scan)), count_options));
+  for (auto maybe_scan_task : scan_task_it) {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+    for (auto maybe_batch : batch_it) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+      total += batch->num_rows();
+    }
+  }
+  return total;
+}
+
 Result<ScanTaskIterator> SyncScanner::Scan() {
   // Transforms Iterator<Fragment> into a unified
   // Iterator<ScanTask>. The first Iterator::Next invocation is going to do
@@ -190,6 +613,495 @@ Result<ScanTaskIterator> SyncScanner::Scan() {
   return GetScanTaskIterator(std::move(fragment_it), scan_options_);
 }
 
+namespace {
+
+inline bool IsBefore(const EnumeratedRecordBatch& left,
+                     const EnumeratedRecordBatch& right) {
+  if (left.fragment.index != right.fragment.index) {
+    return left.fragment.index < right.fragment.index;
+  }
+  return left.record_batch.index < right.record_batch.index;
+}
+
+// A fragment which yields no batches is represented by a single empty batch, so that
+// ordered consumers can tell the fragment is exhausted. These are dropped again
+// before batches are handed to the user in order.
+inline bool IsEmptyFragmentMarker(const EnumeratedRecordBatch& batch) {
+  return batch.record_batch.index == 0 && batch.record_batch.last &&
+         batch.record_batch.value->num_rows() == 0;
+}
+
+Result<std::shared_ptr<RecordBatch>> MakeEmptyBatch(const std::shared_ptr<Schema>& schema) {
+  ArrayVector columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i],
+                          MakeArrayOfNull(schema->field(i)->type(), /*length=*/0));
+  }
+  return RecordBatch::Make(schema, 0, std::move(columns));
+}
+
+/// Tags the batches of a fragment with their position. One batch is held back so
+/// that the last batch of the fragment can be flagged as such.
+///
+/// Like the generators it is merged with, this is not async-reentrant.
+class FragmentBatchEnumerator {
+ public:
+  FragmentBatchEnumerator(RecordBatchGenerator source,
+                          Enumerated<std::shared_ptr<Fragment>> fragment,
+                          std::shared_ptr<Schema> schema)
+      : state_(std::make_shared<State>(std::move(source), std::move(fragment),
+                                       std::move(schema))) {}
+
+  Future<EnumeratedRecordBatch> operator()() {
+    auto state = state_;
+    if (state->finished) {
+      return AsyncGeneratorEnd<EnumeratedRecordBatch>();
+    }
+    if (state->pending != nullptr) {
+      return state->Advance();
+    }
+    return state->source().Then(
+        [state](const std::shared_ptr<RecordBatch>& first)
+            -> Future<EnumeratedRecordBatch> {
+          if (IsIterationEnd(first)) {
+            state->finished = true;
+            ARROW_ASSIGN_OR_RAISE(auto empty, MakeEmptyBatch(state->schema));
+            return Future<EnumeratedRecordBatch>::MakeFinished(
+                state->Tag(std::move(empty), /*last=*/true));
+          }
+          state->pending = first;
+          return state->Advance();
+        });
+  }
+
+ private:
+  struct State : std::enable_shared_from_this<State> {
+    State(RecordBatchGenerator source, Enumerated<std::shared_ptr<Fragment>> fragment,
+          std::shared_ptr<Schema> schema)
+        : source(std::move(source)),
+          fragment(std::move(fragment)),
+          schema(std::move(schema)) {}
+
+    EnumeratedRecordBatch Tag(std::shared_ptr<RecordBatch> batch, bool last) {
+      return EnumeratedRecordBatch{{std::move(batch), batch_index++, last}, fragment};
+    }
+
+    Future<EnumeratedRecordBatch> Advance() {
+      auto self = shared_from_this();
+      return source().Then([self](const std::shared_ptr<RecordBatch>& next) {
+        auto batch = std::move(self->pending);
+        if (IsIterationEnd(next)) {
+          self->finished = true;
+          return self->Tag(std::move(batch), /*last=*/true);
+        }
+        self->pending = next;
+        return self->Tag(std::move(batch), /*last=*/false);
+      });
+    }
+
+    RecordBatchGenerator source;
+    Enumerated<std::shared_ptr<Fragment>> fragment;
+    std::shared_ptr<Schema> schema;
+    std::shared_ptr<RecordBatch> pending;
+    int batch_index = 0;
+    bool finished = false;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+// Only the part of each buffer covered by the array is counted, so that slices of a
+// larger batch aren't charged for all of it.
+int64_t BufferSize(const ArrayData& data) {
+  const auto layout = data.type->layout();
+  int64_t size = 0;
+  for (size_t i = 0; i < data.buffers.size() && i < layout.buffers.size(); ++i) {
+    const auto& buffer = data.buffers[i];
+    if (buffer == nullptr) continue;
+    switch (layout.buffers[i].kind) {
+      case DataTypeLayout::BITMAP:
+        size += std::min(buffer->size(), BitUtil::BytesForBits(data.length));
+        break;
+      case DataTypeLayout::FIXED_WIDTH:
+        size += std::min(buffer->size(), layout.buffers[i].byte_width * data.length);
+        break;
+      default:
+        size += buffer->size();
+        break;
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += BufferSize(*data.dictionary);
+  }
+  return size;
+}
+
+// Empty batches are not counted at all so that the marker batches of empty
+// fragments need no special casing.
+int64_t InflightSize(const RecordBatch& batch) {
+  if (batch.num_rows() == 0) return 0;
+  int64_t size = 0;
+  for (const auto& column : batch.column_data()) {
+    size += BufferSize(*column);
+  }
+  return size;
+}
+
+/// Reads up to max_readahead batches ahead of the consumer, but only while the
+/// scanner's in-flight bytes are within budget.  Batches the consumer asks for are
+/// always requested, so a paused readahead resumes on the next request once the
+/// consumer has caught up.
+///
+/// Readahead requests are issued one at a time, so that each batch is accounted for
+/// before deciding whether to read another.  (The sources pulled from here don't
+/// yield batches concurrently anyway.)
+///
+/// Every batch passing through is added to the in-flight bytes; the scanner removes
+/// it again when the batch is handed to the user.
+///
+/// This generator is not async-reentrant.
+class InflightReadaheadGenerator {
+ public:
+  InflightReadaheadGenerator(RecordBatchGenerator source, int max_readahead,
+                             std::shared_ptr<std::atomic<int64_t>> inflight_bytes,
+                             int64_t max_inflight_bytes)
+      : state_(std::make_shared<State>(std::move(source), max_readahead,
+                                       std::move(inflight_bytes), max_inflight_bytes)) {}
+
+  Future<std::shared_ptr<RecordBatch>> operator()() {
+    auto guard = state_->mutex.Lock();
+    if (state_->queue.empty()) {
+      if (state_->finished.load()) {
+        return AsyncGeneratorEnd<std::shared_ptr<RecordBatch>>();
+      }
+      state_->queue.push_back(state_->Pull());
+    }
+    auto next = std::move(state_->queue.front());
+    state_->queue.pop_front();
+    state_->MaybeReadahead(std::move(guard));
+    return next;
+  }
+
+ private:
+  struct State : std::enable_shared_from_this<State> {
+    State(RecordBatchGenerator source, int max_readahead,
+          std::shared_ptr<std::atomic<int64_t>> inflight_bytes, int64_t max_inflight_bytes)
+        : source(std::move(source)),
+          max_readahead(max_readahead),
+          inflight_bytes(std::move(inflight_bytes)),
+          max_inflight_bytes(max_inflight_bytes) {}
+
+    // Must be called with the mutex held
+    Future<std::shared_ptr<RecordBatch>> Pull() {
+      auto self = shared_from_this();
+      return source().Then([self](const std::shared_ptr<RecordBatch>& batch) {
+        if (IsIterationEnd(batch)) {
+          // May run synchronously, with the mutex held
+          self->finished.store(true);
+        } else {
+          self->inflight_bytes->fetch_add(InflightSize(*batch));
+        }
+        return batch;
+      });
+    }
+
+    void MaybeReadahead(util::Mutex::Guard guard) {
+      if (reading_ahead || finished.load() ||
+          static_cast<int>(queue.size()) >= max_readahead ||
+          (max_inflight_bytes > 0 && inflight_bytes->load() >= max_inflight_bytes)) {
+        return;
+      }
+      reading_ahead = true;
+      auto next = Pull();
+      queue.push_back(next);
+      guard.Unlock();
+
+      auto self = shared_from_this();
+      next.AddCallback([self](const Result<std::shared_ptr<RecordBatch>>&) {
+        auto guard = self->mutex.Lock();
+        self->reading_ahead = false;
+        self->MaybeReadahead(std::move(guard));
+      });
+    }
+
+    RecordBatchGenerator source;
+    const int max_readahead;
+    std::shared_ptr<std::atomic<int64_t>> inflight_bytes;
+    const int64_t max_inflight_bytes;
+
+    util::Mutex mutex;
+    std::deque<Future<std::shared_ptr<RecordBatch>>> queue;
+    bool reading_ahead = false;
+    std::atomic<bool> finished{false};
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+/// Execute a scan task and filter/project its batches on the cpu executor.
+///
+/// Scan tasks which don't support async are read on the IO executor, one batch
+/// ahead of the readahead above them.
+Result<RecordBatchGenerator> ScanTaskToBatches(const std::shared_ptr<ScanTask>& task,
+                                               const BatchMapper& mapper,
+                                               const ScanOptions& options,
+                                               Executor* cpu_executor) {
+  RecordBatchGenerator gen;
+  if (task->supports_async()) {
+    ARROW_ASSIGN_OR_RAISE(gen, task->ExecuteAsync(cpu_executor));
+  } else {
+    // Defer Execute() so that opening the task also happens on the IO executor
+    auto batch_it = MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> task) { return task->Execute(); },
+        MakeVectorIterator(ScanTaskVector{task})));
+    if (options.use_threads) {
+      // Readahead (and its byte budget) is left to InflightReadaheadGenerator
+      ARROW_ASSIGN_OR_RAISE(gen, MakeBackgroundGenerator(std::move(batch_it),
+                                                         options.io_context.executor(),
+                                                         /*max_q=*/1, /*q_restart=*/0));
+      gen = MakeTransferredGenerator(std::move(gen), cpu_executor);
+    } else {
+      auto shared_it = std::make_shared<RecordBatchIterator>(std::move(batch_it));
+      gen = [shared_it]() {
+        return Future<std::shared_ptr<RecordBatch>>::MakeFinished(shared_it->Next());
+      };
+    }
+  }
+
+  return MakeMappedGenerator(std::move(gen), mapper);
+}
+
+Future<EnumeratedRecordBatchGenerator> FragmentToBatches(
+    const Enumerated<std::shared_ptr<Fragment>>& fragment,
+    const std::shared_ptr<ScanOptions>& options, Executor* cpu_executor,
+    const std::shared_ptr<std::atomic<int64_t>>& inflight_bytes) {
+  auto open_fragment = [fragment, options]() -> Result<ScanTaskVector> {
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, ScanFragment(fragment.value, options));
+    return scan_task_it.ToVector();
+  };
+
+  Future<ScanTaskVector> scan_tasks;
+  if (options->use_threads) {
+    auto* io_executor = options->io_context.executor();
+    scan_tasks = cpu_executor->Transfer(DeferNotOk(
+        io_executor->Submit(options->io_context.stop_token(), std::move(open_fragment))));
+  } else {
+    scan_tasks = Future<ScanTaskVector>::MakeFinished(open_fragment());
+  }
+
+  return scan_tasks.Then([fragment, options, cpu_executor,
+                          inflight_bytes](const ScanTaskVector& tasks)
+                             -> Result<EnumeratedRecordBatchGenerator> {
+    ARROW_ASSIGN_OR_RAISE(
+        auto mapper,
+        MakeFragmentBatchMapper(*options, fragment.value->partition_expression()));
+    std::function<Result<RecordBatchGenerator>(const std::shared_ptr<ScanTask>&)>
+        task_to_batches = [mapper, options, cpu_executor](
+                              const std::shared_ptr<ScanTask>& task) {
+          return ScanTaskToBatches(task, mapper, *options, cpu_executor);
+        };
+    // Scan tasks are only executed once the preceding one is exhausted
+    auto batches = MakeConcatenatedGenerator(
+        MakeMappedGenerator(MakeVectorGenerator(tasks), std::move(task_to_batches)));
+    const int max_readahead = options->use_threads ? options->batch_readahead : 0;
+    batches = InflightReadaheadGenerator(std::move(batches), max_readahead,
+                                         inflight_bytes, options->max_inflight_bytes);
+    return FragmentBatchEnumerator(std::move(batches), fragment,
+                                   options->projected_schema);
+  });
+}
+
+}  // namespace
+
+Result<FragmentVector> AsyncScanner::GetFragments() const {
+  // Fragments are cheap to enumerate (they are not opened until scanned), so the
+  // full list is gathered up front to learn which one is last.
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it,
+                        GetFragmentsFromDatasets({dataset_}, scan_options_->filter));
+  return fragment_it.ToVector();
+}
+
+Result<ScanTaskIterator> AsyncScanner::Scan() {
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it,
+                        GetFragmentsFromDatasets({dataset_}, scan_options_->filter));
+  return GetScanTaskIterator(std::move(fragment_it), scan_options_);
+}
+
+EnumeratedRecordBatchGenerator AsyncScanner::ReleaseInflightBytes(
+    EnumeratedRecordBatchGenerator batches) const {
+  auto inflight_bytes = inflight_bytes_;
+  std::function<EnumeratedRecordBatch(const EnumeratedRecordBatch&)> release =
+      [inflight_bytes](const EnumeratedRecordBatch& batch) {
+        inflight_bytes->fetch_sub(InflightSize(*batch.record_batch.value));
+        return batch;
+      };
+  return MakeMappedGenerator(std::move(batches), std::move(release));
+}
+
+Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
+    Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto unordered, ScanBatchesUnorderedAsyncImpl(cpu_executor));
+  return ReleaseInflightBytes(std::move(unordered));
+}
+
+Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsyncImpl(
+    Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  return ScanBatchesUnorderedAsyncImpl(std::move(fragments), scan_options_,
+                                       cpu_executor);
+}
+
+Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsyncImpl(
+    FragmentVector fragments, std::shared_ptr<ScanOptions> options,
+    Executor* cpu_executor) {
+  std::vector<Enumerated<std::shared_ptr<Fragment>>> enumerated(fragments.size());
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    enumerated[i] = {std::move(fragments[i]), static_cast<int>(i),
+                     i + 1 == fragments.size()};
+  }
+
+  auto inflight_bytes = inflight_bytes_;
+  std::function<Future<EnumeratedRecordBatchGenerator>(
+      const Enumerated<std::shared_ptr<Fragment>>&)>
+      fragment_to_batches = [options, cpu_executor, inflight_bytes](
+                                const Enumerated<std::shared_ptr<Fragment>>& fragment) {
+        return FragmentToBatches(fragment, options, cpu_executor, inflight_bytes);
+      };
+  auto batch_gen_gen = MakeMappedGenerator(MakeVectorGenerator(std::move(enumerated)),
+                                           std::move(fragment_to_batches));
+
+  const int max_subscriptions =
+      options->use_threads ? std::max(options->fragment_readahead, 1) : 1;
+  return MakeMergedGenerator(std::move(batch_gen_gen), max_subscriptions);
+}
+
+Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesAsync(
+    Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto unordered, ScanBatchesUnorderedAsyncImpl(cpu_executor));
+
+  auto comes_after = [](const EnumeratedRecordBatch& left,
+                        const EnumeratedRecordBatch& right) {
+    return IsBefore(right, left);
+  };
+  auto is_next = [](const EnumeratedRecordBatch& prev,
+                    const EnumeratedRecordBatch& next) {
+    if (prev.fragment.index == next.fragment.index) {
+      return prev.record_batch.index + 1 == next.record_batch.index;
+    }
+    return prev.record_batch.last && prev.fragment.index + 1 == next.fragment.index &&
+           next.record_batch.index == 0;
+  };
+  // Sentinel standing in for the last batch of fragment -1
+  EnumeratedRecordBatch before_first{{nullptr, -1, /*last=*/true}, {nullptr, -1, false}};
+  // Batches held back for ordering still count as in flight
+  return ReleaseInflightBytes(MakeSequencingGenerator(
+      std::move(unordered), comes_after, is_next, std::move(before_first)));
+}
+
+Result<TaggedRecordBatchIterator> AsyncScanner::ScanBatches() {
+  ARROW_ASSIGN_OR_RAISE(auto ordered, ScanBatchesAsync(scan_options_->cpu_executor));
+  Transformer<EnumeratedRecordBatch, TaggedRecordBatch> untag =
+      [](const EnumeratedRecordBatch& batch) -> Result<TransformFlow<TaggedRecordBatch>> {
+    if (IsEmptyFragmentMarker(batch)) {
+      return TransformSkip();
+    }
+    return TransformYield(
+        TaggedRecordBatch{batch.record_batch.value, batch.fragment.value});
+  };
+  return MakeGeneratorIterator(
+      MakeTransformedGenerator(std::move(ordered), std::move(untag)));
+}
+
+Result<EnumeratedRecordBatchIterator> AsyncScanner::ScanBatchesUnordered() {
+  ARROW_ASSIGN_OR_RAISE(auto unordered,
+                        ScanBatchesUnorderedAsync(scan_options_->cpu_executor));
+  return MakeGeneratorIterator(std::move(unordered));
+}
+
+Result<RecordBatchIterator> AsyncScanner::ScanBatchesSorted() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  return ScanFragmentsSorted(*dataset_, MakeVectorIterator(std::move(fragments)),
+                             scan_options_);
+}
+
+Result<int64_t> AsyncScanner::CountRows() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  ARROW_ASSIGN_OR_RAISE(auto count_options, MakeCountRowsOptions(*scan_options_));
+
+  FragmentVector to_scan;
+  ARROW_ASSIGN_OR_RAISE(int64_t total,
+                        CountRowsWithoutScanning(fragments, count_options, &to_scan));
+  if (to_scan.empty()) {
+    return total;
+  }
+
+  auto scanned = std::make_shared<std::atomic<int64_t>>(0);
+  RETURN_NOT_OK(internal::RunSynchronouslyVoid(
+      [&](Executor* executor) -> Future<> {
+        ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatchesUnorderedAsyncImpl(
+                                                std::move(to_scan), count_options,
+                                                executor));
+        std::function<Status(EnumeratedRecordBatch)> count =
+            [scanned](const EnumeratedRecordBatch& batch) {
+              scanned->fetch_add(batch.record_batch.value->num_rows());
+              return Status::OK();
+            };
+        return VisitAsyncGenerator(ReleaseInflightBytes(std::move(batches)),
+                                   std::move(count));
+      },
+      scan_options_->use_threads));
+  return total + scanned->load();
+}
+
+Result<std::shared_ptr<Table>> AsyncScanner::Head(int64_t num_rows) {
+  if (num_rows <= 0) {
+    return Scanner::Head(num_rows);
+  }
+  // Scan with a StopToken of our own, so that once the rows are read the fragments
+  // which readahead didn't open yet are not opened at all
+  StopSource stop_source;
+  auto head_options = std::make_shared<ScanOptions>(*scan_options_);
+  const auto& io_context = scan_options_->io_context;
+  head_options->io_context =
+      io::IOContext(io_context.pool(), io_context.executor(), stop_source.token(),
+                    io_context.external_id());
+  AsyncScanner head_scanner(dataset_, head_options);
+
+  ARROW_ASSIGN_OR_RAISE(auto batches, head_scanner.ScanBatches());
+  auto head = ReadHead(&batches, num_rows, scan_options_->projected_schema,
+                       io_context.stop_token());
+  stop_source.RequestStop();
+  return head;
+}
+
+Result<std::shared_ptr<Table>> AsyncScanner::ToTable() {
+  return internal::RunSynchronously<std::shared_ptr<Table>>(
+      [this](Executor* executor) { return ToTableAsync(executor); },
+      scan_options_->use_threads);
+}
+
+Future<std::shared_ptr<Table>> AsyncScanner::ToTableAsync(Executor* cpu_executor) {
+  ARROW_ASSIGN_OR_RAISE(auto unordered, ScanBatchesUnorderedAsync(cpu_executor));
+  auto scan_options = scan_options_;
+  return CollectAsyncGenerator(std::move(unordered))
+      .Then([scan_options](const std::vector<EnumeratedRecordBatch>& const_batches)
+                -> Result<std::shared_ptr<Table>> {
+        auto batches = const_batches;
+        std::sort(batches.begin(), batches.end(), IsBefore);
+        RecordBatchVector record_batches;
+        for (auto& batch : batches) {
+          if (!IsEmptyFragmentMarker(batch)) {
+            record_batches.push_back(std::move(batch.record_batch.value));
+          }
+        }
+        return Table::FromRecordBatches(scan_options->projected_schema,
+                                        std::move(record_batches));
+      });
+}
+
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options) {
@@ -250,6 +1162,21 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::UseAsync(bool use_async) {
+  scan_options_->use_async = use_async;
+  return Status::OK();
+}
+
+Status ScannerBuilder::UseGandiva(bool use_gandiva) {
+#ifndef ARROW_GANDIVA
+  if (use_gandiva) {
+    return Status::NotImplemented("Arrow was built without Gandiva");
+  }
+#endif
+  scan_options_->use_gandiva = use_gandiva;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchSize(int64_t batch_size) {
   if (batch_size <= 0) {
     return Status::Invalid("BatchSize must be greater than 0, got ", batch_size);
@@ -279,11 +1206,9 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() {
     return std::make_shared<SyncScanner>(fragment_, scan_options_);
   }
   if (scan_options_->use_async) {
-    // TODO(ARROW-12289)
-    return Status::NotImplemented("The asynchronous scanner is not yet available");
-  } else {
-    return std::make_shared<SyncScanner>(dataset_, scan_options_);
+    return std::make_shared<AsyncScanner>(dataset_, scan_options_);
   }
+  return std::make_shared<SyncScanner>(dataset_, scan_options_);
 }
 
 static inline RecordBatchVector FlattenRecordBatchVector(
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -46,6 +47,7 @@ namespace dataset {
 constexpr int64_t kDefaultBatchSize = 1 << 20;
 constexpr int32_t kDefaultBatchReadahead = 32;
 constexpr int32_t kDefaultFragmentReadahead = 8;
+constexpr int64_t kDefaultMaxInflightBytes = int64_t(1) << 30;
 
 struct ARROW_DS_EXPORT ScanOptions {
   // Filter and projection
@@ -87,8 +89,19 @@ struct ARROW_DS_EXPORT ScanOptions {
   ///
   /// Note: May not be enforced by all scanners
   /// Note: Will be ignored if use_threads is set to false
+  /// Note: The asynchronous scanner scans this many fragments concurrently
   int32_t fragment_readahead = kDefaultFragmentReadahead;
 
+  /// Budget, in bytes, for record batches which have been read but not yet consumed
+  ///
+  /// Once the batches read ahead exceed this budget readahead pauses until the
+  /// consumer catches up.  Batches the consumer is waiting for are always read, so
+  /// the budget may be exceeded by a couple of batches per fragment being scanned.
+  /// Set to 0 to disable the limit.
+  ///
+  /// Note: Only enforced by the asynchronous scanner
+  int64_t max_inflight_bytes = kDefaultMaxInflightBytes;
+
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
@@ -109,14 +122,28 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: This  must be true in order for any readahead to happen
   bool use_threads = false;
 
-  /// If true then an asycnhronous implementation of the scanner will be used.
-  /// This implementation is newer and generally performs better.  However, it
-  /// makes extensive use of threading and is still considered experimental
-  bool use_async = false;
+  /// If true then an asynchronous implementation of the scanner will be used.
+  ///
+  /// The asynchronous scanner opens fragments on the io_context executor and
+  /// decodes, filters and projects batches on the cpu_executor, reading ahead
+  /// across up to fragment_readahead fragments and batch_readahead batches per
+  /// fragment.  If false, every fragment is opened and read in turn.
+  bool use_async = true;
+
+  /// If true, filters and projections are evaluated with Gandiva where possible.
+  ///
+  /// Expressions (or batch schemas) Gandiva cannot handle fall back to the compute
+  /// kernels.  Requires Arrow to be built with ARROW_GANDIVA.
+  bool use_gandiva = false;
 
   /// Fragment-specific scan options.
   std::shared_ptr<FragmentScanOptions> fragment_scan_options;
 
+  /// A cache of decoded batches shared with other scans, see BatchCache.
+  ///
+  /// If null, fragments are read on every scan.
+  std::shared_ptr<BatchCache> batch_cache;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -130,9 +157,18 @@ struct ARROW_DS_EXPORT ScanOptions {
   // expression.
   //
   // This is used by Fragment implementations to apply the column
-  // sub-selection optimization.
+  // sub-selection optimization. A reference to a nested field reports its
+  // top-level field.
   std::vector<std::string> MaterializedFields() const;
 
+  // Return the references to the fields that require materialization, like
+  // MaterializedFields() but keeping references to nested fields, e.g. `a.b` in
+  // `SELECT a.b WHERE c > 1` => [FieldRef("c"), FieldRef("a", "b")].
+  //
+  // Nested references are made of names. Fragment implementations which can read
+  // a subset of the children of a struct use this to skip the others.
+  std::vector<FieldRef> MaterializedFieldRefs() const;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -212,6 +248,14 @@ using EnumeratedRecordBatchIterator = Iterator<EnumeratedRecordBatch>;
 
 }  // namespace dataset
 
+template <typename T>
+struct IterationTraits<dataset::Enumerated<T>> {
+  static dataset::Enumerated<T> End() {
+    return dataset::Enumerated<T>{IterationEnd<T>(), -1, false};
+  }
+  static bool IsEnd(const dataset::Enumerated<T>& val) { return val.index < 0; }
+};
+
 template <>
 struct IterationTraits<dataset::TaggedRecordBatch> {
   static dataset::TaggedRecordBatch End() {
@@ -287,6 +331,34 @@ class ARROW_DS_EXPORT Scanner {
   /// To make up for the out-of-order iteration each batch is further tagged with
   /// positional information.
   virtual Result<EnumeratedRecordBatchIterator> ScanBatchesUnordered();
+  /// \brief Scan the dataset into a stream of record batches in the order given by
+  /// Dataset::sort_keys.
+  ///
+  /// The rows of each fragment must already be sorted by those keys, which must be
+  /// columns of the projected schema.  Fragments are scanned side by side and their
+  /// batches merged on the fly, so only the current batch of each fragment is held in
+  /// memory.  A top-N or range query may stop consuming as soon as it has its rows.
+  ///
+  /// Nulls are sorted at the end, and NaNs at the end before them, regardless of order.
+  virtual Result<RecordBatchIterator> ScanBatchesSorted();
+  /// \brief Count the rows matching the filter.
+  ///
+  /// Fragments are first asked to count their rows without being scanned (see
+  /// Fragment::CountRows), e.g. from Parquet metadata when partition expressions and
+  /// statistics show whether row groups match the filter. The other fragments are
+  /// scanned, only reading the columns the filter references.
+  virtual Result<int64_t> CountRows() = 0;
+  /// \brief Load the first num_rows rows of the scan, in order, into a Table.
+  ///
+  /// Scanning stops once num_rows rows were read. Readahead which would read more
+  /// fragments is cancelled.
+  virtual Result<std::shared_ptr<Table>> Head(int64_t num_rows);
+  /// \brief Present the ordered scan (see ScanBatches) as a RecordBatchReader of the
+  /// projected schema.
+  ///
+  /// Unlike ToTable, batches are read lazily. The reader does not need the Scanner to
+  /// stay alive, so it can be handed to code which only knows RecordBatchReader.
+  Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader();
 
   const std::shared_ptr<ScanOptions>& options() const { return scan_options_; }
 
@@ -311,10 +383,14 @@ class ARROW_DS_EXPORT SyncScanner : public Scanner {
 
   Result<TaggedRecordBatchIterator> ScanBatches() override;
 
+  Result<RecordBatchIterator> ScanBatchesSorted() override;
+
   Result<ScanTaskIterator> Scan() override;
 
   Result<std::shared_ptr<Table>> ToTable() override;
 
+  Result<int64_t> CountRows() override;
+
  protected:
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
   Result<FragmentIterator> GetFragments();
@@ -325,6 +401,80 @@ class ARROW_DS_EXPORT SyncScanner : public Scanner {
   std::shared_ptr<Fragment> fragment_;
 };
 
+/// \brief A Scanner which reads ahead across fragments.
+///
+/// Fragments are opened on the IO executor of ScanOptions::io_context while
+/// record batches are filtered and projected on ScanOptions::cpu_executor, so
+/// that slow I/O on one fragment overlaps with decoding of the others.  Up to
+/// ScanOptions::fragment_readahead fragments are scanned concurrently.
+///
+/// Readahead is additionally bounded by ScanOptions::max_inflight_bytes: while the
+/// batches read but not yet consumed exceed it, fragments only read the batches
+/// the consumer is waiting for.
+///
+/// ScanBatchesUnordered yields batches as soon as they are ready, tagged with
+/// their fragment and batch indices.  ScanBatches and ToTable use those indices
+/// to restore the order the sequential scanner would have produced.
+class ARROW_DS_EXPORT AsyncScanner : public Scanner {
+ public:
+  AsyncScanner(std::shared_ptr<Dataset> dataset, std::shared_ptr<ScanOptions> scan_options)
+      : Scanner(std::move(scan_options)),
+        dataset_(std::move(dataset)),
+        inflight_bytes_(std::make_shared<std::atomic<int64_t>>(0)) {}
+
+  /// \brief Legacy ScanTask based scan, fragments are opened sequentially.
+  Result<ScanTaskIterator> Scan() override;
+
+  Result<TaggedRecordBatchIterator> ScanBatches() override;
+
+  Result<EnumeratedRecordBatchIterator> ScanBatchesUnordered() override;
+
+  Result<RecordBatchIterator> ScanBatchesSorted() override;
+
+  Result<std::shared_ptr<Table>> ToTable() override;
+
+  Result<int64_t> CountRows() override;
+
+  /// Fragments not yet opened when the rows are read are cancelled through the
+  /// StopToken of ScanOptions::io_context.
+  Result<std::shared_ptr<Table>> Head(int64_t num_rows) override;
+
+  /// \brief Scan the dataset, yielding batches in the order they become available.
+  ///
+  /// A fragment which yields no batches is reported as a single empty batch so
+  /// that consumers can still reassemble the batches in order.
+  Result<EnumeratedRecordBatchGenerator> ScanBatchesUnorderedAsync(
+      internal::Executor* cpu_executor);
+
+  /// \brief Scan the dataset, yielding batches in dataset order.
+  ///
+  /// Batches which arrive early are held back until all batches preceding them
+  /// have been yielded.
+  Result<EnumeratedRecordBatchGenerator> ScanBatchesAsync(
+      internal::Executor* cpu_executor);
+
+  /// \brief The bytes of record batches read by this scanner but not yet consumed.
+  ///
+  /// This is what ScanOptions::max_inflight_bytes is compared against.
+  int64_t inflight_bytes() const { return inflight_bytes_->load(); }
+
+ protected:
+  Result<FragmentVector> GetFragments() const;
+  Future<std::shared_ptr<Table>> ToTableAsync(internal::Executor* cpu_executor);
+
+  /// Batches yielded by this generator are still counted as in flight.
+  Result<EnumeratedRecordBatchGenerator> ScanBatchesUnorderedAsyncImpl(
+      internal::Executor* cpu_executor);
+  Result<EnumeratedRecordBatchGenerator> ScanBatchesUnorderedAsyncImpl(
+      FragmentVector fragments, std::shared_ptr<ScanOptions> options,
+      internal::Executor* cpu_executor);
+  EnumeratedRecordBatchGenerator ReleaseInflightBytes(
+      EnumeratedRecordBatchGenerator batches) const;
+
+  std::shared_ptr<Dataset> dataset_;
+  std::shared_ptr<std::atomic<int64_t>> inflight_bytes_;
+};
+
 /// \brief ScannerBuilder is a factory class to construct a Scanner. It is used
 /// to pass information, notably a potential filter expression and a subset of
 /// columns to materialize.
@@ -378,6 +528,13 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///        ThreadPool found in ScanOptions;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Indicate if the Scanner should use the asynchronous implementation.
+  Status UseAsync(bool use_async = true);
+
+  /// \brief Indicate if the Scanner should evaluate filters and projections with
+  ///        Gandiva.
+  Status UseGandiva(bool use_gandiva = true);
+
   /// \brief Set the maximum number of rows per RecordBatch.
   ///
   /// \param[in] batch_size the maximum number of rows.
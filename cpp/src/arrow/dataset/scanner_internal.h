@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -25,12 +27,18 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
+#include "arrow/dataset/batch_cache.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/config.h"
 #include "arrow/util/logging.h"
 
+#ifdef ARROW_GANDIVA
+#include "arrow/dataset/expression_gandiva.h"
+#endif
+
 namespace arrow {
 
 using internal::checked_cast;
@@ -38,37 +46,18 @@ using internal::Executor;
 
 namespace dataset {
 
-// TODO(ARROW-7001) This synchronous version is no longer needed, can use async version
-// regardless of sync/async of source
-inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it, Expression filter,
-                                             MemoryPool* pool) {
-  return MakeMaybeMapIterator(
-      [=](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
-        compute::ExecContext exec_context{pool};
-        ARROW_ASSIGN_OR_RAISE(Datum mask,
-                              ExecuteScalarExpression(filter, Datum(in), &exec_context));
-
-        if (mask.is_scalar()) {
-          const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
-          if (mask_scalar.is_valid && mask_scalar.value) {
-            return std::move(in);
-          }
-          return in->Slice(0, 0);
-        }
-
-        ARROW_ASSIGN_OR_RAISE(
-            Datum filtered,
-            compute::Filter(in, mask, compute::FilterOptions::Defaults(), &exec_context));
-        return filtered.record_batch();
-      },
-      std::move(it));
+// Compile an expression once for execution against every batch of a scan task
+inline Result<std::shared_ptr<CompiledExpression>> CompileForBatches(
+    Expression expr, MemoryPool* pool) {
+  compute::ExecContext exec_context{pool};
+  ARROW_ASSIGN_OR_RAISE(auto compiled,
+                        CompiledExpression::Make(std::move(expr), &exec_context));
+  return std::shared_ptr<CompiledExpression>(std::move(compiled));
 }
 
 inline Result<std::shared_ptr<RecordBatch>> DoFilterRecordBatch(
-    const Expression& filter, MemoryPool* pool, const std::shared_ptr<RecordBatch>& in) {
-  compute::ExecContext exec_context{pool};
-  ARROW_ASSIGN_OR_RAISE(Datum mask,
-                        ExecuteScalarExpression(filter, Datum(in), &exec_context));
+    CompiledExpression* filter, MemoryPool* pool, const std::shared_ptr<RecordBatch>& in) {
+  ARROW_ASSIGN_OR_RAISE(Datum mask, filter->Execute(Datum(in)));
 
   if (mask.is_scalar()) {
     const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
@@ -78,53 +67,42 @@ inline Result<std::shared_ptr<RecordBatch>> DoFilterRecordBatch(
     return in->Slice(0, 0);
   }
 
+  compute::ExecContext exec_context{pool};
   ARROW_ASSIGN_OR_RAISE(
       Datum filtered,
       compute::Filter(in, mask, compute::FilterOptions::Defaults(), &exec_context));
   return filtered.record_batch();
 }
 
-inline RecordBatchGenerator FilterRecordBatch(RecordBatchGenerator rbs, Expression filter,
-                                              MemoryPool* pool) {
-  // TODO(ARROW-7001) This changes to auto
-  std::function<Result<std::shared_ptr<RecordBatch>>(const std::shared_ptr<RecordBatch>&)>
-      mapper = [=](const std::shared_ptr<RecordBatch>& in) {
-        return DoFilterRecordBatch(filter, pool, in);
-      };
-  return MakeMappedGenerator(std::move(rbs), mapper);
-}
+using BatchMapper = std::function<Result<std::shared_ptr<RecordBatch>>(
+    const std::shared_ptr<RecordBatch>&)>;
 
-// TODO(ARROW-7001) This synchronous version is no longer needed, all branches use async
-// version
-inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
-                                              Expression projection, MemoryPool* pool) {
-  return MakeMaybeMapIterator(
-      [=](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
-        compute::ExecContext exec_context{pool};
-        ARROW_ASSIGN_OR_RAISE(Datum projected, ExecuteScalarExpression(
-                                                   projection, Datum(in), &exec_context));
-
-        DCHECK_EQ(projected.type()->id(), Type::STRUCT);
-        if (projected.shape() == ValueDescr::SCALAR) {
-          // Only virtual columns are projected. Broadcast to an array
-          ARROW_ASSIGN_OR_RAISE(
-              projected, MakeArrayFromScalar(*projected.scalar(), in->num_rows(), pool));
-        }
-
-        ARROW_ASSIGN_OR_RAISE(
-            auto out, RecordBatch::FromStructArray(projected.array_as<StructArray>()));
-
-        return out->ReplaceSchemaMetadata(in->schema()->metadata());
-      },
-      std::move(it));
+// Gandiva evaluates the batches it can, the compiled expression takes the rest
+inline Result<BatchMapper> MakeFilterMapper(Expression filter, MemoryPool* pool,
+                                            bool use_gandiva) {
+#ifdef ARROW_GANDIVA
+  std::shared_ptr<GandivaBatchFilter> gandiva_filter;
+  if (use_gandiva) {
+    gandiva_filter = std::make_shared<GandivaBatchFilter>(filter);
+  }
+#endif
+  ARROW_ASSIGN_OR_RAISE(auto compiled, CompileForBatches(std::move(filter), pool));
+  return [=](const std::shared_ptr<RecordBatch>& in)
+             -> Result<std::shared_ptr<RecordBatch>> {
+#ifdef ARROW_GANDIVA
+    if (gandiva_filter) {
+      ARROW_ASSIGN_OR_RAISE(auto out, gandiva_filter->Filter(in, pool));
+      if (out) return out;
+    }
+#endif
+    return DoFilterRecordBatch(compiled.get(), pool, in);
+  };
 }
 
 inline Result<std::shared_ptr<RecordBatch>> DoProjectRecordBatch(
-    const Expression& projection, MemoryPool* pool,
+    CompiledExpression* projection, MemoryPool* pool,
     const std::shared_ptr<RecordBatch>& in) {
-  compute::ExecContext exec_context{pool};
-  ARROW_ASSIGN_OR_RAISE(Datum projected,
-                        ExecuteScalarExpression(projection, Datum(in), &exec_context));
+  ARROW_ASSIGN_OR_RAISE(Datum projected, projection->Execute(Datum(in)));
   DCHECK_EQ(projected.type()->id(), Type::STRUCT);
   if (projected.shape() == ValueDescr::SCALAR) {
     // Only virtual columns are projected. Broadcast to an array
@@ -138,39 +116,70 @@ inline Result<std::shared_ptr<RecordBatch>> DoProjectRecordBatch(
   return out->ReplaceSchemaMetadata(in->schema()->metadata());
 }
 
-inline RecordBatchGenerator ProjectRecordBatch(RecordBatchGenerator rbs,
-                                               Expression projection, MemoryPool* pool) {
-  // TODO(ARROW-7001) This changes to auto
-  std::function<Result<std::shared_ptr<RecordBatch>>(const std::shared_ptr<RecordBatch>&)>
-      mapper = [=](const std::shared_ptr<RecordBatch>& in) {
-        return DoProjectRecordBatch(projection, pool, in);
-      };
-  return MakeMappedGenerator(std::move(rbs), mapper);
+inline Result<BatchMapper> MakeProjectMapper(Expression projection, MemoryPool* pool,
+                                             bool use_gandiva) {
+#ifdef ARROW_GANDIVA
+  std::shared_ptr<GandivaBatchProjector> gandiva_projector;
+  if (use_gandiva) {
+    gandiva_projector = std::make_shared<GandivaBatchProjector>(projection);
+  }
+#endif
+  ARROW_ASSIGN_OR_RAISE(auto compiled, CompileForBatches(std::move(projection), pool));
+  return [=](const std::shared_ptr<RecordBatch>& in)
+             -> Result<std::shared_ptr<RecordBatch>> {
+#ifdef ARROW_GANDIVA
+    if (gandiva_projector) {
+      ARROW_ASSIGN_OR_RAISE(auto out, gandiva_projector->Project(in, pool));
+      if (out) return out;
+    }
+#endif
+    return DoProjectRecordBatch(compiled.get(), pool, in);
+  };
+}
+
+/// \brief Make the mapper filtering then projecting the batches of a fragment.
+///
+/// The filter and projection are simplified against the fragment's partition
+/// expression and compiled once, then the mapper is shared by all of the fragment's
+/// scan tasks so that field lookups, casts to the dataset schema's types and the null
+/// columns of missing fields carry over from one batch to the next.
+inline Result<BatchMapper> MakeFragmentBatchMapper(const ScanOptions& options,
+                                                   const Expression& partition) {
+  ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
+                        SimplifyWithGuarantee(options.filter, partition));
+  ARROW_ASSIGN_OR_RAISE(Expression simplified_projection,
+                        SimplifyWithGuarantee(options.projection, partition));
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto filter,
+      MakeFilterMapper(std::move(simplified_filter), options.pool, options.use_gandiva));
+  ARROW_ASSIGN_OR_RAISE(auto project,
+                        MakeProjectMapper(std::move(simplified_projection), options.pool,
+                                          options.use_gandiva));
+  return [filter, project](const std::shared_ptr<RecordBatch>& in)
+             -> Result<std::shared_ptr<RecordBatch>> {
+    ARROW_ASSIGN_OR_RAISE(auto filtered, filter(in));
+    return project(filtered);
+  };
 }
 
 class FilterAndProjectScanTask : public ScanTask {
  public:
-  explicit FilterAndProjectScanTask(std::shared_ptr<ScanTask> task, Expression partition)
+  FilterAndProjectScanTask(std::shared_ptr<ScanTask> task, BatchMapper mapper)
       : ScanTask(task->options(), task->fragment()),
         task_(std::move(task)),
-        partition_(std::move(partition)) {}
+        mapper_(std::move(mapper)) {}
 
   bool supports_async() const override { return task_->supports_async(); }
 
+  // TODO(ARROW-7001) This synchronous version is no longer needed, can use async version
+  // regardless of sync/async of source
   Result<RecordBatchIterator> ExecuteSync() {
     ARROW_ASSIGN_OR_RAISE(auto it, task_->Execute());
-
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
-                          SimplifyWithGuarantee(options()->filter, partition_));
-
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_projection,
-                          SimplifyWithGuarantee(options()->projection, partition_));
-
-    RecordBatchIterator filter_it =
-        FilterRecordBatch(std::move(it), simplified_filter, options_->pool);
-
-    return ProjectRecordBatch(std::move(filter_it), simplified_projection,
-                              options_->pool);
+    auto mapper = mapper_;
+    return MakeMaybeMapIterator(
+        [mapper](std::shared_ptr<RecordBatch> in) { return mapper(in); },
+        std::move(it));
   }
 
   Result<RecordBatchIterator> Execute() override { return ExecuteSync(); }
@@ -182,39 +191,39 @@ class FilterAndProjectScanTask : public ScanTask {
           "source task did not support async");
     }
     ARROW_ASSIGN_OR_RAISE(auto gen, task_->ExecuteAsync(cpu_executor));
-
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
-                          SimplifyWithGuarantee(options()->filter, partition_));
-
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_projection,
-                          SimplifyWithGuarantee(options()->projection, partition_));
-
-    RecordBatchGenerator filter_gen =
-        FilterRecordBatch(std::move(gen), simplified_filter, options_->pool);
-
-    return ProjectRecordBatch(std::move(filter_gen), simplified_projection,
-                              options_->pool);
+    return MakeMappedGenerator(std::move(gen), mapper_);
   }
 
  private:
   std::shared_ptr<ScanTask> task_;
-  Expression partition_;
+  BatchMapper mapper_;
 };
 
+/// \brief Scan a fragment, through options->batch_cache if set.
+inline Result<ScanTaskIterator> ScanFragment(
+    const std::shared_ptr<Fragment>& fragment,
+    const std::shared_ptr<ScanOptions>& options) {
+  if (options->batch_cache != nullptr) {
+    return options->batch_cache->Scan(fragment, options);
+  }
+  return fragment->Scan(options);
+}
+
 /// \brief GetScanTaskIterator transforms an Iterator<Fragment> in a
 /// flattened Iterator<ScanTask>.
 inline Result<ScanTaskIterator> GetScanTaskIterator(
     FragmentIterator fragments, std::shared_ptr<ScanOptions> options) {
   // Fragment -> ScanTaskIterator
   auto fn = [options](std::shared_ptr<Fragment> fragment) -> Result<ScanTaskIterator> {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, fragment->Scan(options));
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, ScanFragment(fragment, options));
+    ARROW_ASSIGN_OR_RAISE(
+        auto mapper, MakeFragmentBatchMapper(*options, fragment->partition_expression()));
 
-    auto partition = fragment->partition_expression();
     // Apply the filter and/or projection to incoming RecordBatches by
     // wrapping the ScanTask with a FilterAndProjectScanTask
     auto wrap_scan_task =
-        [partition](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
-      return std::make_shared<FilterAndProjectScanTask>(std::move(task), partition);
+        [mapper](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
+      return std::make_shared<FilterAndProjectScanTask>(std::move(task), mapper);
     };
 
     return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
@@ -227,10 +236,19 @@ inline Result<ScanTaskIterator> GetScanTaskIterator(
   return MakeFlattenIterator(std::move(maybe_scantask_it));
 }
 
+// Fragments materialize fields by name (see ScanOptions::MaterializedFieldRefs), so
+// references to nested fields must be made of names, e.g. FieldRef("a", "b")
+inline bool IsNameOrNestedNames(const FieldRef& ref) {
+  if (ref.name()) return true;
+  auto nested_refs = ref.nested_refs();
+  return nested_refs != NULLPTR &&
+         std::all_of(nested_refs->begin(), nested_refs->end(),
+                     [](const FieldRef& nested) { return nested.name() != NULLPTR; });
+}
+
 inline Status NestedFieldRefsNotImplemented() {
-  // TODO(ARROW-11259) Several functions (for example, IpcScanTask::Make) assume that
-  // only top level fields will be materialized.
-  return Status::NotImplemented("Nested field references in scans.");
+  return Status::NotImplemented(
+      "Field references in scans other than names or nested names.");
 }
 
 inline Status SetProjection(ScanOptions* options, const Expression& projection) {
@@ -253,7 +271,7 @@ inline Status SetProjection(ScanOptions* options, std::vector<Expression> exprs,
 
   for (size_t i = 0; i < exprs.size(); ++i) {
     if (auto ref = exprs[i].field_ref()) {
-      if (!ref->name()) return NestedFieldRefsNotImplemented();
+      if (!IsNameOrNestedNames(*ref)) return NestedFieldRefsNotImplemented();
 
       // set metadata and nullability for plain field references
       ARROW_ASSIGN_OR_RAISE(auto field, ref->GetOne(*options->dataset_schema));
@@ -276,7 +294,7 @@ inline Status SetProjection(ScanOptions* options, std::vector<std::string> names
 
 inline Status SetFilter(ScanOptions* options, const Expression& filter) {
   for (const auto& ref : FieldsInExpression(filter)) {
-    if (!ref.name()) return NestedFieldRefsNotImplemented();
+    if (!IsNameOrNestedNames(ref)) return NestedFieldRefsNotImplemented();
 
     RETURN_NOT_OK(ref.FindOne(*options->dataset_schema));
   }
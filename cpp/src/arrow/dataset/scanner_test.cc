@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "arrow/dataset/scanner_internal.h"
@@ -159,6 +160,26 @@ TEST_F(TestScanner, MaterializeMissingColumn) {
   AssertScannerEqualsRepetitionsOf(scanner, batch_with_f64);
 }
 
+TEST_F(TestScanner, MaterializeEvolvedColumns) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  // The fragment has a narrower type for i32 and lacks f64
+  auto physical_batch =
+      ConstantArrayGenerator::Zeroes(kBatchSize, schema({field("i32", int16())}));
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{
+      static_cast<size_t>(kNumberChildDatasets * kNumberBatches), physical_batch});
+
+  ASSERT_OK_AND_ASSIGN(auto f64, MakeArrayOfNull(float64(), kBatchSize));
+  auto expected = RecordBatch::Make(
+      schema_, kBatchSize, {ConstantArrayGenerator::Int32(kBatchSize, 0), f64});
+
+  for (bool use_async : {false, true}) {
+    options_->use_async = use_async;
+    ScannerBuilder builder{schema_, fragment, options_};
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    AssertScanBatchesEqualRepetitionsOf(scanner, expected);
+  }
+}
+
 TEST_F(TestScanner, ToTable) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
@@ -181,6 +202,213 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, CountRows) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  const int64_t total_rows = kNumberChildDatasets * kNumberBatches * kBatchSize;
+
+  for (bool use_async : {false, true}) {
+    options_->use_async = use_async;
+    options_->filter = literal(true);
+    ASSERT_OK_AND_EQ(total_rows, MakeScanner(batch)->CountRows());
+
+    // In memory fragments have to be scanned to count the rows matching a filter
+    SetFilter(equal(field_ref("i32"), literal(0)));
+    ASSERT_OK_AND_EQ(total_rows, MakeScanner(batch)->CountRows());
+    SetFilter(equal(field_ref("i32"), literal(1)));
+    ASSERT_OK_AND_EQ(0, MakeScanner(batch)->CountRows());
+  }
+}
+
+TEST_F(TestScanner, InMemoryFragmentCountRows) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{batch, batch},
+                                                     equal(field_ref("i32"), literal(0)));
+
+  auto count_rows = [&](Expression filter) {
+    SetFilter(filter);
+    EXPECT_OK_AND_ASSIGN(auto count,
+                         fragment->CountRows(options_->filter, options_).result());
+    return count;
+  };
+  // The partition expression decides whether all rows match or none
+  ASSERT_EQ(count_rows(literal(true)), 2 * kBatchSize);
+  ASSERT_EQ(count_rows(equal(field_ref("i32"), literal(0))), 2 * kBatchSize);
+  ASSERT_EQ(count_rows(equal(field_ref("i32"), literal(1))), 0);
+  ASSERT_EQ(count_rows(greater(field_ref("f64"), literal(0.0))), util::nullopt);
+}
+
+TEST_F(TestScanner, Head) {
+  SetSchema({field("i32", int32())});
+  constexpr int kNumFragments = 16;
+
+  // One fragment per batch, each batch holding its own index
+  DatasetVector children;
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumFragments; ++i) {
+    auto batch = RecordBatch::Make(schema_, kBatchSize,
+                                   {ConstantArrayGenerator::Int32(kBatchSize, i)});
+    batches.push_back(batch);
+    children.push_back(
+        std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+  ASSERT_OK_AND_ASSIGN(auto all_rows, Table::FromRecordBatches(batches));
+
+  for (bool use_async : {false, true}) {
+    options_->use_async = use_async;
+    options_->use_threads = true;
+    options_->fragment_readahead = 4;
+    ScannerBuilder builder(dataset, options_);
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+    for (int64_t num_rows : {int64_t(0), int64_t(1), kBatchSize, kBatchSize * 5 / 2}) {
+      ASSERT_OK_AND_ASSIGN(auto head, scanner->Head(num_rows));
+      ASSERT_OK(head->ValidateFull());
+      AssertTablesEqual(*all_rows->Slice(0, num_rows), *head,
+                        /*same_chunk_layout=*/false);
+    }
+
+    // Asking for more rows than there are yields all of them
+    ASSERT_OK_AND_ASSIGN(auto head, scanner->Head(all_rows->num_rows() + 1));
+    AssertTablesEqual(*all_rows, *head, /*same_chunk_layout=*/false);
+
+    ASSERT_RAISES(Invalid, scanner->Head(-1));
+  }
+}
+
+TEST_F(TestScanner, ToRecordBatchReader) {
+  SetSchema({field("i32", int32())});
+  constexpr int kNumFragments = 8;
+
+  DatasetVector children;
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumFragments; ++i) {
+    auto batch = RecordBatch::Make(schema_, kBatchSize,
+                                   {ConstantArrayGenerator::Int32(kBatchSize, i)});
+    batches.push_back(batch);
+    children.push_back(
+        std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  for (bool use_async : {false, true}) {
+    options_->use_async = use_async;
+    options_->use_threads = true;
+    std::shared_ptr<RecordBatchReader> reader;
+    {
+      ScannerBuilder builder(dataset, options_);
+      ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+      ASSERT_OK_AND_ASSIGN(reader, scanner->ToRecordBatchReader());
+    }
+    // The reader outlives the scanner
+    AssertSchemaEqual(*schema_, *reader->schema());
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatchReader(reader.get()));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST_F(TestScanner, SyncScanBatches) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  options_->use_async = false;
+  auto scanner = MakeScanner(batch);
+  ASSERT_NE(dynamic_cast<SyncScanner*>(scanner.get()), nullptr);
+  AssertScanBatchesEqualRepetitionsOf(scanner, batch);
+}
+
+TEST_F(TestScanner, AsyncScanPreservesOrder) {
+  SetSchema({field("i32", int32())});
+  constexpr int kNumFragments = 64;
+
+  // One fragment per batch, each batch holding its own index. Every fourth child
+  // dataset yields no fragments at all.
+  DatasetVector children;
+  RecordBatchVector expected_batches;
+  for (int i = 0; i < kNumFragments; ++i) {
+    RecordBatchVector batches;
+    if (i % 4 != 3) {
+      auto batch = RecordBatch::Make(schema_, kBatchSize,
+                                     {ConstantArrayGenerator::Int32(kBatchSize, i)});
+      batches.push_back(batch);
+      expected_batches.push_back(batch);
+    }
+    children.push_back(std::make_shared<InMemoryDataset>(schema_, batches));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(expected_batches));
+
+  options_->use_threads = true;
+  options_->fragment_readahead = 8;
+  ScannerBuilder builder(dataset, options_);
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_NE(dynamic_cast<AsyncScanner*>(scanner.get()), nullptr);
+
+  ASSERT_OK_AND_ASSIGN(auto it, scanner->ScanBatches());
+  size_t num_batches = 0;
+  ASSERT_OK(it.Visit([&](TaggedRecordBatch batch) -> Status {
+    EXPECT_LT(num_batches, expected_batches.size());
+    AssertBatchesEqual(*expected_batches[num_batches++], *batch.record_batch);
+    return Status::OK();
+  }));
+  ASSERT_EQ(num_batches, expected_batches.size());
+
+  ASSERT_OK_AND_ASSIGN(auto unordered_it, scanner->ScanBatchesUnordered());
+  int64_t num_rows = 0;
+  ASSERT_OK(unordered_it.Visit([&](EnumeratedRecordBatch batch) -> Status {
+    EXPECT_EQ(batch.record_batch.index, 0);
+    EXPECT_TRUE(batch.record_batch.last);
+    num_rows += batch.record_batch.value->num_rows();
+    return Status::OK();
+  }));
+  ASSERT_EQ(num_rows, expected->num_rows());
+
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_F(TestScanner, AsyncScanMaxInflightBytes) {
+  SetSchema({field("i32", int32())});
+  constexpr int kNumFragments = 8;
+  constexpr int kBatchesPerFragment = 16;
+  const int64_t batch_bytes = kBatchSize * sizeof(int32_t);
+
+  // Each fragment holds a single large batch which is sliced into
+  // kBatchesPerFragment batches of kBatchSize rows.
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize * kBatchesPerFragment, schema_);
+  DatasetVector children{static_cast<size_t>(kNumFragments),
+                         std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch})};
+  ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+
+  options_->use_threads = true;
+  options_->batch_size = kBatchSize;
+  options_->fragment_readahead = 2;
+  options_->batch_readahead = kBatchesPerFragment;
+  options_->max_inflight_bytes = 1;
+  ScannerBuilder builder(dataset, options_);
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  auto async_scanner = dynamic_cast<AsyncScanner*>(scanner.get());
+  ASSERT_NE(async_scanner, nullptr);
+
+  ASSERT_OK_AND_ASSIGN(auto it, scanner->ScanBatchesUnordered());
+  int64_t num_batches = 0, max_inflight_bytes = 0;
+  ASSERT_OK(it.Visit([&](EnumeratedRecordBatch batch) -> Status {
+    ++num_batches;
+    SleepABit();
+    max_inflight_bytes = std::max(max_inflight_bytes, async_scanner->inflight_bytes());
+    return Status::OK();
+  }));
+  ASSERT_EQ(num_batches, kNumFragments * kBatchesPerFragment);
+
+  // Readahead is paused, so every fragment being scanned only holds the batch
+  // waiting to be consumed and the one being read ahead (plus some slack for
+  // batches in transit). Without a budget all kBatchesPerFragment would be read.
+  ASSERT_LE(max_inflight_bytes, 3 * options_->fragment_readahead * batch_bytes);
+  ASSERT_EQ(async_scanner->inflight_bytes(), 0);
+}
+
 class TestScannerNestedParallelism : public NestedParallelismMixin {};
 
 TEST_F(TestScannerNestedParallelism, Scan) {
@@ -236,8 +464,10 @@ TEST_F(TestScannerBuilder, TestProject) {
                                  call("multiply", {field_ref("i16"), literal(2)})},
                                 {"i16 renamed", "i16 * 2"}));
 
-  ASSERT_RAISES(NotImplemented, builder.Project({field_ref(FieldRef("nested", "column"))},
-                                                {"nested column"}));
+  ASSERT_RAISES(Invalid, builder.Project({field_ref(FieldRef("nested", "column"))},
+                                         {"nested column"}));
+  ASSERT_RAISES(NotImplemented,
+                builder.Project({field_ref(FieldRef(FieldPath({0})))}, {"i8"}));
 
   // provided more field names than column exprs or vice versa
   ASSERT_RAISES(Invalid, builder.Project({}, {"i16 renamed", "i16 * 2"}));
@@ -256,9 +486,10 @@ TEST_F(TestScannerBuilder, TestFilter) {
 
   ASSERT_RAISES(Invalid, builder.Filter(equal(field_ref("not_a_column"), literal(true))));
 
-  ASSERT_RAISES(
-      NotImplemented,
-      builder.Filter(equal(field_ref(FieldRef("nested", "column")), literal(true))));
+  ASSERT_RAISES(Invalid, builder.Filter(equal(field_ref(FieldRef("nested", "column")),
+                                               literal(true))));
+  ASSERT_RAISES(NotImplemented,
+                builder.Filter(equal(field_ref(FieldRef(FieldPath({0}))), literal(0))));
 
   ASSERT_RAISES(Invalid,
                 builder.Filter(or_(equal(field_ref("i64"), literal<int64_t>(10)),
@@ -309,6 +540,15 @@ TEST(ScanOptions, TestMaterializedFields) {
   // project i32, filter on i64 = materialize i32 & i64
   opts->filter = equal(field_ref("i64"), literal(10));
   EXPECT_THAT(opts->MaterializedFields(), ElementsAre("i64", "i32"));
+
+  // project s.i32, filter on s.i64 = materialize s (reported twice), or s.i64 & s.i32
+  // when keeping nested references
+  opts->dataset_schema = schema({i32, field("s", struct_({i32, i64}))});
+  ASSERT_OK(SetProjection(opts.get(), {field_ref(FieldRef("s", "i32"))}, {"s.i32"}));
+  opts->filter = equal(field_ref(FieldRef("s", "i64")), literal(10));
+  EXPECT_THAT(opts->MaterializedFields(), ElementsAre("s", "s"));
+  EXPECT_THAT(opts->MaterializedFieldRefs(),
+              ElementsAre(FieldRef("s", "i64"), FieldRef("s", "i32")));
 }
 
 }  // namespace dataset
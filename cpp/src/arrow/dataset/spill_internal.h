@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/array/data.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace dataset {
+namespace internal {
+
+// Helpers shared by the operators spilling data to a FileSystem (SortExternal,
+// GroupByExternal).
+
+// Upper bound of the memory held by some data: buffers shared between arrays, or only
+// partly referenced by slices, are counted in full.
+inline int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  if (data.dictionary) {
+    size += BufferSize(*data.dictionary);
+  }
+  return size;
+}
+
+inline int64_t BufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// A uniquely named directory for the spilled files of one operator, created on first
+// use and deleted with everything in it on destruction.
+class SpillDirectory {
+ public:
+  SpillDirectory(std::shared_ptr<fs::FileSystem> filesystem, const std::string& base_dir,
+                 const std::string& prefix)
+      : filesystem_(std::move(filesystem)),
+        path_(fs::internal::ConcatAbstractPath(
+            base_dir, prefix + std::to_string(::arrow::internal::GetRandomSeed()))) {}
+
+  ~SpillDirectory() {
+    if (created_) {
+      Status st = filesystem_->DeleteDir(path_);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "When trying to delete spill directory: " << st;
+      }
+    }
+  }
+
+  fs::FileSystem* filesystem() const { return filesystem_.get(); }
+
+  // Path of a new Arrow IPC stream file, e.g. "<dir>/run-3.arrows"
+  Result<std::string> NewFilePath(const std::string& prefix) {
+    if (!created_) {
+      RETURN_NOT_OK(filesystem_->CreateDir(path_));
+      created_ = true;
+    }
+    const std::string name = prefix + std::to_string(num_files_++) + ".arrows";
+    return fs::internal::ConcatAbstractPath(path_, name);
+  }
+
+ private:
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  const std::string path_;
+  bool created_ = false;
+  int64_t num_files_ = 0;
+};
+
+}  // namespace internal
+}  // namespace dataset
+}  // namespace arrow
@@ -48,6 +48,8 @@ using FragmentVector = std::vector<std::shared_ptr<Fragment>>;
 
 class FragmentScanOptions;
 
+class BatchCache;
+
 class FileSource;
 class FileFormat;
 class FileFragment;
@@ -72,6 +74,7 @@ class ParquetFileFragment;
 class ParquetFragmentScanOptions;
 class ParquetFileWriter;
 class ParquetFileWriteOptions;
+class ParquetMetadataCache;
 
 class Expression;
 
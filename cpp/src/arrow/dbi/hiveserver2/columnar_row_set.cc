@@ -17,12 +17,27 @@
 
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
+#include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
@@ -96,5 +111,328 @@ std::unique_ptr<BinaryColumn> ColumnarRowSet::GetBinaryCol(int i) const {
   return GetCol<BinaryColumn>(i);
 }
 
+// ----------------------------------------------------------------------
+// Decoding into Arrow arrays
+
+namespace {
+
+using internal::checked_cast;
+
+// Keeps the fetched results alive
+using ImplPtr = std::shared_ptr<const void>;
+
+// A Buffer viewing a vector of the fetched results
+template <typename T>
+class RowSetBuffer : public Buffer {
+ public:
+  RowSetBuffer(ImplPtr owner, const std::vector<T>& values)
+      : Buffer(reinterpret_cast<const uint8_t*>(values.data()),
+               static_cast<int64_t>(values.size() * sizeof(T))),
+        owner_(std::move(owner)) {}
+
+ private:
+  ImplPtr owner_;
+};
+
+// HiveServer2 sets the bits of null values, while Arrow sets the bits of valid ones.
+// Due to HUE-2722, 'nulls' may be shorter than the number of rows: the missing bits
+// are valid.
+Status DecodeNulls(const std::string& nulls, int64_t length, MemoryPool* pool,
+                   std::shared_ptr<Buffer>* out, int64_t* null_count) {
+  const auto nulls_data = reinterpret_cast<const uint8_t*>(nulls.data());
+  const int64_t nulls_length =
+      std::min(length, static_cast<int64_t>(nulls.size()) * 8);
+  *null_count = internal::CountSetBits(nulls_data, 0, nulls_length);
+  if (*null_count == 0) {
+    out->reset();
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateEmptyBitmap(length, pool));
+  uint8_t* validity_data = validity->mutable_data();
+  internal::InvertBitmap(nulls_data, 0, nulls_length, validity_data, 0);
+  BitUtil::SetBitsTo(validity_data, nulls_length, length - nulls_length, true);
+  *out = std::move(validity);
+  return Status::OK();
+}
+
+template <typename T>
+std::shared_ptr<ArrayData> MakeArrayData(std::shared_ptr<DataType> type,
+                                         const std::vector<T>& values,
+                                         std::shared_ptr<Buffer> validity,
+                                         int64_t null_count,
+                                         std::shared_ptr<Buffer> data) {
+  return ArrayData::Make(std::move(type), static_cast<int64_t>(values.size()),
+                         {std::move(validity), std::move(data)}, null_count);
+}
+
+// Integers and doubles: the values buffer views the fetched vector
+template <typename T>
+Status DecodePrimitive(const ImplPtr& impl, const std::shared_ptr<DataType>& type,
+                       const std::vector<T>& values, const std::string& nulls,
+                       MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(DecodeNulls(nulls, static_cast<int64_t>(values.size()), pool,
+                            &validity, &null_count));
+  *out = MakeArrayData(type, values, std::move(validity), null_count,
+                       std::make_shared<RowSetBuffer<T>>(impl, values));
+  return Status::OK();
+}
+
+Status DecodeFloat(const std::vector<double>& values, const std::string& nulls,
+                   MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  const auto length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(DecodeNulls(nulls, length, pool, &validity, &null_count));
+  ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(length * sizeof(float), pool));
+  std::copy(values.begin(), values.end(),
+            reinterpret_cast<float*>(data->mutable_data()));
+  *out = MakeArrayData(float32(), values, std::move(validity), null_count,
+                       std::move(data));
+  return Status::OK();
+}
+
+// std::vector<bool> is bit-packed, but its storage is not accessible
+Status DecodeBool(const std::vector<bool>& values, const std::string& nulls,
+                  MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  const auto length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(DecodeNulls(nulls, length, pool, &validity, &null_count));
+  ARROW_ASSIGN_OR_RAISE(auto data, AllocateEmptyBitmap(length, pool));
+  uint8_t* data_bits = data->mutable_data();
+  for (int64_t i = 0; i < length; ++i) {
+    if (values[i]) {
+      BitUtil::SetBit(data_bits, i);
+    }
+  }
+  *out = MakeArrayData(boolean(), values, std::move(validity), null_count,
+                       std::move(data));
+  return Status::OK();
+}
+
+Status DecodeString(const std::shared_ptr<DataType>& type,
+                    const std::vector<std::string>& values, const std::string& nulls,
+                    MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  const auto length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(DecodeNulls(nulls, length, pool, &validity, &null_count));
+
+  int64_t data_length = 0;
+  for (const auto& value : values) {
+    data_length += static_cast<int64_t>(value.size());
+  }
+  if (data_length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Fetched string column of ", data_length,
+                                 " bytes is too large for ", type->ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto offsets,
+                        AllocateBuffer((length + 1) * sizeof(int32_t), pool));
+  ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(data_length, pool));
+  auto offsets_data = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  uint8_t* data_data = data->mutable_data();
+  int32_t offset = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const std::string& value = values[i];
+    offsets_data[i] = offset;
+    std::memcpy(data_data + offset, value.data(), value.size());
+    offset += static_cast<int32_t>(value.size());
+  }
+  offsets_data[length] = offset;
+  *out = ArrayData::Make(type, length,
+                         {std::move(validity), std::move(offsets), std::move(data)},
+                         null_count);
+  return Status::OK();
+}
+
+Status DecodeDecimal(const std::shared_ptr<DataType>& type,
+                     const std::vector<std::string>& values, const std::string& nulls,
+                     MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  const auto length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(DecodeNulls(nulls, length, pool, &validity, &null_count));
+
+  const int32_t scale = checked_cast<const Decimal128Type&>(*type).scale();
+  ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(length * sizeof(Decimal128), pool));
+  auto data_data = reinterpret_cast<Decimal128*>(data->mutable_data());
+  const uint8_t* validity_data = validity ? validity->data() : nullptr;
+  for (int64_t i = 0; i < length; ++i) {
+    if (validity_data != nullptr && !BitUtil::GetBit(validity_data, i)) {
+      data_data[i] = Decimal128();
+      continue;
+    }
+    Decimal128 value;
+    int32_t value_precision, value_scale;
+    RETURN_NOT_OK(
+        Decimal128::FromString(values[i], &value, &value_precision, &value_scale));
+    if (value_scale != scale) {
+      ARROW_ASSIGN_OR_RAISE(value, value.Rescale(value_scale, scale));
+    }
+    data_data[i] = value;
+  }
+  *out = MakeArrayData(type, values, std::move(validity), null_count, std::move(data));
+  return Status::OK();
+}
+
+Status TypeMismatch(const Field& field) {
+  return Status::TypeError("Fetched column '", field.name(),
+                           "' cannot be decoded as ", field.type()->ToString());
+}
+
+}  // namespace
+
+int64_t ColumnarRowSet::num_rows() const {
+  const auto& columns = impl_->resp.results.columns;
+  if (columns.empty()) {
+    return 0;
+  }
+  const hs2::TColumn& col = columns[0];
+  if (col.__isset.boolVal) return static_cast<int64_t>(col.boolVal.values.size());
+  if (col.__isset.byteVal) return static_cast<int64_t>(col.byteVal.values.size());
+  if (col.__isset.i16Val) return static_cast<int64_t>(col.i16Val.values.size());
+  if (col.__isset.i32Val) return static_cast<int64_t>(col.i32Val.values.size());
+  if (col.__isset.i64Val) return static_cast<int64_t>(col.i64Val.values.size());
+  if (col.__isset.doubleVal) return static_cast<int64_t>(col.doubleVal.values.size());
+  if (col.__isset.stringVal) return static_cast<int64_t>(col.stringVal.values.size());
+  if (col.__isset.binaryVal) return static_cast<int64_t>(col.binaryVal.values.size());
+  return 0;
+}
+
+Status ColumnarRowSet::ToRecordBatch(const std::shared_ptr<Schema>& schema,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatch>* out) const {
+  const auto& columns = impl_->resp.results.columns;
+  if (static_cast<int>(columns.size()) != schema->num_fields()) {
+    return Status::Invalid("Fetched ", columns.size(), " columns but the schema has ",
+                           schema->num_fields(), " fields");
+  }
+
+  const int64_t length = num_rows();
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    const hs2::TColumn& col = columns[i];
+    const Field& field = *schema->field(i);
+    const std::shared_ptr<DataType>& type = field.type();
+    switch (type->id()) {
+      case Type::BOOL:
+        if (!col.__isset.boolVal) return TypeMismatch(field);
+        RETURN_NOT_OK(
+            DecodeBool(col.boolVal.values, col.boolVal.nulls, pool, &arrays[i]));
+        break;
+      case Type::INT8:
+        if (!col.__isset.byteVal) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodePrimitive(impl_, type, col.byteVal.values, col.byteVal.nulls,
+                                      pool, &arrays[i]));
+        break;
+      case Type::INT16:
+        if (!col.__isset.i16Val) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodePrimitive(impl_, type, col.i16Val.values, col.i16Val.nulls,
+                                      pool, &arrays[i]));
+        break;
+      case Type::INT32:
+        if (!col.__isset.i32Val) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodePrimitive(impl_, type, col.i32Val.values, col.i32Val.nulls,
+                                      pool, &arrays[i]));
+        break;
+      case Type::INT64:
+        if (!col.__isset.i64Val) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodePrimitive(impl_, type, col.i64Val.values, col.i64Val.nulls,
+                                      pool, &arrays[i]));
+        break;
+      case Type::FLOAT:
+        if (!col.__isset.doubleVal) return TypeMismatch(field);
+        RETURN_NOT_OK(
+            DecodeFloat(col.doubleVal.values, col.doubleVal.nulls, pool, &arrays[i]));
+        break;
+      case Type::DOUBLE:
+        if (!col.__isset.doubleVal) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodePrimitive(impl_, type, col.doubleVal.values,
+                                      col.doubleVal.nulls, pool, &arrays[i]));
+        break;
+      case Type::STRING:
+      case Type::BINARY:
+        if (col.__isset.stringVal) {
+          RETURN_NOT_OK(DecodeString(type, col.stringVal.values, col.stringVal.nulls,
+                                     pool, &arrays[i]));
+        } else if (col.__isset.binaryVal) {
+          RETURN_NOT_OK(DecodeString(type, col.binaryVal.values, col.binaryVal.nulls,
+                                     pool, &arrays[i]));
+        } else {
+          return TypeMismatch(field);
+        }
+        break;
+      case Type::DECIMAL128:
+        if (!col.__isset.stringVal) return TypeMismatch(field);
+        RETURN_NOT_OK(DecodeDecimal(type, col.stringVal.values, col.stringVal.nulls,
+                                    pool, &arrays[i]));
+        break;
+      default:
+        return Status::NotImplemented("Decoding fetched results as ", type->ToString());
+    }
+    if (arrays[i]->length != length) {
+      return Status::Invalid("Fetched column '", field.name(), "' has ",
+                             arrays[i]->length, " rows, expected ", length);
+    }
+  }
+  *out = RecordBatch::Make(schema, length, std::move(arrays));
+  return Status::OK();
+}
+
+Status ColumnDescsToArrowSchema(const std::vector<ColumnDesc>& column_descs,
+                                std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(column_descs.size());
+  for (const ColumnDesc& column_desc : column_descs) {
+    std::shared_ptr<DataType> type;
+    switch (column_desc.type()->type_id()) {
+      case ColumnType::TypeId::BOOLEAN:
+        type = boolean();
+        break;
+      case ColumnType::TypeId::TINYINT:
+        type = int8();
+        break;
+      case ColumnType::TypeId::SMALLINT:
+        type = int16();
+        break;
+      case ColumnType::TypeId::INT:
+        type = int32();
+        break;
+      case ColumnType::TypeId::BIGINT:
+        type = int64();
+        break;
+      case ColumnType::TypeId::FLOAT:
+        type = float32();
+        break;
+      case ColumnType::TypeId::DOUBLE:
+        type = float64();
+        break;
+      case ColumnType::TypeId::DECIMAL: {
+        const DecimalType* decimal_type = column_desc.GetDecimalType();
+        type = decimal(decimal_type->precision(), decimal_type->scale());
+        break;
+      }
+      case ColumnType::TypeId::BINARY:
+        type = binary();
+        break;
+      case ColumnType::TypeId::STRING:
+      case ColumnType::TypeId::VARCHAR:
+      case ColumnType::TypeId::CHAR:
+      case ColumnType::TypeId::TIMESTAMP:
+      case ColumnType::TypeId::DATE:
+        type = utf8();
+        break;
+      default:
+        return Status::NotImplemented("Decoding column '", column_desc.column_name(),
+                                      "' of type ", column_desc.type()->ToString());
+    }
+    fields.push_back(field(column_desc.column_name(), std::move(type)));
+  }
+  *out = schema(std::move(fields));
+  return Status::OK();
+}
+
 }  // namespace hiveserver2
 }  // namespace arrow
@@ -22,12 +22,18 @@
 #include <string>
 #include <vector>
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class Status;
+
 namespace hiveserver2 {
 
+class ColumnDesc;
+
 // The Column class is used to access data that was fetched in columnar format.
 // The contents of the data can be accessed through the data() fn, which returns
 // a ptr to a vector containing the contents of this column in the fetched
@@ -137,6 +143,16 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Returns the number of rows in this set of results.
+  int64_t num_rows() const;
+
+  // Decodes the results into a RecordBatch of the given schema, which is usually
+  // obtained from ColumnDescsToArrowSchema. The buffers of integer and double columns
+  // are not copied: they share ownership of the fetched results with this
+  // ColumnarRowSet, which may be destroyed before the RecordBatch.
+  Status ToRecordBatch(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
@@ -148,8 +164,20 @@ class ARROW_EXPORT ColumnarRowSet {
 
   explicit ColumnarRowSet(ColumnarRowSetImpl* impl);
 
-  std::unique_ptr<ColumnarRowSetImpl> impl_;
+  std::shared_ptr<ColumnarRowSetImpl> impl_;
 };
 
+// Sets 'out' to the Arrow schema that results with the given columns are decoded as
+// by ColumnarRowSet::ToRecordBatch. Types are mapped as follows:
+//
+//   BOOLEAN -> boolean, TINYINT -> int8, SMALLINT -> int16, INT -> int32,
+//   BIGINT -> int64, FLOAT -> float32, DOUBLE -> float64, DECIMAL -> decimal128,
+//   BINARY -> binary, STRING, VARCHAR and CHAR -> utf8
+//
+// TIMESTAMP and DATE values are sent as strings by HiveServer2, and are decoded as
+// utf8 as well. Other types are not supported.
+ARROW_EXPORT Status ColumnDescsToArrowSchema(const std::vector<ColumnDesc>& column_descs,
+                                             std::shared_ptr<Schema>* out);
+
 }  // namespace hiveserver2
 }  // namespace arrow
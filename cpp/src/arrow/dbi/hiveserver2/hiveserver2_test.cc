@@ -28,6 +28,7 @@
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -279,6 +280,39 @@ TEST_F(OperationTest, TestIsNull) {
   ASSERT_OK(select_nulls_op->Close());
 }
 
+TEST_F(OperationTest, TestRecordBatchReader) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, 4, 5, NULL_INT_VALUE}),
+                      std::vector<std::string>({"a", "b", "NULL", "d", "NULL", "f"}));
+
+  std::unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+  ASSERT_OK(Wait(select_op));
+
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(select_op->GetRecordBatchReader(2, default_memory_pool(), &reader));
+  auto expected_schema = schema({field(TEST_COL1, int32()), field(TEST_COL2, utf8())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::vector<std::string> expected_batches = {R"([[1, "a"], [2, "b"]])",
+                                               R"([[3, null], [4, "d"]])",
+                                               R"([[5, null], [null, "f"]])"};
+  for (const auto& expected : expected_batches) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_NE(batch, nullptr);
+    ASSERT_OK(batch->ValidateFull());
+    AssertBatchesEqual(*RecordBatchFromJSON(expected_schema, expected), *batch);
+  }
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  reader.reset();
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestCancel) {
   CreateTestTable();
   InsertIntoTestTable(std::vector<int>({1, 2, 3, 4}),
@@ -22,9 +22,14 @@
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/io/util_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
 using std::unique_ptr;
@@ -113,6 +118,80 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+namespace {
+
+// The results of a single call to Operation::Fetch
+struct FetchedPage {
+  std::shared_ptr<ColumnarRowSet> results;
+  bool has_more_rows;
+};
+
+// Decodes each page of results while the next one is fetched on the IO thread pool
+class OperationBatchReader : public RecordBatchReader {
+ public:
+  OperationBatchReader(const Operation* operation, int max_rows, MemoryPool* pool,
+                       std::shared_ptr<Schema> schema)
+      : operation_(operation),
+        max_rows_(max_rows),
+        pool_(pool),
+        schema_(std::move(schema)),
+        pending_(FetchNext()) {}
+
+  ~OperationBatchReader() override {
+    // The pending fetch uses the operation, which may be closed once we are gone
+    if (pending_.is_valid()) {
+      pending_.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (pending_.is_valid()) {
+      ARROW_ASSIGN_OR_RAISE(FetchedPage page, pending_.result());
+      pending_ = page.has_more_rows ? FetchNext() : Future<FetchedPage>();
+      if (page.results->num_rows() > 0) {
+        return page.results->ToRecordBatch(schema_, pool_, out);
+      }
+    }
+    out->reset();
+    return Status::OK();
+  }
+
+ private:
+  Future<FetchedPage> FetchNext() const {
+    const Operation* operation = operation_;
+    const int max_rows = max_rows_;
+    return DeferNotOk(io::internal::GetIOThreadPool()->Submit(
+        [operation, max_rows]() -> Result<FetchedPage> {
+          std::unique_ptr<ColumnarRowSet> results;
+          FetchedPage page;
+          RETURN_NOT_OK(operation->Fetch(max_rows, FetchOrientation::NEXT, &results,
+                                         &page.has_more_rows));
+          page.results = std::move(results);
+          return page;
+        }));
+  }
+
+  const Operation* operation_;
+  const int max_rows_;
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> schema_;
+  Future<FetchedPage> pending_;
+};
+
+}  // namespace
+
+Status Operation::GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                                       std::shared_ptr<RecordBatchReader>* out) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(ColumnDescsToArrowSchema(column_descs, &schema));
+  *out = std::make_shared<OperationBatchReader>(this, max_rows, pool, std::move(schema));
+  return Status::OK();
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
@@ -24,6 +24,7 @@
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 #include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -91,6 +92,14 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Returns a reader yielding the remaining results of this operation as Arrow record
+  // batches of at most max_rows rows, see ColumnarRowSet::ToRecordBatch. Fetching is
+  // pipelined: while a batch is decoded by ReadNext, the next one is fetched in the
+  // background, so no other function may be called on this operation until the reader
+  // is exhausted or destroyed. The reader must be destroyed before Close is called.
+  Status GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                              std::shared_ptr<RecordBatchReader>* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
@@ -19,6 +19,7 @@
 
 #include "arrow/util/config.h"  // IWYU pragma: export
 
+#include "arrow/filesystem/cachingfs.h"   // IWYU pragma: export
 #include "arrow/filesystem/filesystem.h"  // IWYU pragma: export
 #include "arrow/filesystem/hdfs.h"        // IWYU pragma: export
 #include "arrow/filesystem/localfs.h"     // IWYU pragma: export
@@ -0,0 +1,695 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+
+namespace fs {
+
+BlockCacheOptions BlockCacheOptions::Defaults() { return BlockCacheOptions(); }
+
+namespace {
+
+// The size and modification time of a file, as reported by the base filesystem.
+// Cached blocks are only valid for the version of the file they were read from.
+struct FileVersion {
+  int64_t size;
+  TimePoint mtime;
+
+  bool operator==(const FileVersion& other) const {
+    return size == other.size && mtime == other.mtime;
+  }
+  bool operator!=(const FileVersion& other) const { return !(*this == other); }
+};
+
+struct BlockKey {
+  std::string path;
+  int64_t index;
+
+  bool operator==(const BlockKey& other) const {
+    return index == other.index && path == other.path;
+  }
+};
+
+struct BlockKeyHash {
+  size_t operator()(const BlockKey& key) const {
+    size_t h = std::hash<std::string>()(key.path);
+    ::arrow::internal::hash_combine(h, key.index);
+    return h;
+  }
+};
+
+Status WriteLocalFile(const PlatformFilename& fn, const Buffer& data) {
+  ARROW_ASSIGN_OR_RAISE(int fd, ::arrow::internal::FileOpenWritable(fn));
+  auto st = ::arrow::internal::FileWrite(fd, data.data(), data.size());
+  auto close_st = ::arrow::internal::FileClose(fd);
+  RETURN_NOT_OK(st);
+  return close_st;
+}
+
+Result<std::shared_ptr<Buffer>> ReadLocalFile(const PlatformFilename& fn, int64_t size,
+                                              MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(int fd, ::arrow::internal::FileOpenReadable(fn));
+  auto maybe_buffer = AllocateBuffer(size, pool);
+  Result<int64_t> maybe_nbytes = 0;
+  if (maybe_buffer.ok()) {
+    maybe_nbytes = ::arrow::internal::FileReadAt(
+        fd, (*maybe_buffer)->mutable_data(), /*position=*/0, size);
+  }
+  RETURN_NOT_OK(::arrow::internal::FileClose(fd));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, std::move(maybe_buffer));
+  ARROW_ASSIGN_OR_RAISE(int64_t nbytes, maybe_nbytes);
+  if (nbytes != size) {
+    return Status::IOError("Cached block '", fn.ToString(), "' is truncated");
+  }
+  return buffer;
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Block cache implementation
+
+// A LRU cache of file blocks with a memory tier and an optional local disk tier.
+//
+// Blocks are written to both tiers when they are put in the cache, and
+// each tier evicts its least recently used blocks independently.  A block
+// read from disk is put back in memory.
+class CachingFileSystem::BlockCache {
+ public:
+  BlockCache(const BlockCacheOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool) {}
+
+  ~BlockCache() {
+    if (has_local_tier()) {
+      auto st = ::arrow::internal::DeleteDirTree(local_dir_).status();
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to delete block cache directory '"
+                           << local_dir_.ToString() << "': " << st.ToString();
+      }
+    }
+  }
+
+  static Result<std::shared_ptr<BlockCache>> Make(const BlockCacheOptions& options,
+                                                  MemoryPool* pool) {
+    if (options.block_size <= 0) {
+      return Status::Invalid("Block cache block size must be positive");
+    }
+    if (options.memory_capacity < 0 || options.local_capacity < 0) {
+      return Status::Invalid("Block cache capacity must be non-negative");
+    }
+    auto cache = std::make_shared<BlockCache>(options, pool);
+    if (!options.local_directory.empty() && options.local_capacity > 0) {
+      RETURN_NOT_OK(cache->MakeLocalDirectory());
+    }
+    return cache;
+  }
+
+  int64_t block_size() const { return options_.block_size; }
+
+  MemoryPool* pool() const { return pool_; }
+
+  // Return the cached block, or null if not cached
+  std::shared_ptr<Buffer> Get(const BlockKey& key, const FileVersion& version) {
+    std::vector<PlatformFilename> deleted;
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    Entry& entry = it->second;
+    if (entry.version != version) {
+      ++stats_.invalidations;
+      Drop(it, &deleted);
+      lock.unlock();
+      DeleteLocalFiles(deleted);
+      return nullptr;
+    }
+    if (entry.data != nullptr) {
+      memory_lru_.splice(memory_lru_.begin(), memory_lru_, entry.memory_lru);
+      if (entry.on_disk) {
+        local_lru_.splice(local_lru_.begin(), local_lru_, entry.local_lru);
+      }
+      ++stats_.memory_hits;
+      stats_.hit_bytes += entry.size;
+      return entry.data;
+    }
+
+    // Only on disk: read it without holding the lock.  The file may be
+    // deleted concurrently, in which case the block is fetched again.
+    DCHECK(entry.on_disk);
+    local_lru_.splice(local_lru_.begin(), local_lru_, entry.local_lru);
+    const auto local_file = entry.local_file;
+    const auto size = entry.size;
+    lock.unlock();
+
+    auto maybe_data = ReadLocalFile(local_file, size, pool_);
+    if (!maybe_data.ok()) {
+      return nullptr;
+    }
+    auto data = *std::move(maybe_data);
+
+    lock.lock();
+    ++stats_.local_hits;
+    stats_.hit_bytes += size;
+    it = entries_.find(key);
+    if (it != entries_.end() && it->second.on_disk && it->second.data == nullptr &&
+        it->second.local_file == local_file) {
+      InsertInMemory(it, data);
+    }
+    return data;
+  }
+
+  // Cache a block, replacing any cached version of it
+  void Put(const BlockKey& key, const FileVersion& version,
+           const std::shared_ptr<Buffer>& data) {
+    const int64_t size = data->size();
+    const bool in_memory = size <= options_.memory_capacity;
+    PlatformFilename local_file;
+    bool on_disk = false;
+    if (has_local_tier() && size <= options_.local_capacity) {
+      // Write outside of the lock, under a unique name
+      auto st = local_dir_.Join(std::to_string(next_file_id_++)).Value(&local_file);
+      if (st.ok()) {
+        st = WriteLocalFile(local_file, *data);
+      }
+      if (st.ok()) {
+        on_disk = true;
+      } else {
+        ARROW_LOG(WARNING) << "Failed to write block to local cache: " << st.ToString();
+      }
+    }
+
+    std::vector<PlatformFilename> deleted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        Drop(it, &deleted);
+      }
+      if (in_memory || on_disk) {
+        it = entries_.emplace(key, Entry{}).first;
+        it->second.version = version;
+        it->second.size = size;
+        if (on_disk) {
+          local_lru_.push_front(&it->first);
+          it->second.local_lru = local_lru_.begin();
+          it->second.local_file = std::move(local_file);
+          it->second.on_disk = true;
+          stats_.local_bytes += size;
+          EvictLocal(&deleted);
+        }
+        if (in_memory) {
+          InsertInMemory(it, data);
+        }
+      }
+    }
+    DeleteLocalFiles(deleted);
+  }
+
+  // Record blocks fetched from the base filesystem
+  void RecordMisses(int64_t nblocks, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.misses += nblocks;
+    stats_.miss_bytes += nbytes;
+  }
+
+  // Drop the blocks of all files at or under the given path
+  void Invalidate(const std::string& path) {
+    std::vector<PlatformFilename> deleted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.begin();
+      while (it != entries_.end()) {
+        if (internal::IsAncestorOf(path, it->first.path)) {
+          ++stats_.invalidations;
+          it = Drop(it, &deleted);
+        } else {
+          ++it;
+        }
+      }
+    }
+    DeleteLocalFiles(deleted);
+  }
+
+  BlockCacheStatistics statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ protected:
+  struct Entry {
+    FileVersion version;
+    int64_t size;
+    // Null if not in memory
+    std::shared_ptr<Buffer> data;
+    std::list<const BlockKey*>::iterator memory_lru;
+    bool on_disk = false;
+    PlatformFilename local_file;
+    std::list<const BlockKey*>::iterator local_lru;
+  };
+  using EntryMap = std::unordered_map<BlockKey, Entry, BlockKeyHash>;
+
+  bool has_local_tier() const { return !local_dir_.ToNative().empty(); }
+
+  Status MakeLocalDirectory() {
+    ARROW_ASSIGN_OR_RAISE(auto parent, PlatformFilename::FromString(
+                                           options_.local_directory));
+    RETURN_NOT_OK(::arrow::internal::CreateDirTree(parent));
+    std::random_device rd;
+    for (int i = 0; i < 10; ++i) {
+      std::stringstream ss;
+      ss << "arrow-block-cache-" << std::hex << rd() << rd();
+      ARROW_ASSIGN_OR_RAISE(auto dir, parent.Join(ss.str()));
+      ARROW_ASSIGN_OR_RAISE(bool created, ::arrow::internal::CreateDir(dir));
+      if (created) {
+        local_dir_ = std::move(dir);
+        return Status::OK();
+      }
+    }
+    return Status::IOError("Failed to create a block cache directory in '",
+                           options_.local_directory, "'");
+  }
+
+  // The following methods must be called with the lock held
+
+  void InsertInMemory(EntryMap::iterator it, std::shared_ptr<Buffer> data) {
+    Entry& entry = it->second;
+    if (entry.size > options_.memory_capacity) {
+      return;
+    }
+    memory_lru_.push_front(&it->first);
+    entry.memory_lru = memory_lru_.begin();
+    entry.data = std::move(data);
+    stats_.memory_bytes += entry.size;
+    EvictMemory();
+  }
+
+  void EvictMemory() {
+    while (stats_.memory_bytes > options_.memory_capacity) {
+      auto it = entries_.find(*memory_lru_.back());
+      DCHECK(it != entries_.end());
+      Entry& entry = it->second;
+      memory_lru_.pop_back();
+      entry.data.reset();
+      stats_.memory_bytes -= entry.size;
+      if (!entry.on_disk) {
+        ++stats_.evictions;
+        entries_.erase(it);
+      }
+    }
+  }
+
+  void EvictLocal(std::vector<PlatformFilename>* deleted) {
+    while (stats_.local_bytes > options_.local_capacity) {
+      auto it = entries_.find(*local_lru_.back());
+      DCHECK(it != entries_.end());
+      Entry& entry = it->second;
+      local_lru_.pop_back();
+      deleted->push_back(std::move(entry.local_file));
+      entry.on_disk = false;
+      stats_.local_bytes -= entry.size;
+      if (entry.data == nullptr) {
+        ++stats_.evictions;
+        entries_.erase(it);
+      }
+    }
+  }
+
+  EntryMap::iterator Drop(EntryMap::iterator it,
+                          std::vector<PlatformFilename>* deleted) {
+    Entry& entry = it->second;
+    if (entry.data != nullptr) {
+      memory_lru_.erase(entry.memory_lru);
+      stats_.memory_bytes -= entry.size;
+    }
+    if (entry.on_disk) {
+      local_lru_.erase(entry.local_lru);
+      stats_.local_bytes -= entry.size;
+      deleted->push_back(std::move(entry.local_file));
+    }
+    return entries_.erase(it);
+  }
+
+  // Must be called without the lock held
+  void DeleteLocalFiles(const std::vector<PlatformFilename>& files) {
+    for (const auto& file : files) {
+      // This may fail on Windows if the file is being read, in which case it
+      // is deleted along with the directory.
+      ARROW_UNUSED(::arrow::internal::DeleteFile(file));
+    }
+  }
+
+  const BlockCacheOptions options_;
+  MemoryPool* pool_;
+  PlatformFilename local_dir_;
+  std::atomic<int64_t> next_file_id_{0};
+
+  mutable std::mutex mutex_;
+  EntryMap entries_;
+  // Most recently used blocks first
+  std::list<const BlockKey*> memory_lru_;
+  std::list<const BlockKey*> local_lru_;
+  BlockCacheStatistics stats_;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Cached file implementation
+
+// A RandomAccessFile reading through the block cache.  The file is only
+// opened on the base filesystem when blocks are missing from the cache.
+class CachingFileSystem::CachedInputFile final : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<FileSystem> base_fs, FileInfo info,
+                  std::shared_ptr<BlockCache> cache)
+      : base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        version_{info_.size(), info_.mtime()},
+        cache_(std::move(cache)) {}
+
+  ~CachedInputFile() override { io::internal::CloseFromDestructor(this); }
+
+  Status Close() override {
+    closed_ = true;
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ != nullptr) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > info_.size()) {
+      return Status::IOError("Cannot seek to ", position, " in file '", info_.path(),
+                             "' of size ", info_.size());
+    }
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, info_.size()));
+    if (nbytes == 0) {
+      return 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto blocks, ReadBlocks(position, nbytes));
+    CopyBlocks(blocks, position, nbytes, reinterpret_cast<uint8_t*>(out));
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, info_.size()));
+    if (nbytes == 0) {
+      return AllocateBuffer(0, cache_->pool());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto blocks, ReadBlocks(position, nbytes));
+    const int64_t offset = position % cache_->block_size();
+    if (blocks.size() == 1) {
+      return SliceBuffer(blocks[0], offset, nbytes);
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out,
+                          AllocateBuffer(nbytes, cache_->pool()));
+    CopyBlocks(blocks, position, nbytes, out->mutable_data());
+    return out;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+ protected:
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBaseFile() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  // Return the blocks covering the given (validated, non-empty) range
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadBlocks(int64_t position,
+                                                          int64_t nbytes) {
+    const int64_t block_size = cache_->block_size();
+    const int64_t first_block = position / block_size;
+    const int64_t num_blocks = (position + nbytes - 1) / block_size - first_block + 1;
+
+    std::vector<std::shared_ptr<Buffer>> blocks(num_blocks);
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      blocks[i] = cache_->Get(BlockKey{info_.path(), first_block + i}, version_);
+    }
+    // Fetch each run of missing blocks with a single read
+    int64_t i = 0;
+    while (i < num_blocks) {
+      if (blocks[i] != nullptr) {
+        ++i;
+        continue;
+      }
+      int64_t j = i + 1;
+      while (j < num_blocks && blocks[j] == nullptr) {
+        ++j;
+      }
+      RETURN_NOT_OK(FetchBlocks(first_block + i, j - i, &blocks[i]));
+      i = j;
+    }
+    return blocks;
+  }
+
+  Status FetchBlocks(int64_t first_block, int64_t num_blocks,
+                     std::shared_ptr<Buffer>* out) {
+    const int64_t block_size = cache_->block_size();
+    const int64_t start = first_block * block_size;
+    const int64_t length = std::min(num_blocks * block_size, info_.size() - start);
+    ARROW_ASSIGN_OR_RAISE(auto base_file, GetBaseFile());
+    ARROW_ASSIGN_OR_RAISE(auto data, base_file->ReadAt(start, length));
+    if (data->size() != length) {
+      return Status::IOError("File '", info_.path(), "' is shorter than expected (",
+                             start + data->size(), " < ", start + length,
+                             "), it may have been modified");
+    }
+    cache_->RecordMisses(num_blocks, length);
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      const int64_t offset = i * block_size;
+      out[i] = SliceBuffer(data, offset, std::min(block_size, length - offset));
+      cache_->Put(BlockKey{info_.path(), first_block + i}, version_, out[i]);
+    }
+    return Status::OK();
+  }
+
+  void CopyBlocks(const std::vector<std::shared_ptr<Buffer>>& blocks, int64_t position,
+                  int64_t nbytes, uint8_t* out) const {
+    int64_t offset = position % cache_->block_size();
+    for (const auto& block : blocks) {
+      const int64_t chunk = std::min(block->size() - offset, nbytes);
+      std::memcpy(out, block->data() + offset, static_cast<size_t>(chunk));
+      out += chunk;
+      nbytes -= chunk;
+      offset = 0;
+    }
+    DCHECK_EQ(nbytes, 0);
+  }
+
+  std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const FileVersion version_;
+  std::shared_ptr<BlockCache> cache_;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  bool closed_ = false;
+  int64_t pos_ = 0;
+};
+
+namespace {
+
+// Whether a FileInfo has what's needed to validate cached blocks
+bool IsCacheable(const FileInfo& info) {
+  return info.type() == FileType::File && info.size() != kNoSize &&
+         info.mtime() != kNoTime;
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// CachingFileSystem implementation
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     std::shared_ptr<BlockCache> cache)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      cache_(std::move(cache)) {}
+
+CachingFileSystem::~CachingFileSystem() = default;
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const BlockCacheOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto cache,
+                        BlockCache::Make(options, base_fs->io_context().pool()));
+  return std::shared_ptr<CachingFileSystem>(
+      new CachingFileSystem(std::move(base_fs), std::move(cache)));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const { return this == &other; }
+
+BlockCacheStatistics CachingFileSystem::statistics() const {
+  return cache_->statistics();
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  cache_->Invalidate("");
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(src);
+  cache_->Invalidate(dest);
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(dest);
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenInputFile(path));
+  return file;
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenInputFile(info));
+  return file;
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  if (!IsCacheable(info)) {
+    // Let the base filesystem open the file or raise the appropriate error
+    return base_fs_->OpenInputFile(path);
+  }
+  return std::make_shared<CachedInputFile>(base_fs_, std::move(info), cache_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (!IsCacheable(info)) {
+    return OpenInputFile(info.path());
+  }
+  return std::make_shared<CachedInputFile>(base_fs_, info, cache_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  cache_->Invalidate(path);
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
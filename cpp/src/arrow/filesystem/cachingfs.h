@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the block cache of a CachingFileSystem
+struct ARROW_EXPORT BlockCacheOptions {
+  /// Size of the cached blocks of a file
+  ///
+  /// Reads are widened to whole blocks, and the missing blocks of a read
+  /// are fetched from the base filesystem with a single read.
+  int64_t block_size = 1 << 20;
+
+  /// Maximum number of bytes cached in memory (0 to disable)
+  int64_t memory_capacity = 256 << 20;
+
+  /// Directory where to cache blocks on local disk (empty to disable)
+  ///
+  /// The cache creates, and deletes on destruction, its own subdirectory in
+  /// this directory.  Blocks are written to disk when they are fetched, and
+  /// read back from disk once evicted from memory.
+  std::string local_directory;
+
+  /// Maximum number of bytes cached in local_directory
+  int64_t local_capacity = static_cast<int64_t>(4) << 30;
+
+  static BlockCacheOptions Defaults();
+};
+
+/// Statistics of the block cache of a CachingFileSystem
+struct ARROW_EXPORT BlockCacheStatistics {
+  /// Number of blocks read from memory
+  int64_t memory_hits = 0;
+  /// Number of blocks read from local disk
+  int64_t local_hits = 0;
+  /// Number of blocks fetched from the base filesystem
+  int64_t misses = 0;
+  /// Number of bytes read from the cache
+  int64_t hit_bytes = 0;
+  /// Number of bytes fetched from the base filesystem
+  int64_t miss_bytes = 0;
+  /// Number of blocks evicted to make room for other blocks
+  int64_t evictions = 0;
+  /// Number of blocks dropped because their file changed
+  int64_t invalidations = 0;
+  /// Number of bytes currently cached in memory
+  int64_t memory_bytes = 0;
+  /// Number of bytes currently cached on local disk
+  int64_t local_bytes = 0;
+};
+
+/// \brief A FileSystem implementation caching the blocks of files read from
+/// another filesystem
+///
+/// This is meant to avoid paying the latency and transfer costs of a remote
+/// filesystem (such as S3) when reading the same files repeatedly.  The
+/// blocks of a file are cached with its size and modification time, and are
+/// only used while the base filesystem reports the same ones: files are
+/// looked up in the base filesystem when they are opened, unless a FileInfo
+/// with a size and modification time is given.  Files without a known
+/// modification time are not cached.
+///
+/// Files written, moved or deleted through this filesystem are evicted from
+/// the cache.  All other operations are forwarded to the base filesystem.
+/// The cache is thread-safe and may be shared by several threads reading the
+/// same or different files.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// Create a CachingFileSystem instance caching the files of `base_fs`
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs,
+      const BlockCacheOptions& options = BlockCacheOptions::Defaults());
+
+  std::string type_name() const override { return "caching"; }
+  bool Equals(const FileSystem& other) const override;
+
+  /// Return the statistics of the block cache
+  BlockCacheStatistics statistics() const;
+
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  class BlockCache;
+  class CachedInputFile;
+
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    std::shared_ptr<BlockCache> cache);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
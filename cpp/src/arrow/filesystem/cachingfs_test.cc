@@ -0,0 +1,296 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+std::string MakeData(int64_t size) {
+  std::string data(static_cast<size_t>(size), '\0');
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  return data;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    auto options = BlockCacheOptions::Defaults();
+    // Exercise reads spanning several blocks
+    options.block_size = 4;
+    ASSERT_OK_AND_ASSIGN(caching_fs_, CachingFileSystem::Make(fs_, options));
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return caching_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+class TestCachingFSLocalGeneric : public TestCachingFSGeneric {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("cachingfs-test-"));
+    auto options = BlockCacheOptions::Defaults();
+    options.block_size = 4;
+    options.memory_capacity = 8;
+    options.local_directory = temp_dir_->path().ToString();
+    ASSERT_OK_AND_ASSIGN(caching_fs_, CachingFileSystem::Make(fs_, options));
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSLocalGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Concrete CachingFileSystem tests
+
+class TestCachingFS : public ::testing::Test {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    options_ = BlockCacheOptions::Defaults();
+    options_.block_size = 10;
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(caching_fs_, CachingFileSystem::Make(fs_, options_));
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buffer, expected);
+    std::string out(static_cast<size_t>(nbytes), '\0');
+    ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()),
+                     file->ReadAt(position, nbytes, &out[0]));
+    ASSERT_EQ(out.substr(0, expected.size()), expected);
+  }
+
+ protected:
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  BlockCacheOptions options_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+TEST_F(TestCachingFS, InvalidOptions) {
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, options_));
+  options_.block_size = 10;
+  options_.memory_capacity = -1;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, options_));
+}
+
+TEST_F(TestCachingFS, ReadAt) {
+  MakeFileSystem();
+  const auto data = MakeData(95);
+  ASSERT_OK(fs_->CreateDir("AB"));
+  CreateFile(fs_.get(), "AB/abc", data);
+
+  // Blocks 1 to 3 are fetched with a single read
+  AssertReadAt("AB/abc", 15, 20, data.substr(15, 20));
+  auto stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 3);
+  ASSERT_EQ(stats.miss_bytes, 30);
+  ASSERT_EQ(stats.memory_hits, 3);  // from the second read
+  ASSERT_EQ(stats.memory_bytes, 30);
+
+  // Only blocks 0 and 4 to 9 are missing
+  AssertReadAt("AB/abc", 0, 200, data);
+  stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 10);
+  ASSERT_EQ(stats.miss_bytes, 95);
+  ASSERT_EQ(stats.memory_hits, 3 + 3 + 10);
+  ASSERT_EQ(stats.memory_bytes, 95);
+
+  // Read from a single block, sequential reads
+  AssertReadAt("AB/abc", 91, 2, data.substr(91, 2));
+  ASSERT_OK_AND_ASSIGN(auto stream, caching_fs_->OpenInputStream("AB/abc"));
+  std::string contents;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(7));
+    if (buffer->size() == 0) break;
+    contents += buffer->ToString();
+  }
+  ASSERT_EQ(contents, data);
+  ASSERT_EQ(caching_fs_->statistics().misses, 10);
+}
+
+TEST_F(TestCachingFS, Validation) {
+  MakeFileSystem();
+  const auto data = MakeData(25);
+  CreateFile(fs_.get(), "abc", data);
+  AssertReadAt("abc", 0, 25, data);
+  ASSERT_EQ(caching_fs_->statistics().misses, 3);
+
+  // File changed behind the cache's back
+  const auto new_data = MakeData(30).substr(2);
+  CreateFile(fs_.get(), "abc", new_data);
+  AssertReadAt("abc", 0, 28, new_data);
+  auto stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 6);
+  ASSERT_EQ(stats.invalidations, 3);
+
+  // A FileInfo with a size and mtime is trusted
+  FileInfo info("abc", FileType::File);
+  info.set_size(28);
+  info.set_mtime(time_);
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile(info));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(0, 28));
+  AssertBufferEqual(*buffer, new_data);
+  ASSERT_EQ(caching_fs_->statistics().misses, 6);
+}
+
+TEST_F(TestCachingFS, Invalidation) {
+  MakeFileSystem();
+  ASSERT_OK(caching_fs_->CreateDir("AB/CD"));
+  CreateFile(caching_fs_.get(), "AB/CD/abc", "some data");
+  CreateFile(caching_fs_.get(), "AB/def", "other data");
+  AssertReadAt("AB/CD/abc", 0, 9, "some data");
+  AssertReadAt("AB/def", 0, 10, "other data");
+  ASSERT_EQ(caching_fs_->statistics().memory_bytes, 19);
+
+  // Same size and mtime, but written through the caching filesystem
+  CreateFile(caching_fs_.get(), "AB/CD/abc", "SOME DATA");
+  ASSERT_EQ(caching_fs_->statistics().memory_bytes, 10);
+  AssertReadAt("AB/CD/abc", 0, 9, "SOME DATA");
+
+  ASSERT_OK(caching_fs_->Move("AB/CD", "AB/EF"));
+  ASSERT_EQ(caching_fs_->statistics().memory_bytes, 10);
+  ASSERT_OK(caching_fs_->DeleteDirContents("AB"));
+  ASSERT_EQ(caching_fs_->statistics().memory_bytes, 0);
+  ASSERT_EQ(caching_fs_->statistics().invalidations, 3);
+}
+
+TEST_F(TestCachingFS, MemoryEviction) {
+  options_.memory_capacity = 25;
+  MakeFileSystem();
+  const auto data = MakeData(50);
+  CreateFile(fs_.get(), "abc", data);
+
+  AssertReadAt("abc", 0, 20, data.substr(0, 20));
+  AssertReadAt("abc", 20, 20, data.substr(20, 20));
+  auto stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_EQ(stats.evictions, 2);
+  ASSERT_EQ(stats.memory_bytes, 20);
+
+  // Blocks 2 and 3 are cached, block 0 was evicted
+  AssertReadAt("abc", 25, 10, data.substr(25, 10));
+  ASSERT_EQ(caching_fs_->statistics().misses, 4);
+  AssertReadAt("abc", 0, 5, data.substr(0, 5));
+  ASSERT_EQ(caching_fs_->statistics().misses, 5);
+}
+
+TEST_F(TestCachingFS, LocalCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("cachingfs-test-"));
+  options_.memory_capacity = 0;
+  options_.local_directory = temp_dir->path().ToString();
+  options_.local_capacity = 40;
+  MakeFileSystem();
+  const auto data = MakeData(50);
+  CreateFile(fs_.get(), "abc", data);
+
+  AssertReadAt("abc", 0, 40, data.substr(0, 40));
+  auto stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_EQ(stats.local_hits, 4);
+  ASSERT_EQ(stats.local_bytes, 40);
+  ASSERT_EQ(stats.memory_bytes, 0);
+
+  AssertReadAt("abc", 30, 20, data.substr(30, 20));
+  stats = caching_fs_->statistics();
+  ASSERT_EQ(stats.misses, 5);
+  ASSERT_EQ(stats.local_hits, 4 + 1 + 2);
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.local_bytes, 40);
+
+  // The cache directory is removed along with the filesystem
+  ASSERT_OK_AND_ASSIGN(auto entries, ::arrow::internal::ListDir(temp_dir->path()));
+  ASSERT_EQ(entries.size(), 1);
+  caching_fs_.reset();
+  ASSERT_OK_AND_ASSIGN(entries, ::arrow::internal::ListDir(temp_dir->path()));
+  ASSERT_EQ(entries.size(), 0);
+}
+
+TEST_F(TestCachingFS, ConcurrentReads) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("cachingfs-test-"));
+  options_.memory_capacity = 100;
+  options_.local_directory = temp_dir->path().ToString();
+  options_.local_capacity = 300;
+  MakeFileSystem();
+  const auto data = MakeData(1000);
+  CreateFile(fs_.get(), "abc", data);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&, t] {
+      ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("abc"));
+      for (int i = 0; i < 200; ++i) {
+        const int64_t position = (i * 37 + t * 101) % 1000;
+        const int64_t nbytes = (i * 13) % 50 + 1;
+        ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(position, nbytes));
+        AssertBufferEqual(*buffer, data.substr(position, nbytes));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto stats = caching_fs_->statistics();
+  ASSERT_LE(stats.memory_bytes, 100);
+  ASSERT_LE(stats.local_bytes, 300);
+  ASSERT_GT(stats.memory_hits + stats.local_hits, 0);
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
@@ -34,6 +34,7 @@
 #include "arrow/io/slow.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -43,6 +44,7 @@
 
 namespace arrow {
 
+using internal::checked_pointer_cast;
 using internal::TaskHints;
 using internal::Uri;
 
@@ -139,9 +141,12 @@ template <typename DeferredFunc>
 auto FileSystemDefer(FileSystem* fs, bool synchronous, DeferredFunc&& func)
     -> decltype(DeferNotOk(
         fs->io_context().executor()->Submit(func, std::shared_ptr<FileSystem>{}))) {
+  using FutureType = decltype(DeferNotOk(
+      fs->io_context().executor()->Submit(func, std::shared_ptr<FileSystem>{})));
   auto self = fs->shared_from_this();
   if (synchronous) {
-    return std::forward<DeferredFunc>(func)(std::move(self));
+    // (MakeFinished also accepts a successful Status for Future<>)
+    return FutureType::MakeFinished(std::forward<DeferredFunc>(func)(std::move(self)));
   }
   TaskHints hints;
   hints.external_id = fs->io_context().external_id();
@@ -165,6 +170,16 @@ Future<std::vector<FileInfo>> FileSystem::GetFileInfoAsync(const FileSelector& s
       [select](std::shared_ptr<FileSystem> self) { return self->GetFileInfo(select); });
 }
 
+FileInfoGenerator FileSystem::GetFileInfoGenerator(const FileSelector& select) {
+  return MakeSingleFutureGenerator(GetFileInfoAsync(select));
+}
+
+Future<> FileSystem::DeleteDirContentsAsync(const std::string& path) {
+  return FileSystemDefer(
+      this, default_async_is_sync_,
+      [path](std::shared_ptr<FileSystem> self) { return self->DeleteDirContents(path); });
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -302,14 +317,37 @@ Result<FileInfo> SubTreeFileSystem::GetFileInfo(const std::string& path) {
   return info;
 }
 
-Result<std::vector<FileInfo>> SubTreeFileSystem::GetFileInfo(const FileSelector& select) {
-  auto selector = select;
-  selector.base_dir = PrependBase(selector.base_dir);
-  ARROW_ASSIGN_OR_RAISE(auto infos, base_fs_->GetFileInfo(selector));
+Result<FileInfoVector> SubTreeFileSystem::FixInfos(FileInfoVector infos) const {
   for (auto& info : infos) {
     RETURN_NOT_OK(FixInfo(&info));
   }
-  return infos;
+  return std::move(infos);
+}
+
+FileSelector SubTreeFileSystem::FixSelector(const FileSelector& select) const {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  return selector;
+}
+
+Result<std::vector<FileInfo>> SubTreeFileSystem::GetFileInfo(const FileSelector& select) {
+  ARROW_ASSIGN_OR_RAISE(auto infos, base_fs_->GetFileInfo(FixSelector(select)));
+  return FixInfos(std::move(infos));
+}
+
+Future<std::vector<FileInfo>> SubTreeFileSystem::GetFileInfoAsync(
+    const FileSelector& select) {
+  auto self = checked_pointer_cast<SubTreeFileSystem>(shared_from_this());
+  return base_fs_->GetFileInfoAsync(FixSelector(select)).Then(
+      [self](const FileInfoVector& infos) { return self->FixInfos(infos); });
+}
+
+FileInfoGenerator SubTreeFileSystem::GetFileInfoGenerator(const FileSelector& select) {
+  auto self = checked_pointer_cast<SubTreeFileSystem>(shared_from_this());
+  std::function<Result<FileInfoVector>(const FileInfoVector&)> fix_infos =
+      [self](const FileInfoVector& infos) { return self->FixInfos(infos); };
+  return MakeMappedGenerator(base_fs_->GetFileInfoGenerator(FixSelector(select)),
+                             std::move(fix_infos));
 }
 
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
@@ -332,6 +370,14 @@ Status SubTreeFileSystem::DeleteDirContents(const std::string& path) {
   return base_fs_->DeleteDirContents(s);
 }
 
+Future<> SubTreeFileSystem::DeleteDirContentsAsync(const std::string& path) {
+  if (internal::IsEmptyPath(path)) {
+    return internal::InvalidDeleteDirContents(path);
+  }
+  auto s = PrependBase(path);
+  return base_fs_->DeleteDirContentsAsync(s);
+}
+
 Status SubTreeFileSystem::DeleteRootDirContents() {
   if (base_path_.empty()) {
     return base_fs_->DeleteRootDirContents();
@@ -394,6 +440,38 @@ Result<std::shared_ptr<io::RandomAccessFile>> SubTreeFileSystem::OpenInputFile(
   return base_fs_->OpenInputFile(new_info);
 }
 
+Future<std::shared_ptr<io::InputStream>> SubTreeFileSystem::OpenInputStreamAsync(
+    const std::string& path) {
+  auto s = path;
+  RETURN_NOT_OK(PrependBaseNonEmpty(&s));
+  return base_fs_->OpenInputStreamAsync(s);
+}
+
+Future<std::shared_ptr<io::InputStream>> SubTreeFileSystem::OpenInputStreamAsync(
+    const FileInfo& info) {
+  auto s = info.path();
+  RETURN_NOT_OK(PrependBaseNonEmpty(&s));
+  FileInfo new_info(info);
+  new_info.set_path(std::move(s));
+  return base_fs_->OpenInputStreamAsync(new_info);
+}
+
+Future<std::shared_ptr<io::RandomAccessFile>> SubTreeFileSystem::OpenInputFileAsync(
+    const std::string& path) {
+  auto s = path;
+  RETURN_NOT_OK(PrependBaseNonEmpty(&s));
+  return base_fs_->OpenInputFileAsync(s);
+}
+
+Future<std::shared_ptr<io::RandomAccessFile>> SubTreeFileSystem::OpenInputFileAsync(
+    const FileInfo& info) {
+  auto s = info.path();
+  RETURN_NOT_OK(PrependBaseNonEmpty(&s));
+  FileInfo new_info(info);
+  new_info.set_path(std::move(s));
+  return base_fs_->OpenInputFileAsync(new_info);
+}
+
 Result<std::shared_ptr<io::OutputStream>> SubTreeFileSystem::OpenOutputStream(
     const std::string& path) {
   auto s = path;
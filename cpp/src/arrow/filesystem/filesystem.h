@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -141,6 +143,23 @@ struct ARROW_EXPORT FileLocator {
   std::string path;
 };
 
+using FileInfoVector = std::vector<FileInfo>;
+
+/// \brief An asynchronous generator of batches of FileInfo entries
+///
+/// The end of the stream is signalled by an empty batch.
+using FileInfoGenerator = std::function<Future<FileInfoVector>()>;
+
+}  // namespace fs
+
+template <>
+struct IterationTraits<fs::FileInfoVector> {
+  static fs::FileInfoVector End() { return {}; }
+  static bool IsEnd(const fs::FileInfoVector& val) { return val.empty(); }
+};
+
+namespace fs {
+
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
@@ -186,6 +205,17 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// EXPERIMENTAL: async version of GetFileInfo
   virtual Future<std::vector<FileInfo>> GetFileInfoAsync(const FileSelector& select);
 
+  /// EXPERIMENTAL: streaming async version of GetFileInfo
+  ///
+  /// The returned generator yields the entries in batches, as soon as they are
+  /// available (for example one batch per listing request on object stores),
+  /// and in no particular order.  It is not async-reentrant, i.e. the future
+  /// it returns must complete before it is called again.
+  ///
+  /// The default implementation yields the result of GetFileInfoAsync() as
+  /// a single batch.
+  virtual FileInfoGenerator GetFileInfoGenerator(const FileSelector& select);
+
   /// Create a directory and subdirectories.
   ///
   /// This function succeeds if the directory already exists.
@@ -200,6 +230,9 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// Passing an empty path ("" or "/") is disallowed, see DeleteRootDirContents.
   virtual Status DeleteDirContents(const std::string& path) = 0;
 
+  /// EXPERIMENTAL: async version of DeleteDirContents
+  virtual Future<> DeleteDirContentsAsync(const std::string& path);
+
   /// EXPERIMENTAL: Delete the root directory's contents, recursively.
   ///
   /// Implementations may decide to raise an error if this operation is
@@ -316,10 +349,17 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
 
+  /// \cond FALSE
+  using FileSystem::GetFileInfoAsync;
+  /// \endcond
+  Future<std::vector<FileInfo>> GetFileInfoAsync(const FileSelector& select) override;
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
   Status DeleteDir(const std::string& path) override;
   Status DeleteDirContents(const std::string& path) override;
+  Future<> DeleteDirContentsAsync(const std::string& path) override;
   Status DeleteRootDirContents() override;
 
   Status DeleteFile(const std::string& path) override;
@@ -335,6 +375,16 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
       const std::string& path) override;
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const FileInfo& info) override;
+
+  Future<std::shared_ptr<io::InputStream>> OpenInputStreamAsync(
+      const std::string& path) override;
+  Future<std::shared_ptr<io::InputStream>> OpenInputStreamAsync(
+      const FileInfo& info) override;
+  Future<std::shared_ptr<io::RandomAccessFile>> OpenInputFileAsync(
+      const std::string& path) override;
+  Future<std::shared_ptr<io::RandomAccessFile>> OpenInputFileAsync(
+      const FileInfo& info) override;
+
   Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
       const std::string& path) override;
   Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
@@ -350,6 +400,8 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   Status PrependBaseNonEmpty(std::string* s) const;
   Result<std::string> StripBase(const std::string& s) const;
   Status FixInfo(FileInfo* info) const;
+  Result<FileInfoVector> FixInfos(FileInfoVector infos) const;
+  FileSelector FixSelector(const FileSelector& select) const;
 
   static Result<std::string> NormalizeBasePath(
       std::string base_path, const std::shared_ptr<FileSystem>& base_fs);
@@ -27,7 +27,9 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
 
 namespace arrow {
 namespace fs {
@@ -779,6 +781,40 @@ TEST_F(TestSubTreeFileSystem, GetFileInfoSelector) {
   ASSERT_EQ(infos.size(), 0);
 }
 
+TEST_F(TestSubTreeFileSystem, GetFileInfoGenerator) {
+  ASSERT_OK(subfs_->CreateDir("AB/CD"));
+  CreateFile("ab", "data");
+  CreateFile("AB/cd", "data2");
+
+  FileSelector selector;
+  selector.base_dir = "AB";
+  selector.recursive = true;
+  auto fut = CollectAsyncGenerator(subfs_->GetFileInfoGenerator(selector));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, fut);
+  std::vector<FileInfo> infos;
+  for (const auto& batch : batches) {
+    infos.insert(infos.end(), batch.begin(), batch.end());
+  }
+  SortInfos(&infos);
+  ASSERT_EQ(infos.size(), 2);
+  AssertFileInfo(infos[0], "AB/CD", FileType::Directory, time_);
+  AssertFileInfo(infos[1], "AB/cd", FileType::File, time_, 5);
+
+  selector.base_dir = "nonexistent";
+  fut = CollectAsyncGenerator(subfs_->GetFileInfoGenerator(selector));
+  ASSERT_RAISES(IOError, fut.status());
+}
+
+TEST_F(TestSubTreeFileSystem, DeleteDirContentsAsync) {
+  ASSERT_OK(subfs_->CreateDir("AB/CD"));
+  CreateFile("AB/cd", "data2");
+  ASSERT_FINISHES_OK(subfs_->DeleteDirContentsAsync("AB"));
+  CheckDirs({{"sub", time_}, {"sub/tree", time_}, {"sub/tree/AB", time_}});
+  CheckFiles({});
+
+  ASSERT_RAISES(Invalid, subfs_->DeleteDirContentsAsync("").status());
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Generic SlowFileSystem tests
 
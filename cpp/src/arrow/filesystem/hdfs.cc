@@ -298,6 +298,19 @@ void HdfsOptions::ConfigureExtraConf(std::string key, std::string val) {
   connection_config.extra_conf.emplace(std::move(key), std::move(val));
 }
 
+void HdfsOptions::ConfigureShortCircuitReads(std::string domain_socket_path) {
+  connection_config.short_circuit_reads = true;
+  connection_config.domain_socket_path = std::move(domain_socket_path);
+}
+
+void HdfsOptions::ConfigureZeroCopyReads(bool zero_copy_reads) {
+  connection_config.zero_copy_reads = zero_copy_reads;
+}
+
+void HdfsOptions::ConfigureReadahead(int64_t readahead_size) {
+  connection_config.readahead_size = readahead_size;
+}
+
 bool HdfsOptions::Equals(const HdfsOptions& other) const {
   return (buffer_size == other.buffer_size && replication == other.replication &&
           default_block_size == other.default_block_size &&
@@ -305,7 +318,13 @@ bool HdfsOptions::Equals(const HdfsOptions& other) const {
           connection_config.port == other.connection_config.port &&
           connection_config.user == other.connection_config.user &&
           connection_config.kerb_ticket == other.connection_config.kerb_ticket &&
-          connection_config.extra_conf == other.connection_config.extra_conf);
+          connection_config.extra_conf == other.connection_config.extra_conf &&
+          connection_config.short_circuit_reads ==
+              other.connection_config.short_circuit_reads &&
+          connection_config.domain_socket_path ==
+              other.connection_config.domain_socket_path &&
+          connection_config.zero_copy_reads == other.connection_config.zero_copy_reads &&
+          connection_config.readahead_size == other.connection_config.readahead_size);
 }
 
 Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
@@ -381,6 +400,37 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     options_map.erase(it);
   }
 
+  // configure short-circuit reads
+  it = options_map.find("domain_socket_path");
+  if (it != options_map.end()) {
+    options.ConfigureShortCircuitReads(it->second);
+    options_map.erase(it);
+  }
+
+  // configure zero-copy reads
+  it = options_map.find("zero_copy_reads");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    bool zero_copy_reads;
+    if (!ParseValue<BooleanType>(v.data(), v.size(), &zero_copy_reads)) {
+      return Status::Invalid("Invalid value for option 'zero_copy_reads': '", v, "'");
+    }
+    options.ConfigureZeroCopyReads(zero_copy_reads);
+    options_map.erase(it);
+  }
+
+  // configure readahead_size
+  it = options_map.find("readahead_size");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    int64_t readahead_size;
+    if (!ParseValue<Int64Type>(v.data(), v.size(), &readahead_size)) {
+      return Status::Invalid("Invalid value for option 'readahead_size': '", v, "'");
+    }
+    options.ConfigureReadahead(readahead_size);
+    options_map.erase(it);
+  }
+
   // configure other options
   for (const auto& it : options_map) {
     options.ConfigureExtraConf(it.first, it.second);
@@ -48,6 +48,13 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureBlockSize(int64_t default_block_size);
   void ConfigureKerberosTicketCachePath(std::string path);
   void ConfigureExtraConf(std::string key, std::string val);
+  /// Enable short-circuit local reads through the given DataNode domain socket
+  void ConfigureShortCircuitReads(std::string domain_socket_path);
+  /// Enable zero-copy reads of locally cached blocks
+  void ConfigureZeroCopyReads(bool zero_copy_reads);
+  /// Read files sequentially by chunks of `readahead_size` bytes, prefetching
+  /// the next chunk in the background (0 to disable)
+  void ConfigureReadahead(int64_t readahead_size);
 
   bool Equals(const HdfsOptions& other) const;
 
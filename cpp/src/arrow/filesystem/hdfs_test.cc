@@ -59,6 +59,17 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.port, 9999);
   ASSERT_EQ(options.connection_config.extra_conf["hdfs_token"], "hdfs_token_ticket");
 
+  ASSERT_OK(uri.Parse(
+      "hdfs://otherhost:9999/?domain_socket_path=/var/run/dn_socket"
+      "&zero_copy_reads=true&readahead_size=134217728"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_TRUE(options.connection_config.short_circuit_reads);
+  ASSERT_EQ(options.connection_config.domain_socket_path, "/var/run/dn_socket");
+  ASSERT_TRUE(options.connection_config.zero_copy_reads);
+  ASSERT_EQ(options.connection_config.readahead_size, 134217728);
+  ASSERT_TRUE(options.connection_config.extra_conf.empty());
+  ASSERT_RAISES(Invalid, HdfsOptions::FromUri("hdfs://otherhost:9999/?readahead_size=x"));
+
   ASSERT_OK(uri.Parse("viewfs://other-nn/mypath/myfile"));
   ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
   ASSERT_EQ(options.connection_config.host, "viewfs://other-nn");
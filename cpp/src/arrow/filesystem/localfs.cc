@@ -236,7 +236,8 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         use_direct_io == other.use_direct_io;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -395,7 +396,10 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    io::ReadableFileOptions file_options;
+    file_options.use_io_uring = options.use_io_uring;
+    file_options.use_direct_io = options.use_direct_io;
+    return io::ReadableFile::Open(path, file_options, io_context.pool());
   }
 }
 
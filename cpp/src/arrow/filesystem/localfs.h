@@ -38,6 +38,13 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether regular files read asynchronously through io_uring, where
+  /// available (see io::ReadableFileOptions).  Ignored if use_mmap is true.
+  bool use_io_uring = false;
+
+  /// Whether asynchronous io_uring reads bypass the page cache (O_DIRECT).
+  bool use_direct_io = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
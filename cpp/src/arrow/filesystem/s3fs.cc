@@ -21,10 +21,12 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <iterator>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 // Undefine preprocessor macros that interfere with AWS function / method names
@@ -74,6 +76,7 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
@@ -315,6 +318,11 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          read_part_size == other.read_part_size &&
+          read_concurrency == other.read_concurrency &&
+          write_part_size == other.write_part_size &&
+          max_concurrent_part_uploads == other.max_concurrent_part_uploads &&
+          write_memory_budget == other.write_memory_budget &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey() &&
           GetSessionToken() == other.GetSessionToken());
@@ -630,15 +638,110 @@ Result<S3Model::GetObjectResult> GetObjectRange(Aws::S3::S3Client* client,
   return OutcomeToResult(client->GetObject(req));
 }
 
+Result<int64_t> ReadObjectRange(Aws::S3::S3Client* client, const S3Path& path,
+                                int64_t start, int64_t length, void* out) {
+  ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                        GetObjectRange(client, path, start, length, out));
+
+  auto& stream = result.GetBody();
+  stream.ignore(length);
+  // NOTE: the stream is a stringstream by default, there is no actual error
+  // to check for.  However, stream.fail() may return true if EOF is reached.
+  return stream.gcount();
+}
+
+// A read of an object range split into parts fetched concurrently.
+//
+// Parts are claimed in order by the reading thread and by helper tasks on the
+// IO executor.  The reading thread only waits for parts which are already
+// being fetched, so that the read completes even if the helpers can't run
+// (e.g. when the read itself runs on a saturated IO executor).  Helpers which
+// start after all parts were claimed return without touching the output.
+class PartitionedRangeRead {
+ public:
+  PartitionedRangeRead(std::shared_ptr<Aws::S3::S3Client> client, S3Path path,
+                       int64_t position, int64_t nbytes, int64_t part_size,
+                       uint8_t* out)
+      : client_(std::move(client)),
+        path_(std::move(path)),
+        position_(position),
+        nbytes_(nbytes),
+        part_size_(part_size),
+        num_parts_((nbytes + part_size - 1) / part_size),
+        out_(out),
+        part_bytes_read_(num_parts_, 0) {}
+
+  int64_t num_parts() const { return num_parts_; }
+
+  // Fetch parts until none is left to claim
+  void FetchParts() {
+    while (true) {
+      const int64_t part = next_part_.fetch_add(1);
+      if (part >= num_parts_) {
+        return;
+      }
+      const int64_t offset = part * part_size_;
+      const int64_t length = std::min(part_size_, nbytes_ - offset);
+      auto result = ReadObjectRange(client_.get(), path_, position_ + offset, length,
+                                    out_ + offset);
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (result.ok()) {
+        part_bytes_read_[part] = *result;
+      } else if (status_.ok()) {
+        status_ = result.status();
+      }
+      if (++parts_done_ == num_parts_) {
+        cv_.notify_one();
+      }
+    }
+  }
+
+  // Wait for all parts, and return the number of contiguous bytes read
+  Result<int64_t> Finish() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return parts_done_ == num_parts_; });
+    RETURN_NOT_OK(status_);
+    int64_t bytes_read = 0;
+    for (int64_t part = 0; part < num_parts_; ++part) {
+      bytes_read += part_bytes_read_[part];
+      if (bytes_read < std::min(nbytes_, (part + 1) * part_size_)) {
+        // Short part (the object was truncated?): the following parts don't
+        // follow the bytes read.
+        break;
+      }
+    }
+    return bytes_read;
+  }
+
+ private:
+  std::shared_ptr<Aws::S3::S3Client> client_;
+  const S3Path path_;
+  const int64_t position_;
+  const int64_t nbytes_;
+  const int64_t part_size_;
+  const int64_t num_parts_;
+  uint8_t* out_;
+
+  std::atomic<int64_t> next_part_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int64_t parts_done_ = 0;
+  std::vector<int64_t> part_bytes_read_;
+  Status status_;
+};
+
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Aws::S3::S3Client> client,
                   const io::IOContext& io_context, const S3Path& path,
-                  int64_t size = kNoSize)
+                  const S3Options& options, int64_t size = kNoSize)
       : client_(std::move(client)),
         io_context_(io_context),
         path_(path),
+        read_part_size_(options.read_part_size),
+        read_concurrency_(options.read_concurrency),
         content_length_(size) {}
 
   Status Init() {
@@ -723,15 +826,11 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
+    if (read_concurrency_ > 1 && read_part_size_ > 0 && nbytes > read_part_size_) {
+      return ReadInParts(position, nbytes, reinterpret_cast<uint8_t*>(out));
+    }
     // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
-                          GetObjectRange(client_.get(), path_, position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    return ReadObjectRange(client_.get(), path_, position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -764,9 +863,28 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  Result<int64_t> ReadInParts(int64_t position, int64_t nbytes, uint8_t* out) {
+    auto read = std::make_shared<PartitionedRangeRead>(client_, path_, position, nbytes,
+                                                       read_part_size_, out);
+    const int64_t num_helpers =
+        std::min<int64_t>(read_concurrency_, read->num_parts()) - 1;
+    for (int64_t i = 0; i < num_helpers; ++i) {
+      // If spawning fails, the remaining parts are fetched by this thread
+      if (!io_context_.executor()
+               ->Spawn([read]() { read->FetchParts(); }, io_context_.stop_token())
+               .ok()) {
+        break;
+      }
+    }
+    read->FetchParts();
+    return read->Finish();
+  }
+
   std::shared_ptr<Aws::S3::S3Client> client_;
   const io::IOContext io_context_;
   S3Path path_;
+  const int64_t read_part_size_;
+  const int32_t read_concurrency_;
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -791,7 +909,11 @@ class ObjectOutputStream final : public io::OutputStream {
       : client_(std::move(client)),
         io_context_(io_context),
         path_(path),
-        background_writes_(options.background_writes) {}
+        background_writes_(options.background_writes),
+        fixed_part_size_(options.write_part_size > 0),
+        max_concurrent_part_uploads_(options.max_concurrent_part_uploads),
+        write_memory_budget_(options.write_memory_budget),
+        part_upload_threshold_(std::max(options.write_part_size, kMinimumPartUpload)) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -910,7 +1032,26 @@ class ObjectOutputStream final : public io::OutputStream {
       return Status::Invalid("Operation on closed stream");
     }
 
-    if (!current_part_ && nbytes >= part_upload_threshold_) {
+    if (!current_part_ && fixed_part_size_) {
+      // No current part, upload whole parts directly and buffer the rest
+      // (without copying if the buffer is owned)
+      const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+      while (nbytes >= part_upload_threshold_) {
+        std::shared_ptr<Buffer> owned_part;
+        if (owned_buffer != nullptr) {
+          owned_part = SliceBuffer(owned_buffer, bytes - owned_buffer->data(),
+                                   part_upload_threshold_);
+        }
+        RETURN_NOT_OK(UploadPart(bytes, part_upload_threshold_, std::move(owned_part)));
+        bytes += part_upload_threshold_;
+        nbytes -= part_upload_threshold_;
+        pos_ += part_upload_threshold_;
+      }
+      if (nbytes == 0) {
+        return Status::OK();
+      }
+      data = bytes;
+    } else if (!current_part_ && nbytes >= part_upload_threshold_) {
       // No current part and data large enough, upload it directly
       // (without copying if the buffer is owned)
       RETURN_NOT_OK(UploadPart(data, nbytes, owned_buffer));
@@ -991,7 +1132,21 @@ class ObjectOutputStream final : public io::OutputStream {
 
       {
         std::unique_lock<std::mutex> lock(upload_state_->mutex);
+        // Wait for room in the concurrency limit and the memory budget
+        upload_state_->cv.wait(lock, [&]() {
+          const auto& state = *upload_state_;
+          if (state.parts_in_progress == 0) {
+            return true;
+          }
+          return (max_concurrent_part_uploads_ <= 0 ||
+                  state.parts_in_progress < max_concurrent_part_uploads_) &&
+                 (write_memory_budget_ <= 0 ||
+                  state.bytes_in_progress + nbytes <= write_memory_budget_);
+        });
+        // Don't upload more parts if one failed
+        RETURN_NOT_OK(upload_state_->status);
         ++upload_state_->parts_in_progress;
+        upload_state_->bytes_in_progress += nbytes;
       }
       auto client = client_;
       ARROW_ASSIGN_OR_RAISE(auto fut, io_context_.executor()->Submit(
@@ -1001,9 +1156,9 @@ class ObjectOutputStream final : public io::OutputStream {
       // The closure keeps the buffer and the upload state alive
       auto state = upload_state_;
       auto part_number = part_number_;
-      auto handler = [owned_buffer, state, part_number,
+      auto handler = [owned_buffer, state, part_number, nbytes,
                       req](const Result<S3Model::UploadPartOutcome>& result) -> void {
-        HandleUploadOutcome(state, part_number, req, result);
+        HandleUploadOutcome(state, part_number, nbytes, req, result);
       };
       fut.AddCallback(std::move(handler));
     }
@@ -1020,7 +1175,7 @@ class ObjectOutputStream final : public io::OutputStream {
     // So the total size limit is 2475000MB or ~2.4TB, while keeping manageable
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
-    if (part_number_ % 100 == 0) {
+    if (!fixed_part_size_ && part_number_ % 100 == 0) {
       part_upload_threshold_ += kMinimumPartUpload;
     }
 
@@ -1028,7 +1183,8 @@ class ObjectOutputStream final : public io::OutputStream {
   }
 
   static void HandleUploadOutcome(const std::shared_ptr<UploadState>& state,
-                                  int part_number, const S3Model::UploadPartRequest& req,
+                                  int part_number, int64_t nbytes,
+                                  const S3Model::UploadPartRequest& req,
                                   const Result<S3Model::UploadPartOutcome>& result) {
     std::unique_lock<std::mutex> lock(state->mutex);
     if (!result.ok()) {
@@ -1041,10 +1197,10 @@ class ObjectOutputStream final : public io::OutputStream {
         AddCompletedPart(state, part_number, outcome.GetResult());
       }
     }
-    // Notify completion
-    if (--state->parts_in_progress == 0) {
-      state->cv.notify_all();
-    }
+    // Notify completion (to Flush() or to writes blocked by the upload limits)
+    --state->parts_in_progress;
+    state->bytes_in_progress -= nbytes;
+    state->cv.notify_all();
   }
 
   static void AddCompletedPart(const std::shared_ptr<UploadState>& state, int part_number,
@@ -1075,6 +1231,9 @@ class ObjectOutputStream final : public io::OutputStream {
   const io::IOContext io_context_;
   const S3Path path_;
   const bool background_writes_;
+  const bool fixed_part_size_;
+  const int32_t max_concurrent_part_uploads_;
+  const int64_t write_memory_budget_;
 
   Aws::String upload_id_;
   bool closed_ = true;
@@ -1082,7 +1241,7 @@ class ObjectOutputStream final : public io::OutputStream {
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -1091,6 +1250,7 @@ class ObjectOutputStream final : public io::OutputStream {
     std::condition_variable cv;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
     Status status;
   };
   std::shared_ptr<UploadState> upload_state_;
@@ -1126,6 +1286,11 @@ struct TreeWalker : public std::enable_shared_from_this<TreeWalker> {
 
   template <typename... Args>
   static Status Walk(Args&&... args) {
+    return WalkAsync(std::forward<Args>(args)...).status();
+  }
+
+  template <typename... Args>
+  static Future<> WalkAsync(Args&&... args) {
     auto self = std::make_shared<TreeWalker>(std::forward<Args>(args)...);
     return self->DoWalk();
   }
@@ -1147,12 +1312,12 @@ struct TreeWalker : public std::enable_shared_from_this<TreeWalker> {
   std::shared_ptr<TaskGroup> task_group_;
   std::mutex mutex_;
 
-  Status DoWalk() {
+  Future<> DoWalk() {
     task_group_ =
         TaskGroup::MakeThreaded(io_context_.executor(), io_context_.stop_token());
     WalkChild(base_dir_, /*nesting_depth=*/0);
-    // When this returns, ListObjectsV2 tasks either have finished or will exit early
-    return task_group_->Finish();
+    // When this completes, ListObjectsV2 tasks either have finished or will exit early
+    return task_group_->FinishAsync();
   }
 
   bool ok() const { return task_group_->ok(); }
@@ -1396,20 +1561,58 @@ class S3FileSystem::Impl {
         outcome.GetError());
   }
 
-  Status CheckNestingDepth(int32_t nesting_depth) {
-    if (nesting_depth >= kMaxNestingDepth) {
+  static Status CheckNestingDepth(int32_t nesting_depth, int32_t max_nesting_depth) {
+    if (nesting_depth >= max_nesting_depth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
-                             kMaxNestingDepth, ")");
+                             max_nesting_depth, ")");
     }
     return Status::OK();
   }
 
-  // Workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileInfo>* out) {
-    bool is_empty = true;
-
-    auto handle_error = [&](const AWSError<S3Errors>& error) -> Status {
+  // Convert a page of listing results to FileInfo entries
+  static FileInfoVector ListingToInfos(const std::string& bucket,
+                                       const std::string& prefix,
+                                       const S3Model::ListObjectsV2Result& result) {
+    FileInfoVector infos;
+    // Walk "directories"
+    for (const auto& prefix : result.GetCommonPrefixes()) {
+      const auto child_key =
+          internal::RemoveTrailingSlash(FromAwsString(prefix.GetPrefix()));
+      std::stringstream child_path;
+      child_path << bucket << kSep << child_key;
+      FileInfo info;
+      info.set_path(child_path.str());
+      info.set_type(FileType::Directory);
+      infos.push_back(std::move(info));
+    }
+    // Walk "files"
+    for (const auto& obj : result.GetContents()) {
+      FileInfo info;
+      const auto child_key = internal::RemoveTrailingSlash(FromAwsString(obj.GetKey()));
+      if (child_key == util::string_view(prefix)) {
+        // Amazon can return the "directory" key itself as part of the results, skip
+        continue;
+      }
+      std::stringstream child_path;
+      child_path << bucket << kSep << child_key;
+      info.set_path(child_path.str());
+      FileObjectToInfo(obj, &info);
+      infos.push_back(std::move(info));
+    }
+    return infos;
+  }
+
+  // Workhorse for GetFileInfo(FileSelector...) and GetFileInfoGenerator.
+  // `sink` receives each page of entries.
+  //
+  // The Impl must outlive the returned future.
+  Future<> WalkAsync(const FileSelector& select, const std::string& bucket,
+                     const std::string& key,
+                     std::function<void(FileInfoVector)> sink) {
+    // Handlers are serialized by the TreeWalker
+    auto is_empty = std::make_shared<bool>(true);
+
+    auto handle_error = [select, bucket, key](const AWSError<S3Errors>& error) -> Status {
       if (select.allow_not_found && IsNotFound(error)) {
         return Status::OK();
       }
@@ -1418,90 +1621,96 @@ class S3FileSystem::Impl {
                            error);
     };
 
-    auto handle_recursion = [&](int32_t nesting_depth) -> Result<bool> {
-      RETURN_NOT_OK(CheckNestingDepth(nesting_depth));
+    const int32_t max_nesting_depth = kMaxNestingDepth;
+    auto handle_recursion = [select,
+                             max_nesting_depth](int32_t nesting_depth) -> Result<bool> {
+      RETURN_NOT_OK(CheckNestingDepth(nesting_depth, max_nesting_depth));
       return select.recursive && nesting_depth <= select.max_recursion;
     };
 
-    auto handle_results = [&](const std::string& prefix,
+    auto handle_results = [bucket, is_empty, sink](
+                              const std::string& prefix,
                               const S3Model::ListObjectsV2Result& result) -> Status {
-      // Walk "directories"
-      for (const auto& prefix : result.GetCommonPrefixes()) {
-        is_empty = false;
-        const auto child_key =
-            internal::RemoveTrailingSlash(FromAwsString(prefix.GetPrefix()));
-        std::stringstream child_path;
-        child_path << bucket << kSep << child_key;
-        FileInfo info;
-        info.set_path(child_path.str());
-        info.set_type(FileType::Directory);
-        out->push_back(std::move(info));
+      if (!result.GetCommonPrefixes().empty() || !result.GetContents().empty()) {
+        *is_empty = false;
       }
-      // Walk "files"
-      for (const auto& obj : result.GetContents()) {
-        is_empty = false;
-        FileInfo info;
-        const auto child_key = internal::RemoveTrailingSlash(FromAwsString(obj.GetKey()));
-        if (child_key == util::string_view(prefix)) {
-          // Amazon can return the "directory" key itself as part of the results, skip
-          continue;
-        }
-        std::stringstream child_path;
-        child_path << bucket << kSep << child_key;
-        info.set_path(child_path.str());
-        FileObjectToInfo(obj, &info);
-        out->push_back(std::move(info));
+      auto infos = ListingToInfos(bucket, prefix, result);
+      if (!infos.empty()) {
+        sink(std::move(infos));
       }
       return Status::OK();
     };
 
-    RETURN_NOT_OK(TreeWalker::Walk(client_, io_context_, bucket, key, kListObjectsMaxKeys,
-                                   handle_results, handle_error, handle_recursion));
-
-    // If no contents were found, perhaps it's an empty "directory",
-    // or perhaps it's a nonexistent entry.  Check.
-    if (is_empty && !select.allow_not_found) {
-      RETURN_NOT_OK(IsEmptyDirectory(bucket, key, &is_empty));
-      if (!is_empty) {
-        return PathNotFound(bucket, key);
+    auto walk = TreeWalker::WalkAsync(client_, io_context_, bucket, key,
+                                      kListObjectsMaxKeys, handle_results, handle_error,
+                                      handle_recursion);
+    auto check_exists = [this, select, bucket, key,
+                         is_empty](const detail::Empty&) -> Status {
+      // If no contents were found, perhaps it's an empty "directory",
+      // or perhaps it's a nonexistent entry.  Check.
+      if (*is_empty && !select.allow_not_found) {
+        bool exists = false;
+        RETURN_NOT_OK(IsEmptyDirectory(bucket, key, &exists));
+        if (!exists) {
+          return PathNotFound(bucket, key);
+        }
       }
-    }
+      return Status::OK();
+    };
+    return walk.Then(std::move(check_exists));
+  }
+
+  Status Walk(const FileSelector& select, const std::string& bucket,
+              const std::string& key, std::vector<FileInfo>* out) {
+    auto sink = [out](FileInfoVector infos) {
+      std::move(infos.begin(), infos.end(), std::back_inserter(*out));
+    };
+    RETURN_NOT_OK(WalkAsync(select, bucket, key, sink).status());
     // Sort results for convenience, since they can come massively out of order
     std::sort(out->begin(), out->end(), FileInfo::ByPath{});
     return Status::OK();
   }
 
-  Status WalkForDeleteDir(const std::string& bucket, const std::string& key,
-                          std::vector<std::string>* file_keys,
-                          std::vector<std::string>* dir_keys) {
-    auto handle_results = [&](const std::string& prefix,
-                              const S3Model::ListObjectsV2Result& result) -> Status {
+  struct DeleteDirKeys {
+    std::vector<std::string> file_keys;
+    std::vector<std::string> dir_keys;
+  };
+
+  Future<std::shared_ptr<DeleteDirKeys>> WalkForDeleteDirAsync(const std::string& bucket,
+                                                               const std::string& key) {
+    auto keys = std::make_shared<DeleteDirKeys>();
+
+    // Handlers are serialized by the TreeWalker
+    auto handle_results = [keys](const std::string& prefix,
+                                 const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
-      file_keys->reserve(file_keys->size() + result.GetContents().size());
+      keys->file_keys.reserve(keys->file_keys.size() + result.GetContents().size());
       for (const auto& obj : result.GetContents()) {
-        file_keys->emplace_back(FromAwsString(obj.GetKey()));
+        keys->file_keys.emplace_back(FromAwsString(obj.GetKey()));
       }
       // Walk "directories"
-      dir_keys->reserve(dir_keys->size() + result.GetCommonPrefixes().size());
+      keys->dir_keys.reserve(keys->dir_keys.size() + result.GetCommonPrefixes().size());
       for (const auto& prefix : result.GetCommonPrefixes()) {
-        dir_keys->emplace_back(FromAwsString(prefix.GetPrefix()));
+        keys->dir_keys.emplace_back(FromAwsString(prefix.GetPrefix()));
       }
       return Status::OK();
     };
 
-    auto handle_error = [&](const AWSError<S3Errors>& error) -> Status {
+    auto handle_error = [bucket, key](const AWSError<S3Errors>& error) -> Status {
       return ErrorToStatus(std::forward_as_tuple("When listing objects under key '", key,
                                                  "' in bucket '", bucket, "': "),
                            error);
     };
 
-    auto handle_recursion = [&](int32_t nesting_depth) -> Result<bool> {
-      RETURN_NOT_OK(CheckNestingDepth(nesting_depth));
+    const int32_t max_nesting_depth = kMaxNestingDepth;
+    auto handle_recursion = [max_nesting_depth](int32_t nesting_depth) -> Result<bool> {
+      RETURN_NOT_OK(CheckNestingDepth(nesting_depth, max_nesting_depth));
       return true;  // Recurse
     };
 
-    return TreeWalker::Walk(client_, io_context_, bucket, key, kListObjectsMaxKeys,
-                            handle_results, handle_error, handle_recursion);
+    return TreeWalker::WalkAsync(client_, io_context_, bucket, key, kListObjectsMaxKeys,
+                                 handle_results, handle_error, handle_recursion)
+        .Then([keys](const detail::Empty&) { return keys; });
   }
 
   // Delete multiple objects at once
@@ -1564,24 +1773,32 @@ class S3FileSystem::Impl {
     return DeleteObjectsAsync(bucket, keys).status();
   }
 
-  Status DeleteDirContents(const std::string& bucket, const std::string& key) {
-    std::vector<std::string> file_keys;
-    std::vector<std::string> dir_keys;
-    RETURN_NOT_OK(WalkForDeleteDir(bucket, key, &file_keys, &dir_keys));
-    if (file_keys.empty() && dir_keys.empty() && !key.empty()) {
-      // No contents found, is it an empty directory?
-      bool exists = false;
-      RETURN_NOT_OK(IsEmptyDirectory(bucket, key, &exists));
-      if (!exists) {
-        return PathNotFound(bucket, key);
+  // The Impl must outlive the returned future
+  Future<> DeleteDirContentsAsync(const std::string& bucket, const std::string& key) {
+    auto delete_keys = [this, bucket,
+                        key](const std::shared_ptr<DeleteDirKeys>& keys) -> Future<> {
+      if (keys->file_keys.empty() && keys->dir_keys.empty() && !key.empty()) {
+        // No contents found, is it an empty directory?
+        bool exists = false;
+        RETURN_NOT_OK(IsEmptyDirectory(bucket, key, &exists));
+        if (!exists) {
+          return PathNotFound(bucket, key);
+        }
       }
-    }
-    // First delete all "files", then delete all child "directories"
-    RETURN_NOT_OK(DeleteObjects(bucket, file_keys));
-    // Delete directories in reverse lexicographic order, to ensure children
-    // are deleted before their parents (Minio).
-    std::sort(dir_keys.rbegin(), dir_keys.rend());
-    return DeleteObjects(bucket, dir_keys);
+      // First delete all "files", then delete all child "directories"
+      auto delete_dirs = [this, bucket, keys](const detail::Empty&) {
+        // Delete directories in reverse lexicographic order, to ensure children
+        // are deleted before their parents (Minio).
+        std::sort(keys->dir_keys.rbegin(), keys->dir_keys.rend());
+        return DeleteObjectsAsync(bucket, keys->dir_keys);
+      };
+      return DeleteObjectsAsync(bucket, keys->file_keys).Then(std::move(delete_dirs));
+    };
+    return WalkForDeleteDirAsync(bucket, key).Then(std::move(delete_keys));
+  }
+
+  Status DeleteDirContents(const std::string& bucket, const std::string& key) {
+    return DeleteDirContentsAsync(bucket, key).status();
   }
 
   Status EnsureDirectoryExists(const S3Path& path) {
@@ -1616,7 +1833,8 @@ class S3FileSystem::Impl {
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path);
+    auto ptr =
+        std::make_shared<ObjectInputFile>(client_, fs->io_context(), path, options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -1633,8 +1851,8 @@ class S3FileSystem::Impl {
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(info.path()));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr =
-        std::make_shared<ObjectInputFile>(client_, fs->io_context(), path, info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(client_, fs->io_context(), path,
+                                                 options(), info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -1762,6 +1980,35 @@ Result<std::vector<FileInfo>> S3FileSystem::GetFileInfo(const FileSelector& sele
   return results;
 }
 
+FileInfoGenerator S3FileSystem::GetFileInfoGenerator(const FileSelector& select) {
+  auto maybe_base_path = S3Path::FromString(select.base_dir);
+  if (!maybe_base_path.ok()) {
+    return MakeFailingGenerator<FileInfoVector>(maybe_base_path.status());
+  }
+  auto base_path = *std::move(maybe_base_path);
+  if (base_path.empty()) {
+    // Listing buckets is a single request
+    return FileSystem::GetFileInfoGenerator(select);
+  }
+
+  // Nominal case -> walk a single bucket, yielding each page of results
+  PushGenerator<FileInfoVector> gen;
+  auto producer = gen.producer();
+  auto sink = [producer](FileInfoVector infos) mutable {
+    producer.Push(std::move(infos));
+  };
+  auto walk = impl_->WalkAsync(select, base_path.bucket, base_path.key, sink);
+  // The closure keeps the filesystem alive until the walk is done
+  auto self = ::arrow::internal::checked_pointer_cast<S3FileSystem>(shared_from_this());
+  walk.AddCallback([self, producer](const Result<detail::Empty>& result) mutable {
+    if (!result.ok()) {
+      producer.Push(result.status());
+    }
+    producer.Close();
+  });
+  return gen;
+}
+
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
 
@@ -1836,6 +2083,21 @@ Status S3FileSystem::DeleteDirContents(const std::string& s) {
   return impl_->EnsureDirectoryExists(path);
 }
 
+Future<> S3FileSystem::DeleteDirContentsAsync(const std::string& s) {
+  ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
+
+  if (path.empty()) {
+    return Status::NotImplemented("Cannot delete all S3 buckets");
+  }
+  // The closure keeps the filesystem alive until the deletion is done
+  auto self = ::arrow::internal::checked_pointer_cast<S3FileSystem>(shared_from_this());
+  return impl_->DeleteDirContentsAsync(path.bucket, path.key)
+      .Then([self, path](const detail::Empty&) {
+        // Directory may be implicitly deleted, recreate it
+        return self->impl_->EnsureDirectoryExists(path);
+      });
+}
+
 Status S3FileSystem::DeleteRootDirContents() {
   return Status::NotImplemented("Cannot delete all S3 buckets");
 }
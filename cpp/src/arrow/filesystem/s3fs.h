@@ -72,6 +72,44 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Size of the parts of multipart uploads by OutputStream.
+  ///
+  /// Writes are buffered into parts of this size (at least 5 MiB, the S3
+  /// minimum), and larger writes are split into parts of this size.  As S3
+  /// allows at most 10000 parts per upload, this bounds the size of written
+  /// objects.  If 0 (the default), parts start at 5 MiB and grow every 100
+  /// parts, allowing objects of up to ~2.4 TB.
+  int64_t write_part_size = 0;
+
+  /// Maximum number of part uploads in flight per OutputStream.
+  ///
+  /// Only applies to background writes.  Once reached, writes block until an
+  /// upload finishes.  If 0 (the default), the number is not limited.
+  int32_t max_concurrent_part_uploads = 0;
+
+  /// Maximum number of bytes held by the part uploads in flight per OutputStream.
+  ///
+  /// Only applies to background writes.  A write which would exceed it blocks
+  /// until enough uploads finish (a single part larger than the budget is
+  /// still uploaded once no other is in flight).  Memory used by the part
+  /// being filled (at most a part size) comes on top of it.  If 0 (the
+  /// default), the memory is not limited.
+  int64_t write_memory_budget = 0;
+
+  /// Size of the ranged GET requests of large input file reads.
+  ///
+  /// A read larger than this is split into parts of this size, which are
+  /// fetched concurrently (see read_concurrency) and reassembled in the output.
+  /// A single request is often limited by the throughput of one TCP stream,
+  /// far below the network bandwidth.
+  int64_t read_part_size = 8 * 1024 * 1024;
+
+  /// Maximum number of concurrent ranged GET requests of a single read.
+  ///
+  /// Parts beyond the first are fetched on the IO executor.  1 disables
+  /// splitting reads.
+  int32_t read_concurrency = 4;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -149,10 +187,13 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
 
+  FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
   Status DeleteDir(const std::string& path) override;
   Status DeleteDirContents(const std::string& path) override;
+  Future<> DeleteDirContentsAsync(const std::string& path) override;
   Status DeleteRootDirContents() override;
 
   Status DeleteFile(const std::string& path) override;
@@ -850,6 +850,35 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileReadInParts) {
+  options_.read_part_size = 3;
+  options_.read_concurrency = 2;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(9));
+  AssertBufferEqual(*buf, "some data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 7));
+  AssertBufferEqual(*buf, "ome dat");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 20));
+  AssertBufferEqual(*buf, "me data");
+
+  char result[10];
+  ASSERT_OK_AND_EQ(8, file->ReadAt(1, 8, &result));
+  ASSERT_EQ(std::string(result, 8), "ome data");
+
+  // More parts than concurrent requests
+  options_.read_part_size = 1;
+  options_.read_concurrency = 3;
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 9));
+  AssertBufferEqual(*buf, "some data");
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
@@ -858,6 +887,21 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamBoundedUploads) {
+  // Large writes are split into fixed-size parts, uploaded one at a time
+  options_.write_part_size = 5 * 1024 * 1024;
+  options_.max_concurrent_part_uploads = 1;
+  options_.write_memory_budget = 6 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  // Several parts in flight within the memory budget
+  options_.max_concurrent_part_uploads = 0;
+  options_.write_memory_budget = 11 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
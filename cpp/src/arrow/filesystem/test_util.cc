@@ -30,6 +30,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/future.h"
 
 using ::testing::ElementsAre;
@@ -252,6 +253,24 @@ void GenericFileSystemTest::TestDeleteDirContents(FileSystem* fs) {
   AssertAllFiles(fs, {"AB/abc", "abc"});
 }
 
+void GenericFileSystemTest::TestDeleteDirContentsAsync(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("AB/CD/EF"));
+  ASSERT_OK(fs->CreateDir("AB/GH/IJ"));
+  CreateFile(fs, "AB/abc", "");
+  CreateFile(fs, "AB/CD/def", "");
+  CreateFile(fs, "AB/CD/EF/ghi", "");
+  ASSERT_FINISHES_OK(fs->DeleteDirContentsAsync("AB/CD"));
+  ASSERT_FINISHES_OK(fs->DeleteDirContentsAsync("AB/GH/IJ"));
+
+  AssertAllDirs(fs, {"AB", "AB/CD", "AB/GH", "AB/GH/IJ"});
+  AssertAllFiles(fs, {"AB/abc"});
+
+  // Not a directory
+  CreateFile(fs, "abc", "");
+  ASSERT_RAISES(IOError, fs->DeleteDirContentsAsync("abc").status());
+  AssertAllFiles(fs, {"AB/abc", "abc"});
+}
+
 void GenericFileSystemTest::TestDeleteRootDirContents(FileSystem* fs) {
   ASSERT_OK(fs->CreateDir("AB/CD"));
   CreateFile(fs, "AB/abc", "");
@@ -718,6 +737,52 @@ void GenericFileSystemTest::TestGetFileInfoSelectorAsync(FileSystem* fs) {
   ASSERT_EQ(infos.size(), 0);
 }
 
+void GenericFileSystemTest::TestGetFileInfoGenerator(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("AB/CD"));
+  CreateFile(fs, "abc", "data");
+  CreateFile(fs, "AB/def", "some data");
+  CreateFile(fs, "AB/CD/ghi", "some other data");
+  CreateFile(fs, "AB/CD/jkl", "yet other data");
+
+  auto collect = [&](const FileSelector& s) -> Result<std::vector<FileInfo>> {
+    auto fut = CollectAsyncGenerator(fs->GetFileInfoGenerator(s));
+    ARROW_ASSIGN_OR_RAISE(auto batches, fut.result());
+    std::vector<FileInfo> infos;
+    for (const auto& batch : batches) {
+      infos.insert(infos.end(), batch.begin(), batch.end());
+    }
+    SortInfos(&infos);
+    return infos;
+  };
+
+  FileSelector s;
+  s.base_dir = "";
+  std::vector<FileInfo> infos;
+
+  // Non-recursive
+  ASSERT_OK_AND_ASSIGN(infos, collect(s));
+  ASSERT_EQ(infos.size(), 2);
+  AssertFileInfo(infos[0], "AB", FileType::Directory);
+  AssertFileInfo(infos[1], "abc", FileType::File, 4);
+
+  // Recursive
+  s.base_dir = "AB";
+  s.recursive = true;
+  ASSERT_OK_AND_ASSIGN(infos, collect(s));
+  ASSERT_EQ(infos.size(), 4);
+  AssertFileInfo(infos[0], "AB/CD", FileType::Directory);
+  AssertFileInfo(infos[1], "AB/CD/ghi", FileType::File, 15);
+  AssertFileInfo(infos[2], "AB/CD/jkl", FileType::File, 14);
+  AssertFileInfo(infos[3], "AB/def", FileType::File, 9);
+
+  // Doesn't exist
+  s.base_dir = "XX";
+  ASSERT_RAISES(IOError, collect(s));
+  s.allow_not_found = true;
+  ASSERT_OK_AND_ASSIGN(infos, collect(s));
+  ASSERT_EQ(infos.size(), 0);
+}
+
 void GetSortedInfos(FileSystem* fs, FileSelector s, std::vector<FileInfo>& infos) {
   ASSERT_OK_AND_ASSIGN(infos, fs->GetFileInfo(s));
   // Clear mtime & size for easier testing.
@@ -1014,6 +1079,7 @@ GENERIC_FS_TEST_DEFINE(TestNormalizePath)
 GENERIC_FS_TEST_DEFINE(TestCreateDir)
 GENERIC_FS_TEST_DEFINE(TestDeleteDir)
 GENERIC_FS_TEST_DEFINE(TestDeleteDirContents)
+GENERIC_FS_TEST_DEFINE(TestDeleteDirContentsAsync)
 GENERIC_FS_TEST_DEFINE(TestDeleteRootDirContents)
 GENERIC_FS_TEST_DEFINE(TestDeleteFile)
 GENERIC_FS_TEST_DEFINE(TestDeleteFiles)
@@ -1026,6 +1092,7 @@ GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorWithRecursion)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoAsync)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorAsync)
+GENERIC_FS_TEST_DEFINE(TestGetFileInfoGenerator)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
@@ -20,7 +20,10 @@
 #include "arrow/flight/client.h"
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/client_middleware.h"
+#include "arrow/flight/compression.h"
+#include "arrow/flight/flow_control.h"
 #include "arrow/flight/middleware.h"
+#include "arrow/flight/multi_endpoint_reader.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
@@ -20,6 +20,11 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -27,12 +32,16 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef GRPCPP_PP_INCLUDE
 #include <grpcpp/grpcpp.h>
 #if defined(GRPC_NAMESPACE_FOR_TLS_CREDENTIALS_OPTIONS)
 #include <grpcpp/security/tls_credentials_options.h>
 #endif
+#if defined(GRPC_USE_CLIENT_CALLBACK_API)
+#include <grpcpp/support/client_callback.h>
+#endif
 #else
 #include <grpc++/grpc++.h>
 #endif
@@ -46,16 +55,21 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/client_header_internal.h"
 #include "arrow/flight/client_middleware.h"
+#include "arrow/flight/compression.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
+#include "arrow/flight/transport_internal.h"
 #include "arrow/flight/types.h"
 
 namespace arrow {
@@ -118,30 +132,98 @@ struct ClientRpc {
   }
 };
 
-/// Helper that manages Finish() of a gRPC stream.
+namespace {
+
+// Adapt the gRPC streams of the data-plane RPCs to the operations of
+// internal::ClientDataStream. Operations a stream doesn't support fail.
+
+bool GrpcReadData(grpc::ClientReader<pb::FlightData>* stream,
+                  internal::FlightData* data) {
+  return internal::ReadPayload(stream, data);
+}
+
+bool GrpcReadData(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* stream,
+                  internal::FlightData* data) {
+  return internal::ReadPayload(stream, data);
+}
+
+bool GrpcReadData(grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>*,
+                  internal::FlightData*) {
+  return false;
+}
+
+template <typename Stream>
+bool GrpcReadPutMetadata(Stream*, std::shared_ptr<Buffer>*) {
+  return false;
+}
+
+bool GrpcReadPutMetadata(grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* stream,
+                         std::shared_ptr<Buffer>* out) {
+  pb::PutResult message;
+  if (!stream->Read(&message)) {
+    return false;
+  }
+  *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
+  return true;
+}
+
+bool GrpcWriteData(grpc::ClientReader<pb::FlightData>*, const FlightPayload&) {
+  return false;
+}
+
+template <typename Stream>
+bool GrpcWriteData(Stream* stream, const FlightPayload& payload) {
+  return internal::WritePayload(payload, stream);
+}
+
+bool GrpcWritesDone(grpc::ClientReader<pb::FlightData>*) { return true; }
+
+template <typename Stream>
+bool GrpcWritesDone(Stream* stream) {
+  return stream->WritesDone();
+}
+
+}  // namespace
+
+/// A ClientDataStream over a gRPC stream.
 ///
 /// When we encounter an error (e.g. could not decode an IPC message),
 /// we want to provide both the client-side error context and any
-/// available server-side context. This helper helps wrap up that
-/// logic.
+/// available server-side context. Finish() wraps up that logic.
 ///
-/// This class protects the stream with a flag (so that Finish is
-/// idempotent), and drains the read side (so that Finish won't hang).
+/// Finish() is protected with a flag (so that it is idempotent), and
+/// drains the read side (so that gRPC's Finish won't hang).
 ///
 /// The template lets us abstract between DoGet/DoExchange and DoPut,
 /// which respectively read internal::FlightData and pb::PutResult.
 template <typename Stream, typename ReadT>
-class FinishableStream {
+class GrpcClientDataStream : public internal::ClientDataStream {
  public:
-  FinishableStream(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream)
-      : rpc_(rpc), stream_(stream), finished_(false), server_status_() {}
-  virtual ~FinishableStream() = default;
+  GrpcClientDataStream(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream,
+                       MemoryPool* memory_pool, bool allow_shared_memory = false)
+      : rpc_(std::move(rpc)),
+        stream_(std::move(stream)),
+        memory_pool_(memory_pool),
+        allow_shared_memory_(allow_shared_memory),
+        finished_(false) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    data->memory_pool = memory_pool_;
+    data->allow_shared_memory = allow_shared_memory_;
+    return GrpcReadData(stream_.get(), data);
+  }
 
-  /// \brief Get the underlying stream.
-  std::shared_ptr<Stream> stream() const { return stream_; }
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    return GrpcReadPutMetadata(stream_.get(), out);
+  }
 
-  /// \brief Finish the call, adding server context to the given status.
-  virtual Status Finish(Status st) {
+  bool WriteData(const FlightPayload& payload) override {
+    return GrpcWriteData(stream_.get(), payload);
+  }
+
+  bool WritesDone() override { return GrpcWritesDone(stream_.get()); }
+
+  Status Finish(Status st) override {
     if (finished_) {
       return MergeStatus(std::move(st));
     }
@@ -163,6 +245,8 @@ class FinishableStream {
     return MergeStatus(std::move(st));
   }
 
+  void TryCancel() override { rpc_->context.TryCancel(); }
+
  private:
   Status MergeStatus(Status&& st) {
     if (server_status_.ok()) {
@@ -174,29 +258,43 @@ class FinishableStream {
         ". gRPC client debug context: ", rpc_->context.debug_error_string());
   }
 
+  // The RPC context must outlive the stream
   std::shared_ptr<ClientRpc> rpc_;
   std::shared_ptr<Stream> stream_;
+  MemoryPool* memory_pool_;
+  bool allow_shared_memory_;
   bool finished_;
   Status server_status_;
 };
 
-/// Helper that manages \a Finish() of a read-write gRPC stream.
+/// Helper that manages \a Finish() of a read-write data stream.
 ///
 /// This also calls \a WritesDone() and protects itself with a mutex
 /// to enable sharing between the reader and writer.
-template <typename Stream, typename ReadT>
-class FinishableWritableStream : public FinishableStream<Stream, ReadT> {
+class FinishableWritableStream : public internal::ClientDataStream {
  public:
-  FinishableWritableStream(std::shared_ptr<ClientRpc> rpc,
-                           std::shared_ptr<std::mutex> read_mutex,
-                           std::shared_ptr<Stream> stream)
-      : FinishableStream<Stream, ReadT>(rpc, stream),
+  FinishableWritableStream(std::shared_ptr<std::mutex> read_mutex,
+                           std::unique_ptr<internal::ClientDataStream> stream)
+      : stream_(std::move(stream)),
         finish_mutex_(),
-        read_mutex_(read_mutex),
+        read_mutex_(std::move(read_mutex)),
         done_writing_(false) {}
-  virtual ~FinishableWritableStream() = default;
 
-  /// \brief Indicate to gRPC that the write half of the stream is done.
+  bool ReadData(internal::FlightData* data) override { return stream_->ReadData(data); }
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    return stream_->ReadPutMetadata(out);
+  }
+
+  bool WriteData(const FlightPayload& payload) override {
+    return stream_->WriteData(payload);
+  }
+
+  bool WritesDone() override { return stream_->WritesDone(); }
+
+  void TryCancel() override { stream_->TryCancel(); }
+
+  /// \brief Indicate to the server that the write half of the stream is done.
   Status DoneWriting() {
     // This is only used by the writer side of a stream, so it need
     // not be protected with a lock.
@@ -204,7 +302,7 @@ class FinishableWritableStream : public FinishableStream<Stream, ReadT> {
       return Status::OK();
     }
     done_writing_ = true;
-    if (!this->stream()->WritesDone()) {
+    if (!stream_->WritesDone()) {
       // Error happened, try to close the stream to get more detailed info
       return Finish(MakeFlightError(FlightStatusCode::Internal,
                                     "Could not flush pending record batches"));
@@ -230,10 +328,10 @@ class FinishableWritableStream : public FinishableStream<Stream, ReadT> {
 
     // Try to flush pending writes. Don't use our WritesDone() to
     // avoid recursion.
-    bool finished_writes = done_writing_ || this->stream()->WritesDone();
+    bool finished_writes = done_writing_ || stream_->WritesDone();
     done_writing_ = true;
 
-    st = FinishableStream<Stream, ReadT>::Finish(std::move(st));
+    st = stream_->Finish(std::move(st));
 
     if (!finished_writes) {
       return Status::FromDetailAndArgs(
@@ -244,6 +342,7 @@ class FinishableWritableStream : public FinishableStream<Stream, ReadT> {
   }
 
  private:
+  std::unique_ptr<internal::ClientDataStream> stream_;
   std::mutex finish_mutex_;
   std::shared_ptr<std::mutex> read_mutex_;
   bool done_writing_;
@@ -375,6 +474,138 @@ class GrpcClientInterceptorAdapterFactory
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware_;
 };
 
+// Counts the calls in progress on a pooled channel.  gRPC destroys the
+// interceptor along with the call.
+class StreamCountingInterceptor : public grpc::experimental::Interceptor {
+ public:
+  explicit StreamCountingInterceptor(std::shared_ptr<std::atomic<int64_t>> active_streams)
+      : active_streams_(std::move(active_streams)) {
+    ++*active_streams_;
+  }
+  ~StreamCountingInterceptor() override { --*active_streams_; }
+
+  void Intercept(grpc::experimental::InterceptorBatchMethods* methods) override {
+    methods->Proceed();
+  }
+
+ private:
+  std::shared_ptr<std::atomic<int64_t>> active_streams_;
+};
+
+class StreamCountingInterceptorFactory
+    : public grpc::experimental::ClientInterceptorFactoryInterface {
+ public:
+  explicit StreamCountingInterceptorFactory(
+      std::shared_ptr<std::atomic<int64_t>> active_streams)
+      : active_streams_(std::move(active_streams)) {}
+
+  grpc::experimental::Interceptor* CreateClientInterceptor(
+      grpc::experimental::ClientRpcInfo* info) override {
+    return new StreamCountingInterceptor(active_streams_);
+  }
+
+ private:
+  std::shared_ptr<std::atomic<int64_t>> active_streams_;
+};
+
+namespace {
+
+// The channels of a FlightChannelPool, grouped by location and connection
+// options.
+class GrpcChannelPool {
+ public:
+  using ChannelFactory = std::function<Status(std::shared_ptr<std::atomic<int64_t>>,
+                                              std::shared_ptr<grpc::Channel>*)>;
+
+  explicit GrpcChannelPool(int max_streams_per_channel)
+      : max_streams_per_channel_(max_streams_per_channel) {}
+
+  /// Get the least busy channel for the given key, opening one with
+  /// `make_channel` if there is none or all of them are at capacity.
+  /// `keep_alive` is kept alongside a new channel.
+  Status GetChannel(const std::string& key, const ChannelFactory& make_channel,
+                    std::shared_ptr<void> keep_alive,
+                    std::shared_ptr<grpc::Channel>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Entry>& entries = channels_[key];
+    Entry* best = nullptr;
+    for (auto& entry : entries) {
+      if (best == nullptr || *entry.active_streams < *best->active_streams) {
+        best = &entry;
+      }
+    }
+    if (best == nullptr ||
+        (max_streams_per_channel_ > 0 &&
+         *best->active_streams >= max_streams_per_channel_)) {
+      Entry entry;
+      entry.active_streams = std::make_shared<std::atomic<int64_t>>(0);
+      RETURN_NOT_OK(make_channel(entry.active_streams, &entry.channel));
+      entry.keep_alive = std::move(keep_alive);
+      entries.push_back(std::move(entry));
+      best = &entries.back();
+    }
+    *out = best->channel;
+    return Status::OK();
+  }
+
+  int64_t num_channels() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = 0;
+    for (const auto& pair : channels_) {
+      total += static_cast<int64_t>(pair.second.size());
+    }
+    return total;
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<grpc::Channel> channel;
+    std::shared_ptr<std::atomic<int64_t>> active_streams;
+    std::shared_ptr<void> keep_alive;
+  };
+
+  const int max_streams_per_channel_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::vector<Entry>> channels_;
+};
+
+// Identify the channels that can be shared between clients
+std::string ChannelPoolKey(const Location& location,
+                           const FlightClientOptions& options) {
+  std::stringstream key;
+  key << location.ToString() << '\0' << options.tls_root_certs << '\0'
+      << options.override_hostname << '\0' << options.cert_chain << '\0'
+      << options.private_key << '\0' << options.disable_server_verification;
+  for (const auto& arg : options.generic_options) {
+    key << '\0' << arg.first << '=';
+    if (util::holds_alternative<int>(arg.second)) {
+      key << 'i' << util::get<int>(arg.second);
+    } else if (util::holds_alternative<std::string>(arg.second)) {
+      key << 's' << util::get<std::string>(arg.second);
+    }
+  }
+  // Middleware is attached to the channel, so clients can only share a
+  // channel if they use the same middleware instances
+  for (const auto& middleware : options.middleware) {
+    key << '\0' << middleware.get();
+  }
+  return key.str();
+}
+
+}  // namespace
+
+class FlightChannelPool::Impl : public GrpcChannelPool {
+ public:
+  using GrpcChannelPool::GrpcChannelPool;
+};
+
+FlightChannelPool::FlightChannelPool(int max_streams_per_channel)
+    : impl_(new Impl(max_streams_per_channel)) {}
+
+FlightChannelPool::~FlightChannelPool() = default;
+
+int64_t FlightChannelPool::num_channels() const { return impl_->num_channels(); }
+
 class GrpcClientAuthSender : public ClientAuthSender {
  public:
   explicit GrpcClientAuthSender(
@@ -419,19 +650,18 @@ class GrpcClientAuthReader : public ClientAuthReader {
       stream_;
 };
 
-// An ipc::MessageReader that adapts any readable gRPC stream
+// An ipc::MessageReader that adapts any readable data stream
 // returning FlightData.
-template <typename Reader>
-class GrpcIpcMessageReader : public ipc::MessageReader {
+class ClientIpcMessageReader : public ipc::MessageReader {
  public:
-  GrpcIpcMessageReader(
-      std::shared_ptr<ClientRpc> rpc, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<FinishableStream<Reader, internal::FlightData>> stream,
-      std::shared_ptr<internal::PeekableFlightDataReader<std::shared_ptr<Reader>>>
+  ClientIpcMessageReader(
+      std::shared_ptr<std::mutex> read_mutex,
+      std::shared_ptr<internal::ClientDataStream> stream,
+      std::shared_ptr<
+          internal::PeekableFlightDataReader<std::shared_ptr<internal::ClientDataStream>>>
           peekable_reader,
       std::shared_ptr<Buffer>* app_metadata)
-      : rpc_(rpc),
-        read_mutex_(read_mutex),
+      : read_mutex_(read_mutex),
         stream_(std::move(stream)),
         peekable_reader_(peekable_reader),
         app_metadata_(app_metadata),
@@ -461,15 +691,14 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
   }
 
  private:
-  // The RPC context lifetime must be coupled to the ClientReader
-  std::shared_ptr<ClientRpc> rpc_;
   // Guard reads with a mutex to prevent concurrent reads if the write
   // side calls Finish(). Nullable as DoGet doesn't need this.
   std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<FinishableStream<Reader, internal::FlightData>> stream_;
-  std::shared_ptr<internal::PeekableFlightDataReader<std::shared_ptr<Reader>>>
+  std::shared_ptr<internal::ClientDataStream> stream_;
+  std::shared_ptr<
+      internal::PeekableFlightDataReader<std::shared_ptr<internal::ClientDataStream>>>
       peekable_reader_;
-  // A reference to GrpcStreamReader.app_metadata_. That class
+  // A reference to ClientStreamReader.app_metadata_. That class
   // can't access the app metadata because when it Peek()s the stream,
   // it may be looking at a dictionary batch, not the record
   // batch. Updating it here ensures the reader is always updated with
@@ -480,18 +709,16 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
 
 /// The implementation of the public-facing API for reading from a
 /// FlightData stream
-template <typename Reader>
-class GrpcStreamReader : public FlightStreamReader {
+class ClientStreamReader : public FlightStreamReader {
  public:
-  GrpcStreamReader(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<std::mutex> read_mutex,
-                   const ipc::IpcReadOptions& options,
-                   std::shared_ptr<FinishableStream<Reader, internal::FlightData>> stream)
-      : rpc_(rpc),
-        read_mutex_(read_mutex),
+  ClientStreamReader(std::shared_ptr<std::mutex> read_mutex,
+                     const ipc::IpcReadOptions& options,
+                     std::shared_ptr<internal::ClientDataStream> stream)
+      : read_mutex_(read_mutex),
         options_(options),
         stream_(stream),
-        peekable_reader_(new internal::PeekableFlightDataReader<std::shared_ptr<Reader>>(
-            stream->stream())),
+        peekable_reader_(new internal::PeekableFlightDataReader<
+                         std::shared_ptr<internal::ClientDataStream>>(stream)),
         app_metadata_(nullptr) {}
 
   Status EnsureDataStarted() {
@@ -507,9 +734,9 @@ class GrpcStreamReader : public FlightStreamReader {
             FlightStatusCode::Internal, "Server never sent a data message"));
       }
 
-      auto message_reader =
-          std::unique_ptr<ipc::MessageReader>(new GrpcIpcMessageReader<Reader>(
-              rpc_, read_mutex_, stream_, peekable_reader_, &app_metadata_));
+      auto message_reader = std::unique_ptr<ipc::MessageReader>(
+          new ClientIpcMessageReader(read_mutex_, stream_, peekable_reader_,
+                                     &app_metadata_));
       auto result =
           ipc::RecordBatchStreamReader::Open(std::move(message_reader), options_);
       RETURN_NOT_OK(OverrideWithServerError(std::move(result).Value(&batch_reader_)));
@@ -552,7 +779,7 @@ class GrpcStreamReader : public FlightStreamReader {
     out->app_metadata = std::move(app_metadata_);
     return Status::OK();
   }
-  void Cancel() override { rpc_->context.TryCancel(); }
+  void Cancel() override { stream_->TryCancel(); }
 
  private:
   std::unique_lock<std::mutex> TakeGuard() {
@@ -567,59 +794,353 @@ class GrpcStreamReader : public FlightStreamReader {
     return stream_->Finish(std::move(st));
   }
 
-  friend class GrpcIpcMessageReader<Reader>;
-  std::shared_ptr<ClientRpc> rpc_;
   // Guard reads with a lock to prevent Finish()/Close() from being
   // called on the writer while the reader has a pending
   // read. Nullable, as DoGet() doesn't need this.
   std::shared_ptr<std::mutex> read_mutex_;
   ipc::IpcReadOptions options_;
-  std::shared_ptr<FinishableStream<Reader, internal::FlightData>> stream_;
-  std::shared_ptr<internal::PeekableFlightDataReader<std::shared_ptr<Reader>>>
+  std::shared_ptr<internal::ClientDataStream> stream_;
+  std::shared_ptr<
+      internal::PeekableFlightDataReader<std::shared_ptr<internal::ClientDataStream>>>
       peekable_reader_;
   std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> app_metadata_;
 };
 
+AsyncFlightStreamReader::~AsyncFlightStreamReader() = default;
+
+namespace {
+
+/// Decodes the FlightData messages of a stream as they arrive, for
+/// readers which can't block waiting for the next message.
+class FlightDataDecoder {
+ public:
+  static constexpr int32_t kIpcContinuationToken = -1;
+
+  explicit FlightDataDecoder(const ipc::IpcReadOptions& options)
+      : listener_(std::make_shared<Listener>()), decoder_(listener_, options) {}
+
+  std::shared_ptr<Schema> schema() const { return decoder_.schema(); }
+
+  /// Decode a message.  `*chunk` is set if the message yields a chunk.
+  Status Consume(internal::FlightData* data, util::optional<FlightStreamChunk>* chunk) {
+    if (!data->metadata) {
+      // Metadata-only message.  As in DoGet, those preceding the schema
+      // are discarded.
+      if (schema() && data->app_metadata) {
+        *chunk = FlightStreamChunk{nullptr, std::move(data->app_metadata)};
+      }
+      return Status::OK();
+    }
+
+    // Frame the message as in an IPC stream
+    const int64_t metadata_size = data->metadata->size();
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf8(metadata_size);
+    if (padded_size > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("IPC metadata too large");
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> header,
+                          AllocateBuffer(2 * sizeof(int32_t) + padded_size));
+    uint8_t* out = header->mutable_data();
+    const int32_t prefix[2] = {BitUtil::ToLittleEndian(kIpcContinuationToken),
+                               BitUtil::ToLittleEndian(static_cast<int32_t>(padded_size))};
+    std::memcpy(out, prefix, sizeof(prefix));
+    std::memcpy(out + sizeof(prefix), data->metadata->data(), metadata_size);
+    std::memset(out + sizeof(prefix) + metadata_size, 0, padded_size - metadata_size);
+    RETURN_NOT_OK(decoder_.Consume(std::move(header)));
+    RETURN_NOT_OK(internal::MapSharedMemoryBody(data));
+    if (data->body && data->body->size() > 0) {
+      RETURN_NOT_OK(decoder_.Consume(std::move(data->body)));
+    }
+
+    if (listener_->batch) {
+      *chunk = FlightStreamChunk{std::move(listener_->batch), std::move(data->app_metadata)};
+      listener_->batch = nullptr;
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Listener : public ipc::Listener {
+    Status OnRecordBatchDecoded(std::shared_ptr<RecordBatch> record_batch) override {
+      batch = std::move(record_batch);
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  std::shared_ptr<Listener> listener_;
+  ipc::StreamDecoder decoder_;
+};
+
+#ifdef GRPC_USE_CLIENT_CALLBACK_API
+
+constexpr char kDoGetMethodName[] = "/arrow.flight.protocol.FlightService/DoGet";
+
+/// A DoGet call using the gRPC callback API.
+///
+/// At most one message is read ahead of the consumer.  The reactor keeps
+/// itself alive until gRPC is done with it, and holds the call open (with
+/// AddHold) for as long as it may start another read.
+class DoGetReactor : public grpc::ClientReadReactor<pb::FlightData>,
+                     public std::enable_shared_from_this<DoGetReactor> {
+ public:
+  DoGetReactor(const FlightCallOptions& options, bool allow_shared_memory)
+      : rpc_(options),
+        decoder_(options.read_options),
+        memory_pool_(options.read_options.memory_pool),
+        allow_shared_memory_(allow_shared_memory),
+        schema_(Future<std::shared_ptr<Schema>>::Make()) {}
+
+  ClientRpc* rpc() { return &rpc_; }
+
+  void Start(grpc::ChannelInterface* channel, const grpc::internal::RpcMethod& method,
+             pb::Ticket ticket) {
+    self_ = shared_from_this();
+    ticket_ = std::move(ticket);
+    grpc::internal::ClientCallbackReaderFactory<pb::FlightData>::Create(
+        channel, method, &rpc_.context, &ticket_, this);
+    AddHold();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reading_ = true;
+    }
+    StartNextRead();
+    StartCall();
+  }
+
+  Future<std::shared_ptr<Schema>> GetSchema() { return schema_; }
+
+  Future<FlightStreamChunk> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!ready_.empty()) {
+      FlightStreamChunk chunk = std::move(ready_.front());
+      ready_.pop_front();
+      const Action action = UpdateLocked();
+      lock.unlock();
+      Perform(action);
+      return Future<FlightStreamChunk>::MakeFinished(std::move(chunk));
+    }
+    if (done_) {
+      if (!status_.ok()) {
+        return Future<FlightStreamChunk>::MakeFinished(status_);
+      }
+      return Future<FlightStreamChunk>::MakeFinished(FlightStreamChunk{});
+    }
+    auto future = Future<FlightStreamChunk>::Make();
+    waiters_.push_back(future);
+    const Action action = UpdateLocked();
+    lock.unlock();
+    Perform(action);
+    return future;
+  }
+
+  void Cancel() {
+    rpc_.context.TryCancel();
+    std::unique_lock<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    ready_.clear();
+    const Action action = UpdateLocked();
+    lock.unlock();
+    Perform(action);
+  }
+
+  void OnReadDone(bool ok) override {
+    util::optional<FlightStreamChunk> chunk;
+    Status st;
+    if (ok) {
+      st = decoder_.Consume(&data_, &chunk);
+      data_ = internal::FlightData();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    reading_ = false;
+    if (!ok) {
+      // End of stream or failure; OnDone() gives the status
+      ended_ = true;
+    } else if (!st.ok()) {
+      client_status_ = std::move(st);
+      cancelled_ = true;
+      rpc_.context.TryCancel();
+    }
+    const bool schema_decoded = !schema_decoded_ && decoder_.schema();
+    schema_decoded_ = schema_decoded_ || schema_decoded;
+    Future<FlightStreamChunk> waiter;
+    if (chunk.has_value()) {
+      if (waiters_.empty()) {
+        ready_.push_back(std::move(*chunk));
+      } else {
+        waiter = std::move(waiters_.front());
+        waiters_.pop_front();
+      }
+    }
+    const Action action = UpdateLocked();
+    lock.unlock();
+
+    if (schema_decoded) {
+      schema_.MarkFinished(decoder_.schema());
+    }
+    if (waiter.is_valid()) {
+      waiter.MarkFinished(std::move(*chunk));
+    }
+    Perform(action);
+  }
+
+  void OnDone(const grpc::Status& grpc_status) override {
+    Status st = internal::FromGrpcStatus(grpc_status, &rpc_.context);
+    std::deque<Future<FlightStreamChunk>> waiters;
+    bool schema_decoded;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!client_status_.ok()) {
+        st = client_status_;
+      }
+      status_ = st;
+      done_ = true;
+      waiters.swap(waiters_);
+      schema_decoded = schema_decoded_;
+    }
+    if (!schema_decoded) {
+      schema_.MarkFinished(st.ok() ? MakeFlightError(FlightStatusCode::Internal,
+                                                     "Server never sent a data message")
+                                   : st);
+    }
+    for (auto& waiter : waiters) {
+      if (st.ok()) {
+        waiter.MarkFinished(FlightStreamChunk{});
+      } else {
+        waiter.MarkFinished(st);
+      }
+    }
+    // May destroy this reactor
+    auto self = std::move(self_);
+  }
+
+ private:
+  enum class Action { kNone, kRead, kRemoveHold };
+
+  Action UpdateLocked() {
+    if (hold_removed_ || reading_) {
+      return Action::kNone;
+    }
+    if (ended_ || cancelled_) {
+      hold_removed_ = true;
+      return Action::kRemoveHold;
+    }
+    if (ready_.empty()) {
+      reading_ = true;
+      return Action::kRead;
+    }
+    return Action::kNone;
+  }
+
+  // Reactor operations are performed without holding the mutex, as gRPC
+  // may run reactions inline
+  void Perform(Action action) {
+    if (action == Action::kRead) {
+      StartNextRead();
+    } else if (action == Action::kRemoveHold) {
+      RemoveHold();
+    }
+  }
+
+  void StartNextRead() {
+    data_.memory_pool = memory_pool_;
+    data_.allow_shared_memory = allow_shared_memory_;
+    StartRead(reinterpret_cast<pb::FlightData*>(&data_));
+  }
+
+  ClientRpc rpc_;
+  pb::Ticket ticket_;
+  FlightDataDecoder decoder_;
+  MemoryPool* memory_pool_;
+  bool allow_shared_memory_;
+  // Only accessed by the read in progress
+  internal::FlightData data_;
+  Future<std::shared_ptr<Schema>> schema_;
+  std::shared_ptr<DoGetReactor> self_;
+
+  std::mutex mutex_;
+  std::deque<FlightStreamChunk> ready_;
+  std::deque<Future<FlightStreamChunk>> waiters_;
+  bool reading_ = false;
+  bool ended_ = false;
+  bool cancelled_ = false;
+  bool hold_removed_ = false;
+  bool schema_decoded_ = false;
+  bool done_ = false;
+  Status client_status_;
+  Status status_;
+};
+
+class GrpcAsyncStreamReader : public AsyncFlightStreamReader {
+ public:
+  explicit GrpcAsyncStreamReader(std::shared_ptr<DoGetReactor> reactor)
+      : reactor_(std::move(reactor)) {}
+
+  ~GrpcAsyncStreamReader() override { reactor_->Cancel(); }
+
+  Future<std::shared_ptr<Schema>> GetSchema() override { return reactor_->GetSchema(); }
+  Future<FlightStreamChunk> Next() override { return reactor_->Next(); }
+  void Cancel() override { reactor_->Cancel(); }
+
+ private:
+  std::shared_ptr<DoGetReactor> reactor_;
+};
+
+#endif  // GRPC_USE_CLIENT_CALLBACK_API
+
+Future<std::shared_ptr<RecordBatch>> NextRecordBatch(
+    const std::shared_ptr<AsyncFlightStreamReader>& reader) {
+  return reader->Next().Then(
+      [reader](const FlightStreamChunk& chunk) -> Future<std::shared_ptr<RecordBatch>> {
+        if (!chunk.data && chunk.app_metadata) {
+          // Skip metadata-only messages
+          return NextRecordBatch(reader);
+        }
+        return Future<std::shared_ptr<RecordBatch>>::MakeFinished(chunk.data);
+      });
+}
+
+}  // namespace
+
+std::function<Future<std::shared_ptr<RecordBatch>>()> MakeRecordBatchGenerator(
+    std::shared_ptr<AsyncFlightStreamReader> reader) {
+  return [reader]() { return NextRecordBatch(reader); };
+}
+
 // The next two classes implement writing to a FlightData stream.
 // Similarly to the read side, we want to reuse the implementation of
 // RecordBatchWriter. As a result, these two classes are intertwined
 // in order to pass application metadata "through" RecordBatchWriter.
 // In order to get application-specific metadata to the
 // IpcPayloadWriter, DoPutPayloadWriter takes a pointer to
-// GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
+// ClientStreamWriter. ClientStreamWriter updates a metadata field on
 // write; DoPutPayloadWriter reads that metadata field to determine
 // what to write.
 
-template <typename ProtoReadT, typename FlightReadT>
 class DoPutPayloadWriter;
 
-template <typename ProtoReadT, typename FlightReadT>
-class GrpcStreamWriter : public FlightStreamWriter {
+class ClientStreamWriter : public FlightStreamWriter {
  public:
-  ~GrpcStreamWriter() override = default;
+  ~ClientStreamWriter() override = default;
 
-  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
-
-  explicit GrpcStreamWriter(
-      const FlightDescriptor& descriptor, std::shared_ptr<ClientRpc> rpc,
-      int64_t write_size_limit_bytes, const ipc::IpcWriteOptions& options,
-      std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer)
+  explicit ClientStreamWriter(const FlightDescriptor& descriptor,
+                              int64_t write_size_limit_bytes,
+                              const ipc::IpcWriteOptions& options,
+                              std::shared_ptr<FinishableWritableStream> writer)
       : app_metadata_(nullptr),
         batch_writer_(nullptr),
         writer_(std::move(writer)),
-        rpc_(std::move(rpc)),
         write_size_limit_bytes_(write_size_limit_bytes),
         options_(options),
         descriptor_(descriptor),
         writer_closed_(false) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema,
-      const ipc::IpcWriteOptions& options, std::shared_ptr<ClientRpc> rpc,
-      int64_t write_size_limit_bytes,
-      std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema,
+                     const ipc::IpcWriteOptions& options, int64_t write_size_limit_bytes,
+                     std::shared_ptr<FinishableWritableStream> writer,
+                     std::unique_ptr<FlightStreamWriter>* out);
 
   Status CheckStarted() {
     if (!batch_writer_) {
@@ -629,19 +1150,7 @@ class GrpcStreamWriter : public FlightStreamWriter {
   }
 
   Status Begin(const std::shared_ptr<Schema>& schema,
-               const ipc::IpcWriteOptions& options) override {
-    if (batch_writer_) {
-      return Status::Invalid("This writer has already been started.");
-    }
-    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
-        new DoPutPayloadWriter<ProtoReadT, FlightReadT>(
-            descriptor_, std::move(rpc_), write_size_limit_bytes_, writer_, this));
-    // XXX: this does not actually write the message to the stream.
-    // See Close().
-    ARROW_ASSIGN_OR_RAISE(batch_writer_, ipc::internal::OpenRecordBatchWriter(
-                                             std::move(payload_writer), schema, options));
-    return Status::OK();
-  }
+               const ipc::IpcWriteOptions& options) override;
 
   Status Begin(const std::shared_ptr<Schema>& schema) override {
     return Begin(schema, options_);
@@ -655,7 +1164,7 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) override {
     FlightPayload payload{};
     payload.app_metadata = app_metadata;
-    if (!internal::WritePayload(payload, writer_->stream().get())) {
+    if (!writer_->WriteData(payload)) {
       return writer_->Finish(MakeFlightError(FlightStatusCode::Internal,
                                              "Could not write metadata to stream"));
     }
@@ -704,34 +1213,27 @@ class GrpcStreamWriter : public FlightStreamWriter {
   }
 
  private:
-  friend class DoPutPayloadWriter<ProtoReadT, FlightReadT>;
+  friend class DoPutPayloadWriter;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer_;
+  std::shared_ptr<FinishableWritableStream> writer_;
 
   // Fields used to lazy-initialize the IpcPayloadWriter. They're
   // invalid once Begin() is called.
-  std::shared_ptr<ClientRpc> rpc_;
   int64_t write_size_limit_bytes_;
   ipc::IpcWriteOptions options_;
   FlightDescriptor descriptor_;
   bool writer_closed_;
 };
 
-/// A IpcPayloadWriter implementation that writes to a gRPC stream of
+/// A IpcPayloadWriter implementation that writes to a data stream of
 /// FlightData messages.
-template <typename ProtoReadT, typename FlightReadT>
 class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
-
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::shared_ptr<ClientRpc> rpc,
-      int64_t write_size_limit_bytes,
-      std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer,
-      GrpcStreamWriter<ProtoReadT, FlightReadT>* stream_writer)
+  DoPutPayloadWriter(const FlightDescriptor& descriptor, int64_t write_size_limit_bytes,
+                     std::shared_ptr<FinishableWritableStream> writer,
+                     ClientStreamWriter* stream_writer)
       : descriptor_(descriptor),
-        rpc_(rpc),
         write_size_limit_bytes_(write_size_limit_bytes),
         writer_(std::move(writer)),
         first_payload_(true),
@@ -775,7 +1277,7 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       }
     }
 
-    if (!internal::WritePayload(payload, writer_->stream().get())) {
+    if (!writer_->WriteData(payload)) {
       return writer_->Finish(MakeFlightError(FlightStatusCode::Internal,
                                              "Could not write record batch to stream"));
     }
@@ -783,30 +1285,40 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
   }
 
   Status Close() override {
-    // Closing is handled one layer up in GrpcStreamWriter::Close
+    // Closing is handled one layer up in ClientStreamWriter::Close
     return Status::OK();
   }
 
  protected:
   const FlightDescriptor descriptor_;
-  std::shared_ptr<ClientRpc> rpc_;
   int64_t write_size_limit_bytes_;
-  std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer_;
+  std::shared_ptr<FinishableWritableStream> writer_;
   bool first_payload_;
-  GrpcStreamWriter<ProtoReadT, FlightReadT>* stream_writer_;
+  ClientStreamWriter* stream_writer_;
 };
 
-template <typename ProtoReadT, typename FlightReadT>
-Status GrpcStreamWriter<ProtoReadT, FlightReadT>::Open(
+Status ClientStreamWriter::Begin(const std::shared_ptr<Schema>& schema,
+                                 const ipc::IpcWriteOptions& options) {
+  if (batch_writer_) {
+    return Status::Invalid("This writer has already been started.");
+  }
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      new DoPutPayloadWriter(descriptor_, write_size_limit_bytes_, writer_, this));
+  // XXX: this does not actually write the message to the stream.
+  // See Close().
+  ARROW_ASSIGN_OR_RAISE(batch_writer_, ipc::internal::OpenRecordBatchWriter(
+                                           std::move(payload_writer), schema, options));
+  return Status::OK();
+}
+
+Status ClientStreamWriter::Open(
     const FlightDescriptor& descriptor,
     std::shared_ptr<Schema> schema,  // this schema is nullable
-    const ipc::IpcWriteOptions& options, std::shared_ptr<ClientRpc> rpc,
-    int64_t write_size_limit_bytes,
-    std::shared_ptr<FinishableWritableStream<GrpcStream, FlightReadT>> writer,
+    const ipc::IpcWriteOptions& options, int64_t write_size_limit_bytes,
+    std::shared_ptr<FinishableWritableStream> writer,
     std::unique_ptr<FlightStreamWriter>* out) {
-  std::unique_ptr<GrpcStreamWriter<ProtoReadT, FlightReadT>> instance(
-      new GrpcStreamWriter<ProtoReadT, FlightReadT>(
-          descriptor, std::move(rpc), write_size_limit_bytes, options, writer));
+  std::unique_ptr<ClientStreamWriter> instance(
+      new ClientStreamWriter(descriptor, write_size_limit_bytes, options, writer));
   if (schema) {
     // The schema was provided (DoPut). Eagerly write the schema and
     // descriptor together as the first message.
@@ -817,7 +1329,7 @@ Status GrpcStreamWriter<ProtoReadT, FlightReadT>::Open(
     // calls Begin() to send data, we'll send a redundant descriptor.
     FlightPayload payload{};
     RETURN_NOT_OK(internal::ToPayload(descriptor, &payload.descriptor));
-    if (!internal::WritePayload(payload, instance->writer_->stream().get())) {
+    if (!instance->writer_->WriteData(payload)) {
       return writer->Finish(MakeFlightError(FlightStatusCode::Internal,
                                             "Could not write descriptor to stream"));
     }
@@ -828,19 +1340,15 @@ Status GrpcStreamWriter<ProtoReadT, FlightReadT>::Open(
 
 FlightMetadataReader::~FlightMetadataReader() = default;
 
-class GrpcMetadataReader : public FlightMetadataReader {
+class ClientMetadataReader : public FlightMetadataReader {
  public:
-  explicit GrpcMetadataReader(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader,
-      std::shared_ptr<std::mutex> read_mutex)
-      : reader_(reader), read_mutex_(read_mutex) {}
+  explicit ClientMetadataReader(std::shared_ptr<internal::ClientDataStream> reader,
+                                std::shared_ptr<std::mutex> read_mutex)
+      : reader_(std::move(reader)), read_mutex_(std::move(read_mutex)) {}
 
   Status ReadMetadata(std::shared_ptr<Buffer>* out) override {
     std::lock_guard<std::mutex> guard(*read_mutex_);
-    pb::PutResult message;
-    if (reader_->Read(&message)) {
-      *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
-    } else {
+    if (!reader_->ReadPutMetadata(out)) {
       // Stream finished
       *out = nullptr;
     }
@@ -848,7 +1356,7 @@ class GrpcMetadataReader : public FlightMetadataReader {
   }
 
  private:
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader_;
+  std::shared_ptr<internal::ClientDataStream> reader_;
   std::shared_ptr<std::mutex> read_mutex_;
 };
 
@@ -879,7 +1387,8 @@ constexpr char kDummyRootCert[] =
 }  // namespace
 class FlightClient::FlightClientImpl {
  public:
-  Status Connect(const Location& location, const FlightClientOptions& options) {
+  Status Connect(const Location& location, const FlightClientOptions& options,
+                 GrpcChannelPool* channel_pool) {
     const std::string& scheme = location.scheme();
 
     std::stringstream grpc_uri;
@@ -991,16 +1500,44 @@ class FlightClient::FlightClientImpl {
       args.SetInt(pair.first, pair.second);
     }
 
-    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
-        interceptors;
-    interceptors.emplace_back(
-        new GrpcClientInterceptorAdapterFactory(std::move(options.middleware)));
+    auto make_channel = [&](std::shared_ptr<std::atomic<int64_t>> active_streams,
+                            std::shared_ptr<grpc::Channel>* out) {
+      std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+          interceptors;
+      interceptors.emplace_back(
+          new GrpcClientInterceptorAdapterFactory(options.middleware));
+      if (active_streams) {
+        interceptors.emplace_back(
+            new StreamCountingInterceptorFactory(std::move(active_streams)));
+      }
+      *out = grpc::experimental::CreateCustomChannelWithInterceptors(
+          grpc_uri.str(), creds, args, std::move(interceptors));
+      return Status::OK();
+    };
 
-    stub_ = pb::FlightService::NewStub(
-        grpc::experimental::CreateCustomChannelWithInterceptors(
-            grpc_uri.str(), creds, args, std::move(interceptors)));
+    std::shared_ptr<grpc::Channel> channel;
+    if (channel_pool) {
+      std::shared_ptr<void> keep_alive;
+#if defined(GRPC_NAMESPACE_FOR_TLS_CREDENTIALS_OPTIONS)
+      // The channel may outlive this client
+      keep_alive = noop_auth_check_;
+#endif
+      RETURN_NOT_OK(channel_pool->GetChannel(ChannelPoolKey(location, options),
+                                             make_channel, std::move(keep_alive),
+                                             &channel));
+    } else {
+      RETURN_NOT_OK(make_channel(nullptr, &channel));
+    }
+    stub_ = pb::FlightService::NewStub(channel);
+#ifdef GRPC_USE_CLIENT_CALLBACK_API
+    do_get_method_.reset(new grpc::internal::RpcMethod(
+        kDoGetMethodName, grpc::internal::RpcMethod::SERVER_STREAMING, channel));
+#endif
+    channel_ = std::move(channel);
 
     write_size_limit_bytes_ = options.write_size_limit_bytes;
+    accept_compression_ = internal::FormatCodecList(options.accepted_compression);
+    use_shared_memory_ = options.use_shared_memory;
     return Status::OK();
   }
 
@@ -1152,21 +1689,42 @@ class FlightClient::FlightClientImpl {
 
   Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
                std::unique_ptr<FlightStreamReader>* out) {
-    using StreamReader = GrpcStreamReader<grpc::ClientReader<pb::FlightData>>;
+    using GrpcStream = grpc::ClientReader<pb::FlightData>;
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream =
-        stub_->DoGet(&rpc->context, pb_ticket);
-    auto finishable_stream = std::make_shared<
-        FinishableStream<grpc::ClientReader<pb::FlightData>, internal::FlightData>>(
-        rpc, stream);
-    *out = std::unique_ptr<StreamReader>(
-        new StreamReader(rpc, nullptr, options.read_options, finishable_stream));
+    AcceptCompression(rpc.get());
+    RequestSharedMemory(rpc.get());
+    std::shared_ptr<GrpcStream> stream = stub_->DoGet(&rpc->context, pb_ticket);
+    auto data_stream =
+        std::make_shared<GrpcClientDataStream<GrpcStream, internal::FlightData>>(
+            rpc, stream, options.read_options.memory_pool, use_shared_memory_);
+    *out = std::unique_ptr<ClientStreamReader>(
+        new ClientStreamReader(nullptr, options.read_options, std::move(data_stream)));
     // Eagerly read the schema
-    return static_cast<StreamReader*>(out->get())->EnsureDataStarted();
+    return static_cast<ClientStreamReader*>(out->get())->EnsureDataStarted();
+  }
+
+  Status DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                    std::shared_ptr<AsyncFlightStreamReader>* out) {
+#ifdef GRPC_USE_CLIENT_CALLBACK_API
+    pb::Ticket pb_ticket;
+    internal::ToProto(ticket, &pb_ticket);
+
+    auto reactor = std::make_shared<DoGetReactor>(options, use_shared_memory_);
+    RETURN_NOT_OK(reactor->rpc()->SetToken(auth_handler_.get()));
+    AcceptCompression(reactor->rpc());
+    RequestSharedMemory(reactor->rpc());
+    reactor->Start(channel_.get(), *do_get_method_, std::move(pb_ticket));
+    *out = std::make_shared<GrpcAsyncStreamReader>(std::move(reactor));
+    return Status::OK();
+#else
+    return Status::NotImplemented(
+        "Asynchronous DoGet is unsupported. Please use a release of Arrow Flight built "
+        "with gRPC 1.36 or higher.");
+#endif
   }
 
   Status DoPut(const FlightCallOptions& options, const FlightDescriptor& descriptor,
@@ -1174,7 +1732,6 @@ class FlightClient::FlightClientImpl {
                std::unique_ptr<FlightStreamWriter>* out,
                std::unique_ptr<FlightMetadataReader>* reader) {
     using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
-    using StreamWriter = GrpcStreamWriter<pb::PutResult, pb::PutResult>;
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
@@ -1182,42 +1739,62 @@ class FlightClient::FlightClientImpl {
     // The writer drains the reader on close to avoid hanging inside
     // gRPC. Concurrent reads are unsafe, so a mutex protects this operation.
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
-    auto finishable_stream =
-        std::make_shared<FinishableWritableStream<GrpcStream, pb::PutResult>>(
-            rpc, read_mutex, stream);
-    *reader =
-        std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(stream, read_mutex));
-    return StreamWriter::Open(descriptor, schema, options.write_options, rpc,
-                              write_size_limit_bytes_, finishable_stream, out);
+    auto finishable_stream = std::make_shared<FinishableWritableStream>(
+        read_mutex,
+        std::unique_ptr<internal::ClientDataStream>(
+            new GrpcClientDataStream<GrpcStream, pb::PutResult>(
+                rpc, stream, options.read_options.memory_pool)));
+    *reader = std::unique_ptr<FlightMetadataReader>(
+        new ClientMetadataReader(finishable_stream, read_mutex));
+    return ClientStreamWriter::Open(descriptor, schema, options.write_options,
+                                    write_size_limit_bytes_, finishable_stream, out);
   }
 
   Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
                     std::unique_ptr<FlightStreamWriter>* writer,
                     std::unique_ptr<FlightStreamReader>* reader) {
     using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>;
-    using StreamReader = GrpcStreamReader<GrpcStream>;
-    using StreamWriter = GrpcStreamWriter<pb::FlightData, internal::FlightData>;
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>> stream =
-        stub_->DoExchange(&rpc->context);
+    std::shared_ptr<GrpcStream> stream = stub_->DoExchange(&rpc->context);
     // The writer drains the reader on close to avoid hanging inside
     // gRPC. Concurrent reads are unsafe, so a mutex protects this operation.
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
-    auto finishable_stream =
-        std::make_shared<FinishableWritableStream<GrpcStream, internal::FlightData>>(
-            rpc, read_mutex, stream);
-    *reader = std::unique_ptr<StreamReader>(
-        new StreamReader(rpc, read_mutex, options.read_options, finishable_stream));
+    auto finishable_stream = std::make_shared<FinishableWritableStream>(
+        read_mutex,
+        std::unique_ptr<internal::ClientDataStream>(
+            new GrpcClientDataStream<GrpcStream, internal::FlightData>(
+                rpc, stream, options.read_options.memory_pool)));
+    *reader = std::unique_ptr<FlightStreamReader>(
+        new ClientStreamReader(read_mutex, options.read_options, finishable_stream));
     // Do not eagerly read the schema. There may be metadata messages
     // before any data is sent, or data may not be sent at all.
-    return StreamWriter::Open(descriptor, nullptr, options.write_options, rpc,
-                              write_size_limit_bytes_, finishable_stream, writer);
+    return ClientStreamWriter::Open(descriptor, nullptr, options.write_options,
+                                    write_size_limit_bytes_, finishable_stream, writer);
   }
 
  private:
+  // Let the server compress the data it sends with one of our codecs
+  void AcceptCompression(ClientRpc* rpc) {
+    if (!accept_compression_.empty()) {
+      rpc->context.AddMetadata(internal::kGrpcAcceptCompressionHeader,
+                               accept_compression_);
+    }
+  }
+
+  // Let a server on the same host send DoGet bodies through shared memory
+  void RequestSharedMemory(ClientRpc* rpc) {
+    if (use_shared_memory_) {
+      rpc->context.AddMetadata(internal::kGrpcSharedMemoryHeader, "1");
+    }
+  }
+
+  std::shared_ptr<grpc::Channel> channel_;
   std::unique_ptr<pb::FlightService::Stub> stub_;
+#ifdef GRPC_USE_CLIENT_CALLBACK_API
+  std::unique_ptr<grpc::internal::RpcMethod> do_get_method_;
+#endif
   std::shared_ptr<ClientAuthHandler> auth_handler_;
 #if defined(GRPC_NAMESPACE_FOR_TLS_CREDENTIALS_OPTIONS)
   // Scope the TlsServerAuthorizationCheckConfig to be at the class instance level, since
@@ -1229,6 +1806,9 @@ class FlightClient::FlightClientImpl {
       noop_auth_check_;
 #endif
   int64_t write_size_limit_bytes_;
+  // The codecs listed in the accept-compression header
+  std::string accept_compression_;
+  bool use_shared_memory_ = false;
 };
 
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
@@ -1243,7 +1823,9 @@ Status FlightClient::Connect(const Location& location,
 Status FlightClient::Connect(const Location& location, const FlightClientOptions& options,
                              std::unique_ptr<FlightClient>* client) {
   client->reset(new FlightClient);
-  return (*client)->impl_->Connect(location, options);
+  GrpcChannelPool* channel_pool =
+      options.channel_pool ? options.channel_pool->impl_.get() : nullptr;
+  return (*client)->impl_->Connect(location, options, channel_pool);
 }
 
 Status FlightClient::Authenticate(const FlightCallOptions& options,
@@ -1294,6 +1876,11 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                                std::shared_ptr<AsyncFlightStreamReader>* stream) {
+  return impl_->DoGetAsync(options, ticket, stream);
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -31,8 +32,10 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/variant.h"
 
+#include "arrow/flight/compression.h"
 #include "arrow/flight/types.h"  // IWYU pragma: keep
 #include "arrow/flight/visibility.h"
 
@@ -92,6 +95,32 @@ class ARROW_FLIGHT_EXPORT FlightWriteSizeStatusDetail : public arrow::StatusDeta
   int64_t actual_;
 };
 
+/// \brief A thread-safe cache of connections shared between FlightClient
+/// instances.
+///
+/// Clients created with the same location and connection options (TLS
+/// credentials, generic options and middleware) reuse the same channel,
+/// saving the TCP and TLS handshakes of a new connection.  A channel is
+/// closed when it is no longer used by any client and the pool is
+/// destroyed.
+class ARROW_FLIGHT_EXPORT FlightChannelPool {
+ public:
+  /// \brief Create a pool.
+  /// \param[in] max_streams_per_channel the number of concurrent calls
+  /// above which another channel is opened for the same location and
+  /// options. Only enabled if positive.
+  explicit FlightChannelPool(int max_streams_per_channel = 100);
+  ~FlightChannelPool();
+
+  /// \brief The number of channels currently held by the pool.
+  int64_t num_channels() const;
+
+ private:
+  friend class FlightClient;
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   /// \brief Root certificates to use for validating server
   /// certificates.
@@ -119,6 +148,24 @@ struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   /// \brief Use TLS without validating the server certificate. Use with caution.
   bool disable_server_verification = false;
 
+  /// \brief The codecs the server may compress DoGet streams with, in no
+  /// particular order.
+  ///
+  /// They are advertised to the server in a header; the server picks the
+  /// codec.  If empty, the server is not told that compression is accepted.
+  std::vector<Compression::type> accepted_compression = GetAvailableFlightCodecs();
+
+  /// \brief A pool to take the connection from, shared with other clients.
+  /// If null, the client opens its own connection.
+  std::shared_ptr<FlightChannelPool> channel_pool;
+
+  /// \brief Ask the server to send DoGet message bodies through shared
+  /// memory.
+  ///
+  /// Only servers on the same host enabling FlightServerOptions::shared_memory
+  /// do so; the batches read then reference the shared memory directly.
+  bool use_shared_memory = false;
+
   /// \brief Get default options.
   static FlightClientOptions Defaults();
 };
@@ -154,6 +201,36 @@ class ARROW_FLIGHT_EXPORT FlightStreamWriter : public MetadataRecordBatchWriter
 #pragma warning(pop)
 #endif
 
+/// \brief An asynchronous reader of the data returned by DoGet.
+///
+/// Calls are multiplexed on the transport's own threads, so no thread is
+/// held while waiting for data.  Continuations attached to the returned
+/// futures may run on those threads and should not block.
+class ARROW_FLIGHT_EXPORT AsyncFlightStreamReader {
+ public:
+  virtual ~AsyncFlightStreamReader();
+
+  /// \brief Get the schema of the stream.
+  virtual Future<std::shared_ptr<Schema>> GetSchema() = 0;
+
+  /// \brief Read the next chunk of the stream.
+  ///
+  /// At the end of the stream, both the data and the metadata of the
+  /// chunk are null.  Calls may be issued without waiting for the previous
+  /// ones to complete; they complete in order.
+  virtual Future<FlightStreamChunk> Next() = 0;
+
+  /// \brief Try to cancel the call.
+  virtual void Cancel() = 0;
+};
+
+/// \brief Make an AsyncGenerator of the record batches of a stream.
+///
+/// Application metadata sent along with the batches is discarded.
+ARROW_FLIGHT_EXPORT
+std::function<Future<std::shared_ptr<RecordBatch>>()> MakeRecordBatchGenerator(
+    std::shared_ptr<AsyncFlightStreamReader> reader);
+
 /// \brief A reader for application-specific metadata sent back to the
 /// client during an upload.
 class ARROW_FLIGHT_EXPORT FlightMetadataReader {
@@ -277,6 +354,17 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Given a flight ticket, request to be sent the stream
+  /// asynchronously.
+  ///
+  /// This requires Flight to be built with gRPC 1.36 or higher.
+  /// \param[in] options Per-RPC options
+  /// \param[in] ticket The flight ticket to use
+  /// \param[out] stream the returned asynchronous reader
+  /// \return Status
+  Status DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                    std::shared_ptr<AsyncFlightStreamReader>* stream);
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
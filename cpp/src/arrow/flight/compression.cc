@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/compression.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/ipc/options.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+// Weight of a new measurement in the moving average of a codec's throughput
+constexpr double kThroughputAlpha = 0.25;
+
+}  // namespace
+
+FlightCompressionOptions FlightCompressionOptions::Defaults() {
+  return FlightCompressionOptions();
+}
+
+CodecSelector::CodecSelector() = default;
+
+Status CodecSelector::Make(const FlightCompressionOptions& options,
+                           const std::vector<Compression::type>& codecs,
+                           std::unique_ptr<CodecSelector>* out) {
+  if (codecs.empty()) {
+    return Status::Invalid("CodecSelector needs at least one codec");
+  }
+  if (options.adaptive && options.exploration_interval < 1) {
+    return Status::Invalid("exploration_interval must be at least 1");
+  }
+
+  std::unique_ptr<CodecSelector> selector(new CodecSelector());
+  selector->adaptive_ = options.adaptive;
+  selector->exploration_interval_ = options.exploration_interval;
+  if (options.adaptive) {
+    // Sending uncompressed is always a candidate
+    selector->candidates_.emplace_back();
+  }
+  for (const auto type : codecs) {
+    RETURN_NOT_OK(ipc::internal::CheckCompressionSupported(type));
+    Candidate candidate;
+    ARROW_ASSIGN_OR_RAISE(candidate.codec,
+                          util::Codec::Create(type, options.compression_level));
+    selector->candidates_.push_back(std::move(candidate));
+    if (!options.adaptive) {
+      break;
+    }
+  }
+  *out = std::move(selector);
+  return Status::OK();
+}
+
+std::shared_ptr<util::Codec> CodecSelector::Choose() {
+  if (adaptive_) {
+    current_ = Pick();
+  }
+  return candidates_[current_].codec;
+}
+
+size_t CodecSelector::Pick() {
+  // Measure every candidate once first
+  for (size_t i = 0; i < candidates_.size(); ++i) {
+    if (!candidates_[i].measured) {
+      return i;
+    }
+  }
+  size_t best = 0;
+  for (size_t i = 1; i < candidates_.size(); ++i) {
+    if (candidates_[i].throughput > candidates_[best].throughput) {
+      best = i;
+    }
+  }
+  ++num_batches_;
+  if (num_batches_ % exploration_interval_ == 0) {
+    // Periodically try the other candidates in turn, since the network
+    // conditions or the data may have changed since they were measured
+    next_explored_ = (next_explored_ + 1) % candidates_.size();
+    if (next_explored_ == best) {
+      next_explored_ = (next_explored_ + 1) % candidates_.size();
+    }
+    return next_explored_;
+  }
+  return best;
+}
+
+void CodecSelector::Record(int64_t raw_size, double seconds) {
+  if (!adaptive_) {
+    return;
+  }
+  // Guard against clocks too coarse to measure small batches
+  const double throughput = static_cast<double>(raw_size) / std::max(seconds, 1e-9);
+  Candidate& candidate = candidates_[current_];
+  if (candidate.measured) {
+    candidate.throughput += kThroughputAlpha * (throughput - candidate.throughput);
+  } else {
+    candidate.throughput = throughput;
+    candidate.measured = true;
+  }
+}
+
+std::vector<Compression::type> GetAvailableFlightCodecs() {
+  std::vector<Compression::type> codecs;
+  for (const auto type : {Compression::ZSTD, Compression::LZ4_FRAME}) {
+    if (util::Codec::IsAvailable(type)) {
+      codecs.push_back(type);
+    }
+  }
+  return codecs;
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Negotiated and adaptive compression of Flight data streams.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for compressing the data streams sent by a Flight server.
+struct ARROW_FLIGHT_EXPORT FlightCompressionOptions {
+  /// \brief The codecs that may be used, in order of preference.
+  ///
+  /// A stream is compressed with the first of these codecs that the client
+  /// accepts; codecs not available in this build are ignored.  If no codec
+  /// is agreed on, the stream is sent with the IPC options chosen by the
+  /// application.
+  std::vector<Compression::type> codecs;
+  /// \brief The compression level, or util::kUseDefaultCompressionLevel.
+  int compression_level = util::kUseDefaultCompressionLevel;
+  /// \brief Whether to choose the codec of each batch from measurements.
+  ///
+  /// If true, each batch is sent either uncompressed or with one of the
+  /// agreed codecs, whichever currently gives the highest throughput of
+  /// uncompressed bytes, counting the time spent both compressing and
+  /// sending.  A stream then stops compressing when the network is fast
+  /// and starts again when the network becomes the bottleneck.
+  bool adaptive = false;
+  /// \brief In adaptive mode, the interval, in batches, at which another
+  /// choice than the current best one is tried again.
+  int exploration_interval = 16;
+
+  /// \brief Get default options.
+  static FlightCompressionOptions Defaults();
+};
+
+/// \brief Chooses the compression codec of each batch of a data stream.
+///
+/// This class is not thread-safe; each stream uses its own selector.
+class ARROW_FLIGHT_EXPORT CodecSelector {
+ public:
+  /// \brief Create a selector.
+  /// \param[in] options compression options
+  /// \param[in] codecs the codecs to choose from, in order of preference;
+  /// must not be empty
+  /// \param[out] out the created selector
+  static Status Make(const FlightCompressionOptions& options,
+                     const std::vector<Compression::type>& codecs,
+                     std::unique_ptr<CodecSelector>* out);
+
+  /// \brief Get the codec to use for the next batch, or null to send it
+  /// uncompressed.
+  std::shared_ptr<util::Codec> Choose();
+
+  /// \brief Report how long the batch last chosen for took to be
+  /// compressed and sent.
+  /// \param[in] raw_size the uncompressed size of the batch, in bytes
+  /// \param[in] seconds the time spent compressing and sending it
+  void Record(int64_t raw_size, double seconds);
+
+ private:
+  struct Candidate {
+    std::shared_ptr<util::Codec> codec;
+    // Moving average of the throughput, in uncompressed bytes per second
+    double throughput = 0;
+    bool measured = false;
+  };
+
+  CodecSelector();
+  size_t Pick();
+
+  bool adaptive_ = false;
+  int exploration_interval_ = 0;
+  std::vector<Candidate> candidates_;
+  size_t current_ = 0;
+  size_t next_explored_ = 0;
+  int64_t num_batches_ = 0;
+};
+
+/// \brief Get the codecs that can compress Flight data in this build.
+ARROW_FLIGHT_EXPORT
+std::vector<Compression::type> GetAvailableFlightCodecs();
+
+}  // namespace flight
+}  // namespace arrow
@@ -15,20 +15,29 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <fstream>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gflags/gflags.h>
 
+#include "arrow/config.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/stopwatch.h"
+#include "arrow/util/string.h"
 #include "arrow/util/tdigest.h"
 #include "arrow/util/thread_pool.h"
 
@@ -44,6 +53,11 @@ DEFINE_string(server_unix, "",
               "An existing performance server listening on Unix socket (leave blank to "
               "spawn one automatically)");
 DEFINE_bool(test_unix, false, "Test Unix socket instead of TCP");
+DEFINE_bool(test_tls, false, "Test TLS instead of plaintext TCP");
+DEFINE_string(cert_file, "",
+              "TLS certificate (PEM) of the server, trusted by the client (leave blank "
+              "to use the Flight test certificate from ARROW_TEST_DATA)");
+DEFINE_string(key_file, "", "TLS private key (PEM) of a spawned server");
 DEFINE_int32(num_perf_runs, 1,
              "Number of times to run the perf test to "
              "increase precision");
@@ -53,11 +67,28 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_exchange, false,
+            "Test DoExchange instead of DoGet: each batch is echoed back by the "
+            "server before the next one is sent");
 DEFINE_string(compression, "",
               "Select compression method (\"zstd\", \"lz4\"). "
               "Leave blank to disable compression.\n"
               "E.g., \"zstd\":   zstd with default compression level.\n"
-              "      \"zstd:7\": zstd with compression leve = 7.\n");
+              "      \"zstd:7\": zstd with compression leve = 7.\n"
+              "DoGet is compressed by the server: the method is passed on to a "
+              "spawned server.\n");
+DEFINE_string(schema, "int64",
+              "Columns of the data: \"int64\" for int64 columns only, \"string\" "
+              "for an int64 column followed by string columns");
+DEFINE_int32(num_columns, 4, "Number of columns of the data");
+DEFINE_int32(string_length, 32, "Length of the values of string columns");
+DEFINE_string(scenarios, "",
+              "Comma-separated scenarios to run instead of a single test, or \"all\". "
+              "Each scenario overrides some of the other flags: get, put, exchange, "
+              "many-streams, small-batches, wide, strings, unix, tls, zstd, lz4");
+DEFINE_string(json_output, "",
+              "Append the results to this file, as one JSON object per line, to "
+              "compare them across runs");
 
 namespace perf = arrow::flight::perf;
 
@@ -105,11 +136,156 @@ struct PerformanceStats {
   uint64_t quantile_latency(double q) const { return latencies.Quantile(q) / 1000; }
 };
 
-Status WaitForReady(FlightClient* client, const FlightCallOptions& call_options) {
+// The parameters of a performance test
+struct BenchmarkConfig {
+  std::string scenario = "custom";
+  std::string method = "DoGet";
+  std::string schema = "int64";
+  int32_t num_columns = 4;
+  int32_t string_length = 32;
+  int32_t num_streams = 4;
+  int32_t num_threads = 4;
+  int64_t records_per_stream = 0;
+  int32_t records_per_batch = 0;
+  std::string compression;
+  bool unix_socket = false;
+  bool tls = false;
+
+  std::string transport() const {
+    return unix_socket ? "unix" : (tls ? "tls" : "tcp");
+  }
+};
+
+BenchmarkConfig ConfigFromFlags() {
+  BenchmarkConfig config;
+  if (FLAGS_test_exchange) {
+    config.method = "DoExchange";
+  } else if (FLAGS_test_put) {
+    config.method = "DoPut";
+  }
+  config.schema = FLAGS_schema;
+  config.num_columns = FLAGS_num_columns;
+  config.string_length = FLAGS_string_length;
+  config.num_streams = FLAGS_num_streams;
+  config.num_threads = FLAGS_num_threads;
+  config.records_per_stream = FLAGS_records_per_stream;
+  config.records_per_batch = FLAGS_records_per_batch;
+  config.compression = FLAGS_compression;
+  config.unix_socket = FLAGS_test_unix || !FLAGS_server_unix.empty();
+  config.tls = FLAGS_test_tls;
+  return config;
+}
+
+const std::vector<std::string>& AllScenarios() {
+  static const std::vector<std::string> scenarios = {
+      "get",     "put",  "exchange", "many-streams", "small-batches", "wide",
+      "strings", "unix", "tls",      "zstd",         "lz4"};
+  return scenarios;
+}
+
+Status ApplyScenario(const std::string& name, BenchmarkConfig* config) {
+  config->scenario = name;
+  if (name == "get") {
+    config->method = "DoGet";
+  } else if (name == "put") {
+    config->method = "DoPut";
+  } else if (name == "exchange") {
+    config->method = "DoExchange";
+  } else if (name == "many-streams") {
+    // The same amount of data over many more concurrent streams
+    config->num_streams *= 16;
+    config->num_threads *= 16;
+    config->records_per_stream /= 16;
+  } else if (name == "small-batches") {
+    // Dominated by the per-batch overhead, for latency rather than bandwidth
+    config->records_per_batch = 64;
+    config->records_per_stream =
+        std::min<int64_t>(config->records_per_stream, 10000 * 64);
+  } else if (name == "wide") {
+    // The same amount of data in many more columns
+    config->schema = "int64";
+    config->records_per_stream = config->records_per_stream * config->num_columns / 100;
+    config->num_columns = 100;
+  } else if (name == "strings") {
+    config->schema = "string";
+  } else if (name == "unix") {
+    config->unix_socket = true;
+    config->tls = false;
+  } else if (name == "tls") {
+    config->tls = true;
+    config->unix_socket = false;
+  } else if (name == "zstd" || name == "lz4") {
+    config->compression = name;
+  } else {
+    return Status::Invalid("Unknown scenario: ", name);
+  }
+  return Status::OK();
+}
+
+Status MakePerfSchema(const BenchmarkConfig& config, std::shared_ptr<Schema>* out) {
+  if (config.schema != "int64" && config.schema != "string") {
+    return Status::Invalid("Unknown schema: ", config.schema);
+  }
+  if (config.num_columns < 1) {
+    return Status::Invalid("Need at least one column");
+  }
+  FieldVector fields;
+  for (int i = 0; i < config.num_columns; ++i) {
+    // The first column is always int64, so that the server may verify it
+    const auto type = (config.schema == "string" && i > 0) ? utf8() : int64();
+    fields.push_back(field("f" + std::to_string(i), type));
+  }
+  *out = schema(std::move(fields));
+  return Status::OK();
+}
+
+std::shared_ptr<RecordBatch> MakePerfBatch(const std::shared_ptr<Schema>& schema,
+                                           int32_t length, int32_t string_length) {
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  ArrayVector arrays;
+  for (const auto& field : schema->fields()) {
+    if (field->type()->id() == Type::STRING) {
+      arrays.push_back(rng.String(length, string_length, string_length));
+    } else {
+      arrays.push_back(rng.ArrayOf(field->type(), length, /*null_probability=*/0));
+    }
+  }
+  return RecordBatch::Make(schema, length, std::move(arrays));
+}
+
+int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  return size;
+}
+
+// The size of the data of a batch, as opposed to its size on the wire
+int64_t BatchSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (const auto& column : batch.column_data()) {
+    size += BufferSize(*column);
+  }
+  return size;
+}
+
+// Connect once the server is up.  Each attempt uses a new client, as a TLS
+// channel may not recover from failing to connect to a starting server.
+Status ConnectWhenReady(const Location& location,
+                        const FlightClientOptions& client_options,
+                        const FlightCallOptions& call_options,
+                        std::unique_ptr<FlightClient>* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
+    RETURN_NOT_OK(FlightClient::Connect(location, client_options, client));
     std::unique_ptr<ResultStream> stream;
-    if (client->DoAction(call_options, action, &stream).ok()) {
+    if ((*client)->DoAction(call_options, action, &stream).ok()) {
       return Status::OK();
     }
     std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -119,6 +295,7 @@ Status WaitForReady(FlightClient* client, const FlightCallOptions& call_options)
 
 arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
                                               const FlightCallOptions& call_options,
+                                              const BenchmarkConfig& config,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint,
                                               PerformanceStats* stats) {
@@ -127,9 +304,6 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
   // This must also be set in perf_server.cc
   const bool verify = false;
 
@@ -157,81 +331,124 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
     ++num_batches;
     num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    num_bytes += BatchSize(*batch.data);
   }
   return PerformanceResult{num_batches, num_records, num_bytes};
 }
 
-arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
-                                              const FlightCallOptions& call_options,
-                                              const perf::Token& token,
-                                              const FlightEndpoint& endpoint,
-                                              PerformanceStats* stats) {
-  std::unique_ptr<FlightStreamWriter> writer;
-  std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-  RETURN_NOT_OK(
-      client->DoPut(call_options, FlightDescriptor{}, schema, &writer, &reader));
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+// Write the batches of a stream, measuring the latency of each full batch
+// with the given function
+template <typename WriteFunc>
+arrow::Result<PerformanceResult> WritePerfBatches(const BenchmarkConfig& config,
+                                                  const std::shared_ptr<Schema>& schema,
+                                                  const perf::Token& token,
+                                                  PerformanceStats* stats,
+                                                  WriteFunc&& write_batch) {
+  const int32_t length = token.definition().records_per_batch();
+  std::shared_ptr<RecordBatch> batch =
+      MakePerfBatch(schema, length, config.string_length);
+  RETURN_NOT_OK(batch->ValidateFull());
+  const int64_t batch_bytes = BatchSize(*batch);
 
   int64_t num_bytes = 0;
   int64_t num_records = 0;
   int64_t num_batches = 0;
 
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
-
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
-
   int64_t records_sent = 0;
   const int64_t total_records = token.definition().records_per_stream();
   StopWatch timer;
   while (records_sent < total_records) {
     if (records_sent + length > total_records) {
       const int last_length = total_records - records_sent;
-      RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
+      RETURN_NOT_OK(write_batch(*(batch->Slice(0, last_length))));
       num_records += last_length;
-      // Hard-coded
-      num_bytes += last_length * bytes_per_record;
+      num_bytes += batch_bytes * last_length / length;
       records_sent += last_length;
     } else {
       timer.Start();
-      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      RETURN_NOT_OK(write_batch(*batch));
       stats->AddLatency(timer.Stop());
       num_records += length;
-      // Hard-coded
-      num_bytes += length * bytes_per_record;
+      num_bytes += batch_bytes;
       records_sent += length;
     }
     ++num_batches;
   }
+  return PerformanceResult{num_batches, num_records, num_bytes};
+}
+
+arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
+                                              const FlightCallOptions& call_options,
+                                              const BenchmarkConfig& config,
+                                              const perf::Token& token,
+                                              const FlightEndpoint& endpoint,
+                                              PerformanceStats* stats) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(MakePerfSchema(config, &schema));
+  RETURN_NOT_OK(
+      client->DoPut(call_options, FlightDescriptor{}, schema, &writer, &reader));
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      WritePerfBatches(config, schema, token, stats, [&](const RecordBatch& batch) {
+        return writer->WriteRecordBatch(batch);
+      }));
 
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_batches, num_records, num_bytes};
+  return result;
+}
+
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const FlightCallOptions& call_options,
+                                                   const BenchmarkConfig& config,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint,
+                                                   PerformanceStats* stats) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(MakePerfSchema(config, &schema));
+  RETURN_NOT_OK(client->DoExchange(call_options, FlightDescriptor{}, &writer, &reader));
+  RETURN_NOT_OK(writer->Begin(schema, call_options.write_options));
+
+  // The latency is that of a round trip
+  FlightStreamChunk chunk;
+  ARROW_ASSIGN_OR_RAISE(
+      auto result,
+      WritePerfBatches(config, schema, token, stats,
+                       [&](const RecordBatch& batch) -> Status {
+        RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+        RETURN_NOT_OK(reader->Next(&chunk));
+        if (!chunk.data || chunk.data->num_rows() != batch.num_rows()) {
+          return Status::Invalid("Server did not echo the batch");
+        }
+        return Status::OK();
+      }));
+
+  RETURN_NOT_OK(writer->DoneWriting());
+  RETURN_NOT_OK(reader->Next(&chunk));
+  if (chunk.data) {
+    return Status::Invalid("Server sent more batches than it received");
+  }
+  RETURN_NOT_OK(writer->Close());
+  return result;
 }
 
-Status DoSinglePerfRun(FlightClient* client, const FlightCallOptions& call_options,
-                       bool test_put, PerformanceStats* stats) {
-  // schema not needed
+Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions& client_options,
+                       const FlightCallOptions& call_options,
+                       const BenchmarkConfig& config, PerformanceStats* stats) {
+  std::shared_ptr<Schema> perf_schema;
+  RETURN_NOT_OK(MakePerfSchema(config, &perf_schema));
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*perf_schema));
+
   perf::Perf perf;
-  perf.set_stream_count(FLAGS_num_streams);
-  perf.set_records_per_stream(FLAGS_records_per_stream);
-  perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_schema(serialized_schema->ToString());
+  perf.set_stream_count(config.num_streams);
+  perf.set_records_per_stream(config.records_per_stream);
+  perf.set_records_per_batch(config.records_per_batch);
+  perf.set_string_length(config.string_length);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -248,17 +465,23 @@ Status DoSinglePerfRun(FlightClient* client, const FlightCallOptions& call_optio
 
   int64_t start_total_records = stats->total_records;
 
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop,
-                        &call_options](const FlightEndpoint& endpoint) {
+  auto test_loop = &RunDoGetTest;
+  if (config.method == "DoPut") {
+    test_loop = &RunDoPutTest;
+  } else if (config.method == "DoExchange") {
+    test_loop = &RunDoExchangeTest;
+  }
+  auto ConsumeStream = [&](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    RETURN_NOT_OK(
+        FlightClient::Connect(endpoint.locations.front(), client_options, &client));
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
 
-    const auto& result = test_loop(client.get(), call_options, token, endpoint, stats);
+    const auto& result =
+        test_loop(client.get(), call_options, config, token, endpoint, stats);
     if (result.ok()) {
       const PerformanceResult& perf = result.ValueOrDie();
       stats->Update(perf.num_batches, perf.num_records, perf.num_bytes);
@@ -271,7 +494,7 @@ Status DoSinglePerfRun(FlightClient* client, const FlightCallOptions& call_optio
   //   RETURN_NOT_OK(ConsumeStream(endpoint));
   // }
 
-  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(FLAGS_num_threads));
+  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(config.num_threads));
   std::vector<Future<>> tasks;
   for (const auto& endpoint : plan->endpoints()) {
     ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeStream, endpoint));
@@ -292,14 +515,51 @@ Status DoSinglePerfRun(FlightClient* client, const FlightCallOptions& call_optio
   return Status::OK();
 }
 
-Status RunPerformanceTest(FlightClient* client, const FlightCallOptions& call_options,
-                          bool test_put) {
+// Append the results as a single-line JSON object
+Status WriteJsonResult(const std::string& path, const BenchmarkConfig& config,
+                       const PerformanceStats& stats, uint64_t elapsed_nanos) {
+  std::ofstream out(path, std::ios::app);
+  if (!out) {
+    return Status::IOError("Could not open ", path);
+  }
+  const double time_elapsed = static_cast<double>(elapsed_nanos) / 1e9;
+  constexpr double kMegabyte = static_cast<double>(1 << 20);
+  out << "{\"arrow_version\": \"" << GetBuildInfo().version_string << "\""
+      << ", \"scenario\": \"" << config.scenario << "\""
+      << ", \"method\": \"" << config.method << "\""
+      << ", \"transport\": \"" << config.transport() << "\""
+      << ", \"compression\": \""
+      << (config.compression.empty() ? "none" : config.compression) << "\""
+      << ", \"schema\": \"" << config.schema << "\""
+      << ", \"num_columns\": " << config.num_columns
+      << ", \"num_streams\": " << config.num_streams
+      << ", \"num_threads\": " << config.num_threads
+      << ", \"records_per_batch\": " << config.records_per_batch
+      << ", \"num_perf_runs\": " << FLAGS_num_perf_runs
+      << ", \"batches\": " << stats.total_batches
+      << ", \"records\": " << stats.total_records << ", \"bytes\": " << stats.total_bytes
+      << ", \"nanos\": " << elapsed_nanos << ", \"mb_per_s\": "
+      << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
+      << ", \"batches_per_s\": "
+      << (static_cast<double>(stats.total_batches) / time_elapsed)
+      << ", \"latency_mean_us\": " << stats.mean_latency();
+  for (auto q : stats.quantiles) {
+    out << ", \"latency_p" << static_cast<int>(q * 100) << "_us\": "
+        << stats.quantile_latency(q);
+  }
+  out << ", \"latency_max_us\": " << stats.max_latency() << "}" << std::endl;
+  return out.good() ? Status::OK() : Status::IOError("Could not write to ", path);
+}
+
+Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
+                          const FlightCallOptions& call_options,
+                          const BenchmarkConfig& config) {
   StopWatch timer;
   timer.Start();
 
   PerformanceStats stats;
   for (int i = 0; i < FLAGS_num_perf_runs; ++i) {
-    RETURN_NOT_OK(DoSinglePerfRun(client, call_options, test_put, &stats));
+    RETURN_NOT_OK(DoSinglePerfRun(client, client_options, call_options, config, &stats));
   }
 
   // Elapsed time in seconds
@@ -310,14 +570,14 @@ Status RunPerformanceTest(FlightClient* client, const FlightCallOptions& call_op
   constexpr double kMegabyte = static_cast<double>(1 << 20);
 
   std::cout << "Number of perf runs: " << FLAGS_num_perf_runs << std::endl;
-  std::cout << "Number of concurrent gets/puts: " << FLAGS_num_threads << std::endl;
+  std::cout << "Number of concurrent gets/puts: " << config.num_threads << std::endl;
   std::cout << "Batch size: " << stats.total_bytes / stats.total_batches << std::endl;
-  if (FLAGS_test_put) {
-    std::cout << "Batches written: " << stats.total_batches << std::endl;
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
-  } else {
+  if (config.method == "DoGet") {
     std::cout << "Batches read: " << stats.total_batches << std::endl;
     std::cout << "Bytes read: " << stats.total_bytes << std::endl;
+  } else {
+    std::cout << "Batches written: " << stats.total_batches << std::endl;
+    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
   }
 
   std::cout << "Nanos: " << elapsed_nanos << std::endl;
@@ -335,97 +595,159 @@ Status RunPerformanceTest(FlightClient* client, const FlightCallOptions& call_op
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  if (!FLAGS_json_output.empty()) {
+    RETURN_NOT_OK(WriteJsonResult(FLAGS_json_output, config, stats, elapsed_nanos));
+  }
   return Status::OK();
 }
 
-}  // namespace flight
-}  // namespace arrow
-
-int main(int argc, char** argv) {
-  gflags::ParseCommandLineFlags(&argc, &argv, true);
-
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
+Status ReadFile(const std::string& path, std::string* out) {
+  std::ifstream file(path);
+  if (!file) {
+    return Status::IOError("Could not open ", path);
   }
-  std::cout << std::endl;
+  std::stringstream contents;
+  contents << file.rdbuf();
+  *out = contents.str();
+  return Status::OK();
+}
 
-  arrow::flight::FlightCallOptions call_options;
-  if (!FLAGS_compression.empty()) {
-    if (!FLAGS_test_put) {
-      std::cerr << "Compression is only useful for Put test now, "
-                   "please append \"-test_put\" to command line"
-                << std::endl;
-      std::abort();
-    }
+// Parse "zstd" or "zstd:7" into a codec
+Status MakeCodec(const std::string& compression, std::shared_ptr<util::Codec>* out) {
+  const size_t delim = compression.find(':');
+  const std::string name = compression.substr(0, delim);
+  const int level = delim == std::string::npos
+                        ? util::kUseDefaultCompressionLevel
+                        : std::stoi(compression.substr(delim + 1));
+  ARROW_ASSIGN_OR_RAISE(const auto type, util::Codec::GetCompressionType(name));
+  ARROW_ASSIGN_OR_RAISE(*out, util::Codec::Create(type, level));
+  return Status::OK();
+}
 
-    // "zstd"   -> name = "zstd", level = default
-    // "zstd:7" -> name = "zstd", level = 7
-    const size_t delim = FLAGS_compression.find(":");
-    const std::string name = FLAGS_compression.substr(0, delim);
-    const std::string level_str =
-        delim == std::string::npos
-            ? ""
-            : FLAGS_compression.substr(delim + 1, FLAGS_compression.length() - delim - 1);
-    const int level = level_str.empty() ? arrow::util::kUseDefaultCompressionLevel
-                                        : std::stoi(level_str);
-    const auto type = arrow::util::Codec::GetCompressionType(name).ValueOrDie();
-    auto codec = arrow::util::Codec::Create(type, level).ValueOrDie();
-    std::cout << "Compression method: " << name;
-    if (!level_str.empty()) {
-      std::cout << ", level " << level;
+// Run a test, spawning a server configured for it unless an existing
+// server was given, in which case its configuration must match the test
+Status RunBenchmark(const BenchmarkConfig& config) {
+  std::cout << "Scenario: " << config.scenario << std::endl;
+  std::cout << "Testing method: " << config.method << std::endl;
+
+  FlightCallOptions call_options;
+  std::vector<std::string> server_args;
+  if (!config.compression.empty()) {
+    std::shared_ptr<util::Codec> codec;
+    RETURN_NOT_OK(MakeCodec(config.compression, &codec));
+    std::cout << "Compression method: " << config.compression << std::endl;
+    if (config.method == "DoGet") {
+      server_args = {"-compression", config.compression};
+    } else {
+      call_options.write_options.codec = std::move(codec);
     }
-    std::cout << std::endl;
+  }
 
-    call_options.write_options.codec = std::move(codec);
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  if (config.tls) {
+    std::string cert_file = FLAGS_cert_file;
+    std::string key_file = FLAGS_key_file;
+    if (cert_file.empty()) {
+      std::string root;
+      RETURN_NOT_OK(GetTestResourceRoot(&root));
+      cert_file = root + "/flight/cert0.pem";
+      key_file = root + "/flight/cert0.key";
+    }
+    RETURN_NOT_OK(ReadFile(cert_file, &client_options.tls_root_certs));
+    server_args.insert(server_args.end(),
+                       {"-cert_file", cert_file, "-key_file", key_file});
   }
 
-  std::unique_ptr<arrow::flight::TestServer> server;
-  arrow::flight::Location location;
-  if (FLAGS_test_unix || !FLAGS_server_unix.empty()) {
-    if (FLAGS_server_unix == "") {
-      FLAGS_server_unix = "/tmp/flight-bench-spawn.sock";
+  std::unique_ptr<TestServer> server;
+  Location location;
+  if (config.unix_socket) {
+    std::string server_unix = FLAGS_server_unix;
+    if (server_unix.empty()) {
+      server_unix = "/tmp/flight-bench-spawn.sock";
       std::cout << "Using spawned Unix server" << std::endl;
-      server.reset(
-          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_unix));
+      server.reset(new TestServer("arrow-flight-perf-server", server_unix, server_args));
       server->Start();
     } else {
       std::cout << "Using standalone Unix server" << std::endl;
     }
-    std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
-    ABORT_NOT_OK(arrow::flight::Location::ForGrpcUnix(FLAGS_server_unix, &location));
+    std::cout << "Server unix socket: " << server_unix << std::endl;
+    RETURN_NOT_OK(Location::ForGrpcUnix(server_unix, &location));
   } else {
-    if (FLAGS_server_host == "") {
-      FLAGS_server_host = "localhost";
+    std::string server_host = FLAGS_server_host;
+    if (server_host.empty()) {
+      server_host = "localhost";
       std::cout << "Using spawned TCP server" << std::endl;
       server.reset(
-          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+          new TestServer("arrow-flight-perf-server", FLAGS_server_port, server_args));
       server->Start();
     } else {
       std::cout << "Using standalone TCP server" << std::endl;
     }
-    std::cout << "Server host: " << FLAGS_server_host << std::endl
+    std::cout << "Server host: " << server_host << std::endl
               << "Server port: " << FLAGS_server_port << std::endl;
-    ABORT_NOT_OK(arrow::flight::Location::ForGrpcTcp(FLAGS_server_host, FLAGS_server_port,
-                                                     &location));
+    if (config.tls) {
+      RETURN_NOT_OK(Location::ForGrpcTls(server_host, FLAGS_server_port, &location));
+    } else {
+      RETURN_NOT_OK(Location::ForGrpcTcp(server_host, FLAGS_server_port, &location));
+    }
   }
 
-  std::unique_ptr<arrow::flight::FlightClient> client;
-  ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
-  ABORT_NOT_OK(arrow::flight::WaitForReady(client.get(), call_options));
-
-  arrow::Status s =
-      arrow::flight::RunPerformanceTest(client.get(), call_options, FLAGS_test_put);
+  std::unique_ptr<FlightClient> client;
+  Status st = ConnectWhenReady(location, client_options, call_options, &client);
+  if (st.ok()) {
+    st = RunPerformanceTest(client.get(), client_options, call_options, config);
+  }
 
   if (server) {
     server->Stop();
   }
+  return st;
+}
+
+}  // namespace flight
+}  // namespace arrow
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  const auto base_config = arrow::flight::ConfigFromFlags();
+  std::vector<arrow::flight::BenchmarkConfig> configs;
+  if (FLAGS_scenarios.empty()) {
+    configs.push_back(base_config);
+  } else {
+    std::vector<std::string> names;
+    if (FLAGS_scenarios == "all") {
+      names = arrow::flight::AllScenarios();
+    } else {
+      for (const auto& name : arrow::internal::SplitString(FLAGS_scenarios, ',')) {
+        names.push_back(name.to_string());
+      }
+    }
+    for (const auto& name : names) {
+      auto config = base_config;
+      ABORT_NOT_OK(arrow::flight::ApplyScenario(name, &config));
+      configs.push_back(std::move(config));
+    }
+  }
 
-  if (!s.ok()) {
-    std::cerr << "Failed with error: << " << s.ToString() << std::endl;
+  int failures = 0;
+  for (const auto& config : configs) {
+    if (!config.compression.empty()) {
+      const auto type = arrow::util::Codec::GetCompressionType(
+          config.compression.substr(0, config.compression.find(':')));
+      if (type.ok() && !arrow::util::Codec::IsAvailable(*type)) {
+        std::cout << "Skipping scenario " << config.scenario << ": "
+                  << config.compression << " is not available" << std::endl;
+        continue;
+      }
+    }
+    arrow::Status s = arrow::flight::RunBenchmark(config);
+    if (!s.ok()) {
+      std::cerr << "Failed with error: << " << s.ToString() << std::endl;
+      ++failures;
+    }
+    std::cout << std::endl;
   }
 
-  return 0;
+  return failures == 0 ? 0 : 1;
 }
@@ -18,11 +18,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -32,10 +34,13 @@
 
 #include "arrow/flight/api.h"
 #include "arrow/ipc/test_common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/base64.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -49,6 +54,8 @@
 #include "arrow/flight/client_header_internal.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/server_metrics_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/test_util.h"
 
 namespace arrow {
@@ -322,6 +329,209 @@ TEST(TestFlight, GetPort) {
   ASSERT_GT(server->port(), 0);
 }
 
+class GeneratorTestServer : public FlightServerBase {
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    BatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new RecordBatchGeneratorStream(batches[0]->schema(), MakeVectorGenerator(batches)));
+    return Status::OK();
+  }
+};
+
+TEST(TestFlight, RecordBatchGeneratorStream) {
+  GeneratorTestServer server;
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  ASSERT_OK(server.Init(FlightServerOptions(location)));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server.port(), &location));
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  BatchVector expected_batches, batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{""}, &stream));
+  ASSERT_OK(stream->ReadAll(&batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+  ASSERT_OK(server.Shutdown());
+}
+
+TEST(TestFlight, CodecList) {
+  ASSERT_EQ("zstd,lz4",
+            internal::FormatCodecList({Compression::ZSTD, Compression::LZ4_FRAME}));
+  ASSERT_EQ("", internal::FormatCodecList({}));
+  ASSERT_EQ(std::vector<Compression::type>({Compression::ZSTD, Compression::LZ4_FRAME}),
+            internal::ParseCodecList("zstd, unknown,lz4"));
+  ASSERT_TRUE(internal::ParseCodecList("").empty());
+}
+
+TEST(TestFlight, AdaptiveCodecSelector) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  auto options = FlightCompressionOptions::Defaults();
+  options.adaptive = true;
+  options.exploration_interval = 4;
+  std::unique_ptr<CodecSelector> selector;
+  ASSERT_OK(CodecSelector::Make(options, {Compression::ZSTD}, &selector));
+
+  // Each choice is measured once: sending uncompressed is slower
+  ASSERT_EQ(nullptr, selector->Choose());
+  selector->Record(1000, 1.0);
+  auto codec = selector->Choose();
+  ASSERT_NE(nullptr, codec);
+  ASSERT_EQ(Compression::ZSTD, codec->compression_type());
+  selector->Record(1000, 0.1);
+
+  // The best choice is kept, and the other one is tried again periodically
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_NE(nullptr, selector->Choose());
+    selector->Record(1000, 0.1);
+  }
+  ASSERT_EQ(nullptr, selector->Choose());
+  // Sending uncompressed became faster, e.g. after moving to a faster network
+  selector->Record(1000, 0.001);
+  ASSERT_EQ(nullptr, selector->Choose());
+
+  // Without adaptation, the preferred codec is always used
+  options.adaptive = false;
+  ASSERT_OK(CodecSelector::Make(options, {Compression::ZSTD}, &selector));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_NE(nullptr, selector->Choose());
+    selector->Record(1000, 1.0);
+  }
+}
+
+TEST(TestFlight, NegotiatedCompression) {
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  FlightServerOptions server_options(location);
+  server_options.compression.codecs = {Compression::ZSTD, Compression::LZ4_FRAME};
+  ASSERT_OK(server->Init(server_options));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleLargeBatches(&expected_batches));
+  auto read_bytes = [&](const FlightClientOptions& options, int64_t* out) {
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(FlightClient::Connect(location, options, &client));
+    const FlightDataReadStats before = GetFlightDataReadStats();
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-large-batch-1"}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+    const FlightDataReadStats after = GetFlightDataReadStats();
+    *out = after.zero_copy_bytes + after.copied_bytes - before.zero_copy_bytes -
+           before.copied_bytes;
+  };
+
+  // A client not accepting compression gets the data uncompressed
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.accepted_compression.clear();
+  int64_t uncompressed_bytes = 0;
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &uncompressed_bytes));
+
+  // By default, clients accept the codecs built in
+  client_options = FlightClientOptions::Defaults();
+  int64_t compressed_bytes = 0;
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &compressed_bytes));
+  if (GetAvailableFlightCodecs().empty()) {
+    ASSERT_EQ(uncompressed_bytes, compressed_bytes);
+  } else {
+    ASSERT_LT(compressed_bytes, uncompressed_bytes / 10);
+  }
+
+  // Adaptive compression returns the same data
+  server_options.compression.adaptive = true;
+  server_options.compression.exploration_interval = 1;
+  ASSERT_OK(server->Shutdown());
+  server = ExampleTestServer();
+  ASSERT_OK(server->Init(server_options));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &compressed_bytes));
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST(TestFlight, SharedMemoryDoGet) {
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  FlightServerOptions server_options(location);
+  server_options.shared_memory.enabled = true;
+  server_options.shared_memory.min_body_size = 0;
+  ASSERT_OK(server->Init(server_options));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleLargeBatches(&expected_batches));
+  auto read_bytes = [&](const FlightClientOptions& options, int64_t* out) {
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(FlightClient::Connect(location, options, &client));
+    const FlightDataReadStats before = GetFlightDataReadStats();
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-large-batch-1"}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+    *out = GetFlightDataReadStats().shared_memory_bytes - before.shared_memory_bytes;
+  };
+
+  // Clients must ask for shared memory
+  auto client_options = FlightClientOptions::Defaults();
+  int64_t shared_memory_bytes = 0;
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &shared_memory_bytes));
+  ASSERT_EQ(0, shared_memory_bytes);
+
+  client_options.use_shared_memory = true;
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &shared_memory_bytes));
+  if (internal::SharedMemorySupported()) {
+    ASSERT_GT(shared_memory_bytes, 0);
+  } else {
+    ASSERT_EQ(0, shared_memory_bytes);
+  }
+
+  // As well as asynchronously
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, client_options, &client));
+  std::shared_ptr<AsyncFlightStreamReader> reader;
+  Status st = client->DoGetAsync({}, Ticket{"ticket-large-batch-1"}, &reader);
+  if (!st.IsNotImplemented()) {
+    ASSERT_OK(st);
+    const int64_t before = GetFlightDataReadStats().shared_memory_bytes;
+    ASSERT_FINISHES_OK_AND_ASSIGN(
+        auto batches, CollectAsyncGenerator(MakeRecordBatchGenerator(reader)));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+    ASSERT_EQ(shared_memory_bytes,
+              GetFlightDataReadStats().shared_memory_bytes - before);
+  }
+
+  // Bodies are sent inline once the client has too much left to read
+  server_options.shared_memory.max_unread_bytes = 0;
+  ASSERT_OK(server->Shutdown());
+  server = ExampleTestServer();
+  ASSERT_OK(server->Init(server_options));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  ASSERT_NO_FATAL_FAILURE(read_bytes(client_options, &shared_memory_bytes));
+  ASSERT_EQ(0, shared_memory_bytes);
+  ASSERT_OK(server->Shutdown());
+}
+
 // CI environments don't have an IPv6 interface configured
 TEST(TestFlight, DISABLED_IpV6Port) {
   Location location, location2;
@@ -493,6 +703,34 @@ class DoPutTestServer : public FlightServerBase {
   friend class TestDoPut;
 };
 
+class FlowControlTestServer : public FlightServerBase {
+ public:
+  explicit FlowControlTestServer(const FlowControlOptions& options)
+      : options_(options), released_(release_.get_future()) {}
+
+  Status DoPut(const ServerCallContext& context,
+               std::unique_ptr<FlightMessageReader> reader,
+               std::unique_ptr<FlightMetadataWriter> writer) override {
+    std::shared_ptr<FlowControlledReader> batch_reader;
+    RETURN_NOT_OK(
+        FlowControlledReader::Make(reader.get(), writer.get(), options_, &batch_reader));
+    RETURN_NOT_OK(writer->WriteMetadata(*Buffer::FromString("started")));
+    // Don't consume anything until the test says so
+    released_.wait();
+    return batch_reader->ReadAll(&batches_);
+  }
+
+  void Release() { release_.set_value(); }
+
+  const BatchVector& batches() const { return batches_; }
+
+ private:
+  FlowControlOptions options_;
+  std::promise<void> release_;
+  std::shared_future<void> released_;
+  BatchVector batches_;
+};
+
 class MetadataTestServer : public FlightServerBase {
   Status DoGet(const ServerCallContext& context, const Ticket& request,
                std::unique_ptr<FlightDataStream>* data_stream) override {
@@ -1467,6 +1705,266 @@ TEST_F(TestFlightClient, DoGetLargeBatch) {
   CheckDoGet(ticket, expected_batches);
 }
 
+TEST_F(TestFlightClient, DoGetLargeBatchReassembly) {
+  // Large messages typically arrive in several slices; they are then
+  // reassembled into a single allocation from the read memory pool.
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleLargeBatches(&expected_batches));
+  ProxyMemoryPool pool(default_memory_pool());
+  FlightCallOptions options;
+  options.read_options.memory_pool = &pool;
+  const FlightDataReadStats before = GetFlightDataReadStats();
+
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(options, Ticket{"ticket-large-batch-1"}, &stream));
+  BatchVector batches;
+  ASSERT_OK(stream->ReadAll(&batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+
+  const FlightDataReadStats after = GetFlightDataReadStats();
+  const int64_t zero_copy_bytes = after.zero_copy_bytes - before.zero_copy_bytes;
+  const int64_t copied_bytes = after.copied_bytes - before.copied_bytes;
+  ASSERT_GE(zero_copy_bytes + copied_bytes, 32 * 1024 * 1024);
+  if (copied_bytes > 0) {
+    ASSERT_GT(pool.max_memory(), 0);
+  }
+}
+
+TEST_F(TestFlightClient, ChannelPool) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  auto pool = std::make_shared<FlightChannelPool>(/*max_streams_per_channel=*/2);
+  auto options = FlightClientOptions::Defaults();
+  options.channel_pool = pool;
+
+  // Short-lived clients share a channel
+  for (int i = 0; i < 3; ++i) {
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(FlightClient::Connect(location, options, &client));
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+  }
+  ASSERT_EQ(1, pool->num_channels());
+
+  // Another channel is opened once a channel has too many calls in progress
+  std::vector<std::unique_ptr<FlightClient>> clients;
+  std::vector<std::unique_ptr<FlightStreamReader>> streams;
+  for (int i = 0; i < 3; ++i) {
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(FlightClient::Connect(location, options, &client));
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+    clients.push_back(std::move(client));
+    streams.push_back(std::move(stream));
+  }
+  ASSERT_EQ(2, pool->num_channels());
+
+  // Different connection options get their own channel
+  options.generic_options.emplace_back(GRPC_ARG_MAX_METADATA_SIZE, 64 * 1024);
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, options, &client));
+  ASSERT_EQ(3, pool->num_channels());
+
+  // Pooled channels remain usable after the clients that opened them are gone
+  streams.clear();
+  clients.clear();
+  BatchVector expected_batches, batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  ASSERT_OK(stream->ReadAll(&batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+  client.reset();
+  options.generic_options.clear();
+  ASSERT_OK(FlightClient::Connect(location, options, &client));
+  ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  ASSERT_OK(stream->ReadAll(&batches));
+  ASSERT_EQ(3, pool->num_channels());
+}
+
+FlightInfo MakeIntsFlightInfo(const std::vector<FlightEndpoint>& endpoints) {
+  FlightInfo::Data data;
+  ARROW_EXPECT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"ints"}),
+                                 endpoints, -1, -1, &data));
+  return FlightInfo(data);
+}
+
+TEST_F(TestFlightClient, MultiEndpointReaderOrdered) {
+  BatchVector int_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  // The middle endpoint has no location and goes through client_
+  auto info = MakeIntsFlightInfo({{{"ticket-ints-1"}, {location}},
+                                  {{"ticket-ints-1"}, {}},
+                                  {{"ticket-ints-1"}, {location}}});
+
+  auto options = MultiEndpointReaderOptions::Defaults();
+  options.connections_per_location = 2;
+  // Force the endpoint streams to wait on each other
+  options.max_buffered_batches = 1;
+  std::shared_ptr<MultiEndpointReader> reader;
+  ASSERT_OK(MultiEndpointReader::Open(info, client_.get(), options, &reader));
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+
+  BatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(3 * int_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*int_batches[i % int_batches.size()], *batches[i]);
+  }
+  ASSERT_OK(reader->Close());
+}
+
+TEST_F(TestFlightClient, MultiEndpointReaderUnordered) {
+  BatchVector int_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  const FlightEndpoint endpoint{{"ticket-ints-1"}, {location}};
+  auto info = MakeIntsFlightInfo({endpoint, endpoint, endpoint, endpoint});
+
+  auto options = MultiEndpointReaderOptions::Defaults();
+  options.ordered = false;
+  options.max_concurrent_endpoints = 2;
+  options.max_buffered_batches = 2;
+  std::shared_ptr<MultiEndpointReader> reader;
+  ASSERT_OK(MultiEndpointReader::Open(info, nullptr, options, &reader));
+
+  // Every batch is received once per endpoint, in any order
+  std::vector<int> counts(int_batches.size(), 0);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (!batch) break;
+    auto it = std::find_if(
+        int_batches.begin(), int_batches.end(),
+        [&](const std::shared_ptr<RecordBatch>& b) { return b->Equals(*batch); });
+    ASSERT_NE(int_batches.end(), it);
+    ++counts[it - int_batches.begin()];
+  }
+  ASSERT_EQ(std::vector<int>(int_batches.size(), 4), counts);
+}
+
+TEST_F(TestFlightClient, MultiEndpointReaderErrors) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  auto options = MultiEndpointReaderOptions::Defaults();
+  std::shared_ptr<MultiEndpointReader> reader;
+  BatchVector batches;
+
+  // An endpoint without location needs a default client
+  auto info = MakeIntsFlightInfo({{{"ticket-ints-1"}, {}}});
+  ASSERT_RAISES(Invalid, MultiEndpointReader::Open(info, nullptr, options, &reader));
+
+  // Errors from any endpoint are reported
+  info = MakeIntsFlightInfo(
+      {{{"ticket-ints-1"}, {location}}, {{"ticket-unknown"}, {location}}});
+  ASSERT_OK(MultiEndpointReader::Open(info, nullptr, options, &reader));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, ::testing::HasSubstr("ticket-unknown"),
+                                  reader->ReadAll(&batches));
+  ASSERT_OK(reader->Close());
+
+  // Endpoints must match the FlightInfo schema
+  info = MakeIntsFlightInfo({{{"ticket-floats-1"}, {location}}});
+  ASSERT_OK(MultiEndpointReader::Open(info, nullptr, options, &reader));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("does not match"),
+                                  reader->ReadAll(&batches));
+
+  // Abandoning a reader cancels its streams
+  const FlightEndpoint endpoint{{"ticket-ints-1"}, {location}};
+  info = MakeIntsFlightInfo({endpoint, endpoint, endpoint});
+  options.max_buffered_batches = 1;
+  ASSERT_OK(MultiEndpointReader::Open(info, nullptr, options, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  reader.reset();
+}
+
+TEST_F(TestFlightClient, DoGetAsync) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  std::shared_ptr<AsyncFlightStreamReader> reader;
+  Status st = client_->DoGetAsync({}, Ticket{"ticket-ints-1"}, &reader);
+  if (st.IsNotImplemented()) {
+    GTEST_SKIP() << st.ToString();
+  }
+  ASSERT_OK(st);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto schema, reader->GetSchema());
+  AssertSchemaEqual(*expected_batches[0]->schema(), *schema);
+  // Reads may be issued ahead of the data
+  std::vector<Future<FlightStreamChunk>> chunks;
+  for (size_t i = 0; i <= expected_batches.size(); ++i) {
+    chunks.push_back(reader->Next());
+  }
+  for (size_t i = 0; i < expected_batches.size(); ++i) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto chunk, chunks[i]);
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *chunk.data);
+  }
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto chunk, chunks.back());
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_EQ(nullptr, chunk.app_metadata);
+  ASSERT_FINISHES_OK_AND_ASSIGN(chunk, reader->Next());
+  ASSERT_EQ(nullptr, chunk.data);
+
+  // As an AsyncGenerator
+  ASSERT_OK(client_->DoGetAsync({}, Ticket{"ticket-large-batch-1"}, &reader));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                CollectAsyncGenerator(MakeRecordBatchGenerator(reader)));
+  expected_batches.clear();
+  ASSERT_OK(ExampleLargeBatches(&expected_batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+}
+
+TEST_F(TestFlightClient, DoGetAsyncDicts) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+  std::shared_ptr<AsyncFlightStreamReader> reader;
+  Status st = client_->DoGetAsync({}, Ticket{"ticket-dicts-1"}, &reader);
+  if (st.IsNotImplemented()) {
+    GTEST_SKIP() << st.ToString();
+  }
+  ASSERT_OK(st);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                CollectAsyncGenerator(MakeRecordBatchGenerator(reader)));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+}
+
+TEST_F(TestFlightClient, DoGetAsyncErrors) {
+  std::shared_ptr<AsyncFlightStreamReader> reader;
+  Status st = client_->DoGetAsync({}, Ticket{"ticket-unknown"}, &reader);
+  if (st.IsNotImplemented()) {
+    GTEST_SKIP() << st.ToString();
+  }
+  ASSERT_OK(st);
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, reader->GetSchema());
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, reader->Next());
+
+  // Cancel a stream that is partially read, then drop it
+  ASSERT_OK(client_->DoGetAsync({}, Ticket{"ticket-large-batch-1"}, &reader));
+  ASSERT_FINISHES_OK(reader->Next());
+  reader->Cancel();
+  auto next = reader->Next();
+  reader.reset();
+  ASSERT_FINISHES_AND_RAISES(IOError, next);
+}
+
 TEST_F(TestFlightClient, DoExchange) {
   auto descr = FlightDescriptor::Command("counter");
   BatchVector batches;
@@ -1927,6 +2425,60 @@ TEST_F(TestDoPut, DoPutSizeLimit) {
   CheckBatches(descr, batches);
 }
 
+TEST(TestDoPutFlowControl, WindowAndCoalescing) {
+  auto options = FlowControlOptions::Defaults();
+  options.window_rows = 4;
+  options.window_bytes = FlowControlOptions::kUnlimited;
+  options.target_batch_rows = 10;
+  FlowControlTestServer server(options);
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  ASSERT_OK(server.Init(FlightServerOptions(location)));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server.port(), &location));
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntBatchSized(20, &batch));
+  std::unique_ptr<FlightStreamWriter> stream;
+  std::unique_ptr<FlightMetadataReader> metadata_reader;
+  ASSERT_OK(client->DoPut(FlightDescriptor::Path({"ints"}), batch->schema(), &stream,
+                          &metadata_reader));
+  std::unique_ptr<FlowControlledWriter> writer;
+  ASSERT_OK(
+      FlowControlledWriter::Make(std::move(stream), std::move(metadata_reader), &writer));
+
+  // The client sends small batches, but only as long as less than the
+  // window is in flight
+  std::atomic<int> batches_written(0);
+  Status write_status;
+  std::thread write_thread([&] {
+    for (int i = 0; i < 10 && write_status.ok(); ++i) {
+      write_status = writer->WriteRecordBatch(*batch->Slice(i * 2, 2));
+      ++batches_written;
+    }
+  });
+  SleepFor(0.2);
+  ASSERT_EQ(2, batches_written.load());
+
+  server.Release();
+  write_thread.join();
+  ASSERT_OK(write_status);
+  ASSERT_OK(writer->DoneWriting());
+  // Flow control messages are not returned to the application
+  std::shared_ptr<Buffer> metadata;
+  ASSERT_OK(writer->ReadMetadata(&metadata));
+  ASSERT_NE(nullptr, metadata);
+  ASSERT_EQ("started", metadata->ToString());
+  ASSERT_OK(writer->Close());
+
+  // The server receives them coalesced
+  ASSERT_EQ(2, static_cast<int>(server.batches().size()));
+  ASSERT_BATCHES_EQUAL(*batch->Slice(0, 10), *server.batches()[0]);
+  ASSERT_BATCHES_EQUAL(*batch->Slice(10, 10), *server.batches()[1]);
+  ASSERT_OK(server.Shutdown());
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -2447,6 +2999,106 @@ TEST_F(TestCountingServerMiddleware, Count) {
   ASSERT_EQ(1, request_counter_->failed_);
 }
 
+TEST(TestServerMetricsMiddleware, Record) {
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  FlightServerOptions server_options(location);
+  auto metrics = std::make_shared<FlightServerMetrics>();
+  server_options.middleware.push_back({"metrics", MakeServerMetricsMiddleware(metrics)});
+  ASSERT_OK(server->Init(server_options));
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, &client));
+
+  BatchVector batches;
+  ASSERT_OK(ExampleLargeBatches(&batches));
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{"ticket-large-batch-1"}, &stream));
+  BatchVector read_batches;
+  ASSERT_OK(stream->ReadAll(&read_batches));
+
+  std::unique_ptr<FlightStreamReader> reader;
+  std::unique_ptr<FlightStreamWriter> writer;
+  ASSERT_OK(client->DoExchange(FlightDescriptor::Command("echo"), &writer, &reader));
+  ASSERT_OK(writer->Begin(batches[0]->schema()));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    FlightStreamChunk chunk;
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+  }
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(writer->Close());
+
+  std::unique_ptr<ResultStream> results;
+  ASSERT_RAISES(NotImplemented, client->DoAction(Action{"invalid", nullptr}, &results));
+
+  const auto all_metrics = metrics->GetMetrics();
+  ASSERT_EQ(3, all_metrics.size());
+  const auto& do_get = all_metrics.at(FlightMethod::DoGet);
+  ASSERT_EQ(1, do_get.calls);
+  ASSERT_EQ(0, do_get.failed_calls);
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), do_get.batches_sent);
+  ASSERT_EQ(0, do_get.batches_received);
+  ASSERT_GT(do_get.bytes_sent, 0);
+  ASSERT_EQ(1, do_get.duration.count);
+  ASSERT_GE(do_get.duration.sum, do_get.serialization_time.sum);
+  ASSERT_GT(do_get.serialization_time.sum, 0);
+  ASSERT_GT(do_get.network_time.sum, 0);
+
+  const auto& do_exchange = all_metrics.at(FlightMethod::DoExchange);
+  ASSERT_EQ(1, do_exchange.calls);
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), do_exchange.batches_sent);
+  ASSERT_EQ(static_cast<int64_t>(batches.size()), do_exchange.batches_received);
+  ASSERT_GT(do_exchange.bytes_received, 0);
+  ASSERT_GT(do_exchange.bytes_sent, 0);
+
+  const auto& do_action = all_metrics.at(FlightMethod::DoAction);
+  ASSERT_EQ(1, do_action.calls);
+  ASSERT_EQ(1, do_action.failed_calls);
+
+  const std::string text = metrics->ToPrometheusText();
+  ASSERT_NE(std::string::npos,
+            text.find("# TYPE arrow_flight_server_calls_total counter\n"));
+  ASSERT_NE(std::string::npos,
+            text.find("arrow_flight_server_failed_calls_total{method=\"DoAction\"} 1\n"));
+  ASSERT_NE(std::string::npos,
+            text.find("arrow_flight_server_sent_batches_total{method=\"DoGet\"} " +
+                      std::to_string(batches.size()) + "\n"));
+  ASSERT_NE(std::string::npos,
+            text.find("arrow_flight_server_call_duration_seconds_bucket{method=\"DoGet\","
+                      "le=\"+Inf\"} 1\n"));
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST(TestServerMetricsMiddleware, Histogram) {
+  FlightServerMetrics metrics({1, 0.5});
+  for (const double seconds : {0.1, 0.5, 0.7, 2.0}) {
+    ServerCallStats stats;
+    stats.duration_seconds = seconds;
+    metrics.Record(FlightMethod::ListFlights, Status::OK(), stats);
+  }
+  const auto histogram = metrics.GetMetrics().at(FlightMethod::ListFlights).duration;
+  ASSERT_EQ(std::vector<double>({0.5, 1}), histogram.upper_bounds);
+  ASSERT_EQ(std::vector<int64_t>({2, 1, 1}), histogram.bucket_counts);
+  ASSERT_EQ(4, histogram.count);
+  ASSERT_DOUBLE_EQ(3.3, histogram.sum);
+
+  const std::string text = metrics.ToPrometheusText();
+  for (const char* line :
+       {"arrow_flight_server_call_duration_seconds_bucket{method=\"ListFlights\","
+        "le=\"0.5\"} 2\n",
+        "arrow_flight_server_call_duration_seconds_bucket{method=\"ListFlights\","
+        "le=\"1\"} 3\n",
+        "arrow_flight_server_call_duration_seconds_bucket{method=\"ListFlights\","
+        "le=\"+Inf\"} 4\n",
+        "arrow_flight_server_call_duration_seconds_sum{method=\"ListFlights\"} 3.3\n",
+        "arrow_flight_server_call_duration_seconds_count{method=\"ListFlights\"} 4\n"}) {
+    ASSERT_NE(std::string::npos, text.find(line)) << line << "\n" << text;
+  }
+}
+
 TEST_F(TestPropagatingMiddleware, Propagate) {
   Action action;
   std::unique_ptr<ResultStream> stream;
@@ -0,0 +1,314 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/flow_control.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/endian.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+// A flow control message is the tag followed by the window in rows, the
+// window in bytes and the number of batches consumed so far, as
+// little-endian 64-bit integers.
+constexpr char kCreditTag[] = "ARWFLOW1";
+constexpr size_t kCreditTagLength = sizeof(kCreditTag) - 1;
+constexpr size_t kCreditMessageLength = kCreditTagLength + 3 * sizeof(int64_t);
+
+struct CreditMessage {
+  int64_t window_rows;
+  int64_t window_bytes;
+  int64_t batches_consumed;
+};
+
+std::shared_ptr<Buffer> EncodeCredit(const CreditMessage& message) {
+  std::string data(kCreditMessageLength, '\0');
+  std::memcpy(&data[0], kCreditTag, kCreditTagLength);
+  const int64_t values[] = {message.window_rows, message.window_bytes,
+                            message.batches_consumed};
+  for (size_t i = 0; i < 3; ++i) {
+    const int64_t value = BitUtil::ToLittleEndian(values[i]);
+    std::memcpy(&data[kCreditTagLength + i * sizeof(int64_t)], &value, sizeof(value));
+  }
+  return Buffer::FromString(std::move(data));
+}
+
+bool DecodeCredit(const Buffer& buffer, CreditMessage* message) {
+  if (buffer.size() != static_cast<int64_t>(kCreditMessageLength) ||
+      std::memcmp(buffer.data(), kCreditTag, kCreditTagLength) != 0) {
+    return false;
+  }
+  int64_t values[3];
+  for (size_t i = 0; i < 3; ++i) {
+    std::memcpy(&values[i], buffer.data() + kCreditTagLength + i * sizeof(int64_t),
+                sizeof(int64_t));
+    values[i] = BitUtil::FromLittleEndian(values[i]);
+  }
+  *message = CreditMessage{values[0], values[1], values[2]};
+  return true;
+}
+
+int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  return size;
+}
+
+int64_t BatchSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (const auto& column : batch.column_data()) {
+    size += BufferSize(*column);
+  }
+  return size;
+}
+
+bool IsLimited(int64_t window) { return window != FlowControlOptions::kUnlimited; }
+
+}  // namespace
+
+constexpr int64_t FlowControlOptions::kUnlimited;
+
+FlowControlOptions FlowControlOptions::Defaults() { return FlowControlOptions(); }
+
+//
+// Server side
+
+FlowControlledReader::FlowControlledReader(FlightMessageReader* reader,
+                                           FlightMetadataWriter* writer,
+                                           std::shared_ptr<Schema> schema,
+                                           const FlowControlOptions& options)
+    : reader_(reader), writer_(writer), schema_(std::move(schema)), options_(options) {}
+
+FlowControlledReader::~FlowControlledReader() = default;
+
+Status FlowControlledReader::Make(FlightMessageReader* reader,
+                                  FlightMetadataWriter* writer,
+                                  const FlowControlOptions& options,
+                                  std::shared_ptr<FlowControlledReader>* out) {
+  if (options.window_rows < 0 && IsLimited(options.window_rows)) {
+    return Status::Invalid("window_rows must be non-negative or kUnlimited");
+  }
+  if (options.window_bytes < 0 && IsLimited(options.window_bytes)) {
+    return Status::Invalid("window_bytes must be non-negative or kUnlimited");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+  std::shared_ptr<FlowControlledReader> result(
+      new FlowControlledReader(reader, writer, std::move(schema), options));
+  RETURN_NOT_OK(result->SendCredit());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> FlowControlledReader::schema() const { return schema_; }
+
+Status FlowControlledReader::SetWindow(int64_t window_rows, int64_t window_bytes) {
+  options_.window_rows = window_rows;
+  options_.window_bytes = window_bytes;
+  return SendCredit();
+}
+
+Status FlowControlledReader::SendCredit() {
+  const auto message = EncodeCredit(
+      CreditMessage{options_.window_rows, options_.window_bytes, batches_consumed_});
+  return writer_->WriteMetadata(*message);
+}
+
+Status FlowControlledReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  while (!finished_) {
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(reader_->Next(&chunk));
+    if (chunk.data == nullptr) {
+      if (chunk.app_metadata != nullptr) {
+        continue;
+      }
+      finished_ = true;
+      break;
+    }
+    // Let the client replace the batch right away: it is now accounted
+    // for by the target batch size instead of the window
+    ++batches_consumed_;
+    if (IsLimited(options_.window_rows) || IsLimited(options_.window_bytes)) {
+      RETURN_NOT_OK(SendCredit());
+    }
+
+    if (options_.target_batch_rows <= 0 && options_.target_batch_bytes <= 0) {
+      *batch = std::move(chunk.data);
+      return Status::OK();
+    }
+    pending_rows_ += chunk.data->num_rows();
+    pending_bytes_ += BatchSize(*chunk.data);
+    pending_.push_back(std::move(chunk.data));
+    if ((options_.target_batch_rows > 0 && pending_rows_ >= options_.target_batch_rows) ||
+        (options_.target_batch_bytes > 0 &&
+         pending_bytes_ >= options_.target_batch_bytes)) {
+      return Coalesce(batch);
+    }
+  }
+  if (pending_.empty()) {
+    *batch = nullptr;
+    return Status::OK();
+  }
+  return Coalesce(batch);
+}
+
+Status FlowControlledReader::Coalesce(std::shared_ptr<RecordBatch>* batch) {
+  if (pending_.size() == 1) {
+    *batch = std::move(pending_[0]);
+  } else {
+    ArrayVector columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector chunks;
+      chunks.reserve(pending_.size());
+      for (const auto& pending : pending_) {
+        chunks.push_back(pending->column(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, options_.memory_pool));
+    }
+    *batch = RecordBatch::Make(schema_, pending_rows_, std::move(columns));
+  }
+  pending_.clear();
+  pending_rows_ = 0;
+  pending_bytes_ = 0;
+  return Status::OK();
+}
+
+//
+// Client side
+
+FlowControlledWriter::FlowControlledWriter(std::unique_ptr<FlightStreamWriter> writer,
+                                           std::unique_ptr<FlightMetadataReader> reader)
+    : writer_(std::move(writer)), reader_(std::move(reader)) {}
+
+FlowControlledWriter::~FlowControlledWriter() = default;
+
+Status FlowControlledWriter::Make(std::unique_ptr<FlightStreamWriter> writer,
+                                  std::unique_ptr<FlightMetadataReader> reader,
+                                  std::unique_ptr<FlowControlledWriter>* out) {
+  out->reset(new FlowControlledWriter(std::move(writer), std::move(reader)));
+  return Status::OK();
+}
+
+Status FlowControlledWriter::Begin(const std::shared_ptr<Schema>& schema,
+                                   const ipc::IpcWriteOptions& options) {
+  return writer_->Begin(schema, options);
+}
+
+Status FlowControlledWriter::WriteRecordBatch(const RecordBatch& batch) {
+  RETURN_NOT_OK(WaitForWindow());
+  RETURN_NOT_OK(writer_->WriteRecordBatch(batch));
+  Sent(batch);
+  return Status::OK();
+}
+
+Status FlowControlledWriter::WriteMetadata(std::shared_ptr<Buffer> app_metadata) {
+  return writer_->WriteMetadata(std::move(app_metadata));
+}
+
+Status FlowControlledWriter::WriteWithMetadata(const RecordBatch& batch,
+                                               std::shared_ptr<Buffer> app_metadata) {
+  RETURN_NOT_OK(WaitForWindow());
+  RETURN_NOT_OK(writer_->WriteWithMetadata(batch, std::move(app_metadata)));
+  Sent(batch);
+  return Status::OK();
+}
+
+Status FlowControlledWriter::DoneWriting() { return writer_->DoneWriting(); }
+
+Status FlowControlledWriter::Close() { return writer_->Close(); }
+
+ipc::WriteStats FlowControlledWriter::stats() const { return writer_->stats(); }
+
+Status FlowControlledWriter::ReadMetadata(std::shared_ptr<Buffer>* out) {
+  if (!metadata_.empty()) {
+    *out = std::move(metadata_.front());
+    metadata_.pop_front();
+    return Status::OK();
+  }
+  while (true) {
+    RETURN_NOT_OK(reader_->ReadMetadata(out));
+    CreditMessage message;
+    if (*out == nullptr || !DecodeCredit(**out, &message)) {
+      return Status::OK();
+    }
+  }
+}
+
+Status FlowControlledWriter::WaitForWindow() {
+  if (!have_window_ && batches_acknowledged_ == 0 && in_flight_.empty()) {
+    // The schema is only sent along with the first batch, so the server
+    // can't have started the call and advertised the window yet
+    return Status::OK();
+  }
+  while (!have_window_ ||
+         (IsLimited(window_rows_) && in_flight_rows_ >= window_rows_) ||
+         (IsLimited(window_bytes_) && in_flight_bytes_ >= window_bytes_)) {
+    RETURN_NOT_OK(ReadServerMessage());
+  }
+  return Status::OK();
+}
+
+Status FlowControlledWriter::ReadServerMessage() {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(reader_->ReadMetadata(&metadata));
+  if (metadata == nullptr) {
+    // The server ended the call; Close() reports why
+    return Status::IOError("Server ended the DoPut call before granting a window");
+  }
+  CreditMessage message;
+  if (!DecodeCredit(*metadata, &message)) {
+    metadata_.push_back(std::move(metadata));
+    return Status::OK();
+  }
+  have_window_ = true;
+  window_rows_ = message.window_rows;
+  window_bytes_ = message.window_bytes;
+  while (batches_acknowledged_ < message.batches_consumed && !in_flight_.empty()) {
+    in_flight_rows_ -= in_flight_.front().first;
+    in_flight_bytes_ -= in_flight_.front().second;
+    in_flight_.pop_front();
+    ++batches_acknowledged_;
+  }
+  return Status::OK();
+}
+
+void FlowControlledWriter::Sent(const RecordBatch& batch) {
+  const int64_t bytes = BatchSize(batch);
+  in_flight_.emplace_back(batch.num_rows(), bytes);
+  in_flight_rows_ += batch.num_rows();
+  in_flight_bytes_ += bytes;
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Application-level flow control for DoPut.
+//
+// The server advertises a window, in rows and/or bytes, of data that the
+// client may send ahead of what the server has consumed, and acknowledges
+// the batches it consumes.  Both are sent as application metadata on the
+// DoPut response stream; other metadata messages are passed through.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for the server side of DoPut flow control.
+struct ARROW_FLIGHT_EXPORT FlowControlOptions {
+  /// \brief A window size meaning that the dimension is not limited.
+  static constexpr int64_t kUnlimited = -1;
+
+  /// \brief The number of rows the client may send ahead of the server.
+  int64_t window_rows = kUnlimited;
+  /// \brief The number of bytes the client may send ahead of the server.
+  ///
+  /// Bytes are counted as the total size of the buffers of a batch.
+  int64_t window_bytes = 64 * 1024 * 1024;
+  /// \brief If positive, concatenate incoming batches until they have at
+  /// least this many rows.
+  int64_t target_batch_rows = 0;
+  /// \brief If positive, concatenate incoming batches until they have at
+  /// least this many bytes.
+  int64_t target_batch_bytes = 0;
+  /// \brief The memory pool used to concatenate batches.
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// \brief Get default options.
+  static FlowControlOptions Defaults();
+};
+
+/// \brief The server side of a flow-controlled DoPut.
+///
+/// The window is advertised to the client on creation.  Each batch taken
+/// off the stream is then acknowledged, letting the client send more, so
+/// that the data received but not yet consumed by the handler is bounded
+/// by the window plus one output batch.
+///
+/// Batches can optionally be coalesced to a target size, so that small
+/// client batches don't result in small batches for the handler.  All
+/// the batches of the stream must then have the same dictionaries, if
+/// any.  Application metadata sent by the client is ignored.
+class ARROW_FLIGHT_EXPORT FlowControlledReader : public RecordBatchReader {
+ public:
+  ~FlowControlledReader() override;
+
+  /// \brief Create a reader and advertise the window to the client.
+  /// \param[in] reader the DoPut reader, which must outlive this reader
+  /// \param[in] writer the DoPut metadata writer, which must outlive this
+  /// reader
+  /// \param[in] options flow control options
+  /// \param[out] out the created reader
+  static Status Make(FlightMessageReader* reader, FlightMetadataWriter* writer,
+                     const FlowControlOptions& options,
+                     std::shared_ptr<FlowControlledReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+  /// \brief Advertise a new window to the client, e.g. to pause it with
+  /// a zero window.
+  Status SetWindow(int64_t window_rows, int64_t window_bytes);
+
+ private:
+  FlowControlledReader(FlightMessageReader* reader, FlightMetadataWriter* writer,
+                       std::shared_ptr<Schema> schema, const FlowControlOptions& options);
+
+  Status SendCredit();
+  Status Coalesce(std::shared_ptr<RecordBatch>* batch);
+
+  FlightMessageReader* reader_;
+  FlightMetadataWriter* writer_;
+  std::shared_ptr<Schema> schema_;
+  FlowControlOptions options_;
+  int64_t batches_consumed_ = 0;
+  // Batches taken off the stream but not returned yet, when coalescing
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_ = 0;
+  int64_t pending_bytes_ = 0;
+  bool finished_ = false;
+};
+
+/// \brief The client side of a flow-controlled DoPut.
+///
+/// Writing a batch blocks until the server's window allows it.  A batch
+/// is sent as long as the data in flight is below the window, so that
+/// batches larger than the window can still be sent one at a time.  The
+/// first batch is always sent right away, as the server only receives
+/// the schema along with it.
+class ARROW_FLIGHT_EXPORT FlowControlledWriter : public FlightStreamWriter {
+ public:
+  ~FlowControlledWriter() override;
+
+  /// \brief Wrap the writer and metadata reader returned by DoPut.
+  static Status Make(std::unique_ptr<FlightStreamWriter> writer,
+                     std::unique_ptr<FlightMetadataReader> reader,
+                     std::unique_ptr<FlowControlledWriter>* out);
+
+  Status Begin(const std::shared_ptr<Schema>& schema,
+               const ipc::IpcWriteOptions& options) override;
+  using FlightStreamWriter::Begin;
+  Status WriteRecordBatch(const RecordBatch& batch) override;
+  Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) override;
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override;
+  Status DoneWriting() override;
+  Status Close() override;
+  ipc::WriteStats stats() const override;
+
+  /// \brief Read a metadata message from the server, skipping flow
+  /// control messages.
+  Status ReadMetadata(std::shared_ptr<Buffer>* out);
+
+ private:
+  FlowControlledWriter(std::unique_ptr<FlightStreamWriter> writer,
+                       std::unique_ptr<FlightMetadataReader> reader);
+
+  Status WaitForWindow();
+  Status ReadServerMessage();
+  void Sent(const RecordBatch& batch);
+
+  std::unique_ptr<FlightStreamWriter> writer_;
+  std::unique_ptr<FlightMetadataReader> reader_;
+  // Application metadata received while waiting for the window
+  std::deque<std::shared_ptr<Buffer>> metadata_;
+  bool have_window_ = false;
+  int64_t window_rows_ = 0;
+  int64_t window_bytes_ = 0;
+  // The rows and bytes of the batches not acknowledged yet, in order
+  std::deque<std::pair<int64_t, int64_t>> in_flight_;
+  int64_t in_flight_rows_ = 0;
+  int64_t in_flight_bytes_ = 0;
+  int64_t batches_acknowledged_ = 0;
+};
+
+}  // namespace flight
+}  // namespace arrow
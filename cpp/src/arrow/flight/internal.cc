@@ -41,6 +41,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/string_builder.h"
 
 namespace arrow {
@@ -48,6 +49,8 @@ namespace flight {
 namespace internal {
 
 const char* kGrpcAuthHeader = "auth-token-bin";
+const char* kGrpcAcceptCompressionHeader = "x-arrow-accept-compression";
+const char* kGrpcSharedMemoryHeader = "x-arrow-shared-memory";
 const char* kGrpcStatusCodeHeader = "x-arrow-status";
 const char* kGrpcStatusMessageHeader = "x-arrow-status-message-bin";
 const char* kGrpcStatusDetailHeader = "x-arrow-status-detail-bin";
@@ -473,6 +476,29 @@ Status SchemaToString(const Schema& schema, std::string* out) {
   return Status::OK();
 }
 
+std::string FormatCodecList(const std::vector<Compression::type>& codecs) {
+  std::string header;
+  for (const auto type : codecs) {
+    if (!header.empty()) {
+      header += ",";
+    }
+    header += util::Codec::GetCodecAsString(type);
+  }
+  return header;
+}
+
+std::vector<Compression::type> ParseCodecList(util::string_view header) {
+  std::vector<Compression::type> codecs;
+  for (const auto name : ::arrow::internal::SplitString(header, ',')) {
+    auto maybe_type = util::Codec::GetCompressionType(
+        ::arrow::internal::TrimString(std::string(name)));
+    if (maybe_type.ok()) {
+      codecs.push_back(*maybe_type);
+    }
+  }
+  return codecs;
+}
+
 Status ToProto(const FlightInfo& info, pb::FlightInfo* pb_info) {
   // clear any repeated fields
   pb_info->clear_endpoint();
@@ -19,10 +19,13 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/flight/protocol_internal.h"  // IWYU pragma: keep
 #include "arrow/flight/types.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
 
 namespace grpc {
 
@@ -67,6 +70,14 @@ namespace internal {
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcAuthHeader;
 
+/// The name of the header used by clients to list the codecs they accept.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcAcceptCompressionHeader;
+
+/// The name of the header used by clients to ask for shared memory bodies.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcSharedMemoryHeader;
+
 /// The name of the header used to pass the exact Arrow status code.
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcStatusCodeHeader;
@@ -85,6 +96,14 @@ extern const char* kBinaryErrorDetailsKey;
 ARROW_FLIGHT_EXPORT
 Status SchemaToString(const Schema& schema, std::string* out);
 
+/// Format a list of codecs for the accept-compression header.
+ARROW_FLIGHT_EXPORT
+std::string FormatCodecList(const std::vector<Compression::type>& codecs);
+
+/// Parse the accept-compression header, ignoring unknown codecs.
+ARROW_FLIGHT_EXPORT
+std::vector<Compression::type> ParseCodecList(util::string_view header);
+
 /// Convert a gRPC status to an Arrow status. Optionally, provide a
 /// ClientContext to recover the exact Arrow status if it was passed
 /// over the wire.
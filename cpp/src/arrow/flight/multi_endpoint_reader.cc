@@ -0,0 +1,316 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/multi_endpoint_reader.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/ipc/dictionary.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace flight {
+
+MultiEndpointReaderOptions MultiEndpointReaderOptions::Defaults() {
+  return MultiEndpointReaderOptions();
+}
+
+class MultiEndpointReader::Impl {
+ public:
+  Impl(std::shared_ptr<Schema> schema, const MultiEndpointReaderOptions& options)
+      : schema_(std::move(schema)), options_(options) {}
+
+  ~Impl() { ARROW_UNUSED(Close()); }
+
+  Status Start(const FlightInfo& info, FlightClient* default_client) {
+    if (options_.connections_per_location < 1) {
+      return Status::Invalid("connections_per_location must be at least 1");
+    }
+    if (options_.max_concurrent_endpoints < 1) {
+      return Status::Invalid("max_concurrent_endpoints must be at least 1");
+    }
+    if (options_.max_buffered_batches < 1) {
+      return Status::Invalid("max_buffered_batches must be at least 1");
+    }
+
+    const std::vector<FlightEndpoint>& endpoints = info.endpoints();
+    streams_.resize(endpoints.size());
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      streams_[i].ticket = endpoints[i].ticket;
+      RETURN_NOT_OK(GetClient(endpoints[i], default_client, &streams_[i].client));
+    }
+    if (streams_.empty()) {
+      return Status::OK();
+    }
+
+    const int num_threads = static_cast<int>(std::min<size_t>(
+        streams_.size(), static_cast<size_t>(options_.max_concurrent_endpoints)));
+    ARROW_ASSIGN_OR_RAISE(thread_pool_, internal::ThreadPool::Make(num_threads));
+    // The pool runs tasks in submission order, so in ordered mode the
+    // endpoint being consumed has always been started.
+    for (size_t i = 0; i < streams_.size(); ++i) {
+      RETURN_NOT_OK(thread_pool_->Spawn([this, i] { FetchEndpoint(i); }));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!status_.ok()) {
+        return status_;
+      }
+      if (options_.ordered) {
+        if (current_ == streams_.size()) {
+          *out = nullptr;
+          return Status::OK();
+        }
+        Stream& stream = streams_[current_];
+        if (!stream.batches.empty()) {
+          *out = Pop(&stream);
+          return Status::OK();
+        }
+        if (stream.done) {
+          // Unblock the next endpoint, which is now exempt from the limit
+          ++current_;
+          cv_.notify_all();
+          continue;
+        }
+      } else {
+        for (size_t n = 0; n < streams_.size(); ++n) {
+          Stream& stream = streams_[(current_ + n) % streams_.size()];
+          if (!stream.batches.empty()) {
+            // Rotate the starting point so that no endpoint is starved
+            current_ = (current_ + n + 1) % streams_.size();
+            *out = Pop(&stream);
+            return Status::OK();
+          }
+        }
+        if (num_done_ == streams_.size()) {
+          *out = nullptr;
+          return Status::OK();
+        }
+      }
+      cv_.wait(lock);
+    }
+  }
+
+  Status Close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        return Status::OK();
+      }
+      closed_ = true;
+      CancelLocked();
+    }
+    if (thread_pool_) {
+      RETURN_NOT_OK(thread_pool_->Shutdown(/*wait=*/true));
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Stream {
+    Ticket ticket;
+    FlightClient* client = NULLPTR;
+    // Set while the DoGet call is in progress, so that it can be cancelled
+    FlightStreamReader* reader = NULLPTR;
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool done = false;
+  };
+
+  Status GetClient(const FlightEndpoint& endpoint, FlightClient* default_client,
+                   FlightClient** out) {
+    if (endpoint.locations.empty()) {
+      if (default_client == NULLPTR) {
+        return Status::Invalid(
+            "Flight endpoint has no location and no default client was given");
+      }
+      *out = default_client;
+      return Status::OK();
+    }
+
+    const Location& location = endpoint.locations[0];
+    ConnectionPool& pool = connections_[location.ToString()];
+    if (pool.clients.empty()) {
+      for (int i = 0; i < options_.connections_per_location; ++i) {
+        std::unique_ptr<FlightClient> client;
+        RETURN_NOT_OK(FlightClient::Connect(location, options_.client_options, &client));
+        pool.clients.push_back(std::move(client));
+      }
+    }
+    *out = pool.clients[pool.next++ % pool.clients.size()].get();
+    return Status::OK();
+  }
+
+  void FetchEndpoint(size_t index) {
+    Status st = ReadEndpoint(index);
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_[index].done = true;
+    ++num_done_;
+    if (!st.ok() && !cancelled_) {
+      status_ = std::move(st);
+      CancelLocked();
+    }
+    cv_.notify_all();
+  }
+
+  Status ReadEndpoint(size_t index) {
+    Stream& stream = streams_[index];
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cancelled_) {
+        return Status::OK();
+      }
+    }
+
+    std::unique_ptr<FlightStreamReader> reader;
+    RETURN_NOT_OK(stream.client->DoGet(options_.call_options, stream.ticket, &reader));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cancelled_) {
+        reader->Cancel();
+        return Status::OK();
+      }
+      stream.reader = reader.get();
+    }
+    Status st = ReadStream(index, reader.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    stream.reader = NULLPTR;
+    return st;
+  }
+
+  Status ReadStream(size_t index, FlightStreamReader* reader) {
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+    if (!schema->Equals(*schema_)) {
+      return Status::Invalid("Schema of endpoint ", index, " does not match: expected ",
+                             schema_->ToString(), ", got ", schema->ToString());
+    }
+    while (true) {
+      FlightStreamChunk chunk;
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == NULLPTR) {
+        return Status::OK();
+      }
+      if (!Push(index, std::move(chunk.data))) {
+        return Status::OK();
+      }
+    }
+  }
+
+  // Buffer a batch, waiting for space if needed.  Returns false if the
+  // reader was cancelled.
+  bool Push(size_t index, std::shared_ptr<RecordBatch> batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] {
+      return cancelled_ || buffered_batches_ < options_.max_buffered_batches ||
+             (options_.ordered && index == current_);
+    });
+    if (cancelled_) {
+      return false;
+    }
+    streams_[index].batches.push_back(std::move(batch));
+    ++buffered_batches_;
+    cv_.notify_all();
+    return true;
+  }
+
+  std::shared_ptr<RecordBatch> Pop(Stream* stream) {
+    std::shared_ptr<RecordBatch> batch = std::move(stream->batches.front());
+    stream->batches.pop_front();
+    --buffered_batches_;
+    cv_.notify_all();
+    return batch;
+  }
+
+  void CancelLocked() {
+    cancelled_ = true;
+    for (const Stream& stream : streams_) {
+      if (stream.reader != NULLPTR) {
+        stream.reader->Cancel();
+      }
+    }
+    cv_.notify_all();
+  }
+
+  struct ConnectionPool {
+    std::vector<std::unique_ptr<FlightClient>> clients;
+    size_t next = 0;
+  };
+
+  std::shared_ptr<Schema> schema_;
+  MultiEndpointReaderOptions options_;
+  std::unordered_map<std::string, ConnectionPool> connections_;
+  std::shared_ptr<internal::ThreadPool> thread_pool_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Stream> streams_;
+  // Ordered mode: the endpoint being consumed.  Unordered mode: the
+  // endpoint to look at first.
+  size_t current_ = 0;
+  size_t num_done_ = 0;
+  int64_t buffered_batches_ = 0;
+  bool cancelled_ = false;
+  bool closed_ = false;
+  Status status_;
+};
+
+MultiEndpointReader::MultiEndpointReader() = default;
+
+MultiEndpointReader::~MultiEndpointReader() {
+  if (impl_) {
+    ARROW_UNUSED(impl_->Close());
+  }
+}
+
+Status MultiEndpointReader::Open(const FlightInfo& info, FlightClient* default_client,
+                                 const MultiEndpointReaderOptions& options,
+                                 std::shared_ptr<MultiEndpointReader>* out) {
+  ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+
+  std::unique_ptr<Impl> impl(new Impl(std::move(schema), options));
+  RETURN_NOT_OK(impl->Start(info, default_client));
+  std::shared_ptr<MultiEndpointReader> reader(new MultiEndpointReader());
+  reader->impl_ = std::move(impl);
+  *out = std::move(reader);
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> MultiEndpointReader::schema() const { return impl_->schema(); }
+
+Status MultiEndpointReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+Status MultiEndpointReader::Close() { return impl_->Close(); }
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A client-side reader fetching all the endpoints of a FlightInfo concurrently.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief Options for MultiEndpointReader
+struct ARROW_FLIGHT_EXPORT MultiEndpointReaderOptions {
+  /// \brief Per-RPC options used for every DoGet call.
+  FlightCallOptions call_options;
+  /// \brief Options for the connections opened to endpoint locations.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  /// \brief The number of connections to open to each distinct location.
+  ///
+  /// Endpoints served from the same location are spread over these
+  /// connections in round-robin order.
+  int connections_per_location = 1;
+  /// \brief The maximum number of endpoints fetched at the same time.
+  int max_concurrent_endpoints = 8;
+  /// \brief The maximum number of batches received but not yet consumed.
+  ///
+  /// Endpoint streams stop reading from the network when this limit is
+  /// reached.  In ordered mode, the endpoint currently being consumed is
+  /// exempt from the limit, so that the reader cannot stall.
+  int64_t max_buffered_batches = 16;
+  /// \brief Whether batches are returned in endpoint order.
+  ///
+  /// If true, all batches of an endpoint are returned before the batches of
+  /// the next endpoint, as the order of FlightInfo endpoints is
+  /// significant for some services.  If false, batches are returned as
+  /// soon as they arrive, regardless of their endpoint.
+  bool ordered = true;
+
+  /// \brief Get default options.
+  static MultiEndpointReaderOptions Defaults();
+};
+
+/// \brief A RecordBatchReader over all the endpoints of a FlightInfo.
+///
+/// Endpoints are fetched concurrently with DoGet.  Each endpoint is read
+/// from its first location; endpoints without a location are read with the
+/// client that returned the FlightInfo.  The first error encountered on any
+/// endpoint cancels the other streams and is returned by ReadNext().
+class ARROW_FLIGHT_EXPORT MultiEndpointReader : public RecordBatchReader {
+ public:
+  ~MultiEndpointReader() override;
+
+  /// \brief Start fetching the endpoints of a flight.
+  /// \param[in] info the flight to read; its schema must be set
+  /// \param[in] default_client the client used for endpoints without a
+  /// location. May be null if all endpoints have a location, else it must
+  /// outlive the reader.
+  /// \param[in] options reader options
+  /// \param[out] out the created reader
+  /// \return Status
+  static Status Open(const FlightInfo& info, FlightClient* default_client,
+                     const MultiEndpointReaderOptions& options,
+                     std::shared_ptr<MultiEndpointReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+  /// \brief Cancel the endpoint streams that are still running and wait for
+  /// them to stop.
+  ///
+  /// This is called on destruction if the reader was not exhausted.
+  Status Close();
+
+ private:
+  MultiEndpointReader();
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace flight
+}  // namespace arrow
@@ -19,18 +19,24 @@
 
 #include <signal.h>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
 
 #include <gflags/gflags.h>
 
 #include "arrow/array.h"
+#include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -41,6 +47,12 @@
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
 DEFINE_string(server_unix, "", "Unix socket path where the server is running on");
+DEFINE_string(cert_file, "", "TLS certificate (PEM) to serve with; enables TLS");
+DEFINE_string(key_file, "", "TLS private key (PEM) matching -cert_file");
+DEFINE_string(compression, "",
+              "Compression to use for DoGet when the client accepts it "
+              "(\"zstd\", \"lz4\", optionally with a level, e.g. \"zstd:7\"). "
+              "Leave blank to disable compression.");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -74,6 +86,10 @@ class PerfDataStream : public FlightDataStream {
 
   std::shared_ptr<Schema> schema() override { return schema_; }
 
+  void SetCodecSelector(std::unique_ptr<CodecSelector> selector) override {
+    selector_ = std::move(selector);
+  }
+
   Status GetSchemaPayload(FlightPayload* payload) override {
     return ipc::GetSchemaPayload(*schema_, ipc_options_, mapper_, &payload->ipc_message);
   }
@@ -95,6 +111,9 @@ class PerfDataStream : public FlightDataStream {
     }
 
     auto batch = batch_;
+    if (selector_) {
+      ipc_options_.codec = selector_->Choose();
+    }
 
     // Last partial batch
     if (records_sent_ + batch_length_ > total_records_) {
@@ -117,19 +136,42 @@ class PerfDataStream : public FlightDataStream {
   ipc::IpcWriteOptions ipc_options_;
   std::shared_ptr<RecordBatch> batch_;
   ArrayVector arrays_;
+  std::unique_ptr<CodecSelector> selector_;
 };
 
+Status GetPerfSchema(const perf::Perf& perf, std::shared_ptr<Schema>* schema) {
+  if (perf.schema().empty()) {
+    *schema = arrow::schema({field("a", int64()), field("b", int64()),
+                             field("c", int64()), field("d", int64())});
+    return Status::OK();
+  }
+  io::BufferReader stream(std::make_shared<Buffer>(perf.schema()));
+  return ipc::ReadSchema(&stream, nullptr).Value(schema);
+}
+
 Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
                       bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+  const int32_t string_length = token.definition().string_length();
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    switch (schema->field(i)->type()->id()) {
+      case Type::INT64:
+        RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t),
+                                           default_memory_pool(), &buffer,
+                                           static_cast<int32_t>(i) /* seed */));
+        arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+        break;
+      case Type::STRING:
+        arrays.push_back(rng.String(length, string_length, string_length));
+        break;
+      default:
+        return Status::NotImplemented("Cannot generate perf data of type ",
+                                      *schema->field(i)->type());
+    }
     RETURN_NOT_OK(arrays.back()->Validate());
   }
 
@@ -139,16 +181,27 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
   return Status::OK();
 }
 
+Status ReadFile(const std::string& path, std::string* out) {
+  std::ifstream file(path);
+  if (!file) {
+    return Status::IOError("Could not open ", path);
+  }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  *out = contents.str();
+  return Status::OK();
+}
+
 class FlightPerfServer : public FlightServerBase {
  public:
   FlightPerfServer() : location_() {
-    if (FLAGS_server_unix.empty()) {
-      DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
-    } else {
+    if (!FLAGS_server_unix.empty()) {
       DCHECK_OK(Location::ForGrpcUnix(FLAGS_server_unix, &location_));
+    } else if (!FLAGS_cert_file.empty()) {
+      DCHECK_OK(Location::ForGrpcTls(FLAGS_server_host, FLAGS_port, &location_));
+    } else {
+      DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
     }
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
   }
 
   Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
@@ -174,9 +227,11 @@ class FlightPerfServer : public FlightServerBase {
     uint64_t total_records =
         perf_request.stream_count() * perf_request.records_per_stream();
 
+    std::shared_ptr<Schema> perf_schema;
+    RETURN_NOT_OK(GetPerfSchema(perf_request, &perf_schema));
     FlightInfo::Data data;
     RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+        MakeFlightInfo(*perf_schema, request, endpoints, total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -185,7 +240,9 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    std::shared_ptr<Schema> perf_schema;
+    RETURN_NOT_OK(GetPerfSchema(token.definition(), &perf_schema));
+    return GetPerfBatches(token, perf_schema, false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -202,6 +259,24 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  // Echo each batch back, to measure round trips
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    FlightStreamChunk chunk;
+    bool begun = false;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (!chunk.data) break;
+      if (!begun) {
+        RETURN_NOT_OK(writer->Begin(chunk.data->schema()));
+        begun = true;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -214,7 +289,6 @@ class FlightPerfServer : public FlightServerBase {
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -234,12 +308,32 @@ int main(int argc, char** argv) {
   g_server.reset(new arrow::flight::FlightPerfServer);
 
   arrow::flight::Location location;
-  if (FLAGS_server_unix.empty()) {
-    ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
-  } else {
+  if (!FLAGS_server_unix.empty()) {
     ARROW_CHECK_OK(arrow::flight::Location::ForGrpcUnix(FLAGS_server_unix, &location));
+  } else if (!FLAGS_cert_file.empty()) {
+    ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTls("0.0.0.0", FLAGS_port, &location));
+  } else {
+    ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
   }
   arrow::flight::FlightServerOptions options(location);
+  if (!FLAGS_cert_file.empty()) {
+    arrow::flight::CertKeyPair pair;
+    ARROW_CHECK_OK(arrow::flight::ReadFile(FLAGS_cert_file, &pair.pem_cert));
+    ARROW_CHECK_OK(arrow::flight::ReadFile(FLAGS_key_file, &pair.pem_key));
+    options.tls_certificates.push_back(std::move(pair));
+  }
+  if (!FLAGS_compression.empty()) {
+    // "zstd" or "zstd:7"
+    const size_t delim = FLAGS_compression.find(':');
+    const auto type =
+        arrow::util::Codec::GetCompressionType(FLAGS_compression.substr(0, delim))
+            .ValueOrDie();
+    options.compression.codecs = {type};
+    if (delim != std::string::npos) {
+      options.compression.compression_level =
+          std::stoi(FLAGS_compression.substr(delim + 1));
+    }
+  }
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
@@ -17,7 +17,9 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 #include <vector>
@@ -48,8 +50,10 @@
 
 #include "arrow/buffer.h"
 #include "arrow/flight/server.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
@@ -70,6 +74,37 @@ using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
+namespace {
+
+std::atomic<int64_t> zero_copy_bytes_read{0};
+std::atomic<int64_t> copied_bytes_read{0};
+
+// Return the offset of the data_body contents in a serialized FlightData,
+// or -1 if there is no body or the message can't be scanned.
+int64_t FindBodyOffset(ByteBuffer* buffer) {
+  grpc::ProtoBufferReader reader(buffer);
+  CodedInputStream stream(&reader);
+  while (true) {
+    const uint32_t tag = stream.ReadTag();
+    if (tag == 0 || WireFormatLite::GetTagWireType(tag) !=
+                        WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      return -1;
+    }
+    uint32_t length;
+    if (!stream.ReadVarint32(&length)) {
+      return -1;
+    }
+    if (WireFormatLite::GetTagFieldNumber(tag) == pb::FlightData::kDataBodyFieldNumber) {
+      return stream.CurrentPosition();
+    }
+    if (!stream.Skip(static_cast<int>(length))) {
+      return -1;
+    }
+  }
+}
+
+}  // namespace
+
 bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
                        CodedInputStream* input, std::shared_ptr<Buffer>* out) {
   uint32_t length;
@@ -96,7 +131,8 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  static Status Wrap(ByteBuffer* cpp_buf, MemoryPool* pool,
+                     std::shared_ptr<Buffer>* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
 
@@ -115,13 +151,38 @@ class GrpcBuffer : public MutableBuffer {
       if (slice.refcount) {
         // Increment reference count so this memory remains valid
         *out = std::make_shared<GrpcBuffer>(slice, true);
+        zero_copy_bytes_read += (*out)->size();
       } else {
         // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
         // inlined into the structure and must be copied.
         const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
+        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length, pool));
         std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+        copied_bytes_read += length;
       }
+    } else if ((buffer->type == GRPC_BB_RAW) &&
+               (buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+      // The message spans several slices: reassemble it into a single
+      // allocation from the memory pool.  The copy is offset so that the
+      // body (usually the bulk of the message) starts on a 64-byte boundary,
+      // sparing consumers another copy to realign it.
+      const int64_t body_offset = FindBodyOffset(cpp_buf);
+      const int64_t padding =
+          body_offset < 0 ? 0
+                          : BitUtil::RoundUpToMultipleOf64(body_offset) - body_offset;
+      const auto length = static_cast<int64_t>(grpc_byte_buffer_length(buffer));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> storage,
+                            arrow::AllocateBuffer(padding + length, pool));
+      uint8_t* dest = storage->mutable_data() + padding;
+      const grpc_slice_buffer& slices = buffer->data.raw.slice_buffer;
+      for (size_t i = 0; i < slices.count; ++i) {
+        const size_t slice_length = GRPC_SLICE_LENGTH(slices.slices[i]);
+        std::memcpy(dest, GRPC_SLICE_START_PTR(slices.slices[i]), slice_length);
+        dest += slice_length;
+      }
+      DCHECK_EQ(dest, storage->data() + padding + length);
+      *out = SliceBuffer(std::move(storage), padding, length);
+      copied_bytes_read += length;
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
       // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
@@ -135,6 +196,7 @@ class GrpcBuffer : public MutableBuffer {
 
       // Steal the slice reference
       *out = std::make_shared<GrpcBuffer>(slice, false);
+      copied_bytes_read += (*out)->size();
     }
 
     return Status::OK();
@@ -317,7 +379,7 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
   out->body = nullptr;
 
   std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, out->memory_pool, &wrapped_buffer));
 
   auto buffer_length = static_cast<int>(wrapped_buffer->size());
   CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
@@ -386,9 +448,22 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
 }
 
 ::arrow::Result<std::unique_ptr<ipc::Message>> FlightData::OpenMessage() {
+  RETURN_NOT_OK(MapSharedMemoryBody(this));
   return ipc::Message::Open(metadata, body);
 }
 
+}  // namespace internal
+
+FlightDataReadStats GetFlightDataReadStats() {
+  FlightDataReadStats stats;
+  stats.zero_copy_bytes = internal::zero_copy_bytes_read.load();
+  stats.copied_bytes = internal::copied_bytes_read.load();
+  stats.shared_memory_bytes = internal::SharedMemoryBytesRead();
+  return stats;
+}
+
+namespace internal {
+
 // The pointer bitcast hack below causes legitimate warnings, silence them.
 #ifndef _WIN32
 #pragma GCC diagnostic push
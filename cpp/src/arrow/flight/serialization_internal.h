@@ -25,6 +25,7 @@
 #include "arrow/flight/internal.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/message.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 
 namespace arrow {
@@ -49,6 +50,12 @@ struct FlightData {
   /// Message body
   std::shared_ptr<Buffer> body;
 
+  /// Pool used when the received message has to be copied to be made contiguous
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// Whether the body may be sent through shared memory
+  bool allow_shared_memory = false;
+
   /// Open IPC message from the metadata and body
   ::arrow::Result<std::unique_ptr<ipc::Message>> OpenMessage();
 };
@@ -81,7 +88,7 @@ bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* reader
 // (1) Adapting it to the Flight message format
 // (2) Allowing pure-metadata messages before data is sent
 // (3) Reusing the reader implementation between DoGet and DoExchange.
-// To do this, we wrap the gRPC reader in a peekable iterator.
+// To do this, we wrap the transport's data stream in a peekable iterator.
 // The Flight reader can then peek at the message to determine whether
 // it has application metadata or not, and pass the message to
 // RecordBatchStreamReader as appropriate.
@@ -130,7 +137,7 @@ class PeekableFlightDataReader {
       return valid_;
     }
 
-    if (!internal::ReadPayload(&*stream_, &peek_)) {
+    if (!stream_->ReadData(&peek_)) {
       finished_ = true;
       valid_ = false;
     } else {
@@ -26,8 +26,10 @@
 #include <fcntl.h>
 #include <unistd.h>
 #endif
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <sstream>
@@ -42,6 +44,7 @@
 #include <grpc++/grpc++.h>
 #endif
 
+#include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
@@ -50,16 +53,20 @@
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
 
+#include "arrow/flight/compression.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
+#include "arrow/flight/transport_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -98,13 +105,115 @@ namespace pb = arrow::flight::protocol;
 
 namespace {
 
-// A MessageReader implementation that reads from a gRPC ServerReader.
-// Templated to be generic over DoPut/DoExchange.
-template <typename Reader>
+using SteadyClock = std::chrono::steady_clock;
+
+double SecondsSince(SteadyClock::time_point start) {
+  return std::chrono::duration<double>(SteadyClock::now() - start).count();
+}
+
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = 0;
+  if (payload.descriptor) size += payload.descriptor->size();
+  if (payload.app_metadata) size += payload.app_metadata->size();
+  if (payload.ipc_message.metadata) size += payload.ipc_message.metadata->size();
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    if (buffer) size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  return size;
+}
+
+int64_t FlightDataSize(const internal::FlightData& data) {
+  int64_t size = 0;
+  if (data.app_metadata) size += data.app_metadata->size();
+  if (data.metadata) size += data.metadata->size();
+  if (data.body) size += data.body->size();
+  return size;
+}
+
+// Adapt the gRPC streams of the data-plane RPCs to the operations of
+// internal::ServerDataStream. Operations a stream doesn't support fail.
+
+bool GrpcReadData(grpc::ServerWriter<pb::FlightData>*, internal::FlightData*) {
+  return false;
+}
+
+template <typename Stream>
+bool GrpcReadData(Stream* stream, internal::FlightData* data) {
+  return internal::ReadPayload(stream, data);
+}
+
+bool GrpcWriteData(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>*,
+                   const FlightPayload&) {
+  return false;
+}
+
+template <typename Stream>
+bool GrpcWriteData(Stream* stream, const FlightPayload& payload) {
+  return internal::WritePayload(payload, stream);
+}
+
+template <typename Stream>
+bool GrpcWritePutMetadata(Stream*, const Buffer&) {
+  return false;
+}
+
+bool GrpcWritePutMetadata(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* stream,
+                          const Buffer& metadata) {
+  pb::PutResult message{};
+  message.set_app_metadata(metadata.data(), metadata.size());
+  return stream->Write(message);
+}
+
+/// A ServerDataStream over a gRPC stream, valid for the duration of the call.
+/// The data transferred and the time blocked on the stream are added to
+/// the statistics of the call.
+template <typename Stream>
+class GrpcServerDataStream : public internal::ServerDataStream {
+ public:
+  GrpcServerDataStream(Stream* stream, MemoryPool* memory_pool, ServerCallStats* stats)
+      : stream_(stream), memory_pool_(memory_pool), stats_(stats) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    data->memory_pool = memory_pool_;
+    const auto start = SteadyClock::now();
+    const bool ok = GrpcReadData(stream_, data);
+    stats_->network_seconds += SecondsSince(start);
+    if (ok) {
+      stats_->bytes_received += FlightDataSize(*data);
+    }
+    return ok;
+  }
+
+  bool WriteData(const FlightPayload& payload) override {
+    const auto start = SteadyClock::now();
+    const bool ok = GrpcWriteData(stream_, payload);
+    stats_->network_seconds += SecondsSince(start);
+    if (ok) {
+      stats_->bytes_sent += PayloadSize(payload);
+      if (payload.ipc_message.type == ipc::MessageType::RECORD_BATCH) {
+        ++stats_->batches_sent;
+      }
+    }
+    return ok;
+  }
+
+  bool WritePutMetadata(const Buffer& metadata) override {
+    return GrpcWritePutMetadata(stream_, metadata);
+  }
+
+ private:
+  Stream* stream_;
+  MemoryPool* memory_pool_;
+  ServerCallStats* stats_;
+};
+
+// A MessageReader implementation that reads from a data stream.
+// Generic over DoPut/DoExchange.
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
   explicit FlightIpcMessageReader(
-      std::shared_ptr<internal::PeekableFlightDataReader<Reader*>> peekable_reader,
+      std::shared_ptr<internal::PeekableFlightDataReader<internal::ServerDataStream*>>
+          peekable_reader,
       std::shared_ptr<Buffer>* app_metadata)
       : peekable_reader_(peekable_reader), app_metadata_(app_metadata) {}
 
@@ -127,7 +236,8 @@ class FlightIpcMessageReader : public ipc::MessageReader {
   }
 
  protected:
-  std::shared_ptr<internal::PeekableFlightDataReader<Reader*>> peekable_reader_;
+  std::shared_ptr<internal::PeekableFlightDataReader<internal::ServerDataStream*>>
+      peekable_reader_;
   // A reference to FlightMessageReaderImpl.app_metadata_. That class
   // can't access the app metadata because when it Peek()s the stream,
   // it may be looking at a dictionary batch, not the record
@@ -138,14 +248,13 @@ class FlightIpcMessageReader : public ipc::MessageReader {
   bool stream_finished_ = false;
 };
 
-template <typename WritePayload>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  using GrpcStream = grpc::ServerReaderWriter<WritePayload, pb::FlightData>;
-
-  explicit FlightMessageReaderImpl(GrpcStream* reader)
+  FlightMessageReaderImpl(internal::ServerDataStream* reader, ServerCallStats* stats)
       : reader_(reader),
-        peekable_reader_(new internal::PeekableFlightDataReader<GrpcStream*>(reader)) {}
+        peekable_reader_(
+            new internal::PeekableFlightDataReader<internal::ServerDataStream*>(reader)),
+        stats_(stats) {}
 
   Status Init() {
     // Peek the first message to get the descriptor.
@@ -195,7 +304,16 @@ class FlightMessageReaderImpl : public FlightMessageReader {
       // re-peek here since EnsureDataStarted() advances the stream
       return Next(out);
     }
+    // Reading the batch may block on the stream: only count the rest as
+    // decoding
+    const auto start = SteadyClock::now();
+    const double network_seconds = stats_->network_seconds;
     RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
+    stats_->serialization_seconds +=
+        SecondsSince(start) - (stats_->network_seconds - network_seconds);
+    if (out->data) {
+      ++stats_->batches_received;
+    }
     out->app_metadata = std::move(app_metadata_);
     return Status::OK();
   }
@@ -209,7 +327,7 @@ class FlightMessageReaderImpl : public FlightMessageReader {
         return Status::IOError("Client never sent a data message");
       }
       auto message_reader = std::unique_ptr<ipc::MessageReader>(
-          new FlightIpcMessageReader<GrpcStream>(peekable_reader_, &app_metadata_));
+          new FlightIpcMessageReader(peekable_reader_, &app_metadata_));
       ARROW_ASSIGN_OR_RAISE(
           batch_reader_, ipc::RecordBatchStreamReader::Open(std::move(message_reader)));
     }
@@ -217,29 +335,27 @@ class FlightMessageReaderImpl : public FlightMessageReader {
   }
 
   FlightDescriptor descriptor_;
-  GrpcStream* reader_;
-  std::shared_ptr<internal::PeekableFlightDataReader<GrpcStream*>> peekable_reader_;
+  internal::ServerDataStream* reader_;
+  std::shared_ptr<internal::PeekableFlightDataReader<internal::ServerDataStream*>>
+      peekable_reader_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> app_metadata_;
+  ServerCallStats* stats_;
 };
 
-class GrpcMetadataWriter : public FlightMetadataWriter {
+class ServerMetadataWriter : public FlightMetadataWriter {
  public:
-  explicit GrpcMetadataWriter(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer)
-      : writer_(writer) {}
+  explicit ServerMetadataWriter(internal::ServerDataStream* writer) : writer_(writer) {}
 
   Status WriteMetadata(const Buffer& buffer) override {
-    pb::PutResult message{};
-    message.set_app_metadata(buffer.data(), buffer.size());
-    if (writer_->Write(message)) {
+    if (writer_->WritePutMetadata(buffer)) {
       return Status::OK();
     }
     return Status::IOError("Unknown error writing metadata.");
   }
 
  private:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer_;
+  internal::ServerDataStream* writer_;
 };
 
 class GrpcServerAuthReader : public ServerAuthReader {
@@ -284,9 +400,10 @@ class GrpcServerAuthSender : public ServerAuthSender {
 /// stream for DoExchange.
 class DoExchangeMessageWriter : public FlightMessageWriter {
  public:
-  explicit DoExchangeMessageWriter(
-      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream)
-      : stream_(stream), ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
+  DoExchangeMessageWriter(internal::ServerDataStream* stream, ServerCallStats* stats)
+      : stream_(stream),
+        call_stats_(stats),
+        ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
 
   Status Begin(const std::shared_ptr<Schema>& schema,
                const ipc::IpcWriteOptions& options) override {
@@ -296,10 +413,12 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
     started_ = true;
     ipc_options_ = options;
 
+    const auto start = SteadyClock::now();
     RETURN_NOT_OK(mapper_.AddSchemaFields(*schema));
     FlightPayload schema_payload;
     RETURN_NOT_OK(ipc::GetSchemaPayload(*schema, ipc_options_, mapper_,
                                         &schema_payload.ipc_message));
+    call_stats_->serialization_seconds += SecondsSince(start);
     return WritePayload(schema_payload);
   }
 
@@ -321,7 +440,9 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
     if (app_metadata) {
       payload.app_metadata = app_metadata;
     }
+    const auto start = SteadyClock::now();
     RETURN_NOT_OK(ipc::GetRecordBatchPayload(batch, ipc_options_, &payload.ipc_message));
+    call_stats_->serialization_seconds += SecondsSince(start);
     RETURN_NOT_OK(WritePayload(payload));
     ++stats_.num_record_batches;
     return Status::OK();
@@ -336,7 +457,7 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
 
  private:
   Status WritePayload(const FlightPayload& payload) {
-    if (!internal::WritePayload(payload, stream_)) {
+    if (!stream_->WriteData(payload)) {
       // gRPC doesn't give us any way to find what the error was (if any).
       return Status::IOError("Could not write payload to stream");
     }
@@ -360,15 +481,18 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
                           ipc::CollectDictionaries(batch, mapper_));
     for (const auto& pair : dictionaries) {
       FlightPayload payload{};
+      const auto start = SteadyClock::now();
       RETURN_NOT_OK(ipc::GetDictionaryPayload(pair.first, pair.second, ipc_options_,
                                               &payload.ipc_message));
+      call_stats_->serialization_seconds += SecondsSince(start);
       RETURN_NOT_OK(WritePayload(payload));
       ++stats_.num_dictionary_batches;
     }
     return Status::OK();
   }
 
-  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream_;
+  internal::ServerDataStream* stream_;
+  ServerCallStats* call_stats_;
   ::arrow::ipc::IpcWriteOptions ipc_options_;
   ipc::DictionaryFieldMapper mapper_;
   ipc::WriteStats stats_;
@@ -379,7 +503,7 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
 class FlightServiceImpl;
 class GrpcServerCallContext : public ServerCallContext {
   explicit GrpcServerCallContext(grpc::ServerContext* context)
-      : context_(context), peer_(context_->peer()) {}
+      : context_(context), peer_(context_->peer()), start_(SteadyClock::now()) {}
 
   const std::string& peer_identity() const override { return peer_identity_; }
   const std::string& peer() const override { return peer_; }
@@ -393,7 +517,9 @@ class GrpcServerCallContext : public ServerCallContext {
   }
 
   grpc::Status FinishRequest(const arrow::Status& status) {
+    stats_.duration_seconds = SecondsSince(start_);
     for (const auto& instance : middleware_) {
+      instance->CallStatsCollected(stats_);
       instance->CallCompleted(status);
     }
 
@@ -417,6 +543,8 @@ class GrpcServerCallContext : public ServerCallContext {
   std::string peer_identity_;
   std::vector<std::shared_ptr<ServerMiddleware>> middleware_;
   std::unordered_map<std::string, std::shared_ptr<ServerMiddleware>> middleware_map_;
+  SteadyClock::time_point start_;
+  ServerCallStats stats_;
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
@@ -440,8 +568,24 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      MemoryPool* memory_pool, FlightCompressionOptions compression,
+      SharedMemoryOptions shared_memory, FlightServerBase* server)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        memory_pool_(memory_pool),
+        compression_(std::move(compression)),
+        shared_memory_(shared_memory),
+        server_(server) {
+    // Only offer the codecs that can be used in this build
+    const auto available = GetAvailableFlightCodecs();
+    compression_.codecs.erase(
+        std::remove_if(compression_.codecs.begin(), compression_.codecs.end(),
+                       [&](Compression::type type) {
+                         return std::find(available.begin(), available.end(),
+                                          type) == available.end();
+                       }),
+        compression_.codecs.end());
+  }
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -540,9 +684,49 @@ class FlightServiceImpl : public FlightService::Service {
       }
     }
 
+    flight_context.stats_.queue_seconds = SecondsSince(flight_context.start_);
     return grpc::Status::OK;
   }
 
+  // Compress the stream with the server's preferred codecs among those
+  // the client accepts, if any
+  Status NegotiateCompression(const ServerContext& context, FlightDataStream* stream) {
+    if (compression_.codecs.empty()) {
+      return Status::OK();
+    }
+    const auto& client_metadata = context.client_metadata();
+    const auto header = client_metadata.find(internal::kGrpcAcceptCompressionHeader);
+    if (header == client_metadata.end()) {
+      return Status::OK();
+    }
+    const auto accepted = internal::ParseCodecList(
+        util::string_view(header->second.data(), header->second.length()));
+    std::vector<Compression::type> codecs;
+    for (const auto type : compression_.codecs) {
+      if (std::find(accepted.begin(), accepted.end(), type) != accepted.end()) {
+        codecs.push_back(type);
+      }
+    }
+    if (codecs.empty()) {
+      return Status::OK();
+    }
+    std::unique_ptr<CodecSelector> selector;
+    RETURN_NOT_OK(CodecSelector::Make(compression_, codecs, &selector));
+    stream->SetCodecSelector(std::move(selector));
+    return Status::OK();
+  }
+
+  // Whether to send the message bodies through shared memory
+  bool UseSharedMemory(const ServerContext& context) {
+    if (!shared_memory_.enabled || !internal::SharedMemorySupported()) {
+      return false;
+    }
+    const auto& client_metadata = context.client_metadata();
+    return client_metadata.find(internal::kGrpcSharedMemoryHeader) !=
+               client_metadata.end() &&
+           internal::IsLocalPeer(context.peer());
+  }
+
   grpc::Status Handshake(
       ServerContext* context,
       grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream) {
@@ -654,10 +838,25 @@ class FlightServiceImpl : public FlightService::Service {
                                                           "No data in this flight"));
     }
 
+    std::unique_ptr<internal::SharedMemoryBodyWriter> shared_memory_writer;
+    if (UseSharedMemory(*context)) {
+      shared_memory_writer.reset(
+          new internal::SharedMemoryBodyWriter(shared_memory_, &shared_memory_registry_));
+    } else {
+      SERVICE_RETURN_NOT_OK(flight_context,
+                            NegotiateCompression(*context, data_stream.get()));
+    }
+
+    ServerCallStats* stats = &flight_context.stats_;
+    GrpcServerDataStream<ServerWriter<pb::FlightData>> stream(writer, memory_pool_,
+                                                              stats);
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
+    auto start = SteadyClock::now();
     SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
-    if (!internal::WritePayload(schema_payload, writer)) {
+    stats->serialization_seconds += SecondsSince(start);
+    if (!stream.WriteData(schema_payload)) {
       // gRPC doesn't give any way for us to know why the message
       // could not be written.
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
@@ -666,12 +865,24 @@ class FlightServiceImpl : public FlightService::Service {
     // Consume data stream and write out payloads
     while (true) {
       FlightPayload payload;
+      start = SteadyClock::now();
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
         break;
+      }
+      if (shared_memory_writer) {
+        shared_memory_writer->Process(&payload);
+      }
+      stats->serialization_seconds += SecondsSince(start);
+      if (!stream.WriteData(payload)) {
+        // Connection terminated for some other reason: the client won't
+        // read the remaining segments
+        if (shared_memory_writer) {
+          shared_memory_writer->Abort();
+        }
+        break;
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
@@ -681,11 +892,13 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context(context);
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
-    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::PutResult>>(
-        new FlightMessageReaderImpl<pb::PutResult>(reader));
+    GrpcServerDataStream<grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>>
+        stream(reader, memory_pool_, &flight_context.stats_);
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl>(
+        new FlightMessageReaderImpl(&stream, &flight_context.stats_));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
     auto metadata_writer =
-        std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
+        std::unique_ptr<FlightMetadataWriter>(new ServerMetadataWriter(&stream));
     RETURN_WITH_MIDDLEWARE(flight_context,
                            server_->DoPut(flight_context, std::move(message_reader),
                                           std::move(metadata_writer)));
@@ -696,11 +909,13 @@ class FlightServiceImpl : public FlightService::Service {
       grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream) {
     GrpcServerCallContext flight_context(context);
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoExchange, context, flight_context));
-    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::FlightData>>(
-        new FlightMessageReaderImpl<pb::FlightData>(stream));
+    GrpcServerDataStream<grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>>
+        data_stream(stream, memory_pool_, &flight_context.stats_);
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl>(
+        new FlightMessageReaderImpl(&data_stream, &flight_context.stats_));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
-    auto writer =
-        std::unique_ptr<DoExchangeMessageWriter>(new DoExchangeMessageWriter(stream));
+    auto writer = std::unique_ptr<DoExchangeMessageWriter>(
+        new DoExchangeMessageWriter(&data_stream, &flight_context.stats_));
     RETURN_WITH_MIDDLEWARE(flight_context,
                            server_->DoExchange(flight_context, std::move(message_reader),
                                                std::move(writer)));
@@ -754,6 +969,10 @@ class FlightServiceImpl : public FlightService::Service {
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
+  MemoryPool* memory_pool_;
+  FlightCompressionOptions compression_;
+  SharedMemoryOptions shared_memory_;
+  internal::SharedMemoryRegistry shared_memory_registry_;
   FlightServerBase* server_;
 };
 
@@ -899,7 +1118,8 @@ FlightServerOptions::FlightServerOptions(const Location& location_)
       verify_client(false),
       root_certificates(),
       middleware(),
-      builder_hook(nullptr) {}
+      builder_hook(nullptr),
+      memory_pool(default_memory_pool()) {}
 
 FlightServerOptions::~FlightServerOptions() = default;
 
@@ -908,8 +1128,10 @@ FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
-  impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+  impl_->service_.reset(new FlightServiceImpl(options.auth_handler, options.middleware,
+                                              options.memory_pool,
+                                              options.compression,
+                                              options.shared_memory, this));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -1089,6 +1311,10 @@ class RecordBatchStream::RecordBatchStreamImpl {
                                  &payload->ipc_message);
   }
 
+  void SetCodecSelector(std::unique_ptr<CodecSelector> selector) {
+    selector_ = std::move(selector);
+  }
+
   Status Next(FlightPayload* payload) {
     if (stage_ == Stage::NEW) {
       RETURN_NOT_OK(reader_->ReadNext(&current_batch_));
@@ -1097,6 +1323,7 @@ class RecordBatchStream::RecordBatchStreamImpl {
         payload->ipc_message.metadata = nullptr;
         return Status::OK();
       }
+      StartBatch();
       ARROW_ASSIGN_OR_RAISE(dictionaries_,
                             ipc::CollectDictionaries(*current_batch_, mapper_));
       stage_ = Stage::DICTIONARY;
@@ -1112,6 +1339,8 @@ class RecordBatchStream::RecordBatchStreamImpl {
       }
     }
 
+    // The previous batch has been sent by now
+    FinishBatch();
     RETURN_NOT_OK(reader_->ReadNext(&current_batch_));
 
     // TODO(wesm): Delta dictionaries
@@ -1120,12 +1349,47 @@ class RecordBatchStream::RecordBatchStreamImpl {
       payload->ipc_message.metadata = nullptr;
       return Status::OK();
     } else {
+      StartBatch();
       return ipc::GetRecordBatchPayload(*current_batch_, ipc_options_,
                                         &payload->ipc_message);
     }
   }
 
  private:
+  // Choose the codec of the current batch, and start timing how long it
+  // takes to compress and send it (along with its dictionaries)
+  void StartBatch() {
+    if (selector_) {
+      ipc_options_.codec = selector_->Choose();
+      batch_size_ = 0;
+      for (const auto& column : current_batch_->column_data()) {
+        batch_size_ += BufferSize(*column);
+      }
+      batch_start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  void FinishBatch() {
+    if (selector_) {
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - batch_start_;
+      selector_->Record(batch_size_, elapsed.count());
+    }
+  }
+
+  static int64_t BufferSize(const ArrayData& data) {
+    int64_t size = 0;
+    for (const auto& buffer : data.buffers) {
+      if (buffer) {
+        size += buffer->size();
+      }
+    }
+    for (const auto& child : data.child_data) {
+      size += BufferSize(*child);
+    }
+    return size;
+  }
+
   Status GetNextDictionary(FlightPayload* payload) {
     const auto& it = dictionaries_[dictionary_index_++];
     return ipc::GetDictionaryPayload(it.first, it.second, ipc_options_,
@@ -1141,10 +1405,16 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
   // Index of next dictionary to send
   int dictionary_index_ = 0;
+
+  std::unique_ptr<CodecSelector> selector_;
+  std::chrono::steady_clock::time_point batch_start_;
+  int64_t batch_size_ = 0;
 };
 
 FlightDataStream::~FlightDataStream() {}
 
+void FlightDataStream::SetCodecSelector(std::unique_ptr<CodecSelector> selector) {}
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      const ipc::IpcWriteOptions& options) {
   impl_.reset(new RecordBatchStreamImpl(reader, options));
@@ -1160,5 +1430,56 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+void RecordBatchStream::SetCodecSelector(std::unique_ptr<CodecSelector> selector) {
+  impl_->SetCodecSelector(std::move(selector));
+}
+
+namespace {
+
+class GeneratorReader : public RecordBatchReader {
+ public:
+  GeneratorReader(std::shared_ptr<Schema> schema,
+                  std::function<Future<std::shared_ptr<RecordBatch>>()> generator)
+      : schema_(std::move(schema)), generator_(std::move(generator)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto result = generator_().result();
+    return std::move(result).Value(batch);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::function<Future<std::shared_ptr<RecordBatch>>()> generator_;
+};
+
+}  // namespace
+
+RecordBatchGeneratorStream::RecordBatchGeneratorStream(
+    std::shared_ptr<Schema> schema,
+    std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+    const ipc::IpcWriteOptions& options)
+    : stream_(new RecordBatchStream(
+          std::make_shared<GeneratorReader>(std::move(schema), std::move(generator)),
+          options)) {}
+
+RecordBatchGeneratorStream::~RecordBatchGeneratorStream() {}
+
+std::shared_ptr<Schema> RecordBatchGeneratorStream::schema() { return stream_->schema(); }
+
+Status RecordBatchGeneratorStream::GetSchemaPayload(FlightPayload* payload) {
+  return stream_->GetSchemaPayload(payload);
+}
+
+Status RecordBatchGeneratorStream::Next(FlightPayload* payload) {
+  return stream_->Next(payload);
+}
+
+void RecordBatchGeneratorStream::SetCodecSelector(
+    std::unique_ptr<CodecSelector> selector) {
+  stream_->SetCodecSelector(std::move(selector));
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -20,18 +20,21 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/flight/compression.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/types.h"       // IWYU pragma: keep
 #include "arrow/flight/visibility.h"  // IWYU pragma: keep
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -57,6 +60,14 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Let the given selector choose the compression codec of the
+  /// batches produced from now on.
+  ///
+  /// The server calls this before the first call to Next() when it has
+  /// agreed on compression with the client.  The default implementation
+  /// ignores the selector, leaving the stream's own IPC options in effect.
+  virtual void SetCodecSelector(std::unique_ptr<CodecSelector> selector);
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -73,12 +84,38 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::shared_ptr<Schema> schema() override;
   Status GetSchemaPayload(FlightPayload* payload) override;
   Status Next(FlightPayload* payload) override;
+  void SetCodecSelector(std::unique_ptr<CodecSelector> selector) override;
 
  private:
   class RecordBatchStreamImpl;
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream over an asynchronous generator of record
+/// batches, such as an asynchronous dataset scan.
+///
+/// The server transport is synchronous, so the call still waits for each
+/// batch on its server thread.
+class ARROW_FLIGHT_EXPORT RecordBatchGeneratorStream : public FlightDataStream {
+ public:
+  /// \param[in] schema the schema of the batches
+  /// \param[in] generator an AsyncGenerator of record batches
+  /// \param[in] options IPC options for writing
+  RecordBatchGeneratorStream(
+      std::shared_ptr<Schema> schema,
+      std::function<Future<std::shared_ptr<RecordBatch>>()> generator,
+      const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults());
+  ~RecordBatchGeneratorStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  Status GetSchemaPayload(FlightPayload* payload) override;
+  Status Next(FlightPayload* payload) override;
+  void SetCodecSelector(std::unique_ptr<CodecSelector> selector) override;
+
+ private:
+  std::unique_ptr<RecordBatchStream> stream_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -121,6 +158,24 @@ class ARROW_FLIGHT_EXPORT ServerCallContext {
   virtual ServerMiddleware* GetMiddleware(const std::string& key) const = 0;
 };
 
+/// \brief Options for sending DoGet message bodies through shared memory
+/// to clients on the same host.
+///
+/// Bodies are copied into POSIX shared memory segments, which the client
+/// maps instead of receiving the data over gRPC.  This requires the
+/// client and server to share the shared memory namespace (/dev/shm on
+/// Linux).
+struct ARROW_FLIGHT_EXPORT SharedMemoryOptions {
+  /// \brief Whether to honour requests from clients on the same host.
+  bool enabled = false;
+  /// \brief Bodies smaller than this are sent inline.
+  int64_t min_body_size = 64 * 1024;
+  /// \brief The size of the segments of a call that the client may leave
+  /// unread.  Further bodies are sent inline until the client catches up,
+  /// so that gRPC flow control applies.
+  int64_t max_unread_bytes = 256 * 1024 * 1024;
+};
+
 class ARROW_FLIGHT_EXPORT FlightServerOptions {
  public:
   explicit FlightServerOptions(const Location& location_);
@@ -154,6 +209,18 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// link to the same transport implementation as Flight to avoid
   /// runtime problems.
   std::function<void(void*)> builder_hook;
+  /// \brief The memory pool used to reassemble incoming FlightData
+  /// messages that can't be read without copying.
+  MemoryPool* memory_pool;
+  /// \brief How to compress the DoGet streams of clients accepting
+  /// compression.
+  ///
+  /// When a codec is agreed on, it overrides the IPC options of the
+  /// FlightDataStream, provided the stream supports SetCodecSelector().
+  FlightCompressionOptions compression;
+  /// \brief How to send DoGet streams to clients on the same host asking
+  /// for shared memory.  Compression is not used for those streams.
+  SharedMemoryOptions shared_memory;
 };
 
 /// \brief Skeleton RPC server implementation which can be used to create
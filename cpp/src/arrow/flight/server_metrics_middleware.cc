@@ -0,0 +1,259 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/server_metrics_middleware.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <utility>
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+constexpr char kPrefix[] = "arrow_flight_server_";
+
+const char* MethodName(FlightMethod method) {
+  switch (method) {
+    case FlightMethod::Handshake:
+      return "Handshake";
+    case FlightMethod::ListFlights:
+      return "ListFlights";
+    case FlightMethod::GetFlightInfo:
+      return "GetFlightInfo";
+    case FlightMethod::GetSchema:
+      return "GetSchema";
+    case FlightMethod::DoGet:
+      return "DoGet";
+    case FlightMethod::DoPut:
+      return "DoPut";
+    case FlightMethod::DoAction:
+      return "DoAction";
+    case FlightMethod::ListActions:
+      return "ListActions";
+    case FlightMethod::DoExchange:
+      return "DoExchange";
+    default:
+      return "Invalid";
+  }
+}
+
+FlightHistogram MakeHistogram(const std::vector<double>& upper_bounds) {
+  FlightHistogram histogram;
+  histogram.upper_bounds = upper_bounds;
+  histogram.bucket_counts.assign(upper_bounds.size() + 1, 0);
+  return histogram;
+}
+
+class ServerMetricsMiddleware : public ServerMiddleware {
+ public:
+  ServerMetricsMiddleware(std::shared_ptr<FlightServerMetrics> metrics,
+                          FlightMethod method)
+      : metrics_(std::move(metrics)), method_(method) {}
+
+  std::string name() const override { return "ServerMetricsMiddleware"; }
+
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+
+  void CallStatsCollected(const ServerCallStats& stats) override { stats_ = stats; }
+
+  void CallCompleted(const Status& status) override {
+    metrics_->Record(method_, status, stats_);
+  }
+
+ private:
+  std::shared_ptr<FlightServerMetrics> metrics_;
+  FlightMethod method_;
+  ServerCallStats stats_;
+};
+
+class ServerMetricsMiddlewareFactory : public ServerMiddlewareFactory {
+ public:
+  explicit ServerMetricsMiddlewareFactory(std::shared_ptr<FlightServerMetrics> metrics)
+      : metrics_(std::move(metrics)) {}
+
+  Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
+                   std::shared_ptr<ServerMiddleware>* middleware) override {
+    *middleware = std::make_shared<ServerMetricsMiddleware>(metrics_, info.method);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<FlightServerMetrics> metrics_;
+};
+
+// Write the metric of each method, with the given help and type lines
+void WriteMetric(std::ostream* out, const std::string& name, const char* help,
+                 const char* type,
+                 const std::map<FlightMethod, FlightMethodMetrics>& metrics,
+                 const std::function<void(const std::string& name, const char* method,
+                                          const FlightMethodMetrics&)>& write) {
+  *out << "# HELP " << name << " " << help << "\n";
+  *out << "# TYPE " << name << " " << type << "\n";
+  for (const auto& entry : metrics) {
+    write(name, MethodName(entry.first), entry.second);
+  }
+}
+
+void WriteHistogram(std::ostream* out, const std::string& name, const char* method,
+                    const FlightHistogram& histogram) {
+  int64_t cumulative = 0;
+  for (size_t i = 0; i < histogram.upper_bounds.size(); ++i) {
+    cumulative += histogram.bucket_counts[i];
+    *out << name << "_bucket{method=\"" << method << "\",le=\""
+         << histogram.upper_bounds[i] << "\"} " << cumulative << "\n";
+  }
+  *out << name << "_bucket{method=\"" << method << "\",le=\"+Inf\"} " << histogram.count
+       << "\n";
+  *out << name << "_sum{method=\"" << method << "\"} " << histogram.sum << "\n";
+  *out << name << "_count{method=\"" << method << "\"} " << histogram.count << "\n";
+}
+
+}  // namespace
+
+void FlightHistogram::Add(double value) {
+  const auto bucket = static_cast<size_t>(
+      std::lower_bound(upper_bounds.begin(), upper_bounds.end(), value) -
+      upper_bounds.begin());
+  if (bucket_counts.size() != upper_bounds.size() + 1) {
+    bucket_counts.resize(upper_bounds.size() + 1, 0);
+  }
+  ++bucket_counts[bucket];
+  ++count;
+  sum += value;
+}
+
+std::vector<double> FlightServerMetrics::DefaultBuckets() {
+  std::vector<double> bounds;
+  for (int exponent = -4; exponent < 2; ++exponent) {
+    const double decade = std::pow(10.0, exponent);
+    bounds.push_back(decade);
+    bounds.push_back(2.5 * decade);
+    bounds.push_back(5 * decade);
+  }
+  bounds.push_back(100);
+  return bounds;
+}
+
+FlightServerMetrics::FlightServerMetrics(std::vector<double> upper_bounds)
+    : upper_bounds_(std::move(upper_bounds)) {
+  std::sort(upper_bounds_.begin(), upper_bounds_.end());
+}
+
+void FlightServerMetrics::Record(FlightMethod method, const Status& status,
+                                 const ServerCallStats& stats) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = metrics_.find(method);
+  if (it == metrics_.end()) {
+    FlightMethodMetrics method_metrics;
+    method_metrics.duration = MakeHistogram(upper_bounds_);
+    method_metrics.queue_time = MakeHistogram(upper_bounds_);
+    method_metrics.serialization_time = MakeHistogram(upper_bounds_);
+    method_metrics.network_time = MakeHistogram(upper_bounds_);
+    it = metrics_.emplace(method, std::move(method_metrics)).first;
+  }
+  FlightMethodMetrics& metrics = it->second;
+  ++metrics.calls;
+  if (!status.ok()) {
+    ++metrics.failed_calls;
+  }
+  metrics.bytes_sent += stats.bytes_sent;
+  metrics.bytes_received += stats.bytes_received;
+  metrics.batches_sent += stats.batches_sent;
+  metrics.batches_received += stats.batches_received;
+  metrics.duration.Add(stats.duration_seconds);
+  metrics.queue_time.Add(stats.queue_seconds);
+  metrics.serialization_time.Add(stats.serialization_seconds);
+  metrics.network_time.Add(stats.network_seconds);
+}
+
+std::map<FlightMethod, FlightMethodMetrics> FlightServerMetrics::GetMetrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+std::string FlightServerMetrics::ToPrometheusText() const {
+  const auto metrics = GetMetrics();
+  std::ostringstream out;
+  out.imbue(std::locale::classic());
+  out.precision(std::numeric_limits<double>::digits10);
+
+  using Getter = int64_t FlightMethodMetrics::*;
+  const struct {
+    const char* name;
+    const char* help;
+    Getter getter;
+  } counters[] = {
+      {"calls_total", "Completed calls.", &FlightMethodMetrics::calls},
+      {"failed_calls_total", "Calls completed with an error.",
+       &FlightMethodMetrics::failed_calls},
+      {"sent_bytes_total", "Bytes of FlightData messages sent.",
+       &FlightMethodMetrics::bytes_sent},
+      {"received_bytes_total", "Bytes of FlightData messages received.",
+       &FlightMethodMetrics::bytes_received},
+      {"sent_batches_total", "Record batches sent.", &FlightMethodMetrics::batches_sent},
+      {"received_batches_total", "Record batches received.",
+       &FlightMethodMetrics::batches_received},
+  };
+  for (const auto& counter : counters) {
+    WriteMetric(&out, kPrefix + std::string(counter.name), counter.help, "counter",
+                metrics,
+                [&](const std::string& name, const char* method,
+                    const FlightMethodMetrics& method_metrics) {
+                  out << name << "{method=\"" << method << "\"} "
+                      << method_metrics.*counter.getter << "\n";
+                });
+  }
+
+  using HistogramGetter = FlightHistogram FlightMethodMetrics::*;
+  const struct {
+    const char* name;
+    const char* help;
+    HistogramGetter getter;
+  } histograms[] = {
+      {"call_duration_seconds", "Time from receiving a call to its completion.",
+       &FlightMethodMetrics::duration},
+      {"queue_seconds", "Time before the handler of a call was invoked.",
+       &FlightMethodMetrics::queue_time},
+      {"serialization_seconds", "Time spent encoding and decoding IPC messages.",
+       &FlightMethodMetrics::serialization_time},
+      {"network_seconds", "Time spent blocked on the gRPC stream.",
+       &FlightMethodMetrics::network_time},
+  };
+  for (const auto& histogram : histograms) {
+    WriteMetric(&out, kPrefix + std::string(histogram.name), histogram.help,
+                "histogram", metrics,
+                [&](const std::string& name, const char* method,
+                    const FlightMethodMetrics& method_metrics) {
+                  WriteHistogram(&out, name, method, method_metrics.*histogram.getter);
+                });
+  }
+  return out.str();
+}
+
+std::shared_ptr<ServerMiddlewareFactory> MakeServerMetricsMiddleware(
+    std::shared_ptr<FlightServerMetrics> metrics) {
+  return std::make_shared<ServerMetricsMiddlewareFactory>(std::move(metrics));
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Middleware aggregating the statistics of the calls of a Flight server.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/flight/server_middleware.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+
+/// \brief A histogram of values, e.g. call durations in seconds.
+struct ARROW_FLIGHT_EXPORT FlightHistogram {
+  /// \brief The upper bounds of the buckets, in increasing order.
+  std::vector<double> upper_bounds;
+  /// \brief The number of values in each bucket, not cumulative.  The
+  /// last bucket counts the values above all the bounds.
+  std::vector<int64_t> bucket_counts;
+  /// \brief The number of values.
+  int64_t count = 0;
+  /// \brief The sum of the values.
+  double sum = 0;
+
+  /// \brief Add a value to the histogram.
+  void Add(double value);
+};
+
+/// \brief Aggregated statistics of the calls to a Flight method.
+struct ARROW_FLIGHT_EXPORT FlightMethodMetrics {
+  /// \brief The number of completed calls.
+  int64_t calls = 0;
+  /// \brief The number of calls completed with an error.
+  int64_t failed_calls = 0;
+  int64_t bytes_sent = 0;
+  int64_t bytes_received = 0;
+  int64_t batches_sent = 0;
+  int64_t batches_received = 0;
+  /// \brief Per-call histograms, in seconds (see ServerCallStats).
+  FlightHistogram duration;
+  FlightHistogram queue_time;
+  FlightHistogram serialization_time;
+  FlightHistogram network_time;
+};
+
+/// \brief Thread-safe metrics of the calls of a Flight server.
+///
+/// Add the factory returned by MakeServerMetricsMiddleware() to the
+/// server options for the calls to be recorded, and pull the metrics
+/// with GetMetrics() or ToPrometheusText().  A call reading or writing
+/// data is slow because of IPC encoding when its serialization time
+/// dominates, and because of the network (or a slow peer) when its
+/// network time does.
+class ARROW_FLIGHT_EXPORT FlightServerMetrics {
+ public:
+  /// \brief Buckets from 100 microseconds to 100 seconds.
+  static std::vector<double> DefaultBuckets();
+
+  /// \param[in] upper_bounds the bounds of the buckets of the histograms,
+  /// in increasing order
+  explicit FlightServerMetrics(std::vector<double> upper_bounds = DefaultBuckets());
+
+  /// \brief Record a completed call.
+  void Record(FlightMethod method, const Status& status, const ServerCallStats& stats);
+
+  /// \brief Return the metrics of the methods called so far.
+  std::map<FlightMethod, FlightMethodMetrics> GetMetrics() const;
+
+  /// \brief Return the metrics in the Prometheus text exposition format.
+  ///
+  /// Metrics are prefixed with "arrow_flight_server_" and labelled with
+  /// the method name.
+  std::string ToPrometheusText() const;
+
+ private:
+  std::vector<double> upper_bounds_;
+  mutable std::mutex mutex_;
+  std::map<FlightMethod, FlightMethodMetrics> metrics_;
+};
+
+/// \brief Return a ServerMiddlewareFactory recording the calls in the
+/// given metrics.
+ARROW_FLIGHT_EXPORT std::shared_ptr<ServerMiddlewareFactory> MakeServerMetricsMiddleware(
+    std::shared_ptr<FlightServerMetrics> metrics);
+
+}  // namespace flight
+}  // namespace arrow
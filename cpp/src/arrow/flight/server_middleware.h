@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -30,6 +31,31 @@
 namespace arrow {
 namespace flight {
 
+/// \brief Statistics about a call, collected by the server.
+///
+/// Times are wall-clock times measured on the thread running the call.
+struct ARROW_FLIGHT_EXPORT ServerCallStats {
+  /// \brief Bytes of FlightData messages written to the gRPC stream.
+  int64_t bytes_sent = 0;
+  /// \brief Bytes of FlightData messages read from the gRPC stream.
+  int64_t bytes_received = 0;
+  /// \brief Record batches sent.
+  int64_t batches_sent = 0;
+  /// \brief Record batches received and decoded.
+  int64_t batches_received = 0;
+  /// \brief Seconds from the server receiving the call to its completion.
+  double duration_seconds = 0;
+  /// \brief Seconds before the handler was invoked, i.e. spent
+  /// authenticating the call and starting middleware.
+  double queue_seconds = 0;
+  /// \brief Seconds spent producing and encoding the IPC messages sent,
+  /// and decoding those received.
+  double serialization_seconds = 0;
+  /// \brief Seconds spent blocked reading from or writing to the gRPC
+  /// stream, including waiting on flow control.
+  double network_seconds = 0;
+};
+
 /// \brief Server-side middleware for a call, instantiated per RPC.
 ///
 /// Middleware should be fast and must be infallible: there is no way
@@ -48,6 +74,10 @@ class ARROW_FLIGHT_EXPORT ServerMiddleware {
 
   /// \brief A callback after the call has completed.
   virtual void CallCompleted(const Status& status) = 0;
+
+  /// \brief A callback with the statistics of the call, right before
+  /// CallCompleted().  Does nothing by default.
+  virtual void CallStatsCollected(const ServerCallStats& stats) {}
 };
 
 /// \brief A factory for new middleware instances.
@@ -0,0 +1,281 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/flight/serialization_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+namespace {
+
+// The command of the descriptor naming a segment is the tag followed by
+// the segment name
+constexpr char kSegmentTag[] = "ARWSHM1:";
+constexpr size_t kSegmentTagLength = sizeof(kSegmentTag) - 1;
+// Clients only open segments with this prefix
+constexpr char kSegmentPrefix[] = "/arrow-flight-";
+
+std::atomic<int64_t> shared_memory_bytes_read{0};
+
+#ifndef _WIN32
+// Whether the segment still exists, i.e. the client hasn't unlinked it
+bool SegmentExists(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  return true;
+}
+
+// Create a segment and copy the body into it, padding each buffer to a
+// multiple of 8 bytes as when sent inline
+Status WriteSegment(const std::string& name, const ipc::IpcPayload& payload,
+                    int64_t size) {
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return arrow::internal::IOErrorFromErrno(errno, "Cannot create shared memory '",
+                                             name, "'");
+  }
+  void* data = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+    data = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0);
+  }
+  if (data == MAP_FAILED) {
+    const int errnum = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    return arrow::internal::IOErrorFromErrno(errnum, "Cannot map shared memory '", name,
+                                             "'");
+  }
+  close(fd);
+  auto out = reinterpret_cast<uint8_t*>(data);
+  for (const auto& buffer : payload.body_buffers) {
+    if (!buffer) continue;
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    const int64_t padded = BitUtil::RoundUpToMultipleOf8(buffer->size());
+    std::memset(out + buffer->size(), 0, static_cast<size_t>(padded - buffer->size()));
+    out += padded;
+  }
+  munmap(data, static_cast<size_t>(size));
+  return Status::OK();
+}
+
+// A buffer referencing a mapped segment
+class SharedMemoryBuffer : public Buffer {
+ public:
+  SharedMemoryBuffer(void* data, int64_t size)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size) {}
+
+  ~SharedMemoryBuffer() override {
+    munmap(const_cast<uint8_t*>(data_), static_cast<size_t>(size_));
+  }
+};
+#endif
+
+}  // namespace
+
+#ifdef _WIN32
+bool SharedMemorySupported() { return false; }
+#else
+bool SharedMemorySupported() { return true; }
+#endif
+
+bool IsLocalPeer(const std::string& peer) {
+  for (const char* prefix : {"unix:", "ipv4:127.", "ipv6:[::1]", "ipv6:%5B::1%5D"}) {
+    if (peer.compare(0, std::strlen(prefix), prefix) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int64_t SharedMemoryBytesRead() { return shared_memory_bytes_read.load(); }
+
+//
+// SharedMemoryRegistry
+
+SharedMemoryRegistry::SharedMemoryRegistry() {
+#ifndef _WIN32
+  prefix_ = kSegmentPrefix + std::to_string(getpid()) + "-";
+#endif
+}
+
+SharedMemoryRegistry::~SharedMemoryRegistry() {
+#ifndef _WIN32
+  for (const auto& name : names_) {
+    shm_unlink(name.c_str());
+  }
+#endif
+}
+
+std::string SharedMemoryRegistry::NewName() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return prefix_ + std::to_string(counter_++);
+}
+
+void SharedMemoryRegistry::Add(std::vector<std::string> names) {
+#ifndef _WIN32
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Forget the segments unlinked by clients since, so that the list
+  // doesn't grow with the number of calls
+  std::vector<std::string> remaining;
+  for (auto& name : names_) {
+    if (SegmentExists(name)) {
+      remaining.push_back(std::move(name));
+    }
+  }
+  for (auto& name : names) {
+    remaining.push_back(std::move(name));
+  }
+  names_ = std::move(remaining);
+#endif
+}
+
+//
+// SharedMemoryBodyWriter
+
+SharedMemoryBodyWriter::SharedMemoryBodyWriter(const SharedMemoryOptions& options,
+                                               SharedMemoryRegistry* registry)
+    : options_(options), registry_(registry) {}
+
+SharedMemoryBodyWriter::~SharedMemoryBodyWriter() {
+  if (unread_.empty()) {
+    return;
+  }
+  std::vector<std::string> names;
+  for (auto& segment : unread_) {
+    names.push_back(std::move(segment.first));
+  }
+  registry_->Add(std::move(names));
+}
+
+void SharedMemoryBodyWriter::Process(FlightPayload* payload) {
+#ifndef _WIN32
+  int64_t size = 0;
+  for (const auto& buffer : payload->ipc_message.body_buffers) {
+    if (buffer) {
+      size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+    }
+  }
+  if (size == 0 || size < options_.min_body_size) {
+    return;
+  }
+  // The client unlinks the segments as it reads them
+  while (!unread_.empty() && !SegmentExists(unread_.front().first)) {
+    unread_bytes_ -= unread_.front().second;
+    unread_.pop_front();
+  }
+  if (unread_bytes_ + size > options_.max_unread_bytes) {
+    return;
+  }
+
+  std::string name = registry_->NewName();
+  if (!WriteSegment(name, payload->ipc_message, size).ok()) {
+    // Send the body inline instead
+    return;
+  }
+  std::string descriptor;
+  if (!FlightDescriptor::Command(kSegmentTag + name)
+           .SerializeToString(&descriptor)
+           .ok()) {
+    shm_unlink(name.c_str());
+    return;
+  }
+  payload->descriptor = Buffer::FromString(std::move(descriptor));
+  payload->ipc_message.body_buffers.clear();
+  unread_.emplace_back(std::move(name), size);
+  unread_bytes_ += size;
+#endif
+}
+
+void SharedMemoryBodyWriter::Abort() {
+#ifndef _WIN32
+  for (const auto& segment : unread_) {
+    shm_unlink(segment.first.c_str());
+  }
+#endif
+  unread_.clear();
+  unread_bytes_ = 0;
+}
+
+//
+// Client side
+
+Status MapSharedMemoryBody(FlightData* data) {
+  if (!data->allow_shared_memory || data->descriptor == nullptr ||
+      data->descriptor->type != FlightDescriptor::CMD ||
+      data->descriptor->cmd.compare(0, kSegmentTagLength, kSegmentTag) != 0) {
+    return Status::OK();
+  }
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory bodies are not supported on Windows");
+#else
+  const std::string name = data->descriptor->cmd.substr(kSegmentTagLength);
+  if (name.compare(0, sizeof(kSegmentPrefix) - 1, kSegmentPrefix) != 0 ||
+      name.find('/', 1) != std::string::npos) {
+    return Status::IOError("Invalid shared memory segment name '", name, "'");
+  }
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return arrow::internal::IOErrorFromErrno(errno, "Cannot open shared memory '", name,
+                                             "'");
+  }
+  // The segment stays alive as long as it is mapped
+  shm_unlink(name.c_str());
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return Status::IOError("Invalid shared memory segment '", name, "'");
+  }
+  void* mapped =
+      mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  const int errnum = errno;
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return arrow::internal::IOErrorFromErrno(errnum, "Cannot map shared memory '", name,
+                                             "'");
+  }
+  data->body = std::make_shared<SharedMemoryBuffer>(mapped, st.st_size);
+  data->descriptor = nullptr;
+  shared_memory_bytes_read += st.st_size;
+  return Status::OK();
+#endif
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
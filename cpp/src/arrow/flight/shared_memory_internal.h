@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Transfer of DoGet message bodies through shared memory, between a client
+// and a server on the same host.
+//
+// A client asks for it with the kGrpcSharedMemoryHeader header.  The server
+// then copies large message bodies into POSIX shared memory segments, and
+// sends the messages with an empty body, naming the segment in the
+// flight_descriptor field (otherwise unused in DoGet responses).  The client
+// maps the segment, so that the batches read reference it directly, and
+// unlinks it.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/flight/server.h"
+#include "arrow/flight/types.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+struct FlightData;
+
+/// Whether shared memory segments are supported on this platform
+bool SharedMemorySupported();
+
+/// The number of body bytes mapped from shared memory by clients
+int64_t SharedMemoryBytesRead();
+
+/// Whether a gRPC peer address (e.g. "ipv4:127.0.0.1:1234") is on this host
+bool IsLocalPeer(const std::string& peer);
+
+/// The segments created by a server that clients haven't unlinked yet
+/// when their call ended, as clients may not have read them.  They are
+/// unlinked when the registry is destroyed.
+class SharedMemoryRegistry {
+ public:
+  SharedMemoryRegistry();
+  ~SharedMemoryRegistry();
+
+  /// Return a new segment name
+  std::string NewName();
+
+  /// Keep track of segments not unlinked yet
+  void Add(std::vector<std::string> names);
+
+ private:
+  std::mutex mutex_;
+  std::string prefix_;
+  int64_t counter_ = 0;
+  std::vector<std::string> names_;
+};
+
+/// Moves the message bodies of a DoGet call to shared memory
+class SharedMemoryBodyWriter {
+ public:
+  SharedMemoryBodyWriter(const SharedMemoryOptions& options,
+                         SharedMemoryRegistry* registry);
+  /// Hand the segments not unlinked yet over to the registry
+  ~SharedMemoryBodyWriter();
+
+  /// Move the body of the payload to a segment, unless it is small or the
+  /// client has too much left to read.  Bodies are sent inline if a
+  /// segment can't be created, e.g. because /dev/shm is full.
+  void Process(FlightPayload* payload);
+
+  /// Unlink the segments not unlinked yet, when the call failed
+  void Abort();
+
+ private:
+  SharedMemoryOptions options_;
+  SharedMemoryRegistry* registry_;
+  // The segments sent, oldest first, with their size
+  std::deque<std::pair<std::string, int64_t>> unread_;
+  int64_t unread_bytes_ = 0;
+};
+
+/// If the message names a shared memory segment and the stream allows it,
+/// map the segment as the body of the message
+Status MapSharedMemoryBody(FlightData* data);
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
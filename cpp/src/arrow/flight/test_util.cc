@@ -103,13 +103,15 @@ void TestServer::Start() {
   }
 
   try {
+    std::vector<std::string> args;
     if (unix_sock_.empty()) {
-      server_process_ = std::make_shared<bp::child>(
-          bp::search_path(executable_name_, search_path), "-port", str_port);
+      args = {"-port", str_port};
     } else {
-      server_process_ = std::make_shared<bp::child>(
-          bp::search_path(executable_name_, search_path), "-server_unix", unix_sock_);
+      args = {"-server_unix", unix_sock_};
     }
+    args.insert(args.end(), extra_args_.begin(), extra_args_.end());
+    server_process_ = std::make_shared<bp::child>(
+        bp::search_path(executable_name_, search_path), bp::args(args));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
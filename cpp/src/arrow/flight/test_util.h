@@ -51,10 +51,17 @@ class ARROW_FLIGHT_EXPORT TestServer {
  public:
   explicit TestServer(const std::string& executable_name)
       : executable_name_(executable_name), port_(::arrow::GetListenPort()) {}
-  TestServer(const std::string& executable_name, int port)
-      : executable_name_(executable_name), port_(port) {}
-  TestServer(const std::string& executable_name, const std::string& unix_sock)
-      : executable_name_(executable_name), unix_sock_(unix_sock) {}
+  /// \param[in] extra_args additional command-line arguments for the server
+  TestServer(const std::string& executable_name, int port,
+             std::vector<std::string> extra_args = {})
+      : executable_name_(executable_name),
+        port_(port),
+        extra_args_(std::move(extra_args)) {}
+  TestServer(const std::string& executable_name, const std::string& unix_sock,
+             std::vector<std::string> extra_args = {})
+      : executable_name_(executable_name),
+        unix_sock_(unix_sock),
+        extra_args_(std::move(extra_args)) {}
 
   void Start();
 
@@ -69,6 +76,7 @@ class ARROW_FLIGHT_EXPORT TestServer {
   std::string executable_name_;
   int port_;
   std::string unix_sock_;
+  std::vector<std::string> extra_args_;
   std::shared_ptr<::boost::process::child> server_process_;
 };
 
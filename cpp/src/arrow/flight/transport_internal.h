@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Transport-agnostic interfaces for the Flight data plane.
+//
+// The data-carrying RPCs (DoGet, DoPut and DoExchange) are implemented
+// on top of these interfaces rather than directly on gRPC streams, so
+// that FlightData messages can be carried by another transport while
+// gRPC remains responsible for the control plane (call dispatch,
+// authentication, middleware and the other RPCs).
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/flight/types.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+namespace internal {
+
+struct FlightData;
+
+/// \brief The client side of a FlightData stream.
+///
+/// Read and write methods return false if the stream has ended or
+/// failed; Finish() then returns the reason.  A given stream only
+/// supports the operations of its RPC, e.g. a DoGet stream cannot be
+/// written to.
+class ClientDataStream {
+ public:
+  virtual ~ClientDataStream() = default;
+
+  /// \brief Read the next FlightData message (DoGet, DoExchange).
+  virtual bool ReadData(FlightData* data) = 0;
+
+  /// \brief Read the next application metadata message (DoPut).
+  virtual bool ReadPutMetadata(std::shared_ptr<Buffer>* out) = 0;
+
+  /// \brief Write a FlightData message (DoPut, DoExchange).
+  virtual bool WriteData(const FlightPayload& payload) = 0;
+
+  /// \brief Indicate that no more messages will be written.
+  virtual bool WritesDone() = 0;
+
+  /// \brief End the call, adding the server-side status to the given one.
+  ///
+  /// Unread messages are discarded.  Must be idempotent.
+  virtual Status Finish(Status st) = 0;
+
+  /// \brief Attempt to cancel the call.
+  virtual void TryCancel() = 0;
+};
+
+/// \brief The server side of a FlightData stream.
+///
+/// As on the client side, methods return false if the stream has ended
+/// or failed, and only the operations of the current RPC are supported.
+class ServerDataStream {
+ public:
+  virtual ~ServerDataStream() = default;
+
+  /// \brief Read the next FlightData message (DoPut, DoExchange).
+  virtual bool ReadData(FlightData* data) = 0;
+
+  /// \brief Write a FlightData message (DoGet, DoExchange).
+  virtual bool WriteData(const FlightPayload& payload) = 0;
+
+  /// \brief Write an application metadata message (DoPut).
+  virtual bool WritePutMetadata(const Buffer& metadata) = 0;
+};
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -343,6 +343,21 @@ struct ARROW_FLIGHT_EXPORT FlightPayload {
   ipc::IpcPayload ipc_message;
 };
 
+/// \brief Process-wide counters of FlightData bytes received
+struct ARROW_FLIGHT_EXPORT FlightDataReadStats {
+  /// Bytes handed to readers without copying out of the gRPC buffers
+  int64_t zero_copy_bytes = 0;
+  /// Bytes that had to be copied, e.g. to reassemble a message that
+  /// arrived in several slices
+  int64_t copied_bytes = 0;
+  /// Bytes of message bodies mapped from shared memory
+  int64_t shared_memory_bytes = 0;
+};
+
+/// \brief Return the FlightData read counters for this process
+ARROW_FLIGHT_EXPORT
+FlightDataReadStats GetFlightDataReadStats();
+
 /// \brief Schema result returned after a schema request RPC
 struct ARROW_FLIGHT_EXPORT SchemaResult {
  public:
@@ -25,15 +25,18 @@
 #include "arrow/buffer.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/visibility.h"
 
 #include "generated/Message_generated.h"
 
 #include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_file.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
@@ -65,5 +68,52 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                               ipc::IpcReadOptions::Defaults());
 }
 
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
+    const std::shared_ptr<Schema>& schema, const ipc::DictionaryMemo* dictionary_memo,
+    CudaFileReader* file, int64_t offset, MemoryPool* pool) {
+  // Read the (optional) continuation token and the metadata length on the host
+  int32_t prefix[2];
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, file->ReadAt(offset, sizeof(prefix), prefix));
+  if (bytes_read < static_cast<int64_t>(sizeof(int32_t))) {
+    return Status::Invalid("Expected to read a message length at offset ", offset);
+  }
+  int64_t prefix_size = sizeof(int32_t);
+  int32_t metadata_length = BitUtil::FromLittleEndian(prefix[0]);
+  if (metadata_length == ipc::internal::kIpcContinuationToken) {
+    if (bytes_read < static_cast<int64_t>(sizeof(prefix))) {
+      return Status::Invalid("Expected to read a message length at offset ", offset);
+    }
+    prefix_size = sizeof(prefix);
+    metadata_length = BitUtil::FromLittleEndian(prefix[1]);
+  }
+  if (metadata_length <= 0) {
+    return Status::Invalid("End of stream (message has length 0)");
+  }
+
+  // The pool is only used for metadata allocation
+  ARROW_ASSIGN_OR_RAISE(auto metadata, AllocateBuffer(metadata_length, pool));
+  ARROW_ASSIGN_OR_RAISE(bytes_read, file->ReadAt(offset + prefix_size, metadata_length,
+                                                 metadata->mutable_data()));
+  if (bytes_read != metadata_length) {
+    return Status::Invalid("Expected to read ", metadata_length,
+                           " metadata bytes but got ", bytes_read);
+  }
+  std::shared_ptr<Buffer> shared_metadata = std::move(metadata);
+  ARROW_ASSIGN_OR_RAISE(auto header, ipc::Message::Open(shared_metadata, nullptr));
+
+  // DMA read of the body into device memory
+  const int64_t body_length = header->body_length();
+  ARROW_ASSIGN_OR_RAISE(
+      auto body, file->ReadAt(offset + prefix_size + metadata_length, body_length));
+  if (body->size() != body_length) {
+    return Status::Invalid("Expected to read ", body_length, " body bytes but got ",
+                           body->size());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto message,
+                        ipc::Message::Open(std::move(shared_metadata), std::move(body)));
+  return ipc::ReadRecordBatch(*message, schema, dictionary_memo,
+                              ipc::IpcReadOptions::Defaults());
+}
+
 }  // namespace cuda
 }  // namespace arrow
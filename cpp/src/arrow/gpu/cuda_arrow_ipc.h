@@ -24,6 +24,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
+#include "arrow/gpu/cuda_file.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
@@ -66,6 +67,24 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const std::shared_ptr<Schema>& schema, const ipc::DictionaryMemo* dictionary_memo,
     const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool = default_memory_pool());
 
+/// \brief Read a record batch message from a file directly into device memory
+///
+/// The message metadata is read into host memory, the message body is DMA-read
+/// from storage into device memory with GPUDirect Storage.
+/// \param[in] schema the Schema for the record batch
+/// \param[in] dictionary_memo DictionaryMemo which has any
+/// dictionaries. Can be nullptr if you are sure there are no
+/// dictionary-encoded fields
+/// \param[in] file the CudaFileReader to read from
+/// \param[in] offset the file offset of the IPC message (e.g. the offset of a
+/// ipc::RecordBatchFileReader block)
+/// \param[in] pool a MemoryPool to use for allocating space for the metadata
+/// \return RecordBatch or Status
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
+    const std::shared_ptr<Schema>& schema, const ipc::DictionaryMemo* dictionary_memo,
+    CudaFileReader* file, int64_t offset, MemoryPool* pool = default_memory_pool());
+
 /// @}
 
 }  // namespace cuda
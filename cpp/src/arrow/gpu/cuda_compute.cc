@@ -0,0 +1,964 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace cuda {
+
+using compute::ExecBatch;
+using compute::FunctionDoc;
+using compute::InputType;
+using compute::KernelContext;
+using compute::KernelInitArgs;
+using compute::KernelState;
+using compute::OutputType;
+using internal::ContextSaver;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Device code, compiled at runtime with NVRTC
+
+const char kKernelSource[] = R"(
+#define ARROW_CUDA_GRID_STRIDE_LOOP(i, n)                                      \
+  for (long long i = blockIdx.x * (long long)blockDim.x + threadIdx.x; i < (n); \
+       i += (long long)blockDim.x * gridDim.x)
+
+#define ARROW_CUDA_ADD(a, b) ((a) + (b))
+#define ARROW_CUDA_MIN(a, b) ((b) < (a) ? (b) : (a))
+#define ARROW_CUDA_MAX(a, b) ((a) < (b) ? (b) : (a))
+
+__device__ __forceinline__ bool GetBit(const unsigned char* bits, long long i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+__device__ __forceinline__ void AtomicAdd(long long* address, long long value) {
+  atomicAdd(reinterpret_cast<unsigned long long*>(address),
+            static_cast<unsigned long long>(value));
+}
+
+__device__ __forceinline__ void AtomicAdd(unsigned long long* address,
+                                          unsigned long long value) {
+  atomicAdd(address, value);
+}
+
+__device__ __forceinline__ void AtomicAdd(double* address, double value) {
+#if __CUDA_ARCH__ >= 600
+  atomicAdd(address, value);
+#else
+  unsigned long long* raw = reinterpret_cast<unsigned long long*>(address);
+  unsigned long long old = *raw, assumed;
+  do {
+    assumed = old;
+    old = atomicCAS(raw, assumed,
+                    __double_as_longlong(value + __longlong_as_double(assumed)));
+  } while (assumed != old);
+#endif
+}
+
+// Filtering is done one tile of blockDim.x elements per block: filter_count counts
+// the selected elements of each tile, the host scans the counts into the output
+// offsets of the tiles, then filter_<byte width> compacts each tile.
+
+extern "C" __global__ void filter_count(const unsigned char* selection,
+                                        long long selection_offset, long long length,
+                                        int* tile_counts) {
+  long long i = blockIdx.x * (long long)blockDim.x + threadIdx.x;
+  int selected = i < length && GetBit(selection, selection_offset + i);
+  int count = __syncthreads_count(selected);
+  if (threadIdx.x == 0) tile_counts[blockIdx.x] = count;
+}
+
+#define ARROW_CUDA_FILTER(NAME, T)                                                   \
+  extern "C" __global__ void NAME(const T* values, long long values_offset,          \
+                                  const unsigned char* selection,                    \
+                                  long long selection_offset, long long length,      \
+                                  const long long* tile_offsets, T* out) {           \
+    __shared__ int warp_offsets[32];                                                 \
+    long long i = blockIdx.x * (long long)blockDim.x + threadIdx.x;                  \
+    bool selected = i < length && GetBit(selection, selection_offset + i);           \
+    unsigned int ballot = __ballot_sync(0xffffffff, selected);                       \
+    int lane = threadIdx.x & 31, warp = threadIdx.x >> 5;                            \
+    if (lane == 0) warp_offsets[warp] = __popc(ballot);                              \
+    __syncthreads();                                                                 \
+    if (threadIdx.x == 0) {                                                          \
+      int total = 0;                                                                 \
+      for (int w = 0; w < (blockDim.x >> 5); ++w) {                                  \
+        int count = warp_offsets[w];                                                 \
+        warp_offsets[w] = total;                                                     \
+        total += count;                                                              \
+      }                                                                              \
+    }                                                                                \
+    __syncthreads();                                                                 \
+    if (selected) {                                                                  \
+      int position = warp_offsets[warp] + __popc(ballot & ((1u << lane) - 1));       \
+      out[tile_offsets[blockIdx.x] + position] = values[values_offset + i];          \
+    }                                                                                \
+  }
+
+ARROW_CUDA_FILTER(filter_1, unsigned char)
+ARROW_CUDA_FILTER(filter_2, unsigned short)
+ARROW_CUDA_FILTER(filter_4, unsigned int)
+ARROW_CUDA_FILTER(filter_8, unsigned long long)
+
+#define ARROW_CUDA_TAKE(NAME, T, I)                                                  \
+  extern "C" __global__ void NAME(const T* values, long long values_offset,          \
+                                  long long values_length, const I* indices,         \
+                                  long long indices_offset, long long length, T* out, \
+                                  int* out_of_bounds) {                              \
+    ARROW_CUDA_GRID_STRIDE_LOOP(i, length) {                                         \
+      long long index = (long long)indices[indices_offset + i];                      \
+      if (index < 0 || index >= values_length) {                                     \
+        *out_of_bounds = 1;                                                          \
+        out[i] = 0;                                                                  \
+      } else {                                                                       \
+        out[i] = values[values_offset + index];                                      \
+      }                                                                              \
+    }                                                                                \
+  }
+
+#define ARROW_CUDA_TAKE_INDICES(WIDTH, T)                  \
+  ARROW_CUDA_TAKE(take_##WIDTH##_int8, T, signed char)     \
+  ARROW_CUDA_TAKE(take_##WIDTH##_uint8, T, unsigned char)  \
+  ARROW_CUDA_TAKE(take_##WIDTH##_int16, T, short)          \
+  ARROW_CUDA_TAKE(take_##WIDTH##_uint16, T, unsigned short) \
+  ARROW_CUDA_TAKE(take_##WIDTH##_int32, T, int)            \
+  ARROW_CUDA_TAKE(take_##WIDTH##_uint32, T, unsigned int)  \
+  ARROW_CUDA_TAKE(take_##WIDTH##_int64, T, long long)      \
+  ARROW_CUDA_TAKE(take_##WIDTH##_uint64, T, unsigned long long)
+
+ARROW_CUDA_TAKE_INDICES(1, unsigned char)
+ARROW_CUDA_TAKE_INDICES(2, unsigned short)
+ARROW_CUDA_TAKE_INDICES(4, unsigned int)
+ARROW_CUDA_TAKE_INDICES(8, unsigned long long)
+
+// Reductions write one partial result per block, combined on the host.
+// blockDim.x must be 256.
+
+#define ARROW_CUDA_REDUCE(NAME, T, ACC, OP)                                           \
+  extern "C" __global__ void NAME(const T* values, long long offset, long long length, \
+                                  ACC init, ACC* partials) {                          \
+    __shared__ ACC shared[256];                                                       \
+    ACC acc = init;                                                                   \
+    ARROW_CUDA_GRID_STRIDE_LOOP(i, length) { acc = OP(acc, (ACC)values[offset + i]); } \
+    shared[threadIdx.x] = acc;                                                        \
+    __syncthreads();                                                                  \
+    for (int s = blockDim.x / 2; s > 0; s >>= 1) {                                    \
+      if (threadIdx.x < s) {                                                          \
+        shared[threadIdx.x] = OP(shared[threadIdx.x], shared[threadIdx.x + s]);       \
+      }                                                                               \
+      __syncthreads();                                                                \
+    }                                                                                 \
+    if (threadIdx.x == 0) partials[blockIdx.x] = shared[0];                           \
+  }
+
+#define ARROW_CUDA_HASH_SUM(NAME, T, ACC)                                            \
+  extern "C" __global__ void NAME(const T* values, long long offset,                 \
+                                  const unsigned int* group_ids,                     \
+                                  long long group_ids_offset, long long length,      \
+                                  ACC* sums) {                                       \
+    ARROW_CUDA_GRID_STRIDE_LOOP(i, length) {                                         \
+      AtomicAdd(&sums[group_ids[group_ids_offset + i]], (ACC)values[offset + i]);    \
+    }                                                                                \
+  }
+
+#define ARROW_CUDA_AGGREGATES(NAME, T, SUM_ACC, MIN, MAX) \
+  ARROW_CUDA_REDUCE(sum_##NAME, T, SUM_ACC, ARROW_CUDA_ADD) \
+  ARROW_CUDA_REDUCE(min_##NAME, T, T, MIN)                \
+  ARROW_CUDA_REDUCE(max_##NAME, T, T, MAX)                \
+  ARROW_CUDA_HASH_SUM(hash_sum_##NAME, T, SUM_ACC)
+
+ARROW_CUDA_AGGREGATES(int8, signed char, long long, ARROW_CUDA_MIN, ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(uint8, unsigned char, unsigned long long, ARROW_CUDA_MIN,
+                      ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(int16, short, long long, ARROW_CUDA_MIN, ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(uint16, unsigned short, unsigned long long, ARROW_CUDA_MIN,
+                      ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(int32, int, long long, ARROW_CUDA_MIN, ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(uint32, unsigned int, unsigned long long, ARROW_CUDA_MIN,
+                      ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(int64, long long, long long, ARROW_CUDA_MIN, ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(uint64, unsigned long long, unsigned long long, ARROW_CUDA_MIN,
+                      ARROW_CUDA_MAX)
+ARROW_CUDA_AGGREGATES(float, float, double, fminf, fmaxf)
+ARROW_CUDA_AGGREGATES(double, double, double, fmin, fmax)
+
+#define ARROW_CUDA_MERGE_SUMS(NAME, ACC)                                             \
+  extern "C" __global__ void NAME(const ACC* other_sums, const unsigned int* mapping, \
+                                  long long length, ACC* sums) {                     \
+    ARROW_CUDA_GRID_STRIDE_LOOP(i, length) {                                         \
+      AtomicAdd(&sums[mapping[i]], other_sums[i]);                                   \
+    }                                                                                \
+  }
+
+ARROW_CUDA_MERGE_SUMS(merge_sums_int64, long long)
+ARROW_CUDA_MERGE_SUMS(merge_sums_uint64, unsigned long long)
+ARROW_CUDA_MERGE_SUMS(merge_sums_double, double)
+)";
+
+constexpr int64_t kBlockSize = 256;
+// Upper bound of the grid size of the grid-stride kernels
+constexpr int64_t kMaxBlocks = 4096;
+// Grid size of the reductions, also the number of partial results
+constexpr int64_t kReduceBlocks = 256;
+
+#define NVRTC_RETURN_NOT_OK(FUNC_NAME, STMT)                                  \
+  do {                                                                        \
+    nvrtcResult __res = (STMT);                                               \
+    if (__res != NVRTC_SUCCESS) {                                             \
+      return Status::IOError("NVRTC error in function '", FUNC_NAME,          \
+                             "': ", nvrtcGetErrorString(__res));              \
+    }                                                                         \
+  } while (0)
+
+struct ProgramGuard {
+  ~ProgramGuard() {
+    if (program != nullptr) {
+      nvrtcDestroyProgram(&program);
+    }
+  }
+  nvrtcProgram program = nullptr;
+};
+
+Result<std::string> CompileKernels(int compute_capability) {
+  ProgramGuard guard;
+  NVRTC_RETURN_NOT_OK("nvrtcCreateProgram",
+                      nvrtcCreateProgram(&guard.program, kKernelSource,
+                                         "arrow_cuda_compute.cu", 0, nullptr, nullptr));
+
+  const std::string arch =
+      "--gpu-architecture=compute_" + std::to_string(compute_capability);
+  const char* options[] = {arch.c_str(), "--std=c++11"};
+  if (nvrtcCompileProgram(guard.program, 2, options) != NVRTC_SUCCESS) {
+    size_t log_size;
+    NVRTC_RETURN_NOT_OK("nvrtcGetProgramLogSize",
+                        nvrtcGetProgramLogSize(guard.program, &log_size));
+    std::string log(log_size, '\0');
+    NVRTC_RETURN_NOT_OK("nvrtcGetProgramLog", nvrtcGetProgramLog(guard.program, &log[0]));
+    return Status::IOError("Failed to compile the CUDA compute kernels for ", arch,
+                           ":\n", log);
+  }
+
+  size_t ptx_size;
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTXSize", nvrtcGetPTXSize(guard.program, &ptx_size));
+  std::string ptx(ptx_size, '\0');
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTX", nvrtcGetPTX(guard.program, &ptx[0]));
+  return ptx;
+}
+
+/// The compiled kernels, loaded in a given context
+class KernelModule {
+ public:
+  KernelModule(std::shared_ptr<CudaContext> context, CUmodule module)
+      : context_(std::move(context)), module_(module) {}
+
+  Result<CUfunction> GetFunction(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = functions_.find(name);
+    if (it != functions_.end()) {
+      return it->second;
+    }
+    ContextSaver set_temporary(*context_);
+    CUfunction function;
+    CU_RETURN_NOT_OK("cuModuleGetFunction",
+                     cuModuleGetFunction(&function, module_, name.c_str()));
+    functions_.emplace(name, function);
+    return function;
+  }
+
+ private:
+  // Keeps the context, hence the module, alive for the lifetime of the process
+  std::shared_ptr<CudaContext> context_;
+  CUmodule module_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, CUfunction> functions_;
+};
+
+Result<KernelModule*> GetKernelModule(const std::shared_ptr<CudaContext>& context) {
+  static std::mutex mutex;
+  static std::unordered_map<void*, std::unique_ptr<KernelModule>> modules;
+  static std::unordered_map<int, std::string> ptx_cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = modules.find(context->handle());
+  if (it != modules.end()) {
+    return it->second.get();
+  }
+
+  ContextSaver set_temporary(*context);
+  CUdevice device;
+  int major, minor;
+  CU_RETURN_NOT_OK("cuCtxGetDevice", cuCtxGetDevice(&device));
+  CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                   cuDeviceGetAttribute(
+                       &major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, device));
+  CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                   cuDeviceGetAttribute(
+                       &minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device));
+  const int compute_capability = major * 10 + minor;
+
+  auto ptx_it = ptx_cache.find(compute_capability);
+  if (ptx_it == ptx_cache.end()) {
+    ARROW_ASSIGN_OR_RAISE(auto ptx, CompileKernels(compute_capability));
+    ptx_it = ptx_cache.emplace(compute_capability, std::move(ptx)).first;
+  }
+
+  CUmodule module;
+  CU_RETURN_NOT_OK("cuModuleLoadData", cuModuleLoadData(&module, ptx_it->second.data()));
+  auto kernel_module = ::arrow::internal::make_unique<KernelModule>(context, module);
+  auto out = kernel_module.get();
+  modules.emplace(context->handle(), std::move(kernel_module));
+  return out;
+}
+
+/// Launch a kernel with kBlockSize threads per block on the default stream. The
+/// caller must have made the context current.
+Status Launch(CUfunction function, int64_t num_blocks, std::vector<void*> args) {
+  CU_RETURN_NOT_OK("cuLaunchKernel",
+                   cuLaunchKernel(function, static_cast<unsigned int>(num_blocks), 1, 1,
+                                  static_cast<unsigned int>(kBlockSize), 1, 1,
+                                  /*sharedMemBytes=*/0, /*hStream=*/nullptr, args.data(),
+                                  /*extra=*/nullptr));
+  return Status::OK();
+}
+
+int64_t GridStrideBlocks(int64_t length) {
+  return std::min(BitUtil::CeilDiv(length, kBlockSize), kMaxBlocks);
+}
+
+Result<std::shared_ptr<CudaBuffer>> AllocateDevice(
+    const std::shared_ptr<CudaContext>& context, int64_t nbytes) {
+  // cuMemAlloc rejects empty allocations
+  return context->Allocate(std::max<int64_t>(nbytes, 1));
+}
+
+CUdeviceptr DevicePointer(const Buffer& buffer) {
+  return static_cast<CUdeviceptr>(buffer.address());
+}
+
+/// The values of an array without nulls stored in device memory
+struct DeviceArray {
+  static Result<DeviceArray> Make(const ArrayData& data) {
+    if (data.buffers.size() < 2 || data.buffers[1] == nullptr) {
+      return Status::Invalid("Array of type ", *data.type, " has no values buffer");
+    }
+    if (data.buffers[0] != nullptr && data.null_count != 0) {
+      return Status::NotImplemented("Arrays with nulls in CUDA compute kernels");
+    }
+    if (data.buffers[1]->is_cpu()) {
+      return Status::Invalid("CUDA compute kernels require arrays in device memory");
+    }
+    DeviceArray out;
+    ARROW_ASSIGN_OR_RAISE(out.buffer, CudaBuffer::FromBuffer(data.buffers[1]));
+    out.data = DevicePointer(*out.buffer);
+    out.offset = data.offset;
+    out.length = data.length;
+    return out;
+  }
+
+  const std::shared_ptr<CudaContext>& context() const { return buffer->context(); }
+
+  std::shared_ptr<CudaBuffer> buffer;
+  CUdeviceptr data;
+  int64_t offset;
+  int64_t length;
+};
+
+int ByteWidth(const DataType& type) {
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+/// Name of the device type of a C type in the kernel names, e.g. "int32"
+template <typename CType>
+std::string DeviceTypeName() {
+  if (std::is_floating_point<CType>::value) {
+    return sizeof(CType) == 4 ? "float" : "double";
+  }
+  return std::string(std::is_signed<CType>::value ? "int" : "uint") +
+         std::to_string(sizeof(CType) * 8);
+}
+
+std::string IndexTypeName(const DataType& type) {
+  return std::string(is_signed_integer(type.id()) ? "int" : "uint") +
+         std::to_string(ByteWidth(type) * 8);
+}
+
+// ----------------------------------------------------------------------
+// Filter and take
+
+Status FilterImpl(const ArrayData& values, const ArrayData& selection, Datum* out) {
+  ARROW_ASSIGN_OR_RAISE(auto input, DeviceArray::Make(values));
+  ARROW_ASSIGN_OR_RAISE(auto mask, DeviceArray::Make(selection));
+  const auto& context = input.context();
+  const int byte_width = ByteWidth(*values.type);
+  int64_t length = values.length;
+
+  int64_t num_selected = 0;
+  ARROW_ASSIGN_OR_RAISE(auto output, AllocateDevice(context, 0));
+  if (length > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto module, GetKernelModule(context));
+    ARROW_ASSIGN_OR_RAISE(CUfunction count_kernel, module->GetFunction("filter_count"));
+    ARROW_ASSIGN_OR_RAISE(CUfunction filter_kernel,
+                          module->GetFunction("filter_" + std::to_string(byte_width)));
+
+    ContextSaver set_temporary(*context);
+    int64_t num_tiles = BitUtil::CeilDiv(length, kBlockSize);
+    ARROW_ASSIGN_OR_RAISE(auto tile_counts,
+                          AllocateDevice(context, num_tiles * sizeof(int32_t)));
+    CUdeviceptr tile_counts_data = DevicePointer(*tile_counts);
+    RETURN_NOT_OK(Launch(count_kernel, num_tiles,
+                         {&mask.data, &mask.offset, &length, &tile_counts_data}));
+
+    // The scan over the tiles is cheap enough to be done on the host
+    std::vector<int32_t> counts(num_tiles);
+    RETURN_NOT_OK(tile_counts->CopyToHost(0, num_tiles * sizeof(int32_t), counts.data()));
+    std::vector<int64_t> offsets(num_tiles);
+    for (int64_t i = 0; i < num_tiles; ++i) {
+      offsets[i] = num_selected;
+      num_selected += counts[i];
+    }
+    ARROW_ASSIGN_OR_RAISE(auto tile_offsets,
+                          AllocateDevice(context, num_tiles * sizeof(int64_t)));
+    RETURN_NOT_OK(
+        tile_offsets->CopyFromHost(0, offsets.data(), num_tiles * sizeof(int64_t)));
+    CUdeviceptr tile_offsets_data = DevicePointer(*tile_offsets);
+
+    ARROW_ASSIGN_OR_RAISE(output, AllocateDevice(context, num_selected * byte_width));
+    CUdeviceptr output_data = DevicePointer(*output);
+    RETURN_NOT_OK(Launch(filter_kernel, num_tiles,
+                         {&input.data, &input.offset, &mask.data, &mask.offset, &length,
+                          &tile_offsets_data, &output_data}));
+    RETURN_NOT_OK(context->Synchronize());
+  }
+  *out = ArrayData::Make(values.type, num_selected, {nullptr, std::move(output)},
+                         /*null_count=*/0);
+  return Status::OK();
+}
+
+void FilterExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  ctx->SetStatus(FilterImpl(*batch[0].array(), *batch[1].array(), out));
+}
+
+Status TakeImpl(const ArrayData& values, const ArrayData& indices, Datum* out) {
+  ARROW_ASSIGN_OR_RAISE(auto input, DeviceArray::Make(values));
+  ARROW_ASSIGN_OR_RAISE(auto positions, DeviceArray::Make(indices));
+  const auto& context = input.context();
+  const int byte_width = ByteWidth(*values.type);
+  int64_t length = indices.length;
+
+  ARROW_ASSIGN_OR_RAISE(auto output, AllocateDevice(context, length * byte_width));
+  if (length > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto module, GetKernelModule(context));
+    ARROW_ASSIGN_OR_RAISE(CUfunction kernel,
+                          module->GetFunction("take_" + std::to_string(byte_width) + "_" +
+                                              IndexTypeName(*indices.type)));
+
+    ContextSaver set_temporary(*context);
+    ARROW_ASSIGN_OR_RAISE(auto out_of_bounds, AllocateDevice(context, sizeof(int32_t)));
+    CUdeviceptr out_of_bounds_data = DevicePointer(*out_of_bounds);
+    CU_RETURN_NOT_OK("cuMemsetD32", cuMemsetD32(out_of_bounds_data, 0, 1));
+    CUdeviceptr output_data = DevicePointer(*output);
+    RETURN_NOT_OK(Launch(kernel, GridStrideBlocks(length),
+                         {&input.data, &input.offset, &input.length, &positions.data,
+                          &positions.offset, &length, &output_data,
+                          &out_of_bounds_data}));
+
+    int32_t host_out_of_bounds = 0;
+    RETURN_NOT_OK(
+        out_of_bounds->CopyToHost(0, sizeof(int32_t), &host_out_of_bounds));
+    if (host_out_of_bounds != 0) {
+      return Status::IndexError("Index out of bounds");
+    }
+  }
+  *out = ArrayData::Make(values.type, length, {nullptr, std::move(output)},
+                         /*null_count=*/0);
+  return Status::OK();
+}
+
+void TakeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  ctx->SetStatus(TakeImpl(*batch[0].array(), *batch[1].array(), out));
+}
+
+Result<ValueDescr> FirstArrayType(KernelContext*, const std::vector<ValueDescr>& descrs) {
+  return ValueDescr::Array(descrs[0].type);
+}
+
+// ----------------------------------------------------------------------
+// Aggregations
+
+/// Run a reduction kernel over `input`, returning the partial result of each block
+template <typename Acc>
+Result<std::vector<Acc>> Reduce(const DeviceArray& input, const std::string& name,
+                                Acc init) {
+  const auto& context = input.context();
+  ARROW_ASSIGN_OR_RAISE(auto module, GetKernelModule(context));
+  ARROW_ASSIGN_OR_RAISE(CUfunction kernel, module->GetFunction(name));
+  const int64_t num_blocks =
+      std::min(BitUtil::CeilDiv(input.length, kBlockSize), kReduceBlocks);
+
+  ContextSaver set_temporary(*context);
+  ARROW_ASSIGN_OR_RAISE(auto partials, AllocateDevice(context, num_blocks * sizeof(Acc)));
+  CUdeviceptr partials_data = DevicePointer(*partials);
+  DeviceArray args = input;
+  RETURN_NOT_OK(Launch(kernel, num_blocks,
+                       {&args.data, &args.offset, &args.length, &init, &partials_data}));
+
+  std::vector<Acc> out(num_blocks);
+  RETURN_NOT_OK(partials->CopyToHost(0, num_blocks * sizeof(Acc), out.data()));
+  return out;
+}
+
+template <typename ArrowType>
+struct CudaSumImpl : public KernelState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumType = typename std::conditional<
+      std::is_floating_point<CType>::value, DoubleType,
+      typename std::conditional<std::is_signed<CType>::value, Int64Type,
+                                UInt64Type>::type>::type;
+  using SumCType = typename TypeTraits<SumType>::CType;
+
+  explicit CudaSumImpl(const std::shared_ptr<DataType>&) {}
+
+  Status Consume(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto input, DeviceArray::Make(*batch[0].array()));
+    if (input.length == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto partials,
+                          Reduce<SumCType>(input, "sum_" + DeviceTypeName<CType>(), 0));
+    for (SumCType partial : partials) {
+      sum += partial;
+    }
+    count += input.length;
+    return Status::OK();
+  }
+
+  void MergeFrom(CudaSumImpl&& other) {
+    sum += other.sum;
+    count += other.count;
+  }
+
+  Status Finalize(Datum* out) {
+    if (count == 0) {
+      *out = MakeNullScalar(TypeTraits<SumType>::type_singleton());
+    } else {
+      *out = MakeScalar(sum);
+    }
+    return Status::OK();
+  }
+
+  SumCType sum = 0;
+  int64_t count = 0;
+};
+
+template <typename ArrowType>
+struct CudaMinMaxImpl : public KernelState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  explicit CudaMinMaxImpl(std::shared_ptr<DataType> type) : type(std::move(type)) {}
+
+  static CType Smallest() {
+    return std::is_floating_point<CType>::value ? -std::numeric_limits<CType>::infinity()
+                                                : std::numeric_limits<CType>::lowest();
+  }
+
+  static CType Largest() {
+    return std::is_floating_point<CType>::value ? std::numeric_limits<CType>::infinity()
+                                                : std::numeric_limits<CType>::max();
+  }
+
+  Status Consume(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto input, DeviceArray::Make(*batch[0].array()));
+    if (input.length == 0) {
+      return Status::OK();
+    }
+    const std::string type_name = DeviceTypeName<CType>();
+    ARROW_ASSIGN_OR_RAISE(auto mins, Reduce<CType>(input, "min_" + type_name, Largest()));
+    ARROW_ASSIGN_OR_RAISE(auto maxes,
+                          Reduce<CType>(input, "max_" + type_name, Smallest()));
+    for (size_t i = 0; i < mins.size(); ++i) {
+      min = std::min(min, mins[i]);
+      max = std::max(max, maxes[i]);
+    }
+    has_values = true;
+    return Status::OK();
+  }
+
+  void MergeFrom(CudaMinMaxImpl&& other) {
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    has_values = has_values || other.has_values;
+  }
+
+  Status Finalize(Datum* out) {
+    std::vector<std::shared_ptr<Scalar>> values;
+    if (has_values) {
+      ARROW_ASSIGN_OR_RAISE(auto min_scalar, MakeScalar(type, min));
+      ARROW_ASSIGN_OR_RAISE(auto max_scalar, MakeScalar(type, max));
+      values = {std::move(min_scalar), std::move(max_scalar)};
+    } else {
+      values = {MakeNullScalar(type), MakeNullScalar(type)};
+    }
+    *out = Datum(std::make_shared<StructScalar>(std::move(values), MinMaxType(type)));
+    return Status::OK();
+  }
+
+  static std::shared_ptr<DataType> MinMaxType(const std::shared_ptr<DataType>& type) {
+    return struct_({field("min", type), field("max", type)});
+  }
+
+  std::shared_ptr<DataType> type;
+  CType min = Largest();
+  CType max = Smallest();
+  bool has_values = false;
+};
+
+template <typename Impl>
+compute::ScalarAggregateKernel MakeAggregateKernel(InputType in_type,
+                                                   OutputType out_type) {
+  return compute::ScalarAggregateKernel(
+      {std::move(in_type)}, std::move(out_type),
+      [](KernelContext*, const KernelInitArgs& args) -> std::unique_ptr<KernelState> {
+        return ::arrow::internal::make_unique<Impl>(args.inputs[0].type);
+      },
+      [](KernelContext* ctx, const ExecBatch& batch) {
+        ctx->SetStatus(checked_cast<Impl*>(ctx->state())->Consume(batch));
+      },
+      [](KernelContext*, KernelState&& src, KernelState* dst) {
+        checked_cast<Impl*>(dst)->MergeFrom(checked_cast<Impl&&>(src));
+      },
+      [](KernelContext* ctx, Datum* out) {
+        ctx->SetStatus(checked_cast<Impl*>(ctx->state())->Finalize(out));
+      });
+}
+
+// ----------------------------------------------------------------------
+// Hash aggregations
+
+// Every group emitted by the Grouper has at least one row and the inputs have no
+// nulls, so unlike the CPU "hash_sum" no per-group counts are needed.
+template <typename ArrowType>
+struct CudaGroupedSumImpl : public KernelState {
+  using CType = typename CudaSumImpl<ArrowType>::CType;
+  using SumType = typename CudaSumImpl<ArrowType>::SumType;
+  using SumCType = typename CudaSumImpl<ArrowType>::SumCType;
+
+  Status Reserve(int64_t new_num_groups) {
+    if (new_num_groups <= num_groups) {
+      return Status::OK();
+    }
+    const int64_t capacity = sums == nullptr ? 0 : sums->size() / sizeof(SumCType);
+    if (new_num_groups > capacity) {
+      const int64_t new_capacity = std::max(new_num_groups, capacity * 2);
+      ARROW_ASSIGN_OR_RAISE(auto new_sums,
+                            AllocateDevice(context, new_capacity * sizeof(SumCType)));
+      {
+        ContextSaver set_temporary(*context);
+        CU_RETURN_NOT_OK("cuMemsetD8", cuMemsetD8(DevicePointer(*new_sums), 0,
+                                                  new_capacity * sizeof(SumCType)));
+      }
+      if (num_groups > 0) {
+        RETURN_NOT_OK(
+            new_sums->CopyFromDevice(0, sums->data(), num_groups * sizeof(SumCType)));
+      }
+      sums = std::move(new_sums);
+    }
+    num_groups = new_num_groups;
+    return Status::OK();
+  }
+
+  /// Return the device address of a uint32 array, copying it to the device if needed
+  Result<CUdeviceptr> GroupIdsOnDevice(const ArrayData& group_ids,
+                                       std::shared_ptr<CudaBuffer>* holder) {
+    const auto& buffer = group_ids.buffers[1];
+    if (!buffer->is_cpu()) {
+      ARROW_ASSIGN_OR_RAISE(*holder, CudaBuffer::FromBuffer(buffer));
+      return DevicePointer(**holder) + group_ids.offset * sizeof(uint32_t);
+    }
+    const int64_t nbytes = group_ids.length * sizeof(uint32_t);
+    ARROW_ASSIGN_OR_RAISE(*holder, AllocateDevice(context, nbytes));
+    RETURN_NOT_OK((*holder)->CopyFromHost(0, group_ids.GetValues<uint32_t>(1), nbytes));
+    return DevicePointer(**holder);
+  }
+
+  Status Consume(const ExecBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(auto input, DeviceArray::Make(*batch[0].array()));
+    if (context == nullptr) {
+      context = input.context();
+    }
+    RETURN_NOT_OK(Reserve(batch[2].scalar_as<UInt32Scalar>().value));
+    if (input.length == 0) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto module, GetKernelModule(context));
+    ARROW_ASSIGN_OR_RAISE(CUfunction kernel,
+                          module->GetFunction("hash_sum_" + DeviceTypeName<CType>()));
+    std::shared_ptr<CudaBuffer> group_ids_holder;
+    ARROW_ASSIGN_OR_RAISE(CUdeviceptr group_ids,
+                          GroupIdsOnDevice(*batch[1].array(), &group_ids_holder));
+    int64_t group_ids_offset = 0;
+    CUdeviceptr sums_data = DevicePointer(*sums);
+
+    ContextSaver set_temporary(*context);
+    RETURN_NOT_OK(Launch(kernel, GridStrideBlocks(input.length),
+                         {&input.data, &input.offset, &group_ids, &group_ids_offset,
+                          &input.length, &sums_data}));
+    // Keep group_ids_holder alive until the kernel is done
+    return context->Synchronize();
+  }
+
+  Status Merge(CudaGroupedSumImpl&& other, const ArrayData& group_id_mapping) {
+    if (other.num_groups == 0) {
+      return Status::OK();
+    }
+    if (context == nullptr) {
+      context = other.context;
+    }
+    auto mapping = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t new_num_groups = num_groups;
+    for (int64_t i = 0; i < group_id_mapping.length; ++i) {
+      new_num_groups = std::max<int64_t>(new_num_groups, mapping[i] + 1);
+    }
+    RETURN_NOT_OK(Reserve(new_num_groups));
+
+    ARROW_ASSIGN_OR_RAISE(auto module, GetKernelModule(context));
+    ARROW_ASSIGN_OR_RAISE(
+        CUfunction kernel,
+        module->GetFunction("merge_sums_" + DeviceTypeName<SumCType>()));
+    std::shared_ptr<CudaBuffer> mapping_holder;
+    ARROW_ASSIGN_OR_RAISE(CUdeviceptr mapping_data,
+                          GroupIdsOnDevice(group_id_mapping, &mapping_holder));
+    CUdeviceptr other_sums_data = DevicePointer(*other.sums);
+    CUdeviceptr sums_data = DevicePointer(*sums);
+    int64_t length = group_id_mapping.length;
+
+    ContextSaver set_temporary(*context);
+    RETURN_NOT_OK(Launch(kernel, GridStrideBlocks(length),
+                         {&other_sums_data, &mapping_data, &length, &sums_data}));
+    return context->Synchronize();
+  }
+
+  Status Finalize(Datum* out) {
+    auto type = TypeTraits<SumType>::type_singleton();
+    if (sums == nullptr) {
+      *out = ArrayData::Make(std::move(type), 0, {nullptr, std::make_shared<Buffer>("")},
+                             /*null_count=*/0);
+      return Status::OK();
+    }
+    auto values =
+        std::make_shared<CudaBuffer>(sums, 0, num_groups * sizeof(SumCType));
+    *out = ArrayData::Make(std::move(type), num_groups, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+    return Status::OK();
+  }
+
+  std::shared_ptr<CudaContext> context;
+  std::shared_ptr<CudaBuffer> sums;
+  int64_t num_groups = 0;
+};
+
+template <typename ArrowType>
+compute::HashAggregateKernel MakeGroupedSumKernel() {
+  using Impl = CudaGroupedSumImpl<ArrowType>;
+  compute::HashAggregateKernel kernel;
+  kernel.init = [](KernelContext*,
+                   const KernelInitArgs&) -> std::unique_ptr<KernelState> {
+    return ::arrow::internal::make_unique<Impl>();
+  };
+  kernel.signature = compute::KernelSignature::Make(
+      {InputType::Array(ArrowType::type_id), InputType::Array(Type::UINT32),
+       InputType::Scalar(Type::UINT32)},
+      OutputType(TypeTraits<typename Impl::SumType>::type_singleton()));
+  kernel.consume = [](KernelContext* ctx, const ExecBatch& batch) {
+    ctx->SetStatus(checked_cast<Impl*>(ctx->state())->Consume(batch));
+  };
+  kernel.merge = [](KernelContext* ctx, KernelState&& other,
+                    const ArrayData& group_id_mapping) {
+    ctx->SetStatus(checked_cast<Impl*>(ctx->state())
+                       ->Merge(checked_cast<Impl&&>(other), group_id_mapping));
+  };
+  kernel.finalize = [](KernelContext* ctx, Datum* out) {
+    ctx->SetStatus(checked_cast<Impl*>(ctx->state())->Finalize(out));
+  };
+  return kernel;
+}
+
+// ----------------------------------------------------------------------
+// Registry
+
+const FunctionDoc filter_doc(
+    "Filter with a boolean selection filter on a CUDA device",
+    ("The output is populated with values from the input at positions\n"
+     "where the selection filter is true. Nulls are not supported."),
+    {"input", "selection_filter"}, "FilterOptions");
+
+const FunctionDoc take_doc(
+    "Select values from an input based on indices on a CUDA device",
+    ("The output is populated with values from the input at positions\n"
+     "given by `indices`. Nulls are not supported."),
+    {"input", "indices"}, "TakeOptions");
+
+const FunctionDoc sum_doc("Compute the sum of a numeric array on a CUDA device",
+                          ("Null values are not supported.\n"
+                           "The result is null for an empty input."),
+                          {"array"});
+
+const FunctionDoc min_max_doc(
+    "Compute the minimum and maximum values of an array on a CUDA device",
+    ("Null values are not supported.\n"
+     "The result is a struct of nulls for an empty input."),
+    {"array"}, "MinMaxOptions");
+
+const FunctionDoc hash_sum_doc("Sum values of a numeric array in each group",
+                               ("Null values are not supported."),
+                               {"array", "group_id_array", "group_count"});
+
+template <typename ArrowType>
+void AddNumericKernels(compute::ScalarAggregateFunction* sum,
+                       compute::HashAggregateFunction* hash_sum) {
+  using SumType = typename CudaSumImpl<ArrowType>::SumType;
+  DCHECK_OK(sum->AddKernel(MakeAggregateKernel<CudaSumImpl<ArrowType>>(
+      InputType::Array(ArrowType::type_id),
+      OutputType(TypeTraits<SumType>::type_singleton()))));
+  DCHECK_OK(hash_sum->AddKernel(MakeGroupedSumKernel<ArrowType>()));
+}
+
+template <typename ArrowType>
+void AddFixedWidthKernels(compute::VectorFunction* filter, compute::VectorFunction* take,
+                          compute::ScalarAggregateFunction* min_max) {
+  compute::VectorKernel filter_kernel(
+      {InputType::Array(ArrowType::type_id), InputType::Array(Type::BOOL)},
+      OutputType(FirstArrayType), FilterExec);
+  DCHECK_OK(filter->AddKernel(std::move(filter_kernel)));
+
+  // Indices do not have the length of the values, they cannot be iterated over in
+  // lockstep
+  compute::VectorKernel take_kernel(
+      {InputType::Array(ArrowType::type_id),
+       InputType(compute::match::Integer(), ValueDescr::ARRAY)},
+      OutputType(FirstArrayType), TakeExec);
+  take_kernel.can_execute_chunkwise = false;
+  DCHECK_OK(take->AddKernel(std::move(take_kernel)));
+
+  DCHECK_OK(min_max->AddKernel(MakeAggregateKernel<CudaMinMaxImpl<ArrowType>>(
+      InputType::Array(ArrowType::type_id),
+      OutputType([](KernelContext*,
+                    const std::vector<ValueDescr>& descrs) -> Result<ValueDescr> {
+        return ValueDescr::Scalar(CudaMinMaxImpl<ArrowType>::MinMaxType(descrs[0].type));
+      }))));
+}
+
+std::unique_ptr<compute::FunctionRegistry> MakeCudaFunctionRegistry() {
+  auto registry = compute::FunctionRegistry::Make();
+
+  static const auto default_filter_options = compute::FilterOptions::Defaults();
+  static const auto default_take_options = compute::TakeOptions::Defaults();
+  static const auto default_min_max_options = compute::MinMaxOptions::Defaults();
+
+  auto filter = std::make_shared<compute::VectorFunction>(
+      "filter", compute::Arity::Binary(), &filter_doc, &default_filter_options);
+  auto take = std::make_shared<compute::VectorFunction>(
+      "take", compute::Arity::Binary(), &take_doc, &default_take_options);
+  auto sum = std::make_shared<compute::ScalarAggregateFunction>(
+      "sum", compute::Arity::Unary(), &sum_doc);
+  auto min_max = std::make_shared<compute::ScalarAggregateFunction>(
+      "min_max", compute::Arity::Unary(), &min_max_doc, &default_min_max_options);
+  auto hash_sum = std::make_shared<compute::HashAggregateFunction>(
+      "hash_sum", compute::Arity::Ternary(), &hash_sum_doc);
+
+  AddNumericKernels<Int8Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<UInt8Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<Int16Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<UInt16Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<Int32Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<UInt32Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<Int64Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<UInt64Type>(sum.get(), hash_sum.get());
+  AddNumericKernels<FloatType>(sum.get(), hash_sum.get());
+  AddNumericKernels<DoubleType>(sum.get(), hash_sum.get());
+
+  AddFixedWidthKernels<Int8Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<UInt8Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Int16Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<UInt16Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Int32Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<UInt32Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Int64Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<UInt64Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<FloatType>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<DoubleType>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Date32Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Date64Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Time32Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<Time64Type>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<TimestampType>(filter.get(), take.get(), min_max.get());
+  AddFixedWidthKernels<DurationType>(filter.get(), take.get(), min_max.get());
+
+  DCHECK_OK(registry->AddFunction(std::move(filter)));
+  DCHECK_OK(registry->AddFunction(std::move(take)));
+  DCHECK_OK(registry->AddFunction(std::move(sum)));
+  DCHECK_OK(registry->AddFunction(std::move(min_max)));
+  DCHECK_OK(registry->AddFunction(std::move(hash_sum)));
+  return registry;
+}
+
+}  // namespace
+
+compute::FunctionRegistry* GetCudaFunctionRegistry() {
+  static auto registry = MakeCudaFunctionRegistry();
+  return registry.get();
+}
+
+}  // namespace cuda
+}  // namespace arrow
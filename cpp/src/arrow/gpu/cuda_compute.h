@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionRegistry;
+
+}  // namespace compute
+
+namespace cuda {
+
+/// \brief Get the registry of the compute functions running on CUDA devices
+///
+/// The registry contains "filter", "take", "sum", "min_max" and "hash_sum" kernels
+/// for numeric and temporal arrays whose buffers are CudaBuffers, with the
+/// semantics of the CPU functions of the same name. Pass it to an ExecContext to
+/// run these functions without copying the data back to the host:
+///
+///   compute::ExecContext ctx(default_memory_pool(), cuda::GetCudaFunctionRegistry());
+///   ARROW_ASSIGN_OR_RAISE(
+///       Datum filtered,
+///       compute::Filter(values, selection, compute::FilterOptions::Defaults(), &ctx));
+///
+/// Array results are allocated on the device of the inputs, aggregation results
+/// are returned as host scalars. "hash_sum" is used through
+/// compute::internal::GroupBy, its group ids may be on the host or on the device.
+/// Inputs with nulls are not supported yet.
+///
+/// The kernels are compiled with NVRTC the first time they are used on a device
+/// of a given compute capability.
+ARROW_EXPORT
+compute::FunctionRegistry* GetCudaFunctionRegistry();
+
+}  // namespace cuda
+}  // namespace arrow
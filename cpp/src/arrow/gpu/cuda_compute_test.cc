@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "arrow/gpu/cuda_api.h"
+
+namespace arrow {
+namespace cuda {
+
+constexpr int kGpuNumber = 0;
+
+class TestCudaCompute : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(auto manager, CudaDeviceManager::Instance());
+    ASSERT_OK_AND_ASSIGN(device_, manager->GetDevice(kGpuNumber));
+    exec_context_ = std::make_shared<compute::ExecContext>(default_memory_pool(),
+                                                           GetCudaFunctionRegistry());
+  }
+
+  // Copy an array without nulls to the device
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<Array>& array) {
+    auto data = array->data()->Copy();
+    EXPECT_OK_AND_ASSIGN(
+        data->buffers[1],
+        Buffer::Copy(data->buffers[1], device_->default_memory_manager()));
+    data->buffers[0] = nullptr;
+    return MakeArray(data);
+  }
+
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<DataType>& type,
+                                  const std::string& json) {
+    return ToDevice(ArrayFromJSON(type, json));
+  }
+
+  std::shared_ptr<Array> ToHost(const std::shared_ptr<ArrayData>& array) {
+    auto data = array->Copy();
+    EXPECT_FALSE(data->buffers[1]->is_cpu());
+    EXPECT_OK_AND_ASSIGN(data->buffers[1],
+                         Buffer::Copy(data->buffers[1], default_cpu_memory_manager()));
+    return MakeArray(data);
+  }
+
+ protected:
+  std::shared_ptr<CudaDevice> device_;
+  std::shared_ptr<compute::ExecContext> exec_context_;
+};
+
+TEST_F(TestCudaCompute, Filter) {
+  for (auto type : {int8(), int16(), int32(), float64(), timestamp(TimeUnit::MILLI)}) {
+    SCOPED_TRACE(type->ToString());
+    auto values = ToDevice(type, "[1, 2, 3, 4, 5, 6]");
+    auto selection = ToDevice(boolean(), "[true, false, false, true, true, false]");
+    ASSERT_OK_AND_ASSIGN(Datum filtered,
+                         compute::Filter(values, selection,
+                                         compute::FilterOptions::Defaults(),
+                                         exec_context_.get()));
+    AssertArraysEqual(*ArrayFromJSON(type, "[1, 4, 5]"), *ToHost(filtered.array()));
+
+    // Sliced inputs
+    ASSERT_OK_AND_ASSIGN(filtered, compute::Filter(values->Slice(1), selection->Slice(1),
+                                                   compute::FilterOptions::Defaults(),
+                                                   exec_context_.get()));
+    AssertArraysEqual(*ArrayFromJSON(type, "[4, 5]"), *ToHost(filtered.array()));
+  }
+}
+
+TEST_F(TestCudaCompute, FilterSpansTiles) {
+  std::vector<int64_t> values(10000), expected;
+  std::vector<bool> selection(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i);
+    selection[i] = i % 3 == 0 || i % 7 == 0;
+    if (selection[i]) expected.push_back(values[i]);
+  }
+  std::shared_ptr<Array> host_values, host_selection, host_expected;
+  ArrayFromVector<Int64Type>(values, &host_values);
+  ArrayFromVector<BooleanType, bool>(selection, &host_selection);
+  ArrayFromVector<Int64Type>(expected, &host_expected);
+
+  ASSERT_OK_AND_ASSIGN(Datum filtered,
+                       compute::Filter(ToDevice(host_values), ToDevice(host_selection),
+                                       compute::FilterOptions::Defaults(),
+                                       exec_context_.get()));
+  AssertArraysEqual(*host_expected, *ToHost(filtered.array()));
+}
+
+TEST_F(TestCudaCompute, Take) {
+  auto values = ToDevice(float32(), "[1.5, 2.5, 3.5, 4.5]");
+  for (auto index_type : {int8(), uint16(), int32(), int64()}) {
+    SCOPED_TRACE(index_type->ToString());
+    ASSERT_OK_AND_ASSIGN(Datum taken,
+                         compute::Take(values, ToDevice(index_type, "[3, 0, 0, 2]"),
+                                       compute::TakeOptions::Defaults(),
+                                       exec_context_.get()));
+    AssertArraysEqual(*ArrayFromJSON(float32(), "[4.5, 1.5, 1.5, 3.5]"),
+                      *ToHost(taken.array()));
+  }
+
+  ASSERT_RAISES(IndexError,
+                compute::Take(values, ToDevice(int32(), "[0, 4]"),
+                              compute::TakeOptions::Defaults(), exec_context_.get()));
+}
+
+TEST_F(TestCudaCompute, Aggregates) {
+  auto values = ToDevice(int32(), "[5, -3, 12, 7, 0]");
+  ASSERT_OK_AND_ASSIGN(Datum sum, compute::Sum(values, exec_context_.get()));
+  AssertScalarsEqual(Int64Scalar(21), *sum.scalar());
+
+  ASSERT_OK_AND_ASSIGN(Datum min_max,
+                       compute::MinMax(values, compute::MinMaxOptions::Defaults(),
+                                       exec_context_.get()));
+  const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+  AssertScalarsEqual(Int32Scalar(-3), *min_max_scalar.value[0]);
+  AssertScalarsEqual(Int32Scalar(12), *min_max_scalar.value[1]);
+
+  ASSERT_OK_AND_ASSIGN(sum, compute::Sum(ToDevice(float64(), "[0.5, 1.5, 2]"),
+                                         exec_context_.get()));
+  AssertScalarsEqual(DoubleScalar(4.0), *sum.scalar());
+
+  ASSERT_OK_AND_ASSIGN(sum, compute::Sum(values->Slice(0, 0), exec_context_.get()));
+  ASSERT_FALSE(sum.scalar()->is_valid);
+
+  // Larger than one reduction grid
+  std::vector<uint64_t> many(1 << 20, 3);
+  std::shared_ptr<Array> host_many;
+  ArrayFromVector<UInt64Type>(many, &host_many);
+  ASSERT_OK_AND_ASSIGN(sum, compute::Sum(ToDevice(host_many), exec_context_.get()));
+  AssertScalarsEqual(UInt64Scalar(3 << 20), *sum.scalar());
+}
+
+TEST_F(TestCudaCompute, HashSum) {
+  auto values = ToDevice(int32(), "[1, 2, 3, 4, 5, 6]");
+  auto keys = ArrayFromJSON(int64(), "[10, 20, 10, 30, 20, 10]");
+  ASSERT_OK_AND_ASSIGN(
+      Datum grouped, compute::internal::GroupBy({values}, {keys}, {{"hash_sum", nullptr}},
+                                                exec_context_.get()));
+  const auto& result = grouped.array();
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[10, 7, 4]"),
+                    *ToHost(result->child_data[0]));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[10, 20, 30]"),
+                    *MakeArray(result->child_data[1]));
+}
+
+TEST_F(TestCudaCompute, Errors) {
+  // Inputs must be in device memory
+  auto host_values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, compute::Sum(host_values, exec_context_.get()));
+
+  // Nulls are not supported
+  auto values = ArrayFromJSON(int32(), "[1, null]");
+  auto data = values->data()->Copy();
+  ASSERT_OK_AND_ASSIGN(data->buffers[1], Buffer::Copy(data->buffers[1],
+                                                      device_->default_memory_manager()));
+  ASSERT_RAISES(NotImplemented, compute::Sum(MakeArray(data), exec_context_.get()));
+}
+
+}  // namespace cuda
+}  // namespace arrow
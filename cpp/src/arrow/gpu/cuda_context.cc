@@ -154,6 +154,29 @@ class CudaContext::Impl {
     return Status::OK();
   }
 
+  Status NewStream(CUstream* out) {
+    ContextSaver set_temporary(context_);
+    // Non-blocking: do not synchronize with the legacy default stream
+    CU_RETURN_NOT_OK("cuStreamCreate", cuStreamCreate(out, CU_STREAM_NON_BLOCKING));
+    return Status::OK();
+  }
+
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                     cuMemcpyDtoHAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status Free(void* device_ptr, int64_t nbytes) {
     CU_RETURN_NOT_OK("cuMemFree", cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
     bytes_allocated_ -= nbytes;
@@ -583,6 +606,59 @@ Status CudaContext::CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>
 
 Status CudaContext::Synchronize(void) { return impl_->Synchronize(); }
 
+Result<std::shared_ptr<CudaStream>> CudaContext::NewStream() {
+  CUstream stream;
+  RETURN_NOT_OK(impl_->NewStream(&stream));
+  return std::shared_ptr<CudaStream>(new CudaStream(shared_from_this(), stream));
+}
+
+Status CudaContext::CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  if (stream.context().get() != this) {
+    return Status::Invalid("Stream belongs to another CUDA context");
+  }
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream.handle()));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  if (stream.context().get() != this) {
+    return Status::Invalid("Stream belongs to another CUDA context");
+  }
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream.handle()));
+}
+
+// ----------------------------------------------------------------------
+// CudaStream
+
+CudaStream::CudaStream(std::shared_ptr<CudaContext> context, void* handle)
+    : context_(std::move(context)), handle_(handle) {}
+
+CudaStream::~CudaStream() {
+  ContextSaver set_temporary(*context_);
+  // Pending operations still complete, the resources are released afterwards
+  cuStreamDestroy(reinterpret_cast<CUstream>(handle_));
+}
+
+Status CudaStream::Synchronize() {
+  ContextSaver set_temporary(*context_);
+  CU_RETURN_NOT_OK("cuStreamSynchronize",
+                   cuStreamSynchronize(reinterpret_cast<CUstream>(handle_)));
+  return Status::OK();
+}
+
+Result<bool> CudaStream::IsDone() const {
+  ContextSaver set_temporary(*context_);
+  CUresult res = cuStreamQuery(reinterpret_cast<CUstream>(handle_));
+  if (res == CUDA_ERROR_NOT_READY) {
+    return false;
+  }
+  CU_RETURN_NOT_OK("cuStreamQuery", res);
+  return true;
+}
+
 Status CudaContext::Close() { return impl_->Close(); }
 
 Status CudaContext::Free(void* device_ptr, int64_t nbytes) {
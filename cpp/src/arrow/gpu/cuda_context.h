@@ -36,6 +36,7 @@ class CudaBuffer;
 class CudaHostBuffer;
 class CudaIpcMemHandle;
 class CudaMemoryManager;
+class CudaStream;
 
 // XXX Should CudaContext be merged into CudaMemoryManager?
 
@@ -248,6 +249,36 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \brief Block until the all device tasks are completed.
   Status Synchronize(void);
 
+  /// \brief Create a new stream in this context
+  ///
+  /// Copies and kernels enqueued on different streams may run concurrently.
+  Result<std::shared_ptr<CudaStream>> NewStream();
+
+  /// \brief Enqueue a copy from host memory to device memory on a stream
+  /// \param[in] dst the device address to copy to
+  /// \param[in] src the host address to copy from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream ordering the copy
+  /// \return Status
+  ///
+  /// The copy only overlaps with host work and with other streams if `src` is
+  /// pinned memory, e.g. allocated from a CudaHostMemoryPool. `src` must remain
+  /// valid until the stream is synchronized.
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               const CudaStream& stream);
+
+  /// \brief Enqueue a copy from device memory to host memory on a stream
+  /// \param[in] dst the host address to copy to
+  /// \param[in] src the device address to copy from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream ordering the copy
+  /// \return Status
+  ///
+  /// Same requirements as CopyHostToDeviceAsync(), `dst` must not be read before the
+  /// stream is synchronized.
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               const CudaStream& stream);
+
   int64_t bytes_allocated() const;
 
   /// \brief Expose CUDA context handle to other libraries
@@ -305,5 +336,31 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \endcond
 };
 
+/// \class CudaStream
+/// \brief A CUDA stream, ordering the asynchronous operations enqueued on it
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Block until all the operations enqueued so far have completed
+  Status Synchronize();
+
+  /// \brief Return whether all the operations enqueued so far have completed
+  Result<bool> IsDone() const;
+
+  /// \brief Expose the CUstream handle to other libraries
+  void* handle() const { return handle_; }
+
+  const std::shared_ptr<CudaContext>& context() const { return context_; }
+
+ private:
+  CudaStream(std::shared_ptr<CudaContext> context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  void* handle_;
+
+  friend class CudaContext;
+};
+
 }  // namespace cuda
 }  // namespace arrow
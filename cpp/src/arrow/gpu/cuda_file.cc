@@ -0,0 +1,312 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#ifdef ARROW_CUDA_HAVE_GDS
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cufile.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+
+namespace cuda {
+
+#ifdef ARROW_CUDA_HAVE_GDS
+
+namespace {
+
+Status StatusFromCuFile(CUfileError_t err, const char* function_name) {
+  if (err.err == CU_FILE_CUDA_DRIVER_ERROR) {
+    return internal::StatusFromCuda(err.cu_err, function_name);
+  }
+  return Status::IOError("cuFile error in ", function_name, ": ",
+                         CUFILE_ERRSTR(err.err));
+}
+
+#define CUFILE_RETURN_NOT_OK(FUNC_NAME, STMT)   \
+  do {                                          \
+    CUfileError_t __err = (STMT);               \
+    if (IS_CUFILE_ERR(__err.err)) {             \
+      return StatusFromCuFile(__err, FUNC_NAME); \
+    }                                           \
+  } while (0)
+
+// The driver is opened once and stays open for the lifetime of the process
+Status OpenCuFileDriver() {
+  static const Status status = []() -> Status {
+    CUFILE_RETURN_NOT_OK("cuFileDriverOpen", cuFileDriverOpen());
+    return Status::OK();
+  }();
+  return status;
+}
+
+// GPUDirect Storage only bypasses the page cache for files opened with
+// O_DIRECT, but some filesystems refuse it: cuFile then falls back to
+// (slower) bounce buffers, which is still correct.
+Result<int> OpenDirect(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_DIRECT);
+  if (fd == -1 && errno == EINVAL) {
+    fd = ::open(path.c_str(), O_RDONLY);
+  }
+  if (fd == -1) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "Failed to open local file '",
+                                               path, "'");
+  }
+  return fd;
+}
+
+}  // namespace
+
+#endif  // ARROW_CUDA_HAVE_GDS
+
+// ----------------------------------------------------------------------
+// CudaFileReader
+
+class CudaFileReader::Impl {
+ public:
+  explicit Impl(std::shared_ptr<CudaContext> context) : context_(std::move(context)) {}
+
+  ~Impl() {
+    auto st = Close();
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to close CudaFileReader: " << st.ToString();
+    }
+  }
+
+  Status Open(const std::string& path) {
+#ifdef ARROW_CUDA_HAVE_GDS
+    RETURN_NOT_OK(OpenCuFileDriver());
+    ARROW_ASSIGN_OR_RAISE(auto file_name, PlatformFilename::FromString(path));
+    ARROW_ASSIGN_OR_RAISE(fd_, ::arrow::internal::FileOpenReadable(file_name));
+    ARROW_ASSIGN_OR_RAISE(size_, ::arrow::internal::FileGetSize(fd_));
+    ARROW_ASSIGN_OR_RAISE(direct_fd_, OpenDirect(path));
+
+    CUfileDescr_t descr;
+    std::memset(&descr, 0, sizeof(descr));
+    descr.handle.fd = direct_fd_;
+    descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    CUFILE_RETURN_NOT_OK("cuFileHandleRegister", cuFileHandleRegister(&handle_, &descr));
+    is_registered_ = true;
+    return Status::OK();
+#else
+    return Status::NotImplemented(
+        "CudaFileReader requires Arrow to be built with GPUDirect Storage support "
+        "(ARROW_CUDA_GDS=ON)");
+#endif
+  }
+
+  Status Close() {
+#ifdef ARROW_CUDA_HAVE_GDS
+    if (is_registered_) {
+      cuFileHandleDeregister(handle_);
+      is_registered_ = false;
+    }
+#endif
+    Status st;
+    if (direct_fd_ != -1) {
+      st &= ::arrow::internal::FileClose(direct_fd_);
+      direct_fd_ = -1;
+    }
+    if (fd_ != -1) {
+      st &= ::arrow::internal::FileClose(fd_);
+      fd_ = -1;
+    }
+    return st;
+  }
+
+  bool closed() const { return fd_ == -1; }
+
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation forbidden on closed CudaFileReader");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, int64_t nbytes) const {
+    if (position < 0 || nbytes < 0) {
+      return Status::Invalid("Invalid read (offset = ", position, ", size = ", nbytes,
+                             ")");
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, nbytes));
+    return ::arrow::internal::FileReadAt(fd_, reinterpret_cast<uint8_t*>(out), position,
+                                         nbytes);
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, CudaBuffer* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, nbytes));
+    if (out->context() != context_) {
+      return Status::Invalid("Buffer does not belong to the CudaFileReader context");
+    }
+    if (out->size() < nbytes) {
+      return Status::Invalid("Buffer too small (", out->size(), " bytes) for reading ",
+                             nbytes, " bytes");
+    }
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+#ifdef ARROW_CUDA_HAVE_GDS
+    internal::ContextSaver set_temporary(*context_);
+    void* device_ptr = reinterpret_cast<void*>(out->address());
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      // cuFileRead may return short reads, like pread
+      ssize_t ret =
+          cuFileRead(handle_, device_ptr, static_cast<size_t>(nbytes - bytes_read),
+                     static_cast<off_t>(position + bytes_read),
+                     static_cast<off_t>(bytes_read));
+      if (ret == -1) {
+        return ::arrow::internal::IOErrorFromErrno(errno, "cuFileRead failed");
+      }
+      if (ret < 0) {
+        return Status::IOError("cuFileRead failed: ",
+                               CUFILE_ERRSTR(static_cast<CUfileOpError>(-ret)));
+      }
+      if (ret == 0) {
+        break;
+      }
+      bytes_read += ret;
+    }
+    return bytes_read;
+#else
+    return Status::NotImplemented("GPUDirect Storage support is not enabled");
+#endif
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, nbytes));
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, context_->Allocate(nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(position, nbytes, buffer.get()));
+    if (bytes_read < nbytes) {
+      return std::make_shared<CudaBuffer>(buffer, 0, bytes_read);
+    }
+    return std::move(buffer);
+  }
+
+  Result<int64_t> GetSize() const {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  const std::shared_ptr<CudaContext>& context() const { return context_; }
+
+  int64_t position_ = 0;
+
+ private:
+  std::shared_ptr<CudaContext> context_;
+  int fd_ = -1;
+  int direct_fd_ = -1;
+  int64_t size_ = -1;
+#ifdef ARROW_CUDA_HAVE_GDS
+  CUfileHandle_t handle_;
+  bool is_registered_ = false;
+#endif
+};
+
+CudaFileReader::CudaFileReader(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+CudaFileReader::~CudaFileReader() { io::internal::CloseFromDestructor(this); }
+
+Result<std::shared_ptr<CudaFileReader>> CudaFileReader::Open(
+    const std::string& path, const std::shared_ptr<CudaContext>& context) {
+  std::unique_ptr<Impl> impl(new Impl(context));
+  RETURN_NOT_OK(impl->Open(path));
+  return std::shared_ptr<CudaFileReader>(new CudaFileReader(std::move(impl)));
+}
+
+Status CudaFileReader::DoClose() { return impl_->Close(); }
+
+bool CudaFileReader::closed() const { return impl_->closed(); }
+
+const std::shared_ptr<CudaContext>& CudaFileReader::context() const {
+  return impl_->context();
+}
+
+Result<int64_t> CudaFileReader::ReadAt(int64_t position, int64_t nbytes,
+                                       CudaBuffer* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Result<int64_t> CudaFileReader::DoTell() const {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  return impl_->position_;
+}
+
+Result<int64_t> CudaFileReader::DoGetSize() { return impl_->GetSize(); }
+
+Status CudaFileReader::DoSeek(int64_t position) {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  if (position < 0) {
+    return Status::Invalid("Invalid position");
+  }
+  impl_->position_ = position;
+  return Status::OK();
+}
+
+Result<int64_t> CudaFileReader::DoReadAt(int64_t position, int64_t nbytes, void* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> CudaFileReader::DoReadAt(int64_t position,
+                                                         int64_t nbytes) {
+  return impl_->ReadAt(position, nbytes);
+}
+
+Result<int64_t> CudaFileReader::DoRead(int64_t nbytes, void* out) {
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, impl_->ReadAt(impl_->position_, nbytes, out));
+  impl_->position_ += bytes_read;
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> CudaFileReader::DoRead(int64_t nbytes) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadAt(impl_->position_, nbytes));
+  impl_->position_ += buffer->size();
+  return std::move(buffer);
+}
+
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/io/concurrency.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace cuda {
+
+class CudaBuffer;
+class CudaContext;
+
+/// \class CudaFileReader
+/// \brief File interface reading directly from storage into CUDA device memory
+///
+/// Reads to a Buffer DMA-transfer the file data into a newly allocated
+/// CudaBuffer with GPUDirect Storage (cuFile), without staging it in host
+/// memory. Like with CudaBufferReader, the returned buffers point to device
+/// memory and are generally not compatible with Arrow code expecting CPU
+/// memory. Reads to a raw pointer read into host memory, which is how small
+/// pieces of metadata are meant to be read.
+///
+/// Passing a CudaFileReader to ipc::RecordBatchFileReader::Open yields
+/// record batches whose buffers are on the device.
+///
+/// GPUDirect Storage support is optional (ARROW_CUDA_GDS=ON at build time);
+/// without it, Open returns NotImplemented.
+class ARROW_EXPORT CudaFileReader
+    : public ::arrow::io::internal::RandomAccessFileConcurrencyWrapper<CudaFileReader> {
+ public:
+  ~CudaFileReader() override;
+
+  /// \brief Open a local file for reading into the memory of the given context
+  static Result<std::shared_ptr<CudaFileReader>> Open(
+      const std::string& path, const std::shared_ptr<CudaContext>& context);
+
+  bool closed() const override;
+
+  const std::shared_ptr<CudaContext>& context() const;
+
+  /// \brief Read nbytes at position into an existing device buffer
+  ///
+  /// \param[in] position the file offset to read from
+  /// \param[in] nbytes the number of bytes to read
+  /// \param[in] out the device buffer to read into, at least nbytes large
+  /// \return the number of bytes read
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, CudaBuffer* out);
+  using ::arrow::io::internal::RandomAccessFileConcurrencyWrapper<
+      CudaFileReader>::ReadAt;
+
+ protected:
+  friend ::arrow::io::internal::RandomAccessFileConcurrencyWrapper<CudaFileReader>;
+
+  class Impl;
+  explicit CudaFileReader(std::unique_ptr<Impl> impl);
+
+  Status DoClose();
+
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoTell() const;
+  Status DoSeek(int64_t position);
+  Result<int64_t> DoGetSize();
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace cuda
+}  // namespace arrow
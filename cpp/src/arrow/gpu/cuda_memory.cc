@@ -22,7 +22,10 @@
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -30,6 +33,7 @@
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/gpu/cuda_context.h"
@@ -174,6 +178,22 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, const CudaStream& stream) const {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  return context_->CopyDeviceToHostAsync(out, address() + position, nbytes, stream);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, const CudaStream& stream) {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  return context_->CopyHostToDeviceAsync(address() + position, data, nbytes, stream);
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -212,6 +232,188 @@ Result<uintptr_t> CudaHostBuffer::GetDeviceAddress(
   return ::arrow::cuda::GetDeviceAddress(data(), ctx);
 }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+alignas(64) uint8_t zero_size_area[1];
+
+// Smallest block handed out, pinning is done at page granularity anyway
+constexpr int64_t kMinHostBlockSize = 4096;
+
+int64_t HostBlockSize(int64_t size) {
+  return std::max(kMinHostBlockSize, BitUtil::NextPower2(size));
+}
+
+}  // namespace
+
+class CudaHostMemoryPool::Impl {
+ public:
+  Impl(std::shared_ptr<CudaContext> context, int64_t max_cached_bytes)
+      : context_(std::move(context)), max_cached_bytes_(max_cached_bytes) {}
+
+  ~Impl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int64_t block_size = HostBlockSize(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& blocks = free_blocks_[block_size];
+      if (!blocks.empty()) {
+        *out = blocks.back();
+        blocks.pop_back();
+        bytes_cached_ -= block_size;
+        UpdateAllocated(size);
+        return Status::OK();
+      }
+    }
+
+    ContextSaver set_temporary(*context_);
+    void* data;
+    CU_RETURN_NOT_OK("cuMemHostAlloc",
+                     cuMemHostAlloc(&data, static_cast<size_t>(block_size),
+                                    CU_MEMHOSTALLOC_PORTABLE));
+    *out = reinterpret_cast<uint8_t*>(data);
+    std::lock_guard<std::mutex> lock(mutex_);
+    UpdateAllocated(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size > 0 && new_size > 0 &&
+        HostBlockSize(old_size) == HostBlockSize(new_size)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      UpdateAllocated(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    const int64_t block_size = HostBlockSize(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_allocated_ -= size;
+      if (bytes_cached_ + block_size <= max_cached_bytes_) {
+        free_blocks_[block_size].push_back(buffer);
+        bytes_cached_ += block_size;
+        return;
+      }
+    }
+    FreeBlock(buffer);
+  }
+
+  void ReleaseUnused() {
+    std::unordered_map<int64_t, std::vector<uint8_t*>> blocks;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      blocks.swap(free_blocks_);
+      bytes_cached_ = 0;
+    }
+    for (const auto& size_blocks : blocks) {
+      for (uint8_t* block : size_blocks.second) {
+        FreeBlock(block);
+      }
+    }
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+ private:
+  // Must be called with mutex_ held
+  void UpdateAllocated(int64_t diff) {
+    bytes_allocated_ += diff;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+  }
+
+  void FreeBlock(uint8_t* block) {
+    ContextSaver set_temporary(*context_);
+    ARROW_CHECK_OK(internal::StatusFromCuda(cuMemFreeHost(block), "cuMemFreeHost"));
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t max_cached_bytes_;
+
+  mutable std::mutex mutex_;
+  // Freed blocks by block size
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_blocks_;
+  int64_t bytes_allocated_ = 0;
+  int64_t bytes_cached_ = 0;
+  int64_t max_memory_ = 0;
+};
+
+constexpr int64_t CudaHostMemoryPool::kDefaultMaxCachedBytes;
+
+CudaHostMemoryPool::CudaHostMemoryPool(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CudaHostMemoryPool::~CudaHostMemoryPool() {}
+
+Result<std::unique_ptr<CudaHostMemoryPool>> CudaHostMemoryPool::Make(
+    std::shared_ptr<CudaContext> context, int64_t max_cached_bytes) {
+  if (max_cached_bytes < 0) {
+    return Status::Invalid("max_cached_bytes must be non-negative");
+  }
+  std::unique_ptr<Impl> impl(new Impl(std::move(context), max_cached_bytes));
+  return std::unique_ptr<CudaHostMemoryPool>(new CudaHostMemoryPool(std::move(impl)));
+}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string CudaHostMemoryPool::backend_name() const { return "cuda_pinned"; }
+
+int64_t CudaHostMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void CudaHostMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
 // ----------------------------------------------------------------------
 // CudaBufferReader
 
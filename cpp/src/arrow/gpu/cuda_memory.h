@@ -19,9 +19,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "arrow/buffer.h"
 #include "arrow/io/concurrency.h"
+#include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
 
 namespace arrow {
@@ -29,6 +31,7 @@ namespace cuda {
 
 class CudaContext;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -70,6 +73,28 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the stream ordering the copy
+  /// \return Status
+  ///
+  /// \see CudaContext::CopyDeviceToHostAsync
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         const CudaStream& stream) const;
+
+  /// \brief Enqueue a copy to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream ordering the copy
+  /// \return Status
+  ///
+  /// \see CudaContext::CopyHostToDeviceAsync
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           const CudaStream& stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -117,6 +142,50 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   Result<uintptr_t> GetDeviceAddress(const std::shared_ptr<CudaContext>& ctx);
 };
 
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool allocating pinned (page-locked) host memory
+///
+/// Copies between this memory and the device run asynchronously with
+/// CudaBuffer::CopyFromHostAsync() and CudaBuffer::CopyToHostAsync(), without
+/// staging. Passing this pool to the IPC or Parquet readers makes them decode into
+/// pinned memory, so that the transfer of a batch overlaps with the decoding of the
+/// next one.
+///
+/// Pinning memory is expensive, so freed blocks are kept for reuse: allocations are
+/// rounded up to a power of two and up to `max_cached_bytes` of freed blocks are
+/// cached. The memory is portable across contexts.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedBytes = 256 << 20;
+
+  ~CudaHostMemoryPool() override;
+
+  /// \brief Create a pool pinning memory through the given context
+  static Result<std::unique_ptr<CudaHostMemoryPool>> Make(
+      std::shared_ptr<CudaContext> context,
+      int64_t max_cached_bytes = kDefaultMaxCachedBytes);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+  int64_t max_memory() const override;
+  std::string backend_name() const override;
+
+  /// \brief The number of bytes of freed blocks kept for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief Unpin and free the cached blocks
+  void ReleaseUnused();
+
+ private:
+  class Impl;
+  explicit CudaHostMemoryPool(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
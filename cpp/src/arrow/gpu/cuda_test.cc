@@ -16,13 +16,17 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <cuda.h>
 
 #include "gtest/gtest.h"
 
+#include "arrow/c/bridge.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
@@ -34,6 +38,7 @@
 #include "arrow/gpu/cuda_api.h"
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -377,6 +382,69 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->parent(), device_buffer);
 }
 
+// ------------------------------------------------------------------------
+// Test CudaHostMemoryPool
+
+class TestCudaHostMemoryPool : public TestCudaBase {
+ public:
+  void SetUp() {
+    TestCudaBase::SetUp();
+    ASSERT_OK_AND_ASSIGN(pool_, CudaHostMemoryPool::Make(context_, /*max_cached=*/8192));
+  }
+
+ protected:
+  std::unique_ptr<CudaHostMemoryPool> pool_;
+};
+
+TEST_F(TestCudaHostMemoryPool, AllocateAndReuse) {
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateResizableBuffer(1024, pool_.get()));
+  ASSERT_EQ(pool_->bytes_allocated(), 1024);
+  ASSERT_EQ(buffer->address() % 64, 0);
+  // Pinned memory has a device address
+  ASSERT_OK_AND_ASSIGN(auto device_address, GetDeviceAddress(buffer->data(), context_));
+  ASSERT_NE(device_address, 0);
+
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(pool_->bytes_allocated(), 0);
+  ASSERT_EQ(pool_->bytes_cached(), 4096);
+
+  // A freed block of the same size class is reused
+  ASSERT_OK_AND_ASSIGN(buffer, AllocateResizableBuffer(3072, pool_.get()));
+  ASSERT_EQ(buffer->data(), data);
+  ASSERT_EQ(pool_->bytes_cached(), 0);
+  ASSERT_EQ(pool_->max_memory(), 3072);
+
+  ASSERT_OK(buffer->Resize(5120));
+  ASSERT_EQ(pool_->bytes_allocated(), 5120);
+  // The 4096 bytes block was cached, then the 8192 bytes one did not fit
+  buffer.reset();
+  ASSERT_EQ(pool_->bytes_allocated(), 0);
+  ASSERT_EQ(pool_->bytes_cached(), 4096);
+
+  pool_->ReleaseUnused();
+  ASSERT_EQ(pool_->bytes_cached(), 0);
+}
+
+TEST_F(TestCudaHostMemoryPool, AsyncCopies) {
+  const int64_t kSize = 1 << 20;
+  ASSERT_OK_AND_ASSIGN(auto stream, context_->NewStream());
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, context_->Allocate(kSize));
+
+  ASSERT_OK_AND_ASSIGN(auto src, AllocateBuffer(kSize, pool_.get()));
+  random_bytes(kSize, 0, src->mutable_data());
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, src->data(), kSize, *stream));
+
+  ASSERT_OK_AND_ASSIGN(auto dst, AllocateBuffer(kSize, pool_.get()));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, dst->mutable_data(), *stream));
+  ASSERT_OK(stream->Synchronize());
+  ASSERT_OK_AND_EQ(true, stream->IsDone());
+  AssertBufferEqual(*src, *dst);
+
+  ASSERT_RAISES(Invalid,
+                device_buffer->CopyFromHostAsync(1, src->data(), kSize, *stream));
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -622,5 +690,172 @@ TEST_F(TestCudaArrowIpc, DictionaryWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, CDeviceInterface) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch));
+  ASSERT_OK_AND_ASSIGN(auto device_serialized,
+                       SerializeRecordBatch(*batch, context_.get()));
+  ipc::DictionaryMemo unused_memo;
+  ASSERT_OK_AND_ASSIGN(auto device_batch,
+                       ReadRecordBatch(batch->schema(), &unused_memo, device_serialized));
+
+  // Device data can't be exported as CPU data
+  struct ArrowDeviceArray c_array;
+  ASSERT_RAISES(Invalid, ExportDeviceRecordBatch(*device_batch, ARROW_DEVICE_CPU,
+                                                 kGpuNumber, nullptr, &c_array));
+
+  ASSERT_OK(ExportDeviceRecordBatch(*device_batch, ARROW_DEVICE_CUDA, kGpuNumber,
+                                    nullptr, &c_array));
+  ASSERT_EQ(c_array.device_type, ARROW_DEVICE_CUDA);
+  ASSERT_EQ(c_array.device_id, kGpuNumber);
+  ASSERT_OK_AND_ASSIGN(auto imported,
+                       ImportDeviceRecordBatch(&c_array, batch->schema(), mm_));
+  ASSERT_EQ(imported->num_rows(), batch->num_rows());
+
+  // The buffers were passed through without copying
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    const auto& expected = device_batch->column(i)->data()->buffers[1];
+    const auto& actual = imported->column(i)->data()->buffers[1];
+    ASSERT_FALSE(actual->is_cpu());
+    ASSERT_TRUE(actual->device()->Equals(*device_));
+    ASSERT_EQ(actual->address(), expected->address());
+  }
+}
+
+// ------------------------------------------------------------------------
+// Test GPUDirect Storage reads
+
+class TestCudaFileReader : public TestCudaArrowIpc {
+ public:
+  void SetUp() {
+    TestCudaArrowIpc::SetUp();
+    ASSERT_OK_AND_ASSIGN(temp_dir_, ::arrow::internal::TemporaryDir::Make("cuda-test-"));
+    ASSERT_OK(ipc::test::MakeIntRecordBatch(&batch_));
+  }
+
+  std::string TempFile(const std::string& name) {
+    return temp_dir_->path().Join(name).ValueOrDie().ToString();
+  }
+
+  std::shared_ptr<CudaFileReader> OpenReader(const std::string& path) {
+    auto maybe_reader = CudaFileReader::Open(path, context_);
+    if (maybe_reader.status().IsNotImplemented()) {
+      return nullptr;
+    }
+    EXPECT_OK_AND_ASSIGN(auto reader, maybe_reader);
+    return reader;
+  }
+
+  // Copy the buffers of a batch of flat arrays to the host
+  std::shared_ptr<RecordBatch> ToHost(const RecordBatch& batch) {
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    for (const auto& column : batch.column_data()) {
+      auto data = column->Copy();
+      for (auto& buffer : data->buffers) {
+        if (buffer != nullptr) {
+          EXPECT_FALSE(buffer->is_cpu());
+          EXPECT_OK_AND_ASSIGN(buffer,
+                               Buffer::Copy(buffer, default_cpu_memory_manager()));
+        }
+      }
+      columns.push_back(std::move(data));
+    }
+    return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+  }
+
+ protected:
+  std::unique_ptr<::arrow::internal::TemporaryDir> temp_dir_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestCudaFileReader, ReadAt) {
+  const std::string path = TempFile("data.bin");
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(10000, pool_, &data));
+  ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path));
+  ASSERT_OK(out->Write(data));
+  ASSERT_OK(out->Close());
+
+  auto reader = OpenReader(path);
+  if (reader == nullptr) {
+    GTEST_SKIP() << "Arrow was built without GPUDirect Storage support";
+  }
+  ASSERT_OK_AND_EQ(10000, reader->GetSize());
+
+  // Reads to a Buffer land in device memory
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, reader->ReadAt(1234, 5000));
+  ASSERT_FALSE(device_buffer->is_cpu());
+  ASSERT_EQ(*device_buffer->device(), *device_);
+  ASSERT_OK_AND_ASSIGN(auto host_buffer,
+                       Buffer::Copy(device_buffer, default_cpu_memory_manager()));
+  AssertBufferEqual(*host_buffer, *SliceBuffer(data, 1234, 5000));
+
+  // Truncated at the end of the file
+  ASSERT_OK_AND_ASSIGN(device_buffer, reader->ReadAt(9000, 5000));
+  ASSERT_EQ(1000, device_buffer->size());
+
+  // Reads to a pointer land in host memory
+  uint8_t host_data[100];
+  ASSERT_OK_AND_EQ(100, reader->ReadAt(42, 100, host_data));
+  ASSERT_EQ(0, std::memcmp(host_data, data->data() + 42, 100));
+
+  // Reads into an existing device buffer
+  ASSERT_OK_AND_ASSIGN(auto cuda_buffer, context_->Allocate(100));
+  ASSERT_OK_AND_EQ(100, reader->ReadAt(42, 100, cuda_buffer.get()));
+  ASSERT_OK(cuda_buffer->CopyToHost(0, 100, host_data));
+  ASSERT_EQ(0, std::memcmp(host_data, data->data() + 42, 100));
+  ASSERT_RAISES(Invalid, reader->ReadAt(0, 200, cuda_buffer.get()));
+
+  ASSERT_OK(reader->Close());
+  ASSERT_RAISES(Invalid, reader->ReadAt(0, 100));
+}
+
+TEST_F(TestCudaFileReader, ReadRecordBatch) {
+  // An IPC message preceded by some unrelated data
+  const int64_t offset = 64;
+  ASSERT_OK_AND_ASSIGN(auto serialized, ipc::SerializeRecordBatch(
+                                            *batch_, ipc::IpcWriteOptions::Defaults()));
+  const std::string path = TempFile("batch.arrow");
+  ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path));
+  ASSERT_OK(out->Write(std::string(offset, 'x')));
+  ASSERT_OK(out->Write(serialized));
+  ASSERT_OK(out->Close());
+
+  auto reader = OpenReader(path);
+  if (reader == nullptr) {
+    GTEST_SKIP() << "Arrow was built without GPUDirect Storage support";
+  }
+  ipc::DictionaryMemo unused_memo;
+  ASSERT_OK_AND_ASSIGN(auto device_batch, ReadRecordBatch(batch_->schema(), &unused_memo,
+                                                          reader.get(), offset));
+  CompareBatch(*batch_, *ToHost(*device_batch));
+
+  ASSERT_RAISES(Invalid, ReadRecordBatch(batch_->schema(), &unused_memo, reader.get(),
+                                         offset + serialized->size()));
+}
+
+TEST_F(TestCudaFileReader, RecordBatchFileReader) {
+  const std::string path = TempFile("batches.arrow");
+  ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path));
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(out, batch_->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch_));
+  ASSERT_OK(writer->WriteRecordBatch(*batch_));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(out->Close());
+
+  auto reader = OpenReader(path);
+  if (reader == nullptr) {
+    GTEST_SKIP() << "Arrow was built without GPUDirect Storage support";
+  }
+  // The footer and the message metadata are copied back to the host, the
+  // message bodies stay on the device
+  ASSERT_OK_AND_ASSIGN(auto file_reader, ipc::RecordBatchFileReader::Open(reader));
+  ASSERT_EQ(2, file_reader->num_record_batches());
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto device_batch, file_reader->ReadRecordBatch(i));
+    CompareBatch(*batch_, *ToHost(*device_batch));
+  }
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -17,7 +17,13 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,15 +33,47 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
 
 namespace arrow {
 namespace io {
 
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
-                      internal::ReadRangeCache::kDefaultRangeSizeLimit};
+                      internal::ReadRangeCache::kDefaultRangeSizeLimit,
+                      /*adaptive=*/false, /*evict_consumed=*/false};
 }
 
+CacheOptions CacheOptions::AdaptiveDefaults() {
+  return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
+                      internal::ReadRangeCache::kDefaultRangeSizeLimit,
+                      /*adaptive=*/true, /*evict_consumed=*/true};
+}
+
+namespace {
+
+// See MakeFromNetworkMetrics for the derivation
+CacheOptions MakeFromMetrics(double time_to_first_byte_sec,
+                             double transfer_bandwidth_bytes_per_sec,
+                             double ideal_bandwidth_utilization_frac,
+                             int64_t max_ideal_request_size_bytes) {
+  // hole_size_limit = TTFB * BW
+  const auto hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  const int64_t range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+
+  return {hole_size_limit, range_size_limit, /*adaptive=*/false,
+          /*evict_consumed=*/false};
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_millis,
                                                   int64_t transfer_bandwidth_mib_per_sec,
                                                   double ideal_bandwidth_utilization_frac,
@@ -104,27 +142,88 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  auto options = MakeFromMetrics(
+      time_to_first_byte_sec, static_cast<double>(transfer_bandwidth_bytes_per_sec),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes);
+  DCHECK_GT(options.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(options.range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return options;
+}
 
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
+namespace internal {
+
+namespace {
+
+// Time-to-first-byte and bandwidth of the reads of a RandomAccessFile
+// implementation, estimated by a least-squares fit of read durations
+// against read sizes.  Older reads are given exponentially decaying weights
+// so that the estimates follow changing conditions.
+class ReadMetrics {
+ public:
+  void Record(int64_t nbytes, double seconds) {
+    const double x = static_cast<double>(nbytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    weight_ = weight_ * kDecay + 1;
+    sum_x_ = sum_x_ * kDecay + x;
+    sum_y_ = sum_y_ * kDecay + seconds;
+    sum_xx_ = sum_xx_ * kDecay + x * x;
+    sum_xy_ = sum_xy_ * kDecay + x * seconds;
+    ++num_reads_;
+  }
+
+  // Return false if the reads observed so far don't allow an estimate
+  bool Estimate(double* time_to_first_byte_sec, double* bandwidth_bytes_per_sec) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (num_reads_ < kMinReads) {
+      return false;
+    }
+    // Reads of similar sizes can't tell latency and bandwidth apart
+    const double variance = weight_ * sum_xx_ - sum_x_ * sum_x_;
+    if (variance <= kMinRelativeVariance * weight_ * sum_xx_) {
+      return false;
+    }
+    const double slope = (weight_ * sum_xy_ - sum_x_ * sum_y_) / variance;
+    if (!(slope > 0)) {
+      return false;
+    }
+    *time_to_first_byte_sec = std::max(0.0, (sum_y_ - slope * sum_x_) / weight_);
+    *bandwidth_bytes_per_sec = 1 / slope;
+    return true;
+  }
+
+ private:
+  static constexpr double kDecay = 0.95;
+  static constexpr int64_t kMinReads = 8;
+  static constexpr double kMinRelativeVariance = 0.01;
 
-  return {hole_size_limit, range_size_limit};
+  std::mutex mutex_;
+  double weight_ = 0, sum_x_ = 0, sum_y_ = 0, sum_xx_ = 0, sum_xy_ = 0;
+  int64_t num_reads_ = 0;
+};
+
+constexpr double ReadMetrics::kDecay;
+constexpr int64_t ReadMetrics::kMinReads;
+constexpr double ReadMetrics::kMinRelativeVariance;
+
+ReadMetrics* GetReadMetrics(const RandomAccessFile& file) {
+  static std::mutex mutex;
+  static std::unordered_map<std::type_index, std::unique_ptr<ReadMetrics>> metrics;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& entry = metrics[std::type_index(typeid(file))];
+  if (entry == nullptr) {
+    entry.reset(new ReadMetrics());
+  }
+  return entry.get();
 }
 
-namespace internal {
+}  // namespace
 
 struct RangeCacheEntry {
   ReadRange range;
   Future<std::shared_ptr<Buffer>> future;
+  // Total length of the ranges given to Cache() which were combined into
+  // this entry and not read yet (only maintained with evict_consumed)
+  int64_t unread_bytes;
 
   friend bool operator<(const RangeCacheEntry& left, const RangeCacheEntry& right) {
     return left.range.offset < right.range.offset;
@@ -135,6 +234,11 @@ struct ReadRangeCache::Impl {
   std::shared_ptr<RandomAccessFile> file;
   IOContext ctx;
   CacheOptions options;
+  // Non-null if options.adaptive
+  ReadMetrics* metrics = nullptr;
+
+  // Protects entries, which are modified by Read() with evict_consumed
+  std::mutex mutex;
 
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
@@ -150,6 +254,15 @@ struct ReadRangeCache::Impl {
       entries = std::move(new_entries);
     }
   }
+
+  // Find the entry that may contain the given range
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    return std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+  }
 };
 
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, IOContext ctx,
@@ -158,21 +271,67 @@ ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, IOContext
   impl_->file = std::move(file);
   impl_->ctx = std::move(ctx);
   impl_->options = options;
+  if (options.adaptive) {
+    impl_->metrics = GetReadMetrics(*impl_->file);
+  }
 }
 
 ReadRangeCache::~ReadRangeCache() = default;
 
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
-  ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
-                                        impl_->options.range_size_limit);
+  int64_t hole_size_limit = impl_->options.hole_size_limit;
+  int64_t range_size_limit = impl_->options.range_size_limit;
+  double time_to_first_byte_sec, bandwidth_bytes_per_sec;
+  if (impl_->metrics != nullptr &&
+      impl_->metrics->Estimate(&time_to_first_byte_sec, &bandwidth_bytes_per_sec)) {
+    const auto adapted = MakeFromMetrics(
+        time_to_first_byte_sec, bandwidth_bytes_per_sec,
+        CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+        CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024);
+    hole_size_limit = adapted.hole_size_limit;
+    range_size_limit = std::max<int64_t>(1, adapted.range_size_limit);
+  }
+
+  std::vector<ReadRange> requested;
+  if (impl_->options.evict_consumed) {
+    requested = ranges;
+  }
+  ranges = internal::CoalesceReadRanges(std::move(ranges), hole_size_limit,
+                                        range_size_limit);
   std::vector<RangeCacheEntry> entries;
   entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(impl_->ctx, range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  const auto start = std::chrono::steady_clock::now();
+  auto futures = impl_->file->ReadManyAsync(impl_->ctx, ranges);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& range = ranges[i];
+    auto fut = std::move(futures[i]);
+    if (impl_->metrics != nullptr) {
+      ReadMetrics* metrics = impl_->metrics;
+      fut.AddCallback([metrics, start](const Result<std::shared_ptr<Buffer>>& result) {
+        if (result.ok()) {
+          const std::chrono::duration<double> elapsed =
+              std::chrono::steady_clock::now() - start;
+          metrics->Record((*result)->size(), elapsed.count());
+        }
+      });
+    }
+    entries.push_back({range, std::move(fut), /*unread_bytes=*/0});
+  }
+  for (const auto& range : requested) {
+    if (range.length == 0) continue;
+    auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    DCHECK(it != entries.end() && it->range.Contains(range));
+    it->unread_bytes += range.length;
   }
 
-  impl_->AddEntries(std::move(entries));
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->AddEntries(std::move(entries));
+  }
   // Prefetch immediately, regardless of executor availability, if possible
   return impl_->file->WillNeed(ranges);
 }
@@ -182,20 +341,32 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
     static const uint8_t byte = 0;
     return std::make_shared<Buffer>(&byte, 0);
   }
+  ARROW_TRACE_SPAN(span, "arrow::io::ReadRangeCache::Read");
+  ARROW_TRACE_SPAN_ATTRIBUTE(span, "bytes", range.length);
 
-  const auto it = std::lower_bound(
-      impl_->entries.begin(), impl_->entries.end(), range,
-      [](const RangeCacheEntry& entry, const ReadRange& range) {
-        return entry.range.offset + entry.range.length < range.offset + range.length;
-      });
-  if (it != impl_->entries.end() && it->range.Contains(range)) {
-    ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
-    return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
+  Future<std::shared_ptr<Buffer>> future;
+  int64_t entry_offset;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    const auto it = impl_->FindEntry(range);
+    if (it == impl_->entries.end() || !it->range.Contains(range)) {
+      return Status::Invalid("ReadRangeCache did not find matching cache entry");
+    }
+    future = it->future;
+    entry_offset = it->range.offset;
+    if (impl_->options.evict_consumed) {
+      it->unread_bytes -= range.length;
+      if (it->unread_bytes <= 0) {
+        impl_->entries.erase(it);
+      }
+    }
   }
-  return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  ARROW_ASSIGN_OR_RAISE(auto buf, future.result());
+  return SliceBuffer(std::move(buf), range.offset - entry_offset, range.length);
 }
 
 Future<> ReadRangeCache::Wait() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
   std::vector<Future<>> futures;
   for (const auto& entry : impl_->entries) {
     futures.emplace_back(entry.future);
@@ -203,6 +374,21 @@ Future<> ReadRangeCache::Wait() {
   return AllComplete(futures);
 }
 
+Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  std::vector<Future<>> futures;
+  for (const auto& range : ranges) {
+    if (range.length == 0) continue;
+    const auto it = impl_->FindEntry(range);
+    if (it == impl_->entries.end() || !it->range.Contains(range)) {
+      return Status::Invalid("Range was not requested for caching: offset=",
+                             range.offset, " length=", range.length);
+    }
+    futures.emplace_back(it->future);
+  }
+  return AllComplete(futures);
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
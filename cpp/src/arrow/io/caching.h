@@ -41,10 +41,27 @@ struct ARROW_EXPORT CacheOptions {
   ///   combining two consecutive ranges would produce a range of a
   ///   size greater than this, they are not combined
   int64_t range_size_limit;
+  /// \brief Whether to derive the above limits from the I/O performance
+  ///   observed at runtime
+  ///
+  /// If true, the time-to-first-byte and the bandwidth of the reads issued
+  /// by all caches are measured separately for each RandomAccessFile
+  /// implementation (hence, in practice, for each filesystem), and the limits
+  /// are computed from them as in MakeFromNetworkMetrics.  Until enough reads
+  /// of various sizes were observed, the limits above are used.
+  bool adaptive;
+  /// \brief Whether to release cached data once it has been read
+  ///
+  /// If true, a combined range is dropped from the cache once all the ranges
+  /// it was made of have been read, so that long scans don't keep every range
+  /// in memory until the cache is destroyed.  Each range given to Cache() may
+  /// then be read only once.
+  bool evict_consumed;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
-           range_size_limit == other.range_size_limit;
+           range_size_limit == other.range_size_limit &&
+           adaptive == other.adaptive && evict_consumed == other.evict_consumed;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -67,6 +84,8 @@ struct ARROW_EXPORT CacheOptions {
       int64_t max_ideal_request_size_mib = kDefaultMaxIdealRequestSizeMib);
 
   static CacheOptions Defaults();
+  /// \brief Defaults with adaptive limits and eviction of consumed ranges
+  static CacheOptions AdaptiveDefaults();
 };
 
 namespace internal {
@@ -98,11 +117,18 @@ class ARROW_EXPORT ReadRangeCache {
   Status Cache(std::vector<ReadRange> ranges);
 
   /// \brief Read a range previously given to Cache().
+  ///
+  /// With CacheOptions::evict_consumed, each range can only be read once.
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
   /// \brief Wait until all ranges added so far have been cached.
   Future<> Wait();
 
+  /// \brief Wait until all given ranges have been cached.
+  ///
+  /// Each range must have been previously given to Cache().
+  Future<> WaitFor(std::vector<ReadRange> ranges);
+
  protected:
   struct Impl;
   std::unique_ptr<Impl> impl_;
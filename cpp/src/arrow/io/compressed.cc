@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,16 +30,297 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 
+using internal::Executor;
 using util::Codec;
 using util::Compressor;
 using util::Decompressor;
 
 namespace io {
 
+ParallelCompressionOptions ParallelCompressionOptions::Defaults() {
+  return ParallelCompressionOptions();
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Independent frames of compressed streams
+
+// A BGZF block holds at most 64 KiB of compressed data, so that the
+// uncompressed size of a block is capped to leave room for incompressible data.
+constexpr int64_t kMaxBgzfBlockSize = 1 << 16;
+constexpr int64_t kMaxBgzfInputSize = 0xff00;
+constexpr int64_t kGzipHeaderSize = 10;
+// Size of the extra field and its length
+constexpr int64_t kBgzfExtraSize = 8;
+
+// Don't buffer more than this looking for the end of a frame
+constexpr int64_t kMaxParallelFrameSize = 64 << 20;
+
+bool SupportsParallelFrames(Compression::type compression) {
+  return compression == Compression::GZIP || compression == Compression::ZSTD ||
+         compression == Compression::LZ4_FRAME;
+}
+
+uint32_t LoadLE32(const uint8_t* data) {
+  return BitUtil::FromLittleEndian(util::SafeLoadAs<uint32_t>(data));
+}
+
+uint16_t LoadLE16(const uint8_t* data) {
+  return BitUtil::FromLittleEndian(util::SafeLoadAs<uint16_t>(data));
+}
+
+// Each of the following returns the size of the frame at the start of `data`,
+// 0 if `data` doesn't hold the complete frame, or -1 if the frame is not in the
+// expected format.
+
+int64_t CompleteFrameSize(int64_t frame_size, int64_t size) {
+  return frame_size <= size ? frame_size : 0;
+}
+
+int64_t FindSkippableFrameSize(const uint8_t* data, int64_t size) {
+  // Skippable frames are common to the ZSTD and LZ4 frame formats
+  if (size < 8) {
+    return 0;
+  }
+  return CompleteFrameSize(8 + static_cast<int64_t>(LoadLE32(data + 4)), size);
+}
+
+int64_t FindZstdFrameSize(const uint8_t* data, int64_t size) {
+  constexpr uint32_t kMagic = 0xFD2FB528U;
+  constexpr uint32_t kSkippableMagic = 0x184D2A50U;
+  if (size < 5) {
+    return 0;
+  }
+  const uint32_t magic = LoadLE32(data);
+  if ((magic & 0xFFFFFFF0U) == kSkippableMagic) {
+    return FindSkippableFrameSize(data, size);
+  }
+  if (magic != kMagic) {
+    return -1;
+  }
+  const uint8_t descriptor = data[4];
+  const int content_size_flag = descriptor >> 6;
+  const bool single_segment = (descriptor >> 5) & 1;
+  const bool has_checksum = (descriptor >> 2) & 1;
+  static constexpr int kDictionaryIdSizes[] = {0, 1, 2, 4};
+  int64_t pos = 5 + (single_segment ? 0 : 1) + kDictionaryIdSizes[descriptor & 3];
+  if (content_size_flag == 0) {
+    pos += single_segment ? 1 : 0;
+  } else {
+    pos += 1 << content_size_flag;
+  }
+  while (true) {
+    if (pos + 3 > size) {
+      return 0;
+    }
+    const uint32_t header = data[pos] | (data[pos + 1] << 8) | (data[pos + 2] << 16);
+    const bool last_block = header & 1;
+    const int block_type = (header >> 1) & 3;
+    if (block_type == 3) {
+      // Reserved block type
+      return -1;
+    }
+    // RLE blocks store a single byte
+    pos += 3 + (block_type == 1 ? 1 : static_cast<int64_t>(header >> 3));
+    if (last_block) {
+      return CompleteFrameSize(pos + (has_checksum ? 4 : 0), size);
+    }
+  }
+}
+
+int64_t FindLz4FrameSize(const uint8_t* data, int64_t size) {
+  constexpr uint32_t kMagic = 0x184D2204U;
+  constexpr uint32_t kSkippableMagic = 0x184D2A50U;
+  if (size < 7) {
+    return 0;
+  }
+  const uint32_t magic = LoadLE32(data);
+  if ((magic & 0xFFFFFFF0U) == kSkippableMagic) {
+    return FindSkippableFrameSize(data, size);
+  }
+  const uint8_t flags = data[4];
+  if (magic != kMagic || (flags >> 6) != 1) {
+    return -1;
+  }
+  const bool has_block_checksums = flags & 0x10;
+  const bool has_content_checksum = flags & 0x04;
+  // Magic, flags, block descriptor, optional content size and dictionary id,
+  // header checksum
+  int64_t pos = 6 + ((flags & 0x08) ? 8 : 0) + ((flags & 0x01) ? 4 : 0) + 1;
+  while (true) {
+    if (pos + 4 > size) {
+      return 0;
+    }
+    const uint32_t block_size = LoadLE32(data + pos);
+    pos += 4;
+    if (block_size == 0) {
+      // End mark
+      return CompleteFrameSize(pos + (has_content_checksum ? 4 : 0), size);
+    }
+    // The high bit flags uncompressed blocks
+    pos += (block_size & 0x7FFFFFFFU) + (has_block_checksums ? 4 : 0);
+  }
+}
+
+int64_t FindBgzfBlockSize(const uint8_t* data, int64_t size) {
+  if (size < kGzipHeaderSize + 2) {
+    return 0;
+  }
+  // A gzip member with an extra field...
+  if (data[0] != 0x1f || data[1] != 0x8b || data[2] != 8 || !(data[3] & 0x04)) {
+    return -1;
+  }
+  const int64_t extra_end = kGzipHeaderSize + 2 + LoadLE16(data + kGzipHeaderSize);
+  if (extra_end > size) {
+    return 0;
+  }
+  // ...holding the block size in a "BC" subfield
+  int64_t pos = kGzipHeaderSize + 2;
+  while (pos + 4 <= extra_end) {
+    const uint16_t subfield_size = LoadLE16(data + pos + 2);
+    if (data[pos] == 'B' && data[pos + 1] == 'C' && subfield_size == 2 &&
+        pos + 6 <= extra_end) {
+      return CompleteFrameSize(LoadLE16(data + pos + 4) + 1, size);
+    }
+    pos += 4 + subfield_size;
+  }
+  return -1;
+}
+
+int64_t FindFrameSize(Compression::type compression, const uint8_t* data,
+                      int64_t size) {
+  switch (compression) {
+    case Compression::ZSTD:
+      return FindZstdFrameSize(data, size);
+    case Compression::LZ4_FRAME:
+      return FindLz4FrameSize(data, size);
+    case Compression::GZIP:
+      return FindBgzfBlockSize(data, size);
+    default:
+      return -1;
+  }
+}
+
+// Turn a gzip member into a BGZF block, by adding the block size as an extra
+// field of the header
+Result<std::shared_ptr<Buffer>> MakeBgzfBlock(const Buffer& member, MemoryPool* pool) {
+  const uint8_t* data = member.data();
+  if (member.size() < kGzipHeaderSize || data[0] != 0x1f || data[1] != 0x8b ||
+      data[3] != 0) {
+    return Status::UnknownError("Unexpected gzip header");
+  }
+  const int64_t block_size = member.size() + kBgzfExtraSize;
+  if (block_size > kMaxBgzfBlockSize) {
+    return Status::Invalid("Compressed frame too large for a BGZF block");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto block, AllocateBuffer(block_size, pool));
+  uint8_t* out = block->mutable_data();
+  std::memcpy(out, data, kGzipHeaderSize);
+  out[3] = 0x04;  // FEXTRA
+  const uint16_t block_size_minus_one = static_cast<uint16_t>(block_size - 1);
+  const uint8_t extra[kBgzfExtraSize] = {
+      kBgzfExtraSize - 2, 0, 'B', 'C', 2, 0,
+      static_cast<uint8_t>(block_size_minus_one & 0xff),
+      static_cast<uint8_t>(block_size_minus_one >> 8)};
+  std::memcpy(out + kGzipHeaderSize, extra, sizeof(extra));
+  std::memcpy(out + kGzipHeaderSize + sizeof(extra), data + kGzipHeaderSize,
+              member.size() - kGzipHeaderSize);
+  return std::move(block);
+}
+
+Result<std::shared_ptr<Buffer>> CompressFrame(Codec* codec, MemoryPool* pool,
+                                              std::shared_ptr<Buffer> frame) {
+  // A Compressor per frame, as the one-shot API of some codecs is not thread-safe
+  ARROW_ASSIGN_OR_RAISE(auto compressor, codec->MakeCompressor());
+  ARROW_ASSIGN_OR_RAISE(
+      auto compressed,
+      AllocateResizableBuffer(codec->MaxCompressedLen(frame->size(), frame->data()),
+                              pool));
+  const uint8_t* input = frame->data();
+  int64_t input_len = frame->size();
+  int64_t compressed_pos = 0;
+  while (input_len > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        compressor->Compress(input_len, input, compressed->size() - compressed_pos,
+                             compressed->mutable_data() + compressed_pos));
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    compressed_pos += result.bytes_written;
+    if (result.bytes_read == 0) {
+      RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, compressor->End(compressed->size() - compressed_pos,
+                                     compressed->mutable_data() + compressed_pos));
+    compressed_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+  }
+  RETURN_NOT_OK(compressed->Resize(compressed_pos));
+  if (codec->compression_type() == Compression::GZIP && compressed_pos > 2 &&
+      compressed->data()[0] == 0x1f && compressed->data()[1] == 0x8b) {
+    return MakeBgzfBlock(*compressed, pool);
+  }
+  return std::move(compressed);
+}
+
+Result<std::shared_ptr<ResizableBuffer>> DecompressFrame(Codec* codec, MemoryPool* pool,
+                                                         std::shared_ptr<Buffer> frame) {
+  ARROW_ASSIGN_OR_RAISE(auto decompressor, codec->MakeDecompressor());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> decompressed,
+                        AllocateResizableBuffer(
+                            std::max<int64_t>(frame->size() * 4, 4096), pool));
+  const uint8_t* input = frame->data();
+  int64_t input_len = frame->size();
+  int64_t decompressed_pos = 0;
+  while (!decompressor->IsFinished()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        decompressor->Decompress(input_len, input,
+                                 decompressed->size() - decompressed_pos,
+                                 decompressed->mutable_data() + decompressed_pos));
+    input += result.bytes_read;
+    input_len -= result.bytes_read;
+    decompressed_pos += result.bytes_written;
+    if (decompressed_pos == decompressed->size() ||
+        (result.need_more_output && input_len > 0 && result.bytes_written == 0)) {
+      RETURN_NOT_OK(decompressed->Resize(decompressed->size() * 2));
+    } else if (result.bytes_read == 0 && result.bytes_written == 0) {
+      return Status::IOError("Truncated compressed stream");
+    }
+  }
+  RETURN_NOT_OK(decompressed->Resize(decompressed_pos));
+  return decompressed;
+}
+
+Executor* GetExecutor(const ParallelCompressionOptions& options) {
+  return options.executor != nullptr ? options.executor
+                                       : ::arrow::internal::GetCpuThreadPool();
+}
+
+int32_t GetMaxFramesInFlight(const ParallelCompressionOptions& options) {
+  if (options.max_frames_in_flight > 0) {
+    return options.max_frames_in_flight;
+  }
+  return std::max(2 * GetExecutor(options)->GetCapacity(), 1);
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
@@ -55,6 +337,24 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status Init(Codec* codec, const ParallelCompressionOptions& options) {
+    RETURN_NOT_OK(Init(codec));
+    if (SupportsParallelFrames(codec->compression_type())) {
+      if (options.frame_size <= 0) {
+        return Status::Invalid("Frame size must be positive");
+      }
+      parallel_ = true;
+      codec_ = codec;
+      executor_ = GetExecutor(options);
+      max_frames_in_flight_ = GetMaxFramesInFlight(options);
+      frame_size_ = options.frame_size;
+      if (codec->compression_type() == Compression::GZIP) {
+        frame_size_ = std::min(frame_size_, kMaxBgzfInputSize);
+      }
+    }
+    return Status::OK();
+  }
+
   Result<int64_t> Tell() const {
     std::lock_guard<std::mutex> guard(lock_);
     return total_pos_;
@@ -70,10 +370,68 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  // Compress the current frame in the background
+  Status SubmitFrame() {
+    std::shared_ptr<Buffer> frame;
+    if (frame_ != nullptr) {
+      RETURN_NOT_OK(frame_->Resize(frame_pos_));
+      frame = std::move(frame_);
+    } else {
+      frame = std::make_shared<Buffer>(nullptr, 0);
+    }
+    frame_pos_ = 0;
+    ARROW_ASSIGN_OR_RAISE(auto fut, executor_->Submit(CompressFrame, codec_, pool_,
+                                                      std::move(frame)));
+    compressed_frames_.push_back(std::move(fut));
+    wrote_frame_ = true;
+    return WriteFrames(max_frames_in_flight_);
+  }
+
+  // Write compressed frames, in order, until at most `max_pending` are left
+  Status WriteFrames(size_t max_pending) {
+    while (!compressed_frames_.empty() &&
+           (compressed_frames_.size() > max_pending ||
+            compressed_frames_.front().is_finished())) {
+      auto fut = std::move(compressed_frames_.front());
+      compressed_frames_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto compressed, fut.result());
+      RETURN_NOT_OK(raw_->Write(compressed));
+    }
+    return Status::OK();
+  }
+
+  void WaitForFrames() {
+    for (auto& fut : compressed_frames_) {
+      fut.Wait();
+    }
+    compressed_frames_.clear();
+  }
+
+  Status WriteParallel(const uint8_t* input, int64_t nbytes) {
+    while (nbytes > 0) {
+      if (frame_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(frame_, AllocateResizableBuffer(frame_size_, pool_));
+      }
+      const int64_t chunk_size = std::min(nbytes, frame_size_ - frame_pos_);
+      std::memcpy(frame_->mutable_data() + frame_pos_, input, chunk_size);
+      frame_pos_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (frame_pos_ == frame_size_) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+    }
+    return Status::OK();
+  }
+
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
+    if (parallel_) {
+      return WriteParallel(input, nbytes);
+    }
     while (nbytes > 0) {
       int64_t input_len = nbytes;
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -111,6 +469,13 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (parallel_) {
+      if (frame_pos_ > 0) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      return WriteFrames(0);
+    }
+
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +497,17 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (parallel_) {
+      if (frame_pos_ > 0) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      // BGZF files end with an empty block, and an empty stream needs a frame
+      if (codec_->compression_type() == Compression::GZIP || !wrote_frame_) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+      return WriteFrames(0);
+    }
+
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -158,7 +534,10 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
-      RETURN_NOT_OK(FinalizeCompression());
+      Status st = FinalizeCompression();
+      // Don't leave tasks referring to the codec behind
+      WaitForFrames();
+      RETURN_NOT_OK(st);
       return raw_->Close();
     } else {
       return Status::OK();
@@ -170,6 +549,7 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      WaitForFrames();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -194,6 +574,18 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Parallel compression of independent frames
+  bool parallel_ = false;
+  Codec* codec_ = nullptr;
+  Executor* executor_ = nullptr;
+  size_t max_frames_in_flight_ = 0;
+  int64_t frame_size_ = 0;
+  // Uncompressed data of the current frame
+  std::shared_ptr<ResizableBuffer> frame_;
+  int64_t frame_pos_ = 0;
+  std::deque<Future<std::shared_ptr<Buffer>>> compressed_frames_;
+  bool wrote_frame_ = false;
+
   mutable std::mutex lock_;
 };
 
@@ -206,6 +598,16 @@ Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
   return res;
 }
 
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    const ParallelCompressionOptions& options, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->Init(codec, options));
+  return res;
+}
+
 CompressedOutputStream::~CompressedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedOutputStream::Close() { return impl_->Close(); }
@@ -243,9 +645,28 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  Status Init(Codec* codec, const ParallelCompressionOptions& options) {
+    RETURN_NOT_OK(Init(codec));
+    if (SupportsParallelFrames(codec->compression_type())) {
+      parallel_ = true;
+      codec_ = codec;
+      executor_ = GetExecutor(options);
+      max_frames_in_flight_ = GetMaxFramesInFlight(options);
+    }
+    return Status::OK();
+  }
+
+  void WaitForFrames() {
+    for (auto& fut : decompressed_frames_) {
+      fut.Wait();
+    }
+    decompressed_frames_.clear();
+  }
+
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      WaitForFrames();
       return raw_->Close();
     } else {
       return Status::OK();
@@ -255,6 +676,7 @@ class CompressedInputStream::Impl {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      WaitForFrames();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -326,8 +748,89 @@ class CompressedInputStream::Impl {
     return read_bytes;
   }
 
+  // Hand the compressed data that is not split into frames to the serial
+  // decompressor
+  void StopParallel() {
+    parallel_ = false;
+    compressed_ = std::move(pending_);
+    compressed_pos_ = pending_pos_;
+  }
+
+  // Split the compressed data into frames and submit them for decompression,
+  // until enough frames are in flight.
+  Status SubmitFrames() {
+    const auto compression = codec_->compression_type();
+    while (parallel_ && decompressed_frames_.size() < max_frames_in_flight_) {
+      const int64_t available = pending_ ? pending_->size() - pending_pos_ : 0;
+      int64_t frame_size = 0;
+      if (available > 0) {
+        frame_size =
+            FindFrameSize(compression, pending_->data() + pending_pos_, available);
+      }
+      if (frame_size < 0 || (frame_size == 0 && available > kMaxParallelFrameSize)) {
+        // Not a stream of independent frames, or too large frames
+        StopParallel();
+        break;
+      }
+      if (frame_size > 0) {
+        auto frame = SliceBuffer(pending_, pending_pos_, frame_size);
+        pending_pos_ += frame_size;
+        ARROW_ASSIGN_OR_RAISE(auto fut, executor_->Submit(DecompressFrame, codec_, pool_,
+                                                          std::move(frame)));
+        decompressed_frames_.push_back(std::move(fut));
+        continue;
+      }
+      // Need more compressed data
+      if (raw_eof_) {
+        if (available > 0) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        break;
+      }
+      // Read at least as much as buffered, to keep large frames linear
+      const int64_t read_size =
+          std::max(available, static_cast<int64_t>(kParallelChunkSize));
+      ARROW_ASSIGN_OR_RAISE(auto chunk, raw_->Read(read_size));
+      if (chunk->size() == 0) {
+        raw_eof_ = true;
+      } else if (available > 0) {
+        ARROW_ASSIGN_OR_RAISE(
+            pending_, ConcatenateBuffers({SliceBuffer(pending_, pending_pos_), chunk},
+                                         pool_));
+        pending_pos_ = 0;
+      } else {
+        pending_ = std::move(chunk);
+        pending_pos_ = 0;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status RefillFromFrames(bool* has_data) {
+    RETURN_NOT_OK(SubmitFrames());
+    if (decompressed_frames_.empty()) {
+      if (parallel_) {
+        *has_data = false;
+        return Status::OK();
+      }
+      // Continue with serial decompression
+      return RefillDecompressed(has_data);
+    }
+    auto fut = std::move(decompressed_frames_.front());
+    decompressed_frames_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(decompressed_, fut.result());
+    decompressed_pos_ = 0;
+    // Keep the pipeline full while the caller consumes this frame
+    RETURN_NOT_OK(SubmitFrames());
+    *has_data = true;
+    return Status::OK();
+  }
+
   // Try to feed more data into the decompressed_ buffer.
   Status RefillDecompressed(bool* has_data) {
+    if (parallel_ || !decompressed_frames_.empty()) {
+      return RefillFromFrames(has_data);
+    }
     // First try to read data from the decompressor
     if (compressed_) {
       if (decompressor_->IsFinished()) {
@@ -390,6 +893,8 @@ class CompressedInputStream::Impl {
   static const int64_t kChunkSize = 64 * 1024;
   // Decompress 1 MB at a time
   static const int64_t kDecompressSize = 1024 * 1024;
+  // Read 1 MB compressed data at a time when decompressing frames in parallel
+  static const int64_t kParallelChunkSize = 1024 * 1024;
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
@@ -405,6 +910,17 @@ class CompressedInputStream::Impl {
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  // Parallel decompression of independent frames
+  bool parallel_ = false;
+  Codec* codec_ = nullptr;
+  Executor* executor_ = nullptr;
+  size_t max_frames_in_flight_ = 0;
+  // Compressed data not yet split into frames
+  std::shared_ptr<Buffer> pending_;
+  int64_t pending_pos_ = 0;
+  bool raw_eof_ = false;
+  std::deque<Future<std::shared_ptr<ResizableBuffer>>> decompressed_frames_;
 };
 
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
@@ -417,6 +933,16 @@ Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
   return Status::OK();
 }
 
+Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
+    Codec* codec, const std::shared_ptr<InputStream>& raw,
+    const ParallelCompressionOptions& options, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->Init(codec, options));
+  return res;
+}
+
 CompressedInputStream::~CompressedInputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedInputStream::DoClose() { return impl_->Close(); }
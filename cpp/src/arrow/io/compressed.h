@@ -24,6 +24,7 @@
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -39,6 +40,32 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for compressing or decompressing independent frames in parallel
+///
+/// Streams written as a sequence of independently compressed frames can be
+/// compressed and decompressed by several threads, with the data kept in
+/// order.  This is supported for ZSTD and LZ4_FRAME (multi-frame streams), and
+/// for GZIP with the BGZF format (as written by bgzip or htslib).
+///
+/// Other codecs and streams are (de)compressed serially, as without these
+/// options.  Such streams remain readable by any decompressor.
+struct ARROW_EXPORT ParallelCompressionOptions {
+  /// \brief Uncompressed size of the frames written by CompressedOutputStream
+  ///
+  /// GZIP frames are BGZF blocks, whose uncompressed size is capped to 65280 bytes.
+  int64_t frame_size = 1 << 20;
+
+  /// \brief Maximum number of frames being compressed or decompressed at once
+  ///
+  /// If 0, twice the capacity of the executor.
+  int32_t max_frames_in_flight = 0;
+
+  /// \brief Executor running the compression tasks (default: the CPU thread pool)
+  ::arrow::internal::Executor* executor = NULLPTR;
+
+  static ParallelCompressionOptions Defaults();
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -48,6 +75,13 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed output stream writing independent frames
+  /// compressed in parallel.
+  static Result<std::shared_ptr<CompressedOutputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      const ParallelCompressionOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -86,6 +120,16 @@ class ARROW_EXPORT CompressedInputStream
       util::Codec* codec, const std::shared_ptr<InputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed input stream decompressing independent frames
+  /// in parallel.
+  ///
+  /// Streams whose frames cannot be found without decompressing them (such as
+  /// regular gzip files) are decompressed serially.
+  static Result<std::shared_ptr<CompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      const ParallelCompressionOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   // InputStream interface
 
   bool closed() const override;
@@ -79,12 +79,8 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
   return std::move(compressed);
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
-  // Create compressed input stream
-  auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
-
+Status ReadCompressedInputStream(CompressedInputStream* stream, int64_t* stream_pos,
+                                 std::vector<uint8_t>* out) {
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
   const int64_t chunk_size = 1111;
@@ -105,6 +101,14 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return Status::OK();
 }
 
+Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+  // Create compressed input stream
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  return ReadCompressedInputStream(stream.get(), stream_pos, out);
+}
+
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
                                 std::vector<uint8_t>* out) {
   return RunCompressedInputStream(codec, compressed, nullptr, out);
@@ -153,6 +157,43 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+Status RunParallelCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                        const ParallelCompressionOptions& options,
+                                        std::vector<uint8_t>* out) {
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        CompressedInputStream::Make(codec, buffer_reader, options));
+  int64_t stream_pos = -1;
+  RETURN_NOT_OK(ReadCompressedInputStream(stream.get(), &stream_pos, out));
+  if (stream_pos != static_cast<int64_t>(out->size())) {
+    return Status::Invalid("Unexpected stream position");
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<Buffer> CompressDataParallel(Codec* codec,
+                                             const std::vector<uint8_t>& data,
+                                             const ParallelCompressionOptions& options,
+                                             bool do_flush = false) {
+  auto buffer_writer = *BufferOutputStream::Create();
+  auto stream = *CompressedOutputStream::Make(codec, buffer_writer, options);
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 11111;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ABORT_NOT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      ABORT_NOT_OK(stream->Flush());
+    }
+  }
+  ABORT_NOT_OK(stream->Close());
+  return *buffer_writer->Finish();
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -252,6 +293,92 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+class ParallelCompressedStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  std::unique_ptr<Codec> MakeCodec() { return *Codec::Create(GetParam()); }
+
+  ParallelCompressionOptions MakeOptions() {
+    auto options = ParallelCompressionOptions::Defaults();
+    options.frame_size = 50000;
+    options.max_frames_in_flight = 4;
+    return options;
+  }
+
+  void CheckRoundtrip(const std::vector<uint8_t>& data, bool do_flush) {
+    auto codec = MakeCodec();
+    auto options = MakeOptions();
+    auto compressed = CompressDataParallel(codec.get(), data, options, do_flush);
+
+    // Independent frames are readable by a serial decompressor...
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+    ASSERT_EQ(decompressed, data);
+
+    // ...and by a parallel one
+    ASSERT_OK(RunParallelCompressedInputStream(codec.get(), compressed, options,
+                                               &decompressed));
+    ASSERT_EQ(decompressed, data);
+  }
+};
+
+TEST_P(ParallelCompressedStreamTest, CompressibleData) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  CheckRoundtrip(data, false /* do_flush */);
+}
+
+TEST_P(ParallelCompressedStreamTest, RandomData) {
+  auto data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckRoundtrip(data, false /* do_flush */);
+  CheckRoundtrip(MakeRandomData(200000), true /* do_flush */);
+}
+
+TEST_P(ParallelCompressedStreamTest, EmptyData) { CheckRoundtrip({}, false); }
+
+TEST_P(ParallelCompressedStreamTest, SerialStream) {
+  // A stream not written as independent frames (a single zstd or lz4 frame,
+  // a regular gzip member) is still readable
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), compressed, MakeOptions(),
+                                             &decompressed));
+  ASSERT_EQ(decompressed, data);
+
+  // Same, after independent frames
+  auto parallel_compressed = CompressDataParallel(codec.get(), data, MakeOptions());
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       ConcatenateBuffers({parallel_compressed, compressed}));
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), concatenated, MakeOptions(),
+                                             &decompressed));
+  ASSERT_EQ(decompressed.size(), 2 * data.size());
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), decompressed.begin()));
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), decompressed.begin() + data.size()));
+}
+
+TEST_P(ParallelCompressedStreamTest, TruncatedData) {
+  auto codec = MakeCodec();
+  auto data = MakeRandomData(200000);
+  auto compressed = CompressDataParallel(codec.get(), data, MakeOptions());
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunParallelCompressedInputStream(codec.get(), truncated,
+                                                          MakeOptions(), &decompressed));
+}
+
+TEST_P(ParallelCompressedStreamTest, InvalidData) {
+  auto codec = MakeCodec();
+  auto compressed_data = MakeRandomData(100);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunParallelCompressedInputStream(
+                             codec.get(), Buffer::Wrap(compressed_data), MakeOptions(),
+                             &decompressed));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -278,6 +405,8 @@ INSTANTIATE_TEST_SUITE_P(TestGZipInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_SUITE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_SUITE_P(TestGZipParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::GZIP));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -292,6 +421,8 @@ INSTANTIATE_TEST_SUITE_P(TestLZ4InputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
 INSTANTIATE_TEST_SUITE_P(TestLZ4OutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
+INSTANTIATE_TEST_SUITE_P(TestLZ4ParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::LZ4_FRAME));
 #endif
 
 #ifdef ARROW_WITH_ZSTD
@@ -299,6 +430,8 @@ INSTANTIATE_TEST_SUITE_P(TestZSTDInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::ZSTD));
 INSTANTIATE_TEST_SUITE_P(TestZSTDOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_SUITE_P(TestZSTDParallelStream, ParallelCompressedStreamTest,
+                         ::testing::Values(Compression::ZSTD));
 #endif
 
 }  // namespace io
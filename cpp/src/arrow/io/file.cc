@@ -41,12 +41,14 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
@@ -159,6 +161,15 @@ class OSFile {
                                          nbytes);
   }
 
+  // Read consecutive bytes into the slices
+  Result<int64_t> ReadAtV(int64_t position,
+                          const std::vector<::arrow::internal::IOSlice>& slices) {
+    RETURN_NOT_OK(CheckClosed());
+    // Like ReadAt(), leaves the file position undefined
+    need_seeking_.store(true);
+    return ::arrow::internal::FileReadAtV(fd_, slices, position);
+  }
+
   Status Seek(int64_t pos) {
     RETURN_NOT_OK(CheckClosed());
     if (pos < 0) {
@@ -188,6 +199,20 @@ class OSFile {
                                         length);
   }
 
+  Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::vector<::arrow::internal::IOSlice> slices;
+    slices.reserve(data.size());
+    for (const auto& buffer : data) {
+      // writev() doesn't write to its buffers
+      slices.push_back({const_cast<uint8_t*>(buffer->data()), buffer->size()});
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+    return ::arrow::internal::FileWriteV(fd_, slices);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -243,6 +268,55 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    if (!options.use_io_uring) {
+      return Status::OK();
+    }
+    auto maybe_uring = internal::IoUring::GetInstance();
+    if (!maybe_uring.ok()) {
+      // Fall back on blocking reads on the IOContext executor
+      return Status::OK();
+    }
+    uring_ = maybe_uring.MoveValueUnsafe();
+#ifdef O_DIRECT
+    if (options.use_direct_io) {
+      // A second descriptor, so that synchronous reads, which needn't be
+      // aligned, are unaffected.  Not all filesystems support O_DIRECT.
+      int fd;
+      do {
+        fd = open(file_name_.ToNative().c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+      } while (fd == -1 && errno == EINTR);
+      direct_fd_ = fd;
+    }
+#endif
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (direct_fd_ != -1) {
+      int fd = direct_fd_;
+      direct_fd_ = -1;
+      ARROW_UNUSED(::arrow::internal::FileClose(fd));
+    }
+    return OSFile::Close();
+  }
+
+  bool use_io_uring() const { return uring_ != nullptr; }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext& io_context, const std::vector<ReadRange>& ranges) {
+    auto st = CheckClosed();
+    if (!st.ok()) {
+      return std::vector<Future<std::shared_ptr<Buffer>>>(
+          ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(st));
+    }
+    if (direct_fd_ != -1) {
+      return uring_->ReadMany(io_context, direct_fd_, ranges, kDirectIoAlignment);
+    }
+    return uring_->ReadMany(io_context, fd_, ranges);
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
@@ -266,6 +340,47 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return std::move(buffer);
   }
 
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadBuffersAt(
+      const std::vector<ReadRange>& ranges) {
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+    buffers.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+      ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(range.length, pool_));
+      buffers.push_back(std::move(buffer));
+    }
+
+    // Read each run of consecutive ranges with a single vectored read
+    std::vector<::arrow::internal::IOSlice> slices;
+    size_t run_start = 0;
+    while (run_start < ranges.size()) {
+      size_t run_end = run_start + 1;
+      while (run_end < ranges.size() &&
+             ranges[run_end].offset ==
+                 ranges[run_end - 1].offset + ranges[run_end - 1].length) {
+        ++run_end;
+      }
+      slices.clear();
+      for (size_t i = run_start; i < run_end; ++i) {
+        slices.push_back({buffers[i]->mutable_data(), ranges[i].length});
+      }
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAtV(ranges[run_start].offset, slices));
+      // Truncate the buffers past EOF
+      for (size_t i = run_start; i < run_end; ++i) {
+        const int64_t buffer_bytes_read = std::max<int64_t>(
+            0, std::min(ranges[i].length,
+                        bytes_read - (ranges[i].offset - ranges[run_start].offset)));
+        if (buffer_bytes_read < ranges[i].length) {
+          RETURN_NOT_OK(buffers[i]->Resize(buffer_bytes_read));
+          buffers[i]->ZeroPadding();
+        }
+      }
+      run_start = run_end;
+    }
+    return std::vector<std::shared_ptr<Buffer>>(buffers.begin(), buffers.end());
+  }
+
   Status WillNeed(const std::vector<ReadRange>& ranges) {
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
@@ -288,9 +403,16 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  // The logical block size of most devices, and a multiple of the others'
+  static constexpr int64_t kDirectIoAlignment = 4096;
+
   MemoryPool* pool_;
+  std::shared_ptr<internal::IoUring> uring_;
+  int direct_fd_ = -1;
 };
 
+constexpr int64_t ReadableFile::ReadableFileImpl::kDirectIoAlignment;
+
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
 
 ReadableFile::~ReadableFile() { internal::CloseFromDestructor(this); }
@@ -302,6 +424,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(const std::string& path
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(
+    const std::string& path, const ReadableFileOptions& options, MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, options));
+  return file;
+}
+
 Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* pool) {
   auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
   RETURN_NOT_OK(file->impl_->Open(fd));
@@ -316,6 +445,28 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const IOContext& io_context,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  if (!impl_->use_io_uring()) {
+    return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+  }
+  return impl_->ReadManyAsync(io_context, {{position, nbytes}})[0];
+}
+
+Result<std::vector<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAt(
+    const std::vector<ReadRange>& ranges) {
+  return impl_->ReadBuffersAt(ranges);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const IOContext& io_context, const std::vector<ReadRange>& ranges) {
+  if (!impl_->use_io_uring()) {
+    return RandomAccessFile::ReadManyAsync(io_context, ranges);
+  }
+  return impl_->ReadManyAsync(io_context, ranges);
+}
+
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
@@ -379,6 +530,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->WriteV(data);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -771,5 +926,103 @@ Status MemoryMappedFile::Resize(int64_t new_size) {
 
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
+// ----------------------------------------------------------------------
+// Implement MemoryMappedOutputStream
+
+constexpr int64_t MemoryMappedOutputStream::kDefaultInitialCapacity;
+
+class MemoryMappedOutputStream::Impl {
+ public:
+  Status Open(const std::string& path, int64_t initial_capacity) {
+    if (initial_capacity < 0) {
+      return Status::Invalid("Initial capacity must be non-negative");
+    }
+    ARROW_ASSIGN_OR_RAISE(file_, MemoryMappedFile::Create(path, initial_capacity));
+    capacity_ = initial_capacity;
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (file_->closed()) {
+      return Status::OK();
+    }
+    // Drop the unwritten capacity
+    Status st = file_->Resize(position_);
+    return st & file_->Close();
+  }
+
+  bool closed() const { return file_->closed(); }
+
+  Result<int64_t> Tell() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return position_;
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (file_->closed()) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    if (nbytes > capacity_ - position_) {
+      // Growing the mapping of a file is cheap (mremap() on Linux), but it
+      // still involves a system call: grow in large increments.
+      const int64_t new_capacity =
+          std::max(position_ + nbytes, std::max(2 * capacity_, kMinGrowth));
+      RETURN_NOT_OK(file_->Resize(new_capacity));
+      capacity_ = new_capacity;
+    }
+    RETURN_NOT_OK(file_->Write(data, nbytes));
+    position_ += nbytes;
+    return Status::OK();
+  }
+
+  int64_t capacity() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return capacity_;
+  }
+
+  int file_descriptor() const { return file_->file_descriptor(); }
+
+ private:
+  static constexpr int64_t kMinGrowth = 1 << 20;
+
+  std::shared_ptr<MemoryMappedFile> file_;
+  int64_t capacity_ = 0;
+  int64_t position_ = 0;
+  mutable std::mutex lock_;
+};
+
+constexpr int64_t MemoryMappedOutputStream::Impl::kMinGrowth;
+
+MemoryMappedOutputStream::MemoryMappedOutputStream() : impl_(new Impl()) {}
+
+MemoryMappedOutputStream::~MemoryMappedOutputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Result<std::shared_ptr<MemoryMappedOutputStream>> MemoryMappedOutputStream::Open(
+    const std::string& path, int64_t initial_capacity) {
+  std::shared_ptr<MemoryMappedOutputStream> stream(new MemoryMappedOutputStream());
+  RETURN_NOT_OK(stream->impl_->Open(path, initial_capacity));
+  return stream;
+}
+
+Status MemoryMappedOutputStream::Close() { return impl_->Close(); }
+
+bool MemoryMappedOutputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> MemoryMappedOutputStream::Tell() const { return impl_->Tell(); }
+
+Status MemoryMappedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+int64_t MemoryMappedOutputStream::capacity() const { return impl_->capacity(); }
+
+int MemoryMappedOutputStream::file_descriptor() const {
+  return impl_->file_descriptor();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -67,6 +67,11 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
+
+  /// \brief Write the buffers with as few system calls as possible (writev)
+  ///
+  /// Thread-safe.
+  Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data) override;
   /// \cond FALSE
   using Writable::Write;
   /// \endcond
@@ -80,6 +85,27 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief Options for ReadableFile
+struct ARROW_EXPORT ReadableFileOptions {
+  /// \brief Issue asynchronous reads through io_uring
+  ///
+  /// If true and io_uring is available (Linux only), ReadAsync and
+  /// ReadManyAsync queue reads in the kernel instead of issuing blocking
+  /// reads on the IOContext executor, so that many reads can be in flight
+  /// without as many threads.  ReadManyAsync submits all its reads with a
+  /// single system call.  Otherwise, this option is ignored.
+  bool use_io_uring = false;
+
+  /// \brief Bypass the page cache for io_uring reads (O_DIRECT)
+  ///
+  /// Asynchronous reads are then widened to multiples of the block size and
+  /// read into aligned buffers.  Ignored if use_io_uring is false, or if
+  /// the file or filesystem doesn't support O_DIRECT.
+  bool use_direct_io = false;
+
+  static ReadableFileOptions Defaults() { return ReadableFileOptions(); }
+};
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -97,6 +123,15 @@ class ARROW_EXPORT ReadableFile
   static Result<std::shared_ptr<ReadableFile>> Open(
       const std::string& path, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options how asynchronous reads are issued
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return ReadableFile instance
+  static Result<std::shared_ptr<ReadableFile>> Open(
+      const std::string& path, const ReadableFileOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   /// \brief Open a local file for reading
   /// \param[in] fd file descriptor
   /// \param[in] pool a MemoryPool for memory allocations
@@ -111,6 +146,24 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  /// \brief Read several ranges, with a single vectored read (preadv) for
+  /// each run of consecutive ranges
+  ///
+  /// Thread-safe.
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadManyAt(
+      const std::vector<ReadRange>& ranges) override;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
+  /// \cond FALSE
+  using RandomAccessFile::ReadAsync;
+  using RandomAccessFile::ReadManyAsync;
+  /// \endcond
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -217,5 +270,49 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   std::shared_ptr<MemoryMap> memory_map_;
 };
 
+/// \brief An output stream writing to a memory-mapped file whose final size
+/// is unknown
+///
+/// Unlike MemoryMappedFile, the file and its mapping grow as data is written,
+/// at least doubling their size each time, and the file is truncated to the
+/// written size on Close().  Writes are then mere memory copies, which suits
+/// writing local temporary files, such as IPC streams spilled to disk.
+///
+/// Any existing file with the indicated path is truncated.
+class ARROW_EXPORT MemoryMappedOutputStream : public OutputStream {
+ public:
+  ~MemoryMappedOutputStream() override;
+
+  /// \brief Open a local file for writing through a memory map
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] initial_capacity size of the file before the first growth
+  static Result<std::shared_ptr<MemoryMappedOutputStream>> Open(
+      const std::string& path, int64_t initial_capacity = kDefaultInitialCapacity);
+
+  // OutputStream interface
+  Status Close() override;
+  bool closed() const override;
+  Result<int64_t> Tell() const override;
+
+  // Write bytes to the stream. Thread-safe
+  Status Write(const void* data, int64_t nbytes) override;
+  /// \cond FALSE
+  using Writable::Write;
+  /// \endcond
+
+  /// \brief The current size of the file, including unwritten capacity
+  int64_t capacity() const;
+
+  int file_descriptor() const;
+
+  static constexpr int64_t kDefaultInitialCapacity = 1 << 20;
+
+ private:
+  MemoryMappedOutputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
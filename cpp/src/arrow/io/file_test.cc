@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
@@ -222,6 +223,20 @@ TEST_F(TestFileOutputStream, Append) {
   AssertFileContents(path_, "testdata");
 }
 
+TEST_F(TestFileOutputStream, WriteV) {
+  OpenFile();
+
+  ASSERT_OK(file_->Write("test", 4));
+  ASSERT_OK(file_->WriteV({Buffer::FromString("da"), Buffer::FromString(""),
+                           Buffer::FromString("ta"), Buffer::FromString("!")}));
+  ASSERT_OK_AND_EQ(9, file_->Tell());
+  ASSERT_OK(file_->WriteV({}));
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, "testdata!");
+
+  ASSERT_RAISES(Invalid, file_->WriteV({Buffer::FromString("data")}));
+}
+
 // ----------------------------------------------------------------------
 // File input tests
 
@@ -384,6 +399,68 @@ TEST_F(TestReadableFile, ReadAsync) {
   AssertBufferEqual(*buf2, "test");
 }
 
+TEST_F(TestReadableFile, ReadManyAsync) {
+  // Larger than a block, so that O_DIRECT reads are widened on both ends
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data.push_back(static_cast<char>(i % 127));
+  }
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  const std::vector<ReadRange> ranges = {
+      {1, 10}, {0, 4}, {4000, 200}, {5000, 0}, {9990, 100}, {20000, 10}};
+
+  for (const bool use_io_uring : {false, true}) {
+    for (const bool use_direct_io : {false, true}) {
+      ReadableFileOptions options;
+      options.use_io_uring = use_io_uring;
+      options.use_direct_io = use_direct_io;
+      ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, options));
+
+      auto futures = file_->ReadManyAsync(ranges);
+      ASSERT_EQ(futures.size(), ranges.size());
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        ASSERT_OK_AND_ASSIGN(auto buffer, futures[i].result());
+        const auto offset = std::min<int64_t>(ranges[i].offset, data.size());
+        AssertBufferEqual(*buffer, data.substr(offset, ranges[i].length));
+      }
+      auto future = file_->ReadAsync({}, 9000, 3);
+      ASSERT_OK_AND_ASSIGN(auto buffer, future.result());
+      AssertBufferEqual(*buffer, data.substr(9000, 3));
+
+      future = file_->ReadAsync({}, -1, 3);
+      ASSERT_RAISES(Invalid, future.result());
+      ASSERT_OK(file_->Close());
+      future = file_->ReadAsync({}, 0, 3);
+      ASSERT_RAISES(Invalid, future.result());
+    }
+  }
+}
+
+TEST_F(TestReadableFile, ReadManyAt) {
+  MakeTestFile();
+  OpenFile();
+
+  // Consecutive, disjoint, empty and past-EOF ranges
+  const std::vector<ReadRange> ranges = {{0, 4}, {4, 2}, {6, 10}, {1, 3},
+                                         {3, 0}, {7, 0}, {10, 5}};
+  const std::vector<std::string> expected = {"test", "da", "ta", "est", "", "", ""};
+  ASSERT_OK_AND_ASSIGN(auto buffers, file_->ReadManyAt(ranges));
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    AssertBufferEqual(*buffers[i], expected[i]);
+  }
+  ASSERT_OK_AND_ASSIGN(buffers, file_->ReadManyAt({}));
+  ASSERT_EQ(buffers.size(), 0);
+
+  ASSERT_RAISES(Invalid, file_->ReadManyAt({{0, 4}, {-1, 2}}));
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadManyAt({{0, 4}}));
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -1060,5 +1137,66 @@ TEST_F(TestMemoryMappedFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// Memory-mapped output stream tests
+
+class TestMemoryMappedOutputStream : public TestMemoryMappedFile {};
+
+TEST_F(TestMemoryMappedOutputStream, WriteGrowsAndCloseTruncates) {
+  std::string path = TempFile("mmap-output-stream-test");
+  ASSERT_OK_AND_ASSIGN(auto stream, MemoryMappedOutputStream::Open(path, 1000));
+  ASSERT_OK_AND_EQ(0, stream->Tell());
+  ASSERT_EQ(1000, stream->capacity());
+
+  std::string expected;
+  for (int i = 0; i < 2000; ++i) {
+    std::string chunk = "chunk number " + std::to_string(i) + "\n";
+    ASSERT_OK(stream->Write(chunk.data(), static_cast<int64_t>(chunk.size())));
+    expected += chunk;
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()), stream->Tell());
+  ASSERT_GE(stream->capacity(), static_cast<int64_t>(expected.size()));
+  // Large writes grow the file as much as needed
+  std::vector<uint8_t> large(5 << 20);
+  random_bytes(large.size(), 0, large.data());
+  ASSERT_OK(stream->Write(large.data(), static_cast<int64_t>(large.size())));
+  expected.append(large.begin(), large.end());
+
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(stream->closed());
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(Invalid, stream->Write("x", 1));
+
+  ASSERT_OK_AND_ASSIGN(auto file, MemoryMappedFile::Open(path, FileMode::READ));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()), file->GetSize());
+  ASSERT_OK_AND_ASSIGN(auto contents, file->ReadAt(0, expected.size()));
+  ASSERT_EQ(expected, contents->ToString());
+}
+
+TEST_F(TestMemoryMappedOutputStream, EmptyFile) {
+  for (const int64_t initial_capacity : {0, 4096}) {
+    std::string path = TempFile("mmap-output-stream-empty");
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         MemoryMappedOutputStream::Open(path, initial_capacity));
+    ASSERT_OK(stream->Close());
+
+    ASSERT_OK_AND_ASSIGN(auto file, ReadableFile::Open(path));
+    ASSERT_OK_AND_EQ(0, file->GetSize());
+  }
+}
+
+TEST_F(TestMemoryMappedOutputStream, TruncatesExistingFile) {
+  std::string path = TempFile("mmap-output-stream-existing");
+  CreateFile(path, 100000);
+
+  ASSERT_OK_AND_ASSIGN(auto stream, MemoryMappedOutputStream::Open(path, 0));
+  ASSERT_OK(stream->Write("foo", 3));
+  stream.reset();  // Destructor closes the stream
+
+  ASSERT_OK_AND_ASSIGN(auto file, ReadableFile::Open(path));
+  ASSERT_OK_AND_ASSIGN(auto contents, file->Read(100));
+  ASSERT_EQ("foo", contents->ToString());
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -35,8 +35,10 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 using std::size_t;
 
@@ -120,12 +122,91 @@ Status GetPathInfoFailed(const std::string& path) {
   return Status::IOError(ss.str());
 }
 
+Result<int64_t> Pread(internal::LibHdfsShim* driver, hdfsFS fs, hdfsFile file,
+                      int64_t position, int64_t nbytes, uint8_t* buffer) {
+  constexpr int64_t kMaxBlockSize = std::numeric_limits<int32_t>::max();
+  int64_t total_bytes = 0;
+  while (nbytes > 0) {
+    const auto block_size = static_cast<tSize>(std::min(kMaxBlockSize, nbytes));
+    tSize ret =
+        driver->Pread(fs, file, static_cast<tOffset>(position), buffer, block_size);
+    CHECK_FAILURE(ret, "read");
+    DCHECK_LE(ret, block_size);
+    if (ret == 0) {
+      break;  // EOF
+    }
+    buffer += ret;
+    total_bytes += ret;
+    position += ret;
+    nbytes -= ret;
+  }
+  return total_bytes;
+}
+
+// Read a range with Pread() on the IOContext executor.  The file must
+// remain open until the returned future finishes.
+Future<std::shared_ptr<Buffer>> PreadAsync(const IOContext& io_context,
+                                           internal::LibHdfsShim* driver, hdfsFS fs,
+                                           hdfsFile file, int64_t position,
+                                           int64_t nbytes) {
+  auto read = [=]() -> Result<std::shared_ptr<Buffer>> {
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          AllocateResizableBuffer(nbytes, io_context.pool()));
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        Pread(driver, fs, file, position, nbytes, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    return std::move(buffer);
+  };
+  return DeferNotOk(io_context.executor()->Submit(io_context.stop_token(), read));
+}
+
+// Zero-copy read state shared by a file and the buffers it returned, as those
+// must be released through the file handle.
+struct ZeroCopyReader {
+  ZeroCopyReader(internal::LibHdfsShim* driver, hdfsFS fs, hdfsFile file,
+                 hadoopRzOptions* options)
+      : driver(driver), fs(fs), file(file), options(options) {}
+
+  ~ZeroCopyReader() {
+    driver->RzOptionsFree(options);
+    if (close_file && driver->CloseFile(fs, file) == -1) {
+      ARROW_LOG(WARNING) << "HDFS CloseFile failed, errno: " << TranslateErrno(errno);
+    }
+  }
+
+  internal::LibHdfsShim* driver;
+  hdfsFS fs;
+  hdfsFile file;
+  hadoopRzOptions* options;
+  // Set if the file was closed while buffers were still alive
+  bool close_file = false;
+};
+
+class ZeroCopyBuffer : public Buffer {
+ public:
+  ZeroCopyBuffer(std::shared_ptr<ZeroCopyReader> reader, hadoopRzBuffer* rz_buffer,
+                 const void* data, int64_t size)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size),
+        reader_(std::move(reader)),
+        rz_buffer_(rz_buffer) {}
+
+  ~ZeroCopyBuffer() override { reader_->driver->RzBufferFree(reader_->file, rz_buffer_); }
+
+ private:
+  std::shared_ptr<ZeroCopyReader> reader_;
+  hadoopRzBuffer* rz_buffer_;
+};
+
 }  // namespace
 
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
-  explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+  explicit HdfsReadableFileImpl(const io::IOContext& io_context)
+      : io_context_(io_context), pool_(io_context.pool()) {}
 
   Status Close() {
     if (is_open_) {
@@ -134,6 +215,19 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       // the error doesn't get propagated properly and the second close
       // initiated by the destructor raises a segfault
       is_open_ = false;
+      if (prefetch_.is_valid()) {
+        // The prefetch reads from file_, wait for it before closing
+        prefetch_.Wait();
+        prefetch_ = {};
+      }
+      chunk_.reset();
+      if (zero_copy_ != nullptr && zero_copy_.use_count() > 1) {
+        // Zero-copy buffers are still alive, the last one closes the file
+        zero_copy_->close_file = true;
+        zero_copy_.reset();
+        return Status::OK();
+      }
+      zero_copy_.reset();
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
     }
@@ -145,27 +239,11 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, uint8_t* buffer) {
     if (!driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
-      RETURN_NOT_OK(Seek(position));
-      return Read(nbytes, buffer);
+      RETURN_NOT_OK(HdfsAnyFileImpl::Seek(position));
+      return ReadFromFile(nbytes, buffer);
     }
 
-    constexpr int64_t kMaxBlockSize = std::numeric_limits<int32_t>::max();
-    int64_t total_bytes = 0;
-    while (nbytes > 0) {
-      const auto block_size = static_cast<tSize>(std::min(kMaxBlockSize, nbytes));
-      tSize ret =
-          driver_->Pread(fs_, file_, static_cast<tOffset>(position), buffer, block_size);
-      CHECK_FAILURE(ret, "read");
-      DCHECK_LE(ret, block_size);
-      if (ret == 0) {
-        break;  // EOF
-      }
-      buffer += ret;
-      total_bytes += ret;
-      position += ret;
-      nbytes -= ret;
-    }
-    return total_bytes;
+    return Pread(driver_, fs_, file_, position, nbytes, buffer);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
@@ -182,21 +260,21 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<int64_t> Read(int64_t nbytes, void* buffer) {
-    int64_t total_bytes = 0;
-    while (total_bytes < nbytes) {
-      tSize ret = driver_->Read(
-          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
-          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
-      CHECK_FAILURE(ret, "read");
-      total_bytes += ret;
-      if (ret == 0) {
-        break;
-      }
+    if (readahead_size_ > 0) {
+      return ReadAhead(nbytes, reinterpret_cast<uint8_t*>(buffer));
     }
-    return total_bytes;
+    return ReadFromFile(nbytes, buffer);
   }
 
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (zero_copy_ != nullptr && nbytes > 0 &&
+        nbytes <= std::numeric_limits<int32_t>::max()) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, ReadZeroCopy(nbytes));
+      if (buffer != nullptr) {
+        return buffer;
+      }
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -206,6 +284,25 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return std::move(buffer);
   }
 
+  Status Seek(int64_t position) {
+    if (readahead_size_ > 0) {
+      // Reads are positional, so only the logical position needs updating
+      if (position < 0) {
+        return Status::Invalid("Negative seek position: ", position);
+      }
+      position_ = position;
+      return Status::OK();
+    }
+    return HdfsAnyFileImpl::Seek(position);
+  }
+
+  Result<int64_t> Tell() {
+    if (readahead_size_ > 0) {
+      return position_;
+    }
+    return HdfsAnyFileImpl::Tell();
+  }
+
   Result<int64_t> GetSize() {
     hdfsFileInfo* entry = driver_->GetPathInfo(fs_, path_.c_str());
     if (entry == nullptr) {
@@ -221,13 +318,130 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
 
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
+  // Must be called after set_members()
+  void set_read_options(bool zero_copy, int64_t readahead_size) {
+    if (zero_copy && driver_->HasReadZero()) {
+      hadoopRzOptions* options = driver_->RzOptionsAlloc();
+      if (options != nullptr) {
+        // Checksums would force libhdfs to copy the data, and without a byte
+        // buffer pool reads that cannot be mmapped fail instead of copying,
+        // in which case we fall back on a regular read.
+        if (driver_->RzOptionsSetSkipChecksum(options, 1) == 0 &&
+            driver_->RzOptionsSetByteBufferPool(options, nullptr) == 0) {
+          zero_copy_ = std::make_shared<ZeroCopyReader>(driver_, fs_, file_, options);
+        } else {
+          driver_->RzOptionsFree(options);
+        }
+      }
+    }
+    if (zero_copy_ == nullptr && readahead_size > 0 && driver_->HasPread()) {
+      readahead_size_ = readahead_size;
+    }
+  }
+
  private:
+  Result<int64_t> ReadFromFile(int64_t nbytes, void* buffer) {
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Read(
+          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+    return total_bytes;
+  }
+
+  // Return null if the read cannot be done without copying
+  Result<std::shared_ptr<Buffer>> ReadZeroCopy(int64_t nbytes) {
+    errno = 0;
+    hadoopRzBuffer* rz_buffer =
+        driver_->ReadZero(file_, zero_copy_->options, static_cast<int32_t>(nbytes));
+    if (rz_buffer == nullptr) {
+      if (errno != EPROTONOSUPPORT) {
+        return IOErrorFromErrno(errno, "HDFS zero-copy read failed");
+      }
+      // The data is not available through mmap (e.g. it is not local): don't
+      // try again for this file
+      zero_copy_.reset();
+      return nullptr;
+    }
+    const int64_t length = driver_->RzBufferLength(rz_buffer);
+    const void* data = driver_->RzBufferGet(rz_buffer);
+    if (length == nbytes || length == 0) {
+      return std::make_shared<ZeroCopyBuffer>(zero_copy_, rz_buffer, data, length);
+    }
+    // The read stopped at a block boundary: copy it and read the rest
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
+    std::memcpy(buffer->mutable_data(), data, static_cast<size_t>(length));
+    driver_->RzBufferFree(file_, rz_buffer);
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadFromFile(nbytes - length, buffer->mutable_data() + length));
+    if (length + bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(length + bytes_read));
+    }
+    return std::move(buffer);
+  }
+
+  void Prefetch(int64_t position) {
+    // Close() waits for the prefetch before closing the file
+    prefetch_offset_ = position;
+    prefetch_ = PreadAsync(io_context_, driver_, fs_, file_, position, readahead_size_);
+  }
+
+  // Sequential read through chunks of readahead_size_ bytes, prefetching the
+  // chunk following the one being read
+  Result<int64_t> ReadAhead(int64_t nbytes, uint8_t* out) {
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      if (chunk_ == nullptr || position_ < chunk_offset_ ||
+          position_ >= chunk_offset_ + chunk_->size()) {
+        if (prefetch_.is_valid() && prefetch_offset_ == position_) {
+          auto result = prefetch_.result();
+          prefetch_ = {};
+          ARROW_ASSIGN_OR_RAISE(chunk_, result);
+        } else {
+          ARROW_ASSIGN_OR_RAISE(chunk_, ReadAt(position_, readahead_size_));
+        }
+        chunk_offset_ = position_;
+        if (chunk_->size() == 0) {
+          break;  // EOF
+        }
+        if (chunk_->size() == readahead_size_ && !prefetch_.is_valid()) {
+          Prefetch(chunk_offset_ + readahead_size_);
+        }
+      }
+      const int64_t chunk_position = position_ - chunk_offset_;
+      const int64_t nread =
+          std::min(nbytes - total_bytes, chunk_->size() - chunk_position);
+      std::memcpy(out + total_bytes, chunk_->data() + chunk_position,
+                  static_cast<size_t>(nread));
+      total_bytes += nread;
+      position_ += nread;
+    }
+    return total_bytes;
+  }
+
+  IOContext io_context_;
   MemoryPool* pool_;
   int32_t buffer_size_;
+
+  std::shared_ptr<ZeroCopyReader> zero_copy_;
+
+  // Readahead state
+  int64_t readahead_size_ = 0;
+  int64_t position_ = 0;
+  std::shared_ptr<Buffer> chunk_;
+  int64_t chunk_offset_ = 0;
+  Future<std::shared_ptr<Buffer>> prefetch_;
+  int64_t prefetch_offset_ = -1;
 };
 
 HdfsReadableFile::HdfsReadableFile(const io::IOContext& io_context) {
-  impl_.reset(new HdfsReadableFileImpl(io_context.pool()));
+  impl_.reset(new HdfsReadableFileImpl(io_context));
 }
 
 HdfsReadableFile::~HdfsReadableFile() { DCHECK_OK(impl_->Close()); }
@@ -363,6 +577,17 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
+    if (config->short_circuit_reads) {
+      int ret = driver_->BuilderConfSetStr(builder, "dfs.client.read.shortcircuit",
+                                           "true");
+      CHECK_FAILURE(ret, "confsetstr");
+      if (!config->domain_socket_path.empty()) {
+        ret = driver_->BuilderConfSetStr(builder, "dfs.domain.socket.path",
+                                         config->domain_socket_path.c_str());
+        CHECK_FAILURE(ret, "confsetstr");
+      }
+    }
+
     for (const auto& kv : config->extra_conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
@@ -378,6 +603,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    zero_copy_reads_ = config->zero_copy_reads;
+    readahead_size_ = config->readahead_size;
 
     return Status::OK();
   }
@@ -516,6 +743,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile(io_context));
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    (*file)->impl_->set_read_options(zero_copy_reads_, readahead_size_);
 
     return Status::OK();
   }
@@ -571,6 +799,8 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool zero_copy_reads_ = false;
+  int64_t readahead_size_ = 0;
 
   hdfsFS fs_;
 };
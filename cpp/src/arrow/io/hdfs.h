@@ -90,6 +90,23 @@ struct HdfsConnectionConfig {
   std::string user;
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
+
+  // Read local replicas directly from the DataNode's disks, bypassing the
+  // DataNode process.  The DataNodes must be configured with the same
+  // domain socket path.
+  bool short_circuit_reads = false;
+  std::string domain_socket_path;
+
+  // Have buffer-returning Read() calls return buffers pointing into memory
+  // mapped by libhdfs, when possible, instead of copying the data.  This needs
+  // short-circuit reads and blocks cached by the DataNode; other reads fall
+  // back to copying.
+  bool zero_copy_reads = false;
+
+  // If positive, sequential reads fetch this many bytes at a time (typically
+  // the HDFS block size), while the next chunk is prefetched in the background
+  // on the IOContext executor.  Ignored for zero-copy reads.
+  int64_t readahead_size = 0;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -372,6 +372,51 @@ TEST_F(TestHadoopFileSystem, LargeFile) {
   ASSERT_EQ(0, std::memcmp(buffer2->data(), data.data(), size));
 }
 
+TEST_F(TestHadoopFileSystem, ReadaheadAndZeroCopy) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-readahead-file");
+  const int size = 1000000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  for (const bool zero_copy : {false, true}) {
+    HdfsConnectionConfig conf = this->conf_;
+    conf.readahead_size = 1 << 16;
+    conf.zero_copy_reads = zero_copy;
+    std::shared_ptr<HadoopFileSystem> client;
+    ASSERT_OK(HadoopFileSystem::Connect(&conf, &client));
+
+    std::shared_ptr<HdfsReadableFile> file;
+    ASSERT_OK(client->OpenReadable(path, &file));
+
+    // Reads straddling readahead chunks
+    std::vector<uint8_t> buffer(size);
+    int64_t position = 0;
+    while (position < size) {
+      ASSERT_OK_AND_ASSIGN(int64_t nread, file->Read(100000, buffer.data() + position));
+      ASSERT_GT(nread, 0);
+      position += nread;
+    }
+    ASSERT_OK_AND_EQ(0, file->Read(1, buffer.data()));
+    ASSERT_EQ(0, std::memcmp(buffer.data(), data.data(), size));
+
+    // Buffers may outlive the file
+    ASSERT_OK(file->Seek(12345));
+    ASSERT_OK_AND_EQ(12345, file->Tell());
+    ASSERT_OK_AND_ASSIGN(auto chunk, file->Read(1000));
+    ASSERT_OK(file->Close());
+    ASSERT_EQ(1000, chunk->size());
+    ASSERT_EQ(0, std::memcmp(chunk->data(), data.data() + 12345, 1000));
+    chunk.reset();
+
+    ASSERT_OK(client->Disconnect());
+  }
+}
+
 TEST_F(TestHadoopFileSystem, RenameFile) {
   SKIP_IF_NO_DRIVER();
   ASSERT_OK(this->MakeScratchDir());
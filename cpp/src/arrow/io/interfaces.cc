@@ -128,6 +128,18 @@ Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
   return Read(nbytes);
 }
 
+// Default ReadManyAt() implementation: read each range with ReadAt()
+Result<std::vector<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAt(
+    const std::vector<ReadRange>& ranges) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(range.offset, range.length));
+    buffers.push_back(std::move(buffer));
+  }
+  return buffers;
+}
+
 // Default ReadAsync() implementation: simply issue the read on the context's executor
 Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(const IOContext& ctx,
                                                             int64_t position,
@@ -146,6 +158,22 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(int64_t position,
   return ReadAsync(io_context(), position, nbytes);
 }
 
+// Default ReadManyAsync() implementation: issue each read with ReadAsync()
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    futures.push_back(ReadAsync(ctx, range.offset, range.length));
+  }
+  return futures;
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const std::vector<ReadRange>& ranges) {
+  return ReadManyAsync(io_context(), ranges);
+}
+
 // Default WillNeed() implementation: no-op
 Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return Status::OK();
@@ -159,6 +187,13 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    RETURN_NOT_OK(Write(buffer));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 // An InputStream that reads from a delimited range of a RandomAccessFile
@@ -165,6 +165,14 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write the given buffers to the stream, in order
+  ///
+  /// This is equivalent to calling Write() on each buffer, which is what the
+  /// default implementation does.  Some implementations write all buffers
+  /// with a single vectored write instead, avoiding both several system calls
+  /// and a concatenation copy.
+  virtual Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -280,6 +288,17 @@ class ARROW_EXPORT RandomAccessFile
   /// \return A buffer containing the bytes read, or an error
   virtual Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes);
 
+  /// \brief Read several ranges of data.
+  ///
+  /// Each buffer can be shorter than its range if EOF is reached, as with
+  /// ReadAt().  The default implementation calls ReadAt() for each range, but
+  /// some implementations read consecutive ranges with a single vectored read.
+  ///
+  /// \param[in] ranges The ranges to read
+  /// \return A buffer for each range, or an error
+  virtual Result<std::vector<std::shared_ptr<Buffer>>> ReadManyAt(
+      const std::vector<ReadRange>& ranges);
+
   /// EXPERIMENTAL: Read data asynchronously.
   virtual Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
                                                     int64_t nbytes);
@@ -287,6 +306,18 @@ class ARROW_EXPORT RandomAccessFile
   /// EXPERIMENTAL: Read data asynchronously, using the file's IOContext.
   Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes);
 
+  /// EXPERIMENTAL: Read several ranges of data asynchronously.
+  ///
+  /// The default implementation calls ReadAsync() for each range, but some
+  /// implementations may issue all reads at once more efficiently.
+  virtual std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges);
+
+  /// EXPERIMENTAL: Read several ranges of data asynchronously, using the
+  /// file's IOContext.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const std::vector<ReadRange>& ranges);
+
   /// EXPERIMENTAL: Inform that the given ranges may be read soon.
   ///
   /// Some implementations might arrange to prefetch some of the data.
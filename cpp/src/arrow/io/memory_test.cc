@@ -37,6 +37,7 @@
 #include "arrow/io/transform.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
@@ -120,6 +121,13 @@ TEST_F(TestBufferOutputStream, Reset) {
   ASSERT_EQ(buffer2->size(), static_cast<int64_t>(data.size() * 2));
 }
 
+TEST_F(TestBufferOutputStream, WriteV) {
+  ASSERT_OK(stream_->WriteV({Buffer::FromString("data"), Buffer::FromString("123"),
+                             Buffer::FromString("456")}));
+  ASSERT_OK(stream_->Close());
+  AssertBufferEqual(*buffer_, "data123456");
+}
+
 TEST(TestFixedSizeBufferWriter, Basics) {
   ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> buffer, AllocateBuffer(1024));
 
@@ -225,6 +233,19 @@ TEST(TestBufferReader, ReadAsync) {
   AssertBufferEqual(*buf, "ata1");
 }
 
+TEST(TestBufferReader, ReadManyAt) {
+  std::string data = "data123456";
+
+  BufferReader reader(std::make_shared<Buffer>(data));
+
+  ASSERT_OK_AND_ASSIGN(auto buffers, reader.ReadManyAt({{2, 6}, {1, 4}, {8, 5}}));
+  ASSERT_EQ(buffers.size(), 3);
+  AssertBufferEqual(*buffers[0], "ta1234");
+  AssertBufferEqual(*buffers[1], "ata1");
+  AssertBufferEqual(*buffers[2], "56");
+  ASSERT_RAISES(Invalid, reader.ReadManyAt({{1, 4}, {1, -1}}));
+}
+
 TEST(TestBufferReader, InvalidReads) {
   std::string data = "data123456";
   BufferReader reader(std::make_shared<Buffer>(data));
@@ -729,6 +750,98 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, WaitFor) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}}));
+  ASSERT_FINISHES_OK(cache.WaitFor({{1, 2}, {20, 2}}));
+  ASSERT_FINISHES_OK(cache.WaitFor({{3, 2}, {25, 0}}));
+  ASSERT_FINISHES_OK(cache.WaitFor({}));
+  ASSERT_FINISHES_AND_RAISES(Invalid, cache.WaitFor({{1, 2}, {19, 3}}));
+  ASSERT_FINISHES_AND_RAISES(Invalid, cache.WaitFor({{0, 3}}));
+}
+
+TEST(RangeReadCache, EvictConsumed) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.evict_consumed = true;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Combined into [1, 5), [8, 10) and [20, 22)
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_RAISES(Invalid, cache.Read({8, 2}));
+  // The first combined range is kept until all its ranges are read
+  ASSERT_FINISHES_OK(cache.WaitFor({{3, 2}, {20, 2}}));
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_RAISES(Invalid, cache.Read({1, 2}));
+  ASSERT_RAISES(Invalid, cache.Read({3, 2}));
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({25, 0}));
+  AssertBufferEqual(*buf, "");
+  ASSERT_FINISHES_OK(cache.Wait());
+}
+
+// A file whose reads take 10 ms plus 10 us per byte (a bandwidth of 100 kB/s)
+class HighLatencyFile : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override {
+    ++num_reads;
+    SleepFor(0.01 + nbytes * 1e-5);
+    return Future<std::shared_ptr<Buffer>>::MakeFinished(ReadAt(position, nbytes));
+  }
+
+  int num_reads = 0;
+};
+
+TEST(RangeReadCache, Adaptive) {
+  std::string data(8192, 'x');
+  auto file = std::make_shared<HighLatencyFile>(Buffer(data));
+  CacheOptions options = CacheOptions::AdaptiveDefaults();
+  ASSERT_TRUE(options.adaptive);
+
+  // Observe reads of various sizes
+  for (int64_t size = 100; size <= 1600; size += 100) {
+    internal::ReadRangeCache cache(file, {}, options);
+    ASSERT_OK(cache.Cache({{0, size}}));
+    ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({0, size}));
+    ASSERT_EQ(buf->size(), size);
+  }
+
+  // Ranges 2900 bytes apart are combined with the default hole size limit...
+  file->num_reads = 0;
+  internal::ReadRangeCache default_cache(file, {}, CacheOptions::Defaults());
+  ASSERT_OK(default_cache.Cache({{0, 100}, {3000, 100}}));
+  ASSERT_EQ(file->num_reads, 1);
+
+  // ...but not with the bandwidth-delay product (~1 kB)
+  file->num_reads = 0;
+  internal::ReadRangeCache adaptive_cache(file, {}, options);
+  ASSERT_OK(adaptive_cache.Cache({{0, 100}, {3000, 100}}));
+  ASSERT_EQ(file->num_reads, 2);
+  ASSERT_OK_AND_ASSIGN(auto buf, adaptive_cache.Read({3000, 100}));
+  AssertBufferEqual(*buf, std::string(100, 'x'));
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
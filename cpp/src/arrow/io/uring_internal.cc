@@ -0,0 +1,444 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#ifdef ARROW_HAVE_IO_URING
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using ::arrow::internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+constexpr unsigned kQueueDepth = 256;
+
+// user_data of the no-op request stopping the reaper thread
+constexpr uint64_t kStopRequest = 0;
+
+struct ReadRequest {
+  Future<std::shared_ptr<Buffer>> future;
+  ::arrow::internal::Executor* executor;
+  std::shared_ptr<ResizableBuffer> buffer;
+  int fd;
+  // Offset of the aligned data in `buffer`
+  int64_t buffer_offset;
+  // Position and length of the (aligned) read
+  int64_t position;
+  int64_t nbytes;
+  int64_t bytes_read;
+  // Position and length of the requested range, relative to `position`
+  int64_t range_offset;
+  int64_t range_length;
+  struct iovec iov;
+};
+
+int SetupRing(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int EnterRing(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  ~Impl() {
+    if (reaper_.joinable()) {
+      Status st;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        PrepareRequest(IORING_OP_NOP, -1, nullptr, 0, kStopRequest);
+        st = Submit();
+      }
+      if (st.ok()) {
+        reaper_.join();
+      } else {
+        // The reaper would never return: leak the ring rather than hang
+        ARROW_LOG(WARNING) << "Failed stopping io_uring: " << st.ToString();
+        reaper_.detach();
+        return;
+      }
+    }
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = SetupRing(kQueueDepth, &params);
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    sq_entries_ = params.sq_entries;
+    cq_entries_ = params.cq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    ARROW_ASSIGN_OR_RAISE(sq_ring_, MapRing(sq_ring_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ring_, MapRing(cq_ring_size_, IORING_OFF_CQ_RING));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    ARROW_ASSIGN_OR_RAISE(auto sqes, MapRing(sqes_size_, IORING_OFF_SQES));
+    sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto cq = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    reaper_ = std::thread([this] { ReapCompletions(); });
+    return Status::OK();
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      const IOContext& io_context, int fd, const std::vector<ReadRange>& ranges,
+      int64_t alignment) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+    std::vector<std::unique_ptr<ReadRequest>> requests;
+    for (const auto& range : ranges) {
+      auto future = Future<std::shared_ptr<Buffer>>::Make();
+      futures.push_back(future);
+      auto maybe_request = MakeRequest(io_context, fd, range, alignment);
+      if (!maybe_request.ok()) {
+        future.MarkFinished(maybe_request.status());
+        continue;
+      }
+      auto request = maybe_request.MoveValueUnsafe();
+      request->future = std::move(future);
+      if (request->nbytes == 0) {
+        Finish(request.release(), Status::OK());
+      } else {
+        requests.push_back(std::move(request));
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto& request : requests) {
+      // Bound the number of reads in flight, so that completions can't
+      // overflow the completion queue
+      if (in_flight_ == cq_entries_ || pending_submissions_ == sq_entries_) {
+        auto st = Submit();
+        if (!st.ok()) {
+          FailPending(st);
+        }
+        not_full_.wait(lock, [this] { return in_flight_ < cq_entries_; });
+      }
+      ++in_flight_;
+      PrepareRead(request.release());
+    }
+    auto st = Submit();
+    if (!st.ok()) {
+      FailPending(st);
+    }
+    return futures;
+  }
+
+ private:
+  Result<void*> MapRing(size_t size, off_t offset) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed mapping io_uring");
+    }
+    return ptr;
+  }
+
+  Result<std::unique_ptr<ReadRequest>> MakeRequest(const IOContext& io_context, int fd,
+                                                   const ReadRange& range,
+                                                   int64_t alignment) {
+    RETURN_NOT_OK(ValidateRange(range.offset, range.length));
+    std::unique_ptr<ReadRequest> request(new ReadRequest());
+    request->executor = io_context.executor();
+    request->fd = fd;
+    request->position = range.offset & ~(alignment - 1);
+    request->range_offset = range.offset - request->position;
+    request->range_length = range.length;
+    request->nbytes =
+        range.length == 0
+            ? 0
+            : ((request->range_offset + range.length + alignment - 1) & ~(alignment - 1));
+    request->bytes_read = 0;
+    // Over-allocate to align the data to `alignment`
+    const int64_t extra = alignment > 1 ? alignment : 0;
+    ARROW_ASSIGN_OR_RAISE(
+        request->buffer,
+        AllocateResizableBuffer(request->nbytes + extra, io_context.pool()));
+    const auto address = reinterpret_cast<uintptr_t>(request->buffer->data());
+    request->buffer_offset =
+        extra ? static_cast<int64_t>((alignment - address % alignment) % alignment) : 0;
+    return std::move(request);
+  }
+
+  // Must be called with mutex_ locked
+  void PrepareRequest(uint8_t opcode, int fd, void* addr, unsigned len,
+                      uint64_t user_data, int64_t offset = 0) {
+    const unsigned tail = *sq_tail_;
+    const unsigned index = tail & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(addr);
+    sqe->len = len;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++pending_submissions_;
+  }
+
+  // Must be called with mutex_ locked
+  void PrepareRead(ReadRequest* request) {
+    const int64_t done = request->bytes_read;
+    request->iov.iov_base =
+        request->buffer->mutable_data() + request->buffer_offset + done;
+    request->iov.iov_len = static_cast<size_t>(request->nbytes - done);
+    PrepareRequest(IORING_OP_READV, request->fd, &request->iov, 1,
+                   reinterpret_cast<uint64_t>(request), request->position + done);
+  }
+
+  // Must be called with mutex_ locked
+  Status Submit() {
+    while (pending_submissions_ > 0) {
+      int ret = EnterRing(ring_fd_, pending_submissions_, 0, 0);
+      if (ret < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+          continue;
+        }
+        return IOErrorFromErrno(errno, "io_uring_enter failed");
+      }
+      pending_submissions_ -= static_cast<unsigned>(ret);
+    }
+    return Status::OK();
+  }
+
+  // Fail the reads which could not be submitted.  Must be called with mutex_ locked
+  void FailPending(const Status& st) {
+    unsigned tail = *sq_tail_;
+    for (; pending_submissions_ > 0; --pending_submissions_) {
+      --tail;
+      const auto user_data = sqes_[tail & sq_mask_].user_data;
+      if (user_data != kStopRequest) {
+        --in_flight_;
+        Finish(reinterpret_cast<ReadRequest*>(user_data), st);
+      }
+    }
+    __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+    not_full_.notify_all();
+  }
+
+  void ReapCompletions() {
+    while (true) {
+      int ret = EnterRing(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && errno != EINTR) {
+        ARROW_LOG(ERROR) << "io_uring_enter failed: " << strerror(errno);
+        return;
+      }
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      bool stop = false;
+      for (; head != tail; ++head) {
+        const struct io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        if (cqe.user_data == kStopRequest) {
+          stop = true;
+        } else {
+          OnCompletion(reinterpret_cast<ReadRequest*>(cqe.user_data), cqe.res);
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      if (stop) {
+        return;
+      }
+    }
+  }
+
+  void OnCompletion(ReadRequest* request, int res) {
+    if (res == -EINTR || res == -EAGAIN) {
+      Resubmit(request);
+      return;
+    }
+    if (res > 0) {
+      request->bytes_read += res;
+      if (request->bytes_read < request->nbytes) {
+        // Short read, not necessarily at end of file
+        Resubmit(request);
+        return;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --in_flight_;
+    }
+    not_full_.notify_one();
+    Finish(request, res < 0 ? IOErrorFromErrno(-res, "io_uring read failed")
+                            : Status::OK());
+  }
+
+  void Resubmit(ReadRequest* request) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PrepareRead(request);
+    auto st = Submit();
+    if (!st.ok()) {
+      FailPending(st);
+    }
+  }
+
+  // Finish the future of a request, on its executor
+  static void Finish(ReadRequest* request, Status st) {
+    std::unique_ptr<ReadRequest> owned(request);
+    Result<std::shared_ptr<Buffer>> result;
+    if (st.ok()) {
+      const int64_t available = std::max<int64_t>(
+          0, std::min(owned->range_length, owned->bytes_read - owned->range_offset));
+      result = SliceBuffer(std::move(owned->buffer),
+                           owned->buffer_offset + owned->range_offset, available);
+    } else {
+      result = std::move(st);
+    }
+    auto future = std::move(owned->future);
+    auto spawned = owned->executor->Spawn(
+        [future, result]() mutable { future.MarkFinished(std::move(result)); });
+    if (!spawned.ok()) {
+      future.MarkFinished(std::move(result));
+    }
+  }
+
+  int ring_fd_ = -1;
+  unsigned sq_entries_ = 0, cq_entries_ = 0;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0, cq_ring_size_ = 0, sqes_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  // Protects the submission queue and the counters below
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  unsigned in_flight_ = 0;
+  unsigned pending_submissions_ = 0;
+  std::thread reaper_;
+};
+
+#else  // !ARROW_HAVE_IO_URING
+
+class IoUring::Impl {
+ public:
+  Status Init() { return Status::NotImplemented("io_uring is not supported"); }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(const IOContext&, int,
+                                                        const std::vector<ReadRange>&,
+                                                        int64_t) {
+    return {};
+  }
+};
+
+#endif  // ARROW_HAVE_IO_URING
+
+IoUring::IoUring() : impl_(new Impl()) {}
+
+IoUring::~IoUring() = default;
+
+Result<std::shared_ptr<IoUring>> IoUring::GetInstance() {
+  static Result<std::shared_ptr<IoUring>> instance =
+      []() -> Result<std::shared_ptr<IoUring>> {
+    std::shared_ptr<IoUring> ring(new IoUring());
+    RETURN_NOT_OK(ring->impl_->Init());
+    return ring;
+  }();
+  return instance;
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    const IOContext& io_context, int fd, const std::vector<ReadRange>& ranges,
+    int64_t alignment) {
+  DCHECK_GT(alignment, 0);
+  DCHECK_EQ(alignment & (alignment - 1), 0);
+  return impl_->ReadMany(io_context, fd, ranges, alignment);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous reads of local files through Linux io_uring
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief An io_uring instance serving positional reads of file descriptors
+///
+/// All reads given to a ReadMany() call are queued with a single system call,
+/// so that a single thread can keep many reads in flight.  A background
+/// thread reaps the completions and finishes the futures on the executor of
+/// the IOContext passed to ReadMany().
+class ARROW_EXPORT IoUring {
+ public:
+  ~IoUring();
+
+  /// \brief Return the process-wide instance
+  ///
+  /// Fails if io_uring is not supported by the platform or the kernel, or
+  /// if it is forbidden (e.g. by a seccomp policy).
+  static Result<std::shared_ptr<IoUring>> GetInstance();
+
+  /// \brief Read the given ranges of a file descriptor
+  ///
+  /// As with ReadAt(), reads past the end of the file return truncated
+  /// buffers.  If `alignment` is greater than 1, the reads are widened to
+  /// multiples of it, and into buffers aligned to it, as required for file
+  /// descriptors opened with O_DIRECT.  It must be a power of two.
+  ///
+  /// The file descriptor must remain open until all reads were submitted,
+  /// that is until this function returns.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      const IOContext& io_context, int fd, const std::vector<ReadRange>& ranges,
+      int64_t alignment = 1);
+
+ private:
+  IoUring();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
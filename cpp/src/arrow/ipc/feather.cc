@@ -536,6 +536,7 @@ struct ArrayWriterV1 {
       is_nested_type<T>::value || is_null_type<T>::value || is_decimal_type<T>::value ||
           std::is_same<DictionaryType, T>::value || is_duration_type<T>::value ||
           is_interval_type<T>::value || is_fixed_size_binary_type<T>::value ||
+          is_string_view_type<T>::value ||
           std::is_same<Date64Type, T>::value || std::is_same<Time64Type, T>::value ||
           std::is_same<ExtensionType, T>::value,
       Status>::type
@@ -801,6 +802,7 @@ Status WriteTable(const Table& table, io::OutputStream* dst,
     IpcWriteOptions ipc_options = IpcWriteOptions::Defaults();
     ipc_options.unify_dictionaries = true;
     ipc_options.allow_64bit = true;
+    ipc_options.use_threads = properties.use_threads;
     ARROW_ASSIGN_OR_RAISE(
         ipc_options.codec,
         util::Codec::Create(properties.compression, properties.compression_level));
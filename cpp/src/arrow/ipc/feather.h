@@ -129,6 +129,10 @@ struct ARROW_EXPORT WriteProperties {
 
   /// Compressor-specific compression level
   int compression_level = ::arrow::util::kUseDefaultCompressionLevel;
+
+  /// Compress on the global CPU thread pool. Several chunks, and the
+  /// buffers of all their columns, are then compressed in parallel
+  bool use_threads = true;
 };
 
 ARROW_EXPORT
@@ -127,6 +127,8 @@ class TestFeather : public ::testing::TestWithParam<TestParam>, public TestFeath
 
     auto props = WriteProperties::Defaults();
     props.version = param.version;
+    props.chunksize = chunksize_;
+    props.use_threads = use_threads_;
 
     // Don't fail if the build doesn't have LZ4_FRAME or ZSTD enabled
     if (util::Codec::IsAvailable(param.compression)) {
@@ -136,6 +138,10 @@ class TestFeather : public ::testing::TestWithParam<TestParam>, public TestFeath
     }
     return props;
   }
+
+ protected:
+  int64_t chunksize_ = WriteProperties::Defaults().chunksize;
+  bool use_threads_ = WriteProperties::Defaults().use_threads;
 };
 
 class TestFeatherRoundTrip : public ::testing::TestWithParam<ipc::test::MakeRecordBatch*>,
@@ -213,6 +219,25 @@ TEST_P(TestFeather, PrimitiveIntRoundTrip) {
   CheckRoundtrip(batch);
 }
 
+TEST_P(TestFeather, ManyChunksRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeStringTypesRecordBatchWithNulls(&batch));
+  // More chunks than threads, so that compressed chunks are written
+  // in several rounds
+  chunksize_ = 3;
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch}));
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads);
+    use_threads_ = use_threads;
+    DoWrite(*table);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->Read(&result));
+    ASSERT_OK(result->ValidateFull());
+    AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST_P(TestFeather, PrimitiveFloatRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(ipc::test::MakeFloat3264Batch(&batch));
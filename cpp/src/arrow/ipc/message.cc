@@ -471,9 +471,11 @@ class MessageDecoder::MessageDecoderImpl {
         next_required_size_(initial_next_required_size),
         chunks_(),
         buffered_size_(0),
-        metadata_(nullptr) {}
+        metadata_(nullptr),
+        next_buffer_filled_(0) {}
 
   Status ConsumeData(const uint8_t* data, int64_t size) {
+    RETURN_NOT_OK(CheckNoPendingNextBuffer());
     if (buffered_size_ == 0) {
       while (size > 0 && size >= next_required_size_) {
         auto used_size = next_required_size_;
@@ -510,6 +512,7 @@ class MessageDecoder::MessageDecoderImpl {
   }
 
   Status ConsumeBuffer(std::shared_ptr<Buffer> buffer) {
+    RETURN_NOT_OK(CheckNoPendingNextBuffer());
     if (buffered_size_ == 0) {
       while (buffer->size() >= next_required_size_) {
         auto used_size = next_required_size_;
@@ -555,11 +558,66 @@ class MessageDecoder::MessageDecoderImpl {
     return ConsumeChunks();
   }
 
-  int64_t next_required_size() const { return next_required_size_ - buffered_size_; }
+  Result<std::shared_ptr<Buffer>> GetNextBuffer() {
+    if (state_ == State::EOS) {
+      return Status::Invalid("Message decoder reached end of stream");
+    }
+    if (next_buffer_ == nullptr) {
+      if (state_ == State::INITIAL || state_ == State::METADATA_LENGTH) {
+        // The 4-byte prefixes are only read, so their buffer is reused
+        if (prefix_buffer_ == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(prefix_buffer_, AllocateBuffer(sizeof(int32_t), pool_));
+        }
+        next_buffer_ = prefix_buffer_;
+      } else {
+        // Metadata and bodies are retained by the decoded messages, so they
+        // get a fresh allocation of their exact size
+        ARROW_ASSIGN_OR_RAISE(next_buffer_, AllocateBuffer(next_required_size_, pool_));
+      }
+      // Move data fed previously through Consume() to the new buffer
+      next_buffer_filled_ = buffered_size_;
+      RETURN_NOT_OK(ConsumeDataChunks(buffered_size_, next_buffer_->mutable_data()));
+    }
+    return SliceMutableBuffer(next_buffer_, next_buffer_filled_);
+  }
+
+  Status ConsumeNextBuffer(int64_t nbytes) {
+    if (next_buffer_ == nullptr) {
+      return Status::Invalid("ConsumeNextBuffer() called without GetNextBuffer()");
+    }
+    if (nbytes < 0 || next_buffer_filled_ + nbytes > next_buffer_->size()) {
+      return Status::Invalid("Cannot consume ", nbytes, " bytes, only ",
+                             next_buffer_->size() - next_buffer_filled_,
+                             " bytes are required");
+    }
+    next_buffer_filled_ += nbytes;
+    if (next_buffer_filled_ < next_buffer_->size()) {
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> buffer = std::move(next_buffer_);
+    next_buffer_.reset();
+    next_buffer_filled_ = 0;
+    return ConsumeBuffer(std::move(buffer));
+  }
+
+  int64_t next_required_size() const {
+    return next_required_size_ - buffered_size_ - next_buffer_filled_;
+  }
 
   MessageDecoder::State state() const { return state_; }
 
  private:
+  Status CheckNoPendingNextBuffer() {
+    if (next_buffer_filled_ > 0) {
+      return Status::Invalid(
+          "Cannot consume data while the buffer returned by GetNextBuffer() is "
+          "partially filled");
+    }
+    // An unfilled buffer is simply dropped
+    next_buffer_.reset();
+    return Status::OK();
+  }
+
   Status ConsumeChunks() {
     while (state_ != State::EOS) {
       if (buffered_size_ < next_required_size_) {
@@ -798,6 +856,10 @@ class MessageDecoder::MessageDecoderImpl {
   std::vector<std::shared_ptr<Buffer>> chunks_;
   int64_t buffered_size_;
   std::shared_ptr<Buffer> metadata_;  // Must be CPU buffer
+  // Buffer handed out by GetNextBuffer(), of size next_required_size_
+  std::shared_ptr<Buffer> next_buffer_;
+  int64_t next_buffer_filled_;
+  std::shared_ptr<Buffer> prefix_buffer_;
 };
 
 MessageDecoder::MessageDecoder(std::shared_ptr<MessageDecoderListener> listener,
@@ -823,6 +885,14 @@ Status MessageDecoder::Consume(std::shared_ptr<Buffer> buffer) {
   return impl_->ConsumeBuffer(buffer);
 }
 
+Result<std::shared_ptr<Buffer>> MessageDecoder::GetNextBuffer() {
+  return impl_->GetNextBuffer();
+}
+
+Status MessageDecoder::ConsumeNextBuffer(int64_t nbytes) {
+  return impl_->ConsumeNextBuffer(nbytes);
+}
+
 int64_t MessageDecoder::next_required_size() const { return impl_->next_required_size(); }
 
 MessageDecoder::State MessageDecoder::state() const { return impl_->state(); }
@@ -319,6 +319,44 @@ class ARROW_EXPORT MessageDecoder {
   /// \return Status
   Status Consume(std::shared_ptr<Buffer> buffer);
 
+  /// \brief Return a buffer to read the next bytes of the stream into
+  ///
+  /// This method is provided for users who want to read data directly
+  /// into the decoder's buffers, without intermediate copies. The
+  /// returned buffer is mutable and has exactly next_required_size()
+  /// bytes. Metadata and message bodies are read into buffers
+  /// allocated from the decoder's memory pool with their exact size,
+  /// which are then used as is by the decoded messages. The
+  /// continuation and metadata length prefixes are read into a small
+  /// buffer reused by the decoder.
+  ///
+  /// After writing n bytes of the stream at the start of the returned
+  /// buffer, call ConsumeNextBuffer(n). If n is less than the buffer
+  /// size, GetNextBuffer() returns the remaining part of the same
+  /// buffer. Consume() must not be called while such a buffer is
+  /// partially filled.
+  ///
+  /// ~~~{.cpp}
+  /// while (decoder.next_required_size() > 0) {
+  ///   ARROW_ASSIGN_OR_RAISE(auto buffer, decoder.GetNextBuffer());
+  ///   ARROW_ASSIGN_OR_RAISE(auto n, input->Read(buffer->size(),
+  ///                                             buffer->mutable_data()));
+  ///   if (n == 0) break;
+  ///   RETURN_NOT_OK(decoder.ConsumeNextBuffer(n));
+  /// }
+  /// ~~~
+  ///
+  /// \return a mutable buffer of next_required_size() bytes
+  Result<std::shared_ptr<Buffer>> GetNextBuffer();
+
+  /// \brief Feed the decoder with data written to the buffer returned
+  /// by GetNextBuffer().
+  ///
+  /// \param[in] nbytes the number of bytes written at the start of
+  /// the buffer returned by GetNextBuffer()
+  /// \return Status
+  Status ConsumeNextBuffer(int64_t nbytes);
+
   /// \brief Return the number of bytes needed to advance the state of
   /// the decoder.
   ///
@@ -108,6 +108,10 @@ flatbuf::MetadataVersion MetadataVersionToFlatbuffer(MetadataVersion version) {
 bool HasValidityBitmap(Type::type type_id, MetadataVersion version) {
   // In V4, null types have no validity bitmap
   // In V5 and later, null and union types have no validity bitmap
+  // Run-end encoded types never have one, they postdate V5
+  if (type_id == Type::RUN_END_ENCODED) {
+    return false;
+  }
   return (version < MetadataVersion::V5) ? (type_id != Type::NA)
                                          : ::arrow::internal::HasValidityBitmap(type_id);
 }
@@ -349,6 +353,15 @@ Status ConcreteTypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
       }
       *out = std::make_shared<LargeListType>(children[0]);
       return Status::OK();
+    case flatbuf::Type::RunEndEncoded:
+      if (children.size() != 2) {
+        return Status::Invalid("RunEndEncoded must have exactly 2 child fields");
+      }
+      if (!RunEndEncodedType::RunEndTypeValid(*children[0]->type())) {
+        return Status::Invalid("RunEndEncoded run ends must be int16, int32 or int64");
+      }
+      *out = run_end_encoded(children[0]->type(), children[1]->type());
+      return Status::OK();
     case flatbuf::Type::Map:
       if (children.size() != 1) {
         return Status::Invalid("Map must have exactly 1 child field");
@@ -522,6 +535,11 @@ class FieldToFlatbufferVisitor {
     return Status::OK();
   }
 
+  Status Visit(const StringViewType& type) {
+    // The IPC format has no representation for string views yet
+    return Status::NotImplemented("Unable to convert type: ", type.ToString());
+  }
+
   Status Visit(const StringType& type) {
     fb_type_ = flatbuf::Type::Utf8;
     type_offset_ = flatbuf::CreateUtf8(fbb_).Union();
@@ -626,6 +644,13 @@ class FieldToFlatbufferVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    fb_type_ = flatbuf::Type::RunEndEncoded;
+    RETURN_NOT_OK(VisitChildFields(type));
+    type_offset_ = flatbuf::CreateRunEndEncoded(fbb_).Union();
+    return Status::OK();
+  }
+
   Status Visit(const MapType& type) {
     fb_type_ = flatbuf::Type::Map;
     RETURN_NOT_OK(VisitChildFields(type));
@@ -59,6 +59,19 @@ using KVVector = flatbuffers::Vector<KeyValueOffset>;
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// A compressed body buffer split into several frames (see
+// IpcWriteOptions::compression_frame_size) has its frames preceded by a
+// skippable frame, which both LZ4 frame and ZSTD decoders ignore.  After the
+// magic number and the payload size, its payload holds kCompressedFramesTag,
+// the number of frames, then the uncompressed and compressed length of each
+// frame as int64 (all little-endian).
+constexpr uint32_t kSkippableFrameMagic = 0x184D2A50;
+constexpr uint32_t kCompressedFramesTag = 0x46575241;  // "ARWF"
+
+// Schema custom_metadata key holding the base64-encoded dictionary of the ZSTD
+// codec the body buffers were compressed with (see util::CodecOptions)
+constexpr char kCompressionDictionaryMetadataKey[] = "ARROW:ipc:zstd_dictionary";
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion::V5;
 
@@ -70,6 +70,18 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// like compression
   bool use_threads = true;
 
+  /// \brief Compress body buffers larger than this many bytes as several frames
+  ///
+  /// If positive, a body buffer larger than this is split into independently
+  /// compressed frames of (at most) this uncompressed size, so that a single
+  /// large buffer is compressed and decompressed on several threads (see
+  /// use_threads).  The frames are preceded by an index stored in a skippable
+  /// frame, so the buffer remains a valid LZ4 frame or ZSTD stream, but readers
+  /// which expect a single frame per buffer may not be able to decode it.
+  ///
+  /// Default is 0 (one frame per buffer) to maximize compatibility.
+  int64_t compression_frame_size = 0;
+
   /// \brief Whether to emit dictionary deltas
   ///
   /// If false, a changed dictionary for a given field will emit a full
@@ -82,6 +94,12 @@ struct ARROW_EXPORT IpcWriteOptions {
   ///
   /// Also, note that if a changed dictionary is a nested dictionary,
   /// then a delta is never emitted, for compatibility with the read path.
+  ///
+  /// For the IPC file format, which doesn't support dictionary replacements,
+  /// this allows the dictionary of a field to grow across record batches
+  /// (for example when record batches are written incrementally and
+  /// unify_dictionaries can't be used).  Readers apply all deltas before
+  /// reading any record batch, which then all see the final dictionary.
   bool emit_dictionary_deltas = false;
 
   /// \brief Whether to unify dictionaries for the IPC file format
@@ -93,7 +111,8 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// If this option is true, RecordBatchWriter::WriteTable will attempt
   /// to unify dictionaries across each table column.  If this option is
   /// false, unequal dictionaries across a table column will simply raise
-  /// an error.
+  /// an error, unless they can be written as dictionary deltas (see
+  /// emit_dictionary_deltas).
   ///
   /// Note that enabling this option has a runtime cost. Also, not all types
   /// currently support dictionary unification.
@@ -102,6 +121,39 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to record per-batch column statistics in the file footer
+  ///
+  /// If true, the minimum, maximum and null count of each top-level column of
+  /// each record batch are stored in the custom_metadata of the IPC file footer,
+  /// where RecordBatchFileReader::GetRecordBatchStatistics can retrieve them to
+  /// skip record batches without reading them.  Minimum and maximum are only
+  /// computed for boolean, numeric (except half-float), temporal (except interval)
+  /// and binary-like columns.
+  ///
+  /// This option is ignored for IPC streams, which don't have a footer.
+  bool write_statistics = false;
+
+  /// \brief Coalesce the small writes of IPC stream messages up to this many bytes
+  ///
+  /// If positive, the metadata of the messages written to an IPC stream, and
+  /// their body buffers smaller than this, are gathered in a buffer of this size.
+  /// It is handed to the sink in a single write once full, once
+  /// write_coalescing_max_delay has elapsed, or when the writer is closed.
+  /// Larger body buffers are written directly.  This saves many small writes
+  /// (e.g. system calls on sockets) when streaming small record batches.
+  ///
+  /// This option is ignored for IPC files.  Default is 0 (no coalescing).
+  int64_t write_coalescing_size = 0;
+
+  /// \brief How long in seconds coalesced writes may be held back
+  ///
+  /// After writing a message, the pending writes are flushed if the oldest of
+  /// them is at least this old.  As this is only checked when a message is
+  /// written, messages written before a pause are held back until the next
+  /// message is written or the writer is closed, unless this is 0 (the default)
+  /// in which case each message is flushed as a single write.
+  double write_coalescing_max_delay = 0;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -149,6 +201,29 @@ struct ARROW_EXPORT IpcReadOptions {
   /// RecordBatchStreamReader and StreamDecoder classes.
   bool ensure_native_endian = true;
 
+  /// \brief EXPERIMENTAL: Read the buffers of a column when it is first accessed
+  ///
+  /// Only applies to RecordBatchFileReader on files supporting zero-copy reads,
+  /// such as io::MemoryMappedFile.  ReadRecordBatch then only reads and checks
+  /// the record batch metadata, and the buffers of each column are read from
+  /// the file the first time the column is accessed.  For a memory-mapped file,
+  /// this means only the buffers of the accessed columns are advised to be
+  /// paged in (with madvise), instead of the whole record batch body.
+  ///
+  /// The file must remain open while columns are accessed.  Compressed record
+  /// batches, and record batches whose endianness is converted, are always
+  /// loaded eagerly.
+  bool lazy_columns = false;
+
+  /// \brief Dictionary to decompress ZSTD-compressed body buffers with
+  ///
+  /// Needed if the writer's IpcWriteOptions::codec was created with a
+  /// dictionary.  The RecordBatchFileReader, RecordBatchStreamReader and
+  /// StreamDecoder classes, as well as ReadRecordBatch() given a schema read
+  /// with ReadSchema(), take it from the schema metadata where the writer
+  /// stores it.  This only needs to be set otherwise.
+  std::shared_ptr<Buffer> compression_dictionary;
+
   static IpcReadOptions Defaults();
 };
 
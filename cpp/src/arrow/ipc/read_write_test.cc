@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -46,8 +47,10 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -353,6 +356,7 @@ const std::vector<test::MakeRecordBatch*> kBatchCases = {
     &MakeBooleanBatch,
     &MakeFloatBatch,
     &MakeIntervals,
+    &MakeRunEndEncoded,
     &MakeUuid,
     &MakeDictExtension};
 
@@ -624,6 +628,13 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
     write_options.use_threads = false;
     read_options.use_threads = false;
     CheckRoundtrip(*batch, write_options, read_options);
+
+    // Check buffers compressed as several frames
+    write_options.compression_frame_size = 256;
+    CheckRoundtrip(*batch, write_options, read_options);
+    write_options.use_threads = true;
+    read_options.use_threads = true;
+    CheckRoundtrip(*batch, write_options, read_options);
   }
 
   std::vector<Compression::type> disallowed_codecs = {
@@ -639,6 +650,62 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithCompressionDictionary) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", int32())},
+                                key_value_metadata({"key"}, {"value"}));
+  auto batch = RecordBatch::Make(
+      schema, 500, {rg.String(500, 0, 10, 0.1), rg.Int32(500, 0, 100, 0.1)});
+
+  // ZSTD takes any content as a dictionary
+  util::CodecOptions codec_options;
+  codec_options.dictionary = Buffer::FromString("Apache Arrow columnar in-memory format");
+  IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec,
+                       util::Codec::Create(Compression::ZSTD, codec_options));
+
+  for (bool file_format : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    std::shared_ptr<RecordBatchWriter> writer;
+    if (file_format) {
+      ASSERT_OK_AND_ASSIGN(writer, MakeFileWriter(sink, schema, write_options));
+    } else {
+      ASSERT_OK_AND_ASSIGN(writer, MakeStreamWriter(sink, schema, write_options));
+    }
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    // The readers take the dictionary from the schema metadata, and remove it
+    std::shared_ptr<RecordBatch> read_batch;
+    if (file_format) {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      AssertSchemaEqual(*schema, *reader->schema(), /*check_metadata=*/true);
+      ASSERT_OK_AND_ASSIGN(read_batch, reader->ReadRecordBatch(0));
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                            std::make_shared<io::BufferReader>(buffer)));
+      AssertSchemaEqual(*schema, *reader->schema(), /*check_metadata=*/true);
+      ASSERT_OK(reader->ReadNext(&read_batch));
+
+      // As does ReadRecordBatch() given the schema as read by ReadSchema()
+      io::BufferReader stream(buffer);
+      DictionaryMemo memo;
+      ASSERT_OK_AND_ASSIGN(auto read_schema, ReadSchema(&stream, &memo));
+      ASSERT_NE(read_schema->metadata()->FindKey("ARROW:ipc:zstd_dictionary"), -1);
+      ASSERT_OK_AND_ASSIGN(auto message, ReadMessage(&stream));
+      ASSERT_OK_AND_ASSIGN(auto other_batch, ReadRecordBatch(*message, read_schema, &memo,
+                                                             IpcReadOptions::Defaults()));
+      AssertBatchesEqual(*batch, *other_batch);
+    }
+    AssertBatchesEqual(*batch, *read_batch);
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1009,6 +1076,28 @@ struct FileWriterHelper {
   int64_t footer_offset_;
 };
 
+// Reads the file through RecordBatchFileReader::GetRecordBatchGenerator
+struct FileGeneratorWriterHelper : public FileWriterHelper {
+  Status ReadBatches(const IpcReadOptions& options, RecordBatchVector* out_batches,
+                     ReadStats* out_stats = nullptr) override {
+    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchFileReader::Open(
+                                           buf_reader.get(), footer_offset_, options));
+    EXPECT_EQ(num_batches_written_, reader->num_record_batches());
+
+    // Only coalesce adjacent buffers, so that skipped fields are not read
+    io::CacheOptions cache_options = io::CacheOptions::Defaults();
+    cache_options.hole_size_limit = 0;
+    ARROW_ASSIGN_OR_RAISE(auto generator,
+                          reader->GetRecordBatchGenerator(
+                              /*readahead=*/2, io::default_io_context(), cache_options,
+                              ::arrow::internal::GetCpuThreadPool()));
+    auto fut = CollectAsyncGenerator(std::move(generator));
+    ARROW_ASSIGN_OR_RAISE(*out_batches, fut.result());
+    return Status::OK();
+  }
+};
+
 struct StreamWriterHelper {
   static constexpr bool kIsFileFormat = false;
 
@@ -1119,6 +1208,26 @@ struct StreamDecoderLargeChunksWriterHelper : public StreamDecoderWriterHelper {
   }
 };
 
+struct StreamDecoderNextBufferWriterHelper : public StreamDecoderWriterHelper {
+  Status DoConsume(StreamDecoder* decoder) override {
+    // Feed a first byte through Consume(), then read the rest into the
+    // decoder's buffers in pieces of at most 7 bytes
+    RETURN_NOT_OK(decoder->Consume(buffer_->data(), 1));
+    int64_t offset = 1;
+    while (offset < buffer_->size() && decoder->next_required_size() > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto next_buffer, decoder->GetNextBuffer());
+      if (next_buffer->size() != decoder->next_required_size()) {
+        return Status::Invalid("Unexpected next buffer size");
+      }
+      auto nbytes = std::min<int64_t>({7, next_buffer->size(), buffer_->size() - offset});
+      memcpy(next_buffer->mutable_data(), buffer_->data() + offset, nbytes);
+      RETURN_NOT_OK(decoder->ConsumeNextBuffer(nbytes));
+      offset += nbytes;
+    }
+    return Status::OK();
+  }
+};
+
 // Parameterized mixin with tests for stream / file writer
 
 template <class WriterHelperType>
@@ -1342,6 +1451,9 @@ class ReaderWriterMixin : public ExtensionTypesMixin {
 class TestFileFormat : public ReaderWriterMixin<FileWriterHelper>,
                        public ::testing::TestWithParam<MakeRecordBatch*> {};
 
+class TestFileFormatGenerator : public ReaderWriterMixin<FileGeneratorWriterHelper>,
+                                public ::testing::TestWithParam<MakeRecordBatch*> {};
+
 class TestStreamFormat : public ReaderWriterMixin<StreamWriterHelper>,
                          public ::testing::TestWithParam<MakeRecordBatch*> {};
 
@@ -1355,6 +1467,9 @@ class TestStreamDecoderSmallChunks
 class TestStreamDecoderLargeChunks
     : public ReaderWriterMixin<StreamDecoderLargeChunksWriterHelper>,
       public ::testing::TestWithParam<MakeRecordBatch*> {};
+class TestStreamDecoderNextBuffer
+    : public ReaderWriterMixin<StreamDecoderNextBufferWriterHelper>,
+      public ::testing::TestWithParam<MakeRecordBatch*> {};
 
 TEST_P(TestFileFormat, RoundTrip) {
   TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
@@ -1366,6 +1481,16 @@ TEST_P(TestFileFormat, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestFileFormatGenerator, RoundTrip) {
+  TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+  TestZeroLengthRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+
+  IpcWriteOptions options;
+  options.write_legacy_ipc_format = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
+}
+
 Status MakeDictionaryBatch(std::shared_ptr<RecordBatch>* out) {
   auto f0_type = arrow::dictionary(int32(), utf8());
   auto f1_type = arrow::dictionary(int8(), utf8());
@@ -1567,10 +1692,22 @@ TEST_P(TestStreamDecoderLargeChunks, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+TEST_P(TestStreamDecoderNextBuffer, RoundTrip) {
+  TestRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+  TestZeroLengthRoundTrip(*GetParam(), IpcWriteOptions::Defaults());
+
+  IpcWriteOptions options;
+  options.write_legacy_ipc_format = true;
+  TestRoundTrip(*GetParam(), options);
+  TestZeroLengthRoundTrip(*GetParam(), options);
+}
+
 INSTANTIATE_TEST_SUITE_P(GenericIpcRoundTripTests, TestIpcRoundTrip,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(FileRoundTripTests, TestFileFormat,
                          ::testing::ValuesIn(kBatchCases));
+INSTANTIATE_TEST_SUITE_P(FileGeneratorRoundTripTests, TestFileFormatGenerator,
+                         ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamRoundTripTests, TestStreamFormat,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderDataRoundTripTests, TestStreamDecoderData,
@@ -1581,6 +1718,8 @@ INSTANTIATE_TEST_SUITE_P(StreamDecoderSmallChunksRoundTripTests,
                          TestStreamDecoderSmallChunks, ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderLargeChunksRoundTripTests,
                          TestStreamDecoderLargeChunks, ::testing::ValuesIn(kBatchCases));
+INSTANTIATE_TEST_SUITE_P(StreamDecoderNextBufferRoundTripTests,
+                         TestStreamDecoderNextBuffer, ::testing::ValuesIn(kBatchCases));
 
 TEST(TestIpcFileFormat, FooterMetaData) {
   // ARROW-6837
@@ -1599,6 +1738,169 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+// A zero-copy file counting the bytes read from it
+class ReadCountingFile : public io::RandomAccessFile {
+ public:
+  explicit ReadCountingFile(std::shared_ptr<Buffer> buffer)
+      : reader_(std::make_shared<io::BufferReader>(std::move(buffer))) {}
+
+  Status Close() override { return reader_->Close(); }
+  bool closed() const override { return reader_->closed(); }
+  Result<int64_t> Tell() const override { return reader_->Tell(); }
+  Status Seek(int64_t position) override { return reader_->Seek(position); }
+  Result<int64_t> GetSize() override { return reader_->GetSize(); }
+  bool supports_zero_copy() const override { return true; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    bytes_read_ += nbytes;
+    return reader_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    bytes_read_ += nbytes;
+    return reader_->Read(nbytes);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    bytes_read_ += nbytes;
+    return reader_->ReadAt(position, nbytes);
+  }
+
+  int64_t bytes_read() const { return bytes_read_; }
+
+ private:
+  std::shared_ptr<io::BufferReader> reader_;
+  std::atomic<int64_t> bytes_read_{0};
+};
+
+TEST(TestRecordBatchFileReader, LazyColumns) {
+  const int64_t length = 10000;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema(
+      {field("f0", int64()), field("f1", utf8()), field("f2", float64())});
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {rg.Int64(length, 0, 100, 0.1), rg.String(length, 0, 10, 0.1),
+       rg.Float64(length, 0, 1)});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (const auto& included_fields : std::vector<std::vector<int>>{{}, {2, 1}}) {
+    auto file = std::make_shared<ReadCountingFile>(buffer);
+    auto options = IpcReadOptions::Defaults();
+    options.lazy_columns = true;
+    options.included_fields = included_fields;
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+    const int64_t footer_bytes_read = file->bytes_read();
+
+    // Only the metadata is read until a column is accessed
+    ASSERT_OK_AND_ASSIGN(auto lazy_batch, reader->ReadRecordBatch(1));
+    const int64_t metadata_bytes_read = file->bytes_read() - footer_bytes_read;
+    ASSERT_LT(metadata_bytes_read, 1024);
+
+    auto expected_batch = batch;
+    if (!included_fields.empty()) {
+      ASSERT_OK_AND_ASSIGN(expected_batch, batch->RemoveColumn(0));
+    }
+    const int f2 = lazy_batch->schema()->GetFieldIndex("f2");
+    AssertArraysEqual(*expected_batch->column(f2), *lazy_batch->column(f2));
+    ASSERT_EQ(file->bytes_read() - footer_bytes_read - metadata_bytes_read,
+              length * static_cast<int64_t>(sizeof(double)));
+
+    AssertBatchesEqual(*expected_batch, *lazy_batch, /*check_metadata=*/true);
+    ASSERT_OK(lazy_batch->ValidateFull());
+  }
+}
+
+TEST(TestRecordBatchFileReader, Statistics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("d", float64()),
+                                 field("s", utf8()), field("l", list(int8()))});
+  auto batch0 = RecordBatch::Make(schema, 3,
+                                  {ArrayFromJSON(int32(), "[3, null, 1]"),
+                                   ArrayFromJSON(float64(), "[NaN, 2.5, -1]"),
+                                   ArrayFromJSON(utf8(), R"(["b", "a", null])"),
+                                   ArrayFromJSON(list(int8()), "[null, null, null]")});
+  auto batch1 = RecordBatch::Make(schema, 2,
+                                  {ArrayFromJSON(int32(), "[null, null]"),
+                                   ArrayFromJSON(float64(), "[NaN, NaN]"),
+                                   ArrayFromJSON(utf8(), R"(["z", "y"])"),
+                                   ArrayFromJSON(list(int8()), "[null, null]")});
+  auto metadata = key_value_metadata({"key"}, {"value"});
+
+  std::shared_ptr<Buffer> buffer, buffer_without_statistics;
+  for (bool write_statistics : {true, false}) {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_statistics = write_statistics;
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema, options, metadata));
+    ASSERT_OK(writer->WriteRecordBatch(*batch0));
+    ASSERT_OK(writer->WriteRecordBatch(*batch1));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto file_buffer, sink->Finish());
+    (write_statistics ? buffer : buffer_without_statistics) = file_buffer;
+  }
+
+  auto reader_options = IpcReadOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchFileReader::Open(
+                           std::make_shared<io::BufferReader>(buffer), reader_options));
+  ASSERT_TRUE(reader->metadata()->Equals(*metadata));
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetRecordBatchStatistics(0));
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_EQ(statistics->num_rows, 3);
+  ASSERT_EQ(statistics->columns.size(), 4U);
+  ASSERT_EQ(statistics->columns[0]->null_count, 1);
+  AssertScalarsEqual(Int32Scalar(1), *statistics->columns[0]->min);
+  AssertScalarsEqual(Int32Scalar(3), *statistics->columns[0]->max);
+  ASSERT_EQ(statistics->columns[1]->null_count, 0);
+  AssertScalarsEqual(DoubleScalar(-1), *statistics->columns[1]->min);
+  AssertScalarsEqual(DoubleScalar(2.5), *statistics->columns[1]->max);
+  ASSERT_EQ(statistics->columns[2]->null_count, 1);
+  AssertScalarsEqual(StringScalar("a"), *statistics->columns[2]->min);
+  AssertScalarsEqual(StringScalar("b"), *statistics->columns[2]->max);
+  // No ordering for lists, only the null count is recorded
+  ASSERT_EQ(statistics->columns[3]->null_count, 3);
+  ASSERT_EQ(statistics->columns[3]->min, nullptr);
+
+  // All nulls or NaNs: no min or max
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(1));
+  ASSERT_EQ(statistics->num_rows, 2);
+  ASSERT_EQ(statistics->columns[0]->null_count, 2);
+  ASSERT_EQ(statistics->columns[0]->min, nullptr);
+  ASSERT_EQ(statistics->columns[0]->max, nullptr);
+  ASSERT_EQ(statistics->columns[1]->min, nullptr);
+  AssertScalarsEqual(StringScalar("y"), *statistics->columns[2]->min);
+  AssertScalarsEqual(StringScalar("z"), *statistics->columns[2]->max);
+  ASSERT_EQ(statistics->columns[3]->null_count, 2);
+
+  auto i_at_least_2 = [](const RecordBatchStatistics& statistics) -> Result<bool> {
+    const auto& max = statistics.columns[0]->max;
+    return max != nullptr && checked_cast<const Int32Scalar&>(*max).value >= 2;
+  };
+  ASSERT_OK_AND_EQ(std::vector<int>{0}, reader->SelectRecordBatches(i_at_least_2));
+
+  // Statistics follow the included fields
+  reader_options.included_fields = {2};
+  ASSERT_OK_AND_ASSIGN(reader,
+                       RecordBatchFileReader::Open(
+                           std::make_shared<io::BufferReader>(buffer), reader_options));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(1));
+  ASSERT_EQ(statistics->columns.size(), 1U);
+  AssertScalarsEqual(StringScalar("y"), *statistics->columns[0]->min);
+
+  // Without statistics, all record batches are selected
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(
+                                   std::make_shared<io::BufferReader>(
+                                       buffer_without_statistics)));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(0));
+  ASSERT_EQ(statistics, nullptr);
+  ASSERT_OK_AND_EQ((std::vector<int>{0, 1}), reader->SelectRecordBatches(i_at_least_2));
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -1647,6 +1949,84 @@ TEST_F(TestStreamFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
 TEST_F(TestFileFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
+TEST_F(TestFileFormatGenerator, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
+
+TEST_F(TestFileFormatGenerator, ReadFieldSubset) { TestReadSubsetOfFields(); }
+
+// An OutputStream counting the writes made to it
+class WriteCountingStream : public io::OutputStream {
+ public:
+  WriteCountingStream() : sink_(*io::BufferOutputStream::Create()) {}
+
+  Status Close() override { return sink_->Close(); }
+  bool closed() const override { return sink_->closed(); }
+  Result<int64_t> Tell() const override { return sink_->Tell(); }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    ++num_writes_;
+    return sink_->Write(data, nbytes);
+  }
+
+  int64_t num_writes() const { return num_writes_; }
+  Result<std::shared_ptr<Buffer>> Finish() { return sink_->Finish(); }
+
+ private:
+  std::shared_ptr<io::BufferOutputStream> sink_;
+  int64_t num_writes_ = 0;
+};
+
+TEST(TestRecordBatchStreamWriter, CoalesceWrites) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 100; ++i) {
+    const int64_t length = i % 10 == 0 ? 1000 : 3;
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rg.Int32(length, 0, 100, 0.1), rg.String(length, 0, 10, 0.1)}));
+  }
+
+  auto CheckWrites = [&](int64_t coalescing_size, double max_delay,
+                         int64_t expected_num_writes) {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_coalescing_size = coalescing_size;
+    options.write_coalescing_max_delay = max_delay;
+    WriteCountingStream sink;
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(&sink, schema, options));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    if (expected_num_writes > 0) {
+      ASSERT_EQ(sink.num_writes(), expected_num_writes);
+    }
+
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink.Finish());
+    ASSERT_OK_AND_ASSIGN(
+        auto reader,
+        RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer)));
+    RecordBatchVector read_batches;
+    ASSERT_OK(reader->ReadAll(&read_batches));
+    ASSERT_EQ(read_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *read_batches[i]);
+    }
+  };
+
+  // Without coalescing, each message takes several writes
+  WriteCountingStream sink;
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(&sink, schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[1]));
+  ASSERT_GT(sink.num_writes(), 2);
+
+  // One write per message (schema, batches and end-of-stream)
+  CheckWrites(1 << 20, /*max_delay=*/0, 102);
+  // A single write when closing
+  CheckWrites(1 << 20, /*max_delay=*/3600, 1);
+  // Bodies larger than the coalescing size are written directly
+  CheckWrites(256, /*max_delay=*/3600, -1);
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -1767,6 +2147,27 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+TEST(TestStreamDecoder, NextBuffer) {
+  auto listener = std::make_shared<CollectListener>();
+  StreamDecoder decoder(listener);
+  ASSERT_RAISES(Invalid, decoder.ConsumeNextBuffer(1));
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, decoder.GetNextBuffer());
+  ASSERT_EQ(decoder.next_required_size(), buffer->size());
+  ASSERT_TRUE(buffer->is_mutable());
+  ASSERT_RAISES(Invalid, decoder.ConsumeNextBuffer(buffer->size() + 1));
+  memset(buffer->mutable_data(), 0xff, 1);
+  ASSERT_OK(decoder.ConsumeNextBuffer(1));
+  ASSERT_EQ(buffer->size() - 1, decoder.next_required_size());
+
+  // The partially filled buffer must be completed before calling Consume()
+  const uint8_t data[1] = {0xff};
+  ASSERT_RAISES(Invalid, decoder.Consume(data, 1));
+  ASSERT_OK_AND_ASSIGN(auto rest, decoder.GetNextBuffer());
+  ASSERT_EQ(buffer->data() + 1, rest->data());
+  ASSERT_EQ(decoder.next_required_size(), rest->size());
+}
+
 template <typename WriterHelperType>
 class TestDictionaryReplacement : public ::testing::Test {
  public:
@@ -1826,7 +2227,18 @@ class TestDictionaryReplacement : public ::testing::Test {
     // Emit deltas
     write_options_.emit_dictionary_deltas = true;
     if (WriterHelper::kIsFileFormat) {
-      CheckWritingFails(batches, 1);
+      // Deltas are allowed, but not the final replacement
+      CheckWritingFails(batches, 3);
+
+      RecordBatchVector delta_batches{batch1, batch2, batch3}, actual;
+      ASSERT_OK(RoundTrip(delta_batches, &actual));
+      EXPECT_EQ(read_stats_.num_messages, 7);  // including schema message
+      EXPECT_EQ(read_stats_.num_record_batches, 3);
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 3);
+      EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+      EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
+      // All batches are read with the final dictionary
+      CheckBatchesLogical(delta_batches, actual);
     } else {
       CheckRoundtrip(batches);
       EXPECT_EQ(read_stats_.num_messages, 9);  // including schema message
@@ -18,9 +18,11 @@
 #include "arrow/ipc/reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -30,11 +32,14 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/device.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/statistics_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
@@ -42,6 +47,8 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -51,6 +58,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -133,6 +141,12 @@ struct IpcReadContext {
   const bool swap_endian;
 };
 
+/// \brief A buffer read deferred by ArrayLoader, to be filled in by the caller
+struct BufferReadRequest {
+  io::ReadRange range;
+  std::shared_ptr<Buffer>* out;
+};
+
 /// The field_index and buffer_index are incremented based on how much of the
 /// batch is "consumed" (through nested data reconstruction, for example)
 class ArrayLoader {
@@ -145,6 +159,20 @@ class ArrayLoader {
         file_(file),
         max_recursion_depth_(options.max_recursion_depth) {}
 
+  /// \brief Construct a loader which does not read any buffer itself, but
+  /// records the range of each one (at file_offset plus the buffer's offset)
+  /// in read_requests().  Buffers of length 0 are allocated immediately.
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       MetadataVersion metadata_version, const IpcReadOptions& options,
+                       int64_t file_offset)
+      : metadata_(metadata),
+        metadata_version_(metadata_version),
+        file_(NULLPTR),
+        file_offset_(file_offset),
+        max_recursion_depth_(options.max_recursion_depth) {}
+
+  const std::vector<BufferReadRequest>& read_requests() const { return read_requests_; }
+
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
@@ -160,6 +188,10 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (file_ == NULLPTR) {
+      read_requests_.push_back({{file_offset_ + offset, length}, out});
+      return Status::OK();
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -305,6 +337,10 @@ class ArrayLoader {
     return LoadBinary<T>(type.id());
   }
 
+  Status Visit(const StringViewType& type) {
+    return Status::NotImplemented("Loading arrays of type ", type.ToString());
+  }
+
   Status Visit(const FixedSizeBinaryType& type) {
     out_->buffers.resize(2);
     RETURN_NOT_OK(LoadCommon(type.id()));
@@ -356,7 +392,9 @@ class ArrayLoader {
     // - dense union children must be rewritten (at least one of them)
     //   to insert the required null slots that were formerly omitted
     // So instead we bail out.
-    if (out_->null_count != 0 && out_->buffers[0] != nullptr) {
+    // (the bitmap may not have been read yet if the buffer reads are deferred)
+    if (out_->null_count != 0 &&
+        internal::HasValidityBitmap(type.id(), metadata_version_)) {
       return Status::Invalid(
           "Cannot read pre-1.0.0 Union array with top-level validity bitmap");
     }
@@ -373,6 +411,14 @@ class ArrayLoader {
     return LoadChildren(type.fields());
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    // Run-end encoded arrays have no buffers, only the run ends and values
+    out_->buffers.resize(1);
+    RETURN_NOT_OK(LoadCommon(type.id()));
+    out_->null_count = 0;
+    return LoadChildren(type.fields());
+  }
+
   Status Visit(const DictionaryType& type) {
     // out_->dictionary will be filled later in ResolveDictionaries()
     return LoadType(*type.index_type());
@@ -384,6 +430,8 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  int64_t file_offset_ = 0;
+  std::vector<BufferReadRequest> read_requests_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
@@ -393,36 +441,92 @@ class ArrayLoader {
   ArrayData* out_;
 };
 
-Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
-                                                 const IpcReadOptions& options,
-                                                 util::Codec* codec) {
-  if (buf == nullptr || buf->size() == 0) {
-    return buf;
+// A compressed buffer, or a frame of one, to decompress into (part of) its
+// uncompressed buffer
+struct DecompressionTask {
+  const uint8_t* input;
+  int64_t input_length;
+  uint8_t* output;
+  int64_t output_length;
+};
+
+// Append the tasks decompressing the frames of a buffer compressed as several
+// frames, or return false if the buffer holds a single frame
+Result<bool> GetFrameDecompressionTasks(const uint8_t* data, int64_t size,
+                                        uint8_t* output, int64_t output_length,
+                                        std::vector<DecompressionTask>* tasks) {
+  auto Load32 = [data](int64_t offset) {
+    return BitUtil::FromLittleEndian(util::SafeLoadAs<uint32_t>(data + offset));
+  };
+  auto Load64 = [data](int64_t offset) {
+    return BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data + offset));
+  };
+  // Skippable frame magic and payload size, then tag and number of frames
+  constexpr int64_t kFrameHeaderSize = 2 * sizeof(uint32_t);
+  constexpr int64_t kHeaderSize = 2 * kFrameHeaderSize;
+  constexpr int64_t kEntrySize = 2 * sizeof(int64_t);
+  if (size < kHeaderSize || Load32(0) != internal::kSkippableFrameMagic ||
+      Load32(8) != internal::kCompressedFramesTag) {
+    return false;
+  }
+  const int64_t payload_size = Load32(4);
+  const int64_t num_frames = Load32(12);
+  const int64_t frames_start = kFrameHeaderSize + payload_size;
+  if (frames_start != kHeaderSize + num_frames * kEntrySize || frames_start > size) {
+    return Status::Invalid("Likely corrupted message, invalid compressed frame index");
+  }
+
+  const uint8_t* input = data + frames_start;
+  int64_t input_remaining = size - frames_start;
+  int64_t output_remaining = output_length;
+  for (int64_t i = 0; i < num_frames; ++i) {
+    const int64_t frame_output_length = Load64(kHeaderSize + i * kEntrySize);
+    const int64_t frame_input_length =
+        Load64(kHeaderSize + i * kEntrySize + sizeof(int64_t));
+    if (frame_output_length < 0 || frame_output_length > output_remaining ||
+        frame_input_length < 0 || frame_input_length > input_remaining) {
+      return Status::Invalid("Likely corrupted message, compressed frame ", i,
+                             " exceeds its buffer");
+    }
+    tasks->push_back({input, frame_input_length, output, frame_output_length});
+    input += frame_input_length;
+    input_remaining -= frame_input_length;
+    output += frame_output_length;
+    output_remaining -= frame_output_length;
+  }
+  if (input_remaining != 0 || output_remaining != 0) {
+    return Status::Invalid("Likely corrupted message, compressed frames don't ",
+                           "cover their buffer");
   }
+  return true;
+}
 
-  if (buf->size() < 8) {
+// Allocate the uncompressed buffer of a compressed buffer, and append the
+// task(s) filling it
+Result<std::shared_ptr<Buffer>> PrepareDecompression(
+    const Buffer& buf, const IpcReadOptions& options,
+    std::vector<DecompressionTask>* tasks) {
+  if (buf.size() < 8) {
     return Status::Invalid(
         "Likely corrupted message, compressed buffers "
         "are larger than 8 bytes by construction");
   }
 
-  const uint8_t* data = buf->data();
-  int64_t compressed_size = buf->size() - sizeof(int64_t);
+  const uint8_t* data = buf.data();
+  int64_t compressed_size = buf.size() - sizeof(int64_t);
   int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
 
   ARROW_ASSIGN_OR_RAISE(auto uncompressed,
                         AllocateBuffer(uncompressed_size, options.memory_pool));
 
   ARROW_ASSIGN_OR_RAISE(
-      int64_t actual_decompressed,
-      codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
-                        uncompressed->mutable_data()));
-  if (actual_decompressed != uncompressed_size) {
-    return Status::Invalid("Failed to fully decompress buffer, expected ",
-                           uncompressed_size, " bytes but decompressed ",
-                           actual_decompressed);
+      bool has_frames,
+      GetFrameDecompressionTasks(data + sizeof(int64_t), compressed_size,
+                                 uncompressed->mutable_data(), uncompressed_size, tasks));
+  if (!has_frames) {
+    tasks->push_back({data + sizeof(int64_t), compressed_size,
+                      uncompressed->mutable_data(), uncompressed_size});
   }
-
   return std::move(uncompressed);
 }
 
@@ -451,48 +555,185 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
 
+  util::CodecOptions codec_options;
+  if (util::Codec::SupportsDictionary(compression)) {
+    codec_options.dictionary = options.compression_dictionary;
+  }
   std::unique_ptr<util::Codec> codec;
-  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression, codec_options));
+
+  // Frames of buffers compressed as several frames are decompressed in
+  // parallel, like separate buffers
+  std::vector<std::shared_ptr<Buffer>> compressed_buffers;
+  std::vector<DecompressionTask> tasks;
+  for (auto buffer : buffers) {
+    if (*buffer == nullptr || (*buffer)->size() == 0) {
+      continue;
+    }
+    compressed_buffers.push_back(*buffer);
+    ARROW_ASSIGN_OR_RAISE(*buffer, PrepareDecompression(**buffer, options, &tasks));
+  }
 
   return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
+      options.use_threads, static_cast<int>(tasks.size()), [&](int i) {
+        const DecompressionTask& task = tasks[i];
+        ARROW_ASSIGN_OR_RAISE(int64_t actual_decompressed,
+                              codec->Decompress(task.input_length, task.input,
+                                                task.output_length, task.output));
+        if (actual_decompressed != task.output_length) {
+          return Status::Invalid("Failed to fully decompress buffer, expected ",
+                                 task.output_length, " bytes but decompressed ",
+                                 actual_decompressed);
+        }
         return Status::OK();
       });
 }
 
-Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
-    const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, context.metadata_version, context.options, file);
-
-  ArrayDataVector columns(schema->num_fields());
-  ArrayDataVector filtered_columns;
-  FieldVector filtered_fields;
-  std::shared_ptr<Schema> filtered_schema;
-
+// Load the fields selected by inclusion_mask (all of them if null); the other
+// entries of columns are left null.  If given, read_request_ends receives for
+// each field the number of read requests deferred by the loader so far.
+Status LoadRecordBatchColumns(const flatbuf::RecordBatch* metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              const std::vector<bool>* inclusion_mask,
+                              ArrayLoader* loader, ArrayDataVector* columns,
+                              std::vector<size_t>* read_request_ends = NULLPTR) {
+  columns->assign(schema->num_fields(), nullptr);
+  if (read_request_ends) {
+    read_request_ends->clear();
+  }
   for (int i = 0; i < schema->num_fields(); ++i) {
     const Field& field = *schema->field(i);
     if (!inclusion_mask || (*inclusion_mask)[i]) {
       // Read field
       auto column = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(loader.Load(&field, column.get()));
+      RETURN_NOT_OK(loader->Load(&field, column.get()));
       if (metadata->length() != column->length) {
         return Status::IOError("Array length did not match record batch length");
       }
-      columns[i] = std::move(column);
-      if (inclusion_mask) {
-        filtered_columns.push_back(columns[i]);
-        filtered_fields.push_back(schema->field(i));
-      }
+      (*columns)[i] = std::move(column);
     } else {
       // Skip field. This logic must be executed to advance the state of the
       // loader to the next field
-      RETURN_NOT_OK(loader.SkipField(&field));
+      RETURN_NOT_OK(loader->SkipField(&field));
+    }
+    if (read_request_ends) {
+      read_request_ends->push_back(loader->read_requests().size());
     }
   }
+  return Status::OK();
+}
+
+// Check that the deferred reads of a record batch lie within its body
+Status CheckReadRequests(const std::vector<BufferReadRequest>& read_requests,
+                         int64_t body_offset, int64_t body_length) {
+  for (const auto& request : read_requests) {
+    if (request.range.offset + request.range.length > body_offset + body_length) {
+      return Status::Invalid("Buffer at offset ", request.range.offset - body_offset,
+                             " extends past the end of the record batch body");
+    }
+  }
+  return Status::OK();
+}
+
+/// \brief A record batch whose column buffers are read from the file when the
+/// column is first accessed
+///
+/// The columns are loaded (without their buffers) and their dictionaries
+/// resolved upfront, so that reading the buffers from a zero-copy file is the
+/// only operation left on access.
+class LazyRecordBatch : public RecordBatch {
+ public:
+  struct PendingColumn {
+    std::shared_ptr<ArrayData> data;
+    std::vector<BufferReadRequest> read_requests;
+  };
+
+  LazyRecordBatch(std::shared_ptr<Schema> schema, int64_t num_rows,
+                  std::vector<PendingColumn> columns,
+                  std::shared_ptr<io::RandomAccessFile> file)
+      : RecordBatch(std::move(schema), num_rows),
+        columns_(std::move(columns)),
+        boxed_columns_(columns_.size()),
+        file_(std::move(file)) {}
+
+  std::shared_ptr<Array> column(int i) const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!boxed_columns_[i]) {
+      boxed_columns_[i] = MakeArray(LoadColumn(i));
+    }
+    return boxed_columns_[i];
+  }
+
+  std::shared_ptr<ArrayData> column_data(int i) const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return LoadColumn(i);
+  }
+
+  ArrayDataVector column_data() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ArrayDataVector result(columns_.size());
+    for (int i = 0; i < static_cast<int>(columns_.size()); ++i) {
+      result[i] = LoadColumn(i);
+    }
+    return result;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> AddColumn(
+      int i, const std::shared_ptr<Field>& field,
+      const std::shared_ptr<Array>& column) const override {
+    return Materialize()->AddColumn(i, field, column);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> SetColumn(
+      int i, const std::shared_ptr<Field>& field,
+      const std::shared_ptr<Array>& column) const override {
+    return Materialize()->SetColumn(i, field, column);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> RemoveColumn(int i) const override {
+    return Materialize()->RemoveColumn(i);
+  }
+
+  std::shared_ptr<RecordBatch> ReplaceSchemaMetadata(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
+    return Materialize()->ReplaceSchemaMetadata(metadata);
+  }
+
+  std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override {
+    return Materialize()->Slice(offset, length);
+  }
+
+ private:
+  std::shared_ptr<RecordBatch> Materialize() const {
+    return RecordBatch::Make(schema_, num_rows_, column_data());
+  }
+
+  // Must be called with mutex_ held
+  const std::shared_ptr<ArrayData>& LoadColumn(int i) const {
+    auto& column = columns_[i];
+    for (const auto& request : column.read_requests) {
+      // The reads can only fail if the file was closed
+      ARROW_CHECK_OK(
+          file_->ReadAt(request.range.offset, request.range.length).Value(request.out));
+    }
+    column.read_requests.clear();
+    return column.data;
+  }
+
+  mutable std::mutex mutex_;
+  mutable std::vector<PendingColumn> columns_;
+  mutable std::vector<std::shared_ptr<Array>> boxed_columns_;
+  std::shared_ptr<io::RandomAccessFile> file_;
+};
+
+// Resolve dictionaries, decompress and byte-swap the loaded columns as needed,
+// then assemble them into a record batch
+Result<std::shared_ptr<RecordBatch>> FinishRecordBatch(
+    int64_t length, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
+    ArrayDataVector columns) {
+  ArrayDataVector filtered_columns;
+  std::shared_ptr<Schema> filtered_schema;
 
   // Dictionary resolution needs to happen on the unfiltered columns,
   // because fields are mapped structurally (by path in the original schema).
@@ -500,6 +741,13 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
                                     context.options.memory_pool));
 
   if (inclusion_mask) {
+    FieldVector filtered_fields;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      if ((*inclusion_mask)[i]) {
+        filtered_columns.push_back(std::move(columns[i]));
+        filtered_fields.push_back(schema->field(i));
+      }
+    }
     filtered_schema = ::arrow::schema(std::move(filtered_fields), schema->metadata());
     columns.clear();
   } else {
@@ -518,8 +766,19 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
                             arrow::internal::SwapEndianArrayData(filtered_columns[i]));
     }
   }
-  return RecordBatch::Make(filtered_schema, metadata->length(),
-                           std::move(filtered_columns));
+  return RecordBatch::Make(filtered_schema, length, std::move(filtered_columns));
+}
+
+Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
+    const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
+    io::RandomAccessFile* file) {
+  ArrayLoader loader(metadata, context.metadata_version, context.options, file);
+  ArrayDataVector columns;
+  RETURN_NOT_OK(
+      LoadRecordBatchColumns(metadata, schema, inclusion_mask, &loader, &columns));
+  return FinishRecordBatch(metadata->length(), schema, inclusion_mask, context,
+                           std::move(columns));
 }
 
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
@@ -605,10 +864,10 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                          reader.get());
 }
 
-Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
-    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-    const std::vector<bool>& inclusion_mask, IpcReadContext& context,
-    io::RandomAccessFile* file) {
+// Verify the metadata of a record batch message and record its compression
+// and metadata version in the context
+Result<const flatbuf::RecordBatch*> GetRecordBatchMetadata(const Buffer& metadata,
+                                                           IpcReadContext* context) {
   const flatbuf::Message* message = nullptr;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -619,14 +878,22 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
 
   Compression::type compression;
   RETURN_NOT_OK(GetCompression(batch, &compression));
-  if (context.compression == Compression::UNCOMPRESSED &&
+  if (context->compression == Compression::UNCOMPRESSED &&
       message->version() == flatbuf::MetadataVersion::V4) {
     // Possibly obtain codec information from experimental serialization format
     // in 0.17.x
     RETURN_NOT_OK(GetCompressionExperimental(message, &compression));
   }
-  context.compression = compression;
-  context.metadata_version = internal::GetMetadataVersion(message->version());
+  context->compression = compression;
+  context->metadata_version = internal::GetMetadataVersion(message->version());
+  return batch;
+}
+
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>& inclusion_mask, IpcReadContext& context,
+    io::RandomAccessFile* file) {
+  ARROW_ASSIGN_OR_RAISE(auto batch, GetRecordBatchMetadata(metadata, &context));
   return LoadRecordBatch(batch, schema, inclusion_mask, context, file);
 }
 
@@ -665,18 +932,42 @@ Status GetInclusionMaskAndOutSchema(const std::shared_ptr<Schema>& full_schema,
   return Status::OK();
 }
 
-Status UnpackSchemaMessage(const void* opaque_schema, const IpcReadOptions& options,
+// Remove the compression dictionary stored by the writer from the schema
+// metadata, decoding it into *dictionary if non-null
+Status ExtractCompressionDictionary(std::shared_ptr<Schema>* schema,
+                                    std::shared_ptr<Buffer>* dictionary) {
+  const auto& metadata = (*schema)->metadata();
+  const int index =
+      metadata ? metadata->FindKey(internal::kCompressionDictionaryMetadataKey) : -1;
+  if (index == -1) {
+    return Status::OK();
+  }
+  if (dictionary != nullptr) {
+    *dictionary =
+        Buffer::FromString(::arrow::util::base64_decode(metadata->value(index)));
+  }
+  auto stripped = metadata->Copy();
+  RETURN_NOT_OK(stripped->Delete(index));
+  *schema = stripped->size() > 0 ? (*schema)->WithMetadata(std::move(stripped))
+                                 : (*schema)->RemoveMetadata();
+  return Status::OK();
+}
+
+// The compression dictionary found in the schema metadata, if any, is set
+// in the options
+Status UnpackSchemaMessage(const void* opaque_schema, IpcReadOptions* options,
                            DictionaryMemo* dictionary_memo,
                            std::shared_ptr<Schema>* schema,
                            std::shared_ptr<Schema>* out_schema,
                            std::vector<bool>* field_inclusion_mask, bool* swap_endian) {
   RETURN_NOT_OK(internal::GetSchema(opaque_schema, dictionary_memo, schema));
+  RETURN_NOT_OK(ExtractCompressionDictionary(schema, &options->compression_dictionary));
 
   // If we are selecting only certain fields, populate the inclusion mask now
   // for fast lookups
-  RETURN_NOT_OK(GetInclusionMaskAndOutSchema(*schema, options.included_fields,
+  RETURN_NOT_OK(GetInclusionMaskAndOutSchema(*schema, options->included_fields,
                                              field_inclusion_mask, out_schema));
-  *swap_endian = options.ensure_native_endian && !out_schema->get()->is_native_endian();
+  *swap_endian = options->ensure_native_endian && !out_schema->get()->is_native_endian();
   if (*swap_endian) {
     // create a new schema with native endianness before swapping endian in ArrayData
     *schema = schema->get()->WithEndianness(Endianness::Native);
@@ -685,7 +976,7 @@ Status UnpackSchemaMessage(const void* opaque_schema, const IpcReadOptions& opti
   return Status::OK();
 }
 
-Status UnpackSchemaMessage(const Message& message, const IpcReadOptions& options,
+Status UnpackSchemaMessage(const Message& message, IpcReadOptions* options,
                            DictionaryMemo* dictionary_memo,
                            std::shared_ptr<Schema>* schema,
                            std::shared_ptr<Schema>* out_schema,
@@ -701,13 +992,19 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const Buffer& metadata, const std::shared_ptr<Schema>& schema,
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options,
     io::RandomAccessFile* file) {
+  // A schema obtained with ReadSchema() still carries the compression dictionary
+  std::shared_ptr<Schema> batch_schema = schema;
+  IpcReadOptions batch_options = options;
+  RETURN_NOT_OK(ExtractCompressionDictionary(&batch_schema,
+                                             &batch_options.compression_dictionary));
   std::shared_ptr<Schema> out_schema;
   // Empty means do not use
   std::vector<bool> inclusion_mask;
-  IpcReadContext context(const_cast<DictionaryMemo*>(dictionary_memo), options, false);
-  RETURN_NOT_OK(GetInclusionMaskAndOutSchema(schema, context.options.included_fields,
-                                             &inclusion_mask, &out_schema));
-  return ReadRecordBatchInternal(metadata, schema, inclusion_mask, context, file);
+  IpcReadContext context(const_cast<DictionaryMemo*>(dictionary_memo), batch_options,
+                         false);
+  RETURN_NOT_OK(GetInclusionMaskAndOutSchema(
+      batch_schema, context.options.included_fields, &inclusion_mask, &out_schema));
+  return ReadRecordBatchInternal(metadata, batch_schema, inclusion_mask, context, file);
 }
 
 Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
@@ -796,7 +1093,7 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
       return Status::Invalid("Tried reading schema message, was null or length 0");
     }
 
-    RETURN_NOT_OK(UnpackSchemaMessage(*message, options, &dictionary_memo_, &schema_,
+    RETURN_NOT_OK(UnpackSchemaMessage(*message, &options_, &dictionary_memo_, &schema_,
                                       &out_schema_, &field_inclusion_mask_,
                                       &swap_endian_));
     return Status::OK();
@@ -983,6 +1280,14 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
+    if (options_.lazy_columns && file_->supports_zero_copy()) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadLazyRecordBatch(GetRecordBatchBlock(i)));
+      if (batch) {
+        ++stats_.num_record_batches;
+        return batch;
+      }
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
 
     CHECK_HAS_BODY(*message);
@@ -995,6 +1300,34 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch;
   }
 
+  Result<RecordBatchGenerator> GetRecordBatchGenerator(
+      int readahead, const io::IOContext& io_context,
+      const io::CacheOptions& cache_options,
+      ::arrow::internal::Executor* cpu_executor) override {
+    if (readahead < 0) {
+      return Status::Invalid("readahead must be non-negative, got ", readahead);
+    }
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+
+    auto self = checked_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
+    auto next_index = std::make_shared<std::atomic<int>>(0);
+    RecordBatchGenerator generator = [self, next_index, io_context, cache_options,
+                                      cpu_executor]() {
+      const int i = next_index->fetch_add(1);
+      if (i >= self->num_record_batches()) {
+        return AsyncGeneratorEnd<std::shared_ptr<RecordBatch>>();
+      }
+      return self->ReadRecordBatchAsync(i, io_context, cache_options, cpu_executor);
+    };
+    if (readahead > 0) {
+      generator = MakeReadaheadGenerator(std::move(generator), readahead);
+    }
+    return generator;
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
               const IpcReadOptions& options) {
     owned_file_ = file;
@@ -1009,7 +1342,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     RETURN_NOT_OK(ReadFooter());
 
     // Get the schema and record any observed dictionaries
-    RETURN_NOT_OK(UnpackSchemaMessage(footer_->schema(), options, &dictionary_memo_,
+    RETURN_NOT_OK(UnpackSchemaMessage(footer_->schema(), &options_, &dictionary_memo_,
                                       &schema_, &out_schema_, &field_inclusion_mask_,
                                       &swap_endian_));
     ++stats_.num_messages;
@@ -1020,9 +1353,46 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
   std::shared_ptr<const KeyValueMetadata> metadata() const override { return metadata_; }
 
+  Result<std::shared_ptr<RecordBatchStatistics>> GetRecordBatchStatistics(
+      int i) override {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    if (encoded_statistics_.empty()) {
+      return nullptr;
+    }
+    RETURN_NOT_OK(DecodeStatistics());
+    return statistics_[i];
+  }
+
   ReadStats stats() const override { return stats_; }
 
  private:
+  // Decode the statistics from the footer on first use, keeping those of the
+  // included fields only
+  Status DecodeStatistics() {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    if (!statistics_.empty() || num_record_batches() == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto statistics,
+        internal::ReadStatistics(*schema_, num_record_batches(), encoded_statistics_));
+    if (!field_inclusion_mask_.empty()) {
+      for (const auto& batch_statistics : statistics) {
+        auto& columns = batch_statistics->columns;
+        size_t j = 0;
+        for (size_t i = 0; i < columns.size(); ++i) {
+          if (field_inclusion_mask_[i]) {
+            columns[j++] = std::move(columns[i]);
+          }
+        }
+        columns.resize(j);
+      }
+    }
+    statistics_ = std::move(statistics);
+    return Status::OK();
+  }
+
   FileBlock GetRecordBatchBlock(int i) const {
     return FileBlockFromFlatbuffer(footer_->recordBatches()->Get(i));
   }
@@ -1031,12 +1401,74 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+  // The file, not owned if the reader was opened on a raw pointer (the caller
+  // then guarantees that the file outlives whatever uses it)
+  std::shared_ptr<io::RandomAccessFile> SharedFile() const {
+    if (owned_file_) {
+      return owned_file_;
+    }
+    return std::shared_ptr<io::RandomAccessFile>(std::shared_ptr<void>(), file_);
+  }
+
+  // Read a record batch whose buffers are only read when its columns are
+  // accessed, or return null if the batch must be loaded eagerly
+  Result<std::shared_ptr<RecordBatch>> ReadLazyRecordBatch(const FileBlock& block) {
+    RETURN_NOT_OK(CheckBlockAligned(block));
+    ARROW_ASSIGN_OR_RAISE(auto block_metadata,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    ARROW_ASSIGN_OR_RAISE(auto metadata, GetBlockFlatbuffer(block, block_metadata));
+    IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    ARROW_ASSIGN_OR_RAISE(auto batch, GetRecordBatchMetadata(*metadata, &context));
+    if (context.compression != Compression::UNCOMPRESSED || context.swap_endian) {
+      return nullptr;
+    }
+
+    const int64_t body_offset = block.offset + block.metadata_length;
+    const auto inclusion_mask =
+        field_inclusion_mask_.empty() ? nullptr : &field_inclusion_mask_;
+    ArrayLoader loader(batch, context.metadata_version, options_, body_offset);
+    ArrayDataVector columns;
+    std::vector<size_t> read_request_ends;
+    RETURN_NOT_OK(LoadRecordBatchColumns(batch, schema_, inclusion_mask, &loader,
+                                         &columns, &read_request_ends));
+    const auto& read_requests = loader.read_requests();
+    RETURN_NOT_OK(CheckReadRequests(read_requests, body_offset, block.body_length));
+    RETURN_NOT_OK(
+        ResolveDictionaries(columns, dictionary_memo_, options_.memory_pool));
+
+    FieldVector fields;
+    std::vector<LazyRecordBatch::PendingColumn> pending_columns;
+    size_t read_requests_begin = 0;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const size_t read_requests_end = read_request_ends[i];
+      if (columns[i]) {
+        fields.push_back(schema_->field(i));
+        pending_columns.push_back(
+            {std::move(columns[i]),
+             std::vector<BufferReadRequest>(read_requests.begin() + read_requests_begin,
+                                            read_requests.begin() + read_requests_end)});
+      }
+      read_requests_begin = read_requests_end;
+    }
+    auto out_schema = inclusion_mask
+                          ? ::arrow::schema(std::move(fields), schema_->metadata())
+                          : schema_;
+    ++stats_.num_messages;
+    return std::make_shared<LazyRecordBatch>(std::move(out_schema), batch->length(),
+                                             std::move(pending_columns), SharedFile());
+  }
+
+  static Status CheckBlockAligned(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+    RETURN_NOT_OK(CheckBlockAligned(block));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
     // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -1047,6 +1479,121 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return std::move(message);
   }
 
+  // State of a record batch between the metadata read and the body reads
+  struct AsyncBatchState {
+    explicit AsyncBatchState(const IpcReadContext& context) : context(context) {}
+
+    std::shared_ptr<Buffer> metadata;
+    IpcReadContext context;
+    int64_t length = 0;
+    ArrayDataVector columns;
+    std::vector<BufferReadRequest> read_requests;
+  };
+
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(
+      int i, const io::IOContext& io_context, const io::CacheOptions& cache_options,
+      ::arrow::internal::Executor* cpu_executor) {
+    const FileBlock block = GetRecordBatchBlock(i);
+    RETURN_NOT_OK(CheckBlockAligned(block));
+    auto self = checked_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
+    return file_->ReadAsync(io_context, block.offset, block.metadata_length)
+        .Then([self, block, io_context, cache_options,
+               cpu_executor](const std::shared_ptr<Buffer>& metadata) {
+          return self->ReadRecordBatchBodyAsync(block, metadata, io_context,
+                                                cache_options, cpu_executor);
+        });
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchBodyAsync(
+      const FileBlock& block, const std::shared_ptr<Buffer>& block_metadata,
+      const io::IOContext& io_context, const io::CacheOptions& cache_options,
+      ::arrow::internal::Executor* cpu_executor) {
+    auto state = std::make_shared<AsyncBatchState>(
+        IpcReadContext(&dictionary_memo_, options_, swap_endian_));
+    ARROW_ASSIGN_OR_RAISE(state->metadata, GetBlockFlatbuffer(block, block_metadata));
+    ARROW_ASSIGN_OR_RAISE(auto batch,
+                          GetRecordBatchMetadata(*state->metadata, &state->context));
+    state->length = batch->length();
+
+    // Only compute the buffer ranges of the included fields here
+    const int64_t body_offset = block.offset + block.metadata_length;
+    const auto inclusion_mask =
+        field_inclusion_mask_.empty() ? nullptr : &field_inclusion_mask_;
+    ArrayLoader loader(batch, state->context.metadata_version, options_, body_offset);
+    RETURN_NOT_OK(LoadRecordBatchColumns(batch, schema_, inclusion_mask, &loader,
+                                         &state->columns));
+    state->read_requests = loader.read_requests();
+
+    RETURN_NOT_OK(
+        CheckReadRequests(state->read_requests, body_offset, block.body_length));
+    std::vector<io::ReadRange> ranges;
+    ranges.reserve(state->read_requests.size());
+    for (const auto& request : state->read_requests) {
+      ranges.push_back(request.range);
+    }
+
+    auto cache = std::make_shared<io::internal::ReadRangeCache>(SharedFile(), io_context,
+                                                                cache_options);
+    RETURN_NOT_OK(cache->Cache(ranges));
+    Future<> ready = cache->WaitFor(std::move(ranges));
+    if (cpu_executor) {
+      ready = cpu_executor->Transfer(std::move(ready));
+    }
+
+    auto self = checked_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
+    return ready.Then(
+        [self, state,
+         cache](const detail::Empty&) -> Result<std::shared_ptr<RecordBatch>> {
+          for (const auto& request : state->read_requests) {
+            ARROW_ASSIGN_OR_RAISE(*request.out, cache->Read(request.range));
+          }
+          const auto inclusion_mask = self->field_inclusion_mask_.empty()
+                                          ? nullptr
+                                          : &self->field_inclusion_mask_;
+          return FinishRecordBatch(state->length, self->schema_, inclusion_mask,
+                                   state->context, std::move(state->columns));
+        });
+  }
+
+  // Extract the flatbuffer-encoded Message from the metadata of a block,
+  // i.e. skip the (optional) continuation token and the length prefix
+  static Result<std::shared_ptr<Buffer>> GetBlockFlatbuffer(
+      const FileBlock& block, const std::shared_ptr<Buffer>& block_metadata) {
+    ARROW_ASSIGN_OR_RAISE(auto metadata, ViewOnCpu(block_metadata));
+    if (metadata->size() < block.metadata_length) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", metadata->size());
+    }
+    int64_t prefix_size = sizeof(int32_t);
+    if (metadata->size() < prefix_size) {
+      return Status::Invalid("metadata length is missing. File offset: ", block.offset,
+                             ", metadata length: ", block.metadata_length);
+    }
+    int32_t flatbuffer_size =
+        BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(metadata->data()));
+    if (flatbuffer_size == internal::kIpcContinuationToken) {
+      prefix_size += sizeof(int32_t);
+      if (metadata->size() < prefix_size) {
+        return Status::Invalid("metadata length is missing. File offset: ",
+                               block.offset,
+                               ", metadata length: ", block.metadata_length);
+      }
+      flatbuffer_size = BitUtil::FromLittleEndian(
+          util::SafeLoadAs<int32_t>(metadata->data() + sizeof(int32_t)));
+    }
+    if (flatbuffer_size <= 0 || prefix_size + flatbuffer_size > metadata->size()) {
+      return Status::Invalid("flatbuffer size ", flatbuffer_size,
+                             " invalid. File offset: ", block.offset,
+                             ", metadata length: ", block.metadata_length);
+    }
+    auto flatbuffer = SliceBuffer(metadata, prefix_size, flatbuffer_size);
+    if (reinterpret_cast<uintptr_t>(flatbuffer->data()) % 8 != 0) {
+      // Avoid potential UBSAN issues from Flatbuffers
+      ARROW_ASSIGN_OR_RAISE(flatbuffer, flatbuffer->CopySlice(0, flatbuffer->size()));
+    }
+    return flatbuffer;
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
@@ -1058,15 +1605,28 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), context, &kind, reader.get()));
       ++stats_.num_dictionary_batches;
-      if (kind != DictionaryKind::New) {
-        return Status::Invalid(
-            "Unsupported dictionary replacement or "
-            "dictionary delta in IPC file");
+      if (kind == DictionaryKind::Replacement) {
+        return Status::Invalid("Unsupported dictionary replacement in IPC file");
+      }
+      if (kind == DictionaryKind::Delta) {
+        // All dictionary batches are read before the record batches, so the
+        // record batches see the dictionaries with all their deltas applied.
+        // This is fine as deltas only append to a dictionary.
+        ++stats_.num_dictionary_deltas;
       }
     }
     return Status::OK();
   }
 
+  // Metadata is parsed on the CPU, even if the file returns device buffers (as a
+  // cuda::CudaFileReader does so that the message bodies stay on the device)
+  static Result<std::shared_ptr<Buffer>> ViewOnCpu(std::shared_ptr<Buffer> buffer) {
+    if (buffer->is_cpu()) {
+      return std::move(buffer);
+    }
+    return Buffer::ViewOrCopy(std::move(buffer), default_cpu_memory_manager());
+  }
+
   Status ReadFooter() {
     const int32_t magic_size = static_cast<int>(strlen(kArrowMagicBytes));
 
@@ -1077,6 +1637,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     int file_end_size = static_cast<int>(magic_size + sizeof(int32_t));
     ARROW_ASSIGN_OR_RAISE(auto buffer,
                           file_->ReadAt(footer_offset_ - file_end_size, file_end_size));
+    ARROW_ASSIGN_OR_RAISE(buffer, ViewOnCpu(std::move(buffer)));
 
     const int64_t expected_footer_size = magic_size + sizeof(int32_t);
     if (buffer->size() < expected_footer_size) {
@@ -1098,6 +1659,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     ARROW_ASSIGN_OR_RAISE(
         footer_buffer_,
         file_->ReadAt(footer_offset_ - footer_length - file_end_size, footer_length));
+    ARROW_ASSIGN_OR_RAISE(footer_buffer_, ViewOnCpu(std::move(footer_buffer_)));
 
     const auto data = footer_buffer_->data();
     const auto size = footer_buffer_->size();
@@ -1110,7 +1672,15 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (fb_metadata != nullptr) {
       std::shared_ptr<KeyValueMetadata> md;
       RETURN_NOT_OK(internal::GetKeyValueMetadata(fb_metadata, &md));
-      metadata_ = std::move(md);  // const-ify
+      // The record batch statistics are not part of the user's metadata
+      const int index = md->FindKey(internal::kStatisticsMetadataKey);
+      if (index != -1) {
+        encoded_statistics_ = md->value(index);
+        RETURN_NOT_OK(md->Delete(index));
+      }
+      if (md->size() > 0 || index == -1) {
+        metadata_ = std::move(md);  // const-ify
+      }
     }
 
     return Status::OK();
@@ -1135,6 +1705,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   const flatbuf::Footer* footer_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
 
+  // Per-batch column statistics, see IpcWriteOptions::write_statistics
+  std::string encoded_statistics_;
+  std::mutex statistics_mutex_;
+  std::vector<std::shared_ptr<RecordBatchStatistics>> statistics_;
+
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
@@ -1148,6 +1723,22 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   bool swap_endian_;
 };
 
+Result<std::vector<int>> RecordBatchFileReader::SelectRecordBatches(
+    const std::function<Result<bool>(const RecordBatchStatistics&)>& predicate) {
+  std::vector<int> selected;
+  for (int i = 0; i < num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto statistics, GetRecordBatchStatistics(i));
+    bool may_match = true;
+    if (statistics != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(may_match, predicate(*statistics));
+    }
+    if (may_match) {
+      selected.push_back(i);
+    }
+  }
+  return selected;
+}
+
 Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
     io::RandomAccessFile* file, const IpcReadOptions& options) {
   ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
@@ -1234,13 +1825,21 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
 
   std::shared_ptr<Schema> schema() const { return out_schema_; }
 
+  Result<std::shared_ptr<Buffer>> GetNextBuffer() {
+    return message_decoder_.GetNextBuffer();
+  }
+
+  Status ConsumeNextBuffer(int64_t nbytes) {
+    return message_decoder_.ConsumeNextBuffer(nbytes);
+  }
+
   int64_t next_required_size() const { return message_decoder_.next_required_size(); }
 
   ReadStats stats() const { return stats_; }
 
  private:
   Status OnSchemaMessageDecoded(std::unique_ptr<Message> message) {
-    RETURN_NOT_OK(UnpackSchemaMessage(*message, options_, &dictionary_memo_, &schema_,
+    RETURN_NOT_OK(UnpackSchemaMessage(*message, &options_, &dictionary_memo_, &schema_,
                                       &out_schema_, &field_inclusion_mask_,
                                       &swap_endian_));
 
@@ -1306,7 +1905,7 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
   }
 
   std::shared_ptr<Listener> listener_;
-  const IpcReadOptions options_;
+  IpcReadOptions options_;
   State state_;
   MessageDecoder message_decoder_;
   std::vector<bool> field_inclusion_mask_;
@@ -1332,6 +1931,14 @@ Status StreamDecoder::Consume(std::shared_ptr<Buffer> buffer) {
 
 std::shared_ptr<Schema> StreamDecoder::schema() const { return impl_->schema(); }
 
+Result<std::shared_ptr<Buffer>> StreamDecoder::GetNextBuffer() {
+  return impl_->GetNextBuffer();
+}
+
+Status StreamDecoder::ConsumeNextBuffer(int64_t nbytes) {
+  return impl_->ConsumeNextBuffer(nbytes);
+}
+
 int64_t StreamDecoder::next_required_size() const { return impl_->next_required_size(); }
 
 ReadStats StreamDecoder::stats() const { return impl_->stats(); }
@@ -21,10 +21,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/io/caching.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/options.h"
@@ -32,6 +35,7 @@
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -59,6 +63,27 @@ struct ReadStats {
   int64_t num_replaced_dictionaries = 0;
 };
 
+/// \brief Statistics of a column within one record batch of an IPC file
+///
+/// \see IpcWriteOptions::write_statistics
+struct ARROW_EXPORT ColumnStatistics {
+  /// The smallest and largest non-null values of the column, or null if the
+  /// column has no such values (e.g. all its values are null)
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+  /// The number of null values in the column
+  int64_t null_count = 0;
+};
+
+/// \brief Statistics of one record batch of an IPC file
+struct ARROW_EXPORT RecordBatchStatistics {
+  /// The number of rows in the record batch
+  int64_t num_rows = 0;
+  /// The statistics of each field of RecordBatchFileReader::schema(), or null
+  /// for the fields without statistics
+  std::vector<std::shared_ptr<ColumnStatistics>> columns;
+};
+
 /// \brief Synchronous batch stream reader that reads from io::InputStream
 ///
 /// This class reads the schema (plus any dictionaries) as the first messages
@@ -99,8 +124,11 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
 };
 
 /// \brief Reads the record batch file format
-class ARROW_EXPORT RecordBatchFileReader {
+class ARROW_EXPORT RecordBatchFileReader
+    : public std::enable_shared_from_this<RecordBatchFileReader> {
  public:
+  using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
+
   virtual ~RecordBatchFileReader() = default;
 
   /// \brief Open a RecordBatchFileReader
@@ -167,6 +195,44 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Return a generator reading the record batches of the file in order,
+  /// without blocking on I/O.
+  ///
+  /// The metadata of each record batch is read first.  Then only the buffers of
+  /// the fields selected by IpcReadOptions::included_fields are requested,
+  /// coalesced according to cache_options, instead of the whole message body.
+  /// The batch is assembled (and decompressed if needed) on cpu_executor if
+  /// given, otherwise on the thread that completed the I/O.
+  ///
+  /// Up to readahead record batches are read ahead of the consumer.  The
+  /// generator keeps this reader alive; if the reader was opened on a raw file
+  /// pointer, the file must outlive the generator.  Dictionaries are read
+  /// synchronously by this call.  The read statistics are not updated.
+  virtual Result<RecordBatchGenerator> GetRecordBatchGenerator(
+      int readahead = 0, const io::IOContext& io_context = io::default_io_context(),
+      const io::CacheOptions& cache_options = io::CacheOptions::Defaults(),
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
+  /// \brief Return the column statistics of a record batch from the file footer
+  ///
+  /// Returns null if the file was not written with
+  /// IpcWriteOptions::write_statistics.  No data is read from the file.
+  ///
+  /// \param[in] i the index of the record batch
+  virtual Result<std::shared_ptr<RecordBatchStatistics>> GetRecordBatchStatistics(
+      int i) = 0;
+
+  /// \brief Return the indices of the record batches which may satisfy a predicate
+  ///
+  /// The predicate is evaluated on the statistics of each record batch and
+  /// must return false only if none of the rows of the record batch can
+  /// satisfy it.  Record batches without statistics are always selected.
+  ///
+  /// \param[in] predicate the predicate to evaluate
+  /// \return the indices of the selected record batches, in increasing order
+  Result<std::vector<int>> SelectRecordBatches(
+      const std::function<Result<bool>(const RecordBatchStatistics&)>& predicate);
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
@@ -293,6 +359,44 @@ class ARROW_EXPORT StreamDecoder {
   /// \return the shared schema of the record batches in the stream
   std::shared_ptr<Schema> schema() const;
 
+  /// \brief Return a buffer to read the next bytes of the stream into
+  ///
+  /// This method is provided for users who want to read data directly
+  /// into the decoder's buffers, without intermediate copies. The
+  /// returned buffer is mutable and has exactly next_required_size()
+  /// bytes. Metadata and message bodies are read into buffers
+  /// allocated from IpcReadOptions::memory_pool with their exact size,
+  /// which are then used as is by the decoded record batches. The
+  /// continuation and metadata length prefixes are read into a small
+  /// buffer reused by the decoder.
+  ///
+  /// After writing n bytes of the stream at the start of the returned
+  /// buffer, call ConsumeNextBuffer(n). If n is less than the buffer
+  /// size, GetNextBuffer() returns the remaining part of the same
+  /// buffer. Consume() must not be called while such a buffer is
+  /// partially filled.
+  ///
+  /// ~~~{.cpp}
+  /// while (decoder.next_required_size() > 0) {
+  ///   ARROW_ASSIGN_OR_RAISE(auto buffer, decoder.GetNextBuffer());
+  ///   ARROW_ASSIGN_OR_RAISE(auto n, input->Read(buffer->size(),
+  ///                                             buffer->mutable_data()));
+  ///   if (n == 0) break;
+  ///   RETURN_NOT_OK(decoder.ConsumeNextBuffer(n));
+  /// }
+  /// ~~~
+  ///
+  /// \return a mutable buffer of next_required_size() bytes
+  Result<std::shared_ptr<Buffer>> GetNextBuffer();
+
+  /// \brief Feed the decoder with data written to the buffer returned
+  /// by GetNextBuffer().
+  ///
+  /// \param[in] nbytes the number of bytes written at the start of
+  /// the buffer returned by GetNextBuffer()
+  /// \return Status
+  Status ConsumeNextBuffer(int64_t nbytes);
+
   /// \brief Return the number of bytes needed to advance the state of
   /// the decoder.
   ///
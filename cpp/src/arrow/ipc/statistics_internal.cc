@@ -0,0 +1,300 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/statistics_internal.h"
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/value_parsing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace ipc {
+namespace internal {
+
+namespace {
+
+constexpr char kNumRowsName[] = "num_rows";
+constexpr char kNullCountName[] = "null_count";
+constexpr char kMinName[] = "min";
+constexpr char kMaxName[] = "max";
+
+// Types whose values are ordered by comparing the views of their array values
+template <typename T>
+using has_min_max = std::integral_constant<
+    bool, is_boolean_type<T>::value || has_string_view<T>::value ||
+              (has_c_type<T>::value && !is_half_float_type<T>::value &&
+               !is_interval_type<T>::value)>;
+
+template <typename T, typename R = void>
+using enable_if_min_max = enable_if_t<has_min_max<T>::value, R>;
+
+struct HasMinMaxVisitor {
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  template <typename T>
+  enable_if_min_max<T, Status> Visit(const T&) {
+    has_min_max = true;
+    return Status::OK();
+  }
+
+  bool has_min_max = false;
+};
+
+bool HasMinMax(const DataType& type) {
+  HasMinMaxVisitor visitor;
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.has_min_max;
+}
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+// Append the smallest and largest non-null (and non-NaN) values of an array,
+// or nulls if there are none
+struct MinMaxAppender {
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Min/max statistics of type ", type);
+  }
+
+  template <typename T>
+  enable_if_min_max<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    using BuilderType = typename TypeTraits<T>::BuilderType;
+    using ValueType = typename std::decay<decltype(
+        std::declval<const ArrayType&>().GetView(0))>::type;
+
+    const auto& values = checked_cast<const ArrayType&>(array);
+    auto* min_out = checked_cast<BuilderType*>(min_builder);
+    auto* max_out = checked_cast<BuilderType*>(max_builder);
+
+    bool found = false;
+    ValueType min{}, max{};
+    if (values.null_count() < values.length()) {
+      for (int64_t i = 0; i < values.length(); ++i) {
+        if (values.IsNull(i)) continue;
+        const auto value = values.GetView(i);
+        if (IsNaN(value)) continue;
+        if (!found) {
+          min = max = value;
+          found = true;
+        } else if (value < min) {
+          min = value;
+        } else if (max < value) {
+          max = value;
+        }
+      }
+    }
+    if (!found) {
+      RETURN_NOT_OK(min_out->AppendNull());
+      return max_out->AppendNull();
+    }
+    RETURN_NOT_OK(min_out->Append(min));
+    return max_out->Append(max);
+  }
+
+  const Array& array;
+  ArrayBuilder* min_builder;
+  ArrayBuilder* max_builder;
+};
+
+}  // namespace
+
+struct StatisticsCollector::ColumnCollector {
+  explicit ColumnCollector(MemoryPool* pool) : null_count(pool) {}
+
+  Int64Builder null_count;
+  // Null if the field type has no ordering
+  std::unique_ptr<ArrayBuilder> min;
+  std::unique_ptr<ArrayBuilder> max;
+};
+
+StatisticsCollector::StatisticsCollector(std::shared_ptr<Schema> schema,
+                                         MemoryPool* pool)
+    : schema_(std::move(schema)), pool_(pool) {}
+
+StatisticsCollector::~StatisticsCollector() = default;
+
+Status StatisticsCollector::Append(const RecordBatch& batch) {
+  if (columns_.empty()) {
+    for (const auto& field : schema_->fields()) {
+      auto column = ::arrow::internal::make_unique<ColumnCollector>(pool_);
+      if (HasMinMax(*field->type())) {
+        RETURN_NOT_OK(MakeBuilder(pool_, field->type(), &column->min));
+        RETURN_NOT_OK(MakeBuilder(pool_, field->type(), &column->max));
+      }
+      columns_.push_back(std::move(column));
+    }
+  }
+  if (batch.num_columns() != static_cast<int>(columns_.size())) {
+    return Status::Invalid("Record batch has ", batch.num_columns(),
+                           " columns, expected ", columns_.size());
+  }
+
+  num_rows_.push_back(batch.num_rows());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& array = *batch.column(i);
+    auto* column = columns_[i].get();
+    RETURN_NOT_OK(column->null_count.Append(array.null_count()));
+    if (column->min != nullptr) {
+      MinMaxAppender appender{array, column->min.get(), column->max.get()};
+      RETURN_NOT_OK(VisitTypeInline(*array.type(), &appender));
+    }
+  }
+  return Status::OK();
+}
+
+Result<std::string> StatisticsCollector::Finish() {
+  const auto num_record_batches = static_cast<int64_t>(num_rows_.size());
+
+  Int64Builder num_rows_builder(pool_);
+  RETURN_NOT_OK(num_rows_builder.AppendValues(num_rows_));
+  std::shared_ptr<Array> num_rows;
+  RETURN_NOT_OK(num_rows_builder.Finish(&num_rows));
+
+  FieldVector fields = {field(kNumRowsName, int64(), /*nullable=*/false)};
+  ArrayVector columns = {num_rows};
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    auto* column = columns_[i].get();
+    std::vector<std::string> names = {kNullCountName};
+    ArrayVector children(1);
+    RETURN_NOT_OK(column->null_count.Finish(&children[0]));
+    if (column->min != nullptr) {
+      names.push_back(kMinName);
+      names.push_back(kMaxName);
+      children.resize(3);
+      RETURN_NOT_OK(column->min->Finish(&children[1]));
+      RETURN_NOT_OK(column->max->Finish(&children[2]));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto statistics, StructArray::Make(children, names));
+    fields.push_back(field(std::to_string(i), statistics->type()));
+    columns.push_back(std::move(statistics));
+  }
+  auto batch = RecordBatch::Make(schema(std::move(fields)), num_record_batches,
+                                 std::move(columns));
+
+  auto options = IpcWriteOptions::Defaults();
+  options.memory_pool = pool_;
+  options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(1024, pool_));
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, batch->schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+
+  return ::arrow::util::base64_encode(buffer->data(),
+                                      static_cast<unsigned int>(buffer->size()));
+}
+
+Result<std::vector<std::shared_ptr<RecordBatchStatistics>>> ReadStatistics(
+    const Schema& schema, int num_record_batches, const std::string& encoded) {
+  auto input = std::make_shared<io::BufferReader>(
+      Buffer::FromString(::arrow::util::base64_decode(encoded)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchStreamReader::Open(input));
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(reader->ReadNext(&batch));
+  if (batch == nullptr || batch->num_rows() != num_record_batches) {
+    return Status::Invalid("Statistics of IPC file do not match its ",
+                           num_record_batches, " record batches");
+  }
+  RETURN_NOT_OK(batch->ValidateFull());
+
+  auto num_rows = batch->GetColumnByName(kNumRowsName);
+  if (num_rows == nullptr || num_rows->type_id() != Type::INT64 ||
+      num_rows->null_count() != 0) {
+    return Status::Invalid("Statistics of IPC file lack valid '", kNumRowsName,
+                           "' column");
+  }
+
+  std::vector<std::shared_ptr<RecordBatchStatistics>> out(num_record_batches);
+  for (int i = 0; i < num_record_batches; ++i) {
+    out[i] = std::make_shared<RecordBatchStatistics>();
+    out[i]->num_rows = checked_cast<const Int64Array&>(*num_rows).Value(i);
+    out[i]->columns.resize(schema.num_fields());
+  }
+
+  for (int c = 0; c < batch->num_columns(); ++c) {
+    const auto& name = batch->schema()->field(c)->name();
+    if (name == kNumRowsName) continue;
+
+    int32_t field_index = -1;
+    if (!::arrow::internal::ParseValue<Int32Type>(name.data(), name.size(),
+                                                  &field_index) ||
+        field_index < 0 || field_index >= schema.num_fields() ||
+        batch->column(c)->type_id() != Type::STRUCT) {
+      return Status::Invalid("Invalid statistics column '", name, "' in IPC file");
+    }
+    const auto& column = checked_cast<const StructArray&>(*batch->column(c));
+    const auto& field_type = *schema.field(field_index)->type();
+
+    auto null_count = column.GetFieldByName(kNullCountName);
+    auto min = column.GetFieldByName(kMinName);
+    auto max = column.GetFieldByName(kMaxName);
+    if (null_count == nullptr || null_count->type_id() != Type::INT64 ||
+        (min == nullptr) != (max == nullptr) ||
+        (min != nullptr &&
+         (!min->type()->Equals(field_type) || !max->type()->Equals(field_type)))) {
+      return Status::Invalid("Invalid statistics for field ", field_index,
+                             " in IPC file");
+    }
+
+    for (int i = 0; i < num_record_batches; ++i) {
+      if (column.IsNull(i)) continue;
+      auto statistics = std::make_shared<ColumnStatistics>();
+      if (null_count->IsValid(i)) {
+        statistics->null_count = checked_cast<const Int64Array&>(*null_count).Value(i);
+      }
+      if (min != nullptr && min->IsValid(i) && max->IsValid(i)) {
+        ARROW_ASSIGN_OR_RAISE(statistics->min, min->GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(statistics->max, max->GetScalar(i));
+      }
+      out[i]->columns[field_index] = std::move(statistics);
+    }
+  }
+  return out;
+}
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Per-batch column statistics stored in the IPC file footer
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+
+struct RecordBatchStatistics;
+
+namespace internal {
+
+// Key of the footer custom_metadata entry holding the statistics.
+//
+// The value is the base64 encoding of an IPC stream holding a single record
+// batch, with one row per record batch of the file.  Its first column
+// "num_rows" is the length of each record batch.  The statistics of the i-th
+// field of the file schema are in a struct column named "i" with children
+// "null_count" and, for types with an ordering, "min" and "max" of the field
+// type.
+constexpr char kStatisticsMetadataKey[] = "ARROW:ipc:statistics";
+
+/// \brief Compute the statistics of record batches written to an IPC file
+class ARROW_EXPORT StatisticsCollector {
+ public:
+  StatisticsCollector(std::shared_ptr<Schema> schema, MemoryPool* pool);
+  ~StatisticsCollector();
+
+  /// \brief Compute the statistics of the next record batch of the file
+  Status Append(const RecordBatch& batch);
+
+  /// \brief Serialize the statistics of all appended record batches
+  ///
+  /// \return the footer custom_metadata value for kStatisticsMetadataKey
+  Result<std::string> Finish();
+
+ private:
+  struct ColumnCollector;
+
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  std::vector<int64_t> num_rows_;
+  std::vector<std::unique_ptr<ColumnCollector>> columns_;
+};
+
+/// \brief Deserialize the statistics written by StatisticsCollector::Finish
+///
+/// \param[in] schema the schema of the IPC file
+/// \param[in] num_record_batches the number of record batches of the IPC file
+/// \param[in] encoded the footer custom_metadata value for kStatisticsMetadataKey
+/// \return the statistics of each record batch of the file
+ARROW_EXPORT
+Result<std::vector<std::shared_ptr<RecordBatchStatistics>>> ReadStatistics(
+    const Schema& schema, int num_record_batches, const std::string& encoded);
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
@@ -963,6 +963,25 @@ Status MakeNull(std::shared_ptr<RecordBatch>* out) {
   return Status::OK();
 }
 
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out) {
+  const int64_t length = 7;
+  ARROW_ASSIGN_OR_RAISE(auto a0, RunEndEncodedArray::Make(
+                                     length, ArrayFromJSON(int16(), "[3, 4, 7]"),
+                                     ArrayFromJSON(utf8(), R"(["foo", null, "bar"])")));
+  ARROW_ASSIGN_OR_RAISE(auto a1, RunEndEncodedArray::Make(
+                                     length, ArrayFromJSON(int32(), "[1, 2, 5, 7]"),
+                                     ArrayFromJSON(int32(), "[1, null, 3, 4]")));
+  // The writer must rebase the run ends of a sliced array
+  auto run_ends = ArrayFromJSON(int64(), "[2, 6, 10, 12]");
+  auto values = ArrayFromJSON(list(int8()), "[[1], [], null, [2, 3]]");
+  ARROW_ASSIGN_OR_RAISE(auto a2, RunEndEncodedArray::Make(length, run_ends, values,
+                                                          /*logical_offset=*/3));
+  auto schema = ::arrow::schema(
+      {field("f0", a0->type()), field("f1", a1->type()), field("f2", a2->type())});
+  *out = RecordBatch::Make(schema, length, {a0, a1, a2});
+  return Status::OK();
+}
+
 Status MakeUuid(std::shared_ptr<RecordBatch>* out) {
   auto uuid_type = uuid();
   auto storage_type = checked_cast<const ExtensionType&>(*uuid_type).storage_type();
@@ -156,6 +156,9 @@ Status MakeDecimal(std::shared_ptr<RecordBatch>* out);
 ARROW_TESTING_EXPORT
 Status MakeNull(std::shared_ptr<RecordBatch>* out);
 
+ARROW_TESTING_EXPORT
+Status MakeRunEndEncoded(std::shared_ptr<RecordBatch>* out);
+
 ARROW_TESTING_EXPORT
 Status MakeUuid(std::shared_ptr<RecordBatch>* out);
 
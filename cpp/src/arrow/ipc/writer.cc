@@ -18,6 +18,7 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -32,11 +33,13 @@
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/statistics_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result_internal.h"
@@ -54,6 +57,11 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/ree_util.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing_internal.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -197,9 +205,116 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  // A frame of a body buffer compressed as several frames
+  struct CompressedFrame {
+    size_t buffer_index;
+    int64_t offset;
+    int64_t length;
+    std::shared_ptr<Buffer> compressed;
+  };
+
+  template <typename T>
+  static uint8_t* PutLittleEndian(T value, uint8_t* out) {
+    util::SafeStore(out, BitUtil::ToLittleEndian(value));
+    return out + sizeof(T);
+  }
+
+  // Concatenate the compressed frames of a buffer behind their index
+  Result<std::shared_ptr<Buffer>> AssembleFrames(const CompressedFrame* frames,
+                                                 int64_t num_frames,
+                                                 int64_t uncompressed_size) {
+    const int64_t payload_size = 2 * sizeof(uint32_t) + num_frames * 2 * sizeof(int64_t);
+    int64_t size = sizeof(int64_t) + 2 * sizeof(uint32_t) + payload_size;
+    for (int64_t i = 0; i < num_frames; ++i) {
+      size += frames[i].compressed->size();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(size, options_.memory_pool));
+    uint8_t* out = result->mutable_data();
+    out = PutLittleEndian(uncompressed_size, out);
+    out = PutLittleEndian(internal::kSkippableFrameMagic, out);
+    out = PutLittleEndian(static_cast<uint32_t>(payload_size), out);
+    out = PutLittleEndian(internal::kCompressedFramesTag, out);
+    out = PutLittleEndian(static_cast<uint32_t>(num_frames), out);
+    for (int64_t i = 0; i < num_frames; ++i) {
+      out = PutLittleEndian(frames[i].length, out);
+      out = PutLittleEndian(frames[i].compressed->size(), out);
+    }
+    for (int64_t i = 0; i < num_frames; ++i) {
+      const auto& compressed = frames[i].compressed;
+      std::memcpy(out, compressed->data(), static_cast<size_t>(compressed->size()));
+      out += compressed->size();
+    }
+    return std::move(result);
+  }
+
+  // Compress the buffers larger than frame_size as several frames.  Frames of
+  // all buffers (and the smaller buffers) are compressed in a single parallel
+  // loop, so that one large buffer doesn't leave the other threads idle.
+  Status CompressBodyBuffersInFrames(int64_t frame_size) {
+    std::vector<size_t> whole_buffers;
+    std::vector<CompressedFrame> frames;
+    for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
+      const int64_t size = out_->body_buffers[i]->size();
+      if (size == 0) {
+        continue;
+      }
+      if (size <= frame_size) {
+        whole_buffers.push_back(i);
+        continue;
+      }
+      if (BitUtil::CeilDiv(size, frame_size) > (1 << 24)) {
+        return Status::Invalid("compression_frame_size ", frame_size,
+                               " would split a buffer of ", size,
+                               " bytes into too many frames");
+      }
+      for (int64_t offset = 0; offset < size; offset += frame_size) {
+        frames.push_back({i, offset, std::min(frame_size, size - offset), nullptr});
+      }
+    }
+
+    util::Codec* codec = options_.codec.get();
+    const int num_whole_buffers = static_cast<int>(whole_buffers.size());
+    auto CompressOne = [&](int task) {
+      if (task < num_whole_buffers) {
+        auto& buffer = out_->body_buffers[whole_buffers[task]];
+        return CompressBuffer(*buffer, codec, &buffer);
+      }
+      CompressedFrame& frame = frames[task - num_whole_buffers];
+      const uint8_t* data = out_->body_buffers[frame.buffer_index]->data() + frame.offset;
+      const int64_t maximum_length = codec->MaxCompressedLen(frame.length, data);
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            AllocateBuffer(maximum_length, options_.memory_pool));
+      ARROW_ASSIGN_OR_RAISE(int64_t actual_length,
+                            codec->Compress(frame.length, data, maximum_length,
+                                            result->mutable_data()));
+      frame.compressed = SliceBuffer(std::move(result), /*offset=*/0, actual_length);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options_.use_threads, num_whole_buffers + static_cast<int>(frames.size()),
+        CompressOne));
+
+    for (size_t begin = 0; begin < frames.size();) {
+      const size_t buffer_index = frames[begin].buffer_index;
+      size_t end = begin;
+      while (end < frames.size() && frames[end].buffer_index == buffer_index) {
+        ++end;
+      }
+      auto& buffer = out_->body_buffers[buffer_index];
+      ARROW_ASSIGN_OR_RAISE(buffer, AssembleFrames(&frames[begin],
+                                                   static_cast<int64_t>(end - begin),
+                                                   buffer->size()));
+      begin = end;
+    }
+    return Status::OK();
+  }
+
   Status CompressBodyBuffers() {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
+    if (options_.compression_frame_size > 0) {
+      return CompressBodyBuffersInFrames(options_.compression_frame_size);
+    }
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
@@ -309,6 +424,11 @@ class RecordBatchSerializer {
 
   Status Visit(const NullArray& array) { return Status::OK(); }
 
+  Status Visit(const StringViewArray& array) {
+    return Status::NotImplemented("Serializing arrays of type ",
+                                  array.type()->ToString());
+  }
+
   template <typename T>
   typename std::enable_if<is_number_type<typename T::TypeClass>::value ||
                               is_temporal_type<typename T::TypeClass>::value ||
@@ -404,6 +524,26 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    --max_recursion_depth_;
+    const ArrayData& data = *array.data();
+    const int64_t physical_offset = array.FindPhysicalOffset();
+    const int64_t physical_length = array.FindPhysicalLength();
+    std::shared_ptr<Array> run_ends = array.run_ends();
+    if (array.offset() != 0 || physical_length != run_ends->length() ||
+        (physical_length > 0 &&
+         ree_util::GetRunEnd(*run_ends->data(), physical_length - 1) != array.length())) {
+      // Sliced array: rebase the run ends on the array offset and length
+      ARROW_ASSIGN_OR_RAISE(auto run_ends_data,
+                            ree_util::MakeLogicalRunEnds(data, options_.memory_pool));
+      run_ends = MakeArray(std::move(run_ends_data));
+    }
+    RETURN_NOT_OK(VisitArray(*run_ends));
+    RETURN_NOT_OK(VisitArray(*array.values()->Slice(physical_offset, physical_length)));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
   Status Visit(const SparseUnionArray& array) {
     const int64_t offset = array.offset();
     const int64_t length = array.length();
@@ -576,7 +716,9 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // Now write the buffers, in a single vectored write
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(payload.body_buffers.size() * 2);
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
     int64_t size = 0;
@@ -589,13 +731,16 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
+      buffers.push_back(buffer);
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      buffers.push_back(std::make_shared<Buffer>(kPaddingBytes, padding));
     }
   }
+  if (!buffers.empty()) {
+    RETURN_NOT_OK(dst->WriteV(buffers));
+  }
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -971,18 +1116,22 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<StatisticsCollector> statistics = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
+        statistics_(std::move(statistics)),
         options_(options) {}
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<StatisticsCollector> statistics = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(statistics)) {
     shared_schema_ = schema;
   }
 
@@ -993,22 +1142,21 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
 
-    RETURN_NOT_OK(WriteDictionaries(batch));
-
+    ARROW_TRACE_SPAN(span, "arrow::ipc::WriteRecordBatch");
+    ARROW_TRACE_SPAN_ATTRIBUTE(span, "rows", batch.num_rows());
     IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, &payload));
-    RETURN_NOT_OK(WritePayload(payload));
-    ++stats_.num_record_batches;
-    return Status::OK();
+    return WriteRecordBatchPayload(batch, payload);
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
     if (is_file_format_ && options_.unify_dictionaries) {
       ARROW_ASSIGN_OR_RAISE(auto unified_table,
-                            DictionaryUnifier::UnifyTable(table, options_.memory_pool));
-      return RecordBatchWriter::WriteTable(*unified_table, max_chunksize);
+                            DictionaryUnifier::UnifyTable(table, options_.memory_pool,
+                                                          options_.use_threads));
+      return WriteTableChunks(*unified_table, max_chunksize);
     } else {
-      return RecordBatchWriter::WriteTable(table, max_chunksize);
+      return WriteTableChunks(table, max_chunksize);
     }
   }
 
@@ -1029,6 +1177,62 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   WriteStats stats() const override { return stats_; }
 
  protected:
+  Status WriteRecordBatchPayload(const RecordBatch& batch, const IpcPayload& payload) {
+    RETURN_NOT_OK(WriteDictionaries(batch));
+    RETURN_NOT_OK(WritePayload(payload));
+    ++stats_.num_record_batches;
+    if (statistics_ != nullptr) {
+      RETURN_NOT_OK(statistics_->Append(batch));
+    }
+    return Status::OK();
+  }
+
+  Status WriteTableChunks(const Table& table, int64_t max_chunksize) {
+    if (options_.codec == nullptr || !options_.use_threads) {
+      return RecordBatchWriter::WriteTable(table, max_chunksize);
+    }
+    if (!table.schema()->Equals(schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+    RETURN_NOT_OK(CheckStarted());
+
+    // Compress several chunks at once, rather than only the buffers of one
+    // chunk, so that tables with few columns also keep all threads busy.
+    // The payloads are computed serially inside each task, as nesting
+    // ParallelFor calls on the same thread pool may deadlock.
+    TableBatchReader reader(table);
+    if (max_chunksize > 0) {
+      reader.set_chunksize(max_chunksize);
+    }
+    IpcWriteOptions chunk_options = options_;
+    chunk_options.use_threads = false;
+    const int window_size = std::max(1, GetCpuThreadPoolCapacity());
+
+    RecordBatchVector batches;
+    std::vector<IpcPayload> payloads(window_size);
+    while (true) {
+      batches.clear();
+      std::shared_ptr<RecordBatch> batch;
+      while (static_cast<int>(batches.size()) < window_size) {
+        RETURN_NOT_OK(reader.ReadNext(&batch));
+        if (batch == nullptr) break;
+        batches.push_back(std::move(batch));
+      }
+      if (batches.empty()) break;
+
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(batches.size()), [&](int i) {
+            payloads[i] = IpcPayload();
+            return GetRecordBatchPayload(*batches[i], chunk_options, &payloads[i]);
+          }));
+      for (size_t i = 0; i < batches.size(); ++i) {
+        RETURN_NOT_OK(WriteRecordBatchPayload(*batches[i], payloads[i]));
+        payloads[i] = IpcPayload();
+      }
+    }
+    return Status::OK();
+  }
+
   Status CheckStarted() {
     if (!started_) {
       return Start();
@@ -1063,13 +1267,6 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
           //  for the IPC file format)
           continue;
         }
-        if (is_file_format_) {
-          return Status::Invalid(
-              "Dictionary replacement detected when writing IPC file format. "
-              "Arrow IPC files only support a single dictionary for a given field "
-              "across all batches.");
-        }
-
         // (the read path doesn't support outer dictionary deltas, don't emit them)
         if (new_length > last_length && options_.emit_dictionary_deltas &&
             !HasNestedDict(*dictionary->data()) &&
@@ -1078,6 +1275,13 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
           // New dictionary starts with the current dictionary
           delta_start = last_length;
         }
+        if (is_file_format_ && !delta_start) {
+          return Status::Invalid(
+              "Dictionary replacement detected when writing IPC file format. "
+              "Arrow IPC files only support a single dictionary for a given field "
+              "across all batches, which may only grow through dictionary deltas "
+              "(see IpcWriteOptions::emit_dictionary_deltas).");
+        }
       }
 
       IpcPayload payload;
@@ -1116,11 +1320,13 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
   const bool is_file_format_;
+  // Per-batch column statistics, shared with the PayloadFileWriter
+  const std::shared_ptr<StatisticsCollector> statistics_;
 
   // A map of last-written dictionaries by id.
   // This is required to avoid the same dictionary again and again,
   // and also for correctness when writing the IPC file format
-  // (where replacements and deltas are unsupported).
+  // (where replacements are unsupported).
   // The latter is also why we can't use weak_ptr.
   std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
 
@@ -1191,21 +1397,78 @@ class PayloadStreamWriter : public IpcPayloadWriter, protected StreamBookKeeper
                       const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : StreamBookKeeper(options, std::move(sink)) {}
 
-  ~PayloadStreamWriter() override = default;
+  ~PayloadStreamWriter() override {
+    if (coalescer_ != nullptr) {
+      // Write out the pending messages, without closing the sink
+      auto status = coalescer_->Detach().status();
+      if (!status.ok()) {
+        ARROW_LOG(ERROR) << "Error flushing IPC stream: " << status.ToString();
+      }
+    }
+  }
+
+  Status Start() override {
+    if (options_.write_coalescing_size > 0) {
+      // The coalescer doesn't own the sink, it is detached rather than closed
+      std::shared_ptr<io::OutputStream> raw(std::shared_ptr<void>(), sink_);
+      ARROW_ASSIGN_OR_RAISE(
+          coalescer_, io::BufferedOutputStream::Create(options_.write_coalescing_size,
+                                                       options_.memory_pool, raw));
+      sink_ = coalescer_.get();
+    }
+    return Status::OK();
+  }
 
   Status WritePayload(const IpcPayload& payload) override {
 #ifndef NDEBUG
     // Catch bug fixed in ARROW-3236
     RETURN_NOT_OK(UpdatePositionCheckAligned());
 #endif
+    const int64_t initial_position = position_;
+    const int64_t initial_pending =
+        coalescer_ != nullptr ? coalescer_->bytes_buffered() : 0;
 
     int32_t metadata_length = 0;  // unused
     RETURN_NOT_OK(WriteIpcPayload(payload, options_, sink_, &metadata_length));
     RETURN_NOT_OK(UpdatePositionCheckAligned());
+
+    if (coalescer_ != nullptr) {
+      return CheckPendingDelay(initial_pending, position_ - initial_position);
+    }
+    return Status::OK();
+  }
+
+  Status Close() override {
+    RETURN_NOT_OK(WriteEOS());
+    if (coalescer_ != nullptr) {
+      return coalescer_->Flush();
+    }
+    return Status::OK();
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // Flush the coalesced writes if the oldest of them is too old
+  Status CheckPendingDelay(int64_t initial_pending, int64_t nbytes_written) {
+    const int64_t pending = coalescer_->bytes_buffered();
+    if (pending == 0) {
+      return Status::OK();
+    }
+    const auto now = Clock::now();
+    if (initial_pending == 0 || pending != initial_pending + nbytes_written) {
+      // The pending writes all come from this message
+      pending_since_ = now;
+    }
+    const std::chrono::duration<double> max_delay(options_.write_coalescing_max_delay);
+    if (now - pending_since_ >= max_delay) {
+      return coalescer_->Flush();
+    }
     return Status::OK();
   }
 
-  Status Close() override { return WriteEOS(); }
+  std::shared_ptr<io::BufferedOutputStream> coalescer_;
+  Clock::time_point pending_since_;
 };
 
 /// A IpcPayloadWriter implementation that writes to a IPC file
@@ -1214,14 +1477,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<StatisticsCollector> statistics = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<StatisticsCollector> statistics = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1268,11 +1537,21 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
+    // Record the statistics of the record batches among the custom metadata
+    auto metadata = metadata_;
+    if (statistics_ != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto encoded, statistics_->Finish());
+      std::shared_ptr<KeyValueMetadata> with_statistics =
+          metadata_ != nullptr ? metadata_->Copy() : key_value_metadata({}, {});
+      RETURN_NOT_OK(with_statistics->Set(kStatisticsMetadataKey, encoded));
+      metadata = std::move(with_statistics);
+    }
+
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1292,10 +1571,37 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<StatisticsCollector> statistics_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
 
+// The collector is fed the record batches by the IpcFormatWriter and written
+// to the footer by the PayloadFileWriter
+std::shared_ptr<StatisticsCollector> MakeStatisticsCollector(
+    const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+  if (!options.write_statistics) {
+    return nullptr;
+  }
+  return std::make_shared<StatisticsCollector>(schema, options.memory_pool);
+}
+
+// Store the dictionary of the compression codec, if any, in the schema
+// metadata, as readers need it to decompress the body buffers
+std::shared_ptr<Schema> WithCompressionDictionary(const std::shared_ptr<Schema>& schema,
+                                                  const IpcWriteOptions& options) {
+  if (options.codec == nullptr || options.codec->dictionary() == nullptr) {
+    return schema;
+  }
+  const auto& dictionary = options.codec->dictionary();
+  const auto dictionary_size = static_cast<unsigned int>(dictionary->size());
+  auto metadata = schema->metadata() ? schema->metadata()->Copy()
+                                     : std::make_shared<KeyValueMetadata>();
+  metadata->Append(kCompressionDictionaryMetadataKey,
+                   ::arrow::util::base64_encode(dictionary->data(), dictionary_size));
+  return schema->WithMetadata(std::move(metadata));
+}
+
 }  // namespace internal
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
@@ -1303,7 +1609,8 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     const IpcWriteOptions& options) {
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadStreamWriter>(sink, options),
-      schema, options, /*is_file_format=*/false);
+      internal::WithCompressionDictionary(schema, options), options,
+      /*is_file_format=*/false);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
@@ -1312,7 +1619,8 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadStreamWriter>(std::move(sink),
                                                                     options),
-      schema, options, /*is_file_format=*/false);
+      internal::WithCompressionDictionary(schema, options), options,
+      /*is_file_format=*/false);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewStreamWriter(
@@ -1325,20 +1633,25 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto file_schema = internal::WithCompressionDictionary(schema, options);
+  auto statistics = internal::MakeStatisticsCollector(file_schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
-      ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
-                                                                  metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, file_schema,
+                                                                  metadata, sink,
+                                                                  statistics),
+      file_schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto file_schema = internal::WithCompressionDictionary(schema, options);
+  auto statistics = internal::MakeStatisticsCollector(file_schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
-          options, schema, metadata, std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+          options, file_schema, metadata, std::move(sink), statistics),
+      file_schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -1355,7 +1668,8 @@ Result<std::unique_ptr<RecordBatchWriter>> OpenRecordBatchWriter(
     const IpcWriteOptions& options) {
   // XXX should we call Start()?
   return ::arrow::internal::make_unique<internal::IpcFormatWriter>(
-      std::move(sink), schema, options, /*is_file_format=*/false);
+      std::move(sink), WithCompressionDictionary(schema, options), options,
+      /*is_file_format=*/false);
 }
 
 Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadStreamWriter(
@@ -1367,8 +1681,8 @@ Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  return ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
-                                                                     metadata, sink);
+  return ::arrow::internal::make_unique<internal::PayloadFileWriter>(
+      options, WithCompressionDictionary(schema, options), metadata, sink);
 }
 
 }  // namespace internal
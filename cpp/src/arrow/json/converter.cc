@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
@@ -125,6 +126,26 @@ class NumericConverter : public PrimitiveConverter {
     Builder builder(out_type_, pool_);
     RETURN_NOT_OK(builder.Resize(dict_array.indices()->length()));
 
+    // Parse each distinct representation once, in a single pass over the
+    // dictionary.  If any fails to parse, whether it is actually used is left
+    // to the slower visit below.
+    const auto& dict = checked_cast<const StringArray&>(*dict_array.dictionary());
+    std::vector<value_type> dict_values(static_cast<size_t>(dict.length()));
+    if (arrow::internal::ParseValues(numeric_type_, dict.raw_value_offsets(),
+                                     dict.data()->GetValues<uint8_t>(2, 0),
+                                     dict.null_bitmap_data(), dict.offset(),
+                                     dict.length(), dict_values.data()) == dict.length()) {
+      const Int32Array& indices = checked_cast<const Int32Array&>(*dict_array.indices());
+      for (int64_t i = 0; i < indices.length(); ++i) {
+        if (indices.IsValid(i)) {
+          builder.UnsafeAppend(dict_values[indices.Value(i)]);
+        } else {
+          builder.UnsafeAppendNull();
+        }
+      }
+      return builder.Finish(out);
+    }
+
     auto visit_valid = [&](string_view repr) {
       value_type value;
       if (!arrow::internal::ParseValue(numeric_type_, repr.data(), repr.size(), &value)) {
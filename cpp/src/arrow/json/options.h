@@ -70,5 +70,24 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// \brief Maximum number of rows processed at a time
+  ///
+  /// The JSON writer converts and writes data in batches of N rows.
+  /// This number can impact performance.
+  int32_t batch_size = 1024;
+
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, batches of `batch_size` rows are converted in parallel, and written
+  /// in order by the calling thread.
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace json
 }  // namespace arrow
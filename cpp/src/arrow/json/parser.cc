@@ -326,17 +326,17 @@ class RawArrayBuilder<Kind::kObject> {
 
   Status AppendNull(int64_t count) { return null_bitmap_builder_.Append(count, false); }
 
-  std::string FieldName(int i) const {
-    for (const auto& name_index : name_to_index_) {
-      if (name_index.second == i) {
-        return name_index.first;
-      }
-    }
-    return "";
-  }
+  std::string FieldName(int i) const { return field_names_[i]; }
 
-  int GetFieldIndex(const std::string& name) const {
-    auto it = name_to_index_.find(name);
+  /// \brief Look up a field by name, first trying the field at index `hint`
+  ///
+  /// Rows usually list their keys in the same order, so passing the index
+  /// following the previous key's avoids copying and hashing most keys.
+  int GetFieldIndex(string_view name, int hint = -1) const {
+    if (hint >= 0 && hint < num_fields() && string_view(field_names_[hint]) == name) {
+      return hint;
+    }
+    auto it = name_to_index_.find(std::string(name));
     if (it == name_to_index_.end()) {
       return -1;
     }
@@ -346,6 +346,7 @@ class RawArrayBuilder<Kind::kObject> {
   int AddField(std::string name, BuilderPtr builder) {
     auto index = num_fields();
     field_builders_.push_back(builder);
+    field_names_.push_back(name);
     name_to_index_.emplace(std::move(name), index);
     return index;
   }
@@ -363,18 +364,13 @@ class RawArrayBuilder<Kind::kObject> {
     std::shared_ptr<Buffer> null_bitmap;
     RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
 
-    std::vector<string_view> field_names(num_fields());
-    for (const auto& name_index : name_to_index_) {
-      field_names[name_index.second] = name_index.first;
-    }
-
     std::vector<std::shared_ptr<Field>> fields(num_fields());
     std::vector<std::shared_ptr<ArrayData>> child_data(num_fields());
     for (int i = 0; i < num_fields(); ++i) {
       std::shared_ptr<Array> field_values;
       RETURN_NOT_OK(finish_child(field_builders_[i], &field_values));
       child_data[i] = field_values->data();
-      fields[i] = field(std::string(field_names[i]), field_values->type(),
+      fields[i] = field(field_names_[i], field_values->type(),
                         field_builders_[i].nullable, Kind::Tag(field_builders_[i].kind));
     }
 
@@ -388,6 +384,7 @@ class RawArrayBuilder<Kind::kObject> {
  private:
   std::vector<BuilderPtr> field_builders_;
   std::unordered_map<std::string, int> name_to_index_;
+  std::vector<std::string> field_names_;
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
 
@@ -747,7 +744,8 @@ class HandlerBase : public BlockParser,
   /// there is no field with that name
   bool SetFieldBuilder(string_view key, bool* duplicate_keys) {
     auto parent = Cast<Kind::kObject>(builder_stack_.back());
-    field_index_ = parent->GetFieldIndex(std::string(key));
+    // field_index_ is still the index of the previous key in this object
+    field_index_ = parent->GetFieldIndex(key, field_index_ + 1);
     if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
       return false;
     }
@@ -17,8 +17,14 @@
 
 #include "benchmark/benchmark.h"
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
 #include "arrow/json/chunker.h"
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
@@ -26,6 +32,7 @@
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 namespace json {
@@ -36,13 +43,26 @@ std::shared_ptr<Schema> TestSchema() {
 
 constexpr int seed = 0x432432;
 
-std::string TestJsonData(int num_rows, bool pretty = false) {
+// A schema with `num_cols` fields cycling through integer, floating point,
+// string and boolean types
+std::shared_ptr<Schema> WideSchema(int num_cols) {
+  const std::vector<std::shared_ptr<DataType>> types = {int64(), float64(), utf8(),
+                                                        boolean()};
+  FieldVector fields;
+  for (int i = 0; i < num_cols; ++i) {
+    fields.push_back(field("f" + std::to_string(i), types[i % types.size()]));
+  }
+  return schema(std::move(fields));
+}
+
+std::string TestJsonData(const std::shared_ptr<Schema>& schema, int num_rows,
+                         bool pretty = false) {
   std::default_random_engine engine(seed);
   std::string json;
   for (int i = 0; i < num_rows; ++i) {
     StringBuffer sb;
     Writer writer(sb);
-    ABORT_NOT_OK(Generate(TestSchema(), engine, &writer));
+    ABORT_NOT_OK(Generate(schema, engine, &writer));
     json += pretty ? PrettyPrint(sb.GetString()) : sb.GetString();
     json += "\n";
   }
@@ -50,6 +70,10 @@ std::string TestJsonData(int num_rows, bool pretty = false) {
   return json;
 }
 
+std::string TestJsonData(int num_rows, bool pretty = false) {
+  return TestJsonData(TestSchema(), num_rows, pretty);
+}
+
 static void BenchmarkJSONChunking(benchmark::State& state,
                                   const std::shared_ptr<Buffer>& json,
                                   ParseOptions options) {  // NOLINT non-const reference
@@ -153,12 +177,85 @@ static void ReadJSONBlockWithSchemaMultiThread(
   BenchmarkReadJSONBlockWithSchema(state, true);
 }
 
+static std::shared_ptr<Buffer> Compress(const std::string& data,
+                                        Compression::type compression) {
+  if (compression == Compression::UNCOMPRESSED) {
+    return Buffer::FromString(data);
+  }
+  auto codec = *util::Codec::Create(compression);
+  auto sink = *io::BufferOutputStream::Create();
+  auto stream = *io::CompressedOutputStream::Make(codec.get(), sink);
+  ABORT_NOT_OK(stream->Write(data.data(), static_cast<int64_t>(data.size())));
+  ABORT_NOT_OK(stream->Close());
+  return *sink->Finish();
+}
+
+// End-to-end ingest: compressed bytes -> CompressedInputStream -> TableReader.
+// Arguments: number of columns, use_threads, block size in KiB, Compression::type
+static void ReadJSONCompressed(benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_cols = static_cast<int>(state.range(0));
+  const auto compression = static_cast<Compression::type>(state.range(3));
+  if (!util::Codec::IsAvailable(compression)) {
+    state.SkipWithError("Codec not available");
+    return;
+  }
+
+  // Keep the number of values constant across narrow and wide schemas
+  const int num_rows = (1 << 19) / num_cols;
+  auto schema = WideSchema(num_cols);
+  const auto json = TestJsonData(schema, num_rows);
+  const auto compressed = Compress(json, compression);
+  std::unique_ptr<util::Codec> codec;
+  if (compression != Compression::UNCOMPRESSED) {
+    codec = *util::Codec::Create(compression);
+  }
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(1) != 0;
+  read_options.block_size = static_cast<int32_t>(state.range(2) * 1024);
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema;
+
+  for (auto _ : state) {
+    std::shared_ptr<io::InputStream> input =
+        std::make_shared<io::BufferReader>(compressed);
+    if (codec) {
+      input = *io::CompressedInputStream::Make(codec.get(), input);
+    }
+    auto reader = *TableReader::Make(default_memory_pool(), input, read_options,
+                                     parse_options);
+    std::shared_ptr<Table> table = *reader->Read();
+    benchmark::DoNotOptimize(table->num_rows());
+  }
+
+  state.SetBytesProcessed(state.iterations() * json.size());
+  state.counters["compression_ratio"] =
+      static_cast<double>(json.size()) / static_cast<double>(compressed->size());
+}
+
+static void ReadJSONCompressedArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"cols", "threads", "block_kb", "codec"});
+  for (const int64_t num_cols : {4, 64, 512}) {
+    bench->Args({num_cols, 1, 1024, Compression::UNCOMPRESSED});
+  }
+  for (const int64_t use_threads : {0, 1}) {
+    for (const int64_t block_kb : {64, 256, 1024, 4096}) {
+      for (const int64_t compression :
+           {Compression::UNCOMPRESSED, Compression::GZIP, Compression::ZSTD,
+            Compression::LZ4_FRAME}) {
+        bench->Args({64, use_threads, block_kb, compression});
+      }
+    }
+  }
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
+BENCHMARK(ReadJSONCompressed)->Apply(ReadJSONCompressedArgs)->UseRealTime();
 
 }  // namespace json
 }  // namespace arrow
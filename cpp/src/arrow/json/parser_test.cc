@@ -250,5 +250,21 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+TEST(BlockParser, KeyOrder) {
+  // Keys are not necessarily in the same order in all rows
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(options, R"({"a": 1, "b": "x", "c": {"d": true, "e": 2}}
+{"b": "y", "a": 2, "c": {"e": 3, "d": false}}
+{"c": {"e": 4}, "a": 3}
+{"a": 4, "b": "z", "c": {"d": null, "e": 5}}
+)",
+                     {field("a", utf8()), field("b", utf8()),
+                      field("c", struct_({field("d", boolean()), field("e", utf8())}))},
+                     {R"(["1", "2", "3", "4"])", R"(["x", "y", null, "z"])",
+                      R"([{"d": true, "e": "2"}, {"d": false, "e": "3"},
+                          {"d": null, "e": "4"}, {"d": null, "e": "5"}])"});
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -42,11 +45,124 @@ namespace arrow {
 using util::string_view;
 
 using internal::checked_cast;
+using internal::Executor;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
 
 namespace json {
+namespace {
+
+struct JSONBlock {
+  // (partial + completion + whole) holds entire JSON objects
+  std::shared_ptr<Buffer> partial;
+  std::shared_ptr<Buffer> completion;
+  std::shared_ptr<Buffer> whole;
+  int64_t index;
+};
+
+}  // namespace
+}  // namespace json
+
+template <>
+struct IterationTraits<json::JSONBlock> {
+  static json::JSONBlock End() { return json::JSONBlock{{}, {}, {}, -1}; }
+  static bool IsEnd(const json::JSONBlock& val) { return val.index < 0; }
+};
+
+namespace json {
+namespace {
+
+// A callable that can be used to transform a generator of buffers into a
+// generator of delimited JSON blocks.
+class BlockReader {
+ public:
+  explicit BlockReader(std::unique_ptr<Chunker> chunker)
+      : chunker_(std::move(chunker)), partial_(std::make_shared<Buffer>("")) {}
+
+  static AsyncGenerator<JSONBlock> MakeAsyncIterator(
+      AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
+      std::unique_ptr<Chunker> chunker) {
+    auto block_reader = std::make_shared<BlockReader>(std::move(chunker));
+    // Wrap shared pointer in callable
+    Transformer<std::shared_ptr<Buffer>, JSONBlock> block_reader_fn =
+        [block_reader](std::shared_ptr<Buffer> next) { return (*block_reader)(next); };
+    return MakeTransformedGenerator(std::move(buffer_generator), block_reader_fn);
+  }
+
+  Result<TransformFlow<JSONBlock>> operator()(std::shared_ptr<Buffer> next_buffer) {
+    if (buffer_ == nullptr) {
+      if (next_buffer == nullptr) {
+        // EOF
+        return TransformFinish();
+      }
+      // First buffer: the next one is needed to know whether it is the last one
+      buffer_ = std::move(next_buffer);
+      return TransformSkip();
+    }
+
+    std::shared_ptr<Buffer> whole, completion, next_partial;
+    if (next_buffer == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, buffer_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, buffer_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    JSONBlock block{std::move(partial_), std::move(completion), std::move(whole),
+                    block_index_++};
+    partial_ = std::move(next_partial);
+    buffer_ = std::move(next_buffer);
+    return TransformYield(std::move(block));
+  }
+
+ private:
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<Buffer> partial_, buffer_;
+  int64_t block_index_ = 0;
+};
+
+// Parse a block of JSON objects to an unconverted struct array
+Result<std::shared_ptr<Array>> ParseBlock(const JSONBlock& block,
+                                          const ParseOptions& parse_options,
+                                          MemoryPool* pool) {
+  const auto& partial = block.partial;
+  const auto& completion = block.completion;
+  const auto& whole = block.whole;
+
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+}  // namespace
 
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
@@ -100,10 +216,9 @@ class TableReaderImpl : public TableReader,
       }
 
       // Launch parse task
-      task_group_->Append([self, partial, completion, whole, block_index] {
-        return self->ParseAndInsert(partial, completion, whole, block_index);
-      });
-      block_index++;
+      JSONBlock json_block{partial, completion, whole, block_index++};
+      task_group_->Append(
+          [self, json_block] { return self->ParseAndInsert(json_block); });
 
       partial = next_partial;
       block = next_block;
@@ -128,34 +243,9 @@ class TableReaderImpl : public TableReader,
     return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+  Status ParseAndInsert(const JSONBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block, parse_options_, pool_));
+    builder_->Insert(block.index, field("", parsed->type()), parsed);
     return Status::OK();
   }
 
@@ -168,6 +258,155 @@ class TableReaderImpl : public TableReader,
   std::shared_ptr<ChunkedArrayBuilder> builder_;
 };
 
+// Parses and converts JSON blocks to record batches
+class BlockDecoder {
+ public:
+  BlockDecoder(MemoryPool* pool, const ParseOptions& parse_options)
+      : pool_(pool),
+        parse_options_(parse_options),
+        promotion_graph_(parse_options.unexpected_field_behavior ==
+                                 UnexpectedFieldBehavior::InferType
+                             ? GetPromotionGraph()
+                             : nullptr),
+        type_(parse_options.explicit_schema
+                  ? struct_(parse_options.explicit_schema->fields())
+                  : struct_({})) {}
+
+  Result<std::shared_ptr<RecordBatch>> Decode(const JSONBlock& block) const {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block, parse_options_, pool_));
+
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph_, type_, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> converted;
+    RETURN_NOT_OK(builder->Finish(&converted));
+    DCHECK_EQ(converted->num_chunks(), 1);
+    return RecordBatch::FromStructArray(converted->chunk(0));
+  }
+
+  // Decode the following blocks to the given schema, without inference
+  void FreezeSchema(const std::shared_ptr<Schema>& schema) {
+    parse_options_.explicit_schema = schema;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    promotion_graph_ = nullptr;
+    type_ = struct_(schema->fields());
+  }
+
+ private:
+  MemoryPool* pool_;
+  ParseOptions parse_options_;
+  const PromotionGraph* promotion_graph_;
+  std::shared_ptr<DataType> type_;
+};
+
+// A JSON block whose parsing and conversion has been launched on the CPU executor
+using PendingBatch = util::optional<Future<std::shared_ptr<RecordBatch>>>;
+
+class StreamingReaderImpl : public StreamingReader,
+                            public std::enable_shared_from_this<StreamingReaderImpl> {
+ public:
+  StreamingReaderImpl(io::IOContext io_context, Executor* cpu_executor,
+                      const ReadOptions& read_options, const ParseOptions& parse_options)
+      : io_context_(std::move(io_context)),
+        cpu_executor_(cpu_executor),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        decoder_(std::make_shared<BlockDecoder>(io_context_.pool(), parse_options)) {}
+
+  Future<std::shared_ptr<StreamingReader>> Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+
+    max_readahead_ =
+        read_options_.use_threads ? std::max(1, cpu_executor_->GetCapacity()) : 1;
+    int readahead_restart = std::max(1, max_readahead_ / 2);
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto bg_it, MakeBackgroundGenerator(std::move(istream_it), io_context_.executor(),
+                                            max_readahead_, readahead_restart));
+    auto transferred_it = MakeTransferredGenerator(bg_it, cpu_executor_);
+    block_generator_ = BlockReader::MakeAsyncIterator(std::move(transferred_it),
+                                                      MakeChunker(parse_options_));
+
+    // The first block is decoded alone, so that the schema is decided
+    // before the following blocks are launched
+    auto self = shared_from_this();
+    return block_generator_().Then(
+        [self](const JSONBlock& first_block) -> Result<std::shared_ptr<StreamingReader>> {
+          if (IsIterationEnd(first_block)) {
+            return Status::Invalid("Empty JSON file");
+          }
+          ARROW_ASSIGN_OR_RAISE(self->pending_batch_,
+                                self->decoder_->Decode(first_block));
+          self->schema_ = self->pending_batch_->schema();
+          self->decoder_->FreezeSchema(self->schema_);
+          self->MakeBatchGenerator();
+          return self;
+        });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto next_result = ReadNextAsync().result();
+    return std::move(next_result).Value(batch);
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
+    if (pending_batch_ != nullptr) {
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(
+          std::move(pending_batch_));
+    }
+    return batch_generator_();
+  }
+
+ private:
+  void MakeBatchGenerator() {
+    // The generators must not keep the reader alive, so they only refer to
+    // the shared decoder
+    auto decoder = decoder_;
+    if (!read_options_.use_threads) {
+      std::function<Result<std::shared_ptr<RecordBatch>>(const JSONBlock&)> decode =
+          [decoder](const JSONBlock& block) { return decoder->Decode(block); };
+      batch_generator_ = MakeMappedGenerator(std::move(block_generator_), decode);
+      return;
+    }
+
+    // Launch the decoding of blocks as they are read, up to max_readahead_
+    // blocks ahead of the consumer
+    auto cpu_executor = cpu_executor_;
+    auto stop_token = io_context_.stop_token();
+    std::function<PendingBatch(const JSONBlock&)> launch_block =
+        [decoder, cpu_executor, stop_token](const JSONBlock& block) -> PendingBatch {
+      return DeferNotOk(cpu_executor->Submit(
+          stop_token, [decoder, block] { return decoder->Decode(block); }));
+    };
+    auto pending_generator = MakeSerialReadaheadGenerator(
+        MakeMappedGenerator(std::move(block_generator_), std::move(launch_block)),
+        max_readahead_);
+    // Batches are yielded in order, once their decoding is finished
+    std::function<Future<std::shared_ptr<RecordBatch>>(const PendingBatch&)>
+        wait_for_batch = [](const PendingBatch& pending) { return *pending; };
+    batch_generator_ =
+        MakeMappedGenerator(std::move(pending_generator), std::move(wait_for_batch));
+  }
+
+  io::IOContext io_context_;
+  Executor* cpu_executor_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::shared_ptr<BlockDecoder> decoder_;
+  int max_readahead_ = 1;
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> pending_batch_;
+  AsyncGenerator<JSONBlock> block_generator_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> batch_generator_;
+};
+
 Status TableReader::Read(std::shared_ptr<Table>* out) { return Read().Value(out); }
 
 Result<std::shared_ptr<TableReader>> TableReader::Make(
@@ -192,6 +431,23 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    Executor* cpu_executor, const ReadOptions& read_options,
+    const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(io_context, cpu_executor,
+                                                      read_options, parse_options);
+  return reader->Init(std::move(input));
+}
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto reader_fut = MakeAsync(io_context, std::move(input), GetCpuThreadPool(),
+                              read_options, parse_options);
+  return reader_fut.result();
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -19,10 +19,14 @@
 
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -65,6 +69,36 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally, one block at a time
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each batch holds the objects of a block of about ReadOptions::block_size
+/// bytes, so that memory use is bounded regardless of the file size.
+///
+/// The schema is decided on the first block: afterwards, fields are converted
+/// to the types inferred from the first block, and fields not in the schema
+/// raise an error unless UnexpectedFieldBehavior::Ignore was requested.
+///
+/// The StreamingReader is not async-reentrant.  If ReadOptions::use_threads is
+/// true, blocks are parsed and converted in parallel on `cpu_executor`, with
+/// a bounded readahead, and batches are still yielded in file order.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and parsed during the creation process (to
+  /// decide the schema), so it is returned as a future
+  static Future<std::shared_ptr<StreamingReader>> MakeAsync(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&);
+
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      io::IOContext io_context, std::shared_ptr<io::InputStream> input,
+      const ReadOptions&, const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
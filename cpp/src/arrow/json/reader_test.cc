@@ -25,6 +25,7 @@
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -274,5 +275,103 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  Result<std::shared_ptr<StreamingReader>> MakeReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> stream;
+    RETURN_NOT_OK(MakeStream(input, &stream));
+    return StreamingReader::Make(io::default_io_context(), stream, read_options_,
+                                 parse_options_);
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) { ASSERT_RAISES(Invalid, MakeReader("")); }
+
+TEST_P(StreamingReaderTest, MultipleBlocks) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(src));
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader->schema());
+
+  // One batch per block (the last one is empty because the last block is "  ")
+  RecordBatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 4);
+  ASSERT_OK_AND_ASSIGN(auto actual_table, Table::FromRecordBatches(schema, batches));
+
+  auto expected_table = Table::Make(
+      schema, {
+                  ArrayFromJSON(schema->field(0)->type(), "[3.5, 3.25, 3.125, 0.0]"),
+                  ArrayFromJSON(schema->field(1)->type(), "[false, null, null, true]"),
+                  ArrayFromJSON(schema->field(2)->type(),
+                                "[\"thing\", null, \"\xe5\xbf\x8d\", null]"),
+              });
+  AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, SameAsTableReader) {
+  int64_t count = 1 << 10;
+  read_options_.block_size = static_cast<int>(count / 2);
+
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ", \"b\": \"" + std::to_string(i % 7) +
+            "\"}\n";
+  }
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(json));
+  std::shared_ptr<Table> streamed;
+  ASSERT_OK(reader->ReadAll(&streamed));
+  ASSERT_GT(streamed->column(0)->num_chunks(), 10);
+
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream(json, &input));
+  ASSERT_OK_AND_ASSIGN(auto table_reader, TableReader::Make(default_memory_pool(), input,
+                                                            read_options_,
+                                                            parse_options_));
+  ASSERT_OK_AND_ASSIGN(auto expected, table_reader->Read());
+  AssertTablesEqual(*expected, *streamed, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, SchemaFrozenAfterFirstBlock) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  read_options_.block_size = 16;
+  std::string first_rows;
+  for (int i = 0; i < 10; ++i) {
+    first_rows += "{\"a\": 1}\n";
+  }
+
+  // Unexpected field
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(first_rows + "{\"a\": 2, \"b\": 3}\n"));
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader->schema());
+  RecordBatchVector batches;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+
+  // Unexpected field, ignored
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader(first_rows + "{\"a\": 2, \"b\": 3}\n"));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_EQ(table->num_rows(), 11);
+
+  // Type not compatible with the first block's
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  parse_options_.explicit_schema = nullptr;
+  ASSERT_OK_AND_ASSIGN(reader, MakeReader(first_rows + "{\"a\": \"x\"}\n"));
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,960 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace json {
+// The algorithm follows the CSV writer's: RecordBatches/Tables are broken into slices
+// which are converted independently. A slice is converted column by column, with a
+// tree of ValueWriters mirroring its (possibly nested) type. A first pass computes the
+// length of each value as rendered in JSON, from which the parents compute their own
+// lengths and, in the end, the position of each row in a single output buffer. A second
+// pass then renders each column at the positions of its values in the rows.
+//
+// Slices are independent, so with WriteOptions::use_threads they are converted in
+// parallel on the CPU thread pool, and written to the output in order.
+
+namespace {
+
+struct SliceIteratorFunctor {
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (current_offset < batch->num_rows()) {
+      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
+      current_offset += slice_size;
+      return next;
+    }
+    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+  }
+  const RecordBatch* const batch;
+  const int64_t slice_size;
+  int64_t current_offset;
+};
+
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size) {
+  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
+  return RecordBatchIterator(std::move(functor));
+}
+
+constexpr char kNull[] = "null";
+constexpr int64_t kNullLength = 4;
+
+// Whether a byte must be escaped in a JSON string
+inline bool NeedsEscape(uint8_t c) { return c < 0x20 || c == '"' || c == '\\'; }
+
+// Whether any byte of s must be escaped in a JSON string.  Most strings need no
+// escaping, so they are scanned 16 bytes at a time with SSE, or 8 bytes at a time
+// otherwise.
+bool NeedsEscaping(util::string_view s) {
+  auto data = reinterpret_cast<const uint8_t*>(s.data());
+  int64_t length = static_cast<int64_t>(s.size());
+#if defined(ARROW_HAVE_SSE4_2)
+  const __m128i quotes = _mm_set1_epi8('"');
+  const __m128i backslashes = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1f);
+  for (; length >= 16; data += 16, length -= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i matches =
+        _mm_or_si128(_mm_cmpeq_epi8(v, quotes), _mm_cmpeq_epi8(v, backslashes));
+    // unsigned v <= 0x1f
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v));
+    if (_mm_movemask_epi8(matches) != 0) {
+      return true;
+    }
+  }
+#else
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+  // whether any byte of word is zero
+  auto has_zero_byte = [](uint64_t word) { return ((word - kOnes) & ~word & kHighBits); };
+  for (; length >= 8; data += 8, length -= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, 8);
+    // bytes below 0x20 have their 3 high bits unset
+    if (has_zero_byte(word ^ (kOnes * '"')) || has_zero_byte(word ^ (kOnes * '\\')) ||
+        has_zero_byte(word & (kOnes * 0xe0))) {
+      return true;
+    }
+  }
+#endif
+  for (; length > 0; ++data, --length) {
+    if (NeedsEscape(*data)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Short escape sequence of c, or 0 if it must be written as \u00XX
+inline char ShortEscape(char c) {
+  switch (c) {
+    case '"':
+      return '"';
+    case '\\':
+      return '\\';
+    case '\b':
+      return 'b';
+    case '\f':
+      return 'f';
+    case '\n':
+      return 'n';
+    case '\r':
+      return 'r';
+    case '\t':
+      return 't';
+    default:
+      return 0;
+  }
+}
+
+int64_t EscapedLength(util::string_view s) {
+  int64_t length = 0;
+  for (char c : s) {
+    if (!NeedsEscape(static_cast<uint8_t>(c))) {
+      length += 1;
+    } else {
+      length += ShortEscape(c) != 0 ? 2 : 6;
+    }
+  }
+  return length;
+}
+
+// Copies s to out, escaping characters as needed.  Returns the position after the last
+// written character.
+char* Escape(util::string_view s, char* out) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  for (char c : s) {
+    const auto byte = static_cast<uint8_t>(c);
+    if (!NeedsEscape(byte)) {
+      *out++ = c;
+      continue;
+    }
+    *out++ = '\\';
+    const char short_escape = ShortEscape(c);
+    if (short_escape != 0) {
+      *out++ = short_escape;
+    } else {
+      *out++ = 'u';
+      *out++ = '0';
+      *out++ = '0';
+      *out++ = kHexDigits[byte >> 4];
+      *out++ = kHexDigits[byte & 0xf];
+    }
+  }
+  return out;
+}
+
+// A quoted and escaped JSON string
+std::string Quote(util::string_view s) {
+  std::string quoted(EscapedLength(s) + 2, '"');
+  Escape(s, &quoted[1]);
+  return quoted;
+}
+
+inline void WriteNull(char* out, int64_t position) {
+  if (position >= 0) {
+    std::memcpy(out + position, kNull, kNullLength);
+  }
+}
+
+inline bool IsValid(const ArrayData& data, int64_t i) {
+  return data.buffers[0] == nullptr ||
+         BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+}
+
+// Interface for rendering the values of an array as JSON.
+// The intended usage is to call SetData, which computes the rendered length of each
+// value, then to call Write with the position of each value in the output.
+class ValueWriter {
+ public:
+  virtual ~ValueWriter() = default;
+
+  // Prepares the data and computes the length of its values in JSON.
+  virtual Status SetData(const std::shared_ptr<ArrayData>& data) = 0;
+
+  // Renders value i at output + positions[i], or nowhere if positions[i] is negative
+  // (e.g. for the children of a null struct).
+  virtual void Write(char* output, const int64_t* positions) = 0;
+
+  const std::vector<int64_t>& lengths() const { return lengths_; }
+
+ protected:
+  std::vector<int64_t> lengths_;
+};
+
+class NullWriter : public ValueWriter {
+ public:
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    lengths_.assign(data->length, kNullLength);
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    for (size_t i = 0; i < lengths_.size(); ++i) {
+      WriteNull(output, positions[i]);
+    }
+  }
+};
+
+class BooleanWriter : public ValueWriter {
+ public:
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    lengths_.resize(data_->length);
+    int64_t* length = lengths_.data();
+    VisitArrayDataInline<BooleanType>(
+        *data_, [&](bool value) { *length++ = value ? 4 : 5; },
+        [&]() { *length++ = kNullLength; });
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    VisitArrayDataInline<BooleanType>(
+        *data_,
+        [&](bool value) {
+          if (*positions >= 0) {
+            std::memcpy(output + *positions, value ? "true" : "false", value ? 4 : 5);
+          }
+          ++positions;
+        },
+        [&]() { WriteNull(output, *positions++); });
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+};
+
+// Writer for integer types.  Digits are counted when computing lengths, and formatted
+// directly into the output.
+template <typename Type>
+class IntegerWriter : public ValueWriter {
+ public:
+  using c_type = typename Type::c_type;
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    lengths_.resize(data_->length);
+    int64_t* length = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](c_type value) {
+          auto abs_value = internal::detail::Abs(value);
+          int64_t digits = (value < 0) ? 2 : 1;
+          while (abs_value >= 10) {
+            abs_value /= 10;
+            ++digits;
+          }
+          *length++ = digits;
+        },
+        [&]() { *length++ = kNullLength; });
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    const int64_t* length = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](c_type value) {
+          if (*positions >= 0) {
+            // digits are formatted backwards from the end of the value
+            char* cursor = output + *positions + *length;
+            internal::detail::FormatAllDigits(internal::detail::Abs(value), &cursor);
+            if (value < 0) {
+              internal::detail::FormatOneChar('-', &cursor);
+            }
+          }
+          ++positions;
+          ++length;
+        },
+        [&]() {
+          WriteNull(output, *positions++);
+          ++length;
+        });
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+};
+
+// Writer for floating-point types.  Values are formatted once, when computing lengths,
+// into a scratch area with a fixed size per value.  NaN and infinite values have no
+// JSON representation, they are written as null.
+template <typename Type>
+class FloatingPointWriter : public ValueWriter {
+ public:
+  using c_type = typename Type::c_type;
+  using FormatterType = internal::StringFormatter<Type>;
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    lengths_.resize(data->length);
+    scratch_.resize(data->length * kMaxLength);
+    char* value_out = scratch_.data();
+    int64_t* length = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data,
+        [&](c_type value) {
+          if (std::isfinite(value)) {
+            *length++ = formatter_.FormatFloat(value, value_out, kMaxLength);
+          } else {
+            std::memcpy(value_out, kNull, kNullLength);
+            *length++ = kNullLength;
+          }
+          value_out += kMaxLength;
+        },
+        [&]() {
+          std::memcpy(value_out, kNull, kNullLength);
+          *length++ = kNullLength;
+          value_out += kMaxLength;
+        });
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    for (size_t i = 0; i < lengths_.size(); ++i) {
+      if (positions[i] >= 0) {
+        std::memcpy(output + positions[i], scratch_.data() + i * kMaxLength, lengths_[i]);
+      }
+    }
+  }
+
+ private:
+  static constexpr int kMaxLength = FormatterType::buffer_size;
+
+  FormatterType formatter_;
+  std::vector<char> scratch_;
+};
+
+// Writer for the types formatted by internal::FormatArrayValues (temporal and decimal
+// types).  Values are formatted once, when computing lengths, then copied to the
+// output, surrounded by quotes if kQuoted.
+template <typename Type, bool kQuoted>
+class FormattedWriter : public ValueWriter {
+ public:
+  explicit FormattedWriter(MemoryPool* pool) : offsets_(pool), formatted_(pool) {}
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    offsets_.Reset();
+    formatted_.Reset();
+    RETURN_NOT_OK(offsets_.Append(0));
+    RETURN_NOT_OK(internal::FormatArrayValues<Type>(*data_, &offsets_, &formatted_));
+
+    lengths_.resize(data_->length);
+    const int64_t* offsets = offsets_.data();
+    for (int64_t i = 0; i < data_->length; ++i) {
+      lengths_[i] = IsValid(*data_, i) ? offsets[i + 1] - offsets[i] + 2 * kQuoted
+                                       : kNullLength;
+    }
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    const int64_t* offsets = offsets_.data();
+    for (int64_t i = 0; i < data_->length; ++i) {
+      if (positions[i] < 0) continue;
+      char* out = output + positions[i];
+      if (!IsValid(*data_, i)) {
+        std::memcpy(out, kNull, kNullLength);
+        continue;
+      }
+      const int64_t length = offsets[i + 1] - offsets[i];
+      if (kQuoted) {
+        *out++ = '"';
+        out[length] = '"';
+      }
+      std::memcpy(out, formatted_.data() + offsets[i], length);
+    }
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+  TypedBufferBuilder<int64_t> offsets_;
+  BufferBuilder formatted_;
+};
+
+// Writer for binary-like types.  Values are quoted, and escaped only if a first scan
+// finds characters needing it.
+template <typename Type>
+class StringWriter : public ValueWriter {
+ public:
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    lengths_.resize(data_->length);
+    int64_t* length = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](util::string_view s) {
+          const int64_t escaped_length =
+              NeedsEscaping(s) ? EscapedLength(s) : static_cast<int64_t>(s.size());
+          *length++ = escaped_length + 2;
+        },
+        [&]() { *length++ = kNullLength; });
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    const int64_t* length = lengths_.data();
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](util::string_view s) {
+          if (*positions >= 0) {
+            char* out = output + *positions;
+            *out++ = '"';
+            if (*length == static_cast<int64_t>(s.size()) + 2) {
+              // nothing to escape
+              std::memcpy(out, s.data(), s.size());
+              out += s.size();
+            } else {
+              out = Escape(s, out);
+            }
+            *out = '"';
+          }
+          ++positions;
+          ++length;
+        },
+        [&]() {
+          WriteNull(output, *positions++);
+          ++length;
+        });
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+};
+
+// Writer for struct types, also used for the rows of a batch.  The members of a
+// struct are written in the order of its fields, including null members.
+class StructWriter : public ValueWriter {
+ public:
+  StructWriter(const std::vector<std::shared_ptr<Field>>& fields,
+               std::vector<std::unique_ptr<ValueWriter>> children)
+      : children_(std::move(children)), child_positions_(children_.size()) {
+    for (size_t i = 0; i < fields.size(); ++i) {
+      // e.g. `{"a":` for the first member, then `,"b":`
+      prefixes_.push_back((i == 0 ? "{" : ",") + Quote(fields[i]->name()) + ":");
+    }
+  }
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    const StructArray array(data_);
+    // braces of an empty object, or the opening brace in the first prefix
+    int64_t base_length = prefixes_.empty() ? 2 : 1;
+    for (size_t i = 0; i < children_.size(); ++i) {
+      RETURN_NOT_OK(children_[i]->SetData(array.field(static_cast<int>(i))->data()));
+      base_length += static_cast<int64_t>(prefixes_[i].size());
+    }
+
+    lengths_.resize(data_->length);
+    for (int64_t i = 0; i < data_->length; ++i) {
+      if (!IsValid(*data_, i)) {
+        lengths_[i] = kNullLength;
+        continue;
+      }
+      int64_t length = base_length;
+      for (const auto& child : children_) {
+        length += child->lengths()[i];
+      }
+      lengths_[i] = length;
+    }
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    for (auto& child_positions : child_positions_) {
+      child_positions.resize(data_->length);
+    }
+    for (int64_t i = 0; i < data_->length; ++i) {
+      int64_t position = positions[i];
+      if (position < 0 || !IsValid(*data_, i)) {
+        WriteNull(output, position);
+        for (auto& child_positions : child_positions_) {
+          child_positions[i] = -1;
+        }
+        continue;
+      }
+      if (prefixes_.empty()) {
+        output[position++] = '{';
+      }
+      for (size_t c = 0; c < children_.size(); ++c) {
+        std::memcpy(output + position, prefixes_[c].data(), prefixes_[c].size());
+        position += static_cast<int64_t>(prefixes_[c].size());
+        child_positions_[c][i] = position;
+        position += children_[c]->lengths()[i];
+      }
+      output[position] = '}';
+    }
+    for (size_t c = 0; c < children_.size(); ++c) {
+      children_[c]->Write(output, child_positions_[c].data());
+    }
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+  std::vector<std::string> prefixes_;
+  std::vector<std::unique_ptr<ValueWriter>> children_;
+  std::vector<std::vector<int64_t>> child_positions_;
+};
+
+// Writer for list-like types (list, large list, fixed size list and map).
+template <typename Type>
+class ListWriter : public ValueWriter {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  explicit ListWriter(std::unique_ptr<ValueWriter> values) : values_(std::move(values)) {}
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    const ArrayType array(data_);
+    const int64_t length = data_->length;
+    // offsets of the lists, relative to the first one
+    offsets_.resize(length + 1);
+    const int64_t first_offset = array.value_offset(0);
+    for (int64_t i = 0; i <= length; ++i) {
+      offsets_[i] = array.value_offset(i) - first_offset;
+    }
+    RETURN_NOT_OK(
+        values_->SetData(array.values()->Slice(first_offset, offsets_[length])->data()));
+
+    const auto& value_lengths = values_->lengths();
+    lengths_.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      if (!IsValid(*data_, i)) {
+        lengths_[i] = kNullLength;
+        continue;
+      }
+      // brackets and commas
+      int64_t list_length = 2 + std::max<int64_t>(offsets_[i + 1] - offsets_[i] - 1, 0);
+      for (int64_t j = offsets_[i]; j < offsets_[i + 1]; ++j) {
+        list_length += value_lengths[j];
+      }
+      lengths_[i] = list_length;
+    }
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    const auto& value_lengths = values_->lengths();
+    // values of null lists are not written
+    value_positions_.assign(offsets_.back(), -1);
+    for (int64_t i = 0; i < data_->length; ++i) {
+      int64_t position = positions[i];
+      if (position < 0 || !IsValid(*data_, i)) {
+        WriteNull(output, position);
+        continue;
+      }
+      output[position++] = '[';
+      for (int64_t j = offsets_[i]; j < offsets_[i + 1]; ++j) {
+        if (j > offsets_[i]) {
+          output[position++] = ',';
+        }
+        value_positions_[j] = position;
+        position += value_lengths[j];
+      }
+      output[position] = ']';
+    }
+    values_->Write(output, value_positions_.data());
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+  std::unique_ptr<ValueWriter> values_;
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> value_positions_;
+};
+
+// Writer for dictionary types.  The dictionary values are rendered once, then copied
+// for each index.
+class DictionaryWriter : public ValueWriter {
+ public:
+  explicit DictionaryWriter(std::unique_ptr<ValueWriter> dictionary)
+      : dictionary_(std::move(dictionary)) {}
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    data_ = data;
+    // successive slices usually share the same dictionary
+    if (data_->dictionary != rendered_dictionary_) {
+      RETURN_NOT_OK(dictionary_->SetData(data_->dictionary));
+      const auto& dictionary_lengths = dictionary_->lengths();
+      dictionary_positions_.resize(dictionary_lengths.size());
+      int64_t position = 0;
+      for (size_t i = 0; i < dictionary_lengths.size(); ++i) {
+        dictionary_positions_[i] = position;
+        position += dictionary_lengths[i];
+      }
+      rendered_.resize(position);
+      dictionary_->Write(rendered_.data(), dictionary_positions_.data());
+      rendered_dictionary_ = data_->dictionary;
+    }
+
+    const DictionaryArray array(data_);
+    const auto& dictionary_lengths = dictionary_->lengths();
+    indices_.resize(data_->length);
+    lengths_.resize(data_->length);
+    for (int64_t i = 0; i < data_->length; ++i) {
+      if (array.IsValid(i)) {
+        indices_[i] = array.GetValueIndex(i);
+        lengths_[i] = dictionary_lengths[indices_[i]];
+      } else {
+        indices_[i] = -1;
+        lengths_[i] = kNullLength;
+      }
+    }
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    for (int64_t i = 0; i < data_->length; ++i) {
+      if (positions[i] < 0) continue;
+      if (indices_[i] < 0) {
+        WriteNull(output, positions[i]);
+      } else {
+        std::memcpy(output + positions[i],
+                    rendered_.data() + dictionary_positions_[indices_[i]], lengths_[i]);
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<ArrayData> data_;
+  std::unique_ptr<ValueWriter> dictionary_;
+  std::shared_ptr<ArrayData> rendered_dictionary_;
+  std::vector<int64_t> dictionary_positions_;
+  std::vector<char> rendered_;
+  std::vector<int64_t> indices_;
+};
+
+// Writer for extension types, which are written as their storage.
+class ExtensionWriter : public ValueWriter {
+ public:
+  ExtensionWriter(std::shared_ptr<DataType> storage_type,
+                  std::unique_ptr<ValueWriter> storage)
+      : storage_type_(std::move(storage_type)), storage_(std::move(storage)) {}
+
+  Status SetData(const std::shared_ptr<ArrayData>& data) override {
+    auto storage_data = data->Copy();
+    storage_data->type = storage_type_;
+    RETURN_NOT_OK(storage_->SetData(storage_data));
+    lengths_ = storage_->lengths();
+    return Status::OK();
+  }
+
+  void Write(char* output, const int64_t* positions) override {
+    storage_->Write(output, positions);
+  }
+
+ private:
+  std::shared_ptr<DataType> storage_type_;
+  std::unique_ptr<ValueWriter> storage_;
+};
+
+Result<std::unique_ptr<ValueWriter>> MakeValueWriter(const DataType& type,
+                                                     MemoryPool* pool);
+
+Result<std::unique_ptr<StructWriter>> MakeStructWriter(
+    const std::vector<std::shared_ptr<Field>>& fields, MemoryPool* pool) {
+  std::vector<std::unique_ptr<ValueWriter>> children(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(children[i], MakeValueWriter(*fields[i]->type(), pool));
+  }
+  return ::arrow::internal::make_unique<StructWriter>(fields, std::move(children));
+}
+
+struct ValueWriterFactory {
+  Status Visit(const NullType&) {
+    writer.reset(new NullWriter);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    writer.reset(new BooleanWriter);
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_integer_type<TypeClass>::value || is_duration_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass&) {
+    writer.reset(new IntegerWriter<TypeClass>);
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<std::is_same<FloatType, TypeClass>::value ||
+                  std::is_same<DoubleType, TypeClass>::value,
+              Status>
+  Visit(const TypeClass&) {
+    writer.reset(new FloatingPointWriter<TypeClass>);
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_date_type<TypeClass>::value || is_time_type<TypeClass>::value ||
+                  is_timestamp_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass&) {
+    writer.reset(new FormattedWriter<TypeClass, /*kQuoted=*/true>(pool));
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_decimal<TypeClass, Status> Visit(const TypeClass&) {
+    writer.reset(new FormattedWriter<TypeClass, /*kQuoted=*/false>(pool));
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_base_binary_type<TypeClass>::value ||
+                  std::is_same<FixedSizeBinaryType, TypeClass>::value ||
+                  is_string_view_type<TypeClass>::value,
+              Status>
+  Visit(const TypeClass&) {
+    writer.reset(new StringWriter<TypeClass>);
+    return Status::OK();
+  }
+
+  template <typename TypeClass>
+  enable_if_t<is_list_like_type<TypeClass>::value, Status> Visit(const TypeClass& type) {
+    ARROW_ASSIGN_OR_RAISE(auto values, MakeValueWriter(*type.value_type(), pool));
+    writer.reset(new ListWriter<TypeClass>(std::move(values)));
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    ARROW_ASSIGN_OR_RAISE(writer, MakeStructWriter(type.fields(), pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    ARROW_ASSIGN_OR_RAISE(auto dictionary, MakeValueWriter(*type.value_type(), pool));
+    writer.reset(new DictionaryWriter(std::move(dictionary)));
+    return Status::OK();
+  }
+
+  Status Visit(const ExtensionType& type) {
+    ARROW_ASSIGN_OR_RAISE(auto storage, MakeValueWriter(*type.storage_type(), pool));
+    writer.reset(new ExtensionWriter(type.storage_type(), std::move(storage)));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Writing data of type ", type, " to JSON");
+  }
+
+  MemoryPool* pool;
+  std::unique_ptr<ValueWriter> writer;
+};
+
+Result<std::unique_ptr<ValueWriter>> MakeValueWriter(const DataType& type,
+                                                     MemoryPool* pool) {
+  ValueWriterFactory factory{pool, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(type, &factory));
+  return std::move(factory.writer);
+}
+
+// Converts a non-empty batch to newline-delimited JSON in `data_buffer`.
+Status TranslateMinimalBatch(const RecordBatch& batch, StructWriter* row_writer,
+                             std::vector<int64_t>* positions,
+                             ResizableBuffer* data_buffer) {
+  DCHECK_GT(batch.num_rows(), 0);
+  // The rows are the values of a struct array over the columns
+  std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+  for (int col = 0; col < batch.num_columns(); col++) {
+    columns[col] = batch.column_data(col);
+  }
+  auto rows = ArrayData::Make(struct_(batch.schema()->fields()), batch.num_rows(),
+                              {nullptr}, std::move(columns), /*null_count=*/0);
+  RETURN_NOT_OK(row_writer->SetData(rows));
+
+  // Calculate the position of each row (each followed by a line ending)
+  const auto& row_lengths = row_writer->lengths();
+  positions->resize(batch.num_rows());
+  int64_t position = 0;
+  for (int64_t row = 0; row < batch.num_rows(); row++) {
+    (*positions)[row] = position;
+    position += row_lengths[row] + /*line ending*/ 1;
+  }
+  // Resize the target buffer to required size. We assume batch to batch sizes
+  // should be pretty close so don't shrink the buffer to avoid allocation churn.
+  RETURN_NOT_OK(data_buffer->Resize(position, /*shrink_to_fit=*/false));
+
+  char* output = reinterpret_cast<char*>(data_buffer->mutable_data());
+  row_writer->Write(output, positions->data());
+  for (int64_t row = 0; row < batch.num_rows(); row++) {
+    output[(*positions)[row] + row_lengths[row]] = '\n';
+  }
+  return Status::OK();
+}
+
+class JSONConverter {
+ public:
+  static Result<std::unique_ptr<JSONConverter>> Make(std::shared_ptr<Schema> schema,
+                                                     MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto row_writer, MakeStructWriter(schema->fields(), pool));
+    return std::unique_ptr<JSONConverter>(
+        new JSONConverter(std::move(schema), std::move(row_writer), pool));
+  }
+
+  Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                   io::OutputStream* out) {
+    return WriteBatches(RecordBatchSliceIterator(batch, options.batch_size), options,
+                        out);
+  }
+
+  Status WriteJSON(const Table& table, const WriteOptions& options,
+                   io::OutputStream* out) {
+    auto reader = std::make_shared<TableBatchReader>(table);
+    reader->set_chunksize(options.batch_size);
+    return WriteBatches(MakeFunctionIterator([reader] { return reader->Next(); }),
+                        options, out);
+  }
+
+ private:
+  JSONConverter(std::shared_ptr<Schema> schema, std::unique_ptr<StructWriter> row_writer,
+                MemoryPool* pool)
+      : row_writer_(std::move(row_writer)), schema_(std::move(schema)), pool_(pool) {}
+
+  Status WriteBatches(RecordBatchIterator batches, const WriteOptions& options,
+                      io::OutputStream* out) {
+    if (options.use_threads) {
+      return WriteBatchesParallel(std::move(batches), out);
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                          AllocateResizableBuffer(0, pool_));
+    for (auto maybe_batch : batches) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch, maybe_batch);
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      RETURN_NOT_OK(TranslateMinimalBatch(*batch, row_writer_.get(), &positions_,
+                                          data_buffer.get()));
+      RETURN_NOT_OK(out->Write(data_buffer));
+    }
+    return Status::OK();
+  }
+
+  // Convert batches on the CPU thread pool, while the calling thread writes the
+  // converted batches in order.  The number of batches in flight is bounded
+  // by twice the thread pool capacity.
+  Status WriteBatchesParallel(RecordBatchIterator batches, io::OutputStream* out) {
+    auto executor = ::arrow::internal::GetCpuThreadPool();
+    const size_t max_in_flight = static_cast<size_t>(2 * executor->GetCapacity());
+
+    std::deque<Future<std::shared_ptr<Buffer>>> in_flight;
+    Status st;
+    auto write_next = [&]() {
+      auto maybe_buffer = in_flight.front().result();
+      in_flight.pop_front();
+      if (st.ok()) {
+        st = maybe_buffer.ok() ? out->Write(*maybe_buffer) : maybe_buffer.status();
+      }
+    };
+
+    while (st.ok()) {
+      auto maybe_batch = batches.Next();
+      if (!maybe_batch.ok()) {
+        st = maybe_batch.status();
+        break;
+      }
+      std::shared_ptr<RecordBatch> batch = *std::move(maybe_batch);
+      if (batch == nullptr) {
+        break;
+      }
+      if (batch->num_rows() == 0) {
+        continue;
+      }
+      if (in_flight.size() >= max_in_flight) {
+        write_next();
+      }
+      // The task doesn't reference the converter, which may be destroyed
+      // before the task ends in case of error.
+      auto schema = schema_;
+      auto pool = pool_;
+      in_flight.push_back(DeferNotOk(executor->Submit(
+          [schema, pool, batch]() -> Result<std::shared_ptr<Buffer>> {
+            ARROW_ASSIGN_OR_RAISE(auto row_writer,
+                                  MakeStructWriter(schema->fields(), pool));
+            std::vector<int64_t> positions;
+            ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                                  AllocateResizableBuffer(0, pool));
+            RETURN_NOT_OK(TranslateMinimalBatch(*batch, row_writer.get(), &positions,
+                                                data_buffer.get()));
+            return std::move(data_buffer);
+          })));
+    }
+    while (st.ok() && !in_flight.empty()) {
+      write_next();
+    }
+    return st;
+  }
+
+  std::unique_ptr<StructWriter> row_writer_;
+  std::vector<int64_t> positions_;
+  const std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+};
+
+}  // namespace
+
+Status WriteJSON(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                 arrow::io::OutputStream* output) {
+  if (pool == nullptr) {
+    pool = default_memory_pool();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<JSONConverter> converter,
+                        JSONConverter::Make(table.schema(), pool));
+  return converter->WriteJSON(table, options, output);
+}
+
+Status WriteJSON(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                 arrow::io::OutputStream* output) {
+  if (pool == nullptr) {
+    pool = default_memory_pool();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<JSONConverter> converter,
+                        JSONConverter::Make(batch.schema(), pool));
+  return converter->WriteJSON(batch, options, output);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/io/interfaces.h"
+#include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace json {
+// Functionality for converting Arrow data to newline-delimited JSON text.
+// Each row is written as one JSON object on its own line, with a member per column
+// named after its field. It applies the following formatting rules:
+//  - Nulls are written as null, as are NaN and infinite floating-point values.
+//  - Integers, floating-point and decimal values are written as JSON numbers.
+//  - Binary and string values are written as JSON strings, escaped as needed. Binary
+//  data is not validated as UTF8.
+//  - Dates, times and timestamps are written as JSON strings (e.g.
+//  "2021-03-04 05:06:07"), durations as their integer count.
+//  - Lists are written as JSON arrays, structs as JSON objects and maps as JSON arrays
+//  of {"key": ..., "value": ...} objects. Dictionaries are written as their values.
+//  - LF (\n) is always used as a line ending.
+
+/// \brief Converts table to newline-delimited JSON and writes the results to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const Table& table, const WriteOptions& options,
+                              MemoryPool* pool, arrow::io::OutputStream* output);
+/// \brief Converts batch to newline-delimited JSON and writes the results to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                              MemoryPool* pool, arrow::io::OutputStream* output);
+
+}  // namespace json
+}  // namespace arrow
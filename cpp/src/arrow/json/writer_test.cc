@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+template <typename Data>
+Result<std::string> ToJSONString(const Data& data, const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(data, options, default_memory_pool(), out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+WriteOptions DefaultTestOptions() {
+  WriteOptions options;
+  options.batch_size = 5;
+  return options;
+}
+
+void CheckWrite(const std::shared_ptr<RecordBatch>& batch, const std::string& expected) {
+  WriteOptions options = DefaultTestOptions();
+  ASSERT_OK_AND_ASSIGN(std::string json, ToJSONString(*batch, options));
+  EXPECT_EQ(json, expected);
+
+  // Batch size shouldn't matter.
+  options.batch_size = 2;
+  ASSERT_OK_AND_ASSIGN(json, ToJSONString(*batch, options));
+  EXPECT_EQ(json, expected);
+
+  // Table and Record batch should work identically.
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> table, Table::FromRecordBatches({batch}));
+  ASSERT_OK_AND_ASSIGN(json, ToJSONString(*table, options));
+  EXPECT_EQ(json, expected);
+
+  // Threading shouldn't matter.
+  options.use_threads = !options.use_threads;
+  ASSERT_OK_AND_ASSIGN(json, ToJSONString(*batch, options));
+  EXPECT_EQ(json, expected);
+  ASSERT_OK_AND_ASSIGN(json, ToJSONString(*table, options));
+  EXPECT_EQ(json, expected);
+}
+
+void CheckWrite(const std::shared_ptr<Schema>& schema, const std::string& batch_data,
+                const std::string& expected) {
+  CheckWrite(RecordBatchFromJSON(schema, batch_data), expected);
+}
+
+TEST(TestWriteJSON, Numbers) {
+  CheckWrite(schema({field("a", int8()), field("b", uint64()), field("c", int64()),
+                     field("d", float64())}),
+             R"([[-128, 18446744073709551615, -9223372036854775808, 1.5],
+                 [127, 0, 9223372036854775807, -0.25],
+                 [null, 10, -1, 1e300],
+                 [-10, null, 100, null]])",
+             R"({"a":-128,"b":18446744073709551615,"c":-9223372036854775808,"d":1.5})"
+             "\n"
+             R"({"a":127,"b":0,"c":9223372036854775807,"d":-0.25})"
+             "\n"
+             R"({"a":null,"b":10,"c":-1,"d":1e+300})"
+             "\n"
+             R"({"a":-10,"b":null,"c":100,"d":null})"
+             "\n");
+}
+
+TEST(TestWriteJSON, NonFiniteFloats) {
+  DoubleBuilder builder;
+  ASSERT_OK(builder.AppendValues({NAN, INFINITY, -INFINITY, 0.5}));
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  CheckWrite(RecordBatch::Make(schema({field("x", float64())}), 4, {values}),
+             "{\"x\":null}\n{\"x\":null}\n{\"x\":null}\n{\"x\":0.5}\n");
+}
+
+TEST(TestWriteJSON, Strings) {
+  CheckWrite(schema({field("s", utf8()), field("b", binary())}),
+             R"([["plain", "x"],
+                 ["quote\" backslash\\", ""],
+                 ["line\nbreak\ttab\r\b\f", "\u0001\u001f"],
+                 ["été", null],
+                 ["a long string with a quote past 16 bytes: \"", "x"]])",
+             R"({"s":"plain","b":"x"})"
+             "\n"
+             R"({"s":"quote\" backslash\\","b":""})"
+             "\n"
+             R"({"s":"line\nbreak\ttab\r\b\f","b":"\u0001\u001f"})"
+             "\n"
+             "{\"s\":\"\xc3\xa9t\xc3\xa9\",\"b\":null}\n"
+             R"({"s":"a long string with a quote past 16 bytes: \"","b":"x"})"
+             "\n");
+}
+
+TEST(TestWriteJSON, FieldNames) {
+  CheckWrite(schema({field("a\"", boolean()), field("", null())}),
+             "[[true, null], [false, null], [null, null]]",
+             "{\"a\\\"\":true,\"\":null}\n{\"a\\\"\":false,\"\":null}\n"
+             "{\"a\\\"\":null,\"\":null}\n");
+}
+
+TEST(TestWriteJSON, Temporal) {
+  CheckWrite(schema({field("ts", timestamp(TimeUnit::SECOND)), field("d", date32()),
+                     field("t", time32(TimeUnit::MILLI)),
+                     field("dur", duration(TimeUnit::SECOND))}),
+             "[[1, 0, 3723004, -5], [null, 365, null, null]]",
+             R"({"ts":"1970-01-01 00:00:01","d":"1970-01-01","t":"01:02:03.004",)"
+             R"("dur":-5})"
+             "\n"
+             R"({"ts":null,"d":"1971-01-01","t":null,"dur":null})"
+             "\n");
+}
+
+TEST(TestWriteJSON, Decimal) {
+  CheckWrite(schema({field("d", decimal(5, 2))}), R"([["123.45"], [null], ["-0.01"]])",
+             "{\"d\":123.45}\n{\"d\":null}\n{\"d\":-0.01}\n");
+}
+
+TEST(TestWriteJSON, Nested) {
+  CheckWrite(
+      schema({field("l", list(int32())),
+              field("s", struct_({field("a", int32()), field("b", utf8())}))}),
+      R"([[[1, null, 3], {"a": 1, "b": "x"}],
+          [[], {"a": null, "b": null}],
+          [null, null],
+          [[4], {"a": 2, "b": "y"}]])",
+      R"({"l":[1,null,3],"s":{"a":1,"b":"x"}})"
+      "\n"
+      R"({"l":[],"s":{"a":null,"b":null}})"
+      "\n"
+      R"({"l":null,"s":null})"
+      "\n"
+      R"({"l":[4],"s":{"a":2,"b":"y"}})"
+      "\n");
+
+  CheckWrite(schema({field("m", map(utf8(), int32())),
+                     field("f", fixed_size_list(list(int8()), 2))}),
+             R"([[[["a", 1], ["b", null]], [[1], []]],
+                 [null, null],
+                 [[], [null, [2, 3]]]])",
+             R"({"m":[{"key":"a","value":1},{"key":"b","value":null}],"f":[[1],[]]})"
+             "\n"
+             R"({"m":null,"f":null})"
+             "\n"
+             R"({"m":[],"f":[null,[2,3]]})"
+             "\n");
+}
+
+TEST(TestWriteJSON, Dictionary) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto dict_array = DictArrayFromJSON(dict_type, "[0, 1, null, 1, 0]", R"(["a", "b\""])");
+  CheckWrite(RecordBatch::Make(schema({field("a", dict_type)}), 5, {dict_array}),
+             "{\"a\":\"a\"}\n{\"a\":\"b\\\"\"}\n{\"a\":null}\n{\"a\":\"b\\\"\"}\n"
+             "{\"a\":\"a\"}\n");
+}
+
+TEST(TestWriteJSON, Empty) {
+  CheckWrite(schema({field("a", int32())}), "[]", "");
+
+  // Rows without columns are empty objects
+  auto batch = RecordBatch::Make(schema({}), 2, ArrayVector{});
+  CheckWrite(batch, "{}\n{}\n");
+}
+
+TEST(TestWriteJSON, UnsupportedType) {
+  ASSERT_OK_AND_ASSIGN(auto intervals, MakeArrayOfNull(month_interval(), 1));
+  auto batch = RecordBatch::Make(schema({field("a", month_interval())}), 1, {intervals});
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_RAISES(NotImplemented,
+                WriteJSON(*batch, WriteOptions::Defaults(), default_memory_pool(),
+                          out.get()));
+}
+
+TEST(TestWriteJSON, RoundTrip) {
+  auto batch_schema =
+      schema({field("i", int64()), field("d", float64()), field("s", utf8()),
+              field("b", boolean()), field("l", list(int64())),
+              field("st", struct_({field("x", int64()), field("y", utf8())}))});
+  auto batch = RecordBatchFromJSON(batch_schema, R"([
+      [1, 0.1, "a\"\n", true, [1, 2], {"x": 1, "y": "z"}],
+      [null, null, null, null, null, {"x": null, "y": null}],
+      [-3, 1e-10, "é", false, [], {"x": 5, "y": "\\"}]
+    ])");
+  ASSERT_OK_AND_ASSIGN(std::string json, ToJSONString(*batch, DefaultTestOptions()));
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = batch_schema;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(),
+                        std::make_shared<io::BufferReader>(Buffer::FromString(json)),
+                        ReadOptions::Defaults(), parse_options));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->Read());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST(TestWriteJSON, ParallelOutputOrder) {
+  const int NROWS = 10000;
+  Int64Builder int_builder;
+  StringBuilder string_builder;
+  std::string expected;
+  for (int i = 0; i < NROWS; ++i) {
+    ASSERT_OK(int_builder.Append(i));
+    ASSERT_OK(string_builder.Append("x" + std::to_string(i)));
+    const std::string value = std::to_string(i);
+    expected += "{\"a\":" + value + ",\"b\":\"x" + value + "\"}\n";
+  }
+  ASSERT_OK_AND_ASSIGN(auto ints, int_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto strings, string_builder.Finish());
+  auto batch = RecordBatch::Make(schema({field("a", int64()), field("b", utf8())}),
+                                 NROWS, {ints, strings});
+
+  for (bool use_threads : {false, true}) {
+    WriteOptions options = DefaultTestOptions();
+    options.batch_size = 100;
+    options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto json, ToJSONString(*batch, options));
+    ASSERT_EQ(json, expected);
+  }
+}
+
+}  // namespace json
+}  // namespace arrow
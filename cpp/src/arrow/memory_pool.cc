@@ -22,14 +22,24 @@
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #if defined(sun) || defined(__sun)
 #include <stdlib.h>
 #endif
 
+#ifdef ARROW_WITH_BACKTRACE
+#include <execinfo.h>
+#endif
+
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 #include "arrow/util/optional.h"
@@ -362,6 +372,14 @@ class MimallocAllocator {
 
 int64_t MemoryPool::max_memory() const { return -1; }
 
+int64_t MemoryPool::total_bytes_allocated() const { return -1; }
+
+int64_t MemoryPool::num_allocations() const { return -1; }
+
+int64_t MemoryPool::num_reallocations() const { return -1; }
+
+std::vector<int64_t> MemoryPool::allocation_size_histogram() const { return {}; }
+
 ///////////////////////////////////////////////////////////////////////
 // MemoryPool implementation that delegates its core duty
 // to an Allocator class.
@@ -394,7 +412,7 @@ class BaseMemoryPoolImpl : public MemoryPool {
     }
 #endif
 
-    stats_.UpdateAllocatedBytes(size);
+    stats_.DidAllocateBytes(size);
     return Status::OK();
   }
 
@@ -415,7 +433,7 @@ class BaseMemoryPoolImpl : public MemoryPool {
     }
 #endif
 
-    stats_.UpdateAllocatedBytes(new_size - old_size);
+    stats_.DidReallocateBytes(old_size, new_size);
     return Status::OK();
   }
 
@@ -430,13 +448,25 @@ class BaseMemoryPoolImpl : public MemoryPool {
 #endif
     Allocator::DeallocateAligned(buffer, size);
 
-    stats_.UpdateAllocatedBytes(-size);
+    stats_.DidFreeBytes(size);
   }
 
   int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
 
   int64_t max_memory() const override { return stats_.max_memory(); }
 
+  int64_t total_bytes_allocated() const override {
+    return stats_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return stats_.num_allocations(); }
+
+  int64_t num_reallocations() const override { return stats_.num_reallocations(); }
+
+  std::vector<int64_t> allocation_size_histogram() const override {
+    return stats_.allocation_size_histogram();
+  }
+
  protected:
   internal::MemoryPoolStats stats_;
 };
@@ -550,6 +580,27 @@ Status jemalloc_set_decay_ms(int ms) {
 #endif
 }
 
+Status jemalloc_create_arena(unsigned* out) {
+#ifdef ARROW_JEMALLOC
+  size_t size = sizeof(*out);
+  int err = mallctl("arenas.create", out, &size, nullptr, 0);
+  RETURN_IF_JEMALLOC_ERROR(err);
+  return Status::OK();
+#else
+  return Status::Invalid("jemalloc support is not built");
+#endif
+}
+
+Status jemalloc_set_thread_arena(unsigned arena) {
+#ifdef ARROW_JEMALLOC
+  int err = mallctl("thread.arena", nullptr, nullptr, &arena, sizeof(arena));
+  RETURN_IF_JEMALLOC_ERROR(err);
+  return Status::OK();
+#else
+  return Status::Invalid("jemalloc support is not built");
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////
 // LoggingMemoryPool implementation
 
@@ -585,6 +636,28 @@ int64_t LoggingMemoryPool::max_memory() const {
   return mem;
 }
 
+int64_t LoggingMemoryPool::total_bytes_allocated() const {
+  int64_t nb_bytes = pool_->total_bytes_allocated();
+  std::cout << "total_bytes_allocated: " << nb_bytes << std::endl;
+  return nb_bytes;
+}
+
+int64_t LoggingMemoryPool::num_allocations() const {
+  int64_t count = pool_->num_allocations();
+  std::cout << "num_allocations: " << count << std::endl;
+  return count;
+}
+
+int64_t LoggingMemoryPool::num_reallocations() const {
+  int64_t count = pool_->num_reallocations();
+  std::cout << "num_reallocations: " << count << std::endl;
+  return count;
+}
+
+std::vector<int64_t> LoggingMemoryPool::allocation_size_histogram() const {
+  return pool_->allocation_size_histogram();
+}
+
 std::string LoggingMemoryPool::backend_name() const { return pool_->backend_name(); }
 
 ///////////////////////////////////////////////////////////////////////
@@ -596,28 +669,23 @@ class ProxyMemoryPool::ProxyMemoryPoolImpl {
 
   Status Allocate(int64_t size, uint8_t** out) {
     RETURN_NOT_OK(pool_->Allocate(size, out));
-    stats_.UpdateAllocatedBytes(size);
+    stats_.DidAllocateBytes(size);
     return Status::OK();
   }
 
   Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
     RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
-    stats_.UpdateAllocatedBytes(new_size - old_size);
+    stats_.DidReallocateBytes(old_size, new_size);
     return Status::OK();
   }
 
   void Free(uint8_t* buffer, int64_t size) {
     pool_->Free(buffer, size);
-    stats_.UpdateAllocatedBytes(-size);
+    stats_.DidFreeBytes(size);
   }
 
-  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
-
-  int64_t max_memory() const { return stats_.max_memory(); }
-
   std::string backend_name() const { return pool_->backend_name(); }
 
- private:
   MemoryPool* pool_;
   internal::MemoryPoolStats stats_;
 };
@@ -640,12 +708,644 @@ void ProxyMemoryPool::Free(uint8_t* buffer, int64_t size) {
   return impl_->Free(buffer, size);
 }
 
-int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+int64_t ProxyMemoryPool::bytes_allocated() const {
+  return impl_->stats_.bytes_allocated();
+}
+
+int64_t ProxyMemoryPool::max_memory() const { return impl_->stats_.max_memory(); }
+
+int64_t ProxyMemoryPool::total_bytes_allocated() const {
+  return impl_->stats_.total_bytes_allocated();
+}
+
+int64_t ProxyMemoryPool::num_allocations() const {
+  return impl_->stats_.num_allocations();
+}
+
+int64_t ProxyMemoryPool::num_reallocations() const {
+  return impl_->stats_.num_reallocations();
+}
 
-int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
+std::vector<int64_t> ProxyMemoryPool::allocation_size_histogram() const {
+  return impl_->stats_.allocation_size_histogram();
+}
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// TrackingMemoryPool implementation
+
+class TrackingMemoryPool::TrackingMemoryPoolImpl {
+ public:
+  TrackingMemoryPoolImpl(MemoryPool* pool, std::shared_ptr<TrackingMemoryPool> parent,
+                         int64_t limit, std::string name)
+      : pool_(pool), parent_(std::move(parent)), limit_(limit), name_(std::move(name)) {}
+
+  ~TrackingMemoryPoolImpl() {
+    // Whatever is left (leaks, reservations) is no longer consumed
+    ARROW_UNUSED(Update(-allocated_.load(), -reserved_.load()));
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Update(size, 0));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      ARROW_UNUSED(Update(-size, 0));
+    }
+    return st;
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size > old_size) {
+      RETURN_NOT_OK(Update(new_size - old_size, 0));
+      Status st = pool_->Reallocate(old_size, new_size, ptr);
+      if (!st.ok()) {
+        ARROW_UNUSED(Update(old_size - new_size, 0));
+      }
+      return st;
+    }
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    return Update(new_size - old_size, 0);
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    ARROW_UNUSED(Update(-size, 0));
+  }
+
+  Status Reserve(int64_t bytes) {
+    if (bytes < 0) {
+      return Status::Invalid("Cannot reserve a negative number of bytes");
+    }
+    return Update(0, bytes);
+  }
+
+  void Release(int64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ARROW_UNUSED(UpdateUnlocked(0, -std::min(std::max<int64_t>(bytes, 0), reserved_.load())));
+  }
+
+  // Update the allocated and reserved bytes, charging the change of
+  // consumption to this tracker and its ancestors.  Increases fail if they
+  // exceed a limit, leaving everything unchanged.
+  Status Update(int64_t allocated_diff, int64_t reserved_diff) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return UpdateUnlocked(allocated_diff, reserved_diff);
+  }
+
+  Status UpdateUnlocked(int64_t allocated_diff, int64_t reserved_diff) {
+    const int64_t allocated = allocated_.load() + allocated_diff;
+    const int64_t reserved = reserved_.load() + reserved_diff;
+    const int64_t diff = std::max(allocated, reserved) -
+                         std::max(allocated_.load(), reserved_.load());
+    if (diff > 0) {
+      RETURN_NOT_OK(Consume(diff));
+    } else if (diff < 0) {
+      for (auto node = this; node != nullptr; node = node->parent_impl()) {
+        node->consumption_ += diff;
+      }
+    }
+    allocated_ = allocated;
+    reserved_ = reserved;
+    if (allocated > max_allocated_.load()) {
+      max_allocated_ = allocated;
+    }
+    return Status::OK();
+  }
+
+  // Charge `bytes` to this tracker and its ancestors
+  Status Consume(int64_t bytes) {
+    for (auto node = this; node != nullptr; node = node->parent_impl()) {
+      const int64_t consumption = node->consumption_.fetch_add(bytes) + bytes;
+      if (node->limit_ >= 0 && consumption > node->limit_) {
+        for (auto undo = this; undo != node->parent_impl(); undo = undo->parent_impl()) {
+          undo->consumption_ -= bytes;
+        }
+        return Status::OutOfMemory("Memory limit of '", node->name_, "' exceeded: ",
+                                   "consuming ", bytes, " more bytes over ",
+                                   consumption - bytes, " bytes, limit is ",
+                                   node->limit_);
+      }
+      // Like MemoryPoolStats, don't try to be too rigorous about the peak
+      if (consumption > node->max_consumption_.load()) {
+        node->max_consumption_ = consumption;
+      }
+    }
+    return Status::OK();
+  }
+
+  TrackingMemoryPoolImpl* parent_impl() const {
+    return parent_ ? parent_->impl_.get() : nullptr;
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<TrackingMemoryPool> parent_;
+  const int64_t limit_;
+  const std::string name_;
+
+  // Serializes the updates of allocated_ and reserved_ so that consumption
+  // changes are computed from a consistent pair
+  std::mutex mutex_;
+  std::atomic<int64_t> allocated_{0};
+  std::atomic<int64_t> reserved_{0};
+  std::atomic<int64_t> max_allocated_{0};
+  std::atomic<int64_t> consumption_{0};
+  std::atomic<int64_t> max_consumption_{0};
+};
+
+TrackingMemoryPool::TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+TrackingMemoryPool::~TrackingMemoryPool() {}
+
+std::shared_ptr<TrackingMemoryPool> TrackingMemoryPool::Make(MemoryPool* pool,
+                                                             int64_t limit,
+                                                             std::string name) {
+  return std::shared_ptr<TrackingMemoryPool>(
+      new TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl>(
+          new TrackingMemoryPoolImpl(pool, nullptr, limit, std::move(name)))));
+}
+
+std::shared_ptr<TrackingMemoryPool> TrackingMemoryPool::MakeChild(int64_t limit,
+                                                                  std::string name) {
+  return std::shared_ptr<TrackingMemoryPool>(
+      new TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl>(
+          new TrackingMemoryPoolImpl(impl_->pool_, shared_from_this(), limit,
+                                     std::move(name)))));
+}
+
+Status TrackingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status TrackingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void TrackingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t TrackingMemoryPool::bytes_allocated() const { return impl_->allocated_.load(); }
+
+int64_t TrackingMemoryPool::max_memory() const { return impl_->max_allocated_.load(); }
+
+std::string TrackingMemoryPool::backend_name() const {
+  return impl_->pool_->backend_name();
+}
+
+Status TrackingMemoryPool::Reserve(int64_t bytes) { return impl_->Reserve(bytes); }
+
+void TrackingMemoryPool::Release(int64_t bytes) { impl_->Release(bytes); }
+
+int64_t TrackingMemoryPool::bytes_reserved() const { return impl_->reserved_.load(); }
+
+int64_t TrackingMemoryPool::consumption() const { return impl_->consumption_.load(); }
+
+int64_t TrackingMemoryPool::max_consumption() const {
+  return impl_->max_consumption_.load();
+}
+
+int64_t TrackingMemoryPool::limit() const { return impl_->limit_; }
+
+const std::string& TrackingMemoryPool::name() const { return impl_->name_; }
+
+TrackingMemoryPool* TrackingMemoryPool::parent() const { return impl_->parent_.get(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+namespace {
+
+// Size classes are the powers of two from 64 bytes
+constexpr int kMinSizeClassBits = 6;
+constexpr int kNumCacheShards = 16;
+
+// The cache shard of the calling thread.  Threads are spread over shards
+// round-robin, whatever the pool.
+int CurrentCacheShard() {
+  static std::atomic<int> next_shard{0};
+  thread_local const int shard = next_shard.fetch_add(1) % kNumCacheShards;
+  return shard;
+}
+
+}  // namespace
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_size, int64_t max_cached_bytes)
+      : pool_(pool),
+        num_size_classes_(
+            std::max(0, BitUtil::Log2(static_cast<uint64_t>(std::max<int64_t>(
+                            max_size, 1))) - kMinSizeClassBits + 1)),
+        max_cached_bytes_(max_cached_bytes) {
+    for (auto& shard : shards_) {
+      shard.free_lists.resize(num_size_classes_);
+    }
+  }
+
+  ~RecyclingMemoryPoolImpl() { ReleaseUnused(); }
+
+  // The size class of an allocation of `size` bytes, or -1 if not recycled
+  int SizeClass(int64_t size) const {
+    if (size <= 0) {
+      return -1;
+    }
+    const int size_class =
+        std::max(0, BitUtil::Log2(static_cast<uint64_t>(size)) - kMinSizeClassBits);
+    return size_class < num_size_classes_ ? size_class : -1;
+  }
+
+  static int64_t SizeClassBytes(int size_class) {
+    return int64_t(1) << (size_class + kMinSizeClassBits);
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(AllocateBuffer(size, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int old_class = SizeClass(old_size);
+    const int new_class = SizeClass(new_size);
+    if (old_class >= 0 && old_class == new_class) {
+      // The buffer is already large enough
+    } else if (old_class < 0 && new_class < 0 && old_size > 0 && new_size > 0) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateBuffer(new_size, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeBuffer(*ptr, old_size);
+      *ptr = out;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    FreeBuffer(buffer, size);
+    stats_.DidFreeBytes(size);
+  }
+
+  Status AllocateBuffer(int64_t size, uint8_t** out) {
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      return pool_->Allocate(size, out);
+    }
+    if (!TakeCached(size_class, out)) {
+      return pool_->Allocate(SizeClassBytes(size_class), out);
+    }
+    return Status::OK();
+  }
+
+  void FreeBuffer(uint8_t* buffer, int64_t size) {
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      pool_->Free(buffer, size);
+      return;
+    }
+    const int64_t class_bytes = SizeClassBytes(size_class);
+    if (cached_bytes_.fetch_add(class_bytes) + class_bytes > max_cached_bytes_) {
+      cached_bytes_ -= class_bytes;
+      pool_->Free(buffer, class_bytes);
+      return;
+    }
+    Shard& shard = shards_[CurrentCacheShard()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.free_lists[size_class].push_back(buffer);
+  }
+
+  // Take a cached buffer of the given size class, from the shard of the
+  // calling thread first
+  bool TakeCached(int size_class, uint8_t** out) {
+    if (cached_bytes_.load() == 0) {
+      return false;
+    }
+    const int first = CurrentCacheShard();
+    for (int i = 0; i < kNumCacheShards; ++i) {
+      Shard& shard = shards_[(first + i) % kNumCacheShards];
+      std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+      // Don't wait for other threads' shards, allocating is cheaper
+      if (i == 0) {
+        lock.lock();
+      } else if (!lock.try_lock()) {
+        continue;
+      }
+      auto& free_list = shard.free_lists[size_class];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        cached_bytes_ -= SizeClassBytes(size_class);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void ReleaseUnused() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (int size_class = 0; size_class < num_size_classes_; ++size_class) {
+        const int64_t class_bytes = SizeClassBytes(size_class);
+        for (uint8_t* buffer : shard.free_lists[size_class]) {
+          pool_->Free(buffer, class_bytes);
+          cached_bytes_ -= class_bytes;
+        }
+        shard.free_lists[size_class].clear();
+      }
+    }
+  }
+
+  struct Shard {
+    std::mutex mutex;
+    // Cached buffers by size class
+    std::vector<std::vector<uint8_t*>> free_lists;
+  };
+
+  MemoryPool* pool_;
+  const int num_size_classes_;
+  const int64_t max_cached_bytes_;
+  Shard shards_[kNumCacheShards];
+  std::atomic<int64_t> cached_bytes_{0};
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(std::unique_ptr<RecyclingMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+std::unique_ptr<RecyclingMemoryPool> RecyclingMemoryPool::Make(MemoryPool* pool,
+                                                               int64_t max_size,
+                                                               int64_t max_cached_bytes) {
+  return std::unique_ptr<RecyclingMemoryPool>(
+      new RecyclingMemoryPool(std::unique_ptr<RecyclingMemoryPoolImpl>(
+          new RecyclingMemoryPoolImpl(pool, max_size, max_cached_bytes))));
+}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const {
+  return impl_->stats_.bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->stats_.max_memory(); }
+
+int64_t RecyclingMemoryPool::total_bytes_allocated() const {
+  return impl_->stats_.total_bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::num_allocations() const {
+  return impl_->stats_.num_allocations();
+}
+
+int64_t RecyclingMemoryPool::num_reallocations() const {
+  return impl_->stats_.num_reallocations();
+}
+
+std::vector<int64_t> RecyclingMemoryPool::allocation_size_histogram() const {
+  return impl_->stats_.allocation_size_histogram();
+}
+
+std::string RecyclingMemoryPool::backend_name() const {
+  return impl_->pool_->backend_name();
+}
+
+int64_t RecyclingMemoryPool::bytes_cached() const { return impl_->cached_bytes_.load(); }
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+///////////////////////////////////////////////////////////////////////
+// HeapProfilingMemoryPool implementation
+
+namespace {
+
+constexpr int kMaxSampledStackDepth = 32;
+
+// The call stack of the caller, starting with the frames of the pool
+std::vector<void*> CaptureStack() {
+#ifdef ARROW_WITH_BACKTRACE
+  void* buffer[kMaxSampledStackDepth];
+  const int depth = backtrace(buffer, kMaxSampledStackDepth);
+  return std::vector<void*>(buffer, buffer + depth);
+#else
+  return {};
+#endif
+}
+
+}  // namespace
+
+class HeapProfilingMemoryPool::HeapProfilingMemoryPoolImpl {
+ public:
+  HeapProfilingMemoryPoolImpl(MemoryPool* pool, int64_t sample_interval)
+      : pool_(pool),
+        sample_interval_(std::max<int64_t>(sample_interval, 1)),
+        bytes_until_sample_(sample_interval_) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.DidAllocateBytes(size);
+    if (ShouldSample(size)) {
+      AddSample(*out, size);
+    }
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    uint8_t* old_ptr = *ptr;
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.DidReallocateBytes(old_size, new_size);
+    if (num_samples_.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = samples_.find(old_ptr);
+      if (it != samples_.end()) {
+        Sample sample = std::move(it->second);
+        samples_.erase(it);
+        if (new_size > 0) {
+          sample.size = new_size;
+          samples_.emplace(*ptr, std::move(sample));
+        } else {
+          --num_samples_;
+        }
+        return Status::OK();
+      }
+    }
+    if (new_size > old_size && ShouldSample(new_size - old_size)) {
+      AddSample(*ptr, new_size);
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (num_samples_.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (samples_.erase(buffer) > 0) {
+        --num_samples_;
+      }
+    }
+    pool_->Free(buffer, size);
+    stats_.DidFreeBytes(size);
+  }
+
+  // Whether to sample an allocation of `size` bytes
+  bool ShouldSample(int64_t size) {
+    // Empty allocations all share the same address
+    if (size <= 0 || bytes_until_sample_.fetch_sub(size) - size > 0) {
+      return false;
+    }
+    // Threads crossing the threshold together may all sample, that's fine
+    bytes_until_sample_.store(sample_interval_);
+    return true;
+  }
+
+  void AddSample(uint8_t* buffer, int64_t size) {
+    Sample sample{CaptureStack(), size};
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (samples_.emplace(buffer, std::move(sample)).second) {
+      ++num_samples_;
+    }
+  }
+
+  std::vector<CallSite> LiveHeap() const {
+    std::map<std::vector<void*>, CallSite> call_sites;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& entry : samples_) {
+        const Sample& sample = entry.second;
+        CallSite& call_site = call_sites[sample.stack];
+        ++call_site.num_samples;
+        // A sample stands for the bytes allocated since the previous one
+        call_site.estimated_bytes += std::max(sample.size, sample_interval_);
+      }
+    }
+    std::vector<CallSite> heap;
+    for (auto& entry : call_sites) {
+      entry.second.stack = entry.first;
+      heap.push_back(std::move(entry.second));
+    }
+    std::stable_sort(heap.begin(), heap.end(), [](const CallSite& a, const CallSite& b) {
+      return a.estimated_bytes > b.estimated_bytes;
+    });
+    return heap;
+  }
+
+  struct Sample {
+    std::vector<void*> stack;
+    int64_t size;
+  };
+
+  MemoryPool* pool_;
+  const int64_t sample_interval_;
+  std::atomic<int64_t> bytes_until_sample_;
+  std::atomic<int64_t> num_samples_{0};
+  mutable std::mutex mutex_;
+  // Live sampled allocations by address
+  std::unordered_map<uint8_t*, Sample> samples_;
+  internal::MemoryPoolStats stats_;
+};
+
+HeapProfilingMemoryPool::HeapProfilingMemoryPool(MemoryPool* pool,
+                                                 int64_t sample_interval)
+    : impl_(new HeapProfilingMemoryPoolImpl(pool, sample_interval)) {}
+
+HeapProfilingMemoryPool::~HeapProfilingMemoryPool() {}
+
+Status HeapProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HeapProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HeapProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t HeapProfilingMemoryPool::bytes_allocated() const {
+  return impl_->stats_.bytes_allocated();
+}
+
+int64_t HeapProfilingMemoryPool::max_memory() const {
+  return impl_->stats_.max_memory();
+}
+
+int64_t HeapProfilingMemoryPool::total_bytes_allocated() const {
+  return impl_->stats_.total_bytes_allocated();
+}
+
+int64_t HeapProfilingMemoryPool::num_allocations() const {
+  return impl_->stats_.num_allocations();
+}
+
+int64_t HeapProfilingMemoryPool::num_reallocations() const {
+  return impl_->stats_.num_reallocations();
+}
+
+std::vector<int64_t> HeapProfilingMemoryPool::allocation_size_histogram() const {
+  return impl_->stats_.allocation_size_histogram();
+}
+
+std::string HeapProfilingMemoryPool::backend_name() const {
+  return impl_->pool_->backend_name();
+}
+
+std::vector<HeapProfilingMemoryPool::CallSite> HeapProfilingMemoryPool::LiveHeap()
+    const {
+  return impl_->LiveHeap();
+}
+
+std::string HeapProfilingMemoryPool::LiveHeapDump() const {
+  const auto heap = LiveHeap();
+  int64_t total_bytes = 0, total_samples = 0;
+  for (const auto& call_site : heap) {
+    total_bytes += call_site.estimated_bytes;
+    total_samples += call_site.num_samples;
+  }
+  std::stringstream ss;
+  ss << "Live heap: about " << total_bytes << " bytes in " << total_samples
+     << " sampled allocations\n";
+  for (const auto& call_site : heap) {
+    ss << "\n"
+       << call_site.estimated_bytes << " bytes in " << call_site.num_samples
+       << " sampled allocations from:\n";
+    if (call_site.stack.empty()) {
+      ss << "    (unknown)\n";
+      continue;
+    }
+#ifdef ARROW_WITH_BACKTRACE
+    char** symbols = backtrace_symbols(call_site.stack.data(),
+                                       static_cast<int>(call_site.stack.size()));
+    if (symbols != nullptr) {
+      for (size_t i = 0; i < call_site.stack.size(); ++i) {
+        ss << "    " << symbols[i] << "\n";
+      }
+      free(symbols);
+      continue;
+    }
+#endif
+    for (void* address : call_site.stack) {
+      ss << "    " << address << "\n";
+    }
+  }
+  return ss.str();
+}
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
@@ -21,9 +21,11 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,12 +37,34 @@ namespace internal {
 
 class MemoryPoolStats {
  public:
+  /// The number of allocation size classes: class 0 holds empty allocations,
+  /// class i > 0 allocations of [2^(i-1), 2^i) bytes.
+  static constexpr int kNumSizeClasses = 64;
+
   MemoryPoolStats() : bytes_allocated_(0), max_memory_(0) {}
 
   int64_t max_memory() const { return max_memory_.load(); }
 
   int64_t bytes_allocated() const { return bytes_allocated_.load(); }
 
+  int64_t total_bytes_allocated() const { return total_bytes_allocated_.load(); }
+
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+  int64_t num_reallocations() const { return num_reallocations_.load(); }
+
+  std::vector<int64_t> allocation_size_histogram() const {
+    std::vector<int64_t> histogram(kNumSizeClasses);
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      histogram[i] = size_class_counts_[i].load(std::memory_order_relaxed);
+    }
+    return histogram;
+  }
+
+  static int SizeClass(int64_t size) {
+    return size > 0 ? BitUtil::NumRequiredBits(static_cast<uint64_t>(size)) : 0;
+  }
+
   inline void UpdateAllocatedBytes(int64_t diff) {
     auto allocated = bytes_allocated_.fetch_add(diff) + diff;
     // "maximum" allocated memory is ill-defined in multi-threaded code,
@@ -50,9 +74,31 @@ class MemoryPoolStats {
     }
   }
 
+  inline void DidAllocateBytes(int64_t size) {
+    UpdateAllocatedBytes(size);
+    total_bytes_allocated_.fetch_add(size, std::memory_order_relaxed);
+    num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    size_class_counts_[SizeClass(size)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Growing reallocations count their growth in total_bytes_allocated().
+  inline void DidReallocateBytes(int64_t old_size, int64_t new_size) {
+    UpdateAllocatedBytes(new_size - old_size);
+    if (new_size > old_size) {
+      total_bytes_allocated_.fetch_add(new_size - old_size, std::memory_order_relaxed);
+    }
+    num_reallocations_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  inline void DidFreeBytes(int64_t size) { UpdateAllocatedBytes(-size); }
+
  protected:
   std::atomic<int64_t> bytes_allocated_;
   std::atomic<int64_t> max_memory_;
+  std::atomic<int64_t> total_bytes_allocated_{0};
+  std::atomic<int64_t> num_allocations_{0};
+  std::atomic<int64_t> num_reallocations_{0};
+  std::atomic<int64_t> size_class_counts_[kNumSizeClasses] = {};
 };
 
 }  // namespace internal
@@ -97,6 +143,29 @@ class ARROW_EXPORT MemoryPool {
   /// returns -1
   virtual int64_t max_memory() const;
 
+  /// \brief The number of bytes allocated since the pool was created,
+  /// including freed bytes.  Growing reallocations count their growth.
+  ///
+  /// \return -1 if not known (or not implemented)
+  virtual int64_t total_bytes_allocated() const;
+
+  /// \brief The number of allocations since the pool was created.
+  ///
+  /// \return -1 if not known (or not implemented)
+  virtual int64_t num_allocations() const;
+
+  /// \brief The number of reallocations since the pool was created.
+  ///
+  /// \return -1 if not known (or not implemented)
+  virtual int64_t num_reallocations() const;
+
+  /// \brief The number of allocations since the pool was created, by size
+  /// class.
+  ///
+  /// Element 0 counts empty allocations, element i > 0 allocations of
+  /// [2^(i-1), 2^i) bytes.  Empty if not known (or not implemented).
+  virtual std::vector<int64_t> allocation_size_histogram() const;
+
   /// The name of the backend used by this MemoryPool (e.g. "system" or "jemalloc").
   virtual std::string backend_name() const = 0;
 
@@ -118,6 +187,11 @@ class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
 
   int64_t max_memory() const override;
 
+  int64_t total_bytes_allocated() const override;
+  int64_t num_allocations() const override;
+  int64_t num_reallocations() const override;
+  std::vector<int64_t> allocation_size_histogram() const override;
+
   std::string backend_name() const override;
 
  private:
@@ -142,6 +216,11 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
 
   int64_t max_memory() const override;
 
+  int64_t total_bytes_allocated() const override;
+  int64_t num_allocations() const override;
+  int64_t num_reallocations() const override;
+  std::vector<int64_t> allocation_size_histogram() const override;
+
   std::string backend_name() const override;
 
  private:
@@ -149,6 +228,200 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// A MemoryPool accounting for the memory of a unit of work, e.g. a query,
+/// against an optional limit.
+///
+/// Trackers form a hierarchy: the memory consumed by a tracker (the larger of
+/// its allocated and reserved bytes) is also consumed by all its ancestors, and
+/// must fit in all their limits.  Allocations going over a limit fail with
+/// Status::OutOfMemory, before reaching the underlying pool.
+///
+/// A tracker is cheap: allocations update an atomic counter per ancestor.  Make a
+/// child per query (e.g. as ExecContext or ScanOptions::pool) under a root
+/// tracker bounding the process.
+class ARROW_EXPORT TrackingMemoryPool
+    : public MemoryPool,
+      public std::enable_shared_from_this<TrackingMemoryPool> {
+ public:
+  /// \brief Make a root tracker allocating from `pool`.
+  ///
+  /// \param[in] pool the pool to allocate from
+  /// \param[in] limit the maximum number of bytes consumed, or -1 for no limit
+  /// \param[in] name a name to report in errors
+  static std::shared_ptr<TrackingMemoryPool> Make(MemoryPool* pool, int64_t limit = -1,
+                                                  std::string name = "");
+
+  ~TrackingMemoryPool() override;
+
+  /// \brief Make a child tracker, whose consumption is also accounted for by
+  /// this tracker.
+  ///
+  /// The child keeps this tracker alive.
+  std::shared_ptr<TrackingMemoryPool> MakeChild(int64_t limit = -1,
+                                                std::string name = "");
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes allocated through this tracker, not its children.
+  int64_t bytes_allocated() const override;
+
+  /// The peak of bytes_allocated().
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief Reserve memory ahead of allocations.
+  ///
+  /// The reservation counts against the limits of this tracker and its ancestors
+  /// immediately, so that allocations up to the reserved size can't fail
+  /// because of a limit.  Fails with Status::OutOfMemory if the limits don't
+  /// allow the reservation.
+  Status Reserve(int64_t bytes);
+
+  /// \brief Give back reserved bytes.
+  void Release(int64_t bytes);
+
+  /// The number of bytes reserved by this tracker.
+  int64_t bytes_reserved() const;
+
+  /// The number of bytes consumed by this tracker and its children: the larger
+  /// of the allocated and reserved bytes of each.
+  int64_t consumption() const;
+
+  /// The peak of consumption(): the high-water mark of the tracker.
+  int64_t max_consumption() const;
+
+  /// The maximum consumption, or -1 for no limit.
+  int64_t limit() const;
+
+  const std::string& name() const;
+
+  /// The parent tracker, or null for a root tracker.
+  TrackingMemoryPool* parent() const;
+
+ private:
+  class TrackingMemoryPoolImpl;
+  explicit TrackingMemoryPool(std::unique_ptr<TrackingMemoryPoolImpl> impl);
+
+  std::unique_ptr<TrackingMemoryPoolImpl> impl_;
+};
+
+/// A MemoryPool recycling freed buffers for later allocations of the same size
+/// class.
+///
+/// Kernels processing a stream of batches allocate and free buffers of about the
+/// same sizes for every batch.  This pool rounds small allocations up to a power
+/// of two and keeps freed buffers in per-size caches, so that the next batch gets
+/// them back without a trip to the underlying allocator.  Caches are sharded by
+/// thread to avoid contention, and a thread finding its shard empty takes from
+/// the others before allocating.
+///
+/// Make one per ExecContext or scan: cached buffers are given back to the
+/// underlying pool in bulk by ReleaseUnused() or when the pool is destroyed.  The
+/// pool must outlive the buffers allocated from it.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  /// \brief Make a recycling pool allocating from `pool`.
+  ///
+  /// \param[in] pool the pool to allocate from
+  /// \param[in] max_size the largest allocation to recycle; larger allocations go
+  /// directly to `pool`
+  /// \param[in] max_cached_bytes the maximum number of bytes kept in caches
+  static std::unique_ptr<RecyclingMemoryPool> Make(MemoryPool* pool,
+                                                   int64_t max_size = 1 << 20,
+                                                   int64_t max_cached_bytes = 64 << 20);
+
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes allocated and not yet freed, not counting the caches.
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+  int64_t num_allocations() const override;
+  int64_t num_reallocations() const override;
+  std::vector<int64_t> allocation_size_histogram() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes held in caches.
+  int64_t bytes_cached() const;
+
+  /// \brief Give all cached buffers back to the underlying pool.
+  void ReleaseUnused();
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  explicit RecyclingMemoryPool(std::unique_ptr<RecyclingMemoryPoolImpl> impl);
+
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// A MemoryPool sampling the allocations of another pool with their call
+/// stacks, to find which code holds or churns memory.
+///
+/// An allocation is sampled about every `sample_interval` allocated bytes, and
+/// remembered until it is freed.  LiveHeap() estimates the memory held by each
+/// call stack from the live samples, and LiveHeapDump() renders it.  Only
+/// sampled allocations take a lock, but frees look up a table of samples while
+/// any is live: use it for diagnosis rather than as a default pool.
+///
+/// Call stacks are only captured when Arrow is built with ARROW_WITH_BACKTRACE.
+class ARROW_EXPORT HeapProfilingMemoryPool : public MemoryPool {
+ public:
+  /// The memory held by allocations from a call stack.
+  struct CallSite {
+    /// Return addresses, innermost first
+    std::vector<void*> stack;
+    /// The number of live sampled allocations
+    int64_t num_samples = 0;
+    /// The estimated number of bytes held
+    int64_t estimated_bytes = 0;
+  };
+
+  /// \param[in] pool the pool to allocate from
+  /// \param[in] sample_interval the number of allocated bytes between samples
+  explicit HeapProfilingMemoryPool(MemoryPool* pool,
+                                   int64_t sample_interval = 512 * 1024);
+  ~HeapProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+  int64_t num_allocations() const override;
+  int64_t num_reallocations() const override;
+  std::vector<int64_t> allocation_size_histogram() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The call sites of the live sampled allocations, largest first.
+  std::vector<CallSite> LiveHeap() const;
+
+  /// \brief A human-readable rendering of LiveHeap(), with symbolized stacks
+  /// where possible.
+  std::string LiveHeapDump() const;
+
+ private:
+  class HeapProfilingMemoryPoolImpl;
+  std::unique_ptr<HeapProfilingMemoryPoolImpl> impl_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -168,6 +441,19 @@ ARROW_EXPORT Status jemalloc_memory_pool(MemoryPool** out);
 ARROW_EXPORT
 Status jemalloc_set_decay_ms(int ms);
 
+/// \brief Create a new jemalloc arena and return its index in `out`.
+///
+/// Together with jemalloc_set_thread_arena(), this keeps the allocations of a
+/// group of threads (e.g. the workers pinned to a NUMA node) apart from those of
+/// other threads, so that the memory they reuse stays local to them.
+ARROW_EXPORT
+Status jemalloc_create_arena(unsigned* out);
+
+/// \brief Make the jemalloc allocations of the calling thread come from the
+/// given arena, as returned by jemalloc_create_arena().
+ARROW_EXPORT
+Status jemalloc_set_thread_arena(unsigned arena);
+
 /// \brief Return a process-wide memory pool based on mimalloc.
 ///
 /// May return NotImplemented if mimalloc is not available.
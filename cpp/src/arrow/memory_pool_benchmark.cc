@@ -27,6 +27,14 @@ struct SystemAlloc {
   static Result<MemoryPool*> GetAllocator() { return system_memory_pool(); }
 };
 
+// The system allocator behind a heap profiler sampling with its default interval
+struct HeapProfiledSystemAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static HeapProfilingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
 #ifdef ARROW_JEMALLOC
 struct Jemalloc {
   static Result<MemoryPool*> GetAllocator() {
@@ -115,6 +123,7 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
+BENCHMARK_ALLOCATE(AllocateDeallocate, HeapProfiledSystemAlloc);
 
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
@@ -17,6 +17,10 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -73,7 +77,10 @@ TYPED_TEST_P(TestMemoryPool, OOM) {
 
 TYPED_TEST_P(TestMemoryPool, Reallocate) { this->TestReallocate(); }
 
-REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
+TYPED_TEST_P(TestMemoryPool, Statistics) { this->TestStatistics(); }
+
+REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate,
+                            Statistics);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
@@ -162,6 +169,232 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(HeapProfilingMemoryPool, LiveHeap) {
+  auto pool = MemoryPool::CreateDefault();
+  // Sample every allocation
+  HeapProfilingMemoryPool hp(pool.get(), /*sample_interval=*/1);
+
+  uint8_t *data, *data2, *data3;
+  ASSERT_OK(hp.Allocate(100, &data));
+  ASSERT_OK(hp.Allocate(300, &data2));
+  ASSERT_OK(hp.Allocate(0, &data3));
+  ASSERT_EQ(400, hp.bytes_allocated());
+  ASSERT_EQ(400, pool->bytes_allocated());
+  ASSERT_EQ(3, hp.num_allocations());
+
+  auto heap = hp.LiveHeap();
+  int64_t num_samples = 0, estimated_bytes = 0;
+  for (const auto& call_site : heap) {
+    num_samples += call_site.num_samples;
+    estimated_bytes += call_site.estimated_bytes;
+  }
+  // Empty allocations aren't sampled
+  ASSERT_EQ(2, num_samples);
+  ASSERT_EQ(400, estimated_bytes);
+  ASSERT_GE(heap[0].estimated_bytes, heap.back().estimated_bytes);
+
+  // Samples follow reallocations until freed
+  ASSERT_OK(hp.Reallocate(100, 1000, &data));
+  heap = hp.LiveHeap();
+  estimated_bytes = 0;
+  for (const auto& call_site : heap) {
+    estimated_bytes += call_site.estimated_bytes;
+  }
+  ASSERT_EQ(1300, estimated_bytes);
+
+  auto dump = hp.LiveHeapDump();
+  ASSERT_NE(dump.find("about 1300 bytes in 2 sampled allocations"), std::string::npos)
+      << dump;
+
+  hp.Free(data, 1000);
+  hp.Free(data2, 300);
+  hp.Free(data3, 0);
+  ASSERT_EQ(0, hp.LiveHeap().size());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(HeapProfilingMemoryPool, Sampling) {
+  auto pool = MemoryPool::CreateDefault();
+  HeapProfilingMemoryPool hp(pool.get(), /*sample_interval=*/1000);
+
+  std::vector<uint8_t*> buffers(100);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(hp.Allocate(100, &buffer));
+  }
+  int64_t num_samples = 0, estimated_bytes = 0;
+  for (const auto& call_site : hp.LiveHeap()) {
+    num_samples += call_site.num_samples;
+    estimated_bytes += call_site.estimated_bytes;
+  }
+  ASSERT_EQ(10, num_samples);
+  ASSERT_EQ(10000, estimated_bytes);
+  for (auto buffer : buffers) {
+    hp.Free(buffer, 100);
+  }
+  ASSERT_EQ(0, hp.LiveHeap().size());
+}
+
+TEST(TrackingMemoryPool, Hierarchy) {
+  auto pool = MemoryPool::CreateDefault();
+  auto root = TrackingMemoryPool::Make(pool.get(), /*limit=*/1000, "process");
+  auto query1 = root->MakeChild(/*limit=*/600, "query1");
+  auto query2 = root->MakeChild(/*limit=*/-1, "query2");
+  ASSERT_EQ(root.get(), query1->parent());
+  ASSERT_EQ(nullptr, root->parent());
+
+  uint8_t* data1;
+  ASSERT_OK(query1->Allocate(500, &data1));
+  ASSERT_EQ(500, query1->bytes_allocated());
+  ASSERT_EQ(500, query1->consumption());
+  ASSERT_EQ(0, root->bytes_allocated());
+  ASSERT_EQ(500, root->consumption());
+  ASSERT_EQ(500, pool->bytes_allocated());
+
+  // Over the child's limit
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, query1->Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, query1->Reallocate(500, 700, &data1));
+  ASSERT_EQ(500, root->consumption());
+  ASSERT_EQ(500, pool->bytes_allocated());
+
+  // Over the parent's limit
+  ASSERT_OK(query2->Allocate(400, &data2));
+  uint8_t* data3;
+  ASSERT_RAISES(OutOfMemory, query2->Allocate(200, &data3));
+  ASSERT_EQ(900, root->consumption());
+
+  ASSERT_OK(query1->Reallocate(500, 100, &data1));
+  ASSERT_EQ(500, root->consumption());
+  ASSERT_OK(query2->Allocate(200, &data3));
+  ASSERT_EQ(700, root->consumption());
+
+  query1->Free(data1, 100);
+  query2->Free(data2, 400);
+  query2->Free(data3, 200);
+  ASSERT_EQ(0, root->consumption());
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  // High-water marks
+  ASSERT_EQ(500, query1->max_memory());
+  ASSERT_EQ(500, query1->max_consumption());
+  ASSERT_EQ(600, query2->max_memory());
+  ASSERT_EQ(900, root->max_consumption());
+}
+
+TEST(TrackingMemoryPool, Reservation) {
+  auto pool = MemoryPool::CreateDefault();
+  auto root = TrackingMemoryPool::Make(pool.get(), /*limit=*/1000);
+  auto query1 = root->MakeChild();
+  auto query2 = root->MakeChild();
+
+  ASSERT_OK(query1->Reserve(800));
+  ASSERT_EQ(800, query1->bytes_reserved());
+  ASSERT_EQ(800, root->consumption());
+  ASSERT_RAISES(OutOfMemory, query2->Reserve(300));
+  ASSERT_RAISES(Invalid, query2->Reserve(-1));
+
+  // Allocations within the reservation don't consume more
+  uint8_t* data1;
+  ASSERT_OK(query1->Allocate(600, &data1));
+  ASSERT_EQ(800, root->consumption());
+  uint8_t* data2;
+  ASSERT_OK(query2->Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, query2->Allocate(1, &data2));
+
+  // Releasing the reservation gives back what isn't allocated
+  query1->Release(800);
+  ASSERT_EQ(0, query1->bytes_reserved());
+  ASSERT_EQ(800, root->consumption());
+  query1->Free(data1, 600);
+  ASSERT_EQ(200, root->consumption());
+  query2->Free(data2, 200);
+
+  // Destroying a child gives back its reservation
+  ASSERT_OK(query2->Reserve(500));
+  ASSERT_EQ(500, root->consumption());
+  query2.reset();
+  ASSERT_EQ(0, root->consumption());
+}
+
+TEST(RecyclingMemoryPool, Recycling) {
+  auto pool = MemoryPool::CreateDefault();
+  auto recycling = RecyclingMemoryPool::Make(pool.get(), /*max_size=*/4096,
+                                             /*max_cached_bytes=*/4096);
+
+  uint8_t* data1;
+  ASSERT_OK(recycling->Allocate(100, &data1));
+  ASSERT_EQ(100, recycling->bytes_allocated());
+  ASSERT_EQ(128, pool->bytes_allocated());
+
+  // A freed buffer serves the next allocation of the same size class
+  recycling->Free(data1, 100);
+  ASSERT_EQ(0, recycling->bytes_allocated());
+  ASSERT_EQ(128, recycling->bytes_cached());
+  uint8_t* data2;
+  ASSERT_OK(recycling->Allocate(120, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(0, recycling->bytes_cached());
+  ASSERT_EQ(128, pool->bytes_allocated());
+
+  // Growing within the size class keeps the buffer, otherwise it's copied
+  data2[0] = 42;
+  ASSERT_OK(recycling->Reallocate(120, 128, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_OK(recycling->Reallocate(128, 1000, &data2));
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(1000, recycling->bytes_allocated());
+  ASSERT_EQ(128, recycling->bytes_cached());
+
+  // Large allocations aren't recycled
+  uint8_t* data3;
+  ASSERT_OK(recycling->Allocate(10000, &data3));
+  recycling->Free(data3, 10000);
+  ASSERT_EQ(128, recycling->bytes_cached());
+
+  // Nor what doesn't fit in the cache
+  uint8_t* data4;
+  ASSERT_OK(recycling->Allocate(4000, &data4));
+  recycling->Free(data2, 1000);
+  recycling->Free(data4, 4000);
+  ASSERT_EQ(128 + 1024, recycling->bytes_cached());
+  ASSERT_EQ(128 + 1024, pool->bytes_allocated());
+
+  recycling->ReleaseUnused();
+  ASSERT_EQ(0, recycling->bytes_cached());
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  // Destroying the pool releases its cache
+  ASSERT_OK(recycling->Allocate(64, &data1));
+  recycling->Free(data1, 64);
+  recycling.reset();
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Threads) {
+  auto pool = MemoryPool::CreateDefault();
+  auto recycling = RecyclingMemoryPool::Make(pool.get());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&recycling, i] {
+      for (int j = 0; j < 1000; ++j) {
+        const int64_t size = 64 << ((i + j) % 8);
+        uint8_t* data;
+        ASSERT_OK(recycling->Allocate(size, &data));
+        std::memset(data, i, static_cast<size_t>(size));
+        recycling->Free(data, size);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, recycling->bytes_allocated());
+  ASSERT_EQ(recycling->bytes_cached(), pool->bytes_allocated());
+  recycling->ReleaseUnused();
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
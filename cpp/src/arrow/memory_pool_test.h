@@ -87,6 +87,32 @@ class TestMemoryPoolBase : public ::testing::Test {
     pool->Free(data, 5);
     ASSERT_EQ(0, pool->bytes_allocated());
   }
+
+  void TestStatistics() {
+    auto pool = memory_pool();
+    // The pool may be shared with other tests, so only check differences
+    const int64_t total_bytes = pool->total_bytes_allocated();
+    const int64_t num_allocations = pool->num_allocations();
+    const int64_t num_reallocations = pool->num_reallocations();
+    auto histogram = pool->allocation_size_histogram();
+    ASSERT_EQ(histogram.size(), 64);
+
+    uint8_t *data, *data2;
+    ASSERT_OK(pool->Allocate(100, &data));
+    ASSERT_OK(pool->Allocate(128, &data2));
+    ASSERT_OK(pool->Reallocate(100, 200, &data));
+    ASSERT_OK(pool->Reallocate(200, 50, &data));
+    pool->Free(data, 50);
+    pool->Free(data2, 128);
+
+    ASSERT_EQ(total_bytes + 328, pool->total_bytes_allocated());
+    ASSERT_EQ(num_allocations + 2, pool->num_allocations());
+    ASSERT_EQ(num_reallocations + 2, pool->num_reallocations());
+    // 100 bytes are in [64, 128), 128 bytes in [128, 256)
+    histogram[7] += 1;
+    histogram[8] += 1;
+    ASSERT_EQ(histogram, pool->allocation_size_histogram());
+  }
 };
 
 }  // namespace arrow
@@ -36,7 +36,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
-#include "arrow/util/int_util_internal.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/string.h"
 #include "arrow/vendored/datetime.h"
@@ -145,11 +145,18 @@ class ArrayPrinter : public PrettyPrinter {
     return Status::OK();
   }
 
+  // Format integers without going through the ostream numeric facets
   template <typename T>
-  enable_if_integer<typename T::TypeClass, Status> WriteDataValues(const T& array) {
+  enable_if_t<is_integer_type<typename T::TypeClass>::value ||
+                  is_duration_type<typename T::TypeClass>::value,
+              Status>
+  WriteDataValues(const T& array) {
     const auto data = array.raw_values();
-    // Need to upcast integers to avoid selecting operator<<(char)
-    WriteValues(array, [&](int64_t i) { (*sink_) << internal::UpcastInt(data[i]); });
+    internal::StringFormatter<typename T::TypeClass> formatter(array.type());
+    auto append = [&](util::string_view v) {
+      sink_->write(v.data(), static_cast<std::streamsize>(v.size()));
+    };
+    WriteValues(array, [&](int64_t i) { formatter(data[i], append); });
     return Status::OK();
   }
 
@@ -188,13 +195,6 @@ class ArrayPrinter : public PrettyPrinter {
     return Status::OK();
   }
 
-  template <typename T>
-  enable_if_duration<typename T::TypeClass, Status> WriteDataValues(const T& array) {
-    const auto data = array.raw_values();
-    WriteValues(array, [&](int64_t i) { (*sink_) << data[i]; });
-    return Status::OK();
-  }
-
   Status WriteDataValues(const DayTimeIntervalArray& array) {
     WriteValues(array, [&](int64_t i) {
       auto day_millis = array.GetValue(i);
@@ -215,6 +215,11 @@ class ArrayPrinter : public PrettyPrinter {
     return Status::OK();
   }
 
+  Status WriteDataValues(const StringViewArray& array) {
+    WriteValues(array, [&](int64_t i) { (*sink_) << "\"" << array.GetView(i) << "\""; });
+    return Status::OK();
+  }
+
   // Binary
   template <typename T>
   enable_if_binary_like<typename T::TypeClass, Status> WriteDataValues(const T& array) {
@@ -303,6 +308,7 @@ class ArrayPrinter : public PrettyPrinter {
                   std::is_base_of<FixedSizeBinaryArray, T>::value ||
                   std::is_base_of<BinaryArray, T>::value ||
                   std::is_base_of<LargeBinaryArray, T>::value ||
+                  std::is_base_of<StringViewArray, T>::value ||
                   std::is_base_of<ListArray, T>::value ||
                   std::is_base_of<LargeListArray, T>::value ||
                   std::is_base_of<MapArray, T>::value ||
@@ -385,6 +391,22 @@ class ArrayPrinter : public PrettyPrinter {
     return PrettyPrint(*array.indices(), indent_ + options_.indent_size, sink_);
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // Only print the runs overlapping the array
+    const int64_t physical_offset = array.FindPhysicalOffset();
+    const int64_t physical_length = array.FindPhysicalLength();
+
+    Newline();
+    Write("-- run_ends:\n");
+    RETURN_NOT_OK(PrettyPrint(*array.run_ends()->Slice(physical_offset, physical_length),
+                              indent_ + options_.indent_size, sink_));
+
+    Newline();
+    Write("-- values:\n");
+    return PrettyPrint(*array.values()->Slice(physical_offset, physical_length),
+                       indent_ + options_.indent_size, sink_);
+  }
+
   Status Print(const Array& array) {
     RETURN_NOT_OK(VisitArrayInline(array, this));
     Flush();
@@ -98,6 +98,10 @@ struct ArrayCapsule {
   std::shared_ptr<Array> array;
 };
 
+struct ChunkedArrayCapsule {
+  std::shared_ptr<ChunkedArray> array;
+};
+
 struct BufferCapsule {
   std::shared_ptr<Buffer> buffer;
 };
@@ -106,6 +110,11 @@ void ArrayCapsule_Destructor(PyObject* capsule) {
   delete reinterpret_cast<ArrayCapsule*>(PyCapsule_GetPointer(capsule, "arrow::Array"));
 }
 
+void ChunkedArrayCapsule_Destructor(PyObject* capsule) {
+  delete reinterpret_cast<ChunkedArrayCapsule*>(
+      PyCapsule_GetPointer(capsule, "arrow::ChunkedArray"));
+}
+
 void BufferCapsule_Destructor(PyObject* capsule) {
   delete reinterpret_cast<BufferCapsule*>(PyCapsule_GetPointer(capsule, "arrow::Buffer"));
 }
@@ -207,6 +216,17 @@ Status CapsulizeArray(const std::shared_ptr<Array>& arr, PyObject** out) {
   return Status::OK();
 }
 
+Status CapsulizeChunkedArray(const std::shared_ptr<ChunkedArray>& arr, PyObject** out) {
+  auto capsule = new ChunkedArrayCapsule{{arr}};
+  *out = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow::ChunkedArray",
+                       &ChunkedArrayCapsule_Destructor);
+  if (*out == nullptr) {
+    delete capsule;
+    RETURN_IF_PYERROR();
+  }
+  return Status::OK();
+}
+
 Status CapsulizeBuffer(const std::shared_ptr<Buffer>& buffer, PyObject** out) {
   auto capsule = new BufferCapsule{{buffer}};
   *out = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow::Buffer",
@@ -283,36 +303,87 @@ inline const T* GetPrimitiveValues(const Array& arr) {
   return reinterpret_cast<const T*>(prim_arr.values()->data() + arr.offset() * elsize);
 }
 
-Status MakeNumPyView(std::shared_ptr<Array> arr, PyObject* py_ref, int npy_type, int ndim,
-                     npy_intp* dims, PyObject** out) {
-  PyAcquireGIL lock;
+// Return whether the values of the chunks of a fixed-width ChunkedArray
+// directly follow each other in memory, so that they can be viewed as a single
+// array. This is the case of e.g. the columns of a table built from slices of
+// the same record batch. Empty chunks are ignored.
+bool HasContiguousValues(const ChunkedArray& data) {
+  const int elsize = GetByteWidth(*data.type());
+  const uint8_t* next_values = nullptr;
+  for (const auto& chunk : data.chunks()) {
+    if (chunk->length() == 0) {
+      continue;
+    }
+    const uint8_t* values = GetPrimitiveValues<uint8_t>(*chunk);
+    if (next_values != nullptr && values != next_values) {
+      return false;
+    }
+    next_values = values + chunk->length() * elsize;
+  }
+  return true;
+}
 
+Status MakeNumPyView(const DataType& type, const void* values, PyObject* base,
+                     int npy_type, int ndim, npy_intp* dims, PyObject** out) {
   PyArray_Descr* descr = internal::GetSafeNumPyDtype(npy_type);
-  set_numpy_metadata(npy_type, arr->type().get(), descr);
-  PyObject* result = PyArray_NewFromDescr(
-      &PyArray_Type, descr, ndim, dims, /*strides=*/nullptr,
-      const_cast<void*>(GetPrimitiveValues(*arr)), /*flags=*/0, nullptr);
+  set_numpy_metadata(npy_type, &type, descr);
+  PyObject* result =
+      PyArray_NewFromDescr(&PyArray_Type, descr, ndim, dims, /*strides=*/nullptr,
+                           const_cast<void*>(values), /*flags=*/0, nullptr);
   PyArrayObject* np_arr = reinterpret_cast<PyArrayObject*>(result);
   if (np_arr == nullptr) {
     // Error occurred, trust that error set
+    Py_DECREF(base);
     return Status::OK();
   }
+  RETURN_NOT_OK(SetNdarrayBase(np_arr, base));
+
+  // Do not allow Arrow data to be mutated
+  PyArray_CLEARFLAGS(np_arr, NPY_ARRAY_WRITEABLE);
+  *out = result;
+  return Status::OK();
+}
+
+// View the values of a non-null ChunkedArray whose chunks are contiguous (see
+// HasContiguousValues)
+Status MakeNumPyView(std::shared_ptr<ChunkedArray> data, PyObject* py_ref, int npy_type,
+                     int ndim, npy_intp* dims, PyObject** out) {
+  const void* values = nullptr;
+  for (const auto& chunk : data->chunks()) {
+    if (chunk->length() > 0) {
+      values = GetPrimitiveValues(*chunk);
+      break;
+    }
+  }
+  PyAcquireGIL lock;
 
   PyObject* base;
   if (py_ref == nullptr) {
     // Capsule will be owned by the ndarray, no incref necessary. See
     // ARROW-1973
-    RETURN_NOT_OK(CapsulizeArray(arr, &base));
+    RETURN_NOT_OK(CapsulizeChunkedArray(data, &base));
   } else {
     Py_INCREF(py_ref);
     base = py_ref;
   }
-  RETURN_NOT_OK(SetNdarrayBase(np_arr, base));
+  return MakeNumPyView(*data->type(), values, base, npy_type, ndim, dims, out);
+}
 
-  // Do not allow Arrow data to be mutated
-  PyArray_CLEARFLAGS(np_arr, NPY_ARRAY_WRITEABLE);
-  *out = result;
-  return Status::OK();
+Status MakeNumPyView(std::shared_ptr<Array> arr, PyObject* py_ref, int npy_type, int ndim,
+                     npy_intp* dims, PyObject** out) {
+  PyAcquireGIL lock;
+
+  PyObject* base;
+  if (py_ref == nullptr) {
+    // Capsule will be owned by the ndarray, no incref necessary. See
+    // ARROW-1973
+    RETURN_NOT_OK(CapsulizeArray(arr, &base));
+  } else {
+    Py_INCREF(py_ref);
+    base = py_ref;
+  }
+  return MakeNumPyView(*arr->type(), GetPrimitiveValues(*arr), base, npy_type, ndim,
+                       dims, out);
 }
 
 class PandasWriter {
@@ -944,7 +1015,7 @@ class TypedPandasWriter : public PandasWriter {
       npy_intp dims[2] = {static_cast<npy_intp>(num_columns_),
                           static_cast<npy_intp>(num_rows_)};
       RETURN_NOT_OK(
-          MakeNumPyView(data->chunk(0), py_ref, NPY_TYPE, /*ndim=*/2, dims, &wrapped));
+          MakeNumPyView(std::move(data), py_ref, NPY_TYPE, /*ndim=*/2, dims, &wrapped));
       SetBlockData(wrapped);
       return Status::OK();
     } else {
@@ -1172,7 +1243,9 @@ struct ObjectWriterVisitor {
                   std::is_same<DurationType, Type>::value ||
                   std::is_same<ExtensionType, Type>::value ||
                   std::is_base_of<IntervalType, Type>::value ||
-                  std::is_base_of<UnionType, Type>::value,
+                  std::is_base_of<UnionType, Type>::value ||
+                  std::is_same<StringViewType, Type>::value ||
+                  std::is_same<RunEndEncodedType, Type>::value,
               Status>
   Visit(const Type& type) {
     return Status::NotImplemented("No implemented conversion to object dtype: ",
@@ -1192,7 +1265,10 @@ class ObjectWriter : public TypedPandasWriter<NPY_OBJECT> {
 };
 
 static inline bool IsNonNullContiguous(const ChunkedArray& data) {
-  return data.num_chunks() == 1 && data.null_count() == 0;
+  if (data.num_chunks() == 0 || data.null_count() != 0) {
+    return false;
+  }
+  return data.num_chunks() == 1 || HasContiguousValues(data);
 }
 
 template <int NPY_TYPE>
@@ -2146,24 +2222,30 @@ class SplitBlockCreator : public PandasBlockCreator {
   }
 
   Status Convert(PyObject** out) override {
+    // Write the columns (in parallel if use_threads is set), the writers only
+    // acquire the GIL when they need to create Python objects
+    writers_.resize(num_columns_);
+    auto WriteColumn = [this](int i) {
+      RETURN_NOT_OK(GetWriter(i, &writers_[i]));
+      // ARROW-3789 Use std::move on the array to permit self-destructing
+      return writers_[i]->Write(std::move(arrays_[i]), i, /*rel_placement=*/0);
+    };
+    RETURN_NOT_OK(OptionalParallelFor(options_.use_threads, num_columns_, WriteColumn));
+
     PyAcquireGIL lock;
 
     PyObject* result = PyList_New(0);
     RETURN_IF_PYERROR();
 
     for (int i = 0; i < num_columns_; ++i) {
-      std::shared_ptr<PandasWriter> writer;
-      RETURN_NOT_OK(GetWriter(i, &writer));
-      // ARROW-3789 Use std::move on the array to permit self-destructing
-      RETURN_NOT_OK(writer->Write(std::move(arrays_[i]), i, /*rel_placement=*/0));
-
       PyObject* item;
-      RETURN_NOT_OK(writer->GetDataFrameResult(&item));
+      RETURN_NOT_OK(writers_[i]->GetDataFrameResult(&item));
       if (PyList_Append(result, item) < 0) {
         RETURN_IF_PYERROR();
       }
       // PyList_Append increments object refcount
       Py_DECREF(item);
+      writers_[i].reset();
     }
 
     *out = result;
@@ -74,9 +74,10 @@ struct PandasOptions {
 
   /// \brief If true, create one block per column rather than consolidated
   /// blocks (1 per data type). Do zero-copy wrapping when there are no
-  /// nulls. pandas currently will consolidate the blocks on its own, causing
-  /// increased memory use, so keep this in mind if you are working on a
-  /// memory-constrained situation.
+  /// nulls and the chunks are contiguous in memory. The columns are converted
+  /// in parallel if use_threads is true. pandas currently will consolidate
+  /// the blocks on its own, causing increased memory use, so keep this in mind
+  /// if you are working on a memory-constrained situation.
   bool split_blocks = false;
 
   /// \brief If true, allow non-writable zero-copy views to be created for
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <signal.h>
+#include <algorithm>
 #include <utility>
 
 #include "arrow/flight/internal.h"
@@ -244,11 +245,48 @@ Status PyGeneratorFlightDataStream::GetSchemaPayload(FlightPayload* payload) {
 }
 
 Status PyGeneratorFlightDataStream::Next(FlightPayload* payload) {
-  return SafeCallIntoPython([=] {
-    const Status status = callback_(generator_.obj(), payload);
+  while (true) {
+    if (pending_index_ < pending_.size()) {
+      *payload = std::move(pending_[pending_index_++]);
+      return Status::OK();
+    }
+    RETURN_NOT_OK(pending_error_);
+    if (substream_) {
+      // Drained without the GIL
+      RETURN_NOT_OK(substream_->Next(payload));
+      if (payload->ipc_message.metadata != nullptr) {
+        return Status::OK();
+      }
+      substream_.reset();
+    }
+    RETURN_NOT_OK(PullFromGenerator());
+    if (pending_.empty() && !substream_ && pending_error_.ok()) {
+      // End of stream
+      payload->ipc_message.metadata.reset();
+      return Status::OK();
+    }
+  }
+}
+
+Status PyGeneratorFlightDataStream::PullFromGenerator() {
+  static constexpr int64_t kMaxPayloadsPerPull = 64;
+
+  pending_.clear();
+  pending_index_ = 0;
+  const Status status = SafeCallIntoPython([&] {
+    const Status st = callback_(generator_.obj(), max_payloads_, &pending_, &substream_);
     RETURN_NOT_OK(CheckPyError());
-    return status;
+    return st;
   });
+  max_payloads_ = std::min(max_payloads_ * 2, kMaxPayloadsPerPull);
+  if (!status.ok()) {
+    if (pending_.empty()) {
+      return status;
+    }
+    // Send the payloads obtained before the error first
+    pending_error_ = status;
+  }
+  return Status::OK();
 }
 
 // Flight Server Middleware
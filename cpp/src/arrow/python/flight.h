@@ -307,11 +307,21 @@ class ARROW_PYFLIGHT_EXPORT PyClientMiddleware : public arrow::flight::ClientMid
   Vtable vtable_;
 };
 
-/// \brief A callback that obtains the next payload from a Flight result stream.
-typedef std::function<Status(PyObject*, arrow::flight::FlightPayload*)>
+/// \brief A callback that obtains the next payloads from a Flight result stream.
+///
+/// It appends at most max_payloads payloads, stopping early when the Python
+/// generator hands over a nested stream, which it then moves into the last
+/// argument. Appending nothing and not setting a nested stream ends the stream.
+typedef std::function<Status(PyObject*, int64_t max_payloads,
+                             std::vector<arrow::flight::FlightPayload>*,
+                             std::unique_ptr<arrow::flight::FlightDataStream>*)>
     PyGeneratorFlightDataStreamCallback;
 
 /// \brief A FlightDataStream built around a Python callback.
+///
+/// To limit GIL contention, payloads are pulled from Python in batches, and
+/// nested streams (e.g. wrapping a RecordBatchReader or Table) are drained
+/// without holding the GIL.
 class ARROW_PYFLIGHT_EXPORT PyGeneratorFlightDataStream
     : public arrow::flight::FlightDataStream {
  public:
@@ -326,11 +336,24 @@ class ARROW_PYFLIGHT_EXPORT PyGeneratorFlightDataStream
   Status Next(arrow::flight::FlightPayload* payload) override;
 
  private:
+  /// \brief Refill pending_ from the generator, taking the GIL once.
+  Status PullFromGenerator();
+
   OwnedRefNoGIL generator_;
   std::shared_ptr<arrow::Schema> schema_;
   ipc::DictionaryFieldMapper mapper_;
   ipc::IpcWriteOptions options_;
   PyGeneratorFlightDataStreamCallback callback_;
+  // Payloads obtained from the generator; those from pending_index_ on are not sent yet
+  std::vector<arrow::flight::FlightPayload> pending_;
+  size_t pending_index_ = 0;
+  // How many payloads to ask for in the next pull, growing up to a cap so that short
+  // or slow generators are not made to buffer
+  int64_t max_payloads_ = 1;
+  // An error raised by the generator after the pending payloads
+  Status pending_error_;
+  // A nested stream obtained from the generator and being drained
+  std::unique_ptr<arrow::flight::FlightDataStream> substream_;
 };
 
 ARROW_PYFLIGHT_EXPORT
@@ -422,6 +422,9 @@ class PyConverter : public Converter<PyObject*, PyConversionOptions> {
 template <typename T, typename Enable = void>
 class PyPrimitiveConverter;
 
+template <typename T>
+class PyNumberConverter;
+
 template <typename T>
 class PyListConverter;
 
@@ -436,10 +439,16 @@ struct PyConverterTrait;
 template <typename T>
 struct PyConverterTrait<
     T, enable_if_t<!is_nested_type<T>::value && !is_interval_type<T>::value &&
-                   !is_extension_type<T>::value>> {
+                   !is_extension_type<T>::value && !is_number_type<T>::value &&
+                   !is_string_view_type<T>::value>> {
   using type = PyPrimitiveConverter<T>;
 };
 
+template <typename T>
+struct PyConverterTrait<T, enable_if_number<T>> {
+  using type = PyNumberConverter<T>;
+};
+
 template <typename T>
 struct PyConverterTrait<T, enable_if_list_like<T>> {
   using type = PyListConverter<T>;
@@ -514,6 +523,67 @@ class PyPrimitiveConverter<
   }
 };
 
+// Number sequences (including the values of lists and NumPy object arrays) are
+// converted in batches: the Python objects are converted to C values with the
+// GIL held, then the batch is appended to the builder at once, with the GIL
+// released for large batches.
+template <typename T>
+class PyNumberConverter : public PyPrimitiveConverter<T> {
+ public:
+  using c_type = typename T::c_type;
+
+  static constexpr int64_t kBatchSize = 1 << 16;
+
+  Status Extend(PyObject* values, int64_t size) override {
+    RETURN_NOT_OK(this->Reserve(size));
+    batch_values_.clear();
+    batch_valid_.clear();
+    const auto batch_size = static_cast<size_t>(std::min(size, kBatchSize));
+    batch_values_.reserve(batch_size);
+    batch_valid_.reserve(batch_size);
+    RETURN_NOT_OK(
+        internal::VisitSequence(values, [this](PyObject* item, bool* /* unused */) {
+          if (PyValue::IsNull(this->options_, item)) {
+            batch_values_.push_back(c_type{});
+            batch_valid_.push_back(0);
+          } else {
+            ARROW_ASSIGN_OR_RAISE(auto converted, PyValue::Convert(this->primitive_type_,
+                                                                   this->options_, item));
+            batch_values_.push_back(converted);
+            batch_valid_.push_back(1);
+          }
+          if (batch_values_.size() == static_cast<size_t>(kBatchSize)) {
+            return FlushBatch();
+          }
+          return Status::OK();
+        }));
+    return FlushBatch();
+  }
+
+ protected:
+  Status FlushBatch() {
+    const auto length = static_cast<int64_t>(batch_values_.size());
+    Status st;
+    if (length >= kBatchSize) {
+      PyReleaseGIL unlock;
+      st = this->primitive_builder_->AppendValues(batch_values_.data(), length,
+                                                  batch_valid_.data());
+    } else if (length > 0) {
+      st = this->primitive_builder_->AppendValues(batch_values_.data(), length,
+                                                  batch_valid_.data());
+    }
+    batch_values_.clear();
+    batch_valid_.clear();
+    return st;
+  }
+
+  std::vector<c_type> batch_values_;
+  std::vector<uint8_t> batch_valid_;
+};
+
+template <typename T>
+constexpr int64_t PyNumberConverter<T>::kBatchSize;
+
 template <typename T>
 class PyPrimitiveConverter<T, enable_if_binary<T>>
     : public PrimitiveConverter<T, PyConverter> {
@@ -29,6 +29,7 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/iterator.h"
@@ -51,36 +52,70 @@ std::shared_ptr<Array> RecordBatch::GetColumnByName(const std::string& name) con
 int RecordBatch::num_columns() const { return schema_->num_fields(); }
 
 /// \class SimpleRecordBatch
-/// \brief A basic, non-lazy in-memory record batch
+/// \brief A basic in-memory record batch
+///
+/// Slicing is lazy: a slice shares the column data of the batch it was sliced
+/// from, and each column is only sliced when first accessed.
 class SimpleRecordBatch : public RecordBatch {
  public:
   SimpleRecordBatch(std::shared_ptr<Schema> schema, int64_t num_rows,
                     std::vector<std::shared_ptr<Array>> columns)
       : RecordBatch(std::move(schema), num_rows), boxed_columns_(std::move(columns)) {
-    columns_.resize(boxed_columns_.size());
-    for (size_t i = 0; i < columns_.size(); ++i) {
-      columns_[i] = boxed_columns_[i]->data();
+    auto column_data = std::make_shared<ArrayDataVector>(boxed_columns_.size());
+    for (size_t i = 0; i < column_data->size(); ++i) {
+      (*column_data)[i] = boxed_columns_[i]->data();
     }
+    base_columns_ = std::move(column_data);
   }
 
   SimpleRecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows,
                     std::vector<std::shared_ptr<ArrayData>> columns)
-      : RecordBatch(std::move(schema), num_rows), columns_(std::move(columns)) {
+      : RecordBatch(std::move(schema), num_rows),
+        base_columns_(std::make_shared<const ArrayDataVector>(std::move(columns))) {
     boxed_columns_.resize(schema_->num_fields());
   }
 
+  // Construct a lazy slice of `base_columns`
+  SimpleRecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows,
+                    std::shared_ptr<const ArrayDataVector> base_columns, int64_t offset)
+      : RecordBatch(schema, num_rows),
+        base_columns_(std::move(base_columns)),
+        offset_(offset),
+        is_slice_(true),
+        sliced_columns_(base_columns_->size()),
+        boxed_columns_(base_columns_->size()) {}
+
   std::shared_ptr<Array> column(int i) const override {
     std::shared_ptr<Array> result = internal::atomic_load(&boxed_columns_[i]);
     if (!result) {
-      result = MakeArray(columns_[i]);
+      result = MakeArray(column_data(i));
       internal::atomic_store(&boxed_columns_[i], result);
     }
     return result;
   }
 
-  std::shared_ptr<ArrayData> column_data(int i) const override { return columns_[i]; }
+  std::shared_ptr<ArrayData> column_data(int i) const override {
+    if (!is_slice_) {
+      return (*base_columns_)[i];
+    }
+    std::shared_ptr<ArrayData> result = internal::atomic_load(&sliced_columns_[i]);
+    if (!result) {
+      result = (*base_columns_)[i]->Slice(offset_, num_rows_);
+      internal::atomic_store(&sliced_columns_[i], result);
+    }
+    return result;
+  }
 
-  ArrayDataVector column_data() const override { return columns_; }
+  ArrayDataVector column_data() const override {
+    if (!is_slice_) {
+      return *base_columns_;
+    }
+    ArrayDataVector result(base_columns_->size());
+    for (size_t i = 0; i < result.size(); ++i) {
+      result[i] = column_data(static_cast<int>(i));
+    }
+    return result;
+  }
 
   Result<std::shared_ptr<RecordBatch>> AddColumn(
       int i, const std::shared_ptr<Field>& field,
@@ -101,8 +136,9 @@ class SimpleRecordBatch : public RecordBatch {
 
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->AddField(i, field));
 
-    return RecordBatch::Make(new_schema, num_rows_,
-                             internal::AddVectorElement(columns_, i, column->data()));
+    return RecordBatch::Make(
+        new_schema, num_rows_,
+        internal::AddVectorElement(column_data(), i, column->data()));
   }
 
   Result<std::shared_ptr<RecordBatch>> SetColumn(
@@ -123,42 +159,51 @@ class SimpleRecordBatch : public RecordBatch {
     }
 
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->SetField(i, field));
-    return RecordBatch::Make(new_schema, num_rows_,
-                             internal::ReplaceVectorElement(columns_, i, column->data()));
+    return RecordBatch::Make(
+        new_schema, num_rows_,
+        internal::ReplaceVectorElement(column_data(), i, column->data()));
   }
 
   Result<std::shared_ptr<RecordBatch>> RemoveColumn(int i) const override {
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->RemoveField(i));
 
     return RecordBatch::Make(new_schema, num_rows_,
-                             internal::DeleteVectorElement(columns_, i));
+                             internal::DeleteVectorElement(column_data(), i));
   }
 
   std::shared_ptr<RecordBatch> ReplaceSchemaMetadata(
       const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
     auto new_schema = schema_->WithMetadata(metadata);
-    return RecordBatch::Make(new_schema, num_rows_, columns_);
+    if (is_slice_) {
+      return std::make_shared<SimpleRecordBatch>(std::move(new_schema), num_rows_,
+                                                 base_columns_, offset_);
+    }
+    return RecordBatch::Make(new_schema, num_rows_, *base_columns_);
   }
 
   std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override {
-    std::vector<std::shared_ptr<ArrayData>> arrays;
-    arrays.reserve(num_columns());
-    for (const auto& field : columns_) {
-      arrays.emplace_back(field->Slice(offset, length));
-    }
+    ARROW_CHECK_LE(offset, num_rows_) << "Slice offset greater than batch length";
     int64_t num_rows = std::min(num_rows_ - offset, length);
-    return std::make_shared<SimpleRecordBatch>(schema_, num_rows, std::move(arrays));
+    return std::make_shared<SimpleRecordBatch>(schema_, num_rows, base_columns_,
+                                               offset_ + offset);
   }
 
   Status Validate() const override {
-    if (static_cast<int>(columns_.size()) != schema_->num_fields()) {
+    if (static_cast<int>(base_columns_->size()) != schema_->num_fields()) {
       return Status::Invalid("Number of columns did not match schema");
     }
     return RecordBatch::Validate();
   }
 
  private:
-  std::vector<std::shared_ptr<ArrayData>> columns_;
+  // The column data this batch was sliced from, shared by all slices
+  std::shared_ptr<const ArrayDataVector> base_columns_;
+  // For a slice, the row offset into base_columns_
+  int64_t offset_ = 0;
+  bool is_slice_ = false;
+
+  // For a slice, caching the sliced column data
+  mutable std::vector<std::shared_ptr<ArrayData>> sliced_columns_;
 
   // Caching boxed array data
   mutable std::vector<std::shared_ptr<Array>> boxed_columns_;
@@ -207,6 +252,15 @@ Result<std::shared_ptr<StructArray>> RecordBatch::ToStructArray() const {
                                        /*offset=*/0);
 }
 
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(bool null_to_nan, bool row_major,
+                                                      MemoryPool* pool) const {
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_columns());
+  for (int i = 0; i < num_columns(); ++i) {
+    columns[i] = std::make_shared<ChunkedArray>(column(i));
+  }
+  return internal::ColumnsToTensor(columns, num_rows_, null_to_nan, row_major, pool);
+}
+
 std::vector<std::shared_ptr<Array>> RecordBatch::columns() const {
   std::vector<std::shared_ptr<Array>> children(num_columns());
   for (int i = 0; i < num_columns(); ++i) {
@@ -68,6 +68,21 @@ class ARROW_EXPORT RecordBatch {
   /// in the resulting struct array.
   Result<std::shared_ptr<StructArray>> ToStructArray() const;
 
+  /// \brief Convert the record batch to a two-dimensional Tensor
+  ///
+  /// The tensor has one row per batch row and one column per column.  All
+  /// columns must have a numeric type other than half-float; the tensor has the
+  /// columns' type when they all share it, and float64 otherwise.
+  ///
+  /// \param[in] null_to_nan if true, nulls are converted to NaN (and integer
+  /// columns with nulls to float64), otherwise nulls are an error
+  /// \param[in] row_major if true, create a row-major tensor, otherwise a
+  /// column-major one
+  /// \param[in] pool the memory pool to allocate the tensor from
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Construct record batch from struct array
   ///
   /// This constructs a record batch using the child arrays of the given
@@ -20,7 +20,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -30,6 +32,7 @@
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -133,6 +136,43 @@ TEST_F(TestRecordBatch, Slice) {
   ASSERT_EQ(batch_slice2->column(2)->data()->null_count, 0);
 }
 
+TEST_F(TestRecordBatch, SliceOfSlice) {
+  auto schema = ::arrow::schema({field("f0", int8()), field("f1", utf8())});
+  auto a0 = ArrayFromJSON(int8(), "[0, 1, 2, 3, 4, 5, 6]");
+  auto a1 = ArrayFromJSON(utf8(), R"(["a", "b", null, "d", "e", "f", "g"])");
+  auto batch = RecordBatch::Make(schema, 7, {a0, a1});
+
+  auto slice = batch->Slice(1, 5)->Slice(2, 10);
+  ASSERT_OK(slice->ValidateFull());
+  ASSERT_EQ(slice->num_rows(), 3);
+  AssertArraysEqual(*a0->Slice(3, 3), *slice->column(0));
+  AssertArraysEqual(*a1->Slice(3, 3), *slice->column(1));
+  ASSERT_EQ(slice->column_data(1)->offset, 3);
+  // Boxed columns are cached
+  ASSERT_EQ(slice->column(0), slice->column(0));
+
+  // Column edits and metadata replacement on a slice
+  auto a2 = ArrayFromJSON(int16(), "[7, 8, 9]");
+  ASSERT_OK_AND_ASSIGN(auto added, slice->AddColumn(2, field("f2", int16()), a2));
+  ASSERT_OK(added->ValidateFull());
+  AssertArraysEqual(*a2, *added->column(2));
+  AssertArraysEqual(*slice->column(1), *added->column(1));
+
+  ASSERT_OK_AND_ASSIGN(auto replaced, slice->SetColumn(0, field("f2", int16()), a2));
+  ASSERT_OK(replaced->ValidateFull());
+  AssertArraysEqual(*a2, *replaced->column(0));
+  AssertArraysEqual(*slice->column(1), *replaced->column(1));
+
+  ASSERT_OK_AND_ASSIGN(auto removed, slice->RemoveColumn(0));
+  ASSERT_OK(removed->ValidateFull());
+  ASSERT_EQ(removed->num_columns(), 1);
+  AssertArraysEqual(*slice->column(1), *removed->column(0));
+
+  auto with_metadata = slice->ReplaceSchemaMetadata(key_value_metadata({"k"}, {"v"}));
+  ASSERT_OK(with_metadata->ValidateFull());
+  ASSERT_TRUE(with_metadata->Equals(*slice));
+}
+
 TEST_F(TestRecordBatch, AddColumn) {
   const int length = 10;
 
@@ -289,4 +329,78 @@ TEST_F(TestRecordBatch, FromStructArrayInvalidNullCount) {
   ASSERT_RAISES(Invalid, RecordBatch::FromStructArray(struct_array));
 }
 
+TEST_F(TestRecordBatch, ToTensor) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", int32())});
+  auto batch = RecordBatchFromJSON(schema, R"([{"a": 1, "b": 4},
+                                               {"a": 2, "b": 5},
+                                               {"a": 3, "b": 6}])");
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  std::vector<int32_t> row_major_values = {1, 4, 2, 5, 3, 6};
+  Tensor row_major(int32(), Buffer::Wrap(row_major_values), {3, 2});
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_TRUE(tensor->Equals(row_major));
+
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(/*null_to_nan=*/false,
+                                               /*row_major=*/false));
+  std::vector<int32_t> column_major_values = {1, 2, 3, 4, 5, 6};
+  Tensor column_major(int32(), Buffer::Wrap(column_major_values), {3, 2}, {4, 12});
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_TRUE(tensor->Equals(column_major));
+}
+
+TEST_F(TestRecordBatch, ToTensorMixedTypes) {
+  auto schema = ::arrow::schema({field("a", int8()), field("b", float32())});
+  auto batch = RecordBatchFromJSON(schema, R"([{"a": 1, "b": 1.5},
+                                               {"a": -2, "b": 2.5}])");
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  std::vector<double> values = {1, 1.5, -2, 2.5};
+  Tensor expected(float64(), Buffer::Wrap(values), {2, 2});
+  ASSERT_TRUE(tensor->Equals(expected));
+}
+
+TEST_F(TestRecordBatch, ToTensorNullToNaN) {
+  auto schema = ::arrow::schema({field("a", int16()), field("b", float32())});
+  auto batch = RecordBatchFromJSON(schema, R"([{"a": 1, "b": null},
+                                               {"a": null, "b": 2.5}])");
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/true));
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> values = {1, nan, nan, 2.5};
+  Tensor expected(float64(), Buffer::Wrap(values), {2, 2});
+  ASSERT_TRUE(tensor->Equals(expected, EqualOptions::Defaults().nans_equal(true)));
+
+  // Float columns keep their type
+  batch = RecordBatchFromJSON(::arrow::schema({field("b", float32())}),
+                              R"([{"b": null}, {"b": 2.5}])");
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(/*null_to_nan=*/true));
+  ASSERT_EQ(Type::FLOAT, tensor->type_id());
+  ASSERT_TRUE(std::isnan(tensor->Value<FloatType>({0, 0})));
+  ASSERT_EQ(2.5, tensor->Value<FloatType>({1, 0}));
+}
+
+TEST_F(TestRecordBatch, ToTensorZeroCopy) {
+  auto array = ArrayFromJSON(int64(), "[0, 1, 2, 3, 4]")->Slice(1, 3);
+  auto batch = RecordBatch::Make(::arrow::schema({field("a", int64())}), 3, {array});
+
+  for (bool row_major : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(false, row_major));
+    ASSERT_EQ(reinterpret_cast<const uint8_t*>(array->data()->GetValues<int64_t>(1)),
+              tensor->raw_data());
+    std::vector<int64_t> values = {1, 2, 3};
+    ASSERT_TRUE(tensor->Equals(Tensor(int64(), Buffer::Wrap(values), {3, 1})));
+  }
+}
+
+TEST_F(TestRecordBatch, ToTensorUnsupported) {
+  auto batch =
+      RecordBatch::Make(::arrow::schema({}), 10, std::vector<std::shared_ptr<Array>>{});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+
+  batch = RecordBatchFromJSON(::arrow::schema({field("a", utf8())}), R"([{"a": "x"}])");
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+}
+
 }  // namespace arrow
@@ -95,6 +95,11 @@ struct ScalarHashImpl {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedScalar& s) {
+    AccumulateHashFrom(*s.value);
+    return Status::OK();
+  }
+
   // TODO(bkietz) implement less wimpy hashing when these have ValueType
   Status Visit(const UnionScalar& s) { return Status::OK(); }
   Status Visit(const ExtensionScalar& s) { return Status::OK(); }
@@ -153,6 +158,9 @@ StringScalar::StringScalar(std::string s)
 LargeStringScalar::LargeStringScalar(std::string s)
     : LargeStringScalar(Buffer::FromString(std::move(s))) {}
 
+StringViewScalar::StringViewScalar(std::string s)
+    : StringViewScalar(Buffer::FromString(std::move(s))) {}
+
 FixedSizeBinaryScalar::FixedSizeBinaryScalar(std::shared_ptr<Buffer> value,
                                              std::shared_ptr<DataType> type)
     : BinaryScalar(std::move(value), std::move(type)) {
@@ -276,6 +284,21 @@ Result<std::shared_ptr<Scalar>> DictionaryScalar::GetEncodedValue() const {
   return value.dictionary->GetScalar(index_value);
 }
 
+RunEndEncodedScalar::RunEndEncodedScalar(std::shared_ptr<Scalar> value,
+                                         std::shared_ptr<DataType> type)
+    : Scalar(std::move(type), value->is_valid), value(std::move(value)) {
+  ARROW_CHECK_EQ(this->type->id(), Type::RUN_END_ENCODED);
+}
+
+RunEndEncodedScalar::RunEndEncodedScalar(std::shared_ptr<DataType> type)
+    : RunEndEncodedScalar(
+          MakeNullScalar(checked_cast<const RunEndEncodedType&>(*type).value_type()),
+          type) {}
+
+const std::shared_ptr<DataType>& RunEndEncodedScalar::value_type() const {
+  return checked_cast<const RunEndEncodedType&>(*type).value_type();
+}
+
 std::shared_ptr<DictionaryScalar> DictionaryScalar::Make(std::shared_ptr<Scalar> index,
                                                          std::shared_ptr<Array> dict) {
   auto type = dictionary(index->type, dict->type());
@@ -331,6 +354,9 @@ std::string Scalar::ToString() const {
     return dict_scalar->value.dictionary->ToString() + "[" +
            dict_scalar->value.index->ToString() + "]";
   }
+  if (type->id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedScalar*>(this)->value->ToString();
+  }
   auto maybe_repr = CastTo(utf8());
   if (maybe_repr.ok()) {
     return checked_cast<const StringScalar&>(*maybe_repr.ValueOrDie()).value->ToString();
@@ -354,11 +380,18 @@ struct ScalarParseImpl {
 
   Status Visit(const FixedSizeBinaryType&) { return FinishWithBuffer(); }
 
+  Status Visit(const StringViewType&) { return FinishWithBuffer(); }
+
   Status Visit(const DictionaryType& t) {
     ARROW_ASSIGN_OR_RAISE(auto value, Scalar::Parse(t.value_type(), s_));
     return Finish(std::move(value));
   }
 
+  Status Visit(const RunEndEncodedType& t) {
+    ARROW_ASSIGN_OR_RAISE(auto value, Scalar::Parse(t.value_type(), s_));
+    return Finish(std::move(value));
+  }
+
   Status Visit(const DataType& t) {
     return Status::NotImplemented("parsing scalars of type ", t);
   }
@@ -539,6 +572,12 @@ Status CastImpl(const BinaryScalar& from, StringScalar* to) {
   return Status::OK();
 }
 
+// string view to string
+Status CastImpl(const StringViewScalar& from, StringScalar* to) {
+  to->value = from.value;
+  return Status::OK();
+}
+
 // formattable to string
 template <typename ScalarType, typename T = typename ScalarType::TypeClass,
           typename Formatter = internal::StringFormatter<T>,
@@ -598,6 +637,7 @@ struct FromTypeVisitor : CastImplVisitor {
   Status Visit(const SparseUnionType&) { return NotImplemented(); }
   Status Visit(const DenseUnionType&) { return NotImplemented(); }
   Status Visit(const DictionaryType&) { return NotImplemented(); }
+  Status Visit(const RunEndEncodedType&) { return NotImplemented(); }
   Status Visit(const ExtensionType&) { return NotImplemented(); }
 };
 
@@ -625,6 +665,11 @@ struct ToTypeVisitor : CastImplVisitor {
     return Int32Scalar(0).CastTo(dict_type.index_type()).Value(&out.index);
   }
 
+  Status Visit(const RunEndEncodedType& ree_type) {
+    auto out = checked_cast<RunEndEncodedScalar*>(out_);
+    return from_.CastTo(ree_type.value_type()).Value(&out->value);
+  }
+
   Status Visit(const SparseUnionType&) { return NotImplemented(); }
   Status Visit(const DenseUnionType&) { return NotImplemented(); }
   Status Visit(const ExtensionType&) { return NotImplemented(); }
@@ -633,6 +678,9 @@ struct ToTypeVisitor : CastImplVisitor {
 }  // namespace
 
 Result<std::shared_ptr<Scalar>> Scalar::CastTo(std::shared_ptr<DataType> to) const {
+  if (type->id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedScalar&>(*this).value->CastTo(std::move(to));
+  }
   std::shared_ptr<Scalar> out = MakeNullScalar(to);
   if (is_valid) {
     out->is_valid = true;
@@ -265,6 +265,21 @@ struct ARROW_EXPORT LargeStringScalar : public LargeBinaryScalar {
   LargeStringScalar() : LargeStringScalar(large_utf8()) {}
 };
 
+struct ARROW_EXPORT StringViewScalar : public BaseBinaryScalar {
+  using BaseBinaryScalar::BaseBinaryScalar;
+  using TypeClass = StringViewType;
+
+  StringViewScalar(std::shared_ptr<Buffer> value, std::shared_ptr<DataType> type)
+      : BaseBinaryScalar(std::move(value), std::move(type)) {}
+
+  explicit StringViewScalar(std::shared_ptr<Buffer> value)
+      : StringViewScalar(std::move(value), utf8_view()) {}
+
+  explicit StringViewScalar(std::string s);
+
+  StringViewScalar() : StringViewScalar(utf8_view()) {}
+};
+
 struct ARROW_EXPORT FixedSizeBinaryScalar : public BinaryScalar {
   using TypeClass = FixedSizeBinaryType;
 
@@ -454,6 +469,21 @@ struct ARROW_EXPORT DictionaryScalar : public Scalar {
   Result<std::shared_ptr<Scalar>> GetEncodedValue() const;
 };
 
+/// \brief A scalar value of a run-end encoded type, wrapping a value scalar
+struct ARROW_EXPORT RunEndEncodedScalar : public Scalar {
+  using TypeClass = RunEndEncodedType;
+  using ValueType = std::shared_ptr<Scalar>;
+
+  ValueType value;
+
+  RunEndEncodedScalar(std::shared_ptr<Scalar> value, std::shared_ptr<DataType> type);
+
+  /// \brief Constructs a NULL RunEndEncodedScalar
+  explicit RunEndEncodedScalar(std::shared_ptr<DataType> type);
+
+  const std::shared_ptr<DataType>& value_type() const;
+};
+
 struct ARROW_EXPORT ExtensionScalar : public Scalar {
   using Scalar::Scalar;
   using TypeClass = ExtensionType;
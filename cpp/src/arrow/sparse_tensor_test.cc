@@ -17,9 +17,11 @@
 
 // Unit tests for DataType (and subclasses), Field, and Schema
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -53,6 +55,18 @@ static inline void AssertCOOIndex(const std::shared_ptr<Tensor>& sidx, const int
 //-----------------------------------------------------------------------------
 // SparseCOOIndex
 
+// Return values of a tensor large enough to be converted on the thread pool, with
+// about one nonzero value in 17
+std::vector<int64_t> MakeLargeSparseValues(int64_t size) {
+  std::vector<int64_t> values(size, 0);
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> dist(-8, 8);
+  for (auto& value : values) {
+    value = dist(rng) == 0 ? dist(rng) : 0;
+  }
+  return values;
+}
+
 TEST(TestSparseCOOIndex, MakeRowMajorCanonical) {
   std::vector<int32_t> values = {0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 1, 3, 0, 2, 0, 0, 2, 2,
                                  1, 0, 1, 1, 0, 3, 1, 1, 0, 1, 1, 2, 1, 2, 1, 1, 2, 3};
@@ -412,6 +426,21 @@ TEST_F(TestSparseCOOTensor, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCOOTensor, TestToTensorLarge) {
+  std::vector<int64_t> shape({40, 64, 512});
+  auto values = MakeLargeSparseValues(40 * 64 * 512);
+  Tensor tensor(int64(), Buffer::Wrap(values), shape);
+
+  ASSERT_OK_AND_ASSIGN(auto sparse_tensor, SparseCOOTensor::Make(tensor));
+  ASSERT_EQ(values.size() - std::count(values.begin(), values.end(), 0),
+            sparse_tensor->non_zero_length());
+  auto si = internal::checked_pointer_cast<SparseCOOIndex>(sparse_tensor->sparse_index());
+  ASSERT_TRUE(si->is_canonical());
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Tensor> dense_tensor, sparse_tensor->ToTensor());
+  ASSERT_TRUE(tensor.Equals(*dense_tensor));
+}
+
 template <typename ValueType>
 class TestSparseCOOTensorEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -868,6 +897,23 @@ TEST_F(TestSparseCSRMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSRMatrix, TestToTensorLarge) {
+  std::vector<int64_t> shape({1100, 1000});
+  auto values = MakeLargeSparseValues(1100 * 1000);
+  const auto non_zero_length = static_cast<int64_t>(
+      values.size() - std::count(values.begin(), values.end(), 0));
+  Tensor row_major(int64(), Buffer::Wrap(values), shape);
+  Tensor column_major(int64(), Buffer::Wrap(values), {1000, 1100},
+                      {sizeof(int64_t), 1000 * sizeof(int64_t)});
+
+  for (const Tensor* tensor : {&row_major, &column_major}) {
+    ASSERT_OK_AND_ASSIGN(auto sparse_tensor, SparseCSRMatrix::Make(*tensor));
+    ASSERT_EQ(non_zero_length, sparse_tensor->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Tensor> dense_tensor, sparse_tensor->ToTensor());
+    ASSERT_TRUE(tensor->Equals(*dense_tensor));
+  }
+}
+
 template <typename ValueType>
 class TestSparseCSRMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -1203,6 +1249,23 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSCMatrix, TestToTensorLarge) {
+  std::vector<int64_t> shape({1100, 1000});
+  auto values = MakeLargeSparseValues(1100 * 1000);
+  const auto non_zero_length = static_cast<int64_t>(
+      values.size() - std::count(values.begin(), values.end(), 0));
+  Tensor row_major(int64(), Buffer::Wrap(values), shape);
+  Tensor column_major(int64(), Buffer::Wrap(values), {1000, 1100},
+                      {sizeof(int64_t), 1000 * sizeof(int64_t)});
+
+  for (const Tensor* tensor : {&row_major, &column_major}) {
+    ASSERT_OK_AND_ASSIGN(auto sparse_tensor, SparseCSCMatrix::Make(*tensor));
+    ASSERT_EQ(non_zero_length, sparse_tensor->non_zero_length());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Tensor> dense_tensor, sparse_tensor->ToTensor());
+    ASSERT_TRUE(tensor->Equals(*dense_tensor));
+  }
+}
+
 template <typename ValueType>
 class TestSparseCSCMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
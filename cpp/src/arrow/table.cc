@@ -29,16 +29,20 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
+#include "arrow/array/validate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/pretty_print.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -53,18 +57,21 @@ struct ArrayData;
 // Table methods
 
 /// \class SimpleTable
-/// \brief A basic, non-lazy in-memory table, like SimpleRecordBatch
+/// \brief A basic in-memory table, like SimpleRecordBatch
+///
+/// Like with SimpleRecordBatch, slicing is lazy: each column is only sliced
+/// when first accessed.
 class SimpleTable : public Table {
  public:
   SimpleTable(std::shared_ptr<Schema> schema,
               std::vector<std::shared_ptr<ChunkedArray>> columns, int64_t num_rows = -1)
-      : columns_(std::move(columns)) {
+      : base_columns_(std::make_shared<const ChunkedArrayVector>(std::move(columns))) {
     schema_ = std::move(schema);
     if (num_rows < 0) {
-      if (columns_.size() == 0) {
+      if (base_columns_->size() == 0) {
         num_rows_ = 0;
       } else {
-        num_rows_ = columns_[0]->length();
+        num_rows_ = (*base_columns_)[0]->length();
       }
     } else {
       num_rows_ = num_rows;
@@ -84,28 +91,48 @@ class SimpleTable : public Table {
       num_rows_ = num_rows;
     }
 
-    columns_.resize(columns.size());
+    auto chunked_columns = std::make_shared<ChunkedArrayVector>(columns.size());
     for (size_t i = 0; i < columns.size(); ++i) {
-      columns_[i] = std::make_shared<ChunkedArray>(columns[i]);
+      (*chunked_columns)[i] = std::make_shared<ChunkedArray>(columns[i]);
     }
+    base_columns_ = std::move(chunked_columns);
   }
 
-  std::shared_ptr<ChunkedArray> column(int i) const override { return columns_[i]; }
+  // Construct a lazy slice of `base_columns`
+  SimpleTable(std::shared_ptr<Schema> schema,
+              std::shared_ptr<const ChunkedArrayVector> base_columns, int64_t offset,
+              int64_t num_rows)
+      : base_columns_(std::move(base_columns)),
+        offset_(offset),
+        is_slice_(true),
+        sliced_columns_(base_columns_->size()) {
+    schema_ = std::move(schema);
+    num_rows_ = num_rows;
+  }
 
-  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override {
-    auto sliced = columns_;
-    int64_t num_rows = length;
-    for (auto& column : sliced) {
-      column = column->Slice(offset, length);
-      num_rows = column->length();
+  std::shared_ptr<ChunkedArray> column(int i) const override {
+    if (!is_slice_) {
+      return (*base_columns_)[i];
+    }
+    std::shared_ptr<ChunkedArray> result = internal::atomic_load(&sliced_columns_[i]);
+    if (!result && (*base_columns_)[i] != nullptr) {
+      result = (*base_columns_)[i]->Slice(offset_, num_rows_);
+      internal::atomic_store(&sliced_columns_[i], result);
     }
-    return Table::Make(schema_, sliced, num_rows);
+    return result;
+  }
+
+  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override {
+    ARROW_CHECK_LE(offset, num_rows_) << "Slice offset greater than table length";
+    int64_t num_rows = std::min(num_rows_ - offset, length);
+    return std::make_shared<SimpleTable>(schema_, base_columns_, offset_ + offset,
+                                         num_rows);
   }
 
   Result<std::shared_ptr<Table>> RemoveColumn(int i) const override {
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->RemoveField(i));
 
-    return Table::Make(new_schema, internal::DeleteVectorElement(columns_, i),
+    return Table::Make(new_schema, internal::DeleteVectorElement(columns(), i),
                        this->num_rows());
   }
 
@@ -127,7 +154,7 @@ class SimpleTable : public Table {
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->AddField(i, field_arg));
 
     return Table::Make(new_schema,
-                       internal::AddVectorElement(columns_, i, std::move(col)));
+                       internal::AddVectorElement(columns(), i, std::move(col)));
   }
 
   Result<std::shared_ptr<Table>> SetColumn(
@@ -147,13 +174,17 @@ class SimpleTable : public Table {
 
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->SetField(i, field_arg));
     return Table::Make(new_schema,
-                       internal::ReplaceVectorElement(columns_, i, std::move(col)));
+                       internal::ReplaceVectorElement(columns(), i, std::move(col)));
   }
 
   std::shared_ptr<Table> ReplaceSchemaMetadata(
       const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
     auto new_schema = schema_->WithMetadata(metadata);
-    return Table::Make(new_schema, columns_);
+    if (is_slice_) {
+      return std::make_shared<SimpleTable>(std::move(new_schema), base_columns_, offset_,
+                                           num_rows_);
+    }
+    return Table::Make(new_schema, *base_columns_, num_rows_);
   }
 
   Result<std::shared_ptr<Table>> Flatten(MemoryPool* pool) const override {
@@ -176,7 +207,7 @@ class SimpleTable : public Table {
   Status Validate() const override {
     RETURN_NOT_OK(ValidateMeta());
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
+      const auto col = column(i);
       Status st = col->Validate();
       if (!st.ok()) {
         std::stringstream ss;
@@ -190,7 +221,7 @@ class SimpleTable : public Table {
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
+      const auto col = column(i);
       Status st = col->ValidateFull();
       if (!st.ok()) {
         std::stringstream ss;
@@ -204,11 +235,11 @@ class SimpleTable : public Table {
  protected:
   Status ValidateMeta() const {
     // Make sure columns and schema are consistent
-    if (static_cast<int>(columns_.size()) != schema_->num_fields()) {
+    if (static_cast<int>(base_columns_->size()) != schema_->num_fields()) {
       return Status::Invalid("Number of columns did not match schema");
     }
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
+      const auto col = column(i);
       if (col == nullptr) {
         return Status::Invalid("Column ", i, " was null");
       }
@@ -221,7 +252,7 @@ class SimpleTable : public Table {
 
     // Make sure columns are all the same length, and validate them
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
+      const auto col = column(i);
       if (col->length() != num_rows_) {
         return Status::Invalid("Column ", i, " named ", field(i)->name(),
                                " expected length ", num_rows_, " but got length ",
@@ -238,11 +269,53 @@ class SimpleTable : public Table {
   }
 
  private:
-  std::vector<std::shared_ptr<ChunkedArray>> columns_;
+  // The columns this table was sliced from, shared by all slices
+  std::shared_ptr<const ChunkedArrayVector> base_columns_;
+  // For a slice, the row offset into base_columns_
+  int64_t offset_ = 0;
+  bool is_slice_ = false;
+
+  // For a slice, caching the sliced columns
+  mutable ChunkedArrayVector sliced_columns_;
 };
 
 Table::Table() : num_rows_(0) {}
 
+Status Table::ValidateFull(bool use_threads) const {
+  if (!use_threads) {
+    return ValidateFull();
+  }
+  RETURN_NOT_OK(Validate());
+
+  // Validate all chunks of all columns concurrently, then report the
+  // first error in (column, chunk) order like ValidateFull() does
+  struct ChunkTask {
+    int column;
+    int chunk;
+  };
+  std::vector<ChunkTask> tasks;
+  for (int i = 0; i < num_columns(); ++i) {
+    for (int j = 0; j < column(i)->num_chunks(); ++j) {
+      tasks.push_back({i, j});
+    }
+  }
+  std::vector<Status> statuses(tasks.size());
+  RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(tasks.size()), [&](int k) {
+    auto chunk = column(tasks[k].column)->chunk(tasks[k].chunk);
+    statuses[k] = internal::ValidateArrayFull(*chunk);
+    return Status::OK();
+  }));
+  for (size_t k = 0; k < tasks.size(); ++k) {
+    if (!statuses[k].ok()) {
+      std::stringstream ss;
+      ss << "Column " << tasks[k].column << ": In chunk " << tasks[k].chunk << ": "
+         << statuses[k].ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
 std::vector<std::shared_ptr<ChunkedArray>> Table::columns() const {
   std::vector<std::shared_ptr<ChunkedArray>> result;
   for (int i = 0; i < this->num_columns(); ++i) {
@@ -572,6 +645,11 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
   return Table::Make(schema(), std::move(compacted_columns), num_rows_);
 }
 
+Result<std::shared_ptr<Tensor>> Table::ToTensor(bool null_to_nan, bool row_major,
+                                                MemoryPool* pool) const {
+  return internal::ColumnsToTensor(columns(), num_rows_, null_to_nan, row_major, pool);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
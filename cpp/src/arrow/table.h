@@ -187,6 +187,15 @@ class ARROW_EXPORT Table {
   /// \return Status
   virtual Status ValidateFull() const = 0;
 
+  /// \brief Perform extensive validation checks, optionally in parallel.
+  ///
+  /// Same as ValidateFull(), except that if `use_threads` is true, the chunks
+  /// of all columns are validated concurrently on the CPU thread pool.
+  /// The error reported is the same as with ValidateFull().
+  ///
+  /// \return Status
+  Status ValidateFull(bool use_threads) const;
+
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -208,6 +217,21 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<Table>> CombineChunks(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Convert the table to a two-dimensional Tensor
+  ///
+  /// The tensor has one row per table row and one column per column.  All
+  /// columns must have a numeric type other than half-float; the tensor has the
+  /// columns' type when they all share it, and float64 otherwise.
+  ///
+  /// \param[in] null_to_nan if true, nulls are converted to NaN (and integer
+  /// columns with nulls to float64), otherwise nulls are an error
+  /// \param[in] row_major if true, create a row-major tensor, otherwise a
+  /// column-major one
+  /// \param[in] pool the memory pool to allocate the tensor from
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+constexpr auto kSeed = 0x94378165;
+
+constexpr int64_t kNumRows = 1 << 16;
+constexpr int64_t kSliceLength = 1000;
+
+// A wide batch of struct<int32, list<utf8>> columns
+static std::shared_ptr<RecordBatch> MakeWideBatch(int num_columns) {
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto ints = rng.Int32(kNumRows, 0, 100, /*null_probability=*/0.1);
+  auto strs = rng.String(kNumRows * 2, 0, 10, /*null_probability=*/0.1);
+  auto lists = rng.List(*strs, kNumRows, /*null_probability=*/0.1);
+  auto column = *StructArray::Make({ints, lists}, std::vector<std::string>{"a", "b"});
+
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), column->type()));
+    columns.push_back(column);
+  }
+  return RecordBatch::Make(schema(std::move(fields)), kNumRows, std::move(columns));
+}
+
+static void RecordBatchSliceWide(benchmark::State& state) {
+  const auto batch = MakeWideBatch(static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    for (int64_t offset = 0; offset < kNumRows; offset += kSliceLength) {
+      auto slice = batch->Slice(offset, kSliceLength);
+      // Access a single column, as a projection would
+      benchmark::DoNotOptimize(slice->column(0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kNumRows / kSliceLength));
+}
+
+static void TableSliceWide(benchmark::State& state) {
+  const auto table = *Table::FromRecordBatches(
+      {MakeWideBatch(static_cast<int>(state.range(0)))});
+
+  for (auto _ : state) {
+    for (int64_t offset = 0; offset < kNumRows; offset += kSliceLength) {
+      auto slice = table->Slice(offset, kSliceLength);
+      benchmark::DoNotOptimize(slice->column(0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kNumRows / kSliceLength));
+}
+
+static void RecordBatchSetColumnWide(benchmark::State& state) {
+  const auto batch = MakeWideBatch(static_cast<int>(state.range(0)));
+  const auto field = batch->schema()->field(0);
+  const auto column = batch->column(0);
+
+  for (auto _ : state) {
+    for (int i = 0; i < 100; ++i) {
+      ABORT_NOT_OK(batch->SetColumn(i, field, column).status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK(RecordBatchSliceWide)->Arg(100)->Arg(2000);
+BENCHMARK(TableSliceWide)->Arg(100)->Arg(2000);
+BENCHMARK(RecordBatchSetColumnWide)->Arg(100)->Arg(2000);
+
+}  // namespace arrow
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -29,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -126,6 +129,31 @@ TEST_F(TestTable, InvalidColumns) {
   ASSERT_RAISES(Invalid, table_->ValidateFull());
 }
 
+TEST_F(TestTable, ValidateFullThreaded) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto ints = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[3]", "[]", "[4, null]"});
+  auto strs = ChunkedArrayFromJSON(utf8(), {"[\"a\", \"b\", \"c\"]", "[\"d\", null]"});
+  table_ = Table::Make(schema, {ints, strs});
+  ASSERT_OK(table_->ValidateFull(/*use_threads=*/true));
+  ASSERT_OK(table_->ValidateFull(/*use_threads=*/false));
+
+  // Invalid UTF8 in the second chunk of the second column
+  auto bad_chunk = ArrayFromJSON(utf8(), "[\"d\", \"e\"]");
+  bad_chunk->data()->buffers[2] = Buffer::FromString("\xff" "e");
+  auto bad_strs = std::make_shared<ChunkedArray>(ArrayVector{strs->chunk(0), bad_chunk});
+  table_ = Table::Make(schema, {ints, bad_strs});
+  const auto serial_status = table_->ValidateFull();
+  ASSERT_RAISES(Invalid, serial_status);
+  const auto threaded_status = table_->ValidateFull(/*use_threads=*/true);
+  ASSERT_RAISES(Invalid, threaded_status);
+  ASSERT_EQ(serial_status.message(), threaded_status.message());
+  ASSERT_THAT(threaded_status.message(), ::testing::HasSubstr("Column 1: In chunk 1"));
+
+  // Cheap validation errors are reported first
+  table_ = Table::Make(schema, {ints, strs}, /*num_rows=*/4);
+  ASSERT_RAISES(Invalid, table_->ValidateFull(/*use_threads=*/true));
+}
+
 TEST_F(TestTable, AllColumnsAndFields) {
   const int length = 100;
   MakeExample1(length);
@@ -269,6 +297,67 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, ToTensor) {
+  // Large enough to be converted in parallel, with chunk boundaries which differ
+  // between columns and fall inside row-major tiles
+  const int64_t num_rows = 70000;
+  const std::vector<std::vector<int64_t>> chunk_lengths = {
+      {num_rows}, {1000, 0, 30001, num_rows - 31001}, {7, 65529, num_rows - 65536}};
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < static_cast<int>(chunk_lengths.size()); ++i) {
+    std::vector<uint16_t> values(num_rows);
+    for (int64_t j = 0; j < num_rows; ++j) {
+      values[j] = static_cast<uint16_t>(j * 3 + i);
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<UInt16Type>(values, &array);
+
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (int64_t length : chunk_lengths[i]) {
+      chunks.push_back(array->Slice(offset, length));
+      offset += length;
+    }
+    fields.push_back(field("f" + std::to_string(i), uint16()));
+    columns.push_back(std::make_shared<ChunkedArray>(chunks));
+  }
+  auto table = Table::Make(::arrow::schema(fields), columns);
+  const int64_t num_columns = table->num_columns();
+
+  std::vector<uint16_t> row_major_values(num_rows * num_columns);
+  std::vector<uint16_t> column_major_values(num_rows * num_columns);
+  for (int64_t j = 0; j < num_rows; ++j) {
+    for (int64_t i = 0; i < num_columns; ++i) {
+      const auto value = static_cast<uint16_t>(j * 3 + i);
+      row_major_values[j * num_columns + i] = value;
+      column_major_values[i * num_rows + j] = value;
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor());
+  Tensor row_major(uint16(), Buffer::Wrap(row_major_values), {num_rows, num_columns});
+  ASSERT_TRUE(tensor->Equals(row_major));
+
+  ASSERT_OK_AND_ASSIGN(tensor, table->ToTensor(/*null_to_nan=*/false,
+                                               /*row_major=*/false));
+  Tensor column_major(uint16(), Buffer::Wrap(column_major_values),
+                      {num_rows, num_columns}, {2, 2 * num_rows});
+  ASSERT_TRUE(tensor->Equals(column_major));
+}
+
+TEST_F(TestTable, ToTensorNullToNaN) {
+  auto table = TableFromJSON(::arrow::schema({field("a", uint32())}),
+                             {R"([{"a": 1}, {"a": null}])", R"([{"a": 3}])"});
+  ASSERT_RAISES(Invalid, table->ToTensor());
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor(/*null_to_nan=*/true));
+  std::vector<double> values = {1, std::numeric_limits<double>::quiet_NaN(), 3};
+  Tensor expected(float64(), Buffer::Wrap(values), {3, 1});
+  ASSERT_TRUE(tensor->Equals(expected, EqualOptions::Defaults().nans_equal(true)));
+}
+
 TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   schema_ = schema({field("str", utf8())});
   arrays_ = {nullptr};
@@ -515,6 +604,37 @@ TEST_F(TestTable, Slice) {
                     *three->Slice(length + length / 3, 2 * (length - length / 3)));
 }
 
+TEST_F(TestTable, SliceOfSlice) {
+  auto schema = ::arrow::schema({field("f0", int8()), field("f1", utf8())});
+  auto c0 = ChunkedArrayFromJSON(int8(), {"[0, 1, 2]", "[3, 4, 5, 6]"});
+  auto c1 =
+      ChunkedArrayFromJSON(utf8(), {R"(["a", "b"])", R"([null, "d", "e", "f", "g"])"});
+  auto table = Table::Make(schema, {c0, c1});
+
+  auto slice = table->Slice(1, 5)->Slice(2, 10);
+  ASSERT_OK(slice->ValidateFull());
+  ASSERT_EQ(slice->num_rows(), 3);
+  AssertChunkedEqual(*c0->Slice(3, 3), *slice->column(0));
+  AssertChunkedEqual(*c1->Slice(3, 3), *slice->column(1));
+  // Sliced columns are cached
+  ASSERT_EQ(slice->column(0), slice->column(0));
+
+  auto c2 = ChunkedArrayFromJSON(int16(), {"[7, 8, 9]"});
+  ASSERT_OK_AND_ASSIGN(auto replaced, slice->SetColumn(0, field("f2", int16()), c2));
+  ASSERT_OK(replaced->ValidateFull());
+  AssertChunkedEqual(*c2, *replaced->column(0));
+  AssertChunkedEqual(*slice->column(1), *replaced->column(1));
+
+  ASSERT_OK_AND_ASSIGN(auto removed, slice->RemoveColumn(0));
+  ASSERT_OK(removed->ValidateFull());
+  ASSERT_EQ(removed->num_columns(), 1);
+  AssertChunkedEqual(*slice->column(1), *removed->column(0));
+
+  auto with_metadata = slice->ReplaceSchemaMetadata(key_value_metadata({"k"}, {"v"}));
+  ASSERT_OK(with_metadata->ValidateFull());
+  ASSERT_TRUE(with_metadata->Equals(*slice));
+}
+
 TEST_F(TestTable, RemoveColumn) {
   const int64_t length = 10;
   MakeExample1(length);
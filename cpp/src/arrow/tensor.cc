@@ -20,24 +20,32 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/data.h"
+#include "arrow/chunked_array.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 using internal::checked_cast;
+using internal::OptionalParallelFor;
 
 namespace internal {
 
@@ -339,4 +347,232 @@ Result<int64_t> Tensor::CountNonZero() const {
   return counter.result;
 }
 
+namespace {
+
+// Number of rows of a row-major output tile.  A tile is filled one column at a
+// time, and each column touches one cache line per row, so the lines of a whole
+// tile (16 KiB) stay in the L1 cache until the last column has been written.
+constexpr int64_t kTileRows = 256;
+
+// Tensors with fewer values are filled on the calling thread
+constexpr int64_t kParallelMinimumSize = 1 << 16;
+
+Result<std::shared_ptr<DataType>> ColumnsTensorType(
+    const std::vector<std::shared_ptr<ChunkedArray>>& columns, bool null_to_nan) {
+  if (columns.empty()) {
+    return Status::TypeError("Conversion to Tensor requires at least one column");
+  }
+  std::shared_ptr<DataType> type = columns[0]->type();
+  bool has_nulls = false;
+  for (const auto& column : columns) {
+    const auto& column_type = column->type();
+    if (!is_tensor_supported(column_type->id()) ||
+        column_type->id() == Type::HALF_FLOAT) {
+      return Status::TypeError("Conversion to Tensor is not supported for column type ",
+                               column_type->ToString());
+    }
+    if (!column_type->Equals(*type)) {
+      type = float64();
+    }
+    if (column->null_count() > 0) {
+      if (!null_to_nan) {
+        return Status::Invalid(
+            "Can only convert columns without nulls to Tensor, "
+            "set null_to_nan to convert nulls to NaN");
+      }
+      has_nulls = true;
+    }
+  }
+  if (has_nulls && is_integer(type->id())) {
+    type = float64();
+  }
+  return type;
+}
+
+// Copy `length` values of `chunk` starting at `offset` to every `stride`-th
+// value of `out`, writing nulls as NaN
+template <typename OutCType, typename InCType>
+void CopyColumnValues(const ArrayData& chunk, int64_t offset, int64_t length,
+                      OutCType* out, int64_t stride) {
+  const InCType* in = chunk.GetValues<InCType>(1) + offset;
+  if (std::is_same<OutCType, InCType>::value && stride == 1) {
+    std::memcpy(out, in, length * sizeof(OutCType));
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i * stride] = static_cast<OutCType>(in[i]);
+    }
+  }
+  if (chunk.GetNullCount() > 0) {
+    const uint8_t* bitmap = chunk.buffers[0]->data();
+    const int64_t bitmap_offset = chunk.offset + offset;
+    for (int64_t i = 0; i < length; ++i) {
+      if (!BitUtil::GetBit(bitmap, bitmap_offset + i)) {
+        out[i * stride] = std::numeric_limits<OutCType>::quiet_NaN();
+      }
+    }
+  }
+}
+
+template <typename OutType>
+class ColumnsToTensorConverter {
+ public:
+  using out_c_type = typename OutType::c_type;
+  using CopyFunc = void (*)(const ArrayData&, int64_t, int64_t, out_c_type*, int64_t);
+
+  ColumnsToTensorConverter(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                           int64_t num_rows)
+      : columns_(columns), num_rows_(num_rows) {}
+
+  Status Init() {
+    for (const auto& column : columns_) {
+      CopyFuncMaker maker;
+      RETURN_NOT_OK(VisitTypeInline(*column->type(), &maker));
+      copy_funcs_.push_back(maker.func);
+
+      std::vector<int64_t> starts;
+      int64_t start = 0;
+      for (const auto& chunk : column->chunks()) {
+        starts.push_back(start);
+        start += chunk->length();
+      }
+      chunk_starts_.push_back(std::move(starts));
+    }
+    return Status::OK();
+  }
+
+  // Each column is copied to its own contiguous segment of the output
+  Status FillColumnMajor(bool use_threads, out_c_type* out) {
+    const int num_columns = static_cast<int>(columns_.size());
+    return OptionalParallelFor(use_threads, num_columns, [&](int i) {
+      CopyRows(i, 0, num_rows_, out + i * num_rows_, 1);
+      return Status::OK();
+    });
+  }
+
+  // The output is transposed one tile of kTileRows rows at a time
+  Status FillRowMajor(bool use_threads, out_c_type* out) {
+    const int64_t num_columns = static_cast<int64_t>(columns_.size());
+    const int num_tiles = static_cast<int>((num_rows_ + kTileRows - 1) / kTileRows);
+    return OptionalParallelFor(use_threads, num_tiles, [&](int tile) {
+      const int64_t row_begin = tile * kTileRows;
+      const int64_t row_end = std::min(row_begin + kTileRows, num_rows_);
+      for (int64_t i = 0; i < num_columns; ++i) {
+        CopyRows(static_cast<int>(i), row_begin, row_end,
+                 out + row_begin * num_columns + i, num_columns);
+      }
+      return Status::OK();
+    });
+  }
+
+ private:
+  struct CopyFuncMaker {
+    template <typename TYPE>
+    enable_if_number<TYPE, Status> Visit(const TYPE&) {
+      func = &CopyColumnValues<out_c_type, typename TYPE::c_type>;
+      return Status::OK();
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Conversion to Tensor is not supported for column type ",
+                               type.ToString());
+    }
+
+    CopyFunc func = NULLPTR;
+  };
+
+  // Copy rows [row_begin, row_end) of column i, which may span several chunks
+  void CopyRows(int i, int64_t row_begin, int64_t row_end, out_c_type* out,
+                int64_t stride) {
+    const auto& chunks = columns_[i]->chunks();
+    const auto& starts = chunk_starts_[i];
+    auto chunk_index = static_cast<size_t>(
+        std::upper_bound(starts.begin(), starts.end(), row_begin) - starts.begin() - 1);
+    int64_t row = row_begin;
+    for (; row < row_end && chunk_index < chunks.size(); ++chunk_index) {
+      const ArrayData& chunk = *chunks[chunk_index]->data();
+      const int64_t offset = row - starts[chunk_index];
+      const int64_t length = std::min(chunk.length - offset, row_end - row);
+      if (length <= 0) {
+        continue;
+      }
+      copy_funcs_[i](chunk, offset, length, out, stride);
+      out += length * stride;
+      row += length;
+    }
+  }
+
+  const std::vector<std::shared_ptr<ChunkedArray>>& columns_;
+  const int64_t num_rows_;
+  std::vector<CopyFunc> copy_funcs_;
+  std::vector<std::vector<int64_t>> chunk_starts_;
+};
+
+struct ColumnsToTensorFiller {
+  template <typename TYPE>
+  enable_if_number<TYPE, Status> Visit(const TYPE&) {
+    ColumnsToTensorConverter<TYPE> converter(columns, num_rows);
+    RETURN_NOT_OK(converter.Init());
+    auto out = reinterpret_cast<typename TYPE::c_type*>(data);
+    if (row_major) {
+      return converter.FillRowMajor(use_threads, out);
+    }
+    return converter.FillColumnMajor(use_threads, out);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Conversion to Tensor is not supported for type ",
+                             type.ToString());
+  }
+
+  const std::vector<std::shared_ptr<ChunkedArray>>& columns;
+  int64_t num_rows;
+  bool row_major;
+  bool use_threads;
+  uint8_t* data;
+};
+
+}  // namespace
+
+namespace internal {
+
+Result<std::shared_ptr<Tensor>> ColumnsToTensor(
+    const std::vector<std::shared_ptr<ChunkedArray>>& columns, int64_t num_rows,
+    bool null_to_nan, bool row_major, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto type, ColumnsTensorType(columns, null_to_nan));
+  const auto& fw_type = checked_cast<const FixedWidthType&>(*type);
+  const int64_t num_columns = static_cast<int64_t>(columns.size());
+  const std::vector<int64_t> shape = {num_rows, num_columns};
+
+  std::vector<int64_t> strides;
+  if (row_major) {
+    RETURN_NOT_OK(ComputeRowMajorStrides(fw_type, shape, &strides));
+  } else {
+    RETURN_NOT_OK(ComputeColumnMajorStrides(fw_type, shape, &strides));
+  }
+
+  const int byte_width = GetByteWidth(fw_type);
+  int64_t size;
+  if (MultiplyWithOverflow(num_rows, num_columns, &size) ||
+      MultiplyWithOverflow(size, static_cast<int64_t>(byte_width), &size)) {
+    return Status::Invalid("Tensor size would not fit in 64-bit integer");
+  }
+
+  // A single chunk of a single column already has the layout of the tensor
+  if (num_rows > 0 && num_columns == 1 && columns[0]->num_chunks() == 1 &&
+      columns[0]->type()->Equals(*type) && columns[0]->null_count() == 0) {
+    const ArrayData& chunk = *columns[0]->chunk(0)->data();
+    auto data = SliceBuffer(chunk.buffers[1], chunk.offset * byte_width, size);
+    return Tensor::Make(type, std::move(data), shape, strides);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data, AllocateBuffer(size, pool));
+  ColumnsToTensorFiller filler{columns, num_rows, row_major,
+                               size / byte_width >= kParallelMinimumSize,
+                               data->mutable_data()};
+  RETURN_NOT_OK(VisitTypeInline(*type, &filler));
+  return Tensor::Make(type, std::move(data), shape, strides);
+}
+
+}  // namespace internal
+
 }  // namespace arrow
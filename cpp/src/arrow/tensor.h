@@ -77,6 +77,14 @@ Status ValidateTensorParameters(const std::shared_ptr<DataType>& type,
                                 const std::vector<int64_t>& strides,
                                 const std::vector<std::string>& dim_names);
 
+/// \brief Convert equal-length columns to a two-dimensional tensor
+///
+/// This is the implementation of RecordBatch::ToTensor and Table::ToTensor.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> ColumnsToTensor(
+    const std::vector<std::shared_ptr<ChunkedArray>>& columns, int64_t num_rows,
+    bool null_to_nan, bool row_major, MemoryPool* pool);
+
 }  // namespace internal
 
 class ARROW_EXPORT Tensor {
@@ -17,7 +17,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "arrow/status.h"
 #include "arrow/tensor/converter.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
@@ -86,3 +93,79 @@
       }                                                   \
       break;                                              \
   }
+
+namespace arrow {
+namespace internal {
+
+// Dense tensors of at least this many elements are converted on the CPU thread pool
+constexpr int64_t kParallelConversionMinimumSize = 1 << 20;
+
+// The number of contiguous ranges ParallelForRanges splits [0, length) into
+inline int64_t NumParallelRanges(bool use_threads, int64_t length) {
+  if (!use_threads) {
+    return std::min<int64_t>(length, 1);
+  }
+  return std::min<int64_t>(length, 4 * GetCpuThreadPoolCapacity());
+}
+
+// Call func(range, begin, end) on each of the NumParallelRanges(use_threads, length)
+// contiguous ranges covering [0, length), concurrently if `use_threads`
+template <typename Func>
+Status ParallelForRanges(bool use_threads, int64_t length, Func&& func) {
+  const int64_t num_ranges = NumParallelRanges(use_threads, length);
+  if (num_ranges == 0) {
+    return Status::OK();
+  }
+  const int64_t range_size = (length + num_ranges - 1) / num_ranges;
+  return OptionalParallelFor(use_threads, static_cast<int>(num_ranges), [&](int range) {
+    const int64_t begin = std::min(length, range * range_size);
+    const int64_t end = std::min(length, begin + range_size);
+    func(static_cast<int64_t>(range), begin, end);
+    return Status::OK();
+  });
+}
+
+// Values are compared bitwise to zero, like SparseTensorConverterMixin::IsNonZero,
+// using the unsigned integer type of the same width (see DISPATCH).
+
+// Return the number of nonzero values among `length` contiguous values.  This loop is
+// vectorized by the compiler.
+template <typename c_value_type>
+int64_t CountNonZeroValues(const c_value_type* values, int64_t length) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    count += values[i] != 0;
+  }
+  return count;
+}
+
+// Call visit(i) for each nonzero value among `length` contiguous values, in order.
+// Blocks of values are first tested at once so that zero runs, the common case of
+// sparse data, are skipped with vectorized code.
+template <typename c_value_type, typename Visitor>
+void VisitNonZeroValues(const c_value_type* values, int64_t length, Visitor&& visit) {
+  constexpr int64_t kBlockSize = 16;
+  int64_t i = 0;
+  for (; i + kBlockSize <= length; i += kBlockSize) {
+    c_value_type block = 0;
+    for (int64_t k = 0; k < kBlockSize; ++k) {
+      block |= values[i + k];
+    }
+    if (block == 0) {
+      continue;
+    }
+    for (int64_t k = i; k < i + kBlockSize; ++k) {
+      if (values[k] != 0) {
+        visit(k);
+      }
+    }
+  }
+  for (; i < length; ++i) {
+    if (values[i] != 0) {
+      visit(i);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -52,29 +52,50 @@ inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
   }
 }
 
+// Fill the coordinates and values of the nonzero values of the rows [row_begin, row_end)
+// of a row-major tensor, a row being a contiguous run along the last dimension
 template <typename c_index_type, typename c_value_type>
-void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
-                           c_value_type* values, const int64_t size) {
-  const auto ndim = tensor.ndim();
+void FillRowMajorTensor(const Tensor& tensor, int64_t row_begin, int64_t row_end,
+                        c_index_type* indices, c_value_type* values) {
+  const int ndim = tensor.ndim();
   const auto& shape = tensor.shape();
+  const int64_t row_length = shape[ndim - 1];
   const c_value_type* tensor_data =
-      reinterpret_cast<const c_value_type*>(tensor.raw_data());
+      reinterpret_cast<const c_value_type*>(tensor.raw_data()) + row_begin * row_length;
 
-  constexpr c_value_type zero = 0;
+  // The coordinates of the first row, without the last dimension
   std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
+  for (int64_t d = ndim - 2, row = row_begin; d >= 0; --d) {
+    coord[d] = static_cast<c_index_type>(row % shape[d]);
+    row /= shape[d];
+  }
+
+  for (int64_t row = row_begin; row < row_end; ++row) {
+    VisitNonZeroValues(tensor_data, row_length, [&](int64_t j) {
+      coord[ndim - 1] = static_cast<c_index_type>(j);
       std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
       indices += ndim;
-    }
+      *values++ = tensor_data[j];
+    });
+    tensor_data += row_length;
 
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
+    coord[ndim - 1] = 0;
+    for (int d = ndim - 2; d >= 0; --d) {
+      if (++coord[d] < shape[d]) break;
+      coord[d] = 0;
+    }
   }
 }
 
+template <typename c_index_type, typename c_value_type>
+void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
+                           c_value_type* values, const int64_t size) {
+  const auto& shape = tensor.shape();
+  if (tensor.size() == 0) return;
+  FillRowMajorTensor(tensor, 0, tensor.size() / shape[tensor.ndim() - 1], indices,
+                     values);
+}
+
 template <typename c_index_type, typename c_value_type>
 void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
                               c_value_type* out_values, const int64_t size) {
@@ -155,6 +176,10 @@ void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
 #define CONVERT_STRIDED_TENSOR(index_type, value_type, ...) \
   ARROW_EXPAND(CONVERT_TENSOR(ConvertStridedTensor, index_type, value_type, __VA_ARGS__))
 
+#define CONVERT_ROW_MAJOR_TENSOR_PARALLEL(index_type, value_type, ...) \
+  RETURN_NOT_OK(                                                       \
+      ARROW_EXPAND((ConvertRowMajorParallel<index_type, value_type>(__VA_ARGS__))))
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCOOIndex
 
@@ -176,6 +201,17 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
     const int value_elsize = GetByteWidth(*tensor_.type());
 
     const int64_t ndim = tensor_.ndim();
+    if (ndim > 1 && tensor_.is_row_major() &&
+        tensor_.size() >= kParallelConversionMinimumSize) {
+      std::shared_ptr<Buffer> indices_buffer;
+      std::shared_ptr<Buffer> values_buffer;
+      int64_t nonzero_count = 0;
+      DISPATCH(CONVERT_ROW_MAJOR_TENSOR_PARALLEL, index_elsize, value_elsize,
+               &indices_buffer, &values_buffer, &nonzero_count);
+      return MakeResults(std::move(indices_buffer), std::move(values_buffer),
+                         nonzero_count);
+    }
+
     ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
 
     ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
@@ -210,7 +246,55 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
                nonzero_count);
     }
 
-    // make results
+    return MakeResults(std::move(indices_buffer), std::move(values_buffer),
+                       nonzero_count);
+  }
+
+  // Convert a large row-major tensor in two passes over ranges of rows on the CPU
+  // thread pool: count the nonzero values of each range, then fill the coordinates
+  // and values of each range at the offsets given by the prefix sum of the counts.
+  template <typename c_index_type, typename c_value_type>
+  Status ConvertRowMajorParallel(std::shared_ptr<Buffer>* out_indices,
+                                 std::shared_ptr<Buffer>* out_values,
+                                 int64_t* out_nonzero_count) {
+    const int ndim = tensor_.ndim();
+    const int64_t row_length = tensor_.shape()[ndim - 1];
+    const int64_t num_rows = tensor_.size() / row_length;
+    const auto tensor_data = reinterpret_cast<const c_value_type*>(tensor_.raw_data());
+
+    std::vector<int64_t> range_offsets(NumParallelRanges(true, num_rows) + 1, 0);
+    RETURN_NOT_OK(ParallelForRanges(
+        /*use_threads=*/true, num_rows, [&](int64_t range, int64_t begin, int64_t end) {
+          range_offsets[range + 1] = CountNonZeroValues(tensor_data + begin * row_length,
+                                                        (end - begin) * row_length);
+        }));
+    std::partial_sum(range_offsets.begin(), range_offsets.end(), range_offsets.begin());
+    const int64_t nonzero_count = range_offsets.back();
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto indices_buffer,
+        AllocateBuffer(sizeof(c_index_type) * ndim * nonzero_count, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool_));
+    auto indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+    auto values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(ParallelForRanges(
+        /*use_threads=*/true, num_rows, [&](int64_t range, int64_t begin, int64_t end) {
+          const int64_t offset = range_offsets[range];
+          FillRowMajorTensor(tensor_, begin, end, indices + offset * ndim,
+                             values + offset);
+        }));
+
+    *out_indices = std::move(indices_buffer);
+    *out_values = std::move(values_buffer);
+    *out_nonzero_count = nonzero_count;
+    return Status::OK();
+  }
+
+  Status MakeResults(std::shared_ptr<Buffer> indices_buffer,
+                     std::shared_ptr<Buffer> values_buffer, int64_t nonzero_count) {
+    const int64_t ndim = tensor_.ndim();
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
     std::vector<int64_t> indices_strides;
     RETURN_NOT_OK(internal::ComputeRowMajorStrides(
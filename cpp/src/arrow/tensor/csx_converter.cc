@@ -15,7 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
 #include <cstdint>
 #include <limits>
@@ -26,6 +26,8 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -35,13 +37,14 @@ class MemoryPool;
 namespace internal {
 namespace {
 
+// Using ARROW_EXPAND is necessary to expand __VA_ARGS__ correctly on VC++.
+#define CONVERT_CSX_MATRIX(index_type, value_type, ...) \
+  RETURN_NOT_OK(ARROW_EXPAND((ConvertMatrix<index_type, value_type>(__VA_ARGS__))))
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
 class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
-
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -59,59 +62,19 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
-
-    const int major_axis = static_cast<int>(axis_);
-    const int64_t n_major = tensor_.shape()[major_axis];
-    const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
-
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
-
-    const auto* tensor_data = tensor_.raw_data();
-
     if (ndim <= 1) {
       return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
+    }
 
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
+    std::shared_ptr<Buffer> indptr_buffer;
+    std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    int64_t nonzero_count = 0;
+    DISPATCH(CONVERT_CSX_MATRIX, index_elsize, value_elsize, &indptr_buffer,
+             &indices_buffer, &values_buffer, &nonzero_count);
 
-            k++;
-          }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
-      }
-    }
+    const int major_axis = static_cast<int>(axis_);
+    const int64_t n_major = tensor_.shape()[major_axis];
 
     std::vector<int64_t> indptr_shape({n_major + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -131,6 +94,97 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     return Status::OK();
   }
 
+  // Convert in two passes over slices of the major axis: count the nonzero values
+  // of each slice, then fill the indices and values of each slice at the offsets
+  // given by the prefix sum of the counts.  Both passes are run on the CPU thread
+  // pool for large matrices.
+  template <typename c_index_type, typename c_value_type>
+  Status ConvertMatrix(std::shared_ptr<Buffer>* out_indptr,
+                       std::shared_ptr<Buffer>* out_indices,
+                       std::shared_ptr<Buffer>* out_values, int64_t* out_nonzero_count) {
+    const int major_axis = static_cast<int>(axis_);
+    const int64_t n_major = tensor_.shape()[major_axis];
+    const int64_t n_minor = tensor_.shape()[1 - major_axis];
+    const int64_t major_stride = tensor_.strides()[major_axis];
+    const int64_t minor_stride = tensor_.strides()[1 - major_axis];
+    const uint8_t* tensor_data = tensor_.raw_data();
+    const bool use_threads = tensor_.size() >= kParallelConversionMinimumSize;
+
+    // Slices along the minor axis are contiguous for row-major CSR and for
+    // column-major CSC
+    const bool contiguous = minor_stride == static_cast<int64_t>(sizeof(c_value_type));
+    auto slice_data = [&](int64_t i) { return tensor_data + i * major_stride; };
+    auto value_at = [&](const uint8_t* slice, int64_t j) {
+      return util::SafeLoadAs<c_value_type>(slice + j * minor_stride);
+    };
+
+    std::vector<int64_t> offsets(n_major + 1, 0);
+    RETURN_NOT_OK(
+        ParallelForRanges(use_threads, n_major, [&](int64_t, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            const uint8_t* slice = slice_data(i);
+            int64_t count = 0;
+            if (contiguous) {
+              count = CountNonZeroValues(reinterpret_cast<const c_value_type*>(slice),
+                                         n_minor);
+            } else {
+              for (int64_t j = 0; j < n_minor; ++j) {
+                count += value_at(slice, j) != 0;
+              }
+            }
+            offsets[i + 1] = count;
+          }
+        }));
+    for (int64_t i = 0; i < n_major; ++i) {
+      offsets[i + 1] += offsets[i];
+    }
+    const int64_t nonzero_count = offsets[n_major];
+
+    ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * (n_major + 1), pool_));
+    auto indptr = reinterpret_cast<c_index_type*>(indptr_buffer->mutable_data());
+    for (int64_t i = 0; i <= n_major; ++i) {
+      indptr[i] = static_cast<c_index_type>(offsets[i]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool_));
+    auto indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+    auto values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(
+        ParallelForRanges(use_threads, n_major, [&](int64_t, int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            const uint8_t* slice = slice_data(i);
+            c_index_type* out_index = indices + offsets[i];
+            c_value_type* out_value = values + offsets[i];
+            if (contiguous) {
+              const auto slice_values = reinterpret_cast<const c_value_type*>(slice);
+              VisitNonZeroValues(slice_values, n_minor, [&](int64_t j) {
+                *out_index++ = static_cast<c_index_type>(j);
+                *out_value++ = slice_values[j];
+              });
+            } else {
+              for (int64_t j = 0; j < n_minor; ++j) {
+                const c_value_type x = value_at(slice, j);
+                if (x != 0) {
+                  *out_index++ = static_cast<c_index_type>(j);
+                  *out_value++ = x;
+                }
+              }
+            }
+          }
+        }));
+
+    *out_indptr = std::move(indptr_buffer);
+    *out_indices = std::move(indices_buffer);
+    *out_values = std::move(values_buffer);
+    *out_nonzero_count = nonzero_count;
+    return Status::OK();
+  }
+
   std::shared_ptr<SparseIndex> sparse_index;
   std::shared_ptr<Buffer> data;
 
@@ -20,6 +20,7 @@
 #include "arrow/sparse_tensor.h"
 #include "arrow/testing/gtest_util.h"
 
+#include <numeric>
 #include <random>
 
 namespace arrow {
@@ -147,6 +148,56 @@ class MatrixConversionFixture : public benchmark::Fixture {
   }
 };
 
+// Large row-major tensors and matrices, with about 1% of nonzero values spread
+// uniformly, which are converted on the CPU thread pool
+template <bool kMatrix, typename ValueType, typename IndexType>
+class LargeConversionFixture : public benchmark::Fixture {
+ protected:
+  using c_value_type = typename ValueType::c_type;
+  using c_index_type = typename IndexType::c_type;
+
+  std::shared_ptr<DataType> value_type_ = TypeTraits<ValueType>::type_singleton();
+  std::shared_ptr<DataType> index_type_ = TypeTraits<IndexType>::type_singleton();
+
+  std::vector<c_value_type> values_;
+  std::shared_ptr<Tensor> tensor_;
+
+ public:
+  void SetUp(const ::benchmark::State& state) {
+    std::vector<int64_t> shape;
+    if (kMatrix) {
+      shape = {4096, 4096};
+    } else {
+      shape = {64, 256, 1024};
+    }
+    auto n = std::accumulate(shape.begin(), shape.end(), int64_t(1),
+                             [](int64_t acc, int64_t i) { return acc * i; });
+
+    values_.assign(n, 0);
+    std::default_random_engine rng(42);
+    std::uniform_int_distribution<int64_t> position(0, 99);
+    for (int64_t i = 0; i < n; ++i) {
+      if (position(rng) == 0) {
+        values_[i] = static_cast<c_value_type>(1 + i % 100);
+      }
+    }
+    ABORT_NOT_OK(Tensor::Make(value_type_, Buffer::Wrap(values_), shape).Value(&tensor_));
+  }
+};
+
+template <typename IndexType>
+using Int8LargeTensorConversionFixture =
+    LargeConversionFixture<false, Int8Type, IndexType>;
+template <typename IndexType>
+using DoubleLargeTensorConversionFixture =
+    LargeConversionFixture<false, DoubleType, IndexType>;
+template <typename IndexType>
+using Int8LargeMatrixConversionFixture =
+    LargeConversionFixture<true, Int8Type, IndexType>;
+template <typename IndexType>
+using DoubleLargeMatrixConversionFixture =
+    LargeConversionFixture<true, DoubleType, IndexType>;
+
 #define DEFINE_TYPED_TENSOR_CONVERSION_FIXTURE(value_type_name)                \
   template <typename IndexType>                                                \
   using value_type_name##RowMajorTensorConversionFixture =                     \
@@ -227,4 +278,11 @@ BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Float, Int64);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int32);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int64);
 
+BENCHMARK_CONVERT_TENSOR_(Large, Tensor, COO, Int8, Int32);
+BENCHMARK_CONVERT_TENSOR_(Large, Tensor, COO, Double, Int64);
+BENCHMARK_CONVERT_TENSOR_(Large, Matrix, CSR, Int8, Int16);
+BENCHMARK_CONVERT_TENSOR_(Large, Matrix, CSR, Double, Int64);
+BENCHMARK_CONVERT_TENSOR_(Large, Matrix, CSC, Int8, Int16);
+BENCHMARK_CONVERT_TENSOR_(Large, Matrix, CSC, Double, Int64);
+
 }  // namespace arrow
@@ -45,6 +45,7 @@
 #include "arrow/util/formatting.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/string.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visitor_inline.h"
@@ -223,7 +224,7 @@ class SchemaWriter {
   template <typename T>
   enable_if_t<is_null_type<T>::value || is_primitive_ctype<T>::value ||
               is_base_binary_type<T>::value || is_base_list_type<T>::value ||
-              is_struct_type<T>::value>
+              is_struct_type<T>::value || is_run_end_encoded_type<T>::value>
   WriteTypeMetadata(const T& type) {}
 
   void WriteTypeMetadata(const MapType& type) {
@@ -380,6 +381,7 @@ class SchemaWriter {
   Status Visit(const BinaryType& type) { return WriteVarBytes("binary", type); }
   Status Visit(const LargeStringType& type) { return WriteVarBytes("largeutf8", type); }
   Status Visit(const LargeBinaryType& type) { return WriteVarBytes("largebinary", type); }
+  Status Visit(const StringViewType& type) { return Status::NotImplemented(type.name()); }
   Status Visit(const FixedSizeBinaryType& type) {
     return WritePrimitive("fixedsizebinary", type);
   }
@@ -424,6 +426,11 @@ class SchemaWriter {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    WriteName("runendencoded", type);
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryType& type) { return VisitType(*type.value_type()); }
 
   Status Visit(const ExtensionType& type) { return Status::NotImplemented(type.name()); }
@@ -672,10 +679,22 @@ class ArrayWriter {
     return Status::OK();
   }
 
+  Status Visit(const StringViewArray& array) {
+    return Status::NotImplemented(array.type()->name());
+  }
+
   Status Visit(const DictionaryArray& array) {
     return VisitArrayValues(*array.indices());
   }
 
+  Status Visit(const RunEndEncodedArray& array) {
+    // No validity, only the runs overlapping the array are written
+    ARROW_ASSIGN_OR_RAISE(auto run_ends, ree_util::MakeLogicalRunEnds(*array.data()));
+    auto values =
+        array.values()->Slice(array.FindPhysicalOffset(), array.FindPhysicalLength());
+    return WriteChildren(array.type()->fields(), {MakeArray(run_ends), values});
+  }
+
   template <typename ArrayType>
   enable_if_var_size_list<typename ArrayType::TypeClass, Status> Visit(
       const ArrayType& array) {
@@ -1027,6 +1046,14 @@ Status GetType(const RjObject& json_type,
     return GetFixedSizeList(json_type, children, type);
   } else if (type_name == "struct") {
     *type = struct_(children);
+  } else if (type_name == "runendencoded") {
+    if (children.size() != 2) {
+      return Status::Invalid("Run-end encoded type must have exactly two children");
+    }
+    if (!RunEndEncodedType::RunEndTypeValid(*children[0]->type())) {
+      return Status::Invalid("Run-end encoded run ends must be int16, int32 or int64");
+    }
+    *type = run_end_encoded(children[0]->type(), children[1]->type());
   } else if (type_name == "union") {
     return GetUnion(json_type, children, type);
   } else {
@@ -1291,6 +1318,8 @@ class ArrayReader {
     return FinishBuilder(&builder);
   }
 
+  Status Visit(const StringViewType& type) { return Status::NotImplemented(type.name()); }
+
   Status Visit(const DayTimeIntervalType& type) {
     DayTimeIntervalBuilder builder(pool_);
 
@@ -1452,6 +1481,12 @@ class ArrayReader {
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& type) {
+    RETURN_NOT_OK(InitializeData(1));
+    data_->null_count = 0;
+    return GetChildren(obj_, type);
+  }
+
   Status GetUnionTypeIds() {
     ARROW_ASSIGN_OR_RAISE(const auto json_type_ids, GetMemberArray(obj_, "TYPE_ID"));
     return GetIntArray<uint8_t>(json_type_ids, length_, &data_->buffers[1]);
@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstddef>
 #include <limits>
+#include <mutex>
 #include <ostream>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
@@ -62,6 +63,8 @@ constexpr Type::type StringType::type_id;
 
 constexpr Type::type LargeStringType::type_id;
 
+constexpr Type::type StringViewType::type_id;
+
 constexpr Type::type FixedSizeBinaryType::type_id;
 
 constexpr Type::type StructType::type_id;
@@ -92,6 +95,8 @@ constexpr Type::type DurationType::type_id;
 
 constexpr Type::type DictionaryType::type_id;
 
+constexpr Type::type RunEndEncodedType::type_id;
+
 namespace internal {
 
 struct TypeIdToTypeNameVisitor {
@@ -144,6 +149,7 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(BINARY)
     TO_STRING_CASE(LARGE_STRING)
     TO_STRING_CASE(LARGE_BINARY)
+    TO_STRING_CASE(STRING_VIEW)
     TO_STRING_CASE(FIXED_SIZE_BINARY)
     TO_STRING_CASE(STRUCT)
     TO_STRING_CASE(LIST)
@@ -153,6 +159,7 @@ std::string ToString(Type::type id) {
     TO_STRING_CASE(DENSE_UNION)
     TO_STRING_CASE(SPARSE_UNION)
     TO_STRING_CASE(DICTIONARY)
+    TO_STRING_CASE(RUN_END_ENCODED)
     TO_STRING_CASE(EXTENSION)
 
 #undef TO_STRING_CASE
@@ -491,6 +498,8 @@ std::string StringType::ToString() const { return "string"; }
 
 std::string LargeStringType::ToString() const { return "large_string"; }
 
+std::string StringViewType::ToString() const { return "string_view"; }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 Result<std::shared_ptr<DataType>> FixedSizeBinaryType::Make(int32_t byte_width) {
@@ -870,6 +879,45 @@ std::string DictionaryType::ToString() const {
   return ss.str();
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+RunEndEncodedType::RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                                     std::shared_ptr<DataType> value_type)
+    : NestedType(Type::RUN_END_ENCODED) {
+  DCHECK(RunEndTypeValid(*run_end_type));
+  children_ = {std::make_shared<Field>("run_ends", std::move(run_end_type), false),
+               std::make_shared<Field>("values", std::move(value_type), true)};
+}
+
+Result<std::shared_ptr<DataType>> RunEndEncodedType::Make(
+    std::shared_ptr<DataType> run_end_type, std::shared_ptr<DataType> value_type) {
+  if (!RunEndTypeValid(*run_end_type)) {
+    return Status::TypeError("Run end type should be int16, int32 or int64, got ",
+                             run_end_type->ToString());
+  }
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
+bool RunEndEncodedType::RunEndTypeValid(const DataType& run_end_type) {
+  switch (run_end_type.id()) {
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::string RunEndEncodedType::ToString() const {
+  std::stringstream ss;
+  ss << this->name() << "<run_ends: " << run_end_type()->ToString()
+     << ", values: " << value_type()->ToString() << ">";
+  return ss.str();
+}
+
 // ----------------------------------------------------------------------
 // Null type
 
@@ -1312,17 +1360,36 @@ std::string EndiannessToString(Endianness endianness) {
 
 class Schema::Impl {
  public:
+  using NameToIndexMap = std::unordered_multimap<std::string, int>;
+
   Impl(std::vector<std::shared_ptr<Field>> fields, Endianness endianness,
        std::shared_ptr<const KeyValueMetadata> metadata)
       : fields_(std::move(fields)),
         endianness_(endianness),
-        name_to_index_(CreateNameToIndexMap(fields_)),
         metadata_(std::move(metadata)) {}
 
+  // A copy builds its own lookup map when first needed
+  Impl(const Impl& other)
+      : fields_(other.fields_),
+        endianness_(other.endianness_),
+        metadata_(other.metadata_) {}
+
+  // The name lookup map is built on first use, so that schemas derived with
+  // AddField / SetField / RemoveField don't pay for it unless looked up by name.
+  // Once built, lookups only pay for the fast path of std::call_once.
+  const NameToIndexMap& name_to_index() const {
+    std::call_once(name_to_index_built_,
+                   [this] { name_to_index_ = CreateNameToIndexMap(fields_); });
+    return name_to_index_;
+  }
+
   std::vector<std::shared_ptr<Field>> fields_;
   Endianness endianness_;
-  std::unordered_multimap<std::string, int> name_to_index_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+
+ private:
+  mutable std::once_flag name_to_index_built_;
+  mutable NameToIndexMap name_to_index_;
 };
 
 Schema::Schema(std::vector<std::shared_ptr<Field>> fields, Endianness endianness,
@@ -1414,12 +1481,12 @@ std::shared_ptr<Field> Schema::GetFieldByName(const std::string& name) const {
 }
 
 int Schema::GetFieldIndex(const std::string& name) const {
-  return LookupNameIndex(impl_->name_to_index_, name);
+  return LookupNameIndex(impl_->name_to_index(), name);
 }
 
 std::vector<int> Schema::GetAllFieldIndices(const std::string& name) const {
   std::vector<int> result;
-  auto p = impl_->name_to_index_.equal_range(name);
+  auto p = impl_->name_to_index().equal_range(name);
   for (auto it = p.first; it != p.second; ++it) {
     result.push_back(it->second);
   }
@@ -1443,7 +1510,7 @@ Status Schema::CanReferenceFieldsByNames(const std::vector<std::string>& names)
 std::vector<std::shared_ptr<Field>> Schema::GetAllFieldsByName(
     const std::string& name) const {
   std::vector<std::shared_ptr<Field>> result;
-  auto p = impl_->name_to_index_.equal_range(name);
+  auto p = impl_->name_to_index().equal_range(name);
   for (auto it = p.first; it != p.second; ++it) {
     result.push_back(impl_->fields_[it->second]);
   }
@@ -1919,6 +1986,7 @@ PARAMETER_LESS_FINGERPRINT(Binary)
 PARAMETER_LESS_FINGERPRINT(LargeBinary)
 PARAMETER_LESS_FINGERPRINT(String)
 PARAMETER_LESS_FINGERPRINT(LargeString)
+PARAMETER_LESS_FINGERPRINT(StringView)
 PARAMETER_LESS_FINGERPRINT(Date32)
 PARAMETER_LESS_FINGERPRINT(Date64)
 
@@ -1937,6 +2005,16 @@ std::string DictionaryType::ComputeFingerprint() const {
   return ordered_fingerprint;
 }
 
+std::string RunEndEncodedType::ComputeFingerprint() const {
+  const auto& run_end_fingerprint = run_end_type()->fingerprint();
+  const auto& value_fingerprint = value_type()->fingerprint();
+  if (!value_fingerprint.empty()) {
+    return TypeIdFingerprint(*this) + run_end_fingerprint + "{" + value_fingerprint +
+           "}";
+  }
+  return "";
+}
+
 std::string ListType::ComputeFingerprint() const {
   const auto& child_fingerprint = children_[0]->fingerprint();
   if (!child_fingerprint.empty()) {
@@ -2086,6 +2164,7 @@ TYPE_FACTORY(float32, FloatType)
 TYPE_FACTORY(float64, DoubleType)
 TYPE_FACTORY(utf8, StringType)
 TYPE_FACTORY(large_utf8, LargeStringType)
+TYPE_FACTORY(utf8_view, StringViewType)
 TYPE_FACTORY(binary, BinaryType)
 TYPE_FACTORY(large_binary, LargeBinaryType)
 TYPE_FACTORY(date64, Date64Type)
@@ -2226,6 +2305,12 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
   return std::make_shared<DictionaryType>(index_type, dict_type, ordered);
 }
 
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type) {
+  return std::make_shared<RunEndEncodedType>(std::move(run_end_type),
+                                             std::move(value_type));
+}
+
 std::shared_ptr<Field> field(std::string name, std::shared_ptr<DataType> type,
                              bool nullable,
                              std::shared_ptr<const KeyValueMetadata> metadata) {
@@ -32,6 +32,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/variant.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor.h"  // IWYU pragma: keep
@@ -97,6 +98,9 @@ struct ARROW_EXPORT DataTypeLayout {
   std::vector<BufferSpec> buffers;
   /// Whether this type expects an associated dictionary array.
   bool has_dictionary = false;
+  /// If set, any number of buffers following this specification can come
+  /// after the ones in `buffers` (e.g. the data buffers of a string view array)
+  util::optional<BufferSpec> variadic_spec;
 
   explicit DataTypeLayout(std::vector<BufferSpec> v) : buffers(std::move(v)) {}
 };
@@ -802,6 +806,61 @@ class ARROW_EXPORT LargeStringType : public LargeBinaryType {
   std::string ComputeFingerprint() const override;
 };
 
+/// \brief Concrete type class for utf8-encoded string data stored as views
+///
+/// Each value is a 16-byte view (see c_type) starting with the string size.
+/// Strings of up to 12 bytes are stored inline in the view.  Longer strings
+/// are stored in one of the array's data buffers (the buffers following the
+/// views buffer), and their view holds their first 4 bytes, the index of that
+/// data buffer and their offset in it.
+///
+/// Since the views don't need to be contiguous nor ordered in the data
+/// buffers, selecting or reordering strings only moves their views, and most
+/// comparisons are decided on the inline prefix without dereferencing data.
+class ARROW_EXPORT StringViewType : public DataType {
+ public:
+  static constexpr Type::type type_id = Type::STRING_VIEW;
+  static constexpr bool is_utf8 = true;
+  using PhysicalType = StringViewType;
+
+  static constexpr int kInlineSize = 12;
+  static constexpr int kPrefixSize = 4;
+
+  /// \brief The 16-byte view of a string
+  union c_type {
+    struct {
+      int32_t size;
+      uint8_t data[kInlineSize];
+    } inlined;
+    struct {
+      int32_t size;
+      uint8_t prefix[kPrefixSize];
+      int32_t buffer_index;
+      int32_t offset;
+    } ref;
+
+    int32_t size() const { return inlined.size; }
+    bool is_inline() const { return inlined.size <= kInlineSize; }
+  };
+
+  static constexpr const char* type_name() { return "utf8_view"; }
+
+  StringViewType() : DataType(Type::STRING_VIEW) {}
+
+  DataTypeLayout layout() const override {
+    DataTypeLayout layout(
+        {DataTypeLayout::Bitmap(), DataTypeLayout::FixedWidth(sizeof(c_type))});
+    layout.variadic_spec = DataTypeLayout::VariableWidth();
+    return layout;
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "utf8_view"; }
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 /// \brief Concrete type class for fixed-size binary data
 class ARROW_EXPORT FixedSizeBinaryType : public FixedWidthType, public ParametricType {
  public:
@@ -1392,6 +1451,46 @@ class ARROW_EXPORT DictionaryType : public FixedWidthType {
   bool ordered_;
 };
 
+// ----------------------------------------------------------------------
+// Run-end encoded type
+
+/// \brief Type class for run-end encoded data
+///
+/// A run-end encoded array has no buffers of its own, only two children: the
+/// run ends, a strictly increasing array of (int16, int32 or int64) logical
+/// positions where each run stops, and the values, holding one value per run.
+/// Long runs of equal values thus only cost one value.
+class ARROW_EXPORT RunEndEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_END_ENCODED;
+
+  static constexpr const char* type_name() { return "run_end_encoded"; }
+
+  RunEndEncodedType(std::shared_ptr<DataType> run_end_type,
+                    std::shared_ptr<DataType> value_type);
+
+  // A constructor variant that validates its input parameters
+  static Result<std::shared_ptr<DataType>> Make(std::shared_ptr<DataType> run_end_type,
+                                                std::shared_ptr<DataType> value_type);
+
+  DataTypeLayout layout() const override {
+    // A run-end encoded array has no validity bitmap: nulls are values of runs
+    return DataTypeLayout({DataTypeLayout::AlwaysNull()});
+  }
+
+  std::string ToString() const override;
+  std::string name() const override { return "run_end_encoded"; }
+
+  const std::shared_ptr<DataType>& run_end_type() const { return children_[0]->type(); }
+  const std::shared_ptr<DataType>& value_type() const { return children_[1]->type(); }
+
+  /// \brief Whether the type can be used for run ends (int16, int32 or int64)
+  static bool RunEndTypeValid(const DataType& run_end_type);
+
+ protected:
+  std::string ComputeFingerprint() const override;
+};
+
 // ----------------------------------------------------------------------
 // FieldRef
 
@@ -1560,6 +1659,11 @@ class ARROW_EXPORT FieldRef {
   const std::string* name() const {
     return IsName() ? &util::get<std::string>(impl_) : NULLPTR;
   }
+  const std::vector<FieldRef>* nested_refs() const {
+    return util::holds_alternative<std::vector<FieldRef>>(impl_)
+               ? &util::get<std::vector<FieldRef>>(impl_)
+               : NULLPTR;
+  }
 
   /// \brief Retrieve FieldPath of every child field which matches this FieldRef.
   std::vector<FieldPath> FindAll(const Schema& schema) const;
@@ -1903,6 +2007,7 @@ static inline bool HasValidityBitmap(Type::type id) {
     case Type::NA:
     case Type::DENSE_UNION:
     case Type::SPARSE_UNION:
+    case Type::RUN_END_ENCODED:
       return false;
     default:
       return true;
@@ -125,6 +125,16 @@ class LargeStringArray;
 class LargeStringBuilder;
 struct LargeStringScalar;
 
+class StringViewType;
+class StringViewArray;
+class StringViewBuilder;
+struct StringViewScalar;
+
+class RunEndEncodedType;
+class RunEndEncodedArray;
+class RunEndEncodedBuilder;
+struct RunEndEncodedScalar;
+
 class ListType;
 class ListArray;
 class ListBuilder;
@@ -391,6 +401,14 @@ struct Type {
     /// Like LIST, but with 64-bit offsets
     LARGE_LIST,
 
+    /// Like STRING, but stored as 16-byte views holding a prefix of the
+    /// string and a reference to its data
+    STRING_VIEW,
+
+    /// Run-end encoded logical values, stored as a child array of run ends
+    /// and a child array of values holding one value per run
+    RUN_END_ENCODED,
+
     // Leave this at the end
     MAX_ID
   };
@@ -431,6 +449,8 @@ std::shared_ptr<DataType> ARROW_EXPORT float64();
 std::shared_ptr<DataType> ARROW_EXPORT utf8();
 /// \brief Return a LargeStringType instance
 std::shared_ptr<DataType> ARROW_EXPORT large_utf8();
+/// \brief Return a StringViewType instance
+std::shared_ptr<DataType> ARROW_EXPORT utf8_view();
 /// \brief Return a BinaryType instance
 std::shared_ptr<DataType> ARROW_EXPORT binary();
 /// \brief Return a LargeBinaryType instance
@@ -618,6 +638,14 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
                                      const std::shared_ptr<DataType>& dict_type,
                                      bool ordered = false);
 
+/// \brief Create a RunEndEncodedType instance
+/// \param[in] run_end_type the type of the run ends (must be int16, int32
+/// or int64)
+/// \param[in] value_type the type of the run values
+ARROW_EXPORT
+std::shared_ptr<DataType> run_end_encoded(std::shared_ptr<DataType> run_end_type,
+                                          std::shared_ptr<DataType> value_type);
+
 /// @}
 
 /// \defgroup schema-factories Factory functions for fields and schemas
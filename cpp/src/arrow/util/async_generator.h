@@ -17,9 +17,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <deque>
 #include <queue>
+#include <thread>
 
 #include "arrow/util/functional.h"
 #include "arrow/util/future.h"
@@ -858,6 +860,40 @@ AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source_generator,
   return ReadaheadGenerator<T>(std::move(source_generator), max_readahead);
 }
 
+/// \brief Creates a generator that fails with the given status on its first call
+///
+/// This generator is not async-reentrant
+template <typename T>
+AsyncGenerator<T> MakeFailingGenerator(Status st) {
+  assert(!st.ok());
+  auto state = std::make_shared<Status>(std::move(st));
+  return [state]() -> Future<T> {
+    auto st = std::move(*state);
+    if (!st.ok()) {
+      return std::move(st);
+    } else {
+      return AsyncGeneratorEnd<T>();
+    }
+  };
+}
+
+/// \brief Creates a generator that yields the result of a single future
+///
+/// This generator is not async-reentrant
+template <typename T>
+AsyncGenerator<T> MakeSingleFutureGenerator(Future<T> future) {
+  assert(future.is_valid());
+  auto state = std::make_shared<Future<T>>(std::move(future));
+  return [state]() -> Future<T> {
+    auto fut = std::move(*state);
+    if (fut.is_valid()) {
+      return fut;
+    } else {
+      return AsyncGeneratorEnd<T>();
+    }
+  };
+}
+
 /// \brief Creates a generator that will yield finished futures from a vector
 ///
 /// This generator is async-reentrant
@@ -889,31 +925,30 @@ class MergedGenerator {
       : state_(std::make_shared<State>(std::move(source), max_subscriptions)) {}
 
   Future<T> operator()() {
-    Future<T> waiting_future;
-    std::shared_ptr<DeliveredJob> delivered_job;
-    {
-      auto guard = state_->mutex.Lock();
-      if (!state_->delivered_jobs.empty()) {
-        delivered_job = std::move(state_->delivered_jobs.front());
-        state_->delivered_jobs.pop_front();
-      } else if (state_->finished) {
-        return IterationTraits<T>::End();
-      } else {
-        waiting_future = Future<T>::Make();
-        state_->waiting_jobs.push_back(std::make_shared<Future<T>>(waiting_future));
+    if (state_->balance.fetch_sub(1) > 0) {
+      // A result was delivered, though its producer may still be pushing it
+      DeliveredJob delivered_job;
+      while (!state_->delivered_jobs.TryPop(&delivered_job)) {
+        std::this_thread::yield();
       }
-    }
-    if (delivered_job) {
       // deliverer will be invalid if outer callback encounters an error and delivers a
       // failed result
-      if (delivered_job->deliverer) {
-        delivered_job->deliverer().AddCallback(
-            InnerCallback{state_, delivered_job->index});
+      if (delivered_job.deliverer) {
+        delivered_job.deliverer().AddCallback(
+            InnerCallback{state_, delivered_job.index});
       }
-      return std::move(delivered_job->value);
+      return std::move(delivered_job.value);
     }
-    if (state_->first) {
-      state_->first = false;
+    Future<T> waiting_future;
+    {
+      auto guard = state_->waiting_mutex.Lock();
+      if (state_->finished.load()) {
+        return IterationTraits<T>::End();
+      }
+      waiting_future = Future<T>::Make();
+      state_->waiting_jobs.push_back(waiting_future);
+    }
+    if (state_->first.exchange(false)) {
       for (std::size_t i = 0; i < state_->active_subscriptions.size(); i++) {
         state_->source().AddCallback(OuterCallback{state_, i});
       }
@@ -923,64 +958,96 @@ class MergedGenerator {
 
  private:
   struct DeliveredJob {
-    explicit DeliveredJob(AsyncGenerator<T> deliverer_, Result<T> value_,
-                          std::size_t index_)
-        : deliverer(deliverer_), value(std::move(value_)), index(index_) {}
+    DeliveredJob() = default;
+    DeliveredJob(AsyncGenerator<T> deliverer_, Result<T> value_, std::size_t index_)
+        : deliverer(std::move(deliverer_)), value(std::move(value_)), index(index_) {}
 
     AsyncGenerator<T> deliverer;
     Result<T> value;
-    std::size_t index;
+    std::size_t index = 0;
   };
 
+  // Consumers and producers meet through `balance`: the number of results
+  // delivered to delivered_jobs, minus the number of consumers waiting in
+  // waiting_jobs.  Whoever finds the other side ahead takes from its queue, so
+  // that while results are ahead of consumers, as in a readahead pipeline, they
+  // are exchanged without taking a lock.
   struct State {
     State(AsyncGenerator<AsyncGenerator<T>> source, int max_subscriptions)
         : source(std::move(source)),
           active_subscriptions(max_subscriptions),
-          delivered_jobs(),
-          waiting_jobs(),
-          mutex(),
-          first(true),
-          source_exhausted(false),
-          finished(false),
+          delivered_jobs(max_subscriptions + 1),
           num_active_subscriptions(max_subscriptions) {}
 
+    // Hand a result over to a waiting consumer, returned in `sink`, or queue it for
+    // the next one.  Returns false if there is no sink to mark finished.
+    bool Deliver(const AsyncGenerator<T>& deliverer, const Result<T>& value,
+                 std::size_t index, Future<T>* sink) {
+      if (balance.fetch_add(1) >= 0) {
+        DeliveredJob job(deliverer, value, index);
+        // Can't be full: a subscription has at most one result delivered at a time
+        while (!delivered_jobs.TryPush(std::move(job))) {
+          std::this_thread::yield();
+        }
+        return false;
+      }
+      // A consumer is waiting, or about to
+      while (true) {
+        {
+          auto guard = waiting_mutex.Lock();
+          if (!waiting_jobs.empty()) {
+            *sink = std::move(waiting_jobs.front());
+            waiting_jobs.pop_front();
+            return true;
+          }
+          if (finished.load()) {
+            // The consumer got the end of the stream instead
+            return false;
+          }
+        }
+        std::this_thread::yield();
+      }
+    }
+
+    // End the stream for waiting and future consumers
+    void Finish() {
+      std::deque<Future<T>> purged;
+      {
+        auto guard = waiting_mutex.Lock();
+        finished.store(true);
+        purged.swap(waiting_jobs);
+      }
+      for (auto& waiting_job : purged) {
+        waiting_job.MarkFinished(IterationTraits<T>::End());
+      }
+    }
+
     AsyncGenerator<AsyncGenerator<T>> source;
     // active_subscriptions and delivered_jobs will be bounded by max_subscriptions
     std::vector<AsyncGenerator<T>> active_subscriptions;
-    std::deque<std::shared_ptr<DeliveredJob>> delivered_jobs;
+    util::MpmcQueue<DeliveredJob> delivered_jobs;
     // waiting_jobs is unbounded, reentrant pulls (e.g. AddReadahead) will provide the
     // backpressure
-    std::deque<std::shared_ptr<Future<T>>> waiting_jobs;
-    util::Mutex mutex;
-    bool first;
-    bool source_exhausted;
-    bool finished;
-    int num_active_subscriptions;
+    std::deque<Future<T>> waiting_jobs;
+    util::Mutex waiting_mutex;
+    std::atomic<int64_t> balance{0};
+    std::atomic<bool> first{true};
+    std::atomic<bool> finished{false};
+    std::atomic<int> num_active_subscriptions;
   };
 
   struct InnerCallback {
     void operator()(const Result<T>& maybe_next) {
-      Future<T> sink;
-      bool sub_finished = maybe_next.ok() && IsIterationEnd(*maybe_next);
-      {
-        auto guard = state->mutex.Lock();
-        if (state->finished) {
-          // We've errored out so just ignore this result and don't keep pumping
-          return;
-        }
-        if (!sub_finished) {
-          if (state->waiting_jobs.empty()) {
-            state->delivered_jobs.push_back(std::make_shared<DeliveredJob>(
-                state->active_subscriptions[index], maybe_next, index));
-          } else {
-            sink = std::move(*state->waiting_jobs.front());
-            state->waiting_jobs.pop_front();
-          }
-        }
+      if (state->finished.load()) {
+        // We've errored out so just ignore this result and don't keep pumping
+        return;
       }
-      if (sub_finished) {
+      if (maybe_next.ok() && IsIterationEnd(*maybe_next)) {
         state->source().AddCallback(OuterCallback{state, index});
-      } else if (sink.is_valid()) {
+        return;
+      }
+      Future<T> sink;
+      if (state->Deliver(state->active_subscriptions[index], maybe_next, index, &sink)) {
         sink.MarkFinished(maybe_next);
         if (maybe_next.ok()) {
           state->active_subscriptions[index]().AddCallback(*this);
@@ -993,43 +1060,18 @@ class MergedGenerator {
 
   struct OuterCallback {
     void operator()(const Result<AsyncGenerator<T>>& maybe_next) {
-      bool should_purge = false;
-      bool should_continue = false;
-      Future<T> error_sink;
-      {
-        auto guard = state->mutex.Lock();
-        if (!maybe_next.ok() || IsIterationEnd(*maybe_next)) {
-          state->source_exhausted = true;
-          if (!maybe_next.ok() || --state->num_active_subscriptions == 0) {
-            state->finished = true;
-            should_purge = true;
-          }
-          if (!maybe_next.ok()) {
-            if (state->waiting_jobs.empty()) {
-              state->delivered_jobs.push_back(std::make_shared<DeliveredJob>(
-                  AsyncGenerator<T>(), maybe_next.status(), index));
-            } else {
-              error_sink = std::move(*state->waiting_jobs.front());
-              state->waiting_jobs.pop_front();
-            }
-          }
-        } else {
-          state->active_subscriptions[index] = *maybe_next;
-          should_continue = true;
-        }
-      }
-      if (error_sink.is_valid()) {
-        error_sink.MarkFinished(maybe_next.status());
-      }
-      if (should_continue) {
+      if (maybe_next.ok() && !IsIterationEnd(*maybe_next)) {
+        state->active_subscriptions[index] = *maybe_next;
         (*maybe_next)().AddCallback(InnerCallback{state, index});
-      } else if (should_purge) {
-        // At this point state->finished has been marked true so no one else
-        // will be interacting with waiting_jobs and we can iterate outside lock
-        while (!state->waiting_jobs.empty()) {
-          state->waiting_jobs.front()->MarkFinished(IterationTraits<T>::End());
-          state->waiting_jobs.pop_front();
+      } else if (!maybe_next.ok()) {
+        Future<T> error_sink;
+        if (state->Deliver(AsyncGenerator<T>(), maybe_next.status(), index,
+                           &error_sink)) {
+          error_sink.MarkFinished(maybe_next.status());
         }
+        state->Finish();
+      } else if (--state->num_active_subscriptions == 0) {
+        state->Finish();
       }
     }
     std::shared_ptr<State> state;
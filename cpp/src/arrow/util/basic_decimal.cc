@@ -1333,6 +1333,12 @@ BasicDecimal256 operator+(const BasicDecimal256& left, const BasicDecimal256& ri
   return sum;
 }
 
+BasicDecimal256 operator-(const BasicDecimal256& left, const BasicDecimal256& right) {
+  BasicDecimal256 result = left;
+  result -= right;
+  return result;
+}
+
 BasicDecimal256 operator/(const BasicDecimal256& left, const BasicDecimal256& right) {
   BasicDecimal256 remainder;
   BasicDecimal256 result;
@@ -334,6 +334,8 @@ ARROW_EXPORT BasicDecimal256 operator-(const BasicDecimal256& operand);
 ARROW_EXPORT BasicDecimal256 operator~(const BasicDecimal256& operand);
 ARROW_EXPORT BasicDecimal256 operator+(const BasicDecimal256& left,
                                        const BasicDecimal256& right);
+ARROW_EXPORT BasicDecimal256 operator-(const BasicDecimal256& left,
+                                       const BasicDecimal256& right);
 ARROW_EXPORT BasicDecimal256 operator*(const BasicDecimal256& left,
                                        const BasicDecimal256& right);
 ARROW_EXPORT BasicDecimal256 operator/(const BasicDecimal256& left,
@@ -19,10 +19,12 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 #include "arrow/buffer.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace internal {
@@ -37,6 +39,20 @@ BitBlockCount BitBlockCounter::GetBlockSlow(int64_t block_size) noexcept {
   return {run_length, popcount};
 }
 
+constexpr int64_t BitmapSummary::kChunkBits;
+
+BitmapSummary::BitmapSummary(const uint8_t* bitmap, int64_t offset, int64_t length)
+    : bitmap_(bitmap), offset_(offset), length_(length), popcount_(0) {
+  const int64_t num_chunks = BitUtil::CeilDiv(length, kChunkBits);
+  chunk_popcounts_.resize(static_cast<size_t>(num_chunks));
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    const int64_t popcount =
+        CountSetBits(bitmap, offset + i * kChunkBits, chunk_length(i));
+    chunk_popcounts_[i] = static_cast<uint16_t>(popcount);
+    popcount_ += popcount;
+  }
+}
+
 // Prevent pointer arithmetic on nullptr, which is undefined behavior even if the pointer
 // is never dereferenced.
 inline const uint8_t* EnsureNotNull(const uint8_t* ptr) {
@@ -56,6 +72,40 @@ OptionalBitBlockCounter::OptionalBitBlockCounter(
     : OptionalBitBlockCounter(validity_bitmap ? validity_bitmap->data() : nullptr, offset,
                               length) {}
 
+OptionalBitBlockCounter::OptionalBitBlockCounter(const uint8_t* validity_bitmap,
+                                                 int64_t offset, int64_t length,
+                                                 const BitmapSummary* summary)
+    : OptionalBitBlockCounter(validity_bitmap, offset, length) {
+  DCHECK(summary == nullptr || summary->Describes(validity_bitmap, offset, length));
+  summary_ = summary;
+}
+
+BitBlockCount OptionalBitBlockCounter::NextSummarizedBlock() {
+  constexpr int64_t kMaxChunks =
+      std::numeric_limits<int16_t>::max() / BitmapSummary::kChunkBits;
+  const int64_t first_chunk = position_ / BitmapSummary::kChunkBits;
+  const int64_t end_chunk = std::min(first_chunk + kMaxChunks, summary_->num_chunks());
+
+  // Merge the following chunks with the same bits
+  int64_t length = 0;
+  int64_t popcount = 0;
+  for (int64_t i = first_chunk; i < end_chunk; ++i) {
+    const int64_t chunk_popcount = summary_->chunk_popcount(i);
+    const bool chunk_uniform =
+        chunk_popcount == 0 || chunk_popcount == summary_->chunk_length(i);
+    if (!chunk_uniform || (length > 0 && (chunk_popcount == 0) != (popcount == 0))) {
+      break;
+    }
+    length += summary_->chunk_length(i);
+    popcount += chunk_popcount;
+  }
+  if (length == 0) {
+    return counter_.NextBlock();
+  }
+  counter_.Skip(length);
+  return {static_cast<int16_t>(length), static_cast<int16_t>(popcount)};
+}
+
 OptionalBinaryBitBlockCounter::OptionalBinaryBitBlockCounter(const uint8_t* left_bitmap,
                                                              int64_t left_offset,
                                                              const uint8_t* right_bitmap,
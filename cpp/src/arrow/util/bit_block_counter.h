@@ -21,10 +21,12 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/ubsan.h"
@@ -182,6 +184,43 @@ class ARROW_EXPORT BitBlockCounter {
     return {64, static_cast<int16_t>(popcount)};
   }
 
+  /// \brief Like NextWord, but if the next word is all set or all unset, the
+  /// returned block extends over the following words with the same bits, up
+  /// to a length of INT16_MAX. This skips long runs of valid or null values
+  /// in a single step.
+  BitBlockCount NextBlock() {
+    BitBlockCount block = NextWord();
+    if (ARROW_PREDICT_FALSE(block.popcount == 0 || block.popcount == kWordBits) &&
+        block.length == kWordBits) {
+      // Whole words equal to the block's word continue the run.  Those are
+      // found among the aligned words at bitmap_: with a bit offset, a shifted
+      // word straddles two aligned words, so the last uniform aligned word
+      // can't be included.
+      constexpr int64_t kMaxExtraWords =
+          std::numeric_limits<int16_t>::max() / kWordBits - 1;
+      const int64_t shifted = offset_ != 0 ? 1 : 0;
+      const int64_t max_words =
+          std::min((offset_ + bits_remaining_) / kWordBits, kMaxExtraWords + shifted);
+      const int64_t extra_words =
+          CountUniformWords(bitmap_, max_words, block.popcount != 0) - shifted;
+      if (extra_words > 0) {
+        bitmap_ += extra_words * (kWordBits / 8);
+        bits_remaining_ -= extra_words * kWordBits;
+        block.length = static_cast<int16_t>(block.length + extra_words * kWordBits);
+        block.popcount = block.popcount != 0 ? block.length : 0;
+      }
+    }
+    return block;
+  }
+
+  /// \brief Skip the given number of bits
+  void Skip(int64_t nbits) {
+    nbits = std::min(nbits, bits_remaining_);
+    bitmap_ += (offset_ + nbits) / 8;
+    offset_ = (offset_ + nbits) % 8;
+    bits_remaining_ -= nbits;
+  }
+
  private:
   /// \brief Return block with the requested size when doing word-wise
   /// computation is not possible due to inadequate bits remaining.
@@ -192,6 +231,42 @@ class ARROW_EXPORT BitBlockCounter {
   int64_t offset_;
 };
 
+/// \brief A coarse summary of a bitmap: the number of set bits in each chunk of
+/// kChunkBits bits. Bitmap readers can skip all-set and all-unset chunks
+/// without reading the bitmap again.
+class ARROW_EXPORT BitmapSummary {
+ public:
+  static constexpr int64_t kChunkBits = 4096;
+
+  /// \brief Summarize `length` bits of `bitmap` starting at bit `offset`
+  BitmapSummary(const uint8_t* bitmap, int64_t offset, int64_t length);
+
+  /// \brief Whether the summary was computed over the given bitmap range
+  bool Describes(const uint8_t* bitmap, int64_t offset, int64_t length) const {
+    return bitmap == bitmap_ && offset == offset_ && length == length_;
+  }
+
+  int64_t length() const { return length_; }
+
+  /// \brief The total number of set bits
+  int64_t popcount() const { return popcount_; }
+
+  int64_t num_chunks() const { return static_cast<int64_t>(chunk_popcounts_.size()); }
+
+  int64_t chunk_length(int64_t i) const {
+    return std::min(kChunkBits, length_ - i * kChunkBits);
+  }
+
+  int64_t chunk_popcount(int64_t i) const { return chunk_popcounts_[i]; }
+
+ private:
+  const uint8_t* bitmap_;
+  int64_t offset_;
+  int64_t length_;
+  int64_t popcount_;
+  std::vector<uint16_t> chunk_popcounts_;
+};
+
 /// \brief A tool to iterate through a possibly non-existent validity bitmap,
 /// to allow us to write one code path for both the with-nulls and no-nulls
 /// cases without giving up a lot of performance.
@@ -204,13 +279,22 @@ class ARROW_EXPORT OptionalBitBlockCounter {
   OptionalBitBlockCounter(const std::shared_ptr<Buffer>& validity_bitmap, int64_t offset,
                           int64_t length);
 
-  /// Return block count for next word when the bitmap is available otherwise
-  /// return a block with length up to INT16_MAX when there is no validity
-  /// bitmap (so all the referenced values are not null).
+  // summary may be NULLPTR, otherwise it must describe the given bitmap range
+  OptionalBitBlockCounter(const uint8_t* validity_bitmap, int64_t offset, int64_t length,
+                          const BitmapSummary* summary);
+
+  /// Return block count for the next word or uniform run of words when the
+  /// bitmap is available otherwise return a block with length up to INT16_MAX
+  /// when there is no validity bitmap (so all the referenced values are not null).
   BitBlockCount NextBlock() {
     static constexpr int64_t kMaxBlockSize = std::numeric_limits<int16_t>::max();
     if (has_bitmap_) {
-      BitBlockCount block = counter_.NextWord();
+      BitBlockCount block;
+      if (summary_ != NULLPTR && position_ % BitmapSummary::kChunkBits == 0) {
+        block = NextSummarizedBlock();
+      } else {
+        block = counter_.NextBlock();
+      }
       position_ += block.length;
       return block;
     } else {
@@ -239,10 +323,15 @@ class ARROW_EXPORT OptionalBitBlockCounter {
   }
 
  private:
+  /// \brief Return the uniform chunks at position_ according to the summary,
+  /// falling back to the bit counter
+  BitBlockCount NextSummarizedBlock();
+
   const bool has_bitmap_;
   int64_t position_;
   int64_t length_;
   BitBlockCounter counter_;
+  const BitmapSummary* summary_ = NULLPTR;
 };
 
 /// \brief A class that computes popcounts on the result of bitwise operations
@@ -413,15 +502,16 @@ class ARROW_EXPORT OptionalBinaryBitBlockCounter {
 
 // Functional-style bit block visitors.
 
+// `summary` may be NULLPTR, otherwise it must describe the given bitmap range
 template <typename VisitNotNull, typename VisitNull>
 static Status VisitBitBlocks(const std::shared_ptr<Buffer>& bitmap_buf, int64_t offset,
-                             int64_t length, VisitNotNull&& visit_not_null,
-                             VisitNull&& visit_null) {
+                             int64_t length, const BitmapSummary* summary,
+                             VisitNotNull&& visit_not_null, VisitNull&& visit_null) {
   const uint8_t* bitmap = NULLPTR;
   if (bitmap_buf != NULLPTR) {
     bitmap = bitmap_buf->data();
   }
-  internal::OptionalBitBlockCounter bit_counter(bitmap, offset, length);
+  internal::OptionalBitBlockCounter bit_counter(bitmap, offset, length, summary);
   int64_t position = 0;
   while (position < length) {
     internal::BitBlockCount block = bit_counter.NextBlock();
@@ -446,15 +536,25 @@ static Status VisitBitBlocks(const std::shared_ptr<Buffer>& bitmap_buf, int64_t
   return Status::OK();
 }
 
+template <typename VisitNotNull, typename VisitNull>
+static Status VisitBitBlocks(const std::shared_ptr<Buffer>& bitmap_buf, int64_t offset,
+                             int64_t length, VisitNotNull&& visit_not_null,
+                             VisitNull&& visit_null) {
+  return VisitBitBlocks(bitmap_buf, offset, length, NULLPTR,
+                        std::forward<VisitNotNull>(visit_not_null),
+                        std::forward<VisitNull>(visit_null));
+}
+
+// `summary` may be NULLPTR, otherwise it must describe the given bitmap range
 template <typename VisitNotNull, typename VisitNull>
 static void VisitBitBlocksVoid(const std::shared_ptr<Buffer>& bitmap_buf, int64_t offset,
-                               int64_t length, VisitNotNull&& visit_not_null,
-                               VisitNull&& visit_null) {
+                               int64_t length, const BitmapSummary* summary,
+                               VisitNotNull&& visit_not_null, VisitNull&& visit_null) {
   const uint8_t* bitmap = NULLPTR;
   if (bitmap_buf != NULLPTR) {
     bitmap = bitmap_buf->data();
   }
-  internal::OptionalBitBlockCounter bit_counter(bitmap, offset, length);
+  internal::OptionalBitBlockCounter bit_counter(bitmap, offset, length, summary);
   int64_t position = 0;
   while (position < length) {
     internal::BitBlockCount block = bit_counter.NextBlock();
@@ -478,6 +578,15 @@ static void VisitBitBlocksVoid(const std::shared_ptr<Buffer>& bitmap_buf, int64_
   }
 }
 
+template <typename VisitNotNull, typename VisitNull>
+static void VisitBitBlocksVoid(const std::shared_ptr<Buffer>& bitmap_buf, int64_t offset,
+                               int64_t length, VisitNotNull&& visit_not_null,
+                               VisitNull&& visit_null) {
+  VisitBitBlocksVoid(bitmap_buf, offset, length, NULLPTR,
+                     std::forward<VisitNotNull>(visit_not_null),
+                     std::forward<VisitNull>(visit_null));
+}
+
 template <typename VisitNotNull, typename VisitNull>
 static void VisitTwoBitBlocksVoid(const std::shared_ptr<Buffer>& left_bitmap_buf,
                                   int64_t left_offset,
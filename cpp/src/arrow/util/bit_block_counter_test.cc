@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -206,6 +207,51 @@ TEST_F(TestBitBlockCounter, FourWordsRandomData) {
   }
 }
 
+// A bitmap with long runs of set and unset bits between random bits
+std::shared_ptr<Buffer> MakeRunsBitmap(int64_t nbits) {
+  auto bitmap = *AllocateBitmap(nbits);
+  random_bytes(bitmap->size(), 0, bitmap->mutable_data());
+  BitUtil::SetBitsTo(bitmap->mutable_data(), 100, 40000, true);
+  BitUtil::SetBitsTo(bitmap->mutable_data(), 40200, 70000, false);
+  BitUtil::SetBitsTo(bitmap->mutable_data(), 110300, 1000, true);
+  BitUtil::SetBitsTo(bitmap->mutable_data(), 111400, nbits - 111400, false);
+  return bitmap;
+}
+
+template <typename NextBlockFunc>
+void CheckUniformRuns(const uint8_t* bitmap, int64_t offset, int64_t length,
+                      NextBlockFunc&& next_block) {
+  int64_t position = 0;
+  int64_t num_blocks = 0;
+  while (true) {
+    BitBlockCount block = next_block();
+    if (block.length == 0) {
+      break;
+    }
+    ASSERT_EQ(block.popcount, CountSetBits(bitmap, offset + position, block.length));
+    if (block.length > kWordSize) {
+      ASSERT_TRUE(block.AllSet() || block.NoneSet());
+    }
+    position += block.length;
+    ++num_blocks;
+  }
+  ASSERT_EQ(position, length);
+  // The long runs took a few blocks each
+  ASSERT_LT(num_blocks, 100);
+}
+
+TEST_F(TestBitBlockCounter, NextBlockRuns) {
+  const int64_t nbits = 150000;
+  auto bitmap = MakeRunsBitmap(nbits);
+  for (int64_t offset = 0; offset < 8; ++offset) {
+    SCOPED_TRACE("offset = " + std::to_string(offset));
+    const int64_t length = nbits - offset - 5;
+    BitBlockCounter counter(bitmap->data(), offset, length);
+    CheckUniformRuns(bitmap->data(), offset, length,
+                     [&]() { return counter.NextBlock(); });
+  }
+}
+
 template <template <typename T> class Op, typename NextWordFunc>
 void CheckBinaryBitBlockOp(NextWordFunc&& get_next_word) {
   const int64_t nbytes = 1024;
@@ -321,6 +367,25 @@ TEST(TestOptionalBitBlockCounter, NextWord) {
   ASSERT_EQ(optional_block.popcount, 0);
 }
 
+TEST(TestOptionalBitBlockCounter, NextBlockRuns) {
+  const int64_t nbits = 150000;
+  auto bitmap = MakeRunsBitmap(nbits);
+  for (int64_t offset : {0, 5, 64, 4099}) {
+    SCOPED_TRACE("offset = " + std::to_string(offset));
+    const int64_t length = nbits - offset - 5;
+    OptionalBitBlockCounter counter(bitmap->data(), offset, length);
+    CheckUniformRuns(bitmap->data(), offset, length,
+                     [&]() { return counter.NextBlock(); });
+
+    BitmapSummary summary(bitmap->data(), offset, length);
+    ASSERT_EQ(summary.popcount(), CountSetBits(bitmap->data(), offset, length));
+    ASSERT_EQ(summary.num_chunks(), BitUtil::CeilDiv(length, BitmapSummary::kChunkBits));
+    OptionalBitBlockCounter summarized_counter(bitmap->data(), offset, length, &summary);
+    CheckUniformRuns(bitmap->data(), offset, length,
+                     [&]() { return summarized_counter.NextBlock(); });
+  }
+}
+
 class TestOptionalBinaryBitBlockCounter : public ::testing::Test {
  public:
   void SetUp() {
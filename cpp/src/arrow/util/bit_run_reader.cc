@@ -20,6 +20,7 @@
 #include <cstdint>
 
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 
 namespace arrow {
 namespace internal {
@@ -48,6 +49,16 @@ BitRunReader::BitRunReader(const uint8_t* bitmap, int64_t start_offset, int64_t
   word_ = word_ & ~BitUtil::LeastSignificantBitMask(position_);
 }
 
+void BitRunReader::SkipRunWords() {
+  const int64_t num_words = (length_ - position_) / 64 - 1;
+  if (num_words > 0) {
+    const int64_t skipped =
+        CountUniformWords(bitmap_ + sizeof(uint64_t), num_words, current_run_bit_set_);
+    bitmap_ += skipped * sizeof(uint64_t);
+    position_ += skipped * 64;
+  }
+}
+
 #endif
 
 }  // namespace internal
@@ -128,10 +128,18 @@ class ARROW_EXPORT BitRunReader {
       new_bits = BitUtil::CountTrailingZeros(word_);
       // Continue calculating run length.
       position_ += new_bits;
+      if (new_bits == 64) {
+        // The whole word continues the run, skip any following ones which do
+        SkipRunWords();
+      }
     } while (ARROW_PREDICT_FALSE(BitUtil::IsMultipleOf64(position_)) &&
              ARROW_PREDICT_TRUE(position_ < length_) && new_bits > 0);
   }
 
+  // Advance over the whole words after the current one which continue the
+  // run, leaving at least one word for LoadNextWord().
+  void SkipRunWords();
+
   void LoadNextWord() { return LoadWord(length_ - position_); }
 
   // Helper method for Loading the next word.
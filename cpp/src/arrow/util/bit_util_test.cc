@@ -679,6 +679,34 @@ TEST(BitRunReader, ScalarComparison) {
   EXPECT_EQ(br_bits, brs_bits);
 }
 
+TEST(BitRunReader, LongRuns) {
+  ::arrow::random::RandomArrayGenerator rag(/*seed=*/23);
+  constexpr int64_t kNumBits = 100000;
+  std::shared_ptr<Buffer> buffer =
+      rag.Boolean(kNumBits, /*set_probability=*/.4)->data()->buffers[1];
+  uint8_t* bitmap = buffer->mutable_data();
+  BitUtil::SetBitsTo(bitmap, 1000, 20000, true);
+  BitUtil::SetBitsTo(bitmap, 21000, 65, false);
+  BitUtil::SetBitsTo(bitmap, 22000, 50000, false);
+  BitUtil::SetBitsTo(bitmap, 90000, kNumBits - 90000, true);
+
+  for (int64_t offset : {0, 3, 64, 1000}) {
+    SCOPED_TRACE("offset = " + std::to_string(offset));
+    const int64_t length = kNumBits - offset;
+    internal::BitRunReader reader(bitmap, offset, length);
+    internal::BitRunReaderLinear scalar_reader(bitmap, offset, length);
+    internal::BitRun br, brs;
+    do {
+      br = reader.NextRun();
+      brs = scalar_reader.NextRun();
+      ASSERT_EQ(br.length, brs.length);
+      if (br.length > 0) {
+        ASSERT_EQ(br, brs);
+      }
+    } while (brs.length != 0);
+  }
+}
+
 TEST(BitRunReader, TruncatedWithinWordMultipleOf8Bits) {
   std::vector<int> bm_vector;
   bm_vector.insert(bm_vector.end(), /*n=*/7, /*val=*/1);
@@ -1462,6 +1490,48 @@ TEST_F(BitmapOp, RandomXor) {
   }
 }
 
+TEST_F(BitmapOp, AndMany) {
+  const int kNumBitmaps = 5;
+  const int64_t kBitmapSize = 150;
+  std::vector<std::vector<uint8_t>> data(kNumBitmaps, std::vector<uint8_t>(kBitmapSize));
+  std::vector<const uint8_t*> all_bitmaps;
+  for (int k = 0; k < kNumBitmaps; ++k) {
+    random_bytes(kBitmapSize, k, data[k].data());
+    all_bitmaps.push_back(data[k].data());
+  }
+
+  for (int num_bitmaps = 0; num_bitmaps <= kNumBitmaps; ++num_bitmaps) {
+    const std::vector<const uint8_t*> bitmaps(all_bitmaps.begin(),
+                                              all_bitmaps.begin() + num_bitmaps);
+    for (int64_t first_offset : {0, 5, 8}) {
+      std::vector<int64_t> offsets;
+      for (int k = 0; k < num_bitmaps; ++k) {
+        offsets.push_back(first_offset + k * 7 % 13);
+      }
+      for (int64_t length : {0, 5, 130, 1000}) {
+        std::vector<int> expected(length);
+        for (int64_t i = 0; i < length; ++i) {
+          expected[i] = 1;
+          for (int k = 0; k < num_bitmaps; ++k) {
+            expected[i] &= BitUtil::GetBit(bitmaps[k], offsets[k] + i);
+          }
+        }
+        for (int64_t out_offset : {0, 3, 8, 67}) {
+          ASSERT_OK_AND_ASSIGN(auto out, BitmapAnd(default_memory_pool(), bitmaps,
+                                                   offsets, length, out_offset));
+          auto reader = internal::BitmapReader(out->data(), out_offset, length);
+          ASSERT_READER_VALUES(reader, expected);
+
+          std::memset(out->mutable_data(), 0, out->size());
+          BitmapAnd(bitmaps, offsets, length, out_offset, out->mutable_data());
+          reader = internal::BitmapReader(out->data(), out_offset, length);
+          ASSERT_READER_VALUES(reader, expected);
+        }
+      }
+    }
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -1902,24 +1972,51 @@ TEST(BitUtil, RoundUpToPowerOf2) {
 #undef U64
 #undef S64
 
-static void TestZigZag(int32_t v) {
+static void TestZigZag(int32_t v, std::vector<uint8_t> expected_bytes) {
   uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLength] = {};
   BitUtil::BitWriter writer(buffer, sizeof(buffer));
   BitUtil::BitReader reader(buffer, sizeof(buffer));
   writer.PutZigZagVlqInt(v);
+  EXPECT_EQ(expected_bytes,
+            std::vector<uint8_t>(buffer, buffer + writer.bytes_written()));
   int32_t result;
   EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
   EXPECT_EQ(v, result);
 }
 
 TEST(BitStreamUtil, ZigZag) {
-  TestZigZag(0);
-  TestZigZag(1);
-  TestZigZag(1234);
-  TestZigZag(-1);
-  TestZigZag(-1234);
-  TestZigZag(std::numeric_limits<int32_t>::max());
-  TestZigZag(-std::numeric_limits<int32_t>::max());
+  TestZigZag(0, {0});
+  TestZigZag(1, {2});
+  TestZigZag(1234, {0xA4, 0x13});
+  TestZigZag(-1, {1});
+  TestZigZag(-1234, {0xA3, 0x13});
+  TestZigZag(std::numeric_limits<int32_t>::max(), {0xFE, 0xFF, 0xFF, 0xFF, 0x0F});
+  TestZigZag(-std::numeric_limits<int32_t>::max(), {0xFD, 0xFF, 0xFF, 0xFF, 0x0F});
+  TestZigZag(std::numeric_limits<int32_t>::min(), {0xFF, 0xFF, 0xFF, 0xFF, 0x0F});
+}
+
+static void TestZigZag64(int64_t v, std::vector<uint8_t> expected_bytes) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  EXPECT_EQ(expected_bytes,
+            std::vector<uint8_t>(buffer, buffer + writer.bytes_written()));
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0, {0});
+  TestZigZag64(1, {2});
+  TestZigZag64(1234, {0xA4, 0x13});
+  TestZigZag64(-1, {1});
+  TestZigZag64(-1234, {0xA3, 0x13});
+  TestZigZag64(std::numeric_limits<int64_t>::max(),
+               {0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01});
+  TestZigZag64(std::numeric_limits<int64_t>::min(),
+               {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01});
 }
 
 TEST(BitUtil, RoundTripLittleEndianTest) {
@@ -17,10 +17,13 @@
 
 #include "arrow/util/bitmap_ops.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/result.h"
@@ -28,13 +31,98 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bitmap_ops_avx2.h"
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#include "arrow/util/bitmap_ops_avx512.h"
+#endif
+
 namespace arrow {
 namespace internal {
 
+namespace {
+
+int64_t count_set_bits_default(const uint8_t* data, int64_t nwords) {
+  const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(data);
+  DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
+  const uint64_t* end = u64_data + nwords;
+  int64_t count = 0;
+
+  constexpr int64_t kCountUnrollFactor = 4;
+  const int64_t words_rounded = BitUtil::RoundDown(nwords, kCountUnrollFactor);
+  int64_t count_unroll[kCountUnrollFactor] = {0};
+
+  // Unroll the loop for better performance
+  for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
+    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+      count_unroll[k] += BitUtil::PopCount(u64_data[k]);
+    }
+    u64_data += kCountUnrollFactor;
+  }
+  for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+    count += count_unroll[k];
+  }
+
+  // The trailing part
+  for (; u64_data < end; ++u64_data) {
+    count += BitUtil::PopCount(*u64_data);
+  }
+  return count;
+}
+
+struct CountSetBitsDynamicFunction {
+  using FunctionType = decltype(&count_set_bits_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, count_set_bits_default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, count_set_bits_avx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, count_set_bits_avx512 }
+#endif
+    };
+  }
+};
+
+int64_t count_uniform_words_default(const uint8_t* data, int64_t nwords, uint64_t word) {
+  int64_t i = 0;
+  while (i < nwords && util::SafeLoadAs<uint64_t>(data + i * 8) == word) {
+    ++i;
+  }
+  return i;
+}
+
+struct CountUniformWordsDynamicFunction {
+  using FunctionType = decltype(&count_uniform_words_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, count_uniform_words_default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, count_uniform_words_avx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, count_uniform_words_avx512 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+int64_t CountUniformWords(const uint8_t* data, int64_t nwords, bool set) {
+  static DynamicDispatch<CountUniformWordsDynamicFunction> dispatch;
+  return dispatch.func(data, nwords, set ? ~uint64_t(0) : 0);
+}
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -49,29 +137,8 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 
   if (p.aligned_words > 0) {
     // popcount as much as possible with the widest possible count
-    const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(p.aligned_start);
-    DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
-    const uint64_t* end = u64_data + p.aligned_words;
-
-    constexpr int64_t kCountUnrollFactor = 4;
-    const int64_t words_rounded = BitUtil::RoundDown(p.aligned_words, kCountUnrollFactor);
-    int64_t count_unroll[kCountUnrollFactor] = {0};
-
-    // Unroll the loop for better performance
-    for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
-      for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-        count_unroll[k] += BitUtil::PopCount(u64_data[k]);
-      }
-      u64_data += kCountUnrollFactor;
-    }
-    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-      count += count_unroll[k];
-    }
-
-    // The trailing part
-    for (; u64_data < end; ++u64_data) {
-      count += BitUtil::PopCount(*u64_data);
-    }
+    static DynamicDispatch<CountSetBitsDynamicFunction> dispatch;
+    count += dispatch.func(p.aligned_start, p.aligned_words);
   }
 
   // Account for left over bits (in theory we could fall back to smaller
@@ -454,6 +521,11 @@ bool OptionalBitmapEquals(const std::shared_ptr<Buffer>& left, int64_t left_offs
                               right ? right->data() : nullptr, right_offset, length);
 }
 
+template <typename T>
+struct AndNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
+};
+
 namespace {
 
 template <template <typename> class BitOp>
@@ -499,8 +571,9 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
 }
 
 template <template <typename> class BitOp>
-void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-              int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
+void BitmapOpBytes(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                   int64_t right_offset, int64_t length, int64_t out_offset,
+                   uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
     AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
@@ -512,6 +585,113 @@ void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   }
 }
 
+// The i-th 64-bit word of a bitmap starting `shift` bits into `data`
+inline uint64_t LoadShiftedWord(const uint8_t* data, int shift, int64_t i) {
+  uint64_t word = BitUtil::ToLittleEndian(util::SafeLoadAs<uint64_t>(data + i * 8));
+  if (shift != 0) {
+    const uint64_t next_word =
+        BitUtil::ToLittleEndian(util::SafeLoadAs<uint64_t>(data + i * 8 + 8));
+    word = (word >> shift) | (next_word << (64 - shift));
+  }
+  return word;
+}
+
+inline void StoreWord(uint8_t* out, int64_t i, uint64_t word) {
+  util::SafeStore(out + i * 8, BitUtil::FromLittleEndian(word));
+}
+
+// Word kernels, whose SIMD variants are in bitmap_ops_avx2.cc and
+// bitmap_ops_avx512.cc: they combine `nwords` 64-bit words of bitmaps starting
+// `shift` bits (less than 8) into their first byte, into the byte-aligned `out`.
+// Inputs must have one more word readable.
+
+using BitmapOpWordsFunction = void (*)(const uint8_t* left, int left_shift,
+                                       const uint8_t* right, int right_shift,
+                                       uint8_t* out, int64_t nwords);
+
+template <template <typename> class BitOp>
+void BitmapOpWords(const uint8_t* left, int left_shift, const uint8_t* right,
+                   int right_shift, uint8_t* out, int64_t nwords) {
+  BitOp<uint64_t> op;
+  for (int64_t i = 0; i < nwords; ++i) {
+    StoreWord(out, i,
+              op(LoadShiftedWord(left, left_shift, i),
+                 LoadShiftedWord(right, right_shift, i)));
+  }
+}
+
+template <template <typename> class BitOp>
+struct BitmapOpWordsDynamicFunction;
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#define BITMAP_OP_WORDS_AVX2(FUNC) , {DispatchLevel::AVX2, FUNC##_avx2}
+#else
+#define BITMAP_OP_WORDS_AVX2(FUNC)
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+#define BITMAP_OP_WORDS_AVX512(FUNC) , {DispatchLevel::AVX512, FUNC##_avx512}
+#else
+#define BITMAP_OP_WORDS_AVX512(FUNC)
+#endif
+
+#define BITMAP_OP_WORDS_DYNAMIC_FUNCTION(BIT_OP, FUNC)                                 \
+  template <>                                                                          \
+  struct BitmapOpWordsDynamicFunction<BIT_OP> {                                        \
+    using FunctionType = BitmapOpWordsFunction;                                        \
+                                                                                       \
+    static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {     \
+      return {{DispatchLevel::NONE, BitmapOpWords<BIT_OP>} BITMAP_OP_WORDS_AVX2(FUNC)  \
+                  BITMAP_OP_WORDS_AVX512(FUNC)};                                       \
+    }                                                                                  \
+  };
+
+BITMAP_OP_WORDS_DYNAMIC_FUNCTION(std::bit_and, bitmap_and_words)
+BITMAP_OP_WORDS_DYNAMIC_FUNCTION(std::bit_or, bitmap_or_words)
+BITMAP_OP_WORDS_DYNAMIC_FUNCTION(std::bit_xor, bitmap_xor_words)
+BITMAP_OP_WORDS_DYNAMIC_FUNCTION(AndNotOp, bitmap_and_not_words)
+
+#undef BITMAP_OP_WORDS_DYNAMIC_FUNCTION
+#undef BITMAP_OP_WORDS_AVX2
+#undef BITMAP_OP_WORDS_AVX512
+
+// The number of bits up to the next byte boundary of `out_offset`, and the number of
+// words the word kernels can process after them
+void SplitForWords(int64_t length, int64_t out_offset, int64_t* head_bits,
+                   int64_t* nwords) {
+  *head_bits = std::min(length, (8 - out_offset % 8) % 8);
+  // Inputs must have one more word readable
+  *nwords = std::max<int64_t>((length - *head_bits) / 64 - 1, 0);
+}
+
+template <template <typename> class BitOp>
+void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
+  int64_t head_bits, nwords;
+  SplitForWords(length, out_offset, &head_bits, &nwords);
+  if (nwords == 0) {
+    BitmapOpBytes<BitOp>(left, left_offset, right, right_offset, length, out_offset,
+                         dest);
+    return;
+  }
+  // Handle the bits up to a byte boundary of the output, then whole words whatever
+  // the input offsets, then the rest
+  if (head_bits > 0) {
+    BitmapOpBytes<BitOp>(left, left_offset, right, right_offset, head_bits, out_offset,
+                         dest);
+    left_offset += head_bits;
+    right_offset += head_bits;
+    out_offset += head_bits;
+    length -= head_bits;
+  }
+  static DynamicDispatch<BitmapOpWordsDynamicFunction<BitOp>> dispatch;
+  dispatch.func(left + left_offset / 8, static_cast<int>(left_offset % 8),
+                right + right_offset / 8, static_cast<int>(right_offset % 8),
+                dest + out_offset / 8, nwords);
+  const int64_t word_bits = nwords * 64;
+  BitmapOpBytes<BitOp>(left, left_offset + word_bits, right, right_offset + word_bits,
+                       length - word_bits, out_offset + word_bits, dest);
+}
+
 template <template <typename> class BitOp>
 Result<std::shared_ptr<Buffer>> BitmapOp(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
@@ -565,11 +745,6 @@ void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct AndNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapAndNot(MemoryPool* pool, const uint8_t* left,
                                              int64_t left_offset, const uint8_t* right,
                                              int64_t right_offset, int64_t length,
@@ -584,5 +759,97 @@ void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right
   BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
+namespace {
+
+void bitmap_and_many_words_default(const uint8_t* const* bitmaps, const int* shifts,
+                                   int num_bitmaps, uint8_t* out, int64_t nwords) {
+  for (int64_t i = 0; i < nwords; ++i) {
+    uint64_t word = ~uint64_t(0);
+    for (int k = 0; k < num_bitmaps; ++k) {
+      word &= LoadShiftedWord(bitmaps[k], shifts[k], i);
+    }
+    StoreWord(out, i, word);
+  }
+}
+
+struct BitmapAndManyWordsDynamicFunction {
+  using FunctionType = decltype(&bitmap_and_many_words_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, bitmap_and_many_words_default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, bitmap_and_many_words_avx2 }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, bitmap_and_many_words_avx512 }
+#endif
+    };
+  }
+};
+
+// Bit by bit, for the few bits the word kernels don't handle
+void BitmapAndManyBits(const std::vector<const uint8_t*>& bitmaps,
+                       const std::vector<int64_t>& offsets, int64_t start,
+                       int64_t length, int64_t out_offset, uint8_t* out) {
+  for (int64_t i = start; i < start + length; ++i) {
+    bool bit = true;
+    for (size_t k = 0; k < bitmaps.size() && bit; ++k) {
+      bit = BitUtil::GetBit(bitmaps[k], offsets[k] + i);
+    }
+    BitUtil::SetBitTo(out, out_offset + i, bit);
+  }
+}
+
+}  // namespace
+
+void BitmapAnd(const std::vector<const uint8_t*>& bitmaps,
+               const std::vector<int64_t>& offsets, int64_t length, int64_t out_offset,
+               uint8_t* out) {
+  DCHECK_EQ(bitmaps.size(), offsets.size());
+  switch (bitmaps.size()) {
+    case 0:
+      BitUtil::SetBitsTo(out, out_offset, length, true);
+      return;
+    case 1:
+      CopyBitmap(bitmaps[0], offsets[0], length, out, out_offset);
+      return;
+    case 2:
+      BitmapAnd(bitmaps[0], offsets[0], bitmaps[1], offsets[1], length, out_offset, out);
+      return;
+    default:
+      break;
+  }
+
+  int64_t head_bits, nwords;
+  SplitForWords(length, out_offset, &head_bits, &nwords);
+  if (nwords == 0) {
+    BitmapAndManyBits(bitmaps, offsets, 0, length, out_offset, out);
+    return;
+  }
+  BitmapAndManyBits(bitmaps, offsets, 0, head_bits, out_offset, out);
+  std::vector<const uint8_t*> starts(bitmaps.size());
+  std::vector<int> shifts(bitmaps.size());
+  for (size_t k = 0; k < bitmaps.size(); ++k) {
+    const int64_t offset = offsets[k] + head_bits;
+    starts[k] = bitmaps[k] + offset / 8;
+    shifts[k] = static_cast<int>(offset % 8);
+  }
+  static DynamicDispatch<BitmapAndManyWordsDynamicFunction> dispatch;
+  dispatch.func(starts.data(), shifts.data(), static_cast<int>(bitmaps.size()),
+                out + (out_offset + head_bits) / 8, nwords);
+  const int64_t done_bits = head_bits + nwords * 64;
+  BitmapAndManyBits(bitmaps, offsets, done_bits, length - done_bits, out_offset, out);
+}
+
+Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool,
+                                          const std::vector<const uint8_t*>& bitmaps,
+                                          const std::vector<int64_t>& offsets,
+                                          int64_t length, int64_t out_offset) {
+  ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateEmptyBitmap(length + out_offset, pool));
+  BitmapAnd(bitmaps, offsets, length, out_offset, out_buffer->mutable_data());
+  return out_buffer;
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/util/visibility.h"
@@ -92,6 +93,19 @@ Result<std::shared_ptr<Buffer>> InvertBitmap(MemoryPool* pool, const uint8_t* bi
 ARROW_EXPORT
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// \brief Count the leading 64-bit words of a bitmap which have all their bits set,
+/// or all unset
+///
+/// This lets bitmap readers skip long runs of equal bits in one step.
+///
+/// \param[in] data a pointer to the first word (needs not be aligned)
+/// \param[in] nwords the maximum number of words to inspect
+/// \param[in] set whether to look for all-set or all-unset words
+///
+/// \return The number of leading uniform words, at most `nwords`
+ARROW_EXPORT
+int64_t CountUniformWords(const uint8_t* data, int64_t nwords, bool set);
+
 ARROW_EXPORT
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t length);
@@ -126,6 +140,29 @@ ARROW_EXPORT
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a "bitmap and" on several buffers starting at their respective
+/// bit-offsets for the given bit-length and put the results in out starting at
+/// the given bit-offset.
+///
+/// All bitmaps are combined in a single pass, which is faster than chaining
+/// two-bitmap calls.  With no bitmaps, all output bits are set.
+ARROW_EXPORT
+void BitmapAnd(const std::vector<const uint8_t*>& bitmaps,
+               const std::vector<int64_t>& offsets, int64_t length, int64_t out_offset,
+               uint8_t* out);
+
+/// \brief Do a "bitmap and" on several buffers starting at their respective
+/// bit-offsets for the given bit-length and put the results in out_buffer
+/// starting at the given bit-offset.
+///
+/// out_buffer will be allocated and initialized to zeros using pool before
+/// the operation.
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool,
+                                          const std::vector<const uint8_t*>& bitmaps,
+                                          const std::vector<int64_t>& offsets,
+                                          int64_t length, int64_t out_offset);
+
 /// \brief Do a "bitmap or" for the given bit length on right and left buffers
 /// starting at their respective bit-offsets and put the results in out_buffer
 /// starting at the given bit-offset.
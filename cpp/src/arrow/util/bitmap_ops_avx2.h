@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+namespace arrow {
+namespace internal {
+
+// Word kernels of bitmap_ops.cc: they combine `nwords` 64-bit words of bitmaps
+// starting `shift` bits (less than 8) into their first byte, into the byte-aligned
+// `out`.  Inputs must have one more word readable.
+
+void bitmap_and_words_avx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                           int right_shift, uint8_t* out, int64_t nwords);
+void bitmap_or_words_avx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                          int right_shift, uint8_t* out, int64_t nwords);
+void bitmap_xor_words_avx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                           int right_shift, uint8_t* out, int64_t nwords);
+void bitmap_and_not_words_avx2(const uint8_t* left, int left_shift, const uint8_t* right,
+                               int right_shift, uint8_t* out, int64_t nwords);
+
+void bitmap_and_many_words_avx2(const uint8_t* const* bitmaps, const int* shifts,
+                                int num_bitmaps, uint8_t* out, int64_t nwords);
+
+// The number of set bits in `nwords` 64-bit words
+int64_t count_set_bits_avx2(const uint8_t* data, int64_t nwords);
+
+// The number of leading words, out of `nwords`, equal to `word`
+int64_t count_uniform_words_avx2(const uint8_t* data, int64_t nwords, uint64_t word);
+
+}  // namespace internal
+}  // namespace arrow
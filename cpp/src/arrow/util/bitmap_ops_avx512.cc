@@ -0,0 +1,206 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bitmap_ops_avx512.h"
+
+#include <immintrin.h>
+#include <string.h>
+
+namespace arrow {
+namespace internal {
+
+// Arrow headers aren't included so that no AVX512 variant of their inline functions
+// gets emitted
+
+// GCC 12 wrongly warns about the masked builtins which AVX512 intrinsics expand to
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace {
+
+// The i-th 64-bit word of a bitmap starting `shift` bits into `data`
+inline uint64_t LoadShiftedWord(const uint8_t* data, int shift, int64_t i) {
+  uint64_t word, next_word;
+  memcpy(&word, data + i * 8, 8);
+  if (shift == 0) {
+    return word;
+  }
+  memcpy(&next_word, data + i * 8 + 8, 8);
+  return (word >> shift) | (next_word << (64 - shift));
+}
+
+// The i-th to i+7-th words of a bitmap starting `shift` bits into `data`.
+// `inverse_shift` is 64 - shift: shifting by 64 yields zeros.
+inline __m512i LoadShiftedWords(const uint8_t* data, __m512i shift,
+                                __m512i inverse_shift, int64_t i) {
+  const __m512i words = _mm512_loadu_si512(data + i * 8);
+  const __m512i next_words = _mm512_loadu_si512(data + i * 8 + 8);
+  return _mm512_or_si512(_mm512_srlv_epi64(words, shift),
+                         _mm512_sllv_epi64(next_words, inverse_shift));
+}
+
+struct AndOp {
+  static uint64_t Call(uint64_t l, uint64_t r) { return l & r; }
+  static __m512i Call(__m512i l, __m512i r) { return _mm512_and_si512(l, r); }
+};
+
+struct OrOp {
+  static uint64_t Call(uint64_t l, uint64_t r) { return l | r; }
+  static __m512i Call(__m512i l, __m512i r) { return _mm512_or_si512(l, r); }
+};
+
+struct XorOp {
+  static uint64_t Call(uint64_t l, uint64_t r) { return l ^ r; }
+  static __m512i Call(__m512i l, __m512i r) { return _mm512_xor_si512(l, r); }
+};
+
+struct AndNotOp {
+  static uint64_t Call(uint64_t l, uint64_t r) { return l & ~r; }
+  static __m512i Call(__m512i l, __m512i r) { return _mm512_andnot_si512(r, l); }
+};
+
+template <typename Op>
+void BitmapOpWords(const uint8_t* left, int left_shift, const uint8_t* right,
+                   int right_shift, uint8_t* out, int64_t nwords) {
+  const __m512i left_shifts = _mm512_set1_epi64(left_shift);
+  const __m512i left_inverse_shifts = _mm512_set1_epi64(64 - left_shift);
+  const __m512i right_shifts = _mm512_set1_epi64(right_shift);
+  const __m512i right_inverse_shifts = _mm512_set1_epi64(64 - right_shift);
+  int64_t i = 0;
+  for (; i + 8 <= nwords; i += 8) {
+    const __m512i words =
+        Op::Call(LoadShiftedWords(left, left_shifts, left_inverse_shifts, i),
+                 LoadShiftedWords(right, right_shifts, right_inverse_shifts, i));
+    _mm512_storeu_si512(out + i * 8, words);
+  }
+  for (; i < nwords; ++i) {
+    const uint64_t word = Op::Call(LoadShiftedWord(left, left_shift, i),
+                                   LoadShiftedWord(right, right_shift, i));
+    memcpy(out + i * 8, &word, 8);
+  }
+}
+
+}  // namespace
+
+void bitmap_and_words_avx512(const uint8_t* left, int left_shift, const uint8_t* right,
+                             int right_shift, uint8_t* out, int64_t nwords) {
+  BitmapOpWords<AndOp>(left, left_shift, right, right_shift, out, nwords);
+}
+
+void bitmap_or_words_avx512(const uint8_t* left, int left_shift, const uint8_t* right,
+                            int right_shift, uint8_t* out, int64_t nwords) {
+  BitmapOpWords<OrOp>(left, left_shift, right, right_shift, out, nwords);
+}
+
+void bitmap_xor_words_avx512(const uint8_t* left, int left_shift, const uint8_t* right,
+                             int right_shift, uint8_t* out, int64_t nwords) {
+  BitmapOpWords<XorOp>(left, left_shift, right, right_shift, out, nwords);
+}
+
+void bitmap_and_not_words_avx512(const uint8_t* left, int left_shift,
+                                 const uint8_t* right, int right_shift, uint8_t* out,
+                                 int64_t nwords) {
+  BitmapOpWords<AndNotOp>(left, left_shift, right, right_shift, out, nwords);
+}
+
+void bitmap_and_many_words_avx512(const uint8_t* const* bitmaps, const int* shifts,
+                                  int num_bitmaps, uint8_t* out, int64_t nwords) {
+  // Combine the bitmaps one by one into blocks of the output small enough to stay
+  // in L1 cache
+  constexpr int64_t kBlockWords = 256;
+  for (int64_t block = 0; block < nwords; block += kBlockWords) {
+    const int64_t block_end = block + kBlockWords < nwords ? block + kBlockWords : nwords;
+    for (int k = 0; k < num_bitmaps; ++k) {
+      const __m512i shift = _mm512_set1_epi64(shifts[k]);
+      const __m512i inverse_shift = _mm512_set1_epi64(64 - shifts[k]);
+      int64_t i = block;
+      for (; i + 8 <= block_end; i += 8) {
+        __m512i words = LoadShiftedWords(bitmaps[k], shift, inverse_shift, i);
+        if (k > 0) {
+          words = _mm512_and_si512(words, _mm512_loadu_si512(out + i * 8));
+        }
+        _mm512_storeu_si512(out + i * 8, words);
+      }
+      for (; i < block_end; ++i) {
+        uint64_t word = LoadShiftedWord(bitmaps[k], shifts[k], i);
+        if (k > 0) {
+          uint64_t out_word;
+          memcpy(&out_word, out + i * 8, 8);
+          word &= out_word;
+        }
+        memcpy(out + i * 8, &word, 8);
+      }
+    }
+  }
+}
+
+// Count the bits of each nibble with a lookup table, as in count_set_bits_avx2
+int64_t count_set_bits_avx512(const uint8_t* data, int64_t nwords) {
+  const __m512i lookup = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+  const __m512i low_mask = _mm512_set1_epi8(0x0f);
+  __m512i counts = _mm512_setzero_si512();
+  int64_t i = 0;
+  for (; i + 8 <= nwords; i += 8) {
+    const __m512i words = _mm512_loadu_si512(data + i * 8);
+    const __m512i low = _mm512_and_si512(words, low_mask);
+    const __m512i high = _mm512_and_si512(_mm512_srli_epi16(words, 4), low_mask);
+    const __m512i byte_counts = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, low),
+                                                _mm512_shuffle_epi8(lookup, high));
+    counts =
+        _mm512_add_epi64(counts, _mm512_sad_epu8(byte_counts, _mm512_setzero_si512()));
+  }
+  int64_t count = _mm512_reduce_add_epi64(counts);
+  for (; i < nwords; ++i) {
+    uint64_t word;
+    memcpy(&word, data + i * 8, 8);
+    count += _mm_popcnt_u64(word);
+  }
+  return count;
+}
+
+// Same approach as count_uniform_words_avx2, 16 words at a time
+int64_t count_uniform_words_avx512(const uint8_t* data, int64_t nwords, uint64_t word) {
+  const __m512i pattern = _mm512_set1_epi64(static_cast<int64_t>(word));
+  int64_t i = 0;
+  for (; i + 16 <= nwords; i += 16) {
+    const __m512i diff =
+        _mm512_or_si512(_mm512_xor_si512(_mm512_loadu_si512(data + i * 8), pattern),
+                        _mm512_xor_si512(_mm512_loadu_si512(data + i * 8 + 64), pattern));
+    if (_mm512_test_epi64_mask(diff, diff) != 0) {
+      break;
+    }
+  }
+  for (; i < nwords; ++i) {
+    uint64_t current;
+    memcpy(&current, data + i * 8, 8);
+    if (current != word) {
+      break;
+    }
+  }
+  return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+}  // namespace internal
+}  // namespace arrow
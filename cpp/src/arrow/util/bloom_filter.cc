@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bloom_filter.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/util/bloom_filter_avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+Status BlockedBloomFilter::Init(int64_t num_values, MemoryPool* pool) {
+  constexpr int64_t kBitsPerValue = 10;
+  constexpr int64_t kBitsPerBlock = kWordsPerBlock * 32;
+  const int64_t min_blocks =
+      BitUtil::CeilDiv(num_values * kBitsPerValue, kBitsPerBlock);
+  log_num_blocks_ = 1;
+  while (num_blocks() < min_blocks) {
+    ++log_num_blocks_;
+  }
+  // Buffers are 64-byte aligned, so blocks can be loaded with aligned loads
+  ARROW_ASSIGN_OR_RAISE(buffer_, AllocateBuffer(num_blocks() * kBitsPerBlock / 8, pool));
+  std::memset(buffer_->mutable_data(), 0, static_cast<size_t>(buffer_->size()));
+  blocks_ = reinterpret_cast<uint32_t*>(buffer_->mutable_data());
+  return Status::OK();
+}
+
+namespace {
+
+void may_contain_default(const uint32_t* blocks, int log_num_blocks,
+                         const uint64_t* hashes, int64_t length, uint8_t* out) {
+  std::memset(out, 0, static_cast<size_t>(BitUtil::BytesForBits(length)));
+  for (int64_t i = 0; i < length; ++i) {
+    if (BlockedBloomFilter::MayContain(blocks, log_num_blocks, hashes[i])) {
+      BitUtil::SetBit(out, i);
+    }
+  }
+}
+
+struct MayContainDynamicFunction {
+  using FunctionType = decltype(&may_contain_default);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, may_contain_default }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, bloom_filter_may_contain_avx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+void BlockedBloomFilter::MayContain(const uint64_t* hashes, int64_t length,
+                                    uint8_t* out) const {
+  static DynamicDispatch<MayContainDynamicFunction> dispatch;
+  dispatch.func(blocks_, log_num_blocks_, hashes, length, out);
+}
+
+}  // namespace internal
+}  // namespace arrow
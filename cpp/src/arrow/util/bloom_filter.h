@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A blocked Bloom filter over 64-bit hashes
+///
+/// Each hash selects a 256-bit block and sets or tests one bit in each of the
+/// block's eight 32-bit words, so that a lookup touches a single cache line and
+/// maps to a few SIMD instructions.  With at least 10 bits per value, about 1%
+/// of the absent hashes are reported as present.
+class ARROW_EXPORT BlockedBloomFilter {
+ public:
+  static constexpr int kWordsPerBlock = 8;
+
+  /// \brief Allocate an empty filter sized for `num_values` insertions
+  Status Init(int64_t num_values, MemoryPool* pool = default_memory_pool());
+
+  void Insert(uint64_t hash) {
+    uint32_t* block = blocks_ + BlockIndex(hash, log_num_blocks_) * kWordsPerBlock;
+    const auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < kWordsPerBlock; ++i) {
+      block[i] |= WordMask(key, i);
+    }
+  }
+
+  /// \brief Whether `hash` may have been inserted
+  bool MayContain(uint64_t hash) const {
+    return MayContain(blocks_, log_num_blocks_, hash);
+  }
+
+  /// \brief Set the i-th bit of `out` if `hashes[i]` may have been inserted, and
+  /// clear it otherwise
+  ///
+  /// Uses SIMD instructions if the CPU supports them.
+  void MayContain(const uint64_t* hashes, int64_t length, uint8_t* out) const;
+
+  int64_t num_blocks() const { return int64_t(1) << log_num_blocks_; }
+
+  // Also implemented in bloom_filter_avx2.cc, which must be kept in sync.
+
+  // Blocks are selected by the high bits of a multiplicative hash...
+  static int64_t BlockIndex(uint64_t hash, int log_num_blocks) {
+    return static_cast<int64_t>((hash * 0x9e3779b97f4a7c15ULL) >> (64 - log_num_blocks));
+  }
+
+  // ...and the bit of each word by the low 32 bits of the hash
+  static uint32_t WordMask(uint32_t key, int i) {
+    static constexpr uint32_t kSalts[kWordsPerBlock] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+    return uint32_t(1) << ((key * kSalts[i]) >> 27);
+  }
+
+  static bool MayContain(const uint32_t* blocks, int log_num_blocks, uint64_t hash) {
+    const uint32_t* block = blocks + BlockIndex(hash, log_num_blocks) * kWordsPerBlock;
+    const auto key = static_cast<uint32_t>(hash);
+    bool found = true;
+    for (int i = 0; i < kWordsPerBlock; ++i) {
+      found &= (block[i] & WordMask(key, i)) != 0;
+    }
+    return found;
+  }
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+  uint32_t* blocks_ = NULLPTR;
+  // At least one, so that BlockIndex() never shifts by 64
+  int log_num_blocks_ = 1;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bloom_filter_avx2.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+
+// Kept in sync with BlockedBloomFilter, whose header isn't included so that no AVX2
+// variant of its inline methods gets emitted
+void bloom_filter_may_contain_avx2(const uint32_t* blocks, int log_num_blocks,
+                                   const uint64_t* hashes, int64_t length,
+                                   uint8_t* out) {
+  alignas(32) static const uint32_t kSalts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                 0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                 0x9efc4947U, 0x5c6bfb31U};
+  const __m256i salts = _mm256_load_si256(reinterpret_cast<const __m256i*>(kSalts));
+  const __m256i ones = _mm256_set1_epi32(1);
+  const int shift = 64 - log_num_blocks;
+
+  auto may_contain = [&](uint64_t hash) -> uint8_t {
+    const uint64_t index = (hash * 0x9e3779b97f4a7c15ULL) >> shift;
+    const __m256i block =
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(blocks + index * 8));
+    const __m256i key = _mm256_set1_epi32(static_cast<int32_t>(hash));
+    const __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(key, salts), 27);
+    const __m256i mask = _mm256_sllv_epi32(ones, bits);
+    // Whether all the bits of mask are set in block
+    return static_cast<uint8_t>(_mm256_testc_si256(block, mask));
+  };
+
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; ++j) {
+      byte |= static_cast<uint8_t>(may_contain(hashes[i + j]) << j);
+    }
+    out[i / 8] = byte;
+  }
+  if (i < length) {
+    uint8_t byte = 0;
+    for (int j = 0; i + j < length; ++j) {
+      byte |= static_cast<uint8_t>(may_contain(hashes[i + j]) << j);
+    }
+    out[i / 8] = byte;
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bloom_filter.h"
+
+namespace arrow {
+namespace internal {
+
+std::vector<uint64_t> RandomHashes(int64_t n, uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<uint64_t> hashes(n);
+  for (auto& hash : hashes) {
+    hash = gen();
+  }
+  return hashes;
+}
+
+TEST(BlockedBloomFilter, Sizing) {
+  BlockedBloomFilter filter;
+  ASSERT_OK(filter.Init(0));
+  ASSERT_EQ(filter.num_blocks(), 2);
+  ASSERT_FALSE(filter.MayContain(42));
+
+  // At least 10 bits per value, rounded up to a power of two blocks
+  ASSERT_OK(filter.Init(1000));
+  ASSERT_EQ(filter.num_blocks(), 64);
+}
+
+TEST(BlockedBloomFilter, InsertAndProbe) {
+  constexpr int64_t kNumValues = 100000;
+  BlockedBloomFilter filter;
+  ASSERT_OK(filter.Init(kNumValues));
+
+  const auto inserted = RandomHashes(kNumValues, /*seed=*/42);
+  for (uint64_t hash : inserted) {
+    filter.Insert(hash);
+  }
+  // No false negatives
+  for (uint64_t hash : inserted) {
+    ASSERT_TRUE(filter.MayContain(hash));
+  }
+
+  const auto absent = RandomHashes(kNumValues, /*seed=*/43);
+  int64_t false_positives = 0;
+  for (uint64_t hash : absent) {
+    false_positives += filter.MayContain(hash);
+  }
+  ASSERT_LT(false_positives, kNumValues / 50);
+}
+
+TEST(BlockedBloomFilter, BatchProbe) {
+  constexpr int64_t kNumValues = 5000;
+  BlockedBloomFilter filter;
+  ASSERT_OK(filter.Init(kNumValues / 2));
+  auto hashes = RandomHashes(kNumValues, /*seed=*/0);
+  for (int64_t i = 0; i < kNumValues; i += 2) {
+    filter.Insert(hashes[i]);
+  }
+
+  // Odd lengths exercise the trailing partial byte
+  for (int64_t length : {0, 1, 7, 8, 13, 4999}) {
+    SCOPED_TRACE("length = " + std::to_string(length));
+    std::vector<uint8_t> out(BitUtil::BytesForBits(length) + 1, 0xff);
+    filter.MayContain(hashes.data(), length, out.data());
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_EQ(BitUtil::GetBit(out.data(), i), filter.MayContain(hashes[i]));
+    }
+    // Bytes past the output are untouched
+    ASSERT_EQ(out.back(), 0xff);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
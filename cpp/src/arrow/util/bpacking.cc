@@ -16,10 +16,15 @@
 // under the License.
 
 #include "arrow/util/bpacking.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "arrow/util/bpacking_default.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
 
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
 #include "arrow/util/bpacking_avx2.h"
@@ -174,5 +179,53 @@ int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
 #endif
 }
 
+namespace {
+
+// Unpack 32 values wider than 32 bits
+const uint8_t* unpack32_wide(const uint8_t* in, uint64_t* out, int num_bits) {
+  const int num_bytes = 4 * num_bits;
+  // Copy to a padded buffer so that 8 bytes (plus one for unaligned values) can be
+  // loaded at the position of every value
+  uint8_t buffer[32 * 8 + 9] = {};
+  std::memcpy(buffer, in, num_bytes);
+  const uint64_t mask = num_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << num_bits) - 1;
+  for (int i = 0; i < 32; ++i) {
+    const int bit_offset = i * num_bits;
+    const uint8_t* word = buffer + bit_offset / 8;
+    const int shift = bit_offset % 8;
+    uint64_t value =
+        BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(word)) >> shift;
+    if (shift + num_bits > 64) {
+      value |= static_cast<uint64_t>(word[8]) << (64 - shift);
+    }
+    out[i] = value & mask;
+  }
+  return in + num_bytes;
+}
+
+}  // namespace
+
+int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  if (num_bits <= 32) {
+    // Unpack through the (possibly SIMD) 32-bit kernels, then widen
+    constexpr int kBufferSize = 1024;
+    uint32_t buffer[kBufferSize];
+    const uint32_t* in32 = reinterpret_cast<const uint32_t*>(in);
+    for (int i = 0; i < batch_size; i += kBufferSize) {
+      const int num_values = std::min(kBufferSize, batch_size - i);
+      unpack32(in32, buffer, num_values, num_bits);
+      in32 += num_values / 32 * num_bits;
+      std::copy(buffer, buffer + num_values, out + i);
+    }
+    return batch_size;
+  }
+  DCHECK_LE(num_bits, 64) << "Unsupported num_bits";
+  for (int i = 0; i < batch_size; i += 32) {
+    in = unpack32_wide(in, out + i, num_bits);
+  }
+  return batch_size;
+}
+
 }  // namespace internal
 }  // namespace arrow
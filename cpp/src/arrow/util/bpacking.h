@@ -28,5 +28,12 @@ namespace internal {
 ARROW_EXPORT
 int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
 
+/// \brief Unpack values of up to 64 bits, 32 values at a time.
+///
+/// Like unpack32, batch_size is rounded down to a multiple of 32 and the number of
+/// unpacked values is returned. Bit widths up to 32 go through unpack32.
+ARROW_EXPORT
+int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,7 +18,9 @@
 #include "arrow/util/compression.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/result.h"
@@ -29,6 +31,39 @@
 namespace arrow {
 namespace util {
 
+namespace {
+
+// Codec factories registered with Codec::RegisterFactory
+class CodecRegistry {
+ public:
+  static CodecRegistry* GetInstance() {
+    static CodecRegistry registry;
+    return &registry;
+  }
+
+  void Register(Compression::type codec_type, CodecFactory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    factories_[static_cast<int>(codec_type)] = std::move(factory);
+  }
+
+  bool Unregister(Compression::type codec_type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return factories_.erase(static_cast<int>(codec_type)) > 0;
+  }
+
+  CodecFactory Get(Compression::type codec_type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = factories_.find(static_cast<int>(codec_type));
+    return it == factories_.end() ? CodecFactory() : it->second;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<int, CodecFactory> factories_;
+};
+
+}  // namespace
+
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
@@ -103,8 +138,55 @@ bool Codec::SupportsCompressionLevel(Compression::type codec) {
   }
 }
 
+bool Codec::SupportsDictionary(Compression::type codec) {
+  return codec == Compression::ZSTD;
+}
+
+Status Codec::RegisterFactory(Compression::type codec_type, CodecFactory factory) {
+  if (codec_type == Compression::UNCOMPRESSED) {
+    return Status::Invalid("Cannot register a codec factory for uncompressed data");
+  }
+  if (GetCodecAsString(codec_type) == "unknown") {
+    return Status::Invalid("Unrecognized codec");
+  }
+  if (!factory) {
+    return Status::Invalid("Codec factory for '", GetCodecAsString(codec_type),
+                           "' is empty");
+  }
+  CodecRegistry::GetInstance()->Register(codec_type, std::move(factory));
+  return Status::OK();
+}
+
+Status Codec::UnregisterFactory(Compression::type codec_type) {
+  if (!CodecRegistry::GetInstance()->Unregister(codec_type)) {
+    return Status::KeyError("No codec factory registered for '",
+                            GetCodecAsString(codec_type), "'");
+  }
+  return Status::OK();
+}
+
 Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
                                              int compression_level) {
+  CodecOptions options;
+  options.compression_level = compression_level;
+  return Create(codec_type, options);
+}
+
+Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
+                                             const CodecOptions& options) {
+  const int compression_level = options.compression_level;
+
+  std::unique_ptr<Codec> codec;
+  if (auto factory = CodecRegistry::GetInstance()->Get(codec_type)) {
+    ARROW_ASSIGN_OR_RAISE(codec, factory(options));
+    if (codec == nullptr) {
+      return Status::Invalid("Codec factory for '", GetCodecAsString(codec_type),
+                             "' returned null");
+    }
+    RETURN_NOT_OK(codec->Init());
+    return std::move(codec);
+  }
+
   if (!IsAvailable(codec_type)) {
     if (codec_type == Compression::LZO) {
       return Status::NotImplemented("LZO codec not implemented");
@@ -125,7 +207,11 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
                            "' doesn't support setting a compression level.");
   }
 
-  std::unique_ptr<Codec> codec;
+  if (options.dictionary != nullptr && !SupportsDictionary(codec_type)) {
+    return Status::Invalid("Codec '", GetCodecAsString(codec_type),
+                           "' doesn't support compression dictionaries.");
+  }
+
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
       return nullptr;
@@ -161,7 +247,7 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       break;
     case Compression::ZSTD:
 #ifdef ARROW_WITH_ZSTD
-      codec = internal::MakeZSTDCodec(compression_level);
+      codec = internal::MakeZSTDCodec(compression_level, options.dictionary);
 #endif
       break;
     case Compression::BZ2:
@@ -179,6 +265,10 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
 }
 
 bool Codec::IsAvailable(Compression::type codec_type) {
+  if (codec_type != Compression::UNCOMPRESSED &&
+      CodecRegistry::GetInstance()->Get(codec_type)) {
+    return true;
+  }
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
       return true;
@@ -227,5 +317,18 @@ bool Codec::IsAvailable(Compression::type codec_type) {
   }
 }
 
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size,
+    MemoryPool* pool) {
+  if (max_dictionary_size <= 0) {
+    return Status::Invalid("Dictionary size must be positive");
+  }
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_dictionary_size, pool);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
 }  // namespace util
 }  // namespace arrow
@@ -18,12 +18,15 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -107,6 +110,24 @@ class ARROW_EXPORT Decompressor {
   // XXX add methods for buffer size heuristics?
 };
 
+/// \brief Options for creating a Codec
+struct ARROW_EXPORT CodecOptions {
+  /// Compression level, or kUseDefaultCompressionLevel
+  int compression_level = kUseDefaultCompressionLevel;
+
+  /// Dictionary to prime compression and decompression with
+  ///
+  /// Only supported by ZSTD.  Data compressed with a dictionary can only be
+  /// decompressed with the same dictionary.  See TrainZstdDictionary().
+  std::shared_ptr<Buffer> dictionary;
+};
+
+class Codec;
+
+/// \brief A function creating a Codec from its options
+using CodecFactory =
+    std::function<Result<std::unique_ptr<Codec>>(const CodecOptions& options)>;
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
@@ -126,12 +147,35 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
 
+  /// \brief Create a codec for the given compression algorithm and options
+  static Result<std::unique_ptr<Codec>> Create(Compression::type codec,
+                                               const CodecOptions& options);
+
   /// \brief Return true if support for indicated codec has been enabled
+  /// or a factory has been registered for it
   static bool IsAvailable(Compression::type codec);
 
   /// \brief Return true if indicated codec supports setting a compression level
   static bool SupportsCompressionLevel(Compression::type codec);
 
+  /// \brief Return true if indicated codec supports compression dictionaries
+  static bool SupportsDictionary(Compression::type codec);
+
+  /// \brief Register a factory creating the codecs for a compression algorithm
+  ///
+  /// The factory takes precedence over the built-in implementation, if any,
+  /// in all subsequent calls to Create().  This allows plugging alternative
+  /// implementations (such as hardware-accelerated ones) without modifying
+  /// Arrow; the codecs they create must produce and accept the same format as
+  /// the built-in ones.  Any factory previously registered for the algorithm
+  /// is replaced.
+  static Status RegisterFactory(Compression::type codec, CodecFactory factory);
+
+  /// \brief Unregister the factory registered for a compression algorithm
+  ///
+  /// Create() then uses the built-in implementation again.
+  static Status UnregisterFactory(Compression::type codec);
+
   /// \brief One-shot decompression function
   ///
   /// output_buffer_len must be correct and therefore be obtained in advance.
@@ -172,10 +216,29 @@ class ARROW_EXPORT Codec {
   /// \brief This Codec's compression level, if applicable
   virtual int compression_level() const { return UseDefaultCompressionLevel(); }
 
+  /// \brief This Codec's compression dictionary, if any
+  virtual std::shared_ptr<Buffer> dictionary() const { return NULLPTR; }
+
  private:
   /// \brief Initializes the codec's resources.
   virtual Status Init();
 };
 
+/// \brief Train a ZSTD compression dictionary on sample data
+///
+/// The samples should be representative of the data to be compressed, such
+/// as the values of a column or small record batches; dictionaries mostly
+/// benefit the compression of small inputs.  A few hundred samples totaling
+/// about 100 times max_dictionary_size is usually a good training set.
+///
+/// \param[in] samples the sample data
+/// \param[in] max_dictionary_size the maximum size of the dictionary in bytes
+/// \param[in] pool the memory pool to allocate the dictionary from
+/// \return the dictionary, to be given to Codec::Create in CodecOptions
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t max_dictionary_size = 112640, MemoryPool* pool = default_memory_pool());
+
 }  // namespace util
 }  // namespace arrow
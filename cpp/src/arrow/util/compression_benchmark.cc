@@ -23,9 +23,13 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/result.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -33,38 +37,7 @@
 namespace arrow {
 namespace util {
 
-#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
-
-std::vector<uint8_t> MakeCompressibleData(int data_size) {
-  // XXX This isn't a real-world corpus so doesn't really represent the
-  // comparative qualities of the algorithms
-
-  // First make highly compressible data
-  std::string base_data =
-      "Apache Arrow is a cross-language development platform for in-memory data";
-  int nrepeats = static_cast<int>(1 + data_size / base_data.size());
-
-  std::vector<uint8_t> data(base_data.size() * nrepeats);
-  for (int i = 0; i < nrepeats; ++i) {
-    std::memcpy(data.data() + i * base_data.size(), base_data.data(), base_data.size());
-  }
-  data.resize(data_size);
-
-  // Then randomly mutate some bytes so as to make things harder
-  std::mt19937 engine(42);
-  std::exponential_distribution<> offsets(0.05);
-  std::uniform_int_distribution<> values(0, 255);
-
-  int64_t pos = 0;
-  while (pos < data_size) {
-    data[pos] = static_cast<uint8_t>(values(engine));
-    pos += static_cast<int64_t>(offsets(engine));
-  }
-
-  return data;
-}
-
-int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
+int64_t StreamingCompress(Codec* codec, const uint8_t* data, int64_t data_size,
                           std::vector<uint8_t>* compressed_data = nullptr) {
   if (compressed_data != nullptr) {
     compressed_data->clear();
@@ -72,8 +45,8 @@ int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
   }
   auto compressor = *codec->MakeCompressor();
 
-  const uint8_t* input = data.data();
-  int64_t input_len = data.size();
+  const uint8_t* input = data;
+  int64_t input_len = data_size;
   int64_t compressed_size = 0;
 
   std::vector<uint8_t> output_buffer(1 << 20);  // 1 MB
@@ -112,36 +85,28 @@ int64_t StreamingCompress(Codec* codec, const std::vector<uint8_t>& data,
   return compressed_size;
 }
 
-static void StreamingCompression(Compression::type compression,
-                                 const std::vector<uint8_t>& data,
+void StreamingCompression(Compression::type compression, const uint8_t* data,
+                                 int64_t data_size, int compression_level,
                                  benchmark::State& state) {  // NOLINT non-const reference
-  auto codec = *Codec::Create(compression);
+  auto codec = *Codec::Create(compression, compression_level);
 
   while (state.KeepRunning()) {
-    int64_t compressed_size = StreamingCompress(codec.get(), data);
+    int64_t compressed_size = StreamingCompress(codec.get(), data, data_size);
     state.counters["ratio"] =
-        static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+        static_cast<double>(data_size) / static_cast<double>(compressed_size);
   }
-  state.SetBytesProcessed(state.iterations() * data.size());
-}
-
-template <Compression::type COMPRESSION>
-static void ReferenceStreamingCompression(
-    benchmark::State& state) {                        // NOLINT non-const reference
-  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
-
-  StreamingCompression(COMPRESSION, data, state);
+  state.SetBytesProcessed(state.iterations() * data_size);
 }
 
-static void StreamingDecompression(
-    Compression::type compression, const std::vector<uint8_t>& data,
-    benchmark::State& state) {  // NOLINT non-const reference
-  auto codec = *Codec::Create(compression);
+void StreamingDecompression(
+    Compression::type compression, const uint8_t* data, int64_t data_size,
+    int compression_level, benchmark::State& state) {  // NOLINT non-const reference
+  auto codec = *Codec::Create(compression, compression_level);
 
   std::vector<uint8_t> compressed_data;
-  ARROW_UNUSED(StreamingCompress(codec.get(), data, &compressed_data));
+  ARROW_UNUSED(StreamingCompress(codec.get(), data, data_size, &compressed_data));
   state.counters["ratio"] =
-      static_cast<double>(data.size()) / static_cast<double>(compressed_data.size());
+      static_cast<double>(data_size) / static_cast<double>(compressed_data.size());
 
   while (state.KeepRunning()) {
     auto decompressor = *codec->MakeDecompressor();
@@ -162,9 +127,49 @@ static void StreamingDecompression(
         output_buffer.resize(output_buffer.size() * 2);
       }
     }
-    ARROW_CHECK(decompressed_size == static_cast<int64_t>(data.size()));
+    ARROW_CHECK(decompressed_size == data_size);
   }
-  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetBytesProcessed(state.iterations() * data_size);
+}
+
+#ifdef ARROW_WITH_BENCHMARKS_REFERENCE
+
+std::vector<uint8_t> MakeCompressibleData(int data_size) {
+  // XXX This isn't a real-world corpus so doesn't really represent the
+  // comparative qualities of the algorithms
+
+  // First make highly compressible data
+  std::string base_data =
+      "Apache Arrow is a cross-language development platform for in-memory data";
+  int nrepeats = static_cast<int>(1 + data_size / base_data.size());
+
+  std::vector<uint8_t> data(base_data.size() * nrepeats);
+  for (int i = 0; i < nrepeats; ++i) {
+    std::memcpy(data.data() + i * base_data.size(), base_data.data(), base_data.size());
+  }
+  data.resize(data_size);
+
+  // Then randomly mutate some bytes so as to make things harder
+  std::mt19937 engine(42);
+  std::exponential_distribution<> offsets(0.05);
+  std::uniform_int_distribution<> values(0, 255);
+
+  int64_t pos = 0;
+  while (pos < data_size) {
+    data[pos] = static_cast<uint8_t>(values(engine));
+    pos += static_cast<int64_t>(offsets(engine));
+  }
+
+  return data;
+}
+
+template <Compression::type COMPRESSION>
+static void ReferenceStreamingCompression(
+    benchmark::State& state) {                        // NOLINT non-const reference
+  auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
+
+  StreamingCompression(COMPRESSION, data.data(), data.size(),
+                       kUseDefaultCompressionLevel, state);
 }
 
 template <Compression::type COMPRESSION>
@@ -172,7 +177,8 @@ static void ReferenceStreamingDecompression(
     benchmark::State& state) {                        // NOLINT non-const reference
   auto data = MakeCompressibleData(8 * 1024 * 1024);  // 8 MB
 
-  StreamingDecompression(COMPRESSION, data, state);
+  StreamingDecompression(COMPRESSION, data.data(), data.size(),
+                         kUseDefaultCompressionLevel, state);
 }
 
 #ifdef ARROW_WITH_ZLIB
@@ -197,5 +203,268 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::LZ4_FRAME);
 
 #endif
 
+// ----------------------------------------------------------------------
+// Benchmarks on the buffers of Arrow arrays
+//
+// Each codec is run on the kinds of buffers found in Arrow data (and, once
+// encoded, in Parquet and IPC files), at several compression levels, with
+// the compression ratio reported alongside the throughput.
+
+enum BufferKind { kValidityBitmap, kOffsets, kInt64Deltas, kUtf8Data, kNumBufferKinds };
+
+const char* BufferKindName(int kind) {
+  switch (kind) {
+    case kValidityBitmap:
+      return "validity_bitmap";
+    case kOffsets:
+      return "offsets";
+    case kInt64Deltas:
+      return "int64_deltas";
+    case kUtf8Data:
+      return "utf8_data";
+    default:
+      return "unknown";
+  }
+}
+
+constexpr int64_t kArrowBufferSize = 4 * 1024 * 1024;  // 4 MB
+
+std::shared_ptr<Buffer> MakeArrowBuffer(int kind) {
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  switch (kind) {
+    case kValidityBitmap: {
+      // 5% nulls
+      auto array = rng.Boolean(kArrowBufferSize * 8, /*true_probability=*/0.95);
+      return array->data()->buffers[1];
+    }
+    case kOffsets: {
+      auto array = rng.String(kArrowBufferSize / sizeof(int32_t), /*min_length=*/0,
+                              /*max_length=*/32);
+      return array->data()->buffers[1];
+    }
+    case kInt64Deltas: {
+      // Increasing values with small deltas, such as timestamps or row ids
+      auto deltas = rng.Int64(kArrowBufferSize / sizeof(int64_t), /*min=*/0,
+                              /*max=*/1000);
+      auto buffer = *AllocateBuffer(kArrowBufferSize);
+      auto values = reinterpret_cast<int64_t*>(buffer->mutable_data());
+      auto delta_values = deltas->data()->GetValues<int64_t>(1);
+      int64_t value = 1600000000000;
+      for (int64_t i = 0; i < deltas->length(); ++i) {
+        value += delta_values[i];
+        values[i] = value;
+      }
+      return std::move(buffer);
+    }
+    case kUtf8Data: {
+      // Words drawn from a limited vocabulary
+      auto array = rng.StringWithRepeats(kArrowBufferSize / 8, /*unique=*/10000,
+                                         /*min_length=*/1, /*max_length=*/15);
+      return array->data()->buffers[2];
+    }
+    default:
+      return nullptr;
+  }
+}
+
+// The buffers are generated once and shared by all benchmarks and threads
+const Buffer& GetArrowBuffer(int kind) {
+  static const std::vector<std::shared_ptr<Buffer>> buffers = [] {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (int kind = 0; kind < kNumBufferKinds; ++kind) {
+      buffers.push_back(MakeArrowBuffer(kind));
+    }
+    return buffers;
+  }();
+  return *buffers[kind];
+}
+
+// Level 0 stands for the codec's default level
+int GetCompressionLevel(int64_t level) {
+  return level == 0 ? kUseDefaultCompressionLevel : static_cast<int>(level);
+}
+
+std::vector<int> GetBenchmarkLevels(Compression::type compression) {
+  switch (compression) {
+    case Compression::GZIP:
+      return {1, 6, 9};
+    case Compression::BROTLI:
+      return {1, 5, 8, 11};
+    case Compression::ZSTD:
+      return {1, 3, 9, 19};
+    case Compression::BZ2:
+      return {1, 9};
+    default:
+      return {0};
+  }
+}
+
+template <Compression::type COMPRESSION>
+static void ArrowBufferLevelArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"buffer", "level"});
+  for (int kind = 0; kind < kNumBufferKinds; ++kind) {
+    for (int level : GetBenchmarkLevels(COMPRESSION)) {
+      bench->Args({kind, level});
+    }
+  }
+}
+
+// Concurrent one-shot (de)compression at the default level, as done by the
+// Parquet and IPC readers and writers on several columns at once
+void ArrowBufferThreadArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"buffer", "level"});
+  for (int kind = 0; kind < kNumBufferKinds; ++kind) {
+    bench->Args({kind, 0});
+  }
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  bench->ThreadRange(1, max_threads)->UseRealTime();
+}
+
+template <Compression::type COMPRESSION>
+static void ArrowBufferCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const Buffer& data = GetArrowBuffer(static_cast<int>(state.range(0)));
+  auto codec = *Codec::Create(COMPRESSION, GetCompressionLevel(state.range(1)));
+  state.SetLabel(BufferKindName(static_cast<int>(state.range(0))));
+
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+  int64_t compressed_size = 0;
+  for (auto _ : state) {
+    compressed_size = *codec->Compress(data.size(), data.data(), compressed.size(),
+                                       compressed.data());
+  }
+  state.counters["ratio"] =
+      static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ArrowBufferDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const Buffer& data = GetArrowBuffer(static_cast<int>(state.range(0)));
+  auto codec = *Codec::Create(COMPRESSION, GetCompressionLevel(state.range(1)));
+  state.SetLabel(BufferKindName(static_cast<int>(state.range(0))));
+
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+  compressed.resize(
+      *codec->Compress(data.size(), data.data(), compressed.size(), compressed.data()));
+  std::vector<uint8_t> decompressed(data.size());
+  for (auto _ : state) {
+    auto decompressed_size = *codec->Decompress(compressed.size(), compressed.data(),
+                                                decompressed.size(), decompressed.data());
+    ARROW_CHECK(decompressed_size == data.size());
+  }
+  state.counters["ratio"] =
+      static_cast<double>(data.size()) / static_cast<double>(compressed.size());
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+template <Compression::type COMPRESSION>
+static void ArrowBufferStreamingCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const Buffer& data = GetArrowBuffer(static_cast<int>(state.range(0)));
+  state.SetLabel(BufferKindName(static_cast<int>(state.range(0))));
+  StreamingCompression(COMPRESSION, data.data(), data.size(),
+                       GetCompressionLevel(state.range(1)), state);
+}
+
+template <Compression::type COMPRESSION>
+static void ArrowBufferStreamingDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const Buffer& data = GetArrowBuffer(static_cast<int>(state.range(0)));
+  state.SetLabel(BufferKindName(static_cast<int>(state.range(0))));
+  StreamingDecompression(COMPRESSION, data.data(), data.size(),
+                         GetCompressionLevel(state.range(1)), state);
+}
+
+#ifdef ARROW_WITH_ZLIB
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::GZIP)
+    ->Apply(ArrowBufferLevelArgs<Compression::GZIP>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::GZIP)
+    ->Apply(ArrowBufferLevelArgs<Compression::GZIP>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::GZIP)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::GZIP)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingCompression, Compression::GZIP)
+    ->Apply(ArrowBufferLevelArgs<Compression::GZIP>);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingDecompression, Compression::GZIP)
+    ->Apply(ArrowBufferLevelArgs<Compression::GZIP>);
+#endif
+
+#ifdef ARROW_WITH_BROTLI
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::BROTLI)
+    ->Apply(ArrowBufferLevelArgs<Compression::BROTLI>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::BROTLI)
+    ->Apply(ArrowBufferLevelArgs<Compression::BROTLI>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::BROTLI)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::BROTLI)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingCompression, Compression::BROTLI)
+    ->Apply(ArrowBufferLevelArgs<Compression::BROTLI>);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingDecompression, Compression::BROTLI)
+    ->Apply(ArrowBufferLevelArgs<Compression::BROTLI>);
+#endif
+
+#ifdef ARROW_WITH_BZ2
+// BZ2 only supports streaming compression
+BENCHMARK_TEMPLATE(ArrowBufferStreamingCompression, Compression::BZ2)
+    ->Apply(ArrowBufferLevelArgs<Compression::BZ2>);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingDecompression, Compression::BZ2)
+    ->Apply(ArrowBufferLevelArgs<Compression::BZ2>);
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::ZSTD)
+    ->Apply(ArrowBufferLevelArgs<Compression::ZSTD>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::ZSTD)
+    ->Apply(ArrowBufferLevelArgs<Compression::ZSTD>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::ZSTD)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::ZSTD)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingCompression, Compression::ZSTD)
+    ->Apply(ArrowBufferLevelArgs<Compression::ZSTD>);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingDecompression, Compression::ZSTD)
+    ->Apply(ArrowBufferLevelArgs<Compression::ZSTD>);
+#endif
+
+#ifdef ARROW_WITH_LZ4
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::LZ4)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::LZ4)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::LZ4)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::LZ4)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4_FRAME>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4_FRAME>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingCompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4_FRAME>);
+BENCHMARK_TEMPLATE(ArrowBufferStreamingDecompression, Compression::LZ4_FRAME)
+    ->Apply(ArrowBufferLevelArgs<Compression::LZ4_FRAME>);
+#endif
+
+#ifdef ARROW_WITH_SNAPPY
+// Snappy only supports one-shot compression
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::SNAPPY)
+    ->Apply(ArrowBufferLevelArgs<Compression::SNAPPY>);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::SNAPPY)
+    ->Apply(ArrowBufferLevelArgs<Compression::SNAPPY>);
+BENCHMARK_TEMPLATE(ArrowBufferCompression, Compression::SNAPPY)
+    ->Apply(ArrowBufferThreadArgs);
+BENCHMARK_TEMPLATE(ArrowBufferDecompression, Compression::SNAPPY)
+    ->Apply(ArrowBufferThreadArgs);
+#endif
+
 }  // namespace util
 }  // namespace arrow
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -399,6 +400,84 @@ TEST(TestCodecMisc, SpecifyCompressionLevel) {
   }
 }
 
+// A codec copying its input, to test the codec factory registry
+class CopyCodec : public Codec {
+ public:
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Copy(input_len, input, output_buffer_len, output_buffer);
+  }
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Copy(input_len, input, output_buffer_len, output_buffer);
+  }
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override {
+    return input_len;
+  }
+  Result<std::shared_ptr<Compressor>> MakeCompressor() override {
+    return Status::NotImplemented("Streaming compression");
+  }
+  Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
+    return Status::NotImplemented("Streaming decompression");
+  }
+  Compression::type compression_type() const override { return Compression::LZO; }
+
+ private:
+  Result<int64_t> Copy(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                       uint8_t* output_buffer) {
+    if (output_buffer_len < input_len) {
+      return Status::Invalid("Output buffer too small");
+    }
+    if (input_len > 0) {
+      std::memcpy(output_buffer, input, static_cast<size_t>(input_len));
+    }
+    return input_len;
+  }
+};
+
+TEST(TestCodecMisc, RegisterFactory) {
+  ASSERT_FALSE(Codec::IsAvailable(Compression::LZO));
+  ASSERT_RAISES(NotImplemented, Codec::Create(Compression::LZO));
+
+  int num_created = 0;
+  ASSERT_OK(Codec::RegisterFactory(
+      Compression::LZO,
+      [&](const CodecOptions& options) -> Result<std::unique_ptr<Codec>> {
+        ++num_created;
+        return std::unique_ptr<Codec>(new CopyCodec());
+      }));
+  ASSERT_TRUE(Codec::IsAvailable(Compression::LZO));
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::LZO));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::LZO));
+  ASSERT_EQ(num_created, 2);
+  ASSERT_EQ(c1->name(), "lzo");
+  CheckCodecRoundtrip(c1, c2, MakeCompressibleData(1000));
+
+  ASSERT_OK(Codec::UnregisterFactory(Compression::LZO));
+  ASSERT_FALSE(Codec::IsAvailable(Compression::LZO));
+  ASSERT_RAISES(NotImplemented, Codec::Create(Compression::LZO));
+  ASSERT_RAISES(KeyError, Codec::UnregisterFactory(Compression::LZO));
+
+  ASSERT_RAISES(Invalid, Codec::RegisterFactory(Compression::UNCOMPRESSED,
+                                                [](const CodecOptions&) {
+                                                  return std::unique_ptr<Codec>();
+                                                }));
+  ASSERT_RAISES(Invalid, Codec::RegisterFactory(Compression::LZO, CodecFactory()));
+}
+
+TEST(TestCodecMisc, DictionaryNotSupported) {
+  CodecOptions options;
+  options.dictionary = Buffer::FromString("some dictionary");
+  for (auto compression : {Compression::GZIP, Compression::SNAPPY, Compression::LZ4,
+                           Compression::BROTLI, Compression::BZ2}) {
+    ASSERT_FALSE(Codec::SupportsDictionary(compression));
+    if (Codec::IsAvailable(compression)) {
+      ASSERT_RAISES(Invalid, Codec::Create(compression, options));
+    }
+  }
+  ASSERT_TRUE(Codec::SupportsDictionary(Compression::ZSTD));
+}
+
 TEST_P(CodecTest, OutputBufferIsSmall) {
   auto type = GetCompression();
   if (type != Compression::SNAPPY) {
@@ -587,6 +666,65 @@ INSTANTIATE_TEST_SUITE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2)
 
 #ifdef ARROW_WITH_ZSTD
 INSTANTIATE_TEST_SUITE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
+
+// Small records sharing most of their contents, which a dictionary helps with
+std::vector<std::shared_ptr<Buffer>> MakeDictionarySamples(int num_samples,
+                                                           uint32_t seed) {
+  std::default_random_engine rng(seed);
+  std::uniform_int_distribution<int> dist(0, 1000000);
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < num_samples; ++i) {
+    samples.push_back(Buffer::FromString(
+        "{\"id\": " + std::to_string(dist(rng)) +
+        ", \"name\": \"Apache Arrow\", \"kind\": \"columnar\", \"value\": " +
+        std::to_string(dist(rng)) + ", \"tags\": [\"memory\", \"format\"]}"));
+  }
+  return samples;
+}
+
+TEST(TestCodecZSTD, Dictionary) {
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       TrainZstdDictionary(MakeDictionarySamples(2000, 42), 4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  CodecOptions options;
+  options.compression_level = 3;
+  options.dictionary = dictionary;
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::ZSTD, options));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::ZSTD, options));
+  ASSERT_EQ(c1->dictionary(), dictionary);
+  ASSERT_OK_AND_ASSIGN(auto plain, Codec::Create(Compression::ZSTD, 3));
+  ASSERT_EQ(plain->dictionary(), nullptr);
+
+  auto sample = MakeDictionarySamples(1, 7)[0];
+  std::vector<uint8_t> data(sample->data(), sample->data() + sample->size());
+  CheckCodecRoundtrip(c1, c2, data);
+  CheckStreamingRoundtrip(c1.get(), data);
+  CheckStreamingRoundtrip(c1.get(), MakeRandomData(100000));
+
+  // The dictionary makes small records compress better
+  auto compressed_size = [&](Codec* codec) {
+    std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+    return *codec->Compress(data.size(), data.data(), compressed.size(),
+                            compressed.data());
+  };
+  ASSERT_LT(compressed_size(c1.get()), compressed_size(plain.get()));
+
+  // Data compressed with a dictionary can't be decompressed without it
+  std::vector<uint8_t> compressed(c1->MaxCompressedLen(data.size(), data.data()));
+  ASSERT_OK_AND_ASSIGN(auto size, c1->Compress(data.size(), data.data(),
+                                               compressed.size(), compressed.data()));
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError, plain->Decompress(size, compressed.data(), data.size(),
+                                          decompressed.data()));
+}
+
+TEST(TestCodecZSTD, TrainDictionaryErrors) {
+  ASSERT_RAISES(Invalid, TrainZstdDictionary(MakeDictionarySamples(10, 42), 0));
+  // Not enough samples
+  ASSERT_RAISES(Invalid, TrainZstdDictionary(MakeDictionarySamples(2, 42), 4096));
+}
 #endif
 
 #ifdef ARROW_WITH_LZ4
@@ -19,10 +19,15 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,18 +45,26 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// Digested dictionaries, shared by a codec and its streaming (de)compressors
+using CDictPtr = std::shared_ptr<ZSTD_CDict>;
+using DDictPtr = std::shared_ptr<ZSTD_DDict>;
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(DDictPtr ddict = NULLPTR)
+      : stream_(ZSTD_createDStream()), ddict_(std::move(ddict)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
   Status Init() {
     finished_ = false;
     size_t ret = ZSTD_initDStream(stream_);
+    if (!ZSTD_isError(ret) && ddict_) {
+      ret = ZSTD_DCtx_refDDict(stream_, ddict_.get());
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -88,6 +101,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  DDictPtr ddict_;
   bool finished_;
 };
 
@@ -96,13 +110,19 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level, CDictPtr cdict = NULLPTR)
+      : stream_(ZSTD_createCStream()),
+        cdict_(std::move(cdict)),
+        compression_level_(compression_level) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
   Status Init() {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    if (!ZSTD_isError(ret) && cdict_) {
+      // The compression level the dictionary was digested with applies
+      ret = ZSTD_CCtx_refCDict(stream_, cdict_.get());
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -165,6 +185,7 @@ class ZSTDCompressor : public Compressor {
   ZSTD_CStream* stream_;
 
  private:
+  CDictPtr cdict_;
   int compression_level_;
 };
 
@@ -173,10 +194,26 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level)
+  ZSTDCodec(int compression_level, std::shared_ptr<Buffer> dictionary)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+                               : compression_level),
+        dictionary_(std::move(dictionary)) {}
+
+  Status Init() override {
+    if (dictionary_ == nullptr) {
+      return Status::OK();
+    }
+    // Digest the dictionary once, rather than for each (de)compression
+    const auto dict_size = static_cast<size_t>(dictionary_->size());
+    cdict_.reset(ZSTD_createCDict(dictionary_->data(), dict_size, compression_level_),
+                 ZSTD_freeCDict);
+    ddict_.reset(ZSTD_createDDict(dictionary_->data(), dict_size), ZSTD_freeDDict);
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::OutOfMemory("Failed to load ZSTD dictionary");
+    }
+    return Status::OK();
+  }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -188,8 +225,17 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    size_t ret;
+    if (ddict_) {
+      std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(),
+                                                                ZSTD_freeDCtx);
+      ret = ZSTD_decompress_usingDDict(dctx.get(), output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len), ddict_.get());
+    } else {
+      ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                            static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -207,8 +253,17 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    size_t ret;
+    if (cdict_) {
+      std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(),
+                                                                ZSTD_freeCCtx);
+      ret = ZSTD_compress_usingCDict(cctx.get(), output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict_.get());
+    } else {
+      ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                          static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -216,13 +271,13 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, cdict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(ddict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -231,14 +286,51 @@ class ZSTDCodec : public Codec {
 
   int compression_level() const override { return compression_level_; }
 
+  std::shared_ptr<Buffer> dictionary() const override { return dictionary_; }
+
  private:
   const int compression_level_;
+  const std::shared_ptr<Buffer> dictionary_;
+  CDictPtr cdict_;
+  DDictPtr ddict_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level));
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::shared_ptr<Buffer> dictionary) {
+  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level, std::move(dictionary)));
+}
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size,
+    MemoryPool* pool) {
+  // ZDICT wants the samples back to back
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    total_size += sample->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sample_data, AllocateBuffer(total_size, pool));
+  uint8_t* out = sample_data->mutable_data();
+  for (const auto& sample : samples) {
+    if (sample->size() > 0) {
+      std::memcpy(out, sample->data(), static_cast<size_t>(sample->size()));
+      out += sample->size();
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto dictionary,
+                        AllocateResizableBuffer(max_dictionary_size, pool));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      sample_data->data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret), /*shrink_to_fit=*/true));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
 }
 
 }  // namespace internal
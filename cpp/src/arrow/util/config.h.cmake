@@ -39,6 +39,7 @@
 #cmakedefine ARROW_DATASET
 #cmakedefine ARROW_FILESYSTEM
 #cmakedefine ARROW_FLIGHT
+#cmakedefine ARROW_GANDIVA
 #cmakedefine ARROW_IPC
 #cmakedefine ARROW_JSON
 
@@ -19,22 +19,29 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+#include "arrow/array/data.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/time.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace internal {
@@ -406,5 +413,104 @@ class StringFormatter<TimestampType> {
   TimeUnit::type unit_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Decimal formatting
+
+template <typename T>
+class StringFormatter<T, enable_if_decimal<T>> {
+ public:
+  using value_type = typename std::conditional<T::type_id == Type::DECIMAL128,
+                                               Decimal128, Decimal256>::type;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& type)
+      : scale_(checked_cast<const DecimalType&>(*type).scale()) {}
+
+  template <typename Appender>
+  Return<Appender> operator()(const value_type& value, Appender&& append) {
+    const std::string formatted = value.ToString(scale_);
+    return append(util::string_view(formatted));
+  }
+
+  // Decimal array slots are visited as their raw little-endian bytes
+  template <typename Appender>
+  Return<Appender> operator()(util::string_view bytes, Appender&& append) {
+    return (*this)(value_type(reinterpret_cast<const uint8_t*>(bytes.data())),
+                   std::forward<Appender>(append));
+  }
+
+ private:
+  int32_t scale_;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Batch formatting
+
+/// \brief The expected length of a value formatted by StringFormatter<T>
+///
+/// This only sizes the allocations of FormatArrayValues(); longer values
+/// are still formatted correctly.
+template <typename T, typename Enable = void>
+struct FormattedLengthHint : std::integral_constant<int64_t, 24> {};
+
+template <typename T>
+struct FormattedLengthHint<T, enable_if_decimal<T>>
+    : std::integral_constant<int64_t, 48> {};
+
+/// \brief Format all the values of an array as contiguous string data
+///
+/// Values are formatted back to back into `data`, and the offset after each
+/// value is appended to `offsets` (which is expected to already hold the
+/// initial offset).  Null slots are formatted as empty strings; the caller is
+/// responsible for carrying over the validity bitmap.
+///
+/// Space is reserved a block of values at a time, rather than per value as
+/// an ArrayBuilder would do, and the formatter state (e.g. the floating-point
+/// converter) is set up once for the whole array.
+template <typename T, typename OffsetType>
+Status FormatArrayValues(const ArrayData& input, TypedBufferBuilder<OffsetType>* offsets,
+                         BufferBuilder* data) {
+  using value_type = typename ArrayDataInlineVisitor<T>::c_type;
+  constexpr int64_t kBlockSize = 1024;
+  constexpr int64_t kMaxOffset = std::numeric_limits<OffsetType>::max();
+
+  StringFormatter<T> formatter(input.type);
+  RETURN_NOT_OK(offsets->Reserve(input.length));
+
+  int64_t position = 0;
+  auto reserve_block = [&]() -> Status {
+    if (position++ % kBlockSize == 0) {
+      if (ARROW_PREDICT_FALSE(data->length() > kMaxOffset)) {
+        return Status::CapacityError("Formatted string data exceeds the maximum offset",
+                                     " of ", kMaxOffset);
+      }
+      const int64_t block_length = std::min(kBlockSize, input.length - position + 1);
+      return data->Reserve(block_length * FormattedLengthHint<T>::value);
+    }
+    return Status::OK();
+  };
+  auto append = [&](util::string_view v) {
+    return data->Append(v.data(), static_cast<int64_t>(v.size()));
+  };
+
+  RETURN_NOT_OK(VisitArrayDataInline<T>(
+      input,
+      [&](value_type v) {
+        RETURN_NOT_OK(reserve_block());
+        RETURN_NOT_OK(formatter(v, append));
+        offsets->UnsafeAppend(static_cast<OffsetType>(data->length()));
+        return Status::OK();
+      },
+      [&]() {
+        RETURN_NOT_OK(reserve_block());
+        offsets->UnsafeAppend(static_cast<OffsetType>(data->length()));
+        return Status::OK();
+      }));
+  if (ARROW_PREDICT_FALSE(data->length() > kMaxOffset)) {
+    return Status::CapacityError("Formatted string data exceeds the maximum offset of ",
+                                 kMaxOffset);
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace arrow
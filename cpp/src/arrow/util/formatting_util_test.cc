@@ -19,16 +19,21 @@
 #include <locale>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/formatting.h"
 
 namespace arrow {
 
+using internal::FormatArrayValues;
 using internal::StringFormatter;
 
 class StringAppender {
@@ -427,4 +432,68 @@ TEST(Formatting, Timestamp) {
   }
 }
 
+TEST(Formatting, Decimal) {
+  {
+    StringFormatter<Decimal128Type> formatter(decimal128(10, 3));
+
+    AssertFormatting(formatter, Decimal128(0), "0.000");
+    AssertFormatting(formatter, Decimal128(12345), "12.345");
+    AssertFormatting(formatter, Decimal128(-12345), "-12.345");
+  }
+
+  {
+    StringFormatter<Decimal256Type> formatter(decimal256(40, 0));
+
+    AssertFormatting(formatter, Decimal256("1234567890123456789012345678901234567890"),
+                     "1234567890123456789012345678901234567890");
+    AssertFormatting(formatter, Decimal256(-1), "-1");
+  }
+}
+
+template <typename T>
+void AssertFormatArrayValues(const std::shared_ptr<DataType>& type,
+                             const std::string& json,
+                             const std::vector<std::string>& expected) {
+  auto array = ArrayFromJSON(type, json);
+  TypedBufferBuilder<int32_t> offsets;
+  BufferBuilder data;
+  ASSERT_OK(offsets.Append(0));
+  ASSERT_OK(FormatArrayValues<T>(*array->data(), &offsets, &data));
+
+  ASSERT_EQ(offsets.length(), array->length() + 1);
+  const int32_t* raw_offsets = offsets.data();
+  const auto raw_data = reinterpret_cast<const char*>(data.data());
+  for (int64_t i = 0; i < array->length(); ++i) {
+    SCOPED_TRACE("index = " + std::to_string(i));
+    ASSERT_EQ(std::string(raw_data + raw_offsets[i], raw_offsets[i + 1] - raw_offsets[i]),
+              expected[i]);
+  }
+}
+
+TEST(Formatting, ArrayValues) {
+  // Null slots are formatted as empty strings
+  AssertFormatArrayValues<Int32Type>(int32(), "[1, null, -23, 456]",
+                                     {"1", "", "-23", "456"});
+  AssertFormatArrayValues<BooleanType>(boolean(), "[true, null, false]",
+                                       {"true", "", "false"});
+  AssertFormatArrayValues<DoubleType>(float64(), "[1.5, null, -0.25]",
+                                      {"1.5", "", "-0.25"});
+  AssertFormatArrayValues<TimestampType>(
+      timestamp(TimeUnit::SECOND), "[0, null, 1542129070]",
+      {"1970-01-01 00:00:00", "", "2018-11-13 17:11:10"});
+  AssertFormatArrayValues<Decimal128Type>(decimal128(5, 2), R"(["1.23", null, "-0.50"])",
+                                          {"1.23", "", "-0.50"});
+
+  // Sliced input
+  auto array = ArrayFromJSON(int64(), "[1, 22, null, 4444]")->Slice(1);
+  TypedBufferBuilder<int64_t> offsets;
+  BufferBuilder data;
+  ASSERT_OK(offsets.Append(0));
+  ASSERT_OK(FormatArrayValues<Int64Type>(*array->data(), &offsets, &data));
+  ASSERT_EQ(offsets.length(), 4);
+  ASSERT_EQ(offsets.data()[3], 6);
+  ASSERT_EQ(std::string(reinterpret_cast<const char*>(data.data()), data.length()),
+            "224444");
+}
+
 }  // namespace arrow
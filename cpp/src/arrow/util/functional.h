@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 
@@ -89,6 +91,9 @@ struct call_traits {
 /// Invoking it results in destruction of the lambda, freeing any state/references
 /// immediately. Invoking a default constructed FnOnce or one which has already been
 /// invoked will segfault.
+///
+/// Small callables (e.g. lambdas capturing a few pointers) are stored inline
+/// rather than on the heap, provided they can be moved without throwing.
 template <typename Signature>
 class FnOnce;
 
@@ -100,30 +105,96 @@ class FnOnce<R(A...)> {
   template <typename Fn,
             typename = typename std::enable_if<std::is_convertible<
                 typename std::result_of<Fn && (A...)>::type, R>::value>::type>
-  FnOnce(Fn fn) : impl_(new FnImpl<Fn>(std::move(fn))) {  // NOLINT runtime/explicit
+  FnOnce(Fn fn) {  // NOLINT runtime/explicit
+    Emplace(std::move(fn), FitsInline<Fn>());
   }
 
+  FnOnce(FnOnce&& other) noexcept { MoveFrom(&other); }
+
+  FnOnce& operator=(FnOnce&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+
+  ~FnOnce() { Reset(); }
+
   explicit operator bool() const { return impl_ != NULLPTR; }
 
   R operator()(A... a) && {
-    auto bye = std::move(impl_);
-    return bye->invoke(std::forward<A&&>(a)...);
+    struct ResetOnExit {
+      ~ResetOnExit() { self->Reset(); }
+      FnOnce* self;
+    } reset_on_exit{this};
+    return impl_->invoke(std::forward<A&&>(a)...);
   }
 
  private:
   struct Impl {
     virtual ~Impl() = default;
     virtual R invoke(A&&... a) = 0;
+    // Move an inline callable to `storage`, destroying this one
+    virtual Impl* MoveTo(void* storage) = 0;
   };
 
   template <typename Fn>
   struct FnImpl : Impl {
     explicit FnImpl(Fn fn) : fn_(std::move(fn)) {}
     R invoke(A&&... a) override { return std::move(fn_)(std::forward<A&&>(a)...); }
+    Impl* MoveTo(void* storage) override {
+      auto moved = new (storage) FnImpl(std::move(fn_));
+      this->~FnImpl();
+      return moved;
+    }
     Fn fn_;
   };
 
-  std::unique_ptr<Impl> impl_;
+  // Large enough for a continuation capturing a few shared_ptrs
+  static constexpr size_t kInlineSize = 64;
+  using Storage = typename std::aligned_storage<kInlineSize>::type;
+
+  template <typename Fn>
+  using FitsInline =
+      std::integral_constant<bool, sizeof(FnImpl<Fn>) <= sizeof(Storage) &&
+                                       alignof(FnImpl<Fn>) <= alignof(Storage) &&
+                                       std::is_nothrow_move_constructible<Fn>::value>;
+
+  template <typename Fn>
+  void Emplace(Fn fn, std::true_type /*fits_inline*/) {
+    impl_ = new (&storage_) FnImpl<Fn>(std::move(fn));
+  }
+
+  template <typename Fn>
+  void Emplace(Fn fn, std::false_type /*fits_inline*/) {
+    impl_ = new FnImpl<Fn>(std::move(fn));
+  }
+
+  bool is_inline() const {
+    return static_cast<const void*>(impl_) == static_cast<const void*>(&storage_);
+  }
+
+  void MoveFrom(FnOnce* other) {
+    if (other->is_inline()) {
+      impl_ = other->impl_->MoveTo(&storage_);
+    } else {
+      impl_ = other->impl_;
+    }
+    other->impl_ = NULLPTR;
+  }
+
+  void Reset() {
+    if (is_inline()) {
+      impl_->~Impl();
+    } else {
+      delete impl_;
+    }
+    impl_ = NULLPTR;
+  }
+
+  Impl* impl_ = NULLPTR;
+  Storage storage_;
 };
 
 }  // namespace internal
@@ -21,7 +21,9 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <numeric>
 
 #include "arrow/util/checked_cast.h"
@@ -306,12 +308,90 @@ ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
 
 }  // namespace
 
-std::unique_ptr<FutureImpl> FutureImpl::Make() {
-  return std::unique_ptr<FutureImpl>(new ConcreteFutureImpl());
+namespace {
+
+// A thread-local cache of freed memory blocks of a single size.  It is trivially
+// destructible so that it remains usable while the thread exits.
+struct BlockCache {
+  static constexpr int kCapacity = 64;
+
+  void* blocks[kCapacity];
+  // -1 once the thread has exited
+  int num_blocks;
+};
+
+struct BlockCacheReclaimer {
+  explicit BlockCacheReclaimer(BlockCache* cache) : cache(cache) {}
+
+  ~BlockCacheReclaimer() {
+    while (cache->num_blocks > 0) {
+      ::operator delete(cache->blocks[--cache->num_blocks]);
+    }
+    cache->num_blocks = -1;
+  }
+
+  BlockCache* cache;
+};
+
+template <size_t Size>
+BlockCache* GetBlockCache() {
+  static thread_local BlockCache cache;
+  static thread_local BlockCacheReclaimer reclaimer(&cache);
+  return &cache;
+}
+
+// An allocator recycling blocks through the calling thread's cache.  Futures
+// are short-lived and numerous in async pipelines, this saves a malloc/free pair
+// per future.
+template <typename T>
+struct RecyclingAllocator {
+  using value_type = T;
+
+  RecyclingAllocator() = default;
+  template <typename U>
+  RecyclingAllocator(const RecyclingAllocator<U>&) {}  // NOLINT runtime/explicit
+
+  T* allocate(size_t n) {
+    if (n == 1) {
+      BlockCache* cache = GetBlockCache<sizeof(T)>();
+      if (cache->num_blocks > 0) {
+        return static_cast<T*>(cache->blocks[--cache->num_blocks]);
+      }
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (n == 1) {
+      BlockCache* cache = GetBlockCache<sizeof(T)>();
+      if (cache->num_blocks >= 0 && cache->num_blocks < BlockCache::kCapacity) {
+        cache->blocks[cache->num_blocks++] = p;
+        return;
+      }
+    }
+    ::operator delete(p);
+  }
+
+  template <typename U>
+  bool operator==(const RecyclingAllocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const RecyclingAllocator<U>&) const {
+    return false;
+  }
+};
+
+}  // namespace
+
+std::shared_ptr<FutureImpl> FutureImpl::Make() {
+  return std::allocate_shared<ConcreteFutureImpl>(
+      RecyclingAllocator<ConcreteFutureImpl>());
 }
 
-std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
-  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
+std::shared_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  auto ptr = std::allocate_shared<ConcreteFutureImpl>(
+      RecyclingAllocator<ConcreteFutureImpl>());
   ptr->state_ = state;
   return std::move(ptr);
 }
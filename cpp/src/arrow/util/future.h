@@ -101,6 +101,36 @@ struct ContinueFuture {
 
     signal_to_complete_next.AddCallback(MarkNextFinished{std::move(next)});
   }
+
+  // Run a continuation right away, returning its result as a finished future
+  // rather than marking a pending one finished.
+
+  template <typename ContinueFunc, typename... Args,
+            typename ContinueResult = result_of_t<ContinueFunc && (Args && ...)>,
+            typename NextFuture = ForReturn<ContinueResult>>
+  static typename std::enable_if<std::is_void<ContinueResult>::value, NextFuture>::type
+  Immediately(ContinueFunc&& f, Args&&... a) {
+    std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+    return NextFuture::MakeFinished();
+  }
+
+  template <typename ContinueFunc, typename... Args,
+            typename ContinueResult = result_of_t<ContinueFunc && (Args && ...)>,
+            typename NextFuture = ForReturn<ContinueResult>>
+  static typename std::enable_if<!std::is_void<ContinueResult>::value &&
+                                     !is_future<ContinueResult>::value,
+                                 NextFuture>::type
+  Immediately(ContinueFunc&& f, Args&&... a) {
+    return NextFuture::MakeFinished(std::forward<ContinueFunc>(f)(std::forward<Args>(a)...));
+  }
+
+  template <typename ContinueFunc, typename... Args,
+            typename ContinueResult = result_of_t<ContinueFunc && (Args && ...)>,
+            typename NextFuture = ForReturn<ContinueResult>>
+  static typename std::enable_if<is_future<ContinueResult>::value, NextFuture>::type
+  Immediately(ContinueFunc&& f, Args&&... a) {
+    return std::forward<ContinueFunc>(f)(std::forward<Args>(a)...);
+  }
 };
 
 template <>
@@ -143,8 +173,10 @@ class ARROW_EXPORT FutureImpl {
 
   FutureState state() { return state_.load(); }
 
-  static std::unique_ptr<FutureImpl> Make();
-  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+  // FutureImpls are allocated together with their reference count, from a
+  // thread-local cache of recycled blocks
+  static std::shared_ptr<FutureImpl> Make();
+  static std::shared_ptr<FutureImpl> MakeFinished(FutureState state);
 
   // Future API
   void MarkFinished();
@@ -391,6 +423,11 @@ class ARROW_MUST_USE_TYPE Future {
   /// cyclic reference to itself through the callback.
   template <typename OnComplete>
   void AddCallback(OnComplete on_complete) const {
+    if (IsFutureFinished(impl_->state())) {
+      // Run it right away, without wrapping it in a Callback
+      std::move(on_complete)(*GetResult());
+      return;
+    }
     // We know impl_ will not be dangling when invoking callbacks because at least one
     // thread will be waiting for MarkFinished to return. Thus it's safe to keep a
     // weak reference to impl_ here
@@ -460,6 +497,16 @@ class ARROW_MUST_USE_TYPE Future {
                      ContinuedFuture>::value,
         "OnSuccess and OnFailure must continue with the same future type");
 
+    if (is_finished()) {
+      // Skip the callback and the synchronization of a pending continued future
+      const Result<T>& result = *GetResult();
+      if (ARROW_PREDICT_TRUE(result.ok())) {
+        return detail::ContinueFuture::Immediately(std::move(on_success),
+                                                   result.ValueOrDie());
+      }
+      return detail::ContinueFuture::Immediately(std::move(on_failure), result.status());
+    }
+
     auto next = ContinuedFuture::Make();
 
     struct Callback {
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "arrow/util/functional.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+static constexpr int64_t kNumFutures = 1000;
+
+// Chain continuations onto pending futures, then mark them finished
+static void ThenPending(benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    std::vector<Future<int>> sources(kNumFutures);
+    std::vector<Future<int>> continued(kNumFutures);
+    for (int64_t i = 0; i < kNumFutures; ++i) {
+      sources[i] = Future<int>::Make();
+      continued[i] = sources[i].Then([](const int& x) { return x + 1; });
+    }
+    for (int64_t i = 0; i < kNumFutures; ++i) {
+      sources[i].MarkFinished(static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(continued);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumFutures);
+}
+
+// Chain continuations onto already finished futures
+static void ThenFinished(benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    auto fut = Future<int>::MakeFinished(0);
+    for (int64_t i = 0; i < kNumFutures; ++i) {
+      fut = fut.Then([](const int& x) { return x + 1; });
+    }
+    ARROW_CHECK_EQ(*fut.result(), kNumFutures);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumFutures);
+}
+
+// Make and invoke a callback small enough to be stored inline
+static void FnOnceSmall(benchmark::State& state) {  // NOLINT non-const reference
+  auto data = std::make_shared<int>(1);
+  int64_t total = 0;
+  for (auto _ : state) {
+    internal::FnOnce<int()> fn = [data] { return *data; };
+    total += std::move(fn)();
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(ThenPending);
+BENCHMARK(ThenFinished);
+BENCHMARK(FnOnceSmall);
+
+}  // namespace arrow
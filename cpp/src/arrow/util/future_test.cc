@@ -1205,6 +1205,34 @@ TEST(FutureCompletionTest, ReuseCallback) {
   }
 }
 
+TEST(FutureCompletionTest, ThenOnFinished) {
+  // Continuations of a finished future run right away
+  auto fut = Future<int>::MakeFinished(1);
+  auto next = fut.Then([](const int& x) { return x + 1; });
+  ASSERT_TRUE(next.is_finished());
+  ASSERT_FINISHES_OK_AND_EQ(2, next);
+
+  auto failed = Future<int>::MakeFinished(Status::Invalid("XYZ"));
+  auto failed_next = failed.Then([](const int& x) { return x + 1; });
+  ASSERT_TRUE(failed_next.is_finished());
+  ASSERT_FINISHES_AND_RAISES(Invalid, failed_next);
+
+  auto recovered = failed.Then([](const int& x) { return x + 1; },
+                               [](const Status&) { return Result<int>(0); });
+  ASSERT_FINISHES_OK_AND_EQ(0, recovered);
+
+  // A continuation returning a future continues with that future
+  auto inner = Future<int>::Make();
+  auto chained = fut.Then([inner](const int&) { return inner; });
+  ASSERT_FALSE(chained.is_finished());
+  inner.MarkFinished(3);
+  ASSERT_FINISHES_OK_AND_EQ(3, chained);
+
+  bool ran = false;
+  fut.AddCallback([&ran](const Result<int>& result) { ran = result.ok(); });
+  ASSERT_TRUE(ran);
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
@@ -1597,6 +1625,49 @@ TEST(FnOnceTest, MoveOnlyDataType) {
   ASSERT_EQ(i1.moves, 0);
 }
 
+TEST(FnOnceTest, Storage) {
+  // Small callables are stored inline, large ones on the heap: both must survive
+  // moves and release their state once invoked or destroyed
+  auto state = std::make_shared<int>(42);
+  struct Large {
+    int operator()() { return *state + static_cast<int>(padding[0]); }
+    std::shared_ptr<int> state;
+    int64_t padding[16];
+  };
+
+  FnOnce<int()> small = [state] { return *state; };
+  FnOnce<int()> large = Large{state, {0}};
+  ASSERT_EQ(state.use_count(), 3);
+
+  FnOnce<int()> moved_small = std::move(small);
+  FnOnce<int()> moved_large;
+  moved_large = std::move(large);
+  ASSERT_FALSE(small);
+  ASSERT_FALSE(large);
+  ASSERT_EQ(state.use_count(), 3);
+
+  ASSERT_EQ(std::move(moved_small)(), 42);
+  ASSERT_FALSE(moved_small);
+  ASSERT_EQ(state.use_count(), 2);
+  ASSERT_EQ(std::move(moved_large)(), 42);
+  ASSERT_EQ(state.use_count(), 1);
+
+  {
+    FnOnce<int()> discarded = [state] { return *state; };
+    ASSERT_EQ(state.use_count(), 2);
+  }
+  ASSERT_EQ(state.use_count(), 1);
+
+  // A move-only callable
+  struct MoveOnly {
+    int operator()() { return *data.data; }
+    MoveOnlyDataType data;
+  };
+  FnOnce<int()> move_only = MoveOnly{MoveOnlyDataType(7)};
+  FnOnce<int()> moved_move_only = std::move(move_only);
+  ASSERT_EQ(std::move(moved_move_only)(), 7);
+}
+
 }  // namespace internal
 
 }  // namespace arrow
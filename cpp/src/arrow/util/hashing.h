@@ -42,6 +42,7 @@
 #include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -364,6 +365,260 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An open-addressing insert-only hash table (no deletes) with a Swiss table
+// layout.
+//
+// Besides the entries, a separate array holds one control byte per slot: either
+// kEmpty or a 7-bit tag taken from the hash of the slot's entry.  Lookups compare
+// the control bytes of a whole group of consecutive slots at once (16 with SSE,
+// 8 with portable SWAR code) and only touch the entries whose tag matches, so that
+// a miss usually costs a single cache line of control bytes.  Groups are probed
+// in triangular order.  The first (group width - 1) control bytes are mirrored
+// after the end of the array so that groups never need to wrap around.
+
+namespace detail {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+// A group of 16 control bytes, compared with SSE2 instructions
+class SwissGroup {
+ public:
+  static constexpr int kWidth = 16;
+
+  explicit SwissGroup(const uint8_t* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  // A bitmask of the slots with the given tag, one bit per slot
+  uint64_t Match(uint8_t tag) const {
+    const __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), ctrl_);
+    return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(match)));
+  }
+
+  // A bitmask of the empty slots (the only control bytes with the high bit set)
+  uint64_t MatchEmpty() const {
+    return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+  }
+
+  // The offset in the group of the slot of the lowest bit set in a mask
+  static int Offset(uint64_t mask) { return BitUtil::CountTrailingZeros(mask); }
+
+ private:
+  __m128i ctrl_;
+};
+
+#else
+
+// A group of 8 control bytes, compared in a 64-bit word
+class SwissGroup {
+ public:
+  static constexpr int kWidth = 8;
+
+  explicit SwissGroup(const uint8_t* ctrl)
+      : ctrl_(BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(ctrl))) {}
+
+  // A bitmask of the slots with the given tag, the high bit of each byte.  A byte
+  // following a match may be a false positive, which the caller's full hash
+  // comparison weeds out.
+  uint64_t Match(uint8_t tag) const {
+    const uint64_t x = ctrl_ ^ (kLsbs * tag);
+    return (x - kLsbs) & ~x & kMsbs;
+  }
+
+  // A bitmask of the empty slots (the only control bytes with the high bit set)
+  uint64_t MatchEmpty() const { return ctrl_ & kMsbs; }
+
+  // The offset in the group of the slot of the lowest bit set in a mask
+  static int Offset(uint64_t mask) { return BitUtil::CountTrailingZeros(mask) >> 3; }
+
+ private:
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  uint64_t ctrl_;
+};
+
+#endif
+
+}  // namespace detail
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr uint8_t kEmpty = 0x80;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), ctrl_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements, and room for `capacity` elements without upsizing
+    capacity = std::max<uint64_t>(capacity + capacity / 7 + 1, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    capacity_mask_ = capacity_ - 1;
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffers(capacity_));
+  }
+
+  // Lookup with group probing
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, ctrl_, entries_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, ctrl_, entries_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    const uint64_t index = static_cast<uint64_t>(entry - entries_);
+    // Ensure entry is empty before inserting
+    assert(ctrl_[index] == kEmpty);
+    SetCtrl(ctrl_, capacity_, index, Tag(h));
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 4);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (ctrl_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  using Group = detail::SwissGroup;
+
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const uint8_t* ctrl, const Entry* entries,
+                                   uint64_t size_mask, CmpFunc&& cmp_func) const {
+    const uint8_t tag = Tag(h);
+    uint64_t index = Position(h) & size_mask;
+    uint64_t stride = 0;
+
+    while (true) {
+      const Group group(ctrl + index);
+      if (CKind == DoCompare) {
+        for (uint64_t match = group.Match(tag); match != 0; match &= match - 1) {
+          const uint64_t slot = (index + Group::Offset(match)) & size_mask;
+          if (entries[slot].h == h && cmp_func(&entries[slot].payload)) {
+            // Found
+            return {slot, true};
+          }
+        }
+      }
+      const uint64_t empty = group.MatchEmpty();
+      if (empty != 0) {
+        // Empty slot
+        return {(index + Group::Offset(empty)) & size_mask, false};
+      }
+
+      // Triangular probing visits every group of a power-of-two table
+      stride += Group::kWidth;
+      index = (index + stride) & size_mask;
+    }
+  }
+
+  // The tag uses the low bits of the hash, as the integer hash functions above
+  // mix them best; the starting position uses the bits above.
+  static uint8_t Tag(hash_t h) { return static_cast<uint8_t>(h & 0x7f); }
+  static uint64_t Position(hash_t h) { return h >> 7; }
+
+  static void SetCtrl(uint8_t* ctrl, uint64_t capacity, uint64_t index, uint8_t tag) {
+    ctrl[index] = tag;
+    if (index < Group::kWidth - 1) {
+      // Mirrored control byte
+      ctrl[capacity + index] = tag;
+    }
+  }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffers(uint64_t capacity) {
+    // Entries are only read once their control byte is set, no need to zero them
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    const uint64_t ctrl_size = capacity + Group::kWidth - 1;
+    RETURN_NOT_OK(ctrl_builder_.Resize(ctrl_size));
+    ctrl_ = ctrl_builder_.mutable_data();
+    memset(ctrl_, kEmpty, ctrl_size);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    uint64_t new_mask = new_capacity - 1;
+    assert((new_capacity & new_mask) == 0);  // it's a power of two
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const uint8_t* old_ctrl = ctrl_;
+    const Entry* old_entries = entries_;
+    std::shared_ptr<Buffer> previous_ctrl, previous_entries;
+    RETURN_NOT_OK(ctrl_builder_.Finish(&previous_ctrl));
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffers(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_ctrl[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, ctrl_, entries_, new_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        SetCtrl(ctrl_, new_capacity, p.first, old_ctrl[i]);
+        entries_[p.first] = entry;
+      }
+    }
+    capacity_ = new_capacity;
+    capacity_mask_ = new_mask;
+
+    return Status::OK();
+  }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  uint64_t capacity_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  uint8_t* ctrl_;
+  Entry* entries_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> ctrl_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -589,8 +844,12 @@ class SmallScalarMemoTable : public MemoTable {
 
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
+//
+// It defaults to a SwissHashTable: comparing a value to an entry means loading
+// its offsets and data from the builder, which the control byte tags mostly avoid.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = SwissHashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -800,8 +1059,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
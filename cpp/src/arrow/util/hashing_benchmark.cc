@@ -111,6 +111,49 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// ----------------------------------------------------------------------
+// Memo table benchmarks: GetOrInsert() of many values drawn from a number of
+// distinct values, with either hash table layout
+
+static constexpr int32_t kMemoTableValues = 1 << 18;
+
+template <typename Value>
+static std::vector<Value> MakeRepeatedValues(const std::vector<Value>& distinct) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> index_dist(0, distinct.size() - 1);
+  std::vector<Value> values(kMemoTableValues);
+  std::generate(values.begin(), values.end(),
+                [&]() { return distinct[index_dist(gen)]; });
+  return values;
+}
+
+template <typename MemoTableType, typename Value>
+static void BenchmarkMemoTable(benchmark::State& state,  // NOLINT non-const reference
+                               const std::vector<Value>& values) {
+  while (state.KeepRunning()) {
+    MemoTableType table(default_memory_pool(), 0);
+    for (const auto& v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedValues(MakeIntegers<int64_t>(state.range(0)));
+  BenchmarkMemoTable<ScalarMemoTable<int64_t, HashTableTemplateType>>(state, values);
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values = MakeRepeatedValues(MakeStrings(state.range(0), 2, 20));
+  BenchmarkMemoTable<BinaryMemoTable<BinaryBuilder, HashTableTemplateType>>(state,
+                                                                            values);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +162,16 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+BENCHMARK_TEMPLATE(MemoTableInt64, HashTable)->RangeMultiplier(100)->Range(10, 1000000);
+BENCHMARK_TEMPLATE(MemoTableInt64, SwissHashTable)
+    ->RangeMultiplier(100)
+    ->Range(10, 1000000);
+BENCHMARK_TEMPLATE(MemoTableStrings, HashTable)
+    ->RangeMultiplier(100)
+    ->Range(10, 1000000);
+BENCHMARK_TEMPLATE(MemoTableStrings, SwissHashTable)
+    ->RangeMultiplier(100)
+    ->Range(10, 1000000);
+
 }  // namespace internal
 }  // namespace arrow
@@ -374,6 +374,47 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, SwissHashTableInt64) {
+  // Enough distinct values to upsize the table several times
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(std::numeric_limits<int64_t>::min(),
+                                                    std::numeric_limits<int64_t>::max());
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 500;
+#else
+  const int32_t n_values = 20000;
+#endif
+
+  ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+  std::unordered_map<int64_t, int32_t> map;
+  std::vector<int64_t> inserted;
+
+  for (int32_t i = 0; i < n_values; ++i) {
+    // Look up every other value a second time
+    int64_t value = (i % 2 == 1) ? inserted[i / 2] : value_dist(gen);
+    int32_t expected, actual;
+    auto it = map.find(value);
+    if (it == map.end()) {
+      expected = static_cast<int32_t>(map.size());
+      map[value] = expected;
+      inserted.push_back(value);
+    } else {
+      expected = it->second;
+    }
+    ASSERT_OK(table.GetOrInsert(value, &actual));
+    ASSERT_EQ(actual, expected);
+  }
+  ASSERT_EQ(table.size(), map.size());
+  AssertGetNull(table, kKeyNotFound);
+  AssertGet(table, inserted[0], 0);
+  AssertGetOrInsertNull(table, table.size());
+
+  std::vector<int64_t> values(table.size());
+  table.CopyValues(values.data());
+  inserted.push_back(0);
+  ASSERT_EQ(values, inserted);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -447,7 +488,8 @@ TEST(BinaryMemoTable, Basics) {
   }
 }
 
-TEST(BinaryMemoTable, Stress) {
+template <typename MemoTableType>
+void CheckBinaryMemoTableStress() {
 #ifdef ARROW_VALGRIND
   const int32_t n_values = 20;
   const int32_t n_repeats = 20;
@@ -458,7 +500,7 @@ TEST(BinaryMemoTable, Stress) {
 
   const auto values = MakeDistinctStrings(n_values);
 
-  BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+  MemoTableType table(default_memory_pool(), 0);
   std::unordered_map<std::string, int32_t> map;
 
   for (int32_t i = 0; i < n_repeats; ++i) {
@@ -478,6 +520,14 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, Stress) {
+  CheckBinaryMemoTableStress<BinaryMemoTable<BinaryBuilder>>();
+}
+
+TEST(BinaryMemoTable, StressHashTable) {
+  CheckBinaryMemoTableStress<BinaryMemoTable<BinaryBuilder, HashTable>>();
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/util/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// serialization format: a header followed by the sparse entries (uint32 count,
+// then uint32 entries) or the registers (uint8 ranks), little endian
+constexpr uint8_t kFormatVersion = 1;
+constexpr uint8_t kSparseEncoding = 0;
+constexpr uint8_t kDenseEncoding = 1;
+constexpr size_t kHeaderSize = 3;
+
+// sigma and tau functions of Ertl's improved raw estimator, which corrects the
+// bias of the original estimator at small and large cardinalities without the
+// empirical correction tables of HyperLogLog++
+double Sigma(double x) {
+  if (x == 1.0) return std::numeric_limits<double>::infinity();
+  double y = 1.0;
+  double z = x;
+  double z_prev;
+  do {
+    x *= x;
+    z_prev = z;
+    z += x * y;
+    y += y;
+  } while (z != z_prev);
+  return z;
+}
+
+double Tau(double x) {
+  if (x == 0.0 || x == 1.0) return 0.0;
+  double y = 1.0;
+  double z = 1.0 - x;
+  double z_prev;
+  do {
+    x = std::sqrt(x);
+    z_prev = z;
+    y *= 0.5;
+    z -= (1.0 - x) * (1.0 - x) * y;
+  } while (z != z_prev);
+  return z / 3.0;
+}
+
+}  // namespace
+
+HyperLogLog::HyperLogLog(int precision) : precision_(precision) {
+  DCHECK_GE(precision, kMinPrecision);
+  DCHECK_LE(precision, kMaxPrecision);
+}
+
+void HyperLogLog::MergeSparseBuffer() {
+  if (sparse_buffer_.empty()) return;
+  std::sort(sparse_buffer_.begin(), sparse_buffer_.end());
+  const auto mid = static_cast<std::ptrdiff_t>(sparse_.size());
+  sparse_.insert(sparse_.end(), sparse_buffer_.begin(), sparse_buffer_.end());
+  std::inplace_merge(sparse_.begin(), sparse_.begin() + mid, sparse_.end());
+  sparse_buffer_.clear();
+
+  // entries of the same index are sorted by rank, keep the last one
+  size_t out = 0;
+  for (size_t i = 0; i < sparse_.size(); ++i) {
+    if (out > 0 && (sparse_[out - 1] >> 6) == (sparse_[i] >> 6)) {
+      --out;
+    }
+    sparse_[out++] = sparse_[i];
+  }
+  sparse_.resize(out);
+
+  if (sparse_.size() > sparse_limit()) {
+    ConvertToDense();
+  }
+}
+
+void HyperLogLog::AddSparseEntriesToRegisters(const std::vector<uint32_t>& entries) {
+  const int extra_bits = kSparsePrecision - precision_;
+  const uint32_t extra_mask = (uint32_t(1) << extra_bits) - 1;
+  for (uint32_t entry : entries) {
+    const uint32_t sparse_index = entry >> 6;
+    const uint32_t extra = sparse_index & extra_mask;
+    // the index bits beyond precision are the first bits the rank is counted on
+    const auto rank = static_cast<uint8_t>(
+        extra != 0 ? BitUtil::CountLeadingZeros(extra) - (32 - extra_bits) + 1
+                   : extra_bits + (entry & 0x3f));
+    uint8_t& reg = registers_[sparse_index >> extra_bits];
+    reg = std::max(reg, rank);
+  }
+}
+
+void HyperLogLog::ConvertToDense() {
+  registers_.assign(num_registers(), 0);
+  AddSparseEntriesToRegisters(sparse_);
+  AddSparseEntriesToRegisters(sparse_buffer_);
+  std::vector<uint32_t>().swap(sparse_);
+  std::vector<uint32_t>().swap(sparse_buffer_);
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+  DCHECK_EQ(precision_, other.precision_);
+  if (other.is_sparse()) {
+    if (is_sparse()) {
+      sparse_buffer_.insert(sparse_buffer_.end(), other.sparse_.begin(),
+                            other.sparse_.end());
+      sparse_buffer_.insert(sparse_buffer_.end(), other.sparse_buffer_.begin(),
+                            other.sparse_buffer_.end());
+      MergeSparseBuffer();
+    } else {
+      AddSparseEntriesToRegisters(other.sparse_);
+      AddSparseEntriesToRegisters(other.sparse_buffer_);
+    }
+    return;
+  }
+  if (is_sparse()) {
+    ConvertToDense();
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+}
+
+double HyperLogLog::Estimate() {
+  if (!is_sparse()) {
+    return EstimateDense();
+  }
+  MergeSparseBuffer();
+  if (!is_sparse()) {
+    return EstimateDense();
+  }
+  // linear counting over the 2^kSparsePrecision sparse registers, which is close
+  // to exact at the cardinalities the sparse list can hold
+  const double m = static_cast<double>(uint64_t(1) << kSparsePrecision);
+  const double num_empty = m - static_cast<double>(sparse_.size());
+  return m * std::log(m / num_empty);
+}
+
+double HyperLogLog::EstimateDense() const {
+  const int q = 64 - precision_;
+  const double m = static_cast<double>(num_registers());
+
+  // histogram of register ranks, in [0, q + 1]
+  std::vector<int64_t> counts(q + 2, 0);
+  for (uint8_t rank : registers_) {
+    ++counts[rank];
+  }
+
+  double z = m * Tau(1.0 - static_cast<double>(counts[q + 1]) / m);
+  for (int k = q; k >= 1; --k) {
+    z += static_cast<double>(counts[k]);
+    z *= 0.5;
+  }
+  z += m * Sigma(static_cast<double>(counts[0]) / m);
+  // alpha_inf = 1 / (2 ln 2)
+  return m * m / (2.0 * std::log(2.0) * z);
+}
+
+std::string HyperLogLog::Serialize() {
+  MergeSparseBuffer();
+
+  std::string out;
+  out.push_back(static_cast<char>(kFormatVersion));
+  out.push_back(static_cast<char>(precision_));
+  if (is_sparse()) {
+    out.push_back(static_cast<char>(kSparseEncoding));
+    out.resize(kHeaderSize + (1 + sparse_.size()) * sizeof(uint32_t));
+    char* data = &out[kHeaderSize];
+    const auto count = BitUtil::ToLittleEndian(static_cast<uint32_t>(sparse_.size()));
+    std::memcpy(data, &count, sizeof(uint32_t));
+    for (uint32_t entry : sparse_) {
+      data += sizeof(uint32_t);
+      entry = BitUtil::ToLittleEndian(entry);
+      std::memcpy(data, &entry, sizeof(uint32_t));
+    }
+  } else {
+    out.push_back(static_cast<char>(kDenseEncoding));
+    out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  }
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(util::string_view serialized) {
+  if (serialized.size() < kHeaderSize) {
+    return Status::Invalid("HyperLogLog sketch is truncated");
+  }
+  const auto data = reinterpret_cast<const uint8_t*>(serialized.data());
+  if (data[0] != kFormatVersion) {
+    return Status::Invalid("Unsupported HyperLogLog sketch version ",
+                           static_cast<int>(data[0]));
+  }
+  const int precision = data[1];
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog sketch has invalid precision ", precision);
+  }
+  HyperLogLog sketch(precision);
+  const uint8_t* payload = data + kHeaderSize;
+  const size_t payload_size = serialized.size() - kHeaderSize;
+
+  if (data[2] == kSparseEncoding) {
+    uint32_t count;
+    if (payload_size < sizeof(uint32_t)) {
+      return Status::Invalid("HyperLogLog sketch is truncated");
+    }
+    std::memcpy(&count, payload, sizeof(uint32_t));
+    count = BitUtil::FromLittleEndian(count);
+    if (count > sketch.sparse_limit() ||
+        payload_size != (1 + static_cast<size_t>(count)) * sizeof(uint32_t)) {
+      return Status::Invalid("HyperLogLog sketch has invalid size");
+    }
+    sketch.sparse_.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t entry;
+      std::memcpy(&entry, payload + (1 + i) * sizeof(uint32_t), sizeof(uint32_t));
+      entry = BitUtil::FromLittleEndian(entry);
+      const uint32_t rank = entry & 0x3f;
+      if (rank == 0 || rank > 64 - kSparsePrecision + 1 ||
+          (i > 0 && (entry >> 6) <= (sketch.sparse_[i - 1] >> 6))) {
+        return Status::Invalid("HyperLogLog sketch has invalid entries");
+      }
+      sketch.sparse_[i] = entry;
+    }
+  } else if (data[2] == kDenseEncoding) {
+    if (payload_size != sketch.num_registers()) {
+      return Status::Invalid("HyperLogLog sketch has invalid size");
+    }
+    sketch.registers_.assign(payload, payload + payload_size);
+    std::vector<uint32_t>().swap(sketch.sparse_buffer_);
+    for (uint8_t rank : sketch.registers_) {
+      if (rank > 64 - precision + 1) {
+        return Status::Invalid("HyperLogLog sketch has invalid registers");
+      }
+    }
+  } else {
+    return Status::Invalid("Unknown HyperLogLog sketch encoding ",
+                           static_cast<int>(data[2]));
+  }
+  return std::move(sketch);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// approximate distinct counts from arbitrary length dataset with bounded space
+// based on 'HyperLogLog in Practice: Algorithmic Engineering of a State of The Art
+// Cardinality Estimation Algorithm' from Heule, Nunkesser & Hall (HyperLogLog++)
+// - https://research.google/pubs/pub40671/
+// and the improved raw estimator of 'New cardinality estimation algorithms for
+// HyperLogLog sketches' from Ertl
+// - https://arxiv.org/abs/1702.01284
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 14;
+
+  // precision is the number of hash bits indexing the 2^precision registers,
+  // the standard error of estimates is about 1.04 / sqrt(2^precision)
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  int precision() const { return precision_; }
+
+  // add a 64-bit hash of a value, the hash must disperse all its bits well
+  // this function is intensively called and performance critical
+  void Add(uint64_t hash) {
+    if (is_sparse()) {
+      sparse_buffer_.push_back(EncodeSparse(hash));
+      if (ARROW_PREDICT_FALSE(sparse_buffer_.size() >= sparse_buffer_limit())) {
+        MergeSparseBuffer();
+      }
+      return;
+    }
+    const auto index = static_cast<size_t>(hash >> (64 - precision_));
+    // the sentinel bit caps the rank at 64 - precision + 1
+    const auto rank = static_cast<uint8_t>(
+        BitUtil::CountLeadingZeros((hash << precision_) |
+                                   (uint64_t(1) << (precision_ - 1))) +
+        1);
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  // merge with another sketch of the same precision
+  void Merge(const HyperLogLog& other);
+
+  // estimate the number of distinct hashes added
+  double Estimate();
+
+  // serialize, e.g. to store pre-aggregated sketches, and restore
+  std::string Serialize();
+  static Result<HyperLogLog> Deserialize(util::string_view serialized);
+
+  // check if the sketch still uses the sparse representation
+  bool is_sparse() const { return registers_.empty(); }
+
+ private:
+  // While few registers are set, the sketch is a sorted list of entries each
+  // encoding the register index and rank at kSparsePrecision. Estimates are more
+  // accurate, and the list takes less memory than the registers.
+  static constexpr int kSparsePrecision = 25;
+
+  static uint32_t EncodeSparse(uint64_t hash) {
+    const auto index = static_cast<uint32_t>(hash >> (64 - kSparsePrecision));
+    const auto rank = static_cast<uint32_t>(
+        BitUtil::CountLeadingZeros((hash << kSparsePrecision) |
+                                   (uint64_t(1) << (kSparsePrecision - 1))) +
+        1);
+    return (index << 6) | rank;
+  }
+
+  size_t num_registers() const { return size_t(1) << precision_; }
+  size_t sparse_buffer_limit() const { return std::max<size_t>(num_registers() / 16, 1); }
+  // beyond this number of entries the sparse list takes more memory than registers
+  size_t sparse_limit() const { return num_registers() / 4; }
+
+  // sort buffered entries into the sparse list, switching to registers if it's full
+  void MergeSparseBuffer();
+  void AddSparseEntriesToRegisters(const std::vector<uint32_t>& entries);
+  void ConvertToDense();
+  double EstimateDense() const;
+
+  int precision_;
+  // sorted entries, with a single entry holding the maximum rank of each index
+  std::vector<uint32_t> sparse_;
+  // entries not merged into sparse_ yet
+  std::vector<uint32_t> sparse_buffer_;
+  // one rank per register, empty while the sketch is sparse
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+// SplitMix64, hashes for distinct values are distinct
+static uint64_t Hash(uint64_t value) {
+  uint64_t h = value + 0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog hll;
+  ASSERT_EQ(hll.Estimate(), 0);
+  ASSERT_TRUE(hll.is_sparse());
+}
+
+TEST(HyperLogLogTest, SmallCardinalities) {
+  // the sparse representation counts few values almost exactly
+  HyperLogLog hll;
+  for (uint64_t n = 1; n <= 3000; ++n) {
+    hll.Add(Hash(n));
+    hll.Add(Hash(n / 2));
+    if (n % 100 == 0) {
+      ASSERT_EQ(std::llround(hll.Estimate()), n + 1);
+    }
+  }
+  ASSERT_TRUE(hll.is_sparse());
+}
+
+TEST(HyperLogLogTest, LargeCardinalities) {
+  for (int precision : {HyperLogLog::kMinPrecision, 10, HyperLogLog::kDefaultPrecision,
+                        HyperLogLog::kMaxPrecision}) {
+    SCOPED_TRACE(precision);
+    // allow 4 times the standard error
+    const double tolerance = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    HyperLogLog hll(precision);
+    uint64_t n = 0;
+    for (uint64_t cardinality : {1000, 100000, 1000000}) {
+      for (; n < cardinality; ++n) {
+        hll.Add(Hash(n));
+      }
+      ASSERT_NEAR(hll.Estimate() / static_cast<double>(cardinality), 1.0, tolerance);
+    }
+    ASSERT_FALSE(hll.is_sparse());
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  // sparse into sparse, sparse into dense, dense into sparse and dense into dense
+  for (uint64_t left_size : {100, 100000}) {
+    for (uint64_t right_size : {100, 100000}) {
+      HyperLogLog left, right, both;
+      for (uint64_t i = 0; i < left_size; ++i) {
+        left.Add(Hash(i));
+        both.Add(Hash(i));
+      }
+      for (uint64_t i = 0; i < right_size; ++i) {
+        right.Add(Hash(i + 50));
+        both.Add(Hash(i + 50));
+      }
+      left.Merge(right);
+      ASSERT_EQ(left.Estimate(), both.Estimate());
+      ASSERT_EQ(left.Serialize(), both.Serialize());
+    }
+  }
+}
+
+TEST(HyperLogLogTest, Serialize) {
+  for (uint64_t size : {0, 10, 100000}) {
+    HyperLogLog hll(12);
+    for (uint64_t i = 0; i < size; ++i) {
+      hll.Add(Hash(i));
+    }
+    const std::string serialized = hll.Serialize();
+    ASSERT_OK_AND_ASSIGN(auto restored, HyperLogLog::Deserialize(serialized));
+    ASSERT_EQ(restored.precision(), 12);
+    ASSERT_EQ(restored.is_sparse(), hll.is_sparse());
+    ASSERT_EQ(restored.Estimate(), hll.Estimate());
+    ASSERT_EQ(restored.Serialize(), serialized);
+
+    // the restored sketch keeps counting
+    for (uint64_t i = size; i < size + 100; ++i) {
+      hll.Add(Hash(i));
+      restored.Add(Hash(i));
+    }
+    ASSERT_EQ(restored.Serialize(), hll.Serialize());
+  }
+}
+
+TEST(HyperLogLogTest, DeserializeInvalid) {
+  HyperLogLog hll(12);
+  hll.Add(Hash(1));
+  hll.Add(Hash(2));
+  const std::string serialized = hll.Serialize();
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 2)));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 9)));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized + "x"));
+
+  std::string corrupted = serialized;
+  corrupted[0] = 2;  // version
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(corrupted));
+  corrupted = serialized;
+  corrupted[1] = 30;  // precision
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(corrupted));
+  corrupted = serialized;
+  corrupted[2] = 7;  // encoding
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(corrupted));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -65,7 +65,9 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <limits.h>  // IOV_MAX
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -1248,6 +1250,83 @@ static inline int64_t pread_compat(int fd, void* buf, int64_t nbytes, int64_t po
 #endif
 }
 
+#ifndef _WIN32
+
+#ifdef IOV_MAX
+static constexpr int kMaxIOVecs = IOV_MAX;
+#else
+static constexpr int kMaxIOVecs = 1024;
+#endif
+
+// Transfer the bytes of the slices with as few calls to `transfer` as the
+// system limits allow.  `transfer` is given the iovecs of the next bytes and
+// the number of bytes already transferred, and returns the number of bytes it
+// transferred (0 at EOF) or -1 on error.  Return the total number of bytes
+// transferred.
+template <typename Transfer>
+static Result<int64_t> VectoredTransfer(const std::vector<IOSlice>& slices,
+                                        Transfer&& transfer, const char* error_message) {
+  const int64_t max_chunksize = ARROW_MAX_IO_CHUNKSIZE;
+  std::vector<struct iovec> iovecs;
+  int64_t transferred = 0;
+  // The next byte to transfer
+  size_t slice_index = 0;
+  int64_t slice_offset = 0;
+
+  while (slice_index < slices.size()) {
+    iovecs.clear();
+    int64_t chunksize = 0;
+    size_t index = slice_index;
+    int64_t offset = slice_offset;
+    while (index < slices.size() && static_cast<int>(iovecs.size()) < kMaxIOVecs &&
+           chunksize < max_chunksize) {
+      const int64_t length =
+          std::min(slices[index].size - offset, max_chunksize - chunksize);
+      if (length > 0) {
+        struct iovec iov;
+        iov.iov_base = slices[index].data + offset;
+        iov.iov_len = static_cast<size_t>(length);
+        iovecs.push_back(iov);
+        chunksize += length;
+      }
+      offset += length;
+      if (offset == slices[index].size) {
+        ++index;
+        offset = 0;
+      }
+    }
+    if (iovecs.empty()) {
+      // Only empty slices left
+      break;
+    }
+
+    const int64_t ret =
+        transfer(iovecs.data(), static_cast<int>(iovecs.size()), transferred);
+    if (ret == -1) {
+      return IOErrorFromErrno(errno, error_message);
+    }
+    if (ret == 0) {
+      // EOF
+      break;
+    }
+    transferred += ret;
+    for (int64_t remaining = ret; remaining > 0;) {
+      const int64_t available = slices[slice_index].size - slice_offset;
+      if (remaining >= available) {
+        remaining -= available;
+        ++slice_index;
+        slice_offset = 0;
+      } else {
+        slice_offset += remaining;
+        remaining = 0;
+      }
+    }
+  }
+  return transferred;
+}
+
+#endif
+
 Result<int64_t> FileRead(int fd, uint8_t* buffer, int64_t nbytes) {
   int64_t bytes_read = 0;
 
@@ -1296,6 +1375,31 @@ Result<int64_t> FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nb
   return bytes_read;
 }
 
+Result<int64_t> FileReadAtV(int fd, const std::vector<IOSlice>& slices,
+                            int64_t position) {
+#ifdef __linux__
+  return VectoredTransfer(
+      slices,
+      [&](const struct iovec* iov, int iovcnt, int64_t bytes_read) {
+        return static_cast<int64_t>(
+            preadv(fd, iov, iovcnt, static_cast<off_t>(position + bytes_read)));
+      },
+      "Error reading bytes from file");
+#else
+  int64_t bytes_read = 0;
+  for (const auto& slice : slices) {
+    ARROW_ASSIGN_OR_RAISE(int64_t ret,
+                          FileReadAt(fd, slice.data, position + bytes_read, slice.size));
+    bytes_read += ret;
+    if (ret < slice.size) {
+      // EOF
+      break;
+    }
+  }
+  return bytes_read;
+#endif
+}
+
 //
 // Writing data
 //
@@ -1326,6 +1430,33 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWriteV(int fd, const std::vector<IOSlice>& slices) {
+#ifdef _WIN32
+  for (const auto& slice : slices) {
+    RETURN_NOT_OK(FileWrite(fd, slice.data, slice.size));
+  }
+  return Status::OK();
+#else
+  int64_t nbytes = 0;
+  for (const auto& slice : slices) {
+    nbytes += slice.size;
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t bytes_written,
+      VectoredTransfer(
+          slices,
+          [&](const struct iovec* iov, int iovcnt, int64_t) {
+            return static_cast<int64_t>(writev(fd, iov, iovcnt));
+          },
+          "Error writing bytes to file"));
+  if (bytes_written != nbytes) {
+    return Status::IOError("Error writing bytes to file: wrote ", bytes_written,
+                           " bytes out of ", nbytes);
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
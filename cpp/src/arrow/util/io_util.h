@@ -200,8 +200,23 @@ Result<int64_t> FileRead(int fd, uint8_t* buffer, int64_t nbytes);
 ARROW_EXPORT
 Result<int64_t> FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes);
 
+/// A memory region to write from or read into, for vectored I/O
+struct IOSlice {
+  uint8_t* data;
+  int64_t size;
+};
+
+/// Read from given file position into consecutive memory regions, with as few
+/// system calls as possible.  Return number of bytes read.
+ARROW_EXPORT
+Result<int64_t> FileReadAtV(int fd, const std::vector<IOSlice>& slices,
+                            int64_t position);
+
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+/// Write the given memory regions in order, with as few system calls as possible.
+ARROW_EXPORT
+Status FileWriteV(int fd, const std::vector<IOSlice>& slices);
 ARROW_EXPORT
 Status FileTruncate(int fd, const int64_t size);
 
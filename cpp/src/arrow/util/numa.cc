@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+#ifdef __linux__
+constexpr char kNodeDirectory[] = "/sys/devices/system/node";
+
+// Flags of get_mempolicy(2), from <numaif.h>: we don't link to libnuma
+constexpr unsigned long kMpolFNode = 1 << 0;  // NOLINT runtime/int
+constexpr unsigned long kMpolFAddr = 1 << 1;  // NOLINT runtime/int
+
+bool ReadFirstLine(const std::string& path, std::string* out) {
+  std::ifstream file(path);
+  return static_cast<bool>(std::getline(file, *out));
+}
+#endif
+
+std::vector<NumaNode> SingleNode() {
+  NumaNode node{0, {}};
+  const int num_cpus = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int cpu = 0; cpu < num_cpus; ++cpu) {
+    node.cpus.push_back(cpu);
+  }
+  return {std::move(node)};
+}
+
+std::vector<NumaNode> DetectNumaNodes() {
+#ifdef __linux__
+  std::string online;
+  if (!ReadFirstLine(std::string(kNodeDirectory) + "/online", &online)) {
+    return SingleNode();
+  }
+  auto maybe_ids = ParseCpuList(online);
+  if (!maybe_ids.ok()) {
+    ARROW_LOG(WARNING) << "Failed to parse the online NUMA nodes: "
+                       << maybe_ids.status().ToString();
+    return SingleNode();
+  }
+  std::vector<NumaNode> nodes;
+  for (const int id : *maybe_ids) {
+    std::string cpulist;
+    std::stringstream path;
+    path << kNodeDirectory << "/node" << id << "/cpulist";
+    if (!ReadFirstLine(path.str(), &cpulist)) {
+      continue;
+    }
+    auto maybe_cpus = ParseCpuList(cpulist);
+    // Skip memory-only nodes
+    if (maybe_cpus.ok() && !maybe_cpus->empty()) {
+      nodes.push_back({id, *std::move(maybe_cpus)});
+    }
+  }
+  if (nodes.empty()) {
+    return SingleNode();
+  }
+  return nodes;
+#else
+  return SingleNode();
+#endif
+}
+
+}  // namespace
+
+const std::vector<NumaNode>& GetNumaNodes() {
+  static const std::vector<NumaNode> nodes = DetectNumaNodes();
+  return nodes;
+}
+
+Result<std::vector<int>> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  const auto trimmed = TrimString(list);
+  if (trimmed.empty()) {
+    return cpus;
+  }
+  for (const auto& range : SplitString(trimmed, ',')) {
+    const auto dash = std::min(range.find('-'), range.size());
+    uint32_t first, last;
+    if (!ParseUnsigned(range.data(), dash, &first)) {
+      return Status::Invalid("Invalid CPU list: '", list, "'");
+    }
+    if (dash == range.size()) {
+      last = first;
+    } else if (!ParseUnsigned(range.data() + dash + 1, range.size() - dash - 1, &last)) {
+      return Status::Invalid("Invalid CPU list: '", list, "'");
+    }
+    if (last < first) {
+      return Status::Invalid("Invalid CPU range in list: '", list, "'");
+    }
+    for (uint32_t cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+  return cpus;
+}
+
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::Invalid("CPU ", cpu, " out of range");
+    }
+    CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    return IOErrorFromErrno(errno, "Failed to set thread affinity");
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Thread affinity is only supported on Linux");
+#endif
+}
+
+int GetNumaNodeOfAddress(const void* address) {
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, const_cast<void*>(address),
+              kMpolFNode | kMpolFAddr) != 0) {
+    return -1;
+  }
+  return node;
+#else
+  return -1;
+#endif
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Queries of the NUMA topology of the host and thread placement
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// A NUMA node and the CPUs attached to it.
+struct NumaNode {
+  int id;
+  std::vector<int> cpus;
+};
+
+/// Return the NUMA nodes of the host with their CPUs.
+///
+/// On Linux, this information is pulled from /sys/devices/system/node.
+/// Elsewhere, or if it isn't available, a single node 0 with all the CPUs is
+/// returned.  The result is computed once.
+ARROW_EXPORT const std::vector<NumaNode>& GetNumaNodes();
+
+/// Parse a Linux CPU or node list, e.g. "0-3,8,10-11".
+ARROW_EXPORT Result<std::vector<int>> ParseCpuList(const std::string& list);
+
+/// Restrict the calling thread to the given CPUs.
+///
+/// Return NotImplemented on platforms without thread affinity support.
+ARROW_EXPORT Status SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
+/// Return the NUMA node of the memory page holding `address`, or -1 if unknown.
+///
+/// This is a system call: callers should query once per buffer, not per value.
+ARROW_EXPORT int GetNumaNodeOfAddress(const void* address);
+
+}  // namespace internal
+}  // namespace arrow
@@ -17,6 +17,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 #include "arrow/vendored/ProducerConsumerQueue.h"
 
 namespace arrow {
@@ -25,5 +32,112 @@ namespace util {
 template <typename T>
 using SpscQueue = arrow_vendored::folly::ProducerConsumerQueue<T>;
 
-}
+/// \brief A bounded multi-producer multi-consumer queue.
+///
+/// Pushes and pops take no lock: each claims a slot of a ring buffer with a
+/// compare-and-swap, then publishes it through a per-slot sequence number
+/// (after Dmitry Vyukov's bounded MPMC queue).  A push to a full queue or a pop
+/// from an empty queue fails immediately rather than waiting.
+template <typename T>
+class MpmcQueue {
+ public:
+  /// \brief Make a queue holding at least `capacity` elements.
+  ///
+  /// The capacity is rounded up to a power of two.
+  explicit MpmcQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size *= 2;
+    }
+    mask_ = size - 1;
+    cells_.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_.store(0, std::memory_order_relaxed);
+  }
+
+  ~MpmcQueue() {
+    const size_t end = enqueue_pos_.load();
+    for (size_t pos = dequeue_pos_.load(); pos != end; ++pos) {
+      reinterpret_cast<T*>(&cells_[pos & mask_].storage)->~T();
+    }
+  }
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  /// \brief Push a value, returning false if the queue is full.
+  template <typename U>
+  bool TryPush(U&& value) {
+    Cell* cell;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (&cell->storage) T(std::forward<U>(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// \brief Pop a value into `out`, returning false if the queue is empty.
+  bool TryPop(T* out) {
+    Cell* cell;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    T* value = reinterpret_cast<T*>(&cell->storage);
+    *out = std::move(*value);
+    value->~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t capacity() const { return mask_ + 1; }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  static constexpr size_t kCacheLineSize = 64;
+
+  std::unique_ptr<Cell[]> cells_;
+  size_t mask_;
+  // Keep the producers' and the consumers' positions on separate cache lines
+  char pad0_[kCacheLineSize];
+  std::atomic<size_t> enqueue_pos_;
+  char pad1_[kCacheLineSize - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> dequeue_pos_;
+  char pad2_[kCacheLineSize - sizeof(std::atomic<size_t>)];
+};
+
+}  // namespace util
 }  // namespace arrow
@@ -79,7 +79,46 @@ void SpscQueueThroughput(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * kSize);
 }
 
+void MpmcQueueThroughput(benchmark::State& state) {
+  const int num_threads = static_cast<int>(state.range(0));
+  const int64_t items_per_thread = kSize / num_threads;
+  MpmcQueue<std::shared_ptr<Buffer>> queue(16);
+
+  std::vector<std::shared_ptr<Buffer>> source;
+  source.reserve(kSize);
+  const uint8_t data[1] = {0};
+  for (int64_t i = 0; i < kSize; i++) {
+    source.push_back(std::make_shared<Buffer>(data, 1));
+  }
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+      threads.emplace_back([&, t] {
+        for (int64_t i = t * items_per_thread; i < (t + 1) * items_per_thread; i++) {
+          while (!queue.TryPush(source[i])) {
+          }
+        }
+      });
+      threads.emplace_back([&] {
+        std::shared_ptr<Buffer> buf;
+        for (int64_t i = 0; i < items_per_thread; i++) {
+          while (!queue.TryPop(&buf)) {
+          }
+          ARROW_CHECK(buf && buf->size() == 1);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * items_per_thread * num_threads);
+}
+
 BENCHMARK(SpscQueueThroughput)->UseRealTime();
+BENCHMARK(MpmcQueueThroughput)->UseRealTime()->Arg(1)->Arg(2)->Arg(4);
 
 }  // namespace util
 }  // namespace arrow
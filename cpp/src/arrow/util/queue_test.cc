@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
@@ -51,5 +55,60 @@ TEST(TestSpscQueue, TestMoveOnly) {
   ASSERT_EQ(queue.SizeGuess(), 0);
 }
 
+TEST(TestMpmcQueue, TestMoveOnly) {
+  MpmcQueue<MoveOnlyDataType> queue(3);
+  ASSERT_EQ(queue.capacity(), 4u);
+
+  MoveOnlyDataType out(-1);
+  ASSERT_FALSE(queue.TryPop(&out));
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(i)));
+  }
+  ASSERT_FALSE(queue.TryPush(MoveOnlyDataType(4)));
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.TryPop(&out));
+    ASSERT_EQ(i, *out.data);
+  }
+  ASSERT_FALSE(queue.TryPop(&out));
+
+  // Elements left in the queue are destroyed with it
+  ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(5)));
+}
+
+TEST(TestMpmcQueue, TestThreads) {
+  constexpr int kNumThreads = 4;
+  constexpr int kNumItems = 10000;
+  MpmcQueue<int> queue(16);
+  std::atomic<int64_t> sum{0};
+  std::atomic<int> num_popped{0};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int item = 1; item <= kNumItems; ++item) {
+        while (!queue.TryPush(item)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    threads.emplace_back([&] {
+      int item;
+      while (num_popped.load() < kNumThreads * kNumItems) {
+        if (queue.TryPop(&item)) {
+          sum += item;
+          ++num_popped;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(sum.load(), int64_t(kNumThreads) * kNumItems * (kNumItems + 1) / 2);
+}
+
 }  // namespace util
 }  // namespace arrow
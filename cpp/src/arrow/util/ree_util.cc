@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/ree_util.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "arrow/buffer.h"
+
+namespace arrow {
+namespace ree_util {
+
+namespace {
+
+template <typename RunEndCType>
+int64_t FindPhysicalIndexImpl(const ArrayData& data, int64_t i) {
+  const ArrayData& run_ends_data = RunEndsArray(data);
+  return FindPhysicalIndex(run_ends_data.GetValues<RunEndCType>(1), run_ends_data.length,
+                           data.offset + i);
+}
+
+template <typename RunEndCType>
+Result<std::shared_ptr<Buffer>> MakeLogicalRunEndsImpl(const ArrayData& data,
+                                                       int64_t physical_offset,
+                                                       int64_t physical_length,
+                                                       MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(physical_length * sizeof(RunEndCType), pool));
+  const RunEndCType* in = RunEndsArray(data).GetValues<RunEndCType>(1) + physical_offset;
+  auto out = reinterpret_cast<RunEndCType*>(buffer->mutable_data());
+  for (int64_t i = 0; i < physical_length; ++i) {
+    const int64_t run_end = std::min<int64_t>(in[i] - data.offset, data.length);
+    out[i] = static_cast<RunEndCType>(run_end);
+  }
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
+template <typename RunEndCType>
+Result<std::shared_ptr<Buffer>> NarrowRunEnds(const int64_t* run_ends, int64_t num_runs,
+                                              MemoryPool* pool) {
+  if (num_runs > 0 && run_ends[num_runs - 1] > std::numeric_limits<RunEndCType>::max()) {
+    return Status::CapacityError("Run end ", run_ends[num_runs - 1],
+                                 " does not fit in the run end type");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(num_runs * sizeof(RunEndCType), pool));
+  auto out = reinterpret_cast<RunEndCType*>(buffer->mutable_data());
+  for (int64_t i = 0; i < num_runs; ++i) {
+    out[i] = static_cast<RunEndCType>(run_ends[i]);
+  }
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
+}  // namespace
+
+Result<std::shared_ptr<ArrayData>> MakeLogicalRunEnds(const ArrayData& data,
+                                                      MemoryPool* pool) {
+  const auto& run_end_type = RunEndsArray(data).type;
+  const int64_t physical_offset = FindPhysicalOffset(data);
+  const int64_t physical_length = FindPhysicalLength(data);
+  Result<std::shared_ptr<Buffer>> run_ends;
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      run_ends =
+          MakeLogicalRunEndsImpl<int16_t>(data, physical_offset, physical_length, pool);
+      break;
+    case Type::INT32:
+      run_ends =
+          MakeLogicalRunEndsImpl<int32_t>(data, physical_offset, physical_length, pool);
+      break;
+    default:
+      DCHECK_EQ(run_end_type->id(), Type::INT64);
+      run_ends =
+          MakeLogicalRunEndsImpl<int64_t>(data, physical_offset, physical_length, pool);
+      break;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, std::move(run_ends));
+  return ArrayData::Make(run_end_type, physical_length, {nullptr, std::move(buffer)},
+                         /*null_count=*/0);
+}
+
+Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const int64_t* run_ends,
+    int64_t num_runs, MemoryPool* pool) {
+  Result<std::shared_ptr<Buffer>> buffer;
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      buffer = NarrowRunEnds<int16_t>(run_ends, num_runs, pool);
+      break;
+    case Type::INT32:
+      buffer = NarrowRunEnds<int32_t>(run_ends, num_runs, pool);
+      break;
+    default:
+      DCHECK_EQ(run_end_type->id(), Type::INT64);
+      buffer = NarrowRunEnds<int64_t>(run_ends, num_runs, pool);
+      break;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer, std::move(buffer));
+  return ArrayData::Make(run_end_type, num_runs, {nullptr, std::move(run_ends_buffer)},
+                         /*null_count=*/0);
+}
+
+int64_t GetRunEnd(const ArrayData& run_ends, int64_t i) {
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return run_ends.GetValues<int16_t>(1)[i];
+    case Type::INT32:
+      return run_ends.GetValues<int32_t>(1)[i];
+    default:
+      DCHECK_EQ(run_ends.type->id(), Type::INT64);
+      return run_ends.GetValues<int64_t>(1)[i];
+  }
+}
+
+int64_t FindPhysicalIndex(const ArrayData& data, int64_t i) {
+  switch (RunEndsArray(data).type->id()) {
+    case Type::INT16:
+      return FindPhysicalIndexImpl<int16_t>(data, i);
+    case Type::INT32:
+      return FindPhysicalIndexImpl<int32_t>(data, i);
+    default:
+      DCHECK_EQ(RunEndsArray(data).type->id(), Type::INT64);
+      return FindPhysicalIndexImpl<int64_t>(data, i);
+  }
+}
+
+int64_t FindPhysicalOffset(const ArrayData& data) { return FindPhysicalIndex(data, 0); }
+
+int64_t FindPhysicalLength(const ArrayData& data) {
+  if (data.length == 0) {
+    return 0;
+  }
+  // The run containing the last value is the last overlapping the array
+  return FindPhysicalIndex(data, data.length - 1) + 1 - FindPhysicalOffset(data);
+}
+
+MergedRunsIterator::MergedRunsIterator(const ArrayData& left, const ArrayData& right)
+    : left_run_ends_(RunEndsArray(left)),
+      right_run_ends_(RunEndsArray(right)),
+      left_offset_(left.offset),
+      right_offset_(right.offset),
+      length_(left.length),
+      left_index_(FindPhysicalOffset(left)),
+      right_index_(FindPhysicalOffset(right)) {
+  DCHECK_EQ(left.length, right.length);
+  if (!is_end()) {
+    left_run_end_ = GetRunEnd(left_run_ends_, left_index_) - left_offset_;
+    right_run_end_ = GetRunEnd(right_run_ends_, right_index_) - right_offset_;
+    FindRunEnd();
+  }
+}
+
+void MergedRunsIterator::FindRunEnd() {
+  run_end_ = std::min(std::min(left_run_end_, right_run_end_), length_);
+}
+
+void MergedRunsIterator::Next() {
+  position_ = run_end_;
+  if (is_end()) {
+    return;
+  }
+  if (left_run_end_ == position_) {
+    ++left_index_;
+    left_run_end_ = GetRunEnd(left_run_ends_, left_index_) - left_offset_;
+  }
+  if (right_run_end_ == position_) {
+    ++right_index_;
+    right_run_end_ = GetRunEnd(right_run_ends_, right_index_) - right_offset_;
+  }
+  FindRunEnd();
+}
+
+}  // namespace ree_util
+}  // namespace arrow
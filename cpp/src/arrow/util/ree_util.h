@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers to work with the runs of run-end encoded arrays
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "arrow/array/data.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ree_util {
+
+/// \brief The child array holding the run ends of a run-end encoded array
+inline const ArrayData& RunEndsArray(const ArrayData& data) {
+  return *data.child_data[0];
+}
+
+/// \brief The child array holding the run values of a run-end encoded array
+inline const ArrayData& ValuesArray(const ArrayData& data) {
+  return *data.child_data[1];
+}
+
+/// \brief Return the `i`-th run end of a run ends array, whatever its type
+ARROW_EXPORT int64_t GetRunEnd(const ArrayData& run_ends, int64_t i);
+
+/// \brief Find the index of the run containing the logical position `i`
+///
+/// Returns `run_ends_size` if `i` is past the last run end.
+template <typename RunEndCType>
+int64_t FindPhysicalIndex(const RunEndCType* run_ends, int64_t run_ends_size,
+                          int64_t i) {
+  return std::upper_bound(run_ends, run_ends + run_ends_size, i) - run_ends;
+}
+
+/// \brief Find the index of the run containing the `i`-th value of the array
+///
+/// `i` is relative to the array offset.
+ARROW_EXPORT int64_t FindPhysicalIndex(const ArrayData& data, int64_t i);
+
+/// \brief Find the index of the first run overlapping the array
+ARROW_EXPORT int64_t FindPhysicalOffset(const ArrayData& data);
+
+/// \brief Find the number of runs overlapping the array
+ARROW_EXPORT int64_t FindPhysicalLength(const ArrayData& data);
+
+/// \brief Make the run ends of the runs overlapping a run-end encoded array
+///
+/// The run ends are made relative to the array offset and clipped to its
+/// length, so that they can be used with the values sliced to the same runs
+/// (see FindPhysicalOffset() and FindPhysicalLength()).
+ARROW_EXPORT Result<std::shared_ptr<ArrayData>> MakeLogicalRunEnds(
+    const ArrayData& data, MemoryPool* pool = default_memory_pool());
+
+/// \brief Make a run ends array of the given type from int64 run ends
+///
+/// Returns CapacityError if the last run end does not fit in `run_end_type`.
+ARROW_EXPORT Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const int64_t* run_ends,
+    int64_t num_runs, MemoryPool* pool = default_memory_pool());
+
+/// \brief Visit the runs of a run-end encoded array with the given run end type
+///
+/// See VisitRuns().
+template <typename RunEndCType, typename Visitor>
+Status VisitRunsTyped(const ArrayData& data, Visitor&& visit) {
+  const ArrayData& run_ends_data = RunEndsArray(data);
+  const RunEndCType* run_ends = run_ends_data.GetValues<RunEndCType>(1);
+  const int64_t end = data.offset + data.length;
+  int64_t position = data.offset;
+  int64_t physical_index = FindPhysicalIndex(run_ends, run_ends_data.length, position);
+  while (position < end) {
+    const int64_t run_end = std::min<int64_t>(run_ends[physical_index], end);
+    RETURN_NOT_OK(visit(physical_index, run_end - position));
+    position = run_end;
+    ++physical_index;
+  }
+  return Status::OK();
+}
+
+/// \brief Visit the runs of a run-end encoded array
+///
+/// `visit(int64_t physical_index, int64_t run_length)` is called in order for
+/// each run overlapping the array, with the run lengths clipped to the array
+/// offset and length.  `physical_index` indexes the values child array.
+template <typename Visitor>
+Status VisitRuns(const ArrayData& data, Visitor&& visit) {
+  DCHECK_EQ(data.type->id(), Type::RUN_END_ENCODED);
+  switch (RunEndsArray(data).type->id()) {
+    case Type::INT16:
+      return VisitRunsTyped<int16_t>(data, std::forward<Visitor>(visit));
+    case Type::INT32:
+      return VisitRunsTyped<int32_t>(data, std::forward<Visitor>(visit));
+    default:
+      DCHECK_EQ(RunEndsArray(data).type->id(), Type::INT64);
+      return VisitRunsTyped<int64_t>(data, std::forward<Visitor>(visit));
+  }
+}
+
+/// \brief Iterate over the runs of two run-end encoded arrays of equal length
+///
+/// The runs of both arrays are split where either array starts a new run, so
+/// that each merged run maps to a single run of each array.
+class ARROW_EXPORT MergedRunsIterator {
+ public:
+  MergedRunsIterator(const ArrayData& left, const ArrayData& right);
+
+  bool is_end() const { return position_ >= length_; }
+
+  /// \brief Advance to the next merged run
+  void Next();
+
+  /// \brief The length of the current merged run
+  int64_t run_length() const { return run_end_ - position_; }
+
+  /// \brief The index of the current run in the left values array
+  int64_t left_physical_index() const { return left_index_; }
+
+  /// \brief The index of the current run in the right values array
+  int64_t right_physical_index() const { return right_index_; }
+
+ private:
+  void FindRunEnd();
+
+  const ArrayData& left_run_ends_;
+  const ArrayData& right_run_ends_;
+  const int64_t left_offset_;
+  const int64_t right_offset_;
+  const int64_t length_;
+  int64_t position_ = 0;
+  int64_t run_end_ = 0;
+  int64_t left_index_;
+  int64_t right_index_;
+  int64_t left_run_end_ = 0;
+  int64_t right_run_end_ = 0;
+};
+
+}  // namespace ree_util
+}  // namespace arrow
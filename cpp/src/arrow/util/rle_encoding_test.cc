@@ -30,6 +30,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/rle_encoding.h"
 
@@ -173,6 +174,49 @@ TEST(BitArray, TestMixed) {
   }
 }
 
+// Reads back values of up to 64 bits with GetBatch and unpack64
+TEST(BitArray, TestWideValues) {
+  const int num_vals = 32 * 33;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint64_t> dist;
+  for (int width = 0; width <= 64; ++width) {
+    const uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+    std::vector<uint64_t> values(num_vals);
+    for (auto& value : values) value = dist(gen) & mask;
+
+    const int len = static_cast<int>(BitUtil::BytesForBits(width * num_vals));
+    // Never empty, as BitReader requires a buffer
+    std::vector<uint8_t> buffer(len + 1);
+    BitUtil::BitWriter writer(buffer.data(), len);
+    for (uint64_t value : values) {
+      // PutValue takes at most 32 bits
+      if (width <= 32) {
+        ASSERT_TRUE(writer.PutValue(value, width));
+      } else {
+        ASSERT_TRUE(writer.PutValue(value & 0xFFFFFFFF, 32));
+        ASSERT_TRUE(writer.PutValue(value >> 32, width - 32));
+      }
+    }
+    writer.Flush();
+
+    std::vector<uint64_t> unpacked(num_vals);
+    ASSERT_EQ(num_vals, ::arrow::internal::unpack64(buffer.data(), unpacked.data(),
+                                                    num_vals, width));
+    ASSERT_EQ(values, unpacked) << "width = " << width;
+
+    // Batches not aligned on 32 values go through the scalar path too
+    std::vector<uint64_t> read(num_vals);
+    BitUtil::BitReader reader(buffer.data(), len);
+    int num_read = 0;
+    for (int batch_size : {5, 64, 27, num_vals}) {
+      batch_size = std::min(batch_size, num_vals - num_read);
+      ASSERT_EQ(batch_size, reader.GetBatch(width, read.data() + num_read, batch_size));
+      num_read += batch_size;
+    }
+    ASSERT_EQ(values, read) << "width = " << width;
+  }
+}
+
 // Validates encoding of values by encoding and decoding them.  If
 // expected_encoding != NULL, also validates that the encoded buffer is
 // exactly 'expected_encoding'.
@@ -18,17 +18,23 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <list>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "arrow/memory_pool.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/tracing_internal.h"
 
 namespace arrow {
 namespace internal {
@@ -43,6 +49,23 @@ struct Task {
   Executor::StopCallback stop_callback;
 };
 
+#ifdef ARROW_WITH_TRACING
+// A task running in a span of its own, child of the span which spawned it, and
+// recording how long it waited in the queue
+struct TracedTask {
+  void operator()() && {
+    const int64_t start_time = tracing::NowNanos();
+    tracing::Span span("arrow::internal::ThreadPool::RunTask", parent_span_id);
+    span.SetAttribute("queue_time_ns", start_time - spawn_time);
+    std::move(callable)();
+  }
+
+  FnOnce<void()> callable;
+  uint64_t parent_span_id;
+  int64_t spawn_time;
+};
+#endif
+
 }  // namespace
 
 struct SerialExecutor::State {
@@ -103,12 +126,42 @@ void SerialExecutor::RunLoop() {
   }
 }
 
+// A queue of tasks owned by a worker thread.  The owner pushes and pops
+// at the back (LIFO, for cache locality of nested tasks) while idle
+// workers steal from the front.
+struct WorkerQueue {
+  std::mutex mutex;
+  std::deque<Task> tasks;
+  // Approximate size, to skip empty queues without locking them
+  std::atomic<int64_t> size{0};
+  // Whether a worker owns the queue (guarded by ThreadPool::State::mutex_)
+  bool in_use = false;
+};
+
 struct ThreadPool::State {
   State() = default;
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  // Acquire a free worker queue, creating it if necessary
+  WorkerQueue* AcquireQueueUnlocked();
+  // Whether the calling worker should exit because of a lower capacity
+  bool ShouldSecedeUnlocked() const {
+    return workers_.size() > static_cast<size_t>(desired_capacity_.load());
+  }
 
+  void PushGlobal(int32_t priority, Task task);
+  // Pop the next task from the global queue, only if urgent if `urgent_only`
+  bool PopGlobal(bool urgent_only, Task* out);
+  bool PopLocal(WorkerQueue* queue, Task* out);
+  bool Steal(WorkerQueue* thief, Task* out);
+  // Find a task for a worker; `num_local` counts the local tasks run in a row
+  bool PopTask(WorkerQueue* queue, int* num_local, Task* out);
+  // Wake a worker if any is waiting for tasks
+  void NotifyOne();
+  // Drop all queued tasks
+  void ClearTasks();
+
+  // Protects the worker list, the capacity and shutdown changes, and the
+  // waits for tasks.  Queuing and dequeuing tasks doesn't take it.
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -116,19 +169,191 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<Task> pending_tasks_;
 
-  // Desired number of threads
-  int desired_capacity_ = 0;
+  // Tasks spawned from outside the pool's workers, or with a non-default
+  // priority, by priority then in FIFO order
+  std::mutex global_mutex_;
+  std::map<int32_t, std::deque<Task>> global_tasks_;
+  std::atomic<int64_t> num_global_tasks_{0};
+  std::atomic<int64_t> num_urgent_global_tasks_{0};
 
+  // Worker queues are only destroyed with the State so that they can be
+  // stolen from without holding mutex_: they are published as a snapshot
+  // replaced whenever a queue is added.
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  std::shared_ptr<const std::vector<WorkerQueue*>> worker_queues_snapshot_ =
+      std::make_shared<const std::vector<WorkerQueue*>>();
+
+  // Desired number of threads
+  std::atomic<int> desired_capacity_{0};
+  // Number of workers, i.e. workers_.size()
+  std::atomic<int> num_workers_{0};
+  // Number of workers waiting for tasks
+  std::atomic<int> num_waiting_{0};
+
+  // Number of tasks queued, incremented before a task is pushed and
+  // decremented after it is popped
+  std::atomic<int64_t> tasks_queued_{0};
   // Total number of tasks that are either queued or running
-  int tasks_queued_or_running_ = 0;
+  std::atomic<int64_t> tasks_queued_or_running_{0};
 
   // Are we shutting down?
-  bool please_shutdown_ = false;
-  bool quick_shutdown_ = false;
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
+
+  // Called by each worker when it starts
+  std::function<void()> worker_init_;
+};
+
+namespace {
+
+// Number of local tasks a worker runs in a row before looking at the
+// global queue, so that tasks respawning themselves can't starve it
+constexpr int kMaxLocalTasksInARow = 61;
+
+// The worker queue of the current thread, if it is a ThreadPool worker
+struct CurrentWorker {
+  ThreadPool::State* state = nullptr;
+  WorkerQueue* queue = nullptr;
 };
 
+thread_local CurrentWorker current_worker;
+
+}  // namespace
+
+WorkerQueue* ThreadPool::State::AcquireQueueUnlocked() {
+  for (const auto& queue : worker_queues_) {
+    if (!queue->in_use) {
+      queue->in_use = true;
+      return queue.get();
+    }
+  }
+  worker_queues_.emplace_back(new WorkerQueue());
+  WorkerQueue* queue = worker_queues_.back().get();
+  queue->in_use = true;
+  auto snapshot = std::make_shared<std::vector<WorkerQueue*>>();
+  for (const auto& q : worker_queues_) {
+    snapshot->push_back(q.get());
+  }
+  std::atomic_store(&worker_queues_snapshot_,
+                    std::shared_ptr<const std::vector<WorkerQueue*>>(std::move(snapshot)));
+  return queue;
+}
+
+void ThreadPool::State::PushGlobal(int32_t priority, Task task) {
+  std::lock_guard<std::mutex> lock(global_mutex_);
+  global_tasks_[priority].push_back(std::move(task));
+  ++num_global_tasks_;
+  if (priority < 0) {
+    ++num_urgent_global_tasks_;
+  }
+}
+
+bool ThreadPool::State::PopGlobal(bool urgent_only, Task* out) {
+  std::lock_guard<std::mutex> lock(global_mutex_);
+  if (global_tasks_.empty()) {
+    return false;
+  }
+  auto it = global_tasks_.begin();
+  if (urgent_only && it->first >= 0) {
+    return false;
+  }
+  *out = std::move(it->second.front());
+  it->second.pop_front();
+  --num_global_tasks_;
+  if (it->first < 0) {
+    --num_urgent_global_tasks_;
+  }
+  if (it->second.empty()) {
+    global_tasks_.erase(it);
+  }
+  return true;
+}
+
+bool ThreadPool::State::PopLocal(WorkerQueue* queue, Task* out) {
+  if (queue->size.load() == 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->tasks.empty()) {
+    return false;
+  }
+  *out = std::move(queue->tasks.back());
+  queue->tasks.pop_back();
+  --queue->size;
+  return true;
+}
+
+bool ThreadPool::State::Steal(WorkerQueue* thief, Task* out) {
+  const auto queues = std::atomic_load(&worker_queues_snapshot_);
+  const size_t num_queues = queues->size();
+  // Start after the thief's queue so that thieves spread over victims
+  size_t start = 0;
+  while (start < num_queues && (*queues)[start] != thief) {
+    ++start;
+  }
+  for (size_t i = 1; i <= num_queues; ++i) {
+    WorkerQueue* victim = (*queues)[(start + i) % num_queues];
+    if (victim == thief || victim->size.load() == 0) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(victim->mutex);
+    if (!victim->tasks.empty()) {
+      *out = std::move(victim->tasks.front());
+      victim->tasks.pop_front();
+      --victim->size;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::State::PopTask(WorkerQueue* queue, int* num_local, Task* out) {
+  bool found = false;
+  if (num_urgent_global_tasks_.load() > 0 || *num_local >= kMaxLocalTasksInARow) {
+    *num_local = 0;
+    found = num_global_tasks_.load() > 0 && PopGlobal(/*urgent_only=*/false, out);
+  }
+  if (!found && PopLocal(queue, out)) {
+    ++*num_local;
+    found = true;
+  }
+  if (!found) {
+    *num_local = 0;
+    found = (num_global_tasks_.load() > 0 && PopGlobal(/*urgent_only=*/false, out)) ||
+            Steal(queue, out);
+  }
+  if (found) {
+    --tasks_queued_;
+  }
+  return found;
+}
+
+void ThreadPool::State::NotifyOne() {
+  if (num_waiting_.load() > 0) {
+    // Take the lock so that the notification can't be lost between a
+    // worker's last check for tasks and its wait
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_one();
+  }
+}
+
+void ThreadPool::State::ClearTasks() {
+  {
+    std::lock_guard<std::mutex> lock(global_mutex_);
+    global_tasks_.clear();
+    num_global_tasks_ = 0;
+    num_urgent_global_tasks_ = 0;
+  }
+  for (const auto& queue : worker_queues_) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.clear();
+    queue->size = 0;
+  }
+  tasks_queued_ = 0;
+  tasks_queued_or_running_ = 0;
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -139,50 +364,83 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
 
-  // If too many threads, we should secede from the pool
-  const auto should_secede = [&]() -> bool {
-    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
-  };
+  WorkerQueue* queue = state->AcquireQueueUnlocked();
+  current_worker.state = state.get();
+  current_worker.queue = queue;
+  lock.unlock();
+  if (state->worker_init_) {
+    state->worker_init_();
+  }
 
+  int num_local = 0;
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
 
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
-        break;
-      }
-
-      DCHECK_GE(state->tasks_queued_or_running_, 0);
-      {
-        Task task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        StopToken* stop_token = &task.stop_token;
-        lock.unlock();
-        if (!stop_token->IsStopRequested()) {
-          std::move(task.callable)();
-        } else {
-          if (task.stop_callback) {
-            std::move(task.stop_callback)(stop_token->Poll());
-          }
+    // Execute pending tasks if any.  If too many threads, we should secede
+    // from the pool: this is confirmed below under the lock.
+    Task task;
+    if (!state->quick_shutdown_.load() &&
+        state->num_workers_.load() <= state->desired_capacity_.load() &&
+        state->PopTask(queue, &num_local, &task)) {
+      StopToken* stop_token = &task.stop_token;
+      if (!stop_token->IsStopRequested()) {
+        std::move(task.callable)();
+      } else {
+        if (task.stop_callback) {
+          std::move(task.stop_callback)(stop_token->Poll());
         }
-        ARROW_UNUSED(std::move(task));  // release resources before waiting for lock
+      }
+      ARROW_UNUSED(std::move(task));  // release resources before waiting for lock
+      if (--state->tasks_queued_or_running_ == 0 && state->please_shutdown_.load()) {
+        // Wake the workers waiting for the last task to exit
         lock.lock();
+        state->cv_.notify_all();
+        lock.unlock();
       }
-      state->tasks_queued_or_running_--;
+      continue;
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+
+    lock.lock();
+    // Now either no task was found *or* a quick shutdown was requested
+    if (state->quick_shutdown_.load() || state->ShouldSecedeUnlocked()) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    if (state->please_shutdown_.load() && state->tasks_queued_or_running_.load() == 0) {
+      break;
+    }
+    // Announce we're waiting before checking for tasks one last time:
+    // a concurrent SpawnReal() either sees us waiting or has its task seen here.
+    ++state->num_waiting_;
+    if (state->tasks_queued_.load() == 0) {
+      // Wait for next wakeup
+      state->cv_.wait(lock);
+    } else {
+      // A task is being pushed, or a thread has yet to pick its task
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+    }
+    --state->num_waiting_;
+    lock.unlock();
+  }
+  DCHECK_GE(state->tasks_queued_or_running_.load(), 0);
+
+  // Hand the remaining local tasks over to the other workers
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex);
+    while (!queue->tasks.empty()) {
+      state->PushGlobal(/*priority=*/0, std::move(queue->tasks.front()));
+      queue->tasks.pop_front();
+    }
+    queue->size = 0;
+  }
+  queue->in_use = false;
+  current_worker = CurrentWorker{};
+  if (state->num_waiting_.load() > 0) {
+    state->cv_.notify_all();
   }
-  DCHECK_GE(state->tasks_queued_or_running_, 0);
 
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
@@ -194,7 +452,8 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
-  if (state->please_shutdown_) {
+  --state->num_workers_;
+  if (state->please_shutdown_.load()) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
   }
@@ -223,11 +482,12 @@ void ThreadPool::ProtectAgainstFork() {
     // Ideally we would use pthread_at_fork(), but that doesn't allow
     // storing an argument, hence we'd need to maintain a list of all
     // existing ThreadPools.
-    int capacity = state_->desired_capacity_;
+    int capacity = state_->desired_capacity_.load();
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
+    new_state->worker_init_ = state_->worker_init_;
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -254,8 +514,9 @@ Status ThreadPool::SetCapacity(int threads) {
 
   state_->desired_capacity_ = threads;
   // See if we need to increase or decrease the number of running threads
-  const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
-                                threads - static_cast<int>(state_->workers_.size()));
+  const int required =
+      static_cast<int>(std::min<int64_t>(state_->tasks_queued_.load(),
+                                         threads - static_cast<int>(state_->workers_.size())));
   if (required > 0) {
     // Some tasks are pending, spawn the number of needed threads immediately
     LaunchWorkersUnlocked(required);
@@ -272,6 +533,8 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+bool ThreadPool::OwnsThisThread() const { return current_worker.state == state_; }
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -290,9 +553,9 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->tasks_queued_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    state_->ClearTasks();
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -314,27 +577,60 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
     auto it = --(state_->workers_.end());
     *it = std::thread([state, it] { WorkerLoop(state, it); });
   }
+  state_->num_workers_ = static_cast<int>(state_->workers_.size());
 }
 
 Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
                              StopCallback&& stop_callback) {
-  {
-    ProtectAgainstFork();
+  ProtectAgainstFork();
+  // Count the task before checking for shutdown: a concurrent Shutdown()
+  // either makes us fail or waits for the task
+  const int64_t tasks_queued_or_running = ++state_->tasks_queued_or_running_;
+  if (state_->please_shutdown_.load()) {
+    if (--state_->tasks_queued_or_running_ == 0) {
+      // Workers may be waiting for our task to exit
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_.notify_all();
+    }
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  const int num_workers = state_->num_workers_.load();
+  if (num_workers < tasks_queued_or_running &&
+      num_workers < state_->desired_capacity_.load()) {
     std::lock_guard<std::mutex> lock(state_->mutex_);
-    if (state_->please_shutdown_) {
+    if (state_->please_shutdown_.load()) {
+      // Shutdown() may not wait for a worker launched now
+      --state_->tasks_queued_or_running_;
+      state_->cv_.notify_all();
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
-    state_->tasks_queued_or_running_++;
-    if (static_cast<int>(state_->workers_.size()) < state_->tasks_queued_or_running_ &&
+    if (static_cast<int>(state_->workers_.size()) <
+            state_->tasks_queued_or_running_.load() &&
         state_->desired_capacity_ > static_cast<int>(state_->workers_.size())) {
       // We can still spin up more workers so spin up a new worker
       LaunchWorkersUnlocked(/*threads=*/1);
     }
-    state_->pending_tasks_.push_back(
-        {std::move(task), std::move(stop_token), std::move(stop_callback)});
   }
-  state_->cv_.notify_one();
+
+#ifdef ARROW_WITH_TRACING
+  if (tracing::IsEnabled()) {
+    task = TracedTask{std::move(task), tracing::CurrentSpanId(), tracing::NowNanos()};
+  }
+#endif
+
+  ++state_->tasks_queued_;
+  Task queued_task{std::move(task), std::move(stop_token), std::move(stop_callback)};
+  if (current_worker.state == state_ && hints.priority == 0) {
+    // Spawned by one of our workers: keep the task local to it
+    WorkerQueue* queue = current_worker.queue;
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.push_back(std::move(queued_task));
+    ++queue->size;
+  } else {
+    state_->PushGlobal(hints.priority, std::move(queued_task));
+  }
+  state_->NotifyOne();
   return Status::OK();
 }
 
@@ -344,6 +640,14 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads,
+                                                     std::function<void()> worker_init) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->worker_init_ = std::move(worker_init);
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -409,6 +713,115 @@ ThreadPool* GetCpuThreadPool() {
   return singleton.get();
 }
 
+// ----------------------------------------------------------------------
+// NUMA-aware thread pool
+
+namespace {
+
+// The NumaThreadPool partition of the current thread, if it is a worker
+struct CurrentNumaPartition {
+  const NumaThreadPool* pool = nullptr;
+  int index = -1;
+};
+
+thread_local CurrentNumaPartition current_numa_partition;
+
+}  // namespace
+
+Result<std::shared_ptr<NumaThreadPool>> NumaThreadPool::Make(int threads_per_node) {
+  if (threads_per_node < 0) {
+    return Status::Invalid("NumaThreadPool threads per node must be >= 0");
+  }
+  auto pool = std::shared_ptr<NumaThreadPool>(new NumaThreadPool());
+  const auto& nodes = GetNumaNodes();
+  const bool use_arenas = nodes.size() > 1 &&
+                          std::string(default_memory_pool()->backend_name()) == "jemalloc";
+  for (const auto& node : nodes) {
+    const int index = static_cast<int>(pool->partitions_.size());
+    unsigned arena = 0;
+    const bool has_arena = use_arenas && jemalloc_create_arena(&arena).ok();
+    // Pinning is skipped on a single node, where it only restricts the OS scheduler
+    std::vector<int> cpus;
+    if (nodes.size() > 1) {
+      cpus = node.cpus;
+    }
+    const NumaThreadPool* self = pool.get();
+    auto worker_init = [self, index, cpus, has_arena, arena]() {
+      if (!cpus.empty()) {
+        auto st = SetCurrentThreadAffinity(cpus);
+        if (!st.ok()) {
+          ARROW_LOG(WARNING) << "Failed to pin NumaThreadPool worker: " << st.ToString();
+        }
+      }
+      if (has_arena) {
+        ARROW_UNUSED(jemalloc_set_thread_arena(arena));
+      }
+      current_numa_partition.pool = self;
+      current_numa_partition.index = index;
+    };
+    const int threads =
+        threads_per_node > 0 ? threads_per_node : static_cast<int>(node.cpus.size());
+    ARROW_ASSIGN_OR_RAISE(auto node_pool,
+                          ThreadPool::Make(std::max(1, threads), std::move(worker_init)));
+    pool->partitions_.push_back({node.id, std::move(node_pool)});
+  }
+  return pool;
+}
+
+NumaThreadPool::~NumaThreadPool() = default;
+
+int NumaThreadPool::GetCapacity() {
+  int capacity = 0;
+  for (const auto& partition : partitions_) {
+    capacity += partition.pool->GetCapacity();
+  }
+  return capacity;
+}
+
+int NumaThreadPool::GetPartitionOfNode(int node_id) const {
+  for (size_t i = 0; i < partitions_.size(); ++i) {
+    if (partitions_[i].node_id == node_id) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+Status NumaThreadPool::Shutdown(bool wait) {
+  Status st;
+  for (const auto& partition : partitions_) {
+    st &= partition.pool->Shutdown(wait);
+  }
+  return st;
+}
+
+Status NumaThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task,
+                                 StopToken stop_token, StopCallback&& stop_callback) {
+  int index = -1;
+  if (hints.numa_node >= 0) {
+    index = GetPartitionOfNode(hints.numa_node);
+  }
+  if (index < 0 && current_numa_partition.pool == this) {
+    index = current_numa_partition.index;
+  }
+  if (index < 0) {
+    index = static_cast<int>(next_partition_++ % partitions_.size());
+  }
+  return partitions_[index].pool->SpawnReal(hints, std::move(task), std::move(stop_token),
+                                            std::move(stop_callback));
+}
+
+NumaThreadPool* GetNumaCpuThreadPool() {
+  static std::shared_ptr<NumaThreadPool> singleton = [] {
+    auto maybe_pool = NumaThreadPool::Make();
+    if (!maybe_pool.ok()) {
+      maybe_pool.status().Abort("Failed to create global NUMA thread pool");
+    }
+    return *std::move(maybe_pool);
+  }();
+  return singleton.get();
+}
+
 Status RunSynchronouslyVoid(FnOnce<Future<arrow::detail::Empty>(Executor*)> get_future,
                             bool use_threads) {
   return RunSynchronously(std::move(get_future), use_threads).status();
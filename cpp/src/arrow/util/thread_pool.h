@@ -21,11 +21,14 @@
 #include <unistd.h>
 #endif
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -62,9 +65,11 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only honours the priority.
 struct TaskHints {
-  // The lower, the more urgent
+  // The lower, the more urgent.  Tasks with a negative priority are run
+  // before the tasks with the default priority, tasks with a positive
+  // priority after them.
   int32_t priority = 0;
   // The IO transfer size in bytes
   int64_t io_size = -1;
@@ -72,6 +77,9 @@ struct TaskHints {
   int64_t cpu_cost = -1;
   // An application-specific ID
   int64_t external_id = -1;
+  // The NUMA node holding the task's input data, if known.
+  // Used by NumaThreadPool to run the task on that node.
+  int32_t numa_node = -1;
 };
 
 class ARROW_EXPORT Executor {
@@ -241,8 +249,13 @@ class ARROW_EXPORT SerialExecutor : public Executor {
   void MarkFinished();
 };
 
-/// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-/// pool of worker threads.
+/// An Executor implementation spawning tasks on a fixed-size pool of worker threads.
+///
+/// Tasks spawned from outside the pool are run in FIFO order by priority
+/// (see TaskHints).  Tasks with the default priority spawned by a worker
+/// are queued on that worker, which runs them in LIFO order, and idle
+/// workers steal them in FIFO order.  This way nested parallelism
+/// doesn't contend on a single queue.
 ///
 /// Note: Any sort of nested parallelism will deadlock this executor.  Blocking waits are
 /// fine but if one task needs to wait for another task it must be expressed as an
@@ -252,6 +265,11 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but each worker thread calls `worker_init` when it starts,
+  // e.g. to set its CPU affinity.
+  static Result<std::shared_ptr<ThreadPool>> Make(int threads,
+                                                  std::function<void()> worker_init);
+
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
   static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
@@ -273,6 +291,11 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // as soon as possible.
   Status SetCapacity(int threads);
 
+  // Whether the calling thread is one of this pool's workers.  Code running
+  // on a worker shouldn't block waiting for other tasks of the same pool,
+  // as all workers could end up waiting.
+  bool OwnsThisThread() const;
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -290,6 +313,7 @@ class ARROW_EXPORT ThreadPool : public Executor {
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend class NumaThreadPool;
 
   ThreadPool();
 
@@ -318,6 +342,58 @@ class ARROW_EXPORT ThreadPool : public Executor {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+/// An Executor made of one ThreadPool per NUMA node, whose workers are pinned
+/// to the CPUs of their node.
+///
+/// A task runs on the node given by TaskHints::numa_node if any, otherwise on
+/// the node of the worker spawning it, so that chains of tasks stay on the node
+/// whose memory they first touched.  Tasks spawned from other threads are
+/// distributed round-robin.  When the default memory pool is jemalloc, each node
+/// gets its own arena, so that the memory reused by its workers stays local.
+///
+/// Use it as ScanOptions::cpu_executor or ExecContext::executor on multi-socket
+/// hosts.  On a single-node host it behaves like a ThreadPool.
+class ARROW_EXPORT NumaThreadPool : public Executor {
+ public:
+  // Construct a pool with `threads_per_node` workers per NUMA node, or as
+  // many workers as the node has CPUs if 0
+  static Result<std::shared_ptr<NumaThreadPool>> Make(int threads_per_node = 0);
+
+  ~NumaThreadPool() override;
+
+  // The total number of worker threads
+  int GetCapacity() override;
+
+  int num_nodes() const { return static_cast<int>(partitions_.size()); }
+  // The NUMA node id of the i-th partition
+  int node_id(int i) const { return partitions_[i].node_id; }
+  // The ThreadPool of the i-th partition
+  ThreadPool* node_pool(int i) const { return partitions_[i].pool.get(); }
+
+  // Return the partition of the given NUMA node id, or -1 if none
+  int GetPartitionOfNode(int node_id) const;
+
+  // Shutdown the pools of all nodes (see ThreadPool::Shutdown)
+  Status Shutdown(bool wait = true);
+
+ protected:
+  NumaThreadPool() = default;
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
+                   StopCallback&&) override;
+
+  struct Partition {
+    int node_id;
+    std::shared_ptr<ThreadPool> pool;
+  };
+  std::vector<Partition> partitions_;
+  std::atomic<uint32_t> next_partition_{0};
+};
+
+// Return a process-global NumaThreadPool for CPU-bound tasks, created on
+// first use.  This is opt-in: GetCpuThreadPool() is not NUMA-aware.
+ARROW_EXPORT NumaThreadPool* GetNumaCpuThreadPool();
+
 /// \brief Potentially run an async operation serially (if use_threads is false)
 /// \see RunSerially
 ///
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
@@ -35,6 +36,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -464,6 +466,45 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_OK(pool->Shutdown());
 }
 
+TEST_F(TestThreadPool, Priority) {
+  auto pool = this->MakeThreadPool(1);
+  auto gating_task = GatingTask::Make();
+  ASSERT_OK(pool->Spawn(gating_task->Task()));
+  ASSERT_OK(gating_task->WaitForRunning(1));
+
+  std::vector<int32_t> order;
+  for (const int32_t priority : {2, 0, -1, 1, 0, -1}) {
+    TaskHints hints;
+    hints.priority = priority;
+    ASSERT_OK(pool->Spawn(hints, [&order, priority] { order.push_back(priority); }));
+  }
+  ASSERT_OK(gating_task->Unlock());
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(order, std::vector<int32_t>({-1, -1, 0, 0, 1, 2}));
+}
+
+TEST_F(TestThreadPool, StressNestedSpawn) {
+  // Tasks spawned from workers are queued locally and stolen by idle workers
+  auto pool = this->MakeThreadPool(8);
+  constexpr int kFanOut = 4;
+  constexpr int kDepth = 6;
+  std::atomic<int> num_tasks{0};
+  std::function<void(int)> spawn_tree = [&](int depth) {
+    if (depth < kDepth) {
+      for (int i = 0; i < kFanOut; ++i) {
+        ASSERT_OK(pool->Spawn([&, depth] { spawn_tree(depth + 1); }));
+      }
+    }
+    ++num_tasks;
+  };
+  ASSERT_OK(pool->Spawn([&] { spawn_tree(0); }));
+  // (4^7 - 1) / 3 tasks in the tree
+  constexpr int kNumTasks = 5461;
+  BusyWait(10, [&] { return num_tasks.load() == kNumTasks; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(num_tasks.load(), kNumTasks);
+}
+
 // Test Submit() functionality
 
 TEST_F(TestThreadPool, Submit) {
@@ -497,6 +538,17 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(3);
+  auto other_pool = this->MakeThreadPool(1);
+  ASSERT_FALSE(pool->OwnsThisThread());
+
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] { return pool->OwnsThisThread(); }));
+  ASSERT_OK_AND_EQ(true, fut.result());
+  ASSERT_OK_AND_ASSIGN(fut, other_pool->Submit([&] { return pool->OwnsThisThread(); }));
+  ASSERT_OK_AND_EQ(false, fut.result());
+}
+
 TEST_F(TestThreadPool, SubmitWithStopToken) {
   auto pool = this->MakeThreadPool(3);
   {
@@ -647,5 +699,61 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestNumaThreadPool, ParseCpuList) {
+  ASSERT_OK_AND_EQ(std::vector<int>({}), ParseCpuList(""));
+  ASSERT_OK_AND_EQ(std::vector<int>({0}), ParseCpuList("0"));
+  ASSERT_OK_AND_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}),
+                   ParseCpuList("0-3,8,10-11"));
+  ASSERT_RAISES(Invalid, ParseCpuList("3-1"));
+  ASSERT_RAISES(Invalid, ParseCpuList("0,x"));
+  ASSERT_RAISES(Invalid, ParseCpuList("0-"));
+}
+
+TEST(TestNumaThreadPool, Nodes) {
+  const auto& nodes = GetNumaNodes();
+  ASSERT_GE(nodes.size(), 1);
+  for (const auto& node : nodes) {
+    ASSERT_GE(node.id, 0);
+    ASSERT_GT(node.cpus.size(), 0);
+  }
+}
+
+TEST(TestNumaThreadPool, Spawn) {
+  ASSERT_OK_AND_ASSIGN(auto pool, NumaThreadPool::Make(/*threads_per_node=*/2));
+  ASSERT_EQ(pool->num_nodes(), static_cast<int>(GetNumaNodes().size()));
+  ASSERT_EQ(pool->GetCapacity(), 2 * pool->num_nodes());
+  for (int i = 0; i < pool->num_nodes(); ++i) {
+    ASSERT_EQ(pool->GetPartitionOfNode(pool->node_id(i)), i);
+  }
+  ASSERT_EQ(pool->GetPartitionOfNode(-1), -1);
+
+  // Tasks run on the node they are hinted to: its workers are all busy
+  // until the gating tasks are unlocked
+  TaskHints hints;
+  hints.numa_node = pool->node_id(pool->num_nodes() - 1);
+  auto gating_task = GatingTask::Make();
+  ASSERT_OK(pool->Spawn(hints, gating_task->Task()));
+  ASSERT_OK(pool->Spawn(hints, gating_task->Task()));
+  ASSERT_OK(gating_task->WaitForRunning(2));
+  ASSERT_OK(gating_task->Unlock());
+
+  // Tasks spawned by a node's workers stay on that node
+  std::atomic<int> num_finished{0};
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->Spawn(hints, [&] {
+      ASSERT_OK(pool->Spawn([&] { ++num_finished; }));
+      ++num_finished;
+    }));
+  }
+  // Tasks without hints are spread over the nodes
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->Spawn([&] { ++num_finished; }));
+  }
+  BusyWait(10, [&] { return num_finished.load() == 300; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(num_finished.load(), 300);
+}
+
 }  // namespace internal
 }  // namespace arrow
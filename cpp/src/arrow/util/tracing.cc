@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "arrow/util/string.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+namespace tracing {
+
+namespace {
+
+std::atomic<bool> g_enabled{false};
+std::atomic<uint64_t> g_next_span_id{1};
+// The tracer is swapped with std::atomic_load/store
+std::shared_ptr<Tracer> g_tracer;
+
+thread_local uint64_t current_span_id = 0;
+
+uint64_t CurrentThreadId() {
+  return static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+}
+
+}  // namespace
+
+void SetTracer(std::shared_ptr<Tracer> tracer) {
+  const bool enabled = tracer != nullptr;
+  std::atomic_store(&g_tracer, std::move(tracer));
+  g_enabled.store(enabled);
+}
+
+std::shared_ptr<Tracer> GetTracer() { return std::atomic_load(&g_tracer); }
+
+bool IsEnabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t CurrentSpanId() { return current_span_id; }
+
+Span::Span(const char* name, uint64_t parent_span_id) {
+  if (ARROW_PREDICT_TRUE(!IsEnabled())) {
+    return;
+  }
+  tracer_ = GetTracer();
+  if (tracer_ == nullptr) {
+    return;
+  }
+  data_.reset(new SpanData);
+  data_->name = name;
+  data_->span_id = g_next_span_id.fetch_add(1);
+  data_->parent_span_id = parent_span_id;
+  data_->thread_id = CurrentThreadId();
+  data_->start_time_ns = NowNanos();
+  previous_span_id_ = current_span_id;
+  current_span_id = data_->span_id;
+}
+
+void Span::SetAttribute(const char* key, int64_t value) {
+  if (data_) {
+    data_->attributes.emplace_back(key, value);
+  }
+}
+
+void Span::SetAttribute(const char* key, const std::string& value) {
+  if (data_) {
+    data_->attributes.emplace_back(key, value);
+  }
+}
+
+void Span::End() {
+  if (!data_) {
+    return;
+  }
+  data_->end_time_ns = NowNanos();
+  current_span_id = previous_span_id_;
+  tracer_->OnSpanEnd(std::move(*data_));
+  data_.reset();
+  tracer_.reset();
+}
+
+void RecordingTracer::OnSpanEnd(SpanData span) {
+  auto guard = mutex_.Lock();
+  spans_.push_back(std::move(span));
+}
+
+std::vector<SpanData> RecordingTracer::spans() const {
+  auto guard = mutex_.Lock();
+  return spans_;
+}
+
+std::string RecordingTracer::ToChromeTraceJson() const {
+  auto spans = this->spans();
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "{\"traceEvents\":[";
+  for (size_t i = 0; i < spans.size(); ++i) {
+    const auto& span = spans[i];
+    // Complete events, with times in microseconds
+    ss << (i > 0 ? "," : "") << "{\"name\":\"" << Escape(span.name)
+       << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << span.thread_id
+       << ",\"ts\":" << span.start_time_ns / 1000.0
+       << ",\"dur\":" << (span.end_time_ns - span.start_time_ns) / 1000.0
+       << ",\"args\":{\"span_id\":" << span.span_id
+       << ",\"parent_span_id\":" << span.parent_span_id;
+    for (const auto& attribute : span.attributes) {
+      ss << ",\"" << Escape(attribute.first) << "\":";
+      if (const auto value = util::get_if<int64_t>(&attribute.second)) {
+        ss << *value;
+      } else {
+        ss << "\"" << Escape(*util::get_if<std::string>(&attribute.second))
+           << "\"";
+      }
+    }
+    ss << "}}";
+  }
+  ss << "]}";
+  return ss.str();
+}
+
+}  // namespace tracing
+}  // namespace arrow
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/mutex.h"
+#include "arrow/util/variant.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace tracing {
+
+/// \brief A finished span: a named and timed region of work.
+///
+/// The fields map onto those of OpenTelemetry spans, so that a Tracer can
+/// forward spans to an OpenTelemetry exporter.
+struct ARROW_EXPORT SpanData {
+  using AttributeValue = util::Variant<int64_t, std::string>;
+
+  /// The name of the region of work, e.g. "parquet::DecompressPage"
+  std::string name;
+  /// An id unique in the process
+  uint64_t span_id = 0;
+  /// The id of the enclosing span, or 0 for a root span
+  uint64_t parent_span_id = 0;
+  /// Start and end times, in nanoseconds since the Unix epoch
+  int64_t start_time_ns = 0;
+  int64_t end_time_ns = 0;
+  /// An id of the thread which ran the span
+  uint64_t thread_id = 0;
+  std::vector<std::pair<std::string, AttributeValue>> attributes;
+};
+
+/// \brief Receives spans as they end.
+///
+/// Arrow records spans only while a tracer is installed, and only when built
+/// with ARROW_WITH_TRACING.
+class ARROW_EXPORT Tracer {
+ public:
+  virtual ~Tracer() = default;
+
+  /// \brief Called from the thread which ended the span.
+  ///
+  /// Must be thread-safe, and cheap: it runs on the critical path.
+  virtual void OnSpanEnd(SpanData span) = 0;
+};
+
+/// \brief Install the process-wide tracer, or uninstall it with null.
+///
+/// Spans started before the tracer changes are reported to the previous one.
+ARROW_EXPORT void SetTracer(std::shared_ptr<Tracer> tracer);
+
+/// \brief Return the process-wide tracer, or null if none is installed.
+ARROW_EXPORT std::shared_ptr<Tracer> GetTracer();
+
+/// \brief A Tracer keeping spans in memory.
+class ARROW_EXPORT RecordingTracer : public Tracer {
+ public:
+  void OnSpanEnd(SpanData span) override;
+
+  /// The spans ended so far, in order of their end.
+  std::vector<SpanData> spans() const;
+
+  /// \brief The spans ended so far, in the Chrome trace event format.
+  ///
+  /// The result can be loaded in chrome://tracing or Perfetto.
+  std::string ToChromeTraceJson() const;
+
+ private:
+  mutable util::Mutex mutex_;
+  std::vector<SpanData> spans_;
+};
+
+}  // namespace tracing
+}  // namespace arrow
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Instrumentation of Arrow code with tracing spans (see tracing.h)
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace tracing {
+
+/// Whether a tracer is installed.
+ARROW_EXPORT bool IsEnabled();
+
+/// The current time, in nanoseconds since the Unix epoch.
+ARROW_EXPORT int64_t NowNanos();
+
+/// The id of the innermost span active in the calling thread, or 0.
+ARROW_EXPORT uint64_t CurrentSpanId();
+
+/// \brief A span covering the lifetime of this object, or until End().
+///
+/// A span does nothing unless a tracer is installed when it starts.  Spans
+/// started while another is active in the same thread become its children, so
+/// they must end in the reverse order they started.
+class ARROW_EXPORT Span {
+ public:
+  explicit Span(const char* name) : Span(name, CurrentSpanId()) {}
+
+  /// \brief Start a span with an explicit parent, e.g. the span which spawned a
+  /// task.
+  Span(const char* name, uint64_t parent_span_id);
+
+  ~Span() { End(); }
+
+  bool active() const { return data_ != NULLPTR; }
+
+  void SetAttribute(const char* key, int64_t value);
+  void SetAttribute(const char* key, const std::string& value);
+
+  void End();
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Span);
+
+  std::shared_ptr<Tracer> tracer_;
+  std::unique_ptr<SpanData> data_;
+  uint64_t previous_span_id_ = 0;
+};
+
+}  // namespace tracing
+}  // namespace arrow
+
+// Compile spans out unless built with ARROW_WITH_TRACING.  Attribute values
+// aren't evaluated then.
+#ifdef ARROW_WITH_TRACING
+#define ARROW_TRACE_SPAN(var, name) ::arrow::tracing::Span var(name)
+#define ARROW_TRACE_SPAN_ATTRIBUTE(var, key, value) \
+  do {                                              \
+    if (var.active()) {                             \
+      var.SetAttribute(key, value);                 \
+    }                                               \
+  } while (false)
+#else
+#define ARROW_TRACE_SPAN(var, name)
+#define ARROW_TRACE_SPAN_ATTRIBUTE(var, key, value)
+#endif
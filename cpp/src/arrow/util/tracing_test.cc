@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+namespace tracing {
+
+class TestTracing : public ::testing::Test {
+ public:
+  void SetUp() override {
+    tracer_ = std::make_shared<RecordingTracer>();
+    SetTracer(tracer_);
+  }
+
+  void TearDown() override { SetTracer(nullptr); }
+
+ protected:
+  std::shared_ptr<RecordingTracer> tracer_;
+};
+
+TEST_F(TestTracing, Nesting) {
+  ASSERT_TRUE(IsEnabled());
+  ASSERT_EQ(CurrentSpanId(), 0);
+  {
+    Span outer("outer");
+    ASSERT_TRUE(outer.active());
+    const auto outer_id = CurrentSpanId();
+    ASSERT_NE(outer_id, 0);
+    {
+      Span inner("inner");
+      ASSERT_NE(CurrentSpanId(), outer_id);
+    }
+    ASSERT_EQ(CurrentSpanId(), outer_id);
+  }
+  ASSERT_EQ(CurrentSpanId(), 0);
+
+  auto spans = tracer_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  ASSERT_EQ(spans[0].name, "inner");
+  ASSERT_EQ(spans[1].name, "outer");
+  ASSERT_EQ(spans[0].parent_span_id, spans[1].span_id);
+  ASSERT_EQ(spans[1].parent_span_id, 0);
+  ASSERT_LE(spans[1].start_time_ns, spans[0].start_time_ns);
+  ASSERT_LE(spans[0].end_time_ns, spans[1].end_time_ns);
+}
+
+TEST_F(TestTracing, Attributes) {
+  {
+    Span span("span");
+    span.SetAttribute("bytes", 42);
+    span.SetAttribute("function", "sum");
+    span.End();
+    ASSERT_FALSE(span.active());
+    // Ignored once ended
+    span.SetAttribute("rows", 1);
+  }
+
+  auto spans = tracer_->spans();
+  ASSERT_EQ(spans.size(), 1);
+  const auto& attributes = spans[0].attributes;
+  ASSERT_EQ(attributes.size(), 2);
+  ASSERT_EQ(attributes[0].first, "bytes");
+  ASSERT_EQ(attributes[0].second, SpanData::AttributeValue(int64_t(42)));
+  ASSERT_EQ(attributes[1].first, "function");
+  ASSERT_EQ(attributes[1].second, SpanData::AttributeValue(std::string("sum")));
+}
+
+TEST_F(TestTracing, NoTracer) {
+  SetTracer(nullptr);
+  ASSERT_FALSE(IsEnabled());
+  {
+    Span span("span");
+    ASSERT_FALSE(span.active());
+    ASSERT_EQ(CurrentSpanId(), 0);
+  }
+  ASSERT_EQ(tracer_->spans().size(), 0);
+}
+
+TEST_F(TestTracing, ChromeTraceJson) {
+  { Span span("a\"b"); }
+  {
+    Span span("c");
+    span.SetAttribute("rows", 3);
+    span.SetAttribute("name", "x");
+  }
+  auto json = tracer_->ToChromeTraceJson();
+  ASSERT_EQ(json.find("{\"traceEvents\":[{\"name\":\"a\\\"b\",\"ph\":\"X\""), 0)
+      << json;
+  ASSERT_NE(json.find("\"rows\":3,\"name\":\"x\"}}]}"), std::string::npos) << json;
+}
+
+#ifdef ARROW_WITH_TRACING
+TEST_F(TestTracing, ThreadPoolTasks) {
+  ASSERT_OK_AND_ASSIGN(auto pool, internal::ThreadPool::Make(1));
+  uint64_t parent_id;
+  {
+    Span parent("parent");
+    parent_id = CurrentSpanId();
+    ASSERT_OK(pool->Spawn([] { Span child("child"); }));
+    ASSERT_OK(pool->Shutdown());
+  }
+
+  auto spans = tracer_->spans();
+  ASSERT_EQ(spans.size(), 3);
+  ASSERT_EQ(spans[0].name, "child");
+  ASSERT_EQ(spans[1].name, "arrow::internal::ThreadPool::RunTask");
+  ASSERT_EQ(spans[2].name, "parent");
+  ASSERT_EQ(spans[1].parent_span_id, parent_id);
+  ASSERT_EQ(spans[0].parent_span_id, spans[1].span_id);
+  ASSERT_EQ(spans[1].attributes.size(), 1);
+  ASSERT_EQ(spans[1].attributes[0].first, "queue_time_ns");
+}
+#endif
+
+}  // namespace tracing
+}  // namespace arrow
@@ -297,6 +297,24 @@ static inline bool Utf8IsContinuation(const uint8_t codeunit) {
   return (codeunit & 0xC0) == 0x80;  // upper two bits should be 10
 }
 
+// Count the codepoints of UTF8 data, assuming it is valid: these are the bytes
+// which are not continuation bytes.
+static inline int64_t UTF8Length(const uint8_t* first, const uint8_t* last) {
+  int64_t length = last - first;
+  // Eight bytes at a time: the high bit of a byte is set in `continuations` if
+  // the byte's upper two bits are 10, and the horizontal sum of the high bits,
+  // shifted down, is the product's top byte
+  for (; last - first >= 8; first += 8) {
+    const auto word = util::SafeLoadAs<uint64_t>(first);
+    const uint64_t continuations = word & ~(word << 1) & 0x8080808080808080ULL;
+    length -= static_cast<int64_t>(((continuations >> 7) * 0x0101010101010101ULL) >> 56);
+  }
+  for (; first < last; ++first) {
+    length -= Utf8IsContinuation(*first);
+  }
+  return length;
+}
+
 static inline bool Utf8Is2ByteStart(const uint8_t codeunit) {
   return (codeunit & 0xE0) == 0xC0;  // upper three bits should be 110
 }
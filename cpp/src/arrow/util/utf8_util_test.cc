@@ -431,6 +431,29 @@ TEST(UTF8DecodeReverse, Basics) {
   CheckInvalid("\xF0\x80\x80");
 }
 
+TEST(UTF8Length, Basics) {
+  auto length = [](const std::string& s) {
+    const auto data = reinterpret_cast<const uint8_t*>(s.data());
+    return UTF8Length(data, data + s.size());
+  };
+
+  ASSERT_EQ(0, length(""));
+  ASSERT_EQ(1, length("a"));
+  ASSERT_EQ(1, length("\xc3\xa9"));
+  ASSERT_EQ(6, length("\xc9\x91\xc9\xbd\xe2\xb1\xa4oW\xf0\x9f\x98\x80"));
+
+  // Around and across the boundaries of eight byte words
+  std::string s;
+  int64_t expected = 0;
+  for (int i = 0; i < 40; ++i) {
+    s += (i % 3 == 0) ? "\xe2\x82\xac" : (i % 3 == 1) ? "b" : "\xc3\xa9";
+    ++expected;
+    ASSERT_EQ(expected, length(s));
+    // Without its lead byte, the first codepoint is not counted
+    ASSERT_EQ(expected - 1, length(s.substr(1)));
+  }
+}
+
 TEST(UTF8FindIf, Basics) {
   auto CheckOk = [](const std::string& s, unsigned char test, int64_t offset_left,
                     int64_t offset_right) -> void {
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/vendored/fast_float/fast_float.h"
 
@@ -40,12 +41,168 @@ bool StringToFloat(const char* s, size_t length, double* out) {
 
 namespace {
 
+// A strptime format made only of zero-padded numeric fields and literal
+// characters (for example "%Y-%m-%d %H:%M:%S" or "%d/%m/%Y"), compiled once
+// so that values laid out exactly like the format are parsed without a copy
+// and a call to strptime().
+//
+// Parse() only accepts a subset of what strptime() accepts (no unpadded
+// fields, no extra whitespace...) and yields the same result for it, so
+// callers fall back on strptime() when it fails.
+enum FixedLayoutField : uint8_t {
+  kYear,
+  kMonth,
+  kDay,
+  kHour,
+  kMinute,
+  kSecond,
+  kLiteral
+};
+
+constexpr int kNumFixedLayoutFields = kLiteral;
+// Leap seconds are left to strptime()
+constexpr uint32_t kMinFieldValues[kNumFixedLayoutFields] = {0, 1, 1, 0, 0, 0};
+constexpr uint32_t kMaxFieldValues[kNumFixedLayoutFields] = {9999, 12, 31, 23, 59, 59};
+
+class FixedLayoutFormat {
+ public:
+  static bool Compile(const std::string& format, FixedLayoutFormat* out) {
+    FixedLayoutFormat layout;
+    for (size_t i = 0; i < format.size(); ++i) {
+      if (format[i] != '%') {
+        layout.AddLiteral(format[i]);
+        continue;
+      }
+      if (++i == format.size()) {
+        return false;
+      }
+      switch (format[i]) {
+        case '%':
+          layout.AddLiteral('%');
+          break;
+        case 'Y':
+          layout.AddField(kYear, 4);
+          break;
+        case 'm':
+          layout.AddField(kMonth, 2);
+          break;
+        case 'd':
+          layout.AddField(kDay, 2);
+          break;
+        case 'H':
+          layout.AddField(kHour, 2);
+          break;
+        case 'M':
+          layout.AddField(kMinute, 2);
+          break;
+        case 'S':
+          layout.AddField(kSecond, 2);
+          break;
+        default:
+          // Other directives are locale-dependent or variable-width
+          return false;
+      }
+    }
+    if (format == "%Y-%m-%d") {
+      layout.kind_ = kISODate;
+    } else if (format == "%Y-%m-%d %H:%M:%S" || format == "%Y-%m-%dT%H:%M:%S") {
+      layout.kind_ = kISODateTime;
+    }
+    *out = std::move(layout);
+    return true;
+  }
+
+  bool Parse(const char* s, size_t length, TimeUnit::type unit, int64_t* out) const {
+    using seconds_type = std::chrono::duration<int64_t>;
+
+    if (length != items_.size()) {
+      return false;
+    }
+    // Common ISO8601-like layouts are validated a word at a time
+    if (kind_ != kGeneric) {
+      seconds_type since_epoch, since_midnight(0);
+      if (!detail::ParseYYYY_MM_DD(s, &since_epoch)) {
+        return false;
+      }
+      if (kind_ == kISODateTime) {
+        if (s[10] != items_[10].literal ||
+            !detail::ParseHH_MM_SS(s + 11, &since_midnight)) {
+          return false;
+        }
+      }
+      *out = util::CastSecondsToUnit(unit, (since_epoch + since_midnight).count());
+      return true;
+    }
+
+    // Same defaults as a zeroed struct tm
+    uint32_t values[kNumFixedLayoutFields] = {1900, 1, 0, 0, 0, 0};
+    for (size_t i = 0; i < length;) {
+      const Item& item = items_[i];
+      if (item.field == kLiteral) {
+        if (s[i] != item.literal) {
+          return false;
+        }
+        ++i;
+        continue;
+      }
+      uint32_t value = 0;
+      for (uint8_t j = 0; j < item.width; ++j) {
+        const uint8_t digit = static_cast<uint8_t>(s[i + j] - '0');
+        if (ARROW_PREDICT_FALSE(digit > 9)) {
+          return false;
+        }
+        value = value * 10 + digit;
+      }
+      if (ARROW_PREDICT_FALSE(value < kMinFieldValues[item.field] ||
+                              value > kMaxFieldValues[item.field])) {
+        return false;
+      }
+      values[item.field] = value;
+      i += item.width;
+    }
+
+    arrow_vendored::date::sys_seconds secs =
+        arrow_vendored::date::sys_days(
+            arrow_vendored::date::year(static_cast<int>(values[kYear])) /
+            static_cast<int>(values[kMonth]) / static_cast<int>(values[kDay])) +
+        std::chrono::hours(values[kHour]) + std::chrono::minutes(values[kMinute]) +
+        std::chrono::seconds(values[kSecond]);
+    *out = util::CastSecondsToUnit(unit, secs.time_since_epoch().count());
+    return true;
+  }
+
+ private:
+  enum Kind : uint8_t { kGeneric, kISODate, kISODateTime };
+
+  // One item per input character, fields are described by their first character
+  struct Item {
+    FixedLayoutField field;
+    uint8_t width;
+    char literal;
+  };
+
+  void AddLiteral(char c) { items_.push_back({kLiteral, 1, c}); }
+
+  void AddField(FixedLayoutField field, uint8_t width) {
+    items_.push_back({field, width, 0});
+    items_.resize(items_.size() + width - 1, {kLiteral, 0, 0});
+  }
+
+  std::vector<Item> items_;
+  Kind kind_ = kGeneric;
+};
+
 class StrptimeTimestampParser : public TimestampParser {
  public:
-  explicit StrptimeTimestampParser(std::string format) : format_(std::move(format)) {}
+  explicit StrptimeTimestampParser(std::string format)
+      : format_(std::move(format)),
+        has_fixed_layout_(FixedLayoutFormat::Compile(format_, &fixed_layout_)) {}
 
   bool operator()(const char* s, size_t length, TimeUnit::type out_unit,
                   int64_t* out) const override {
+    if (has_fixed_layout_ && fixed_layout_.Parse(s, length, out_unit, out)) {
+      return true;
+    }
     return ParseTimestampStrptime(s, length, format_.c_str(),
                                   /*ignore_time_in_day=*/false,
                                   /*allow_trailing_chars=*/false, out_unit, out);
@@ -57,6 +214,8 @@ class StrptimeTimestampParser : public TimestampParser {
 
  private:
   std::string format_;
+  FixedLayoutFormat fixed_layout_;
+  bool has_fixed_layout_;
 };
 
 class ISO8601Parser : public TimestampParser {
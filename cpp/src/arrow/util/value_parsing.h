@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
@@ -30,9 +31,12 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 #include "arrow/vendored/strptime.h"
@@ -155,6 +159,56 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+namespace detail {
+
+// SWAR ("SIMD within a register") helpers, processing eight characters at once
+// as a little-endian word, with the first character in the lowest byte
+
+static inline uint64_t LoadEightChars(const char* s) {
+  return BitUtil::FromLittleEndian(
+      util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s)));
+}
+
+// Whether the bytes of `chars` selected by `mask` (with 0xFF) are all digits
+static inline bool AreDigits(uint64_t chars, uint64_t mask = ~uint64_t(0)) {
+  // Digits become 0-9, the only values below 0x80 whose sum with 0x76 is too
+  const uint64_t values = (chars ^ 0x3030303030303030ULL) & mask;
+  return ((values | (values + 0x7676767676767676ULL)) & 0x8080808080808080ULL) == 0;
+}
+
+// The value of eight digits, by combining them into pairs, then quadruplets
+static inline uint32_t ParseEightDigits(uint64_t chars) {
+  uint64_t values = chars & 0x0F0F0F0F0F0F0F0FULL;
+  values = (values * (10 * 256 + 1)) >> 8;
+  values = ((values & 0x00FF00FF00FF00FFULL) * (100 * 65536 + 1)) >> 16;
+  return static_cast<uint32_t>(
+      ((values & 0x0000FFFF0000FFFFULL) * (10000 * (uint64_t(1) << 32) + 1)) >> 32);
+}
+
+// Parse at least eight digits, few enough that they cannot overflow `T`
+template <typename T>
+static inline bool ParseUnsignedEightAtATime(const char* s, size_t length, T* out) {
+  uint64_t result = 0;
+  for (; length >= 8; s += 8, length -= 8) {
+    const uint64_t chars = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!AreDigits(chars))) {
+      return false;
+    }
+    result = result * 100000000U + ParseEightDigits(chars);
+  }
+  for (; length > 0; ++s, --length) {
+    const uint8_t digit = ParseDecimalDigit(*s);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = static_cast<T>(result);
+  return true;
+}
+
+}  // namespace detail
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -219,6 +273,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length == 8 || length == 9) {
+    return detail::ParseUnsignedEightAtATime(s, length, out);
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -239,6 +296,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    return detail::ParseUnsignedEightAtATime(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -388,23 +448,26 @@ namespace detail {
 
 using ts_type = TimestampType::c_type;
 
+// The digit at index `i` of characters validated by AreDigits()
+static inline uint32_t DigitAt(uint64_t chars, int i) {
+  return static_cast<uint32_t>((chars >> (8 * i)) & 0x0F);
+}
+
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  // Validate "YYYY-MM-" at once, the caller ensures at least 10 characters
+  const uint64_t chars = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((chars & 0xFF0000FF00000000ULL) != 0x2D00002D00000000ULL) ||
+      ARROW_PREDICT_FALSE(!AreDigits(chars, 0x00FFFF00FFFFFFFFULL))) {
     return false;
   }
+  uint8_t day = 0;
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
+  const auto year = static_cast<int>(DigitAt(chars, 0) * 1000 + DigitAt(chars, 1) * 100 +
+                                     DigitAt(chars, 2) * 10 + DigitAt(chars, 3));
+  const auto month = DigitAt(chars, 5) * 10 + DigitAt(chars, 6);
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -454,21 +517,15 @@ static inline bool ParseHH_MM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  // Validate "hh:mm:ss" at once
+  const uint64_t chars = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((chars & 0x0000FF0000FF0000ULL) != 0x00003A00003A0000ULL) ||
+      ARROW_PREDICT_FALSE(!AreDigits(chars, 0xFFFF00FFFF00FFFFULL))) {
     return false;
   }
+  const uint32_t hours = DigitAt(chars, 0) * 10 + DigitAt(chars, 1);
+  const uint32_t minutes = DigitAt(chars, 3) * 10 + DigitAt(chars, 4);
+  const uint32_t seconds = DigitAt(chars, 6) * 10 + DigitAt(chars, 7);
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -776,5 +833,49 @@ enable_if_parameter_free<T, bool> ParseValue(
   return StringConverter<T>::Convert(type, s, length, out);
 }
 
+/// \brief Parse the `length` strings of a binary-like array in a single pass.
+///
+/// `offsets` points to the offset of the first string and `valid_bits`, if not
+/// null, to the validity bitmap, starting at bit `valid_bits_offset`.  The slots
+/// of `out` for null strings are zeroed.
+///
+/// \return the index of the first non-null string which fails to parse, or
+/// `length` if they all parse
+template <typename T, typename offset_type>
+int64_t ParseValues(const T& type, const offset_type* offsets, const uint8_t* data,
+                    const uint8_t* valid_bits, int64_t valid_bits_offset, int64_t length,
+                    typename StringConverter<T>::value_type* out) {
+  using value_type = typename StringConverter<T>::value_type;
+  const char* chars = reinterpret_cast<const char*>(data);
+  auto parse_run = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      const auto value_length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+      if (ARROW_PREDICT_FALSE(!StringConverter<T>::Convert(type, chars + offsets[i],
+                                                           value_length, out + i))) {
+        return i;
+      }
+    }
+    return end;
+  };
+  if (valid_bits == NULLPTR) {
+    return parse_run(0, length);
+  }
+  SetBitRunReader reader(valid_bits, valid_bits_offset, length);
+  int64_t position = 0;
+  while (true) {
+    const auto run = reader.NextRun();
+    std::fill(out + position, out + (run.length == 0 ? length : run.position),
+              value_type{});
+    if (run.length == 0) {
+      return length;
+    }
+    position = run.position + run.length;
+    const int64_t parsed_until = parse_run(run.position, position);
+    if (ARROW_PREDICT_FALSE(parsed_until != position)) {
+      return parsed_until;
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -20,6 +20,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/util/value_parsing.h"
@@ -196,12 +197,19 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion<UInt32Type>("432198765", 432198765UL);
   AssertConversion<UInt32Type>("4294967295", 4294967295UL);
   AssertConversion<UInt32Type>("04294967295", 4294967295UL);
+  AssertConversion<UInt32Type>("12345678", 12345678UL);
+  AssertConversion<UInt32Type>("999999999", 999999999UL);
 
   // Non-representable values
   AssertConversionFails<UInt32Type>("-1");
   AssertConversionFails<UInt32Type>("4294967296");
   AssertConversionFails<UInt32Type>("12345678901");
 
+  // Non-digits among eight or nine digits
+  AssertConversionFails<UInt32Type>("1234567/");
+  AssertConversionFails<UInt32Type>(":12345678");
+  AssertConversionFails<UInt32Type>("1234 5678");
+
   AssertConversionFails<UInt32Type>("");
   AssertConversionFails<UInt32Type>("-");
   AssertConversionFails<UInt32Type>("0.0");
@@ -214,11 +222,18 @@ TEST(StringConversion, ToInt64) {
   AssertConversion<Int64Type>("09223372036854775807", 9223372036854775807LL);
   AssertConversion<Int64Type>("-9223372036854775808", -9223372036854775807LL - 1);
   AssertConversion<Int64Type>("-009223372036854775808", -9223372036854775807LL - 1);
+  AssertConversion<Int64Type>("12345678", 12345678LL);
+  AssertConversion<Int64Type>("-123456789012345678", -123456789012345678LL);
 
   // Non-representable values
   AssertConversionFails<Int64Type>("9223372036854775808");
   AssertConversionFails<Int64Type>("-9223372036854775809");
 
+  // Non-digits among eight digits or more
+  AssertConversionFails<Int64Type>("1234567x9012");
+  AssertConversionFails<Int64Type>("12345678901234567x");
+  AssertConversionFails<Int64Type>("-12345678-");
+
   AssertConversionFails<Int64Type>("");
   AssertConversionFails<Int64Type>("-");
   AssertConversionFails<Int64Type>("0.0");
@@ -228,10 +243,16 @@ TEST(StringConversion, ToInt64) {
 TEST(StringConversion, ToUInt64) {
   AssertConversion<UInt64Type>("0", 0);
   AssertConversion<UInt64Type>("18446744073709551615", 18446744073709551615ULL);
+  AssertConversion<UInt64Type>("9999999999999999999", 9999999999999999999ULL);
+  AssertConversion<UInt64Type>("1234567890123456", 1234567890123456ULL);
 
   // Non-representable values
   AssertConversionFails<UInt64Type>("-1");
   AssertConversionFails<UInt64Type>("18446744073709551616");
+  AssertConversionFails<UInt64Type>("99999999999999999999");
+
+  AssertConversionFails<UInt64Type>("123456789012345678:");
+  AssertConversionFails<UInt64Type>("12345678\xb0");
 
   AssertConversionFails<UInt64Type>("");
   AssertConversionFails<UInt64Type>("-");
@@ -343,6 +364,13 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
     AssertConversionFails(type, "1970-01-01 00:60");
     AssertConversionFails(type, "1970-01-01 00,00");
     AssertConversionFails(type, "1970-01-01 24:00:00");
+    // Non-digits and misplaced separators
+    AssertConversionFails(type, "1970-0a-01 00:00:00");
+    AssertConversionFails(type, "197\xb0-01-01 00:00:00");
+    AssertConversionFails(type, "1970/01/01 00:00:00");
+    AssertConversionFails(type, "1970-01-0/ 00:00:00");
+    AssertConversionFails(type, "1970-01-01 00:0a:00");
+    AssertConversionFails(type, "1970-01-01 00-00-00");
     AssertConversionFails(type, "1970-01-01 00:60:00");
     AssertConversionFails(type, "1970-01-01 00:00:60");
     AssertConversionFails(type, "1970-01-01 00:00,00");
@@ -423,6 +451,43 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
   }
 }
 
+TEST(ParseValues, Basics) {
+  auto strings = ArrayFromJSON(utf8(), R"(["1", null, "-23", "", "45678901234", null])");
+  const auto& string_array = checked_cast<const StringArray&>(*strings);
+
+  auto parse = [&](const StringArray& array, std::vector<int64_t>* out) {
+    out->assign(static_cast<size_t>(array.length()), -1);
+    return ParseValues(Int64Type(), array.raw_value_offsets(), array.raw_data(),
+                       array.null_bitmap_data(), array.offset(), array.length(),
+                       out->data());
+  };
+  std::vector<int64_t> out;
+  // The empty string fails to parse
+  ASSERT_EQ(parse(string_array, &out), 3);
+  ASSERT_EQ(out[0], 1);
+  ASSERT_EQ(out[1], 0);
+  ASSERT_EQ(out[2], -23);
+
+  // Sliced past the empty string, with nulls zeroed
+  auto sliced = checked_pointer_cast<StringArray>(strings->Slice(4));
+  ASSERT_EQ(parse(*sliced, &out), 2);
+  ASSERT_EQ(out, std::vector<int64_t>({45678901234LL, 0}));
+
+  // Without validity bitmap
+  auto no_nulls = ArrayFromJSON(utf8(), R"(["7", "0012345678", "x", "8"])");
+  ASSERT_EQ(parse(checked_cast<const StringArray&>(*no_nulls), &out), 2);
+  ASSERT_EQ(out[1], 12345678);
+
+  auto timestamps = checked_pointer_cast<StringArray>(
+      ArrayFromJSON(utf8(), R"(["1970-01-01", null, "2018-11-13T17:11:10"])"));
+  std::vector<int64_t> timestamp_out(3, -1);
+  ASSERT_EQ(ParseValues(TimestampType(TimeUnit::SECOND), timestamps->raw_value_offsets(),
+                        timestamps->raw_data(), timestamps->null_bitmap_data(),
+                        timestamps->offset(), timestamps->length(), timestamp_out.data()),
+            3);
+  ASSERT_EQ(timestamp_out, std::vector<int64_t>({0, 0, 1542129070}));
+}
+
 TEST(TimestampParser, StrptimeParser) {
   std::string format = "%m/%d/%Y %H:%M:%S";
   auto parser = TimestampParser::MakeStrptime(format);
@@ -456,5 +521,50 @@ TEST(TimestampParser, StrptimeParser) {
   }
 }
 
+TEST(TimestampParser, StrptimeParserFixedLayout) {
+  // Formats made of zero-padded numeric fields take a fast path,
+  // which must agree with strptime()
+  struct Case {
+    std::string format;
+    std::vector<std::string> values;
+  };
+
+  std::vector<Case> cases = {
+      {"%Y-%m-%d",
+       {"2000-05-31", "1970-01-01", "2000-02-30", "2000-5-31", "2000-05-31 ",
+        "0000-01-01", "2000-13-01", "2000-00-01", "2000/05/31", "20000-05-31", ""}},
+      {"%Y-%m-%d %H:%M:%S",
+       {"2000-05-31 12:34:56", "2000-05-31 23:59:59", "2000-05-31 24:00:00",
+        "2000-05-31 12:34:60", "2000-05-31T12:34:56", "2000-05-31 12:34", "2000-05-31"}},
+      {"%Y-%m-%dT%H:%M:%S", {"2000-05-31T12:34:56", "2000-05-31 12:34:56"}},
+      {"%d/%m/%Y %H:%M",
+       {"31/05/2000 12:34", "31/5/2000 12:34", "31/05/2000 12:60", "32/05/2000 12:34",
+        "31/05/2000  12:34", "31/05/2000 1a:34"}},
+      {"%H:%M:%S", {"12:34:56", "00:00:00"}},
+      {"%Y%m%d%%", {"20000531%", "20000531"}},
+  };
+
+  std::vector<TimeUnit::type> units = {TimeUnit::SECOND, TimeUnit::NANO};
+
+  for (const auto& case_ : cases) {
+    auto parser = TimestampParser::MakeStrptime(case_.format);
+    for (const auto& value : case_.values) {
+      for (auto unit : units) {
+        SCOPED_TRACE("format = '" + case_.format + "', value = '" + value + "'");
+        int64_t converted = -1, expected = -1;
+        bool expected_ok = ParseTimestampStrptime(value.data(), value.size(),
+                                                  case_.format.c_str(),
+                                                  /*ignore_time_in_day=*/false,
+                                                  /*allow_trailing_chars=*/false, unit,
+                                                  &expected);
+        ASSERT_EQ(expected_ok, (*parser)(value.data(), value.size(), unit, &converted));
+        if (expected_ok) {
+          ASSERT_EQ(expected, converted);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
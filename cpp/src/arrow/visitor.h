@@ -44,6 +44,7 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const BinaryArray& array);
   virtual Status Visit(const LargeStringArray& array);
   virtual Status Visit(const LargeBinaryArray& array);
+  virtual Status Visit(const StringViewArray& array);
   virtual Status Visit(const FixedSizeBinaryArray& array);
   virtual Status Visit(const Date32Array& array);
   virtual Status Visit(const Date64Array& array);
@@ -63,6 +64,7 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const SparseUnionArray& array);
   virtual Status Visit(const DenseUnionArray& array);
   virtual Status Visit(const DictionaryArray& array);
+  virtual Status Visit(const RunEndEncodedArray& array);
   virtual Status Visit(const ExtensionArray& array);
 };
 
@@ -87,6 +89,7 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const BinaryType& type);
   virtual Status Visit(const LargeStringType& type);
   virtual Status Visit(const LargeBinaryType& type);
+  virtual Status Visit(const StringViewType& type);
   virtual Status Visit(const FixedSizeBinaryType& type);
   virtual Status Visit(const Date64Type& type);
   virtual Status Visit(const Date32Type& type);
@@ -106,6 +109,7 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const SparseUnionType& type);
   virtual Status Visit(const DenseUnionType& type);
   virtual Status Visit(const DictionaryType& type);
+  virtual Status Visit(const RunEndEncodedType& type);
   virtual Status Visit(const ExtensionType& type);
 };
 
@@ -130,6 +134,7 @@ class ARROW_EXPORT ScalarVisitor {
   virtual Status Visit(const BinaryScalar& scalar);
   virtual Status Visit(const LargeStringScalar& scalar);
   virtual Status Visit(const LargeBinaryScalar& scalar);
+  virtual Status Visit(const StringViewScalar& scalar);
   virtual Status Visit(const FixedSizeBinaryScalar& scalar);
   virtual Status Visit(const Date64Scalar& scalar);
   virtual Status Visit(const Date32Scalar& scalar);
@@ -147,6 +152,7 @@ class ARROW_EXPORT ScalarVisitor {
   virtual Status Visit(const FixedSizeListScalar& scalar);
   virtual Status Visit(const StructScalar& scalar);
   virtual Status Visit(const DictionaryScalar& scalar);
+  virtual Status Visit(const RunEndEncodedScalar& scalar);
 };
 
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/extension_type.h"
@@ -58,6 +59,7 @@ namespace arrow {
   ACTION(Binary);                               \
   ACTION(LargeString);                          \
   ACTION(LargeBinary);                          \
+  ACTION(StringView);                           \
   ACTION(FixedSizeBinary);                      \
   ACTION(Duration);                             \
   ACTION(Date32);                               \
@@ -77,6 +79,7 @@ namespace arrow {
   ACTION(SparseUnion);                          \
   ACTION(DenseUnion);                           \
   ACTION(Dictionary);                           \
+  ACTION(RunEndEncoded);                        \
   ACTION(Extension)
 
 #define TYPE_VISIT_INLINE(TYPE_CLASS) \
@@ -145,7 +148,8 @@ struct ArrayDataInlineVisitor<T, enable_if_has_c_type<T>> {
                             NullFunc&& null_func) {
     const c_type* data = arr.GetValues<c_type>(1);
     auto visit_valid = [&](int64_t i) { return valid_func(data[i]); };
-    return VisitBitBlocks(arr.buffers[0], arr.offset, arr.length, std::move(visit_valid),
+    return VisitBitBlocks(arr.buffers[0], arr.offset, arr.length,
+                          arr.GetCachedValiditySummary().get(), std::move(visit_valid),
                           std::forward<NullFunc>(null_func));
   }
 
@@ -155,7 +159,8 @@ struct ArrayDataInlineVisitor<T, enable_if_has_c_type<T>> {
     using c_type = typename T::c_type;
     const c_type* data = arr.GetValues<c_type>(1);
     auto visit_valid = [&](int64_t i) { valid_func(data[i]); };
-    VisitBitBlocksVoid(arr.buffers[0], arr.offset, arr.length, std::move(visit_valid),
+    VisitBitBlocksVoid(arr.buffers[0], arr.offset, arr.length,
+                       arr.GetCachedValiditySummary().get(), std::move(visit_valid),
                        std::forward<NullFunc>(null_func));
   }
 };
@@ -171,7 +176,7 @@ struct ArrayDataInlineVisitor<BooleanType> {
     int64_t offset = arr.offset;
     const uint8_t* data = arr.buffers[1]->data();
     return VisitBitBlocks(
-        arr.buffers[0], offset, arr.length,
+        arr.buffers[0], offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) { return valid_func(BitUtil::GetBit(data, offset + i)); },
         std::forward<NullFunc>(null_func));
   }
@@ -182,7 +187,7 @@ struct ArrayDataInlineVisitor<BooleanType> {
     int64_t offset = arr.offset;
     const uint8_t* data = arr.buffers[1]->data();
     VisitBitBlocksVoid(
-        arr.buffers[0], offset, arr.length,
+        arr.buffers[0], offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) { valid_func(BitUtil::GetBit(data, offset + i)); },
         std::forward<NullFunc>(null_func));
   }
@@ -213,7 +218,7 @@ struct ArrayDataInlineVisitor<T, enable_if_base_binary<T>> {
     }
     offset_type cur_offset = *offsets++;
     return VisitBitBlocks(
-        arr.buffers[0], arr.offset, arr.length,
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) {
           ARROW_UNUSED(i);
           auto value = util::string_view(data + cur_offset, *offsets - cur_offset);
@@ -246,7 +251,7 @@ struct ArrayDataInlineVisitor<T, enable_if_base_binary<T>> {
     }
 
     VisitBitBlocksVoid(
-        arr.buffers[0], arr.offset, arr.length,
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) {
           auto value = util::string_view(reinterpret_cast<const char*>(data + offsets[i]),
                                          offsets[i + 1] - offsets[i]);
@@ -271,7 +276,7 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
                                            /*absolute_offset=*/arr.offset * byte_width);
 
     return VisitBitBlocks(
-        arr.buffers[0], arr.offset, arr.length,
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) {
           auto value = util::string_view(data, byte_width);
           data += byte_width;
@@ -293,7 +298,7 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
                                            /*absolute_offset=*/arr.offset * byte_width);
 
     VisitBitBlocksVoid(
-        arr.buffers[0], arr.offset, arr.length,
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
         [&](int64_t i) {
           valid_func(util::string_view(data, byte_width));
           data += byte_width;
@@ -305,6 +310,51 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
   }
 };
 
+// StringView
+template <typename T>
+struct ArrayDataInlineVisitor<T, enable_if_string_view<T>> {
+  using c_type = util::string_view;
+
+  template <typename ValidFunc, typename NullFunc>
+  static Status VisitStatus(const ArrayData& arr, ValidFunc&& valid_func,
+                            NullFunc&& null_func) {
+    const auto* views = arr.GetValues<StringViewType::c_type>(1);
+    const auto data_buffers = DataBuffers(arr);
+    return VisitBitBlocks(
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
+        [&](int64_t i) { return valid_func(GetView(views[i], data_buffers)); },
+        std::forward<NullFunc>(null_func));
+  }
+
+  template <typename ValidFunc, typename NullFunc>
+  static void VisitVoid(const ArrayData& arr, ValidFunc&& valid_func,
+                        NullFunc&& null_func) {
+    const auto* views = arr.GetValues<StringViewType::c_type>(1);
+    const auto data_buffers = DataBuffers(arr);
+    VisitBitBlocksVoid(
+        arr.buffers[0], arr.offset, arr.length, arr.GetCachedValiditySummary().get(),
+        [&](int64_t i) { valid_func(GetView(views[i], data_buffers)); },
+        std::forward<NullFunc>(null_func));
+  }
+
+ private:
+  static std::vector<const char*> DataBuffers(const ArrayData& arr) {
+    std::vector<const char*> data_buffers;
+    for (size_t i = 2; i < arr.buffers.size(); ++i) {
+      data_buffers.push_back(arr.GetValues<char>(static_cast<int>(i), 0));
+    }
+    return data_buffers;
+  }
+
+  static util::string_view GetView(const StringViewType::c_type& view,
+                                   const std::vector<const char*>& data_buffers) {
+    const char* data =
+        view.is_inline() ? reinterpret_cast<const char*>(view.inlined.data)
+                         : data_buffers[view.ref.buffer_index] + view.ref.offset;
+    return util::string_view(data, view.size());
+  }
+};
+
 }  // namespace internal
 
 // Visit an array's data values, in order, without overhead.
@@ -318,7 +368,8 @@ struct ArrayDataInlineVisitor<T, enable_if_fixed_size_binary<T>> {
 // ... where `scalar_type` depends on the array data type:
 // - the type's `c_type`, if any
 // - for boolean arrays, a `bool`
-// - for binary, string and fixed-size binary arrays, a `util::string_view`
+// - for binary, string, string view and fixed-size binary arrays, a
+//   `util::string_view`
 
 template <typename T, typename ValidFunc, typename NullFunc>
 typename internal::call_traits::enable_if_return<ValidFunc, Status>::type
@@ -343,7 +394,8 @@ VisitArrayDataInline(const ArrayData& arr, ValidFunc&& valid_func, NullFunc&& nu
 // The scalar value's type depends on the array data type:
 // - the type's `c_type`, if any
 // - for boolean arrays, a `bool`
-// - for binary, string and fixed-size binary arrays, a `util::string_view`
+// - for binary, string, string view and fixed-size binary arrays, a
+//   `util::string_view`
 
 template <typename T>
 struct ArrayDataVisitor {
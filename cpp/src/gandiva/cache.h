@@ -17,9 +17,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "arrow/util/future.h"
+#include "gandiva/arrow.h"
 #include "gandiva/lru_cache.h"
 #include "gandiva/visibility.h"
 
@@ -31,29 +42,146 @@ int GetCapacity();
 GANDIVA_EXPORT
 void LogCacheSize(size_t capacity);
 
+/// \brief Counters of a module cache.
+struct CacheStats {
+  /// Lookups that found a built module.
+  int64_t hits = 0;
+  /// Lookups that did not find the module, and built it.
+  int64_t misses = 0;
+  /// Lookups that waited for another thread building the same module.
+  int64_t waits = 0;
+  /// Total time spent building modules on misses.
+  int64_t build_time_ns = 0;
+};
+
+/// \brief A thread-safe LRU cache of built modules.
+///
+/// The cache is split into shards by key hash, each with its own lock, so that
+/// concurrent lookups of different keys rarely contend.
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity) : cache_(capacity) { LogCacheSize(capacity); }
+  static constexpr size_t kMaxShards = 16;
+
+  explicit Cache(size_t capacity)
+      : num_shards_(std::max<size_t>(1, std::min(kMaxShards, capacity))) {
+    // Round up, so that the total capacity is at least the requested one.
+    const size_t shard_capacity = (capacity + num_shards_ - 1) / num_shards_;
+    shards_.reserve(num_shards_);
+    for (size_t i = 0; i < num_shards_; ++i) {
+      shards_.emplace_back(new Shard(shard_capacity));
+    }
+    LogCacheSize(capacity);
+  }
 
   Cache() : Cache(GetCapacity()) {}
 
   ValueType GetModule(KeyType cache_key) {
-    arrow::util::optional<ValueType> result;
-    mtx_.lock();
-    result = cache_.get(cache_key);
-    mtx_.unlock();
+    auto& shard = ShardFor(cache_key);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto result = shard.cache.get(cache_key);
     return result != arrow::util::nullopt ? *result : nullptr;
   }
 
   void PutModule(KeyType cache_key, ValueType module) {
-    mtx_.lock();
-    cache_.insert(cache_key, module);
-    mtx_.unlock();
+    auto& shard = ShardFor(cache_key);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    shard.cache.insert(cache_key, module);
+  }
+
+  /// \brief Return the module for `cache_key`, building it if it is absent.
+  ///
+  /// When several threads look up the same absent key, only one of them calls
+  /// `build`, the others wait for its outcome.
+  Status GetOrBuildModule(const KeyType& cache_key,
+                          const std::function<Status(ValueType*)>& build,
+                          ValueType* module) {
+    auto& shard = ShardFor(cache_key);
+    arrow::Future<ValueType> in_flight;
+    bool is_builder = false;
+    {
+      std::lock_guard<std::mutex> lock(shard.mtx);
+      auto result = shard.cache.get(cache_key);
+      if (result != arrow::util::nullopt) {
+        ++hits_;
+        *module = *result;
+        return Status::OK();
+      }
+      auto it = shard.in_flight.find(cache_key);
+      if (it != shard.in_flight.end()) {
+        in_flight = it->second;
+      } else {
+        in_flight = arrow::Future<ValueType>::Make();
+        shard.in_flight.emplace(cache_key, in_flight);
+        is_builder = true;
+      }
+    }
+
+    if (!is_builder) {
+      ++waits_;
+      const auto& result = in_flight.result();
+      ARROW_RETURN_NOT_OK(result.status());
+      *module = *result;
+      return Status::OK();
+    }
+
+    ++misses_;
+    const auto start = std::chrono::steady_clock::now();
+    ValueType built;
+    Status status = build(&built);
+    build_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    {
+      std::lock_guard<std::mutex> lock(shard.mtx);
+      if (status.ok()) {
+        shard.cache.insert(cache_key, built);
+      }
+      shard.in_flight.erase(cache_key);
+    }
+    if (!status.ok()) {
+      in_flight.MarkFinished(status);
+      return status;
+    }
+    in_flight.MarkFinished(built);
+    *module = std::move(built);
+    return Status::OK();
+  }
+
+  CacheStats stats() const {
+    CacheStats stats;
+    stats.hits = hits_.load();
+    stats.misses = misses_.load();
+    stats.waits = waits_.load();
+    stats.build_time_ns = build_time_ns_.load();
+    return stats;
   }
 
  private:
-  LruCache<KeyType, ValueType> cache_;
-  std::mutex mtx_;
+  using hasher = typename LruCache<KeyType, ValueType>::hasher;
+
+  struct Shard {
+    explicit Shard(size_t capacity) : cache(capacity) {}
+
+    std::mutex mtx;
+    LruCache<KeyType, ValueType> cache;
+    // Modules being built, to let concurrent lookups of the same key wait for them.
+    std::unordered_map<KeyType, arrow::Future<ValueType>, hasher> in_flight;
+  };
+
+  Shard& ShardFor(const KeyType& cache_key) {
+    return *shards_[cache_key.Hash() % num_shards_];
+  }
+
+  const size_t num_shards_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+  std::atomic<int64_t> waits_{0};
+  std::atomic<int64_t> build_time_ns_{0};
 };
+
+template <class KeyType, typename ValueType>
+constexpr size_t Cache<KeyType, ValueType>::kMaxShards;
+
 }  // namespace gandiva
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/cache.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+namespace gandiva {
+
+class TestModuleKey {
+ public:
+  explicit TestModuleKey(int tmp) : tmp_(tmp) {}
+  std::size_t Hash() const { return tmp_; }
+  bool operator==(const TestModuleKey& other) const { return tmp_ == other.tmp_; }
+
+ private:
+  int tmp_;
+};
+
+using TestCache = Cache<TestModuleKey, std::shared_ptr<std::string>>;
+
+Status BuildModule(const std::string& value, std::shared_ptr<std::string>* module) {
+  *module = std::make_shared<std::string>(value);
+  return Status::OK();
+}
+
+TEST(TestCache, TestGetOrBuild) {
+  TestCache cache(100);
+  auto build_a = [](std::shared_ptr<std::string>* out) { return BuildModule("a", out); };
+  auto build_b = [](std::shared_ptr<std::string>* out) { return BuildModule("b", out); };
+
+  std::shared_ptr<std::string> module;
+  ASSERT_OK(cache.GetOrBuildModule(TestModuleKey(1), build_a, &module));
+  ASSERT_EQ(*module, "a");
+
+  // Found in the cache, not rebuilt
+  std::shared_ptr<std::string> cached_module;
+  ASSERT_OK(cache.GetOrBuildModule(TestModuleKey(1), build_b, &cached_module));
+  ASSERT_EQ(cached_module, module);
+  ASSERT_EQ(cache.GetModule(TestModuleKey(1)), module);
+
+  // Failures are returned and not cached
+  ASSERT_RAISES(Invalid, cache.GetOrBuildModule(
+                             TestModuleKey(2),
+                             [](std::shared_ptr<std::string>* out) {
+                               return Status::Invalid("cannot build");
+                             },
+                             &module));
+  ASSERT_EQ(cache.GetModule(TestModuleKey(2)), nullptr);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 2);
+  ASSERT_EQ(stats.waits, 0);
+  ASSERT_GE(stats.build_time_ns, 0);
+}
+
+TEST(TestCache, TestConcurrentBuild) {
+  constexpr int kNumThreads = 8;
+  TestCache cache(100);
+  std::atomic<int> num_builds{0};
+  std::atomic<int> num_started{0};
+  std::vector<std::shared_ptr<std::string>> modules(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      ++num_started;
+      ASSERT_OK(cache.GetOrBuildModule(
+          TestModuleKey(1),
+          [&](std::shared_ptr<std::string>* out) {
+            ++num_builds;
+            // Give the other threads time to look up the same key
+            while (num_started.load() < kNumThreads) {
+              std::this_thread::yield();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return BuildModule("a", out);
+          },
+          &modules[i]));
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Only one thread built the module, the others waited for it or found it.
+  ASSERT_EQ(num_builds.load(), 1);
+  for (const auto& module : modules) {
+    ASSERT_EQ(module, modules[0]);
+  }
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.hits + stats.waits, kNumThreads - 1);
+}
+
+TEST(TestCache, TestSmallCapacity) {
+  // Fewer entries than shards
+  TestCache cache(2);
+  cache.PutModule(TestModuleKey(1), std::make_shared<std::string>("a"));
+  cache.PutModule(TestModuleKey(2), std::make_shared<std::string>("b"));
+  cache.PutModule(TestModuleKey(3), std::make_shared<std::string>("c"));
+  int num_entries = 0;
+  for (int i = 1; i <= 3; ++i) {
+    num_entries += cache.GetModule(TestModuleKey(i)) != nullptr;
+  }
+  ASSERT_EQ(num_entries, 2);
+}
+
+}  // namespace gandiva
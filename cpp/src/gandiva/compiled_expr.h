@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "gandiva/llvm_includes.h"
 #include "gandiva/selection_vector.h"
@@ -54,6 +55,12 @@ class CompiledExpr {
     return jit_functions_[static_cast<int>(mode)];
   }
 
+  /// Average size in bytes of a var-len output entry in the last evaluated batch,
+  /// used to reserve the output data buffer up-front.
+  int64_t varlen_bytes_per_row() const { return varlen_bytes_per_row_.load(); }
+
+  void set_varlen_bytes_per_row(int64_t bytes) { varlen_bytes_per_row_.store(bytes); }
+
  private:
   // value & validities for the expression tree (root)
   ValueValidityPairPtr value_validity_;
@@ -62,10 +69,12 @@ class CompiledExpr {
   FieldDescriptorPtr output_;
 
   // IR functions for various modes in the generated code
-  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_;
+  std::array<llvm::Function*, SelectionVector::kNumModes> ir_functions_{};
 
   // JIT functions in the generated code (set after the module is optimised and finalized)
-  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_;
+  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_{};
+
+  std::atomic<int64_t> varlen_bytes_per_row_{0};
 };
 
 }  // namespace gandiva
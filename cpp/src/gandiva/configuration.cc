@@ -29,11 +29,15 @@ std::size_t Configuration::Hash() const {
   size_t result = kHashSeed;
   arrow::internal::hash_combine(result, static_cast<size_t>(optimize_));
   arrow::internal::hash_combine(result, static_cast<size_t>(target_host_cpu_));
+  arrow::internal::hash_combine(result, static_cast<size_t>(tiered_compilation_));
+  arrow::internal::hash_combine(result, static_cast<size_t>(parallel_evaluation_));
   return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return optimize_ == other.optimize_ && target_host_cpu_ == other.target_host_cpu_;
+  return optimize_ == other.optimize_ && target_host_cpu_ == other.target_host_cpu_ &&
+         tiered_compilation_ == other.tiered_compilation_ &&
+         parallel_evaluation_ == other.parallel_evaluation_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
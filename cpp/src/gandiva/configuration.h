@@ -34,8 +34,16 @@ class GANDIVA_EXPORT Configuration {
  public:
   friend class ConfigurationBuilder;
 
-  Configuration() : optimize_(true), target_host_cpu_(true) {}
-  explicit Configuration(bool optimize) : optimize_(optimize), target_host_cpu_(true) {}
+  Configuration()
+      : optimize_(true),
+        target_host_cpu_(true),
+        tiered_compilation_(false),
+        parallel_evaluation_(false) {}
+  explicit Configuration(bool optimize)
+      : optimize_(optimize),
+        target_host_cpu_(true),
+        tiered_compilation_(false),
+        parallel_evaluation_(false) {}
 
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
@@ -43,13 +51,23 @@ class GANDIVA_EXPORT Configuration {
 
   bool optimize() const { return optimize_; }
   bool target_host_cpu() const { return target_host_cpu_; }
+  bool tiered_compilation() const { return tiered_compilation_; }
+  bool parallel_evaluation() const { return parallel_evaluation_; }
 
   void set_optimize(bool optimize) { optimize_ = optimize; }
   void target_host_cpu(bool target_host_cpu) { target_host_cpu_ = target_host_cpu; }
+  void set_tiered_compilation(bool tiered_compilation) {
+    tiered_compilation_ = tiered_compilation;
+  }
+  void set_parallel_evaluation(bool parallel_evaluation) {
+    parallel_evaluation_ = parallel_evaluation;
+  }
 
  private:
-  bool optimize_;        /* optimise the generated llvm IR */
-  bool target_host_cpu_; /* set the mcpu flag to host cpu while compiling llvm ir */
+  bool optimize_;            /* optimise the generated llvm IR */
+  bool target_host_cpu_;     /* set the mcpu flag to host cpu while compiling llvm ir */
+  bool tiered_compilation_;  /* start with unoptimized code, optimise in background */
+  bool parallel_evaluation_; /* split large batches across the cpu thread pool */
 };
 
 /// \brief configuration builder for gandiva
@@ -23,6 +23,7 @@
 
 #include "gandiva/engine.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -45,6 +46,7 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/DataLayout.h>
@@ -75,6 +77,7 @@
 #include "gandiva/configuration.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
+#include "gandiva/object_file_cache.h"
 
 namespace gandiva {
 
@@ -119,7 +122,17 @@ Engine::Engine(const std::shared_ptr<Configuration>& conf,
       ir_builder_(arrow::internal::make_unique<llvm::IRBuilder<>>(*context_)),
       module_(module),
       types_(*context_),
-      optimize_(conf->optimize()) {}
+      optimize_(conf->optimize()) {
+  if (conf->target_host_cpu()) {
+    for (const auto& attr : cpu_attrs) {
+      if (attr == "+avx512f") {
+        vector_register_bits_ = std::max(vector_register_bits_, 512);
+      } else if (attr == "+avx" || attr == "+avx2") {
+        vector_register_bits_ = std::max(vector_register_bits_, 256);
+      }
+    }
+  }
+}
 
 Status Engine::Init() {
   // Add mappings for functions that can be accessed from LLVM/IR module.
@@ -272,11 +285,72 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+namespace {
+
+// Adapts an ObjectFileCache entry to the llvm::ObjectCache interface, so that MCJIT
+// loads the object from disk instead of generating code, or stores the object it
+// generated.
+class ModuleObjectCache : public llvm::ObjectCache {
+ public:
+  ModuleObjectCache(std::shared_ptr<ObjectFileCache> cache, std::string key,
+                    arrow::util::optional<std::string> object)
+      : cache_(std::move(cache)), key_(std::move(key)), object_(std::move(object)) {}
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef obj) override {
+    auto status = cache_->Put(key_, obj.getBuffer().str());
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Could not store compiled module: " << status.ToString();
+    }
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override {
+    if (!object_.has_value()) {
+      return nullptr;
+    }
+    return llvm::MemoryBuffer::getMemBufferCopy(*object_);
+  }
+
+ private:
+  std::shared_ptr<ObjectFileCache> cache_;
+  std::string key_;
+  arrow::util::optional<std::string> object_;
+};
+
+}  // namespace
+
+std::string Engine::ObjectCacheKey() {
+  // The IR covers the expressions, the schema and the pre-compiled functions they
+  // use; the remaining fields cover everything that affects code generation.
+  std::string key;
+  llvm::raw_string_ostream stream(key);
+  stream << "llvm " << LLVM_VERSION_STRING << "\n";
+  stream << "triple " << execution_engine_->getTargetMachine()->getTargetTriple().str()
+         << "\n";
+  stream << "cpu " << execution_engine_->getTargetMachine()->getTargetCPU() << " "
+         << execution_engine_->getTargetMachine()->getTargetFeatureString() << "\n";
+  stream << "optimize " << optimize_ << "\n";
+  module_->print(stream, nullptr);
+  return stream.str();
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
-  if (optimize_) {
+  bool cached = false;
+  auto file_cache = object_cache_enabled_ ? ObjectFileCache::GetDefault() : nullptr;
+  if (file_cache != nullptr) {
+    auto key = ObjectCacheKey();
+    auto object = file_cache->Get(key);
+    cached = object.has_value();
+    object_cache_.reset(
+        new ModuleObjectCache(std::move(file_cache), std::move(key), std::move(object)));
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  // The optimizer only affects code generation, skip it if the object is cached.
+  if (optimize_ && !cached) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
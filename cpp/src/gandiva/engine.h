@@ -54,6 +54,17 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
+  /// Mark the module as unsuitable for the persistent object cache.
+  ///
+  /// Must be called when the generated IR embeds addresses that are only valid
+  /// in the current process (e.g. function holders).
+  void DisableObjectCache() { object_cache_enabled_ = false; }
+
+  /// Width in bits of the widest vector registers of the target CPU.
+  ///
+  /// Falls back to 128 (SSE2/NEON baseline) when not targeting the host CPU.
+  int vector_register_bits() const { return vector_register_bits_; }
+
   /// Optimise and compile the module.
   Status FinalizeModule();
 
@@ -89,6 +100,9 @@ class GANDIVA_EXPORT Engine {
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Return the key identifying the compiled module in the persistent object cache.
+  std::string ObjectCacheKey();
+
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -97,8 +111,12 @@ class GANDIVA_EXPORT Engine {
 
   std::vector<std::string> functions_to_compile_;
 
+  std::unique_ptr<llvm::ObjectCache> object_cache_;
+
+  int vector_register_bits_ = 128;
   bool optimize_ = true;
   bool module_finalized_ = false;
+  bool object_cache_enabled_ = true;
 };
 
 }  // namespace gandiva
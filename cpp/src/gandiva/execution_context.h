@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include "arrow/buffer.h"
 #include "gandiva/simple_arena.h"
 
 namespace gandiva {
@@ -41,6 +42,27 @@ class ExecutionContext {
 
   SimpleArena* arena() { return &arena_; }
 
+  /// Serve arena allocations from the unused capacity of the var-len output buffer
+  /// `buffer`, so that a result built in the arena needs no copy when it is appended.
+  void BeginVarlenOutput(arrow::ResizableBuffer* buffer) {
+    varlen_output_ = buffer;
+    UpdateVarlenOutputWindow();
+  }
+
+  void EndVarlenOutput() {
+    varlen_output_ = NULLPTR;
+    arena_.ClearWindow();
+  }
+
+  arrow::ResizableBuffer* varlen_output() const { return varlen_output_; }
+
+  /// Move the arena window past the data of the var-len output buffer, must be
+  /// called whenever the buffer is appended to or reallocated.
+  void UpdateVarlenOutputWindow() {
+    uint8_t* data = varlen_output_->mutable_data();
+    arena_.SetWindow(data + varlen_output_->size(), data + varlen_output_->capacity());
+  }
+
   void Reset() {
     error_msg_.clear();
     arena_.Reset();
@@ -49,6 +71,7 @@ class ExecutionContext {
  private:
   std::string error_msg_;
   SimpleArena arena_;
+  arrow::ResizableBuffer* varlen_output_ = NULLPTR;
 };
 
 }  // namespace gandiva
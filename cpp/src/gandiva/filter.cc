@@ -17,11 +17,13 @@
 
 #include "gandiva/filter.h"
 
+#include <cstring>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hash_util.h"
 
 #include "gandiva/bitmap_accumulator.h"
@@ -30,6 +32,7 @@
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
 #include "gandiva/selection_vector_impl.h"
+#include "gandiva/tiered_generator.h"
 
 namespace gandiva {
 
@@ -86,9 +89,23 @@ void FilterCacheKey::UpdateUniqifier(const std::string& expr) {
   }
 }
 
+namespace {
+
+Cache<FilterCacheKey, std::shared_ptr<Filter>>& FilterCache() {
+  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  return cache;
+}
+
+}  // namespace
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
-    : llvm_generator_(std::move(llvm_generator)),
+    : Filter(std::make_shared<TieredGenerator>(std::move(llvm_generator)), schema,
+             configuration) {}
+
+Filter::Filter(std::shared_ptr<TieredGenerator> generator, SchemaPtr schema,
+               std::shared_ptr<Configuration> configuration)
+    : generator_(std::move(generator)),
       schema_(schema),
       configuration_(configuration) {}
 
@@ -102,45 +119,52 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  // see if equivalent filter was already built, or is being built by another
+  // thread, otherwise build it.
   FilterCacheKey cache_key(schema, configuration, *(condition.get()));
-  auto cachedFilter = cache.GetModule(cache_key);
-  if (cachedFilter != nullptr) {
-    *filter = cachedFilter;
-    return Status::OK();
-  }
+  return FilterCache().GetOrBuildModule(
+      cache_key,
+      [&](std::shared_ptr<Filter>* built_filter) -> Status {
+        // Build LLVM generator, and generate code for the specified expression
+        auto build = [schema, condition](
+                         std::shared_ptr<Configuration> config,
+                         std::unique_ptr<LLVMGenerator>* llvm_gen) -> Status {
+          ARROW_RETURN_NOT_OK(LLVMGenerator::Make(config, llvm_gen));
 
-  // Build LLVM generator, and generate code for the specified expression
-  std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+          // Run the validation on the expression.
+          // Return if the expression is invalid since we will not be able to process
+          // further.
+          ExprValidator expr_validator((*llvm_gen)->types(), schema);
+          ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+          return (*llvm_gen)->Build({condition}, SelectionVector::Mode::MODE_NONE);
+        };
+        std::shared_ptr<TieredGenerator> generator;
+        ARROW_RETURN_NOT_OK(
+            TieredGenerator::Make(configuration, std::move(build), &generator));
 
-  // Run the validation on the expression.
-  // Return if the expression is invalid since we will not be able to process further.
-  ExprValidator expr_validator(llvm_gen->types(), schema);
-  ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
-  ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
+        // Instantiate the filter with the completely built llvm generator
+        *built_filter =
+            std::make_shared<Filter>(std::move(generator), schema, configuration);
+        return Status::OK();
+      },
+      filter);
+}
 
-  // Instantiate the filter with the completely built llvm generator
-  *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
-  cache.PutModule(cache_key, *filter);
+CacheStats Filter::GetCacheStats() { return FilterCache().stats(); }
 
+Status Filter::ValidateEvaluateArgs(const arrow::RecordBatch& batch) {
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("RecordBatch schema must expected filter schema"));
+  ARROW_RETURN_IF(batch.num_rows() == 0,
+                  Status::Invalid("RecordBatch must be non-empty."));
   return Status::OK();
 }
 
-Status Filter::Evaluate(const arrow::RecordBatch& batch,
-                        std::shared_ptr<SelectionVector> out_selection) {
+Status Filter::EvaluateBitMap(const arrow::RecordBatch& batch, uint8_t* result) {
   const auto num_rows = batch.num_rows();
-  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
-                  Status::Invalid("RecordBatch schema must expected filter schema"));
-  ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
-  ARROW_RETURN_IF(out_selection == nullptr,
-                  Status::Invalid("out_selection must be non-null."));
-  ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
-                  Status::Invalid("Output selection vector capacity too small"));
 
-  // Allocate three local_bitmaps (one for output, one for validity, one to compute the
-  // intersection).
-  LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
+  // Allocate two local_bitmaps (one for output, one for validity).
+  LocalBitMapsHolder bitmaps(num_rows, 2 /*local_bitmaps*/);
   int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
 
   auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
@@ -148,16 +172,88 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  ARROW_RETURN_NOT_OK(generator_->get()->Execute(batch, {array_data}));
 
   // Compute the intersection of the value and validity.
-  auto result = bitmaps.GetLocalBitMap(2);
   BitMapAccumulator::IntersectBitMaps(
       result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap((1))}, {0, 0}, num_rows);
+  return Status::OK();
+}
 
-  return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
+Status Filter::Evaluate(const arrow::RecordBatch& batch,
+                        std::shared_ptr<SelectionVector> out_selection) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgs(batch));
+  ARROW_RETURN_IF(out_selection == nullptr,
+                  Status::Invalid("out_selection must be non-null."));
+  ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
+                  Status::Invalid("Output selection vector capacity too small"));
+
+  LocalBitMapsHolder bitmaps(num_rows, 1 /*local_bitmaps*/);
+  auto result = bitmaps.GetLocalBitMap(0);
+  ARROW_RETURN_NOT_OK(EvaluateBitMap(batch, result));
+
+  return out_selection->PopulateFromBitMap(result, bitmaps.GetLocalBitMapSize(),
+                                           num_rows - 1);
+}
+
+Status Filter::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                        std::shared_ptr<arrow::BooleanArray>* out_bitmap) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgs(batch));
+  ARROW_RETURN_IF(out_bitmap == nullptr, Status::Invalid("out_bitmap must be non-null."));
+
+  // 64-bit aligned, like the local bitmaps.
+  int64_t bitmap_size = arrow::BitUtil::RoundUpToMultipleOf64(num_rows) / 8;
+  ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateBuffer(bitmap_size, pool));
+  // Zero the padding, which the intersection does not write.
+  std::memset(buffer->mutable_data() + bitmap_size - 8, 0, 8);
+  ARROW_RETURN_NOT_OK(EvaluateBitMap(batch, buffer->mutable_data()));
+
+  *out_bitmap = std::make_shared<arrow::BooleanArray>(num_rows, std::move(buffer));
+  return Status::OK();
+}
+
+Status Filter::EvaluateAdaptive(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                                std::shared_ptr<arrow::Array>* out) {
+  ARROW_RETURN_IF(out == nullptr, Status::Invalid("out must be non-null."));
+  std::shared_ptr<arrow::BooleanArray> bitmap;
+  ARROW_RETURN_NOT_OK(Evaluate(batch, pool, &bitmap));
+
+  const auto num_rows = batch.num_rows();
+  const auto num_matches = bitmap->true_count();
+  int index_bit_width = 64;
+  if (num_rows <= 1 << 16) {
+    index_bit_width = 16;
+  } else if (num_rows <= 1LL << 32) {
+    index_bit_width = 32;
+  }
+  // The bitmap takes one bit per row, the indices index_bit_width bits per match.
+  if (num_matches * index_bit_width >= num_rows) {
+    *out = std::move(bitmap);
+    return Status::OK();
+  }
+
+  std::shared_ptr<SelectionVector> selection;
+  switch (index_bit_width) {
+    case 16:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt16(num_matches, pool, &selection));
+      break;
+    case 32:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(num_matches, pool, &selection));
+      break;
+    default:
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt64(num_matches, pool, &selection));
+  }
+  ARROW_RETURN_NOT_OK(selection->PopulateFromBitMap(bitmap->values()->data(),
+                                                    bitmap->values()->size(),
+                                                    num_rows - 1));
+  *out = selection->ToArray();
+  return Status::OK();
 }
 
-std::string Filter::DumpIR() { return llvm_generator_->DumpIR(); }
+arrow::Future<> Filter::OptimizedCodeReady() const { return generator_->optimized(); }
+
+std::string Filter::DumpIR() { return generator_->get()->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,8 +23,10 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache.h"
 #include "gandiva/condition.h"
 #include "gandiva/configuration.h"
 #include "gandiva/selection_vector.h"
@@ -33,6 +35,7 @@
 namespace gandiva {
 
 class LLVMGenerator;
+class TieredGenerator;
 
 class FilterCacheKey {
  public:
@@ -68,6 +71,9 @@ class GANDIVA_EXPORT Filter {
   Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
          std::shared_ptr<Configuration> config);
 
+  Filter(std::shared_ptr<TieredGenerator> generator, SchemaPtr schema,
+         std::shared_ptr<Configuration> config);
+
   // Inline dtor will attempt to resolve the destructor for
   // LLVMGenerator on MSVC, so we compile the dtor in the object code
   ~Filter();
@@ -101,10 +107,52 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Evaluate the specified record batch, and return a bitmap of the matching rows.
+  ///
+  /// The result has no nulls, it can be passed as-is as the selection filter of
+  /// arrow::compute::Filter.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate the bitmap
+  /// \param[out] out_bitmap true for the rows that match the condition.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  std::shared_ptr<arrow::BooleanArray>* out_bitmap);
+
+  /// Evaluate the specified record batch, and return the matching rows in the smaller
+  /// of two forms, chosen from the number of matches in the batch.
+  ///
+  /// The result is either a bitmap, as returned by the overload above, or the indices
+  /// of the matching rows (uint16 for batches of up to 65536 rows, uint32 or uint64
+  /// otherwise), which can be passed as-is as the indices of arrow::compute::Take.
+  /// Indices are returned when they take less memory than the bitmap, i.e. when less
+  /// than one row in 16 (resp. 32, 64) matches.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate the result
+  /// \param[out] out a boolean array or an unsigned integer array.
+  Status EvaluateAdaptive(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                          std::shared_ptr<arrow::Array>* out);
+
+  /// Return a future that completes once optimized code is used for evaluation.
+  ///
+  /// With tiered compilation (see Configuration::set_tiered_compilation), Make()
+  /// returns as soon as unoptimized code is built. Otherwise the future is already
+  /// finished.
+  arrow::Future<> OptimizedCodeReady() const;
+
   std::string DumpIR();
 
+  /// Return the statistics of the process-wide cache of built filters.
+  static CacheStats GetCacheStats();
+
  private:
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  Status ValidateEvaluateArgs(const arrow::RecordBatch& batch);
+
+  /// Evaluate the condition, and write the bitmap of the matching rows to 'result',
+  /// which must have room for the rows of 'batch' rounded up to a multiple of 64.
+  Status EvaluateBitMap(const arrow::RecordBatch& batch, uint8_t* result);
+
+  std::shared_ptr<TieredGenerator> generator_;
   SchemaPtr schema_;
   std::shared_ptr<Configuration> configuration_;
 };
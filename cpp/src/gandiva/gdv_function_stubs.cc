@@ -17,11 +17,13 @@
 
 #include "gandiva/gdv_function_stubs.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "arrow/util/value_parsing.h"
 #include "gandiva/engine.h"
+#include "gandiva/execution_context.h"
 #include "gandiva/exported_funcs.h"
 #include "gandiva/hash_utils.h"
 #include "gandiva/in_holder.h"
@@ -29,6 +31,10 @@
 #include "gandiva/random_generator_holder.h"
 #include "gandiva/to_date_holder.h"
 
+// Minimum unused capacity kept at the end of a var-len output buffer, for the next
+// entries to be built in place.
+static constexpr int64_t kMinVarlenWindow = 1024;
+
 /// Stub functions that can be accessed from LLVM or the pre-compiled library.
 
 extern "C" {
@@ -113,24 +119,51 @@ int32_t gdv_fn_populate_varlen_vector(int64_t context_ptr, int8_t* data_ptr,
                                       int32_t* offsets, int64_t slot,
                                       const char* entry_buf, int32_t entry_len) {
   auto buffer = reinterpret_cast<arrow::ResizableBuffer*>(data_ptr);
+  auto context = reinterpret_cast<gandiva::ExecutionContext*>(context_ptr);
   int32_t offset = static_cast<int32_t>(buffer->size());
-
+  int64_t new_size = offset + entry_len;
+  bool direct_output = context->varlen_output() == buffer;
+
+  // Entries built in the arena window already live in the unused capacity of the
+  // buffer, they fit without growing it.
+  if (new_size > buffer->capacity()) {
+    // Grow geometrically to amortise the reallocations over the batch.
+    auto status = buffer->Reserve(std::max(new_size, 2 * buffer->capacity()));
+    if (!status.ok()) {
+      context->set_error_msg(status.message().c_str());
+      return -1;
+    }
+  }
   // This also sets the size in the buffer.
-  auto status = buffer->Resize(offset + entry_len, false /*shrink*/);
+  auto status = buffer->Resize(new_size, false /*shrink*/);
   if (!status.ok()) {
-    gandiva::ExecutionContext* context =
-        reinterpret_cast<gandiva::ExecutionContext*>(context_ptr);
-
     context->set_error_msg(status.message().c_str());
     return -1;
   }
 
-  // append the new entry.
-  memcpy(buffer->mutable_data() + offset, entry_buf, entry_len);
+  // append the new entry, unless it was built in place.
+  uint8_t* entry_dest = buffer->mutable_data() + offset;
+  if (entry_len > 0 && entry_dest != reinterpret_cast<const uint8_t*>(entry_buf)) {
+    // may overlap when the entry was built further in the arena window.
+    memmove(entry_dest, entry_buf, entry_len);
+  }
 
   // update offsets buffer.
   offsets[slot] = offset;
-  offsets[slot + 1] = offset + entry_len;
+  offsets[slot + 1] = static_cast<int32_t>(new_size);
+
+  if (direct_output) {
+    // Keep room for the next entries to be built in place.
+    if (buffer->capacity() - new_size < std::max<int64_t>(entry_len, kMinVarlenWindow)) {
+      status = buffer->Reserve(std::max(new_size + kMinVarlenWindow,
+                                        2 * buffer->capacity()));
+      if (!status.ok()) {
+        context->set_error_msg(status.message().c_str());
+        return -1;
+      }
+    }
+    context->UpdateVarlenOutputWindow();
+  }
   return 0;
 }
 
@@ -17,8 +17,10 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -40,6 +42,65 @@ namespace gandiva {
 
 LLVMGenerator::LLVMGenerator() : enable_ir_traces_(false) {}
 
+namespace {
+
+/// Checks whether a value tree is simple enough for the loop vectorizer : only
+/// fixed-width reads, literals and non-nullable functions that need no context
+/// or holder (arithmetic, comparisons, casts). Branches, function calls into the
+/// runtime and variable-width values all defeat vectorization.
+class VectorizableChecker : public DexVisitor {
+ public:
+  bool Check(const Dex& dex) {
+    const_cast<Dex&>(dex).Accept(*this);
+    return vectorizable_;
+  }
+
+  void Visit(const VectorReadValidityDex& dex) override {}
+  void Visit(const VectorReadFixedLenValueDex& dex) override {}
+  void Visit(const VectorReadVarLenValueDex& dex) override { vectorizable_ = false; }
+  void Visit(const LocalBitMapValidityDex& dex) override {}
+  void Visit(const TrueDex& dex) override {}
+  void Visit(const FalseDex& dex) override {}
+
+  void Visit(const LiteralDex& dex) override {
+    if (!arrow::is_primitive(dex.type()->id())) {
+      vectorizable_ = false;
+    }
+  }
+
+  void Visit(const NonNullableFuncDex& dex) override {
+    auto native_function = dex.native_function();
+    if (dex.function_holder() != nullptr || native_function->NeedsContext() ||
+        native_function->CanReturnErrors()) {
+      vectorizable_ = false;
+      return;
+    }
+    for (auto& arg : dex.args()) {
+      if (!vectorizable_) {
+        return;
+      }
+      arg->value_expr()->Accept(*this);
+    }
+  }
+
+  void Visit(const NullableNeverFuncDex& dex) override { vectorizable_ = false; }
+  void Visit(const NullableInternalFuncDex& dex) override { vectorizable_ = false; }
+  void Visit(const IfDex& dex) override { vectorizable_ = false; }
+  void Visit(const BooleanAndDex& dex) override { vectorizable_ = false; }
+  void Visit(const BooleanOrDex& dex) override { vectorizable_ = false; }
+  void Visit(const InExprDexBase<int32_t>& dex) override { vectorizable_ = false; }
+  void Visit(const InExprDexBase<int64_t>& dex) override { vectorizable_ = false; }
+  void Visit(const InExprDexBase<gandiva::DecimalScalar128>& dex) override {
+    vectorizable_ = false;
+  }
+  void Visit(const InExprDexBase<std::string>& dex) override { vectorizable_ = false; }
+
+ private:
+  bool vectorizable_ = true;
+};
+
+}  // namespace
+
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
   std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator());
@@ -51,20 +112,26 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
 }
 
 Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
-  int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
   ExprDecomposer decomposer(function_registry_, annotator_);
   ValueValidityPairPtr value_validity;
   ARROW_RETURN_NOT_OK(decomposer.Decompose(*expr->root(), &value_validity));
-  // Generate the IR function for the decomposed expression.
-  std::unique_ptr<CompiledExpr> compiled_expr(new CompiledExpr(value_validity, output));
-  llvm::Function* ir_function = nullptr;
-  ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
-                                       annotator_.buffer_count(), output, idx,
-                                       &ir_function, selection_vector_mode_));
-  compiled_expr->SetIRFunction(selection_vector_mode_, ir_function);
+  compiled_exprs_.emplace_back(new CompiledExpr(value_validity, output));
+  return Status::OK();
+}
 
-  compiled_exprs_.push_back(std::move(compiled_expr));
+Status LLVMGenerator::CodeGenCompiledExprs(size_t begin, size_t end) {
+  std::vector<ValueOutput> values;
+  for (size_t idx = begin; idx < end; ++idx) {
+    values.emplace_back(compiled_exprs_[idx]->value_validity()->value_expr(),
+                        compiled_exprs_[idx]->output());
+  }
+  // Generate the IR function, it is attached to the first expression of the group.
+  llvm::Function* ir_function = nullptr;
+  ARROW_RETURN_NOT_OK(CodeGenExprValues(values, annotator_.buffer_count(),
+                                        static_cast<int>(begin), &ir_function,
+                                        selection_vector_mode_));
+  compiled_exprs_[begin]->SetIRFunction(selection_vector_mode_, ir_function);
   return Status::OK();
 }
 
@@ -76,12 +143,38 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
 
+  // Consecutive expressions with fixed-width outputs share a loop, so that the
+  // subexpressions they have in common (e.g. a*b in a*b+1 and a*b-1) are computed
+  // once per row by the optimizer, and the constant ones are folded. Var-len outputs
+  // keep a loop each, since their results are built in place in the output buffer.
+  size_t group_begin = 0;
+  for (size_t idx = 0; idx < compiled_exprs_.size(); ++idx) {
+    auto type_id = compiled_exprs_[idx]->output()->Type()->id();
+    if (arrow::is_binary_like(type_id)) {
+      if (group_begin < idx) {
+        ARROW_RETURN_NOT_OK(CodeGenCompiledExprs(group_begin, idx));
+      }
+      ARROW_RETURN_NOT_OK(CodeGenCompiledExprs(idx, idx + 1));
+      group_begin = idx + 1;
+    } else if (idx + 1 - group_begin == kMaxSharedLoopExprs) {
+      ARROW_RETURN_NOT_OK(CodeGenCompiledExprs(group_begin, idx + 1));
+      group_begin = idx + 1;
+    }
+  }
+  if (group_begin < compiled_exprs_.size()) {
+    ARROW_RETURN_NOT_OK(CodeGenCompiledExprs(group_begin, compiled_exprs_.size()));
+  }
+
   // Compile and inject into the process' memory the generated function.
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
 
   // setup the jit functions for each expression.
   for (auto& compiled_expr : compiled_exprs_) {
     auto ir_fn = compiled_expr->GetIRFunction(mode);
+    if (ir_fn == nullptr) {
+      // evaluated in the loop of a preceding expression.
+      continue;
+    }
     auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_fn));
     compiled_expr->SetJITFunction(selection_vector_mode_, jit_fn);
   }
@@ -123,10 +216,33 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
       num_output_rows = selection_vector->GetNumSlots();
     }
 
+    // Var-len results are built by the arena directly in the output data buffer,
+    // reserved from the entry size seen in the previous batch.
+    arrow::ResizableBuffer* varlen_output = nullptr;
+    int64_t varlen_start = 0;
+    const auto& output = compiled_expr->output();
+    if (arrow::is_binary_like(output->Type()->id())) {
+      varlen_output = reinterpret_cast<arrow::ResizableBuffer*>(
+          eval_batch->GetBuffer(output->data_buffer_ptr_idx()));
+      varlen_start = varlen_output->size();
+      ARROW_RETURN_NOT_OK(varlen_output->Reserve(
+          varlen_start + num_output_rows * compiled_expr->varlen_bytes_per_row()));
+      eval_batch->GetExecutionContext()->BeginVarlenOutput(varlen_output);
+    }
+
+    // null for expressions evaluated in the loop of a preceding expression.
     EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
-                 eval_batch->GetLocalBitMapArray(), selection_buffer,
-                 (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
+    if (jit_function != nullptr) {
+      jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+                   eval_batch->GetLocalBitMapArray(), selection_buffer,
+                   (int64_t)eval_batch->GetExecutionContext(), num_output_rows);
+    }
+
+    if (varlen_output != nullptr) {
+      eval_batch->GetExecutionContext()->EndVarlenOutput();
+      compiled_expr->set_varlen_bytes_per_row(
+          arrow::BitUtil::CeilDiv(varlen_output->size() - varlen_start, num_output_rows));
+    }
 
     // check for execution errors
     ARROW_RETURN_IF(
@@ -194,7 +310,7 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
                                       std::to_string(idx) + "_lbmap");
 }
 
-/// \brief Generate code for one expression.
+/// \brief Generate code for one or more expressions, evaluated in a single loop.
 
 // Sample IR code for "c1:int + c2:int"
 //
@@ -247,6 +363,15 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
                                        FieldDescriptorPtr output, int suffix_idx,
                                        llvm::Function** fn,
                                        SelectionVector::Mode selection_vector_mode) {
+  return CodeGenExprValues({{value_expr, output}}, buffer_count, suffix_idx, fn,
+                           selection_vector_mode);
+}
+
+Status LLVMGenerator::CodeGenExprValues(const std::vector<ValueOutput>& values,
+                                        int buffer_count, int suffix_idx,
+                                        llvm::Function** fn,
+                                        SelectionVector::Mode selection_vector_mode) {
+  DCHECK(!values.empty());
   llvm::IRBuilder<>* builder = ir_builder();
   // Create fn prototype :
   //   int expr_1 (long **addrs, long *offsets, long **bitmaps,
@@ -303,14 +428,20 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   llvm::BasicBlock* loop_body = llvm::BasicBlock::Create(*context(), "loop", *fn);
   llvm::BasicBlock* loop_exit = llvm::BasicBlock::Create(*context(), "exit", *fn);
 
-  // Add reference to output vector (in entry block)
+  // Add reference to output vectors (in entry block)
   builder->SetInsertPoint(loop_entry);
-  llvm::Value* output_ref =
-      GetDataReference(arg_addrs, output->data_idx(), output->field());
-  llvm::Value* output_buffer_ptr_ref = GetDataBufferPtrReference(
-      arg_addrs, output->data_buffer_ptr_idx(), output->field());
-  llvm::Value* output_offset_ref =
-      GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field());
+  std::vector<llvm::Value*> output_refs;
+  std::vector<llvm::Value*> output_buffer_ptr_refs;
+  std::vector<llvm::Value*> output_offset_refs;
+  for (auto& value : values) {
+    const FieldDescriptorPtr& output = value.second;
+    output_refs.push_back(
+        GetDataReference(arg_addrs, output->data_idx(), output->field()));
+    output_buffer_ptr_refs.push_back(GetDataBufferPtrReference(
+        arg_addrs, output->data_buffer_ptr_idx(), output->field()));
+    output_offset_refs.push_back(
+        GetOffsetsReference(arg_addrs, output->offsets_idx(), output->field()));
+  }
 
   std::vector<llvm::Value*> slice_offsets;
   for (int idx = 0; idx < buffer_count; idx++) {
@@ -333,11 +464,18 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
         types()->i64_type(), true, "position_var");
   }
 
-  // The visitor can add code to both the entry/loop blocks.
-  Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
-                  arg_context_ptr, position_var);
-  value_expr->Accept(visitor);
-  LValuePtr output_value = visitor.result();
+  // The visitor can add code to both the entry/loop blocks. All the values are
+  // computed before any of them is stored, so that the optimizer can share the
+  // loads and subexpressions the expressions have in common.
+  std::vector<LValuePtr> output_values;
+  bool has_arena_allocs = false;
+  for (auto& value : values) {
+    Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, slice_offsets,
+                    arg_context_ptr, position_var);
+    value.first->Accept(visitor);
+    output_values.push_back(visitor.result());
+    has_arena_allocs |= visitor.has_arena_allocs();
+  }
 
   // The "current" block may have changed due to code generation in the visitor.
   llvm::BasicBlock* loop_body_tail = builder->GetInsertBlock();
@@ -346,30 +484,34 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   builder->SetInsertPoint(loop_entry);
   builder->CreateBr(loop_body);
 
-  // save the value in the output vector.
+  // save the values in the output vectors.
   builder->SetInsertPoint(loop_body_tail);
 
-  auto output_type_id = output->Type()->id();
-  if (output_type_id == arrow::Type::BOOL) {
-    SetPackedBitValue(output_ref, loop_var, output_value->data());
-  } else if (arrow::is_primitive(output_type_id) ||
-             output_type_id == arrow::Type::DECIMAL) {
-    llvm::Value* slot_offset = builder->CreateGEP(output_ref, loop_var);
-    builder->CreateStore(output_value->data(), slot_offset);
-  } else if (arrow::is_binary_like(output_type_id)) {
-    // Var-len output. Make a function call to populate the data.
-    // if there is an error, the fn sets it in the context. And, will be returned at the
-    // end of this row batch.
-    AddFunctionCall("gdv_fn_populate_varlen_vector", types()->i32_type(),
-                    {arg_context_ptr, output_buffer_ptr_ref, output_offset_ref, loop_var,
-                     output_value->data(), output_value->length()});
-  } else {
-    return Status::NotImplemented("output type ", output->Type()->ToString(),
-                                  " not supported");
+  for (size_t i = 0; i < values.size(); ++i) {
+    const FieldDescriptorPtr& output = values[i].second;
+    const LValuePtr& output_value = output_values[i];
+    auto output_type_id = output->Type()->id();
+    if (output_type_id == arrow::Type::BOOL) {
+      SetPackedBitValue(output_refs[i], loop_var, output_value->data());
+    } else if (arrow::is_primitive(output_type_id) ||
+               output_type_id == arrow::Type::DECIMAL) {
+      llvm::Value* slot_offset = builder->CreateGEP(output_refs[i], loop_var);
+      builder->CreateStore(output_value->data(), slot_offset);
+    } else if (arrow::is_binary_like(output_type_id)) {
+      // Var-len output. Make a function call to populate the data.
+      // if there is an error, the fn sets it in the context. And, will be returned at
+      // the end of this row batch.
+      AddFunctionCall("gdv_fn_populate_varlen_vector", types()->i32_type(),
+                      {arg_context_ptr, output_buffer_ptr_refs[i], output_offset_refs[i],
+                       loop_var, output_value->data(), output_value->length()});
+    } else {
+      return Status::NotImplemented("output type ", output->Type()->ToString(),
+                                    " not supported");
+    }
+    ADD_TRACE("saving result " + output->Name() + " value %T", output_value->data());
   }
-  ADD_TRACE("saving result " + output->Name() + " value %T", output_value->data());
 
-  if (visitor.has_arena_allocs()) {
+  if (has_arena_allocs) {
     // Reset allocations to avoid excessive memory usage. Once the result is copied to
     // the output vector (store instruction above), any memory allocations in this
     // iteration of the loop are no longer needed.
@@ -386,7 +528,18 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   llvm::Value* loop_var_check =
       builder->CreateICmpSLT(loop_update, arg_nrecords, "loop_var < nrec");
-  builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+  llvm::BranchInst* loop_latch =
+      builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+
+  // Vectorize a shared loop only if every expression in it can be vectorized.
+  int vector_width = std::numeric_limits<int>::max();
+  for (auto& value : values) {
+    vector_width = std::min(vector_width, VectorizationWidth(*value.first, value.second,
+                                                             selection_vector_mode));
+  }
+  if (vector_width > 1) {
+    AddVectorizeHints(loop_latch, vector_width);
+  }
 
   // Loop exit
   builder->SetInsertPoint(loop_exit);
@@ -394,6 +547,45 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   return Status::OK();
 }
 
+int LLVMGenerator::VectorizationWidth(const Dex& value_expr,
+                                      const FieldDescriptorPtr& output,
+                                      SelectionVector::Mode selection_vector_mode) {
+  // Gathers through a selection vector, packed bit stores and traces (calls to
+  // printf) all keep the loop scalar.
+  if (selection_vector_mode != SelectionVector::MODE_NONE || enable_ir_traces_) {
+    return 1;
+  }
+  const auto& output_type = output->Type();
+  if (output_type->id() == arrow::Type::BOOL || !arrow::is_primitive(output_type->id())) {
+    return 1;
+  }
+  if (!VectorizableChecker().Check(value_expr)) {
+    return 1;
+  }
+  const int bit_width =
+      arrow::internal::checked_cast<const arrow::FixedWidthType&>(*output_type)
+          .bit_width();
+  return engine_->vector_register_bits() / bit_width;
+}
+
+void LLVMGenerator::AddVectorizeHints(llvm::BranchInst* loop_latch, int width) {
+  // Request vectorization with `width` lanes, so that the vector width follows the
+  // output type and the widest registers of the target rather than the cost model.
+  llvm::LLVMContext& ctx = *context();
+  llvm::Metadata* enable[] = {
+      llvm::MDString::get(ctx, "llvm.loop.vectorize.enable"),
+      llvm::ConstantAsMetadata::get(llvm::ConstantInt::getTrue(ctx))};
+  llvm::Metadata* vector_width[] = {
+      llvm::MDString::get(ctx, "llvm.loop.vectorize.width"),
+      llvm::ConstantAsMetadata::get(types()->i32_constant(width))};
+  // The first operand of a loop id is a self reference.
+  llvm::Metadata* loop_id_operands[] = {nullptr, llvm::MDNode::get(ctx, enable),
+                                        llvm::MDNode::get(ctx, vector_width)};
+  llvm::MDNode* loop_id = llvm::MDNode::getDistinct(ctx, loop_id_operands);
+  loop_id->replaceOperandWith(0, loop_id);
+  loop_latch->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
+}
+
 /// Return value of a bit in bitMap.
 llvm::Value* LLVMGenerator::GetPackedBitValue(llvm::Value* bitmap,
                                               llvm::Value* position) {
@@ -677,8 +869,9 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      // Emit the literal as a module constant rather than the address of the holder's
+      // copy, so that the generated code stays position independent.
+      value = generator_->ir_builder()->CreateGlobalStringPtr(str, "str_literal");
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -1005,6 +1198,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->DisableObjectCache();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1046,6 +1240,7 @@ void LLVMGenerator::Visitor::VisitInExpression<gandiva::DecimalScalar128>(
   const InExprDex<gandiva::DecimalScalar128>& dex_instance =
       dynamic_cast<const InExprDex<gandiva::DecimalScalar128>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->DisableObjectCache();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1231,6 +1426,9 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
+    // The holder address is specific to this process.
+    generator_->engine_->DisableObjectCache();
+    generator_->has_function_holders_ = true;
     auto ptr = types->i64_constant((int64_t)holder);
     params.push_back(ptr);
   }
@@ -1376,6 +1574,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
   trace_strings_.push_back(dmsg);
 
   // cast this to an llvm pointer.
+  engine_->DisableObjectCache();
   const char* str = trace_strings_.back().c_str();
   llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/util/macros.h"
@@ -71,6 +72,10 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const ArrayDataVector& output_vector);
 
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
+
+  /// \brief Whether the generated code uses function holders. These may keep state
+  /// from row to row (e.g. random()), so the rows must be evaluated in order.
+  bool has_function_holders() const { return has_function_holders_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
   std::string DumpIR() { return engine_->DumpIR(); }
@@ -193,6 +198,24 @@ class GANDIVA_EXPORT LLVMGenerator {
                           int suffix_idx, llvm::Function** fn,
                           SelectionVector::Mode selection_vector_mode);
 
+  using ValueOutput = std::pair<DexPtr, FieldDescriptorPtr>;
+
+  /// Generate code for the value arrays of several expressions, in a single loop.
+  Status CodeGenExprValues(const std::vector<ValueOutput>& values, int num_buffers,
+                           int suffix_idx, llvm::Function** fn,
+                           SelectionVector::Mode selection_vector_mode);
+
+  /// Generate the code for compiled_exprs_[begin, end) in a single loop.
+  Status CodeGenCompiledExprs(size_t begin, size_t end);
+
+  /// Return the number of lanes the value loop of an expression should be
+  /// vectorized with, or 1 if it should be left scalar.
+  int VectorizationWidth(const Dex& value_expr, const FieldDescriptorPtr& output,
+                         SelectionVector::Mode selection_vector_mode);
+
+  /// Attach loop metadata to 'loop_latch' requesting vectorization with 'width' lanes.
+  void AddVectorizeHints(llvm::BranchInst* loop_latch, int width);
+
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
 
@@ -237,11 +260,16 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// Generate the code to print a trace msg with one optional argument (%T)
   void AddTrace(const std::string& msg, llvm::Value* value = NULLPTR);
 
+  /// Maximum number of expressions evaluated in the same loop, bounding the size of
+  /// the generated functions.
+  static constexpr size_t kMaxSharedLoopExprs = 16;
+
   std::unique_ptr<Engine> engine_;
   std::vector<std::unique_ptr<CompiledExpr>> compiled_exprs_;
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  bool has_function_holders_ = false;
 
   // used for debug
   bool enable_ir_traces_;
@@ -85,6 +85,9 @@ TEST_F(TestLLVMGenerator, TestAdd) {
 
   ASSERT_OK(generator->CodeGenExprValue(func_dex, 4, desc_sum, 0, &ir_func,
                                         SelectionVector::MODE_NONE));
+  // The loop only does arithmetic, it is explicitly marked for vectorization.
+  EXPECT_THAT(generator->engine_->DumpIR(),
+              testing::HasSubstr("llvm.loop.vectorize.width"));
 
   ASSERT_OK(generator->engine_->FinalizeModule());
   auto ir = generator->engine_->DumpIR();
@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_file_cache.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace gandiva {
+
+namespace {
+
+constexpr char kMagic[] = "GDVOBJ01";
+constexpr size_t kMagicSize = sizeof(kMagic) - 1;
+constexpr char kSuffix[] = ".gdvobj";
+
+static const int64_t DEFAULT_OBJECT_CACHE_SIZE = 256LL << 20;
+
+bool HasSuffix(const std::string& s, const char* suffix) {
+  const size_t n = std::strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+int64_t GetObjectCacheCapacity() {
+  int64_t capacity = DEFAULT_OBJECT_CACHE_SIZE;
+  const char* env_cache_size = std::getenv("GANDIVA_OBJECT_CACHE_SIZE");
+  if (env_cache_size != nullptr) {
+    capacity = std::atoll(env_cache_size);
+    if (capacity <= 0) {
+      ARROW_LOG(WARNING) << "Invalid object cache size provided. Using default size: "
+                         << DEFAULT_OBJECT_CACHE_SIZE;
+      capacity = DEFAULT_OBJECT_CACHE_SIZE;
+    }
+  }
+  return capacity;
+}
+
+std::shared_ptr<ObjectFileCache> MakeDefaultCache() {
+  const char* env_cache_dir = std::getenv("GANDIVA_OBJECT_CACHE_DIR");
+  if (env_cache_dir == nullptr || *env_cache_dir == '\0') {
+    return nullptr;
+  }
+  auto capacity = GetObjectCacheCapacity();
+  ARROW_LOG(INFO) << "Creating gandiva object cache in " << env_cache_dir
+                  << " with capacity: " << capacity;
+  return std::make_shared<ObjectFileCache>(env_cache_dir, capacity);
+}
+
+}  // namespace
+
+ObjectFileCache::ObjectFileCache(std::string directory, int64_t capacity)
+    : directory_(std::move(directory)), capacity_(capacity) {
+  if (!directory_.empty() && directory_.back() != '/') {
+    directory_ += '/';
+  }
+  auto dir = arrow::internal::PlatformFilename::FromString(directory_);
+  auto st = dir.ok() ? arrow::internal::CreateDirTree(*dir).status() : dir.status();
+  if (!st.ok()) {
+    ARROW_LOG(WARNING) << "Could not create gandiva object cache directory "
+                       << directory_ << ": " << st.ToString();
+  }
+}
+
+std::string ObjectFileCache::PathForKey(const std::string& key) const {
+  const auto n = static_cast<int64_t>(key.size());
+  std::stringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16)
+     << arrow::internal::ComputeStringHash<0>(key.data(), n) << std::setw(16)
+     << arrow::internal::ComputeStringHash<1>(key.data(), n);
+  return directory_ + ss.str() + kSuffix;
+}
+
+arrow::util::optional<std::string> ObjectFileCache::Get(const std::string& key) {
+  std::ifstream in(PathForKey(key), std::ios::binary);
+  if (!in) {
+    return arrow::util::nullopt;
+  }
+  char magic[kMagicSize];
+  uint64_t key_size = 0;
+  in.read(magic, kMagicSize);
+  in.read(reinterpret_cast<char*>(&key_size), sizeof(key_size));
+  if (!in || std::memcmp(magic, kMagic, kMagicSize) != 0 || key_size != key.size()) {
+    return arrow::util::nullopt;
+  }
+  std::string stored_key(key_size, '\0');
+  in.read(&stored_key[0], key_size);
+  if (!in || stored_key != key) {
+    return arrow::util::nullopt;
+  }
+  std::string object((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+  if (in.bad() || object.empty()) {
+    return arrow::util::nullopt;
+  }
+  return object;
+}
+
+arrow::Status ObjectFileCache::Put(const std::string& key, const std::string& object) {
+  const int64_t entry_size = static_cast<int64_t>(
+      kMagicSize + sizeof(uint64_t) + key.size() + object.size());
+  if (entry_size > capacity_) {
+    return arrow::Status::OK();
+  }
+
+  const auto path = PathForKey(key);
+  // Other processes may be writing the same entry, use a unique temporary name.
+  static std::atomic<uint64_t> counter{0};
+  std::stringstream tmp_path;
+  tmp_path << path << ".tmp." << std::random_device()() << "." << counter++;
+
+  {
+    std::ofstream out(tmp_path.str(), std::ios::binary | std::ios::trunc);
+    const uint64_t key_size = key.size();
+    out.write(kMagic, kMagicSize);
+    out.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    out.write(key.data(), key.size());
+    out.write(object.data(), object.size());
+    out.close();
+    if (!out) {
+      std::remove(tmp_path.str().c_str());
+      return arrow::Status::IOError("Failed to write gandiva object cache entry ",
+                                    tmp_path.str());
+    }
+  }
+  if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.str().c_str());
+    return arrow::Status::IOError("Failed to rename gandiva object cache entry to ",
+                                  path);
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  return Evict(path);
+}
+
+arrow::Status ObjectFileCache::Evict(const std::string& keep_path) {
+  struct Entry {
+    std::string path;
+    int64_t size;
+    int64_t mtime;
+  };
+
+  ARROW_ASSIGN_OR_RAISE(auto dir,
+                        arrow::internal::PlatformFilename::FromString(directory_));
+  ARROW_ASSIGN_OR_RAISE(auto children, arrow::internal::ListDir(dir));
+
+  std::vector<Entry> entries;
+  int64_t total_size = 0;
+  for (const auto& child : children) {
+    auto name = child.ToString();
+    if (!HasSuffix(name, kSuffix)) {
+      continue;
+    }
+    auto path = directory_ + name;
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+      // Concurrently removed
+      continue;
+    }
+    entries.push_back({std::move(path), static_cast<int64_t>(st.st_size),
+                       static_cast<int64_t>(st.st_mtime)});
+    total_size += st.st_size;
+  }
+  if (total_size <= capacity_) {
+    return arrow::Status::OK();
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.mtime < b.mtime; });
+  for (const auto& entry : entries) {
+    if (total_size <= capacity_) {
+      break;
+    }
+    if (entry.path == keep_path) {
+      continue;
+    }
+    std::remove(entry.path.c_str());
+    total_size -= entry.size;
+  }
+  return arrow::Status::OK();
+}
+
+std::shared_ptr<ObjectFileCache> ObjectFileCache::GetDefault() {
+  static std::shared_ptr<ObjectFileCache> cache = MakeDefaultCache();
+  return cache;
+}
+
+}  // namespace gandiva
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/optional.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief On-disk cache of compiled object code, shared across processes.
+///
+/// Entries are stored one per file in a directory, named after a hash of the key.
+/// Each file also records the full key, so that a hash collision reads as a miss.
+/// Files are written to a temporary name and renamed into place, so concurrent
+/// readers and writers (possibly in different processes) never see a partial entry.
+/// When the directory grows beyond the capacity, the least recently written
+/// entries are removed.
+class GANDIVA_EXPORT ObjectFileCache {
+ public:
+  /// \param[in] directory the cache directory, created if it does not exist
+  /// \param[in] capacity the maximum total size in bytes of the cached entries
+  ObjectFileCache(std::string directory, int64_t capacity);
+
+  /// Return the object stored under `key`, if any.
+  arrow::util::optional<std::string> Get(const std::string& key);
+
+  /// Store `object` under `key`, evicting older entries if needed.
+  arrow::Status Put(const std::string& key, const std::string& object);
+
+  const std::string& directory() const { return directory_; }
+  int64_t capacity() const { return capacity_; }
+
+  /// Return the process-wide cache, or nullptr if disabled.
+  ///
+  /// The cache is enabled by setting GANDIVA_OBJECT_CACHE_DIR to a directory.
+  /// GANDIVA_OBJECT_CACHE_SIZE optionally sets its capacity in bytes.
+  static std::shared_ptr<ObjectFileCache> GetDefault();
+
+ private:
+  std::string PathForKey(const std::string& key) const;
+  // Remove the oldest entries until the cache fits, sparing `keep_path`.
+  arrow::Status Evict(const std::string& keep_path);
+
+  std::string directory_;
+  int64_t capacity_;
+  std::mutex mtx_;
+};
+
+}  // namespace gandiva
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "gandiva/object_file_cache.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+class TestObjectFileCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         arrow::internal::TemporaryDir::Make("gandiva-object-cache-"));
+    directory_ = temp_dir_->path().ToString() + "cache";
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  std::string directory_;
+};
+
+TEST_F(TestObjectFileCache, TestPutGet) {
+  ObjectFileCache cache(directory_, 1 << 20);
+  ASSERT_EQ(cache.Get("key1"), arrow::util::nullopt);
+
+  ASSERT_OK(cache.Put("key1", std::string("obj\0ect1", 8)));
+  ASSERT_OK(cache.Put("key2", "object2"));
+  ASSERT_EQ(*cache.Get("key1"), std::string("obj\0ect1", 8));
+  ASSERT_EQ(*cache.Get("key2"), "object2");
+  ASSERT_EQ(cache.Get("key3"), arrow::util::nullopt);
+
+  // Overwrite an existing entry
+  ASSERT_OK(cache.Put("key1", "object3"));
+  ASSERT_EQ(*cache.Get("key1"), "object3");
+
+  // Entries are visible to other instances sharing the directory
+  ObjectFileCache other(directory_, 1 << 20);
+  ASSERT_EQ(*other.Get("key2"), "object2");
+}
+
+TEST_F(TestObjectFileCache, TestEvict) {
+  const std::string object(1000, 'x');
+  ObjectFileCache cache(directory_, 2500);
+  ASSERT_OK(cache.Put("key1", object));
+  ASSERT_OK(cache.Put("key2", object));
+  ASSERT_NE(cache.Get("key1"), arrow::util::nullopt);
+  ASSERT_OK(cache.Put("key3", object));
+
+  // One of the older entries was evicted, the latest one is kept.
+  ASSERT_NE(cache.Get("key3"), arrow::util::nullopt);
+  int num_entries = 0;
+  for (const auto& key : {"key1", "key2", "key3"}) {
+    num_entries += cache.Get(key).has_value();
+  }
+  ASSERT_EQ(num_entries, 2);
+
+  // Entries larger than the capacity are not stored
+  ASSERT_OK(cache.Put("key4", std::string(3000, 'x')));
+  ASSERT_EQ(cache.Get("key4"), arrow::util::nullopt);
+}
+
+}  // namespace gandiva
@@ -17,6 +17,7 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -24,10 +25,13 @@
 
 #include "arrow/util/hash_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/tiered_generator.h"
 
 namespace gandiva {
 
@@ -121,10 +125,23 @@ class ProjectorCacheKey {
   uint32_t uniqifier_;
 };
 
-Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+namespace {
+
+// Rows evaluated by each task with parallel evaluation. Small enough for the inputs
+// and outputs of a task to stay in cache, and a multiple of 64.
+constexpr int64_t kParallelEvaluationRows = 16 * 1024;
+
+Cache<ProjectorCacheKey, std::shared_ptr<Projector>>& ProjectorCache() {
+  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  return cache;
+}
+
+}  // namespace
+
+Projector::Projector(std::shared_ptr<TieredGenerator> generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
-    : llvm_generator_(std::move(llvm_generator)),
+    : generator_(std::move(generator)),
       schema_(schema),
       output_fields_(output_fields),
       configuration_(configuration) {}
@@ -153,28 +170,42 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
+  // see if equivalent projector was already built, or is being built by another
+  // thread, otherwise build it.
   ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
-  std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
-  if (cached_projector != nullptr) {
-    *projector = cached_projector;
-    return Status::OK();
-  }
+  return ProjectorCache().GetOrBuildModule(
+      cache_key,
+      [&](std::shared_ptr<Projector>* built_projector) {
+        return Build(schema, exprs, selection_vector_mode, configuration,
+                     built_projector);
+      },
+      projector);
+}
 
-  // Build LLVM generator, and generate code for the specified expressions
-  std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+CacheStats Projector::GetCacheStats() { return ProjectorCache().stats(); }
 
-  // Run the validation on the expressions.
-  // Return if any of the expression is invalid since
-  // we will not be able to process further.
-  ExprValidator expr_validator(llvm_gen->types(), schema);
-  for (auto& expr : exprs) {
-    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
-  }
+Status Projector::Build(SchemaPtr schema, const ExpressionVector& exprs,
+                        SelectionVector::Mode selection_vector_mode,
+                        std::shared_ptr<Configuration> configuration,
+                        std::shared_ptr<Projector>* projector) {
+  // Build LLVM generator, and generate code for the specified expressions
+  auto build = [schema, exprs, selection_vector_mode](
+                   std::shared_ptr<Configuration> config,
+                   std::unique_ptr<LLVMGenerator>* llvm_gen) -> Status {
+    ARROW_RETURN_NOT_OK(LLVMGenerator::Make(config, llvm_gen));
+
+    // Run the validation on the expressions.
+    // Return if any of the expression is invalid since
+    // we will not be able to process further.
+    ExprValidator expr_validator((*llvm_gen)->types(), schema);
+    for (auto& expr : exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
 
-  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+    return (*llvm_gen)->Build(exprs, selection_vector_mode);
+  };
+  std::shared_ptr<TieredGenerator> generator;
+  ARROW_RETURN_NOT_OK(TieredGenerator::Make(configuration, std::move(build), &generator));
 
   // save the output field types. Used for validation at Evaluate() time.
   std::vector<FieldPtr> output_fields;
@@ -185,9 +216,7 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
-
+      new Projector(std::move(generator), schema, output_fields, configuration));
   return Status::OK();
 }
 
@@ -223,7 +252,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -250,8 +279,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  ARROW_RETURN_NOT_OK(Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
@@ -261,6 +289,54 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+Status Projector::Execute(const arrow::RecordBatch& batch,
+                          const SelectionVector* selection_vector,
+                          const ArrayDataVector& output_data_vecs) {
+  auto generator = generator_->get();
+  const int64_t num_rows = batch.num_rows();
+  // Rows with a selection vector are not contiguous, and function holders may depend
+  // on the order of evaluation (e.g. random()).
+  if (!configuration_->parallel_evaluation() || selection_vector != nullptr ||
+      num_rows < 2 * kParallelEvaluationRows || generator->has_function_holders() ||
+      arrow::GetCpuThreadPoolCapacity() < 2) {
+    return generator->Execute(batch, selection_vector, output_data_vecs);
+  }
+
+  std::vector<int> bit_widths;
+  for (const auto& array_data : output_data_vecs) {
+    auto type_id = array_data->type->id();
+    if (!arrow::is_primitive(type_id) && type_id != arrow::Type::DECIMAL) {
+      // Variable length outputs are built sequentially, they cannot be split.
+      return generator->Execute(batch, selection_vector, output_data_vecs);
+    }
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data->type);
+    bit_widths.push_back(fw_type.bit_width());
+  }
+
+  // Evaluate each range of rows into the matching part of the output buffers. The
+  // generated code writes the outputs from their first row, so each range gets
+  // outputs made of buffer slices. Ranges start at a multiple of 64 rows, so that
+  // bitmaps of different ranges never share a word.
+  const int num_tasks = static_cast<int>(
+      arrow::BitUtil::CeilDiv(num_rows, kParallelEvaluationRows));
+  return arrow::internal::ParallelFor(num_tasks, [&](int task) {
+    const int64_t offset = task * kParallelEvaluationRows;
+    const int64_t length = std::min(kParallelEvaluationRows, num_rows - offset);
+    ArrayDataVector range_data_vecs;
+    for (size_t i = 0; i < output_data_vecs.size(); ++i) {
+      const auto& array_data = *output_data_vecs[i];
+      auto validity = arrow::SliceBuffer(array_data.buffers[0], offset / 8,
+                                         arrow::BitUtil::BytesForBits(length));
+      auto data = arrow::SliceBuffer(
+          array_data.buffers[1], offset * bit_widths[i] / 8,
+          arrow::BitUtil::BytesForBits(length * bit_widths[i]));
+      range_data_vecs.push_back(
+          arrow::ArrayData::Make(array_data.type, length, {validity, data}));
+    }
+    return generator->Execute(*batch.Slice(offset, length), nullptr, range_data_vecs);
+  });
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -357,6 +433,8 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-std::string Projector::DumpIR() { return llvm_generator_->DumpIR(); }
+arrow::Future<> Projector::OptimizedCodeReady() const { return generator_->optimized(); }
+
+std::string Projector::DumpIR() { return generator_->get()->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,8 +23,10 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
 #include "gandiva/selection_vector.h"
@@ -32,7 +34,7 @@
 
 namespace gandiva {
 
-class LLVMGenerator;
+class TieredGenerator;
 
 /// \brief projection using expressions.
 ///
@@ -117,12 +119,33 @@ class GANDIVA_EXPORT Projector {
   Status Evaluate(const arrow::RecordBatch& batch,
                   const SelectionVector* selection_vector, const ArrayDataVector& output);
 
+  /// Return a future that completes once optimized code is used for evaluation.
+  ///
+  /// With tiered compilation (see Configuration::set_tiered_compilation), Make()
+  /// returns as soon as unoptimized code is built. Otherwise the future is already
+  /// finished.
+  arrow::Future<> OptimizedCodeReady() const;
+
   std::string DumpIR();
 
+  /// Return the statistics of the process-wide cache of built projectors.
+  static CacheStats GetCacheStats();
+
  private:
-  Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+  Projector(std::shared_ptr<TieredGenerator> generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
+  /// Build a projector, bypassing the cache.
+  static Status Build(SchemaPtr schema, const ExpressionVector& exprs,
+                      SelectionVector::Mode selection_vector_mode,
+                      std::shared_ptr<Configuration> configuration,
+                      std::shared_ptr<Projector>* projector);
+
+  /// Execute the generated code, splitting large batches across the CPU thread pool
+  /// if parallel evaluation is enabled.
+  Status Execute(const arrow::RecordBatch& batch, const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_data_vecs);
+
   /// Allocate an ArrowData of length 'length'.
   Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
                         arrow::MemoryPool* pool, ArrayDataPtr* array_data);
@@ -134,7 +157,7 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  std::shared_ptr<TieredGenerator> generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
@@ -37,6 +37,10 @@ namespace gandiva {
 /// The allocated memory gets released only when the arena is destroyed, or on
 /// Reset.
 ///
+/// A window of externally owned memory can also be set, allocations are then served
+/// from the window first (e.g. the unused capacity of an output buffer, so that a
+/// result built in the arena is already in place).
+///
 /// This code is not multi-thread safe, and avoids all locking for efficiency.
 ///
 class SimpleArena {
@@ -51,6 +55,16 @@ class SimpleArena {
   // Reset arena state.
   void Reset();
 
+  // Serve allocations from [begin, end) before using the chunks, until cleared.
+  void SetWindow(uint8_t* begin, uint8_t* end);
+
+  void ClearWindow() { SetWindow(NULLPTR, NULLPTR); }
+
+  // Whether ptr was allocated from the current window.
+  bool InWindow(const uint8_t* ptr) const {
+    return ptr >= window_begin_ && ptr < window_avail_;
+  }
+
   // total bytes allocated from system.
   int64_t total_bytes() { return total_bytes_; }
 
@@ -88,6 +102,11 @@ class SimpleArena {
 
   // List of allocated chunks.
   std::vector<Chunk> chunks_;
+
+  // Externally owned window, window_avail_ is the next free byte in it.
+  uint8_t* window_begin_ = NULLPTR;
+  uint8_t* window_avail_ = NULLPTR;
+  uint8_t* window_end_ = NULLPTR;
 };
 
 inline SimpleArena::SimpleArena(arrow::MemoryPool* pool, int64_t min_chunk_size)
@@ -100,6 +119,11 @@ inline SimpleArena::SimpleArena(arrow::MemoryPool* pool, int64_t min_chunk_size)
 inline SimpleArena::~SimpleArena() { ReleaseChunks(false /*retain_first*/); }
 
 inline uint8_t* SimpleArena::Allocate(int64_t size) {
+  if (window_avail_ != NULLPTR && window_end_ - window_avail_ >= size) {
+    uint8_t* ret = window_avail_;
+    window_avail_ += size;
+    return ret;
+  }
   if (avail_bytes_ < size) {
     auto status = AllocateChunk(std::max(size, min_chunk_size_));
     if (!status.ok()) {
@@ -131,6 +155,7 @@ inline arrow::Status SimpleArena::AllocateChunk(int64_t size) {
 // By retaining the first chunk, the number of malloc calls are reduced to one per batch,
 // instead of one per record.
 inline void SimpleArena::Reset() {
+  window_avail_ = window_begin_;
   if (chunks_.size() == 0) {
     // if there are no chunks, nothing to do.
     return;
@@ -146,6 +171,11 @@ inline void SimpleArena::Reset() {
   avail_bytes_ = total_bytes_ = chunks_.at(0).size_;
 }
 
+inline void SimpleArena::SetWindow(uint8_t* begin, uint8_t* end) {
+  window_begin_ = window_avail_ = begin;
+  window_end_ = end;
+}
+
 inline void SimpleArena::ReleaseChunks(bool retain_first) {
   for (auto& chunk : chunks_) {
     if (retain_first) {
@@ -99,4 +99,35 @@ TEST_F(TestSimpleArena, TestReset2) {
   EXPECT_EQ(arena.avail_bytes(), large_size - small_size);
 }
 
+// allocations from an external window, then fallback to chunks
+TEST_F(TestSimpleArena, TestWindow) {
+  int64_t chunk_size = 4096;
+  SimpleArena arena(arrow::default_memory_pool(), chunk_size);
+
+  uint8_t window[256];
+  arena.SetWindow(window, window + sizeof(window));
+
+  auto p = arena.Allocate(100);
+  EXPECT_EQ(p, window);
+  EXPECT_TRUE(arena.InWindow(p));
+  p = arena.Allocate(100);
+  EXPECT_EQ(p, window + 100);
+  EXPECT_EQ(arena.total_bytes(), 0);
+
+  // does not fit in the rest of the window.
+  p = arena.Allocate(100);
+  EXPECT_NE(p, nullptr);
+  EXPECT_FALSE(arena.InWindow(p));
+  EXPECT_EQ(arena.total_bytes(), chunk_size);
+
+  // should re-use the window after reset.
+  arena.Reset();
+  EXPECT_EQ(arena.Allocate(10), window);
+
+  arena.ClearWindow();
+  p = arena.Allocate(10);
+  EXPECT_FALSE(arena.InWindow(p));
+  EXPECT_EQ(arena.avail_bytes(), chunk_size - 10);
+}
+
 }  // namespace gandiva
@@ -123,6 +123,94 @@ TEST_F(TestFilter, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestBitMapOutput) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 < 10
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_10 = TreeExprBuilder::MakeLiteral((int32_t)10);
+  auto less_than_10 = TreeExprBuilder::MakeFunction("less_than", {node_f0, literal_10},
+                                                    arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_10);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, TestConfiguration(), &filter));
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 20, 3, 4, 6}, {true, true, true, false, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  // Null conditions do not match.
+  std::shared_ptr<arrow::BooleanArray> bitmap;
+  ASSERT_OK(filter->Evaluate(*in_batch, pool_, &bitmap));
+  EXPECT_EQ(bitmap->null_count(), 0);
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayBool({true, false, true, false, true}),
+                            bitmap);
+
+  // 3 matches out of 5 rows, the bitmap is smaller than the indices.
+  std::shared_ptr<arrow::Array> adaptive;
+  ASSERT_OK(filter->EvaluateAdaptive(*in_batch, pool_, &adaptive));
+  EXPECT_ARROW_ARRAY_EQUALS(bitmap, adaptive);
+
+  // 2 matches out of 100 rows, the indices are smaller than the bitmap.
+  std::vector<int32_t> values(100, 50);
+  values[7] = 1;
+  values[93] = 2;
+  auto array1 = MakeArrowArrayInt32(values, std::vector<bool>(100, true));
+  in_batch = arrow::RecordBatch::Make(schema, 100, {array1});
+  ASSERT_OK(filter->EvaluateAdaptive(*in_batch, pool_, &adaptive));
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({7, 93}), adaptive);
+}
+
+TEST_F(TestFilter, TestTieredCompilation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 + f1 < 10
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto sum_func =
+      TreeExprBuilder::MakeFunction("add", {node_f0, node_f1}, arrow::int32());
+  auto literal_10 = TreeExprBuilder::MakeLiteral((int32_t)10);
+  auto less_than_10 = TreeExprBuilder::MakeFunction("less_than", {sum_func, literal_10},
+                                                    arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than_10);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_tiered_compilation(true);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, configuration, &filter);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4, 6}, {true, true, true, false, true});
+  auto array1 = MakeArrowArrayInt32({5, 9, 6, 17, 3}, {true, true, false, true, true});
+  // expected output (indices for which condition matches)
+  auto exp = MakeArrowArrayUint16({0, 4});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  ASSERT_OK(status);
+
+  // Evaluate with whichever code is available, then with the optimized code.
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+  ASSERT_OK(filter->OptimizedCodeReady().status());
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+}
+
 TEST_F(TestFilter, TestSimpleCustomConfig) {
   // schema for input fields
   auto field0 = field("f0", int32());
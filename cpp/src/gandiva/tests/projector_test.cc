@@ -254,6 +254,170 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestSharedLoop) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", arrow::utf8());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // output fields
+  auto field_plus = field("plus", int32());
+  auto field_upper = field("upper", arrow::utf8());
+  auto field_minus = field("minus", int32());
+  auto field_gt = field("gt", boolean());
+
+  // Build expressions sharing f0 * f1, with a var-len output in between.
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+  auto product = TreeExprBuilder::MakeFunction("multiply", {node0, node1}, int32());
+  auto one = TreeExprBuilder::MakeLiteral(1);
+  auto plus_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("add", {product, one}, int32()), field_plus);
+  auto upper_expr = TreeExprBuilder::MakeExpression("upper", {field2}, field_upper);
+  auto minus_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("subtract", {product, one}, int32()), field_minus);
+  auto gt_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction(
+          "greater_than", {product, TreeExprBuilder::MakeLiteral(10)}, boolean()),
+      field_gt);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {plus_expr, upper_expr, minus_expr, gt_expr},
+                            TestConfiguration(), &projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({5, 6, 7, 8}, {true, true, false, true});
+  auto array2 = MakeArrowArrayUtf8({"a", "bc", "", "d"}, {true, true, true, true});
+  // expected output
+  auto exp_plus = MakeArrowArrayInt32({6, 13, 0, 0}, {true, true, false, false});
+  auto exp_upper = MakeArrowArrayUtf8({"A", "BC", "", "D"}, {true, true, true, true});
+  auto exp_minus = MakeArrowArrayInt32({4, 11, 0, 0}, {true, true, false, false});
+  auto exp_gt =
+      MakeArrowArrayBool({false, true, false, false}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch =
+      arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_plus, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_minus, outputs.at(2));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_gt, outputs.at(3));
+}
+
+TEST_F(TestProjector, TestTieredCompilation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_tiered_compilation(true);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, configuration, &projector);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate with whichever code is available, then with the optimized code.
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  ASSERT_OK(projector->OptimizedCodeReady().status());
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  // Without tiered compilation, the optimized code is ready on return.
+  std::shared_ptr<Projector> non_tiered_projector;
+  status =
+      Projector::Make(schema, {sum_expr}, TestConfiguration(), &non_tiered_projector);
+  ASSERT_OK(status);
+  EXPECT_NE(non_tiered_projector, projector);
+  EXPECT_TRUE(non_tiered_projector->OptimizedCodeReady().is_finished());
+}
+
+TEST_F(TestProjector, TestParallelEvaluation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_less = field("less_than", boolean());
+
+  // Build expressions
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto less_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_less);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_parallel_evaluation(true);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr, less_expr}, configuration, &projector);
+  ASSERT_OK(status);
+
+  // Large enough to be split, with a partial last range.
+  int num_records = 100003;
+  std::vector<int32_t> values0(num_records), values1(num_records);
+  std::vector<int32_t> sums(num_records);
+  std::vector<bool> validity0(num_records), validity1(num_records);
+  std::vector<bool> less(num_records), out_validity(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values0[i] = i;
+    values1[i] = (i * 7) % 1000;
+    validity0[i] = i % 5 != 0;
+    validity1[i] = i % 7 != 0;
+    sums[i] = values0[i] + values1[i];
+    less[i] = values0[i] < values1[i];
+    out_validity[i] = validity0[i] && validity1[i];
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, validity1);
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32(sums, out_validity);
+  auto exp_less = MakeArrowArrayBool(less, out_validity);
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_less, outputs.at(1));
+
+  auto sliced_batch = in_batch->Slice(3, num_records - 3);
+  ASSERT_OK(projector->Evaluate(*sliced_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum->Slice(3), outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_less->Slice(3), outputs.at(1));
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
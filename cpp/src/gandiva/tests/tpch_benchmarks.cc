@@ -0,0 +1,359 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compile and evaluation costs of TPC-H Q1 and Q6 style filters and projections
+// over lineitem-like batches, to compare against the arrow::compute kernels.
+//
+// Prices are float64 rather than decimal, and dates are int32 days since the epoch.
+// Evaluation benchmarks take (batch size, null percentage) as arguments and report
+// the peak memory allocated during evaluation.
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/config.h"
+#include "benchmark/benchmark.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+#ifdef ARROW_COMPUTE
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#endif
+
+namespace gandiva {
+
+using arrow::float64;
+using arrow::int32;
+
+namespace {
+
+constexpr int64_t kRowsPerIteration = 1 << 20;
+
+// 1992-01-01 to 1998-12-01, the range of l_shipdate in dbgen
+constexpr int32_t kMinShipDate = 8035;
+constexpr int32_t kMaxShipDate = 10561;
+// Q1: l_shipdate <= date '1998-12-01' - interval '90' day
+constexpr int32_t kQ1ShipDate = 10471;
+// Q6: l_shipdate >= date '1994-01-01' and l_shipdate < date '1995-01-01'
+constexpr int32_t kQ6ShipDateStart = 8766;
+constexpr int32_t kQ6ShipDateEnd = 9131;
+
+SchemaPtr LineitemSchema() {
+  return arrow::schema({field("l_quantity", float64()),
+                        field("l_extendedprice", float64()),
+                        field("l_discount", float64()), field("l_tax", float64()),
+                        field("l_shipdate", int32())});
+}
+
+std::vector<std::shared_ptr<arrow::RecordBatch>> MakeLineitemBatches(
+    int64_t batch_size, double null_probability) {
+  arrow::random::RandomArrayGenerator rag(0x7c9);
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  for (int64_t i = 0; i < kRowsPerIteration; i += batch_size) {
+    batches.push_back(arrow::RecordBatch::Make(
+        LineitemSchema(), batch_size,
+        {rag.Float64(batch_size, 1, 50, null_probability),
+         rag.Float64(batch_size, 900, 105000, null_probability),
+         rag.Float64(batch_size, 0, 0.1, null_probability),
+         rag.Float64(batch_size, 0, 0.08, null_probability),
+         rag.Int32(batch_size, kMinShipDate, kMaxShipDate, null_probability)}));
+  }
+  return batches;
+}
+
+NodePtr Column(const char* name) {
+  return TreeExprBuilder::MakeField(LineitemSchema()->GetFieldByName(name));
+}
+
+NodePtr Call(const char* function, NodeVector args, DataTypePtr type) {
+  return TreeExprBuilder::MakeFunction(function, std::move(args), std::move(type));
+}
+
+// The salt perturbs a literal so that each value gives a distinct cache key, salt 0
+// is the actual query.
+
+// sum_disc_price and sum_charge of Q1
+ExpressionVector Q1Projection(int salt) {
+  auto one = TreeExprBuilder::MakeLiteral(1.0 + salt * 1e-12);
+  auto disc_price =
+      Call("multiply",
+           {Column("l_extendedprice"), Call("subtract", {one, Column("l_discount")},
+                                            float64())},
+           float64());
+  auto charge = Call(
+      "multiply", {disc_price, Call("add", {one, Column("l_tax")}, float64())},
+      float64());
+  return {TreeExprBuilder::MakeExpression(disc_price, field("disc_price", float64())),
+          TreeExprBuilder::MakeExpression(charge, field("charge", float64()))};
+}
+
+ConditionPtr Q1Filter(int salt) {
+  return TreeExprBuilder::MakeCondition(
+      Call("less_than_or_equal_to",
+           {Column("l_shipdate"), TreeExprBuilder::MakeLiteral(kQ1ShipDate + salt)},
+           arrow::boolean()));
+}
+
+// revenue of Q6
+ExpressionVector Q6Projection(int salt) {
+  auto discount = Column("l_discount");
+  if (salt != 0) {
+    discount = Call("add", {discount, TreeExprBuilder::MakeLiteral(salt * 1e-12)},
+                    float64());
+  }
+  auto revenue = Call("multiply", {Column("l_extendedprice"), discount}, float64());
+  return {TreeExprBuilder::MakeExpression(revenue, field("revenue", float64()))};
+}
+
+ConditionPtr Q6Filter(int salt) {
+  auto boolean = arrow::boolean();
+  return TreeExprBuilder::MakeCondition(TreeExprBuilder::MakeAnd(
+      {Call("greater_than_or_equal_to",
+            {Column("l_shipdate"), TreeExprBuilder::MakeLiteral(kQ6ShipDateStart + salt)},
+            boolean),
+       Call("less_than",
+            {Column("l_shipdate"), TreeExprBuilder::MakeLiteral(kQ6ShipDateEnd)},
+            boolean),
+       Call("greater_than_or_equal_to",
+            {Column("l_discount"), TreeExprBuilder::MakeLiteral(0.05)}, boolean),
+       Call("less_than_or_equal_to",
+            {Column("l_discount"), TreeExprBuilder::MakeLiteral(0.07)}, boolean),
+       Call("less_than", {Column("l_quantity"), TreeExprBuilder::MakeLiteral(24.0)},
+            boolean)}));
+}
+
+// Salts handed out to cold compiles, never reused within the process so that every
+// iteration misses the cache.
+int NextColdSalt() {
+  static std::atomic<int> salt{1};
+  return salt++;
+}
+
+void SetEvaluateArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"batch_size", "null_percent"})
+      ->ArgsProduct({{1024, 16 * 1024, 64 * 1024}, {0, 1, 50}})
+      ->Unit(benchmark::kMicrosecond);
+}
+
+void SetEvaluateCounters(benchmark::State& state, const arrow::ProxyMemoryPool& pool) {
+  state.SetItemsProcessed(state.iterations() * kRowsPerIteration);
+  state.counters["peak_bytes"] = static_cast<double>(pool.max_memory());
+}
+
+}  // namespace
+
+static void CompileProjectorCold(benchmark::State& state,
+                                 ExpressionVector (*make_exprs)(int)) {
+  auto schema = LineitemSchema();
+  for (auto _ : state) {
+    std::shared_ptr<Projector> projector;
+    ASSERT_OK(Projector::Make(schema, make_exprs(NextColdSalt()), TestConfiguration(),
+                              &projector));
+  }
+}
+
+static void CompileProjectorCached(benchmark::State& state,
+                                   ExpressionVector (*make_exprs)(int)) {
+  auto schema = LineitemSchema();
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, make_exprs(0), TestConfiguration(), &projector));
+  for (auto _ : state) {
+    ASSERT_OK(Projector::Make(schema, make_exprs(0), TestConfiguration(), &projector));
+  }
+}
+
+static void CompileFilterCold(benchmark::State& state,
+                              ConditionPtr (*make_condition)(int)) {
+  auto schema = LineitemSchema();
+  for (auto _ : state) {
+    std::shared_ptr<Filter> filter;
+    ASSERT_OK(Filter::Make(schema, make_condition(NextColdSalt()), TestConfiguration(),
+                           &filter));
+  }
+}
+
+static void CompileFilterCached(benchmark::State& state,
+                                ConditionPtr (*make_condition)(int)) {
+  auto schema = LineitemSchema();
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, make_condition(0), TestConfiguration(), &filter));
+  for (auto _ : state) {
+    ASSERT_OK(Filter::Make(schema, make_condition(0), TestConfiguration(), &filter));
+  }
+}
+
+static void EvaluateProjector(benchmark::State& state,
+                              ExpressionVector (*make_exprs)(int)) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(LineitemSchema(), make_exprs(0), TestConfiguration(),
+                            &projector));
+
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      arrow::ArrayVector outputs;
+      ASSERT_OK(projector->Evaluate(*batch, &pool, &outputs));
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+static void EvaluateFilter(benchmark::State& state,
+                           ConditionPtr (*make_condition)(int)) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(
+      Filter::Make(LineitemSchema(), make_condition(0), TestConfiguration(), &filter));
+
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::MakeInt32(state.range(0), &pool, &selection));
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      ASSERT_OK(filter->Evaluate(*batch, selection));
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+BENCHMARK_CAPTURE(CompileProjectorCold, Q1, &Q1Projection)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CompileProjectorCold, Q6, &Q6Projection)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CompileFilterCold, Q1, &Q1Filter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CompileFilterCold, Q6, &Q6Filter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CompileProjectorCached, Q1, &Q1Projection)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(CompileProjectorCached, Q6, &Q6Projection)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(CompileFilterCached, Q1, &Q1Filter)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(CompileFilterCached, Q6, &Q6Filter)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(EvaluateProjector, Q1, &Q1Projection)->Apply(SetEvaluateArgs);
+BENCHMARK_CAPTURE(EvaluateProjector, Q6, &Q6Projection)->Apply(SetEvaluateArgs);
+BENCHMARK_CAPTURE(EvaluateFilter, Q1, &Q1Filter)->Apply(SetEvaluateArgs);
+BENCHMARK_CAPTURE(EvaluateFilter, Q6, &Q6Filter)->Apply(SetEvaluateArgs);
+
+#ifdef ARROW_COMPUTE
+
+// The same expressions evaluated by the compute kernels, one kernel call per node.
+
+namespace cp = arrow::compute;
+
+static void ComputeQ1Projection(benchmark::State& state) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  cp::ExecContext ctx(&pool);
+  arrow::Datum one(1.0);
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      ASSERT_OK_AND_ASSIGN(auto one_minus_discount,
+                           cp::Subtract(one, batch->GetColumnByName("l_discount"),
+                                        cp::ArithmeticOptions(), &ctx));
+      ASSERT_OK_AND_ASSIGN(
+          auto disc_price,
+          cp::Multiply(batch->GetColumnByName("l_extendedprice"), one_minus_discount,
+                       cp::ArithmeticOptions(), &ctx));
+      ASSERT_OK_AND_ASSIGN(auto one_plus_tax,
+                           cp::Add(one, batch->GetColumnByName("l_tax"),
+                                   cp::ArithmeticOptions(), &ctx));
+      ASSERT_OK_AND_ASSIGN(auto charge, cp::Multiply(disc_price, one_plus_tax,
+                                                     cp::ArithmeticOptions(), &ctx));
+      benchmark::DoNotOptimize(charge);
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+static void ComputeQ6Projection(benchmark::State& state) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  cp::ExecContext ctx(&pool);
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      ASSERT_OK_AND_ASSIGN(auto revenue,
+                           cp::Multiply(batch->GetColumnByName("l_extendedprice"),
+                                        batch->GetColumnByName("l_discount"),
+                                        cp::ArithmeticOptions(), &ctx));
+      benchmark::DoNotOptimize(revenue);
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+static void ComputeQ1Filter(benchmark::State& state) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  cp::ExecContext ctx(&pool);
+  arrow::Datum ship_date(kQ1ShipDate);
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      ASSERT_OK_AND_ASSIGN(
+          auto mask, cp::CallFunction("less_equal",
+                                      {batch->GetColumnByName("l_shipdate"), ship_date},
+                                      &ctx));
+      benchmark::DoNotOptimize(mask);
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+static void ComputeQ6Filter(benchmark::State& state) {
+  auto batches = MakeLineitemBatches(state.range(0), state.range(1) / 100.0);
+  arrow::ProxyMemoryPool pool(arrow::default_memory_pool());
+  cp::ExecContext ctx(&pool);
+  arrow::Datum start(kQ6ShipDateStart), end(kQ6ShipDateEnd), min_discount(0.05),
+      max_discount(0.07), max_quantity(24.0);
+  for (auto _ : state) {
+    for (const auto& batch : batches) {
+      auto ship_date = batch->GetColumnByName("l_shipdate");
+      auto discount = batch->GetColumnByName("l_discount");
+      ASSERT_OK_AND_ASSIGN(auto mask,
+                           cp::CallFunction("greater_equal", {ship_date, start}, &ctx));
+      ASSERT_OK_AND_ASSIGN(auto term, cp::CallFunction("less", {ship_date, end}, &ctx));
+      ASSERT_OK_AND_ASSIGN(mask, cp::KleeneAnd(mask, term, &ctx));
+      ASSERT_OK_AND_ASSIGN(
+          term, cp::CallFunction("greater_equal", {discount, min_discount}, &ctx));
+      ASSERT_OK_AND_ASSIGN(mask, cp::KleeneAnd(mask, term, &ctx));
+      ASSERT_OK_AND_ASSIGN(
+          term, cp::CallFunction("less_equal", {discount, max_discount}, &ctx));
+      ASSERT_OK_AND_ASSIGN(mask, cp::KleeneAnd(mask, term, &ctx));
+      ASSERT_OK_AND_ASSIGN(
+          term, cp::CallFunction(
+                    "less", {batch->GetColumnByName("l_quantity"), max_quantity}, &ctx));
+      ASSERT_OK_AND_ASSIGN(mask, cp::KleeneAnd(mask, term, &ctx));
+      benchmark::DoNotOptimize(mask);
+    }
+  }
+  SetEvaluateCounters(state, pool);
+}
+
+BENCHMARK(ComputeQ1Projection)->Apply(SetEvaluateArgs);
+BENCHMARK(ComputeQ6Projection)->Apply(SetEvaluateArgs);
+BENCHMARK(ComputeQ1Filter)->Apply(SetEvaluateArgs);
+BENCHMARK(ComputeQ6Filter)->Apply(SetEvaluateArgs);
+
+#endif  // ARROW_COMPUTE
+
+}  // namespace gandiva
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/tiered_generator.h"
+
+#include <utility>
+
+#include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+#include "gandiva/llvm_generator.h"
+
+namespace gandiva {
+
+TieredGenerator::TieredGenerator(std::unique_ptr<LLVMGenerator> generator)
+    : generator_(std::move(generator)), optimized_(arrow::Future<>::MakeFinished()) {}
+
+TieredGenerator::~TieredGenerator() {}
+
+Status TieredGenerator::Make(std::shared_ptr<Configuration> configuration,
+                             BuildFunc build,
+                             std::shared_ptr<TieredGenerator>* tiered_generator) {
+  std::unique_ptr<LLVMGenerator> generator;
+  if (!configuration->tiered_compilation() || !configuration->optimize()) {
+    ARROW_RETURN_NOT_OK(build(configuration, &generator));
+    *tiered_generator = std::make_shared<TieredGenerator>(std::move(generator));
+    return Status::OK();
+  }
+
+  // First tier: skip the optimizer and use the fastest code generation.
+  auto unoptimized_configuration = std::make_shared<Configuration>(*configuration);
+  unoptimized_configuration->set_optimize(false);
+  ARROW_RETURN_NOT_OK(build(unoptimized_configuration, &generator));
+  auto tiered = std::make_shared<TieredGenerator>(std::move(generator));
+
+  // Second tier: build the optimized code in the background. Only a weak reference
+  // is kept, so that the owner may be destroyed before it finishes.
+  auto optimized = arrow::Future<>::Make();
+  tiered->optimized_ = optimized;
+  std::weak_ptr<TieredGenerator> weak_tiered = tiered;
+  auto status = arrow::internal::GetCpuThreadPool()->Spawn(
+      [weak_tiered, configuration, build, optimized]() mutable {
+        std::unique_ptr<LLVMGenerator> optimized_generator;
+        auto status = build(configuration, &optimized_generator);
+        if (status.ok()) {
+          if (auto tiered = weak_tiered.lock()) {
+            arrow::internal::atomic_store(
+                &tiered->generator_,
+                std::shared_ptr<LLVMGenerator>(std::move(optimized_generator)));
+          }
+        } else {
+          ARROW_LOG(WARNING) << "Building optimized code failed, keeping unoptimized "
+                             << "code: " << status.ToString();
+        }
+        optimized.MarkFinished(std::move(status));
+      });
+  if (!status.ok()) {
+    optimized.MarkFinished(std::move(status));
+  }
+
+  *tiered_generator = std::move(tiered);
+  return Status::OK();
+}
+
+std::shared_ptr<LLVMGenerator> TieredGenerator::get() const {
+  return arrow::internal::atomic_load(&generator_);
+}
+
+}  // namespace gandiva
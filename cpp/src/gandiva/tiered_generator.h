@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "arrow/util/future.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/configuration.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief Holds the generated code used by a Projector or Filter.
+///
+/// With tiered compilation, the code is first built without optimizations, which
+/// is much faster, and the optimized code is built on the CPU thread pool. It is
+/// swapped in once ready; evaluations already running keep the code they started
+/// with.
+class GANDIVA_EXPORT TieredGenerator {
+ public:
+  /// Build the expressions into `generator` with the given configuration.
+  using BuildFunc = std::function<Status(std::shared_ptr<Configuration>,
+                                         std::unique_ptr<LLVMGenerator>*)>;
+
+  explicit TieredGenerator(std::unique_ptr<LLVMGenerator> generator);
+
+  ~TieredGenerator();
+
+  /// Build the generated code, tiered if the configuration asks for it.
+  static Status Make(std::shared_ptr<Configuration> configuration, BuildFunc build,
+                     std::shared_ptr<TieredGenerator>* tiered_generator);
+
+  /// Return the best generated code available.
+  std::shared_ptr<LLVMGenerator> get() const;
+
+  /// Return a future that completes once the optimized code is in use.
+  ///
+  /// It completes with an error if the optimized code failed to build, in which
+  /// case the unoptimized code remains in use.
+  arrow::Future<> optimized() const { return optimized_; }
+
+ private:
+  std::shared_ptr<LLVMGenerator> generator_;
+  arrow::Future<> optimized_;
+};
+
+}  // namespace gandiva
@@ -39,6 +39,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
@@ -48,6 +49,7 @@
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
@@ -2124,6 +2126,131 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 3, &table));
+
+  auto arrow_writer_properties = ArrowWriterProperties::Builder()
+                                     .set_use_threads(true)
+                                     ->store_schema()
+                                     ->build();
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, /*row_group_size=*/300, &result,
+                                      default_writer_properties(),
+                                      arrow_writer_properties));
+  ASSERT_OK(result->ValidateFull());
+  ::arrow::AssertTablesEqual(*table, *result, false);
+
+  // The row groups are serialized in order, as with a serial write
+  auto serial_sink = CreateOutputStream();
+  auto threaded_sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), serial_sink, 300));
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), threaded_sink, 300,
+                                default_writer_properties(),
+                                ArrowWriterProperties::Builder()
+                                    .set_use_threads(true)
+                                    ->build()));
+  ASSERT_OK_AND_ASSIGN(auto serial_buffer, serial_sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto threaded_buffer, threaded_sink->Finish());
+  ASSERT_TRUE(serial_buffer->Equals(*threaded_buffer));
+}
+
+void WriteRecordBatches(const Table& table, int64_t batch_size,
+                        const std::shared_ptr<WriterProperties>& properties,
+                        std::shared_ptr<Buffer>* out) {
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table.schema(), default_memory_pool(), sink,
+                                      properties, &writer));
+  ::arrow::TableBatchReader batch_reader(table);
+  batch_reader.set_chunksize(batch_size);
+  ::arrow::RecordBatchVector batches;
+  ASSERT_OK(batch_reader.ReadAll(&batches));
+  for (const auto& batch : batches) {
+    ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(*out, sink->Finish());
+}
+
+void CheckRowGroupSizes(const std::shared_ptr<Buffer>& buffer, const Table& expected,
+                        const std::vector<int64_t>& row_group_sizes) {
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto metadata = reader->parquet_reader()->metadata();
+  ASSERT_EQ(static_cast<int>(row_group_sizes.size()), metadata->num_row_groups());
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    ASSERT_EQ(row_group_sizes[i], metadata->RowGroup(i)->num_rows());
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ::arrow::AssertTablesEqual(expected, *result, false);
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatch) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(5, 1000, 1, &table));
+
+  // Batches are split to respect the row group length
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteRecordBatches(
+      *table, 100, WriterProperties::Builder().max_row_group_length(250)->build(),
+      &buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRowGroupSizes(buffer, *table, {250, 250, 250, 250}));
+
+  // A row group is cut after the batch that makes it reach the byte size target
+  // (plain-encoded, each batch holds 5 * 100 doubles)
+  ASSERT_NO_FATAL_FAILURE(WriteRecordBatches(
+      *table, 100,
+      WriterProperties::Builder()
+          .disable_dictionary()
+          ->max_row_group_length(250)
+          ->max_row_group_bytes(5 * 150 * sizeof(double))
+          ->build(),
+      &buffer));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckRowGroupSizes(buffer, *table, {200, 200, 200, 200, 200}));
+
+  ASSERT_NO_FATAL_FAILURE(WriteRecordBatches(
+      *table, 100, WriterProperties::Builder().max_row_group_bytes(1)->build(),
+      &buffer));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckRowGroupSizes(buffer, *table, std::vector<int64_t>(10, 100)));
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchNewBufferedRowGroup) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(3, 300, 1, &table));
+  ::arrow::TableBatchReader batch_reader(*table);
+  batch_reader.set_chunksize(100);
+  ::arrow::RecordBatchVector batches;
+  ASSERT_OK(batch_reader.ReadAll(&batches));
+
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), default_memory_pool(), sink,
+                                      default_writer_properties(), &writer));
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batches[1]));
+  ASSERT_OK_NO_THROW(writer->NewBufferedRowGroup());
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batches[2]));
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_NO_FATAL_FAILURE(CheckRowGroupSizes(buffer, *table, {200, 100}));
+
+  // Mismatching schema
+  auto other_batch = batches[0]->RemoveColumn(0);
+  ASSERT_OK(other_batch.status());
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), default_memory_pool(),
+                                      CreateOutputStream(), default_writer_properties(),
+                                      &writer));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(**other_batch));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -2160,6 +2287,72 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadRowRanges) {
+  const int64_t num_rows = 1000;
+  const int64_t row_group_size = 300;
+
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto ints = rag.Int64(num_rows, -100, 100, /*null_probability=*/0.2);
+  auto strings = rag.String(num_rows, 0, 10, /*null_probability=*/0.1);
+  auto lists = rag.List(*rag.Int32(3 * num_rows, 0, 10, /*null_probability=*/0.1),
+                        num_rows, /*null_probability=*/0.1, /*force_empty_nulls=*/true);
+  ASSERT_OK_AND_ASSIGN(auto structs,
+                       ::arrow::StructArray::Make(::arrow::ArrayVector{ints, strings},
+                                                  std::vector<std::string>{"i", "s"}));
+  auto schema = ::arrow::schema(
+      {::arrow::field("ints", ints->type()), ::arrow::field("strings", strings->type()),
+       ::arrow::field("lists", lists->type()),
+       ::arrow::field("structs", structs->type())});
+  auto table = Table::Make(schema, {ints, strings, lists, structs});
+
+  // Small pages, so that whole pages are skipped
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(20)
+                               ->data_pagesize(64)
+                               ->enable_write_page_index()
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                row_group_size, writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  const std::vector<int> row_groups = {0, 1, 2, 3};
+  const std::vector<std::vector<RowRange>> row_ranges = {
+      {{0, 10}, {150, 20}, {170, 0}, {299, 1}}, {}, {{5, 1}, {250, 50}}, {{0, 100}}};
+  std::vector<std::shared_ptr<Table>> slices;
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    for (const RowRange& range : row_ranges[i]) {
+      slices.push_back(
+          table->Slice(row_groups[i] * row_group_size + range.offset, range.length));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadRowRanges(row_groups, row_ranges, {0, 1, 2, 3, 4},
+                                           &result));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+
+  reader->set_use_threads(true);
+  ASSERT_OK_NO_THROW(reader->ReadRowRanges(row_groups, row_ranges, {0, 1, 2, 3, 4},
+                                           &result));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+
+  // Column subset
+  ASSERT_OK_NO_THROW(reader->ReadRowRanges(row_groups, row_ranges, {1, 2}, &result));
+  ASSERT_OK_AND_ASSIGN(auto expected_subset, expected->SelectColumns({1, 2}));
+  AssertTablesEqual(*expected_subset, *result, /*same_chunk_layout=*/false);
+
+  ASSERT_RAISES(Invalid, reader->ReadRowRanges({0}, {{{10, 5}, {0, 5}}}, {0}, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowRanges({0}, {{{290, 20}}}, {0}, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowRanges({0, 1}, {{{0, 5}}}, {0}, &result));
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
@@ -2331,6 +2524,97 @@ TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ASSERT_EQ(actual_batch->num_rows(), num_rows);
 }
 
+void TestGetRecordBatchGenerator(
+    ArrowReaderProperties properties = default_arrow_reader_properties(),
+    ::arrow::internal::Executor* cpu_executor = nullptr, int readahead = 0) {
+  const int num_rows = 1000;
+  const int num_columns = 5;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  properties.set_batch_size(batch_size);
+
+  std::unique_ptr<FileReader> unique_reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&unique_reader));
+  std::shared_ptr<FileReader> reader(std::move(unique_reader));
+
+  // Read the row groups out of order, skipping one of them
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       reader->GetRecordBatchGenerator(reader, {3, 0, 1}, {0, 2, 4},
+                                                       cpu_executor, readahead));
+  auto expected = ::arrow::ConcatenateTables(
+                      {table->Slice(750, 250), table->Slice(0, 500)})
+                      .ValueOrDie();
+  ASSERT_OK_AND_ASSIGN(expected, expected->SelectColumns({0, 2, 4}));
+
+  ::arrow::RecordBatchVector batches;
+  while (true) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator());
+    if (batch == nullptr) break;
+    ASSERT_LE(batch->num_rows(), batch_size);
+    batches.push_back(std::move(batch));
+  }
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  // 3 row groups of 250 rows, each split into batches of 100, 100 and 50 rows
+  ASSERT_EQ(batches.size(), 9U);
+
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator(reader, {4}, {0}));
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator(reader, {0}, {5}));
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchGenerator) { TestGetRecordBatchGenerator(); }
+
+TEST(TestArrowReadWrite, GetRecordBatchGeneratorCoalesced) {
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_pre_buffer(true);
+  TestGetRecordBatchGenerator(properties);
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchGeneratorThreaded) {
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_pre_buffer(true);
+  TestGetRecordBatchGenerator(properties, ::arrow::internal::GetCpuThreadPool(),
+                              /*readahead=*/2);
+  TestGetRecordBatchGenerator(default_arrow_reader_properties(),
+                              ::arrow::internal::GetCpuThreadPool(), /*readahead=*/2);
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupsAsync) {
+  const int num_rows = 1000;
+  const int num_columns = 5;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(default_arrow_reader_properties())->Build(&reader));
+
+  ASSERT_OK_AND_ASSIGN(auto expected, table->Slice(250, 500)->SelectColumns({1, 3}));
+  for (auto executor : std::vector<::arrow::internal::Executor*>{
+           nullptr, ::arrow::internal::GetCpuThreadPool()}) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto actual,
+                                  reader->ReadRowGroupsAsync({1, 2}, {1, 3}, executor));
+    ASSERT_OK(actual->ValidateFull());
+    ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+  ASSERT_FINISHES_AND_RAISES(Invalid, reader->ReadRowGroupsAsync({4}, {0}));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2736,6 +3020,39 @@ TEST(ArrowReadWrite, DecimalStats) {
   ::arrow::AssertScalarsEqual(*expected_max, *max, /*verbose=*/true);
 }
 
+TEST(ArrowReadWrite, IntegerDecimalStats) {
+  using ::arrow::Decimal128;
+
+  // Decimals stored as INT64 can't be written from Arrow
+  std::vector<NodePtr> fields({PrimitiveNode::Make("root", Repetition::REQUIRED,
+                                                   LogicalType::Decimal(12, 2),
+                                                   ParquetType::INT64)});
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto sink = CreateOutputStream();
+  auto writer = ParquetFileWriter::Open(sink, schema);
+  auto column_writer = checked_cast<Int64Writer*>(writer->AppendRowGroup()->NextColumn());
+  std::vector<int64_t> values = {12345, -500, 0, 700};
+  column_writer->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                            values.data());
+  writer->Close();
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+
+  std::shared_ptr<Scalar> min, max;
+  ReadSingleColumnFileStatistics(std::move(reader), &min, &max);
+
+  auto type = ::arrow::decimal128(/*precision=*/12, /*scale=*/2);
+  ::arrow::AssertScalarsEqual(::arrow::Decimal128Scalar(Decimal128(-500), type), *min,
+                              /*verbose=*/true);
+  ::arrow::AssertScalarsEqual(::arrow::Decimal128Scalar(Decimal128(12345), type), *max,
+                              /*verbose=*/true);
+}
+
 TEST(ArrowReadWrite, NestedNullableField) {
   auto int_field = ::arrow::field("int_array", ::arrow::int32());
   auto int_array =
@@ -2791,6 +3108,8 @@ TEST(TestArrowReadWrite, CanonicalNestedRoundTrip) {
   auto expected =
       ::arrow::Table::Make(schema, {doc_id_array, links_id_array, name_array});
   CheckSimpleRoundtrip(expected, 2);
+  CheckSimpleRoundtrip(expected, 1,
+                       ArrowWriterProperties::Builder().set_use_threads(true)->build());
 }
 
 TEST(ArrowReadWrite, ListOfStruct) {
@@ -3920,6 +4239,78 @@ TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   ::arrow::AssertTablesEqual(*expected_dense, *actual_dense);
 }
 
+TEST(TestArrowWriteDictionaries, AutoReadFixedWidthAsDictionary) {
+  // Each row group holds the same dictionary values: they are read into a single
+  // chunk with a single dictionary
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(),
+                                        "[0, 1, 2, null, 1, 0, 1, 2, null, 0, 2, 2]");
+  ::arrow::FieldVector fields;
+  ::arrow::ArrayVector columns;
+  for (const auto& dict : {
+           ::arrow::ArrayFromJSON(::arrow::int32(), "[7, -1, 42]"),
+           ::arrow::ArrayFromJSON(::arrow::int64(), "[7, -1, 42]"),
+           ::arrow::ArrayFromJSON(::arrow::float64(), "[0.5, -1.5, 3]"),
+           ::arrow::ArrayFromJSON(::arrow::date32(), "[0, 17000, 18000]"),
+           ::arrow::ArrayFromJSON(::arrow::fixed_size_binary(3),
+                                  R"(["abc", "def", "ghi"])"),
+       }) {
+    auto dict_type = ::arrow::dictionary(::arrow::int32(), dict->type());
+    ASSERT_OK_AND_ASSIGN(auto column,
+                         ::arrow::DictionaryArray::FromArrays(dict_type, indices, dict));
+    fields.push_back(::arrow::field("f" + std::to_string(fields.size()), dict_type));
+    columns.push_back(std::move(column));
+  }
+  auto expected = Table::Make(::arrow::schema(fields), columns);
+
+  auto props_store_schema = ArrowWriterProperties::Builder().store_schema()->build();
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(expected, /*row_group_size=*/4, &actual, default_writer_properties(),
+              props_store_schema);
+  ASSERT_OK(actual->ValidateFull());
+  ::arrow::AssertTablesEqual(*expected, *actual);
+}
+
+TEST(TestArrowReadDictionary, ReadFixedWidthAsDictionary) {
+  // Without a stored schema, read_dictionary selects the columns to read as
+  // dictionaries
+  auto values = ::arrow::ArrayFromJSON(::arrow::int64(),
+                                       "[3, 1, 3, null, 3, 1, 1, 2, null, 2, 3, 1]");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, /*row_group_size=*/4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  auto column = actual->column(0);
+  ASSERT_TRUE(
+      column->type()->Equals(::arrow::dictionary(::arrow::int32(), ::arrow::int64())));
+  // The row groups have different dictionaries
+  ASSERT_EQ(column->num_chunks(), 3);
+  ASSERT_OK_AND_ASSIGN(auto dense, ::arrow::compute::Cast(*column->chunk(0),
+                                                          ::arrow::int64()));
+  AssertArraysEqual(*values->Slice(0, 4), *dense);
+
+  // Boolean columns can't be read as dictionaries
+  auto bools = MakeSimpleTable(
+      ::arrow::ArrayFromJSON(::arrow::boolean(), "[true, false, null]"), true);
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(bools, 3, default_arrow_writer_properties(), &buffer));
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ::arrow::AssertTablesEqual(*bools, *actual);
+}
+
 TEST(TestArrowWriteDictionaries, NestedSubfield) {
   auto offsets = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 0, 2, 3]");
   auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 0, 0]");
@@ -0,0 +1,308 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Benchmarks of writing and reading whole files of a synthetic dataset mixing
+// flat, nested and dictionary-heavy columns, with the writer and reader settings
+// that matter most for tuning, over the storage a file is typically read from.
+
+#include "benchmark/benchmark.h"
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+#include "arrow/array.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#define EXIT_NOT_OK(s)                                        \
+  do {                                                        \
+    ::arrow::Status _s = (s);                                 \
+    if (ARROW_PREDICT_FALSE(!_s.ok())) {                      \
+      std::cout << "Exiting: " << _s.ToString() << std::endl; \
+      exit(EXIT_FAILURE);                                     \
+    }                                                         \
+  } while (0)
+
+namespace parquet {
+
+using arrow::FileReader;
+using arrow::FileReaderBuilder;
+using arrow::WriteTable;
+
+namespace benchmark {
+
+constexpr int64_t kNumRows = 1 << 20;
+
+const std::vector<Compression::type> kCodecs = {
+    Compression::UNCOMPRESSED, Compression::SNAPPY, Compression::ZSTD};
+
+enum Storage {
+  // In-memory buffer
+  kMemory,
+  // File on local disk, read with explicit reads
+  kLocalFile,
+  // Memory-mapped file on local disk
+  kMemoryMap,
+  // File on local disk behind a SlowFileSystem adding about 1ms per access
+  kSlowFileSystem
+};
+
+// The size of the buffers of an array, as a measure of the data processed
+static int64_t DataSize(const ::arrow::ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) size += buffer->size();
+  }
+  for (const auto& child : data.child_data) {
+    size += DataSize(*child);
+  }
+  return size;
+}
+
+static int64_t DataSize(const ::arrow::Table& table) {
+  int64_t size = 0;
+  for (const auto& column : table.columns()) {
+    for (const auto& chunk : column->chunks()) {
+      size += DataSize(*chunk->data());
+    }
+  }
+  return size;
+}
+
+// A table of kNumRows rows with:
+// - an int64 key and a double measure with some nulls
+// - low and medium cardinality strings, which stay dictionary encoded
+// - a list of strings drawn from a small set of tags
+// - a struct of two doubles
+static std::shared_ptr<::arrow::Table> MakeDataset() {
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto id = rng.Int64(kNumRows, 0, kNumRows * 16, /*null_probability=*/0);
+  auto category = rng.StringWithRepeats(kNumRows, /*unique=*/64, 4, 16, 0.01);
+  auto label = rng.StringWithRepeats(kNumRows, /*unique=*/4096, 8, 32, 0.1);
+  auto value = rng.Float64(kNumRows, -1e6, 1e6, /*null_probability=*/0.05);
+  auto tag_values = rng.StringWithRepeats(kNumRows * 2, /*unique=*/256, 3, 12, 0);
+  auto tags = rng.List(*tag_values, kNumRows, /*null_probability=*/0.1);
+  auto x = rng.Float64(kNumRows, -180, 180, /*null_probability=*/0);
+  auto y = rng.Float64(kNumRows, -90, 90, /*null_probability=*/0);
+  auto point = *::arrow::StructArray::Make(::arrow::ArrayVector{x, y},
+                                           std::vector<std::string>{"x", "y"});
+
+  auto schema = ::arrow::schema({::arrow::field("id", id->type(), false),
+                                 ::arrow::field("category", category->type()),
+                                 ::arrow::field("label", label->type()),
+                                 ::arrow::field("value", value->type()),
+                                 ::arrow::field("tags", tags->type()),
+                                 ::arrow::field("point", point->type())});
+  return ::arrow::Table::Make(schema, {id, category, label, value, tags, point});
+}
+
+static const std::shared_ptr<::arrow::Table>& Dataset() {
+  static auto table = MakeDataset();
+  return table;
+}
+
+static const std::string& TemporaryDirPath() {
+  static auto dir = [] {
+    auto maybe_dir = ::arrow::internal::TemporaryDir::Make("parquet-benchmark-");
+    EXIT_NOT_OK(maybe_dir.status());
+    return maybe_dir.MoveValueUnsafe();
+  }();
+  static const std::string path = dir->path().ToString();
+  return path;
+}
+
+static bool SkipUnavailableCodec(::benchmark::State& state, Compression::type codec) {
+  if (!::arrow::util::Codec::IsAvailable(codec)) {
+    state.SkipWithError("Codec not available");
+    return true;
+  }
+  return false;
+}
+
+static std::shared_ptr<WriterProperties> MakeWriterProperties(Compression::type codec,
+                                                              int64_t page_size) {
+  return WriterProperties::Builder()
+      .compression(codec)
+      ->data_pagesize(page_size)
+      ->max_row_group_length(kNumRows)
+      ->build();
+}
+
+//
+// Writing
+//
+
+// XXX We can use ArgsProduct() starting from Benchmark 1.5.2
+static void WriteArguments(::benchmark::internal::Benchmark* b) {
+  b->ArgNames({"codec", "page_kib", "row_group_rows", "threads", "to_file"});
+  for (int codec = 0; codec < static_cast<int>(kCodecs.size()); ++codec) {
+    for (int64_t page_kib : {64, 1024}) {
+      for (int64_t row_group_rows : {kNumRows / 16, kNumRows}) {
+        for (int use_threads : {0, 1}) {
+          for (int to_file : {0, 1}) {
+            b->Args({codec, page_kib, row_group_rows, use_threads, to_file});
+          }
+        }
+      }
+    }
+  }
+}
+
+static void BM_WriteDataset(::benchmark::State& state) {
+  const Compression::type codec = kCodecs[state.range(0)];
+  if (SkipUnavailableCodec(state, codec)) return;
+  const auto& table = Dataset();
+  auto properties = MakeWriterProperties(codec, state.range(1) * 1024);
+  auto arrow_properties = ArrowWriterProperties::Builder()
+                              .set_use_threads(state.range(3) != 0)
+                              ->build();
+  const std::string path = TemporaryDirPath() + "write.parquet";
+
+  int64_t file_size = 0;
+  for (auto _ : state) {
+    std::shared_ptr<::arrow::io::OutputStream> sink;
+    if (state.range(4) != 0) {
+      PARQUET_ASSIGN_OR_THROW(sink, ::arrow::io::FileOutputStream::Open(path));
+    } else {
+      PARQUET_ASSIGN_OR_THROW(sink, ::arrow::io::BufferOutputStream::Create());
+    }
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                           state.range(2), properties, arrow_properties));
+    PARQUET_ASSIGN_OR_THROW(file_size, sink->Tell());
+    EXIT_NOT_OK(sink->Close());
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*table));
+  state.counters["file_size"] = static_cast<double>(file_size);
+}
+
+BENCHMARK(BM_WriteDataset)->Apply(WriteArguments)->Unit(::benchmark::kMillisecond);
+
+//
+// Reading
+//
+
+// The path to a file of the dataset written with the given codec, in row groups of
+// kNumRows / 16 rows and pages of the default size
+static const std::string& DatasetFile(Compression::type codec) {
+  static std::map<Compression::type, std::string> paths;
+  auto it = paths.find(codec);
+  if (it == paths.end()) {
+    const std::string path = TemporaryDirPath() + "read-" +
+                             ::arrow::util::Codec::GetCodecAsString(codec) + ".parquet";
+    std::shared_ptr<::arrow::io::OutputStream> sink;
+    PARQUET_ASSIGN_OR_THROW(sink, ::arrow::io::FileOutputStream::Open(path));
+    EXIT_NOT_OK(WriteTable(*Dataset(), ::arrow::default_memory_pool(), sink,
+                           kNumRows / 16,
+                           MakeWriterProperties(codec, kDefaultDataPageSize)));
+    EXIT_NOT_OK(sink->Close());
+    it = paths.emplace(codec, path).first;
+  }
+  return it->second;
+}
+
+static std::shared_ptr<::arrow::io::RandomAccessFile> OpenDatasetFile(
+    const std::string& path, Storage storage) {
+  switch (storage) {
+    case kMemory: {
+      std::shared_ptr<::arrow::io::RandomAccessFile> file;
+      PARQUET_ASSIGN_OR_THROW(file, ::arrow::io::ReadableFile::Open(path));
+      PARQUET_ASSIGN_OR_THROW(auto size, file->GetSize());
+      PARQUET_ASSIGN_OR_THROW(auto buffer, file->ReadAt(0, size));
+      return std::make_shared<::arrow::io::BufferReader>(buffer);
+    }
+    case kLocalFile: {
+      std::shared_ptr<::arrow::io::RandomAccessFile> file;
+      PARQUET_ASSIGN_OR_THROW(file, ::arrow::io::ReadableFile::Open(path));
+      return file;
+    }
+    case kMemoryMap: {
+      std::shared_ptr<::arrow::io::RandomAccessFile> file;
+      PARQUET_ASSIGN_OR_THROW(
+          file, ::arrow::io::MemoryMappedFile::Open(path, ::arrow::io::FileMode::READ));
+      return file;
+    }
+    case kSlowFileSystem: {
+      auto fs = std::make_shared<::arrow::fs::SlowFileSystem>(
+          std::make_shared<::arrow::fs::LocalFileSystem>(), /*average_latency=*/0.001,
+          /*seed=*/42);
+      std::shared_ptr<::arrow::io::RandomAccessFile> file;
+      PARQUET_ASSIGN_OR_THROW(file, fs->OpenInputFile(path));
+      return file;
+    }
+  }
+  return nullptr;
+}
+
+static void ReadArguments(::benchmark::internal::Benchmark* b) {
+  b->ArgNames({"codec", "storage", "pre_buffer", "threads"});
+  for (int codec = 0; codec < static_cast<int>(kCodecs.size()); ++codec) {
+    for (int storage : {kMemory, kLocalFile, kMemoryMap, kSlowFileSystem}) {
+      for (int pre_buffer : {0, 1}) {
+        for (int use_threads : {0, 1}) {
+          b->Args({codec, storage, pre_buffer, use_threads});
+        }
+      }
+    }
+  }
+}
+
+static void BM_ReadDataset(::benchmark::State& state) {
+  const Compression::type codec = kCodecs[state.range(0)];
+  if (SkipUnavailableCodec(state, codec)) return;
+  const std::string& path = DatasetFile(codec);
+  const auto storage = static_cast<Storage>(state.range(1));
+  ArrowReaderProperties properties;
+  properties.set_pre_buffer(state.range(2) != 0);
+  properties.set_use_threads(state.range(3) != 0);
+
+  // The file is loaded in memory once, other storage is opened anew each time
+  auto memory_file = OpenDatasetFile(path, kMemory);
+  for (auto _ : state) {
+    auto file = storage == kMemory ? memory_file : OpenDatasetFile(path, storage);
+    FileReaderBuilder builder;
+    EXIT_NOT_OK(builder.Open(file));
+    std::unique_ptr<FileReader> reader;
+    EXIT_NOT_OK(builder.properties(properties)->Build(&reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(reader->ReadTable(&table));
+    if (storage != kMemory) {
+      EXIT_NOT_OK(file->Close());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*Dataset()));
+}
+
+BENCHMARK(BM_ReadDataset)->Apply(ReadArguments)->Unit(::benchmark::kMillisecond);
+
+}  // namespace benchmark
+
+}  // namespace parquet
@@ -18,6 +18,7 @@
 #include "parquet/arrow/reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <unordered_set>
 #include <utility>
@@ -30,12 +31,16 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing_internal.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
@@ -113,6 +118,10 @@ class ColumnReaderImpl : public ColumnReader {
 
   virtual ::arrow::Status LoadBatch(int64_t num_records) = 0;
 
+  // Skip records without materializing them. Records loaded by LoadBatch and not
+  // built yet are dropped.
+  virtual ::arrow::Status SkipRecords(int64_t num_records) = 0;
+
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
@@ -199,20 +208,25 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        std::shared_ptr<const std::vector<RowRange>> row_ranges =
+                            nullptr) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
     ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->row_ranges = std::move(row_ranges);
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
-                         std::shared_ptr<::arrow::Schema>* out_schema) {
+                         std::shared_ptr<::arrow::Schema>* out_schema,
+                         std::shared_ptr<const std::vector<RowRange>> row_ranges =
+                             nullptr) {
     // We only need to read schema fields which have columns indicated
     // in the indices vector
     ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
@@ -224,8 +238,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   &reader, row_ranges));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -291,6 +305,30 @@ class FileReaderImpl : public FileReader {
                        const std::vector<int>& indices,
                        std::shared_ptr<Table>* table) override;
 
+  Status ReadRowRanges(const std::vector<int>& row_groups,
+                       const std::vector<std::vector<RowRange>>& row_ranges,
+                       const std::vector<int>& column_indices,
+                       std::shared_ptr<Table>* out) override;
+
+  // Decode the given row groups, assuming they are already buffered if
+  // pre-buffering is enabled
+  Status DecodeRowGroups(const std::vector<int>& row_groups,
+                         const std::vector<int>& column_indices, bool use_threads,
+                         std::shared_ptr<Table>* out);
+
+  // Decode a single row group and slice it into batches
+  ::arrow::Result<RecordBatchGenerator> DecodeRowGroupBatches(
+      int row_group, const std::vector<int>& column_indices);
+
+  ::arrow::Result<RecordBatchGenerator> GetRecordBatchGenerator(
+      std::shared_ptr<FileReader> reader, const std::vector<int> row_group_indices,
+      const std::vector<int> column_indices, ::arrow::internal::Executor* cpu_executor,
+      int row_group_readahead) override;
+
+  Future<std::shared_ptr<Table>> ReadRowGroupsAsync(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor) override;
+
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
@@ -450,6 +488,7 @@ class LeafReader : public ColumnReaderImpl {
       }
       int64_t records_read = record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
+      row_position_ += records_read;
       if (records_read == 0) {
         NextRowGroup();
       }
@@ -460,6 +499,31 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status SkipRecords(int64_t records_to_skip) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    out_ = nullptr;
+    record_reader_->Reset();
+    // The rows of dropped pages are not in the column chunk as read
+    const int64_t end = row_position_ + records_to_skip;
+    for (const auto& rows : dropped_rows_) {
+      records_to_skip -= std::max<int64_t>(
+          0, std::min(rows.second, end) - std::max(rows.first, row_position_));
+    }
+    row_position_ = end;
+    while (records_to_skip > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_skipped = record_reader_->SkipRecords(records_to_skip);
+      records_to_skip -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   ::arrow::Status BuildArray(int64_t length_upper_bound,
                              std::shared_ptr<::arrow::ChunkedArray>* out) final {
     *out = out_;
@@ -472,14 +536,59 @@ class LeafReader : public ColumnReaderImpl {
   std::shared_ptr<ChunkedArray> out_;
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    row_position_ = 0;
+    dropped_rows_.clear();
+    if (page_reader != nullptr && ctx_->row_ranges != nullptr &&
+        descr_->max_repetition_level() == 0) {
+      DropUnselectedPages(page_reader.get());
+    }
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Use the OffsetIndex, if any, to skip the data pages holding no selected row.
+  // Pages of repeated leaves may not start at row boundaries, so they are all read.
+  void DropUnselectedPages(PageReader* page_reader) {
+    const int row_group = input_->current_row_group();
+    std::unique_ptr<OffsetIndex> offset_index =
+        ctx_->reader->RowGroup(row_group)->GetOffsetIndex(input_->column_index());
+    if (offset_index == nullptr) {
+      return;
+    }
+    const int64_t num_rows = input_->metadata()->RowGroup(row_group)->num_rows();
+    const std::vector<RowRange>& ranges = *ctx_->row_ranges;
+
+    auto dropped_pages = std::make_shared<std::vector<bool>>(offset_index->num_pages());
+    size_t range = 0;
+    for (int i = 0; i < offset_index->num_pages(); ++i) {
+      const int64_t first_row = offset_index->page_locations()[i].first_row_index;
+      const int64_t end_row = first_row + offset_index->num_rows(i, num_rows);
+      while (range < ranges.size() &&
+             ranges[range].offset + ranges[range].length <= first_row) {
+        ++range;
+      }
+      if (range == ranges.size() || ranges[range].offset >= end_row) {
+        (*dropped_pages)[i] = true;
+        dropped_rows_.emplace_back(first_row, end_row);
+      }
+    }
+    if (dropped_rows_.empty()) {
+      return;
+    }
+    page_reader->set_data_page_filter([dropped_pages](const DataPageStats& stats) {
+      return stats.page_ordinal < static_cast<int32_t>(dropped_pages->size()) &&
+             (*dropped_pages)[stats.page_ordinal];
+    });
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // Index of the next row to read or skip in the current row group
+  int64_t row_position_ = 0;
+  // The [first, end) rows of the current row group in dropped data pages
+  std::vector<std::pair<int64_t, int64_t>> dropped_rows_;
 };
 
 // Column reader for extension arrays
@@ -498,9 +607,15 @@ class ExtensionReader : public ColumnReaderImpl {
   }
 
   Status LoadBatch(int64_t number_of_records) final {
+    ARROW_TRACE_SPAN(span, "parquet::arrow::LeafReader::LoadBatch");
+    ARROW_TRACE_SPAN_ATTRIBUTE(span, "records", number_of_records);
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  Status SkipRecords(int64_t number_of_records) final {
+    return storage_reader_->SkipRecords(number_of_records);
+  }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -545,6 +660,10 @@ class ListReader : public ColumnReaderImpl {
     return item_reader_->LoadBatch(number_of_records);
   }
 
+  Status SkipRecords(int64_t number_of_records) final {
+    return item_reader_->SkipRecords(number_of_records);
+  }
+
   virtual ::arrow::Result<std::shared_ptr<ChunkedArray>> AssembleArray(
       std::shared_ptr<ArrayData> data) {
     if (field_->type()->id() == ::arrow::Type::MAP) {
@@ -678,6 +797,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
     }
     return Status::OK();
   }
+  Status SkipRecords(int64_t records_to_skip) override {
+    for (const std::unique_ptr<ColumnReaderImpl>& reader : children_) {
+      RETURN_NOT_OK(reader->SkipRecords(records_to_skip));
+    }
+    return Status::OK();
+  }
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
@@ -996,13 +1121,20 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  return DecodeRowGroups(row_groups, column_indices, reader_properties_.use_threads(),
+                         out);
+}
+
+Status FileReaderImpl::DecodeRowGroups(const std::vector<int>& row_groups,
+                                       const std::vector<int>& column_indices,
+                                       bool use_threads, std::shared_ptr<Table>* out) {
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
   RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
 
   ::arrow::ChunkedArrayVector columns(readers.size());
   RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
-      reader_properties_.use_threads(), static_cast<int>(readers.size()), [&](int i) {
+      use_threads, static_cast<int>(readers.size()), [&](int i) {
         return ReadColumn(static_cast<int>(i), row_groups, readers[i].get(), &columns[i]);
       }));
 
@@ -1019,6 +1151,198 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return (*out)->Validate();
 }
 
+namespace {
+
+Status CheckRowRanges(int row_group, int64_t num_rows,
+                      const std::vector<RowRange>& ranges) {
+  int64_t end = 0;
+  for (const RowRange& range : ranges) {
+    if (range.offset < end || range.length < 0 ||
+        range.length > num_rows - range.offset) {
+      return Status::Invalid("Row ranges of row group ", row_group,
+                             " must be sorted, non-overlapping and within its ", num_rows,
+                             " rows");
+    }
+    end = range.offset + range.length;
+  }
+  return Status::OK();
+}
+
+// Read the given ranges of the single row group a column reader was made for
+Status ReadColumnRanges(ColumnReaderImpl* reader, const std::vector<RowRange>& ranges,
+                        ::arrow::ArrayVector* chunks) {
+  int64_t position = 0;
+  for (const RowRange& range : ranges) {
+    if (range.length == 0) {
+      continue;
+    }
+    if (range.offset > position) {
+      RETURN_NOT_OK(reader->SkipRecords(range.offset - position));
+    }
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(reader->NextBatch(range.length, &column));
+    chunks->insert(chunks->end(), column->chunks().begin(), column->chunks().end());
+    position = range.offset + range.length;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status FileReaderImpl::ReadRowRanges(const std::vector<int>& row_groups,
+                                     const std::vector<std::vector<RowRange>>& row_ranges,
+                                     const std::vector<int>& column_indices,
+                                     std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+  if (row_ranges.size() != row_groups.size()) {
+    return Status::Invalid("Got ", row_ranges.size(), " lists of row ranges for ",
+                           row_groups.size(), " row groups");
+  }
+  int64_t num_rows = 0;
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    const int64_t row_group_rows =
+        parquet_reader()->metadata()->RowGroup(row_groups[i])->num_rows();
+    RETURN_NOT_OK(CheckRowRanges(row_groups[i], row_group_rows, row_ranges[i]));
+    for (const RowRange& range : row_ranges[i]) {
+      num_rows += range.length;
+    }
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_UNUSED(parquet_reader()->PreBuffer(row_groups, column_indices,
+                                             reader_properties_.io_context(),
+                                             reader_properties_.cache_options()));
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {}, &readers, &result_schema));
+
+  // Each row group gets its own readers, so that the pages they drop only depend
+  // on its ranges
+  std::vector<::arrow::ArrayVector> chunks(readers.size());
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    if (row_ranges[i].empty()) {
+      continue;
+    }
+    auto ranges = std::make_shared<const std::vector<RowRange>>(row_ranges[i]);
+    std::shared_ptr<::arrow::Schema> schema;
+    RETURN_NOT_OK(
+        GetFieldReaders(column_indices, {row_groups[i]}, &readers, &schema, ranges));
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        reader_properties_.use_threads(), static_cast<int>(readers.size()),
+        [&](int j) { return ReadColumnRanges(readers[j].get(), *ranges, &chunks[j]); }));
+  }
+
+  ::arrow::ChunkedArrayVector columns(chunks.size());
+  for (size_t j = 0; j < chunks.size(); ++j) {
+    columns[j] = std::make_shared<ChunkedArray>(std::move(chunks[j]),
+                                                result_schema->field(j)->type());
+  }
+  *out = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+  return (*out)->Validate();
+}
+
+::arrow::Result<FileReader::RecordBatchGenerator> FileReaderImpl::DecodeRowGroupBatches(
+    int row_group, const std::vector<int>& column_indices) {
+  std::shared_ptr<Table> table;
+  // Columns are decoded serially: this may already run on a CPU thread pool task,
+  // which mustn't block waiting on other tasks of the same pool.
+  RETURN_NOT_OK(DecodeRowGroups({row_group}, column_indices, /*use_threads=*/false,
+                                &table));
+  ::arrow::TableBatchReader table_reader(*table);
+  table_reader.set_chunksize(properties().batch_size());
+  ::arrow::RecordBatchVector batches;
+  RETURN_NOT_OK(table_reader.ReadAll(&batches));
+  return ::arrow::MakeVectorGenerator(std::move(batches));
+}
+
+::arrow::Result<FileReader::RecordBatchGenerator> FileReaderImpl::GetRecordBatchGenerator(
+    std::shared_ptr<FileReader> reader, const std::vector<int> row_group_indices,
+    const std::vector<int> column_indices, ::arrow::internal::Executor* cpu_executor,
+    int row_group_readahead) {
+  if (reader.get() != this) {
+    return Status::Invalid("GetRecordBatchGenerator must be passed this reader");
+  }
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+
+  const bool pre_buffer = reader_properties_.pre_buffer();
+  if (pre_buffer) {
+    // Issue all the reads now; row groups are decoded as their data arrives
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    ARROW_UNUSED(reader_->PreBuffer(row_group_indices, column_indices,
+                                    reader_properties_.io_context(),
+                                    reader_properties_.cache_options()));
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // NB: the closure keeps `reader` alive, hence `this`
+  auto decode_row_group = [reader, this, column_indices, cpu_executor,
+                           pre_buffer](int row_group) -> Future<RecordBatchGenerator> {
+    auto decode = [reader, this, column_indices, row_group]() {
+      return DecodeRowGroupBatches(row_group, column_indices);
+    };
+    Future<> ready = Future<>::MakeFinished();
+    if (pre_buffer) {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      ready = reader_->WhenBuffered({row_group}, column_indices);
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
+    if (cpu_executor == nullptr) {
+      return ready.Then([decode](const ::arrow::detail::Empty&) { return decode(); });
+    }
+    return ready.Then([cpu_executor, decode](const ::arrow::detail::Empty&) {
+      return ::arrow::DeferNotOk(cpu_executor->Submit(decode));
+    });
+  };
+
+  // Async-reentrant, so that several row groups can be decoded ahead
+  auto next_index = std::make_shared<std::atomic<size_t>>(0);
+  ::arrow::AsyncGenerator<RecordBatchGenerator> row_group_generator =
+      [row_group_indices, next_index,
+       decode_row_group]() -> Future<RecordBatchGenerator> {
+    const size_t index = next_index->fetch_add(1);
+    if (index >= row_group_indices.size()) {
+      return ::arrow::AsyncGeneratorEnd<RecordBatchGenerator>();
+    }
+    return decode_row_group(row_group_indices[index]);
+  };
+  if (row_group_readahead > 0) {
+    row_group_generator = ::arrow::MakeReadaheadGenerator(std::move(row_group_generator),
+                                                          row_group_readahead);
+  }
+  return ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
+}
+
+Future<std::shared_ptr<Table>> FileReaderImpl::ReadRowGroupsAsync(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    ::arrow::internal::Executor* cpu_executor) {
+  RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+
+  // The data is always fetched through the read cache, so that no I/O blocks
+  Future<> ready;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  ready = reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
+                             reader_properties_.cache_options());
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  const bool use_threads = reader_properties_.use_threads() && cpu_executor == nullptr;
+  auto decode = [this, row_groups, column_indices,
+                 use_threads]() -> ::arrow::Result<std::shared_ptr<Table>> {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(DecodeRowGroups(row_groups, column_indices, use_threads, &table));
+    return table;
+  };
+  if (cpu_executor == nullptr) {
+    return ready.Then([decode](const ::arrow::detail::Empty&) { return decode(); });
+  }
+  return ready.Then([cpu_executor, decode](const ::arrow::detail::Empty&) {
+    return ::arrow::DeferNotOk(cpu_executor->Submit(decode));
+  });
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
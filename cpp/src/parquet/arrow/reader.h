@@ -18,9 +18,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
@@ -49,6 +52,14 @@ class ColumnReader;
 struct SchemaManifest;
 class RowGroupReader;
 
+/// \brief A range of rows within a row group
+struct PARQUET_EXPORT RowRange {
+  /// Index of the first row of the range, relative to the start of the row group
+  int64_t offset;
+  /// Number of rows in the range
+  int64_t length;
+};
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -106,6 +117,10 @@ class RowGroupReader;
 // arrays
 class PARQUET_EXPORT FileReader {
  public:
+  /// \brief An asynchronous stream of record batches, ended by a null batch
+  using RecordBatchGenerator =
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>;
+
   /// Factory function to create a FileReader from a ParquetFileReader and properties
   static ::arrow::Status Make(::arrow::MemoryPool* pool,
                               std::unique_ptr<ParquetFileReader> reader,
@@ -179,6 +194,39 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a generator of record batches of the given row groups and
+  /// columns.
+  ///
+  /// The file reader must be passed in as a shared_ptr so that it is kept alive
+  /// by the generator; it must be this reader.
+  ///
+  /// If pre_buffer is enabled in the reader properties, the column chunks of all
+  /// the row groups are requested up front through a read cache, and each row
+  /// group is decoded as soon as its column chunks have arrived, instead of
+  /// blocking on I/O.  Decoding happens on cpu_executor if given, otherwise on
+  /// the thread that completed the I/O (or the caller's thread).
+  ///
+  /// Up to row_group_readahead row groups are decoded ahead of the consumer.
+  /// Columns of a row group are decoded serially; parallelism comes from
+  /// readahead across row groups.
+  ///
+  /// \returns error Status if either row_group_indices or column_indices
+  ///     contains an invalid index
+  virtual ::arrow::Result<RecordBatchGenerator> GetRecordBatchGenerator(
+      std::shared_ptr<FileReader> reader, const std::vector<int> row_group_indices,
+      const std::vector<int> column_indices,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR,
+      int row_group_readahead = 0) = 0;
+
+  /// \brief Read the given row groups and columns into a Table asynchronously.
+  ///
+  /// The column chunks are fetched through a read cache without blocking, then
+  /// decoded on cpu_executor if given.  The FileReader must outlive the returned
+  /// Future.
+  virtual ::arrow::Future<std::shared_ptr<::arrow::Table>> ReadRowGroupsAsync(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      ::arrow::internal::Executor* cpu_executor = NULLPTR) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -200,6 +248,17 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read selected ranges of rows of the given row groups into a Table
+  ///
+  /// row_ranges[i] holds the sorted, non-overlapping ranges of rows to read from
+  /// row_groups[i]. The rows in between are skipped: data pages of flat columns
+  /// holding none of the selected rows are not read at all if the file has an
+  /// OffsetIndex, and the other skipped values are decoded but not materialized.
+  virtual ::arrow::Status ReadRowRanges(
+      const std::vector<int>& row_groups,
+      const std::vector<std::vector<RowRange>>& row_ranges,
+      const std::vector<int>& column_indices, std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
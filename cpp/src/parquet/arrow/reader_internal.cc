@@ -121,6 +121,17 @@ Status MakeMinMaxTypedScalar(const StatisticsType& statistics,
   return Status::OK();
 }
 
+// Decimals stored as INT32 or INT64 have a precision of at most 18
+template <typename StatisticsType>
+Status MakeMinMaxDecimalScalar(const StatisticsType& statistics,
+                               std::shared_ptr<DataType> type,
+                               std::shared_ptr<::arrow::Scalar>* min,
+                               std::shared_ptr<::arrow::Scalar>* max) {
+  ARROW_ASSIGN_OR_RAISE(*min, ::arrow::MakeScalar(type, Decimal128(statistics.min())));
+  ARROW_ASSIGN_OR_RAISE(*max, ::arrow::MakeScalar(type, Decimal128(statistics.max())));
+  return Status::OK();
+}
+
 template <typename StatisticsType>
 Status MakeMinMaxIntegralScalar(const StatisticsType& statistics,
                                 const ::arrow::DataType& arrow_type,
@@ -164,6 +175,8 @@ static Status FromInt32Statistics(const Int32Statistics& statistics,
     case LogicalType::Type::NONE:
       return MakeMinMaxTypedScalar<int32_t>(statistics, type, min, max);
       break;
+    case LogicalType::Type::DECIMAL:
+      return MakeMinMaxDecimalScalar(statistics, type, min, max);
     default:
       break;
   }
@@ -186,6 +199,8 @@ static Status FromInt64Statistics(const Int64Statistics& statistics,
     case LogicalType::Type::NONE:
       return MakeMinMaxTypedScalar<int64_t>(statistics, type, min, max);
       break;
+    case LogicalType::Type::DECIMAL:
+      return MakeMinMaxDecimalScalar(statistics, type, min, max);
     default:
       break;
   }
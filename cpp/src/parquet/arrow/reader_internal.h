@@ -26,6 +26,7 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
@@ -75,11 +76,15 @@ class FileColumnIterator {
       return nullptr;
     }
 
-    auto row_group_reader = reader_->RowGroup(row_groups_.front());
+    current_row_group_ = row_groups_.front();
+    auto row_group_reader = reader_->RowGroup(current_row_group_);
     row_groups_.pop_front();
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
+  /// The row group of the chunk last returned by NextChunk, or -1
+  int current_row_group() const { return current_row_group_; }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -93,6 +98,7 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  int current_row_group_ = -1;
 };
 
 using FileColumnIteratorFactory =
@@ -109,6 +115,9 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  // If set, the rows to read from the single row group read. Data pages of flat
+  // leaves holding none of them are dropped.
+  std::shared_ptr<const std::vector<RowRange>> row_ranges;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
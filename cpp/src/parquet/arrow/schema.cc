@@ -408,8 +408,25 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const ArrowType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Supported for the types whose values are the Parquet physical values, so that
+  // the dictionary can be read as is and viewed as the logical type
+  switch (type.id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::UINT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::UINT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::DATE32:
+    case ::arrow::Type::TIME32:
+    case ::arrow::Type::TIME64:
+      return true;
+    default:
+      return false;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -879,8 +896,8 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
       inferred_type->id() != ::arrow::Type::DICTIONARY &&
       IsDictionaryReadSupported(*inferred_type)) {
-    // Direct dictionary reads are only suppored for a couple primitive types,
-    // so no need to recurse on value types.
+    // Direct dictionary reads are only supported for primitive types, so no need
+    // to recurse on value types.
     const auto& dict_origin_type =
         checked_cast<const ::arrow::DictionaryType&>(*origin_type);
     inferred->field = inferred->field->WithType(
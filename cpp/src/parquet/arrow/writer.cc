@@ -35,6 +35,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/path_internal.h"
@@ -61,6 +62,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -115,21 +117,33 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  // A non-negative |leaf_column_start| is the index of the first leaf column in
+  // a buffered row group.
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer,
+                      int leaf_column_start = -1)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        leaf_column_start_(leaf_column_start) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written.
   //
-  // Columns are written in DFS order.
+  // Columns are written in DFS order.  In a buffered row group, the column
+  // writers are left open (the row group closes them in order), so that
+  // writers of distinct columns may run concurrently.
   Status Write(ArrowWriteContext* ctx) {
+    const bool buffered = leaf_column_start_ >= 0;
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (buffered) {
+        const int column_index = leaf_column_start_ + leaf_idx;
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(column_index));
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -149,11 +163,15 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      if (!buffered) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
     return Status::OK();
   }
 
+  int leaf_count() const { return leaf_count_; }
+
   // Make a new object by converting each chunk in |data| to a MultipathLevelBuilder.
   //
   // It is necessary to create a new builder per array because the MultipathlevelBuilder
@@ -164,14 +182,15 @@ class ArrowColumnWriterV2 {
   // RowGroupWriters (we could construct each builder on demand in that case).
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int leaf_column_start = -1) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(data.type().get()), row_group_writer);
+          CalculateLeafCount(data.type().get()), row_group_writer, leaf_column_start);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -196,7 +215,8 @@ class ArrowColumnWriterV2 {
     bool is_nullable = false;
     // The row_group_writer hasn't been advanced yet so add 1 to the current
     // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
+    int column_index = leaf_column_start >= 0 ? leaf_column_start
+                                              : row_group_writer->current_column() + 1;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -243,7 +263,7 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, leaf_column_start);
   }
 
  private:
@@ -251,6 +271,7 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int leaf_column_start_;
 };
 
 }  // namespace
@@ -268,7 +289,8 @@ class FileWriterImpl : public FileWriter {
         row_group_writer_(nullptr),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(std::move(arrow_properties)),
-        closed_(false) {}
+        closed_(false),
+        batch_row_group_open_(false) {}
 
   Status Init() {
     return SchemaManifest::Make(writer_->schema(), /*schema_metadata=*/nullptr,
@@ -280,6 +302,52 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    batch_row_group_open_ = false;
+    return Status::OK();
+  }
+
+  Status NewBufferedRowGroup() override {
+    RETURN_NOT_OK(AppendBufferedRowGroup());
+    batch_row_group_open_ = true;
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("Record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    columns.reserve(batch.num_columns());
+    for (const auto& column : batch.columns()) {
+      columns.push_back(std::make_shared<ChunkedArray>(column));
+    }
+
+    const int64_t max_row_group_length = properties().max_row_group_length();
+    if (max_row_group_length <= 0) {
+      return Status::Invalid("max_row_group_length must be greater than 0");
+    }
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (!batch_row_group_open_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      int64_t num_rows;
+      PARQUET_CATCH_NOT_OK(num_rows = row_group_writer_->num_rows());
+      const int64_t size =
+          std::min(max_row_group_length - num_rows, batch.num_rows() - offset);
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, size));
+      offset += size;
+
+      // The size is only checked between writes, so a row group can exceed the
+      // target by up to the encoded size of a batch
+      if (num_rows + size >= max_row_group_length ||
+          EstimateBufferedRowGroupBytes() >= properties().max_row_group_bytes()) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        batch_row_group_open_ = false;
+      }
+    }
     return Status::OK();
   }
 
@@ -335,6 +403,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (UseThreads()) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -359,6 +430,64 @@ class FileWriterImpl : public FileWriter {
 
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Encryptors are shared between columns, so encrypted files are written serially
+  bool UseThreads() const {
+    return arrow_properties_->use_threads() &&
+           properties().file_encryption_properties() == nullptr;
+  }
+
+  Status AppendBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    batch_row_group_open_ = false;
+    return Status::OK();
+  }
+
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    RETURN_NOT_OK(AppendBufferedRowGroup());
+    return WriteBufferedColumns(table.columns(), offset, size);
+  }
+
+  // Append a slice of the given columns to the current buffered row group.  With
+  // use_threads, the columns are encoded concurrently; the row group serializes
+  // them in order when closed.
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size) {
+    const int num_columns = static_cast<int>(columns.size());
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers(num_columns);
+    int leaf_column_start = 0;
+    for (int i = 0; i < num_columns; i++) {
+      ARROW_ASSIGN_OR_RAISE(writers[i], ArrowColumnWriterV2::Make(
+                                            *columns[i], offset, size, schema_manifest_,
+                                            row_group_writer_, leaf_column_start));
+      leaf_column_start += writers[i]->leaf_count();
+    }
+    if (!UseThreads()) {
+      for (const auto& writer : writers) {
+        RETURN_NOT_OK(writer->Write(&column_write_context_));
+      }
+      return Status::OK();
+    }
+    return ::arrow::internal::ParallelFor(num_columns, [&](int i) {
+      // The scratch buffers of a write context can't be shared between threads
+      ArrowWriteContext ctx(memory_pool(), arrow_properties_.get());
+      return writers[i]->Write(&ctx);
+    });
+  }
+
+  // The encoded size of the current buffered row group: its finished pages
+  // plus the values and dictionaries not written to a page yet
+  int64_t EstimateBufferedRowGroupBytes() const {
+    int64_t size = row_group_writer_->total_compressed_bytes() +
+                   row_group_writer_->total_bytes_written();
+    for (int i = 0; i < row_group_writer_->num_columns(); i++) {
+      size += row_group_writer_->column(i)->estimated_buffered_value_bytes();
+    }
+    return size;
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -379,6 +508,8 @@ class FileWriterImpl : public FileWriter {
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
+  // Whether the current row group is buffered and accepts record batches
+  bool batch_row_group_open_;
 };
 
 FileWriter::~FileWriter() {}
@@ -27,6 +27,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -43,6 +44,9 @@ namespace arrow {
 ///
 /// Start a new RowGroup or Chunk with NewRowGroup.
 /// Write column-by-column the whole column chunk.
+///
+/// Alternatively, write RecordBatches with WriteRecordBatch, which buffers them
+/// into row groups of the size given by the WriterProperties.
 class PARQUET_EXPORT FileWriter {
  public:
   static ::arrow::Status Make(MemoryPool* pool, std::unique_ptr<ParquetFileWriter> writer,
@@ -67,6 +71,20 @@ class PARQUET_EXPORT FileWriter {
   virtual ::arrow::Status WriteTable(const ::arrow::Table& table, int64_t chunk_size) = 0;
 
   virtual ::arrow::Status NewRowGroup(int64_t chunk_size) = 0;
+
+  /// \brief Start a new buffered row group, to be filled by WriteRecordBatch.
+  ///
+  /// This closes the current row group, if any. It is only needed to cut a
+  /// row group before it reaches its maximum size.
+  virtual ::arrow::Status NewBufferedRowGroup() = 0;
+
+  /// \brief Append a RecordBatch to the current buffered row group.
+  ///
+  /// The encoded pages of a row group are held in memory until it is closed,
+  /// which happens once it holds WriterProperties::max_row_group_length() rows
+  /// (the batch is split if needed) or once its estimated encoded size reaches
+  /// WriterProperties::max_row_group_bytes() after a batch is written.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
   virtual ::arrow::Status WriteColumnChunk(const ::arrow::Array& data) = 0;
 
   /// \brief Write ColumnChunk in row group using slice of a ChunkedArray
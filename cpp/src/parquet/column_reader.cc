@@ -18,9 +18,12 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -32,15 +35,19 @@
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing_internal.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -212,17 +219,128 @@ EncodedStatistics ExtractStatsFromHeader(const H& header) {
 // This subclass delimits pages appearing in a serialized stream, each preceded
 // by a serialized Thrift format::PageHeader indicating the type of each page
 // and the page metadata.
+// Decompress a page into `out`, which must hold uncompressed_len bytes.  The first
+// levels_byte_len bytes (the levels of a V2 data page) are stored uncompressed.
+void DecompressPage(::arrow::util::Codec* codec, const Buffer& page_buffer,
+                    int compressed_len, int uncompressed_len, int levels_byte_len,
+                    uint8_t* out) {
+  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
+    throw ParquetException("Invalid page header");
+  }
+
+  if (levels_byte_len > 0) {
+    // First copy the levels as-is
+    memcpy(out, page_buffer.data(), levels_byte_len);
+  }
+
+  ARROW_TRACE_SPAN(span, "parquet::DecompressPage");
+  ARROW_TRACE_SPAN_ATTRIBUTE(span, "compressed_bytes", compressed_len);
+  ARROW_TRACE_SPAN_ATTRIBUTE(span, "uncompressed_bytes", uncompressed_len);
+
+  // Decompress the values
+  PARQUET_THROW_NOT_OK(codec->Decompress(
+      compressed_len - levels_byte_len, page_buffer.data() + levels_byte_len,
+      uncompressed_len - levels_byte_len, out + levels_byte_len));
+}
+
+// A page read from the stream, whose data may still need to be decrypted and
+// decompressed
+struct CompressedPage {
+  std::shared_ptr<Buffer> buffer;
+  int compressed_len = 0;
+  int uncompressed_len = 0;
+  int levels_byte_len = 0;
+  bool needs_decompression = false;
+  // Set if the buffer is still encrypted
+  std::shared_ptr<Decryptor> decryptor;
+  // Builds the page from its uncompressed data
+  std::function<std::shared_ptr<Page>(std::shared_ptr<Buffer>)> make_page;
+};
+
+// A page decrypted and decompressed ahead of its use by a task on the CPU thread pool.
+//
+// Whichever of the task and the reader gets to the page first decompresses it, so
+// that a reader running on a pool thread never waits for a task queued behind it.
+class ReadaheadPage {
+ public:
+  ReadaheadPage(CompressedPage page, Compression::type codec, ::arrow::MemoryPool* pool)
+      : compressed_page_(std::move(page)), codec_(codec), pool_(pool) {}
+
+  static void Schedule(const std::shared_ptr<ReadaheadPage>& page) {
+    // If the task can't be spawned, the reader decompresses the page itself
+    ARROW_UNUSED(::arrow::internal::GetCpuThreadPool()->Spawn([page] { page->Run(); }));
+  }
+
+  int64_t uncompressed_len() const { return compressed_page_.uncompressed_len; }
+
+  std::shared_ptr<Page> Get() {
+    Run();
+    done_.Wait();
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+    return page_;
+  }
+
+ private:
+  void Run() {
+    if (claimed_.exchange(true)) {
+      return;
+    }
+    try {
+      std::shared_ptr<Buffer> buffer = compressed_page_.buffer;
+      int compressed_len = compressed_page_.compressed_len;
+      if (compressed_page_.decryptor != nullptr) {
+        Decryptor* decryptor = compressed_page_.decryptor.get();
+        std::shared_ptr<ResizableBuffer> decrypted =
+            AllocateBuffer(pool_, compressed_len - decryptor->CiphertextSizeDelta());
+        compressed_len =
+            decryptor->Decrypt(buffer->data(), compressed_len, decrypted->mutable_data());
+        buffer = std::move(decrypted);
+      }
+      if (compressed_page_.needs_decompression) {
+        std::shared_ptr<ResizableBuffer> decompressed =
+            AllocateBuffer(pool_, compressed_page_.uncompressed_len);
+        DecompressPage(GetCodec(codec_).get(), *buffer, compressed_len,
+                       compressed_page_.uncompressed_len,
+                       compressed_page_.levels_byte_len, decompressed->mutable_data());
+        buffer = std::move(decompressed);
+      }
+      page_ = compressed_page_.make_page(std::move(buffer));
+    } catch (...) {
+      error_ = std::current_exception();
+    }
+    compressed_page_.buffer.reset();
+    compressed_page_.decryptor.reset();
+    done_.MarkFinished();
+  }
+
+  CompressedPage compressed_page_;
+  // Codecs may not be shareable between threads, so each page makes its own
+  const Compression::type codec_;
+  ::arrow::MemoryPool* pool_;
+  std::atomic<bool> claimed_{false};
+  ::arrow::Future<> done_ = ::arrow::Future<>::Make();
+  std::shared_ptr<Page> page_;
+  std::exception_ptr error_;
+};
+
 class SerializedPageReader : public PageReader {
  public:
   SerializedPageReader(std::shared_ptr<ArrowInputStream> stream, int64_t total_num_rows,
                        Compression::type codec, ::arrow::MemoryPool* pool,
-                       const CryptoContext* crypto_ctx)
+                       const CryptoContext* crypto_ctx, int32_t readahead_pages = 0,
+                       int64_t readahead_bytes = 0)
       : stream_(std::move(stream)),
+        pool_(pool),
+        codec_(codec),
         decompression_buffer_(AllocateBuffer(pool, 0)),
         page_ordinal_(0),
         seen_num_rows_(0),
         total_num_rows_(total_num_rows),
-        decryption_buffer_(AllocateBuffer(pool, 0)) {
+        decryption_buffer_(AllocateBuffer(pool, 0)),
+        readahead_pages_(readahead_pages),
+        readahead_bytes_(readahead_bytes) {
     if (crypto_ctx != nullptr) {
       crypto_ctx_ = *crypto_ctx;
       InitDecryption();
@@ -242,11 +360,29 @@ class SerializedPageReader : public PageReader {
 
   void InitDecryption();
 
+  // Whether the current page is a data page that data_page_filter_ skips
+  bool ShouldSkipDataPage();
+
+  // Read the next page from the stream, without decompressing it.  Returns false
+  // at the end of the column chunk.
+  bool ReadCompressedPage(CompressedPage* out);
+
+  // Read pages ahead until readahead_pages_ or readahead_bytes_ is reached, and
+  // schedule their decompression
+  void FillReadahead();
+
   std::shared_ptr<Buffer> DecompressIfNeeded(std::shared_ptr<Buffer> page_buffer,
                                              int compressed_len, int uncompressed_len,
                                              int levels_byte_len = 0);
 
+  bool readahead_enabled() const {
+    return readahead_pages_ > 0 &&
+           (decompressor_ != nullptr || crypto_ctx_.data_decryptor != nullptr);
+  }
+
   std::shared_ptr<ArrowInputStream> stream_;
+  ::arrow::MemoryPool* pool_;
+  const Compression::type codec_;
 
   format::PageHeader current_page_header_;
   std::shared_ptr<Page> current_page_;
@@ -284,6 +420,13 @@ class SerializedPageReader : public PageReader {
   std::string data_page_header_aad_;
   // Encryption
   std::shared_ptr<ResizableBuffer> decryption_buffer_;
+
+  // Pages read ahead of the current one, in order
+  const int32_t readahead_pages_;
+  const int64_t readahead_bytes_;
+  std::deque<std::shared_ptr<ReadaheadPage>> readahead_;
+  int64_t readahead_uncompressed_bytes_ = 0;
+  bool end_of_chunk_ = false;
 };
 
 void SerializedPageReader::InitDecryption() {
@@ -318,6 +461,52 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (!readahead_enabled()) {
+    CompressedPage page;
+    if (!ReadCompressedPage(&page)) {
+      return std::shared_ptr<Page>(nullptr);
+    }
+    std::shared_ptr<Buffer> page_buffer = std::move(page.buffer);
+    if (page.needs_decompression) {
+      page_buffer = DecompressIfNeeded(std::move(page_buffer), page.compressed_len,
+                                       page.uncompressed_len, page.levels_byte_len);
+    }
+    return page.make_page(std::move(page_buffer));
+  }
+
+  FillReadahead();
+  if (readahead_.empty()) {
+    return std::shared_ptr<Page>(nullptr);
+  }
+  std::shared_ptr<ReadaheadPage> next = std::move(readahead_.front());
+  readahead_.pop_front();
+  readahead_uncompressed_bytes_ -= next->uncompressed_len();
+  // Keep the following pages decompressing while this one is decoded
+  FillReadahead();
+  return next->Get();
+}
+
+void SerializedPageReader::FillReadahead() {
+  while (!end_of_chunk_ &&
+         (readahead_.empty() ||
+          (static_cast<int32_t>(readahead_.size()) < readahead_pages_ &&
+           readahead_uncompressed_bytes_ < readahead_bytes_))) {
+    CompressedPage page;
+    if (!ReadCompressedPage(&page)) {
+      end_of_chunk_ = true;
+      break;
+    }
+    readahead_uncompressed_bytes_ += page.uncompressed_len;
+    const bool needs_task = page.needs_decompression || page.decryptor != nullptr;
+    auto readahead_page = std::make_shared<ReadaheadPage>(std::move(page), codec_, pool_);
+    if (needs_task) {
+      ReadaheadPage::Schedule(readahead_page);
+    }
+    readahead_.push_back(std::move(readahead_page));
+  }
+}
+
+bool SerializedPageReader::ReadCompressedPage(CompressedPage* out) {
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
 
@@ -331,7 +520,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
       if (view.size() == 0) {
-        return std::shared_ptr<Page>(nullptr);
+        return false;
       }
 
       // This gets used, then set by DeserializeThriftMsg
@@ -364,6 +553,11 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       throw ParquetException("Invalid page header");
     }
 
+    if (data_page_filter_ && ShouldSkipDataPage()) {
+      PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      continue;
+    }
+
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -378,8 +572,11 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       ParquetException::EofException(ss.str());
     }
 
-    // Decrypt it if we need to
-    if (crypto_ctx_.data_decryptor != nullptr) {
+    // Decrypt it if we need to. Pages read ahead are decrypted by their task, with a
+    // decryptor of their own as the tasks may run concurrently.
+    if (crypto_ctx_.data_decryptor != nullptr && readahead_enabled()) {
+      out->decryptor = crypto_ctx_.data_decryptor->Clone();
+    } else if (crypto_ctx_.data_decryptor != nullptr) {
       PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
           compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(), false));
       compressed_len = crypto_ctx_.data_decryptor->Decrypt(
@@ -388,6 +585,12 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       page_buffer = decryption_buffer_;
     }
 
+    out->buffer = std::move(page_buffer);
+    out->compressed_len = compressed_len;
+    out->uncompressed_len = uncompressed_len;
+    out->levels_byte_len = 0;
+    out->needs_decompression = decompressor_ != nullptr;
+
     const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
 
     if (page_type == PageType::DICTIONARY_PAGE) {
@@ -400,13 +603,13 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
         throw ParquetException("Invalid page header (negative number of values)");
       }
 
-      // Uncompress if needed
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
+      const int32_t num_values = dict_header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&dict_header.encoding);
+      out->make_page = [=](std::shared_ptr<Buffer> page_buffer) {
+        return std::make_shared<DictionaryPage>(std::move(page_buffer), num_values,
+                                                encoding, is_sorted);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
@@ -417,15 +620,18 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       EncodedStatistics page_statistics = ExtractStatsFromHeader(header);
       seen_num_rows_ += header.num_values;
 
-      // Uncompress if needed
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(page_buffer, header.num_values,
-                                          LoadEnumSafe(&header.encoding),
-                                          LoadEnumSafe(&header.definition_level_encoding),
-                                          LoadEnumSafe(&header.repetition_level_encoding),
-                                          uncompressed_len, page_statistics);
+      const int32_t num_values = header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const Encoding::type definition_level_encoding =
+          LoadEnumSafe(&header.definition_level_encoding);
+      const Encoding::type repetition_level_encoding =
+          LoadEnumSafe(&header.repetition_level_encoding);
+      out->make_page = [=](std::shared_ptr<Buffer> page_buffer) {
+        return std::make_shared<DataPageV1>(
+            std::move(page_buffer), num_values, encoding, definition_level_encoding,
+            repetition_level_encoding, uncompressed_len, page_statistics);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
@@ -447,25 +653,61 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
                           header.repetition_levels_byte_length, &levels_byte_len)) {
         throw ParquetException("Levels size too large (corrupt file?)");
       }
-      // DecompressIfNeeded doesn't take `is_compressed` into account as
-      // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
-      }
-
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          page_statistics);
+      out->levels_byte_len = levels_byte_len;
+      out->needs_decompression = out->needs_decompression && is_compressed;
+
+      const int32_t num_values = header.num_values;
+      const int32_t num_nulls = header.num_nulls;
+      const int32_t num_rows = header.num_rows;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const int32_t definition_levels_byte_length = header.definition_levels_byte_length;
+      const int32_t repetition_levels_byte_length = header.repetition_levels_byte_length;
+      out->make_page = [=](std::shared_ptr<Buffer> page_buffer) {
+        return std::make_shared<DataPageV2>(
+            std::move(page_buffer), num_values, num_nulls, num_rows, encoding,
+            definition_levels_byte_length, repetition_levels_byte_length,
+            uncompressed_len, is_compressed, page_statistics);
+      };
+      return true;
     } else {
       // We don't know what this page type is. We're allowed to skip non-data
       // pages.
       continue;
     }
   }
-  return std::shared_ptr<Page>(nullptr);
+  return false;
+}
+
+bool SerializedPageReader::ShouldSkipDataPage() {
+  const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+  EncodedStatistics page_statistics;
+  DataPageStats stats;
+  stats.page_ordinal = page_ordinal_;
+  if (page_type == PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = current_page_header_.data_page_header;
+    page_statistics = ExtractStatsFromHeader(header);
+    stats.num_values = header.num_values;
+    stats.num_rows = -1;
+  } else if (page_type == PageType::DATA_PAGE_V2) {
+    const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
+    page_statistics = ExtractStatsFromHeader(header);
+    stats.num_values = header.num_values;
+    stats.num_rows = header.num_rows;
+  } else {
+    return false;
+  }
+  if (stats.num_values < 0) {
+    throw ParquetException("Invalid page header (negative number of values)");
+  }
+  stats.encoded_statistics = &page_statistics;
+  if (!data_page_filter_(stats)) {
+    return false;
+  }
+  // Keep the page ordinal (used in encryption AADs) and row count in sync with
+  // the pages actually in the column chunk
+  ++page_ordinal_;
+  seen_num_rows_ += stats.num_values;
+  return true;
 }
 
 std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
@@ -474,27 +716,13 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   if (decompressor_ == nullptr) {
     return page_buffer;
   }
-  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
-    throw ParquetException("Invalid page header");
-  }
 
   // Grow the uncompressed buffer if we need to.
   if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
     PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
   }
-
-  if (levels_byte_len > 0) {
-    // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer->data(), levels_byte_len);
-  }
-
-  // Decompress the values
-  PARQUET_THROW_NOT_OK(decompressor_->Decompress(
-      compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
-      uncompressed_len - levels_byte_len,
-      decompression_buffer_->mutable_data() + levels_byte_len));
-
+  DecompressPage(decompressor_.get(), *page_buffer, compressed_len, uncompressed_len,
+                 levels_byte_len, decompression_buffer_->mutable_data());
   return decompression_buffer_;
 }
 
@@ -509,6 +737,16 @@ std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> s
       new SerializedPageReader(std::move(stream), total_num_rows, codec, pool, ctx));
 }
 
+std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
+                                             int64_t total_num_rows,
+                                             Compression::type codec,
+                                             const ReaderProperties& properties,
+                                             const CryptoContext* ctx) {
+  return std::unique_ptr<PageReader>(new SerializedPageReader(
+      std::move(stream), total_num_rows, codec, properties.memory_pool(), ctx,
+      properties.page_readahead(), properties.page_readahead_bytes()));
+}
+
 namespace {
 
 // ----------------------------------------------------------------------
@@ -765,8 +1003,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -774,11 +1015,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1192,6 +1428,77 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    DCHECK_EQ(values_written_, 0);
+    int64_t records_skipped = 0;
+
+    if (levels_position_ < levels_written_) {
+      records_skipped += SkipRecordData(num_records);
+    }
+
+    // Skipped levels are discarded batch by batch, so keep the batches small
+    const int64_t level_batch_size = kMinLevelBatchSize;
+
+    while (!at_record_start_ || records_skipped < num_records) {
+      if (!this->HasNextInternal()) {
+        if (!at_record_start_) {
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+
+      // Levels already skipped are not needed anymore
+      if (levels_position_ == levels_written_) {
+        levels_position_ = levels_written_ = 0;
+      }
+
+      if (this->max_rep_level_ == 0 &&
+          available_values_current_page() <= num_records - records_skipped) {
+        // Each level of a flat column is a record: drop the rest of the page
+        records_skipped += available_values_current_page();
+        this->ConsumeBufferedValues(available_values_current_page());
+        continue;
+      }
+
+      int64_t batch_size = std::min(level_batch_size, available_values_current_page());
+      if (batch_size == 0) {
+        break;
+      }
+
+      if (this->max_def_level_ > 0) {
+        ReserveLevels(batch_size);
+
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        int16_t* rep_levels = this->rep_levels() + levels_written_;
+
+        int64_t levels_read = 0;
+        if (this->max_rep_level_ > 0) {
+          levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+          if (this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+            throw ParquetException("Number of decoded rep / def levels did not match");
+          }
+        } else {
+          levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+        }
+
+        if (levels_read == 0) {
+          break;
+        }
+
+        levels_written_ += levels_read;
+        records_skipped += SkipRecordData(num_records - records_skipped);
+      } else {
+        batch_size = std::min(num_records - records_skipped, batch_size);
+        SkipValues(batch_size);
+        this->ConsumeBufferedValues(batch_size);
+        records_skipped += batch_size;
+      }
+    }
+
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1445,6 +1752,46 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  // Skip up to num_records records from the written levels, decoding the values they
+  // hold into scratch space. Return the number of records skipped
+  int64_t SkipRecordData(int64_t num_records) {
+    const int64_t start_levels_position = levels_position_;
+
+    int64_t values_to_skip = 0;
+    int64_t records_skipped = 0;
+    if (this->max_rep_level_ > 0) {
+      records_skipped = DelimitRecords(num_records, &values_to_skip);
+    } else {
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      const int16_t* def_levels = this->def_levels() + levels_position_;
+      values_to_skip = std::count(def_levels, def_levels + records_skipped,
+                                  this->max_def_level_);
+      levels_position_ += records_skipped;
+    }
+
+    SkipValues(values_to_skip);
+    this->ConsumeBufferedValues(levels_position_ - start_levels_position);
+    return records_skipped;
+  }
+
+  void SkipValues(int64_t num_values) {
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (num_values == 0) {
+      return;
+    }
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(kSkipBatchSize, num_values));
+      if (this->current_decoder_->Decode(scratch, batch_size) != batch_size) {
+        throw ParquetException("Could not skip values: end of page reached");
+      }
+      num_values -= batch_size;
+    }
+  }
+
   void DebugPrintState() override {
     const int16_t* def_levels = this->def_levels();
     const int16_t* rep_levels = this->rep_levels();
@@ -1490,6 +1837,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
   LevelInfo leaf_info_;
+  // Values decoded by SkipRecords are thrown away here
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1587,13 +1936,23 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+// Reads values of any dictionary-encodable type as an Arrow dictionary array of
+// the physical type. Column chunks with identical dictionaries (as is common for
+// low-cardinality columns) are accumulated into the same chunk, without
+// re-inserting the dictionary into the builder.
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool), builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                             ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, leaf_info, pool),
+        builder_(PhysicalArrowType(descr), pool),
+        pool_(pool) {
     this->read_dictionary_ = true;
+    // Values are decoded directly into the builder
+    this->uses_values_ = false;
+    this->values_.reset();
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
@@ -1609,63 +1968,93 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
       result_chunks_.emplace_back(std::move(chunk));
 
-      // Also clears the dictionary memo table
+      // Keeps the dictionary memo table
       builder_.Reset();
     }
   }
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+      auto dictionary = decoder->GetDictionaryArray();
+      // If the dictionary is the one in the builder's memo, its indices stay valid
+      if (last_dictionary_ == nullptr || !last_dictionary_->Equals(*dictionary)) {
+        /// If there is a new dictionary, we may need to flush the builder, then
+        /// insert the new dictionary values
+        FlushBuilder();
+        builder_.ResetFull();
+        decoder->InsertDictionary(&builder_);
+        // Keep a copy, since the decoder reuses its memory for the next dictionary
+        PARQUET_ASSIGN_OR_THROW(last_dictionary_,
+                                ::arrow::Concatenate({dictionary}, pool_));
+      }
       this->new_dictionary_ = false;
     }
   }
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  static std::shared_ptr<::arrow::DataType> PhysicalArrowType(
+      const ColumnDescriptor* descr) {
+    switch (descr->physical_type()) {
+      case Type::INT32:
+        return ::arrow::int32();
+      case Type::INT64:
+        return ::arrow::int64();
+      case Type::FLOAT:
+        return ::arrow::float32();
+      case Type::DOUBLE:
+        return ::arrow::float64();
+      case Type::BYTE_ARRAY:
+        return ::arrow::binary();
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return ::arrow::fixed_size_binary(descr->type_length());
+      default:
+        throw ParquetException("Cannot read column of physical type ",
+                               TypeToString(descr->physical_type()),
+                               " directly as dictionary");
+    }
+  }
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
+  ::arrow::MemoryPool* pool_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+  // A copy of the dictionary last inserted into the builder's memo
+  std::shared_ptr<::arrow::Array> last_dictionary_;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -1683,12 +2072,25 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         ::arrow::MemoryPool* pool,
                                                         bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool);
+    return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(descr, leaf_info,
+                                                                      pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool);
   }
 }
 
+template <typename DType, typename RecordReaderType = TypedRecordReader<DType>>
+std::shared_ptr<RecordReader> MakeFixedWidthRecordReader(const ColumnDescriptor* descr,
+                                                         LevelInfo leaf_info,
+                                                         ::arrow::MemoryPool* pool,
+                                                         bool read_dictionary) {
+  if (read_dictionary) {
+    return std::make_shared<DictionaryRecordReaderImpl<DType>>(descr, leaf_info, pool);
+  } else {
+    return std::make_shared<RecordReaderType>(descr, leaf_info, pool);
+  }
+}
+
 }  // namespace
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
@@ -1698,19 +2100,24 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<Int32Type>(descr, leaf_info, pool,
+                                                   read_dictionary);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<Int64Type>(descr, leaf_info, pool,
+                                                   read_dictionary);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, leaf_info, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<FloatType>(descr, leaf_info, pool,
+                                                   read_dictionary);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<DoubleType>(descr, leaf_info, pool,
+                                                    read_dictionary);
     case Type::BYTE_ARRAY:
       return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::make_shared<FLBARecordReader>(descr, leaf_info, pool);
+      return MakeFixedWidthRecordReader<FLBAType, FLBARecordReader>(
+          descr, leaf_info, pool, read_dictionary);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
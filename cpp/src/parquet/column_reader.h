@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -46,7 +47,9 @@ class RleDecoder;
 namespace parquet {
 
 class Decryptor;
+class EncodedStatistics;
 class Page;
+class ReaderProperties;
 
 // 16 MB is the default maximum page header size
 static constexpr uint32_t kDefaultMaxPageHeaderSize = 16 * 1024 * 1024;
@@ -96,10 +99,28 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+// What a data page filter knows about a data page, from its header
+struct DataPageStats {
+  // Statistics from the page header, possibly unset
+  const EncodedStatistics* encoded_statistics;
+  // Number of values (including nulls) in the page. For non-repeated columns,
+  // this is the number of rows.
+  int32_t num_values;
+  // Number of rows in the page, or -1 for DATA_PAGE (V1) pages which don't
+  // record it
+  int32_t num_rows;
+  // Ordinal of the page among the data pages of the column chunk, matching its
+  // position in the OffsetIndex
+  int32_t page_ordinal;
+};
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
  public:
+  // Returns true if the data page should be skipped
+  using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
   virtual ~PageReader() = default;
 
   static std::unique_ptr<PageReader> Open(
@@ -107,11 +128,30 @@ class PARQUET_EXPORT PageReader {
       Compression::type codec, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       const CryptoContext* ctx = NULLPTR);
 
+  // As above, with the memory pool and page readahead taken from the properties
+  static std::unique_ptr<PageReader> Open(std::shared_ptr<ArrowInputStream> stream,
+                                          int64_t total_num_rows,
+                                          Compression::type codec,
+                                          const ReaderProperties& properties,
+                                          const CryptoContext* ctx = NULLPTR);
+
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Skip the data pages the filter selects. Skipped pages are neither decrypted
+  // nor decompressed, and NextPage() doesn't return them. Since this drops
+  // rows, callers reading several columns must skip the same rows in each of
+  // them, e.g. by selecting pages from the OffsetIndex of a column whose pages
+  // are aligned with the others'.
+  void set_data_page_filter(DataPageFilter data_page_filter) {
+    data_page_filter_ = std::move(data_page_filter);
+  }
+
+ protected:
+  DataPageFilter data_page_filter_;
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -223,6 +263,14 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records from the column chunk. Their
+  /// values are decoded but not written out, and data pages made only of skipped
+  /// records of a flat column are dropped without being decoded
+  ///
+  /// No records may be pending, i.e. call Reset() first after ReadRecords
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -313,7 +361,7 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for all physical types but BOOLEAN and INT96
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
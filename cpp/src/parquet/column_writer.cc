@@ -33,6 +33,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -42,6 +43,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/visitor_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -161,6 +163,28 @@ inline const T* AddIfNotNull(const T* base, int64_t offset) {
   return nullptr;
 }
 
+// Hash a physical value the way BloomFilter::Hash expects it
+template <typename T>
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                const T& value) {
+  return filter.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                const Int96& value) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor*,
+                                const ByteArray& value) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ColumnDescriptor* descr,
+                                const FLBA& value) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
 }  // namespace
 
 LevelEncoder::LevelEncoder() {}
@@ -337,6 +361,8 @@ class SerializedPageWriter : public PageWriter {
                       meta_encryptor_);
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
+    metadata_->WritePageIndex(sink_.get());
+    metadata_->WriteBloomFilter(sink_.get());
   }
 
   /**
@@ -401,6 +427,8 @@ class SerializedPageWriter : public PageWriter {
     const int64_t header_size =
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
+    metadata_->AddPageLocation(start_pos,
+                               static_cast<int32_t>(header_size + output_data_len));
 
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
@@ -576,6 +604,9 @@ class BufferedPageWriter : public PageWriter {
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
+    // Page locations were recorded relative to the in-memory sink
+    metadata_->WritePageIndex(in_memory_sink_.get(), final_position);
+    metadata_->WriteBloomFilter(in_memory_sink_.get(), final_position);
 
     // flush everything to the serialized sink
     PARQUET_ASSIGN_OR_THROW(auto buffer, in_memory_sink_->Finish());
@@ -644,6 +675,7 @@ class ColumnWriterImpl {
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
         rows_written_(0),
+        page_first_row_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
@@ -682,6 +714,10 @@ class ColumnWriterImpl {
   // Merges page statistics into chunk statistics, then resets the values
   virtual void ResetPageStatistics() = 0;
 
+  // Truncates or drops the min/max longer than the max statistics size and sets
+  // the sort order
+  void FinishStatistics(EncodedStatistics* statistics);
+
   // Adds Data Pages to an in memory buffer in dictionary encoding mode
   // Serializes the Data Pages in other encoding modes
   void AddDataPage();
@@ -750,6 +786,9 @@ class ColumnWriterImpl {
   // Total number of rows written with this ColumnWriter
   int rows_written_;
 
+  // Index of the first row of the data page being buffered
+  int64_t page_first_row_;
+
   // Records the total number of uncompressed bytes written by the serializer
   int64_t total_bytes_written_;
 
@@ -853,10 +892,27 @@ void ColumnWriterImpl::AddDataPage() {
 
   // Re-initialize the sinks for next Page.
   InitSinks();
+  page_first_row_ = rows_written_;
   num_buffered_values_ = 0;
   num_buffered_encoded_values_ = 0;
 }
 
+void ColumnWriterImpl::FinishStatistics(EncodedStatistics* statistics) {
+  const size_t max_size = properties_->max_statistics_size(descr_->path());
+  const SortOrder::type sort_order = descr_->sort_order();
+  // Prefixes of values ordered bytewise bound them, other values can't be truncated
+  if (descr_->physical_type() == Type::BYTE_ARRAY && sort_order == SortOrder::UNSIGNED &&
+      properties_->statistics_truncation_enabled(descr_->path())) {
+    const auto& logical_type = descr_->logical_type();
+    const bool is_utf8 = logical_type != nullptr &&
+                         (logical_type->is_string() || logical_type->is_JSON());
+    statistics->TruncateMinMax(max_size, is_utf8);
+  } else {
+    statistics->ApplyStatSizeLimits(max_size);
+  }
+  statistics->set_is_signed(SortOrder::SIGNED == sort_order);
+}
+
 void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
                                        int64_t repetition_levels_rle_size,
                                        int64_t uncompressed_size,
@@ -868,9 +924,9 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
                      uncompressed_data_->mutable_data());
 
   EncodedStatistics page_stats = GetPageStatistics();
-  page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
-  page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
+  FinishStatistics(&page_stats);
   ResetPageStatistics();
+  metadata_->AddPageIndexEntry(page_stats, page_first_row_, num_buffered_values_);
 
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
@@ -923,9 +979,9 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                      compressed_values, combined->mutable_data());
 
   EncodedStatistics page_stats = GetPageStatistics();
-  page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
-  page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
+  FinishStatistics(&page_stats);
   ResetPageStatistics();
+  metadata_->AddPageIndexEntry(page_stats, page_first_row_, num_buffered_values_);
 
   int32_t num_values = static_cast<int32_t>(num_buffered_values_);
   int32_t null_count = static_cast<int32_t>(page_stats.null_count);
@@ -960,9 +1016,7 @@ int64_t ColumnWriterImpl::Close() {
     FlushBufferedDataPages();
 
     EncodedStatistics chunk_statistics = GetChunkStatistics();
-    chunk_statistics.ApplyStatSizeLimits(
-        properties_->max_statistics_size(descr_->path()));
-    chunk_statistics.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
+    FinishStatistics(&chunk_statistics);
 
     // Write stats only if the column has at least one row written
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
@@ -1043,6 +1097,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+    bloom_filter_ = metadata->bloom_filter();
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -1201,6 +1256,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   int64_t total_bytes_written() const override { return total_bytes_written_; }
 
+  int64_t estimated_buffered_value_bytes() const override {
+    int64_t size = EstimatedBufferedValueBytes();
+    if (has_dictionary_ && !fallback_) {
+      size += dynamic_cast<DictEncoder<DType>*>(current_encoder_.get())
+                  ->dict_encoded_size();
+    }
+    return size;
+  }
+
   const WriterProperties* properties() override { return properties_; }
 
  private:
@@ -1209,6 +1273,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::unique_ptr<Encoder> current_encoder_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  // Owned by the column chunk metadata builder, null unless requested
+  BloomFilter* bloom_filter_ = nullptr;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1355,16 +1421,16 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
       fallback_ = true;
-      // Only PLAIN encoding is supported for fallback in V1
-      current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+      // Fall back to the column's configured (non-dictionary) encoding
+      encoding_ = properties_->encoding(descr_->path());
+      current_encoder_ = MakeEncoder(DType::type_num, encoding_, false, descr_,
                                      properties_->memory_pool());
-      encoding_ = Encoding::PLAIN;
     }
   }
 
   // Checks if the Dictionary Page size limit is reached
   // If the limit is reached, the Dictionary and Data Pages are serialized
-  // The encoding is switched to PLAIN
+  // The encoding is switched to the fallback encoding
   //
   // Only one Dictionary Page is written.
   // Fallback to PLAIN if dictionary page limit is reached.
@@ -1389,6 +1455,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1406,6 +1477,27 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      ::arrow::internal::VisitSetBitRunsVoid(
+          valid_bits, valid_bits_offset, num_spaced_values,
+          [&](int64_t position, int64_t length) {
+            for (int64_t i = position; i < position + length; ++i) {
+              bloom_filter_->InsertHash(
+                  BloomFilterHash(*bloom_filter_, descr_, values[i]));
+            }
+          });
+    }
+  }
+
+  // Insert the non-null values of a binary-like array into the bloom filter
+  template <typename ArrayType>
+  void UpdateBloomFilterBinary(const ArrayType& array) {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsValid(i)) {
+        const ByteArray value(array.GetView(i));
+        bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+      }
+    }
   }
 };
 
@@ -1437,13 +1529,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. A bloom filter needs the
+    // physical values, so it also takes the dense path.
     return WriteDense();
   }
 
@@ -1901,6 +1994,14 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      if (::arrow::is_large_binary_like(data_slice->type_id())) {
+        UpdateBloomFilterBinary(
+            checked_cast<const ::arrow::LargeBinaryArray&>(*data_slice));
+      } else {
+        UpdateBloomFilterBinary(checked_cast<const ::arrow::BinaryArray&>(*data_slice));
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
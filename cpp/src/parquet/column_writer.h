@@ -138,6 +138,10 @@ class PARQUET_EXPORT ColumnWriter {
   /// dictionary pages to the ColumnChunk so far
   virtual int64_t total_bytes_written() const = 0;
 
+  /// \brief An estimate of the encoded size of the values not written to a page
+  /// yet, including the dictionary of a dictionary-encoded column
+  virtual int64_t estimated_buffered_value_bytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
@@ -93,7 +93,8 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
   std::shared_ptr<TypedColumnWriter<TestType>> BuildWriter(
       int64_t output_size = SMALL_SIZE,
       const ColumnProperties& column_properties = ColumnProperties(),
-      const ParquetVersion::type version = ParquetVersion::PARQUET_1_0) {
+      const ParquetVersion::type version = ParquetVersion::PARQUET_1_0,
+      Encoding::type fallback_encoding = Encoding::PLAIN) {
     sink_ = CreateOutputStream();
     WriterProperties::Builder wp_builder;
     wp_builder.version(version);
@@ -101,6 +102,7 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
         column_properties.encoding() == Encoding::RLE_DICTIONARY) {
       wp_builder.enable_dictionary();
       wp_builder.dictionary_pagesize_limit(DICTIONARY_PAGE_SIZE);
+      wp_builder.encoding(fallback_encoding);
     } else {
       wp_builder.disable_dictionary();
       wp_builder.encoding(column_properties.encoding());
@@ -419,22 +421,23 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
 }
+*/
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
-}
+// The DELTA_* encodings only support some physical types
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+using TestInt32ValuesWriter = TestPrimitiveWriter<Int32Type>;
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+
+TEST_F(TestInt32ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -684,8 +687,40 @@ TEST_F(TestBooleanValuesWriter, AlternateBooleanValues) {
 }
 
 // PARQUET-979
-// Prevent writing large MIN, MAX stats
 using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, DictionaryFallbackToDeltaByteArray) {
+  // Once the dictionary grows too large, the configured encoding is used
+  this->GenerateData(VERY_LARGE_SIZE);
+  ColumnProperties column_properties;
+  column_properties.set_encoding(Encoding::PLAIN_DICTIONARY);
+  auto writer =
+      this->BuildWriter(VERY_LARGE_SIZE, column_properties, ParquetVersion::PARQUET_1_0,
+                        Encoding::DELTA_BYTE_ARRAY);
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+
+  this->SetupValuesOut(VERY_LARGE_SIZE);
+  this->ReadColumnFully();
+  ASSERT_EQ(VERY_LARGE_SIZE, this->values_read_);
+  this->values_.resize(VERY_LARGE_SIZE);
+  ASSERT_EQ(this->values_, this->values_out_);
+
+  std::vector<Encoding::type> expected(
+      {Encoding::PLAIN_DICTIONARY, Encoding::PLAIN, Encoding::RLE,
+       Encoding::DELTA_BYTE_ARRAY});
+  ASSERT_EQ(this->metadata_encodings(), expected);
+}
+
+// Prevent writing large MIN, MAX stats
 TEST_F(TestByteArrayValuesWriter, OmitStats) {
   int min_len = 1024 * 4;
   int max_len = 1024 * 8;
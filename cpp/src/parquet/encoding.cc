@@ -20,9 +20,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -40,6 +42,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -928,6 +931,380 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// DELTA_BINARY_PACKED: a header holding the block size, the number of miniblocks
+// per block, the number of values and the first value, followed by blocks of the
+// deltas between consecutive values. Each block holds the minimum delta, the bit
+// width of each miniblock and the miniblocks of bit-packed deltas minus that
+// minimum. Deltas are computed with wrapping arithmetic, as the format requires.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        deltas_(kValuesPerBlock),
+        block_buffer_(AllocateBuffer(pool, kMaxBlockSize)),
+        sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const ::arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                                   this->memory_pool()));
+      T* data = reinterpret_cast<T*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<T>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  static constexpr int kMaxHeaderSize =
+      3 * ::arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+  static constexpr int kMaxBlockSize =
+      ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kMiniBlocksPerBlock +
+      kValuesPerBlock * sizeof(T);
+
+  // Bit-pack a delta; BitWriter packs at most 32 bits at a time
+  static void PutPacked(::arrow::BitUtil::BitWriter* writer, UT value, int bit_width) {
+    if (bit_width <= 32) {
+      writer->PutValue(static_cast<uint64_t>(value), bit_width);
+    } else {
+      writer->PutValue(static_cast<uint64_t>(value) & 0xFFFFFFFFULL, 32);
+      writer->PutValue(static_cast<uint64_t>(value) >> 32, bit_width - 32);
+    }
+  }
+
+  void FlushBlock();
+
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  uint32_t values_current_block_ = 0;
+  std::vector<T> deltas_;
+  std::shared_ptr<ResizableBuffer> block_buffer_;
+  ::arrow::BufferBuilder sink_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) return;
+
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  for (; idx < num_values; ++idx) {
+    const T value = src[idx];
+    deltas_[values_current_block_] = static_cast<T>(static_cast<UT>(value) -
+                                                    static_cast<UT>(current_value_));
+    current_value_ = value;
+    if (++values_current_block_ == kValuesPerBlock) FlushBlock();
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) return;
+
+  const T min_delta =
+      *std::min_element(deltas_.begin(), deltas_.begin() + values_current_block_);
+  ::arrow::BitUtil::BitWriter writer(block_buffer_->mutable_data(), kMaxBlockSize);
+  writer.PutZigZagVlqInt(min_delta);
+  uint8_t* bit_widths = writer.GetNextBytePtr(kMiniBlocksPerBlock);
+
+  for (uint32_t i = 0; i < kMiniBlocksPerBlock; ++i) {
+    const uint32_t start = i * kValuesPerMiniBlock;
+    if (start >= values_current_block_) {
+      // Unneeded miniblocks of the last block have no bits
+      bit_widths[i] = 0;
+      continue;
+    }
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT max_value = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      max_value = std::max(max_value, static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                                      static_cast<UT>(min_delta)));
+    }
+    const int bit_width = ::arrow::BitUtil::NumRequiredBits(max_value);
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+    for (uint32_t j = start; j < end; ++j) {
+      PutPacked(&writer, static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta),
+                bit_width);
+    }
+    // A miniblock is always padded to its full size
+    for (uint32_t j = end; j < start + kValuesPerMiniBlock; ++j) {
+      PutPacked(&writer, 0, bit_width);
+    }
+  }
+  writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(block_buffer_->data(), writer.bytes_written()));
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header_buffer[kMaxHeaderSize];
+  ::arrow::BitUtil::BitWriter header_writer(header_buffer, kMaxHeaderSize);
+  header_writer.PutVlqInt(kValuesPerBlock);
+  header_writer.PutVlqInt(kMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(first_value_);
+  header_writer.Flush();
+
+  const int header_size = header_writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_size + sink_.length());
+  std::memcpy(buffer->mutable_data(), header_buffer, header_size);
+  std::memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <>
+void DeltaBitPackEncoder<Int32Type>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != ::arrow::Type::INT32) {
+    throw ParquetException("direct put to Int32 from " + values.type()->ToString() +
+                           " not supported");
+  }
+  const auto& data = checked_cast<const ::arrow::Int32Array&>(values);
+  ::arrow::internal::VisitSetBitRunsVoid(
+      data.null_bitmap_data(), data.offset(), data.length(),
+      [&](int64_t position, int64_t length) {
+        Put(data.raw_values() + position, static_cast<int>(length));
+      });
+}
+
+template <>
+void DeltaBitPackEncoder<Int64Type>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != ::arrow::Type::INT64) {
+    throw ParquetException("direct put to Int64 from " + values.type()->ToString() +
+                           " not supported");
+  }
+  const auto& data = checked_cast<const ::arrow::Int64Array&>(values);
+  ::arrow::internal::VisitSetBitRunsVoid(
+      data.null_bitmap_data(), data.offset(), data.length(),
+      [&](int64_t position, int64_t length) {
+        Put(data.raw_values() + position, static_cast<int>(length));
+      });
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+// DELTA_LENGTH_BYTE_ARRAY: the lengths of the values, DELTA_BINARY_PACKED,
+// followed by the concatenated bytes of the values.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+    std::memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    std::memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      ::arrow::internal::VisitSetBitRunsVoid(
+          valid_bits, valid_bits_offset, num_values,
+          [&](int64_t position, int64_t length) {
+            Put(src + position, static_cast<int>(length));
+          });
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+  void Put(const uint8_t* data, uint32_t length) {
+    const int32_t signed_length = static_cast<int32_t>(length);
+    length_encoder_.Put(&signed_length, 1);
+    PARQUET_THROW_NOT_OK(sink_.Append(data, length));
+  }
+
+ private:
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          Put(reinterpret_cast<const uint8_t*>(view.data()),
+              static_cast<uint32_t>(view.size()));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+  }
+
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  ::arrow::BufferBuilder sink_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+// DELTA_BYTE_ARRAY (incremental encoding): the lengths of the prefixes each value
+// shares with the previous one, DELTA_BINARY_PACKED, followed by the remaining
+// suffixes, DELTA_LENGTH_BYTE_ARRAY.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    std::memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    std::memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+                suffixes->size());
+    // Each page starts over from an empty previous value
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(::arrow::util::string_view(reinterpret_cast<const char*>(src[i].ptr),
+                                     src[i].len));
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      ::arrow::internal::VisitSetBitRunsVoid(
+          valid_bits, valid_bits_offset, num_values,
+          [&](int64_t position, int64_t length) {
+            Put(src + position, static_cast<int>(length));
+          });
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  void Put(::arrow::util::string_view value) {
+    const size_t max_prefix = std::min(value.size(), last_value_.size());
+    size_t prefix = 0;
+    while (prefix < max_prefix && value[prefix] == last_value_[prefix]) ++prefix;
+
+    const int32_t prefix_length = static_cast<int32_t>(prefix);
+    prefix_length_encoder_.Put(&prefix_length, 1);
+    suffix_encoder_.Put(reinterpret_cast<const uint8_t*>(value.data()) + prefix,
+                        static_cast<uint32_t>(value.size() - prefix));
+    last_value_.assign(value.data(), value.size());
+  }
+
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          Put(view);
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1258,6 +1635,52 @@ struct ArrowBinaryHelper {
   int64_t chunk_space_remaining;
 };
 
+// Append decoded values, interleaved with nulls, to a dense binary accumulator
+Status AppendBinary(const std::vector<ByteArray>& values, int num_values,
+                    int null_count, const uint8_t* valid_bits,
+                    int64_t valid_bits_offset,
+                    typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  ArrowBinaryHelper helper(out);
+  RETURN_NOT_OK(helper.builder->Reserve(num_values));
+  auto it = values.begin();
+  int i = 0;
+  return VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const int32_t length = static_cast<int32_t>(it->len);
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(length))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+          RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+        }
+        RETURN_NOT_OK(helper.Append(it->ptr, length));
+        ++it;
+        ++i;
+        return Status::OK();
+      },
+      [&]() {
+        helper.UnsafeAppendNull();
+        ++i;
+        return Status::OK();
+      });
+}
+
+// Append decoded values, interleaved with nulls, to a dictionary builder
+Status AppendBinary(const std::vector<ByteArray>& values, int num_values,
+                    int null_count, const uint8_t* valid_bits,
+                    int64_t valid_bits_offset,
+                    typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  RETURN_NOT_OK(out->Reserve(num_values));
+  auto it = values.begin();
+  return VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = *it++;
+        return out->Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return out->AppendNull(); });
+}
+
 template <>
 inline int PlainDecoder<ByteArrayType>::DecodeArrow(
     int num_values, int null_count, const uint8_t* valid_bits, int64_t valid_bits_offset,
@@ -1514,6 +1937,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
                   int64_t valid_bits_offset,
                   typename EncodingTraits<Type>::DictAccumulator* out) override;
 
+  std::shared_ptr<::arrow::Array> GetDictionaryArray() override;
+
   void InsertDictionary(::arrow::ArrayBuilder* builder) override;
 
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
@@ -1542,9 +1967,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(builder, indices_buffer, num_values, valid_bytes.data());
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1563,8 +1986,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(builder, indices_buffer, num_values, /*valid_bytes=*/nullptr);
     num_values_ -= num_values;
     return num_values;
   }
@@ -1577,6 +1999,14 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     return Status::Invalid("Index not in dictionary bounds");
   }
 
+  // Append indices to the EncodingTraits<Type>::DictAccumulator builder
+  void AppendIndices(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                     int64_t length, const uint8_t* valid_bytes) {
+    auto dict_builder =
+        checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+    PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+  }
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -1608,6 +2038,18 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   ::arrow::util::RleDecoder idx_decoder_;
 };
 
+template <>
+void DictDecoderImpl<BooleanType>::AppendIndices(::arrow::ArrayBuilder*, const int32_t*,
+                                                 int64_t, const uint8_t*) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::AppendIndices(::arrow::ArrayBuilder*, const int32_t*,
+                                               int64_t, const uint8_t*) {
+  ParquetException::NYI("Reading INT96 values directly as dictionary");
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::SetDict(TypedDecoder<Type>* dictionary) {
   DecodeDict(dictionary);
@@ -1809,19 +2251,53 @@ int DictDecoderImpl<Type>::DecodeArrow(
   return num_values - null_count;
 }
 
+template <typename Type>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<Type>::GetDictionaryArray() {
+  // Fixed-width values are laid out the same in Parquet and Arrow
+  using ArrowType = typename EncodingTraits<Type>::Accumulator::TypeClass;
+  return std::make_shared<typename ::arrow::TypeTraits<ArrowType>::ArrayType>(
+      dictionary_length_, dictionary_);
+}
+
+template <>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<BooleanType>::GetDictionaryArray() {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<Int96Type>::GetDictionaryArray() {
+  ParquetException::NYI("Reading INT96 values directly as dictionary");
+}
+
+template <>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionaryArray() {
+  return std::make_shared<::arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                                byte_array_data_);
+}
+
+template <>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<FLBAType>::GetDictionaryArray() {
+  return std::make_shared<::arrow::FixedSizeBinaryArray>(
+      ::arrow::fixed_size_binary(descr_->type_length()), dictionary_length_,
+      byte_array_data_);
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  // The memo values are copied from the array referencing the decoder's memory
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*GetDictionaryArray()));
 }
 
 template <>
-void DictDecoderImpl<ByteArrayType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
-  auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
+void DictDecoderImpl<BooleanType>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
 
-  // Make a BinaryArray referencing the internal dictionary data
-  auto arr = std::make_shared<::arrow::BinaryArray>(
-      dictionary_length_, byte_array_offsets_, byte_array_data_);
-  PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(::arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Reading INT96 values directly as dictionary");
 }
 
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
@@ -2035,10 +2511,72 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+// Turn unpacked deltas into values: add the block's minimum delta to each delta and
+// compute the running sum, starting after last_value. Returns the last value.
+template <typename UT>
+UT DeltaPrefixSumScalar(UT* values, int num_values, UT min_delta, UT last_value) {
+  for (int i = 0; i < num_values; ++i) {
+    values[i] += min_delta;
+  }
+  for (int i = 0; i < num_values; ++i) {
+    last_value += values[i];
+    values[i] = last_value;
+  }
+  return last_value;
+}
+
+template <typename UT>
+UT DeltaPrefixSum(UT* values, int num_values, UT min_delta, UT last_value) {
+  return DeltaPrefixSumScalar(values, num_values, min_delta, last_value);
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+// In-register scans: log2(lanes) shifted additions compute the running sum of a
+// vector, to which the last value of the previous vector is added
+
+template <>
+uint32_t DeltaPrefixSum(uint32_t* values, int num_values, uint32_t min_delta,
+                        uint32_t last_value) {
+  const __m128i min = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+  __m128i carry = _mm_set1_epi32(static_cast<int32_t>(last_value));
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    __m128i* out = reinterpret_cast<__m128i*>(values + i);
+    __m128i x = _mm_add_epi32(_mm_loadu_si128(out), min);
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi32(x, carry);
+    _mm_storeu_si128(out, x);
+    carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+  last_value = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+
+template <>
+uint64_t DeltaPrefixSum(uint64_t* values, int num_values, uint64_t min_delta,
+                        uint64_t last_value) {
+  const __m128i min = _mm_set1_epi64x(static_cast<int64_t>(min_delta));
+  __m128i carry = _mm_set1_epi64x(static_cast<int64_t>(last_value));
+  int i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    __m128i* out = reinterpret_cast<__m128i*>(values + i);
+    __m128i x = _mm_add_epi64(_mm_loadu_si128(out), min);
+    x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi64(x, carry);
+    _mm_storeu_si128(out, x);
+    carry = _mm_unpackhi_epi64(x, x);
+  }
+  last_value = static_cast<uint64_t>(_mm_cvtsi128_si64(carry));
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+#endif
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  typedef typename std::make_unsigned<T>::type UT;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -2050,11 +2588,18 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
+    this->data_ = data;
+    this->len_ = len;
     decoder_ = ::arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
+  /// \brief The number of values in the page, as recorded by its header
+  int ValidValuesCount() const { return static_cast<int>(total_value_count_); }
+
+  /// \brief The number of bytes read so far, including skipped miniblock padding
+  int BytesConsumed() { return this->len_ - decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2062,98 +2607,158 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    auto it = values.begin();
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() {
+          out->UnsafeAppend(*it++);
+          return Status::OK();
+        },
+        [&]() {
+          out->UnsafeAppendNull();
+          return Status::OK();
+        }));
+    return decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int decoded = GetInternal(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    auto it = values.begin();
+    PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { return out->Append(*it++); }, [&]() { return out->AppendNull(); }));
+    return decoded;
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  static constexpr int kMaxDeltaBitWidth = static_cast<int>(sizeof(T) * 8);
+
+  void InitHeader() {
+    int64_t first_value = 0;
+    if (!decoder_.GetVlqInt(&values_per_block_) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
-
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    if (values_per_block_ == 0 || values_per_block_ % 128 != 0) {
+      throw ParquetException("the number of values in a block must be multiple of 128");
+    }
+    if (mini_blocks_per_block_ == 0 || values_per_block_ % mini_blocks_per_block_ != 0) {
+      throw ParquetException("invalid number of miniblocks in a delta block");
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    if (values_per_mini_block_ % 32 != 0) {
+      throw ParquetException(
+          "the number of values in a miniblock must be multiple of 32");
+    }
+    if (total_value_count_ > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+      throw ParquetException("invalid number of values in a delta page");
+    }
+    delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
+    last_value_ = static_cast<T>(first_value);
+    total_values_remaining_ = total_value_count_;
+    first_value_emitted_ = false;
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_remaining_current_mini_block_ = 0;
+  }
 
+  void InitBlock() {
     if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > kMaxDeltaBitWidth)) {
+      throw ParquetException("delta bit width larger than integer bit width");
+    }
+    delta_bit_width_ = bit_width;
+    values_remaining_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
+    max_values = static_cast<int>(
+        std::min<uint64_t>(max_values, total_values_remaining_));
+    if (max_values == 0) return 0;
+
+    int i = 0;
+    if (!first_value_emitted_) {
+      buffer[i++] = last_value_;
+      first_value_emitted_ = true;
+    }
+    while (i < max_values) {
+      if (values_remaining_current_mini_block_ == 0) {
+        if (++mini_block_idx_ < mini_blocks_per_block_) {
+          InitMiniBlock(delta_bit_widths_->data()[mini_block_idx_]);
         } else {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
         }
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int batch_size = std::min(
+          max_values - i, static_cast<int>(values_remaining_current_mini_block_));
+      // Miniblocks are byte-aligned, so whole groups of 32 deltas are unpacked by
+      // the bpacking kernels
+      UT* deltas = reinterpret_cast<UT*>(buffer + i);
+      if (decoder_.GetBatch(delta_bit_width_, deltas, batch_size) != batch_size) {
+        ParquetException::EofException();
+      }
+      // Wrapping arithmetic, as the deltas were computed
+      last_value_ = static_cast<T>(DeltaPrefixSum<UT>(deltas, batch_size,
+                                                      static_cast<UT>(min_delta_),
+                                                      static_cast<UT>(last_value_)));
+      values_remaining_current_mini_block_ -= batch_size;
+      i += batch_size;
     }
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
+
+    if (total_values_remaining_ == 0 && values_remaining_current_mini_block_ > 0) {
+      // Skip the padding of the last miniblock, so that data following the
+      // values (e.g. the bytes of DELTA_LENGTH_BYTE_ARRAY) can be located
+      const int padding_bits = static_cast<int>(values_remaining_current_mini_block_) *
+                               delta_bit_width_;
+      if (!decoder_.Advance(padding_bits)) ParquetException::EofException();
+      values_remaining_current_mini_block_ = 0;
+    }
     return max_values;
   }
 
   MemoryPool* pool_;
   ::arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t values_per_block_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint32_t total_value_count_;
+
+  uint32_t total_values_remaining_;
+  bool first_value_emitted_;
+  uint32_t mini_block_idx_;
+  uint32_t values_remaining_current_mini_block_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
 
-  int32_t last_value_;
+  int64_t min_delta_;
+  T last_value_;
 };
 
 // ----------------------------------------------------------------------
@@ -2166,48 +2771,78 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        buffered_length_(AllocateBuffer(pool, 0)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // All lengths are decoded upfront, as the value bytes only start after them
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(buffered_length_->Resize(num_lengths * sizeof(int32_t)));
+    int32_t* lengths = reinterpret_cast<int32_t*>(buffered_length_->mutable_data());
+    if (len_decoder_.Decode(lengths, num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int consumed = len_decoder_.BytesConsumed();
+    data_ = data + consumed;
+    len_ = len - consumed;
+    length_idx_ = 0;
+    num_valid_values_ = num_lengths;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, num_valid_values_ - length_idx_);
+    const int32_t* lengths =
+        reinterpret_cast<const int32_t*>(buffered_length_->data()) + length_idx_;
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths[i];
+      if (ARROW_PREDICT_FALSE(length < 0)) {
+        throw ParquetException("negative string delta length");
+      }
+      if (ARROW_PREDICT_FALSE(length > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    std::vector<ByteArray> values(num_values - null_count);
+    const int decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
+    }
+    PARQUET_THROW_NOT_OK(AppendBinary(values, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out));
+    return decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    std::vector<ByteArray> values(num_values - null_count);
+    const int decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
+    }
+    PARQUET_THROW_NOT_OK(AppendBinary(values, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out));
+    return decoded;
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> buffered_length_;
+  int length_idx_ = 0;
+  int num_valid_values_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2221,46 +2856,108 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        buffered_prefix_length_(AllocateBuffer(pool, 0)),
+        buffered_data_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+    // The prefix lengths are decoded upfront, as the suffixes only start after them
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(
+        buffered_prefix_length_->Resize(num_prefixes * sizeof(int32_t)));
+    int32_t* prefix_lengths =
+        reinterpret_cast<int32_t*>(buffered_prefix_length_->mutable_data());
+    if (prefix_len_decoder_.Decode(prefix_lengths, num_prefixes) != num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int consumed = prefix_len_decoder_.BytesConsumed();
+    suffix_decoder_.SetData(num_prefixes, data + consumed, len - consumed);
+    prefix_len_idx_ = 0;
+    num_valid_values_ = num_prefixes;
+    last_value_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  /// The decoded values point into a buffer owned by the decoder, and are valid
+  /// until the next call to Decode() or SetData()
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_valid_values_ - prefix_len_idx_);
+    if (max_values == 0) return 0;
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    const int32_t* prefix_lengths =
+        reinterpret_cast<const int32_t*>(buffered_prefix_length_->data()) +
+        prefix_len_idx_;
+    int64_t data_size = 0;
+    {
+      // Compute the decoded sizes, checking each prefix against the previous value
+      int64_t previous_length = static_cast<int64_t>(last_value_.size());
+      for (int i = 0; i < max_values; ++i) {
+        if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0 ||
+                                prefix_lengths[i] > previous_length)) {
+          throw ParquetException("invalid prefix length in DELTA_BYTE_ARRAY data");
+        }
+        previous_length = prefix_lengths[i] + static_cast<int64_t>(buffer[i].len);
+        data_size += previous_length;
+      }
     }
-    this->num_values_ -= max_values;
+    PARQUET_THROW_NOT_OK(buffered_data_->Resize(data_size));
+
+    uint8_t* data = buffered_data_->mutable_data();
+    const uint8_t* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    for (int i = 0; i < max_values; ++i) {
+      const ByteArray suffix = buffer[i];
+      std::memcpy(data, previous, prefix_lengths[i]);
+      std::memcpy(data + prefix_lengths[i], suffix.ptr, suffix.len);
+      buffer[i].ptr = data;
+      buffer[i].len = static_cast<uint32_t>(prefix_lengths[i]) + suffix.len;
+      previous = data;
+      data += buffer[i].len;
+    }
+    last_value_.assign(reinterpret_cast<const char*>(buffer[max_values - 1].ptr),
+                       buffer[max_values - 1].len);
+
+    prefix_len_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    std::vector<ByteArray> values(num_values - null_count);
+    const int decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
+    }
+    PARQUET_THROW_NOT_OK(AppendBinary(values, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out));
+    return decoded;
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    std::vector<ByteArray> values(num_values - null_count);
+    const int decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(decoded != num_values - null_count)) {
+      ParquetException::EofException();
+    }
+    PARQUET_THROW_NOT_OK(AppendBinary(values, num_values, null_count, valid_bits,
+                                      valid_bits_offset, out));
+    return decoded;
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  std::shared_ptr<ResizableBuffer> buffered_prefix_length_;
+  std::shared_ptr<ResizableBuffer> buffered_data_;
+  std::string last_value_;
+  int prefix_len_idx_ = 0;
+  int num_valid_values_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2448,6 +3145,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2488,6 +3205,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
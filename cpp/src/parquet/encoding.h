@@ -352,6 +352,12 @@ class DictDecoder : virtual public TypedDecoder<DType> {
  public:
   virtual void SetDict(TypedDecoder<DType>* dictionary) = 0;
 
+  /// \brief Return the dictionary values as an Arrow array of the physical type
+  ///
+  /// The array references the decoder's memory and is only valid until the next
+  /// call to SetDict().
+  virtual std::shared_ptr<::arrow::Array> GetDictionaryArray() = 0;
+
   /// \brief Insert dictionary values into the Arrow dictionary builder's memo,
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
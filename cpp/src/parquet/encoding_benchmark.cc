@@ -117,6 +117,36 @@ static void BM_PlainDecodingInt64(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
 
+template <typename DType>
+static void BM_DeltaBitPackingDecode(benchmark::State& state) {
+  using T = typename DType::c_type;
+  // Random steps, so that miniblocks have different bit widths
+  ::arrow::random::RandomArrayGenerator rag(0);
+  std::vector<T> values(state.range(0));
+  const auto steps = rag.Int32(state.range(0), 0, 1 << 16);
+  const int32_t* raw_steps =
+      static_cast<const ::arrow::Int32Array&>(*steps).raw_values();
+  T value = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    value = static_cast<T>(value + raw_steps[i]);
+    values[i] = value;
+  }
+  auto encoder = MakeTypedEncoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<DType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_DeltaBitPackingDecode, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackingDecode, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+
 static void BM_PlainEncodingDouble(benchmark::State& state) {
   std::vector<double> values(state.range(0), 64.0);
   auto encoder = MakeTypedEncoder<DoubleType>(Encoding::PLAIN);
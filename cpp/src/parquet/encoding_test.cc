@@ -1243,5 +1243,233 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests.
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  using c_type = typename Type::c_type;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+    }
+
+    {
+      // Try again but with a small step, which doesn't line up with miniblocks
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 41;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(
+            VerifyResults<c_type>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<c_type>(decode_buf_, draws_, num_values_,
+                                                        valid_bits, valid_bits_offset));
+  }
+
+  // Deltas between extreme values overflow, and must wrap around
+  void ExecuteExtremes(int nvalues) {
+    this->InitData(nvalues, 1);
+    for (int i = 0; i < nvalues; ++i) {
+      draws_[i] = (i % 3 == 0) ? std::numeric_limits<c_type>::min()
+                               : std::numeric_limits<c_type>::max();
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Empty, partial and full miniblocks and blocks
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 3));
+
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 33, null_prob));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, WrappingDeltas) {
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteExtremes(1));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteExtremes(1000));
+}
+
+TEST(DeltaBitPackEncoding, SpecExample) {
+  // Example 1 of the Parquet specification: 1, 2, 3, 4, 5
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  // Header (block size 128, 4 miniblocks, 5 values, first value 1), then one block
+  // with a minimum delta of 1 and miniblocks of width 0
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0};
+  ASSERT_EQ(expected, std::vector<uint8_t>(buffer->data(),
+                                           buffer->data() + buffer->size()));
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests.
+
+class DeltaLengthByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+TEST(DeltaByteArrayEncodingAdHoc, SharedPrefixes) {
+  std::vector<std::string> strings = {"",        "apple",  "applesauce", "apply",
+                                      "apricot", "banana", "",           "bandana"};
+  std::vector<ByteArray> values;
+  for (const auto& s : strings) {
+    values.emplace_back(static_cast<uint32_t>(s.size()),
+                        reinterpret_cast<const uint8_t*>(s.data()));
+  }
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  // Encode two pages, the second one must not depend on the first
+  for (int page = 0; page < 2; ++page) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    auto buffer = encoder->FlushValues();
+    decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                     static_cast<int>(buffer->size()));
+    std::vector<ByteArray> decoded(values.size());
+    // Decode in two batches, as prefixes refer to values of the previous batch
+    ASSERT_EQ(3, decoder->Decode(decoded.data(), 3));
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_EQ(strings[i], std::string(reinterpret_cast<const char*>(decoded[i].ptr),
+                                        decoded[i].len));
+    }
+    ASSERT_EQ(5, decoder->Decode(decoded.data(), 10));
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_EQ(strings[i + 3],
+                std::string(reinterpret_cast<const char*>(decoded[i].ptr),
+                            decoded[i].len));
+    }
+  }
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  const auto delta_binary_packed = Encoding::DELTA_BINARY_PACKED;
+  ASSERT_THROW(MakeTypedEncoder<BooleanType>(delta_binary_packed), ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(delta_binary_packed), ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(delta_binary_packed), ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(delta_binary_packed), ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(delta_binary_packed), ParquetException);
+
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int64Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
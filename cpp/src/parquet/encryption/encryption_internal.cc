@@ -321,15 +321,25 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    std::fill(key_.begin(), key_.end(), 0);
+    key_.clear();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
+  bool gcm() const { return aes_mode_ == kGcmMode; }
+  int key_length() const { return key_length_; }
 
  private:
   EVP_CIPHER_CTX* ctx_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
+  // The key currently set in ctx_, if any
+  std::vector<uint8_t> key_;
+
+  // Set the key, if it changed since the last call, and the IV
+  void SetKeyAndIv(const uint8_t* key, const uint8_t* iv);
+
   int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
                  int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
@@ -425,8 +435,27 @@ AesDecryptor* AesDecryptor::Make(ParquetCipher::type alg_id, int key_len, bool m
   return decryptor;
 }
 
+std::unique_ptr<AesDecryptor> AesDecryptor::Clone() const {
+  // The cipher of data modules is given by the mode, the metadata flag only forces GCM
+  return std::unique_ptr<AesDecryptor>(new AesDecryptor(
+      impl_->gcm() ? ParquetCipher::AES_GCM_V1 : ParquetCipher::AES_GCM_CTR_V1,
+      impl_->key_length(), /*metadata=*/false));
+}
+
 int AesDecryptor::CiphertextSizeDelta() { return impl_->ciphertext_size_delta(); }
 
+void AesDecryptor::AesDecryptorImpl::SetKeyAndIv(const uint8_t* key, const uint8_t* iv) {
+  // Expanding the key is skipped when it didn't change, e.g. between the pages of a
+  // column chunk
+  const bool same_key = !key_.empty() && std::equal(key_.begin(), key_.end(), key);
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, same_key ? nullptr : key, iv)) {
+    throw ParquetException("Couldn't set key and IV");
+  }
+  if (!same_key) {
+    key_.assign(key, key + key_length_);
+  }
+}
+
 int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
                                                int ciphertext_len, const uint8_t* key,
                                                int key_len, const uint8_t* aad,
@@ -457,9 +486,7 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, nonce);
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -519,9 +546,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, iv);
 
   // Decryption
   if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
@@ -86,11 +86,16 @@ class AesDecryptor {
   ~AesDecryptor();
   void WipeOut();
 
+  /// A decryptor for the same cipher and key length with its own cipher context,
+  /// that can be used concurrently with this one.
+  std::unique_ptr<AesDecryptor> Clone() const;
+
   /// Size difference between plaintext and ciphertext, for this cipher.
   int CiphertextSizeDelta();
 
   /// Decrypts ciphertext with the key and aad. Key length is passed only for
   /// validation. If different from value in constructor, exception will be thrown.
+  /// The key schedule is only computed again when the key changes between calls.
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
@@ -83,6 +83,11 @@ AesDecryptor* AesDecryptor::Make(ParquetCipher::type alg_id, int key_len, bool m
   return NULLPTR;
 }
 
+std::unique_ptr<AesDecryptor> AesDecryptor::Clone() const {
+  ThrowOpenSSLRequiredException();
+  return NULLPTR;
+}
+
 int AesDecryptor::CiphertextSizeDelta() {
   ThrowOpenSSLRequiredException();
   return -1;
@@ -16,6 +16,10 @@
 // under the License.
 
 #include "parquet/encryption/internal_file_decryptor.h"
+
+#include <algorithm>
+#include <utility>
+
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/encryption_internal.h"
 
@@ -31,6 +35,22 @@ Decryptor::Decryptor(encryption::AesDecryptor* aes_decryptor, const std::string&
       aad_(aad),
       pool_(pool) {}
 
+Decryptor::Decryptor(std::unique_ptr<encryption::AesDecryptor> aes_decryptor,
+                     const std::string& key, const std::string& file_aad,
+                     const std::string& aad, ::arrow::MemoryPool* pool)
+    : Decryptor(aes_decryptor.get(), key, file_aad, aad, pool) {
+  owned_aes_decryptor_ = std::move(aes_decryptor);
+}
+
+Decryptor::~Decryptor() = default;
+
+std::shared_ptr<Decryptor> Decryptor::Clone() const {
+  return std::make_shared<Decryptor>(aes_decryptor_->Clone(), key_, file_aad_, aad_,
+                                     pool_);
+}
+
+void Decryptor::WipeOut() { aes_decryptor_->WipeOut(); }
+
 int Decryptor::CiphertextSizeDelta() { return aes_decryptor_->CiphertextSizeDelta(); }
 
 int Decryptor::Decrypt(const uint8_t* ciphertext, int ciphertext_len,
@@ -59,10 +79,20 @@ InternalFileDecryptor::InternalFileDecryptor(FileDecryptionProperties* propertie
 }
 
 void InternalFileDecryptor::WipeOutDecryptionKeys() {
+  std::lock_guard<std::mutex> lock(mutex_);
   properties_->WipeOutDecryptionKeys();
   for (auto const& i : all_decryptors_) {
-    i->WipeOut();
+    if (auto decryptor = i.lock()) {
+      decryptor->WipeOut();
+    }
+  }
+  all_decryptors_.clear();
+  for (auto& column_key : column_keys_) {
+    std::fill(column_key.second.begin(), column_key.second.end(), '\0');
   }
+  column_keys_.clear();
+  std::fill(footer_key_.begin(), footer_key_.end(), '\0');
+  footer_key_.clear();
 }
 
 std::string InternalFileDecryptor::GetFooterKey() {
@@ -106,44 +136,30 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptorForColumnDat
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetFooterDecryptor(
     const std::string& aad, bool metadata) {
-  if (metadata) {
-    if (footer_metadata_decryptor_ != nullptr) return footer_metadata_decryptor_;
-  } else {
-    if (footer_data_decryptor_ != nullptr) return footer_data_decryptor_;
-  }
-
-  std::string footer_key = properties_->footer_key();
-  if (footer_key.empty()) {
-    if (footer_key_metadata_.empty())
-      throw ParquetException("No footer key or key metadata");
-    if (properties_->key_retriever() == nullptr)
-      throw ParquetException("No footer key or key retriever");
-    try {
-      footer_key = properties_->key_retriever()->GetKey(footer_key_metadata_);
-    } catch (KeyAccessDeniedException& e) {
-      std::stringstream ss;
-      ss << "Footer key: access denied " << e.what() << "\n";
-      throw ParquetException(ss.str());
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (footer_key_.empty()) {
+    std::string footer_key = properties_->footer_key();
+    if (footer_key.empty()) {
+      if (footer_key_metadata_.empty())
+        throw ParquetException("No footer key or key metadata");
+      if (properties_->key_retriever() == nullptr)
+        throw ParquetException("No footer key or key retriever");
+      try {
+        footer_key = properties_->key_retriever()->GetKey(footer_key_metadata_);
+      } catch (KeyAccessDeniedException& e) {
+        std::stringstream ss;
+        ss << "Footer key: access denied " << e.what() << "\n";
+        throw ParquetException(ss.str());
+      }
     }
+    if (footer_key.empty()) {
+      throw ParquetException(
+          "Invalid footer encryption key. "
+          "Could not parse footer metadata");
+    }
+    footer_key_ = std::move(footer_key);
   }
-  if (footer_key.empty()) {
-    throw ParquetException(
-        "Invalid footer encryption key. "
-        "Could not parse footer metadata");
-  }
-
-  // Create both data and metadata decryptors to avoid redundant retrieval of key
-  // from the key_retriever.
-  auto aes_metadata_decryptor = GetMetaAesDecryptor(footer_key.size());
-  auto aes_data_decryptor = GetDataAesDecryptor(footer_key.size());
-
-  footer_metadata_decryptor_ = std::make_shared<Decryptor>(
-      aes_metadata_decryptor, footer_key, file_aad_, aad, pool_);
-  footer_data_decryptor_ =
-      std::make_shared<Decryptor>(aes_data_decryptor, footer_key, file_aad_, aad, pool_);
-
-  if (metadata) return footer_metadata_decryptor_;
-  return footer_data_decryptor_;
+  return MakeDecryptor(footer_key_, aad, metadata);
 }
 
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnMetaDecryptor(
@@ -161,23 +177,14 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDataDecryptor(
 std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     const std::string& column_path, const std::string& column_key_metadata,
     const std::string& aad, bool metadata) {
-  std::string column_key;
-  // first look if we already got the decryptor from before
-  if (metadata) {
-    if (column_metadata_map_.find(column_path) != column_metadata_map_.end()) {
-      auto res(column_metadata_map_.at(column_path));
-      res->UpdateAad(aad);
-      return res;
-    }
-  } else {
-    if (column_data_map_.find(column_path) != column_data_map_.end()) {
-      auto res(column_data_map_.at(column_path));
-      res->UpdateAad(aad);
-      return res;
-    }
+  std::lock_guard<std::mutex> lock(mutex_);
+  // first look if we already got the key from before
+  auto it = column_keys_.find(column_path);
+  if (it != column_keys_.end()) {
+    return MakeDecryptor(it->second, aad, metadata);
   }
 
-  column_key = properties_->column_key(column_path);
+  std::string column_key = properties_->column_key(column_path);
   // No explicit column key given via API. Retrieve via key metadata.
   if (column_key.empty() && !column_key_metadata.empty() &&
       properties_->key_retriever() != nullptr) {
@@ -193,48 +200,30 @@ std::shared_ptr<Decryptor> InternalFileDecryptor::GetColumnDecryptor(
     throw HiddenColumnException("HiddenColumnException, path=" + column_path);
   }
 
-  // Create both data and metadata decryptors to avoid redundant retrieval of key
-  // using the key_retriever.
-  auto aes_metadata_decryptor = GetMetaAesDecryptor(column_key.size());
-  auto aes_data_decryptor = GetDataAesDecryptor(column_key.size());
-
-  column_metadata_map_[column_path] = std::make_shared<Decryptor>(
-      aes_metadata_decryptor, column_key, file_aad_, aad, pool_);
-  column_data_map_[column_path] =
-      std::make_shared<Decryptor>(aes_data_decryptor, column_key, file_aad_, aad, pool_);
-
-  if (metadata) return column_metadata_map_[column_path];
-  return column_data_map_[column_path];
+  column_keys_[column_path] = column_key;
+  return MakeDecryptor(column_key, aad, metadata);
 }
 
-int InternalFileDecryptor::MapKeyLenToDecryptorArrayIndex(int key_len) {
-  if (key_len == 16)
-    return 0;
-  else if (key_len == 24)
-    return 1;
-  else if (key_len == 32)
-    return 2;
-  throw ParquetException("decryption key must be 16, 24 or 32 bytes in length");
-}
-
-encryption::AesDecryptor* InternalFileDecryptor::GetMetaAesDecryptor(size_t key_size) {
-  int key_len = static_cast<int>(key_size);
-  int index = MapKeyLenToDecryptorArrayIndex(key_len);
-  if (meta_decryptor_[index] == nullptr) {
-    meta_decryptor_[index].reset(
-        encryption::AesDecryptor::Make(algorithm_, key_len, true, &all_decryptors_));
+std::shared_ptr<Decryptor> InternalFileDecryptor::MakeDecryptor(const std::string& key,
+                                                                const std::string& aad,
+                                                                bool metadata) {
+  const int key_len = static_cast<int>(key.size());
+  if (key_len != 16 && key_len != 24 && key_len != 32) {
+    throw ParquetException("decryption key must be 16, 24 or 32 bytes in length");
   }
-  return meta_decryptor_[index].get();
-}
-
-encryption::AesDecryptor* InternalFileDecryptor::GetDataAesDecryptor(size_t key_size) {
-  int key_len = static_cast<int>(key_size);
-  int index = MapKeyLenToDecryptorArrayIndex(key_len);
-  if (data_decryptor_[index] == nullptr) {
-    data_decryptor_[index].reset(
-        encryption::AesDecryptor::Make(algorithm_, key_len, false, &all_decryptors_));
+  std::unique_ptr<encryption::AesDecryptor> aes_decryptor(
+      encryption::AesDecryptor::Make(algorithm_, key_len, metadata, nullptr));
+  auto decryptor = std::make_shared<Decryptor>(std::move(aes_decryptor), key, file_aad_,
+                                               aad, pool_);
+  if (all_decryptors_.size() == all_decryptors_.capacity()) {
+    // Forget the decryptors already destroyed before growing
+    all_decryptors_.erase(
+        std::remove_if(all_decryptors_.begin(), all_decryptors_.end(),
+                       [](const std::weak_ptr<Decryptor>& d) { return d.expired(); }),
+        all_decryptors_.end());
   }
-  return data_decryptor_[index].get();
+  all_decryptors_.push_back(decryptor);
+  return decryptor;
 }
 
 }  // namespace parquet
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -33,20 +34,32 @@ class AesEncryptor;
 
 class FileDecryptionProperties;
 
+/// A Decryptor is not thread-safe: it holds an AES cipher context. Use Clone() to
+/// decrypt with the same key and AAD from another thread.
 class PARQUET_EXPORT Decryptor {
  public:
   Decryptor(encryption::AesDecryptor* decryptor, const std::string& key,
             const std::string& file_aad, const std::string& aad,
             ::arrow::MemoryPool* pool);
+  Decryptor(std::unique_ptr<encryption::AesDecryptor> decryptor, const std::string& key,
+            const std::string& file_aad, const std::string& aad,
+            ::arrow::MemoryPool* pool);
+  ~Decryptor();
 
   const std::string& file_aad() const { return file_aad_; }
   void UpdateAad(const std::string& aad) { aad_ = aad; }
   ::arrow::MemoryPool* pool() { return pool_; }
 
+  /// Return a decryptor for the same key and AAD with its own cipher context
+  std::shared_ptr<Decryptor> Clone() const;
+
   int CiphertextSizeDelta();
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* plaintext);
 
+  void WipeOut();
+
  private:
+  std::unique_ptr<encryption::AesDecryptor> owned_aes_decryptor_;
   encryption::AesDecryptor* aes_decryptor_;
   std::string key_;
   std::string file_aad_;
@@ -54,6 +67,9 @@ class PARQUET_EXPORT Decryptor {
   ::arrow::MemoryPool* pool_;
 };
 
+/// Keys are retrieved once per file (footer key) or column (column keys), but each
+/// call returns a new Decryptor with its own cipher context, so that column chunks
+/// can be decrypted concurrently. The methods are thread-safe.
 class InternalFileDecryptor {
  public:
   explicit InternalFileDecryptor(FileDecryptionProperties* properties,
@@ -90,19 +106,16 @@ class InternalFileDecryptor {
   FileDecryptionProperties* properties_;
   // Concatenation of aad_prefix (if exists) and aad_file_unique
   std::string file_aad_;
-  std::map<std::string, std::shared_ptr<Decryptor>> column_data_map_;
-  std::map<std::string, std::shared_ptr<Decryptor>> column_metadata_map_;
-
-  std::shared_ptr<Decryptor> footer_metadata_decryptor_;
-  std::shared_ptr<Decryptor> footer_data_decryptor_;
   ParquetCipher::type algorithm_;
   std::string footer_key_metadata_;
-  std::vector<encryption::AesDecryptor*> all_decryptors_;
 
-  /// Key must be 16, 24 or 32 bytes in length. Thus there could be up to three
-  // types of meta_decryptors and data_decryptors.
-  std::unique_ptr<encryption::AesDecryptor> meta_decryptor_[3];
-  std::unique_ptr<encryption::AesDecryptor> data_decryptor_[3];
+  // Guards the members below
+  std::mutex mutex_;
+  // Keys already retrieved, by column path
+  std::map<std::string, std::string> column_keys_;
+  std::string footer_key_;
+  // Decryptors handed out, to be wiped out with the keys
+  std::vector<std::weak_ptr<Decryptor>> all_decryptors_;
 
   ::arrow::MemoryPool* pool_;
 
@@ -112,10 +125,9 @@ class InternalFileDecryptor {
                                                 const std::string& aad,
                                                 bool metadata = false);
 
-  encryption::AesDecryptor* GetMetaAesDecryptor(size_t key_size);
-  encryption::AesDecryptor* GetDataAesDecryptor(size_t key_size);
-
-  int MapKeyLenToDecryptorArrayIndex(int key_len);
+  // Make a decryptor with its own cipher context. Must be called with mutex_ held.
+  std::shared_ptr<Decryptor> MakeDecryptor(const std::string& key, const std::string& aad,
+                                           bool metadata);
 };
 
 }  // namespace parquet
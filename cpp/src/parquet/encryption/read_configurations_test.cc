@@ -174,6 +174,8 @@ class TestDecryptionConfiguration
     }
 
     decryptor_.DecryptFile(file, file_decryption_properties);
+    // Pages read ahead are decrypted concurrently on the CPU thread pool
+    decryptor_.DecryptFile(file, file_decryption_properties, /*page_readahead=*/4);
   }
 
   // Check that the decryption result is as expected.
@@ -327,9 +327,11 @@ void ReadAndVerifyColumn(RowGroupReader* rg_reader, RowGroupMetadata* rg_md,
 
 void FileDecryptor::DecryptFile(
     std::string file,
-    std::shared_ptr<FileDecryptionProperties> file_decryption_properties) {
+    std::shared_ptr<FileDecryptionProperties> file_decryption_properties,
+    int32_t page_readahead) {
   std::string exception_msg;
   parquet::ReaderProperties reader_properties = parquet::default_reader_properties();
+  reader_properties.set_page_readahead(page_readahead);
   if (file_decryption_properties) {
     reader_properties.file_decryption_properties(file_decryption_properties->DeepClone());
   }
@@ -105,7 +105,8 @@ class FileEncryptor {
 class FileDecryptor {
  public:
   void DecryptFile(std::string file_name,
-                   std::shared_ptr<FileDecryptionProperties> file_decryption_properties);
+                   std::shared_ptr<FileDecryptionProperties> file_decryption_properties,
+                   int32_t page_readahead = 0);
 };
 
 }  // namespace test
@@ -93,6 +93,16 @@ class TestPageSerde : public ::testing::Test {
     page_reader_ = PageReader::Open(stream, num_rows, codec);
   }
 
+  void InitSerializedPageReader(int64_t num_rows, Compression::type codec,
+                                const ReaderProperties& properties) {
+    EndStream();
+
+    auto stream = std::make_shared<::arrow::io::BufferReader>(out_buffer_);
+    page_reader_ = PageReader::Open(stream, num_rows, codec, properties);
+  }
+
+  void CheckCompressedPages(const ReaderProperties& properties);
+
   void WriteDataPageHeader(int max_serialized_len = 1024, int32_t uncompressed_size = 0,
                            int32_t compressed_size = 0) {
     // Simplifying writing serialized data page headers which may or may not
@@ -234,7 +244,7 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
-TEST_F(TestPageSerde, Compression) {
+void TestPageSerde::CheckCompressedPages(const ReaderProperties& properties) {
   std::vector<Compression::type> codec_types;
 
 #ifdef ARROW_WITH_SNAPPY
@@ -290,20 +300,44 @@ TEST_F(TestPageSerde, Compression) {
       ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
     }
 
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
+    InitSerializedPageReader(num_rows * num_pages, codec_type, properties);
 
-    std::shared_ptr<Page> page;
-    const DataPageV1* data_page;
+    std::vector<std::shared_ptr<Page>> pages;
     for (int i = 0; i < num_pages; ++i) {
       int data_size = static_cast<int>(faux_data[i].size());
-      page = page_reader_->NextPage();
-      data_page = static_cast<const DataPageV1*>(page.get());
+      pages.push_back(page_reader_->NextPage());
+      ASSERT_NE(nullptr, pages.back());
+      auto data_page = static_cast<const DataPageV1*>(pages.back().get());
       ASSERT_EQ(data_size, data_page->size());
       ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
     }
+    ASSERT_EQ(nullptr, page_reader_->NextPage());
+
+    if (properties.page_readahead() > 0) {
+      // Pages read ahead don't share their decompression buffer
+      for (int i = 0; i < num_pages; ++i) {
+        ASSERT_EQ(0, memcmp(faux_data[i].data(), pages[i]->data(),
+                            static_cast<int>(faux_data[i].size())));
+      }
+    }
 
     ResetStream();
   }
+}
+
+TEST_F(TestPageSerde, Compression) {
+  ASSERT_NO_FATAL_FAILURE(CheckCompressedPages(default_reader_properties()));
+}
+
+TEST_F(TestPageSerde, CompressionWithPageReadahead) {
+  ReaderProperties properties;
+  properties.set_page_readahead(3);
+  ASSERT_NO_FATAL_FAILURE(CheckCompressedPages(properties));
+
+  // The byte budget is reached before the page count
+  properties.set_page_readahead(100);
+  properties.set_page_readahead_bytes(256);
+  ASSERT_NO_FATAL_FAILURE(CheckCompressedPages(properties));
 }  // namespace parquet
 
 TEST_F(TestPageSerde, LZONotSupported) {
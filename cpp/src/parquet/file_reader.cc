@@ -46,8 +46,6 @@
 
 namespace parquet {
 
-// PARQUET-978: Minimize footer reads by reading 64 KB from the end of the file
-static constexpr int64_t kDefaultFooterReadSize = 64 * 1024;
 static constexpr uint32_t kFooterSize = 8;
 
 // For PARQUET-816
@@ -84,6 +82,36 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -160,7 +188,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool());
+                              properties_);
     }
 
     if (file_decryptor_ == nullptr) {
@@ -182,7 +210,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
       return PageReader::Open(stream, col->num_values(), col->compression(),
-                              properties_.memory_pool(), &ctx);
+                              properties_, &ctx);
     }
 
     // The column is encrypted with its own key
@@ -197,10 +225,64 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
     return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool(), &ctx);
+                            properties_, &ctx);
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Page indexes of encrypted columns are not supported
+    if (!col->has_column_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    auto buffer = ReadIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(file_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    auto buffer = ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Bloom filters of encrypted columns are not supported
+    if (!col->has_bloom_filter() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    // The serialized filter starts with its bitset length, hash strategy and
+    // algorithm, each a uint32_t. Check the length before reading the bitset.
+    constexpr int32_t kHeaderLength = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    auto header = ReadIndex(offset, kHeaderLength);
+    const uint32_t num_bytes = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (num_bytes < BlockSplitBloomFilter::kMinimumBloomFilterBytes ||
+        num_bytes > BloomFilter::kMaximumBloomFilterBytes ||
+        (num_bytes & (num_bytes - 1)) != 0) {
+      throw ParquetException("Invalid bloom filter size (corrupt file?)");
+    }
+    auto buffer = ReadIndex(offset, kHeaderLength + static_cast<int32_t>(num_bytes));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
   }
 
  private:
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length < 0 || offset + length > source_size_) {
+      throw ParquetException("Invalid index location (corrupt file?)");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      ParquetException::EofException("Index was truncated");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -267,6 +349,21 @@ class SerializedFile : public ParquetFileReader::Contents {
     return cached_source_->Wait();
   }
 
+  ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices) const {
+    if (!cached_source_) {
+      return ::arrow::Status::Invalid("Must call PreBuffer before WhenBuffered");
+    }
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row : row_groups) {
+      for (int col : column_indices) {
+        ranges.push_back(
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+      }
+    }
+    return cached_source_->WaitFor(std::move(ranges));
+  }
+
   void ParseMetaData() {
     if (source_size_ == 0) {
       throw ParquetInvalidOrCorruptedFileException("Parquet file size is 0 bytes");
@@ -276,7 +373,9 @@ class SerializedFile : public ParquetFileReader::Contents {
           " bytes, smaller than the minimum file footer (", kFooterSize, " bytes)");
     }
 
-    int64_t footer_read_size = std::min(source_size_, kDefaultFooterReadSize);
+    int64_t footer_read_size =
+        std::min(source_size_, std::max<int64_t>(properties_.footer_read_size(),
+                                                 kFooterSize));
     PARQUET_ASSIGN_OR_THROW(
         auto footer_buffer,
         source_->ReadAt(source_size_ - footer_read_size, footer_read_size));
@@ -290,6 +389,11 @@ class SerializedFile : public ParquetFileReader::Contents {
           "is not a parquet file.");
     }
 
+    if (footer_read_size == source_size_) {
+      // The whole file was read: serve the column chunks from memory as well
+      source_ = std::make_shared<::arrow::io::BufferReader>(footer_buffer);
+    }
+
     if (memcmp(footer_buffer->data() + footer_read_size - 4, kParquetEMagic, 4) == 0) {
       // Encrypted file with Encrypted footer.
       ParseMetaDataOfEncryptedFileWithEncryptedFooter(footer_buffer, footer_read_size);
@@ -597,6 +701,14 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   return file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+::arrow::Future<> ParquetFileReader::WhenBuffered(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices) const {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  return file->WhenBuffered(row_groups, column_indices);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
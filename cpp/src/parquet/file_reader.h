@@ -24,7 +24,9 @@
 
 #include "arrow/io/caching.h"
 #include "arrow/util/type_fwd.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -45,6 +47,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) { return NULLPTR; }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +63,15 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the page indexes of the indicated column, if the file has them.
+  // Returns nullptr otherwise.
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Read the bloom filter of the indicated column, if the file has one.
+  // Returns nullptr otherwise.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -130,6 +144,17 @@ class PARQUET_EXPORT ParquetFileReader {
                               const ::arrow::io::IOContext& ctx,
                               const ::arrow::io::CacheOptions& options);
 
+  /// Wait for the specified row groups and column indices to be pre-buffered.
+  ///
+  /// After the returned Future completes, reading the specified row
+  /// groups/columns will not block.
+  ///
+  /// PreBuffer must be called first. This method does not start any
+  /// I/O of its own, so it can be used to sequence decoding of row groups
+  /// after a single PreBuffer() call covering all of them.
+  ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
+                                 const std::vector<int>& column_indices) const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
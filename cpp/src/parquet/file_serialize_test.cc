@@ -18,12 +18,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "arrow/testing/gtest_compat.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
@@ -426,6 +429,159 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+TEST(ParquetRoundtrip, PageIndex) {
+  constexpr int kValueCount = 10000;
+  constexpr int kBatchSize = 500;
+  for (bool buffered : {false, true}) {
+    SCOPED_TRACE(buffered ? "buffered" : "unbuffered");
+    auto sink = CreateOutputStream();
+    auto writer_props = parquet::WriterProperties::Builder()
+                            .disable_dictionary()
+                            ->data_pagesize(1024)
+                            ->write_batch_size(kBatchSize)
+                            ->enable_write_page_index()
+                            ->build();
+    schema::NodeVector fields;
+    fields.push_back(
+        PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+    auto schema = std::static_pointer_cast<GroupNode>(
+        GroupNode::Make("schema", Repetition::REQUIRED, fields));
+    auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+    auto rg_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    auto col_writer = static_cast<Int32Writer*>(rg_writer->column(0));
+    std::vector<int32_t> values_in(kValueCount);
+    std::iota(values_in.begin(), values_in.end(), 0);
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values_in.data());
+    rg_writer->Close();
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    auto file_reader = ParquetFileReader::Open(source);
+    auto rg_reader = file_reader->RowGroup(0);
+    auto col_metadata = rg_reader->metadata()->ColumnChunk(0);
+    ASSERT_TRUE(col_metadata->has_column_index());
+    ASSERT_TRUE(col_metadata->has_offset_index());
+
+    auto offset_index = rg_reader->GetOffsetIndex(0);
+    auto column_index = rg_reader->GetColumnIndex(0);
+    ASSERT_NE(nullptr, offset_index);
+    ASSERT_NE(nullptr, column_index);
+    const int num_pages = offset_index->num_pages();
+    ASSERT_EQ(kValueCount / kBatchSize, num_pages);
+    ASSERT_EQ(num_pages, column_index->num_pages());
+    if (column_index->has_null_counts()) {
+      ASSERT_EQ(0, column_index->null_counts()[0]);
+    }
+
+    const auto& locations = offset_index->page_locations();
+    for (int i = 0; i < num_pages; ++i) {
+      ASSERT_EQ(i * kBatchSize, locations[i].first_row_index);
+      ASSERT_EQ(kBatchSize, offset_index->num_rows(i, kValueCount));
+      ASSERT_GE(locations[i].offset, col_metadata->data_page_offset());
+      if (i > 0) {
+        ASSERT_EQ(locations[i - 1].offset + locations[i - 1].compressed_page_size,
+                  locations[i].offset);
+      }
+      auto stats = std::static_pointer_cast<Int32Statistics>(
+          column_index->page_statistics(i, kBatchSize));
+      ASSERT_TRUE(stats->HasMinMax());
+      ASSERT_EQ(i * kBatchSize, stats->min());
+      ASSERT_EQ((i + 1) * kBatchSize - 1, stats->max());
+    }
+    ASSERT_EQ(num_pages - 1, offset_index->FindPage(kValueCount - 1));
+    ASSERT_EQ(1, offset_index->FindPage(kBatchSize));
+
+    // Read only the pages whose statistics may contain values in [2000, 3000)
+    auto page_reader = rg_reader->GetColumnPageReader(0);
+    page_reader->set_data_page_filter([&](const DataPageStats& page) {
+      const auto& location = locations[page.page_ordinal];
+      return location.first_row_index + page.num_values <= 2000 ||
+             location.first_row_index >= 3000;
+    });
+    auto col_reader = std::static_pointer_cast<Int32Reader>(
+        ColumnReader::Make(file_reader->metadata()->schema()->Column(0),
+                           std::move(page_reader)));
+    std::vector<int32_t> values_out(kValueCount);
+    int64_t values_read = 0;
+    while (col_reader->HasNext()) {
+      int64_t batch_values_read;
+      col_reader->ReadBatch(kValueCount - values_read, nullptr, nullptr,
+                            values_out.data() + values_read, &batch_values_read);
+      values_read += batch_values_read;
+    }
+    ASSERT_EQ(1000, values_read);
+    values_out.resize(values_read);
+    ASSERT_EQ(std::vector<int32_t>(values_in.begin() + 2000, values_in.begin() + 3000),
+              values_out);
+  }
+}
+
+TEST(ParquetRoundtrip, BloomFilter) {
+  constexpr int kValueCount = 1000;
+  for (bool buffered : {false, true}) {
+    SCOPED_TRACE(buffered ? "buffered" : "unbuffered");
+    auto sink = CreateOutputStream();
+    BloomFilterOptions bloom_filter_options;
+    bloom_filter_options.ndv = kValueCount;
+    bloom_filter_options.fpp = 0.01;
+    auto writer_props = parquet::WriterProperties::Builder()
+                            .enable_bloom_filter("a", bloom_filter_options)
+                            ->enable_write_page_index()
+                            ->build();
+    schema::NodeVector fields;
+    fields.push_back(
+        PrimitiveNode::Make("a", parquet::Repetition::OPTIONAL, parquet::Type::INT64));
+    fields.push_back(
+        PrimitiveNode::Make("b", parquet::Repetition::REQUIRED, parquet::Type::INT64));
+    auto schema = std::static_pointer_cast<GroupNode>(
+        GroupNode::Make("schema", Repetition::REQUIRED, fields));
+    auto file_writer = parquet::ParquetFileWriter::Open(sink, schema, writer_props);
+    auto rg_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    // Even values, every tenth of them null
+    std::vector<int64_t> values(kValueCount);
+    std::vector<int16_t> def_levels(kValueCount);
+    for (int i = 0; i < kValueCount; ++i) {
+      values[i] = 2 * i;
+      def_levels[i] = i % 10 == 0 ? 0 : 1;
+    }
+    std::vector<int64_t> non_null_values;
+    for (int i = 0; i < kValueCount; ++i) {
+      if (def_levels[i] == 1) non_null_values.push_back(values[i]);
+    }
+    auto col_writer = static_cast<Int64Writer*>(rg_writer->column(0));
+    col_writer->WriteBatch(kValueCount, def_levels.data(), nullptr,
+                           non_null_values.data());
+    col_writer = static_cast<Int64Writer*>(rg_writer->column(1));
+    col_writer->WriteBatch(kValueCount, nullptr, nullptr, values.data());
+    rg_writer->Close();
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    auto file_reader = ParquetFileReader::Open(source);
+    auto rg_reader = file_reader->RowGroup(0);
+    ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(1));
+    // The bloom filter doesn't disturb the page index written before it
+    ASSERT_NE(nullptr, rg_reader->GetOffsetIndex(0));
+
+    auto bloom_filter = rg_reader->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+    for (int64_t value : non_null_values) {
+      ASSERT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(value)));
+    }
+    int false_positives = 0;
+    for (int i = 0; i < kValueCount; ++i) {
+      false_positives += bloom_filter->FindHash(bloom_filter->Hash(int64_t(2 * i + 1)));
+    }
+    ASSERT_LT(false_positives, kValueCount / 20);
+  }
+}
+
 TEST(ParquetRoundtrip, AllNulls) {
   auto primitive_node =
       PrimitiveNode::Make("nulls", Repetition::OPTIONAL, nullptr, Type::INT32);
@@ -38,6 +38,27 @@ namespace {
 using ::arrow::internal::CpuInfo;
 using ::arrow::util::optional;
 
+constexpr int64_t kBlockSize = 64;
+
+// Whether a block of kBlockSize levels only holds continuations of the current list
+bool AllContinuations(const int16_t* def_levels, const int16_t* rep_levels,
+                      const LevelInfo& level_info) {
+  int16_t min_def = def_levels[0];
+  int16_t min_rep = rep_levels[0];
+  int16_t max_rep = rep_levels[0];
+  for (int64_t i = 1; i < kBlockSize; i++) {
+    min_def = std::min(min_def, def_levels[i]);
+    min_rep = std::min(min_rep, rep_levels[i]);
+    max_rep = std::max(max_rep, rep_levels[i]);
+  }
+  return min_rep == level_info.rep_level && max_rep == level_info.rep_level &&
+         min_def >= level_info.repeated_ancestor_def_level;
+}
+
+// Reconstructs list offsets and validity.  Levels are processed in blocks of 64:
+// a block made only of continuations of the current list (the common case for
+// long lists, detected with a min/max scan that compilers vectorize) just adds its
+// size to the current offset, other blocks are visited level by level.
 template <typename OffsetType>
 void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels,
                             int64_t num_def_levels, LevelInfo level_info,
@@ -48,14 +69,15 @@ void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels
     valid_bits_writer.emplace(output->valid_bits, output->valid_bits_offset,
                               output->values_read_upper_bound);
   }
-  for (int x = 0; x < num_def_levels; x++) {
+
+  auto visit_level = [&](int16_t def_level, int16_t rep_level) {
     // Skip items that belong to empty or null ancestor lists and further nested lists.
-    if (def_levels[x] < level_info.repeated_ancestor_def_level ||
-        rep_levels[x] > level_info.rep_level) {
-      continue;
+    if (def_level < level_info.repeated_ancestor_def_level ||
+        rep_level > level_info.rep_level) {
+      return;
     }
 
-    if (rep_levels[x] == level_info.rep_level) {
+    if (rep_level == level_info.rep_level) {
       // A continuation of an existing list.
       // offsets can be null for structs with repeated children (we don't need to know
       // offsets until we get to the children).
@@ -86,7 +108,7 @@ void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels
         // fixed size lists so it should be cheaper to make these cumulative and
         // subtract when validating fixed size lists.
         *offsets = *(offsets - 1);
-        if (def_levels[x] >= level_info.def_level) {
+        if (def_level >= level_info.def_level) {
           if (ARROW_PREDICT_FALSE(*offsets == std::numeric_limits<OffsetType>::max())) {
             throw ParquetException("List index overflow.");
           }
@@ -97,7 +119,7 @@ void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels
       if (valid_bits_writer.has_value()) {
         // the level_info def level for lists reflects element present level.
         // the prior level distinguishes between empty lists.
-        if (def_levels[x] >= level_info.def_level - 1) {
+        if (def_level >= level_info.def_level - 1) {
           valid_bits_writer->Set();
         } else {
           output->null_count++;
@@ -106,7 +128,27 @@ void DefRepLevelsToListInfo(const int16_t* def_levels, const int16_t* rep_levels
         valid_bits_writer->Next();
       }
     }
+  };
+
+  for (int64_t x = 0; x < num_def_levels; x += kBlockSize) {
+    const int64_t block_size = std::min(kBlockSize, num_def_levels - x);
+    const int16_t* defs = def_levels + x;
+    const int16_t* reps = rep_levels + x;
+    if (block_size == kBlockSize && AllContinuations(defs, reps, level_info)) {
+      if (offsets != nullptr) {
+        if (ARROW_PREDICT_FALSE(*offsets >
+                                std::numeric_limits<OffsetType>::max() - kBlockSize)) {
+          throw ParquetException("List index overflow.");
+        }
+        *offsets += static_cast<OffsetType>(kBlockSize);
+      }
+      continue;
+    }
+    for (int64_t i = 0; i < block_size; i++) {
+      visit_level(defs[i], reps[i]);
+    }
   }
+
   if (valid_bits_writer.has_value()) {
     valid_bits_writer->Finish();
   }
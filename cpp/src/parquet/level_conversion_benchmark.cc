@@ -78,3 +78,30 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+void BM_DefRepLevelsToList(::benchmark::State& state) {
+  // Lists of state.range(0) present elements
+  const int64_t list_length = state.range(0);
+  std::vector<int16_t> def_levels(/*count=*/kLevelCount, kPresentDefLevel);
+  std::vector<int16_t> rep_levels(/*count=*/kLevelCount, kHasRepeatedElements);
+  for (size_t x = 0; x < rep_levels.size(); x += list_length) {
+    rep_levels[x] = 0;
+  }
+  std::vector<int32_t> offsets(/*count=*/kLevelCount + 1, 0);
+  std::vector<uint8_t> bitmap(/*count=*/kLevelCount, 0);
+  parquet::internal::LevelInfo info;
+  info.def_level = kPresentDefLevel;
+  info.rep_level = kHasRepeatedElements;
+  for (auto _ : state) {
+    parquet::internal::ValidityBitmapInputOutput validity_io;
+    validity_io.values_read_upper_bound = kLevelCount;
+    validity_io.valid_bits = bitmap.data();
+    parquet::internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(),
+                                          kLevelCount, info, &validity_io,
+                                          offsets.data());
+  }
+  ::benchmark::DoNotOptimize(offsets);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kLevelCount);
+}
+
+BENCHMARK(BM_DefRepLevelsToList)->Arg(2)->Arg(16)->Arg(256);
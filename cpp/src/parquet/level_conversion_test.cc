@@ -315,6 +315,43 @@ TYPED_TEST(NestedListTest, SimpleLongList) {
             "1");
 }
 
+TYPED_TEST(NestedListTest, ListsSpanningLevelBlocks) {
+  // Lists of length 0 to 150 (every 7th list is null) cross the boundaries of the
+  // 64-level blocks that levels are classified in.
+  LevelInfo level_info;
+  level_info.rep_level = 1;
+  level_info.def_level = 2;
+
+  constexpr int kNumLists = 151;
+  MultiLevelTestData test_data;
+  std::vector<typename TypeParam::OffsetsType> expected_offsets{0};
+  std::string expected_validity;
+  for (int length = 0; length < kNumLists; length++) {
+    const bool is_null = length % 7 == 3;
+    if (length > 0 && length % 8 == 0) expected_validity += " ";
+    expected_validity += is_null ? "0" : "1";
+    if (is_null || length == 0) {
+      test_data.def_levels.push_back(is_null ? 0 : 1);
+      test_data.rep_levels.push_back(0);
+      expected_offsets.push_back(expected_offsets.back());
+      continue;
+    }
+    test_data.def_levels.insert(test_data.def_levels.end(), length, 2);
+    test_data.rep_levels.push_back(0);
+    test_data.rep_levels.insert(test_data.rep_levels.end(), length - 1, 1);
+    expected_offsets.push_back(expected_offsets.back() + length);
+  }
+
+  this->InitForLength(kNumLists);
+  typename TypeParam::OffsetsType* next_position = this->Run(test_data, level_info);
+
+  EXPECT_EQ(next_position, this->offsets_.data() + kNumLists);
+  EXPECT_THAT(this->offsets_, testing::ElementsAreArray(expected_offsets));
+  EXPECT_EQ(this->validity_io_.values_read, kNumLists);
+  EXPECT_EQ(this->validity_io_.null_count, 22);
+  EXPECT_EQ(BitmapToString(this->validity_io_.valid_bits, kNumLists), expected_validity);
+}
+
 TYPED_TEST(NestedListTest, TestOverflow) {
   LevelInfo level_info;
   level_info.rep_level = 1;
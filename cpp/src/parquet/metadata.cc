@@ -28,6 +28,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_decryptor.h"
 #include "parquet/exception.h"
@@ -283,6 +284,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_metadata_->total_uncompressed_size;
   }
 
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
   inline std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const {
     if (column_->__isset.crypto_metadata) {
       return ColumnCryptoMetaData::Make(
@@ -360,6 +385,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -1347,10 +1398,8 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
     }
     thrift_encodings.push_back(ToThrift(Encoding::RLE));
-    // Only PLAIN encoding is supported for fallback in V1
-    // TODO(majetideepak): Use user specified encoding for V2
     if (dictionary_fallback) {
-      thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
+      thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
     }
     column_chunk_->meta_data.__set_encodings(thrift_encodings);
     std::vector<format::PageEncodingStats> thrift_encoding_stats;
@@ -1433,6 +1482,85 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     serializer.Serialize(column_chunk_, sink);
   }
 
+  void AddPageIndexEntry(const EncodedStatistics& page_stats, int64_t first_row_index,
+                         int64_t num_values) {
+    if (!writes_page_index()) return;
+    PageIndexEntry entry;
+    entry.first_row_index = first_row_index;
+    entry.null_page = !page_stats.has_min && !page_stats.has_max &&
+                      page_stats.has_null_count && page_stats.null_count == num_values;
+    entry.has_min_max = page_stats.has_min && page_stats.has_max;
+    if (entry.has_min_max) {
+      entry.min = page_stats.min();
+      entry.max = page_stats.max();
+    }
+    entry.has_null_count = page_stats.has_null_count;
+    entry.null_count = page_stats.null_count;
+    page_index_entries_.push_back(std::move(entry));
+  }
+
+  void AddPageLocation(int64_t offset, int32_t compressed_page_size) {
+    if (!writes_page_index()) return;
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    page_locations_.push_back(location);
+  }
+
+  void WritePageIndex(::arrow::io::OutputStream* sink, int64_t offset_base) {
+    if (!writes_page_index() || page_locations_.empty() ||
+        page_locations_.size() != page_index_entries_.size()) {
+      return;
+    }
+    ThriftSerializer serializer;
+
+    // A ColumnIndex can only be written if every page has min/max statistics,
+    // except for pages containing only nulls.
+    bool has_column_index = true;
+    bool has_null_counts = true;
+    for (const auto& entry : page_index_entries_) {
+      has_column_index &= entry.null_page || entry.has_min_max;
+      has_null_counts &= entry.has_null_count;
+    }
+    if (has_column_index) {
+      format::ColumnIndex column_index;
+      for (const auto& entry : page_index_entries_) {
+        column_index.null_pages.push_back(entry.null_page);
+        column_index.min_values.push_back(entry.null_page ? "" : entry.min);
+        column_index.max_values.push_back(entry.null_page ? "" : entry.max);
+        if (has_null_counts) column_index.null_counts.push_back(entry.null_count);
+      }
+      column_index.__isset.null_counts = has_null_counts;
+      column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+
+      PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+      int64_t length = serializer.Serialize(&column_index, sink);
+      column_chunk_->__set_column_index_offset(offset_base + position);
+      column_chunk_->__set_column_index_length(static_cast<int32_t>(length));
+    }
+
+    format::OffsetIndex offset_index;
+    for (size_t i = 0; i < page_locations_.size(); ++i) {
+      format::PageLocation location = page_locations_[i];
+      location.__set_offset(offset_base + location.offset);
+      location.__set_first_row_index(page_index_entries_[i].first_row_index);
+      offset_index.page_locations.push_back(location);
+    }
+    PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+    int64_t length = serializer.Serialize(&offset_index, sink);
+    column_chunk_->__set_offset_index_offset(offset_base + position);
+    column_chunk_->__set_offset_index_length(static_cast<int32_t>(length));
+  }
+
+  BloomFilter* bloom_filter() { return bloom_filter_.get(); }
+
+  void WriteBloomFilter(::arrow::io::OutputStream* sink, int64_t offset_base) {
+    if (!bloom_filter_) return;
+    PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+    bloom_filter_->WriteTo(sink);
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset_base + position);
+  }
+
   const ColumnDescriptor* descr() const { return column_; }
   int64_t total_compressed_size() const {
     return column_chunk_->meta_data.total_compressed_size;
@@ -1446,12 +1574,49 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_path_in_schema(column_->path()->ToDotVector());
     column_chunk_->meta_data.__set_codec(
         ToThrift(properties_->compression(column_->path())));
+
+    const BloomFilterOptions* bloom_filter_options =
+        properties_->bloom_filter_options(column_->path());
+    if (bloom_filter_options != nullptr &&
+        column_->physical_type() != Type::BOOLEAN && !is_encrypted()) {
+      bloom_filter_.reset(new BlockSplitBloomFilter());
+      bloom_filter_->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                              static_cast<uint32_t>(bloom_filter_options->ndv),
+                              bloom_filter_options->fpp) /
+                          8);
+    }
   }
 
+  bool is_encrypted() const {
+    const auto& encrypt_md =
+        properties_->column_encryption_properties(column_->path()->ToDotString());
+    return encrypt_md != nullptr && encrypt_md->is_encrypted();
+  }
+
+  // Page indexes address rows, which only match values for non-repeated columns,
+  // and are not written encrypted.
+  bool writes_page_index() const {
+    return properties_->write_page_index() && column_->max_repetition_level() == 0 &&
+           !is_encrypted();
+  }
+
+  struct PageIndexEntry {
+    int64_t first_row_index;
+    bool null_page;
+    bool has_min_max;
+    std::string min;
+    std::string max;
+    bool has_null_count;
+    int64_t null_count;
+  };
+
   format::ColumnChunk* column_chunk_;
   std::unique_ptr<format::ColumnChunk> owned_column_chunk_;
   const std::shared_ptr<WriterProperties> properties_;
   const ColumnDescriptor* column_;
+  std::vector<PageIndexEntry> page_index_entries_;
+  std::vector<format::PageLocation> page_locations_;
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter_;
 };
 
 std::unique_ptr<ColumnChunkMetaDataBuilder> ColumnChunkMetaDataBuilder::Make(
@@ -1504,6 +1669,29 @@ void ColumnChunkMetaDataBuilder::WriteTo(::arrow::io::OutputStream* sink) {
   impl_->WriteTo(sink);
 }
 
+void ColumnChunkMetaDataBuilder::AddPageIndexEntry(const EncodedStatistics& page_stats,
+                                                   int64_t first_row_index,
+                                                   int64_t num_values) {
+  impl_->AddPageIndexEntry(page_stats, first_row_index, num_values);
+}
+
+void ColumnChunkMetaDataBuilder::AddPageLocation(int64_t offset,
+                                                 int32_t compressed_page_size) {
+  impl_->AddPageLocation(offset, compressed_page_size);
+}
+
+void ColumnChunkMetaDataBuilder::WritePageIndex(::arrow::io::OutputStream* sink,
+                                                int64_t offset_base) {
+  impl_->WritePageIndex(sink, offset_base);
+}
+
+BloomFilter* ColumnChunkMetaDataBuilder::bloom_filter() { return impl_->bloom_filter(); }
+
+void ColumnChunkMetaDataBuilder::WriteBloomFilter(::arrow::io::OutputStream* sink,
+                                                  int64_t offset_base) {
+  impl_->WriteBloomFilter(sink, offset_base);
+}
+
 const ColumnDescriptor* ColumnChunkMetaDataBuilder::descr() const {
   return impl_->descr();
 }
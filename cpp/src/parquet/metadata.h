@@ -31,6 +31,7 @@
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnDescriptor;
 class EncodedStatistics;
 class Statistics;
@@ -161,6 +162,21 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // Location of the serialized ColumnIndex and OffsetIndex of this column chunk
+  // in the file, if page indexes were written. See RowGroupReader::GetColumnIndex
+  // and RowGroupReader::GetOffsetIndex.
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // Offset of the bloom filter of this column chunk in the file, if one was
+  // written. See RowGroupReader::GetColumnBloomFilter.
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -415,6 +431,29 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   // For writing metadata at end of column chunk
   void WriteTo(::arrow::io::OutputStream* sink);
 
+  // Page index: record the statistics and first row of each data page, in the
+  // order the pages are built, and the location of each data page, in the
+  // order they are written. These are ignored unless the writer properties
+  // enable page indexes and the column supports them.
+  void AddPageIndexEntry(const EncodedStatistics& page_stats, int64_t first_row_index,
+                         int64_t num_values);
+  void AddPageLocation(int64_t offset, int32_t compressed_page_size);
+
+  // Serialize the ColumnIndex and OffsetIndex recorded so far to the sink and
+  // set their locations in the column chunk. `offset_base` is added to page
+  // and index offsets, for sinks that don't start at the beginning of the file.
+  // Call after WriteTo, so that file_offset still points to the column metadata;
+  // the index locations are serialized with the file footer.
+  void WritePageIndex(::arrow::io::OutputStream* sink, int64_t offset_base = 0);
+
+  // The bloom filter to insert the hashes of the column values into, or null if
+  // the writer properties don't request one for this column.
+  BloomFilter* bloom_filter();
+
+  // Serialize the bloom filter to the sink and set its offset in the column
+  // metadata. Like WritePageIndex, call after WriteTo.
+  void WriteBloomFilter(::arrow::io::OutputStream* sink, int64_t offset_base = 0);
+
  private:
   explicit ColumnChunkMetaDataBuilder(std::shared_ptr<WriterProperties> props,
                                       const ColumnDescriptor* column);
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const auto& location : offset_index.page_locations) {
+    if (location.offset < 0 || location.compressed_page_size < 0 ||
+        location.first_row_index < 0 ||
+        (!page_locations.empty() &&
+         location.first_row_index < page_locations.back().first_row_index)) {
+      throw ParquetException("Invalid OffsetIndex (corrupt file?)");
+    }
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+int64_t OffsetIndex::num_rows(int i, int64_t row_group_num_rows) const {
+  const int64_t end = i + 1 < num_pages() ? page_locations_[i + 1].first_row_index
+                                          : row_group_num_rows;
+  return end - page_locations_[i].first_row_index;
+}
+
+int OffsetIndex::FindPage(int64_t row_index) const {
+  auto it = std::upper_bound(
+      page_locations_.begin(), page_locations_.end(), row_index,
+      [](int64_t row, const PageLocation& page) { return row < page.first_row_index; });
+  return static_cast<int>(it - page_locations_.begin()) - 1;
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Invalid ColumnIndex (corrupt file?)");
+  }
+
+  std::unique_ptr<ColumnIndex> result(new ColumnIndex(descr));
+  result->null_pages_ = std::move(column_index.null_pages);
+  result->min_values_ = std::move(column_index.min_values);
+  result->max_values_ = std::move(column_index.max_values);
+  // Check the range of the raw value, as for LoadEnumSafe
+  const auto boundary_order = internal::LoadEnumRaw(&column_index.boundary_order);
+  if (boundary_order == format::BoundaryOrder::ASCENDING) {
+    result->boundary_order_ = BoundaryOrder::ASCENDING;
+  } else if (boundary_order == format::BoundaryOrder::DESCENDING) {
+    result->boundary_order_ = BoundaryOrder::DESCENDING;
+  }
+  result->has_null_counts_ = column_index.__isset.null_counts;
+  result->null_counts_ = std::move(column_index.null_counts);
+  return result;
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i,
+                                                         int64_t num_values) const {
+  const bool has_min_max = !null_pages_[i];
+  const int64_t null_count = has_null_counts_ ? null_counts_[i] : 0;
+  return Statistics::Make(descr_, has_min_max ? min_values_[i] : "",
+                          has_min_max ? max_values_[i] : "", num_values, null_count,
+                          /*distinct_count=*/0, has_min_max, has_null_counts_,
+                          /*has_distinct_count=*/false);
+}
+
+}  // namespace parquet
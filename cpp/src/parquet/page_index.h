@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page indexes (ColumnIndex and OffsetIndex) describe the data pages of a
+// column chunk, so that readers can skip pages without reading their headers.
+// See https://github.com/apache/parquet-format/blob/master/PageIndex.md
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class Statistics;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Location of a data page in the file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief The locations of the data pages of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex from its thrift representation
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  /// \brief Return the number of rows in page i, given the number of rows of the
+  /// row group
+  int64_t num_rows(int i, int64_t row_group_num_rows) const;
+
+  /// \brief Return the index of the page containing the given row, or -1 if the
+  /// row precedes the first page
+  int FindPage(int64_t row_index) const;
+
+ private:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations)
+      : page_locations_(std::move(page_locations)) {}
+
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief Per-page statistics of a column chunk
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex from its thrift representation
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  const ColumnDescriptor* descr() const { return descr_; }
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether page i contains only nulls, in which case it has no min/max
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+
+  /// \brief Plain-encoded lower bounds of the values of each page
+  const std::vector<std::string>& encoded_min_values() const { return min_values_; }
+
+  /// \brief Plain-encoded upper bounds of the values of each page
+  const std::vector<std::string>& encoded_max_values() const { return max_values_; }
+
+  BoundaryOrder::type boundary_order() const { return boundary_order_; }
+
+  bool has_null_counts() const { return has_null_counts_; }
+
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+  /// \brief Decode the statistics of page i.
+  ///
+  /// The column index doesn't record how many values a page holds, so
+  /// `num_values` must be supplied by the caller, e.g. from the OffsetIndex of a
+  /// non-repeated column, minus the null count.
+  std::shared_ptr<Statistics> page_statistics(int i, int64_t num_values) const;
+
+ private:
+  explicit ColumnIndex(const ColumnDescriptor* descr) : descr_(descr) {}
+
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  BoundaryOrder::type boundary_order_ = BoundaryOrder::UNORDERED;
+  bool has_null_counts_ = false;
+  std::vector<int64_t> null_counts_;
+};
+
+}  // namespace parquet
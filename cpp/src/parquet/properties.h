@@ -26,6 +26,7 @@
 #include "arrow/io/caching.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/optional.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/exception.h"
 #include "parquet/parquet_version.h"
@@ -60,6 +61,10 @@ enum class ParquetDataPageVersion { V1, V2 };
 
 /// Align the default buffer size to a small multiple of a page size.
 constexpr int64_t kDefaultBufferSize = 4096 * 4;
+// PARQUET-978: Minimize footer reads by reading 64 KB from the end of the file
+constexpr int64_t kDefaultFooterReadSize = 64 * 1024;
+/// Bound on the uncompressed size of the pages decompressed ahead of the reader
+constexpr int64_t kDefaultPageReadaheadBytes = 16 * 1024 * 1024;
 
 class PARQUET_EXPORT ReaderProperties {
  public:
@@ -85,6 +90,29 @@ class PARQUET_EXPORT ReaderProperties {
   int64_t buffer_size() const { return buffer_size_; }
   void set_buffer_size(int64_t size) { buffer_size_ = size; }
 
+  /// The number of bytes speculatively read from the end of the file when
+  /// opening it, in the hope that they hold the whole footer. The footer is
+  /// re-fetched with a second read only if it turns out to be larger.
+  ///
+  /// If this covers the whole file, later reads of column chunks are served from
+  /// that first read too, so that small files on high-latency filesystems cost a
+  /// single round trip.
+  int64_t footer_read_size() const { return footer_read_size_; }
+  void set_footer_read_size(int64_t size) { footer_read_size_ = size; }
+
+  /// The number of pages of a column chunk that are read and decompressed on
+  /// the CPU thread pool ahead of the page being decoded, so that decompression
+  /// overlaps with decoding. 0 (the default) decompresses each page when it is
+  /// decoded.
+  ///
+  /// Fewer pages are read ahead once their uncompressed size reaches
+  /// `page_readahead_bytes()`.
+  int32_t page_readahead() const { return page_readahead_; }
+  void set_page_readahead(int32_t num_pages) { page_readahead_ = num_pages; }
+
+  int64_t page_readahead_bytes() const { return page_readahead_bytes_; }
+  void set_page_readahead_bytes(int64_t size) { page_readahead_bytes_ = size; }
+
   void file_decryption_properties(std::shared_ptr<FileDecryptionProperties> decryption) {
     file_decryption_properties_ = std::move(decryption);
   }
@@ -96,6 +124,9 @@ class PARQUET_EXPORT ReaderProperties {
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
+  int64_t footer_read_size_ = kDefaultFooterReadSize;
+  int32_t page_readahead_ = 0;
+  int64_t page_readahead_bytes_ = kDefaultPageReadaheadBytes;
   bool buffered_stream_enabled_ = false;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
@@ -107,11 +138,23 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_STATISTICS_TRUNCATION_ENABLED = true;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+
+/// \brief Sizing of the bloom filter written for a column chunk
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected number of distinct values in a column chunk
+  int32_t ndv = DEFAULT_BLOOM_FILTER_NDV;
+  /// Target false positive probability, in (0.0, 1.0)
+  double fpp = DEFAULT_BLOOM_FILTER_FPP;
+};
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -125,6 +168,7 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
+        statistics_truncation_enabled_(DEFAULT_IS_STATISTICS_TRUNCATION_ENABLED),
         compression_level_(Codec::UseDefaultCompressionLevel()) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
@@ -143,10 +187,18 @@ class PARQUET_EXPORT ColumnProperties {
     max_stats_size_ = max_stats_size;
   }
 
+  void set_statistics_truncation_enabled(bool statistics_truncation_enabled) {
+    statistics_truncation_enabled_ = statistics_truncation_enabled;
+  }
+
   void set_compression_level(int compression_level) {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_options(const BloomFilterOptions& options) {
+    bloom_filter_options_ = options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -157,15 +209,24 @@ class PARQUET_EXPORT ColumnProperties {
 
   size_t max_statistics_size() const { return max_stats_size_; }
 
+  bool statistics_truncation_enabled() const { return statistics_truncation_enabled_; }
+
   int compression_level() const { return compression_level_; }
 
+  /// \brief The bloom filter options, or null if no bloom filter is written
+  const BloomFilterOptions* bloom_filter_options() const {
+    return bloom_filter_options_ ? &*bloom_filter_options_ : NULLPTR;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
   bool dictionary_enabled_;
   bool statistics_enabled_;
   size_t max_stats_size_;
+  bool statistics_truncation_enabled_;
   int compression_level_;
+  ::arrow::util::optional<BloomFilterOptions> bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -177,10 +238,12 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -231,6 +294,14 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Target size of a row group written by parquet::arrow::FileWriter's
+    /// WriteRecordBatch, as estimated from its encoded (and compressed) pages.
+    /// Default 128MB.
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -304,6 +375,31 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Truncate the min/max statistics of BYTE_ARRAY columns to
+    /// max_statistics_size() bytes instead of omitting them when they are longer.
+    /// The truncated max is rounded up so that it still bounds the values. Only
+    /// applies to columns ordered bytewise (e.g. strings, not decimals).
+    /// Enabled by default.
+    Builder* enable_statistics_truncation() {
+      default_column_properties_.set_statistics_truncation_enabled(true);
+      return this;
+    }
+
+    Builder* disable_statistics_truncation() {
+      default_column_properties_.set_statistics_truncation_enabled(false);
+      return this;
+    }
+
+    Builder* enable_statistics_truncation(const std::string& path) {
+      statistics_truncation_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* disable_statistics_truncation(const std::string& path) {
+      statistics_truncation_enabled_[path] = false;
+      return this;
+    }
+
     Builder* compression(const std::string& path, Compression::type codec) {
       codecs_[path] = codec;
       return this;
@@ -397,6 +493,47 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a ColumnIndex (per-page min/max and null counts) and an OffsetIndex
+    /// (page locations) for each column chunk, so that readers can skip pages.
+    /// Page indexes are only written for non-repeated, unencrypted columns.
+    /// Disabled by default.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
+    /// Write a split block bloom filter for the column described by path, so that
+    /// readers can skip row groups not containing the values looked up by an
+    /// equality predicate. Bloom filters aren't written for BOOLEAN or encrypted
+    /// columns. Disabled by default.
+    Builder* enable_bloom_filter(const std::string& path,
+                                BloomFilterOptions options = BloomFilterOptions()) {
+      if (options.ndv <= 0 || !(options.fpp > 0.0 && options.fpp < 1.0)) {
+        throw ParquetException("Invalid bloom filter options");
+      }
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                BloomFilterOptions options = BloomFilterOptions()) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -415,11 +552,16 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : statistics_truncation_enabled_)
+        get(item.first).set_statistics_truncation_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          max_row_group_bytes_, pagesize_, version_, created_by_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties, data_page_version_, write_page_index_));
     }
 
    private:
@@ -427,10 +569,12 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -441,6 +585,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> statistics_truncation_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -451,6 +597,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -461,6 +609,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -508,6 +658,16 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool statistics_truncation_enabled(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).statistics_truncation_enabled();
+  }
+
+  const BloomFilterOptions* bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -524,20 +684,23 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version,
       const std::string& created_by,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool write_page_index)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        write_page_index_(write_page_index),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -546,10 +709,12 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool write_page_index_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -581,6 +746,12 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   bool use_threads() const { return use_threads_; }
 
+  /// \brief Read the given column directly as an Arrow dictionary array with
+  /// int32 indices, instead of expanding its dictionary-encoded values.
+  ///
+  /// Supported for binary, string, fixed-size binary, 32 and 64-bit integer,
+  /// floating-point, date32, time32 and time64 columns; ignored for others.
+  /// Column chunks sharing the same dictionary are read into the same chunk.
   void set_read_dictionary(int column_index, bool read_dict) {
     if (read_dict) {
       read_dict_indices_.insert(column_index);
@@ -649,7 +820,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(false) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -701,11 +873,20 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of a row group concurrently
+    /// on the CPU thread pool when writing a Table.
+    ///
+    /// Each row group is buffered in memory until all of its columns are encoded.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_));
     }
 
    private:
@@ -718,6 +899,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -744,20 +927,24 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether column chunks are encoded concurrently by WriteTable.
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -766,6 +953,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -35,6 +35,9 @@ TEST(TestReaderProperties, Basics) {
   ReaderProperties props;
 
   ASSERT_EQ(props.buffer_size(), kDefaultBufferSize);
+  ASSERT_EQ(props.footer_read_size(), kDefaultFooterReadSize);
+  ASSERT_EQ(props.page_readahead(), 0);
+  ASSERT_EQ(props.page_readahead_bytes(), kDefaultPageReadaheadBytes);
   ASSERT_FALSE(props.is_buffered_stream_enabled());
 }
 
@@ -43,6 +46,7 @@ TEST(TestWriterProperties, Basics) {
 
   ASSERT_EQ(kDefaultDataPageSize, props->data_pagesize());
   ASSERT_EQ(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT, props->dictionary_pagesize_limit());
+  ASSERT_EQ(DEFAULT_MAX_ROW_GROUP_BYTES, props->max_row_group_bytes());
   ASSERT_EQ(ParquetVersion::PARQUET_1_0, props->version());
   ASSERT_EQ(ParquetDataPageVersion::V1, props->data_page_version());
 }
@@ -21,11 +21,15 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/checked_cast.h"
@@ -548,6 +552,92 @@ TEST(TestFileReader, BufferedReads) {
   }
 }
 
+// Forwards to a wrapped file, counting the reads
+class CountingFile : public ::arrow::io::RandomAccessFile {
+ public:
+  explicit CountingFile(std::shared_ptr<::arrow::io::RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  ::arrow::Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  ::arrow::Result<int64_t> Tell() const override { return file_->Tell(); }
+  ::arrow::Status Seek(int64_t position) override { return file_->Seek(position); }
+  ::arrow::Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  ::arrow::Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->Read(nbytes, out);
+  }
+  ::arrow::Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ++num_reads_;
+    return file_->Read(nbytes);
+  }
+  ::arrow::Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes, out);
+  }
+  ::arrow::Result<std::shared_ptr<Buffer>> ReadAt(int64_t position,
+                                                  int64_t nbytes) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<::arrow::io::RandomAccessFile> file_;
+  int num_reads_ = 0;
+};
+
+TEST(TestFileReader, SpeculativeFooterRead) {
+  const int num_rows = 100;
+
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("field", Repetition::REQUIRED, Type::INT32)}));
+  ASSERT_OK_AND_ASSIGN(auto out_file, ::arrow::io::BufferOutputStream::Create());
+  std::shared_ptr<ParquetFileWriter> file_writer =
+      ParquetFileWriter::Open(out_file, schema);
+  RowGroupWriter* rg_writer = file_writer->AppendRowGroup();
+  std::vector<int32_t> values(num_rows);
+  std::iota(values.begin(), values.end(), 0);
+  static_cast<Int32Writer*>(rg_writer->NextColumn())
+      ->WriteBatch(num_rows, nullptr, nullptr, values.data());
+  rg_writer->Close();
+  file_writer->Close();
+  ASSERT_OK_AND_ASSIGN(auto file_buf, out_file->Finish());
+
+  auto read_all = [&](const ReaderProperties& props) {
+    auto in_file = std::make_shared<CountingFile>(
+        std::make_shared<::arrow::io::BufferReader>(file_buf));
+    std::unique_ptr<ParquetFileReader> file_reader =
+        ParquetFileReader::Open(in_file, props);
+    const int reads_to_open = in_file->num_reads();
+
+    auto col_reader =
+        std::static_pointer_cast<Int32Reader>(file_reader->RowGroup(0)->Column(0));
+    std::vector<int32_t> read_values(num_rows);
+    int64_t values_read = 0;
+    col_reader->ReadBatch(num_rows, nullptr, nullptr, read_values.data(), &values_read);
+    EXPECT_EQ(num_rows, values_read);
+    EXPECT_EQ(values, read_values);
+    return std::make_pair(reads_to_open, in_file->num_reads());
+  };
+
+  // The default footer read covers this small file: a single read serves both the
+  // metadata and the column chunk
+  ReaderProperties props;
+  ASSERT_GT(props.footer_read_size(), file_buf->size());
+  ASSERT_EQ(std::make_pair(1, 1), read_all(props));
+
+  // A too small footer read requires reading the metadata and the column chunk
+  // separately
+  props.set_footer_read_size(16);
+  auto reads = read_all(props);
+  ASSERT_EQ(2, reads.first);
+  ASSERT_GT(reads.second, reads.first);
+}
+
 class TestCodec : public ::testing::TestWithParam<std::string> {
  protected:
   const std::string& GetDataFile() { return GetParam(); }
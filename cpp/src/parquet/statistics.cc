@@ -32,6 +32,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/encoding.h"
 #include "parquet/exception.h"
@@ -714,8 +715,90 @@ void TypedStatisticsImpl<ByteArrayType>::PlainDecode(const std::string& src,
   dst->ptr = reinterpret_cast<const uint8_t*>(src.c_str());
 }
 
+// ----------------------------------------------------------------------
+// Truncation of binary statistics
+
+using ::arrow::util::Utf8IsContinuation;
+
+uint8_t ByteAt(const std::string& value, size_t i) {
+  return static_cast<uint8_t>(value[i]);
+}
+
+// Increment the last byte of value that is not 0xFF, dropping the bytes after it
+bool IncrementBytes(std::string* value) {
+  while (!value->empty()) {
+    const uint8_t last = ByteAt(*value, value->size() - 1);
+    if (last != 0xFF) {
+      value->back() = static_cast<char>(last + 1);
+      return true;
+    }
+    value->pop_back();
+  }
+  return false;
+}
+
+// Increment the last code point of value that can be incremented without growing
+// its encoding, dropping the code points after it. Invalid UTF-8 is incremented
+// bytewise instead.
+bool IncrementUtf8(std::string* value) {
+  while (!value->empty()) {
+    size_t start = value->size() - 1;
+    while (start > 0 && Utf8IsContinuation(ByteAt(*value, start))) {
+      --start;
+    }
+    const size_t width = value->size() - start;
+    const auto begin = reinterpret_cast<const uint8_t*>(value->data()) + start;
+    const uint8_t* end = begin;
+    uint32_t codepoint;
+    // The terminating NUL stops decoding of a truncated sequence
+    if (!::arrow::util::UTF8Decode(&end, &codepoint) ||
+        static_cast<size_t>(end - begin) != width) {
+      return IncrementBytes(value);
+    }
+    uint32_t next = codepoint + 1;
+    if (next == 0xD800) {
+      // Skip the surrogates, which are not valid code points
+      next = 0xE000;
+    }
+    if (next < ::arrow::util::kMaxUnicodeCodepoint) {
+      uint8_t encoded[4];
+      const auto encoded_width =
+          static_cast<size_t>(::arrow::util::UTF8Encode(encoded, next) - encoded);
+      if (encoded_width <= width) {
+        value->replace(start, width, reinterpret_cast<const char*>(encoded),
+                       encoded_width);
+        return true;
+      }
+    }
+    value->resize(start);
+  }
+  return false;
+}
+
+// The length of the longest prefix of value of at most length bytes that does not
+// split a UTF-8 code point
+size_t Utf8PrefixLength(const std::string& value, size_t length) {
+  while (length > 0 && Utf8IsContinuation(ByteAt(value, length))) {
+    --length;
+  }
+  return length;
+}
+
 }  // namespace
 
+void EncodedStatistics::TruncateMinMax(size_t length, bool is_utf8) {
+  // The strings may be shared with copies of these statistics, so replace them
+  if (has_min && min_->length() > length) {
+    const size_t prefix_length = is_utf8 ? Utf8PrefixLength(*min_, length) : length;
+    min_ = std::make_shared<std::string>(*min_, 0, prefix_length);
+  }
+  if (has_max && max_->length() > length) {
+    const size_t prefix_length = is_utf8 ? Utf8PrefixLength(*max_, length) : length;
+    max_ = std::make_shared<std::string>(*max_, 0, prefix_length);
+    has_max = is_utf8 ? IncrementUtf8(max_.get()) : IncrementBytes(max_.get());
+  }
+}
+
 // ----------------------------------------------------------------------
 // Public factory functions
 
@@ -151,6 +151,12 @@ class PARQUET_EXPORT EncodedStatistics {
     }
   }
 
+  // Truncate min and max, which must be ordered bytewise, to at most length bytes
+  // rather than dropping them: the min is cut to a prefix and the max is cut and
+  // its last byte (or code point if is_utf8) incremented so that both remain
+  // bounds of the values. A max made only of 0xFF bytes (or U+10FFFF) is dropped.
+  void TruncateMinMax(size_t length, bool is_utf8);
+
   bool is_set() const {
     return has_min || has_max || has_null_count || has_distinct_count;
   }
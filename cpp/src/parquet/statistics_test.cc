@@ -643,6 +643,48 @@ TEST(CorrectStatistics, Basics) {
   AssertStatsSet(version, props, schema.Column(5), true);
 }
 
+TEST(EncodedStatistics, TruncateMinMax) {
+  auto truncate = [](const std::string& min, const std::string& max, size_t length,
+                     bool is_utf8) {
+    EncodedStatistics statistics;
+    statistics.set_min(min).set_max(max);
+    statistics.TruncateMinMax(length, is_utf8);
+    return statistics;
+  };
+
+  // Values which fit are kept as is
+  auto statistics = truncate("abc", "abd", 3, /*is_utf8=*/false);
+  ASSERT_EQ("abc", statistics.min());
+  ASSERT_EQ("abd", statistics.max());
+
+  statistics = truncate("abcdef", "abcxyz", 3, /*is_utf8=*/false);
+  ASSERT_EQ("abc", statistics.min());
+  ASSERT_EQ("abd", statistics.max());
+
+  // Trailing 0xFF bytes can't be incremented
+  statistics = truncate("a", std::string("a\xff\xff\xff", 4), 3, /*is_utf8=*/false);
+  ASSERT_EQ("b", statistics.max());
+  statistics = truncate("a", std::string("\xff\xff\xff\xff", 4), 3, /*is_utf8=*/false);
+  ASSERT_TRUE(statistics.has_min);
+  ASSERT_FALSE(statistics.has_max);
+
+  // Code points are not split: "\xc3\xa9" is U+00E9 and "\xc3\xaa" U+00EA
+  statistics = truncate("a\xc3\xa9t\xc3\xa9", "a\xc3\xa9t\xc3\xa9", 4, /*is_utf8=*/true);
+  ASSERT_EQ("a\xc3\xa9t", statistics.min());
+  ASSERT_EQ("a\xc3\xa9u", statistics.max());
+  statistics = truncate("a\xc3\xa9t\xc3\xa9", "a\xc3\xa9t\xc3\xa9", 2, /*is_utf8=*/true);
+  ASSERT_EQ("a", statistics.min());
+  ASSERT_EQ("b", statistics.max());
+  statistics = truncate("ab", "a\xc3\xa9t\xc3\xa9", 3, /*is_utf8=*/true);
+  ASSERT_EQ("a\xc3\xaa", statistics.max());
+  // U+007F would take two bytes once incremented
+  statistics = truncate("ab", "a\x7f\x7f", 2, /*is_utf8=*/true);
+  ASSERT_EQ("b", statistics.max());
+  // U+D7FF is followed by U+E000
+  statistics = truncate("ab", "\xed\x9f\xbf\xed\x9f\xbf", 3, /*is_utf8=*/true);
+  ASSERT_EQ("\xee\x80\x80", statistics.max());
+}
+
 // Test SortOrder class
 static const int NUM_VALUES = 10;
 
@@ -17,12 +17,26 @@
 
 #include "parquet/stream_reader.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+namespace {
+
+template <typename ReaderType>
+int64_t ReadColumnBatch(ColumnReader* reader, int64_t batch_size, int16_t* def_levels,
+                        int16_t* rep_levels, uint8_t* values) {
+  int64_t values_read;
+  return static_cast<ReaderType*>(reader)->ReadBatch(
+      batch_size, def_levels, rep_levels,
+      reinterpret_cast<typename ReaderType::T*>(values), &values_read);
+}
+
+}  // namespace
+
+constexpr int64_t StreamReader::kBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -51,8 +65,17 @@ StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader)
 
   nodes_.resize(schema->num_columns());
 
+  column_buffers_.resize(schema->num_columns());
+  rep_levels_.resize(kBatchSize);
+
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
+
+    auto& buffer = column_buffers_[i];
+    buffer.max_def_level = schema->Column(i)->max_definition_level();
+    buffer.value_byte_size = GetTypeByteSize(nodes_[i]->physical_type());
+    buffer.def_levels.resize(kBatchSize);
+    buffer.values.resize(kBatchSize * buffer.value_byte_size);
   }
   NextRowGroup();
 }
@@ -284,66 +307,105 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
 
 void StreamReader::Read(ByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  auto value = static_cast<const ByteArray*>(ReadValue());
 
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  auto value = static_cast<const ByteArray*>(ReadValue());
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::Read(FixedLenByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  auto value = static_cast<const FixedLenByteArray*>(ReadValue());
 
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  auto value = static_cast<const FixedLenByteArray*>(ReadValue());
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
+}
+
+const void* StreamReader::ReadValue() {
+  const int i = column_index_++;
+  auto& buffer = column_buffers_[i];
+
+  if (buffer.level_index == buffer.num_levels) {
+    auto reader = column_readers_[i].get();
+    int16_t* def_levels = buffer.def_levels.data();
+    int16_t* rep_levels = rep_levels_.data();
+    uint8_t* values = buffer.values.data();
+
+    // Values of BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY columns point into
+    // the current page, which remains valid until the next batch of
+    // the column is read.
+    switch (reader->type()) {
+      case Type::BOOLEAN:
+        buffer.num_levels = ReadColumnBatch<BoolReader>(reader, kBatchSize, def_levels,
+                                                        rep_levels, values);
+        break;
+      case Type::INT32:
+        buffer.num_levels = ReadColumnBatch<Int32Reader>(reader, kBatchSize, def_levels,
+                                                         rep_levels, values);
+        break;
+      case Type::INT64:
+        buffer.num_levels = ReadColumnBatch<Int64Reader>(reader, kBatchSize, def_levels,
+                                                         rep_levels, values);
+        break;
+      case Type::BYTE_ARRAY:
+        buffer.num_levels = ReadColumnBatch<ByteArrayReader>(
+            reader, kBatchSize, def_levels, rep_levels, values);
+        break;
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        buffer.num_levels = ReadColumnBatch<FixedLenByteArrayReader>(
+            reader, kBatchSize, def_levels, rep_levels, values);
+        break;
+      case Type::FLOAT:
+        buffer.num_levels = ReadColumnBatch<FloatReader>(reader, kBatchSize, def_levels,
+                                                         rep_levels, values);
+        break;
+      case Type::DOUBLE:
+        buffer.num_levels = ReadColumnBatch<DoubleReader>(reader, kBatchSize, def_levels,
+                                                          rep_levels, values);
+        break;
+      case Type::INT96:
+        buffer.num_levels = ReadColumnBatch<Int96Reader>(reader, kBatchSize, def_levels,
+                                                         rep_levels, values);
+        break;
+      case Type::UNDEFINED:
+        throw ParquetException("Unexpected type: " + TypeToString(reader->type()));
+        break;
+    }
+    buffer.level_index = 0;
+    buffer.value_index = 0;
+
+    if (buffer.num_levels == 0) {
+      ThrowReadFailedException(nodes_[i]);
+    }
+  }
+  if (buffer.IsNull(buffer.level_index++)) {
+    return nullptr;
+  }
+  return buffer.values.data() + buffer.value_byte_size * buffer.value_index++;
 }
 
 void StreamReader::EndRow() {
@@ -357,7 +419,8 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  const auto& buffer = column_buffers_[0];
+  if (buffer.level_index == buffer.num_levels && !column_readers_[0]->HasNext()) {
     NextRowGroup();
   }
 }
@@ -372,6 +435,9 @@ void StreamReader::NextRowGroup() {
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
+      column_buffers_[i].num_levels = 0;
+      column_buffers_[i].level_index = 0;
+      column_buffers_[i].value_index = 0;
     }
     if (column_readers_[0]->HasNext()) {
       row_group_row_offset_ = current_row_;
@@ -390,6 +456,7 @@ void StreamReader::SetEof() {
   row_group_reader_.reset();
   column_readers_.clear();
   nodes_.clear();
+  column_buffers_.clear();
 }
 
 int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
@@ -401,11 +468,11 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
   while (!eof_ && (num_rows_remaining_to_skip > 0)) {
     int64_t num_rows_in_row_group = row_group_reader_->metadata()->num_rows();
     int64_t num_rows_remaining_in_row_group =
-        num_rows_in_row_group - current_row_ - row_group_row_offset_;
+        num_rows_in_row_group - (current_row_ - row_group_row_offset_);
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -425,14 +492,30 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
+void StreamReader::SkipRowsInColumn(int i, int64_t num_rows_to_skip) {
+  // Skip the rows already decoded first.
+  auto& buffer = column_buffers_[i];
+  const int64_t num_buffered_skipped =
+      std::min(num_rows_to_skip, buffer.num_levels - buffer.level_index);
+
+  for (int64_t j = 0; j < num_buffered_skipped; ++j) {
+    if (!buffer.IsNull(buffer.level_index++)) {
+      ++buffer.value_index;
+    }
+  }
+  num_rows_to_skip -= num_buffered_skipped;
+  if (num_rows_to_skip == 0) {
+    return;
+  }
+
+  auto reader = column_readers_[i].get();
   int64_t num_skipped = 0;
 
   switch (reader->type()) {
@@ -53,6 +53,9 @@ namespace parquet {
 /// However, if the value is not present then a ParquetException will
 /// be raised.
 ///
+/// Values are decoded in batches per column and handed out from
+/// these batches.
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamReader {
@@ -208,56 +211,41 @@ class PARQUET_EXPORT StreamReader {
   template <typename ReaderType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+    auto value = static_cast<const typename ReaderType::T*>(ReadValue());
 
-    if (values_read != 1) {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
+    auto value = static_cast<const ReadType*>(ReadValue());
 
-    if (values_read == 1) {
-      *v = tmp;
-    } else {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
+    auto value = static_cast<const ReadType*>(ReadValue());
 
-    if (values_read == 1) {
-      *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
+    if (value != NULLPTR) {
+      *v = T(*value);
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
+  /// \brief Advance to the next column of the row, decoding the next
+  /// batch of the column if needed.
+  /// \return The value of the column or NULLPTR if it is null.
+  const void* ReadValue();
+
   void ReadFixedLength(char* ptr, int len);
 
   void Read(ByteArray* v);
@@ -273,16 +261,34 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int i, int64_t num_rows_to_skip);
 
   void SetEof();
 
  private:
+  // The current batch of definition levels and non-null values
+  // decoded from a column.
+  struct ColumnBuffer {
+    int16_t max_def_level{0};
+    int value_byte_size{0};
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    int64_t num_levels{0};
+    int64_t level_index{0};
+    int64_t value_index{0};
+
+    bool IsNull(int64_t level) const {
+      return max_def_level > 0 && def_levels[level] < max_def_level;
+    }
+  };
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
+  std::vector<int16_t> rep_levels_;
 
   bool eof_{true};
   int row_group_index_{0};
@@ -290,7 +296,8 @@ class PARQUET_EXPORT StreamReader {
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
 
-  static constexpr int64_t kBatchSizeOne = 1;
+  // Number of levels decoded at a time from each column.
+  static constexpr int64_t kBatchSize = 1024;
 };  // namespace parquet
 
 PARQUET_EXPORT
@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "parquet/exception.h"
 #include "parquet/test_util.h"
 
@@ -827,6 +828,55 @@ TEST_F(TestOptionalFields, ReadOptionalFieldAsRequiredField) {
   }
 }
 
+TEST(TestMultipleRowGroups, ReadAndSkipRows) {
+  constexpr int num_rows = 2500;
+  constexpr int row_group_size = 1000;
+
+  schema::NodeVector fields;
+  fields.push_back(schema::PrimitiveNode::Make("int32_field", Repetition::REQUIRED,
+                                               Type::INT32, ConvertedType::INT_32));
+  fields.push_back(schema::PrimitiveNode::Make("string_field", Repetition::OPTIONAL,
+                                               Type::BYTE_ARRAY, ConvertedType::UTF8));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto sink = CreateOutputStream();
+  {
+    // Rows are written in batches, the last ones when the writer is destroyed.
+    StreamWriter os{ParquetFileWriter::Open(sink, schema)};
+    os.SetMaxRowGroupSize(0);
+
+    for (int i = 0; i < num_rows; ++i) {
+      os << TestData::GetInt32(i) << TestData::GetOptString(i) << EndRow;
+      if ((i + 1) % row_group_size == 0) {
+        os << EndRowGroup;
+      }
+    }
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  EXPECT_EQ(3, file_reader->metadata()->num_row_groups());
+
+  StreamReader reader{std::move(file_reader)};
+  EXPECT_EQ(num_rows, reader.num_rows());
+
+  int32_t int32;
+  optional<std::string> opt_string;
+  int num_rows_read = 0;
+
+  // Skipping leaves partially consumed batches and crosses row groups.
+  for (int i = 0; !reader.eof(); ++num_rows_read) {
+    EXPECT_EQ(i, reader.current_row());
+    reader >> int32 >> opt_string >> EndRow;
+    EXPECT_EQ(int32, TestData::GetInt32(i)) << "index: " << i;
+    EXPECT_EQ(opt_string, TestData::GetOptString(i)) << "index: " << i;
+    i += 1 + static_cast<int>(reader.SkipRows(300));
+  }
+  EXPECT_EQ(num_rows, reader.current_row());
+  EXPECT_EQ(9, num_rows_read);
+}
+
 class TestReadingDataFiles : public ::testing::Test {
  protected:
   std::string GetDataFile(const std::string& filename) const {
@@ -21,12 +21,26 @@
 
 namespace parquet {
 
+namespace {
+
+template <typename WriterType>
+int64_t WriteColumnBatch(ColumnWriter* writer, int64_t num_levels,
+                         const int16_t* def_levels, const int16_t* rep_levels,
+                         const void* values) {
+  auto typed_writer = static_cast<WriterType*>(writer);
+  typed_writer->WriteBatch(num_levels, def_levels, rep_levels,
+                           static_cast<const typename WriterType::T*>(values));
+  return typed_writer->EstimatedBufferedValueBytes();
+}
+
+}  // namespace
+
 int64_t StreamWriter::default_row_group_size_{512 * 1024 * 1024};  // 512MB
 
 constexpr int16_t StreamWriter::kDefLevelZero;
 constexpr int16_t StreamWriter::kDefLevelOne;
 constexpr int16_t StreamWriter::kRepLevelZero;
-constexpr int64_t StreamWriter::kBatchSizeOne;
+constexpr int64_t StreamWriter::kBatchSize;
 
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
     : data{data_ptr}, size{std::strlen(data_ptr)} {}
@@ -45,6 +59,37 @@ StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
   }
+  column_buffers_.resize(nodes_.size());
+}
+
+StreamWriter::~StreamWriter() {
+  // Write the remaining values before the file writer is closed.
+  if (file_writer_) {
+    try {
+      FlushColumns();
+    } catch (...) {
+    }
+  }
+}
+
+StreamWriter& StreamWriter::operator=(StreamWriter&& other) {
+  if (this != &other) {
+    if (file_writer_) {
+      FlushColumns();
+    }
+    column_index_ = other.column_index_;
+    current_row_ = other.current_row_;
+    row_group_size_ = other.row_group_size_;
+    max_row_group_size_ = other.max_row_group_size_;
+    num_buffered_rows_ = other.num_buffered_rows_;
+    buffered_bytes_ = other.buffered_bytes_;
+    file_writer_ = std::move(other.file_writer_);
+    row_group_writer_ = std::move(other.row_group_writer_);
+    nodes_ = std::move(other.nodes_);
+    column_buffers_ = std::move(other.column_buffers_);
+    rep_levels_ = std::move(other.rep_levels_);
+  }
+  return *this;
 }
 
 void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
@@ -143,44 +188,33 @@ StreamWriter& StreamWriter::operator<<(::arrow::util::string_view v) {
 StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
                                                 std::size_t data_len) {
   CheckColumn(Type::BYTE_ARRAY, ConvertedType::UTF8);
-
-  auto writer = static_cast<ByteArrayWriter*>(row_group_writer_->column(column_index_++));
-
-  if (data_ptr != nullptr) {
-    ByteArray ba_value;
-
-    ba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    ba_value.len = static_cast<uint32_t>(data_len);
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &ba_value);
-  } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
-  }
+  BufferValue(data_ptr, data_len, /*variable_length=*/true);
   return *this;
 }
 
 StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t data_len) {
   CheckColumn(Type::FIXED_LEN_BYTE_ARRAY, ConvertedType::NONE,
               static_cast<int>(data_len));
+  BufferValue(data_ptr, data_len);
+  return *this;
+}
 
-  auto writer =
-      static_cast<FixedLenByteArrayWriter*>(row_group_writer_->column(column_index_++));
+void StreamWriter::BufferValue(const void* data_ptr, std::size_t data_len,
+                               bool variable_length) {
+  auto& buffer = column_buffers_[column_index_++];
 
   if (data_ptr != nullptr) {
-    FixedLenByteArray flba_value;
+    auto bytes = static_cast<const uint8_t*>(data_ptr);
 
-    flba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &flba_value);
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.values.insert(buffer.values.end(), bytes, bytes + data_len);
+    if (variable_length) {
+      buffer.lengths.push_back(static_cast<uint32_t>(data_len));
+    }
+    buffered_bytes_ += static_cast<int64_t>(data_len);
   } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
+    buffer.def_levels.push_back(kDefLevelZero);
   }
-  return *this;
 }
 
 void StreamWriter::CheckColumn(Type::type physical_type,
@@ -226,50 +260,11 @@ int64_t StreamWriter::SkipColumns(int num_columns_to_skip) {
       throw ParquetException("Cannot skip column '" + node->name() +
                              "' as it is required.");
     }
-    auto writer = row_group_writer_->column(column_index_++);
-
-    WriteNullValue(writer);
+    BufferValue(nullptr, 0);
   }
   return num_columns_skipped;
 }
 
-void StreamWriter::WriteNullValue(ColumnWriter* writer) {
-  switch (writer->type()) {
-    case Type::BOOLEAN:
-      static_cast<BoolWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                   &kRepLevelZero, nullptr);
-      break;
-    case Type::INT32:
-      static_cast<Int32Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::INT64:
-      static_cast<Int64Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::BYTE_ARRAY:
-      static_cast<ByteArrayWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                        &kRepLevelZero, nullptr);
-      break;
-    case Type::FIXED_LEN_BYTE_ARRAY:
-      static_cast<FixedLenByteArrayWriter*>(writer)->WriteBatch(
-          kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-      break;
-    case Type::FLOAT:
-      static_cast<FloatWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::DOUBLE:
-      static_cast<DoubleWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                     &kRepLevelZero, nullptr);
-      break;
-    case Type::INT96:
-    case Type::UNDEFINED:
-      throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
-      break;
-  }
-}
-
 void StreamWriter::SkipOptionalColumn() {
   if (SkipColumns(1) != 1) {
     throw ParquetException("Failed to skip optional column at column index " +
@@ -288,15 +283,12 @@ void StreamWriter::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    //
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  if (++num_buffered_rows_ >= kBatchSize) {
+    FlushColumns();
+  }
+  if ((max_row_group_size_ > 0) &&
+      (row_group_size_ + buffered_bytes_ > max_row_group_size_)) {
+    EndRowGroup();
   }
 }
 
@@ -304,11 +296,101 @@ void StreamWriter::EndRowGroup() {
   if (!file_writer_) {
     throw ParquetException("StreamWriter not initialized");
   }
+  FlushColumns();
+
   // Avoid creating empty row groups.
   if (row_group_writer_->num_rows() > 0) {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
+    row_group_size_ = 0;
+  }
+}
+
+void StreamWriter::FlushColumns() {
+  int64_t buffered_value_bytes = 0;
+
+  for (int i = 0; i < num_columns(); ++i) {
+    buffered_value_bytes += FlushColumn(i);
+  }
+  num_buffered_rows_ = 0;
+  buffered_bytes_ = 0;
+
+  // Size already written (compressed + uncompressed) and the size of
+  // the values not written to a page yet.
+  //
+  row_group_size_ = row_group_writer_->total_bytes_written() +
+                    row_group_writer_->total_compressed_bytes() + buffered_value_bytes;
+}
+
+int64_t StreamWriter::FlushColumn(int i) {
+  auto& buffer = column_buffers_[i];
+  const auto num_levels = static_cast<int64_t>(buffer.def_levels.size());
+
+  if (num_levels == 0) {
+    return 0;
+  }
+  if (static_cast<int64_t>(rep_levels_.size()) < num_levels) {
+    rep_levels_.resize(num_levels, kRepLevelZero);
+  }
+  auto writer = row_group_writer_->column(i);
+  const int16_t* def_levels = buffer.def_levels.data();
+  const int16_t* rep_levels = rep_levels_.data();
+  const uint8_t* values = buffer.values.data();
+  int64_t buffered_value_bytes = 0;
+
+  switch (writer->type()) {
+    case Type::BOOLEAN:
+      buffered_value_bytes = WriteColumnBatch<BoolWriter>(writer, num_levels, def_levels,
+                                                          rep_levels, values);
+      break;
+    case Type::INT32:
+      buffered_value_bytes = WriteColumnBatch<Int32Writer>(writer, num_levels, def_levels,
+                                                           rep_levels, values);
+      break;
+    case Type::INT64:
+      buffered_value_bytes = WriteColumnBatch<Int64Writer>(writer, num_levels, def_levels,
+                                                           rep_levels, values);
+      break;
+    case Type::BYTE_ARRAY: {
+      std::vector<ByteArray> byte_arrays(buffer.lengths.size());
+      for (std::size_t j = 0; j < byte_arrays.size(); ++j) {
+        byte_arrays[j].ptr = values;
+        byte_arrays[j].len = buffer.lengths[j];
+        values += buffer.lengths[j];
+      }
+      buffered_value_bytes = WriteColumnBatch<ByteArrayWriter>(
+          writer, num_levels, def_levels, rep_levels, byte_arrays.data());
+      break;
+    }
+    case Type::FIXED_LEN_BYTE_ARRAY: {
+      const int type_length = nodes_[i]->type_length();
+      std::vector<FixedLenByteArray> fixed_len_byte_arrays(
+          type_length > 0 ? buffer.values.size() / type_length : 0);
+      for (auto& fixed_len_byte_array : fixed_len_byte_arrays) {
+        fixed_len_byte_array.ptr = values;
+        values += type_length;
+      }
+      buffered_value_bytes = WriteColumnBatch<FixedLenByteArrayWriter>(
+          writer, num_levels, def_levels, rep_levels, fixed_len_byte_arrays.data());
+      break;
+    }
+    case Type::FLOAT:
+      buffered_value_bytes = WriteColumnBatch<FloatWriter>(writer, num_levels, def_levels,
+                                                           rep_levels, values);
+      break;
+    case Type::DOUBLE:
+      buffered_value_bytes = WriteColumnBatch<DoubleWriter>(
+          writer, num_levels, def_levels, rep_levels, values);
+      break;
+    case Type::INT96:
+    case Type::UNDEFINED:
+      throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
+      break;
   }
+  buffer.def_levels.clear();
+  buffer.values.clear();
+  buffer.lengths.clear();
+  return buffered_value_bytes;
 }
 
 StreamWriter& operator<<(StreamWriter& os, EndRowType) {
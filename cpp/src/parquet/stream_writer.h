@@ -57,6 +57,10 @@ namespace parquet {
 /// have a value (i.e. it is nullopt) then a ParquetException will be
 /// raised.
 ///
+/// Values are buffered per column and handed to the column writers
+/// in batches, at the latest when the row group ends or the writer is
+/// destroyed.
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamWriter {
@@ -71,7 +75,7 @@ class PARQUET_EXPORT StreamWriter {
 
   explicit StreamWriter(std::unique_ptr<ParquetFileWriter> writer);
 
-  ~StreamWriter() = default;
+  ~StreamWriter();
 
   static void SetDefaultMaxRowGroupSize(int64_t max_size);
 
@@ -85,7 +89,7 @@ class PARQUET_EXPORT StreamWriter {
 
   // Moving is possible.
   StreamWriter(StreamWriter&&) = default;
-  StreamWriter& operator=(StreamWriter&&) = default;
+  StreamWriter& operator=(StreamWriter&&);
 
   // Copying is not allowed.
   StreamWriter(const StreamWriter&) = delete;
@@ -180,13 +184,8 @@ class PARQUET_EXPORT StreamWriter {
  protected:
   template <typename WriterType, typename T>
   StreamWriter& Write(const T v) {
-    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->EstimatedBufferedValueBytes();
-    }
+    const typename WriterType::T value = v;
+    BufferValue(&value, sizeof(value));
     return *this;
   }
 
@@ -202,7 +201,18 @@ class PARQUET_EXPORT StreamWriter {
   /// not optional.
   void SkipOptionalColumn();
 
-  void WriteNullValue(ColumnWriter* writer);
+  /// \brief Append a value of the next column to its buffer.
+  /// Variable length values also record their length.
+  void BufferValue(const void* data_ptr, std::size_t data_len,
+                   bool variable_length = false);
+
+  /// \brief Write the buffered values of all columns to the row group.
+  void FlushColumns();
+
+  /// \brief Write the buffered values of a column to the row group.
+  /// \return The estimated size of the values buffered by the column
+  /// writer.
+  int64_t FlushColumn(int i);
 
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
@@ -211,19 +221,34 @@ class PARQUET_EXPORT StreamWriter {
     void operator()(void*) {}
   };
 
+  // The values of a column which were not written yet.  Values are
+  // stored back to back in their physical representation, except
+  // BYTE_ARRAY which stores the bytes of each value along with its
+  // length.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    std::vector<uint32_t> lengths;
+  };
+
   int32_t column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_size_{0};
   int64_t max_row_group_size_{default_row_group_size_};
+  int64_t num_buffered_rows_{0};
+  int64_t buffered_bytes_{0};
 
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
   std::vector<node_ptr_type> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
+  std::vector<int16_t> rep_levels_;
 
   static constexpr int16_t kDefLevelZero = 0;
   static constexpr int16_t kDefLevelOne = 1;
   static constexpr int16_t kRepLevelZero = 0;
-  static constexpr int64_t kBatchSizeOne = 1;
+  // Number of rows buffered before the values are written.
+  static constexpr int64_t kBatchSize = 1024;
 
   static int64_t default_row_group_size_;
 };
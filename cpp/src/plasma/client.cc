@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <deque>
 #include <mutex>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -115,6 +116,21 @@ std::shared_ptr<Buffer> MakeBufferFromGpuProcessHandle(GpuProcessHandle* handle)
 
 #endif
 
+namespace {
+
+// Return the elements of values at the given indices.
+template <typename T>
+std::vector<T> Gather(const std::vector<T>& values, const std::vector<size_t>& indices) {
+  std::vector<T> out;
+  out.reserve(indices.size());
+  for (size_t index : indices) {
+    out.push_back(values[index]);
+  }
+  return out;
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // PlasmaBuffer
 
@@ -235,6 +251,12 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data,
+                     bool evict_if_full = true);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
@@ -243,14 +265,27 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Release(const ObjectID& object_id);
 
+  Status ReleaseBatch(const std::vector<ObjectID>& object_ids);
+
+  Status SetReleaseBatchSize(int64_t release_batch_size);
+
+  Status FlushReleases();
+
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  Status ContainsBatch(const std::vector<ObjectID>& object_ids,
+                       std::vector<bool>* has_object);
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status List(ObjectTable* objects);
 
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -277,13 +312,25 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity() { return store_capacity_; }
 
  private:
-  /// Check if store_fd has already been received from the store. If yes,
-  /// return it. Otherwise, receive it from the store (see analogous logic
+  /// Check if store_fd has already been received from a store shard. If yes,
+  /// return it. Otherwise, receive it from the shard (see analogous logic
   /// in store.cc).
   ///
+  /// \param shard Index of the shard that sent store_fd.
   /// \param store_fd File descriptor to fetch from the store.
   /// \return Client file descriptor corresponding to store_fd.
-  int GetStoreFd(int store_fd);
+  int GetStoreFd(size_t shard, int store_fd);
+
+  /// Return the index of the store shard that owns an object.
+  size_t ShardOf(const ObjectID& object_id) const {
+    return object_id.hash() % store_conns_.size();
+  }
+
+  /// Group the positions of objects by the store shard that owns them.
+  ///
+  /// \return For each shard, the positions in object_ids of its objects.
+  std::vector<std::vector<size_t>> GroupByShard(const ObjectID* object_ids,
+                                                int64_t num_objects) const;
 
   /// This is a helper method for marking an object as unused by this client.
   ///
@@ -291,6 +338,15 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Decrement the count of an object in use by this client, and mark it
+  /// unused when the count reaches zero.
+  ///
+  /// \param object_id The object ID we stop using.
+  /// \param[out] is_unused Whether this client no longer uses the object, in
+  ///             which case the store must be told about the release.
+  /// \return The return status.
+  Status DecrementObjectCount(const ObjectID& object_id, bool* is_unused);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -316,8 +372,11 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   arrow::Result<std::shared_ptr<CudaContext>> GetCudaContext(int device_number);
 #endif
 
-  /// File descriptor of the Unix domain socket that connects to the store.
-  int store_conn_;
+  /// File descriptors of the Unix domain sockets that connect to the shards of
+  /// the store. A store that is not sharded only has shard 0.
+  std::vector<int> store_conns_;
+  /// For each shard, the store file descriptors it has sent to this client.
+  std::vector<std::unordered_set<int>> received_store_fds_;
   /// Table of dlmalloc buffer files that have been memory mapped so far. This
   /// is a hash table mapping a file descriptor to a struct containing the
   /// address of the corresponding memory-mapped file.
@@ -333,13 +392,22 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   std::unordered_set<ObjectID> deletion_cache_;
   /// A queue of notification
   std::deque<std::tuple<ObjectID, int64_t, int64_t>> pending_notification_;
+  /// Objects released by this client that the store has not been told about
+  /// yet. They are sent in a single message once there are release_batch_size_
+  /// of them, or before any other request to the store.
+  std::vector<ObjectID> pending_releases_;
+  int64_t release_batch_size_;
   /// A mutex which protects this class.
   std::recursive_mutex client_mutex_;
 };
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {}
+PlasmaClient::Impl::Impl()
+    : store_conns_(1, 0),
+      received_store_fds_(1),
+      store_capacity_(0),
+      release_batch_size_(1) {}
 
 PlasmaClient::Impl::~Impl() {}
 
@@ -372,15 +440,28 @@ bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
   return (elem != objects_in_use_.end());
 }
 
-int PlasmaClient::Impl::GetStoreFd(int store_fd) {
+int PlasmaClient::Impl::GetStoreFd(size_t shard, int store_fd) {
   auto entry = mmap_table_.find(store_fd);
-  if (entry == mmap_table_.end()) {
-    int fd = recv_fd(store_conn_);
+  if (received_store_fds_[shard].insert(store_fd).second) {
+    int fd = recv_fd(store_conns_[shard]);
     ARROW_CHECK(fd >= 0) << "recv not successful";
-    return fd;
-  } else {
-    return entry->second->fd();
+    if (entry == mmap_table_.end()) {
+      return fd;
+    }
+    // The shards share the memory-mapped files, this one was already
+    // received from another shard.
+    close(fd);
   }
+  return entry->second->fd();
+}
+
+std::vector<std::vector<size_t>> PlasmaClient::Impl::GroupByShard(
+    const ObjectID* object_ids, int64_t num_objects) const {
+  std::vector<std::vector<size_t>> groups(store_conns_.size());
+  for (int64_t i = 0; i < num_objects; ++i) {
+    groups[ShardOf(object_ids[i])].push_back(static_cast<size_t>(i));
+  }
+  return groups;
 }
 
 void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
@@ -422,12 +503,15 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
                                   bool evict_if_full) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
+  const size_t shard = ShardOf(object_id);
+  const int conn = store_conns_[shard];
+  ARROW_LOG(DEBUG) << "called plasma_create on conn " << conn << " with size "
                    << data_size << " and metadata size " << metadata_size;
-  RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, evict_if_full, data_size,
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendCreateRequest(conn, object_id, evict_if_full, data_size,
                                   metadata_size, device_num));
   std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
+  RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaCreateReply, &buffer));
   ObjectID id;
   PlasmaObject object;
   int store_fd;
@@ -437,7 +521,7 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
   // If the CreateReply included an error, then the store will not send a file
   // descriptor.
   if (device_num == 0) {
-    int fd = GetStoreFd(store_fd);
+    int fd = GetStoreFd(shard, store_fd);
     ARROW_CHECK(object.data_size == data_size);
     ARROW_CHECK(object.metadata_size == metadata_size);
     // The metadata should come right after the data.
@@ -491,7 +575,8 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
                                          bool evict_if_full) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  ARROW_LOG(DEBUG) << "called CreateAndSeal on conn " << store_conn_;
+  const int conn = store_conns_[ShardOf(object_id)];
+  ARROW_LOG(DEBUG) << "called CreateAndSeal on conn " << conn;
   // Compute the object hash.
   static unsigned char digest[kDigestSize];
   uint64_t hash = ComputeObjectHashCPU(
@@ -499,11 +584,11 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
       reinterpret_cast<const uint8_t*>(metadata.data()), metadata.size());
   memcpy(&digest[0], &hash, sizeof(hash));
 
-  RETURN_NOT_OK(SendCreateAndSealRequest(store_conn_, object_id, evict_if_full, data,
-                                         metadata, digest));
-  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(
-      PlasmaReceive(store_conn_, MessageType::PlasmaCreateAndSealReply, &buffer));
+      SendCreateAndSealRequest(conn, object_id, evict_if_full, data, metadata, digest));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaCreateAndSealReply, &buffer));
   RETURN_NOT_OK(ReadCreateAndSealReply(buffer.data(), buffer.size()));
   return Status::OK();
 }
@@ -514,7 +599,8 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
                                               bool evict_if_full) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  ARROW_LOG(DEBUG) << "called CreateAndSealBatch on conn " << store_conn_;
+  ARROW_LOG(DEBUG) << "called CreateAndSealBatch on " << store_conns_.size()
+                   << " store shard(s)";
 
   std::vector<std::string> digests;
   for (size_t i = 0; i < object_ids.size(); i++) {
@@ -527,13 +613,134 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
     digests.push_back(digest);
   }
 
-  RETURN_NOT_OK(SendCreateAndSealBatchRequest(store_conn_, object_ids, evict_if_full,
-                                              data, metadata, digests));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(
-      PlasmaReceive(store_conn_, MessageType::PlasmaCreateAndSealBatchReply, &buffer));
-  RETURN_NOT_OK(ReadCreateAndSealBatchReply(buffer.data(), buffer.size()));
+  RETURN_NOT_OK(FlushReleases());
+  // Send the requests to all the shards before waiting for any reply.
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    RETURN_NOT_OK(SendCreateAndSealBatchRequest(
+        store_conns_[shard], Gather(object_ids, indices), evict_if_full,
+        Gather(data, indices), Gather(metadata, indices), Gather(digests, indices)));
+  }
+  Status status;
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    if (groups[shard].empty()) {
+      continue;
+    }
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(store_conns_[shard],
+                                MessageType::PlasmaCreateAndSealBatchReply, &buffer));
+    Status shard_status = ReadCreateAndSealBatchReply(buffer.data(), buffer.size());
+    if (status.ok()) {
+      status = shard_status;
+    }
+  }
+  return status;
+}
+
+Status PlasmaClient::Impl::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                       const std::vector<int64_t>& data_sizes,
+                                       const std::vector<std::string>& metadata,
+                                       std::vector<std::shared_ptr<Buffer>>* data,
+                                       bool evict_if_full) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  ARROW_LOG(DEBUG) << "called CreateBatch on " << store_conns_.size()
+                   << " store shard(s)";
+  if (data_sizes.size() != object_ids.size() || metadata.size() != object_ids.size()) {
+    return Status::Invalid("CreateBatch() needs a data size and metadata per object");
+  }
+  std::vector<int64_t> metadata_sizes;
+  metadata_sizes.reserve(metadata.size());
+  for (const auto& object_metadata : metadata) {
+    metadata_sizes.push_back(static_cast<int64_t>(object_metadata.size()));
+  }
+
+  RETURN_NOT_OK(FlushReleases());
+  // Send the requests to all the shards before waiting for any reply.
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    RETURN_NOT_OK(SendCreateBatchRequest(store_conns_[shard], Gather(object_ids, indices),
+                                         evict_if_full, Gather(data_sizes, indices),
+                                         Gather(metadata_sizes, indices)));
+  }
+  std::vector<PlasmaObject> objects(object_ids.size());
+  std::vector<size_t> created;
+  Status status;
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(
+        PlasmaReceive(store_conns_[shard], MessageType::PlasmaCreateBatchReply, &buffer));
+    std::vector<ObjectID> created_ids;
+    std::vector<PlasmaObject> shard_objects;
+    std::vector<int> store_fds;
+    std::vector<int64_t> mmap_sizes;
+    // If the CreateBatchReply included an error, then the store will not send
+    // file descriptors.
+    Status shard_status = ReadCreateBatchReply(buffer.data(), buffer.size(), &created_ids,
+                                               &shard_objects, &store_fds, &mmap_sizes);
+    if (!shard_status.ok()) {
+      if (status.ok()) {
+        status = shard_status;
+      }
+      continue;
+    }
+    ARROW_CHECK(created_ids.size() == indices.size());
+
+    // As in GetBuffers, mmap all of the file descriptors first.
+    for (size_t i = 0; i < store_fds.size(); i++) {
+      int fd = GetStoreFd(shard, store_fds[i]);
+      LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+    }
+    for (size_t i = 0; i < indices.size(); i++) {
+      DCHECK(created_ids[i] == object_ids[indices[i]]);
+      objects[indices[i]] = shard_objects[i];
+      created.push_back(indices[i]);
+    }
+  }
+  if (!status.ok()) {
+    // Each shard creates all of its objects or none of them. Abort the objects
+    // of the shards that succeeded so that the whole batch fails.
+    for (size_t i : created) {
+      const int conn = store_conns_[ShardOf(object_ids[i])];
+      RETURN_NOT_OK(SendAbortRequest(conn, object_ids[i]));
+      std::vector<uint8_t> buffer;
+      RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaAbortReply, &buffer));
+      ObjectID aborted_id;
+      RETURN_NOT_OK(ReadAbortReply(buffer.data(), buffer.size(), &aborted_id));
+    }
+    return status;
+  }
 
+  data->clear();
+  data->reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    PlasmaObject* object = &objects[i];
+    ARROW_CHECK(object->data_size == data_sizes[i]);
+    ARROW_CHECK(object->metadata_size == metadata_sizes[i]);
+    // The metadata should come right after the data.
+    ARROW_CHECK(object->metadata_offset == object->data_offset + data_sizes[i]);
+    auto object_data = std::make_shared<PlasmaMutableBuffer>(
+        shared_from_this(), LookupMmappedFile(object->store_fd) + object->data_offset,
+        data_sizes[i]);
+    memcpy(object_data->mutable_data() + object->data_size, metadata[i].data(),
+           metadata[i].size());
+    data->push_back(std::move(object_data));
+    // As in Create, the second reference is released by the call to SealBatch.
+    IncrementObjectCount(object_ids[i], object, false);
+    IncrementObjectCount(object_ids[i], object, false);
+  }
   return Status::OK();
 }
 
@@ -594,28 +801,57 @@ Status PlasmaClient::Impl::GetBuffers(
   }
 
   // If we get here, then the objects aren't all currently in use by this
-  // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
-  std::vector<ObjectID> received_object_ids(num_objects);
+  // client, so we need to send a request to the plasma store. The shards wait
+  // for their objects concurrently, send all the requests before reading any
+  // reply.
+  RETURN_NOT_OK(FlushReleases());
+  auto groups = GroupByShard(object_ids, num_objects);
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    std::vector<ObjectID> shard_object_ids;
+    shard_object_ids.reserve(indices.size());
+    for (size_t index : indices) {
+      shard_object_ids.push_back(object_ids[index]);
+    }
+    RETURN_NOT_OK(SendGetRequest(store_conns_[shard], shard_object_ids.data(),
+                                 shard_object_ids.size(), timeout_ms));
+  }
   std::vector<PlasmaObject> object_data(num_objects);
-  PlasmaObject* object;
-  std::vector<int> store_fds;
-  std::vector<int64_t> mmap_sizes;
-  RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
-                             object_data.data(), num_objects, store_fds, mmap_sizes));
-
-  // We mmap all of the file descriptors here so that we can avoid look them up
-  // in the subsequent loop based on just the store file descriptor and without
-  // having to know the relevant file descriptor received from recv_fd.
-  for (size_t i = 0; i < store_fds.size(); i++) {
-    int fd = GetStoreFd(store_fds[i]);
-    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    const int64_t num_shard_objects = static_cast<int64_t>(indices.size());
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(
+        PlasmaReceive(store_conns_[shard], MessageType::PlasmaGetReply, &buffer));
+    std::vector<ObjectID> received_object_ids(num_shard_objects);
+    std::vector<PlasmaObject> shard_object_data(num_shard_objects);
+    std::vector<int> store_fds;
+    std::vector<int64_t> mmap_sizes;
+    RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
+                               shard_object_data.data(), num_shard_objects, store_fds,
+                               mmap_sizes));
+
+    // We mmap all of the file descriptors here so that we can avoid look them up
+    // in the subsequent loop based on just the store file descriptor and without
+    // having to know the relevant file descriptor received from recv_fd.
+    for (size_t i = 0; i < store_fds.size(); i++) {
+      int fd = GetStoreFd(shard, store_fds[i]);
+      LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+    }
+    for (size_t i = 0; i < indices.size(); i++) {
+      DCHECK(received_object_ids[i] == object_ids[indices[i]]);
+      object_data[indices[i]] = shard_object_data[i];
+    }
   }
 
+  PlasmaObject* object;
   for (int64_t i = 0; i < num_objects; ++i) {
-    DCHECK(received_object_ids[i] == object_ids[i]);
     object = &object_data[i];
     if (object_buffers[i].data) {
       // If the object was already in use by the client, then the store should
@@ -661,7 +897,7 @@ Status PlasmaClient::Impl::GetBuffers(
       object_buffers[i].device_num = object->device_num;
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
-      IncrementObjectCount(received_object_ids[i], object, true);
+      IncrementObjectCount(object_ids[i], object, true);
     } else {
       // The object was not retrieved.  The caller can detect this condition
       // by checking the boolean value of the metadata/data buffers.
@@ -704,13 +940,8 @@ Status PlasmaClient::Impl::MarkObjectUnused(const ObjectID& object_id) {
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
-  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-
-  // If the client is already disconnected, ignore release requests.
-  if (store_conn_ < 0) {
-    return Status::OK();
-  }
+Status PlasmaClient::Impl::DecrementObjectCount(const ObjectID& object_id,
+                                                bool* is_unused) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
 
@@ -729,10 +960,29 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   object_entry->second->count -= 1;
   ARROW_CHECK(object_entry->second->count >= 0);
   // Check if the client is no longer using this object.
-  if (object_entry->second->count == 0) {
-    // Tell the store that the client no longer needs the object.
+  *is_unused = object_entry->second->count == 0;
+  if (*is_unused) {
     RETURN_NOT_OK(MarkObjectUnused(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // If the client is already disconnected, ignore release requests.
+  if (store_conns_[0] < 0) {
+    return Status::OK();
+  }
+  bool is_unused;
+  RETURN_NOT_OK(DecrementObjectCount(object_id, &is_unused));
+  if (is_unused) {
+    // Tell the store that the client no longer needs the object, possibly
+    // together with other releases.
+    pending_releases_.push_back(object_id);
+    if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+      RETURN_NOT_OK(FlushReleases());
+    }
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
       deletion_cache_.erase(object_id);
@@ -742,6 +992,66 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::ReleaseBatch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // If the client is already disconnected, ignore release requests.
+  if (store_conns_[0] < 0) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> ids_to_delete;
+  for (const auto& object_id : object_ids) {
+    bool is_unused;
+    RETURN_NOT_OK(DecrementObjectCount(object_id, &is_unused));
+    if (is_unused) {
+      pending_releases_.push_back(object_id);
+      if (deletion_cache_.erase(object_id) > 0) {
+        ids_to_delete.push_back(object_id);
+      }
+    }
+  }
+  RETURN_NOT_OK(FlushReleases());
+  if (!ids_to_delete.empty()) {
+    RETURN_NOT_OK(Delete(ids_to_delete));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::SetReleaseBatchSize(int64_t release_batch_size) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  if (release_batch_size < 1) {
+    return Status::Invalid("Release batch size must be at least 1, got ",
+                           release_batch_size);
+  }
+  release_batch_size_ = release_batch_size;
+  if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+    return FlushReleases();
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::FlushReleases() {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  if (pending_releases_.empty()) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> object_ids;
+  object_ids.swap(pending_releases_);
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.size() == 1) {
+      RETURN_NOT_OK(SendReleaseRequest(store_conns_[shard], object_ids[indices[0]]));
+    } else if (indices.size() > 1) {
+      RETURN_NOT_OK(
+          SendReleaseBatchRequest(store_conns_[shard], Gather(object_ids, indices)));
+    }
+  }
+  return Status::OK();
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -752,9 +1062,11 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   } else {
     // If we don't already have a reference to the object, check with the store
     // to see if we have the object.
-    RETURN_NOT_OK(SendContainsRequest(store_conn_, object_id));
+    const int conn = store_conns_[ShardOf(object_id)];
+    RETURN_NOT_OK(FlushReleases());
+    RETURN_NOT_OK(SendContainsRequest(conn, object_id));
     std::vector<uint8_t> buffer;
-    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaContainsReply, &buffer));
+    RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaContainsReply, &buffer));
     ObjectID object_id2;
     DCHECK_GT(buffer.size(), 0);
     RETURN_NOT_OK(
@@ -763,12 +1075,78 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::ContainsBatch(const std::vector<ObjectID>& object_ids,
+                                         std::vector<bool>* has_object) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Only ask the store about the objects we don't already have a reference to.
+  has_object->assign(object_ids.size(), true);
+  std::vector<ObjectID> ids_to_query;
+  std::vector<size_t> query_indices;
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    if (objects_in_use_.count(object_ids[i]) == 0) {
+      ids_to_query.push_back(object_ids[i]);
+      query_indices.push_back(i);
+    }
+  }
+  if (ids_to_query.empty()) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(FlushReleases());
+  auto groups = GroupByShard(ids_to_query.data(), ids_to_query.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    if (groups[shard].empty()) {
+      continue;
+    }
+    RETURN_NOT_OK(SendContainsBatchRequest(store_conns_[shard],
+                                           Gather(ids_to_query, groups[shard])));
+  }
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(store_conns_[shard],
+                                MessageType::PlasmaContainsBatchReply, &buffer));
+    std::vector<ObjectID> queried_ids;
+    std::vector<bool> queried_has_object;
+    RETURN_NOT_OK(ReadContainsBatchReply(buffer.data(), buffer.size(), &queried_ids,
+                                         &queried_has_object));
+    ARROW_CHECK(queried_has_object.size() == indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+      (*has_object)[query_indices[indices[i]]] = queried_has_object[i];
+    }
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  RETURN_NOT_OK(FlushReleases());
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    if (!groups[shard].empty()) {
+      RETURN_NOT_OK(
+          SendPrefetchRequest(store_conns_[shard], Gather(object_ids, groups[shard])));
+    }
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  RETURN_NOT_OK(SendListRequest(store_conn_));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaListReply, &buffer));
-  return ReadListReply(buffer.data(), buffer.size(), objects);
+  RETURN_NOT_OK(FlushReleases());
+  for (int conn : store_conns_) {
+    RETURN_NOT_OK(SendListRequest(conn));
+  }
+  // Each shard lists its own objects.
+  for (int conn : store_conns_) {
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaListReply, &buffer));
+    RETURN_NOT_OK(ReadListReply(buffer.data(), buffer.size(), objects));
+  }
+  return Status::OK();
 }
 
 static void ComputeBlockHash(const unsigned char* data, int64_t nbytes, uint64_t* hash) {
@@ -861,10 +1239,12 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   /// Send the seal request to Plasma.
   std::vector<uint8_t> digest(kDigestSize);
   RETURN_NOT_OK(Hash(object_id, &digest[0]));
+  const int conn = store_conns_[ShardOf(object_id)];
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(
-      SendSealRequest(store_conn_, object_id, std::string(digest.begin(), digest.end())));
+      SendSealRequest(conn, object_id, std::string(digest.begin(), digest.end())));
   std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSealReply, &buffer));
+  RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaSealReply, &buffer));
   ObjectID sealed_id;
   RETURN_NOT_OK(ReadSealReply(buffer.data(), buffer.size(), &sealed_id));
   ARROW_CHECK(sealed_id == object_id);
@@ -876,6 +1256,68 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::SealBatch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  // Make sure this client has an unsealed reference to every object before
+  // sending the request to Plasma.
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                             "SealBatch() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "SealBatch() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::string digest(kDigestSize, '\0');
+    RETURN_NOT_OK(Hash(object_id, reinterpret_cast<uint8_t*>(&digest[0])));
+    digests.push_back(std::move(digest));
+  }
+  RETURN_NOT_OK(FlushReleases());
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    RETURN_NOT_OK(SendSealBatchRequest(store_conns_[shard], Gather(object_ids, indices),
+                                       Gather(digests, indices)));
+  }
+  std::vector<PlasmaError> errors(object_ids.size(), PlasmaError::OK);
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    const auto& indices = groups[shard];
+    if (indices.empty()) {
+      continue;
+    }
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(
+        PlasmaReceive(store_conns_[shard], MessageType::PlasmaSealBatchReply, &buffer));
+    std::vector<ObjectID> sealed_ids;
+    std::vector<PlasmaError> shard_errors;
+    RETURN_NOT_OK(
+        ReadSealBatchReply(buffer.data(), buffer.size(), &sealed_ids, &shard_errors));
+    ARROW_CHECK(shard_errors.size() == indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+      errors[indices[i]] = shard_errors[i];
+    }
+  }
+  // Release the references taken in CreateBatch (or Create) with a single
+  // message, as Seal does for a single object.
+  RETURN_NOT_OK(ReleaseBatch(object_ids));
+  for (const auto& error : errors) {
+    RETURN_NOT_OK(PlasmaErrorStatus(error));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -903,7 +1345,9 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
 #endif
 
   // Send the abort request.
-  RETURN_NOT_OK(SendAbortRequest(store_conn_, object_id));
+  const int conn = store_conns_[ShardOf(object_id)];
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendAbortRequest(conn, object_id));
   // Decrease the reference count to zero, then remove the object.
   object_entry->second->count--;
   RETURN_NOT_OK(MarkObjectUnused(object_id));
@@ -911,7 +1355,7 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::vector<uint8_t> buffer;
   ObjectID id;
   MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
+  RETURN_NOT_OK(ReadMessage(conn, &type, &buffer));
   return ReadAbortReply(buffer.data(), buffer.size(), &id);
 }
 
@@ -928,14 +1372,28 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
     }
   }
   if (not_in_use_ids.size() > 0) {
-    RETURN_NOT_OK(SendDeleteRequest(store_conn_, not_in_use_ids));
-    std::vector<uint8_t> buffer;
-    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaDeleteReply, &buffer));
-    DCHECK_GT(buffer.size(), 0);
-    std::vector<PlasmaError> error_codes;
-    not_in_use_ids.clear();
-    RETURN_NOT_OK(
-        ReadDeleteReply(buffer.data(), buffer.size(), &not_in_use_ids, &error_codes));
+    RETURN_NOT_OK(FlushReleases());
+    auto groups = GroupByShard(not_in_use_ids.data(), not_in_use_ids.size());
+    for (size_t shard = 0; shard < groups.size(); ++shard) {
+      if (groups[shard].empty()) {
+        continue;
+      }
+      RETURN_NOT_OK(SendDeleteRequest(store_conns_[shard],
+                                      Gather(not_in_use_ids, groups[shard])));
+    }
+    for (size_t shard = 0; shard < groups.size(); ++shard) {
+      if (groups[shard].empty()) {
+        continue;
+      }
+      std::vector<uint8_t> buffer;
+      RETURN_NOT_OK(
+          PlasmaReceive(store_conns_[shard], MessageType::PlasmaDeleteReply, &buffer));
+      DCHECK_GT(buffer.size(), 0);
+      std::vector<ObjectID> deleted_ids;
+      std::vector<PlasmaError> error_codes;
+      RETURN_NOT_OK(
+          ReadDeleteReply(buffer.data(), buffer.size(), &deleted_ids, &error_codes));
+    }
   }
   return Status::OK();
 }
@@ -943,23 +1401,48 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  // Send a request to the store to evict objects.
-  RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
-  // Wait for a response with the number of bytes actually evicted.
-  std::vector<uint8_t> buffer;
-  MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
-  return ReadEvictReply(buffer.data(), buffer.size(), num_bytes_evicted);
+  // Send a request to the store to evict objects. Each shard evicts from its
+  // own objects, ask them in turn until enough memory was freed.
+  RETURN_NOT_OK(FlushReleases());
+  num_bytes_evicted = 0;
+  for (size_t shard = 0; shard < store_conns_.size(); ++shard) {
+    if (shard > 0 && num_bytes_evicted >= num_bytes) {
+      break;
+    }
+    RETURN_NOT_OK(SendEvictRequest(store_conns_[shard], num_bytes - num_bytes_evicted));
+    // Wait for a response with the number of bytes actually evicted.
+    std::vector<uint8_t> buffer;
+    MessageType type;
+    RETURN_NOT_OK(ReadMessage(store_conns_[shard], &type, &buffer));
+    int64_t shard_bytes_evicted;
+    RETURN_NOT_OK(ReadEvictReply(buffer.data(), buffer.size(), shard_bytes_evicted));
+    num_bytes_evicted += shard_bytes_evicted;
+  }
+  return Status::OK();
 }
 
 Status PlasmaClient::Impl::Refresh(const std::vector<ObjectID>& object_ids) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  RETURN_NOT_OK(SendRefreshLRURequest(store_conn_, object_ids));
-  std::vector<uint8_t> buffer;
-  MessageType type;
-  RETURN_NOT_OK(ReadMessage(store_conn_, &type, &buffer));
-  return ReadRefreshLRUReply(buffer.data(), buffer.size());
+  RETURN_NOT_OK(FlushReleases());
+  auto groups = GroupByShard(object_ids.data(), object_ids.size());
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    if (groups[shard].empty()) {
+      continue;
+    }
+    RETURN_NOT_OK(
+        SendRefreshLRURequest(store_conns_[shard], Gather(object_ids, groups[shard])));
+  }
+  for (size_t shard = 0; shard < groups.size(); ++shard) {
+    if (groups[shard].empty()) {
+      continue;
+    }
+    std::vector<uint8_t> buffer;
+    MessageType type;
+    RETURN_NOT_OK(ReadMessage(store_conns_[shard], &type, &buffer));
+    RETURN_NOT_OK(ReadRefreshLRUReply(buffer.data(), buffer.size()));
+  }
+  return Status::OK();
 }
 
 Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
@@ -989,11 +1472,13 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   // Make the socket non-blocking.
   int flags = fcntl(sock[1], F_GETFL, 0);
   ARROW_CHECK(fcntl(sock[1], F_SETFL, flags | O_NONBLOCK) == 0);
-  // Tell the Plasma store about the subscription.
-  RETURN_NOT_OK(SendSubscribeRequest(store_conn_));
-  // Send the file descriptor that the Plasma store should use to push
-  // notifications about sealed objects to this client.
-  ARROW_CHECK(send_fd(store_conn_, sock[1]) >= 0);
+  // Tell every shard of the Plasma store about the subscription, and send the
+  // file descriptor that it should use to push notifications about sealed
+  // objects to this client.
+  for (int conn : store_conns_) {
+    RETURN_NOT_OK(SendSubscribeRequest(conn));
+    ARROW_CHECK(send_fd(conn, sock[1]) >= 0);
+  }
   close(sock[1]);
   // Return the file descriptor that the client should use to read notifications
   // about sealed objects.
@@ -1059,7 +1544,8 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
                                    int release_delay, int num_retries) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
-  RETURN_NOT_OK(ConnectIpcSocketRetry(store_socket_name, num_retries, -1, &store_conn_));
+  RETURN_NOT_OK(
+      ConnectIpcSocketRetry(store_socket_name, num_retries, -1, &store_conns_[0]));
   if (manager_socket_name != "") {
     return Status::NotImplemented("plasma manager is no longer supported");
   }
@@ -1067,21 +1553,46 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
     ARROW_LOG(WARNING) << "The release_delay parameter in PlasmaClient::Connect "
                        << "is deprecated";
   }
-  // Send a ConnectRequest to the store to get its memory capacity.
-  RETURN_NOT_OK(SendConnectRequest(store_conn_));
+  // Send a ConnectRequest to the store to get its memory capacity and number
+  // of shards.
+  RETURN_NOT_OK(SendConnectRequest(store_conns_[0]));
   std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaConnectReply, &buffer));
-  RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_));
+  RETURN_NOT_OK(PlasmaReceive(store_conns_[0], MessageType::PlasmaConnectReply, &buffer));
+  int num_shards;
+  RETURN_NOT_OK(
+      ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_, &num_shards));
+  // Shard i > 0 listens on the store socket name followed by ".i".
+  store_conns_.resize(1);
+  for (int i = 1; i < num_shards; ++i) {
+    int conn;
+    RETURN_NOT_OK(ConnectIpcSocketRetry(store_socket_name + "." + std::to_string(i),
+                                        num_retries, -1, &conn));
+    store_conns_.push_back(conn);
+  }
+  received_store_fds_.assign(num_shards, std::unordered_set<int>());
   return Status::OK();
 }
 
 Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
                                             int64_t output_memory_quota) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  RETURN_NOT_OK(SendSetOptionsRequest(store_conn_, client_name, output_memory_quota));
-  std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSetOptionsReply, &buffer));
-  return ReadSetOptionsReply(buffer.data(), buffer.size());
+  // The objects of this client are spread over the shards, each one enforces
+  // its share of the quota.
+  const int64_t shard_memory_quota =
+      output_memory_quota / static_cast<int64_t>(store_conns_.size());
+  for (int conn : store_conns_) {
+    RETURN_NOT_OK(SendSetOptionsRequest(conn, client_name, shard_memory_quota));
+  }
+  Status status;
+  for (int conn : store_conns_) {
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(conn, MessageType::PlasmaSetOptionsReply, &buffer));
+    Status shard_status = ReadSetOptionsReply(buffer.data(), buffer.size());
+    if (status.ok()) {
+      status = shard_status;
+    }
+  }
+  return status;
 }
 
 Status PlasmaClient::Impl::Disconnect() {
@@ -1093,23 +1604,35 @@ Status PlasmaClient::Impl::Disconnect() {
 
   // Close the connections to Plasma. The Plasma store will release the objects
   // that were in use by us when handling the SIGPIPE.
-  close(store_conn_);
-  store_conn_ = -1;
+  pending_releases_.clear();
+  for (auto& conn : store_conns_) {
+    close(conn);
+    conn = -1;
+  }
   return Status::OK();
 }
 
 std::string PlasmaClient::Impl::DebugString() {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  if (!SendGetDebugStringRequest(store_conn_).ok()) {
-    return "error sending request";
-  }
-  std::vector<uint8_t> buffer;
-  if (!PlasmaReceive(store_conn_, MessageType::PlasmaGetDebugStringReply, &buffer).ok()) {
-    return "error receiving reply";
-  }
   std::string debug_string;
-  if (!ReadGetDebugStringReply(buffer.data(), buffer.size(), &debug_string).ok()) {
-    return "error parsing reply";
+  for (size_t shard = 0; shard < store_conns_.size(); ++shard) {
+    const int conn = store_conns_[shard];
+    if (!SendGetDebugStringRequest(conn).ok()) {
+      return "error sending request";
+    }
+    std::vector<uint8_t> buffer;
+    if (!PlasmaReceive(conn, MessageType::PlasmaGetDebugStringReply, &buffer).ok()) {
+      return "error receiving reply";
+    }
+    std::string shard_debug_string;
+    if (!ReadGetDebugStringReply(buffer.data(), buffer.size(), &shard_debug_string)
+             .ok()) {
+      return "error parsing reply";
+    }
+    if (store_conns_.size() > 1) {
+      debug_string += "\n(shard " + std::to_string(shard) + ")";
+    }
+    debug_string += shard_debug_string;
   }
   return debug_string;
 }
@@ -1153,6 +1676,14 @@ Status PlasmaClient::CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
   return impl_->CreateAndSealBatch(object_ids, data, metadata, evict_if_full);
 }
 
+Status PlasmaClient::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                 const std::vector<int64_t>& data_sizes,
+                                 const std::vector<std::string>& metadata,
+                                 std::vector<std::shared_ptr<Buffer>>* data,
+                                 bool evict_if_full) {
+  return impl_->CreateBatch(object_ids, data_sizes, metadata, data, evict_if_full);
+}
+
 Status PlasmaClient::Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
                          std::vector<ObjectBuffer>* object_buffers) {
   return impl_->Get(object_ids, timeout_ms, object_buffers);
@@ -1167,16 +1698,39 @@ Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
 
+Status PlasmaClient::ReleaseBatch(const std::vector<ObjectID>& object_ids) {
+  return impl_->ReleaseBatch(object_ids);
+}
+
+Status PlasmaClient::SetReleaseBatchSize(int64_t release_batch_size) {
+  return impl_->SetReleaseBatchSize(release_batch_size);
+}
+
+Status PlasmaClient::FlushReleases() { return impl_->FlushReleases(); }
+
 Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
 
+Status PlasmaClient::ContainsBatch(const std::vector<ObjectID>& object_ids,
+                                   std::vector<bool>* has_object) {
+  return impl_->ContainsBatch(object_ids, has_object);
+}
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::SealBatch(const std::vector<ObjectID>& object_ids) {
+  return impl_->SealBatch(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
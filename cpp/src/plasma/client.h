@@ -50,6 +50,9 @@ class ARROW_EXPORT PlasmaClient {
 
   /// Connect to the local plasma store. Return the resulting connection.
   ///
+  /// If the store is sharded (plasma-store-server -n), this connects to every
+  /// shard, and the requests about an object go to the shard owning its ID.
+  ///
   /// \param store_socket_name The name of the UNIX domain socket to use to
   ///        connect to the Plasma store.
   /// \param manager_socket_name The name of the UNIX domain socket to use to
@@ -68,7 +71,8 @@ class ARROW_EXPORT PlasmaClient {
   ///
   /// \param client_name The name of the client, used in debug messages.
   /// \param output_memory_quota The memory quota in bytes for objects created by
-  ///        this client.
+  ///        this client. With a sharded store, each shard enforces an equal share
+  ///        of it.
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
   /// Create an object in the Plasma Store. Any metadata for this object must be
@@ -126,6 +130,26 @@ class ARROW_EXPORT PlasmaClient {
                             const std::vector<std::string>& metadata,
                             bool evict_if_full = true);
 
+  /// Create multiple objects in the object store with a single request. This is
+  /// an optimization of Create to eliminate the cost of IPC per object. The
+  /// objects are created on the host, either all of them or none.
+  ///
+  /// \param object_ids The vector of IDs of the objects to create.
+  /// \param data_sizes The size in bytes of the data of each object.
+  /// \param metadata The vector of metadata for the objects to create.
+  /// \param[out] data The buffers of the newly created objects.
+  /// \param evict_if_full Whether to evict other objects to make space for
+  ///        these objects.
+  /// \return The return status.
+  ///
+  /// As with Create, each returned object must be released once it is done
+  /// with, and either sealed (see SealBatch) or aborted.
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data,
+                     bool evict_if_full = true);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -166,6 +190,26 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Release multiple objects with a single message to the store.
+  ///
+  /// \param object_ids The IDs of the objects that are no longer needed.
+  /// \return The return status.
+  Status ReleaseBatch(const std::vector<ObjectID>& object_ids);
+
+  /// Set the number of releases the client accumulates before telling the
+  /// store about them in a single message. The default of 1 sends each release
+  /// immediately. Pending releases are also sent before any other request to the
+  /// store, so that the store never sees requests out of order.
+  ///
+  /// \param release_batch_size The number of releases to accumulate, at least 1.
+  /// \return The return status.
+  Status SetReleaseBatchSize(int64_t release_batch_size);
+
+  /// Send the pending releases to the store.
+  ///
+  /// \return The return status.
+  Status FlushReleases();
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -178,6 +222,25 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  /// Check if the object store contains multiple objects with a single request.
+  ///
+  /// \param object_ids The IDs of the objects whose presence we are checking.
+  /// \param[out] has_object Whether each object is present in the store.
+  /// \return The return status.
+  Status ContainsBatch(const std::vector<ObjectID>& object_ids,
+                       std::vector<bool>* has_object);
+
+  /// Ask the store to start restoring objects it evicted to its external store,
+  /// so that a later Get does not wait for them to be read back. This does not
+  /// wait for the objects to be restored. Objects that are in memory or not in
+  /// the store are ignored.
+  ///
+  /// This API is experimental and might change in the future.
+  ///
+  /// \param object_ids The IDs of the objects to restore.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// List all the objects in the object store.
   ///
   /// This API is experimental and might change in the future.
@@ -210,6 +273,12 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal multiple objects with a single request to the store.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -255,7 +324,8 @@ class ARROW_EXPORT PlasmaClient {
 
   /// Subscribe to notifications when objects are sealed in the object store.
   /// Whenever an object is sealed, a message will be written to the client
-  /// socket that is returned by this method.
+  /// socket that is returned by this method. With a sharded store, the
+  /// notifications of different shards are not ordered with respect to each other.
   ///
   /// \param fd Out parameter for the file descriptor the client should use to
   /// read notifications
@@ -299,6 +369,7 @@ class ARROW_EXPORT PlasmaClient {
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStore, CreateSealBatchTest);
 
   bool IsInUse(const ObjectID& object_id);
 
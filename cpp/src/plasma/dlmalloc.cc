@@ -25,6 +25,11 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -67,6 +72,8 @@ static void* pointer_advance(void* p, ptrdiff_t n) { return (unsigned char*)p +
 
 static void* pointer_retreat(void* p, ptrdiff_t n) { return (unsigned char*)p - n; }
 
+static MmapOptions mmap_options;
+
 // Create a buffer. This is creating a temporary file and then
 // immediately unlinking it so we do not leave traces in the system.
 int create_buffer(int64_t size) {
@@ -105,6 +112,45 @@ int create_buffer(int64_t size) {
   return fd;
 }
 
+// Apply the MmapOptions to a new mapping. The NUMA policy and the huge page advice
+// only affect pages that are not faulted in yet, so they come before the prefault.
+static void PrepareMapping(void* pointer, size_t size) {
+#ifdef __linux__
+  if (!mmap_options.numa_nodes.empty()) {
+    constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+    std::vector<unsigned long> node_mask;                     // NOLINT
+    for (int node : mmap_options.numa_nodes) {
+      size_t word = node / kBitsPerWord;
+      if (node_mask.size() <= word) {
+        node_mask.resize(word + 1, 0);
+      }
+      node_mask[word] |= 1UL << (node % kBitsPerWord);
+    }
+    // There is no glibc wrapper for mbind, and it would be the only use of libnuma.
+    if (syscall(SYS_mbind, pointer, size, MPOL_BIND, node_mask.data(),
+                node_mask.size() * kBitsPerWord + 1, 0) != 0) {
+      ARROW_LOG(WARNING) << "mbind failed with error: " << std::strerror(errno);
+    }
+  }
+#ifdef MADV_HUGEPAGE
+  if (mmap_options.transparent_hugepages && !plasma_config->hugepages_enabled &&
+      madvise(pointer, size, MADV_HUGEPAGE) != 0) {
+    ARROW_LOG(WARNING) << "madvise(MADV_HUGEPAGE) failed with error: "
+                       << std::strerror(errno);
+  }
+#endif
+#endif
+  if (mmap_options.prefault) {
+    // The file is zero-filled, writing zeros faults the pages in without
+    // changing its contents.
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile uint8_t* data = static_cast<uint8_t*>(pointer);
+    for (size_t offset = 0; offset < size; offset += page_size) {
+      data[offset] = 0;
+    }
+  }
+}
+
 void* fake_mmap(size_t size) {
   // Add kMmapRegionsGap so that the returned pointer is deliberately not
   // page-aligned. This ensures that the segments of memory returned by
@@ -115,7 +161,8 @@ void* fake_mmap(size_t size) {
   ARROW_CHECK(fd >= 0) << "Failed to create buffer during mmap";
   // MAP_POPULATE can be used to pre-populate the page tables for this memory region
   // which avoids work when accessing the pages later. However it causes long pauses
-  // when mmapping the files. Only supported on Linux.
+  // when mmapping the files, and it would fault the pages in before the NUMA policy
+  // is set. MmapOptions::prefault does it on request in PrepareMapping instead.
   void* pointer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
   if (pointer == MAP_FAILED) {
     ARROW_LOG(ERROR) << "mmap failed with error: " << std::strerror(errno);
@@ -125,13 +172,17 @@ void* fake_mmap(size_t size) {
     }
     return pointer;
   }
+  PrepareMapping(pointer, size);
 
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
 
-  MmapRecord& record = mmap_records[pointer];
-  record.fd = fd;
-  record.size = size;
+  {
+    std::lock_guard<std::mutex> lock(mmap_records_mutex);
+    MmapRecord& record = mmap_records[pointer];
+    record.fd = fd;
+    record.size = size;
+  }
 
   // We lie to dlmalloc about where mapped memory actually lives.
   pointer = pointer_advance(pointer, kMmapRegionsGap);
@@ -144,6 +195,7 @@ int fake_munmap(void* addr, int64_t size) {
   addr = pointer_retreat(addr, kMmapRegionsGap);
   size += kMmapRegionsGap;
 
+  std::lock_guard<std::mutex> lock(mmap_records_mutex);
   auto entry = mmap_records.find(addr);
 
   if (entry == mmap_records.end() || entry->second.size != size) {
@@ -163,4 +215,13 @@ int fake_munmap(void* addr, int64_t size) {
 
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
 
+void SetMmapOptions(const MmapOptions& options) {
+  mmap_options = options;
+  if (options.prefault) {
+    // Never trim, otherwise freeing the preallocation done at startup unmaps the
+    // prefaulted arena and the next mmap starts over with cold pages.
+    change_mparam(M_TRIM_THRESHOLD, -1);
+  }
+}
+
 }  // namespace plasma
@@ -54,6 +54,9 @@ class ExternalStore {
   /// This method will be called whenever an object in the Plasma store needs
   /// to be evicted to the external store.
   ///
+  /// Put and Get are called on background threads of the Plasma store, and may
+  /// be called concurrently. The data buffers stay valid until Put returns.
+  ///
   /// This API is experimental and might change in the future.
   ///
   /// \param ids The IDs of the objects to put.
@@ -28,6 +28,7 @@ Status HashTableStore::Connect(const std::string& endpoint) { return Status::OK(
 
 Status HashTableStore::Put(const std::vector<ObjectID>& ids,
                            const std::vector<std::shared_ptr<Buffer>>& data) {
+  std::lock_guard<std::mutex> lock(mutex_);
   for (size_t i = 0; i < ids.size(); ++i) {
     table_[ids[i]] = data[i]->ToString();
   }
@@ -37,14 +38,10 @@ Status HashTableStore::Put(const std::vector<ObjectID>& ids,
 Status HashTableStore::Get(const std::vector<ObjectID>& ids,
                            std::vector<std::shared_ptr<Buffer>> buffers) {
   ARROW_CHECK(ids.size() == buffers.size());
+  std::lock_guard<std::mutex> lock(mutex_);
   for (size_t i = 0; i < ids.size(); ++i) {
-    bool valid;
-    HashTable::iterator result;
-    {
-      result = table_.find(ids[i]);
-      valid = result != table_.end();
-    }
-    if (valid) {
+    auto result = table_.find(ids[i]);
+    if (result != table_.end()) {
       ARROW_CHECK(buffers[i]->size() == static_cast<int64_t>(result->second.size()));
       std::memcpy(buffers[i]->mutable_data(), result->second.data(),
                   result->second.size());
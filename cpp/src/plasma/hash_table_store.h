@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -44,6 +45,8 @@ class HashTableStore : public ExternalStore {
  private:
   typedef std::unordered_map<ObjectID, std::string> HashTable;
 
+  // Put and Get are called concurrently by the threads of the store.
+  std::mutex mutex_;
   HashTable table_;
 };
 
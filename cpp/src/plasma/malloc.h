@@ -20,7 +20,9 @@
 #include <inttypes.h>
 #include <stddef.h>
 
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace plasma {
 
@@ -38,6 +40,23 @@ void GetMallocMapinfo(void* addr, int* fd, int64_t* map_length, ptrdiff_t* offse
 /// \return The size of the corresponding memory-mapped file.
 int64_t GetMmapSize(int fd);
 
+/// Options for the memory-mapped files backing the store.
+struct MmapOptions {
+  /// Touch every page of a new mapping, so that the store does not take page
+  /// faults when objects are first written. This also keeps the arena mapped
+  /// once it is allocated.
+  bool prefault = false;
+  /// Advise the kernel to back new mappings with transparent huge pages. Has no
+  /// effect when the files live on a huge page file system.
+  bool transparent_hugepages = false;
+  /// NUMA nodes to bind new mappings to, the default policy is used if empty.
+  std::vector<int> numa_nodes;
+};
+
+/// Set the options applied by the following mmaps. This must be called before
+/// the first allocation.
+void SetMmapOptions(const MmapOptions& options);
+
 struct MmapRecord {
   int fd;
   int64_t size;
@@ -48,4 +67,7 @@ struct MmapRecord {
 /// and size.
 extern std::unordered_map<void*, MmapRecord> mmap_records;
 
+/// Protects mmap_records, which is shared by the shards of a multi-threaded store.
+extern std::mutex mmap_records_mutex;
+
 }  // namespace plasma
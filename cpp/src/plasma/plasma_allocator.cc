@@ -27,10 +27,13 @@ void* dlmemalign(size_t alignment, size_t bytes);
 void dlfree(void* mem);
 }
 
+std::mutex PlasmaAllocator::mutex_;
 int64_t PlasmaAllocator::footprint_limit_ = 0;
-int64_t PlasmaAllocator::allocated_ = 0;
+std::atomic<int64_t> PlasmaAllocator::allocated_(0);
 
 void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+  // dlmalloc is built without its own locks.
+  std::lock_guard<std::mutex> lock(mutex_);
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
@@ -41,6 +44,7 @@ void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
   dlfree(mem);
   allocated_ -= bytes;
 }
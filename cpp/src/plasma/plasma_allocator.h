@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 
 namespace plasma {
 
+/// The allocator is shared by all the shards of the store, Memalign and Free
+/// may be called concurrently.
 class PlasmaAllocator {
  public:
   /// Allocates size bytes and returns a pointer to the allocated memory. The
@@ -54,7 +58,8 @@ class PlasmaAllocator {
   static int64_t Allocated();
 
  private:
-  static int64_t allocated_;
+  static std::mutex mutex_;
+  static std::atomic<int64_t> allocated_;
   static int64_t footprint_limit_;
 };
 
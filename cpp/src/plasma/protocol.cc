@@ -606,17 +606,19 @@ Status SendConnectRequest(int sock) {
 
 Status ReadConnectRequest(const uint8_t* data) { return Status::OK(); }
 
-Status SendConnectReply(int sock, int64_t memory_capacity) {
+Status SendConnectReply(int sock, int64_t memory_capacity, int num_shards) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaConnectReply(fbb, memory_capacity);
+  auto message = fb::CreatePlasmaConnectReply(fbb, memory_capacity, num_shards);
   return PlasmaSend(sock, MessageType::PlasmaConnectReply, &fbb, message);
 }
 
-Status ReadConnectReply(const uint8_t* data, size_t size, int64_t* memory_capacity) {
+Status ReadConnectReply(const uint8_t* data, size_t size, int64_t* memory_capacity,
+                        int* num_shards) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaConnectReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   *memory_capacity = message->memory_capacity();
+  *num_shards = message->num_shards();
   return Status::OK();
 }
 
@@ -826,4 +828,243 @@ Status ReadRefreshLRUReply(const uint8_t* data, size_t size) {
   return Status::OK();
 }
 
+// Batch messages.
+
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              bool evict_if_full, const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes) {
+  DCHECK(object_ids.size() == data_sizes.size());
+  DCHECK(object_ids.size() == metadata_sizes.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaCreateBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()), evict_if_full,
+      fbb.CreateVector(
+          arrow::util::MakeNonNull(reinterpret_cast<const uint64_t*>(data_sizes.data())),
+          data_sizes.size()),
+      fbb.CreateVector(arrow::util::MakeNonNull(
+                           reinterpret_cast<const uint64_t*>(metadata_sizes.data())),
+                       metadata_sizes.size()));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchRequest, &fbb, message);
+}
+
+Status ReadCreateBatchRequest(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids, bool* evict_if_full,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+
+  *evict_if_full = message->evict_if_full();
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  data_sizes->assign(message->data_sizes()->begin(), message->data_sizes()->end());
+  metadata_sizes->assign(message->metadata_sizes()->begin(),
+                         message->metadata_sizes()->end());
+  ARROW_CHECK(object_ids->size() == data_sizes->size());
+  ARROW_CHECK(object_ids->size() == metadata_sizes->size());
+  return Status::OK();
+}
+
+Status SendCreateBatchReply(int sock, PlasmaError error,
+                            const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes) {
+  DCHECK(object_ids.size() == objects.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> specs;
+  specs.reserve(objects.size());
+  for (const auto& object : objects) {
+    specs.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                     object.data_size, object.metadata_offset,
+                                     object.metadata_size, object.device_num));
+  }
+  auto message = fb::CreatePlasmaCreateBatchReply(
+      fbb, error, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStructs(arrow::util::MakeNonNull(specs.data()), specs.size()),
+      fbb.CreateVector(arrow::util::MakeNonNull(store_fds.data()), store_fds.size()),
+      fbb.CreateVector(arrow::util::MakeNonNull(mmap_sizes.data()), mmap_sizes.size()));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchReply, &fbb, message);
+}
+
+Status ReadCreateBatchReply(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  RETURN_NOT_OK(PlasmaErrorStatus(message->error()));
+
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->plasma_objects(), objects, [](const PlasmaObjectSpec& spec) {
+    PlasmaObject object = {};
+    object.store_fd = spec.segment_index();
+    object.data_offset = spec.data_offset();
+    object.data_size = spec.data_size();
+    object.metadata_offset = spec.metadata_offset();
+    object.metadata_size = spec.metadata_size();
+    object.device_num = spec.device_num();
+    return object;
+  });
+  ARROW_CHECK(message->store_fds()->size() == message->mmap_sizes()->size());
+  store_fds->assign(message->store_fds()->begin(), message->store_fds()->end());
+  mmap_sizes->assign(message->mmap_sizes()->begin(), message->mmap_sizes()->end());
+  return Status::OK();
+}
+
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests) {
+  DCHECK(object_ids.size() == digests.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      ToFlatbuffer(&fbb, digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->digests(), digests, [](const flatbuffers::String& element) {
+    ARROW_CHECK_EQ(element.size(), kDigestSize);
+    return element.str();
+  });
+  ARROW_CHECK(object_ids->size() == digests->size());
+  return Status::OK();
+}
+
+Status SendSealBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                          const std::vector<PlasmaError>& errors) {
+  DCHECK(object_ids.size() == errors.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(
+          arrow::util::MakeNonNull(reinterpret_cast<const int32_t*>(errors.data())),
+          errors.size()));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchReply, &fbb, message);
+}
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size,
+                          std::vector<ObjectID>* object_ids,
+                          std::vector<PlasmaError>* errors) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  errors->clear();
+  errors->reserve(message->errors()->size());
+  for (uoffset_t i = 0; i < message->errors()->size(); ++i) {
+    errors->push_back(static_cast<PlasmaError>(message->errors()->Get(i)));
+  }
+  return Status::OK();
+}
+
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaReleaseBatchRequest, &fbb, message);
+}
+
+Status ReadReleaseBatchRequest(const uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
+Status SendContainsBatchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaContainsBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaContainsBatchRequest, &fbb, message);
+}
+
+Status ReadContainsBatchRequest(const uint8_t* data, size_t size,
+                                std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaContainsBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
+Status SendContainsBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<bool>& has_object) {
+  DCHECK(object_ids.size() == has_object.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<int32_t> has_object_ints(has_object.begin(), has_object.end());
+  auto message = fb::CreatePlasmaContainsBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(arrow::util::MakeNonNull(has_object_ints.data()),
+                       has_object_ints.size()));
+  return PlasmaSend(sock, MessageType::PlasmaContainsBatchReply, &fbb, message);
+}
+
+Status ReadContainsBatchReply(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<bool>* has_object) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaContainsBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  has_object->clear();
+  has_object->reserve(message->has_object()->size());
+  for (uoffset_t i = 0; i < message->has_object()->size(); ++i) {
+    has_object->push_back(message->has_object()->Get(i) != 0);
+  }
+  return Status::OK();
+}
+
+// Prefetch messages.
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPrefetchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPrefetchRequest, &fbb, message);
+}
+
+Status ReadPrefetchRequest(const uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPrefetchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
 }  // namespace plasma
@@ -54,6 +54,8 @@ flatbuffers::Offset<flatbuffers::Vector<int64_t>> ToFlatbuffer(
 
 Status PlasmaReceive(int sock, MessageType message_type, std::vector<uint8_t>* buffer);
 
+Status PlasmaErrorStatus(PlasmaError plasma_error);
+
 /* Set options messages. */
 
 Status SendSetOptionsRequest(int sock, const std::string& client_name,
@@ -206,9 +208,10 @@ Status SendConnectRequest(int sock);
 
 Status ReadConnectRequest(const uint8_t* data, size_t size);
 
-Status SendConnectReply(int sock, int64_t memory_capacity);
+Status SendConnectReply(int sock, int64_t memory_capacity, int num_shards);
 
-Status ReadConnectReply(const uint8_t* data, size_t size, int64_t* memory_capacity);
+Status ReadConnectReply(const uint8_t* data, size_t size, int64_t* memory_capacity,
+                        int* num_shards);
 
 /* Plasma Evict message functions (no reply so far). */
 
@@ -248,4 +251,65 @@ Status SendRefreshLRUReply(int sock);
 
 Status ReadRefreshLRUReply(const uint8_t* data, size_t size);
 
+/* Plasma batch message functions. */
+
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              bool evict_if_full, const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes);
+
+Status ReadCreateBatchRequest(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids, bool* evict_if_full,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes);
+
+Status SendCreateBatchReply(int sock, PlasmaError error,
+                            const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateBatchReply(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes);
+
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests);
+
+Status SendSealBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                          const std::vector<PlasmaError>& errors);
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size,
+                          std::vector<ObjectID>* object_ids,
+                          std::vector<PlasmaError>* errors);
+
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadReleaseBatchRequest(const uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids);
+
+Status SendContainsBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadContainsBatchRequest(const uint8_t* data, size_t size,
+                                std::vector<ObjectID>* object_ids);
+
+Status SendContainsBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<bool>& has_object);
+
+Status ReadContainsBatchReply(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<bool>* has_object);
+
+/* Plasma Prefetch message functions. */
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(const uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids);
+
 }  // namespace plasma
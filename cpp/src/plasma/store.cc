@@ -25,6 +25,11 @@
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
+//
+// With -n, the object table is split in several shards, each served by its
+// own thread and listening on its own socket. Clients connect to every shard
+// and send the requests for an object to the shard owning its ID. The shards
+// only share the memory allocator.
 
 #include "plasma/store.h"
 
@@ -47,8 +52,10 @@
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -58,6 +65,7 @@
 
 #include "arrow/status.h"
 #include "arrow/util/config.h"
+#include "arrow/util/thread_pool.h"
 
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
@@ -84,6 +92,10 @@ namespace plasma {
 
 void SetMallocGranularity(int value);
 
+// Number of threads of each store shard writing objects to and reading them from
+// the external store.
+constexpr int kExternalStoreThreads = 4;
+
 struct GetRequest {
   GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
   /// The client that called get.
@@ -117,16 +129,36 @@ Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
+                         std::shared_ptr<ExternalStore> external_store, int num_shards)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
-      external_store_(external_store) {
+      num_shards_(num_shards),
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit() / num_shards),
+      external_store_(external_store),
+      transfer_pipe_{-1, -1} {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  if (external_store_) {
+    external_store_pool_ = *arrow::internal::ThreadPool::Make(kExternalStoreThreads);
+    ARROW_CHECK(pipe(transfer_pipe_) == 0);
+    // The event loop only needs one byte to wake up, never block the writers.
+    ARROW_CHECK(fcntl(transfer_pipe_[1], F_SETFL, O_NONBLOCK) == 0);
+    loop_->AddFileEvent(transfer_pipe_[0], kEventLoopRead, [this](int events) {
+      char buffer[64];
+      ssize_t nbytes = read(transfer_pipe_[0], buffer, sizeof(buffer));
+      ARROW_UNUSED(nbytes);
+      ProcessFinishedTransfers();
+    });
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  if (external_store_pool_) {
+    ARROW_CHECK_OK(external_store_pool_->Shutdown());
+    close(transfer_pipe_[0]);
+    close(transfer_pipe_[1]);
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
@@ -183,6 +215,12 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
       // make more space, return an error to the client.
       break;
     }
+    // Objects being written to the external store are freed once the write is
+    // done, wait for them before evicting more.
+    if (!evicting_objects_.empty()) {
+      WaitForFinishedEvictions();
+      continue;
+    }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
     bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
@@ -501,8 +539,9 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     std::vector<std::shared_ptr<Buffer>> buffers;
     for (size_t i = 0; i < evicted_ids.size(); ++i) {
       ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
+      buffers.emplace_back(new arrow::MutableBuffer(
+          evicted_entries[i]->pointer,
+          evicted_entries[i]->data_size + evicted_entries[i]->metadata_size));
     }
     if (external_store_->Get(evicted_ids, buffers).ok()) {
       for (size_t i = 0; i < evicted_ids.size(); ++i) {
@@ -590,7 +629,8 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   return entry && (entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED)
+                   entry->state == ObjectState::PLASMA_EVICTED ||
+                   restoring_objects_.count(object_id) > 0)
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
@@ -661,8 +701,9 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotSealed;
   }
 
-  if (entry->ref_count != 0) {
-    // To delete an object, there must be no clients currently using it.
+  if (entry->ref_count != 0 || evicting_objects_.count(object_id) > 0) {
+    // To delete an object, there must be no clients currently using it, and it
+    // must not be being written to the external store.
     // Put it into deletion cache, it will be deleted later.
     deletion_cache_.emplace(object_id);
     return PlasmaError::ObjectInUse;
@@ -684,8 +725,6 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     return;
   }
 
-  std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -698,13 +737,20 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     ARROW_CHECK(entry->ref_count == 0)
         << "To evict an object, there must be no clients currently using it.";
 
-    // If there is a backing external store, then mark object for eviction to
-    // external store, free the object data pointer and keep a placeholder
-    // entry in ObjectTable
+    // If there is a backing external store, then write the object to it in the
+    // background. The object data pointer is freed and a placeholder entry is
+    // kept in the ObjectTable once the write is done, see FinishEviction.
     if (external_store_) {
-      evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
-      evicted_entries.push_back(entry);
+      if (!evicting_objects_.insert(object_id).second) {
+        // The object was accessed and released again while being written.
+        continue;
+      }
+      std::vector<std::shared_ptr<Buffer>> data = {std::make_shared<arrow::Buffer>(
+          entry->pointer, entry->data_size + entry->metadata_size)};
+      ARROW_CHECK_OK(external_store_pool_->Spawn([this, object_id, data]() {
+        PushFinishedTransfer({object_id, external_store_->Put({object_id}, data)},
+                             &finished_evictions_);
+      }));
     } else {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
@@ -716,15 +762,131 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
       PushNotification(&notification);
     }
   }
+}
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
-      entry->pointer = nullptr;
-      entry->state = ObjectState::PLASMA_EVICTED;
+void PlasmaStore::PrefetchObjects(const std::vector<ObjectID>& object_ids) {
+  if (!external_store_) {
+    return;
+  }
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_EVICTED) {
+      continue;
+    }
+    ARROW_CHECK(!entry->pointer);
+    entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size,
+                                    /*evict=*/true, &entry->fd, &entry->map_size,
+                                    &entry->offset, /*client=*/nullptr, false);
+    if (!entry->pointer) {
+      ARROW_LOG(WARNING) << "Not enough memory to prefetch the object "
+                         << object_id.hex();
+      return;
     }
+    // The object is not sealed before it is restored, get requests wait for it.
+    entry->state = ObjectState::PLASMA_CREATED;
+    entry->create_time = std::time(nullptr);
+    restoring_objects_.insert(object_id);
+    std::vector<std::shared_ptr<Buffer>> buffers = {
+        std::make_shared<arrow::MutableBuffer>(entry->pointer,
+                                               entry->data_size + entry->metadata_size)};
+    ARROW_CHECK_OK(external_store_pool_->Spawn([this, object_id, buffers]() {
+      PushFinishedTransfer({object_id, external_store_->Get({object_id}, buffers)},
+                           &finished_restores_);
+    }));
+  }
+}
+
+void PlasmaStore::PushFinishedTransfer(ExternalTransfer transfer,
+                                       std::deque<ExternalTransfer>* finished) {
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex_);
+    finished->push_back(std::move(transfer));
+  }
+  evictions_cv_.notify_one();
+  ssize_t nbytes = write(transfer_pipe_[1], "x", 1);
+  ARROW_UNUSED(nbytes);
+}
+
+void PlasmaStore::ProcessFinishedTransfers() {
+  std::deque<ExternalTransfer> evictions;
+  std::deque<ExternalTransfer> restores;
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex_);
+    evictions.swap(finished_evictions_);
+    restores.swap(finished_restores_);
+  }
+  for (const auto& transfer : evictions) {
+    FinishEviction(transfer);
+  }
+  for (const auto& transfer : restores) {
+    FinishRestore(transfer);
+  }
+}
+
+void PlasmaStore::WaitForFinishedEvictions() {
+  std::deque<ExternalTransfer> evictions;
+  {
+    std::unique_lock<std::mutex> lock(transfers_mutex_);
+    evictions_cv_.wait(lock, [this]() { return !finished_evictions_.empty(); });
+    evictions.swap(finished_evictions_);
+  }
+  for (const auto& transfer : evictions) {
+    FinishEviction(transfer);
+  }
+}
+
+void PlasmaStore::FinishEviction(const ExternalTransfer& transfer) {
+  const ObjectID& object_id = transfer.object_id;
+  evicting_objects_.erase(object_id);
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_SEALED);
+  if (!transfer.status.ok()) {
+    // Keep the object in memory, it can be evicted again after its next access.
+    ARROW_LOG(ERROR) << "Failed to evict object " << object_id.hex()
+                     << " to the external store: " << transfer.status.ToString();
+    return;
+  }
+  if (entry->ref_count > 0) {
+    // A client got the object while it was written, keep it in memory.
+    return;
+  }
+  // The object may have been added back to the eviction policy by an access.
+  eviction_policy_.RemoveObject(object_id);
+  if (deletion_cache_.erase(object_id) > 0) {
+    EraseFromObjectTable(object_id);
+    fb::ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    PushNotification(&notification);
+    return;
   }
+  PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+  entry->pointer = nullptr;
+  entry->state = ObjectState::PLASMA_EVICTED;
+}
+
+void PlasmaStore::FinishRestore(const ExternalTransfer& transfer) {
+  ObjectID object_id = transfer.object_id;
+  restoring_objects_.erase(object_id);
+  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_CREATED);
+  if (!transfer.status.ok()) {
+    ARROW_LOG(ERROR) << "Failed to restore object " << object_id.hex()
+                     << " from the external store: " << transfer.status.ToString();
+    PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+    entry->pointer = nullptr;
+    entry->state = ObjectState::PLASMA_EVICTED;
+    return;
+  }
+  entry->state = ObjectState::PLASMA_SEALED;
+  std::memset(&entry->digest[0], 0, kDigestSize);
+  entry->construct_duration = std::time(nullptr) - entry->create_time;
+  eviction_policy_.ObjectCreated(object_id, /*client=*/nullptr, false);
+  if (deletion_cache_.erase(object_id) > 0) {
+    DeleteObject(object_id);
+    return;
+  }
+  UpdateObjectGetRequests(object_id);
 }
 
 void PlasmaStore::ConnectClient(int listener_sock) {
@@ -818,8 +980,14 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
     // Decode the length, which is the first bytes of the message.
     int64_t size = *(reinterpret_cast<int64_t*>(notification.get()));
 
-    // Attempt to send a notification about this object ID.
-    ssize_t nbytes = send(client_fd, notification.get(), sizeof(int64_t) + size, 0);
+    // Attempt to send a notification about this object ID. All the shards
+    // write to the socket of a subscriber, don't interleave their messages.
+    ssize_t nbytes;
+    {
+      static std::mutex send_mutex;
+      std::lock_guard<std::mutex> lock(send_mutex);
+      nbytes = send(client_fd, notification.get(), sizeof(int64_t) + size, 0);
+    }
     if (nbytes >= 0) {
       ARROW_CHECK(nbytes == static_cast<ssize_t>(sizeof(int64_t)) + size);
     } else if (nbytes == -1 &&
@@ -1110,11 +1278,113 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       eviction_policy_.RefreshObjects(object_ids);
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
+    case fb::MessageType::PlasmaCreateBatchRequest: {
+      bool evict_if_full;
+      std::vector<ObjectID> object_ids;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      RETURN_NOT_OK(ReadCreateBatchRequest(input, input_size, &object_ids,
+                                           &evict_if_full, &data_sizes, &metadata_sizes));
+      // CreateBatch currently only supports device_num = 0, which corresponds
+      // to the host.
+      int device_num = 0;
+      std::vector<PlasmaObject> objects(object_ids.size());
+      size_t i = 0;
+      PlasmaError error_code = PlasmaError::OK;
+      for (i = 0; i < object_ids.size(); i++) {
+        error_code = CreateObject(object_ids[i], evict_if_full, data_sizes[i],
+                                  metadata_sizes[i], device_num, client, &objects[i]);
+        if (error_code != PlasmaError::OK) {
+          break;
+        }
+      }
+
+      // The batch is created entirely or not at all: if error, abort the
+      // previous i objects immediately.
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      if (error_code == PlasmaError::OK) {
+        std::unordered_set<int> fds_to_send;
+        for (const auto& created : objects) {
+          if (fds_to_send.insert(created.store_fd).second) {
+            store_fds.push_back(created.store_fd);
+            mmap_sizes.push_back(GetMmapSize(created.store_fd));
+          }
+        }
+      } else {
+        for (size_t j = 0; j < i; j++) {
+          AbortObject(object_ids[j], client);
+        }
+        object_ids.clear();
+        objects.clear();
+      }
+
+      HANDLE_SIGPIPE(SendCreateBatchReply(client->fd, error_code, object_ids, objects,
+                                          store_fds, mmap_sizes),
+                     client->fd);
+      // Only send the file descriptors that haven't been sent, as in ReturnFromGet.
+      for (int store_fd : store_fds) {
+        if (client->used_fds.find(store_fd) == client->used_fds.end()) {
+          WarnIfSigpipe(send_fd(client->fd, store_fd), client->fd);
+          client->used_fds.insert(store_fd);
+        }
+      }
+    } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      std::vector<ObjectID> ids_to_seal;
+      std::vector<std::string> digests_to_seal;
+      std::vector<PlasmaError> error_codes;
+      error_codes.reserve(object_ids.size());
+      for (size_t i = 0; i < object_ids.size(); i++) {
+        auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+        if (entry == nullptr) {
+          error_codes.push_back(PlasmaError::ObjectNotFound);
+        } else if (entry->state != ObjectState::PLASMA_CREATED) {
+          error_codes.push_back(PlasmaError::ObjectExists);
+        } else {
+          error_codes.push_back(PlasmaError::OK);
+          ids_to_seal.push_back(object_ids[i]);
+          digests_to_seal.push_back(digests[i]);
+        }
+      }
+      if (!ids_to_seal.empty()) {
+        SealObjects(ids_to_seal, digests_to_seal);
+      }
+      HANDLE_SIGPIPE(SendSealBatchReply(client->fd, object_ids, error_codes),
+                     client->fd);
+    } break;
+    case fb::MessageType::PlasmaReleaseBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseBatchRequest(input, input_size, &object_ids));
+      for (const auto& id : object_ids) {
+        ReleaseObject(id, client);
+      }
+    } break;
+    case fb::MessageType::PlasmaContainsBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadContainsBatchRequest(input, input_size, &object_ids));
+      std::vector<bool> has_object;
+      has_object.reserve(object_ids.size());
+      for (const auto& id : object_ids) {
+        has_object.push_back(ContainsObject(id) == ObjectStatus::OBJECT_FOUND);
+      }
+      HANDLE_SIGPIPE(SendContainsBatchReply(client->fd, object_ids, has_object),
+                     client->fd);
+    } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      PrefetchObjects(object_ids);
+    } break;
     case fb::MessageType::PlasmaSubscribeRequest:
       SubscribeToUpdates(client);
       break;
     case fb::MessageType::PlasmaConnectRequest: {
-      HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit()),
+      HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit(),
+                                      num_shards_),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaDisconnectClient:
@@ -1145,15 +1415,20 @@ Status PlasmaStore::ProcessMessage(Client* client) {
 
 class PlasmaStoreRunner {
  public:
-  PlasmaStoreRunner() {}
+  PlasmaStoreRunner() : stop_pipe_{-1, -1} {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
-    loop_.reset(new EventLoop);
-    store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
-    plasma_config = store_->GetPlasmaStoreInfo();
+             std::shared_ptr<ExternalStore> external_store, int num_shards) {
+    // Stop() is called from a signal handler. It wakes up the event loops of
+    // all the shards by making this pipe readable.
+    ARROW_CHECK(pipe(stop_pipe_) == 0);
+    // Create one event loop and one store per shard.
+    for (int i = 0; i < num_shards; ++i) {
+      loops_.emplace_back(new EventLoop);
+      stores_.emplace_back(new PlasmaStore(loops_[i].get(), directory, hugepages_enabled,
+                                           socket_name, external_store, num_shards));
+    }
+    plasma_config = stores_[0]->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
     // large amount of space up front. According to the documentation,
@@ -1167,27 +1442,59 @@ class PlasmaStoreRunner {
     plasma::PlasmaAllocator::Free(
         pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
 
-    int socket = BindIpcSock(socket_name, true);
-    // TODO(pcm): Check return value.
-    ARROW_CHECK(socket >= 0);
-
-    loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
-      this->store_->ConnectClient(socket);
-    });
-    loop_->Start();
+    // Bind all the sockets before serving any client, clients connect to the
+    // other shards once shard 0 told them how many there are.
+    for (int i = 0; i < num_shards; ++i) {
+      std::string shard_socket_name = socket_name;
+      if (i > 0) {
+        shard_socket_name += "." + std::to_string(i);
+      }
+      int socket = BindIpcSock(shard_socket_name, true);
+      // TODO(pcm): Check return value.
+      ARROW_CHECK(socket >= 0);
+
+      EventLoop* loop = loops_[i].get();
+      PlasmaStore* store = stores_[i].get();
+      loop->AddFileEvent(socket, kEventLoopRead,
+                         [store, socket](int events) { store->ConnectClient(socket); });
+      loop->AddFileEvent(stop_pipe_[0], kEventLoopRead,
+                         [loop](int events) { loop->Stop(); });
+    }
+    // Shard 0 runs on the calling thread.
+    for (int i = 1; i < num_shards; ++i) {
+      EventLoop* loop = loops_[i].get();
+      threads_.emplace_back([loop]() { loop->Start(); });
+    }
+    loops_[0]->Start();
   }
 
-  void Stop() { loop_->Stop(); }
+  void Stop() {
+    if (stop_pipe_[1] >= 0) {
+      ssize_t nbytes = write(stop_pipe_[1], "x", 1);
+      ARROW_UNUSED(nbytes);
+    }
+  }
 
   void Shutdown() {
-    loop_->Shutdown();
-    loop_ = nullptr;
-    store_ = nullptr;
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
+    for (auto& loop : loops_) {
+      loop->Shutdown();
+    }
+    loops_.clear();
+    stores_.clear();
+    close(stop_pipe_[0]);
+    close(stop_pipe_[1]);
+    stop_pipe_[0] = stop_pipe_[1] = -1;
   }
 
  private:
-  std::unique_ptr<EventLoop> loop_;
-  std::unique_ptr<PlasmaStore> store_;
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+  std::vector<std::unique_ptr<PlasmaStore>> stores_;
+  std::vector<std::thread> threads_;
+  int stop_pipe_[2];
 };
 
 static std::unique_ptr<PlasmaStoreRunner> g_runner = nullptr;
@@ -1202,14 +1509,15 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_shards) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_shards);
 }
 
 // Function to use (instead of ARROW_LOG(FATAL)) for usage, etc. errors before
@@ -1237,6 +1545,18 @@ DEFINE_bool(h, false, "whether to enable hugepage support");
 DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
 DEFINE_string(m, "", "amount of memory in bytes to use for Plasma store, required");
+DEFINE_int32(n, 1,
+             "number of shards of the object table, each one served by its own "
+             "thread, optional");
+DEFINE_bool(p, false,
+            "whether to prefault the memory of the store at startup, so that "
+            "creating objects does not take page faults");
+DEFINE_bool(t, false,
+            "whether to advise the kernel to use transparent huge pages for the "
+            "memory of the store, ignored with -h");
+DEFINE_string(N, "",
+              "comma-separated NUMA nodes to bind the memory of the store to, "
+              "optional");
 
 int main(int argc, char* argv[]) {
   ArrowLog::StartArrowLog(argv[0], ArrowLogLevel::ARROW_INFO);
@@ -1288,6 +1608,25 @@ int main(int argc, char* argv[]) {
     plasma::ExitWithUsageError(
         "please specify the amount of memory (in bytes) to use with -m");
   }
+  if (FLAGS_n < 1) {
+    plasma::ExitWithUsageError("-n switch takes a number of shards of at least 1");
+  }
+  plasma::MmapOptions mmap_options;
+  mmap_options.prefault = FLAGS_p;
+  mmap_options.transparent_hugepages = FLAGS_t;
+  if (!FLAGS_N.empty()) {
+    std::istringstream nodes(FLAGS_N);
+    std::string node;
+    while (std::getline(nodes, node, ',')) {
+      char extra;
+      int numa_node;
+      if (sscanf(node.c_str(), "%d%c", &numa_node, &extra) != 1 || numa_node < 0) {
+        plasma::ExitWithUsageError(
+            "-N switch takes a comma-separated list of NUMA node numbers");
+      }
+      mmap_options.numa_nodes.push_back(numa_node);
+    }
+  }
   if (hugepages_enabled && plasma_directory.empty()) {
     plasma::ExitWithUsageError(
         "if you want to use hugepages, please specify path to huge pages "
@@ -1295,8 +1634,9 @@ int main(int argc, char* argv[]) {
   }
   ARROW_CHECK(!plasma_directory.empty());
   ARROW_LOG(INFO) << "Starting object store with directory " << plasma_directory
-                  << " and huge page support "
-                  << (hugepages_enabled ? "enabled" : "disabled");
+                  << ", huge page support "
+                  << (hugepages_enabled ? "enabled" : "disabled") << " and " << FLAGS_n
+                  << " shard(s)";
 
 #ifdef __linux__
   if (!hugepages_enabled) {
@@ -1325,6 +1665,7 @@ int main(int argc, char* argv[]) {
     plasma::SetMallocGranularity(1024 * 1024 * 1024);  // 1 GiB
   }
 #endif
+  plasma::SetMmapOptions(mmap_options);
 
   // Get external store
   std::shared_ptr<plasma::ExternalStore> external_store{nullptr};
@@ -1343,7 +1684,8 @@ int main(int argc, char* argv[]) {
   }
 
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      FLAGS_n);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -33,6 +35,9 @@
 
 namespace arrow {
 class Status;
+namespace internal {
+class ThreadPool;
+}  // namespace internal
 }  // namespace arrow
 
 namespace plasma {
@@ -58,10 +63,13 @@ class PlasmaStore {
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
 
   // TODO: PascalCase PlasmaStore methods.
+  /// \param num_shards The number of shards of the store this instance is
+  ///        one of. Each shard evicts from its own share of the memory.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store, int num_shards);
 
+  /// Waits for the transfers to the external store that are in progress.
   ~PlasmaStore();
 
   /// Get a const pointer to the internal PlasmaStoreInfo object.
@@ -116,9 +124,19 @@ class PlasmaStore {
 
   /// Evict objects returned by the eviction policy.
   ///
+  /// With an external store, the objects are written to it in the background.
+  /// They stay readable, and their memory is only freed, once that is done.
+  ///
   /// \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Start restoring objects evicted to the external store, in the background.
+  /// Get requests for these objects are served once they are restored. Objects
+  /// that are not evicted are ignored.
+  ///
+  /// \param object_ids Object IDs of the objects to be restored.
+  void PrefetchObjects(const std::vector<ObjectID>& object_ids);
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -205,6 +223,30 @@ class PlasmaStore {
 
   uint8_t* AllocateMemory(size_t size, bool evict_if_full, int* fd, int64_t* map_size,
                           ptrdiff_t* offset, Client* client, bool is_create);
+
+  /// A write of an object to the external store, or a read of it back, that
+  /// finished on a background thread.
+  struct ExternalTransfer {
+    ObjectID object_id;
+    Status status;
+  };
+
+  /// Called on the background threads when a transfer finishes.
+  void PushFinishedTransfer(ExternalTransfer transfer,
+                            std::deque<ExternalTransfer>* finished);
+
+  /// Free the memory of the objects written to the external store, and serve the
+  /// objects read back from it.
+  void ProcessFinishedTransfers();
+
+  /// Block until a write to the external store finishes and free the memory of
+  /// the written objects. Restored objects are left to the event loop, so that
+  /// this does not serve get requests in the middle of processing another one.
+  void WaitForFinishedEvictions();
+
+  void FinishEviction(const ExternalTransfer& transfer);
+
+  void FinishRestore(const ExternalTransfer& transfer);
 #ifdef PLASMA_CUDA
   arrow::Result<std::shared_ptr<arrow::cuda::CudaContext>> GetCudaContext(int device_num);
   Status AllocateCudaMemory(int device_num, int64_t size, uint8_t** out_pointer,
@@ -215,6 +257,8 @@ class PlasmaStore {
 
   /// Event loop of the plasma store.
   EventLoop* loop_;
+  /// The number of shards of the store, reported to connecting clients.
+  int num_shards_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
@@ -240,6 +284,19 @@ class PlasmaStore {
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
   std::shared_ptr<ExternalStore> external_store_;
+
+  /// The threads writing objects to and reading them from the external store.
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_pool_;
+  /// Objects being written to the external store, or read back from it.
+  std::unordered_set<ObjectID> evicting_objects_;
+  std::unordered_set<ObjectID> restoring_objects_;
+  /// Transfers finished by the background threads, not processed yet. The
+  /// threads write a byte to transfer_pipe_ to wake up the event loop.
+  std::mutex transfers_mutex_;
+  std::condition_variable evictions_cv_;
+  std::deque<ExternalTransfer> finished_evictions_;
+  std::deque<ExternalTransfer> finished_restores_;
+  int transfer_pipe_[2];
 };
 
 }  // namespace plasma
@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <thread>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
@@ -51,6 +52,8 @@ void AssertObjectBufferEqual(const ObjectBuffer& object_buffer,
 
 class TestPlasmaStore : public ::testing::Test {
  public:
+  explicit TestPlasmaStore(int num_shards = 1) : num_shards_(num_shards) {}
+
   // TODO(pcm): At the moment, stdout of the test gets mixed up with
   // stdout of the object store. Consider changing that.
 
@@ -61,7 +64,8 @@ class TestPlasmaStore : public ::testing::Test {
     std::string plasma_directory =
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
-        plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
+        plasma_directory + "/plasma-store-server -m 10000000 -n " +
+        std::to_string(num_shards_) + " -s " + store_socket_name_ +
         " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
@@ -101,12 +105,18 @@ class TestPlasmaStore : public ::testing::Test {
   }
 
  protected:
+  int num_shards_;
   PlasmaClient client_;
   PlasmaClient client2_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
 };
 
+class TestPlasmaStoreSharded : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreSharded() : TestPlasmaStore(3) {}
+};
+
 TEST_F(TestPlasmaStore, NewSubscriberTest) {
   PlasmaClient local_client, local_client2;
 
@@ -699,6 +709,66 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, CreateSealBatchTest) {
+  std::vector<ObjectID> object_ids = {random_object_id(), random_object_id()};
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(client_.CreateBatch(object_ids, {5, 3}, {"1", "22"}, &data));
+  ASSERT_EQ(data.size(), 2);
+  memcpy(data[0]->mutable_data(), "hello", 5);
+  memcpy(data[1]->mutable_data(), "foo", 3);
+
+  std::vector<bool> has_object;
+  ARROW_CHECK_OK(client2_.ContainsBatch(object_ids, &has_object));
+  ASSERT_EQ(has_object, std::vector<bool>({false, false}));
+
+  ARROW_CHECK_OK(client_.SealBatch(object_ids));
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(client_.SealBatch(object_ids)));
+  // Release the ref count of CreateBatch.
+  ARROW_CHECK_OK(client_.ReleaseBatch(object_ids));
+  EXPECT_FALSE(client_.IsInUse(object_ids[0]));
+  EXPECT_FALSE(client_.IsInUse(object_ids[1]));
+
+  ARROW_CHECK_OK(client2_.ContainsBatch(
+      {object_ids[0], random_object_id(), object_ids[1]}, &has_object));
+  ASSERT_EQ(has_object, std::vector<bool>({true, false, true}));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {'1'}, {'h', 'e', 'l', 'l', 'o'});
+  AssertObjectBufferEqual(object_buffers[1], {'2', '2'}, {'f', 'o', 'o'});
+
+  // The batch is created entirely or not at all.
+  ObjectID new_id = random_object_id();
+  ASSERT_TRUE(IsPlasmaObjectExists(
+      client_.CreateBatch({new_id, object_ids[0]}, {1, 1}, {"", ""}, &data)));
+  ARROW_CHECK_OK(client2_.ContainsBatch({new_id}, &has_object));
+  ASSERT_FALSE(has_object[0]);
+}
+
+TEST_F(TestPlasmaStore, ReleaseBatchSizeTest) {
+  ASSERT_RAISES(Invalid, client_.SetReleaseBatchSize(0));
+  ARROW_CHECK_OK(client_.SetReleaseBatchSize(3));
+
+  std::vector<ObjectID> object_ids;
+  std::vector<uint8_t> data = {1, 2, 3};
+  for (int i = 0; i < 3; i++) {
+    object_ids.push_back(random_object_id());
+    CreateObject(client_, object_ids.back(), {42}, data);
+  }
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+  // The releases are held back by the client, the objects can't be evicted.
+  object_buffers.resize(1);
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client2_.Evict(1 << 30, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, 0);
+  // The third release reaches the threshold and flushes the batch.
+  object_buffers.clear();
+  ARROW_CHECK_OK(client2_.Evict(1 << 30, num_bytes_evicted));
+  ASSERT_GT(num_bytes_evicted, 0);
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -864,6 +934,65 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+TEST_F(TestPlasmaStoreSharded, ObjectsAcrossShardsTest) {
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 30; i++) {
+    object_ids.push_back(random_object_id());
+    CreateObject(client_, object_ids.back(), {static_cast<uint8_t>(i)},
+                 {static_cast<uint8_t>(i), 42});
+  }
+
+  // A single Get is answered by all the shards.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    AssertObjectBufferEqual(object_buffers[i], {static_cast<uint8_t>(i)},
+                            {static_cast<uint8_t>(i), 42});
+  }
+  object_buffers.clear();
+
+  ObjectTable objects;
+  ARROW_CHECK_OK(client2_.List(&objects));
+  ASSERT_EQ(objects.size(), object_ids.size());
+
+  // Batches are split by shard and the results put back in order.
+  std::vector<ObjectID> batch_ids = {random_object_id(), random_object_id(),
+                                     random_object_id(), random_object_id()};
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(
+      client_.CreateBatch(batch_ids, {1, 2, 3, 4}, {"a", "b", "c", "d"}, &data));
+  ARROW_CHECK_OK(client_.SealBatch(batch_ids));
+  ARROW_CHECK_OK(client_.ReleaseBatch(batch_ids));
+  std::vector<bool> has_object;
+  ARROW_CHECK_OK(client2_.ContainsBatch(
+      {batch_ids[0], random_object_id(), object_ids[0], batch_ids[3]}, &has_object));
+  ASSERT_EQ(has_object, std::vector<bool>({true, false, true, true}));
+
+  // A new subscriber is notified about the objects of every shard.
+  int fd = -1;
+  ARROW_CHECK_OK(client2_.Subscribe(&fd));
+  ASSERT_GT(fd, 0);
+  std::unordered_set<ObjectID> notified_ids;
+  for (size_t i = 0; i < object_ids.size() + batch_ids.size(); i++) {
+    ObjectID object_id;
+    int64_t data_size, metadata_size;
+    ARROW_CHECK_OK(client2_.GetNotification(fd, &object_id, &data_size, &metadata_size));
+    notified_ids.insert(object_id);
+  }
+  ASSERT_EQ(notified_ids.size(), object_ids.size() + batch_ids.size());
+
+  ARROW_CHECK_OK(client_.Delete(object_ids));
+  objects.clear();
+  ARROW_CHECK_OK(client2_.List(&objects));
+  ASSERT_EQ(objects.size(), batch_ids.size());
+
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client2_.Evict(1000, num_bytes_evicted));
+  // The batch objects are evicted from all the shards.
+  ASSERT_EQ(num_bytes_evicted, (1 + 1) + (2 + 1) + (3 + 1) + (4 + 1));
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
@@ -134,6 +134,37 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string metadata = "meta";
+  for (int i = 0; i < 20; i++) {
+    ObjectID object_id = random_object_id();
+    object_ids.push_back(object_id);
+    std::string data(100 * 1024, static_cast<char>('a' + i));
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_id, data, metadata));
+  }
+
+  // The first objects were evicted to make room for the last ones. Restore
+  // them in the background, then get them.
+  std::vector<ObjectID> prefetched(object_ids.begin(), object_ids.begin() + 4);
+  ASSERT_OK(client_.Prefetch(prefetched));
+  std::vector<ObjectBuffer> object_buffers;
+  ASSERT_OK(client_.Get(prefetched, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), prefetched.size());
+  for (int i = 0; i < 4; i++) {
+    AssertObjectBufferEqual(object_buffers[i], metadata,
+                            std::string(100 * 1024, static_cast<char>('a' + i)));
+  }
+  bool has_object;
+  ASSERT_OK(client_.Contains(object_ids[4], &has_object));
+  ASSERT_TRUE(has_object);
+
+  // Prefetching objects that are in memory or unknown does nothing.
+  ASSERT_OK(client_.Prefetch({object_ids[0], random_object_id()}));
+  ASSERT_OK(client_.Get({object_ids[19]}, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], metadata, std::string(100 * 1024, 't'));
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
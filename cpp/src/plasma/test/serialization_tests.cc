@@ -330,4 +330,73 @@ TEST_F(TestPlasmaSerialization, DataReply) {
   ASSERT_EQ(metadata_size1, metadata_size2);
 }
 
+
+TEST_F(TestPlasmaSerialization, CreateBatchReply) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<PlasmaObject> objects1 = {random_plasma_object(), random_plasma_object()};
+  std::vector<int> store_fds1 = {objects1[0].store_fd, objects1[1].store_fd};
+  std::vector<int64_t> mmap_sizes1 = {1000000, 2000000};
+  ASSERT_OK(SendCreateBatchReply(fd, PlasmaError::OK, object_ids1, objects1, store_fds1,
+                                 mmap_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateBatchReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<PlasmaObject> objects2;
+  std::vector<int> store_fds2;
+  std::vector<int64_t> mmap_sizes2;
+  ASSERT_OK(ReadCreateBatchReply(data.data(), data.size(), &object_ids2, &objects2,
+                                 &store_fds2, &mmap_sizes2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(store_fds1, store_fds2);
+  ASSERT_EQ(mmap_sizes1, mmap_sizes2);
+  ASSERT_EQ(objects2.size(), 2);
+  for (size_t i = 0; i < objects1.size(); ++i) {
+    ASSERT_EQ(memcmp(&objects1[i], &objects2[i], sizeof(PlasmaObject)), 0);
+  }
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, SealBatchReply) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<PlasmaError> errors1 = {PlasmaError::OK, PlasmaError::ObjectNotFound};
+  ASSERT_OK(SendSealBatchReply(fd, object_ids1, errors1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSealBatchReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<PlasmaError> errors2;
+  ASSERT_OK(ReadSealBatchReply(data.data(), data.size(), &object_ids2, &errors2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_TRUE(errors1 == errors2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, ContainsBatchReply) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<bool> has_object1 = {false, true};
+  ASSERT_OK(SendContainsBatchReply(fd, object_ids1, has_object1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaContainsBatchReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<bool> has_object2;
+  ASSERT_OK(ReadContainsBatchReply(data.data(), data.size(), &object_ids2, &has_object2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(has_object1, has_object2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, PrefetchRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ASSERT_OK(SendPrefetchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaPrefetchRequest);
+  std::vector<ObjectID> object_ids2;
+  ASSERT_OK(ReadPrefetchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
 }  // namespace plasma
@@ -2791,6 +2791,22 @@ cdef class Scanner(_Weakrefable):
 
         return pyarrow_wrap_table(GetResultValue(result))
 
+    def to_reader(self):
+        """Consume this scanner as a RecordBatchReader.
+
+        Unlike to_batches(), the batches are read in C++, so the reader can
+        be consumed without holding the GIL, e.g. by returning it from
+        FlightServerBase.do_get.
+
+        Returns
+        -------
+        reader : RecordBatchReader
+        """
+        cdef RecordBatchReader reader
+        reader = RecordBatchReader.__new__(RecordBatchReader)
+        reader.reader = GetResultValue(self.scanner.ToRecordBatchReader())
+        return reader
+
 
 def _get_partition_keys(Expression partition_expression):
     """
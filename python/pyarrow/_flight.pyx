@@ -1440,9 +1440,6 @@ cdef class GeneratorStream(FlightDataStream):
     cdef:
         shared_ptr[CSchema] schema
         object generator
-        # A substream currently being consumed by the client, if
-        # present. Produced by the generator.
-        unique_ptr[CFlightDataStream] current_stream
         CIpcWriteOptions c_options
 
     def __init__(self, schema, generator, options=None):
@@ -1635,79 +1632,85 @@ cdef class ClientAuthSender(_Weakrefable):
         return result
 
 
-cdef CStatus _data_stream_next(void* self, CFlightPayload* payload) except *:
-    """Callback for implementing FlightDataStream in Python."""
+cdef CStatus _data_stream_next(
+    void* self,
+    int64_t max_payloads,
+    vector[CFlightPayload]* payloads,
+    unique_ptr[CFlightDataStream]* substream
+) except *:
+    """Callback for implementing FlightDataStream in Python.
+
+    Up to max_payloads RecordBatches are pulled from the generator while
+    holding the GIL once. A nested stream ends the pull: it is handed
+    over to be drained without the GIL.
+    """
     cdef:
         unique_ptr[CFlightDataStream] data_stream
+        CFlightPayload payload
 
     py_stream = <object> self
     if not isinstance(py_stream, GeneratorStream):
         raise RuntimeError("self object in callback is not GeneratorStream")
     stream = <GeneratorStream> py_stream
+    stream_schema = pyarrow_wrap_schema(stream.schema)
 
-    if stream.current_stream != nullptr:
-        check_flight_status(stream.current_stream.get().Next(payload))
-        # If the stream ended, see if there's another stream from the
-        # generator
-        if payload.ipc_message.metadata != nullptr:
+    while <int64_t> payloads.size() < max_payloads:
+        try:
+            result = next(stream.generator)
+        except StopIteration:
             return CStatus_OK()
-        stream.current_stream.reset(nullptr)
-
-    try:
-        result = next(stream.generator)
-    except StopIteration:
-        payload.ipc_message.metadata.reset(<CBuffer*> nullptr)
-        return CStatus_OK()
-    except FlightError as flight_error:
-        return (<FlightError> flight_error).to_status()
+        except FlightError as flight_error:
+            return (<FlightError> flight_error).to_status()
 
-    if isinstance(result, (list, tuple)):
-        result, metadata = result
-    else:
-        result, metadata = result, None
-
-    if isinstance(result, (Table, RecordBatchReader)):
-        if metadata:
-            raise ValueError("Can only return metadata alongside a "
-                             "RecordBatch.")
-        result = RecordBatchStream(result)
-
-    stream_schema = pyarrow_wrap_schema(stream.schema)
-    if isinstance(result, FlightDataStream):
-        if metadata:
-            raise ValueError("Can only return metadata alongside a "
-                             "RecordBatch.")
-        data_stream = unique_ptr[CFlightDataStream](
-            (<FlightDataStream> result).to_stream())
-        substream_schema = pyarrow_wrap_schema(data_stream.get().schema())
-        if substream_schema != stream_schema:
-            raise ValueError("Got a FlightDataStream whose schema does not "
-                             "match the declared schema of this "
-                             "GeneratorStream. "
-                             "Got: {}\nExpected: {}".format(substream_schema,
-                                                            stream_schema))
-        stream.current_stream.reset(
-            new CPyFlightDataStream(result, move(data_stream)))
-        return _data_stream_next(self, payload)
-    elif isinstance(result, RecordBatch):
-        batch = <RecordBatch> result
-        if batch.schema != stream_schema:
-            raise ValueError("Got a RecordBatch whose schema does not "
-                             "match the declared schema of this "
-                             "GeneratorStream. "
-                             "Got: {}\nExpected: {}".format(batch.schema,
-                                                            stream_schema))
-        check_flight_status(GetRecordBatchPayload(
-            deref(batch.batch),
-            stream.c_options,
-            &payload.ipc_message))
-        if metadata:
-            payload.app_metadata = pyarrow_unwrap_buffer(as_buffer(metadata))
-    else:
-        raise TypeError("GeneratorStream must be initialized with "
-                        "an iterator of FlightDataStream, Table, "
-                        "RecordBatch, or RecordBatchStreamReader objects, "
-                        "not {}.".format(type(result)))
+        if isinstance(result, (list, tuple)):
+            result, metadata = result
+        else:
+            result, metadata = result, None
+
+        if isinstance(result, (Table, RecordBatchReader)):
+            if metadata:
+                raise ValueError("Can only return metadata alongside a "
+                                 "RecordBatch.")
+            result = RecordBatchStream(result)
+
+        if isinstance(result, FlightDataStream):
+            if metadata:
+                raise ValueError("Can only return metadata alongside a "
+                                 "RecordBatch.")
+            data_stream = unique_ptr[CFlightDataStream](
+                (<FlightDataStream> result).to_stream())
+            substream_schema = pyarrow_wrap_schema(data_stream.get().schema())
+            if substream_schema != stream_schema:
+                raise ValueError("Got a FlightDataStream whose schema does "
+                                 "not match the declared schema of this "
+                                 "GeneratorStream. "
+                                 "Got: {}\nExpected: {}".format(
+                                     substream_schema, stream_schema))
+            substream[0].reset(
+                new CPyFlightDataStream(result, move(data_stream)))
+            return CStatus_OK()
+        elif isinstance(result, RecordBatch):
+            batch = <RecordBatch> result
+            if batch.schema != stream_schema:
+                raise ValueError("Got a RecordBatch whose schema does not "
+                                 "match the declared schema of this "
+                                 "GeneratorStream. "
+                                 "Got: {}\nExpected: {}".format(batch.schema,
+                                                                stream_schema))
+            payload = CFlightPayload()
+            check_flight_status(GetRecordBatchPayload(
+                deref(batch.batch),
+                stream.c_options,
+                &payload.ipc_message))
+            if metadata:
+                payload.app_metadata = pyarrow_unwrap_buffer(
+                    as_buffer(metadata))
+            payloads.push_back(payload)
+        else:
+            raise TypeError("GeneratorStream must be initialized with "
+                            "an iterator of FlightDataStream, Table, "
+                            "RecordBatch, or RecordBatchStreamReader "
+                            "objects, not {}.".format(type(result)))
     return CStatus_OK()
 
 
@@ -1805,9 +1808,12 @@ cdef CStatus _do_get(void* self, const CServerCallContext& context,
                                         py_ticket)
     except FlightError as flight_error:
         return (<FlightError> flight_error).to_status()
+    if isinstance(result, (Table, RecordBatchReader)):
+        # Streamed entirely in C++, without the GIL
+        result = RecordBatchStream(result)
     if not isinstance(result, FlightDataStream):
         raise TypeError("FlightServerBase.do_get must return "
-                        "a FlightDataStream")
+                        "a FlightDataStream, Table or RecordBatchReader")
     data_stream = unique_ptr[CFlightDataStream](
         (<FlightDataStream> result).to_stream())
     stream[0] = unique_ptr[CFlightDataStream](
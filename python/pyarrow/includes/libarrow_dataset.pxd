@@ -91,6 +91,7 @@ cdef extern from "arrow/dataset/api.h" namespace "arrow::dataset" nogil:
         CScanner(shared_ptr[CFragment], shared_ptr[CScanOptions])
         CResult[CScanTaskIterator] Scan()
         CResult[shared_ptr[CTable]] ToTable()
+        CResult[shared_ptr[CRecordBatchReader]] ToRecordBatchReader()
         CResult[CFragmentIterator] GetFragments()
         const shared_ptr[CScanOptions]& options()
 
@@ -408,7 +408,9 @@ ctypedef CStatus cb_do_action(object, const CServerCallContext&,
 ctypedef CStatus cb_list_actions(object, const CServerCallContext&,
                                  vector[CActionType]*)
 ctypedef CStatus cb_result_next(object, unique_ptr[CFlightResult]*)
-ctypedef CStatus cb_data_stream_next(object, CFlightPayload*)
+ctypedef CStatus cb_data_stream_next(object, int64_t,
+                                     vector[CFlightPayload]*,
+                                     unique_ptr[CFlightDataStream]*)
 ctypedef CStatus cb_server_authenticate(object, CServerAuthSender*,
                                         CServerAuthReader*)
 ctypedef CStatus cb_is_valid(object, const c_string&, c_string*)
@@ -372,6 +372,25 @@ def test_sequence_numpy_integer_inferred(seq, np_scalar_pa_type):
     assert arr.to_pylist() == expected
 
 
+@parametrize_with_iterable_types
+@pytest.mark.parametrize("pa_type", [pa.int64(), pa.uint8(), pa.float64()])
+def test_sequence_numbers_multiple_batches(seq, pa_type):
+    # Number sequences are converted in batches of 65536 values
+    n = 3 * 65536 + 17
+    expected = [None if i % 7 == 0 else i % 100 for i in range(n)]
+    arr = pa.array(seq(expected), type=pa_type)
+    assert len(arr) == n
+    assert arr.null_count == sum(1 for v in expected if v is None)
+    assert arr.to_pylist() == expected
+
+    arr = pa.array(np.array(expected, dtype=object), type=pa_type)
+    assert arr.to_pylist() == expected
+
+    nested = [expected[i:i + 1000] for i in range(0, n, 1000)]
+    arr = pa.array(seq(nested), type=pa.list_(pa_type))
+    assert arr.to_pylist() == nested
+
+
 @parametrize_with_iterable_types
 def test_sequence_custom_integers(seq):
     expected = [0, 42, 2**33 + 1, -2**63]
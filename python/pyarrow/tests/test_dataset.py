@@ -363,6 +363,17 @@ def test_scanner(dataset):
             assert batch.num_columns == 1
 
 
+def test_scanner_to_reader(dataset):
+    scanner = ds.Scanner.from_dataset(dataset, columns=['i64'])
+    expected = scanner.to_table()
+
+    reader = scanner.to_reader()
+    assert isinstance(reader, pa.ipc.RecordBatchReader)
+    assert reader.schema == expected.schema
+    del scanner
+    assert reader.read_all().equals(expected)
+
+
 def test_abstract_classes():
     classes = [
         ds.FileFormat,
@@ -303,6 +303,43 @@ class InvalidStreamFlightServer(FlightServerBase):
         return flight.GeneratorStream(self.schema, [table1, table2])
 
 
+class MixedStreamFlightServer(FlightServerBase):
+    """A Flight server returning tables, readers and generators."""
+
+    schema = pa.schema([('a', pa.int64())])
+
+    def do_get(self, context, ticket):
+        if ticket.ticket == b'table':
+            return self.make_table(0, 100)
+        elif ticket.ticket == b'reader':
+            return pa.ipc.RecordBatchReader.from_batches(
+                self.schema, self.make_table(0, 100).to_batches(10))
+        elif ticket.ticket == b'error':
+            return flight.GeneratorStream(self.schema, self.failing_stream())
+        return flight.GeneratorStream(self.schema, self.mixed_stream())
+
+    @classmethod
+    def make_table(cls, start, stop):
+        return pa.Table.from_arrays([pa.array(range(start, stop))],
+                                    schema=cls.schema)
+
+    @classmethod
+    def mixed_stream(cls):
+        # More batches than are pulled from the generator at once
+        for i in range(300):
+            batch = cls.make_table(i, i + 1).to_batches()[0]
+            yield batch, struct.pack('<i', i)
+        yield cls.make_table(300, 400)
+        for i in range(400, 410):
+            yield cls.make_table(i, i + 1).to_batches()[0]
+
+    @classmethod
+    def failing_stream(cls):
+        for i in range(3):
+            yield cls.make_table(i, i + 1).to_batches()[0]
+        raise flight.FlightServerError("stream failed")
+
+
 class SlowFlightServer(FlightServerBase):
     """A Flight server that delays its responses to test timeouts."""
 
@@ -1054,6 +1091,48 @@ def test_flight_generator_stream():
         assert result.equals(data)
 
 
+def test_flight_do_get_table_and_reader():
+    """Return a Table or RecordBatchReader directly from do_get."""
+    expected = MixedStreamFlightServer.make_table(0, 100)
+    with MixedStreamFlightServer() as server:
+        client = FlightClient(('localhost', server.port))
+        for ticket in (b'table', b'reader'):
+            result = client.do_get(flight.Ticket(ticket)).read_all()
+            assert result.equals(expected)
+
+
+def test_flight_mixed_generator_stream():
+    """Stream many batches with metadata, interleaved with a Table."""
+    with MixedStreamFlightServer() as server:
+        client = FlightClient(('localhost', server.port))
+        reader = client.do_get(flight.Ticket(b''))
+        values = []
+        while True:
+            try:
+                batch, buf = reader.read_chunk()
+            except StopIteration:
+                break
+            start = len(values)
+            values.extend(batch.column(0).to_pylist())
+            if start < 300:
+                assert struct.unpack('<i', buf.to_pybytes()) == (start,)
+            else:
+                assert buf is None
+        assert values == list(range(410))
+
+
+def test_flight_generator_stream_error():
+    """Batches yielded before an error are still received."""
+    with MixedStreamFlightServer() as server:
+        client = FlightClient(('localhost', server.port))
+        reader = client.do_get(flight.Ticket(b'error'))
+        for i in range(3):
+            batch, _ = reader.read_chunk()
+            assert batch.column(0).to_pylist() == [i]
+        with pytest.raises(flight.FlightServerError, match="stream failed"):
+            reader.read_chunk()
+
+
 def test_flight_invalid_generator_stream():
     """Try streaming data with mismatched schemas."""
     with InvalidStreamFlightServer() as server:
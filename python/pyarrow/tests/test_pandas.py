@@ -2491,6 +2491,21 @@ class TestZeroCopyConversion:
         result = pa.array(arr).to_pandas(zero_copy_only=True)
         npt.assert_array_equal(result, arr)
 
+    def test_zero_copy_contiguous_chunks(self):
+        # Slices of the same array can be viewed as a single ndarray
+        arr = pa.array(np.arange(10, dtype=np.int64))
+        chunked = pa.chunked_array([arr.slice(0, 3), arr.slice(3, 0),
+                                    arr.slice(3)])
+        result = chunked.to_pandas(zero_copy_only=True)
+        npt.assert_array_equal(result, np.arange(10))
+
+    def test_zero_copy_failure_on_non_contiguous_chunks(self):
+        arr = pa.array(np.arange(10, dtype=np.int64))
+        self.check_zero_copy_failure(
+            pa.chunked_array([arr.slice(0, 3), arr.slice(4)]))
+        self.check_zero_copy_failure(
+            pa.chunked_array([pa.array([0, 1]), pa.array([2, 3])]))
+
     def check_zero_copy_failure(self, arr):
         with pytest.raises(pa.ArrowInvalid):
             arr.to_pandas(zero_copy_only=True)
@@ -3434,6 +3449,21 @@ def test_to_pandas_split_blocks():
     _check_to_pandas_memory_unchanged(t, split_blocks=True)
 
 
+def test_to_pandas_split_blocks_contiguous_chunks():
+    batch = pa.record_batch([
+        pa.array(np.arange(1000, dtype=np.int64)),
+        pa.array(np.arange(1000, dtype=np.float64)),
+        pa.array(np.arange(1000, dtype='datetime64[ns]')),
+    ], ['f0', 'f1', 'f2'])
+    t = pa.Table.from_batches([batch.slice(0, 250), batch.slice(250)])
+
+    for use_threads in [False, True]:
+        _check_to_pandas_memory_unchanged(t, split_blocks=True,
+                                          use_threads=use_threads)
+        result = t.to_pandas(split_blocks=True, use_threads=use_threads)
+        tm.assert_frame_equal(result, batch.to_pandas())
+
+
 def _check_blocks_created(t, number):
     x = t.to_pandas(split_blocks=True)
     assert len(x._data.blocks) == number
@@ -0,0 +1,290 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "./arrow_types.h"
+
+#if defined(ARROW_R_WITH_ARROW) && defined(HAS_ALTREP)
+
+#include <arrow/array.h>
+#include <arrow/chunked_array.h>
+#include <arrow/util/checked_cast.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace arrow {
+namespace r {
+namespace altrep {
+
+// Arrow-backed R vectors
+//
+// The data1 slot of these ALTREP vectors holds an external pointer to the
+// ChunkedArray they wrap.  Elements are read from the Arrow buffers on demand,
+// and the whole vector is only converted ("materialized") when R needs a
+// contiguous or writeable data pointer that the Arrow buffers cannot provide.
+// The materialized vector is then kept in the data2 slot, and used from then on.
+
+namespace {
+
+using arrow::internal::checked_cast;
+
+using ChunkedArrayPointer = cpp11::external_pointer<std::shared_ptr<ChunkedArray>>;
+
+const std::shared_ptr<ChunkedArray>& GetChunkedArray(SEXP alt) {
+  return *ChunkedArrayPointer(R_altrep_data1(alt));
+}
+
+// Find the chunk holding element i, and make i relative to that chunk
+const Array* LocateElement(const ChunkedArray& chunked_array, R_xlen_t* i) {
+  for (const auto& chunk : chunked_array.chunks()) {
+    if (*i < chunk->length()) {
+      return chunk.get();
+    }
+    *i -= chunk->length();
+  }
+  return nullptr;
+}
+
+template <typename Impl>
+struct AltrepVectorBase {
+  static R_altrep_class_t class_t;
+
+  static SEXP Make(const std::shared_ptr<ChunkedArray>& chunked_array) {
+    ChunkedArrayPointer xp(new std::shared_ptr<ChunkedArray>(chunked_array));
+    return R_new_altrep(class_t, xp, R_NilValue);
+  }
+
+  static bool IsMaterialized(SEXP alt) { return !Rf_isNull(R_altrep_data2(alt)); }
+
+  static SEXP Materialize(SEXP alt) {
+    BEGIN_CPP11
+    if (!IsMaterialized(alt)) {
+      const auto& chunked_array = GetChunkedArray(alt);
+      SEXP data = PROTECT(ArrayVector__as_vector(
+          chunked_array->length(), chunked_array->type(), chunked_array->chunks(),
+          GetBoolOption("arrow.use_threads", true)));
+      R_set_altrep_data2(alt, data);
+      UNPROTECT(1);
+    }
+    return R_altrep_data2(alt);
+    END_CPP11
+  }
+
+  static R_xlen_t Length(SEXP alt) { return GetChunkedArray(alt)->length(); }
+
+  static Rboolean Inspect(SEXP alt, int pre, int deep, int pvec,
+                          void (*inspect_subtree)(SEXP, int, int, int)) {
+    const auto& chunked_array = GetChunkedArray(alt);
+    Rprintf("arrow::ChunkedArray<%s> (%d chunks%s)\n",
+            chunked_array->type()->ToString().c_str(), chunked_array->num_chunks(),
+            IsMaterialized(alt) ? ", materialized" : "");
+    return TRUE;
+  }
+
+  // The vector is immutable until it is materialized, so an unmaterialized
+  // duplicate can share the ChunkedArray
+  static SEXP Duplicate(SEXP alt, Rboolean deep) {
+    if (IsMaterialized(alt)) {
+      return Rf_duplicate(R_altrep_data2(alt));
+    }
+    return R_new_altrep(class_t, R_altrep_data1(alt), R_NilValue);
+  }
+
+  static void* Dataptr(SEXP alt, Rboolean writeable) {
+    if (!writeable) {
+      const void* data = Impl::Dataptr_or_null(alt);
+      if (data != nullptr) {
+        return const_cast<void*>(data);
+      }
+    }
+    return DATAPTR(Materialize(alt));
+  }
+
+  static void InitClass(R_altrep_class_t klass) {
+    class_t = klass;
+    R_set_altrep_Length_method(class_t, Length);
+    R_set_altrep_Inspect_method(class_t, Inspect);
+    R_set_altrep_Duplicate_method(class_t, Duplicate);
+    R_set_altvec_Dataptr_method(class_t, Dataptr);
+    R_set_altvec_Dataptr_or_null_method(class_t, Impl::Dataptr_or_null);
+  }
+};
+
+template <typename Impl>
+R_altrep_class_t AltrepVectorBase<Impl>::class_t;
+
+// double and int32 arrays have the memory layout of R vectors, which can use
+// the Arrow buffer directly as long as there is a single chunk without nulls
+template <int sexp_type>
+struct AltrepPrimitive : public AltrepVectorBase<AltrepPrimitive<sexp_type>> {
+  using Base = AltrepVectorBase<AltrepPrimitive<sexp_type>>;
+  using c_type = typename std::conditional<sexp_type == REALSXP, double, int>::type;
+
+  static c_type NA() { return sexp_type == REALSXP ? NA_REAL : NA_INTEGER; }
+
+  static const void* Dataptr_or_null(SEXP alt) {
+    if (Base::IsMaterialized(alt)) {
+      return DATAPTR_RO(R_altrep_data2(alt));
+    }
+    const auto& chunked_array = GetChunkedArray(alt);
+    if (chunked_array->num_chunks() == 1 && chunked_array->null_count() == 0) {
+      return chunked_array->chunk(0)->data()->template GetValues<c_type>(1);
+    }
+    return nullptr;
+  }
+
+  static c_type Elt(SEXP alt, R_xlen_t i) {
+    if (Base::IsMaterialized(alt)) {
+      return reinterpret_cast<const c_type*>(DATAPTR_RO(R_altrep_data2(alt)))[i];
+    }
+    const Array* chunk = LocateElement(*GetChunkedArray(alt), &i);
+    if (chunk->IsNull(i)) {
+      return NA();
+    }
+    return chunk->data()->template GetValues<c_type>(1)[i];
+  }
+
+  static R_xlen_t Get_region(SEXP alt, R_xlen_t i, R_xlen_t n, c_type* buf) {
+    const R_xlen_t length = Base::Length(alt);
+    n = std::min(n, length - i);
+    if (Base::IsMaterialized(alt)) {
+      auto data = reinterpret_cast<const c_type*>(DATAPTR_RO(R_altrep_data2(alt)));
+      std::copy(data + i, data + i + n, buf);
+      return n;
+    }
+
+    R_xlen_t copied = 0;
+    R_xlen_t offset = i;
+    for (const auto& chunk : GetChunkedArray(alt)->chunks()) {
+      if (copied == n) {
+        break;
+      }
+      if (offset >= chunk->length()) {
+        offset -= chunk->length();
+        continue;
+      }
+      const R_xlen_t chunk_n = std::min<R_xlen_t>(chunk->length() - offset, n - copied);
+      auto values = chunk->data()->template GetValues<c_type>(1) + offset;
+      std::copy(values, values + chunk_n, buf + copied);
+      if (chunk->null_count() > 0) {
+        for (R_xlen_t j = 0; j < chunk_n; j++) {
+          if (chunk->IsNull(offset + j)) {
+            buf[copied + j] = NA();
+          }
+        }
+      }
+      copied += chunk_n;
+      offset = 0;
+    }
+    return copied;
+  }
+};
+
+using AltrepReal = AltrepPrimitive<REALSXP>;
+using AltrepInteger = AltrepPrimitive<INTSXP>;
+
+// Strings have no R data pointer to share, the CHARSXP of an element is made
+// when it is first accessed
+struct AltrepString : public AltrepVectorBase<AltrepString> {
+  static const void* Dataptr_or_null(SEXP alt) {
+    if (IsMaterialized(alt)) {
+      return DATAPTR_RO(R_altrep_data2(alt));
+    }
+    return nullptr;
+  }
+
+  static SEXP Elt(SEXP alt, R_xlen_t i) {
+    if (IsMaterialized(alt)) {
+      return STRING_ELT(R_altrep_data2(alt), i);
+    }
+    const Array* chunk = LocateElement(*GetChunkedArray(alt), &i);
+    if (chunk->IsNull(i)) {
+      return NA_STRING;
+    }
+    auto view = checked_cast<const StringArray*>(chunk)->GetView(i);
+    return Rf_mkCharLenCE(view.data(), static_cast<int>(view.size()), CE_UTF8);
+  }
+
+  static void Set_elt(SEXP alt, R_xlen_t i, SEXP value) {
+    SET_STRING_ELT(Materialize(alt), i, value);
+  }
+};
+
+// Strings with embedded nuls go through the regular converter, which either
+// strips the nuls or raises an error as soon as the data frame is made
+bool HasEmbeddedNul(const ChunkedArray& chunked_array) {
+  for (const auto& chunk : chunked_array.chunks()) {
+    const auto& array = checked_cast<const StringArray&>(*chunk);
+    if (array.length() == 0 || array.value_data() == nullptr) {
+      continue;
+    }
+    const int32_t begin = array.value_offset(0);
+    const int32_t end = array.value_offset(array.length());
+    if (std::memchr(array.value_data()->data() + begin, '\0', end - begin) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+void Init_Altrep_classes(DllInfo* dll) {
+  R_altrep_class_t real_class = R_make_altreal_class("array_dbl_vector", "arrow", dll);
+  AltrepReal::InitClass(real_class);
+  R_set_altreal_Elt_method(real_class, AltrepReal::Elt);
+  R_set_altreal_Get_region_method(real_class, AltrepReal::Get_region);
+
+  R_altrep_class_t integer_class =
+      R_make_altinteger_class("array_int_vector", "arrow", dll);
+  AltrepInteger::InitClass(integer_class);
+  R_set_altinteger_Elt_method(integer_class, AltrepInteger::Elt);
+  R_set_altinteger_Get_region_method(integer_class, AltrepInteger::Get_region);
+
+  R_altrep_class_t string_class =
+      R_make_altstring_class("array_string_vector", "arrow", dll);
+  AltrepString::InitClass(string_class);
+  R_set_altstring_Elt_method(string_class, AltrepString::Elt);
+  R_set_altstring_Set_elt_method(string_class, AltrepString::Set_elt);
+}
+
+SEXP MakeAltrepVector(const std::shared_ptr<ChunkedArray>& chunked_array) {
+  switch (chunked_array->type()->id()) {
+    case Type::DOUBLE:
+      return AltrepReal::Make(chunked_array);
+
+    case Type::INT32:
+      return AltrepInteger::Make(chunked_array);
+
+    case Type::STRING:
+      if (HasEmbeddedNul(*chunked_array)) {
+        break;
+      }
+      return AltrepString::Make(chunked_array);
+
+    default:
+      break;
+  }
+  return R_NilValue;
+}
+
+}  // namespace altrep
+}  // namespace r
+}  // namespace arrow
+
+#endif
@@ -142,14 +142,32 @@ Status IngestSome(const std::shared_ptr<arrow::Array>& array, R_xlen_t n,
 
 // Allocate + Ingest
 SEXP ArrayVector__as_vector(R_xlen_t n, const std::shared_ptr<DataType>& type,
-                            const ArrayVector& arrays) {
+                            const ArrayVector& arrays, bool use_threads) {
   auto converter = Converter::Make(type, arrays);
   SEXP data = PROTECT(converter->Allocate(n));
-  StopIfNotOk(converter->IngestSerial(data));
+  if (use_threads && arrays.size() > 1 && converter->Parallel()) {
+    auto tg =
+        arrow::internal::TaskGroup::MakeThreaded(arrow::internal::GetCpuThreadPool());
+    converter->IngestParallel(data, tg, converter);
+    StopIfNotOk(tg->Finish());
+  } else {
+    StopIfNotOk(converter->IngestSerial(data));
+  }
   UNPROTECT(1);
   return data;
 }
 
+// An Arrow-backed ALTREP vector for the column, or R_NilValue when the column
+// has to be converted
+SEXP MaybeAltrepVector(const std::shared_ptr<ChunkedArray>& column, bool use_altrep) {
+#if defined(HAS_ALTREP)
+  if (use_altrep) {
+    return altrep::MakeAltrepVector(column);
+  }
+#endif
+  return R_NilValue;
+}
+
 template <typename Type>
 class Converter_Int : public Converter {
   using value_type = typename TypeTraits<Type>::ArrayType::value_type;
@@ -675,7 +693,7 @@ class Converter_Dictionary : public Converter {
     }
 
     SEXP vec = PROTECT(ArrayVector__as_vector(dictionary_->length(), dictionary_->type(),
-                                              {dictionary_}));
+                                              {dictionary_}, /*use_threads=*/false));
     SEXP strings_vec = PROTECT(Rf_coerceVector(vec, STRSXP));
     UNPROTECT(2);
     return strings_vec;
@@ -1216,11 +1234,17 @@ std::shared_ptr<Converter> Converter::Make(const std::shared_ptr<DataType>& type
 
 cpp11::writable::list to_dataframe_serial(
     int64_t nr, int64_t nc, const cpp11::writable::strings& names,
-    const std::vector<std::shared_ptr<Converter>>& converters) {
+    const std::vector<std::shared_ptr<ChunkedArray>>& columns) {
   cpp11::writable::list tbl(nc);
+  const bool use_altrep = GetBoolOption("arrow.use_altrep", true);
   for (int i = 0; i < nc; i++) {
-    SEXP column = tbl[i] = converters[i]->Allocate(nr);
-    StopIfNotOk(converters[i]->IngestSerial(column));
+    SEXP column = tbl[i] = MaybeAltrepVector(columns[i], use_altrep);
+    if (column != R_NilValue) {
+      continue;
+    }
+    auto converter = Converter::Make(columns[i]->type(), columns[i]->chunks());
+    column = tbl[i] = converter->Allocate(nr);
+    StopIfNotOk(converter->IngestSerial(column));
   }
   tbl.attr(R_NamesSymbol) = names;
   tbl.attr(R_ClassSymbol) = arrow::r::data::classes_tbl_df;
@@ -1230,18 +1254,27 @@ cpp11::writable::list to_dataframe_serial(
 
 cpp11::writable::list to_dataframe_parallel(
     int64_t nr, int64_t nc, const cpp11::writable::strings& names,
-    const std::vector<std::shared_ptr<Converter>>& converters) {
+    const std::vector<std::shared_ptr<ChunkedArray>>& columns) {
   cpp11::writable::list tbl(nc);
+  std::vector<std::shared_ptr<Converter>> converters(nc);
 
   // task group to ingest data in parallel
   auto tg = arrow::internal::TaskGroup::MakeThreaded(arrow::internal::GetCpuThreadPool());
 
   // allocate and start ingesting immediately the columns that
   // can be ingested in parallel, i.e. when ingestion no longer
-  // need to happen on the main thread
+  // need to happen on the main thread. Columns backed by ALTREP
+  // vectors are not ingested at all
+  const bool use_altrep = GetBoolOption("arrow.use_altrep", true);
   for (int i = 0; i < nc; i++) {
+    SEXP column = tbl[i] = MaybeAltrepVector(columns[i], use_altrep);
+    if (column != R_NilValue) {
+      continue;
+    }
+
     // allocate data for column i
-    SEXP column = tbl[i] = converters[i]->Allocate(nr);
+    converters[i] = Converter::Make(columns[i]->type(), columns[i]->chunks());
+    column = tbl[i] = converters[i]->Allocate(nr);
 
     // add a task to ingest data of that column if that can be done in parallel
     if (converters[i]->Parallel()) {
@@ -1253,7 +1286,7 @@ cpp11::writable::list to_dataframe_parallel(
 
   // ingest the columns that cannot be dealt with in parallel
   for (int i = 0; i < nc; i++) {
-    if (!converters[i]->Parallel()) {
+    if (converters[i] && !converters[i]->Parallel()) {
       status &= converters[i]->IngestSerial(tbl[i]);
     }
   }
@@ -1275,13 +1308,15 @@ cpp11::writable::list to_dataframe_parallel(
 
 // [[arrow::export]]
 SEXP Array__as_vector(const std::shared_ptr<arrow::Array>& array) {
-  return arrow::r::ArrayVector__as_vector(array->length(), array->type(), {array});
+  return arrow::r::ArrayVector__as_vector(array->length(), array->type(), {array},
+                                          /*use_threads=*/false);
 }
 
 // [[arrow::export]]
 SEXP ChunkedArray__as_vector(const std::shared_ptr<arrow::ChunkedArray>& chunked_array) {
+  const bool use_threads = arrow::r::GetBoolOption("arrow.use_threads", true);
   return arrow::r::ArrayVector__as_vector(chunked_array->length(), chunked_array->type(),
-                                          chunked_array->chunks());
+                                          chunked_array->chunks(), use_threads);
 }
 
 // [[arrow::export]]
@@ -1290,19 +1325,17 @@ cpp11::writable::list RecordBatch__to_dataframe(
   int64_t nc = batch->num_columns();
   int64_t nr = batch->num_rows();
   cpp11::writable::strings names(nc);
-  std::vector<arrow::ArrayVector> arrays(nc);
-  std::vector<std::shared_ptr<arrow::r::Converter>> converters(nc);
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns(nc);
 
   for (R_xlen_t i = 0; i < nc; i++) {
     names[i] = batch->column_name(i);
-    arrays[i] = {batch->column(i)};
-    converters[i] = arrow::r::Converter::Make(batch->column(i)->type(), arrays[i]);
+    columns[i] = std::make_shared<arrow::ChunkedArray>(batch->column(i));
   }
 
   if (use_threads) {
-    return arrow::r::to_dataframe_parallel(nr, nc, names, converters);
+    return arrow::r::to_dataframe_parallel(nr, nc, names, columns);
   } else {
-    return arrow::r::to_dataframe_serial(nr, nc, names, converters);
+    return arrow::r::to_dataframe_serial(nr, nc, names, columns);
   }
 }
 
@@ -1312,18 +1345,15 @@ cpp11::writable::list Table__to_dataframe(const std::shared_ptr<arrow::Table>& t
   int64_t nc = table->num_columns();
   int64_t nr = table->num_rows();
   cpp11::writable::strings names(nc);
-  std::vector<std::shared_ptr<arrow::r::Converter>> converters(nc);
 
   for (R_xlen_t i = 0; i < nc; i++) {
-    converters[i] =
-        arrow::r::Converter::Make(table->column(i)->type(), table->column(i)->chunks());
     names[i] = table->field(i)->name();
   }
 
   if (use_threads) {
-    return arrow::r::to_dataframe_parallel(nr, nc, names, converters);
+    return arrow::r::to_dataframe_parallel(nr, nc, names, table->columns());
   } else {
-    return arrow::r::to_dataframe_serial(nr, nc, names, converters);
+    return arrow::r::to_dataframe_serial(nr, nc, names, table->columns());
   }
 }
 
@@ -102,6 +102,12 @@ std::shared_ptr<arrow::Array> vec_to_arrow(SEXP x,
                                            const std::shared_ptr<arrow::DataType>& type,
                                            bool type_inferred);
 
+// Convert several R vectors, the conversions that do not need the R API run
+// in parallel on the CPU thread pool unless options(arrow.use_threads = FALSE)
+Status vecs_to_arrow(const std::vector<SEXP>& xs,
+                     const std::vector<std::shared_ptr<arrow::DataType>>& types,
+                     bool type_inferred, std::vector<std::shared_ptr<arrow::Array>>* out);
+
 // the integer64 sentinel
 constexpr int64_t NA_INT64 = std::numeric_limits<int64_t>::min();
 
@@ -154,6 +160,23 @@ arrow::Status InferSchemaFromDots(SEXP lst, SEXP schema_sxp, int num_fields,
 arrow::Status AddMetadataFromDots(SEXP lst, int num_fields,
                                   std::shared_ptr<arrow::Schema>& schema);
 
+SEXP ArrayVector__as_vector(R_xlen_t n, const std::shared_ptr<DataType>& type,
+                            const ArrayVector& arrays, bool use_threads);
+
+#if defined(HAS_ALTREP)
+
+namespace altrep {
+
+void Init_Altrep_classes(DllInfo* dll);
+
+// An ALTREP vector backed by the ChunkedArray, or R_NilValue if its type
+// is not supported
+SEXP MakeAltrepVector(const std::shared_ptr<ChunkedArray>& chunked_array);
+
+}  // namespace altrep
+
+#endif
+
 }  // namespace r
 }  // namespace arrow
 
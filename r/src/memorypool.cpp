@@ -20,6 +20,8 @@
 #include <arrow/memory_pool.h>
 #include <arrow/util/mutex.h>
 
+#include <thread>
+
 class GcMemoryPool : public arrow::MemoryPool {
  public:
   GcMemoryPool() : pool_(arrow::default_memory_pool()) {}
@@ -45,6 +47,10 @@ class GcMemoryPool : public arrow::MemoryPool {
   arrow::Status GcAndTryAgain(const Call& call) {
     if (call().ok()) {
       return arrow::Status::OK();
+    } else if (std::this_thread::get_id() != main_thread_id_) {
+      // The garbage collector can only run on the main R thread, allocations
+      // happening on the Arrow thread pools just fail.
+      return call();
     } else {
       auto lock = mutex_.Lock();
 
@@ -58,6 +64,8 @@ class GcMemoryPool : public arrow::MemoryPool {
 
   arrow::util::Mutex mutex_;
   arrow::MemoryPool* pool_;
+  // g_pool is constructed when the package is loaded, i.e. on the main R thread
+  std::thread::id main_thread_id_ = std::this_thread::get_id();
 };
 
 static GcMemoryPool g_pool;
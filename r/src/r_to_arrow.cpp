@@ -29,6 +29,9 @@
 #include <arrow/util/bitmap_writer.h>
 #include <arrow/util/checked_cast.h>
 #include <arrow/util/converter.h>
+#include <arrow/util/functional.h>
+#include <arrow/util/task_group.h>
+#include <arrow/util/thread_pool.h>
 
 namespace arrow {
 
@@ -176,6 +179,13 @@ struct RVectorVisitor {
   template <typename AppendNull, typename AppendValue>
   static Status Visit(SEXP x, int64_t size, AppendNull&& append_null,
                       AppendValue&& append_value) {
+    if (std::is_arithmetic<data_type>::value && !ALTREP(x)) {
+      // read the memory directly, which does not need the R API
+      // and so may happen off the main thread
+      auto p = reinterpret_cast<const data_type*>(DATAPTR_RO(x));
+      return VisitPointer(p, size, append_null, append_value);
+    }
+
     r_vector_type values(x);
     auto it = values.begin();
 
@@ -193,6 +203,23 @@ struct RVectorVisitor {
   }
 
   static T GetValue(data_type x) { return x; }
+
+ private:
+  template <typename AppendNull, typename AppendValue>
+  static Status VisitPointer(const data_type* p, int64_t size, AppendNull&& append_null,
+                             AppendValue&& append_value) {
+    for (int64_t i = 0; i < size; i++) {
+      auto value = GetValue(p[i]);
+
+      if (is_NA<T>(value)) {
+        RETURN_NOT_OK(append_null());
+      } else {
+        RETURN_NOT_OK(append_value(value));
+      }
+    }
+
+    return Status::OK();
+  }
 };
 
 template <>
@@ -202,6 +229,60 @@ int64_t RVectorVisitor<int64_t>::GetValue(double x) {
   return value;
 }
 
+// ---- conversion tasks
+//
+// The R API can only be used from the main thread. Tasks that need it are delayed
+// and run on the main thread in Finish(), while tasks that only read the memory
+// of R vectors run on the Arrow CPU thread pool in the meantime.
+class RTasks {
+ public:
+  using Task = internal::FnOnce<Status()>;
+
+  explicit RTasks(bool use_threads)
+      : use_threads_(use_threads),
+        parallel_tasks_(use_threads ? arrow::internal::TaskGroup::MakeThreaded(
+                                          arrow::internal::GetCpuThreadPool())
+                                    : nullptr) {}
+
+  void Append(bool parallel, Task&& task) {
+    if (parallel && use_threads_) {
+      parallel_tasks_->Append(std::move(task));
+    } else {
+      delayed_serial_tasks_.push_back(std::move(task));
+    }
+  }
+
+  Status Finish() {
+    Status status = Status::OK();
+
+    try {
+      for (auto& task : delayed_serial_tasks_) {
+        status &= std::move(task)();
+        if (!status.ok()) {
+          break;
+        }
+      }
+    } catch (...) {
+      // a task hit cpp11::stop(), let the parallel tasks finish before unwinding
+      if (parallel_tasks_ != nullptr) {
+        ARROW_UNUSED(parallel_tasks_->Finish());
+      }
+      throw;
+    }
+    delayed_serial_tasks_.clear();
+
+    if (parallel_tasks_ != nullptr) {
+      status &= parallel_tasks_->Finish();
+    }
+    return status;
+  }
+
+ private:
+  bool use_threads_;
+  std::shared_ptr<arrow::internal::TaskGroup> parallel_tasks_;
+  std::vector<Task> delayed_serial_tasks_;
+};
+
 class RConverter : public Converter<SEXP, RConversionOptions> {
  public:
   virtual Status Append(SEXP) { return Status::NotImplemented("Append"); }
@@ -210,6 +291,14 @@ class RConverter : public Converter<SEXP, RConversionOptions> {
     return Status::NotImplemented("ExtendMasked");
   }
 
+  // Add the task that will Extend() this converter with `values`.
+  //
+  // By default it runs on the main thread, converters that do not need
+  // the R API for some vectors can run those in parallel
+  virtual void DelayedExtend(SEXP values, int64_t size, RTasks& tasks) {
+    tasks.Append(false, [this, values, size] { return this->Extend(values, size); });
+  }
+
   virtual Status ExtendMasked(SEXP values, SEXP mask, int64_t size) {
     return Status::NotImplemented("ExtendMasked");
   }
@@ -318,7 +407,20 @@ class RPrimitiveConverter<
     : public PrimitiveConverter<T, RConverter> {
  public:
   Status Extend(SEXP x, int64_t size) override {
+    return ExtendImpl(x, size, GetVectorType(x));
+  }
+
+  void DelayedExtend(SEXP x, int64_t size, RTasks& tasks) override {
+    // the R vector is inspected here, on the main thread. After that,
+    // converting a vector that is not ALTREP only reads its memory
     auto rtype = GetVectorType(x);
+    bool parallel = !ALTREP(x) && (rtype == UINT8 || rtype == INT32 ||
+                                   rtype == FLOAT64 || rtype == INT64);
+    tasks.Append(parallel, [this, x, size, rtype] { return ExtendImpl(x, size, rtype); });
+  }
+
+ private:
+  Status ExtendImpl(SEXP x, int64_t size, RVectorType rtype) {
     switch (rtype) {
       case UINT8:
         return AppendRangeDispatch<unsigned char>(x, size);
@@ -336,7 +438,6 @@ class RPrimitiveConverter<
     return Status::Invalid("cannot convert");
   }
 
- private:
   template <typename r_value_type>
   Status AppendRangeLoopDifferentType(SEXP x, int64_t size) {
     RETURN_NOT_OK(this->Reserve(size));
@@ -929,67 +1030,83 @@ bool can_reuse_memory(SEXP x, const std::shared_ptr<arrow::DataType>& type) {
 
 // this is only used on some special cases when the arrow Array can just use the memory of
 // the R object, via an RBuffer, hence be zero copy
+//
+// The RBuffer is made on the main thread, while the scan for NA values and the
+// validity bitmap are left to a task that may run in parallel
 template <int RTYPE, typename RVector, typename Type>
-std::shared_ptr<Array> MakeSimpleArray(SEXP x) {
+void DelayedMakeSimpleArray(SEXP x, RTasks& tasks, std::shared_ptr<Array>* out) {
   using value_type = typename arrow::TypeTraits<Type>::ArrayType::value_type;
   RVector vec(x);
-  auto n = vec.size();
+  int64_t n = vec.size();
   auto p_vec_start = reinterpret_cast<const value_type*>(DATAPTR_RO(vec));
-  auto p_vec_end = p_vec_start + n;
-  std::vector<std::shared_ptr<Buffer>> buffers{nullptr,
-                                               std::make_shared<RBuffer<RVector>>(vec)};
-
-  int null_count = 0;
-
-  auto first_na = std::find_if(p_vec_start, p_vec_end, is_NA<value_type>);
-  if (first_na < p_vec_end) {
-    auto null_bitmap =
-        ValueOrStop(AllocateBuffer(BitUtil::BytesForBits(n), gc_memory_pool()));
-    internal::FirstTimeBitmapWriter bitmap_writer(null_bitmap->mutable_data(), 0, n);
-
-    // first loop to clear all the bits before the first NA
-    auto j = std::distance(p_vec_start, first_na);
-    int i = 0;
-    for (; i < j; i++, bitmap_writer.Next()) {
-      bitmap_writer.Set();
-    }
+  std::shared_ptr<Buffer> data_buffer = std::make_shared<RBuffer<RVector>>(vec);
 
-    auto p_vec = first_na;
-    // then finish
-    for (; i < n; i++, bitmap_writer.Next(), ++p_vec) {
-      if (is_NA<value_type>(*p_vec)) {
-        bitmap_writer.Clear();
-        null_count++;
-      } else {
+  auto task = [n, p_vec_start, data_buffer, out] {
+    auto p_vec_end = p_vec_start + n;
+    std::vector<std::shared_ptr<Buffer>> buffers{nullptr, data_buffer};
+
+    int64_t null_count = 0;
+
+    auto first_na = std::find_if(p_vec_start, p_vec_end, is_NA<value_type>);
+    if (first_na < p_vec_end) {
+      ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBuffer(BitUtil::BytesForBits(n),
+                                                             gc_memory_pool()));
+      internal::FirstTimeBitmapWriter bitmap_writer(null_bitmap->mutable_data(), 0, n);
+
+      // first loop to clear all the bits before the first NA
+      auto j = std::distance(p_vec_start, first_na);
+      int64_t i = 0;
+      for (; i < j; i++, bitmap_writer.Next()) {
         bitmap_writer.Set();
       }
-    }
 
-    bitmap_writer.Finish();
-    buffers[0] = std::move(null_bitmap);
-  }
+      auto p_vec = first_na;
+      // then finish
+      for (; i < n; i++, bitmap_writer.Next(), ++p_vec) {
+        if (is_NA<value_type>(*p_vec)) {
+          bitmap_writer.Clear();
+          null_count++;
+        } else {
+          bitmap_writer.Set();
+        }
+      }
+
+      bitmap_writer.Finish();
+      buffers[0] = std::move(null_bitmap);
+    }
 
-  auto data = ArrayData::Make(std::make_shared<Type>(), LENGTH(x), std::move(buffers),
-                              null_count, 0 /*offset*/);
+    auto data = ArrayData::Make(std::make_shared<Type>(), n, std::move(buffers),
+                                null_count, 0 /*offset*/);
 
-  // return the right Array class
-  return std::make_shared<typename TypeTraits<Type>::ArrayType>(data);
+    // return the right Array class
+    *out = std::make_shared<typename TypeTraits<Type>::ArrayType>(data);
+    return Status::OK();
+  };
+  tasks.Append(true, std::move(task));
 }
 
-std::shared_ptr<arrow::Array> vec_to_arrow__reuse_memory(SEXP x) {
+void DelayedVecToArrowReuseMemory(SEXP x, RTasks& tasks, std::shared_ptr<Array>* out) {
   auto type = TYPEOF(x);
 
   if (type == INTSXP) {
-    return MakeSimpleArray<INTSXP, cpp11::integers, Int32Type>(x);
+    DelayedMakeSimpleArray<INTSXP, cpp11::integers, Int32Type>(x, tasks, out);
   } else if (type == REALSXP && Rf_inherits(x, "integer64")) {
-    return MakeSimpleArray<REALSXP, cpp11::doubles, Int64Type>(x);
+    DelayedMakeSimpleArray<REALSXP, cpp11::doubles, Int64Type>(x, tasks, out);
   } else if (type == REALSXP) {
-    return MakeSimpleArray<REALSXP, cpp11::doubles, DoubleType>(x);
+    DelayedMakeSimpleArray<REALSXP, cpp11::doubles, DoubleType>(x, tasks, out);
   } else if (type == RAWSXP) {
-    return MakeSimpleArray<RAWSXP, cpp11::raws, UInt8Type>(x);
+    DelayedMakeSimpleArray<RAWSXP, cpp11::raws, UInt8Type>(x, tasks, out);
+  } else {
+    cpp11::stop("Unreachable: you might need to fix can_reuse_memory()");
   }
+}
 
-  cpp11::stop("Unreachable: you might need to fix can_reuse_memory()");
+std::shared_ptr<arrow::Array> vec_to_arrow__reuse_memory(SEXP x) {
+  RTasks tasks(/*use_threads=*/false);
+  std::shared_ptr<arrow::Array> out;
+  DelayedVecToArrowReuseMemory(x, tasks, &out);
+  StopIfNotOk(tasks.Finish());
+  return out;
 }
 
 std::shared_ptr<arrow::Array> vec_to_arrow(SEXP x,
@@ -1018,6 +1135,50 @@ std::shared_ptr<arrow::Array> vec_to_arrow(SEXP x,
   return ValueOrStop(converter->ToArray());
 }
 
+Status vecs_to_arrow(const std::vector<SEXP>& xs,
+                     const std::vector<std::shared_ptr<arrow::DataType>>& types,
+                     bool type_inferred,
+                     std::vector<std::shared_ptr<arrow::Array>>* out) {
+  const size_t n = xs.size();
+  out->resize(n);
+  std::vector<std::unique_ptr<RConverter>> converters(n);
+
+  // declared after the converters, so that it is destroyed first, which waits
+  // for the parallel tasks that use them
+  RTasks tasks(GetBoolOption("arrow.use_threads", true));
+
+  for (size_t j = 0; j < n; j++) {
+    SEXP x = xs[j];
+    if (Rf_inherits(x, "Array")) {
+      (*out)[j] = cpp11::as_cpp<std::shared_ptr<arrow::Array>>(x);
+      continue;
+    }
+
+    if (can_reuse_memory(x, types[j])) {
+      DelayedVecToArrowReuseMemory(x, tasks, &(*out)[j]);
+      continue;
+    }
+
+    RConversionOptions options;
+    options.strict = !type_inferred;
+    options.type = types[j];
+    options.size = vctrs::vec_size(x);
+
+    converters[j] = ValueOrStop(MakeConverter<RConverter, RConverterTrait>(
+        options.type, options, gc_memory_pool()));
+    converters[j]->DelayedExtend(x, options.size, tasks);
+  }
+
+  RETURN_NOT_OK(tasks.Finish());
+
+  for (size_t j = 0; j < n; j++) {
+    if (converters[j] != nullptr) {
+      ARROW_ASSIGN_OR_RAISE((*out)[j], converters[j]->ToArray());
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace r
 }  // namespace arrow
 
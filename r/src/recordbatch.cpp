@@ -261,18 +261,25 @@ std::shared_ptr<arrow::RecordBatch> RecordBatch__from_arrays__known_schema(
   }
 
   // convert lst to a vector of arrow::Array
-  std::vector<std::shared_ptr<arrow::Array>> arrays(num_fields);
+  std::vector<SEXP> vecs(num_fields);
 
-  auto fill_array = [&arrays, &schema](int j, SEXP x, std::string name) {
+  auto fill_array = [&vecs, &schema](int j, SEXP x, std::string name) {
     if (schema->field(j)->name() != name) {
       cpp11::stop("field at index %d has name '%s' != '%s'", j + 1,
                   schema->field(j)->name().c_str(), name.c_str());
     }
-    arrays[j] = arrow::r::vec_to_arrow(x, schema->field(j)->type(), false);
+    vecs[j] = x;
   };
 
   arrow::r::TraverseDots(lst, num_fields, fill_array);
 
+  std::vector<std::shared_ptr<arrow::DataType>> types(num_fields);
+  for (int j = 0; j < num_fields; j++) {
+    types[j] = schema->field(j)->type();
+  }
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  StopIfNotOk(arrow::r::vecs_to_arrow(vecs, types, false, &arrays));
+
   int64_t num_rows = 0;
   StopIfNotOk(arrow::r::check_consistent_array_size(arrays, &num_rows));
   return arrow::RecordBatch::Make(schema, num_rows, arrays);
@@ -284,11 +291,15 @@ namespace r {
 arrow::Status CollectRecordBatchArrays(
     SEXP lst, const std::shared_ptr<arrow::Schema>& schema, int num_fields, bool inferred,
     std::vector<std::shared_ptr<arrow::Array>>& arrays) {
-  auto extract_one_array = [&arrays, &schema, inferred](int j, SEXP x, cpp11::r_string) {
-    arrays[j] = arrow::r::vec_to_arrow(x, schema->field(j)->type(), inferred);
-  };
+  std::vector<SEXP> vecs(num_fields);
+  auto extract_one_array = [&vecs](int j, SEXP x, cpp11::r_string) { vecs[j] = x; };
   arrow::r::TraverseDots(lst, num_fields, extract_one_array);
-  return arrow::Status::OK();
+
+  std::vector<std::shared_ptr<arrow::DataType>> types(num_fields);
+  for (int j = 0; j < num_fields; j++) {
+    types[j] = schema->field(j)->type();
+  }
+  return arrow::r::vecs_to_arrow(vecs, types, inferred, &arrays);
 }
 
 }  // namespace r
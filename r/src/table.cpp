@@ -276,8 +276,12 @@ arrow::Status CollectTableColumns(
     cpp11::stop("incompatible. schema has %d fields, and %d columns are supplied",
                 schema->num_fields(), num_fields);
   }
-  auto extract_one_column = [&columns, &schema, inferred](int j, SEXP x,
-                                                          std::string name) {
+  // R vectors are collected first, and then converted together
+  std::vector<int> vec_indices;
+  std::vector<SEXP> vecs;
+  std::vector<std::shared_ptr<arrow::DataType>> vec_types;
+
+  auto extract_one_column = [&](int j, SEXP x, std::string name) {
     if (!inferred && schema->field(j)->name() != name) {
       cpp11::stop("field at index %d has name '%s' != '%s'", j + 1,
                   schema->field(j)->name().c_str(), name.c_str());
@@ -288,11 +292,18 @@ arrow::Status CollectTableColumns(
       columns[j] = std::make_shared<arrow::ChunkedArray>(
           cpp11::as_cpp<std::shared_ptr<arrow::Array>>(x));
     } else {
-      auto array = arrow::r::vec_to_arrow(x, schema->field(j)->type(), inferred);
-      columns[j] = std::make_shared<arrow::ChunkedArray>(array);
+      vec_indices.push_back(j);
+      vecs.push_back(x);
+      vec_types.push_back(schema->field(j)->type());
     }
   };
   arrow::r::TraverseDots(lst, num_fields, extract_one_column);
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  RETURN_NOT_OK(arrow::r::vecs_to_arrow(vecs, vec_types, inferred, &arrays));
+  for (size_t i = 0; i < vec_indices.size(); i++) {
+    columns[vec_indices[i]] = std::make_shared<arrow::ChunkedArray>(arrays[i]);
+  }
   return arrow::Status::OK();
 }
 